@@ -0,0 +1,2831 @@
+/**
+ * The block encoder of ASTC_Encode.hlsl, written so that it compiles both as hlsl and as c++.
+ * the cpu backend builds it through astc_hlsl_shim.h (see astc_encode_scalar.cpp), so the shader
+ * and the cpu encode every block with the same code and write the same bits.
+ *
+ * keep it in the common subset of the two languages:
+ *	out/inout parameters go through ASTC_OUT/ASTC_INOUT/ASTC_OUT_ARRAY,
+ *	float literals carry the f suffix, swizzles are .xyzw only,
+ *	and only the float4/uint4/float4x4 operations and intrinsics of the shim are used.
+ */
+
+// parameter qualifiers, astc_hlsl_shim.h maps them to references for the c++ build
+#ifndef ASTC_OUT
+#define ASTC_OUT(T) out T
+#define ASTC_INOUT(T) inout T
+#define ASTC_OUT_ARRAY out
+#endif
+
+// the footprint, any of the 14 2d ones of the spec from 4x4 to 12x12, or a cubic 3d one from 3x3x3 to 6x6x6
+#ifndef BLOCK_DIM_X
+#define BLOCK_DIM_X 4
+#endif
+
+#ifndef BLOCK_DIM_Y
+#define BLOCK_DIM_Y 4
+#endif
+
+#ifndef BLOCK_DIM_Z
+#define BLOCK_DIM_Z 1
+#endif
+
+#ifndef HAS_ALPHA
+#define HAS_ALPHA 0
+#endif
+
+// the texels are linear half float range values, encoded with the hdr cems 7/11/15
+#ifndef IS_HDR
+#define IS_HDR 0
+#endif
+
+#define BLOCK_SIZE ((BLOCK_DIM_X) * (BLOCK_DIM_Y) * (BLOCK_DIM_Z))
+
+#include "ASTC_Table.hlsl"
+
+// the partition table and the weight grids of the footprint
+#if BLOCK_DIM_X == 3 && BLOCK_DIM_Y == 3 && BLOCK_DIM_Z == 3
+#define PARTITION_2_TABLE partition_2_3x3x3
+#define PARTITION_2_COUNT PARTITION_2_COUNT_3X3X3
+#define PARTITION_2_WORDS PARTITION_2_WORDS_3X3X3
+#define WEIGHT_GRID_COUNT WEIGHT_GRID_COUNT_3X3X3
+#define MAX_GRID_WEIGHTS MAX_GRID_WEIGHTS_3X3X3
+#define WEIGHT_GRIDS weight_grids_3x3x3
+#define WEIGHT_GRIDS_Z weight_grids_z_3x3x3
+#define DECIMATION_IDX decimation_idx_3x3x3
+#define DECIMATION_WT decimation_wt_3x3x3
+#define INFILL_IDX infill_idx_3x3x3
+#define INFILL_WT infill_wt_3x3x3
+#define PSEUDO_INVERSE_IDX pseudo_inverse_idx_3x3x3
+#define PSEUDO_INVERSE_WT pseudo_inverse_wt_3x3x3
+#elif BLOCK_DIM_X == 4 && BLOCK_DIM_Y == 4 && BLOCK_DIM_Z == 4
+#define PARTITION_2_TABLE partition_2_4x4x4
+#define PARTITION_2_COUNT PARTITION_2_COUNT_4X4X4
+#define PARTITION_2_WORDS PARTITION_2_WORDS_4X4X4
+#define WEIGHT_GRID_COUNT WEIGHT_GRID_COUNT_4X4X4
+#define MAX_GRID_WEIGHTS MAX_GRID_WEIGHTS_4X4X4
+#define WEIGHT_GRIDS weight_grids_4x4x4
+#define WEIGHT_GRIDS_Z weight_grids_z_4x4x4
+#define DECIMATION_IDX decimation_idx_4x4x4
+#define DECIMATION_WT decimation_wt_4x4x4
+#define INFILL_IDX infill_idx_4x4x4
+#define INFILL_WT infill_wt_4x4x4
+#define PSEUDO_INVERSE_IDX pseudo_inverse_idx_4x4x4
+#define PSEUDO_INVERSE_WT pseudo_inverse_wt_4x4x4
+#elif BLOCK_DIM_X == 5 && BLOCK_DIM_Y == 5 && BLOCK_DIM_Z == 5
+#define PARTITION_2_TABLE partition_2_5x5x5
+#define PARTITION_2_COUNT PARTITION_2_COUNT_5X5X5
+#define PARTITION_2_WORDS PARTITION_2_WORDS_5X5X5
+#define WEIGHT_GRID_COUNT WEIGHT_GRID_COUNT_5X5X5
+#define MAX_GRID_WEIGHTS MAX_GRID_WEIGHTS_5X5X5
+#define WEIGHT_GRIDS weight_grids_5x5x5
+#define WEIGHT_GRIDS_Z weight_grids_z_5x5x5
+#define DECIMATION_IDX decimation_idx_5x5x5
+#define DECIMATION_WT decimation_wt_5x5x5
+#define INFILL_IDX infill_idx_5x5x5
+#define INFILL_WT infill_wt_5x5x5
+#define PSEUDO_INVERSE_IDX pseudo_inverse_idx_5x5x5
+#define PSEUDO_INVERSE_WT pseudo_inverse_wt_5x5x5
+#elif BLOCK_DIM_X == 6 && BLOCK_DIM_Y == 6 && BLOCK_DIM_Z == 6
+#define PARTITION_2_TABLE partition_2_6x6x6
+#define PARTITION_2_COUNT PARTITION_2_COUNT_6X6X6
+#define PARTITION_2_WORDS PARTITION_2_WORDS_6X6X6
+#define WEIGHT_GRID_COUNT WEIGHT_GRID_COUNT_6X6X6
+#define MAX_GRID_WEIGHTS MAX_GRID_WEIGHTS_6X6X6
+#define WEIGHT_GRIDS weight_grids_6x6x6
+#define WEIGHT_GRIDS_Z weight_grids_z_6x6x6
+#define DECIMATION_IDX decimation_idx_6x6x6
+#define DECIMATION_WT decimation_wt_6x6x6
+#define INFILL_IDX infill_idx_6x6x6
+#define INFILL_WT infill_wt_6x6x6
+#define PSEUDO_INVERSE_IDX pseudo_inverse_idx_6x6x6
+#define PSEUDO_INVERSE_WT pseudo_inverse_wt_6x6x6
+#elif BLOCK_DIM_Z != 1
+#error "BLOCK_DIM_X x BLOCK_DIM_Y x BLOCK_DIM_Z is not a cubic 3d astc footprint"
+#elif BLOCK_DIM_X == 4 && BLOCK_DIM_Y == 4
+#define PARTITION_2_TABLE partition_2_4x4
+#define PARTITION_2_COUNT PARTITION_2_COUNT_4X4
+#define PARTITION_2_WORDS PARTITION_2_WORDS_4X4
+#define WEIGHT_GRID_COUNT WEIGHT_GRID_COUNT_4X4
+#define MAX_GRID_WEIGHTS MAX_GRID_WEIGHTS_4X4
+#define WEIGHT_GRIDS weight_grids_4x4
+#define DECIMATION_IDX decimation_idx_4x4
+#define DECIMATION_WT decimation_wt_4x4
+#define INFILL_IDX infill_idx_4x4
+#define INFILL_WT infill_wt_4x4
+#define PSEUDO_INVERSE_IDX pseudo_inverse_idx_4x4
+#define PSEUDO_INVERSE_WT pseudo_inverse_wt_4x4
+#elif BLOCK_DIM_X == 5 && BLOCK_DIM_Y == 4
+#define PARTITION_2_TABLE partition_2_5x4
+#define PARTITION_2_COUNT PARTITION_2_COUNT_5X4
+#define PARTITION_2_WORDS PARTITION_2_WORDS_5X4
+#define WEIGHT_GRID_COUNT WEIGHT_GRID_COUNT_5X4
+#define MAX_GRID_WEIGHTS MAX_GRID_WEIGHTS_5X4
+#define WEIGHT_GRIDS weight_grids_5x4
+#define DECIMATION_IDX decimation_idx_5x4
+#define DECIMATION_WT decimation_wt_5x4
+#define INFILL_IDX infill_idx_5x4
+#define INFILL_WT infill_wt_5x4
+#define PSEUDO_INVERSE_IDX pseudo_inverse_idx_5x4
+#define PSEUDO_INVERSE_WT pseudo_inverse_wt_5x4
+#elif BLOCK_DIM_X == 5 && BLOCK_DIM_Y == 5
+#define PARTITION_2_TABLE partition_2_5x5
+#define PARTITION_2_COUNT PARTITION_2_COUNT_5X5
+#define PARTITION_2_WORDS PARTITION_2_WORDS_5X5
+#define WEIGHT_GRID_COUNT WEIGHT_GRID_COUNT_5X5
+#define MAX_GRID_WEIGHTS MAX_GRID_WEIGHTS_5X5
+#define WEIGHT_GRIDS weight_grids_5x5
+#define DECIMATION_IDX decimation_idx_5x5
+#define DECIMATION_WT decimation_wt_5x5
+#define INFILL_IDX infill_idx_5x5
+#define INFILL_WT infill_wt_5x5
+#define PSEUDO_INVERSE_IDX pseudo_inverse_idx_5x5
+#define PSEUDO_INVERSE_WT pseudo_inverse_wt_5x5
+#elif BLOCK_DIM_X == 6 && BLOCK_DIM_Y == 5
+#define PARTITION_2_TABLE partition_2_6x5
+#define PARTITION_2_COUNT PARTITION_2_COUNT_6X5
+#define PARTITION_2_WORDS PARTITION_2_WORDS_6X5
+#define WEIGHT_GRID_COUNT WEIGHT_GRID_COUNT_6X5
+#define MAX_GRID_WEIGHTS MAX_GRID_WEIGHTS_6X5
+#define WEIGHT_GRIDS weight_grids_6x5
+#define DECIMATION_IDX decimation_idx_6x5
+#define DECIMATION_WT decimation_wt_6x5
+#define INFILL_IDX infill_idx_6x5
+#define INFILL_WT infill_wt_6x5
+#define PSEUDO_INVERSE_IDX pseudo_inverse_idx_6x5
+#define PSEUDO_INVERSE_WT pseudo_inverse_wt_6x5
+#elif BLOCK_DIM_X == 6 && BLOCK_DIM_Y == 6
+#define PARTITION_2_TABLE partition_2_6x6
+#define PARTITION_2_COUNT PARTITION_2_COUNT_6X6
+#define PARTITION_2_WORDS PARTITION_2_WORDS_6X6
+#define WEIGHT_GRID_COUNT WEIGHT_GRID_COUNT_6X6
+#define MAX_GRID_WEIGHTS MAX_GRID_WEIGHTS_6X6
+#define WEIGHT_GRIDS weight_grids_6x6
+#define DECIMATION_IDX decimation_idx_6x6
+#define DECIMATION_WT decimation_wt_6x6
+#define INFILL_IDX infill_idx_6x6
+#define INFILL_WT infill_wt_6x6
+#define PSEUDO_INVERSE_IDX pseudo_inverse_idx_6x6
+#define PSEUDO_INVERSE_WT pseudo_inverse_wt_6x6
+#elif BLOCK_DIM_X == 8 && BLOCK_DIM_Y == 5
+#define PARTITION_2_TABLE partition_2_8x5
+#define PARTITION_2_COUNT PARTITION_2_COUNT_8X5
+#define PARTITION_2_WORDS PARTITION_2_WORDS_8X5
+#define WEIGHT_GRID_COUNT WEIGHT_GRID_COUNT_8X5
+#define MAX_GRID_WEIGHTS MAX_GRID_WEIGHTS_8X5
+#define WEIGHT_GRIDS weight_grids_8x5
+#define DECIMATION_IDX decimation_idx_8x5
+#define DECIMATION_WT decimation_wt_8x5
+#define INFILL_IDX infill_idx_8x5
+#define INFILL_WT infill_wt_8x5
+#define PSEUDO_INVERSE_IDX pseudo_inverse_idx_8x5
+#define PSEUDO_INVERSE_WT pseudo_inverse_wt_8x5
+#elif BLOCK_DIM_X == 8 && BLOCK_DIM_Y == 6
+#define PARTITION_2_TABLE partition_2_8x6
+#define PARTITION_2_COUNT PARTITION_2_COUNT_8X6
+#define PARTITION_2_WORDS PARTITION_2_WORDS_8X6
+#define WEIGHT_GRID_COUNT WEIGHT_GRID_COUNT_8X6
+#define MAX_GRID_WEIGHTS MAX_GRID_WEIGHTS_8X6
+#define WEIGHT_GRIDS weight_grids_8x6
+#define DECIMATION_IDX decimation_idx_8x6
+#define DECIMATION_WT decimation_wt_8x6
+#define INFILL_IDX infill_idx_8x6
+#define INFILL_WT infill_wt_8x6
+#define PSEUDO_INVERSE_IDX pseudo_inverse_idx_8x6
+#define PSEUDO_INVERSE_WT pseudo_inverse_wt_8x6
+#elif BLOCK_DIM_X == 8 && BLOCK_DIM_Y == 8
+#define PARTITION_2_TABLE partition_2_8x8
+#define PARTITION_2_COUNT PARTITION_2_COUNT_8X8
+#define PARTITION_2_WORDS PARTITION_2_WORDS_8X8
+#define WEIGHT_GRID_COUNT WEIGHT_GRID_COUNT_8X8
+#define MAX_GRID_WEIGHTS MAX_GRID_WEIGHTS_8X8
+#define WEIGHT_GRIDS weight_grids_8x8
+#define DECIMATION_IDX decimation_idx_8x8
+#define DECIMATION_WT decimation_wt_8x8
+#define INFILL_IDX infill_idx_8x8
+#define INFILL_WT infill_wt_8x8
+#define PSEUDO_INVERSE_IDX pseudo_inverse_idx_8x8
+#define PSEUDO_INVERSE_WT pseudo_inverse_wt_8x8
+#elif BLOCK_DIM_X == 10 && BLOCK_DIM_Y == 5
+#define PARTITION_2_TABLE partition_2_10x5
+#define PARTITION_2_COUNT PARTITION_2_COUNT_10X5
+#define PARTITION_2_WORDS PARTITION_2_WORDS_10X5
+#define WEIGHT_GRID_COUNT WEIGHT_GRID_COUNT_10X5
+#define MAX_GRID_WEIGHTS MAX_GRID_WEIGHTS_10X5
+#define WEIGHT_GRIDS weight_grids_10x5
+#define DECIMATION_IDX decimation_idx_10x5
+#define DECIMATION_WT decimation_wt_10x5
+#define INFILL_IDX infill_idx_10x5
+#define INFILL_WT infill_wt_10x5
+#define PSEUDO_INVERSE_IDX pseudo_inverse_idx_10x5
+#define PSEUDO_INVERSE_WT pseudo_inverse_wt_10x5
+#elif BLOCK_DIM_X == 10 && BLOCK_DIM_Y == 6
+#define PARTITION_2_TABLE partition_2_10x6
+#define PARTITION_2_COUNT PARTITION_2_COUNT_10X6
+#define PARTITION_2_WORDS PARTITION_2_WORDS_10X6
+#define WEIGHT_GRID_COUNT WEIGHT_GRID_COUNT_10X6
+#define MAX_GRID_WEIGHTS MAX_GRID_WEIGHTS_10X6
+#define WEIGHT_GRIDS weight_grids_10x6
+#define DECIMATION_IDX decimation_idx_10x6
+#define DECIMATION_WT decimation_wt_10x6
+#define INFILL_IDX infill_idx_10x6
+#define INFILL_WT infill_wt_10x6
+#define PSEUDO_INVERSE_IDX pseudo_inverse_idx_10x6
+#define PSEUDO_INVERSE_WT pseudo_inverse_wt_10x6
+#elif BLOCK_DIM_X == 10 && BLOCK_DIM_Y == 8
+#define PARTITION_2_TABLE partition_2_10x8
+#define PARTITION_2_COUNT PARTITION_2_COUNT_10X8
+#define PARTITION_2_WORDS PARTITION_2_WORDS_10X8
+#define WEIGHT_GRID_COUNT WEIGHT_GRID_COUNT_10X8
+#define MAX_GRID_WEIGHTS MAX_GRID_WEIGHTS_10X8
+#define WEIGHT_GRIDS weight_grids_10x8
+#define DECIMATION_IDX decimation_idx_10x8
+#define DECIMATION_WT decimation_wt_10x8
+#define INFILL_IDX infill_idx_10x8
+#define INFILL_WT infill_wt_10x8
+#define PSEUDO_INVERSE_IDX pseudo_inverse_idx_10x8
+#define PSEUDO_INVERSE_WT pseudo_inverse_wt_10x8
+#elif BLOCK_DIM_X == 10 && BLOCK_DIM_Y == 10
+#define PARTITION_2_TABLE partition_2_10x10
+#define PARTITION_2_COUNT PARTITION_2_COUNT_10X10
+#define PARTITION_2_WORDS PARTITION_2_WORDS_10X10
+#define WEIGHT_GRID_COUNT WEIGHT_GRID_COUNT_10X10
+#define MAX_GRID_WEIGHTS MAX_GRID_WEIGHTS_10X10
+#define WEIGHT_GRIDS weight_grids_10x10
+#define DECIMATION_IDX decimation_idx_10x10
+#define DECIMATION_WT decimation_wt_10x10
+#define INFILL_IDX infill_idx_10x10
+#define INFILL_WT infill_wt_10x10
+#define PSEUDO_INVERSE_IDX pseudo_inverse_idx_10x10
+#define PSEUDO_INVERSE_WT pseudo_inverse_wt_10x10
+#elif BLOCK_DIM_X == 12 && BLOCK_DIM_Y == 10
+#define PARTITION_2_TABLE partition_2_12x10
+#define PARTITION_2_COUNT PARTITION_2_COUNT_12X10
+#define PARTITION_2_WORDS PARTITION_2_WORDS_12X10
+#define WEIGHT_GRID_COUNT WEIGHT_GRID_COUNT_12X10
+#define MAX_GRID_WEIGHTS MAX_GRID_WEIGHTS_12X10
+#define WEIGHT_GRIDS weight_grids_12x10
+#define DECIMATION_IDX decimation_idx_12x10
+#define DECIMATION_WT decimation_wt_12x10
+#define INFILL_IDX infill_idx_12x10
+#define INFILL_WT infill_wt_12x10
+#define PSEUDO_INVERSE_IDX pseudo_inverse_idx_12x10
+#define PSEUDO_INVERSE_WT pseudo_inverse_wt_12x10
+#elif BLOCK_DIM_X == 12 && BLOCK_DIM_Y == 12
+#define PARTITION_2_TABLE partition_2_12x12
+#define PARTITION_2_COUNT PARTITION_2_COUNT_12X12
+#define PARTITION_2_WORDS PARTITION_2_WORDS_12X12
+#define WEIGHT_GRID_COUNT WEIGHT_GRID_COUNT_12X12
+#define MAX_GRID_WEIGHTS MAX_GRID_WEIGHTS_12X12
+#define WEIGHT_GRIDS weight_grids_12x12
+#define DECIMATION_IDX decimation_idx_12x12
+#define DECIMATION_WT decimation_wt_12x12
+#define INFILL_IDX infill_idx_12x12
+#define INFILL_WT infill_wt_12x12
+#define PSEUDO_INVERSE_IDX pseudo_inverse_idx_12x12
+#define PSEUDO_INVERSE_WT pseudo_inverse_wt_12x12
+#else
+#error "BLOCK_DIM_X x BLOCK_DIM_Y is not a 2d astc footprint"
+#endif
+
+#include "ASTC_IntegerSequenceEncoding.hlsl"
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// calc the dominant axis
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+void swap(ASTC_INOUT(float4) lhs, ASTC_INOUT(float4) rhs)
+{
+	float4 tmp = lhs;
+	lhs = rhs;
+	rhs = tmp;
+}
+
+float4 eigen_vector(float4x4 m)
+{
+	// a flat block has no principal axis, any one spans it
+	float trace = m[0][0] + m[1][1] + m[2][2] + m[3][3];
+	if (trace < SMALL_VALUE)
+	{
+		return float4(0.57735f, 0.57735f, 0.57735f, 0.0f);
+	}
+
+	// the eigen values of m / trace are at most 1, so its powers can't overflow
+	m /= trace;
+	float4x4 m2 = mul(m, m);
+	float4x4 m4 = mul(m2, m2);
+
+	// start from the largest column of m * m, unlike a fixed vector it can't miss an alpha only axis
+	float4 v = m2[0];
+	float largest = m2[0][0];
+	for (int c = 1; c < 4; ++c)
+	{
+		if (m2[c][c] > largest)
+		{
+			largest = m2[c][c];
+			v = m2[c];
+		}
+	}
+	v = normalize(v);
+
+	for (int i = 0; i < EIGEN_ITERATIONS; ++i)
+	{
+		float4 w = mul(m4, v);
+		float len = length(w);
+		if (len < SMALL_VALUE)
+		{
+			break;
+		}
+		w = w / len;
+		float cosine = dot(w, v);
+		v = w;
+		if (cosine > EIGEN_CONVERGED)
+		{
+			break;
+		}
+	}
+	return v;
+}
+
+void find_min_max(float4 texels[BLOCK_SIZE], float4 pt_mean, float4 vec_k, ASTC_OUT(float4) e0, ASTC_OUT(float4) e1)
+{
+	float a = 1e31f;
+	float b = -1e31f;
+	for (int i = 0; i < BLOCK_SIZE; ++i)
+	{
+		float4 texel = texels[i] - pt_mean;
+		float t = dot(texel, vec_k);
+		a = min(a, t);
+		b = max(b, t);
+	}
+
+	e0 = clamp(vec_k * a + pt_mean, 0.0f, 255.0f);
+	e1 = clamp(vec_k * b + pt_mean, 0.0f, 255.0f);
+
+	// if the direction-vector ends up pointing from light to dark, FLIP IT!
+	// this will make the first endpoint the darkest one.
+	float4 e0u = round(e0);
+	float4 e1u = round(e1);
+	if (e0u.x + e0u.y + e0u.z > e1u.x + e1u.y + e1u.z)
+	{
+		swap(e0, e1);
+	}
+
+#if !HAS_ALPHA
+	e0.w = 255.0f;
+	e1.w = 255.0f;
+#endif
+
+}
+
+float4x4 covariance_matrix(float4 texels[BLOCK_SIZE], float4 pt_mean)
+{
+	float4x4 cov = 0;
+	for (int k = 0; k < BLOCK_SIZE; ++k)
+	{
+		float4 texel = texels[k] - pt_mean;
+		for (int i = 0; i < 4; ++i)
+		{
+			for (int j = 0; j < 4; ++j)
+			{
+				cov[i][j] += texel[i] * texel[j];
+			}
+		}
+	}
+	cov /= BLOCK_SIZE - 1;
+	return cov;
+}
+
+void principal_component_analysis(float4 texels[BLOCK_SIZE], ASTC_OUT(float4) e0, ASTC_OUT(float4) e1)
+{
+	int i = 0;
+	float4 pt_mean = 0;
+	for (i = 0; i < BLOCK_SIZE; ++i)
+	{
+		pt_mean += texels[i];
+	}
+	pt_mean /= BLOCK_SIZE;
+
+	float4x4 cov = covariance_matrix(texels, pt_mean);
+
+	float4 vec_k = eigen_vector(cov);
+
+	find_min_max(texels, pt_mean, vec_k, e0, e1);
+
+}
+
+void max_accumulation_pixel_direction(float4 texels[BLOCK_SIZE], ASTC_OUT(float4) e0, ASTC_OUT(float4) e1)
+{
+	int i = 0;
+	float4 pt_mean = 0;
+	for (i = 0; i < BLOCK_SIZE; ++i)
+	{
+		pt_mean += texels[i];
+	}
+	pt_mean /= BLOCK_SIZE;
+
+	float4 sum_r = float4(0,0,0,0);
+	float4 sum_g = float4(0,0,0,0);
+	float4 sum_b = float4(0,0,0,0);
+	float4 sum_a = float4(0,0,0,0);
+	for (i = 0; i < BLOCK_SIZE; ++i)
+	{
+		float4 dt = texels[i] - pt_mean;
+		sum_r += (dt.x > 0) ? dt : 0;
+		sum_g += (dt.y > 0) ? dt : 0;
+		sum_b += (dt.z > 0) ? dt : 0;
+		sum_a += (dt.w > 0) ? dt : 0;
+	}
+
+	float dot_r = dot(sum_r, sum_r);
+	float dot_g = dot(sum_g, sum_g);
+	float dot_b = dot(sum_b, sum_b);
+
+	float maxdot = dot_r;
+	float4 vec_k = sum_r;
+
+	if (dot_g > maxdot)
+	{
+		vec_k = sum_g;
+		maxdot = dot_g;
+	}
+
+	if (dot_b > maxdot)
+	{
+		vec_k = sum_b;
+		maxdot = dot_b;
+	}
+
+#if HAS_ALPHA
+	float dot_a = dot(sum_a, sum_a);
+	if (dot_a > maxdot)
+	{
+		vec_k = sum_a;
+		maxdot = dot_a;
+	}
+#endif
+
+	// safe normalize
+	float lenk = length(vec_k);
+	vec_k = (lenk < SMALL_VALUE) ? vec_k : normalize(vec_k);
+
+	find_min_max(texels, pt_mean, vec_k, e0, e1);
+
+}
+
+// the range of the texels along the luminance axis
+void luminance_axis(float4 texels[BLOCK_SIZE], ASTC_OUT(float4) e0, ASTC_OUT(float4) e1)
+{
+	float4 pt_mean = 0;
+	for (int i = 0; i < BLOCK_SIZE; ++i)
+	{
+		pt_mean += texels[i];
+	}
+	pt_mean /= BLOCK_SIZE;
+
+	float4 vec_k = float4(0.57735f, 0.57735f, 0.57735f, 0.0f);
+	find_min_max(texels, pt_mean, vec_k, e0, e1);
+}
+
+// the corners of the bounding box of the texels, the darkest one first
+void bounding_box_axis(float4 texels[BLOCK_SIZE], ASTC_OUT(float4) e0, ASTC_OUT(float4) e1)
+{
+	e0 = texels[0];
+	e1 = texels[0];
+	for (int i = 1; i < BLOCK_SIZE; ++i)
+	{
+		float4 texel = texels[i];
+		e0 = float4(min(e0.x, texel.x), min(e0.y, texel.y), min(e0.z, texel.z), min(e0.w, texel.w));
+		e1 = float4(max(e1.x, texel.x), max(e1.y, texel.y), max(e1.z, texel.z), max(e1.w, texel.w));
+	}
+#if !HAS_ALPHA
+	e0.w = 255.0f;
+	e1.w = 255.0f;
+#endif
+}
+
+// the axes choose_best_axis() tries besides the principal component
+#define AXIS_MAX_ACCUMULATION 0
+#define AXIS_LUMINANCE 1
+#define AXIS_BOUNDING_BOX 2
+#define AXIS_CANDIDATES 3
+
+void candidate_axis(float4 texels[BLOCK_SIZE], uint axis, ASTC_OUT(float4) e0, ASTC_OUT(float4) e1)
+{
+	if (axis == AXIS_MAX_ACCUMULATION)
+	{
+		max_accumulation_pixel_direction(texels, e0, e1);
+	}
+	else if (axis == AXIS_LUMINANCE)
+	{
+		luminance_axis(texels, e0, e1);
+	}
+	else
+	{
+		bounding_box_axis(texels, e0, e1);
+	}
+}
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// quantize & unquantize the endpoints
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// QUANT_6 and up, see color_quant_table
+uint unquantize_color(uint qm_index, uint q)
+{
+	return (color_quant_table[color_table_offset[qm_index] + q] >> 8) & 0xFF;
+}
+
+// the ise value whose unquantized value is the closest to "v"
+uint quantize_color(uint qm_index, float v)
+{
+	int base = color_table_offset[qm_index];
+	int levels = quant_levels[qm_index];
+
+	// the unquantized values are close to linear, the closest one is at most one rank off
+	int rank = (int)round(v * ((levels - 1) / 255.0f));
+	uint q = color_quant_table[base + rank] & 0xFF;
+	float err = abs(v - unquantize_color(qm_index, q));
+	if (rank > 0)
+	{
+		uint q0 = color_quant_table[base + rank - 1] & 0xFF;
+		float err0 = abs(v - unquantize_color(qm_index, q0));
+		if (err0 < err)
+		{
+			q = q0;
+			err = err0;
+		}
+	}
+	if (rank < levels - 1)
+	{
+		uint q1 = color_quant_table[base + rank + 1] & 0xFF;
+		float err1 = abs(v - unquantize_color(qm_index, q1));
+		if (err1 < err)
+		{
+			q = q1;
+		}
+	}
+	return q;
+}
+
+// cem 8/12, the only rgb(a) cem of the fast path, cem 11/15 for hdr
+uint direct_cem()
+{
+#if IS_HDR && HAS_ALPHA
+	return CEM_HDR_RGBA_DIRECT;
+#elif IS_HDR
+	return CEM_HDR_RGB_DIRECT;
+#elif HAS_ALPHA
+	return CEM_LDR_RGBA_DIRECT;
+#else
+	return CEM_LDR_RGB_DIRECT;
+#endif
+}
+
+// cem 9/13
+uint base_offset_cem()
+{
+#if HAS_ALPHA
+	return CEM_LDR_RGBA_BASE_OFFSET;
+#else
+	return CEM_LDR_RGB_BASE_OFFSET;
+#endif
+}
+
+// blue_contract() of the spec, the decoder applies it when it swaps the endpoints
+float4 blue_contract(float4 c)
+{
+	return float4((int)(c.x + c.z) >> 1, (int)(c.y + c.z) >> 1, c.z, c.w);
+}
+
+// the values blue_contract() decodes to "c"
+float4 blue_expand(float4 c)
+{
+	return float4(2.0f * c.x - c.z, 2.0f * c.y - c.z, c.z, c.w);
+}
+
+// cem 8/12 with every component quantized on its own
+void encode_direct_color(uint qm_index, float4 e0, float4 e1, ASTC_OUT_ARRAY uint endpoint_quantized[8])
+{
+	uint4 e0q = uint4(quantize_color(qm_index, e0.x), quantize_color(qm_index, e0.y), quantize_color(qm_index, e0.z), quantize_color(qm_index, e0.w));
+	uint4 e1q = uint4(quantize_color(qm_index, e1.x), quantize_color(qm_index, e1.y), quantize_color(qm_index, e1.z), quantize_color(qm_index, e1.w));
+
+	// the decoder blue-contracts and swaps the endpoints when the second one is darker,
+	// rounding to fewer bits can flip the order find_min_max() set up
+	uint s0 = unquantize_color(qm_index, e0q.x) + unquantize_color(qm_index, e0q.y) + unquantize_color(qm_index, e0q.z);
+	uint s1 = unquantize_color(qm_index, e1q.x) + unquantize_color(qm_index, e1q.y) + unquantize_color(qm_index, e1q.z);
+	if (s0 > s1)
+	{
+		uint4 tmp = e0q;
+		e0q = e1q;
+		e1q = tmp;
+	}
+
+	endpoint_quantized[0] = e0q.x;
+	endpoint_quantized[1] = e1q.x;
+	endpoint_quantized[2] = e0q.y;
+	endpoint_quantized[3] = e1q.y;
+	endpoint_quantized[4] = e0q.z;
+	endpoint_quantized[5] = e1q.z;
+	endpoint_quantized[6] = e0q.w;
+	endpoint_quantized[7] = e1q.w;
+}
+
+/**
+ * cem 8/12 blue-contracted: red and green are stored at twice their distance to blue, so they keep
+ * one more bit when they are close to it. the decoder only contracts when the second endpoint is the
+ * darker one, it holds "e0".
+ */
+void encode_blue_contract_color(uint qm_index, float4 e0, float4 e1, ASTC_OUT_ARRAY uint endpoint_quantized[8])
+{
+	float4 x0 = clamp(blue_expand(e0), 0.0f, 255.0f);
+	float4 x1 = clamp(blue_expand(e1), 0.0f, 255.0f);
+	for (int c = 0; c < 4; ++c)
+	{
+		endpoint_quantized[2 * c] = quantize_color(qm_index, x1[c]);
+		endpoint_quantized[2 * c + 1] = quantize_color(qm_index, x0[c]);
+	}
+}
+
+/**
+ * cem 9/13: a base and a signed offset of -32..31 per component. bit_transfer_signed() of the decoder
+ * drops bit 0 of both values, so QUANT_128 already holds the base and the offset exactly.
+ */
+void encode_base_offset_color(uint qm_index, float4 e0, float4 e1, ASTC_OUT_ARRAY uint endpoint_quantized[8])
+{
+	for (int c = 0; c < 4; ++c)
+	{
+		// base bits 0-6 are bits 1-7 of the first value, base bit 7 is bit 7 of the second one
+		uint base = (uint)round(clamp(e0[c], 0.0f, 255.0f));
+		uint v0 = quantize_color(qm_index, (base & 0x7F) * 2 + 0.5f);
+		int decoded_base = (int)((unquantize_color(qm_index, v0) >> 1) | (base & 0x80));
+
+		// the offset from the base the decoder sees, in bits 1-6 of the second value
+		int offset = (int)round(clamp(e1[c], 0.0f, 255.0f)) - decoded_base;
+		offset = (offset < -32) ? -32 : ((offset > 31) ? 31 : offset);
+		uint v1 = quantize_color(qm_index, ((base & 0x80) | (((uint)offset & 0x3F) << 1)) + 0.5f);
+
+		endpoint_quantized[2 * c] = v0;
+		endpoint_quantized[2 * c + 1] = v1;
+	}
+}
+
+// squared error of the decoded endpoints "e0"/"e1"
+float endpoint_error(float4 ep0, float4 ep1, float4 e0, float4 e1)
+{
+	float4 d0 = ep0 - e0;
+	float4 d1 = ep1 - e1;
+#if !HAS_ALPHA
+	d0.w = 0;
+	d1.w = 0;
+#endif
+	return dot(d0, d0) + dot(d1, d1);
+}
+
+// hdr endpoints: the decoder shifts the 12 bit endpoint integers to 16 bit values, interpolates them and maps
+// the result to a half float through a piecewise linear mantissa ("HDR Endpoint Decoding" of the spec).
+// the hdr encoder works on those 16 bit values scaled to 0..255 like the ldr texels, an endpoint integer x is x / 16.
+
+// the inverse of that mapping, the scaled 16 bit value of the half float range value "f"
+float half_to_lns(float f)
+{
+	// negatives and nan are 0, infinities the largest half
+	f = min(max(f, 0.0f), 65504.0f);
+
+	// subnormals count 2^-24 steps with exponent 0
+	float e = 0;
+	float m = f * 16777216.0f;
+	if (f >= 6.103515625e-05f)
+	{
+		e = floor(log2(f));
+		m = (f / exp2(e) - 1.0f) * 1024.0f;
+		e += 15.0f;
+	}
+
+	// the decoder's mantissa is 3x, 4x - 512 or 5x - 2048 of the low 11 bits, in 1/8 steps
+	float mt = m * 8.0f;
+	float lm = (mt < 1536.0f) ? mt / 3.0f : ((mt < 5632.0f) ? (mt + 512.0f) / 4.0f : (mt + 2048.0f) / 5.0f);
+	return max(e * 2048.0f + lm, 0.0f) / 256.0f;
+}
+
+// the half float bits the decoder makes of the scaled 16 bit value "v"
+uint lns_to_half(float v)
+{
+	uint c = (uint)round(clamp(v, 0.0f, 255.0f) * 256.0f);
+	uint m = c & 0x7FF;
+	uint mt = (m < 512) ? 3 * m : ((m < 1536) ? 4 * m - 512 : 5 * m - 2048);
+	uint h = ((c >> 11) << 10) + (mt >> 3);
+	return (h > 0x7BFF) ? 0x7BFF : h;
+}
+
+// an hdr texel in the domain of the encoder, alpha is 255 without HAS_ALPHA like the ldr texels
+float4 hdr_texel(float4 texel)
+{
+#if HAS_ALPHA
+	return float4(half_to_lns(texel.x), half_to_lns(texel.y), half_to_lns(texel.z), half_to_lns(texel.w));
+#else
+	return float4(half_to_lns(texel.x), half_to_lns(texel.y), half_to_lns(texel.z), 255.0f);
+#endif
+}
+
+// swaps the major component "majcomp" of cem 7/11 with red, the decoder swaps it back
+float4 major_first(float4 c, uint majcomp)
+{
+	return (majcomp == 1) ? float4(c.y, c.x, c.z, c.w) : ((majcomp == 2) ? float4(c.z, c.y, c.x, c.w) : c);
+}
+
+// the rgb part of endpoint_error(), the decoded endpoints are in the other order when "swapped"
+float hdr_rgb_error(float4 ep0, float4 ep1, bool swapped, float4 e0, float4 e1)
+{
+	float4 d0 = (swapped ? ep1 : ep0) - e0;
+	float4 d1 = (swapped ? ep0 : ep1) - e1;
+	d0.w = 0;
+	d1.w = 0;
+	return dot(d0, d0) + dot(d1, d1);
+}
+
+// cem 11, "HDR Endpoint Mode 11" of the spec
+void decode_hdr_rgb(uint v[8], ASTC_OUT(float4) e0, ASTC_OUT(float4) e1)
+{
+	uint majcomp = ((v[4] & 0x80) >> 7) | ((v[5] & 0x80) >> 6);
+	if (majcomp == 3)
+	{
+		// direct, 8 bit red and green, 7 bit blue
+		e0 = float4(v[0] << 4, v[2] << 4, (v[4] & 0x7F) << 5, 0) / 16.0f;
+		e1 = float4(v[1] << 4, v[3] << 4, (v[5] & 0x7F) << 5, 0) / 16.0f;
+		return;
+	}
+
+	uint mode = ((v[1] & 0x80) >> 7) | ((v[2] & 0x80) >> 6) | ((v[3] & 0x80) >> 5);
+	int a = (int)(v[0] | ((v[1] & 0x40) << 2));
+	int b0 = (int)(v[2] & 0x3F);
+	int b1 = (int)(v[3] & 0x3F);
+	int c = (int)(v[1] & 0x3F);
+	int d0 = (int)(v[4] & 0x1F);
+	int d1 = (int)(v[5] & 0x1F);
+	int x0 = (int)(v[2] >> 6) & 1;
+	int x1 = (int)(v[3] >> 6) & 1;
+	int x2 = (int)(v[4] >> 6) & 1;
+	int x3 = (int)(v[5] >> 6) & 1;
+	int x4 = (int)(v[4] >> 5) & 1;
+	int x5 = (int)(v[5] >> 5) & 1;
+
+	// the bits each mode moves between the fields
+	uint onehot = 1u << mode;
+	a |= (onehot & 0xA4) ? (x0 << 9) : 0;
+	a |= (onehot & 0x08) ? (x2 << 9) : 0;
+	a |= (onehot & 0x50) ? ((x4 << 9) | (x5 << 10)) : 0;
+	a |= (onehot & 0xA0) ? (x1 << 10) : 0;
+	a |= (onehot & 0xC0) ? (x2 << 11) : 0;
+	c |= (onehot & 0x04) ? (x1 << 6) : 0;
+	c |= (onehot & 0xE8) ? (x3 << 6) : 0;
+	c |= (onehot & 0x20) ? (x2 << 7) : 0;
+	b0 |= (onehot & 0x5B) ? (x0 << 6) : 0;
+	b1 |= (onehot & 0x5B) ? (x1 << 6) : 0;
+	b0 |= (onehot & 0x12) ? (x2 << 7) : 0;
+	b1 |= (onehot & 0x12) ? (x3 << 7) : 0;
+	d0 |= (onehot & 0xAF) ? (x4 << 5) : 0;
+	d1 |= (onehot & 0xAF) ? (x5 << 5) : 0;
+	d0 |= (onehot & 0x05) ? (x2 << 6) : 0;
+	d1 |= (onehot & 0x05) ? (x3 << 6) : 0;
+
+	// d is signed, every field is in steps of 1 << shift
+	int dsign = 1 << (4 + ((0xAF >> mode) & 1) + ((0x05 >> mode) & 1));
+	d0 = (d0 ^ dsign) - dsign;
+	d1 = (d1 ^ dsign) - dsign;
+	int step = 1 << ((mode >> 1) ^ 3);
+	a *= step;
+	b0 *= step;
+	b1 *= step;
+	c *= step;
+	d0 *= step;
+	d1 *= step;
+
+	float4 c0 = float4(a - c, a - b0 - c - d0, a - b1 - c - d1, 0);
+	float4 c1 = float4(a, a - b0, a - b1, 0);
+	e0 = major_first(clamp(c0, 0.0f, 4095.0f), majcomp) / 16.0f;
+	e1 = major_first(clamp(c1, 0.0f, 4095.0f), majcomp) / 16.0f;
+}
+
+// cem 7, "HDR Endpoint Mode 7" of the spec
+void decode_hdr_rgb_scale(uint v[8], ASTC_OUT(float4) e0, ASTC_OUT(float4) e1)
+{
+	uint modeval = ((v[0] & 0xC0) >> 6) | ((v[1] & 0x80) >> 5) | ((v[2] & 0x80) >> 4);
+	uint majcomp = modeval >> 2;
+	uint mode = modeval & 3;
+	if ((modeval & 0xC) == 0xC)
+	{
+		majcomp = (modeval == 0xF) ? 0 : modeval & 3;
+		mode = (modeval == 0xF) ? 5 : 4;
+	}
+
+	int r = (int)(v[0] & 0x3F);
+	int g = (int)(v[1] & 0x1F);
+	int b = (int)(v[2] & 0x1F);
+	int s = (int)(v[3] & 0x1F);
+	int x0 = (int)(v[1] >> 6) & 1;
+	int x1 = (int)(v[1] >> 5) & 1;
+	int x2 = (int)(v[2] >> 6) & 1;
+	int x3 = (int)(v[2] >> 5) & 1;
+	int x4 = (int)(v[3] >> 7) & 1;
+	int x5 = (int)(v[3] >> 6) & 1;
+	int x6 = (int)(v[3] >> 5) & 1;
+
+	uint onehot = 1u << mode;
+	g |= (onehot & 0x30) ? (x0 << 6) : 0;
+	g |= (onehot & 0x3A) ? (x1 << 5) : 0;
+	b |= (onehot & 0x30) ? (x2 << 6) : 0;
+	b |= (onehot & 0x3A) ? (x3 << 5) : 0;
+	s |= (onehot & 0x3D) ? (x6 << 5) : 0;
+	s |= (onehot & 0x2D) ? (x5 << 6) : 0;
+	s |= (onehot & 0x04) ? (x4 << 7) : 0;
+	r |= (onehot & 0x3B) ? (x4 << 6) : 0;
+	r |= (onehot & 0x04) ? (x3 << 6) : 0;
+	r |= (onehot & 0x10) ? (x5 << 7) : 0;
+	r |= (onehot & 0x0F) ? (x2 << 7) : 0;
+	r |= (onehot & 0x05) ? (x1 << 8) : 0;
+	r |= (onehot & 0x0A) ? (x0 << 8) : 0;
+	r |= (onehot & 0x05) ? (x0 << 9) : 0;
+	r |= (onehot & 0x02) ? (x6 << 9) : 0;
+	r |= (onehot & 0x01) ? (x3 << 10) : 0;
+	r |= (onehot & 0x02) ? (x5 << 10) : 0;
+
+	int shift = (mode < 2) ? 1 : (int)mode;
+	r <<= shift;
+	g <<= shift;
+	b <<= shift;
+	s <<= shift;
+	if (mode != 5)
+	{
+		g = r - g;
+		b = r - b;
+	}
+
+	float4 c1 = float4(r, g, b, 0);
+	float4 c0 = float4(r - s, g - s, b - s, 0);
+	e0 = major_first(clamp(c0, 0.0f, 4095.0f), majcomp) / 16.0f;
+	e1 = major_first(clamp(c1, 0.0f, 4095.0f), majcomp) / 16.0f;
+}
+
+// the alpha of cem 15, "HDR Alpha" of the spec
+void decode_hdr_alpha(uint v6, uint v7, ASTC_OUT(float) a0, ASTC_OUT(float) a1)
+{
+	uint mode = ((v6 >> 7) & 1) | ((v7 >> 6) & 2);
+	int base = (int)(v6 & 0x7F);
+	int offset = (int)(v7 & 0x7F);
+	if (mode == 3)
+	{
+		base <<= 5;
+		offset <<= 5;
+	}
+	else
+	{
+		// a 12 bit base and a signed offset that share 14 bits
+		base |= (offset << (mode + 1)) & 0x780;
+		int osign = 0x20 >> mode;
+		offset = ((offset & (0x3F >> mode)) ^ osign) - osign;
+		base <<= 4 - mode;
+		offset = base + offset * (1 << (4 - mode));
+		offset = (offset < 0) ? 0 : ((offset > 0xFFF) ? 0xFFF : offset);
+	}
+	a0 = base / 16.0f;
+	a1 = offset / 16.0f;
+}
+
+// cem 11 direct (majcomp 3) of the 12 bit endpoints "t0"/"t1", for endpoints too far apart for the other modes
+void pack_hdr_rgb_direct(float4 t0, float4 t1, ASTC_OUT_ARRAY uint v[8])
+{
+	v[0] = (uint)clamp(round(t0.x / 16.0f), 0.0f, 255.0f);
+	v[1] = (uint)clamp(round(t1.x / 16.0f), 0.0f, 255.0f);
+	v[2] = (uint)clamp(round(t0.y / 16.0f), 0.0f, 255.0f);
+	v[3] = (uint)clamp(round(t1.y / 16.0f), 0.0f, 255.0f);
+	v[4] = 0x80 | (uint)clamp(round(t0.z / 32.0f), 0.0f, 127.0f);
+	v[5] = 0x80 | (uint)clamp(round(t1.z / 32.0f), 0.0f, 127.0f);
+	v[6] = 0;
+	v[7] = 0;
+}
+
+/**
+ * cem 11 mode "mode" (0-7) of the 12 bit endpoints "t0"/"t1" whose major component "majcomp" is in x.
+ * the second endpoint holds the largest value, the others are differences to it: a, then the b, c and d
+ * fields of every mode in the widths and positions decode_hdr_rgb() reads them from.
+ */
+void pack_hdr_rgb(float4 t0, float4 t1, uint mode, uint majcomp, ASTC_OUT_ARRAY uint v[8])
+{
+	float step = (float)(1 << ((mode >> 1) ^ 3));
+	int amax = (1 << (9 + (mode >> 1))) - 1;
+	int bmax = (1 << (6 + ((0x5B >> mode) & 1) + ((0x12 >> mode) & 1))) - 1;
+	int cmax = (1 << (6 + ((0xEC >> mode) & 1) + ((0x20 >> mode) & 1))) - 1;
+	int dsign = 1 << (4 + ((0xAF >> mode) & 1) + ((0x05 >> mode) & 1));
+
+	// every field is taken against the decoded ones before it, so their rounding doesn't add up
+	int a = (int)clamp(round(t1.x / step), 0.0f, (float)amax);
+	float ad = a * step;
+	int c = (int)clamp(round((ad - t0.x) / step), 0.0f, (float)cmax);
+	int b0 = (int)clamp(round((ad - t1.y) / step), 0.0f, (float)bmax);
+	int b1 = (int)clamp(round((ad - t1.z) / step), 0.0f, (float)bmax);
+	int d0 = (int)clamp(round((ad - (b0 + c) * step - t0.y) / step), (float)-dsign, dsign - 1.0f);
+	int d1 = (int)clamp(round((ad - (b1 + c) * step - t0.z) / step), (float)-dsign, dsign - 1.0f);
+
+	uint onehot = 1u << mode;
+	int x0 = (onehot & 0xA4) ? (a >> 9) : (b0 >> 6);
+	int x1 = (onehot & 0xA0) ? (a >> 10) : ((onehot & 0x04) ? (c >> 6) : (b1 >> 6));
+	int x2 = (onehot & 0x08) ? (a >> 9) : ((onehot & 0xC0) ? (a >> 11) : ((onehot & 0x20) ? (c >> 7) : ((onehot & 0x12) ? (b0 >> 7) : (d0 >> 6))));
+	int x3 = (onehot & 0xE8) ? (c >> 6) : ((onehot & 0x12) ? (b1 >> 7) : (d1 >> 6));
+	int x4 = (onehot & 0x50) ? (a >> 9) : (d0 >> 5);
+	int x5 = (onehot & 0x50) ? (a >> 10) : (d1 >> 5);
+
+	v[0] = (uint)a & 0xFF;
+	v[1] = ((mode & 1) << 7) | ((((uint)a >> 8) & 1) << 6) | ((uint)c & 0x3F);
+	v[2] = (((mode >> 1) & 1) << 7) | (((uint)x0 & 1) << 6) | ((uint)b0 & 0x3F);
+	v[3] = ((mode >> 2) << 7) | (((uint)x1 & 1) << 6) | ((uint)b1 & 0x3F);
+	v[4] = ((majcomp & 1) << 7) | (((uint)x2 & 1) << 6) | (((uint)x4 & 1) << 5) | ((uint)d0 & 0x1F);
+	v[5] = ((majcomp >> 1) << 7) | (((uint)x3 & 1) << 6) | (((uint)x5 & 1) << 5) | ((uint)d1 & 0x1F);
+	v[6] = 0;
+	v[7] = 0;
+}
+
+// quantizes the cem 11 values "v", returns the rgb error of what they decode to
+float quantize_hdr_rgb(uint qm_index, uint v[8], float4 ep0, float4 ep1, bool swapped, ASTC_OUT_ARRAY uint endpoint_quantized[8])
+{
+	uint u[8];
+	for (int i = 0; i < 8; ++i)
+	{
+		endpoint_quantized[i] = (i < 6) ? quantize_color(qm_index, v[i]) : 0;
+		u[i] = unquantize_color(qm_index, endpoint_quantized[i]);
+	}
+	float4 e0, e1;
+	decode_hdr_rgb(u, e0, e1);
+	return hdr_rgb_error(ep0, ep1, swapped, e0, e1);
+}
+
+/**
+ * the cem 11 values that decode the closest to the rgb of ep0/ep1, returns their error. every mode trades
+ * the range of the differences against their precision, so each one and each major component is tried.
+ * "swapped": ep1 is the first endpoint of the values.
+ */
+float encode_hdr_rgb(uint qm_index, float4 ep0, float4 ep1, ASTC_OUT(bool) swapped, ASTC_OUT_ARRAY uint endpoint_quantized[8])
+{
+	float4 t0 = ep0 * 16.0f;
+	float4 t1 = ep1 * 16.0f;
+	uint v[8];
+	pack_hdr_rgb_direct(t0, t1, v);
+	swapped = false;
+	float best_err = quantize_hdr_rgb(qm_index, v, ep0, ep1, false, endpoint_quantized);
+
+	for (uint majcomp = 0; majcomp < 3; ++majcomp)
+	{
+		// the second endpoint has the larger major component
+		bool swap_ends = t1[majcomp] < t0[majcomp];
+		float4 s0 = major_first(swap_ends ? t1 : t0, majcomp);
+		float4 s1 = major_first(swap_ends ? t0 : t1, majcomp);
+		for (uint mode = 0; mode < 8; ++mode)
+		{
+			uint q[8];
+			pack_hdr_rgb(s0, s1, mode, majcomp, v);
+			float err = quantize_hdr_rgb(qm_index, v, ep0, ep1, swap_ends, q);
+			if (err < best_err)
+			{
+				for (int i = 0; i < 8; ++i)
+				{
+					endpoint_quantized[i] = q[i];
+				}
+				best_err = err;
+				swapped = swap_ends;
+			}
+		}
+	}
+	return best_err;
+}
+
+/**
+ * the cem 15 alpha values that decode the closest to "a0"/"a1", returns their error. modes 0-2 store a
+ * base and a signed offset in 14 bits, mode 3 both ends with 7 bits.
+ */
+float encode_hdr_alpha(uint qm_index, float a0, float a1, ASTC_OUT(uint) q6, ASTC_OUT(uint) q7)
+{
+	float t0 = a0 * 16.0f;
+	float t1 = a1 * 16.0f;
+	float best_err = 1e31f;
+	q6 = 0;
+	q7 = 0;
+	for (uint mode = 0; mode < 4; ++mode)
+	{
+		uint v6 = 0x80 | (uint)clamp(round(t0 / 32.0f), 0.0f, 127.0f);
+		uint v7 = 0x80 | (uint)clamp(round(t1 / 32.0f), 0.0f, 127.0f);
+		if (mode < 3)
+		{
+			float step = (float)(1 << (4 - mode));
+			int osign = 0x20 >> mode;
+			int base = (int)clamp(round(t0 / step), 0.0f, (float)((1 << (8 + mode)) - 1));
+			int offset = (int)clamp(round(t1 / step) - base, (float)-osign, osign - 1.0f);
+			v6 = ((mode & 1) << 7) | ((uint)base & 0x7F);
+			v7 = ((mode >> 1) << 7) | (((uint)base >> 7) << (6 - mode)) | ((uint)offset & (0x3F >> mode));
+		}
+
+		uint r6 = quantize_color(qm_index, v6);
+		uint r7 = quantize_color(qm_index, v7);
+		float d0, d1;
+		decode_hdr_alpha(unquantize_color(qm_index, r6), unquantize_color(qm_index, r7), d0, d1);
+		float err = (a0 - d0) * (a0 - d0) + (a1 - d1) * (a1 - d1);
+		if (err < best_err)
+		{
+			q6 = r6;
+			q7 = r7;
+			best_err = err;
+		}
+	}
+	return best_err;
+}
+
+// cem 11/15, the alpha of encode_hdr_alpha() follows the endpoint order of encode_hdr_rgb(), returns the error
+float encode_hdr_color(uint qm_index, float4 ep0, float4 ep1, ASTC_OUT_ARRAY uint endpoint_quantized[8])
+{
+	bool swapped;
+	float err = encode_hdr_rgb(qm_index, ep0, ep1, swapped, endpoint_quantized);
+#if HAS_ALPHA
+	err += encode_hdr_alpha(qm_index, swapped ? ep1.w : ep0.w, swapped ? ep0.w : ep1.w, endpoint_quantized[6], endpoint_quantized[7]);
+#endif
+	return err;
+}
+
+/**
+ * cem 7 mode "mode" (0-4) of the 12 bit endpoint "t1" whose major component "majcomp" is in x, and the 12 bit
+ * "scale" the first endpoint is darker by. mode 5 has no difference fields, it is left out.
+ */
+void pack_hdr_rgb_scale(float4 t1, float scale, uint mode, uint majcomp, ASTC_OUT_ARRAY uint v[8])
+{
+	uint shift = (mode < 2) ? 1 : mode;
+	float step = (float)(1 << shift);
+	int rmax = (1 << (12 - shift)) - 1;
+	int gmax = (1 << (5 + ((0x3A >> mode) & 1) + ((0x30 >> mode) & 1))) - 1;
+	int smax = (1 << (5 + ((0x3D >> mode) & 1) + ((0x2D >> mode) & 1) + ((0x04 >> mode) & 1))) - 1;
+
+	int r = (int)clamp(round(t1.x / step), 0.0f, (float)rmax);
+	float rd = r * step;
+	int g = (int)clamp(round((rd - t1.y) / step), 0.0f, (float)gmax);
+	int b = (int)clamp(round((rd - t1.z) / step), 0.0f, (float)gmax);
+	int s = (int)clamp(round(scale / step), 0.0f, (float)smax);
+
+	uint onehot = 1u << mode;
+	int x0 = (onehot & 0x30) ? (g >> 6) : ((onehot & 0x0A) ? (r >> 8) : (r >> 9));
+	int x1 = (onehot & 0x3A) ? (g >> 5) : (r >> 8);
+	int x2 = (onehot & 0x30) ? (b >> 6) : (r >> 7);
+	int x3 = (onehot & 0x3A) ? (b >> 5) : ((onehot & 0x04) ? (r >> 6) : (r >> 10));
+	int x4 = (onehot & 0x04) ? (s >> 7) : (r >> 6);
+	int x5 = (onehot & 0x2D) ? (s >> 6) : ((onehot & 0x10) ? (r >> 7) : (r >> 10));
+	int x6 = (onehot & 0x3D) ? (s >> 5) : (r >> 9);
+
+	uint modeval = (mode < 4) ? ((majcomp << 2) | mode) : (0xC | majcomp);
+	v[0] = ((modeval & 3) << 6) | ((uint)r & 0x3F);
+	v[1] = (((modeval >> 2) & 1) << 7) | (((uint)x0 & 1) << 6) | (((uint)x1 & 1) << 5) | ((uint)g & 0x1F);
+	v[2] = ((modeval >> 3) << 7) | (((uint)x2 & 1) << 6) | (((uint)x3 & 1) << 5) | ((uint)b & 0x1F);
+	v[3] = (((uint)x4 & 1) << 7) | (((uint)x5 & 1) << 6) | (((uint)x6 & 1) << 5) | ((uint)s & 0x1F);
+	for (int i = 4; i < 8; ++i)
+	{
+		v[i] = 0;
+	}
+}
+
+/**
+ * cem 7: the brighter endpoint and a scale the other one is darker by in every component, 4 values instead
+ * of the 6 of cem 11. returns the rgb error of the best mode and major component.
+ */
+float encode_hdr_scale_color(uint qm_index, float4 ep0, float4 ep1, ASTC_OUT_ARRAY uint endpoint_quantized[8])
+{
+	bool swapped = ep1.x + ep1.y + ep1.z < ep0.x + ep0.y + ep0.z;
+	float4 t0 = (swapped ? ep1 : ep0) * 16.0f;
+	float4 t1 = (swapped ? ep0 : ep1) * 16.0f;
+	float4 d = t1 - t0;
+	float scale = max((d.x + d.y + d.z) / 3.0f, 0.0f);
+
+	float best_err = 1e31f;
+	for (uint majcomp = 0; majcomp < 3; ++majcomp)
+	{
+		for (uint mode = 0; mode < 5; ++mode)
+		{
+			uint v[8];
+			pack_hdr_rgb_scale(major_first(t1, majcomp), scale, mode, majcomp, v);
+
+			uint q[8];
+			uint u[8];
+			for (int i = 0; i < 8; ++i)
+			{
+				q[i] = (i < 4) ? quantize_color(qm_index, v[i]) : 0;
+				u[i] = unquantize_color(qm_index, q[i]);
+			}
+			float4 e0, e1;
+			decode_hdr_rgb_scale(u, e0, e1);
+			float err = hdr_rgb_error(ep0, ep1, swapped, e0, e1);
+			if (err < best_err)
+			{
+				for (int j = 0; j < 8; ++j)
+				{
+					endpoint_quantized[j] = q[j];
+				}
+				best_err = err;
+			}
+		}
+	}
+	return best_err;
+}
+
+// the endpoints the decoder gets out of cem "cem", see "Color Endpoint Decoding" of the spec
+void decode_color(uint cem, uint qm_index, uint endpoint_quantized[8], ASTC_OUT(float4) e0, ASTC_OUT(float4) e1)
+{
+	uint v[8];
+	for (int i = 0; i < 8; ++i)
+	{
+		v[i] = unquantize_color(qm_index, endpoint_quantized[i]);
+	}
+
+	if (cem == CEM_HDR_RGB_SCALE)
+	{
+		decode_hdr_rgb_scale(v, e0, e1);
+	}
+	else if (cem == CEM_HDR_RGB_DIRECT || cem == CEM_HDR_RGBA_DIRECT)
+	{
+		decode_hdr_rgb(v, e0, e1);
+		if (cem == CEM_HDR_RGBA_DIRECT)
+		{
+			decode_hdr_alpha(v[6], v[7], e0.w, e1.w);
+		}
+	}
+	else if (cem == CEM_LDR_RGB_BASE_OFFSET || cem == CEM_LDR_RGBA_BASE_OFFSET)
+	{
+		// bit_transfer_signed(), the base takes the top bit of the offset value
+		int offset_sum = 0;
+		for (int c = 0; c < 4; ++c)
+		{
+			int base = (int)((v[2 * c] >> 1) | (v[2 * c + 1] & 0x80));
+			int offset = (int)((v[2 * c + 1] >> 1) & 0x3F);
+			offset = (offset & 0x20) ? offset - 0x40 : offset;
+			e0[c] = base;
+			e1[c] = base + offset;
+			offset_sum += (c < 3) ? offset : 0;
+		}
+		if (offset_sum < 0)
+		{
+			float4 tmp = e0;
+			e0 = blue_contract(e1);
+			e1 = blue_contract(tmp);
+		}
+		e0 = clamp(e0, 0.0f, 255.0f);
+		e1 = clamp(e1, 0.0f, 255.0f);
+	}
+	else
+	{
+		e0 = float4(v[0], v[2], v[4], v[6]);
+		e1 = float4(v[1], v[3], v[5], v[7]);
+		if (v[1] + v[3] + v[5] < v[0] + v[2] + v[4])
+		{
+			float4 tmp = e0;
+			e0 = blue_contract(e1);
+			e1 = blue_contract(tmp);
+		}
+	}
+
+#if !HAS_ALPHA
+	e0.w = 255.0f;
+	e1.w = 255.0f;
+#endif
+}
+
+/**
+ * the values of cem "cem" that decode the closest to ep0/ep1, returns their endpoint_error().
+ * cem 8/12 takes the better one of the direct and the blue-contracted values, hdr is always cem 11/15.
+ */
+float encode_color_cem(uint cem, uint qm_index, float4 ep0, float4 ep1, ASTC_OUT_ARRAY uint endpoint_quantized[8])
+{
+#if IS_HDR
+	// hdr only has the direct cem 11/15 here
+	return (cem == direct_cem()) ? encode_hdr_color(qm_index, ep0, ep1, endpoint_quantized) : 1e31f;
+#else
+	float4 e0, e1;
+	if (cem == base_offset_cem())
+	{
+		encode_base_offset_color(qm_index, ep0, ep1, endpoint_quantized);
+		decode_color(cem, qm_index, endpoint_quantized, e0, e1);
+		return endpoint_error(ep0, ep1, e0, e1);
+	}
+
+	encode_direct_color(qm_index, ep0, ep1, endpoint_quantized);
+	decode_color(cem, qm_index, endpoint_quantized, e0, e1);
+	float err = endpoint_error(ep0, ep1, e0, e1);
+
+	uint contracted[8];
+	encode_blue_contract_color(qm_index, ep0, ep1, contracted);
+	decode_color(cem, qm_index, contracted, e0, e1);
+	float contracted_err = endpoint_error(ep0, ep1, e0, e1);
+	if (contracted_err < err)
+	{
+		for (int i = 0; i < 8; ++i)
+		{
+			endpoint_quantized[i] = contracted[i];
+		}
+		err = contracted_err;
+	}
+	return err;
+#endif
+}
+
+/**
+ * quantize the endpoints with the rgb(a) cem that keeps them the most precise, returns the cem.
+ * QUANT_256 already rounds every component to the closest value, it stays direct like the fast path.
+ * hdr takes cem 11/15, cem 7 needs fewer values and is chosen by the caller, see choose_hdr_scale().
+ */
+uint encode_color(uint qm_index, float4 ep0, float4 ep1, ASTC_OUT_ARRAY uint endpoint_quantized[8])
+{
+#if IS_HDR
+	encode_hdr_color(qm_index, ep0, ep1, endpoint_quantized);
+	return direct_cem();
+#else
+	if (qm_index == QUANT_256)
+	{
+		encode_direct_color(qm_index, ep0, ep1, endpoint_quantized);
+		return direct_cem();
+	}
+
+	float err = encode_color_cem(direct_cem(), qm_index, ep0, ep1, endpoint_quantized);
+
+	uint base_offset[8];
+	float base_offset_err = encode_color_cem(base_offset_cem(), qm_index, ep0, ep1, base_offset);
+	if (base_offset_err < err)
+	{
+		for (int i = 0; i < 8; ++i)
+		{
+			endpoint_quantized[i] = base_offset[i];
+		}
+		return base_offset_cem();
+	}
+	return direct_cem();
+#endif
+}
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// calculate quantized weights
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+uint quantize_weight(uint weight_range, float weight)
+{
+	uint q = (uint)round(weight * weight_range);
+	return clamp(q, 0, weight_range);
+}
+
+float unquantize_weight(uint weight_range, uint qw)
+{
+	float w = 1.0f * qw / weight_range;
+	return clamp(w, 0.0f, 1.0f);
+}
+
+float4 sample_texel(float4 texels[BLOCK_SIZE], uint4 index, float4 coff)
+{
+	float4 sum = texels[index.x] * coff.x;
+	sum += texels[index.y] * coff.y;
+	sum += texels[index.z] * coff.z;
+	sum += texels[index.w] * coff.w;
+	return sum;
+}
+
+// the grid of the fast blockmode, the partition, dual plane and luminance encodings keep to it too.
+// it is 4x4, 3x3x3 for the 3d footprints
+#define DEFAULT_GRID 0
+
+// the weights of DEFAULT_GRID as a constant, the arrays of the dual plane weights take twice that
+#if BLOCK_DIM_Z > 1
+#define DEFAULT_GRID_WEIGHTS 27
+#else
+#define DEFAULT_GRID_WEIGHTS (X_GRIDS * Y_GRIDS)
+#endif
+
+// the weight quant method of the fast blockmode, the finest one whose DEFAULT_GRID leaves the endpoints QUANT_256
+#if BLOCK_DIM_Z > 1 && HAS_ALPHA
+#define FAST_WEIGHT_QUANT QUANT_3
+#elif BLOCK_DIM_Z > 1
+#define FAST_WEIGHT_QUANT QUANT_5
+#elif HAS_ALPHA
+#define FAST_WEIGHT_QUANT QUANT_6
+#else
+#define FAST_WEIGHT_QUANT QUANT_12
+#endif
+
+// the depth of "grid", 1 for the 2d footprints
+#if BLOCK_DIM_Z > 1
+#define GRID_DEPTH(grid) WEIGHT_GRIDS_Z[grid]
+#else
+#define GRID_DEPTH(grid) 1
+#endif
+
+uint grid_weight_count(uint grid)
+{
+	return WEIGHT_GRIDS[grid].x * WEIGHT_GRIDS[grid].y * GRID_DEPTH(grid);
+}
+
+// the grid is smaller than the block, the weights are decimated and the decoder infills them
+bool is_decimated_grid(uint grid)
+{
+	return grid_weight_count(grid) != BLOCK_SIZE;
+}
+
+/**
+ * the bilinear taps of the texels around weight "i" of the grid, at the texel position the decoder's
+ * infill gives it: grid point g of N lands on texel g * (B - 1) / (N - 1) of a B texel wide block.
+ */
+void grid_sample_taps(uint grid, uint i, ASTC_OUT(uint4) index, ASTC_OUT(float4) coff)
+{
+	uint k = WEIGHT_GRIDS[grid].z + i;
+	index = DECIMATION_IDX[k];
+	coff = DECIMATION_WT[k];
+}
+
+// "C.2.18 Weight Infill": the grid weights of texel "i" and their factors
+void infill_taps(uint grid, uint i, ASTC_OUT(uint4) index, ASTC_OUT(float4) coff)
+{
+	uint k = WEIGHT_GRIDS[grid].w + i;
+	index = INFILL_IDX[k];
+	coff = INFILL_WT[k];
+}
+
+// the weight of texel "i" once the decoder infills the weight grid
+float infill_weight(uint weights[MAX_GRID_WEIGHTS], uint grid, uint weight_range, uint i)
+{
+	if (is_decimated_grid(grid))
+	{
+		uint4 index;
+		float4 coff;
+		infill_taps(grid, i, index, coff);
+		return (weights[index.x] * coff.x + weights[index.y] * coff.y + weights[index.z] * coff.z + weights[index.w] * coff.w) / weight_range;
+	}
+	return (float)weights[i] / weight_range;
+}
+
+// the residual corrections fit_grid_weights() makes after its first estimate
+#define LEAST_SQUARES_ITERATIONS 2
+
+// the texel values "values" infilled from the float weights of "grid", like infill_weight() does for the quantized ones
+float infill_value(float values[MAX_GRID_WEIGHTS], uint grid, uint i)
+{
+	uint4 index;
+	float4 coff;
+	infill_taps(grid, i, index, coff);
+	return values[index.x] * coff.x + values[index.y] * coff.y + values[index.z] * coff.z + values[index.w] * coff.w;
+}
+
+// row "i" of the pseudo-inverse of the infill of "grid" applied to the texel values "values"
+float pseudo_inverse_row(float values[BLOCK_SIZE], uint grid, uint i)
+{
+	uint first = (WEIGHT_GRIDS[grid].z + i) * 4;
+	float sum = 0;
+	for (uint k = first; k < first + 4; ++k)
+	{
+		uint4 index = PSEUDO_INVERSE_IDX[k];
+		float4 coff = PSEUDO_INVERSE_WT[k];
+		sum += values[index.x] * coff.x + values[index.y] * coff.y + values[index.z] * coff.z + values[index.w] * coff.w;
+	}
+	return sum;
+}
+
+/**
+ * the weights of a decimated grid whose infill is the closest to "texel_weights" over every texel, in the least squares sense.
+ * the table holds the largest taps of the pseudo-inverse only, each iteration adds its estimate of the weights of the residual.
+ */
+void fit_grid_weights(float texel_weights[BLOCK_SIZE], uint grid, ASTC_OUT_ARRAY float grid_weights[MAX_GRID_WEIGHTS])
+{
+	uint i = 0;
+	uint count = grid_weight_count(grid);
+	for (i = 0; i < count; ++i)
+	{
+		grid_weights[i] = pseudo_inverse_row(texel_weights, grid, i);
+	}
+
+	float residual[BLOCK_SIZE];
+	for (uint iteration = 0; iteration < LEAST_SQUARES_ITERATIONS; ++iteration)
+	{
+		for (i = 0; i < BLOCK_SIZE; ++i)
+		{
+			residual[i] = texel_weights[i] - infill_value(grid_weights, grid, i);
+		}
+		for (i = 0; i < count; ++i)
+		{
+			grid_weights[i] += pseudo_inverse_row(residual, grid, i);
+		}
+	}
+}
+
+/**
+ * the weights of "grid" along the axis from "ep0" to "ep1". a decimated grid samples the texels at its grid points,
+ * or with "least_squares" fits the weights of every texel with fit_grid_weights().
+ */
+void calculate_normal_weights(float4 texels[BLOCK_SIZE],
+	float4 ep0,
+	float4 ep1,
+	uint grid,
+	bool least_squares,
+	ASTC_OUT_ARRAY float projw[MAX_GRID_WEIGHTS])
+{
+	int i = 0;
+	int count = grid_weight_count(grid);
+	float4 vec_k = ep1 - ep0;
+	if (length(vec_k) < SMALL_VALUE)
+	{
+		for (i = 0; i < count; ++i)
+		{
+			projw[i] = 0;
+		}
+	}
+	else if (least_squares && is_decimated_grid(grid))
+	{
+		float len2 = dot(vec_k, vec_k);
+		float texel_weights[BLOCK_SIZE];
+		for (i = 0; i < BLOCK_SIZE; ++i)
+		{
+			texel_weights[i] = dot(texels[i] - ep0, vec_k) / len2;
+		}
+		fit_grid_weights(texel_weights, grid, projw);
+		for (i = 0; i < count; ++i)
+		{
+			projw[i] = clamp(projw[i], 0.0f, 1.0f);
+		}
+	}
+	else
+	{
+		vec_k = normalize(vec_k);
+		float minw = 1e31f;
+		float maxw = -1e31f;
+		if (is_decimated_grid(grid))
+		{
+			for (i = 0; i < count; ++i)
+			{
+				uint4 index;
+				float4 coff;
+				grid_sample_taps(grid, i, index, coff);
+				float4 sum = sample_texel(texels, index, coff);
+				float w = dot(vec_k, sum - ep0);
+				minw = min(w, minw);
+				maxw = max(w, maxw);
+				projw[i] = w;
+			}
+		}
+		else
+		{
+			// one weight per texel, "count" is BLOCK_SIZE
+			for (i = 0; i < count; ++i)
+			{
+				float4 texel = texels[i];
+				float w = dot(vec_k, texel - ep0);
+				minw = min(w, minw);
+				maxw = max(w, maxw);
+				projw[i] = w;
+			}
+		}
+
+		float invlen = maxw - minw;
+		invlen = max(SMALL_VALUE, invlen);
+		invlen = 1.0f / invlen;
+		for (i = 0; i < count; ++i)
+		{
+			projw[i] = (projw[i] - minw) * invlen;
+		}
+	}
+}
+
+void quantize_weights(float projw[MAX_GRID_WEIGHTS],
+	uint count,
+	uint weight_range,
+	ASTC_OUT_ARRAY uint weights[MAX_GRID_WEIGHTS])
+{
+	for (uint i = 0; i < count; ++i)
+	{
+		weights[i] = quantize_weight(weight_range, projw[i]);
+	}
+}
+
+void calculate_quantized_weights(float4 texels[BLOCK_SIZE],
+	uint grid,
+	bool least_squares,
+	uint weight_range,
+	float4 ep0,
+	float4 ep1,
+	ASTC_OUT_ARRAY uint weights[MAX_GRID_WEIGHTS])
+{
+	float projw[MAX_GRID_WEIGHTS];
+	calculate_normal_weights(texels, ep0, ep1, grid, least_squares, projw);
+	quantize_weights(projw, grid_weight_count(grid), weight_range, weights);
+}
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// encode single partition
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// candidate blockmode uint4(weights quantmethod, endpoints quantmethod, weights range, endpoints quantmethod passed to encode_color)
+
+uint4 assemble_block(uint blockmode, uint color_endpoint_mode, uint partition_count, uint partition_index, uint4 ep_ise, uint4 wt_ise)
+{
+	uint4 phy_blk = uint4(0, 0, 0, 0);
+	// weights ise
+	phy_blk.w |= reverse_byte(wt_ise.x & 0xFF) << 24;
+	phy_blk.w |= reverse_byte((wt_ise.x >> 8) & 0xFF) << 16;
+	phy_blk.w |= reverse_byte((wt_ise.x >> 16) & 0xFF) << 8;
+	phy_blk.w |= reverse_byte((wt_ise.x >> 24) & 0xFF);
+
+	phy_blk.z |= reverse_byte(wt_ise.y & 0xFF) << 24;
+	phy_blk.z |= reverse_byte((wt_ise.y >> 8) & 0xFF) << 16;
+	phy_blk.z |= reverse_byte((wt_ise.y >> 16) & 0xFF) << 8;
+	phy_blk.z |= reverse_byte((wt_ise.y >> 24) & 0xFF);
+
+	phy_blk.y |= reverse_byte(wt_ise.z & 0xFF) << 24;
+	phy_blk.y |= reverse_byte((wt_ise.z >> 8) & 0xFF) << 16;
+	phy_blk.y |= reverse_byte((wt_ise.z >> 16) & 0xFF) << 8;
+	phy_blk.y |= reverse_byte((wt_ise.z >> 24) & 0xFF);
+
+	// blockmode & partition count
+	phy_blk.x = blockmode; // blockmode is 11 bit
+
+	if (partition_count > 1)
+	{
+		// partition index is 10 bit, the cem field is 6 bit: a 00 selector then the cem all partitions share
+		phy_blk.x |= ((partition_count - 1) & 0x3) << 11;
+		phy_blk.x |= (partition_index & 0x3FF) << 13;
+		phy_blk.x |= (color_endpoint_mode & 0xF) << 25;
+
+		// endpoints start from bits 29, up to 75 bits of them
+		phy_blk.x |= ep_ise.x << 29;
+		phy_blk.y |= (ep_ise.x >> 3) | (ep_ise.y << 29);
+		phy_blk.z |= (ep_ise.y >> 3) | (ep_ise.z << 29);
+		phy_blk.w |= (ep_ise.z >> 3);
+		return phy_blk;
+	}
+
+	// cem: color_endpoint_mode is 4 bit
+	phy_blk.x |= (color_endpoint_mode & 0xF) << 13;
+
+	// endpoints start from bits 17
+	phy_blk.x |= (ep_ise.x & 0x7FFF) << 17;
+	phy_blk.y |= ((ep_ise.x >> 15) & 0x1FFFF);
+	phy_blk.y |= (ep_ise.y & 0x7FFF) << 17;
+	phy_blk.z |= ((ep_ise.y >> 15) & 0x1FFFF);
+
+	return phy_blk;
+
+}
+
+/**
+ * the blockmode of "grid" with the given weight quant method, 0 (a reserved blockmode) when
+ * "Table C.2.8 - 2D Block Mode Layout" has no row for them. the rows the grids of weight_grids_<w>x<h> need:
+	------------------------------------------------------------------------
+	10  9   8   7   6   5   4   3   2   1   0   Width Height Notes
+	------------------------------------------------------------------------
+	D   H     B       A     R0  0   0   R2  R1  B + 4   A + 2
+	D   H     B       A     R0  0   1   R2  R1  B + 8   A + 2
+	  B     1   0     A     R0  R2  R1  0   0   A + 6   B + 6   D=0, H=0
+ * and the one of "Table C.2.13 - 3D Block Mode Layout" the 3d grids need:
+	------------------------------------------------------------------------
+	10  9   8   7   6   5   4   3   2   1   0   Width Height Depth
+	------------------------------------------------------------------------
+	D   H     B       A     R0    C     R2  R1  A + 2   B + 2  C + 2
+ */
+uint assemble_grid_blockmode(uint grid, uint weight_quantmethod)
+{
+	uint width = WEIGHT_GRIDS[grid].x;
+	uint height = WEIGHT_GRIDS[grid].y;
+
+	// more details from "Table C.2.7 - Weight Range Encodings"
+	uint h = (weight_quantmethod < 6) ? 0 : 1;	// "a precision bit H"
+	uint r = (weight_quantmethod % 6) + 2;		// "The weight ranges are encoded using a 3 bit value R"
+
+	// d, the dual plane bit, is 0: encode_dual_plane() sets it
+	uint blockmode = 0;
+#if BLOCK_DIM_Z > 1
+	uint depth = GRID_DEPTH(grid);
+	if (width >= 2 && width <= 5 && height >= 2 && height <= 5 && depth >= 2 && depth <= 5)
+	{
+		blockmode = (r >> 1) & 0x3;
+		blockmode |= (depth - 2) << 2;
+		blockmode |= (r & 0x1) << 4;
+		blockmode |= (width - 2) << 5;
+		blockmode |= (height - 2) << 7;
+		blockmode |= h << 9;
+	}
+#else
+	if (width >= 4 && width <= 11 && height >= 2 && height <= 5)
+	{
+		uint b = (width < 8) ? width - 4 : width - 8;
+		blockmode = (r >> 1) & 0x3;
+		blockmode |= (width < 8) ? 0 : (1 << 2);
+		blockmode |= (r & 0x1) << 4;
+		blockmode |= (height - 2) << 5;
+		blockmode |= b << 7;
+		blockmode |= h << 9;
+	}
+	else if (width >= 6 && width <= 9 && height >= 6 && height <= 9 && h == 0)
+	{
+		blockmode = ((r >> 1) & 0x1) << 2;
+		blockmode |= ((r >> 2) & 0x1) << 3;
+		blockmode |= (r & 0x1) << 4;
+		blockmode |= (width - 6) << 5;
+		blockmode |= 0x2 << 7;
+		blockmode |= (height - 6) << 9;
+	}
+#endif
+	return blockmode;
+}
+
+// the blockmode of DEFAULT_GRID, the first row of "Table C.2.8" or of "Table C.2.13"
+uint assemble_blockmode(uint weight_quantmethod)
+{
+	return assemble_grid_blockmode(DEFAULT_GRID, weight_quantmethod);
+}
+
+uint4 endpoint_ise(uint colorquant_index, float4 ep0, float4 ep1, uint endpoint_quantmethod, ASTC_OUT(uint) color_endpoint_mode)
+{
+	// encode endpoints
+	uint ep_quantized[8];
+	color_endpoint_mode = encode_color(colorquant_index, ep0, ep1, ep_quantized);
+#if !HAS_ALPHA
+	ep_quantized[6] = 0;
+	ep_quantized[7] = 0;
+#endif
+
+	// endpoints quantized ise encode
+	uint4 ep_ise = 0;
+	bise_endpoints(ep_quantized, endpoint_quantmethod, ep_ise);
+	return ep_ise;
+}
+
+uint4 quantized_weight_ise(uint wt_quantized[MAX_GRID_WEIGHTS], uint grid, uint weight_quantmethod)
+{
+	uint count = grid_weight_count(grid);
+	uint wt_scrambled[MAX_BLOCK_WEIGHTS];
+	for (uint i = 0; i < count; ++i)
+	{
+		int w = weight_quantmethod * WEIGHT_QUANTIZE_NUM + wt_quantized[i];
+		wt_scrambled[i] = scramble_table[w];
+	}
+
+	// weights quantized ise encode
+	uint4 wt_ise = 0;
+	bise_block_weights(wt_scrambled, count, weight_quantmethod, wt_ise);
+	return wt_ise;
+}
+
+uint4 weight_ise(float4 texels[BLOCK_SIZE], uint grid, bool least_squares, uint weight_range, float4 ep0, float4 ep1, uint  weight_quantmethod)
+{
+	// encode weights
+	uint wt_quantized[MAX_GRID_WEIGHTS];
+	calculate_quantized_weights(texels, grid, least_squares, weight_range, ep0, ep1, wt_quantized);
+	return quantized_weight_ise(wt_quantized, grid, weight_quantmethod);
+}
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// choose the quant methods
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// blockmode(11) + partition count(2) + cem(4) of a single partition block
+#define BLOCK_HEADER_BITS 17
+
+// "Table C.2.7": the weights of a legal block take 24 to 96 bits
+#define MIN_WEIGHT_BITS 24
+#define MAX_WEIGHT_BITS 96
+
+// the endpoint integers of "partition_count" partitions, CEM 8 takes 6 of them and CEM 12 takes 8
+uint endpoint_count(uint partition_count)
+{
+#if HAS_ALPHA
+	return partition_count * 8;
+#else
+	return partition_count * 6;
+#endif
+}
+
+// the endpoint quant method the decoder derives from the bits left after the weights,
+// QUANT_MAX when they are too few for QUANT_6
+uint endpoint_quantmethod_for_bits(uint count, uint bits)
+{
+	for (int q = QUANT_256; q >= QUANT_6; --q)
+	{
+		if (compute_ise_bitcount(count, q) <= bits)
+		{
+			return q;
+		}
+	}
+	return QUANT_MAX;
+}
+
+// the endpoints the weights are fitted to, the fast QUANT_256 path keeps the unrounded ones.
+// hdr endpoints move by more than the rounding in every mode, they are always decoded.
+void weighting_endpoints(uint endpoint_quantmethod, float4 ep0, float4 ep1, ASTC_OUT(float4) e0, ASTC_OUT(float4) e1)
+{
+	e0 = ep0;
+	e1 = ep1;
+	if (IS_HDR || endpoint_quantmethod != QUANT_256)
+	{
+		uint ep_quantized[8];
+		uint cem = encode_color(endpoint_quantmethod, ep0, ep1, ep_quantized);
+		decode_color(cem, endpoint_quantmethod, ep_quantized, e0, e1);
+	}
+}
+
+// squared error of every texel decoded with "e0"/"e1" and the weights of "grid" fitted to "w0"/"w1"
+float grid_error(float4 texels[BLOCK_SIZE], float4 e0, float4 e1, float4 w0, float4 w1, uint grid, uint weight_quantmethod)
+{
+	uint weight_range = quant_levels[weight_quantmethod] - 1;
+	uint weights[MAX_GRID_WEIGHTS];
+	calculate_quantized_weights(texels, grid, true, weight_range, w0, w1, weights);
+
+	float err = 0;
+	for (int i = 0; i < BLOCK_SIZE; ++i)
+	{
+		float w = infill_weight(weights, grid, weight_range, i);
+		float4 diff = texels[i] - (e0 + (e1 - e0) * w);
+#if !HAS_ALPHA
+		diff.w = 0;
+#endif
+		err += dot(diff, diff);
+	}
+	return err;
+}
+
+// squared error of every texel once encoded with "grid" and the given quant methods
+float quantmethod_error(float4 texels[BLOCK_SIZE], float4 ep0, float4 ep1, uint grid, uint weight_quantmethod, uint endpoint_quantmethod)
+{
+	uint ep_quantized[8];
+	uint cem = encode_color(endpoint_quantmethod, ep0, ep1, ep_quantized);
+	float4 e0, e1;
+	decode_color(cem, endpoint_quantmethod, ep_quantized, e0, e1);
+
+	float4 w0 = e0;
+	float4 w1 = e1;
+#if !IS_HDR
+	weighting_endpoints(endpoint_quantmethod, ep0, ep1, w0, w1);
+#endif
+	return grid_error(texels, e0, e1, w0, w1, grid, weight_quantmethod);
+}
+
+/**
+ * try up to "effort" (weight, endpoint) quant method pairs on every weight grid of the footprint besides
+ * the fast one, finest weights first. only the grid and the weight quant method are free, the decoder derives
+ * the endpoint quant method from the bits that are left. returns the error of the best one.
+ */
+float choose_best_quantmethod(float4 texels[BLOCK_SIZE], float4 ep0, float4 ep1, uint effort, ASTC_INOUT(uint) best_grid, ASTC_INOUT(uint4) best_blockmode)
+{
+	float best_err = quantmethod_error(texels, ep0, ep1, best_grid, best_blockmode.x, best_blockmode.y);
+	uint fast_grid = best_grid;
+	uint fast_wq = best_blockmode.x;
+	for (uint grid = 0; grid < WEIGHT_GRID_COUNT; ++grid)
+	{
+		uint tried = 0;
+		for (int wq = QUANT_32; wq >= QUANT_2 && tried < effort; --wq)
+		{
+			uint weight_bits = compute_ise_bitcount(grid_weight_count(grid), wq);
+			if (weight_bits < MIN_WEIGHT_BITS || weight_bits > MAX_WEIGHT_BITS || (grid == fast_grid && (uint)wq == fast_wq))
+			{
+				continue;
+			}
+
+			uint eq = endpoint_quantmethod_for_bits(endpoint_count(1), 128 - BLOCK_HEADER_BITS - weight_bits);
+			if (eq == QUANT_MAX || assemble_grid_blockmode(grid, wq) == 0)
+			{
+				continue;
+			}
+
+			++tried;
+			float err = quantmethod_error(texels, ep0, ep1, grid, wq, eq);
+			if (err < best_err)
+			{
+				best_err = err;
+				best_grid = grid;
+				best_blockmode = uint4(wq, eq, quant_levels[wq], eq);
+			}
+		}
+	}
+	return best_err;
+}
+
+/**
+ * the power iteration of the principal component converges poorly on some blocks, "ep0"/"ep1" become the endpoints
+ * of the candidate axis whose block encodes with the least error with "blockmode" on the default grid.
+ * returns that error.
+ */
+float choose_best_axis(float4 texels[BLOCK_SIZE], uint4 blockmode, ASTC_INOUT(float4) ep0, ASTC_INOUT(float4) ep1)
+{
+	float best_err = quantmethod_error(texels, ep0, ep1, DEFAULT_GRID, blockmode.x, blockmode.y);
+	for (uint axis = 0; axis < AXIS_CANDIDATES; ++axis)
+	{
+		float4 e0, e1;
+		candidate_axis(texels, axis, e0, e1);
+		float err = quantmethod_error(texels, e0, e1, DEFAULT_GRID, blockmode.x, blockmode.y);
+		if (err < best_err)
+		{
+			best_err = err;
+			ep0 = e0;
+			ep1 = e1;
+		}
+	}
+	return best_err;
+}
+
+// the most endpoint refinements refine_endpoints() makes, effort N makes up to N of them
+#define MAX_REFINE_ITERATIONS 4
+
+/**
+ * refit "ep0"/"ep1" to the quantized, infilled weights of the block: the two endpoints that minimize the
+ * squared error of every channel for those weights. the weights are quantized again for the new endpoints,
+ * it stops once the error of the encoded block stops going down. returns the error of "ep0"/"ep1".
+ */
+float refine_endpoints(float4 texels[BLOCK_SIZE], uint grid, uint4 blockmode, uint iterations, float err, ASTC_INOUT(float4) ep0, ASTC_INOUT(float4) ep1)
+{
+	uint weight_range = blockmode.z - 1;
+	for (uint iteration = 0; iteration < iterations; ++iteration)
+	{
+		float4 w0, w1;
+		weighting_endpoints(blockmode.y, ep0, ep1, w0, w1);
+		uint weights[MAX_GRID_WEIGHTS];
+		calculate_quantized_weights(texels, grid, true, weight_range, w0, w1, weights);
+
+		// the normal equations of texel = e0 * (1 - w) + e1 * w
+		float aa = 0;
+		float ab = 0;
+		float bb = 0;
+		float4 ta = 0;
+		float4 tb = 0;
+		for (int i = 0; i < BLOCK_SIZE; ++i)
+		{
+			float w = infill_weight(weights, grid, weight_range, i);
+			float v = 1.0f - w;
+			aa += v * v;
+			ab += v * w;
+			bb += w * w;
+			ta += texels[i] * v;
+			tb += texels[i] * w;
+		}
+
+		float det = aa * bb - ab * ab;
+		if (det < SMALL_VALUE * BLOCK_SIZE * BLOCK_SIZE)
+		{
+			break;
+		}
+		float4 e0 = clamp((ta * bb - tb * ab) / det, 0.0f, 255.0f);
+		float4 e1 = clamp((tb * aa - ta * ab) / det, 0.0f, 255.0f);
+#if !HAS_ALPHA
+		e0.w = 255.0f;
+		e1.w = 255.0f;
+#endif
+		// the darker endpoint first, like find_min_max()
+		if (e0.x + e0.y + e0.z > e1.x + e1.y + e1.z)
+		{
+			swap(e0, e1);
+		}
+
+		float refined_err = quantmethod_error(texels, e0, e1, grid, blockmode.x, blockmode.y);
+		if (refined_err >= err)
+		{
+			break;
+		}
+		err = refined_err;
+		ep0 = e0;
+		ep1 = e1;
+	}
+	return err;
+}
+
+/**
+ * hdr rgb: cem 7 takes 4 endpoint values instead of the 6 of cem 11, the bits it saves go to finer endpoints
+ * or weights. tries up to 1 + "effort" weight quant methods on "grid", finest first, "blk" becomes the best
+ * one when its error is below "best_err".
+ */
+void choose_hdr_scale(float4 texels[BLOCK_SIZE], float4 ep0, float4 ep1, uint grid, uint effort, ASTC_INOUT(float) best_err, ASTC_INOUT(uint4) blk)
+{
+	uint best_wq = QUANT_MAX;
+	uint best_eq = QUANT_MAX;
+	uint tried = 0;
+	for (int wq = QUANT_32; wq >= QUANT_2 && tried <= effort; --wq)
+	{
+		uint weight_bits = compute_ise_bitcount(grid_weight_count(grid), wq);
+		if (weight_bits < MIN_WEIGHT_BITS || weight_bits > MAX_WEIGHT_BITS)
+		{
+			continue;
+		}
+
+		uint eq = endpoint_quantmethod_for_bits(4, 128 - BLOCK_HEADER_BITS - weight_bits);
+		if (eq == QUANT_MAX || assemble_grid_blockmode(grid, wq) == 0)
+		{
+			continue;
+		}
+
+		++tried;
+		uint ep_quantized[8];
+		encode_hdr_scale_color(eq, ep0, ep1, ep_quantized);
+		float4 e0, e1;
+		decode_color(CEM_HDR_RGB_SCALE, eq, ep_quantized, e0, e1);
+		float err = grid_error(texels, e0, e1, e0, e1, grid, wq);
+		if (err < best_err)
+		{
+			best_err = err;
+			best_wq = wq;
+			best_eq = eq;
+		}
+	}
+	if (best_wq == QUANT_MAX)
+	{
+		return;
+	}
+
+	// the last 2 values stay 0, the ise of 6 values starts with the one of 4
+	uint ep_quantized[8];
+	encode_hdr_scale_color(best_eq, ep0, ep1, ep_quantized);
+	float4 e0, e1;
+	decode_color(CEM_HDR_RGB_SCALE, best_eq, ep_quantized, e0, e1);
+	uint4 ep_ise = 0;
+	bise_endpoints(ep_quantized, best_eq, ep_ise);
+	uint4 wt_ise = weight_ise(texels, grid, true, quant_levels[best_wq] - 1, e0, e1, best_wq);
+	blk = assemble_block(assemble_grid_blockmode(grid, best_wq), CEM_HDR_RGB_SCALE, 1, 0, ep_ise, wt_ise);
+}
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// two partitions
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// blockmode(11) + partition count(2) + partition index(10) + cem(6) of a multi partition block
+#define PARTITION_HEADER_BITS 29
+
+// the most partition patterns encode_block tries, the closest ones to the clustering of the texels
+#define PARTITION_CANDIDATES 4
+
+// the pattern of a single partition block, every texel in partition 0
+#define PARTITION_NONE 0xFFFFFFFF
+
+// the words of a pattern of PARTITION_2_TABLE, texel i is bit (i & 31) of word (i >> 5)
+// and the partition index sits in the top 10 bits of the last word
+#define PARTITION_WORDS PARTITION_2_WORDS
+#define PARTITION_INDEX_SHIFT 22
+#define PARTITION_TEXEL_MASK 0x003FFFFF
+
+uint partition_word(uint p, uint w)
+{
+	uint k = p * PARTITION_WORDS + w;
+	return PARTITION_2_TABLE[k >> 2][k & 3];
+}
+
+uint partition_index(uint p)
+{
+	return partition_word(p, PARTITION_WORDS - 1) >> PARTITION_INDEX_SHIFT;
+}
+
+uint texel_partition(uint p, uint i)
+{
+	if (p == PARTITION_NONE)
+	{
+		return 0;
+	}
+	return (partition_word(p, i >> 5) >> (i & 31)) & 1;
+}
+
+// the texels off pattern "p", whichever way round its partitions are
+uint partition_mismatch(uint p, uint cluster[PARTITION_WORDS])
+{
+	uint diff = 0;
+	for (uint w = 0; w < PARTITION_WORDS; ++w)
+	{
+		uint bits = partition_word(p, w) ^ cluster[w];
+		diff += countbits((w == PARTITION_WORDS - 1) ? bits & PARTITION_TEXEL_MASK : bits);
+	}
+	return (diff < BLOCK_SIZE - diff) ? diff : BLOCK_SIZE - diff;
+}
+
+// 2-means of the texels starting from the endpoints of the principal axis, as the texel bits of a pattern
+void cluster_texels(float4 texels[BLOCK_SIZE], float4 ep0, float4 ep1, ASTC_OUT_ARRAY uint cluster[PARTITION_WORDS])
+{
+	float4 c0 = ep0;
+	float4 c1 = ep1;
+	uint w = 0;
+	for (int iter = 0; iter < 3; ++iter)
+	{
+		for (w = 0; w < PARTITION_WORDS; ++w)
+		{
+			cluster[w] = 0;
+		}
+		float4 sum0 = 0;
+		float4 sum1 = 0;
+		float n0 = 0;
+		float n1 = 0;
+		for (int i = 0; i < BLOCK_SIZE; ++i)
+		{
+			float4 d0 = texels[i] - c0;
+			float4 d1 = texels[i] - c1;
+#if !HAS_ALPHA
+			d0.w = 0;
+			d1.w = 0;
+#endif
+			if (dot(d1, d1) < dot(d0, d0))
+			{
+				cluster[i >> 5] |= 1u << (i & 31);
+				sum1 += texels[i];
+				n1 += 1;
+			}
+			else
+			{
+				sum0 += texels[i];
+				n0 += 1;
+			}
+		}
+		if (n0 > 0)
+		{
+			c0 = sum0 / n0;
+		}
+		if (n1 > 0)
+		{
+			c1 = sum1 / n1;
+		}
+	}
+}
+
+void partition_endpoints(float4 texels[BLOCK_SIZE], uint pattern, uint part, ASTC_OUT(float4) e0, ASTC_OUT(float4) e1)
+{
+	int i = 0;
+	float4 pt_mean = 0;
+	float n = 0;
+	for (i = 0; i < BLOCK_SIZE; ++i)
+	{
+		if (texel_partition(pattern, i) == part)
+		{
+			pt_mean += texels[i];
+			n += 1;
+		}
+	}
+	pt_mean /= n;
+
+	// the texels of the other partition move to the mean, they add nothing to the covariance
+	// and project to the middle of the axis
+	float4 part_texels[BLOCK_SIZE];
+	for (i = 0; i < BLOCK_SIZE; ++i)
+	{
+		part_texels[i] = (texel_partition(pattern, i) == part) ? texels[i] : pt_mean;
+	}
+	principal_component_analysis(part_texels, e0, e1);
+}
+
+/**
+ * quantize the endpoints of both partitions in the order of the block, "e0"/"e1" get them decoded.
+ * both partitions share the cem (the cem selector stays 00), the one with the smaller endpoint_error() is returned.
+ */
+uint encode_partition_color(uint qm_index, float4 ep0[2], float4 ep1[2],
+	ASTC_OUT_ARRAY uint endpoint_quantized[16],
+	ASTC_OUT_ARRAY float4 e0[2],
+	ASTC_OUT_ARRAY float4 e1[2])
+{
+	int i = 0;
+	for (i = 0; i < 16; ++i)
+	{
+		endpoint_quantized[i] = 0;
+	}
+
+	uint direct[16];
+	uint base_offset[16];
+	float direct_err = 0;
+	float base_offset_err = 0;
+	uint count = endpoint_count(1);
+	uint part = 0;
+	for (part = 0; part < 2; ++part)
+	{
+		uint ep_quantized[8];
+		direct_err += encode_color_cem(direct_cem(), qm_index, ep0[part], ep1[part], ep_quantized);
+		for (i = 0; i < (int)count; ++i)
+		{
+			direct[part * count + i] = ep_quantized[i];
+		}
+#if IS_HDR
+		// hdr has no base+offset cem, the direct values stay
+		base_offset_err = direct_err;
+#else
+		base_offset_err += encode_color_cem(base_offset_cem(), qm_index, ep0[part], ep1[part], ep_quantized);
+#endif
+		for (i = 0; i < (int)count; ++i)
+		{
+			base_offset[part * count + i] = ep_quantized[i];
+		}
+	}
+
+	uint cem = (base_offset_err < direct_err) ? base_offset_cem() : direct_cem();
+	for (i = 0; i < (int)(2 * count); ++i)
+	{
+		endpoint_quantized[i] = (cem == direct_cem()) ? direct[i] : base_offset[i];
+	}
+
+	for (part = 0; part < 2; ++part)
+	{
+		uint ep_quantized[8];
+		for (i = 0; i < 8; ++i)
+		{
+			ep_quantized[i] = (i < (int)count) ? endpoint_quantized[part * count + i] : 0;
+		}
+		decode_color(cem, qm_index, ep_quantized, e0[part], e1[part]);
+	}
+	return cem;
+}
+
+// the weight of every texel on the endpoints of its own partition, fitted by the weight grid
+void calculate_partition_weights(float4 texels[BLOCK_SIZE], uint pattern, float4 e0[2], float4 e1[2],
+	uint grid,
+	uint weight_range,
+	ASTC_OUT_ARRAY uint weights[MAX_GRID_WEIGHTS])
+{
+	int i = 0;
+	float texel_weights[BLOCK_SIZE];
+	for (i = 0; i < BLOCK_SIZE; ++i)
+	{
+		uint part = texel_partition(pattern, i);
+		float4 vec_k = e1[part] - e0[part];
+#if !HAS_ALPHA
+		vec_k.w = 0;
+#endif
+		float len2 = dot(vec_k, vec_k);
+		float w = (len2 < SMALL_VALUE) ? 0.0f : dot(texels[i] - e0[part], vec_k) / len2;
+		texel_weights[i] = clamp(w, 0.0f, 1.0f);
+	}
+
+	int count = grid_weight_count(grid);
+	float grid_weights[MAX_GRID_WEIGHTS];
+	if (is_decimated_grid(grid))
+	{
+		fit_grid_weights(texel_weights, grid, grid_weights);
+	}
+	for (i = 0; i < count; ++i)
+	{
+		float w = texel_weights[i];
+		if (is_decimated_grid(grid))
+		{
+			w = clamp(grid_weights[i], 0.0f, 1.0f);
+		}
+		weights[i] = quantize_weight(weight_range, w);
+	}
+}
+
+// squared error of every texel decoded
+float block_error(float4 texels[BLOCK_SIZE], uint pattern, float4 e0[2], float4 e1[2], uint grid, uint weights[MAX_GRID_WEIGHTS], uint weight_range)
+{
+	float err = 0;
+	for (int i = 0; i < BLOCK_SIZE; ++i)
+	{
+		float w = infill_weight(weights, grid, weight_range, i);
+		uint part = texel_partition(pattern, i);
+		float4 diff = texels[i] - (e0[part] + (e1[part] - e0[part]) * w);
+#if !HAS_ALPHA
+		diff.w = 0;
+#endif
+		err += dot(diff, diff);
+	}
+	return err;
+}
+
+/**
+ * encode the texels with the two partitions of "pattern" and the best (weight, endpoint) quant methods
+ * that fit, returns the block_error() of "blk".
+ */
+float encode_partitions(float4 texels[BLOCK_SIZE], uint pattern, ASTC_OUT(uint4) blk)
+{
+	float4 ep0[2];
+	float4 ep1[2];
+	partition_endpoints(texels, pattern, 0, ep0[0], ep1[0]);
+	partition_endpoints(texels, pattern, 1, ep0[1], ep1[1]);
+
+	float best_err = 1e31f;
+	uint best_wq = QUANT_MAX;
+	uint best_eq = QUANT_MAX;
+	for (int wq = QUANT_32; wq >= QUANT_2; --wq)
+	{
+		uint weight_bits = compute_ise_bitcount(DEFAULT_GRID_WEIGHTS, wq);
+		if (weight_bits < MIN_WEIGHT_BITS || weight_bits > MAX_WEIGHT_BITS)
+		{
+			continue;
+		}
+
+		uint eq = endpoint_quantmethod_for_bits(endpoint_count(2), 128 - PARTITION_HEADER_BITS - weight_bits);
+		if (eq == QUANT_MAX)
+		{
+			continue;
+		}
+
+		uint ep_quantized[16];
+		float4 e0[2];
+		float4 e1[2];
+		encode_partition_color(eq, ep0, ep1, ep_quantized, e0, e1);
+
+		uint weight_range = quant_levels[wq] - 1;
+		uint weights[MAX_GRID_WEIGHTS];
+		calculate_partition_weights(texels, pattern, e0, e1, DEFAULT_GRID, weight_range, weights);
+		float err = block_error(texels, pattern, e0, e1, DEFAULT_GRID, weights, weight_range);
+		if (err < best_err)
+		{
+			best_err = err;
+			best_wq = wq;
+			best_eq = eq;
+		}
+	}
+
+	blk = 0;
+	if (best_wq == QUANT_MAX)
+	{
+		return best_err;
+	}
+
+	uint ep_quantized[16];
+	float4 e0[2];
+	float4 e1[2];
+	uint color_endpoint_mode = encode_partition_color(best_eq, ep0, ep1, ep_quantized, e0, e1);
+	uint4 ep_ise = 0;
+	bise_partition_endpoints(ep_quantized, best_eq, ep_ise);
+
+	uint weights[MAX_GRID_WEIGHTS];
+	calculate_partition_weights(texels, pattern, e0, e1, DEFAULT_GRID, quant_levels[best_wq] - 1, weights);
+	uint4 wt_ise = quantized_weight_ise(weights, DEFAULT_GRID, best_wq);
+
+	blk = assemble_block(assemble_blockmode(best_wq), color_endpoint_mode, 2, partition_index(pattern), ep_ise, wt_ise);
+	return best_err;
+}
+
+/**
+ * try the partition patterns the closest to a 2-means clustering of the texels, up to "effort" of them,
+ * "blk" becomes the best one when its error is below "best_err".
+ */
+void choose_best_partitioning(float4 texels[BLOCK_SIZE], float4 ep0, float4 ep1, uint effort, ASTC_INOUT(float) best_err, ASTC_INOUT(uint4) blk)
+{
+	uint cluster[PARTITION_WORDS];
+	cluster_texels(texels, ep0, ep1, cluster);
+
+	// the candidates sorted by their mismatch
+	uint candidates[PARTITION_CANDIDATES];
+	uint mismatches[PARTITION_CANDIDATES];
+	int k = 0;
+	for (k = 0; k < PARTITION_CANDIDATES; ++k)
+	{
+		candidates[k] = 0;
+		mismatches[k] = BLOCK_SIZE;
+	}
+
+	for (uint p = 0; p < PARTITION_2_COUNT; ++p)
+	{
+		uint miss = partition_mismatch(p, cluster);
+		if (miss >= mismatches[PARTITION_CANDIDATES - 1])
+		{
+			continue;
+		}
+		for (k = PARTITION_CANDIDATES - 1; k > 0 && mismatches[k - 1] > miss; --k)
+		{
+			candidates[k] = candidates[k - 1];
+			mismatches[k] = mismatches[k - 1];
+		}
+		candidates[k] = p;
+		mismatches[k] = miss;
+	}
+
+	uint tries = (effort < PARTITION_CANDIDATES) ? effort : PARTITION_CANDIDATES;
+	for (k = 0; k < (int)tries; ++k)
+	{
+		if (mismatches[k] == BLOCK_SIZE)
+		{
+			break;
+		}
+		uint4 part_blk;
+		float err = encode_partitions(texels, candidates[k], part_blk);
+		if (err < best_err)
+		{
+			best_err = err;
+			blk = part_blk;
+		}
+	}
+}
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// dual plane
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// the color component selector below the weights of a dual plane block
+#define CCS_BITS 2
+
+/**
+ * the channel the least correlated with the others, the one a second weight plane helps the most.
+ * 4 when none of the channels varies.
+ */
+uint dual_plane_channel(float4 texels[BLOCK_SIZE])
+{
+	float4 pt_mean = 0;
+	for (int i = 0; i < BLOCK_SIZE; ++i)
+	{
+		pt_mean += texels[i];
+	}
+	pt_mean /= BLOCK_SIZE;
+	float4x4 cov = covariance_matrix(texels, pt_mean);
+
+#if HAS_ALPHA
+	uint channels = 4;
+#else
+	uint channels = 3;
+#endif
+
+	uint best_channel = 4;
+	float best_corr = 1e31f;
+	for (uint c = 0; c < channels; ++c)
+	{
+		float var_c = cov[c][c];
+		if (var_c < SMALL_VALUE)
+		{
+			continue;
+		}
+
+		// the largest squared correlation coefficient with another channel
+		float corr = 0;
+		for (uint j = 0; j < channels; ++j)
+		{
+			float var_j = cov[j][j];
+			if (j != c && var_j >= SMALL_VALUE)
+			{
+				corr = max(corr, cov[c][j] * cov[c][j] / (var_c * var_j));
+			}
+		}
+		if (corr < best_corr)
+		{
+			best_corr = corr;
+			best_channel = c;
+		}
+	}
+	return best_channel;
+}
+
+// squared error of every texel decoded, "channel" takes its weights from the second plane
+float dual_plane_error(float4 texels[BLOCK_SIZE], float4 e0, float4 e1, uint channel,
+	uint weights0[MAX_GRID_WEIGHTS],
+	uint weights1[MAX_GRID_WEIGHTS],
+	uint weight_range)
+{
+	float err = 0;
+	for (int i = 0; i < BLOCK_SIZE; ++i)
+	{
+		float4 w = infill_weight(weights0, DEFAULT_GRID, weight_range, i);
+		w[channel] = infill_weight(weights1, DEFAULT_GRID, weight_range, i);
+		float4 diff = texels[i] - (e0 + (e1 - e0) * w);
+#if !HAS_ALPHA
+		diff.w = 0;
+#endif
+		err += dot(diff, diff);
+	}
+	return err;
+}
+
+// the weights of the two planes against the decoded endpoints "e0"/"e1"
+void calculate_dual_plane_weights(float4 texels[BLOCK_SIZE], float4 e0, float4 e1, uint channel,
+	uint weight_range,
+	ASTC_OUT_ARRAY uint weights0[MAX_GRID_WEIGHTS],
+	ASTC_OUT_ARRAY uint weights1[MAX_GRID_WEIGHTS])
+{
+	// each plane sees only its own channels of the endpoints
+	float4 mask = 0;
+	mask[channel] = 1.0f;
+	float4 plane_e0[2];
+	float4 plane_e1[2];
+	plane_e0[0] = e0 - e0 * mask;
+	plane_e1[0] = e1 - e1 * mask;
+	plane_e0[1] = plane_e0[0];
+	plane_e1[1] = plane_e1[0];
+	calculate_partition_weights(texels, PARTITION_NONE, plane_e0, plane_e1, DEFAULT_GRID, weight_range, weights0);
+
+	plane_e0[0] = e0 * mask;
+	plane_e1[0] = e1 * mask;
+	plane_e0[1] = plane_e0[0];
+	plane_e1[1] = plane_e1[0];
+	calculate_partition_weights(texels, PARTITION_NONE, plane_e0, plane_e1, DEFAULT_GRID, weight_range, weights1);
+}
+
+/**
+ * encode the texels with "channel" on a second weight plane and the best (weight, endpoint) quant methods
+ * that fit, returns the error of "blk".
+ */
+float encode_dual_plane(float4 texels[BLOCK_SIZE], uint channel, ASTC_OUT(uint4) blk)
+{
+	// the principal axis of the other channels, "channel" spans its own range
+	float4 plane_texels[BLOCK_SIZE];
+	float cmin = 1e31f;
+	float cmax = -1e31f;
+	for (int i = 0; i < BLOCK_SIZE; ++i)
+	{
+		float4 texel = texels[i];
+		cmin = min(cmin, texel[channel]);
+		cmax = max(cmax, texel[channel]);
+		texel[channel] = 0;
+		plane_texels[i] = texel;
+	}
+	float4 ep0, ep1;
+	principal_component_analysis(plane_texels, ep0, ep1);
+	ep0[channel] = cmin;
+	ep1[channel] = cmax;
+
+	float best_err = 1e31f;
+	uint best_wq = QUANT_MAX;
+	uint best_eq = QUANT_MAX;
+	for (int wq = QUANT_32; wq >= QUANT_2; --wq)
+	{
+		uint weight_bits = compute_ise_bitcount(2 * DEFAULT_GRID_WEIGHTS, wq);
+		if (weight_bits < MIN_WEIGHT_BITS || weight_bits > MAX_WEIGHT_BITS)
+		{
+			continue;
+		}
+
+		uint eq = endpoint_quantmethod_for_bits(endpoint_count(1), 128 - BLOCK_HEADER_BITS - CCS_BITS - weight_bits);
+		if (eq == QUANT_MAX)
+		{
+			continue;
+		}
+
+		uint ep_quantized[8];
+		uint cem = encode_color(eq, ep0, ep1, ep_quantized);
+		float4 e0, e1;
+		decode_color(cem, eq, ep_quantized, e0, e1);
+
+		uint weight_range = quant_levels[wq] - 1;
+		uint weights0[MAX_GRID_WEIGHTS];
+		uint weights1[MAX_GRID_WEIGHTS];
+		calculate_dual_plane_weights(texels, e0, e1, channel, weight_range, weights0, weights1);
+		float err = dual_plane_error(texels, e0, e1, channel, weights0, weights1, weight_range);
+		if (err < best_err)
+		{
+			best_err = err;
+			best_wq = wq;
+			best_eq = eq;
+		}
+	}
+
+	blk = 0;
+	if (best_wq == QUANT_MAX)
+	{
+		return best_err;
+	}
+
+	uint ep_quantized[8];
+	uint color_endpoint_mode = encode_color(best_eq, ep0, ep1, ep_quantized);
+	float4 e0, e1;
+	decode_color(color_endpoint_mode, best_eq, ep_quantized, e0, e1);
+#if !HAS_ALPHA
+	ep_quantized[6] = 0;
+	ep_quantized[7] = 0;
+#endif
+	uint4 ep_ise = 0;
+	bise_endpoints(ep_quantized, best_eq, ep_ise);
+
+	// the weights of the two planes interleave
+	uint weights0[MAX_GRID_WEIGHTS];
+	uint weights1[MAX_GRID_WEIGHTS];
+	calculate_dual_plane_weights(texels, e0, e1, channel, quant_levels[best_wq] - 1, weights0, weights1);
+	uint wt_quantized[MAX_BLOCK_WEIGHTS];
+	for (int k = 0; k < DEFAULT_GRID_WEIGHTS; ++k)
+	{
+		wt_quantized[2 * k] = scramble_table[best_wq * WEIGHT_QUANTIZE_NUM + weights0[k]];
+		wt_quantized[2 * k + 1] = scramble_table[best_wq * WEIGHT_QUANTIZE_NUM + weights1[k]];
+	}
+	uint4 wt_ise = 0;
+	bise_block_weights(wt_quantized, 2 * DEFAULT_GRID_WEIGHTS, best_wq, wt_ise);
+
+	blk = assemble_block(assemble_blockmode(best_wq) | (1 << 10), color_endpoint_mode, 1, 0, ep_ise, wt_ise);
+
+	// the ccs sits right below the weights
+	uint ccs_pos = 128 - CCS_BITS - compute_ise_bitcount(2 * DEFAULT_GRID_WEIGHTS, best_wq);
+	orbits8_ptr(blk, ccs_pos, channel, CCS_BITS);
+	return best_err;
+}
+
+// "blk" becomes the dual plane encoding when its error is below "best_err"
+void choose_dual_plane(float4 texels[BLOCK_SIZE], ASTC_INOUT(float) best_err, ASTC_INOUT(uint4) blk)
+{
+	uint channel = dual_plane_channel(texels);
+	if (channel == 4)
+	{
+		return;
+	}
+
+	uint4 dual_blk;
+	float err = encode_dual_plane(texels, channel, dual_blk);
+	if (err < best_err)
+	{
+		best_err = err;
+		blk = dual_blk;
+	}
+}
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// luminance endpoints of gray blocks
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+bool is_gray_block(float4 texels[BLOCK_SIZE])
+{
+	// cem 0/4 are ldr, gray hdr blocks keep cem 11/15
+	if (IS_HDR)
+	{
+		return false;
+	}
+	for (int i = 0; i < BLOCK_SIZE; ++i)
+	{
+		if (texels[i].x != texels[i].y || texels[i].x != texels[i].z)
+		{
+			return false;
+		}
+	}
+	return true;
+}
+
+/**
+ * the luminance range of a gray block, with alpha the principal axis of (luminance, alpha) in closed form.
+ * the endpoints come back as rgba with r == g == b.
+ */
+void luminance_endpoints(float4 texels[BLOCK_SIZE], ASTC_OUT(float4) e0, ASTC_OUT(float4) e1)
+{
+	int i = 0;
+#if HAS_ALPHA
+	float4 pt_mean = 0;
+	for (i = 0; i < BLOCK_SIZE; ++i)
+	{
+		pt_mean += texels[i];
+	}
+	pt_mean /= BLOCK_SIZE;
+
+	float cov_ll = 0;
+	float cov_la = 0;
+	float cov_aa = 0;
+	for (i = 0; i < BLOCK_SIZE; ++i)
+	{
+		float4 texel = texels[i] - pt_mean;
+		cov_ll += texel.x * texel.x;
+		cov_la += texel.x * texel.w;
+		cov_aa += texel.w * texel.w;
+	}
+
+	// the major axis of the 2x2 covariance
+	float theta = 0.5f * atan2(2.0f * cov_la, cov_ll - cov_aa);
+	float4 vec_k = float4(cos(theta), cos(theta), cos(theta), sin(theta));
+
+	float a = 1e31f;
+	float b = -1e31f;
+	for (i = 0; i < BLOCK_SIZE; ++i)
+	{
+		float4 texel = texels[i] - pt_mean;
+		float t = texel.x * vec_k.x + texel.w * vec_k.w;
+		a = min(a, t);
+		b = max(b, t);
+	}
+	e0 = clamp(vec_k * a + pt_mean, 0.0f, 255.0f);
+	e1 = clamp(vec_k * b + pt_mean, 0.0f, 255.0f);
+#else
+	float lmin = 1e31f;
+	float lmax = -1e31f;
+	for (i = 0; i < BLOCK_SIZE; ++i)
+	{
+		lmin = min(lmin, texels[i].x);
+		lmax = max(lmax, texels[i].x);
+	}
+	e0 = float4(lmin, lmin, lmin, 255.0f);
+	e1 = float4(lmax, lmax, lmax, 255.0f);
+#endif
+}
+
+// CEM 0 takes (l0, l1), CEM 4 (l0, l1, a0, a1). "e0"/"e1" get them decoded
+void encode_luminance_color(uint qm_index, float4 ep0, float4 ep1,
+	ASTC_OUT_ARRAY uint endpoint_quantized[8],
+	ASTC_OUT(float4) e0,
+	ASTC_OUT(float4) e1)
+{
+	for (int i = 0; i < 8; ++i)
+	{
+		endpoint_quantized[i] = 0;
+	}
+	endpoint_quantized[0] = quantize_color(qm_index, ep0.x);
+	endpoint_quantized[1] = quantize_color(qm_index, ep1.x);
+	float l0 = unquantize_color(qm_index, endpoint_quantized[0]);
+	float l1 = unquantize_color(qm_index, endpoint_quantized[1]);
+#if HAS_ALPHA
+	endpoint_quantized[2] = quantize_color(qm_index, ep0.w);
+	endpoint_quantized[3] = quantize_color(qm_index, ep1.w);
+	e0 = float4(l0, l0, l0, unquantize_color(qm_index, endpoint_quantized[2]));
+	e1 = float4(l1, l1, l1, unquantize_color(qm_index, endpoint_quantized[3]));
+#else
+	e0 = float4(l0, l0, l0, 255.0f);
+	e1 = float4(l1, l1, l1, 255.0f);
+#endif
+}
+
+// the block_error() of a gray block with luminance endpoints "ep0"/"ep1" and the given quant methods
+float luminance_error(float4 texels[BLOCK_SIZE], float4 ep0, float4 ep1, uint weight_quantmethod, uint endpoint_quantmethod)
+{
+	uint ep_quantized[8];
+	float4 e0[2];
+	float4 e1[2];
+	encode_luminance_color(endpoint_quantmethod, ep0, ep1, ep_quantized, e0[0], e1[0]);
+	e0[1] = e0[0];
+	e1[1] = e1[0];
+
+	uint weight_range = quant_levels[weight_quantmethod] - 1;
+	uint weights[MAX_GRID_WEIGHTS];
+	calculate_partition_weights(texels, PARTITION_NONE, e0, e1, DEFAULT_GRID, weight_range, weights);
+	return block_error(texels, PARTITION_NONE, e0, e1, DEFAULT_GRID, weights, weight_range);
+}
+
+/**
+ * encode a gray block with CEM 0, or CEM 4 with alpha. the 2 or 4 endpoint integers leave room for finer
+ * weights than rgb(a) blocks get, "effort" more weight quant methods are tried besides that default.
+ * returns the error of "blk" when "measure" is set or "effort" is not 0.
+ */
+float encode_luminance(float4 texels[BLOCK_SIZE], uint effort, bool measure, ASTC_OUT(uint4) blk)
+{
+	float4 ep0, ep1;
+	luminance_endpoints(texels, ep0, ep1);
+
+	// the 27 weights of the 3d DEFAULT_GRID only fit coarser ones
+#if HAS_ALPHA
+	uint color_endpoint_mode = CEM_LDR_LUMINANCE_ALPHA_DIRECT;
+	uint best_wq = (BLOCK_DIM_Z > 1) ? QUANT_8 : QUANT_24;
+	uint count = 4;
+#else
+	uint color_endpoint_mode = CEM_LDR_LUMINANCE_DIRECT;
+	uint best_wq = (BLOCK_DIM_Z > 1) ? QUANT_10 : QUANT_32;
+	uint count = 2;
+#endif
+	uint best_eq = endpoint_quantmethod_for_bits(count, 128 - BLOCK_HEADER_BITS - compute_ise_bitcount(DEFAULT_GRID_WEIGHTS, best_wq));
+	float best_err = (effort > 0 || measure) ? luminance_error(texels, ep0, ep1, best_wq, best_eq) : 0.0f;
+
+	uint tried = 0;
+	for (int wq = QUANT_32; wq >= QUANT_2 && tried < effort; --wq)
+	{
+		uint weight_bits = compute_ise_bitcount(DEFAULT_GRID_WEIGHTS, wq);
+		if (weight_bits < MIN_WEIGHT_BITS || weight_bits > MAX_WEIGHT_BITS || (uint)wq == best_wq)
+		{
+			continue;
+		}
+
+		uint eq = endpoint_quantmethod_for_bits(count, 128 - BLOCK_HEADER_BITS - weight_bits);
+		if (eq == QUANT_MAX)
+		{
+			continue;
+		}
+
+		++tried;
+		float err = luminance_error(texels, ep0, ep1, wq, eq);
+		if (err < best_err)
+		{
+			best_err = err;
+			best_wq = wq;
+			best_eq = eq;
+		}
+	}
+
+	uint ep_quantized[8];
+	float4 e0[2];
+	float4 e1[2];
+	encode_luminance_color(best_eq, ep0, ep1, ep_quantized, e0[0], e1[0]);
+	e0[1] = e0[0];
+	e1[1] = e1[0];
+	uint4 ep_ise = 0;
+	bise_endpoints(ep_quantized, best_eq, ep_ise);
+
+	uint weights[MAX_GRID_WEIGHTS];
+	calculate_partition_weights(texels, PARTITION_NONE, e0, e1, DEFAULT_GRID, quant_levels[best_wq] - 1, weights);
+	uint4 wt_ise = quantized_weight_ise(weights, DEFAULT_GRID, best_wq);
+
+	blk = assemble_block(assemble_blockmode(best_wq), color_endpoint_mode, 1, 0, ep_ise, wt_ise);
+	return best_err;
+}
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// void-extent blocks
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// the first 64 bits of a 2d ldr void-extent block: blockmode 0x1FC, ldr, and all extent coordinates set (no extent).
+// the 6 coordinates of a 3d one take the same bits
+#define VOID_EXTENT_HEADER_LO 0xFFFFFDFC
+#define VOID_EXTENT_HEADER_HI 0xFFFFFFFF
+// the same with the hdr bit 9 set, the color is stored as half floats
+#define VOID_EXTENT_HEADER_HDR_LO 0xFFFFFFFC
+
+/**
+ * every channel spans at most "tolerance" over the block, "color" gets the middle of the spans.
+ * alpha only counts with HAS_ALPHA, it is 255 otherwise like the endpoints.
+ */
+bool is_void_extent_block(float4 texels[BLOCK_SIZE], float tolerance, ASTC_OUT(float4) color)
+{
+	float4 cmin = texels[0];
+	float4 cmax = texels[0];
+	for (int i = 1; i < BLOCK_SIZE; ++i)
+	{
+		float4 texel = texels[i];
+		cmin = float4(min(cmin.x, texel.x), min(cmin.y, texel.y), min(cmin.z, texel.z), min(cmin.w, texel.w));
+		cmax = float4(max(cmax.x, texel.x), max(cmax.y, texel.y), max(cmax.z, texel.z), max(cmax.w, texel.w));
+	}
+
+	float4 span = cmax - cmin;
+	color = (cmin + cmax) * 0.5f;
+#if !HAS_ALPHA
+	span.w = 0;
+	color.w = 255.0f;
+#endif
+	return max(max(span.x, span.y), max(span.z, span.w)) <= tolerance;
+}
+
+// every texel of the block decodes to "color", stored as unorm16, or as half floats for hdr
+uint4 encode_void_extent(float4 color)
+{
+#if IS_HDR
+	uint4 c = uint4(lns_to_half(color.x), lns_to_half(color.y), lns_to_half(color.z), lns_to_half(color.w));
+#if !HAS_ALPHA
+	c.w = 0x3C00;
+#endif
+	return uint4(VOID_EXTENT_HEADER_HDR_LO, VOID_EXTENT_HEADER_HI, c.x | (c.y << 16), c.z | (c.w << 16));
+#else
+	uint4 c = uint4(round(clamp(color, 0.0f, 255.0f) * 257.0f));
+	return uint4(VOID_EXTENT_HEADER_LO, VOID_EXTENT_HEADER_HI, c.x | (c.y << 16), c.z | (c.w << 16));
+#endif
+}
+
+/**
+ * "effort": how many more quant methods per weight grid, endpoint refinements and partition patterns to try,
+ * 0 is the fixed fast blockmode.
+ * "dual_plane": also try a second weight plane for the least correlated channel.
+ * "void_extent_tolerance": blocks whose channels span at most that much become one color void-extent blocks.
+ */
+uint4 encode_block(float4 texels[BLOCK_SIZE], uint effort, bool dual_plane, float void_extent_tolerance)
+{
+#if IS_HDR
+	// the decoder interpolates the log-like values of hdr_texel(), fitting the block to them keeps the error relative
+	for (int i = 0; i < BLOCK_SIZE; ++i)
+	{
+		texels[i] = hdr_texel(texels[i]);
+	}
+#endif
+
+	// constant blocks need none of the work below
+	float4 color;
+	if (is_void_extent_block(texels, void_extent_tolerance, color))
+	{
+		return encode_void_extent(color);
+	}
+
+	// gray blocks skip the rgb(a) axis search, their 1d fit is enough
+	uint4 gray_blk = 0;
+	float gray_err = 1e31f;
+	bool gray = is_gray_block(texels);
+	if (gray)
+	{
+		gray_err = encode_luminance(texels, effort, dual_plane, gray_blk);
+		if (effort == 0 && !dual_plane)
+		{
+			return gray_blk;
+		}
+	}
+
+	float4 ep0, ep1;
+	principal_component_analysis(texels, ep0, ep1);
+
+	// endpoints_quant是根据整个128bits减去weights的编码占用和其他配置占用后剩余的bits位数来确定的。
+	// for fast compression!
+	uint4 best_blockmode = uint4(FAST_WEIGHT_QUANT, QUANT_256, quant_levels[FAST_WEIGHT_QUANT], QUANT_256);
+	uint best_grid = DEFAULT_GRID;
+
+	float best_err = 0;
+	if (effort > 0)
+	{
+		uint iterations = (effort < MAX_REFINE_ITERATIONS) ? effort : MAX_REFINE_ITERATIONS;
+		choose_best_axis(texels, best_blockmode, ep0, ep1);
+		best_err = choose_best_quantmethod(texels, ep0, ep1, effort, best_grid, best_blockmode);
+		best_err = refine_endpoints(texels, best_grid, best_blockmode, iterations, best_err, ep0, ep1);
+	}
+
+	uint weight_quantmethod = best_blockmode.x;
+	uint endpoint_quantmethod = best_blockmode.y;
+	uint weight_range = best_blockmode.z;
+	uint colorquant_index = best_blockmode.w;
+
+	// reference to arm astc encoder "symbolic_to_physical"
+	//uint bytes_of_one_endpoint = 2 * (color_endpoint_mode >> 2) + 2;
+
+	uint blockmode = assemble_grid_blockmode(best_grid, weight_quantmethod);
+
+	uint color_endpoint_mode = 0;
+	uint4 ep_ise = endpoint_ise(colorquant_index, ep0, ep1, endpoint_quantmethod, color_endpoint_mode);
+
+	float4 w0, w1;
+	weighting_endpoints(endpoint_quantmethod, ep0, ep1, w0, w1);
+	uint4 wt_ise = weight_ise(texels, best_grid, effort > 0, weight_range - 1, w0, w1, weight_quantmethod);
+
+	// assemble to astcblock
+	uint4 blk = assemble_block(blockmode, color_endpoint_mode, 1, 0, ep_ise, wt_ise);
+
+	if (effort > 0 || dual_plane || IS_HDR)
+	{
+		if (effort == 0)
+		{
+			best_err = quantmethod_error(texels, ep0, ep1, best_grid, best_blockmode.x, best_blockmode.y);
+		}
+		if (gray_err <= best_err)
+		{
+			best_err = gray_err;
+			blk = gray_blk;
+		}
+#if IS_HDR && !HAS_ALPHA
+		choose_hdr_scale(texels, ep0, ep1, best_grid, effort, best_err, blk);
+#endif
+		if (effort > 0)
+		{
+			choose_best_partitioning(texels, ep0, ep1, effort, best_err, blk);
+		}
+		if (dual_plane)
+		{
+			choose_dual_plane(texels, best_err, blk);
+		}
+	}
+	return blk;
+
+}
@@ -0,0 +1,8861 @@
+// generated by astc_table_gen.cpp, the weight grids of every footprint and their "C.2.18 Weight Infill" tables.
+//	weight_grids_<w>x<h>: uint4(grid width, grid height, first decimation entry, first infill entry), the 4x4 grid first.
+//		the 3d footprints put the 3x3x3 grid first, weight_grids_z_<w>x<h>x<d> holds the grid depths
+//	decimation_*: the bilinear taps of the texels around every grid weight, at the texel position the infill gives it,
+//		in the nearest texel slice for the 3d grids
+//	infill_*: the grid weights of every texel and their factors, the decoder's integer factors divided by 16.
+//		the 3d grids take the 4 corners of the simplex interpolation.
+//		taps with a 0 factor point at the first one, they never read past the grid.
+//	pseudo_inverse_*: the 16 largest taps of every row of the pseudo-inverse of the infill, 4 entries per grid weight
+//		from 4 * the first decimation entry. the texels of a row are in order, a short row ends with 0 taps.
+//		the kept taps are not rescaled after the truncation, the residual passes of fit_grid_weights() make up for the rest.
+#ifndef ASTC_DECIMATION_TABLE_HLSL
+#define ASTC_DECIMATION_TABLE_HLSL
+
+
+#define WEIGHT_GRID_COUNT_4X4 1
+#define MAX_GRID_WEIGHTS_4X4 16
+static const uint4 weight_grids_4x4[WEIGHT_GRID_COUNT_4X4] = { uint4(4, 4, 0, 0) };
+static const uint4 decimation_idx_4x4[16] =
+{
+	uint4(0, 1, 4, 5), uint4(1, 2, 5, 6), uint4(2, 3, 6, 7), uint4(3, 3, 7, 7),
+	uint4(4, 5, 8, 9), uint4(5, 6, 9, 10), uint4(6, 7, 10, 11), uint4(7, 7, 11, 11),
+	uint4(8, 9, 12, 13), uint4(9, 10, 13, 14), uint4(10, 11, 14, 15), uint4(11, 11, 15, 15),
+	uint4(12, 13, 12, 13), uint4(13, 14, 13, 14), uint4(14, 15, 14, 15), uint4(15, 15, 15, 15),
+};
+static const float4 decimation_wt_4x4[16] =
+{
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+};
+static const uint4 infill_idx_4x4[16] =
+{
+	uint4(0, 0, 0, 0), uint4(1, 1, 1, 1), uint4(2, 2, 2, 2), uint4(3, 3, 3, 3),
+	uint4(4, 4, 4, 4), uint4(5, 5, 5, 5), uint4(6, 6, 6, 6), uint4(7, 7, 7, 7),
+	uint4(8, 8, 8, 8), uint4(9, 9, 9, 9), uint4(10, 10, 10, 10), uint4(11, 11, 11, 11),
+	uint4(12, 12, 12, 12), uint4(13, 13, 13, 13), uint4(14, 14, 14, 14), uint4(15, 15, 15, 15),
+};
+static const float4 infill_wt_4x4[16] =
+{
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+};
+static const uint4 pseudo_inverse_idx_4x4[64] =
+{
+	uint4(0, 0, 0, 0), uint4(0, 0, 0, 0), uint4(0, 0, 0, 0), uint4(0, 0, 0, 0),
+	uint4(1, 1, 1, 1), uint4(1, 1, 1, 1), uint4(1, 1, 1, 1), uint4(1, 1, 1, 1),
+	uint4(2, 2, 2, 2), uint4(2, 2, 2, 2), uint4(2, 2, 2, 2), uint4(2, 2, 2, 2),
+	uint4(3, 3, 3, 3), uint4(3, 3, 3, 3), uint4(3, 3, 3, 3), uint4(3, 3, 3, 3),
+	uint4(4, 4, 4, 4), uint4(4, 4, 4, 4), uint4(4, 4, 4, 4), uint4(4, 4, 4, 4),
+	uint4(5, 5, 5, 5), uint4(5, 5, 5, 5), uint4(5, 5, 5, 5), uint4(5, 5, 5, 5),
+	uint4(6, 6, 6, 6), uint4(6, 6, 6, 6), uint4(6, 6, 6, 6), uint4(6, 6, 6, 6),
+	uint4(7, 7, 7, 7), uint4(7, 7, 7, 7), uint4(7, 7, 7, 7), uint4(7, 7, 7, 7),
+	uint4(8, 8, 8, 8), uint4(8, 8, 8, 8), uint4(8, 8, 8, 8), uint4(8, 8, 8, 8),
+	uint4(9, 9, 9, 9), uint4(9, 9, 9, 9), uint4(9, 9, 9, 9), uint4(9, 9, 9, 9),
+	uint4(10, 10, 10, 10), uint4(10, 10, 10, 10), uint4(10, 10, 10, 10), uint4(10, 10, 10, 10),
+	uint4(11, 11, 11, 11), uint4(11, 11, 11, 11), uint4(11, 11, 11, 11), uint4(11, 11, 11, 11),
+	uint4(12, 12, 12, 12), uint4(12, 12, 12, 12), uint4(12, 12, 12, 12), uint4(12, 12, 12, 12),
+	uint4(13, 13, 13, 13), uint4(13, 13, 13, 13), uint4(13, 13, 13, 13), uint4(13, 13, 13, 13),
+	uint4(14, 14, 14, 14), uint4(14, 14, 14, 14), uint4(14, 14, 14, 14), uint4(14, 14, 14, 14),
+	uint4(15, 15, 15, 15), uint4(15, 15, 15, 15), uint4(15, 15, 15, 15), uint4(15, 15, 15, 15),
+};
+static const float4 pseudo_inverse_wt_4x4[64] =
+{
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+};
+
+#define WEIGHT_GRID_COUNT_5X4 2
+#define MAX_GRID_WEIGHTS_5X4 20
+static const uint4 weight_grids_5x4[WEIGHT_GRID_COUNT_5X4] = { uint4(4, 4, 0, 0), uint4(5, 4, 16, 20) };
+static const uint4 decimation_idx_5x4[36] =
+{
+	uint4(0, 1, 5, 6), uint4(1, 2, 6, 7), uint4(2, 3, 7, 8), uint4(4, 4, 9, 9),
+	uint4(5, 6, 10, 11), uint4(6, 7, 11, 12), uint4(7, 8, 12, 13), uint4(9, 9, 14, 14),
+	uint4(10, 11, 15, 16), uint4(11, 12, 16, 17), uint4(12, 13, 17, 18), uint4(14, 14, 19, 19),
+	uint4(15, 16, 15, 16), uint4(16, 17, 16, 17), uint4(17, 18, 17, 18), uint4(19, 19, 19, 19),
+	uint4(0, 1, 5, 6), uint4(1, 2, 6, 7), uint4(2, 3, 7, 8), uint4(3, 4, 8, 9),
+	uint4(4, 4, 9, 9), uint4(5, 6, 10, 11), uint4(6, 7, 11, 12), uint4(7, 8, 12, 13),
+	uint4(8, 9, 13, 14), uint4(9, 9, 14, 14), uint4(10, 11, 15, 16), uint4(11, 12, 16, 17),
+	uint4(12, 13, 17, 18), uint4(13, 14, 18, 19), uint4(14, 14, 19, 19), uint4(15, 16, 15, 16),
+	uint4(16, 17, 16, 17), uint4(17, 18, 17, 18), uint4(18, 19, 18, 19), uint4(19, 19, 19, 19),
+};
+static const float4 decimation_wt_5x4[36] =
+{
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.666666627f, 0.333333373f, 0.0f, 0.0f),
+	float4(0.333333254f, 0.666666746f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.666666627f, 0.333333373f, 0.0f, 0.0f),
+	float4(0.333333254f, 0.666666746f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.666666627f, 0.333333373f, 0.0f, 0.0f),
+	float4(0.333333254f, 0.666666746f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.666666627f, 0.333333373f, 0.0f, 0.0f),
+	float4(0.333333254f, 0.666666746f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+};
+static const uint4 infill_idx_5x4[40] =
+{
+	uint4(0, 0, 0, 0), uint4(0, 1, 0, 0), uint4(1, 2, 1, 1), uint4(2, 3, 2, 2),
+	uint4(3, 3, 3, 3), uint4(4, 4, 4, 4), uint4(4, 5, 4, 4), uint4(5, 6, 5, 5),
+	uint4(6, 7, 6, 6), uint4(7, 7, 7, 7), uint4(8, 8, 8, 8), uint4(8, 9, 8, 8),
+	uint4(9, 10, 9, 9), uint4(10, 11, 10, 10), uint4(11, 11, 11, 11), uint4(12, 12, 12, 12),
+	uint4(12, 13, 12, 12), uint4(13, 14, 13, 13), uint4(14, 15, 14, 14), uint4(15, 15, 15, 15),
+	uint4(0, 0, 0, 0), uint4(1, 1, 1, 1), uint4(2, 2, 2, 2), uint4(3, 3, 3, 3),
+	uint4(4, 4, 4, 4), uint4(5, 5, 5, 5), uint4(6, 6, 6, 6), uint4(7, 7, 7, 7),
+	uint4(8, 8, 8, 8), uint4(9, 9, 9, 9), uint4(10, 10, 10, 10), uint4(11, 11, 11, 11),
+	uint4(12, 12, 12, 12), uint4(13, 13, 13, 13), uint4(14, 14, 14, 14), uint4(15, 15, 15, 15),
+	uint4(16, 16, 16, 16), uint4(17, 17, 17, 17), uint4(18, 18, 18, 18), uint4(19, 19, 19, 19),
+};
+static const float4 infill_wt_5x4[40] =
+{
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.25f, 0.75f, 0.0f, 0.0f), float4(0.5f, 0.5f, 0.0f, 0.0f), float4(0.75f, 0.25f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.25f, 0.75f, 0.0f, 0.0f), float4(0.5f, 0.5f, 0.0f, 0.0f),
+	float4(0.75f, 0.25f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.25f, 0.75f, 0.0f, 0.0f),
+	float4(0.5f, 0.5f, 0.0f, 0.0f), float4(0.75f, 0.25f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.25f, 0.75f, 0.0f, 0.0f), float4(0.5f, 0.5f, 0.0f, 0.0f), float4(0.75f, 0.25f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+};
+static const uint4 pseudo_inverse_idx_5x4[144] =
+{
+	uint4(0, 1, 2, 3), uint4(4, 0, 0, 0), uint4(0, 0, 0, 0), uint4(0, 0, 0, 0),
+	uint4(0, 1, 2, 3), uint4(4, 0, 0, 0), uint4(0, 0, 0, 0), uint4(0, 0, 0, 0),
+	uint4(0, 1, 2, 3), uint4(4, 0, 0, 0), uint4(0, 0, 0, 0), uint4(0, 0, 0, 0),
+	uint4(0, 1, 2, 3), uint4(4, 0, 0, 0), uint4(0, 0, 0, 0), uint4(0, 0, 0, 0),
+	uint4(5, 6, 7, 8), uint4(9, 5, 5, 5), uint4(5, 5, 5, 5), uint4(5, 5, 5, 5),
+	uint4(5, 6, 7, 8), uint4(9, 5, 5, 5), uint4(5, 5, 5, 5), uint4(5, 5, 5, 5),
+	uint4(5, 6, 7, 8), uint4(9, 5, 5, 5), uint4(5, 5, 5, 5), uint4(5, 5, 5, 5),
+	uint4(5, 6, 7, 8), uint4(9, 5, 5, 5), uint4(5, 5, 5, 5), uint4(5, 5, 5, 5),
+	uint4(10, 11, 12, 13), uint4(14, 10, 10, 10), uint4(10, 10, 10, 10), uint4(10, 10, 10, 10),
+	uint4(10, 11, 12, 13), uint4(14, 10, 10, 10), uint4(10, 10, 10, 10), uint4(10, 10, 10, 10),
+	uint4(10, 11, 12, 13), uint4(14, 10, 10, 10), uint4(10, 10, 10, 10), uint4(10, 10, 10, 10),
+	uint4(10, 11, 12, 13), uint4(14, 10, 10, 10), uint4(10, 10, 10, 10), uint4(10, 10, 10, 10),
+	uint4(15, 16, 17, 18), uint4(19, 15, 15, 15), uint4(15, 15, 15, 15), uint4(15, 15, 15, 15),
+	uint4(15, 16, 17, 18), uint4(19, 15, 15, 15), uint4(15, 15, 15, 15), uint4(15, 15, 15, 15),
+	uint4(15, 16, 17, 18), uint4(19, 15, 15, 15), uint4(15, 15, 15, 15), uint4(15, 15, 15, 15),
+	uint4(15, 16, 17, 18), uint4(19, 15, 15, 15), uint4(15, 15, 15, 15), uint4(15, 15, 15, 15),
+	uint4(0, 0, 0, 0), uint4(0, 0, 0, 0), uint4(0, 0, 0, 0), uint4(0, 0, 0, 0),
+	uint4(1, 1, 1, 1), uint4(1, 1, 1, 1), uint4(1, 1, 1, 1), uint4(1, 1, 1, 1),
+	uint4(2, 2, 2, 2), uint4(2, 2, 2, 2), uint4(2, 2, 2, 2), uint4(2, 2, 2, 2),
+	uint4(3, 3, 3, 3), uint4(3, 3, 3, 3), uint4(3, 3, 3, 3), uint4(3, 3, 3, 3),
+	uint4(4, 4, 4, 4), uint4(4, 4, 4, 4), uint4(4, 4, 4, 4), uint4(4, 4, 4, 4),
+	uint4(5, 5, 5, 5), uint4(5, 5, 5, 5), uint4(5, 5, 5, 5), uint4(5, 5, 5, 5),
+	uint4(6, 6, 6, 6), uint4(6, 6, 6, 6), uint4(6, 6, 6, 6), uint4(6, 6, 6, 6),
+	uint4(7, 7, 7, 7), uint4(7, 7, 7, 7), uint4(7, 7, 7, 7), uint4(7, 7, 7, 7),
+	uint4(8, 8, 8, 8), uint4(8, 8, 8, 8), uint4(8, 8, 8, 8), uint4(8, 8, 8, 8),
+	uint4(9, 9, 9, 9), uint4(9, 9, 9, 9), uint4(9, 9, 9, 9), uint4(9, 9, 9, 9),
+	uint4(10, 10, 10, 10), uint4(10, 10, 10, 10), uint4(10, 10, 10, 10), uint4(10, 10, 10, 10),
+	uint4(11, 11, 11, 11), uint4(11, 11, 11, 11), uint4(11, 11, 11, 11), uint4(11, 11, 11, 11),
+	uint4(12, 12, 12, 12), uint4(12, 12, 12, 12), uint4(12, 12, 12, 12), uint4(12, 12, 12, 12),
+	uint4(13, 13, 13, 13), uint4(13, 13, 13, 13), uint4(13, 13, 13, 13), uint4(13, 13, 13, 13),
+	uint4(14, 14, 14, 14), uint4(14, 14, 14, 14), uint4(14, 14, 14, 14), uint4(14, 14, 14, 14),
+	uint4(15, 15, 15, 15), uint4(15, 15, 15, 15), uint4(15, 15, 15, 15), uint4(15, 15, 15, 15),
+	uint4(16, 16, 16, 16), uint4(16, 16, 16, 16), uint4(16, 16, 16, 16), uint4(16, 16, 16, 16),
+	uint4(17, 17, 17, 17), uint4(17, 17, 17, 17), uint4(17, 17, 17, 17), uint4(17, 17, 17, 17),
+	uint4(18, 18, 18, 18), uint4(18, 18, 18, 18), uint4(18, 18, 18, 18), uint4(18, 18, 18, 18),
+	uint4(19, 19, 19, 19), uint4(19, 19, 19, 19), uint4(19, 19, 19, 19), uint4(19, 19, 19, 19),
+};
+static const float4 pseudo_inverse_wt_5x4[144] =
+{
+	float4(0.985714f, 0.0571429f, -0.0857143f, 0.0571429f), float4(-0.0142857f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(-0.252381f, 1.00952f, 0.485714f, -0.32381f), float4(0.0809524f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0809524f, -0.32381f, 0.485714f, 1.00952f), float4(-0.252381f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(-0.0142857f, 0.0571429f, -0.0857143f, 0.0571429f), float4(0.985714f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.985714f, 0.0571429f, -0.0857143f, 0.0571429f), float4(-0.0142857f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(-0.252381f, 1.00952f, 0.485714f, -0.32381f), float4(0.0809524f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0809524f, -0.32381f, 0.485714f, 1.00952f), float4(-0.252381f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(-0.0142857f, 0.0571429f, -0.0857143f, 0.0571429f), float4(0.985714f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.985714f, 0.0571429f, -0.0857143f, 0.0571429f), float4(-0.0142857f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(-0.252381f, 1.00952f, 0.485714f, -0.32381f), float4(0.0809524f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0809524f, -0.32381f, 0.485714f, 1.00952f), float4(-0.252381f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(-0.0142857f, 0.0571429f, -0.0857143f, 0.0571429f), float4(0.985714f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.985714f, 0.0571429f, -0.0857143f, 0.0571429f), float4(-0.0142857f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(-0.252381f, 1.00952f, 0.485714f, -0.32381f), float4(0.0809524f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0809524f, -0.32381f, 0.485714f, 1.00952f), float4(-0.252381f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(-0.0142857f, 0.0571429f, -0.0857143f, 0.0571429f), float4(0.985714f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+};
+
+#define WEIGHT_GRID_COUNT_5X5 2
+#define MAX_GRID_WEIGHTS_5X5 25
+static const uint4 weight_grids_5x5[WEIGHT_GRID_COUNT_5X5] = { uint4(4, 4, 0, 0), uint4(5, 5, 16, 25) };
+static const uint4 decimation_idx_5x5[41] =
+{
+	uint4(0, 1, 5, 6), uint4(1, 2, 6, 7), uint4(2, 3, 7, 8), uint4(4, 4, 9, 9),
+	uint4(5, 6, 10, 11), uint4(6, 7, 11, 12), uint4(7, 8, 12, 13), uint4(9, 9, 14, 14),
+	uint4(10, 11, 15, 16), uint4(11, 12, 16, 17), uint4(12, 13, 17, 18), uint4(14, 14, 19, 19),
+	uint4(20, 21, 20, 21), uint4(21, 22, 21, 22), uint4(22, 23, 22, 23), uint4(24, 24, 24, 24),
+	uint4(0, 1, 5, 6), uint4(1, 2, 6, 7), uint4(2, 3, 7, 8), uint4(3, 4, 8, 9),
+	uint4(4, 4, 9, 9), uint4(5, 6, 10, 11), uint4(6, 7, 11, 12), uint4(7, 8, 12, 13),
+	uint4(8, 9, 13, 14), uint4(9, 9, 14, 14), uint4(10, 11, 15, 16), uint4(11, 12, 16, 17),
+	uint4(12, 13, 17, 18), uint4(13, 14, 18, 19), uint4(14, 14, 19, 19), uint4(15, 16, 20, 21),
+	uint4(16, 17, 21, 22), uint4(17, 18, 22, 23), uint4(18, 19, 23, 24), uint4(19, 19, 24, 24),
+	uint4(20, 21, 20, 21), uint4(21, 22, 21, 22), uint4(22, 23, 22, 23), uint4(23, 24, 23, 24),
+	uint4(24, 24, 24, 24),
+};
+static const float4 decimation_wt_5x5[41] =
+{
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.666666627f, 0.333333373f, 0.0f, 0.0f),
+	float4(0.333333254f, 0.666666746f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.666666627f, 0.0f, 0.333333373f, 0.0f), float4(0.444444388f, 0.222222239f, 0.222222239f, 0.111111134f),
+	float4(0.222222149f, 0.444444478f, 0.111111097f, 0.222222269f), float4(0.666666627f, 0.0f, 0.333333373f, 0.0f),
+	float4(0.333333254f, 0.0f, 0.666666746f, 0.0f), float4(0.222222149f, 0.111111097f, 0.444444478f, 0.222222269f),
+	float4(0.11111106f, 0.222222194f, 0.222222194f, 0.444444537f), float4(0.333333254f, 0.0f, 0.666666746f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.666666627f, 0.333333373f, 0.0f, 0.0f),
+	float4(0.333333254f, 0.666666746f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f),
+};
+static const uint4 infill_idx_5x5[50] =
+{
+	uint4(0, 0, 0, 0), uint4(0, 1, 0, 0), uint4(1, 2, 1, 1), uint4(2, 3, 2, 2),
+	uint4(3, 3, 3, 3), uint4(0, 0, 4, 0), uint4(0, 1, 4, 5), uint4(1, 2, 5, 6),
+	uint4(2, 3, 6, 7), uint4(3, 3, 7, 3), uint4(4, 4, 8, 4), uint4(4, 5, 8, 9),
+	uint4(5, 6, 9, 10), uint4(6, 7, 10, 11), uint4(7, 7, 11, 7), uint4(8, 8, 12, 8),
+	uint4(8, 9, 12, 13), uint4(9, 10, 13, 14), uint4(10, 11, 14, 15), uint4(11, 11, 15, 11),
+	uint4(12, 12, 12, 12), uint4(12, 13, 12, 12), uint4(13, 14, 13, 13), uint4(14, 15, 14, 14),
+	uint4(15, 15, 15, 15), uint4(0, 0, 0, 0), uint4(1, 1, 1, 1), uint4(2, 2, 2, 2),
+	uint4(3, 3, 3, 3), uint4(4, 4, 4, 4), uint4(5, 5, 5, 5), uint4(6, 6, 6, 6),
+	uint4(7, 7, 7, 7), uint4(8, 8, 8, 8), uint4(9, 9, 9, 9), uint4(10, 10, 10, 10),
+	uint4(11, 11, 11, 11), uint4(12, 12, 12, 12), uint4(13, 13, 13, 13), uint4(14, 14, 14, 14),
+	uint4(15, 15, 15, 15), uint4(16, 16, 16, 16), uint4(17, 17, 17, 17), uint4(18, 18, 18, 18),
+	uint4(19, 19, 19, 19), uint4(20, 20, 20, 20), uint4(21, 21, 21, 21), uint4(22, 22, 22, 22),
+	uint4(23, 23, 23, 23), uint4(24, 24, 24, 24),
+};
+static const float4 infill_wt_5x5[50] =
+{
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.25f, 0.75f, 0.0f, 0.0f), float4(0.5f, 0.5f, 0.0f, 0.0f), float4(0.75f, 0.25f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.25f, 0.0f, 0.75f, 0.0f), float4(0.0625f, 0.1875f, 0.1875f, 0.5625f), float4(0.125f, 0.125f, 0.375f, 0.375f),
+	float4(0.1875f, 0.0625f, 0.5625f, 0.1875f), float4(0.25f, 0.0f, 0.75f, 0.0f), float4(0.5f, 0.0f, 0.5f, 0.0f), float4(0.125f, 0.375f, 0.125f, 0.375f),
+	float4(0.25f, 0.25f, 0.25f, 0.25f), float4(0.375f, 0.125f, 0.375f, 0.125f), float4(0.5f, 0.0f, 0.5f, 0.0f), float4(0.75f, 0.0f, 0.25f, 0.0f),
+	float4(0.1875f, 0.5625f, 0.0625f, 0.1875f), float4(0.375f, 0.375f, 0.125f, 0.125f), float4(0.5625f, 0.1875f, 0.1875f, 0.0625f), float4(0.75f, 0.0f, 0.25f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.25f, 0.75f, 0.0f, 0.0f), float4(0.5f, 0.5f, 0.0f, 0.0f), float4(0.75f, 0.25f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+};
+static const uint4 pseudo_inverse_idx_5x5[164] =
+{
+	uint4(0, 1, 2, 3), uint4(4, 5, 6, 7), uint4(10, 11, 12, 13), uint4(15, 17, 18, 20),
+	uint4(0, 1, 2, 3), uint4(4, 6, 7, 8), uint4(10, 11, 12, 13), uint4(16, 17, 18, 21),
+	uint4(0, 1, 2, 3), uint4(4, 6, 7, 8), uint4(11, 12, 13, 14), uint4(16, 17, 18, 19),
+	uint4(0, 1, 2, 3), uint4(4, 7, 9, 11), uint4(12, 13, 14, 16), uint4(17, 18, 19, 24),
+	uint4(0, 2, 5, 6), uint4(7, 8, 9, 10), uint4(11, 12, 13, 15), uint4(16, 17, 18, 20),
+	uint4(1, 2, 3, 5), uint4(6, 7, 8, 9), uint4(10, 11, 12, 13), uint4(16, 17, 18, 21),
+	uint4(2, 3, 5, 6), uint4(7, 8, 9, 11), uint4(12, 13, 14, 16), uint4(17, 18, 19, 23),
+	uint4(2, 3, 4, 6), uint4(7, 8, 9, 11), uint4(12, 13, 14, 16), uint4(17, 18, 19, 24),
+	uint4(0, 5, 6, 7), uint4(8, 10, 11, 12), uint4(13, 15, 16, 17), uint4(18, 20, 22, 23),
+	uint4(1, 6, 7, 8), uint4(10, 11, 12, 13), uint4(15, 16, 17, 18), uint4(19, 21, 22, 23),
+	uint4(3, 6, 7, 8), uint4(9, 11, 12, 13), uint4(14, 16, 17, 18), uint4(19, 21, 22, 23),
+	uint4(4, 6, 7, 8), uint4(9, 11, 12, 13), uint4(14, 16, 17, 18), uint4(19, 21, 22, 24),
+	uint4(0, 5, 7, 8), uint4(10, 11, 12, 13), uint4(15, 16, 17, 20), uint4(21, 22, 23, 24),
+	uint4(6, 7, 8, 10), uint4(11, 12, 13, 15), uint4(16, 17, 18, 20), uint4(21, 22, 23, 24),
+	uint4(6, 7, 8, 9), uint4(11, 12, 13, 14), uint4(16, 17, 18, 20), uint4(21, 22, 23, 24),
+	uint4(4, 6, 7, 9), uint4(11, 12, 13, 14), uint4(17, 18, 19, 20), uint4(21, 22, 23, 24),
+	uint4(0, 0, 0, 0), uint4(0, 0, 0, 0), uint4(0, 0, 0, 0), uint4(0, 0, 0, 0),
+	uint4(1, 1, 1, 1), uint4(1, 1, 1, 1), uint4(1, 1, 1, 1), uint4(1, 1, 1, 1),
+	uint4(2, 2, 2, 2), uint4(2, 2, 2, 2), uint4(2, 2, 2, 2), uint4(2, 2, 2, 2),
+	uint4(3, 3, 3, 3), uint4(3, 3, 3, 3), uint4(3, 3, 3, 3), uint4(3, 3, 3, 3),
+	uint4(4, 4, 4, 4), uint4(4, 4, 4, 4), uint4(4, 4, 4, 4), uint4(4, 4, 4, 4),
+	uint4(5, 5, 5, 5), uint4(5, 5, 5, 5), uint4(5, 5, 5, 5), uint4(5, 5, 5, 5),
+	uint4(6, 6, 6, 6), uint4(6, 6, 6, 6), uint4(6, 6, 6, 6), uint4(6, 6, 6, 6),
+	uint4(7, 7, 7, 7), uint4(7, 7, 7, 7), uint4(7, 7, 7, 7), uint4(7, 7, 7, 7),
+	uint4(8, 8, 8, 8), uint4(8, 8, 8, 8), uint4(8, 8, 8, 8), uint4(8, 8, 8, 8),
+	uint4(9, 9, 9, 9), uint4(9, 9, 9, 9), uint4(9, 9, 9, 9), uint4(9, 9, 9, 9),
+	uint4(10, 10, 10, 10), uint4(10, 10, 10, 10), uint4(10, 10, 10, 10), uint4(10, 10, 10, 10),
+	uint4(11, 11, 11, 11), uint4(11, 11, 11, 11), uint4(11, 11, 11, 11), uint4(11, 11, 11, 11),
+	uint4(12, 12, 12, 12), uint4(12, 12, 12, 12), uint4(12, 12, 12, 12), uint4(12, 12, 12, 12),
+	uint4(13, 13, 13, 13), uint4(13, 13, 13, 13), uint4(13, 13, 13, 13), uint4(13, 13, 13, 13),
+	uint4(14, 14, 14, 14), uint4(14, 14, 14, 14), uint4(14, 14, 14, 14), uint4(14, 14, 14, 14),
+	uint4(15, 15, 15, 15), uint4(15, 15, 15, 15), uint4(15, 15, 15, 15), uint4(15, 15, 15, 15),
+	uint4(16, 16, 16, 16), uint4(16, 16, 16, 16), uint4(16, 16, 16, 16), uint4(16, 16, 16, 16),
+	uint4(17, 17, 17, 17), uint4(17, 17, 17, 17), uint4(17, 17, 17, 17), uint4(17, 17, 17, 17),
+	uint4(18, 18, 18, 18), uint4(18, 18, 18, 18), uint4(18, 18, 18, 18), uint4(18, 18, 18, 18),
+	uint4(19, 19, 19, 19), uint4(19, 19, 19, 19), uint4(19, 19, 19, 19), uint4(19, 19, 19, 19),
+	uint4(20, 20, 20, 20), uint4(20, 20, 20, 20), uint4(20, 20, 20, 20), uint4(20, 20, 20, 20),
+	uint4(21, 21, 21, 21), uint4(21, 21, 21, 21), uint4(21, 21, 21, 21), uint4(21, 21, 21, 21),
+	uint4(22, 22, 22, 22), uint4(22, 22, 22, 22), uint4(22, 22, 22, 22), uint4(22, 22, 22, 22),
+	uint4(23, 23, 23, 23), uint4(23, 23, 23, 23), uint4(23, 23, 23, 23), uint4(23, 23, 23, 23),
+	uint4(24, 24, 24, 24), uint4(24, 24, 24, 24), uint4(24, 24, 24, 24), uint4(24, 24, 24, 24),
+};
+static const float4 pseudo_inverse_wt_5x5[164] =
+{
+	float4(0.971633f, 0.0563265f, -0.0844898f, 0.0563265f), float4(-0.0140816f, 0.0563265f, 0.00326531f, -0.00489796f),
+	float4(-0.0844898f, -0.00489796f, 0.00734694f, -0.00489796f), float4(0.0563265f, -0.00489796f, 0.00326531f, -0.0140816f),
+	float4(-0.248776f, 0.995102f, 0.478776f, -0.319184f), float4(0.0797959f, 0.0576871f, 0.0277551f, -0.0185034f),
+	float4(0.0216327f, -0.0865306f, -0.0416327f, 0.0277551f), float4(0.0576871f, 0.0277551f, -0.0185034f, -0.0144218f),
+	float4(0.0797959f, -0.319184f, 0.478776f, 0.995102f), float4(-0.248776f, -0.0185034f, 0.0277551f, 0.0576871f),
+	float4(0.0277551f, -0.0416327f, -0.0865306f, 0.0216327f), float4(-0.0185034f, 0.0277551f, 0.0576871f, -0.0144218f),
+	float4(-0.0140816f, 0.0563265f, -0.0844898f, 0.0563265f), float4(0.971633f, -0.00489796f, 0.0563265f, -0.00489796f),
+	float4(0.00734694f, -0.00489796f, -0.0844898f, 0.00326531f), float4(-0.00489796f, 0.00326531f, 0.0563265f, -0.0140816f),
+	float4(-0.248776f, 0.0216327f, 0.995102f, 0.0576871f), float4(-0.0865306f, 0.0576871f, -0.0144218f, 0.478776f),
+	float4(0.0277551f, -0.0416327f, 0.0277551f, -0.319184f), float4(-0.0185034f, 0.0277551f, -0.0185034f, 0.0797959f),
+	float4(-0.254785f, -0.122585f, 0.0817234f, -0.254785f), float4(1.01914f, 0.49034f, -0.326893f, 0.0817234f),
+	float4(-0.122585f, 0.49034f, 0.235918f, -0.157279f), float4(-0.326893f, -0.157279f, 0.104853f, 0.0817234f),
+	float4(-0.122585f, -0.254785f, 0.0817234f, -0.326893f), float4(0.49034f, 1.01914f, -0.254785f, -0.157279f),
+	float4(0.235918f, 0.49034f, -0.122585f, 0.104853f), float4(-0.157279f, -0.326893f, 0.0817234f, 0.0817234f),
+	float4(0.0216327f, -0.0144218f, -0.248776f, 0.0576871f), float4(-0.0865306f, 0.0576871f, 0.995102f, 0.0277551f),
+	float4(-0.0416327f, 0.0277551f, 0.478776f, -0.0185034f), float4(0.0277551f, -0.0185034f, -0.319184f, 0.0797959f),
+	float4(0.0797959f, -0.319184f, -0.0185034f, 0.0277551f), float4(-0.0185034f, 0.478776f, 0.0277551f, -0.0416327f),
+	float4(0.0277551f, 0.995102f, 0.0576871f, -0.0865306f), float4(0.0576871f, -0.248776f, 0.0216327f, -0.0144218f),
+	float4(0.0817234f, -0.326893f, -0.157279f, 0.104853f), float4(-0.122585f, 0.49034f, 0.235918f, -0.157279f),
+	float4(-0.254785f, 1.01914f, 0.49034f, -0.326893f), float4(0.0817234f, -0.254785f, -0.122585f, 0.0817234f),
+	float4(0.0817234f, 0.104853f, -0.157279f, -0.326893f), float4(0.0817234f, -0.157279f, 0.235918f, 0.49034f),
+	float4(-0.122585f, -0.326893f, 0.49034f, 1.01914f), float4(-0.254785f, 0.0817234f, -0.122585f, -0.254785f),
+	float4(0.0797959f, -0.0185034f, 0.0277551f, -0.0185034f), float4(-0.319184f, 0.0277551f, -0.0416327f, 0.0277551f),
+	float4(0.478776f, 0.0576871f, -0.0865306f, 0.0576871f), float4(0.995102f, -0.0144218f, 0.0216327f, -0.248776f),
+	float4(-0.0140816f, 0.0563265f, -0.00489796f, 0.00326531f), float4(-0.0844898f, -0.00489796f, 0.00734694f, -0.00489796f),
+	float4(0.0563265f, 0.00326531f, -0.00489796f, 0.971633f), float4(0.0563265f, -0.0844898f, 0.0563265f, -0.0140816f),
+	float4(0.0576871f, 0.0277551f, -0.0185034f, 0.0216327f), float4(-0.0865306f, -0.0416327f, 0.0277551f, -0.0144218f),
+	float4(0.0576871f, 0.0277551f, -0.0185034f, -0.248776f), float4(0.995102f, 0.478776f, -0.319184f, 0.0797959f),
+	float4(-0.0185034f, 0.0277551f, 0.0576871f, -0.0144218f), float4(0.0277551f, -0.0416327f, -0.0865306f, 0.0216327f),
+	float4(-0.0185034f, 0.0277551f, 0.0576871f, 0.0797959f), float4(-0.319184f, 0.478776f, 0.995102f, -0.248776f),
+	float4(-0.0140816f, 0.00326531f, -0.00489796f, 0.0563265f), float4(-0.00489796f, 0.00734694f, -0.00489796f, -0.0844898f),
+	float4(-0.00489796f, 0.00326531f, 0.0563265f, -0.0140816f), float4(0.0563265f, -0.0844898f, 0.0563265f, 0.971633f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+};
+
+#define WEIGHT_GRID_COUNT_6X5 3
+#define MAX_GRID_WEIGHTS_6X5 30
+static const uint4 weight_grids_6x5[WEIGHT_GRID_COUNT_6X5] = { uint4(4, 4, 0, 0), uint4(5, 5, 16, 30), uint4(6, 5, 41, 60) };
+static const uint4 decimation_idx_6x5[71] =
+{
+	uint4(0, 1, 6, 7), uint4(1, 2, 7, 8), uint4(3, 4, 9, 10), uint4(5, 5, 11, 11),
+	uint4(6, 7, 12, 13), uint4(7, 8, 13, 14), uint4(9, 10, 15, 16), uint4(11, 11, 17, 17),
+	uint4(12, 13, 18, 19), uint4(13, 14, 19, 20), uint4(15, 16, 21, 22), uint4(17, 17, 23, 23),
+	uint4(24, 25, 24, 25), uint4(25, 26, 25, 26), uint4(27, 28, 27, 28), uint4(29, 29, 29, 29),
+	uint4(0, 1, 6, 7), uint4(1, 2, 7, 8), uint4(2, 3, 8, 9), uint4(3, 4, 9, 10),
+	uint4(5, 5, 11, 11), uint4(6, 7, 12, 13), uint4(7, 8, 13, 14), uint4(8, 9, 14, 15),
+	uint4(9, 10, 15, 16), uint4(11, 11, 17, 17), uint4(12, 13, 18, 19), uint4(13, 14, 19, 20),
+	uint4(14, 15, 20, 21), uint4(15, 16, 21, 22), uint4(17, 17, 23, 23), uint4(18, 19, 24, 25),
+	uint4(19, 20, 25, 26), uint4(20, 21, 26, 27), uint4(21, 22, 27, 28), uint4(23, 23, 29, 29),
+	uint4(24, 25, 24, 25), uint4(25, 26, 25, 26), uint4(26, 27, 26, 27), uint4(27, 28, 27, 28),
+	uint4(29, 29, 29, 29), uint4(0, 1, 6, 7), uint4(1, 2, 7, 8), uint4(2, 3, 8, 9),
+	uint4(3, 4, 9, 10), uint4(4, 5, 10, 11), uint4(5, 5, 11, 11), uint4(6, 7, 12, 13),
+	uint4(7, 8, 13, 14), uint4(8, 9, 14, 15), uint4(9, 10, 15, 16), uint4(10, 11, 16, 17),
+	uint4(11, 11, 17, 17), uint4(12, 13, 18, 19), uint4(13, 14, 19, 20), uint4(14, 15, 20, 21),
+	uint4(15, 16, 21, 22), uint4(16, 17, 22, 23), uint4(17, 17, 23, 23), uint4(18, 19, 24, 25),
+	uint4(19, 20, 25, 26), uint4(20, 21, 26, 27), uint4(21, 22, 27, 28), uint4(22, 23, 28, 29),
+	uint4(23, 23, 29, 29), uint4(24, 25, 24, 25), uint4(25, 26, 25, 26), uint4(26, 27, 26, 27),
+	uint4(27, 28, 27, 28), uint4(28, 29, 28, 29), uint4(29, 29, 29, 29),
+};
+static const float4 decimation_wt_6x5[71] =
+{
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.333333373f, 0.666666627f, 0.0f, 0.0f),
+	float4(0.666666746f, 0.333333254f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.666666627f, 0.0f, 0.333333373f, 0.0f), float4(0.222222239f, 0.444444388f, 0.111111134f, 0.222222239f),
+	float4(0.444444478f, 0.222222149f, 0.222222269f, 0.111111097f), float4(0.666666627f, 0.0f, 0.333333373f, 0.0f),
+	float4(0.333333254f, 0.0f, 0.666666746f, 0.0f), float4(0.111111097f, 0.222222149f, 0.222222269f, 0.444444478f),
+	float4(0.222222194f, 0.11111106f, 0.444444537f, 0.222222194f), float4(0.333333254f, 0.0f, 0.666666746f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.333333373f, 0.666666627f, 0.0f, 0.0f),
+	float4(0.666666746f, 0.333333254f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.75f, 0.25f, 0.0f, 0.0f),
+	float4(0.5f, 0.5f, 0.0f, 0.0f), float4(0.25f, 0.75f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.75f, 0.25f, 0.0f, 0.0f), float4(0.5f, 0.5f, 0.0f, 0.0f),
+	float4(0.25f, 0.75f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.75f, 0.25f, 0.0f, 0.0f),
+	float4(0.5f, 0.5f, 0.0f, 0.0f), float4(0.25f, 0.75f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.75f, 0.25f, 0.0f, 0.0f), float4(0.5f, 0.5f, 0.0f, 0.0f),
+	float4(0.25f, 0.75f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.75f, 0.25f, 0.0f, 0.0f),
+	float4(0.5f, 0.5f, 0.0f, 0.0f), float4(0.25f, 0.75f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f),
+};
+static const uint4 infill_idx_6x5[90] =
+{
+	uint4(0, 0, 0, 0), uint4(0, 1, 0, 0), uint4(1, 2, 1, 1), uint4(1, 2, 1, 1),
+	uint4(2, 3, 2, 2), uint4(3, 3, 3, 3), uint4(0, 0, 4, 0), uint4(0, 1, 4, 5),
+	uint4(1, 2, 5, 6), uint4(1, 2, 5, 6), uint4(2, 3, 6, 7), uint4(3, 3, 7, 3),
+	uint4(4, 4, 8, 4), uint4(4, 5, 8, 9), uint4(5, 6, 9, 10), uint4(5, 6, 9, 10),
+	uint4(6, 7, 10, 11), uint4(7, 7, 11, 7), uint4(8, 8, 12, 8), uint4(8, 9, 12, 13),
+	uint4(9, 10, 13, 14), uint4(9, 10, 13, 14), uint4(10, 11, 14, 15), uint4(11, 11, 15, 11),
+	uint4(12, 12, 12, 12), uint4(12, 13, 12, 12), uint4(13, 14, 13, 13), uint4(13, 14, 13, 13),
+	uint4(14, 15, 14, 14), uint4(15, 15, 15, 15), uint4(0, 0, 0, 0), uint4(0, 1, 0, 0),
+	uint4(1, 2, 1, 1), uint4(2, 3, 2, 2), uint4(3, 4, 3, 3), uint4(4, 4, 4, 4),
+	uint4(5, 5, 5, 5), uint4(5, 6, 5, 5), uint4(6, 7, 6, 6), uint4(7, 8, 7, 7),
+	uint4(8, 9, 8, 8), uint4(9, 9, 9, 9), uint4(10, 10, 10, 10), uint4(10, 11, 10, 10),
+	uint4(11, 12, 11, 11), uint4(12, 13, 12, 12), uint4(13, 14, 13, 13), uint4(14, 14, 14, 14),
+	uint4(15, 15, 15, 15), uint4(15, 16, 15, 15), uint4(16, 17, 16, 16), uint4(17, 18, 17, 17),
+	uint4(18, 19, 18, 18), uint4(19, 19, 19, 19), uint4(20, 20, 20, 20), uint4(20, 21, 20, 20),
+	uint4(21, 22, 21, 21), uint4(22, 23, 22, 22), uint4(23, 24, 23, 23), uint4(24, 24, 24, 24),
+	uint4(0, 0, 0, 0), uint4(1, 1, 1, 1), uint4(2, 2, 2, 2), uint4(3, 3, 3, 3),
+	uint4(4, 4, 4, 4), uint4(5, 5, 5, 5), uint4(6, 6, 6, 6), uint4(7, 7, 7, 7),
+	uint4(8, 8, 8, 8), uint4(9, 9, 9, 9), uint4(10, 10, 10, 10), uint4(11, 11, 11, 11),
+	uint4(12, 12, 12, 12), uint4(13, 13, 13, 13), uint4(14, 14, 14, 14), uint4(15, 15, 15, 15),
+	uint4(16, 16, 16, 16), uint4(17, 17, 17, 17), uint4(18, 18, 18, 18), uint4(19, 19, 19, 19),
+	uint4(20, 20, 20, 20), uint4(21, 21, 21, 21), uint4(22, 22, 22, 22), uint4(23, 23, 23, 23),
+	uint4(24, 24, 24, 24), uint4(25, 25, 25, 25), uint4(26, 26, 26, 26), uint4(27, 27, 27, 27),
+	uint4(28, 28, 28, 28), uint4(29, 29, 29, 29),
+};
+static const float4 infill_wt_6x5[90] =
+{
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.375f, 0.625f, 0.0f, 0.0f), float4(0.8125f, 0.1875f, 0.0f, 0.0f), float4(0.1875f, 0.8125f, 0.0f, 0.0f),
+	float4(0.625f, 0.375f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.25f, 0.0f, 0.75f, 0.0f), float4(0.125f, 0.125f, 0.25f, 0.5f),
+	float4(0.1875f, 0.0625f, 0.625f, 0.125f), float4(0.0625f, 0.1875f, 0.125f, 0.625f), float4(0.1875f, 0.0625f, 0.4375f, 0.3125f), float4(0.25f, 0.0f, 0.75f, 0.0f),
+	float4(0.5f, 0.0f, 0.5f, 0.0f), float4(0.1875f, 0.3125f, 0.1875f, 0.3125f), float4(0.4375f, 0.0625f, 0.375f, 0.125f), float4(0.125f, 0.375f, 0.0625f, 0.4375f),
+	float4(0.3125f, 0.1875f, 0.3125f, 0.1875f), float4(0.5f, 0.0f, 0.5f, 0.0f), float4(0.75f, 0.0f, 0.25f, 0.0f), float4(0.3125f, 0.4375f, 0.0625f, 0.1875f),
+	float4(0.625f, 0.125f, 0.1875f, 0.0625f), float4(0.125f, 0.625f, 0.0625f, 0.1875f), float4(0.5f, 0.25f, 0.125f, 0.125f), float4(0.75f, 0.0f, 0.25f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.375f, 0.625f, 0.0f, 0.0f), float4(0.8125f, 0.1875f, 0.0f, 0.0f), float4(0.1875f, 0.8125f, 0.0f, 0.0f),
+	float4(0.625f, 0.375f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.1875f, 0.8125f, 0.0f, 0.0f),
+	float4(0.375f, 0.625f, 0.0f, 0.0f), float4(0.625f, 0.375f, 0.0f, 0.0f), float4(0.8125f, 0.1875f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.1875f, 0.8125f, 0.0f, 0.0f), float4(0.375f, 0.625f, 0.0f, 0.0f), float4(0.625f, 0.375f, 0.0f, 0.0f),
+	float4(0.8125f, 0.1875f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.1875f, 0.8125f, 0.0f, 0.0f),
+	float4(0.375f, 0.625f, 0.0f, 0.0f), float4(0.625f, 0.375f, 0.0f, 0.0f), float4(0.8125f, 0.1875f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.1875f, 0.8125f, 0.0f, 0.0f), float4(0.375f, 0.625f, 0.0f, 0.0f), float4(0.625f, 0.375f, 0.0f, 0.0f),
+	float4(0.8125f, 0.1875f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.1875f, 0.8125f, 0.0f, 0.0f),
+	float4(0.375f, 0.625f, 0.0f, 0.0f), float4(0.625f, 0.375f, 0.0f, 0.0f), float4(0.8125f, 0.1875f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+};
+static const uint4 pseudo_inverse_idx_6x5[284] =
+{
+	uint4(0, 1, 2, 3), uint4(4, 5, 6, 7), uint4(8, 10, 12, 13), uint4(14, 18, 19, 24),
+	uint4(0, 1, 2, 3), uint4(4, 5, 8, 9), uint4(10, 12, 13, 14), uint4(16, 18, 19, 20),
+	uint4(0, 1, 2, 3), uint4(4, 5, 9, 10), uint4(11, 15, 16, 17), uint4(19, 21, 22, 27),
+	uint4(0, 1, 2, 3), uint4(4, 5, 9, 10), uint4(11, 15, 16, 17), uint4(21, 22, 23, 29),
+	uint4(0, 1, 2, 6), uint4(7, 8, 10, 12), uint4(13, 14, 16, 18), uint4(19, 20, 24, 25),
+	uint4(1, 2, 6, 7), uint4(8, 9, 10, 11), uint4(12, 13, 14, 16), uint4(18, 19, 20, 26),
+	uint4(3, 4, 5, 6), uint4(7, 9, 10, 11), uint4(13, 14, 15, 16), uint4(17, 21, 22, 23),
+	uint4(3, 4, 5, 7), uint4(9, 10, 11, 15), uint4(16, 17, 21, 22), uint4(23, 27, 28, 29),
+	uint4(0, 1, 2, 6), uint4(7, 8, 12, 13), uint4(14, 18, 19, 20), uint4(22, 24, 25, 26),
+	uint4(6, 7, 8, 12), uint4(13, 14, 15, 16), uint4(18, 19, 20, 22), uint4(23, 24, 25, 26),
+	uint4(3, 9, 10, 11), uint4(13, 15, 16, 17), uint4(18, 19, 20, 21), uint4(22, 23, 27, 28),
+	uint4(4, 5, 9, 10), uint4(11, 13, 15, 16), uint4(17, 19, 21, 22), uint4(23, 27, 28, 29),
+	uint4(0, 6, 7, 8), uint4(12, 13, 14, 18), uint4(19, 20, 24, 25), uint4(26, 27, 28, 29),
+	uint4(2, 7, 8, 10), uint4(12, 13, 14, 18), uint4(19, 20, 24, 25), uint4(26, 27, 28, 29),
+	uint4(9, 10, 11, 13), uint4(15, 16, 17, 19), uint4(20, 21, 24, 25), uint4(26, 27, 28, 29),
+	uint4(5, 10, 11, 15), uint4(16, 17, 19, 21), uint4(22, 23, 24, 25), uint4(26, 27, 28, 29),
+	uint4(0, 1, 2, 3), uint4(4, 5, 0, 0), uint4(0, 0, 0, 0), uint4(0, 0, 0, 0),
+	uint4(0, 1, 2, 3), uint4(4, 5, 0, 0), uint4(0, 0, 0, 0), uint4(0, 0, 0, 0),
+	uint4(0, 1, 2, 3), uint4(4, 5, 0, 0), uint4(0, 0, 0, 0), uint4(0, 0, 0, 0),
+	uint4(0, 1, 2, 3), uint4(4, 5, 0, 0), uint4(0, 0, 0, 0), uint4(0, 0, 0, 0),
+	uint4(0, 1, 2, 3), uint4(4, 5, 0, 0), uint4(0, 0, 0, 0), uint4(0, 0, 0, 0),
+	uint4(6, 7, 8, 9), uint4(10, 11, 6, 6), uint4(6, 6, 6, 6), uint4(6, 6, 6, 6),
+	uint4(6, 7, 8, 9), uint4(10, 11, 6, 6), uint4(6, 6, 6, 6), uint4(6, 6, 6, 6),
+	uint4(6, 7, 8, 9), uint4(10, 11, 6, 6), uint4(6, 6, 6, 6), uint4(6, 6, 6, 6),
+	uint4(6, 7, 8, 9), uint4(10, 11, 6, 6), uint4(6, 6, 6, 6), uint4(6, 6, 6, 6),
+	uint4(6, 7, 8, 9), uint4(10, 11, 6, 6), uint4(6, 6, 6, 6), uint4(6, 6, 6, 6),
+	uint4(12, 13, 14, 15), uint4(16, 17, 12, 12), uint4(12, 12, 12, 12), uint4(12, 12, 12, 12),
+	uint4(12, 13, 14, 15), uint4(16, 17, 12, 12), uint4(12, 12, 12, 12), uint4(12, 12, 12, 12),
+	uint4(12, 13, 14, 15), uint4(16, 17, 12, 12), uint4(12, 12, 12, 12), uint4(12, 12, 12, 12),
+	uint4(12, 13, 14, 15), uint4(16, 17, 12, 12), uint4(12, 12, 12, 12), uint4(12, 12, 12, 12),
+	uint4(12, 13, 14, 15), uint4(16, 17, 12, 12), uint4(12, 12, 12, 12), uint4(12, 12, 12, 12),
+	uint4(18, 19, 20, 21), uint4(22, 23, 18, 18), uint4(18, 18, 18, 18), uint4(18, 18, 18, 18),
+	uint4(18, 19, 20, 21), uint4(22, 23, 18, 18), uint4(18, 18, 18, 18), uint4(18, 18, 18, 18),
+	uint4(18, 19, 20, 21), uint4(22, 23, 18, 18), uint4(18, 18, 18, 18), uint4(18, 18, 18, 18),
+	uint4(18, 19, 20, 21), uint4(22, 23, 18, 18), uint4(18, 18, 18, 18), uint4(18, 18, 18, 18),
+	uint4(18, 19, 20, 21), uint4(22, 23, 18, 18), uint4(18, 18, 18, 18), uint4(18, 18, 18, 18),
+	uint4(24, 25, 26, 27), uint4(28, 29, 24, 24), uint4(24, 24, 24, 24), uint4(24, 24, 24, 24),
+	uint4(24, 25, 26, 27), uint4(28, 29, 24, 24), uint4(24, 24, 24, 24), uint4(24, 24, 24, 24),
+	uint4(24, 25, 26, 27), uint4(28, 29, 24, 24), uint4(24, 24, 24, 24), uint4(24, 24, 24, 24),
+	uint4(24, 25, 26, 27), uint4(28, 29, 24, 24), uint4(24, 24, 24, 24), uint4(24, 24, 24, 24),
+	uint4(24, 25, 26, 27), uint4(28, 29, 24, 24), uint4(24, 24, 24, 24), uint4(24, 24, 24, 24),
+	uint4(0, 0, 0, 0), uint4(0, 0, 0, 0), uint4(0, 0, 0, 0), uint4(0, 0, 0, 0),
+	uint4(1, 1, 1, 1), uint4(1, 1, 1, 1), uint4(1, 1, 1, 1), uint4(1, 1, 1, 1),
+	uint4(2, 2, 2, 2), uint4(2, 2, 2, 2), uint4(2, 2, 2, 2), uint4(2, 2, 2, 2),
+	uint4(3, 3, 3, 3), uint4(3, 3, 3, 3), uint4(3, 3, 3, 3), uint4(3, 3, 3, 3),
+	uint4(4, 4, 4, 4), uint4(4, 4, 4, 4), uint4(4, 4, 4, 4), uint4(4, 4, 4, 4),
+	uint4(5, 5, 5, 5), uint4(5, 5, 5, 5), uint4(5, 5, 5, 5), uint4(5, 5, 5, 5),
+	uint4(6, 6, 6, 6), uint4(6, 6, 6, 6), uint4(6, 6, 6, 6), uint4(6, 6, 6, 6),
+	uint4(7, 7, 7, 7), uint4(7, 7, 7, 7), uint4(7, 7, 7, 7), uint4(7, 7, 7, 7),
+	uint4(8, 8, 8, 8), uint4(8, 8, 8, 8), uint4(8, 8, 8, 8), uint4(8, 8, 8, 8),
+	uint4(9, 9, 9, 9), uint4(9, 9, 9, 9), uint4(9, 9, 9, 9), uint4(9, 9, 9, 9),
+	uint4(10, 10, 10, 10), uint4(10, 10, 10, 10), uint4(10, 10, 10, 10), uint4(10, 10, 10, 10),
+	uint4(11, 11, 11, 11), uint4(11, 11, 11, 11), uint4(11, 11, 11, 11), uint4(11, 11, 11, 11),
+	uint4(12, 12, 12, 12), uint4(12, 12, 12, 12), uint4(12, 12, 12, 12), uint4(12, 12, 12, 12),
+	uint4(13, 13, 13, 13), uint4(13, 13, 13, 13), uint4(13, 13, 13, 13), uint4(13, 13, 13, 13),
+	uint4(14, 14, 14, 14), uint4(14, 14, 14, 14), uint4(14, 14, 14, 14), uint4(14, 14, 14, 14),
+	uint4(15, 15, 15, 15), uint4(15, 15, 15, 15), uint4(15, 15, 15, 15), uint4(15, 15, 15, 15),
+	uint4(16, 16, 16, 16), uint4(16, 16, 16, 16), uint4(16, 16, 16, 16), uint4(16, 16, 16, 16),
+	uint4(17, 17, 17, 17), uint4(17, 17, 17, 17), uint4(17, 17, 17, 17), uint4(17, 17, 17, 17),
+	uint4(18, 18, 18, 18), uint4(18, 18, 18, 18), uint4(18, 18, 18, 18), uint4(18, 18, 18, 18),
+	uint4(19, 19, 19, 19), uint4(19, 19, 19, 19), uint4(19, 19, 19, 19), uint4(19, 19, 19, 19),
+	uint4(20, 20, 20, 20), uint4(20, 20, 20, 20), uint4(20, 20, 20, 20), uint4(20, 20, 20, 20),
+	uint4(21, 21, 21, 21), uint4(21, 21, 21, 21), uint4(21, 21, 21, 21), uint4(21, 21, 21, 21),
+	uint4(22, 22, 22, 22), uint4(22, 22, 22, 22), uint4(22, 22, 22, 22), uint4(22, 22, 22, 22),
+	uint4(23, 23, 23, 23), uint4(23, 23, 23, 23), uint4(23, 23, 23, 23), uint4(23, 23, 23, 23),
+	uint4(24, 24, 24, 24), uint4(24, 24, 24, 24), uint4(24, 24, 24, 24), uint4(24, 24, 24, 24),
+	uint4(25, 25, 25, 25), uint4(25, 25, 25, 25), uint4(25, 25, 25, 25), uint4(25, 25, 25, 25),
+	uint4(26, 26, 26, 26), uint4(26, 26, 26, 26), uint4(26, 26, 26, 26), uint4(26, 26, 26, 26),
+	uint4(27, 27, 27, 27), uint4(27, 27, 27, 27), uint4(27, 27, 27, 27), uint4(27, 27, 27, 27),
+	uint4(28, 28, 28, 28), uint4(28, 28, 28, 28), uint4(28, 28, 28, 28), uint4(28, 28, 28, 28),
+	uint4(29, 29, 29, 29), uint4(29, 29, 29, 29), uint4(29, 29, 29, 29), uint4(29, 29, 29, 29),
+};
+static const float4 pseudo_inverse_wt_6x5[284] =
+{
+	float4(0.905849f, 0.206215f, -0.161749f, 0.0109726f), float4(0.0344977f, -0.0126544f, 0.0480306f, 0.0385045f),
+	float4(-0.0224607f, 0.00865551f, -0.0816095f, -0.0258361f), float4(0.00689922f, 0.0528495f, 0.019238f, -0.0126709f),
+	float4(-0.213565f, 0.570923f, 0.789013f, -0.0529969f), float4(-0.167764f, 0.0619637f, 0.0507805f, 0.0146433f),
+	float4(-0.0317184f, 0.0201337f, -0.0366599f, -0.0637542f), float4(0.0135179f, -0.0135993f, 0.0224202f, 0.0405851f),
+	float4(0.062789f, -0.167454f, -0.0538466f, 0.785331f), float4(0.56887f, -0.211488f, 0.0119864f, 0.0734807f),
+	float4(-0.0257233f, -0.0628739f, -0.0557259f, 0.0135567f), float4(-0.00777152f, 0.0434416f, 0.0350006f, -0.00929235f),
+	float4(-0.0126544f, 0.0339819f, 0.0106915f, -0.160216f), float4(0.208284f, 0.907903f, 0.00924138f, -0.019267f),
+	float4(0.0607785f, 0.0174488f, -0.0111758f, -0.0749349f), float4(-0.0115807f, 0.00636989f, 0.0506272f, -0.0126709f),
+	float4(-0.237909f, -0.0518273f, 0.0456153f, 0.940294f), float4(0.178165f, -0.146559f, 0.0249296f, 0.456985f),
+	float4(0.11598f, -0.0797566f, 0.0173988f, -0.296362f), float4(-0.0894945f, 0.0522023f, 0.0717266f, 0.0212194f),
+	float4(-0.123489f, -0.161604f, -0.193524f, 0.574376f), float4(0.747819f, -0.0687945f, -0.129162f, 0.0535828f),
+	float4(-0.0885953f, 0.244515f, 0.39963f, -0.0872821f), float4(0.0610982f, -0.151592f, -0.254344f, 0.0617877f),
+	float4(-0.211146f, -0.141902f, 0.0751815f, 0.0542603f), float4(-0.160891f, 0.877135f, 0.533487f, -0.221245f),
+	float4(-0.059283f, -0.0617667f, 0.353617f, 0.304686f), float4(-0.115819f, -0.243889f, -0.190084f, 0.0644025f),
+	float4(0.0284684f, -0.0604747f, -0.221596f, 0.0338919f), float4(-0.183975f, 0.256411f, 0.912995f, -0.0736972f),
+	float4(0.0911557f, 0.436067f, 0.0480916f, -0.0536368f), float4(-0.295621f, -0.0146833f, 0.0157873f, 0.0746897f),
+	float4(0.0746897f, 0.0157873f, -0.0146833f, -0.295621f), float4(-0.0536368f, 0.0480916f, 0.436067f, 0.0911557f),
+	float4(-0.0736972f, 0.912995f, 0.256411f, -0.183975f), float4(0.0338919f, -0.221596f, -0.0604747f, 0.0284684f),
+	float4(0.0644025f, -0.190084f, -0.243889f, -0.115819f), float4(0.304686f, 0.353617f, -0.0617667f, -0.059283f),
+	float4(-0.221245f, 0.533487f, 0.877135f, -0.160891f), float4(0.0542603f, 0.0751815f, -0.141902f, -0.211146f),
+	float4(0.0617877f, -0.254344f, -0.151592f, 0.0610982f), float4(-0.0872821f, 0.39963f, 0.244515f, -0.0885953f),
+	float4(0.0535828f, -0.129162f, -0.0687945f, 0.747819f), float4(0.574376f, -0.193524f, -0.161604f, -0.123489f),
+	float4(0.0212194f, 0.0717266f, 0.0522023f, -0.0894945f), float4(-0.296362f, 0.0173988f, -0.0797566f, 0.11598f),
+	float4(0.456985f, 0.0249296f, -0.146559f, 0.178165f), float4(0.940294f, 0.0456153f, -0.0518273f, -0.237909f),
+	float4(-0.0126709f, 0.0506272f, 0.00636989f, -0.0115807f), float4(-0.0749349f, -0.0111758f, 0.0174488f, 0.0607785f),
+	float4(-0.019267f, 0.00924138f, 0.907903f, 0.208284f), float4(-0.160216f, 0.0106915f, 0.0339819f, -0.0126544f),
+	float4(-0.00929235f, 0.0350006f, 0.0434416f, -0.00777152f), float4(0.0135567f, -0.0557259f, -0.0628739f, -0.0257233f),
+	float4(0.0734807f, 0.0119864f, -0.211488f, 0.56887f), float4(0.785331f, -0.0538466f, -0.167454f, 0.062789f),
+	float4(0.0405851f, 0.0224202f, -0.0135993f, 0.0135179f), float4(-0.0637542f, -0.0366599f, 0.0201337f, -0.0317184f),
+	float4(0.0146433f, 0.0507805f, 0.0619637f, -0.167764f), float4(-0.0529969f, 0.789013f, 0.570923f, -0.213565f),
+	float4(-0.0126709f, 0.019238f, 0.0528495f, 0.00689922f), float4(-0.0258361f, -0.0816095f, 0.00865551f, -0.0224607f),
+	float4(0.0385045f, 0.0480306f, -0.0126544f, 0.0344977f), float4(0.0109726f, -0.161749f, 0.206215f, 0.905849f),
+	float4(0.996932f, 0.0163624f, -0.0354519f, 0.0354519f), float4(-0.0163624f, 0.00306795f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(-0.209923f, 1.11959f, 0.240891f, -0.240891f), float4(0.11118f, -0.0208463f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0692308f, -0.369231f, 0.8f, 0.8f), float4(-0.369231f, 0.0692308f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(-0.0208463f, 0.11118f, -0.240891f, 0.240891f), float4(1.11959f, -0.209923f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.00306795f, -0.0163624f, 0.0354519f, -0.0354519f), float4(0.0163624f, 0.996932f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.996932f, 0.0163624f, -0.0354519f, 0.0354519f), float4(-0.0163624f, 0.00306795f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(-0.209923f, 1.11959f, 0.240891f, -0.240891f), float4(0.11118f, -0.0208463f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0692308f, -0.369231f, 0.8f, 0.8f), float4(-0.369231f, 0.0692308f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(-0.0208463f, 0.11118f, -0.240891f, 0.240891f), float4(1.11959f, -0.209923f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.00306795f, -0.0163624f, 0.0354519f, -0.0354519f), float4(0.0163624f, 0.996932f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.996932f, 0.0163624f, -0.0354519f, 0.0354519f), float4(-0.0163624f, 0.00306795f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(-0.209923f, 1.11959f, 0.240891f, -0.240891f), float4(0.11118f, -0.0208463f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0692308f, -0.369231f, 0.8f, 0.8f), float4(-0.369231f, 0.0692308f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(-0.0208463f, 0.11118f, -0.240891f, 0.240891f), float4(1.11959f, -0.209923f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.00306795f, -0.0163624f, 0.0354519f, -0.0354519f), float4(0.0163624f, 0.996932f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.996932f, 0.0163624f, -0.0354519f, 0.0354519f), float4(-0.0163624f, 0.00306795f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(-0.209923f, 1.11959f, 0.240891f, -0.240891f), float4(0.11118f, -0.0208463f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0692308f, -0.369231f, 0.8f, 0.8f), float4(-0.369231f, 0.0692308f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(-0.0208463f, 0.11118f, -0.240891f, 0.240891f), float4(1.11959f, -0.209923f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.00306795f, -0.0163624f, 0.0354519f, -0.0354519f), float4(0.0163624f, 0.996932f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.996932f, 0.0163624f, -0.0354519f, 0.0354519f), float4(-0.0163624f, 0.00306795f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(-0.209923f, 1.11959f, 0.240891f, -0.240891f), float4(0.11118f, -0.0208463f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0692308f, -0.369231f, 0.8f, 0.8f), float4(-0.369231f, 0.0692308f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(-0.0208463f, 0.11118f, -0.240891f, 0.240891f), float4(1.11959f, -0.209923f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.00306795f, -0.0163624f, 0.0354519f, -0.0354519f), float4(0.0163624f, 0.996932f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+};
+
+#define WEIGHT_GRID_COUNT_6X6 3
+#define MAX_GRID_WEIGHTS_6X6 36
+static const uint4 weight_grids_6x6[WEIGHT_GRID_COUNT_6X6] = { uint4(4, 4, 0, 0), uint4(5, 5, 16, 36), uint4(6, 6, 41, 72) };
+static const uint4 decimation_idx_6x6[77] =
+{
+	uint4(0, 1, 6, 7), uint4(1, 2, 7, 8), uint4(3, 4, 9, 10), uint4(5, 5, 11, 11),
+	uint4(6, 7, 12, 13), uint4(7, 8, 13, 14), uint4(9, 10, 15, 16), uint4(11, 11, 17, 17),
+	uint4(18, 19, 24, 25), uint4(19, 20, 25, 26), uint4(21, 22, 27, 28), uint4(23, 23, 29, 29),
+	uint4(30, 31, 30, 31), uint4(31, 32, 31, 32), uint4(33, 34, 33, 34), uint4(35, 35, 35, 35),
+	uint4(0, 1, 6, 7), uint4(1, 2, 7, 8), uint4(2, 3, 8, 9), uint4(3, 4, 9, 10),
+	uint4(5, 5, 11, 11), uint4(6, 7, 12, 13), uint4(7, 8, 13, 14), uint4(8, 9, 14, 15),
+	uint4(9, 10, 15, 16), uint4(11, 11, 17, 17), uint4(12, 13, 18, 19), uint4(13, 14, 19, 20),
+	uint4(14, 15, 20, 21), uint4(15, 16, 21, 22), uint4(17, 17, 23, 23), uint4(18, 19, 24, 25),
+	uint4(19, 20, 25, 26), uint4(20, 21, 26, 27), uint4(21, 22, 27, 28), uint4(23, 23, 29, 29),
+	uint4(30, 31, 30, 31), uint4(31, 32, 31, 32), uint4(32, 33, 32, 33), uint4(33, 34, 33, 34),
+	uint4(35, 35, 35, 35), uint4(0, 1, 6, 7), uint4(1, 2, 7, 8), uint4(2, 3, 8, 9),
+	uint4(3, 4, 9, 10), uint4(4, 5, 10, 11), uint4(5, 5, 11, 11), uint4(6, 7, 12, 13),
+	uint4(7, 8, 13, 14), uint4(8, 9, 14, 15), uint4(9, 10, 15, 16), uint4(10, 11, 16, 17),
+	uint4(11, 11, 17, 17), uint4(12, 13, 18, 19), uint4(13, 14, 19, 20), uint4(14, 15, 20, 21),
+	uint4(15, 16, 21, 22), uint4(16, 17, 22, 23), uint4(17, 17, 23, 23), uint4(18, 19, 24, 25),
+	uint4(19, 20, 25, 26), uint4(20, 21, 26, 27), uint4(21, 22, 27, 28), uint4(22, 23, 28, 29),
+	uint4(23, 23, 29, 29), uint4(24, 25, 30, 31), uint4(25, 26, 31, 32), uint4(26, 27, 32, 33),
+	uint4(27, 28, 33, 34), uint4(28, 29, 34, 35), uint4(29, 29, 35, 35), uint4(30, 31, 30, 31),
+	uint4(31, 32, 31, 32), uint4(32, 33, 32, 33), uint4(33, 34, 33, 34), uint4(34, 35, 34, 35),
+	uint4(35, 35, 35, 35),
+};
+static const float4 decimation_wt_6x6[77] =
+{
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.333333373f, 0.666666627f, 0.0f, 0.0f),
+	float4(0.666666746f, 0.333333254f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.333333373f, 0.0f, 0.666666627f, 0.0f), float4(0.111111134f, 0.222222239f, 0.222222239f, 0.444444388f),
+	float4(0.222222269f, 0.111111097f, 0.444444478f, 0.222222149f), float4(0.333333373f, 0.0f, 0.666666627f, 0.0f),
+	float4(0.666666746f, 0.0f, 0.333333254f, 0.0f), float4(0.222222269f, 0.444444478f, 0.111111097f, 0.222222149f),
+	float4(0.444444537f, 0.222222194f, 0.222222194f, 0.11111106f), float4(0.666666746f, 0.0f, 0.333333254f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.333333373f, 0.666666627f, 0.0f, 0.0f),
+	float4(0.666666746f, 0.333333254f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.75f, 0.25f, 0.0f, 0.0f),
+	float4(0.5f, 0.5f, 0.0f, 0.0f), float4(0.25f, 0.75f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.75f, 0.0f, 0.25f, 0.0f),
+	float4(0.5625f, 0.1875f, 0.1875f, 0.0625f), float4(0.375f, 0.375f, 0.125f, 0.125f),
+	float4(0.1875f, 0.5625f, 0.0625f, 0.1875f), float4(0.75f, 0.0f, 0.25f, 0.0f),
+	float4(0.5f, 0.0f, 0.5f, 0.0f), float4(0.375f, 0.125f, 0.375f, 0.125f),
+	float4(0.25f, 0.25f, 0.25f, 0.25f), float4(0.125f, 0.375f, 0.125f, 0.375f),
+	float4(0.5f, 0.0f, 0.5f, 0.0f), float4(0.25f, 0.0f, 0.75f, 0.0f),
+	float4(0.1875f, 0.0625f, 0.5625f, 0.1875f), float4(0.125f, 0.125f, 0.375f, 0.375f),
+	float4(0.0625f, 0.1875f, 0.1875f, 0.5625f), float4(0.25f, 0.0f, 0.75f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.75f, 0.25f, 0.0f, 0.0f),
+	float4(0.5f, 0.5f, 0.0f, 0.0f), float4(0.25f, 0.75f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f),
+};
+static const uint4 infill_idx_6x6[108] =
+{
+	uint4(0, 0, 0, 0), uint4(0, 1, 0, 0), uint4(1, 2, 1, 1), uint4(1, 2, 1, 1),
+	uint4(2, 3, 2, 2), uint4(3, 3, 3, 3), uint4(0, 0, 4, 0), uint4(0, 1, 4, 5),
+	uint4(1, 2, 5, 6), uint4(1, 2, 5, 6), uint4(2, 3, 6, 7), uint4(3, 3, 7, 3),
+	uint4(4, 4, 8, 4), uint4(4, 5, 8, 9), uint4(5, 6, 9, 10), uint4(5, 6, 9, 10),
+	uint4(6, 7, 10, 11), uint4(7, 7, 11, 7), uint4(4, 4, 8, 4), uint4(4, 5, 8, 9),
+	uint4(5, 6, 9, 10), uint4(5, 6, 9, 10), uint4(6, 7, 10, 11), uint4(7, 7, 11, 7),
+	uint4(8, 8, 12, 8), uint4(8, 9, 12, 13), uint4(9, 10, 13, 14), uint4(9, 10, 13, 14),
+	uint4(10, 11, 14, 15), uint4(11, 11, 15, 11), uint4(12, 12, 12, 12), uint4(12, 13, 12, 12),
+	uint4(13, 14, 13, 13), uint4(13, 14, 13, 13), uint4(14, 15, 14, 14), uint4(15, 15, 15, 15),
+	uint4(0, 0, 0, 0), uint4(0, 1, 0, 0), uint4(1, 2, 1, 1), uint4(2, 3, 2, 2),
+	uint4(3, 4, 3, 3), uint4(4, 4, 4, 4), uint4(0, 0, 5, 0), uint4(0, 1, 5, 6),
+	uint4(1, 2, 6, 7), uint4(2, 3, 7, 8), uint4(3, 4, 8, 9), uint4(4, 4, 9, 4),
+	uint4(5, 5, 10, 5), uint4(5, 6, 10, 11), uint4(6, 7, 11, 12), uint4(7, 8, 12, 13),
+	uint4(8, 9, 13, 14), uint4(9, 9, 14, 9), uint4(10, 10, 15, 10), uint4(10, 11, 15, 16),
+	uint4(11, 12, 16, 17), uint4(12, 13, 17, 18), uint4(13, 14, 18, 19), uint4(14, 14, 19, 14),
+	uint4(15, 15, 20, 15), uint4(15, 16, 20, 21), uint4(16, 17, 21, 22), uint4(17, 18, 22, 23),
+	uint4(18, 19, 23, 24), uint4(19, 19, 24, 19), uint4(20, 20, 20, 20), uint4(20, 21, 20, 20),
+	uint4(21, 22, 21, 21), uint4(22, 23, 22, 22), uint4(23, 24, 23, 23), uint4(24, 24, 24, 24),
+	uint4(0, 0, 0, 0), uint4(1, 1, 1, 1), uint4(2, 2, 2, 2), uint4(3, 3, 3, 3),
+	uint4(4, 4, 4, 4), uint4(5, 5, 5, 5), uint4(6, 6, 6, 6), uint4(7, 7, 7, 7),
+	uint4(8, 8, 8, 8), uint4(9, 9, 9, 9), uint4(10, 10, 10, 10), uint4(11, 11, 11, 11),
+	uint4(12, 12, 12, 12), uint4(13, 13, 13, 13), uint4(14, 14, 14, 14), uint4(15, 15, 15, 15),
+	uint4(16, 16, 16, 16), uint4(17, 17, 17, 17), uint4(18, 18, 18, 18), uint4(19, 19, 19, 19),
+	uint4(20, 20, 20, 20), uint4(21, 21, 21, 21), uint4(22, 22, 22, 22), uint4(23, 23, 23, 23),
+	uint4(24, 24, 24, 24), uint4(25, 25, 25, 25), uint4(26, 26, 26, 26), uint4(27, 27, 27, 27),
+	uint4(28, 28, 28, 28), uint4(29, 29, 29, 29), uint4(30, 30, 30, 30), uint4(31, 31, 31, 31),
+	uint4(32, 32, 32, 32), uint4(33, 33, 33, 33), uint4(34, 34, 34, 34), uint4(35, 35, 35, 35),
+};
+static const float4 infill_wt_6x6[108] =
+{
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.375f, 0.625f, 0.0f, 0.0f), float4(0.8125f, 0.1875f, 0.0f, 0.0f), float4(0.1875f, 0.8125f, 0.0f, 0.0f),
+	float4(0.625f, 0.375f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.375f, 0.0f, 0.625f, 0.0f), float4(0.125f, 0.25f, 0.25f, 0.375f),
+	float4(0.3125f, 0.0625f, 0.5f, 0.125f), float4(0.0625f, 0.3125f, 0.125f, 0.5f), float4(0.25f, 0.125f, 0.375f, 0.25f), float4(0.375f, 0.0f, 0.625f, 0.0f),
+	float4(0.8125f, 0.0f, 0.1875f, 0.0f), float4(0.3125f, 0.5f, 0.0625f, 0.125f), float4(0.6875f, 0.125f, 0.125f, 0.0625f), float4(0.125f, 0.6875f, 0.0625f, 0.125f),
+	float4(0.5f, 0.3125f, 0.125f, 0.0625f), float4(0.8125f, 0.0f, 0.1875f, 0.0f), float4(0.1875f, 0.0f, 0.8125f, 0.0f), float4(0.0625f, 0.125f, 0.3125f, 0.5f),
+	float4(0.125f, 0.0625f, 0.6875f, 0.125f), float4(0.0625f, 0.125f, 0.125f, 0.6875f), float4(0.125f, 0.0625f, 0.5f, 0.3125f), float4(0.1875f, 0.0f, 0.8125f, 0.0f),
+	float4(0.625f, 0.0f, 0.375f, 0.0f), float4(0.25f, 0.375f, 0.125f, 0.25f), float4(0.5f, 0.125f, 0.3125f, 0.0625f), float4(0.125f, 0.5f, 0.0625f, 0.3125f),
+	float4(0.375f, 0.25f, 0.25f, 0.125f), float4(0.625f, 0.0f, 0.375f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.375f, 0.625f, 0.0f, 0.0f),
+	float4(0.8125f, 0.1875f, 0.0f, 0.0f), float4(0.1875f, 0.8125f, 0.0f, 0.0f), float4(0.625f, 0.375f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.1875f, 0.8125f, 0.0f, 0.0f), float4(0.375f, 0.625f, 0.0f, 0.0f), float4(0.625f, 0.375f, 0.0f, 0.0f),
+	float4(0.8125f, 0.1875f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.1875f, 0.0f, 0.8125f, 0.0f), float4(0.0625f, 0.125f, 0.125f, 0.6875f),
+	float4(0.0625f, 0.125f, 0.3125f, 0.5f), float4(0.125f, 0.0625f, 0.5f, 0.3125f), float4(0.125f, 0.0625f, 0.6875f, 0.125f), float4(0.1875f, 0.0f, 0.8125f, 0.0f),
+	float4(0.375f, 0.0f, 0.625f, 0.0f), float4(0.0625f, 0.3125f, 0.125f, 0.5f), float4(0.125f, 0.25f, 0.25f, 0.375f), float4(0.25f, 0.125f, 0.375f, 0.25f),
+	float4(0.3125f, 0.0625f, 0.5f, 0.125f), float4(0.375f, 0.0f, 0.625f, 0.0f), float4(0.625f, 0.0f, 0.375f, 0.0f), float4(0.125f, 0.5f, 0.0625f, 0.3125f),
+	float4(0.25f, 0.375f, 0.125f, 0.25f), float4(0.375f, 0.25f, 0.25f, 0.125f), float4(0.5f, 0.125f, 0.3125f, 0.0625f), float4(0.625f, 0.0f, 0.375f, 0.0f),
+	float4(0.8125f, 0.0f, 0.1875f, 0.0f), float4(0.125f, 0.6875f, 0.0625f, 0.125f), float4(0.3125f, 0.5f, 0.0625f, 0.125f), float4(0.5f, 0.3125f, 0.125f, 0.0625f),
+	float4(0.6875f, 0.125f, 0.125f, 0.0625f), float4(0.8125f, 0.0f, 0.1875f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.1875f, 0.8125f, 0.0f, 0.0f),
+	float4(0.375f, 0.625f, 0.0f, 0.0f), float4(0.625f, 0.375f, 0.0f, 0.0f), float4(0.8125f, 0.1875f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+};
+static const uint4 pseudo_inverse_idx_6x6[308] =
+{
+	uint4(0, 1, 2, 3), uint4(4, 5, 6, 7), uint4(8, 12, 13, 14), uint4(18, 24, 25, 30),
+	uint4(0, 1, 2, 3), uint4(4, 5, 6, 7), uint4(8, 9, 10, 12), uint4(13, 14, 16, 26),
+	uint4(0, 1, 2, 3), uint4(4, 5, 7, 8), uint4(9, 10, 11, 13), uint4(15, 16, 17, 27),
+	uint4(0, 1, 2, 3), uint4(4, 5, 7, 9), uint4(10, 11, 15, 16), uint4(17, 23, 29, 35),
+	uint4(0, 1, 2, 6), uint4(7, 8, 12, 13), uint4(14, 16, 18, 19), uint4(24, 25, 26, 30),
+	uint4(0, 1, 2, 6), uint4(7, 8, 10, 12), uint4(13, 14, 15, 16), uint4(20, 25, 26, 32),
+	uint4(3, 4, 5, 7), uint4(9, 10, 11, 13), uint4(14, 15, 16, 17), uint4(21, 27, 28, 33),
+	uint4(3, 4, 5, 9), uint4(10, 11, 13, 15), uint4(16, 17, 22, 23), uint4(27, 28, 29, 35),
+	uint4(0, 6, 7, 8), uint4(12, 13, 18, 19), uint4(20, 22, 24, 25), uint4(26, 30, 31, 32),
+	uint4(7, 8, 14, 18), uint4(19, 20, 21, 22), uint4(23, 24, 25, 26), uint4(28, 30, 31, 32),
+	uint4(9, 10, 15, 18), uint4(19, 20, 21, 22), uint4(23, 25, 27, 28), uint4(29, 33, 34, 35),
+	uint4(5, 9, 10, 11), uint4(16, 17, 19, 21), uint4(22, 23, 27, 28), uint4(29, 33, 34, 35),
+	uint4(0, 6, 7, 12), uint4(18, 19, 20, 24), uint4(25, 26, 30, 31), uint4(32, 33, 34, 35),
+	uint4(8, 18, 19, 20), uint4(22, 24, 25, 26), uint4(27, 28, 30, 31), uint4(32, 33, 34, 35),
+	uint4(9, 19, 21, 22), uint4(23, 25, 26, 27), uint4(28, 29, 30, 31), uint4(32, 33, 34, 35),
+	uint4(5, 10, 11, 17), uint4(21, 22, 23, 27), uint4(28, 29, 30, 31), uint4(32, 33, 34, 35),
+	uint4(0, 1, 2, 3), uint4(4, 5, 6, 7), uint4(8, 9, 12, 13), uint4(18, 19, 24, 30),
+	uint4(0, 1, 2, 3), uint4(4, 5, 7, 8), uint4(9, 12, 13, 15), uint4(18, 19, 21, 25),
+	uint4(0, 1, 2, 3), uint4(4, 5, 8, 9), uint4(14, 15, 16, 20), uint4(21, 22, 26, 27),
+	uint4(0, 1, 2, 3), uint4(4, 5, 8, 9), uint4(10, 14, 16, 17), uint4(20, 22, 23, 28),
+	uint4(0, 1, 2, 3), uint4(4, 5, 8, 9), uint4(10, 11, 16, 17), uint4(22, 23, 29, 35),
+	uint4(0, 2, 3, 6), uint4(7, 8, 9, 10), uint4(12, 13, 18, 19), uint4(20, 21, 24, 30),
+	uint4(1, 2, 3, 6), uint4(7, 8, 9, 10), uint4(12, 13, 15, 18), uint4(19, 20, 21, 25),
+	uint4(2, 3, 7, 8), uint4(9, 10, 13, 14), uint4(15, 16, 19, 20), uint4(21, 22, 26, 27),
+	uint4(2, 3, 4, 7), uint4(8, 9, 10, 11), uint4(14, 16, 17, 20), uint4(21, 22, 23, 28),
+	uint4(2, 3, 5, 7), uint4(8, 9, 10, 11), uint4(16, 17, 20, 21), uint4(22, 23, 29, 35),
+	uint4(0, 6, 8, 12), uint4(13, 14, 15, 16), uint4(18, 19, 20, 21), uint4(22, 24, 26, 30),
+	uint4(7, 8, 9, 12), uint4(13, 14, 15, 16), uint4(18, 19, 20, 21), uint4(22, 25, 26, 27),
+	uint4(7, 8, 9, 10), uint4(13, 14, 15, 16), uint4(19, 20, 21, 22), uint4(25, 26, 27, 28),
+	uint4(8, 9, 10, 13), uint4(14, 15, 16, 17), uint4(19, 20, 21, 22), uint4(23, 26, 27, 28),
+	uint4(5, 11, 13, 14), uint4(15, 16, 17, 19), uint4(20, 21, 22, 23), uint4(26, 27, 29, 35),
+	uint4(0, 6, 12, 13), uint4(14, 15, 18, 19), uint4(24, 25, 26, 27), uint4(28, 30, 32, 33),
+	uint4(7, 12, 13, 14), uint4(15, 18, 19, 21), uint4(24, 25, 26, 27), uint4(28, 31, 32, 33),
+	uint4(8, 9, 13, 14), uint4(15, 16, 19, 20), uint4(21, 22, 25, 26), uint4(27, 28, 32, 33),
+	uint4(10, 14, 15, 16), uint4(17, 20, 22, 23), uint4(25, 26, 27, 28), uint4(29, 32, 33, 34),
+	uint4(5, 11, 14, 15), uint4(16, 17, 22, 23), uint4(25, 26, 27, 28), uint4(29, 32, 33, 35),
+	uint4(0, 6, 12, 13), uint4(18, 19, 24, 25), uint4(26, 27, 30, 31), uint4(32, 33, 34, 35),
+	uint4(7, 12, 13, 15), uint4(18, 19, 21, 25), uint4(26, 27, 30, 31), uint4(32, 33, 34, 35),
+	uint4(8, 9, 14, 15), uint4(16, 19, 20, 21), uint4(26, 27, 30, 31), uint4(32, 33, 34, 35),
+	uint4(10, 14, 16, 17), uint4(20, 22, 23, 26), uint4(27, 28, 30, 31), uint4(32, 33, 34, 35),
+	uint4(5, 11, 16, 17), uint4(22, 23, 26, 27), uint4(28, 29, 30, 31), uint4(32, 33, 34, 35),
+	uint4(0, 0, 0, 0), uint4(0, 0, 0, 0), uint4(0, 0, 0, 0), uint4(0, 0, 0, 0),
+	uint4(1, 1, 1, 1), uint4(1, 1, 1, 1), uint4(1, 1, 1, 1), uint4(1, 1, 1, 1),
+	uint4(2, 2, 2, 2), uint4(2, 2, 2, 2), uint4(2, 2, 2, 2), uint4(2, 2, 2, 2),
+	uint4(3, 3, 3, 3), uint4(3, 3, 3, 3), uint4(3, 3, 3, 3), uint4(3, 3, 3, 3),
+	uint4(4, 4, 4, 4), uint4(4, 4, 4, 4), uint4(4, 4, 4, 4), uint4(4, 4, 4, 4),
+	uint4(5, 5, 5, 5), uint4(5, 5, 5, 5), uint4(5, 5, 5, 5), uint4(5, 5, 5, 5),
+	uint4(6, 6, 6, 6), uint4(6, 6, 6, 6), uint4(6, 6, 6, 6), uint4(6, 6, 6, 6),
+	uint4(7, 7, 7, 7), uint4(7, 7, 7, 7), uint4(7, 7, 7, 7), uint4(7, 7, 7, 7),
+	uint4(8, 8, 8, 8), uint4(8, 8, 8, 8), uint4(8, 8, 8, 8), uint4(8, 8, 8, 8),
+	uint4(9, 9, 9, 9), uint4(9, 9, 9, 9), uint4(9, 9, 9, 9), uint4(9, 9, 9, 9),
+	uint4(10, 10, 10, 10), uint4(10, 10, 10, 10), uint4(10, 10, 10, 10), uint4(10, 10, 10, 10),
+	uint4(11, 11, 11, 11), uint4(11, 11, 11, 11), uint4(11, 11, 11, 11), uint4(11, 11, 11, 11),
+	uint4(12, 12, 12, 12), uint4(12, 12, 12, 12), uint4(12, 12, 12, 12), uint4(12, 12, 12, 12),
+	uint4(13, 13, 13, 13), uint4(13, 13, 13, 13), uint4(13, 13, 13, 13), uint4(13, 13, 13, 13),
+	uint4(14, 14, 14, 14), uint4(14, 14, 14, 14), uint4(14, 14, 14, 14), uint4(14, 14, 14, 14),
+	uint4(15, 15, 15, 15), uint4(15, 15, 15, 15), uint4(15, 15, 15, 15), uint4(15, 15, 15, 15),
+	uint4(16, 16, 16, 16), uint4(16, 16, 16, 16), uint4(16, 16, 16, 16), uint4(16, 16, 16, 16),
+	uint4(17, 17, 17, 17), uint4(17, 17, 17, 17), uint4(17, 17, 17, 17), uint4(17, 17, 17, 17),
+	uint4(18, 18, 18, 18), uint4(18, 18, 18, 18), uint4(18, 18, 18, 18), uint4(18, 18, 18, 18),
+	uint4(19, 19, 19, 19), uint4(19, 19, 19, 19), uint4(19, 19, 19, 19), uint4(19, 19, 19, 19),
+	uint4(20, 20, 20, 20), uint4(20, 20, 20, 20), uint4(20, 20, 20, 20), uint4(20, 20, 20, 20),
+	uint4(21, 21, 21, 21), uint4(21, 21, 21, 21), uint4(21, 21, 21, 21), uint4(21, 21, 21, 21),
+	uint4(22, 22, 22, 22), uint4(22, 22, 22, 22), uint4(22, 22, 22, 22), uint4(22, 22, 22, 22),
+	uint4(23, 23, 23, 23), uint4(23, 23, 23, 23), uint4(23, 23, 23, 23), uint4(23, 23, 23, 23),
+	uint4(24, 24, 24, 24), uint4(24, 24, 24, 24), uint4(24, 24, 24, 24), uint4(24, 24, 24, 24),
+	uint4(25, 25, 25, 25), uint4(25, 25, 25, 25), uint4(25, 25, 25, 25), uint4(25, 25, 25, 25),
+	uint4(26, 26, 26, 26), uint4(26, 26, 26, 26), uint4(26, 26, 26, 26), uint4(26, 26, 26, 26),
+	uint4(27, 27, 27, 27), uint4(27, 27, 27, 27), uint4(27, 27, 27, 27), uint4(27, 27, 27, 27),
+	uint4(28, 28, 28, 28), uint4(28, 28, 28, 28), uint4(28, 28, 28, 28), uint4(28, 28, 28, 28),
+	uint4(29, 29, 29, 29), uint4(29, 29, 29, 29), uint4(29, 29, 29, 29), uint4(29, 29, 29, 29),
+	uint4(30, 30, 30, 30), uint4(30, 30, 30, 30), uint4(30, 30, 30, 30), uint4(30, 30, 30, 30),
+	uint4(31, 31, 31, 31), uint4(31, 31, 31, 31), uint4(31, 31, 31, 31), uint4(31, 31, 31, 31),
+	uint4(32, 32, 32, 32), uint4(32, 32, 32, 32), uint4(32, 32, 32, 32), uint4(32, 32, 32, 32),
+	uint4(33, 33, 33, 33), uint4(33, 33, 33, 33), uint4(33, 33, 33, 33), uint4(33, 33, 33, 33),
+	uint4(34, 34, 34, 34), uint4(34, 34, 34, 34), uint4(34, 34, 34, 34), uint4(34, 34, 34, 34),
+	uint4(35, 35, 35, 35), uint4(35, 35, 35, 35), uint4(35, 35, 35, 35), uint4(35, 35, 35, 35),
+};
+static const float4 pseudo_inverse_wt_6x6[308] =
+{
+	float4(0.849559f, 0.195966f, -0.148877f, 0.00883075f), float4(0.0307761f, -0.0115023f, 0.195966f, 0.0277279f),
+	float4(-0.0333341f, -0.148877f, -0.0333341f, 0.0326918f), float4(0.00883075f, 0.0307761f, 0.00809056f, -0.0115023f),
+	float4(-0.19619f, 0.525116f, 0.726861f, -0.0432652f), float4(-0.150386f, 0.0561431f, -0.0489835f, 0.14112f),
+	float4(0.17792f, -0.0246386f, -0.0422516f, 0.0300742f), float4(-0.0926841f, -0.139393f, 0.025044f, 0.0242312f),
+	float4(0.0561431f, -0.150386f, -0.0432652f, 0.726861f), float4(0.525116f, -0.19619f, -0.0422516f, -0.0246386f),
+	float4(0.17792f, 0.14112f, -0.0489835f, 0.025044f), float4(-0.139393f, -0.0926841f, 0.0300742f, 0.0242312f),
+	float4(-0.0115023f, 0.0307761f, 0.00883075f, -0.148877f), float4(0.195966f, 0.849559f, 0.00809056f, -0.0333341f),
+	float4(0.0277279f, 0.195966f, 0.0326918f, -0.0333341f), float4(-0.148877f, 0.00883075f, 0.0307761f, -0.0115023f),
+	float4(-0.19619f, -0.0489835f, 0.0300742f, 0.525116f), float4(0.14112f, -0.0926841f, 0.726861f, 0.17792f),
+	float4(-0.139393f, 0.0242312f, -0.0432652f, -0.0246386f), float4(-0.150386f, -0.0422516f, 0.025044f, 0.0561431f),
+	float4(0.0523409f, -0.119816f, -0.170364f, -0.119816f), float4(0.300168f, 0.439241f, -0.0774849f, -0.170364f),
+	float4(0.439241f, 0.675319f, -0.0697904f, -0.117491f), float4(-0.0697904f, -0.0774849f, -0.117491f, 0.0453815f),
+	float4(-0.170364f, -0.119816f, 0.0523409f, -0.0774849f), float4(0.439241f, 0.300168f, -0.119816f, -0.117491f),
+	float4(-0.0697904f, 0.675319f, 0.439241f, -0.170364f), float4(-0.0697904f, -0.117491f, -0.0774849f, 0.0453815f),
+	float4(0.0300742f, -0.0489835f, -0.19619f, -0.0926841f), float4(0.14112f, 0.525116f, 0.0242312f, -0.139393f),
+	float4(0.17792f, 0.726861f, -0.0246386f, -0.0432652f), float4(0.025044f, -0.0422516f, -0.150386f, 0.0561431f),
+	float4(0.0561431f, -0.150386f, -0.0422516f, 0.025044f), float4(-0.0432652f, -0.0246386f, 0.726861f, 0.17792f),
+	float4(-0.139393f, 0.0242312f, 0.525116f, 0.14112f), float4(-0.0926841f, -0.19619f, -0.0489835f, 0.0300742f),
+	float4(-0.0774849f, -0.117491f, -0.0697904f, -0.170364f), float4(0.439241f, 0.675319f, -0.0697904f, -0.117491f),
+	float4(0.0453815f, -0.119816f, 0.300168f, 0.439241f), float4(-0.0774849f, 0.0523409f, -0.119816f, -0.170364f),
+	float4(-0.117491f, -0.0774849f, -0.0697904f, 0.0453815f), float4(-0.117491f, -0.0697904f, 0.675319f, 0.439241f),
+	float4(-0.170364f, -0.0774849f, 0.439241f, 0.300168f), float4(-0.119816f, -0.170364f, -0.119816f, 0.0523409f),
+	float4(0.0561431f, 0.025044f, -0.0422516f, -0.150386f), float4(-0.0246386f, -0.0432652f, 0.0242312f, -0.139393f),
+	float4(0.17792f, 0.726861f, -0.0926841f, 0.14112f), float4(0.525116f, 0.0300742f, -0.0489835f, -0.19619f),
+	float4(-0.0115023f, 0.0307761f, 0.00809056f, 0.00883075f), float4(-0.148877f, -0.0333341f, 0.0326918f, 0.195966f),
+	float4(0.0277279f, -0.0333341f, 0.849559f, 0.195966f), float4(-0.148877f, 0.00883075f, 0.0307761f, -0.0115023f),
+	float4(0.0242312f, 0.0300742f, -0.0926841f, -0.139393f), float4(0.025044f, -0.0489835f, 0.14112f, 0.17792f),
+	float4(-0.0246386f, -0.0422516f, -0.19619f, 0.525116f), float4(0.726861f, -0.0432652f, -0.150386f, 0.0561431f),
+	float4(0.0242312f, 0.025044f, -0.139393f, -0.0926841f), float4(0.0300742f, -0.0422516f, -0.0246386f, 0.17792f),
+	float4(0.14112f, -0.0489835f, 0.0561431f, -0.150386f), float4(-0.0432652f, 0.726861f, 0.525116f, -0.19619f),
+	float4(-0.0115023f, 0.00809056f, 0.0307761f, 0.00883075f), float4(0.0326918f, -0.0333341f, -0.148877f, -0.0333341f),
+	float4(0.0277279f, 0.195966f, -0.0115023f, 0.0307761f), float4(0.00883075f, -0.148877f, 0.195966f, 0.849559f),
+	float4(0.993653f, 0.0159249f, -0.035426f, 0.0353754f), float4(-0.0163877f, 0.00316943f, 0.0159249f, 0.00600856f),
+	float4(-0.00648414f, 0.00673732f, -0.035426f, -0.00648414f), float4(0.0353754f, 0.00673732f, -0.0163877f, 0.00316943f),
+	float4(-0.209705f, 1.11735f, 0.240746f, -0.240079f), float4(0.11096f, -0.0209009f, 0.0122644f, 0.00551219f),
+	float4(-0.0088469f, 0.00776813f, -0.032028f, 0.00783421f), float4(-0.00747235f, 0.0305491f, -0.010792f, -0.0140655f),
+	float4(0.0691412f, -0.368065f, 0.79663f, 0.79663f), float4(-0.368065f, 0.0691412f, 0.0168491f, 0.0168491f),
+	float4(-0.0336981f, -0.0336981f, 0.00958713f, 0.0336981f), float4(0.0336981f, -0.00958713f, -0.0168491f, -0.0168491f),
+	float4(-0.0209009f, 0.11096f, -0.240079f, 0.240746f), float4(1.11735f, -0.209705f, -0.0088469f, 0.00551219f),
+	float4(0.0122644f, 0.00783421f, -0.032028f, 0.00776813f), float4(-0.010792f, 0.0305491f, -0.00747235f, -0.0140655f),
+	float4(0.00316943f, -0.0163877f, 0.0353754f, -0.035426f), float4(0.0159249f, 0.993653f, 0.00673732f, -0.00648414f),
+	float4(0.00600856f, 0.0159249f, -0.00648414f, -0.035426f), float4(0.00673732f, 0.0353754f, -0.0163877f, 0.00316943f),
+	float4(-0.209705f, 0.00776813f, -0.00747235f, 1.11735f), float4(0.0122644f, -0.032028f, 0.0305491f, -0.0140655f),
+	float4(0.240746f, 0.00551219f, -0.240079f, -0.0088469f), float4(0.00783421f, -0.010792f, 0.11096f, -0.0209009f),
+	float4(-0.187921f, -0.0406282f, 0.0383058f, -0.187921f), float4(1.21291f, 0.260935f, -0.249323f, 0.114037f),
+	float4(-0.0406282f, 0.260935f, -0.0475666f, 0.0383058f), float4(-0.249323f, -0.0475666f, 0.0707909f, 0.114037f),
+	float4(-0.178663f, -0.178663f, -0.40678f, 0.893313f), float4(0.893313f, -0.40678f, -0.0837465f, 0.213373f),
+	float4(0.213373f, -0.0837465f, 0.0837465f, -0.213373f), float4(-0.213373f, 0.0837465f, 0.106687f, 0.106687f),
+	float4(0.0383058f, -0.0406282f, -0.187921f, 0.114037f), float4(-0.249323f, 0.260935f, 1.21291f, -0.187921f),
+	float4(-0.0475666f, 0.260935f, -0.0406282f, 0.0707909f), float4(-0.0475666f, -0.249323f, 0.0383058f, 0.114037f),
+	float4(-0.00747235f, 0.00776813f, -0.209705f, -0.0140655f), float4(0.0305491f, -0.032028f, 0.0122644f, 1.11735f),
+	float4(0.00551219f, 0.240746f, -0.010792f, 0.00783421f), float4(-0.0088469f, -0.240079f, 0.11096f, -0.0209009f),
+	float4(0.0691412f, -0.368065f, 0.00958713f, 0.79663f), float4(0.0168491f, -0.0336981f, 0.0336981f, -0.0168491f),
+	float4(0.79663f, 0.0168491f, -0.0336981f, 0.0336981f), float4(-0.0168491f, -0.368065f, 0.00958713f, 0.0691412f),
+	float4(-0.40678f, -0.0837465f, 0.0837465f, -0.178663f), float4(0.893313f, 0.213373f, -0.213373f, 0.106687f),
+	float4(-0.178663f, 0.893313f, 0.213373f, -0.213373f), float4(0.106687f, -0.40678f, -0.0837465f, 0.0837465f),
+	float4(0.181818f, -0.333333f, -0.333333f, 0.181818f), float4(-0.333333f, 0.666667f, 0.666667f, -0.333333f),
+	float4(-0.333333f, 0.666667f, 0.666667f, -0.333333f), float4(0.181818f, -0.333333f, -0.333333f, 0.181818f),
+	float4(0.0837465f, -0.0837465f, -0.40678f, 0.106687f), float4(-0.213373f, 0.213373f, 0.893313f, -0.178663f),
+	float4(0.106687f, -0.213373f, 0.213373f, 0.893313f), float4(-0.178663f, 0.0837465f, -0.0837465f, -0.40678f),
+	float4(0.0691412f, -0.368065f, -0.0168491f, 0.0336981f), float4(-0.0336981f, 0.0168491f, 0.79663f, -0.0168491f),
+	float4(0.0336981f, -0.0336981f, 0.0168491f, 0.79663f), float4(-0.00958713f, 0.00958713f, -0.368065f, 0.0691412f),
+	float4(-0.0209009f, 0.11096f, -0.240079f, -0.0088469f), float4(0.00783421f, -0.010792f, 0.240746f, 0.00551219f),
+	float4(1.11735f, 0.0122644f, -0.032028f, 0.0305491f), float4(-0.0140655f, -0.209705f, 0.00776813f, -0.00747235f),
+	float4(0.114037f, 0.0383058f, -0.249323f, -0.0475666f), float4(0.0707909f, -0.0406282f, 0.260935f, -0.0475666f),
+	float4(-0.187921f, 1.21291f, 0.260935f, -0.249323f), float4(0.114037f, -0.187921f, -0.0406282f, 0.0383058f),
+	float4(0.106687f, 0.106687f, 0.0837465f, -0.213373f), float4(-0.213373f, 0.0837465f, -0.0837465f, 0.213373f),
+	float4(0.213373f, -0.0837465f, -0.40678f, 0.893313f), float4(0.893313f, -0.40678f, -0.178663f, -0.178663f),
+	float4(0.114037f, 0.0707909f, -0.0475666f, -0.249323f), float4(0.0383058f, -0.0475666f, 0.260935f, -0.0406282f),
+	float4(0.114037f, -0.249323f, 0.260935f, 1.21291f), float4(-0.187921f, 0.0383058f, -0.0406282f, -0.187921f),
+	float4(-0.0209009f, 0.11096f, -0.010792f, 0.00783421f), float4(-0.0088469f, -0.240079f, 0.00551219f, 0.240746f),
+	float4(-0.0140655f, 0.0305491f, -0.032028f, 0.0122644f), float4(1.11735f, -0.00747235f, 0.00776813f, -0.209705f),
+	float4(0.00316943f, -0.0163877f, 0.0353754f, 0.00673732f), float4(-0.035426f, -0.00648414f, 0.0159249f, 0.00600856f),
+	float4(-0.00648414f, 0.00673732f, 0.993653f, 0.0159249f), float4(-0.035426f, 0.0353754f, -0.0163877f, 0.00316943f),
+	float4(-0.0140655f, -0.00747235f, 0.0305491f, -0.010792f), float4(0.00776813f, -0.032028f, 0.00783421f, 0.0122644f),
+	float4(0.00551219f, -0.0088469f, -0.209705f, 1.11735f), float4(0.240746f, -0.240079f, 0.11096f, -0.0209009f),
+	float4(-0.0168491f, -0.0168491f, 0.0336981f, 0.0336981f), float4(-0.00958713f, 0.00958713f, -0.0336981f, -0.0336981f),
+	float4(0.0168491f, 0.0168491f, 0.0691412f, -0.368065f), float4(0.79663f, 0.79663f, -0.368065f, 0.0691412f),
+	float4(-0.0140655f, -0.010792f, 0.0305491f, -0.00747235f), float4(0.00783421f, -0.032028f, 0.00776813f, -0.0088469f),
+	float4(0.00551219f, 0.0122644f, -0.0209009f, 0.11096f), float4(-0.240079f, 0.240746f, 1.11735f, -0.209705f),
+	float4(0.00316943f, -0.0163877f, 0.00673732f, 0.0353754f), float4(-0.00648414f, -0.035426f, 0.00673732f, -0.00648414f),
+	float4(0.00600856f, 0.0159249f, 0.00316943f, -0.0163877f), float4(0.0353754f, -0.035426f, 0.0159249f, 0.993653f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+};
+
+#define WEIGHT_GRID_COUNT_8X5 4
+#define MAX_GRID_WEIGHTS_8X5 40
+static const uint4 weight_grids_8x5[WEIGHT_GRID_COUNT_8X5] = { uint4(4, 4, 0, 0), uint4(5, 5, 16, 40), uint4(6, 5, 41, 80), uint4(8, 5, 71, 120) };
+static const uint4 decimation_idx_8x5[111] =
+{
+	uint4(0, 1, 8, 9), uint4(2, 3, 10, 11), uint4(4, 5, 12, 13), uint4(7, 7, 15, 15),
+	uint4(8, 9, 16, 17), uint4(10, 11, 18, 19), uint4(12, 13, 20, 21), uint4(15, 15, 23, 23),
+	uint4(16, 17, 24, 25), uint4(18, 19, 26, 27), uint4(20, 21, 28, 29), uint4(23, 23, 31, 31),
+	uint4(32, 33, 32, 33), uint4(34, 35, 34, 35), uint4(36, 37, 36, 37), uint4(39, 39, 39, 39),
+	uint4(0, 1, 8, 9), uint4(1, 2, 9, 10), uint4(3, 4, 11, 12), uint4(5, 6, 13, 14),
+	uint4(7, 7, 15, 15), uint4(8, 9, 16, 17), uint4(9, 10, 17, 18), uint4(11, 12, 19, 20),
+	uint4(13, 14, 21, 22), uint4(15, 15, 23, 23), uint4(16, 17, 24, 25), uint4(17, 18, 25, 26),
+	uint4(19, 20, 27, 28), uint4(21, 22, 29, 30), uint4(23, 23, 31, 31), uint4(24, 25, 32, 33),
+	uint4(25, 26, 33, 34), uint4(27, 28, 35, 36), uint4(29, 30, 37, 38), uint4(31, 31, 39, 39),
+	uint4(32, 33, 32, 33), uint4(33, 34, 33, 34), uint4(35, 36, 35, 36), uint4(37, 38, 37, 38),
+	uint4(39, 39, 39, 39), uint4(0, 1, 8, 9), uint4(1, 2, 9, 10), uint4(2, 3, 10, 11),
+	uint4(4, 5, 12, 13), uint4(5, 6, 13, 14), uint4(7, 7, 15, 15), uint4(8, 9, 16, 17),
+	uint4(9, 10, 17, 18), uint4(10, 11, 18, 19), uint4(12, 13, 20, 21), uint4(13, 14, 21, 22),
+	uint4(15, 15, 23, 23), uint4(16, 17, 24, 25), uint4(17, 18, 25, 26), uint4(18, 19, 26, 27),
+	uint4(20, 21, 28, 29), uint4(21, 22, 29, 30), uint4(23, 23, 31, 31), uint4(24, 25, 32, 33),
+	uint4(25, 26, 33, 34), uint4(26, 27, 34, 35), uint4(28, 29, 36, 37), uint4(29, 30, 37, 38),
+	uint4(31, 31, 39, 39), uint4(32, 33, 32, 33), uint4(33, 34, 33, 34), uint4(34, 35, 34, 35),
+	uint4(36, 37, 36, 37), uint4(37, 38, 37, 38), uint4(39, 39, 39, 39), uint4(0, 1, 8, 9),
+	uint4(1, 2, 9, 10), uint4(2, 3, 10, 11), uint4(3, 4, 11, 12), uint4(4, 5, 12, 13),
+	uint4(5, 6, 13, 14), uint4(6, 7, 14, 15), uint4(7, 7, 15, 15), uint4(8, 9, 16, 17),
+	uint4(9, 10, 17, 18), uint4(10, 11, 18, 19), uint4(11, 12, 19, 20), uint4(12, 13, 20, 21),
+	uint4(13, 14, 21, 22), uint4(14, 15, 22, 23), uint4(15, 15, 23, 23), uint4(16, 17, 24, 25),
+	uint4(17, 18, 25, 26), uint4(18, 19, 26, 27), uint4(19, 20, 27, 28), uint4(20, 21, 28, 29),
+	uint4(21, 22, 29, 30), uint4(22, 23, 30, 31), uint4(23, 23, 31, 31), uint4(24, 25, 32, 33),
+	uint4(25, 26, 33, 34), uint4(26, 27, 34, 35), uint4(27, 28, 35, 36), uint4(28, 29, 36, 37),
+	uint4(29, 30, 37, 38), uint4(30, 31, 38, 39), uint4(31, 31, 39, 39), uint4(32, 33, 32, 33),
+	uint4(33, 34, 33, 34), uint4(34, 35, 34, 35), uint4(35, 36, 35, 36), uint4(36, 37, 36, 37),
+	uint4(37, 38, 37, 38), uint4(38, 39, 38, 39), uint4(39, 39, 39, 39),
+};
+static const float4 decimation_wt_8x5[111] =
+{
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.666666746f, 0.333333254f, 0.0f, 0.0f),
+	float4(0.333333492f, 0.666666508f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.666666627f, 0.0f, 0.333333373f, 0.0f), float4(0.444444478f, 0.222222149f, 0.222222269f, 0.111111097f),
+	float4(0.222222313f, 0.444444299f, 0.111111179f, 0.222222194f), float4(0.666666627f, 0.0f, 0.333333373f, 0.0f),
+	float4(0.333333254f, 0.0f, 0.666666746f, 0.0f), float4(0.222222194f, 0.11111106f, 0.444444537f, 0.222222194f),
+	float4(0.111111134f, 0.22222212f, 0.222222358f, 0.444444388f), float4(0.333333254f, 0.0f, 0.666666746f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.666666746f, 0.333333254f, 0.0f, 0.0f),
+	float4(0.333333492f, 0.666666508f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.25f, 0.75f, 0.0f, 0.0f),
+	float4(0.5f, 0.5f, 0.0f, 0.0f), float4(0.75f, 0.25f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.25f, 0.75f, 0.0f, 0.0f), float4(0.5f, 0.5f, 0.0f, 0.0f),
+	float4(0.75f, 0.25f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.25f, 0.75f, 0.0f, 0.0f),
+	float4(0.5f, 0.5f, 0.0f, 0.0f), float4(0.75f, 0.25f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.25f, 0.75f, 0.0f, 0.0f), float4(0.5f, 0.5f, 0.0f, 0.0f),
+	float4(0.75f, 0.25f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.25f, 0.75f, 0.0f, 0.0f),
+	float4(0.5f, 0.5f, 0.0f, 0.0f), float4(0.75f, 0.25f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.600000024f, 0.399999976f, 0.0f, 0.0f), float4(0.200000048f, 0.799999952f, 0.0f, 0.0f),
+	float4(0.800000191f, 0.199999809f, 0.0f, 0.0f), float4(0.400000095f, 0.599999905f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.600000024f, 0.399999976f, 0.0f, 0.0f), float4(0.200000048f, 0.799999952f, 0.0f, 0.0f),
+	float4(0.800000191f, 0.199999809f, 0.0f, 0.0f), float4(0.400000095f, 0.599999905f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.600000024f, 0.399999976f, 0.0f, 0.0f), float4(0.200000048f, 0.799999952f, 0.0f, 0.0f),
+	float4(0.800000191f, 0.199999809f, 0.0f, 0.0f), float4(0.400000095f, 0.599999905f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.600000024f, 0.399999976f, 0.0f, 0.0f), float4(0.200000048f, 0.799999952f, 0.0f, 0.0f),
+	float4(0.800000191f, 0.199999809f, 0.0f, 0.0f), float4(0.400000095f, 0.599999905f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.600000024f, 0.399999976f, 0.0f, 0.0f), float4(0.200000048f, 0.799999952f, 0.0f, 0.0f),
+	float4(0.800000191f, 0.199999809f, 0.0f, 0.0f), float4(0.400000095f, 0.599999905f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f),
+};
+static const uint4 infill_idx_8x5[160] =
+{
+	uint4(0, 0, 0, 0), uint4(0, 1, 0, 0), uint4(0, 1, 0, 0), uint4(1, 2, 1, 1),
+	uint4(1, 2, 1, 1), uint4(2, 3, 2, 2), uint4(2, 3, 2, 2), uint4(3, 3, 3, 3),
+	uint4(0, 0, 4, 0), uint4(0, 1, 4, 5), uint4(0, 1, 4, 5), uint4(1, 2, 5, 6),
+	uint4(1, 2, 5, 6), uint4(2, 2, 6, 7), uint4(2, 3, 6, 7), uint4(3, 3, 7, 3),
+	uint4(4, 4, 8, 4), uint4(4, 5, 8, 9), uint4(4, 5, 8, 9), uint4(5, 6, 9, 10),
+	uint4(5, 6, 9, 10), uint4(6, 7, 10, 11), uint4(6, 7, 10, 11), uint4(7, 7, 11, 7),
+	uint4(8, 8, 12, 8), uint4(8, 9, 12, 13), uint4(8, 9, 8, 13), uint4(9, 10, 13, 14),
+	uint4(9, 10, 13, 14), uint4(10, 11, 14, 15), uint4(10, 11, 14, 15), uint4(11, 11, 15, 11),
+	uint4(12, 12, 12, 12), uint4(12, 13, 12, 12), uint4(12, 13, 12, 12), uint4(13, 14, 13, 13),
+	uint4(13, 14, 13, 13), uint4(14, 15, 14, 14), uint4(14, 15, 14, 14), uint4(15, 15, 15, 15),
+	uint4(0, 0, 0, 0), uint4(0, 1, 0, 0), uint4(1, 2, 1, 1), uint4(1, 2, 1, 1),
+	uint4(2, 3, 2, 2), uint4(2, 3, 2, 2), uint4(3, 4, 3, 3), uint4(4, 4, 4, 4),
+	uint4(5, 5, 5, 5), uint4(5, 6, 5, 5), uint4(6, 7, 6, 6), uint4(6, 7, 6, 6),
+	uint4(7, 8, 7, 7), uint4(7, 8, 7, 7), uint4(8, 9, 8, 8), uint4(9, 9, 9, 9),
+	uint4(10, 10, 10, 10), uint4(10, 11, 10, 10), uint4(11, 12, 11, 11), uint4(11, 12, 11, 11),
+	uint4(12, 13, 12, 12), uint4(12, 13, 12, 12), uint4(13, 14, 13, 13), uint4(14, 14, 14, 14),
+	uint4(15, 15, 15, 15), uint4(15, 16, 15, 15), uint4(16, 17, 16, 16), uint4(16, 17, 16, 16),
+	uint4(17, 18, 17, 17), uint4(17, 18, 17, 17), uint4(18, 19, 18, 18), uint4(19, 19, 19, 19),
+	uint4(20, 20, 20, 20), uint4(20, 21, 20, 20), uint4(21, 22, 21, 21), uint4(21, 22, 21, 21),
+	uint4(22, 23, 22, 22), uint4(22, 23, 22, 22), uint4(23, 24, 23, 23), uint4(24, 24, 24, 24),
+	uint4(0, 0, 0, 0), uint4(0, 1, 0, 0), uint4(1, 2, 1, 1), uint4(2, 3, 2, 2),
+	uint4(2, 3, 2, 2), uint4(3, 4, 3, 3), uint4(4, 5, 4, 4), uint4(5, 5, 5, 5),
+	uint4(6, 6, 6, 6), uint4(6, 7, 6, 6), uint4(7, 8, 7, 7), uint4(8, 9, 8, 8),
+	uint4(8, 9, 8, 8), uint4(9, 10, 9, 9), uint4(10, 11, 10, 10), uint4(11, 11, 11, 11),
+	uint4(12, 12, 12, 12), uint4(12, 13, 12, 12), uint4(13, 14, 13, 13), uint4(14, 15, 14, 14),
+	uint4(14, 15, 14, 14), uint4(15, 16, 15, 15), uint4(16, 17, 16, 16), uint4(17, 17, 17, 17),
+	uint4(18, 18, 18, 18), uint4(18, 19, 18, 18), uint4(19, 20, 19, 19), uint4(20, 21, 20, 20),
+	uint4(20, 21, 20, 20), uint4(21, 22, 21, 21), uint4(22, 23, 22, 22), uint4(23, 23, 23, 23),
+	uint4(24, 24, 24, 24), uint4(24, 25, 24, 24), uint4(25, 26, 25, 25), uint4(26, 27, 26, 26),
+	uint4(26, 27, 26, 26), uint4(27, 28, 27, 27), uint4(28, 29, 28, 28), uint4(29, 29, 29, 29),
+	uint4(0, 0, 0, 0), uint4(1, 1, 1, 1), uint4(2, 2, 2, 2), uint4(3, 3, 3, 3),
+	uint4(4, 4, 4, 4), uint4(5, 5, 5, 5), uint4(6, 6, 6, 6), uint4(7, 7, 7, 7),
+	uint4(8, 8, 8, 8), uint4(9, 9, 9, 9), uint4(10, 10, 10, 10), uint4(11, 11, 11, 11),
+	uint4(12, 12, 12, 12), uint4(13, 13, 13, 13), uint4(14, 14, 14, 14), uint4(15, 15, 15, 15),
+	uint4(16, 16, 16, 16), uint4(17, 17, 17, 17), uint4(18, 18, 18, 18), uint4(19, 19, 19, 19),
+	uint4(20, 20, 20, 20), uint4(21, 21, 21, 21), uint4(22, 22, 22, 22), uint4(23, 23, 23, 23),
+	uint4(24, 24, 24, 24), uint4(25, 25, 25, 25), uint4(26, 26, 26, 26), uint4(27, 27, 27, 27),
+	uint4(28, 28, 28, 28), uint4(29, 29, 29, 29), uint4(30, 30, 30, 30), uint4(31, 31, 31, 31),
+	uint4(32, 32, 32, 32), uint4(33, 33, 33, 33), uint4(34, 34, 34, 34), uint4(35, 35, 35, 35),
+	uint4(36, 36, 36, 36), uint4(37, 37, 37, 37), uint4(38, 38, 38, 38), uint4(39, 39, 39, 39),
+};
+static const float4 infill_wt_8x5[160] =
+{
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.5625f, 0.4375f, 0.0f, 0.0f), float4(0.125f, 0.875f, 0.0f, 0.0f), float4(0.6875f, 0.3125f, 0.0f, 0.0f),
+	float4(0.3125f, 0.6875f, 0.0f, 0.0f), float4(0.875f, 0.125f, 0.0f, 0.0f), float4(0.4375f, 0.5625f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.25f, 0.0f, 0.75f, 0.0f), float4(0.125f, 0.125f, 0.4375f, 0.3125f), float4(0.0625f, 0.1875f, 0.0625f, 0.6875f), float4(0.1875f, 0.0625f, 0.5f, 0.25f),
+	float4(0.0625f, 0.1875f, 0.25f, 0.5f), float4(0.25f, 0.0f, 0.625f, 0.125f), float4(0.125f, 0.125f, 0.3125f, 0.4375f), float4(0.25f, 0.0f, 0.75f, 0.0f),
+	float4(0.5f, 0.0f, 0.5f, 0.0f), float4(0.3125f, 0.1875f, 0.25f, 0.25f), float4(0.0625f, 0.4375f, 0.0625f, 0.4375f), float4(0.375f, 0.125f, 0.3125f, 0.1875f),
+	float4(0.1875f, 0.3125f, 0.125f, 0.375f), float4(0.4375f, 0.0625f, 0.4375f, 0.0625f), float4(0.25f, 0.25f, 0.1875f, 0.3125f), float4(0.5f, 0.0f, 0.5f, 0.0f),
+	float4(0.75f, 0.0f, 0.25f, 0.0f), float4(0.4375f, 0.3125f, 0.125f, 0.125f), float4(0.125f, 0.625f, 0.0f, 0.25f), float4(0.5f, 0.25f, 0.1875f, 0.0625f),
+	float4(0.25f, 0.5f, 0.0625f, 0.1875f), float4(0.6875f, 0.0625f, 0.1875f, 0.0625f), float4(0.3125f, 0.4375f, 0.125f, 0.125f), float4(0.75f, 0.0f, 0.25f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.5625f, 0.4375f, 0.0f, 0.0f), float4(0.125f, 0.875f, 0.0f, 0.0f), float4(0.6875f, 0.3125f, 0.0f, 0.0f),
+	float4(0.3125f, 0.6875f, 0.0f, 0.0f), float4(0.875f, 0.125f, 0.0f, 0.0f), float4(0.4375f, 0.5625f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.4375f, 0.5625f, 0.0f, 0.0f), float4(0.875f, 0.125f, 0.0f, 0.0f), float4(0.3125f, 0.6875f, 0.0f, 0.0f),
+	float4(0.6875f, 0.3125f, 0.0f, 0.0f), float4(0.125f, 0.875f, 0.0f, 0.0f), float4(0.5625f, 0.4375f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.4375f, 0.5625f, 0.0f, 0.0f), float4(0.875f, 0.125f, 0.0f, 0.0f), float4(0.3125f, 0.6875f, 0.0f, 0.0f),
+	float4(0.6875f, 0.3125f, 0.0f, 0.0f), float4(0.125f, 0.875f, 0.0f, 0.0f), float4(0.5625f, 0.4375f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.4375f, 0.5625f, 0.0f, 0.0f), float4(0.875f, 0.125f, 0.0f, 0.0f), float4(0.3125f, 0.6875f, 0.0f, 0.0f),
+	float4(0.6875f, 0.3125f, 0.0f, 0.0f), float4(0.125f, 0.875f, 0.0f, 0.0f), float4(0.5625f, 0.4375f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.4375f, 0.5625f, 0.0f, 0.0f), float4(0.875f, 0.125f, 0.0f, 0.0f), float4(0.3125f, 0.6875f, 0.0f, 0.0f),
+	float4(0.6875f, 0.3125f, 0.0f, 0.0f), float4(0.125f, 0.875f, 0.0f, 0.0f), float4(0.5625f, 0.4375f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.4375f, 0.5625f, 0.0f, 0.0f), float4(0.875f, 0.125f, 0.0f, 0.0f), float4(0.3125f, 0.6875f, 0.0f, 0.0f),
+	float4(0.6875f, 0.3125f, 0.0f, 0.0f), float4(0.125f, 0.875f, 0.0f, 0.0f), float4(0.5625f, 0.4375f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.3125f, 0.6875f, 0.0f, 0.0f), float4(0.5625f, 0.4375f, 0.0f, 0.0f), float4(0.875f, 0.125f, 0.0f, 0.0f),
+	float4(0.125f, 0.875f, 0.0f, 0.0f), float4(0.4375f, 0.5625f, 0.0f, 0.0f), float4(0.75f, 0.25f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.3125f, 0.6875f, 0.0f, 0.0f), float4(0.5625f, 0.4375f, 0.0f, 0.0f), float4(0.875f, 0.125f, 0.0f, 0.0f),
+	float4(0.125f, 0.875f, 0.0f, 0.0f), float4(0.4375f, 0.5625f, 0.0f, 0.0f), float4(0.75f, 0.25f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.3125f, 0.6875f, 0.0f, 0.0f), float4(0.5625f, 0.4375f, 0.0f, 0.0f), float4(0.875f, 0.125f, 0.0f, 0.0f),
+	float4(0.125f, 0.875f, 0.0f, 0.0f), float4(0.4375f, 0.5625f, 0.0f, 0.0f), float4(0.75f, 0.25f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.3125f, 0.6875f, 0.0f, 0.0f), float4(0.5625f, 0.4375f, 0.0f, 0.0f), float4(0.875f, 0.125f, 0.0f, 0.0f),
+	float4(0.125f, 0.875f, 0.0f, 0.0f), float4(0.4375f, 0.5625f, 0.0f, 0.0f), float4(0.75f, 0.25f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.3125f, 0.6875f, 0.0f, 0.0f), float4(0.5625f, 0.4375f, 0.0f, 0.0f), float4(0.875f, 0.125f, 0.0f, 0.0f),
+	float4(0.125f, 0.875f, 0.0f, 0.0f), float4(0.4375f, 0.5625f, 0.0f, 0.0f), float4(0.75f, 0.25f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+};
+static const uint4 pseudo_inverse_idx_8x5[444] =
+{
+	uint4(0, 1, 2, 3), uint4(4, 5, 6, 7), uint4(8, 10, 11, 16), uint4(17, 24, 25, 32),
+	uint4(0, 1, 2, 3), uint4(4, 5, 6, 7), uint4(8, 9, 11, 18), uint4(19, 21, 26, 27),
+	uint4(0, 1, 2, 3), uint4(4, 5, 6, 7), uint4(11, 12, 13, 20), uint4(21, 22, 28, 29),
+	uint4(0, 1, 2, 3), uint4(4, 5, 6, 7), uint4(13, 15, 21, 22), uint4(23, 29, 30, 31),
+	uint4(0, 1, 8, 9), uint4(10, 11, 13, 16), uint4(17, 18, 19, 24), uint4(25, 27, 32, 33),
+	uint4(2, 3, 8, 9), uint4(10, 11, 12, 13), uint4(16, 18, 19, 20), uint4(21, 24, 26, 27),
+	uint4(4, 5, 7, 10), uint4(11, 12, 13, 14), uint4(15, 18, 20, 21), uint4(22, 23, 28, 29),
+	uint4(6, 7, 10, 12), uint4(13, 14, 15, 20), uint4(21, 22, 23, 28), uint4(29, 30, 31, 39),
+	uint4(0, 8, 9, 10), uint4(11, 16, 17, 18), uint4(19, 24, 25, 26), uint4(27, 29, 32, 33),
+	uint4(10, 11, 16, 17), uint4(18, 19, 21, 24), uint4(25, 26, 27, 28), uint4(29, 32, 34, 35),
+	uint4(12, 13, 15, 18), uint4(19, 20, 21, 23), uint4(26, 27, 28, 29), uint4(30, 31, 36, 37),
+	uint4(6, 7, 12, 14), uint4(15, 20, 21, 22), uint4(23, 26, 28, 29), uint4(30, 31, 38, 39),
+	uint4(8, 9, 10, 16), uint4(17, 18, 24, 26), uint4(32, 33, 34, 35), uint4(36, 37, 38, 39),
+	uint4(10, 11, 17, 18), uint4(19, 26, 27, 28), uint4(32, 33, 34, 35), uint4(36, 37, 38, 39),
+	uint4(12, 13, 18, 20), uint4(21, 28, 30, 31), uint4(32, 33, 34, 35), uint4(36, 37, 38, 39),
+	uint4(7, 14, 15, 22), uint4(23, 28, 29, 31), uint4(32, 33, 34, 35), uint4(36, 37, 38, 39),
+	uint4(0, 1, 2, 3), uint4(4, 5, 6, 7), uint4(0, 0, 0, 0), uint4(0, 0, 0, 0),
+	uint4(0, 1, 2, 3), uint4(4, 5, 6, 7), uint4(0, 0, 0, 0), uint4(0, 0, 0, 0),
+	uint4(0, 1, 2, 3), uint4(4, 5, 6, 7), uint4(0, 0, 0, 0), uint4(0, 0, 0, 0),
+	uint4(0, 1, 2, 3), uint4(4, 5, 6, 7), uint4(0, 0, 0, 0), uint4(0, 0, 0, 0),
+	uint4(0, 1, 2, 3), uint4(4, 5, 6, 7), uint4(0, 0, 0, 0), uint4(0, 0, 0, 0),
+	uint4(8, 9, 10, 11), uint4(12, 13, 14, 15), uint4(8, 8, 8, 8), uint4(8, 8, 8, 8),
+	uint4(8, 9, 10, 11), uint4(12, 13, 14, 15), uint4(8, 8, 8, 8), uint4(8, 8, 8, 8),
+	uint4(8, 9, 10, 11), uint4(12, 13, 14, 15), uint4(8, 8, 8, 8), uint4(8, 8, 8, 8),
+	uint4(8, 9, 10, 11), uint4(12, 13, 14, 15), uint4(8, 8, 8, 8), uint4(8, 8, 8, 8),
+	uint4(8, 9, 10, 11), uint4(12, 13, 14, 15), uint4(8, 8, 8, 8), uint4(8, 8, 8, 8),
+	uint4(16, 17, 18, 19), uint4(20, 21, 22, 23), uint4(16, 16, 16, 16), uint4(16, 16, 16, 16),
+	uint4(16, 17, 18, 19), uint4(20, 21, 22, 23), uint4(16, 16, 16, 16), uint4(16, 16, 16, 16),
+	uint4(16, 17, 18, 19), uint4(20, 21, 22, 23), uint4(16, 16, 16, 16), uint4(16, 16, 16, 16),
+	uint4(16, 17, 18, 19), uint4(20, 21, 22, 23), uint4(16, 16, 16, 16), uint4(16, 16, 16, 16),
+	uint4(16, 17, 18, 19), uint4(20, 21, 22, 23), uint4(16, 16, 16, 16), uint4(16, 16, 16, 16),
+	uint4(24, 25, 26, 27), uint4(28, 29, 30, 31), uint4(24, 24, 24, 24), uint4(24, 24, 24, 24),
+	uint4(24, 25, 26, 27), uint4(28, 29, 30, 31), uint4(24, 24, 24, 24), uint4(24, 24, 24, 24),
+	uint4(24, 25, 26, 27), uint4(28, 29, 30, 31), uint4(24, 24, 24, 24), uint4(24, 24, 24, 24),
+	uint4(24, 25, 26, 27), uint4(28, 29, 30, 31), uint4(24, 24, 24, 24), uint4(24, 24, 24, 24),
+	uint4(24, 25, 26, 27), uint4(28, 29, 30, 31), uint4(24, 24, 24, 24), uint4(24, 24, 24, 24),
+	uint4(32, 33, 34, 35), uint4(36, 37, 38, 39), uint4(32, 32, 32, 32), uint4(32, 32, 32, 32),
+	uint4(32, 33, 34, 35), uint4(36, 37, 38, 39), uint4(32, 32, 32, 32), uint4(32, 32, 32, 32),
+	uint4(32, 33, 34, 35), uint4(36, 37, 38, 39), uint4(32, 32, 32, 32), uint4(32, 32, 32, 32),
+	uint4(32, 33, 34, 35), uint4(36, 37, 38, 39), uint4(32, 32, 32, 32), uint4(32, 32, 32, 32),
+	uint4(32, 33, 34, 35), uint4(36, 37, 38, 39), uint4(32, 32, 32, 32), uint4(32, 32, 32, 32),
+	uint4(0, 1, 2, 3), uint4(4, 5, 6, 7), uint4(0, 0, 0, 0), uint4(0, 0, 0, 0),
+	uint4(0, 1, 2, 3), uint4(4, 5, 6, 7), uint4(0, 0, 0, 0), uint4(0, 0, 0, 0),
+	uint4(0, 1, 2, 3), uint4(4, 5, 6, 7), uint4(0, 0, 0, 0), uint4(0, 0, 0, 0),
+	uint4(0, 1, 2, 3), uint4(4, 5, 6, 7), uint4(0, 0, 0, 0), uint4(0, 0, 0, 0),
+	uint4(0, 1, 2, 3), uint4(4, 5, 6, 7), uint4(0, 0, 0, 0), uint4(0, 0, 0, 0),
+	uint4(0, 1, 2, 3), uint4(4, 5, 6, 7), uint4(0, 0, 0, 0), uint4(0, 0, 0, 0),
+	uint4(8, 9, 10, 11), uint4(12, 13, 14, 15), uint4(8, 8, 8, 8), uint4(8, 8, 8, 8),
+	uint4(8, 9, 10, 11), uint4(12, 13, 14, 15), uint4(8, 8, 8, 8), uint4(8, 8, 8, 8),
+	uint4(8, 9, 10, 11), uint4(12, 13, 14, 15), uint4(8, 8, 8, 8), uint4(8, 8, 8, 8),
+	uint4(8, 9, 10, 11), uint4(12, 13, 14, 15), uint4(8, 8, 8, 8), uint4(8, 8, 8, 8),
+	uint4(8, 9, 10, 11), uint4(12, 13, 14, 15), uint4(8, 8, 8, 8), uint4(8, 8, 8, 8),
+	uint4(8, 9, 10, 11), uint4(12, 13, 14, 15), uint4(8, 8, 8, 8), uint4(8, 8, 8, 8),
+	uint4(16, 17, 18, 19), uint4(20, 21, 22, 23), uint4(16, 16, 16, 16), uint4(16, 16, 16, 16),
+	uint4(16, 17, 18, 19), uint4(20, 21, 22, 23), uint4(16, 16, 16, 16), uint4(16, 16, 16, 16),
+	uint4(16, 17, 18, 19), uint4(20, 21, 22, 23), uint4(16, 16, 16, 16), uint4(16, 16, 16, 16),
+	uint4(16, 17, 18, 19), uint4(20, 21, 22, 23), uint4(16, 16, 16, 16), uint4(16, 16, 16, 16),
+	uint4(16, 17, 18, 19), uint4(20, 21, 22, 23), uint4(16, 16, 16, 16), uint4(16, 16, 16, 16),
+	uint4(16, 17, 18, 19), uint4(20, 21, 22, 23), uint4(16, 16, 16, 16), uint4(16, 16, 16, 16),
+	uint4(24, 25, 26, 27), uint4(28, 29, 30, 31), uint4(24, 24, 24, 24), uint4(24, 24, 24, 24),
+	uint4(24, 25, 26, 27), uint4(28, 29, 30, 31), uint4(24, 24, 24, 24), uint4(24, 24, 24, 24),
+	uint4(24, 25, 26, 27), uint4(28, 29, 30, 31), uint4(24, 24, 24, 24), uint4(24, 24, 24, 24),
+	uint4(24, 25, 26, 27), uint4(28, 29, 30, 31), uint4(24, 24, 24, 24), uint4(24, 24, 24, 24),
+	uint4(24, 25, 26, 27), uint4(28, 29, 30, 31), uint4(24, 24, 24, 24), uint4(24, 24, 24, 24),
+	uint4(24, 25, 26, 27), uint4(28, 29, 30, 31), uint4(24, 24, 24, 24), uint4(24, 24, 24, 24),
+	uint4(32, 33, 34, 35), uint4(36, 37, 38, 39), uint4(32, 32, 32, 32), uint4(32, 32, 32, 32),
+	uint4(32, 33, 34, 35), uint4(36, 37, 38, 39), uint4(32, 32, 32, 32), uint4(32, 32, 32, 32),
+	uint4(32, 33, 34, 35), uint4(36, 37, 38, 39), uint4(32, 32, 32, 32), uint4(32, 32, 32, 32),
+	uint4(32, 33, 34, 35), uint4(36, 37, 38, 39), uint4(32, 32, 32, 32), uint4(32, 32, 32, 32),
+	uint4(32, 33, 34, 35), uint4(36, 37, 38, 39), uint4(32, 32, 32, 32), uint4(32, 32, 32, 32),
+	uint4(32, 33, 34, 35), uint4(36, 37, 38, 39), uint4(32, 32, 32, 32), uint4(32, 32, 32, 32),
+	uint4(0, 0, 0, 0), uint4(0, 0, 0, 0), uint4(0, 0, 0, 0), uint4(0, 0, 0, 0),
+	uint4(1, 1, 1, 1), uint4(1, 1, 1, 1), uint4(1, 1, 1, 1), uint4(1, 1, 1, 1),
+	uint4(2, 2, 2, 2), uint4(2, 2, 2, 2), uint4(2, 2, 2, 2), uint4(2, 2, 2, 2),
+	uint4(3, 3, 3, 3), uint4(3, 3, 3, 3), uint4(3, 3, 3, 3), uint4(3, 3, 3, 3),
+	uint4(4, 4, 4, 4), uint4(4, 4, 4, 4), uint4(4, 4, 4, 4), uint4(4, 4, 4, 4),
+	uint4(5, 5, 5, 5), uint4(5, 5, 5, 5), uint4(5, 5, 5, 5), uint4(5, 5, 5, 5),
+	uint4(6, 6, 6, 6), uint4(6, 6, 6, 6), uint4(6, 6, 6, 6), uint4(6, 6, 6, 6),
+	uint4(7, 7, 7, 7), uint4(7, 7, 7, 7), uint4(7, 7, 7, 7), uint4(7, 7, 7, 7),
+	uint4(8, 8, 8, 8), uint4(8, 8, 8, 8), uint4(8, 8, 8, 8), uint4(8, 8, 8, 8),
+	uint4(9, 9, 9, 9), uint4(9, 9, 9, 9), uint4(9, 9, 9, 9), uint4(9, 9, 9, 9),
+	uint4(10, 10, 10, 10), uint4(10, 10, 10, 10), uint4(10, 10, 10, 10), uint4(10, 10, 10, 10),
+	uint4(11, 11, 11, 11), uint4(11, 11, 11, 11), uint4(11, 11, 11, 11), uint4(11, 11, 11, 11),
+	uint4(12, 12, 12, 12), uint4(12, 12, 12, 12), uint4(12, 12, 12, 12), uint4(12, 12, 12, 12),
+	uint4(13, 13, 13, 13), uint4(13, 13, 13, 13), uint4(13, 13, 13, 13), uint4(13, 13, 13, 13),
+	uint4(14, 14, 14, 14), uint4(14, 14, 14, 14), uint4(14, 14, 14, 14), uint4(14, 14, 14, 14),
+	uint4(15, 15, 15, 15), uint4(15, 15, 15, 15), uint4(15, 15, 15, 15), uint4(15, 15, 15, 15),
+	uint4(16, 16, 16, 16), uint4(16, 16, 16, 16), uint4(16, 16, 16, 16), uint4(16, 16, 16, 16),
+	uint4(17, 17, 17, 17), uint4(17, 17, 17, 17), uint4(17, 17, 17, 17), uint4(17, 17, 17, 17),
+	uint4(18, 18, 18, 18), uint4(18, 18, 18, 18), uint4(18, 18, 18, 18), uint4(18, 18, 18, 18),
+	uint4(19, 19, 19, 19), uint4(19, 19, 19, 19), uint4(19, 19, 19, 19), uint4(19, 19, 19, 19),
+	uint4(20, 20, 20, 20), uint4(20, 20, 20, 20), uint4(20, 20, 20, 20), uint4(20, 20, 20, 20),
+	uint4(21, 21, 21, 21), uint4(21, 21, 21, 21), uint4(21, 21, 21, 21), uint4(21, 21, 21, 21),
+	uint4(22, 22, 22, 22), uint4(22, 22, 22, 22), uint4(22, 22, 22, 22), uint4(22, 22, 22, 22),
+	uint4(23, 23, 23, 23), uint4(23, 23, 23, 23), uint4(23, 23, 23, 23), uint4(23, 23, 23, 23),
+	uint4(24, 24, 24, 24), uint4(24, 24, 24, 24), uint4(24, 24, 24, 24), uint4(24, 24, 24, 24),
+	uint4(25, 25, 25, 25), uint4(25, 25, 25, 25), uint4(25, 25, 25, 25), uint4(25, 25, 25, 25),
+	uint4(26, 26, 26, 26), uint4(26, 26, 26, 26), uint4(26, 26, 26, 26), uint4(26, 26, 26, 26),
+	uint4(27, 27, 27, 27), uint4(27, 27, 27, 27), uint4(27, 27, 27, 27), uint4(27, 27, 27, 27),
+	uint4(28, 28, 28, 28), uint4(28, 28, 28, 28), uint4(28, 28, 28, 28), uint4(28, 28, 28, 28),
+	uint4(29, 29, 29, 29), uint4(29, 29, 29, 29), uint4(29, 29, 29, 29), uint4(29, 29, 29, 29),
+	uint4(30, 30, 30, 30), uint4(30, 30, 30, 30), uint4(30, 30, 30, 30), uint4(30, 30, 30, 30),
+	uint4(31, 31, 31, 31), uint4(31, 31, 31, 31), uint4(31, 31, 31, 31), uint4(31, 31, 31, 31),
+	uint4(32, 32, 32, 32), uint4(32, 32, 32, 32), uint4(32, 32, 32, 32), uint4(32, 32, 32, 32),
+	uint4(33, 33, 33, 33), uint4(33, 33, 33, 33), uint4(33, 33, 33, 33), uint4(33, 33, 33, 33),
+	uint4(34, 34, 34, 34), uint4(34, 34, 34, 34), uint4(34, 34, 34, 34), uint4(34, 34, 34, 34),
+	uint4(35, 35, 35, 35), uint4(35, 35, 35, 35), uint4(35, 35, 35, 35), uint4(35, 35, 35, 35),
+	uint4(36, 36, 36, 36), uint4(36, 36, 36, 36), uint4(36, 36, 36, 36), uint4(36, 36, 36, 36),
+	uint4(37, 37, 37, 37), uint4(37, 37, 37, 37), uint4(37, 37, 37, 37), uint4(37, 37, 37, 37),
+	uint4(38, 38, 38, 38), uint4(38, 38, 38, 38), uint4(38, 38, 38, 38), uint4(38, 38, 38, 38),
+	uint4(39, 39, 39, 39), uint4(39, 39, 39, 39), uint4(39, 39, 39, 39), uint4(39, 39, 39, 39),
+};
+static const float4 pseudo_inverse_wt_8x5[444] =
+{
+	float4(0.79265f, 0.357854f, -0.0769418f, -0.119697f), float4(-0.0219311f, 0.0501403f, 0.017239f, -0.0156623f),
+	float4(0.057064f, 0.0206056f, -0.0218782f, -0.0640768f), float4(-0.0402101f, 0.0424243f, 0.0225161f, -0.010236f),
+	float4(-0.201169f, 0.21695f, 0.635069f, 0.448698f), float4(0.0816976f, -0.188691f, -0.0646331f, 0.0594247f),
+	float4(-0.0190472f, 0.0316613f, 0.0544541f, -0.0493864f), float4(-0.0424348f, 0.020475f, 0.0336493f, 0.025004f),
+	float4(0.0595407f, -0.0645678f, -0.188676f, 0.0806325f), float4(0.446355f, 0.632315f, 0.216489f, -0.199338f),
+	float4(-0.0191213f, 0.0302155f, 0.0525621f, -0.0362275f), float4(-0.06642f, -0.0345988f, 0.0253247f, 0.0443287f),
+	float4(-0.0156623f, 0.0171882f, 0.0500388f, -0.0214387f), float4(-0.118475f, -0.075185f, 0.359351f, 0.793887f),
+	float4(-0.0227473f, 0.0473519f, 0.0163954f, -0.0154098f), float4(-0.07045f, -0.0139196f, 0.0176488f, 0.042886f),
+	float4(-0.188131f, -0.0875976f, 0.776233f, 0.385538f), float4(-0.103403f, -0.0949902f, 0.0443198f, 0.372932f),
+	float4(0.227092f, -0.0290843f, -0.0621901f, -0.24872f), float4(-0.125049f, 0.0302437f, 0.0605933f, 0.0305132f),
+	float4(-0.152324f, -0.102397f, -0.17587f, 0.202805f), float4(0.675436f, 0.407991f, 0.0878103f, -0.191364f),
+	float4(-0.0693468f, 0.291263f, 0.252175f, 0.0739301f), float4(-0.11086f, 0.0728111f, -0.197848f, -0.149079f),
+	float4(-0.134878f, -0.186924f, 0.0836382f, -0.22525f), float4(0.123282f, 0.475998f, 0.654363f, 0.211788f),
+	float4(-0.230788f, -0.0852384f, 0.192453f, 0.350678f), float4(0.171058f, -0.132087f, -0.134775f, -0.235364f),
+	float4(-0.0931575f, -0.201493f, 0.0635853f, -0.135478f), float4(-0.0536332f, 0.381742f, 0.817117f, -0.0522908f),
+	float4(-0.0502517f, 0.115149f, 0.402415f, 0.0391221f), float4(0.0510868f, -0.115631f, -0.248874f, 0.0599777f),
+	float4(0.0599777f, -0.248874f, -0.115631f, 0.0510868f), float4(0.0391221f, 0.402415f, 0.115149f, -0.0502517f),
+	float4(-0.0522908f, 0.817117f, 0.381742f, -0.0536332f), float4(-0.135478f, 0.0635853f, -0.201493f, -0.0931575f),
+	float4(-0.235364f, -0.134775f, -0.132087f, 0.171058f), float4(0.350678f, 0.192453f, -0.0852384f, -0.230788f),
+	float4(0.211788f, 0.654363f, 0.475998f, 0.123282f), float4(-0.22525f, 0.0836382f, -0.186924f, -0.134878f),
+	float4(-0.149079f, -0.197848f, 0.0728111f, -0.11086f), float4(0.0739301f, 0.252175f, 0.291263f, -0.0693468f),
+	float4(-0.191364f, 0.0878103f, 0.407991f, 0.675436f), float4(0.202805f, -0.17587f, -0.102397f, -0.152324f),
+	float4(0.0305132f, 0.0605933f, 0.0302437f, -0.125049f), float4(-0.24872f, -0.0621901f, -0.0290843f, 0.227092f),
+	float4(0.372932f, 0.0443198f, -0.0949902f, -0.103403f), float4(0.385538f, 0.776233f, -0.0875976f, -0.188131f),
+	float4(0.042886f, 0.0176488f, -0.0139196f, -0.07045f), float4(-0.0154098f, 0.0163954f, 0.0473519f, -0.0227473f),
+	float4(0.793887f, 0.359351f, -0.075185f, -0.118475f), float4(-0.0214387f, 0.0500388f, 0.0171882f, -0.0156623f),
+	float4(0.0443287f, 0.0253247f, -0.0345988f, -0.06642f), float4(-0.0362275f, 0.0525621f, 0.0302155f, -0.0191213f),
+	float4(-0.199338f, 0.216489f, 0.632315f, 0.446355f), float4(0.0806325f, -0.188676f, -0.0645678f, 0.0595407f),
+	float4(0.025004f, 0.0336493f, 0.020475f, -0.0424348f), float4(-0.0493864f, 0.0544541f, 0.0316613f, -0.0190472f),
+	float4(0.0594247f, -0.0646331f, -0.188691f, 0.0816976f), float4(0.448698f, 0.635069f, 0.21695f, -0.201169f),
+	float4(-0.010236f, 0.0225161f, 0.0424243f, -0.0402101f), float4(-0.0640768f, -0.0218782f, 0.0206056f, 0.057064f),
+	float4(-0.0156623f, 0.017239f, 0.0501403f, -0.0219311f), float4(-0.119697f, -0.0769418f, 0.357854f, 0.79265f),
+	float4(0.881593f, 0.270644f, -0.169588f, -0.0123115f), float4(0.0448696f, -0.00948133f, -0.0101788f, 0.00445324f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(-0.204539f, 0.467517f, 0.821023f, 0.0596032f), float4(-0.217226f, 0.0459017f, 0.0492785f, -0.0215593f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0750646f, -0.171576f, -0.159819f, 0.756331f), float4(0.756331f, -0.159819f, -0.171576f, 0.0750646f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(-0.0215593f, 0.0492785f, 0.0459017f, -0.217226f), float4(0.0596032f, 0.821023f, 0.467517f, -0.204539f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.00445324f, -0.0101788f, -0.00948133f, 0.0448696f), float4(-0.0123115f, -0.169588f, 0.270644f, 0.881593f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.881593f, 0.270644f, -0.169588f, -0.0123115f), float4(0.0448696f, -0.00948133f, -0.0101788f, 0.00445324f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(-0.204539f, 0.467517f, 0.821023f, 0.0596032f), float4(-0.217226f, 0.0459017f, 0.0492785f, -0.0215593f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0750646f, -0.171576f, -0.159819f, 0.756331f), float4(0.756331f, -0.159819f, -0.171576f, 0.0750646f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(-0.0215593f, 0.0492785f, 0.0459017f, -0.217226f), float4(0.0596032f, 0.821023f, 0.467517f, -0.204539f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.00445324f, -0.0101788f, -0.00948133f, 0.0448696f), float4(-0.0123115f, -0.169588f, 0.270644f, 0.881593f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.881593f, 0.270644f, -0.169588f, -0.0123115f), float4(0.0448696f, -0.00948133f, -0.0101788f, 0.00445324f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(-0.204539f, 0.467517f, 0.821023f, 0.0596032f), float4(-0.217226f, 0.0459017f, 0.0492785f, -0.0215593f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0750646f, -0.171576f, -0.159819f, 0.756331f), float4(0.756331f, -0.159819f, -0.171576f, 0.0750646f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(-0.0215593f, 0.0492785f, 0.0459017f, -0.217226f), float4(0.0596032f, 0.821023f, 0.467517f, -0.204539f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.00445324f, -0.0101788f, -0.00948133f, 0.0448696f), float4(-0.0123115f, -0.169588f, 0.270644f, 0.881593f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.881593f, 0.270644f, -0.169588f, -0.0123115f), float4(0.0448696f, -0.00948133f, -0.0101788f, 0.00445324f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(-0.204539f, 0.467517f, 0.821023f, 0.0596032f), float4(-0.217226f, 0.0459017f, 0.0492785f, -0.0215593f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0750646f, -0.171576f, -0.159819f, 0.756331f), float4(0.756331f, -0.159819f, -0.171576f, 0.0750646f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(-0.0215593f, 0.0492785f, 0.0459017f, -0.217226f), float4(0.0596032f, 0.821023f, 0.467517f, -0.204539f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.00445324f, -0.0101788f, -0.00948133f, 0.0448696f), float4(-0.0123115f, -0.169588f, 0.270644f, 0.881593f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.881593f, 0.270644f, -0.169588f, -0.0123115f), float4(0.0448696f, -0.00948133f, -0.0101788f, 0.00445324f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(-0.204539f, 0.467517f, 0.821023f, 0.0596032f), float4(-0.217226f, 0.0459017f, 0.0492785f, -0.0215593f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0750646f, -0.171576f, -0.159819f, 0.756331f), float4(0.756331f, -0.159819f, -0.171576f, 0.0750646f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(-0.0215593f, 0.0492785f, 0.0459017f, -0.217226f), float4(0.0596032f, 0.821023f, 0.467517f, -0.204539f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.00445324f, -0.0101788f, -0.00948133f, 0.0448696f), float4(-0.0123115f, -0.169588f, 0.270644f, 0.881593f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.967275f, 0.104719f, -0.12799f, 0.0649557f), float4(-0.00672315f, -0.00511246f, 0.00383435f, -0.000958587f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(-0.287351f, 0.919524f, 0.653915f, -0.331864f), float4(0.0343492f, 0.02612f, -0.01959f, 0.00489751f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0769021f, -0.246087f, 0.300773f, 1.00737f), float4(-0.104266f, -0.0792867f, 0.059465f, -0.0148663f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(-0.0186696f, 0.0597428f, -0.073019f, -0.105833f), float4(0.996397f, 0.323158f, -0.242368f, 0.0605921f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.00543199f, -0.0173824f, 0.0212451f, 0.0307925f), float4(-0.289905f, 0.571013f, 0.905074f, -0.226268f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(-0.000958587f, 0.00306748f, -0.00374914f, -0.00543397f), float4(0.0511598f, -0.100767f, 0.0755752f, 0.981106f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.967275f, 0.104719f, -0.12799f, 0.0649557f), float4(-0.00672315f, -0.00511246f, 0.00383435f, -0.000958587f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(-0.287351f, 0.919524f, 0.653915f, -0.331864f), float4(0.0343492f, 0.02612f, -0.01959f, 0.00489751f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0769021f, -0.246087f, 0.300773f, 1.00737f), float4(-0.104266f, -0.0792867f, 0.059465f, -0.0148663f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(-0.0186696f, 0.0597428f, -0.073019f, -0.105833f), float4(0.996397f, 0.323158f, -0.242368f, 0.0605921f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.00543199f, -0.0173824f, 0.0212451f, 0.0307925f), float4(-0.289905f, 0.571013f, 0.905074f, -0.226268f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(-0.000958587f, 0.00306748f, -0.00374914f, -0.00543397f), float4(0.0511598f, -0.100767f, 0.0755752f, 0.981106f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.967275f, 0.104719f, -0.12799f, 0.0649557f), float4(-0.00672315f, -0.00511246f, 0.00383435f, -0.000958587f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(-0.287351f, 0.919524f, 0.653915f, -0.331864f), float4(0.0343492f, 0.02612f, -0.01959f, 0.00489751f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0769021f, -0.246087f, 0.300773f, 1.00737f), float4(-0.104266f, -0.0792867f, 0.059465f, -0.0148663f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(-0.0186696f, 0.0597428f, -0.073019f, -0.105833f), float4(0.996397f, 0.323158f, -0.242368f, 0.0605921f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.00543199f, -0.0173824f, 0.0212451f, 0.0307925f), float4(-0.289905f, 0.571013f, 0.905074f, -0.226268f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(-0.000958587f, 0.00306748f, -0.00374914f, -0.00543397f), float4(0.0511598f, -0.100767f, 0.0755752f, 0.981106f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.967275f, 0.104719f, -0.12799f, 0.0649557f), float4(-0.00672315f, -0.00511246f, 0.00383435f, -0.000958587f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(-0.287351f, 0.919524f, 0.653915f, -0.331864f), float4(0.0343492f, 0.02612f, -0.01959f, 0.00489751f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0769021f, -0.246087f, 0.300773f, 1.00737f), float4(-0.104266f, -0.0792867f, 0.059465f, -0.0148663f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(-0.0186696f, 0.0597428f, -0.073019f, -0.105833f), float4(0.996397f, 0.323158f, -0.242368f, 0.0605921f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.00543199f, -0.0173824f, 0.0212451f, 0.0307925f), float4(-0.289905f, 0.571013f, 0.905074f, -0.226268f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(-0.000958587f, 0.00306748f, -0.00374914f, -0.00543397f), float4(0.0511598f, -0.100767f, 0.0755752f, 0.981106f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.967275f, 0.104719f, -0.12799f, 0.0649557f), float4(-0.00672315f, -0.00511246f, 0.00383435f, -0.000958587f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(-0.287351f, 0.919524f, 0.653915f, -0.331864f), float4(0.0343492f, 0.02612f, -0.01959f, 0.00489751f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0769021f, -0.246087f, 0.300773f, 1.00737f), float4(-0.104266f, -0.0792867f, 0.059465f, -0.0148663f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(-0.0186696f, 0.0597428f, -0.073019f, -0.105833f), float4(0.996397f, 0.323158f, -0.242368f, 0.0605921f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.00543199f, -0.0173824f, 0.0212451f, 0.0307925f), float4(-0.289905f, 0.571013f, 0.905074f, -0.226268f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(-0.000958587f, 0.00306748f, -0.00374914f, -0.00543397f), float4(0.0511598f, -0.100767f, 0.0755752f, 0.981106f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+};
+
+#define WEIGHT_GRID_COUNT_8X6 4
+#define MAX_GRID_WEIGHTS_8X6 48
+static const uint4 weight_grids_8x6[WEIGHT_GRID_COUNT_8X6] = { uint4(4, 4, 0, 0), uint4(5, 5, 16, 48), uint4(6, 6, 41, 96), uint4(8, 6, 77, 144) };
+static const uint4 decimation_idx_8x6[125] =
+{
+	uint4(0, 1, 8, 9), uint4(2, 3, 10, 11), uint4(4, 5, 12, 13), uint4(7, 7, 15, 15),
+	uint4(8, 9, 16, 17), uint4(10, 11, 18, 19), uint4(12, 13, 20, 21), uint4(15, 15, 23, 23),
+	uint4(24, 25, 32, 33), uint4(26, 27, 34, 35), uint4(28, 29, 36, 37), uint4(31, 31, 39, 39),
+	uint4(40, 41, 40, 41), uint4(42, 43, 42, 43), uint4(44, 45, 44, 45), uint4(47, 47, 47, 47),
+	uint4(0, 1, 8, 9), uint4(1, 2, 9, 10), uint4(3, 4, 11, 12), uint4(5, 6, 13, 14),
+	uint4(7, 7, 15, 15), uint4(8, 9, 16, 17), uint4(9, 10, 17, 18), uint4(11, 12, 19, 20),
+	uint4(13, 14, 21, 22), uint4(15, 15, 23, 23), uint4(16, 17, 24, 25), uint4(17, 18, 25, 26),
+	uint4(19, 20, 27, 28), uint4(21, 22, 29, 30), uint4(23, 23, 31, 31), uint4(24, 25, 32, 33),
+	uint4(25, 26, 33, 34), uint4(27, 28, 35, 36), uint4(29, 30, 37, 38), uint4(31, 31, 39, 39),
+	uint4(40, 41, 40, 41), uint4(41, 42, 41, 42), uint4(43, 44, 43, 44), uint4(45, 46, 45, 46),
+	uint4(47, 47, 47, 47), uint4(0, 1, 8, 9), uint4(1, 2, 9, 10), uint4(2, 3, 10, 11),
+	uint4(4, 5, 12, 13), uint4(5, 6, 13, 14), uint4(7, 7, 15, 15), uint4(8, 9, 16, 17),
+	uint4(9, 10, 17, 18), uint4(10, 11, 18, 19), uint4(12, 13, 20, 21), uint4(13, 14, 21, 22),
+	uint4(15, 15, 23, 23), uint4(16, 17, 24, 25), uint4(17, 18, 25, 26), uint4(18, 19, 26, 27),
+	uint4(20, 21, 28, 29), uint4(21, 22, 29, 30), uint4(23, 23, 31, 31), uint4(24, 25, 32, 33),
+	uint4(25, 26, 33, 34), uint4(26, 27, 34, 35), uint4(28, 29, 36, 37), uint4(29, 30, 37, 38),
+	uint4(31, 31, 39, 39), uint4(32, 33, 40, 41), uint4(33, 34, 41, 42), uint4(34, 35, 42, 43),
+	uint4(36, 37, 44, 45), uint4(37, 38, 45, 46), uint4(39, 39, 47, 47), uint4(40, 41, 40, 41),
+	uint4(41, 42, 41, 42), uint4(42, 43, 42, 43), uint4(44, 45, 44, 45), uint4(45, 46, 45, 46),
+	uint4(47, 47, 47, 47), uint4(0, 1, 8, 9), uint4(1, 2, 9, 10), uint4(2, 3, 10, 11),
+	uint4(3, 4, 11, 12), uint4(4, 5, 12, 13), uint4(5, 6, 13, 14), uint4(6, 7, 14, 15),
+	uint4(7, 7, 15, 15), uint4(8, 9, 16, 17), uint4(9, 10, 17, 18), uint4(10, 11, 18, 19),
+	uint4(11, 12, 19, 20), uint4(12, 13, 20, 21), uint4(13, 14, 21, 22), uint4(14, 15, 22, 23),
+	uint4(15, 15, 23, 23), uint4(16, 17, 24, 25), uint4(17, 18, 25, 26), uint4(18, 19, 26, 27),
+	uint4(19, 20, 27, 28), uint4(20, 21, 28, 29), uint4(21, 22, 29, 30), uint4(22, 23, 30, 31),
+	uint4(23, 23, 31, 31), uint4(24, 25, 32, 33), uint4(25, 26, 33, 34), uint4(26, 27, 34, 35),
+	uint4(27, 28, 35, 36), uint4(28, 29, 36, 37), uint4(29, 30, 37, 38), uint4(30, 31, 38, 39),
+	uint4(31, 31, 39, 39), uint4(32, 33, 40, 41), uint4(33, 34, 41, 42), uint4(34, 35, 42, 43),
+	uint4(35, 36, 43, 44), uint4(36, 37, 44, 45), uint4(37, 38, 45, 46), uint4(38, 39, 46, 47),
+	uint4(39, 39, 47, 47), uint4(40, 41, 40, 41), uint4(41, 42, 41, 42), uint4(42, 43, 42, 43),
+	uint4(43, 44, 43, 44), uint4(44, 45, 44, 45), uint4(45, 46, 45, 46), uint4(46, 47, 46, 47),
+	uint4(47, 47, 47, 47),
+};
+static const float4 decimation_wt_8x6[125] =
+{
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.666666746f, 0.333333254f, 0.0f, 0.0f),
+	float4(0.333333492f, 0.666666508f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.333333373f, 0.0f, 0.666666627f, 0.0f), float4(0.222222269f, 0.111111097f, 0.444444478f, 0.222222149f),
+	float4(0.111111179f, 0.222222194f, 0.222222313f, 0.444444299f), float4(0.333333373f, 0.0f, 0.666666627f, 0.0f),
+	float4(0.666666746f, 0.0f, 0.333333254f, 0.0f), float4(0.444444537f, 0.222222194f, 0.222222194f, 0.11111106f),
+	float4(0.222222358f, 0.444444388f, 0.111111134f, 0.22222212f), float4(0.666666746f, 0.0f, 0.333333254f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.666666746f, 0.333333254f, 0.0f, 0.0f),
+	float4(0.333333492f, 0.666666508f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.25f, 0.75f, 0.0f, 0.0f),
+	float4(0.5f, 0.5f, 0.0f, 0.0f), float4(0.75f, 0.25f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.75f, 0.0f, 0.25f, 0.0f),
+	float4(0.1875f, 0.5625f, 0.0625f, 0.1875f), float4(0.375f, 0.375f, 0.125f, 0.125f),
+	float4(0.5625f, 0.1875f, 0.1875f, 0.0625f), float4(0.75f, 0.0f, 0.25f, 0.0f),
+	float4(0.5f, 0.0f, 0.5f, 0.0f), float4(0.125f, 0.375f, 0.125f, 0.375f),
+	float4(0.25f, 0.25f, 0.25f, 0.25f), float4(0.375f, 0.125f, 0.375f, 0.125f),
+	float4(0.5f, 0.0f, 0.5f, 0.0f), float4(0.25f, 0.0f, 0.75f, 0.0f),
+	float4(0.0625f, 0.1875f, 0.1875f, 0.5625f), float4(0.125f, 0.125f, 0.375f, 0.375f),
+	float4(0.1875f, 0.0625f, 0.5625f, 0.1875f), float4(0.25f, 0.0f, 0.75f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.25f, 0.75f, 0.0f, 0.0f),
+	float4(0.5f, 0.5f, 0.0f, 0.0f), float4(0.75f, 0.25f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.600000024f, 0.399999976f, 0.0f, 0.0f), float4(0.200000048f, 0.799999952f, 0.0f, 0.0f),
+	float4(0.800000191f, 0.199999809f, 0.0f, 0.0f), float4(0.400000095f, 0.599999905f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.600000024f, 0.399999976f, 0.0f, 0.0f), float4(0.200000048f, 0.799999952f, 0.0f, 0.0f),
+	float4(0.800000191f, 0.199999809f, 0.0f, 0.0f), float4(0.400000095f, 0.599999905f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.600000024f, 0.399999976f, 0.0f, 0.0f), float4(0.200000048f, 0.799999952f, 0.0f, 0.0f),
+	float4(0.800000191f, 0.199999809f, 0.0f, 0.0f), float4(0.400000095f, 0.599999905f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.600000024f, 0.399999976f, 0.0f, 0.0f), float4(0.200000048f, 0.799999952f, 0.0f, 0.0f),
+	float4(0.800000191f, 0.199999809f, 0.0f, 0.0f), float4(0.400000095f, 0.599999905f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.600000024f, 0.399999976f, 0.0f, 0.0f), float4(0.200000048f, 0.799999952f, 0.0f, 0.0f),
+	float4(0.800000191f, 0.199999809f, 0.0f, 0.0f), float4(0.400000095f, 0.599999905f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.600000024f, 0.399999976f, 0.0f, 0.0f), float4(0.200000048f, 0.799999952f, 0.0f, 0.0f),
+	float4(0.800000191f, 0.199999809f, 0.0f, 0.0f), float4(0.400000095f, 0.599999905f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f),
+};
+static const uint4 infill_idx_8x6[192] =
+{
+	uint4(0, 0, 0, 0), uint4(0, 1, 0, 0), uint4(0, 1, 0, 0), uint4(1, 2, 1, 1),
+	uint4(1, 2, 1, 1), uint4(2, 3, 2, 2), uint4(2, 3, 2, 2), uint4(3, 3, 3, 3),
+	uint4(0, 0, 4, 0), uint4(0, 1, 4, 5), uint4(0, 1, 4, 5), uint4(1, 2, 5, 6),
+	uint4(1, 2, 5, 6), uint4(2, 3, 6, 7), uint4(2, 3, 6, 7), uint4(3, 3, 7, 3),
+	uint4(4, 4, 8, 4), uint4(4, 5, 8, 9), uint4(4, 5, 4, 9), uint4(5, 6, 9, 10),
+	uint4(5, 6, 9, 10), uint4(6, 7, 10, 6), uint4(6, 7, 10, 11), uint4(7, 7, 11, 7),
+	uint4(4, 4, 8, 4), uint4(4, 5, 8, 9), uint4(4, 5, 8, 9), uint4(5, 6, 9, 10),
+	uint4(5, 6, 9, 10), uint4(6, 6, 10, 11), uint4(6, 7, 10, 11), uint4(7, 7, 11, 7),
+	uint4(8, 8, 12, 8), uint4(8, 9, 12, 13), uint4(8, 9, 12, 13), uint4(9, 10, 13, 14),
+	uint4(9, 10, 13, 14), uint4(10, 11, 14, 15), uint4(10, 11, 14, 15), uint4(11, 11, 15, 11),
+	uint4(12, 12, 12, 12), uint4(12, 13, 12, 12), uint4(12, 13, 12, 12), uint4(13, 14, 13, 13),
+	uint4(13, 14, 13, 13), uint4(14, 15, 14, 14), uint4(14, 15, 14, 14), uint4(15, 15, 15, 15),
+	uint4(0, 0, 0, 0), uint4(0, 1, 0, 0), uint4(1, 2, 1, 1), uint4(1, 2, 1, 1),
+	uint4(2, 3, 2, 2), uint4(2, 3, 2, 2), uint4(3, 4, 3, 3), uint4(4, 4, 4, 4),
+	uint4(0, 0, 5, 0), uint4(0, 1, 5, 6), uint4(1, 1, 6, 7), uint4(1, 2, 6, 7),
+	uint4(2, 3, 7, 8), uint4(2, 3, 7, 8), uint4(3, 4, 8, 9), uint4(4, 4, 9, 4),
+	uint4(5, 5, 10, 5), uint4(5, 6, 10, 11), uint4(6, 7, 11, 12), uint4(6, 7, 11, 12),
+	uint4(7, 8, 12, 13), uint4(7, 8, 12, 13), uint4(8, 9, 13, 14), uint4(9, 9, 14, 9),
+	uint4(10, 10, 15, 10), uint4(10, 11, 15, 16), uint4(11, 12, 16, 17), uint4(11, 12, 16, 17),
+	uint4(12, 13, 17, 18), uint4(12, 13, 17, 18), uint4(13, 14, 18, 19), uint4(14, 14, 19, 14),
+	uint4(15, 15, 20, 15), uint4(15, 16, 20, 21), uint4(16, 17, 21, 16), uint4(16, 17, 21, 22),
+	uint4(17, 18, 22, 23), uint4(17, 18, 17, 23), uint4(18, 19, 23, 24), uint4(19, 19, 24, 19),
+	uint4(20, 20, 20, 20), uint4(20, 21, 20, 20), uint4(21, 22, 21, 21), uint4(21, 22, 21, 21),
+	uint4(22, 23, 22, 22), uint4(22, 23, 22, 22), uint4(23, 24, 23, 23), uint4(24, 24, 24, 24),
+	uint4(0, 0, 0, 0), uint4(0, 1, 0, 0), uint4(1, 2, 1, 1), uint4(2, 3, 2, 2),
+	uint4(2, 3, 2, 2), uint4(3, 4, 3, 3), uint4(4, 5, 4, 4), uint4(5, 5, 5, 5),
+	uint4(6, 6, 6, 6), uint4(6, 7, 6, 6), uint4(7, 8, 7, 7), uint4(8, 9, 8, 8),
+	uint4(8, 9, 8, 8), uint4(9, 10, 9, 9), uint4(10, 11, 10, 10), uint4(11, 11, 11, 11),
+	uint4(12, 12, 12, 12), uint4(12, 13, 12, 12), uint4(13, 14, 13, 13), uint4(14, 15, 14, 14),
+	uint4(14, 15, 14, 14), uint4(15, 16, 15, 15), uint4(16, 17, 16, 16), uint4(17, 17, 17, 17),
+	uint4(18, 18, 18, 18), uint4(18, 19, 18, 18), uint4(19, 20, 19, 19), uint4(20, 21, 20, 20),
+	uint4(20, 21, 20, 20), uint4(21, 22, 21, 21), uint4(22, 23, 22, 22), uint4(23, 23, 23, 23),
+	uint4(24, 24, 24, 24), uint4(24, 25, 24, 24), uint4(25, 26, 25, 25), uint4(26, 27, 26, 26),
+	uint4(26, 27, 26, 26), uint4(27, 28, 27, 27), uint4(28, 29, 28, 28), uint4(29, 29, 29, 29),
+	uint4(30, 30, 30, 30), uint4(30, 31, 30, 30), uint4(31, 32, 31, 31), uint4(32, 33, 32, 32),
+	uint4(32, 33, 32, 32), uint4(33, 34, 33, 33), uint4(34, 35, 34, 34), uint4(35, 35, 35, 35),
+	uint4(0, 0, 0, 0), uint4(1, 1, 1, 1), uint4(2, 2, 2, 2), uint4(3, 3, 3, 3),
+	uint4(4, 4, 4, 4), uint4(5, 5, 5, 5), uint4(6, 6, 6, 6), uint4(7, 7, 7, 7),
+	uint4(8, 8, 8, 8), uint4(9, 9, 9, 9), uint4(10, 10, 10, 10), uint4(11, 11, 11, 11),
+	uint4(12, 12, 12, 12), uint4(13, 13, 13, 13), uint4(14, 14, 14, 14), uint4(15, 15, 15, 15),
+	uint4(16, 16, 16, 16), uint4(17, 17, 17, 17), uint4(18, 18, 18, 18), uint4(19, 19, 19, 19),
+	uint4(20, 20, 20, 20), uint4(21, 21, 21, 21), uint4(22, 22, 22, 22), uint4(23, 23, 23, 23),
+	uint4(24, 24, 24, 24), uint4(25, 25, 25, 25), uint4(26, 26, 26, 26), uint4(27, 27, 27, 27),
+	uint4(28, 28, 28, 28), uint4(29, 29, 29, 29), uint4(30, 30, 30, 30), uint4(31, 31, 31, 31),
+	uint4(32, 32, 32, 32), uint4(33, 33, 33, 33), uint4(34, 34, 34, 34), uint4(35, 35, 35, 35),
+	uint4(36, 36, 36, 36), uint4(37, 37, 37, 37), uint4(38, 38, 38, 38), uint4(39, 39, 39, 39),
+	uint4(40, 40, 40, 40), uint4(41, 41, 41, 41), uint4(42, 42, 42, 42), uint4(43, 43, 43, 43),
+	uint4(44, 44, 44, 44), uint4(45, 45, 45, 45), uint4(46, 46, 46, 46), uint4(47, 47, 47, 47),
+};
+static const float4 infill_wt_8x6[192] =
+{
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.5625f, 0.4375f, 0.0f, 0.0f), float4(0.125f, 0.875f, 0.0f, 0.0f), float4(0.6875f, 0.3125f, 0.0f, 0.0f),
+	float4(0.3125f, 0.6875f, 0.0f, 0.0f), float4(0.875f, 0.125f, 0.0f, 0.0f), float4(0.4375f, 0.5625f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.375f, 0.0f, 0.625f, 0.0f), float4(0.1875f, 0.1875f, 0.375f, 0.25f), float4(0.0625f, 0.3125f, 0.0625f, 0.5625f), float4(0.25f, 0.125f, 0.4375f, 0.1875f),
+	float4(0.125f, 0.25f, 0.1875f, 0.4375f), float4(0.3125f, 0.0625f, 0.5625f, 0.0625f), float4(0.1875f, 0.1875f, 0.25f, 0.375f), float4(0.375f, 0.0f, 0.625f, 0.0f),
+	float4(0.8125f, 0.0f, 0.1875f, 0.0f), float4(0.4375f, 0.375f, 0.125f, 0.0625f), float4(0.125f, 0.6875f, 0.0f, 0.1875f), float4(0.5625f, 0.25f, 0.125f, 0.0625f),
+	float4(0.25f, 0.5625f, 0.0625f, 0.125f), float4(0.6875f, 0.125f, 0.1875f, 0.0f), float4(0.375f, 0.4375f, 0.0625f, 0.125f), float4(0.8125f, 0.0f, 0.1875f, 0.0f),
+	float4(0.1875f, 0.0f, 0.8125f, 0.0f), float4(0.125f, 0.0625f, 0.4375f, 0.375f), float4(0.0f, 0.1875f, 0.125f, 0.6875f), float4(0.125f, 0.0625f, 0.5625f, 0.25f),
+	float4(0.0625f, 0.125f, 0.25f, 0.5625f), float4(0.1875f, 0.0f, 0.6875f, 0.125f), float4(0.0625f, 0.125f, 0.375f, 0.4375f), float4(0.1875f, 0.0f, 0.8125f, 0.0f),
+	float4(0.625f, 0.0f, 0.375f, 0.0f), float4(0.375f, 0.25f, 0.1875f, 0.1875f), float4(0.0625f, 0.5625f, 0.0625f, 0.3125f), float4(0.4375f, 0.1875f, 0.25f, 0.125f),
+	float4(0.1875f, 0.4375f, 0.125f, 0.25f), float4(0.5625f, 0.0625f, 0.3125f, 0.0625f), float4(0.25f, 0.375f, 0.1875f, 0.1875f), float4(0.625f, 0.0f, 0.375f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.5625f, 0.4375f, 0.0f, 0.0f), float4(0.125f, 0.875f, 0.0f, 0.0f), float4(0.6875f, 0.3125f, 0.0f, 0.0f),
+	float4(0.3125f, 0.6875f, 0.0f, 0.0f), float4(0.875f, 0.125f, 0.0f, 0.0f), float4(0.4375f, 0.5625f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.4375f, 0.5625f, 0.0f, 0.0f), float4(0.875f, 0.125f, 0.0f, 0.0f), float4(0.3125f, 0.6875f, 0.0f, 0.0f),
+	float4(0.6875f, 0.3125f, 0.0f, 0.0f), float4(0.125f, 0.875f, 0.0f, 0.0f), float4(0.5625f, 0.4375f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.1875f, 0.0f, 0.8125f, 0.0f), float4(0.0625f, 0.125f, 0.375f, 0.4375f), float4(0.1875f, 0.0f, 0.6875f, 0.125f), float4(0.0625f, 0.125f, 0.25f, 0.5625f),
+	float4(0.125f, 0.0625f, 0.5625f, 0.25f), float4(0.0f, 0.1875f, 0.125f, 0.6875f), float4(0.125f, 0.0625f, 0.4375f, 0.375f), float4(0.1875f, 0.0f, 0.8125f, 0.0f),
+	float4(0.375f, 0.0f, 0.625f, 0.0f), float4(0.1875f, 0.1875f, 0.25f, 0.375f), float4(0.3125f, 0.0625f, 0.5625f, 0.0625f), float4(0.125f, 0.25f, 0.1875f, 0.4375f),
+	float4(0.25f, 0.125f, 0.4375f, 0.1875f), float4(0.0625f, 0.3125f, 0.0625f, 0.5625f), float4(0.1875f, 0.1875f, 0.375f, 0.25f), float4(0.375f, 0.0f, 0.625f, 0.0f),
+	float4(0.625f, 0.0f, 0.375f, 0.0f), float4(0.25f, 0.375f, 0.1875f, 0.1875f), float4(0.5625f, 0.0625f, 0.3125f, 0.0625f), float4(0.1875f, 0.4375f, 0.125f, 0.25f),
+	float4(0.4375f, 0.1875f, 0.25f, 0.125f), float4(0.0625f, 0.5625f, 0.0625f, 0.3125f), float4(0.375f, 0.25f, 0.1875f, 0.1875f), float4(0.625f, 0.0f, 0.375f, 0.0f),
+	float4(0.8125f, 0.0f, 0.1875f, 0.0f), float4(0.375f, 0.4375f, 0.0625f, 0.125f), float4(0.6875f, 0.125f, 0.1875f, 0.0f), float4(0.25f, 0.5625f, 0.0625f, 0.125f),
+	float4(0.5625f, 0.25f, 0.125f, 0.0625f), float4(0.125f, 0.6875f, 0.0f, 0.1875f), float4(0.4375f, 0.375f, 0.125f, 0.0625f), float4(0.8125f, 0.0f, 0.1875f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.4375f, 0.5625f, 0.0f, 0.0f), float4(0.875f, 0.125f, 0.0f, 0.0f), float4(0.3125f, 0.6875f, 0.0f, 0.0f),
+	float4(0.6875f, 0.3125f, 0.0f, 0.0f), float4(0.125f, 0.875f, 0.0f, 0.0f), float4(0.5625f, 0.4375f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.3125f, 0.6875f, 0.0f, 0.0f), float4(0.5625f, 0.4375f, 0.0f, 0.0f), float4(0.875f, 0.125f, 0.0f, 0.0f),
+	float4(0.125f, 0.875f, 0.0f, 0.0f), float4(0.4375f, 0.5625f, 0.0f, 0.0f), float4(0.75f, 0.25f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.3125f, 0.6875f, 0.0f, 0.0f), float4(0.5625f, 0.4375f, 0.0f, 0.0f), float4(0.875f, 0.125f, 0.0f, 0.0f),
+	float4(0.125f, 0.875f, 0.0f, 0.0f), float4(0.4375f, 0.5625f, 0.0f, 0.0f), float4(0.75f, 0.25f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.3125f, 0.6875f, 0.0f, 0.0f), float4(0.5625f, 0.4375f, 0.0f, 0.0f), float4(0.875f, 0.125f, 0.0f, 0.0f),
+	float4(0.125f, 0.875f, 0.0f, 0.0f), float4(0.4375f, 0.5625f, 0.0f, 0.0f), float4(0.75f, 0.25f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.3125f, 0.6875f, 0.0f, 0.0f), float4(0.5625f, 0.4375f, 0.0f, 0.0f), float4(0.875f, 0.125f, 0.0f, 0.0f),
+	float4(0.125f, 0.875f, 0.0f, 0.0f), float4(0.4375f, 0.5625f, 0.0f, 0.0f), float4(0.75f, 0.25f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.3125f, 0.6875f, 0.0f, 0.0f), float4(0.5625f, 0.4375f, 0.0f, 0.0f), float4(0.875f, 0.125f, 0.0f, 0.0f),
+	float4(0.125f, 0.875f, 0.0f, 0.0f), float4(0.4375f, 0.5625f, 0.0f, 0.0f), float4(0.75f, 0.25f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.3125f, 0.6875f, 0.0f, 0.0f), float4(0.5625f, 0.4375f, 0.0f, 0.0f), float4(0.875f, 0.125f, 0.0f, 0.0f),
+	float4(0.125f, 0.875f, 0.0f, 0.0f), float4(0.4375f, 0.5625f, 0.0f, 0.0f), float4(0.75f, 0.25f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+};
+static const uint4 pseudo_inverse_idx_8x6[500] =
+{
+	uint4(0, 1, 2, 3), uint4(4, 5, 6, 7), uint4(8, 9, 11, 16), uint4(17, 19, 32, 33),
+	uint4(0, 1, 2, 3), uint4(4, 5, 6, 7), uint4(8, 9, 10, 11), uint4(13, 17, 18, 19),
+	uint4(0, 1, 2, 3), uint4(4, 5, 6, 7), uint4(10, 12, 13, 14), uint4(15, 20, 21, 22),
+	uint4(0, 1, 2, 3), uint4(4, 5, 6, 7), uint4(12, 14, 15, 20), uint4(22, 23, 38, 39),
+	uint4(0, 1, 8, 9), uint4(10, 11, 13, 16), uint4(17, 18, 19, 21), uint4(24, 32, 33, 40),
+	uint4(2, 3, 8, 9), uint4(10, 11, 13, 16), uint4(17, 18, 19, 20), uint4(21, 22, 34, 35),
+	uint4(4, 5, 10, 12), uint4(13, 14, 15, 17), uint4(18, 19, 20, 21), uint4(22, 23, 36, 37),
+	uint4(6, 7, 10, 12), uint4(13, 14, 15, 18), uint4(20, 21, 22, 23), uint4(31, 38, 39, 47),
+	uint4(0, 8, 9, 16), uint4(24, 25, 26, 27), uint4(29, 32, 33, 34), uint4(35, 37, 40, 41),
+	uint4(10, 11, 24, 25), uint4(26, 27, 28, 29), uint4(30, 32, 33, 34), uint4(35, 37, 42, 43),
+	uint4(12, 13, 25, 26), uint4(27, 28, 29, 30), uint4(31, 34, 36, 37), uint4(38, 39, 44, 45),
+	uint4(7, 14, 15, 23), uint4(26, 28, 29, 30), uint4(31, 34, 36, 37), uint4(38, 39, 46, 47),
+	uint4(8, 9, 24, 25), uint4(27, 32, 33, 35), uint4(40, 41, 42, 43), uint4(44, 45, 46, 47),
+	uint4(25, 26, 27, 32), uint4(33, 34, 35, 37), uint4(40, 41, 42, 43), uint4(44, 45, 46, 47),
+	uint4(28, 29, 30, 34), uint4(36, 37, 38, 39), uint4(40, 41, 42, 43), uint4(44, 45, 46, 47),
+	uint4(14, 15, 28, 30), uint4(31, 36, 38, 39), uint4(40, 41, 42, 43), uint4(44, 45, 46, 47),
+	uint4(0, 1, 2, 3), uint4(4, 5, 6, 8), uint4(9, 16, 17, 18), uint4(24, 25, 26, 32),
+	uint4(0, 1, 2, 3), uint4(4, 5, 6, 7), uint4(9, 10, 17, 18), uint4(20, 25, 26, 34),
+	uint4(0, 1, 2, 3), uint4(4, 5, 6, 7), uint4(10, 11, 12, 13), uint4(19, 20, 27, 28),
+	uint4(0, 1, 2, 3), uint4(4, 5, 6, 7), uint4(13, 14, 19, 21), uint4(22, 29, 30, 37),
+	uint4(1, 2, 3, 4), uint4(5, 6, 7, 14), uint4(15, 21, 22, 23), uint4(29, 30, 31, 39),
+	uint4(0, 1, 2, 8), uint4(9, 10, 12, 16), uint4(17, 18, 24, 25), uint4(26, 32, 33, 34),
+	uint4(0, 1, 2, 4), uint4(8, 9, 10, 12), uint4(14, 17, 18, 20), uint4(24, 25, 26, 34),
+	uint4(3, 4, 8, 9), uint4(10, 11, 12, 13), uint4(14, 15, 19, 20), uint4(27, 28, 35, 36),
+	uint4(3, 5, 6, 7), uint4(9, 11, 13, 14), uint4(15, 19, 21, 22), uint4(29, 30, 31, 37),
+	uint4(5, 6, 7, 11), uint4(13, 14, 15, 21), uint4(22, 23, 29, 30), uint4(31, 37, 38, 39),
+	uint4(0, 8, 9, 10), uint4(16, 17, 18, 20), uint4(24, 25, 26, 28), uint4(32, 33, 34, 40),
+	uint4(2, 9, 10, 12), uint4(16, 17, 18, 20), uint4(24, 25, 26, 28), uint4(33, 34, 36, 42),
+	uint4(11, 12, 17, 18), uint4(19, 20, 21, 22), uint4(25, 26, 27, 28), uint4(29, 30, 35, 36),
+	uint4(5, 11, 13, 14), uint4(19, 21, 22, 23), uint4(27, 29, 30, 31), uint4(35, 37, 38, 45),
+	uint4(7, 13, 14, 15), uint4(19, 21, 22, 23), uint4(27, 29, 30, 31), uint4(37, 38, 39, 47),
+	uint4(8, 9, 10, 16), uint4(17, 18, 24, 25), uint4(26, 32, 33, 34), uint4(36, 40, 41, 42),
+	uint4(10, 16, 17, 18), uint4(25, 26, 28, 32), uint4(33, 34, 36, 38), uint4(40, 41, 42, 44),
+	uint4(11, 12, 19, 20), uint4(27, 28, 32, 33), uint4(34, 35, 36, 37), uint4(38, 39, 43, 44),
+	uint4(13, 21, 22, 23), uint4(27, 29, 30, 33), uint4(35, 37, 38, 39), uint4(43, 45, 46, 47),
+	uint4(13, 14, 15, 21), uint4(22, 23, 29, 30), uint4(31, 35, 37, 38), uint4(39, 45, 46, 47),
+	uint4(8, 16, 17, 18), uint4(24, 25, 26, 32), uint4(33, 40, 41, 42), uint4(43, 44, 45, 46),
+	uint4(10, 17, 18, 25), uint4(26, 28, 33, 34), uint4(40, 41, 42, 43), uint4(44, 45, 46, 47),
+	uint4(19, 20, 27, 28), uint4(34, 35, 36, 37), uint4(40, 41, 42, 43), uint4(44, 45, 46, 47),
+	uint4(13, 21, 22, 27), uint4(29, 30, 37, 38), uint4(40, 41, 42, 43), uint4(44, 45, 46, 47),
+	uint4(15, 21, 22, 23), uint4(29, 30, 31, 38), uint4(39, 41, 42, 43), uint4(44, 45, 46, 47),
+	uint4(0, 1, 2, 3), uint4(4, 5, 6, 7), uint4(0, 0, 0, 0), uint4(0, 0, 0, 0),
+	uint4(0, 1, 2, 3), uint4(4, 5, 6, 7), uint4(0, 0, 0, 0), uint4(0, 0, 0, 0),
+	uint4(0, 1, 2, 3), uint4(4, 5, 6, 7), uint4(0, 0, 0, 0), uint4(0, 0, 0, 0),
+	uint4(0, 1, 2, 3), uint4(4, 5, 6, 7), uint4(0, 0, 0, 0), uint4(0, 0, 0, 0),
+	uint4(0, 1, 2, 3), uint4(4, 5, 6, 7), uint4(0, 0, 0, 0), uint4(0, 0, 0, 0),
+	uint4(0, 1, 2, 3), uint4(4, 5, 6, 7), uint4(0, 0, 0, 0), uint4(0, 0, 0, 0),
+	uint4(8, 9, 10, 11), uint4(12, 13, 14, 15), uint4(8, 8, 8, 8), uint4(8, 8, 8, 8),
+	uint4(8, 9, 10, 11), uint4(12, 13, 14, 15), uint4(8, 8, 8, 8), uint4(8, 8, 8, 8),
+	uint4(8, 9, 10, 11), uint4(12, 13, 14, 15), uint4(8, 8, 8, 8), uint4(8, 8, 8, 8),
+	uint4(8, 9, 10, 11), uint4(12, 13, 14, 15), uint4(8, 8, 8, 8), uint4(8, 8, 8, 8),
+	uint4(8, 9, 10, 11), uint4(12, 13, 14, 15), uint4(8, 8, 8, 8), uint4(8, 8, 8, 8),
+	uint4(8, 9, 10, 11), uint4(12, 13, 14, 15), uint4(8, 8, 8, 8), uint4(8, 8, 8, 8),
+	uint4(16, 17, 18, 19), uint4(20, 21, 22, 23), uint4(16, 16, 16, 16), uint4(16, 16, 16, 16),
+	uint4(16, 17, 18, 19), uint4(20, 21, 22, 23), uint4(16, 16, 16, 16), uint4(16, 16, 16, 16),
+	uint4(16, 17, 18, 19), uint4(20, 21, 22, 23), uint4(16, 16, 16, 16), uint4(16, 16, 16, 16),
+	uint4(16, 17, 18, 19), uint4(20, 21, 22, 23), uint4(16, 16, 16, 16), uint4(16, 16, 16, 16),
+	uint4(16, 17, 18, 19), uint4(20, 21, 22, 23), uint4(16, 16, 16, 16), uint4(16, 16, 16, 16),
+	uint4(16, 17, 18, 19), uint4(20, 21, 22, 23), uint4(16, 16, 16, 16), uint4(16, 16, 16, 16),
+	uint4(24, 25, 26, 27), uint4(28, 29, 30, 31), uint4(24, 24, 24, 24), uint4(24, 24, 24, 24),
+	uint4(24, 25, 26, 27), uint4(28, 29, 30, 31), uint4(24, 24, 24, 24), uint4(24, 24, 24, 24),
+	uint4(24, 25, 26, 27), uint4(28, 29, 30, 31), uint4(24, 24, 24, 24), uint4(24, 24, 24, 24),
+	uint4(24, 25, 26, 27), uint4(28, 29, 30, 31), uint4(24, 24, 24, 24), uint4(24, 24, 24, 24),
+	uint4(24, 25, 26, 27), uint4(28, 29, 30, 31), uint4(24, 24, 24, 24), uint4(24, 24, 24, 24),
+	uint4(24, 25, 26, 27), uint4(28, 29, 30, 31), uint4(24, 24, 24, 24), uint4(24, 24, 24, 24),
+	uint4(32, 33, 34, 35), uint4(36, 37, 38, 39), uint4(32, 32, 32, 32), uint4(32, 32, 32, 32),
+	uint4(32, 33, 34, 35), uint4(36, 37, 38, 39), uint4(32, 32, 32, 32), uint4(32, 32, 32, 32),
+	uint4(32, 33, 34, 35), uint4(36, 37, 38, 39), uint4(32, 32, 32, 32), uint4(32, 32, 32, 32),
+	uint4(32, 33, 34, 35), uint4(36, 37, 38, 39), uint4(32, 32, 32, 32), uint4(32, 32, 32, 32),
+	uint4(32, 33, 34, 35), uint4(36, 37, 38, 39), uint4(32, 32, 32, 32), uint4(32, 32, 32, 32),
+	uint4(32, 33, 34, 35), uint4(36, 37, 38, 39), uint4(32, 32, 32, 32), uint4(32, 32, 32, 32),
+	uint4(40, 41, 42, 43), uint4(44, 45, 46, 47), uint4(40, 40, 40, 40), uint4(40, 40, 40, 40),
+	uint4(40, 41, 42, 43), uint4(44, 45, 46, 47), uint4(40, 40, 40, 40), uint4(40, 40, 40, 40),
+	uint4(40, 41, 42, 43), uint4(44, 45, 46, 47), uint4(40, 40, 40, 40), uint4(40, 40, 40, 40),
+	uint4(40, 41, 42, 43), uint4(44, 45, 46, 47), uint4(40, 40, 40, 40), uint4(40, 40, 40, 40),
+	uint4(40, 41, 42, 43), uint4(44, 45, 46, 47), uint4(40, 40, 40, 40), uint4(40, 40, 40, 40),
+	uint4(40, 41, 42, 43), uint4(44, 45, 46, 47), uint4(40, 40, 40, 40), uint4(40, 40, 40, 40),
+	uint4(0, 0, 0, 0), uint4(0, 0, 0, 0), uint4(0, 0, 0, 0), uint4(0, 0, 0, 0),
+	uint4(1, 1, 1, 1), uint4(1, 1, 1, 1), uint4(1, 1, 1, 1), uint4(1, 1, 1, 1),
+	uint4(2, 2, 2, 2), uint4(2, 2, 2, 2), uint4(2, 2, 2, 2), uint4(2, 2, 2, 2),
+	uint4(3, 3, 3, 3), uint4(3, 3, 3, 3), uint4(3, 3, 3, 3), uint4(3, 3, 3, 3),
+	uint4(4, 4, 4, 4), uint4(4, 4, 4, 4), uint4(4, 4, 4, 4), uint4(4, 4, 4, 4),
+	uint4(5, 5, 5, 5), uint4(5, 5, 5, 5), uint4(5, 5, 5, 5), uint4(5, 5, 5, 5),
+	uint4(6, 6, 6, 6), uint4(6, 6, 6, 6), uint4(6, 6, 6, 6), uint4(6, 6, 6, 6),
+	uint4(7, 7, 7, 7), uint4(7, 7, 7, 7), uint4(7, 7, 7, 7), uint4(7, 7, 7, 7),
+	uint4(8, 8, 8, 8), uint4(8, 8, 8, 8), uint4(8, 8, 8, 8), uint4(8, 8, 8, 8),
+	uint4(9, 9, 9, 9), uint4(9, 9, 9, 9), uint4(9, 9, 9, 9), uint4(9, 9, 9, 9),
+	uint4(10, 10, 10, 10), uint4(10, 10, 10, 10), uint4(10, 10, 10, 10), uint4(10, 10, 10, 10),
+	uint4(11, 11, 11, 11), uint4(11, 11, 11, 11), uint4(11, 11, 11, 11), uint4(11, 11, 11, 11),
+	uint4(12, 12, 12, 12), uint4(12, 12, 12, 12), uint4(12, 12, 12, 12), uint4(12, 12, 12, 12),
+	uint4(13, 13, 13, 13), uint4(13, 13, 13, 13), uint4(13, 13, 13, 13), uint4(13, 13, 13, 13),
+	uint4(14, 14, 14, 14), uint4(14, 14, 14, 14), uint4(14, 14, 14, 14), uint4(14, 14, 14, 14),
+	uint4(15, 15, 15, 15), uint4(15, 15, 15, 15), uint4(15, 15, 15, 15), uint4(15, 15, 15, 15),
+	uint4(16, 16, 16, 16), uint4(16, 16, 16, 16), uint4(16, 16, 16, 16), uint4(16, 16, 16, 16),
+	uint4(17, 17, 17, 17), uint4(17, 17, 17, 17), uint4(17, 17, 17, 17), uint4(17, 17, 17, 17),
+	uint4(18, 18, 18, 18), uint4(18, 18, 18, 18), uint4(18, 18, 18, 18), uint4(18, 18, 18, 18),
+	uint4(19, 19, 19, 19), uint4(19, 19, 19, 19), uint4(19, 19, 19, 19), uint4(19, 19, 19, 19),
+	uint4(20, 20, 20, 20), uint4(20, 20, 20, 20), uint4(20, 20, 20, 20), uint4(20, 20, 20, 20),
+	uint4(21, 21, 21, 21), uint4(21, 21, 21, 21), uint4(21, 21, 21, 21), uint4(21, 21, 21, 21),
+	uint4(22, 22, 22, 22), uint4(22, 22, 22, 22), uint4(22, 22, 22, 22), uint4(22, 22, 22, 22),
+	uint4(23, 23, 23, 23), uint4(23, 23, 23, 23), uint4(23, 23, 23, 23), uint4(23, 23, 23, 23),
+	uint4(24, 24, 24, 24), uint4(24, 24, 24, 24), uint4(24, 24, 24, 24), uint4(24, 24, 24, 24),
+	uint4(25, 25, 25, 25), uint4(25, 25, 25, 25), uint4(25, 25, 25, 25), uint4(25, 25, 25, 25),
+	uint4(26, 26, 26, 26), uint4(26, 26, 26, 26), uint4(26, 26, 26, 26), uint4(26, 26, 26, 26),
+	uint4(27, 27, 27, 27), uint4(27, 27, 27, 27), uint4(27, 27, 27, 27), uint4(27, 27, 27, 27),
+	uint4(28, 28, 28, 28), uint4(28, 28, 28, 28), uint4(28, 28, 28, 28), uint4(28, 28, 28, 28),
+	uint4(29, 29, 29, 29), uint4(29, 29, 29, 29), uint4(29, 29, 29, 29), uint4(29, 29, 29, 29),
+	uint4(30, 30, 30, 30), uint4(30, 30, 30, 30), uint4(30, 30, 30, 30), uint4(30, 30, 30, 30),
+	uint4(31, 31, 31, 31), uint4(31, 31, 31, 31), uint4(31, 31, 31, 31), uint4(31, 31, 31, 31),
+	uint4(32, 32, 32, 32), uint4(32, 32, 32, 32), uint4(32, 32, 32, 32), uint4(32, 32, 32, 32),
+	uint4(33, 33, 33, 33), uint4(33, 33, 33, 33), uint4(33, 33, 33, 33), uint4(33, 33, 33, 33),
+	uint4(34, 34, 34, 34), uint4(34, 34, 34, 34), uint4(34, 34, 34, 34), uint4(34, 34, 34, 34),
+	uint4(35, 35, 35, 35), uint4(35, 35, 35, 35), uint4(35, 35, 35, 35), uint4(35, 35, 35, 35),
+	uint4(36, 36, 36, 36), uint4(36, 36, 36, 36), uint4(36, 36, 36, 36), uint4(36, 36, 36, 36),
+	uint4(37, 37, 37, 37), uint4(37, 37, 37, 37), uint4(37, 37, 37, 37), uint4(37, 37, 37, 37),
+	uint4(38, 38, 38, 38), uint4(38, 38, 38, 38), uint4(38, 38, 38, 38), uint4(38, 38, 38, 38),
+	uint4(39, 39, 39, 39), uint4(39, 39, 39, 39), uint4(39, 39, 39, 39), uint4(39, 39, 39, 39),
+	uint4(40, 40, 40, 40), uint4(40, 40, 40, 40), uint4(40, 40, 40, 40), uint4(40, 40, 40, 40),
+	uint4(41, 41, 41, 41), uint4(41, 41, 41, 41), uint4(41, 41, 41, 41), uint4(41, 41, 41, 41),
+	uint4(42, 42, 42, 42), uint4(42, 42, 42, 42), uint4(42, 42, 42, 42), uint4(42, 42, 42, 42),
+	uint4(43, 43, 43, 43), uint4(43, 43, 43, 43), uint4(43, 43, 43, 43), uint4(43, 43, 43, 43),
+	uint4(44, 44, 44, 44), uint4(44, 44, 44, 44), uint4(44, 44, 44, 44), uint4(44, 44, 44, 44),
+	uint4(45, 45, 45, 45), uint4(45, 45, 45, 45), uint4(45, 45, 45, 45), uint4(45, 45, 45, 45),
+	uint4(46, 46, 46, 46), uint4(46, 46, 46, 46), uint4(46, 46, 46, 46), uint4(46, 46, 46, 46),
+	uint4(47, 47, 47, 47), uint4(47, 47, 47, 47), uint4(47, 47, 47, 47), uint4(47, 47, 47, 47),
+};
+static const float4 pseudo_inverse_wt_8x6[500] =
+{
+	float4(0.746412f, 0.33577f, -0.0748729f, -0.114005f), float4(-0.0201727f, 0.0488056f, 0.0165513f, -0.015703f),
+	float4(0.17198f, 0.0506031f, -0.0232878f, -0.130492f), float4(-0.0528088f, 0.0207466f, 0.0287096f, 0.0143124f),
+	float4(-0.192199f, 0.2026f, 0.597399f, 0.421261f), float4(0.0745367f, -0.180348f, -0.0611633f, 0.0580212f),
+	float4(-0.0460794f, 0.0713468f, 0.11943f, 0.087437f), float4(-0.0368516f, -0.042475f, -0.0990855f, -0.0755758f),
+	float4(0.0580212f, -0.0611633f, -0.180348f, 0.0745367f), float4(0.421261f, 0.597399f, 0.2026f, -0.192199f),
+	float4(-0.0368516f, 0.087437f, 0.11943f, 0.0713468f), float4(-0.0460794f, -0.0755758f, -0.0990855f, -0.042475f),
+	float4(-0.015703f, 0.0165513f, 0.0488056f, -0.0201727f), float4(-0.114005f, -0.0748729f, 0.33577f, 0.746412f),
+	float4(-0.0232878f, 0.0506031f, 0.17198f, 0.0207466f), float4(-0.0528088f, -0.130492f, 0.0143124f, 0.0287096f),
+	float4(-0.17268f, -0.0789357f, 0.466055f, 0.238735f), float4(-0.0688516f, -0.075386f, 0.0321613f, 0.641813f),
+	float4(0.261316f, -0.0315601f, -0.0998205f, 0.0386281f), float4(-0.0497962f, -0.14118f, -0.0706627f, 0.0523193f),
+	float4(-0.139092f, -0.098625f, -0.120766f, 0.0983401f), float4(0.395331f, 0.275572f, -0.117558f, -0.165308f),
+	float4(0.20252f, 0.485417f, 0.371064f, 0.0613557f), float4(-0.14395f, -0.0600964f, -0.120727f, -0.084256f),
+	float4(-0.098625f, -0.139092f, -0.117558f, 0.275572f), float4(0.395331f, 0.0983401f, -0.120766f, -0.0600964f),
+	float4(-0.14395f, 0.0613557f, 0.371064f, 0.485417f), float4(0.20252f, -0.165308f, -0.084256f, -0.120727f),
+	float4(-0.0789357f, -0.17268f, 0.0321613f, -0.075386f), float4(-0.0688516f, 0.238735f, 0.466055f, 0.0386281f),
+	float4(-0.0998205f, -0.0315601f, 0.261316f, 0.641813f), float4(-0.0497962f, -0.0706627f, -0.14118f, 0.0523193f),
+	float4(0.0523193f, -0.14118f, -0.0706627f, -0.0497962f), float4(0.641813f, 0.261316f, -0.0315601f, -0.0998205f),
+	float4(0.0386281f, 0.466055f, 0.238735f, -0.0688516f), float4(-0.075386f, 0.0321613f, -0.17268f, -0.0789357f),
+	float4(-0.120727f, -0.084256f, -0.165308f, 0.20252f), float4(0.485417f, 0.371064f, 0.0613557f, -0.14395f),
+	float4(-0.0600964f, -0.120766f, 0.0983401f, 0.395331f), float4(0.275572f, -0.117558f, -0.139092f, -0.098625f),
+	float4(-0.084256f, -0.120727f, -0.0600964f, -0.14395f), float4(0.0613557f, 0.371064f, 0.485417f, 0.20252f),
+	float4(-0.165308f, -0.117558f, 0.275572f, 0.395331f), float4(0.0983401f, -0.120766f, -0.098625f, -0.139092f),
+	float4(0.0523193f, -0.0706627f, -0.14118f, -0.0497962f), float4(0.0386281f, -0.0998205f, -0.0315601f, 0.261316f),
+	float4(0.641813f, 0.0321613f, -0.075386f, -0.0688516f), float4(0.238735f, 0.466055f, -0.0789357f, -0.17268f),
+	float4(0.0287096f, 0.0143124f, -0.130492f, -0.0528088f), float4(0.0207466f, 0.17198f, 0.0506031f, -0.0232878f),
+	float4(0.746412f, 0.33577f, -0.0748729f, -0.114005f), float4(-0.0201727f, 0.0488056f, 0.0165513f, -0.015703f),
+	float4(-0.042475f, -0.0990855f, -0.0755758f, -0.0460794f), float4(0.0713468f, 0.11943f, 0.087437f, -0.0368516f),
+	float4(-0.192199f, 0.2026f, 0.597399f, 0.421261f), float4(0.0745367f, -0.180348f, -0.0611633f, 0.0580212f),
+	float4(-0.0755758f, -0.0990855f, -0.042475f, -0.0368516f), float4(0.087437f, 0.11943f, 0.0713468f, -0.0460794f),
+	float4(0.0580212f, -0.0611633f, -0.180348f, 0.0745367f), float4(0.421261f, 0.597399f, 0.2026f, -0.192199f),
+	float4(0.0143124f, 0.0287096f, 0.0207466f, -0.0528088f), float4(-0.130492f, -0.0232878f, 0.0506031f, 0.17198f),
+	float4(-0.015703f, 0.0165513f, 0.0488056f, -0.0201727f), float4(-0.114005f, -0.0748729f, 0.33577f, 0.746412f),
+	float4(0.878679f, 0.2699f, -0.168778f, -0.0121033f), float4(0.0447943f, -0.0094645f, -0.0101488f, 0.0202024f),
+	float4(-0.00877588f, -0.0289508f, -0.0120906f, 0.0101797f), float4(0.031047f, 0.00685006f, -0.00698273f, -0.0140673f),
+	float4(-0.203594f, 0.465565f, 0.817557f, 0.0594624f), float4(-0.216236f, 0.0456002f, 0.0489638f, -0.021522f),
+	float4(0.011243f, 0.0150242f, -0.0168555f, -0.0355699f), float4(0.00909303f, 0.0206843f, 0.0338947f, -0.0152682f),
+	float4(0.074938f, -0.170671f, -0.158862f, 0.753916f), float4(0.753916f, -0.158862f, -0.170671f, 0.074938f),
+	float4(-0.0126805f, 0.0123265f, 0.0123265f, -0.0126805f), float4(-0.0239756f, -0.0239756f, 0.0240999f, 0.0240999f),
+	float4(-0.021522f, 0.0489638f, 0.0456002f, -0.216236f), float4(0.0594624f, 0.817557f, 0.465565f, -0.203594f),
+	float4(0.0150242f, 0.011243f, 0.00909303f, -0.0355699f), float4(-0.0168555f, 0.0338947f, 0.0206843f, -0.0152682f),
+	float4(-0.0101488f, -0.0094645f, 0.0447943f, -0.0121033f), float4(-0.168778f, 0.2699f, 0.878679f, -0.00877588f),
+	float4(0.0202024f, 0.0101797f, -0.0120906f, -0.0289508f), float4(-0.00698273f, 0.00685006f, 0.031047f, -0.0140673f),
+	float4(-0.177908f, -0.0543348f, 0.0337561f, 0.970245f), float4(0.31613f, -0.198177f, 0.0582047f, 0.201275f),
+	float4(0.0941291f, -0.0528665f, -0.215216f, -0.0592768f), float4(0.0312964f, 0.0978463f, 0.0328541f, -0.0186866f),
+	float4(0.0650772f, -0.119324f, -0.213604f, 0.0772089f), float4(-0.249979f, 0.543967f, 0.963537f, -0.282102f),
+	float4(0.0710783f, 0.0954759f, 0.21206f, -0.068038f), float4(0.0595957f, -0.119256f, -0.201705f, 0.0908062f),
+	float4(-0.162844f, -0.162844f, 0.0987757f, -0.213909f), float4(-0.178602f, 0.854671f, 0.854671f, -0.178602f),
+	float4(-0.213909f, 0.0987757f, 0.17429f, 0.17429f), float4(-0.175492f, -0.175492f, 0.0764305f, 0.0764305f),
+	float4(0.0772089f, -0.213604f, -0.119324f, 0.0650772f), float4(0.0710783f, -0.282102f, 0.963537f, 0.543967f),
+	float4(-0.249979f, -0.068038f, 0.21206f, 0.0954759f), float4(-0.201705f, -0.119256f, 0.0595957f, 0.0908062f),
+	float4(0.0337561f, -0.0543348f, -0.177908f, 0.0582047f), float4(-0.198177f, 0.31613f, 0.970245f, -0.0528665f),
+	float4(0.0941291f, 0.201275f, 0.0312964f, -0.0592768f), float4(-0.215216f, -0.0186866f, 0.0328541f, 0.0978463f),
+	float4(0.0604233f, -0.329175f, -0.105597f, 0.070542f), float4(0.724768f, 0.18808f, -0.122302f, 0.0275245f),
+	float4(0.724768f, 0.18808f, -0.122302f, 0.0275245f), float4(-0.329175f, -0.105597f, 0.070542f, 0.0604233f),
+	float4(0.0620095f, -0.161767f, -0.279243f, 0.0658587f), float4(-0.151179f, 0.377946f, 0.620891f, -0.140853f),
+	float4(-0.151179f, 0.377946f, 0.620891f, -0.140853f), float4(-0.161767f, -0.279243f, 0.0658587f, 0.0620095f),
+	float4(-0.256351f, -0.256351f, -0.116739f, -0.118283f), float4(0.588326f, 0.588326f, -0.118283f, -0.116739f),
+	float4(-0.116739f, -0.118283f, 0.588326f, 0.588326f), float4(-0.118283f, -0.116739f, -0.256351f, -0.256351f),
+	float4(0.0620095f, 0.0658587f, -0.279243f, -0.161767f), float4(-0.140853f, 0.620891f, 0.377946f, -0.151179f),
+	float4(-0.140853f, 0.620891f, 0.377946f, -0.151179f), float4(0.0658587f, -0.279243f, -0.161767f, 0.0620095f),
+	float4(0.0604233f, 0.070542f, -0.105597f, -0.329175f), float4(0.0275245f, -0.122302f, 0.18808f, 0.724768f),
+	float4(0.0275245f, -0.122302f, 0.18808f, 0.724768f), float4(0.070542f, -0.105597f, -0.329175f, 0.0604233f),
+	float4(0.0978463f, 0.0328541f, -0.0186866f, -0.215216f), float4(-0.0592768f, 0.0312964f, 0.201275f, 0.0941291f),
+	float4(-0.0528665f, 0.970245f, 0.31613f, -0.198177f), float4(0.0582047f, -0.177908f, -0.0543348f, 0.0337561f),
+	float4(0.0908062f, 0.0595957f, -0.119256f, -0.201705f), float4(0.0954759f, 0.21206f, -0.068038f, -0.249979f),
+	float4(0.543967f, 0.963537f, -0.282102f, 0.0710783f), float4(0.0650772f, -0.119324f, -0.213604f, 0.0772089f),
+	float4(0.0764305f, 0.0764305f, -0.175492f, -0.175492f), float4(0.17429f, 0.17429f, 0.0987757f, -0.213909f),
+	float4(-0.178602f, 0.854671f, 0.854671f, -0.178602f), float4(-0.213909f, 0.0987757f, -0.162844f, -0.162844f),
+	float4(0.0908062f, -0.201705f, -0.119256f, 0.0595957f), float4(-0.068038f, 0.21206f, 0.0954759f, 0.0710783f),
+	float4(-0.282102f, 0.963537f, 0.543967f, -0.249979f), float4(0.0772089f, -0.213604f, -0.119324f, 0.0650772f),
+	float4(-0.0186866f, 0.0328541f, 0.0978463f, 0.0312964f), float4(-0.0592768f, -0.215216f, -0.0528665f, 0.0941291f),
+	float4(0.201275f, 0.0582047f, -0.198177f, 0.31613f), float4(0.970245f, 0.0337561f, -0.0543348f, -0.177908f),
+	float4(-0.0140673f, 0.031047f, 0.00685006f, -0.00698273f), float4(-0.0289508f, -0.0120906f, 0.0101797f, 0.0202024f),
+	float4(-0.00877588f, 0.878679f, 0.2699f, -0.168778f), float4(-0.0121033f, 0.0447943f, -0.0094645f, -0.0101488f),
+	float4(-0.0152682f, 0.0206843f, 0.0338947f, -0.0168555f), float4(-0.0355699f, 0.00909303f, 0.011243f, 0.0150242f),
+	float4(-0.203594f, 0.465565f, 0.817557f, 0.0594624f), float4(-0.216236f, 0.0456002f, 0.0489638f, -0.021522f),
+	float4(0.0240999f, 0.0240999f, -0.0239756f, -0.0239756f), float4(-0.0126805f, 0.0123265f, 0.0123265f, -0.0126805f),
+	float4(0.074938f, -0.170671f, -0.158862f, 0.753916f), float4(0.753916f, -0.158862f, -0.170671f, 0.074938f),
+	float4(-0.0152682f, 0.0338947f, 0.0206843f, 0.00909303f), float4(-0.0355699f, -0.0168555f, 0.0150242f, 0.011243f),
+	float4(-0.021522f, 0.0489638f, 0.0456002f, -0.216236f), float4(0.0594624f, 0.817557f, 0.465565f, -0.203594f),
+	float4(-0.0140673f, -0.00698273f, 0.00685006f, 0.031047f), float4(0.0101797f, -0.0120906f, -0.0289508f, -0.00877588f),
+	float4(0.0202024f, -0.0101488f, -0.0094645f, 0.0447943f), float4(-0.0121033f, -0.168778f, 0.2699f, 0.878679f),
+	float4(0.967275f, 0.104719f, -0.12799f, 0.0649557f), float4(-0.00672315f, -0.00511246f, 0.00383435f, -0.000958587f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(-0.287351f, 0.919524f, 0.653915f, -0.331864f), float4(0.0343492f, 0.02612f, -0.01959f, 0.00489751f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0769021f, -0.246087f, 0.300773f, 1.00737f), float4(-0.104266f, -0.0792867f, 0.059465f, -0.0148663f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(-0.0186696f, 0.0597428f, -0.073019f, -0.105833f), float4(0.996397f, 0.323158f, -0.242368f, 0.0605921f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.00543199f, -0.0173824f, 0.0212451f, 0.0307925f), float4(-0.289905f, 0.571013f, 0.905074f, -0.226268f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(-0.000958587f, 0.00306748f, -0.00374914f, -0.00543397f), float4(0.0511598f, -0.100767f, 0.0755752f, 0.981106f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.967275f, 0.104719f, -0.12799f, 0.0649557f), float4(-0.00672315f, -0.00511246f, 0.00383435f, -0.000958587f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(-0.287351f, 0.919524f, 0.653915f, -0.331864f), float4(0.0343492f, 0.02612f, -0.01959f, 0.00489751f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0769021f, -0.246087f, 0.300773f, 1.00737f), float4(-0.104266f, -0.0792867f, 0.059465f, -0.0148663f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(-0.0186696f, 0.0597428f, -0.073019f, -0.105833f), float4(0.996397f, 0.323158f, -0.242368f, 0.0605921f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.00543199f, -0.0173824f, 0.0212451f, 0.0307925f), float4(-0.289905f, 0.571013f, 0.905074f, -0.226268f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(-0.000958587f, 0.00306748f, -0.00374914f, -0.00543397f), float4(0.0511598f, -0.100767f, 0.0755752f, 0.981106f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.967275f, 0.104719f, -0.12799f, 0.0649557f), float4(-0.00672315f, -0.00511246f, 0.00383435f, -0.000958587f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(-0.287351f, 0.919524f, 0.653915f, -0.331864f), float4(0.0343492f, 0.02612f, -0.01959f, 0.00489751f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0769021f, -0.246087f, 0.300773f, 1.00737f), float4(-0.104266f, -0.0792867f, 0.059465f, -0.0148663f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(-0.0186696f, 0.0597428f, -0.073019f, -0.105833f), float4(0.996397f, 0.323158f, -0.242368f, 0.0605921f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.00543199f, -0.0173824f, 0.0212451f, 0.0307925f), float4(-0.289905f, 0.571013f, 0.905074f, -0.226268f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(-0.000958587f, 0.00306748f, -0.00374914f, -0.00543397f), float4(0.0511598f, -0.100767f, 0.0755752f, 0.981106f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.967275f, 0.104719f, -0.12799f, 0.0649557f), float4(-0.00672315f, -0.00511246f, 0.00383435f, -0.000958587f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(-0.287351f, 0.919524f, 0.653915f, -0.331864f), float4(0.0343492f, 0.02612f, -0.01959f, 0.00489751f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0769021f, -0.246087f, 0.300773f, 1.00737f), float4(-0.104266f, -0.0792867f, 0.059465f, -0.0148663f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(-0.0186696f, 0.0597428f, -0.073019f, -0.105833f), float4(0.996397f, 0.323158f, -0.242368f, 0.0605921f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.00543199f, -0.0173824f, 0.0212451f, 0.0307925f), float4(-0.289905f, 0.571013f, 0.905074f, -0.226268f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(-0.000958587f, 0.00306748f, -0.00374914f, -0.00543397f), float4(0.0511598f, -0.100767f, 0.0755752f, 0.981106f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.967275f, 0.104719f, -0.12799f, 0.0649557f), float4(-0.00672315f, -0.00511246f, 0.00383435f, -0.000958587f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(-0.287351f, 0.919524f, 0.653915f, -0.331864f), float4(0.0343492f, 0.02612f, -0.01959f, 0.00489751f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0769021f, -0.246087f, 0.300773f, 1.00737f), float4(-0.104266f, -0.0792867f, 0.059465f, -0.0148663f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(-0.0186696f, 0.0597428f, -0.073019f, -0.105833f), float4(0.996397f, 0.323158f, -0.242368f, 0.0605921f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.00543199f, -0.0173824f, 0.0212451f, 0.0307925f), float4(-0.289905f, 0.571013f, 0.905074f, -0.226268f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(-0.000958587f, 0.00306748f, -0.00374914f, -0.00543397f), float4(0.0511598f, -0.100767f, 0.0755752f, 0.981106f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.967275f, 0.104719f, -0.12799f, 0.0649557f), float4(-0.00672315f, -0.00511246f, 0.00383435f, -0.000958587f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(-0.287351f, 0.919524f, 0.653915f, -0.331864f), float4(0.0343492f, 0.02612f, -0.01959f, 0.00489751f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0769021f, -0.246087f, 0.300773f, 1.00737f), float4(-0.104266f, -0.0792867f, 0.059465f, -0.0148663f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(-0.0186696f, 0.0597428f, -0.073019f, -0.105833f), float4(0.996397f, 0.323158f, -0.242368f, 0.0605921f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.00543199f, -0.0173824f, 0.0212451f, 0.0307925f), float4(-0.289905f, 0.571013f, 0.905074f, -0.226268f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(-0.000958587f, 0.00306748f, -0.00374914f, -0.00543397f), float4(0.0511598f, -0.100767f, 0.0755752f, 0.981106f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+};
+
+#define WEIGHT_GRID_COUNT_8X8 4
+#define MAX_GRID_WEIGHTS_8X8 64
+static const uint4 weight_grids_8x8[WEIGHT_GRID_COUNT_8X8] = { uint4(4, 4, 0, 0), uint4(5, 5, 16, 64), uint4(6, 6, 41, 128), uint4(8, 8, 77, 192) };
+static const uint4 decimation_idx_8x8[141] =
+{
+	uint4(0, 1, 8, 9), uint4(2, 3, 10, 11), uint4(4, 5, 12, 13), uint4(7, 7, 15, 15),
+	uint4(16, 17, 24, 25), uint4(18, 19, 26, 27), uint4(20, 21, 28, 29), uint4(23, 23, 31, 31),
+	uint4(32, 33, 40, 41), uint4(34, 35, 42, 43), uint4(36, 37, 44, 45), uint4(39, 39, 47, 47),
+	uint4(56, 57, 56, 57), uint4(58, 59, 58, 59), uint4(60, 61, 60, 61), uint4(63, 63, 63, 63),
+	uint4(0, 1, 8, 9), uint4(1, 2, 9, 10), uint4(3, 4, 11, 12), uint4(5, 6, 13, 14),
+	uint4(7, 7, 15, 15), uint4(8, 9, 16, 17), uint4(9, 10, 17, 18), uint4(11, 12, 19, 20),
+	uint4(13, 14, 21, 22), uint4(15, 15, 23, 23), uint4(24, 25, 32, 33), uint4(25, 26, 33, 34),
+	uint4(27, 28, 35, 36), uint4(29, 30, 37, 38), uint4(31, 31, 39, 39), uint4(40, 41, 48, 49),
+	uint4(41, 42, 49, 50), uint4(43, 44, 51, 52), uint4(45, 46, 53, 54), uint4(47, 47, 55, 55),
+	uint4(56, 57, 56, 57), uint4(57, 58, 57, 58), uint4(59, 60, 59, 60), uint4(61, 62, 61, 62),
+	uint4(63, 63, 63, 63), uint4(0, 1, 8, 9), uint4(1, 2, 9, 10), uint4(2, 3, 10, 11),
+	uint4(4, 5, 12, 13), uint4(5, 6, 13, 14), uint4(7, 7, 15, 15), uint4(8, 9, 16, 17),
+	uint4(9, 10, 17, 18), uint4(10, 11, 18, 19), uint4(12, 13, 20, 21), uint4(13, 14, 21, 22),
+	uint4(15, 15, 23, 23), uint4(16, 17, 24, 25), uint4(17, 18, 25, 26), uint4(18, 19, 26, 27),
+	uint4(20, 21, 28, 29), uint4(21, 22, 29, 30), uint4(23, 23, 31, 31), uint4(32, 33, 40, 41),
+	uint4(33, 34, 41, 42), uint4(34, 35, 42, 43), uint4(36, 37, 44, 45), uint4(37, 38, 45, 46),
+	uint4(39, 39, 47, 47), uint4(40, 41, 48, 49), uint4(41, 42, 49, 50), uint4(42, 43, 50, 51),
+	uint4(44, 45, 52, 53), uint4(45, 46, 53, 54), uint4(47, 47, 55, 55), uint4(56, 57, 56, 57),
+	uint4(57, 58, 57, 58), uint4(58, 59, 58, 59), uint4(60, 61, 60, 61), uint4(61, 62, 61, 62),
+	uint4(63, 63, 63, 63), uint4(0, 1, 8, 9), uint4(1, 2, 9, 10), uint4(2, 3, 10, 11),
+	uint4(3, 4, 11, 12), uint4(4, 5, 12, 13), uint4(5, 6, 13, 14), uint4(6, 7, 14, 15),
+	uint4(7, 7, 15, 15), uint4(8, 9, 16, 17), uint4(9, 10, 17, 18), uint4(10, 11, 18, 19),
+	uint4(11, 12, 19, 20), uint4(12, 13, 20, 21), uint4(13, 14, 21, 22), uint4(14, 15, 22, 23),
+	uint4(15, 15, 23, 23), uint4(16, 17, 24, 25), uint4(17, 18, 25, 26), uint4(18, 19, 26, 27),
+	uint4(19, 20, 27, 28), uint4(20, 21, 28, 29), uint4(21, 22, 29, 30), uint4(22, 23, 30, 31),
+	uint4(23, 23, 31, 31), uint4(24, 25, 32, 33), uint4(25, 26, 33, 34), uint4(26, 27, 34, 35),
+	uint4(27, 28, 35, 36), uint4(28, 29, 36, 37), uint4(29, 30, 37, 38), uint4(30, 31, 38, 39),
+	uint4(31, 31, 39, 39), uint4(32, 33, 40, 41), uint4(33, 34, 41, 42), uint4(34, 35, 42, 43),
+	uint4(35, 36, 43, 44), uint4(36, 37, 44, 45), uint4(37, 38, 45, 46), uint4(38, 39, 46, 47),
+	uint4(39, 39, 47, 47), uint4(40, 41, 48, 49), uint4(41, 42, 49, 50), uint4(42, 43, 50, 51),
+	uint4(43, 44, 51, 52), uint4(44, 45, 52, 53), uint4(45, 46, 53, 54), uint4(46, 47, 54, 55),
+	uint4(47, 47, 55, 55), uint4(48, 49, 56, 57), uint4(49, 50, 57, 58), uint4(50, 51, 58, 59),
+	uint4(51, 52, 59, 60), uint4(52, 53, 60, 61), uint4(53, 54, 61, 62), uint4(54, 55, 62, 63),
+	uint4(55, 55, 63, 63), uint4(56, 57, 56, 57), uint4(57, 58, 57, 58), uint4(58, 59, 58, 59),
+	uint4(59, 60, 59, 60), uint4(60, 61, 60, 61), uint4(61, 62, 61, 62), uint4(62, 63, 62, 63),
+	uint4(63, 63, 63, 63),
+};
+static const float4 decimation_wt_8x8[141] =
+{
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.666666746f, 0.333333254f, 0.0f, 0.0f),
+	float4(0.333333492f, 0.666666508f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.666666746f, 0.0f, 0.333333254f, 0.0f), float4(0.444444537f, 0.222222194f, 0.222222194f, 0.11111106f),
+	float4(0.222222358f, 0.444444388f, 0.111111134f, 0.22222212f), float4(0.666666746f, 0.0f, 0.333333254f, 0.0f),
+	float4(0.333333492f, 0.0f, 0.666666508f, 0.0f), float4(0.222222358f, 0.111111134f, 0.444444388f, 0.22222212f),
+	float4(0.111111216f, 0.222222269f, 0.222222269f, 0.444444239f), float4(0.333333492f, 0.0f, 0.666666508f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.666666746f, 0.333333254f, 0.0f, 0.0f),
+	float4(0.333333492f, 0.666666508f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.25f, 0.75f, 0.0f, 0.0f),
+	float4(0.5f, 0.5f, 0.0f, 0.0f), float4(0.75f, 0.25f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.25f, 0.0f, 0.75f, 0.0f),
+	float4(0.0625f, 0.1875f, 0.1875f, 0.5625f), float4(0.125f, 0.125f, 0.375f, 0.375f),
+	float4(0.1875f, 0.0625f, 0.5625f, 0.1875f), float4(0.25f, 0.0f, 0.75f, 0.0f),
+	float4(0.5f, 0.0f, 0.5f, 0.0f), float4(0.125f, 0.375f, 0.125f, 0.375f),
+	float4(0.25f, 0.25f, 0.25f, 0.25f), float4(0.375f, 0.125f, 0.375f, 0.125f),
+	float4(0.5f, 0.0f, 0.5f, 0.0f), float4(0.75f, 0.0f, 0.25f, 0.0f),
+	float4(0.1875f, 0.5625f, 0.0625f, 0.1875f), float4(0.375f, 0.375f, 0.125f, 0.125f),
+	float4(0.5625f, 0.1875f, 0.1875f, 0.0625f), float4(0.75f, 0.0f, 0.25f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.25f, 0.75f, 0.0f, 0.0f),
+	float4(0.5f, 0.5f, 0.0f, 0.0f), float4(0.75f, 0.25f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.600000024f, 0.399999976f, 0.0f, 0.0f), float4(0.200000048f, 0.799999952f, 0.0f, 0.0f),
+	float4(0.800000191f, 0.199999809f, 0.0f, 0.0f), float4(0.400000095f, 0.599999905f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.600000024f, 0.0f, 0.399999976f, 0.0f),
+	float4(0.360000014f, 0.239999995f, 0.239999995f, 0.159999982f), float4(0.120000035f, 0.479999989f, 0.0800000131f, 0.319999963f),
+	float4(0.480000138f, 0.119999893f, 0.320000052f, 0.0799999163f), float4(0.240000069f, 0.359999955f, 0.160000026f, 0.23999995f),
+	float4(0.600000024f, 0.0f, 0.399999976f, 0.0f), float4(0.200000048f, 0.0f, 0.799999952f, 0.0f),
+	float4(0.120000035f, 0.0800000131f, 0.479999989f, 0.319999963f), float4(0.0400000177f, 0.160000026f, 0.160000026f, 0.639999926f),
+	float4(0.160000071f, 0.039999973f, 0.640000105f, 0.159999833f), float4(0.0800000355f, 0.120000012f, 0.320000052f, 0.4799999f),
+	float4(0.200000048f, 0.0f, 0.799999952f, 0.0f), float4(0.800000191f, 0.0f, 0.199999809f, 0.0f),
+	float4(0.480000138f, 0.320000052f, 0.119999893f, 0.0799999163f), float4(0.160000071f, 0.640000105f, 0.039999973f, 0.159999833f),
+	float4(0.640000284f, 0.159999892f, 0.159999892f, 0.0399999246f), float4(0.320000142f, 0.480000049f, 0.0799999461f, 0.119999863f),
+	float4(0.800000191f, 0.0f, 0.199999809f, 0.0f), float4(0.400000095f, 0.0f, 0.599999905f, 0.0f),
+	float4(0.240000069f, 0.160000026f, 0.359999955f, 0.23999995f), float4(0.0800000355f, 0.320000052f, 0.120000012f, 0.4799999f),
+	float4(0.320000142f, 0.0799999461f, 0.480000049f, 0.119999863f), float4(0.160000071f, 0.240000024f, 0.240000024f, 0.359999895f),
+	float4(0.400000095f, 0.0f, 0.599999905f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.600000024f, 0.399999976f, 0.0f, 0.0f), float4(0.200000048f, 0.799999952f, 0.0f, 0.0f),
+	float4(0.800000191f, 0.199999809f, 0.0f, 0.0f), float4(0.400000095f, 0.599999905f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f),
+};
+static const uint4 infill_idx_8x8[256] =
+{
+	uint4(0, 0, 0, 0), uint4(0, 1, 0, 0), uint4(0, 1, 0, 0), uint4(1, 2, 1, 1),
+	uint4(1, 2, 1, 1), uint4(2, 3, 2, 2), uint4(2, 3, 2, 2), uint4(3, 3, 3, 3),
+	uint4(0, 0, 4, 0), uint4(0, 1, 4, 5), uint4(0, 1, 4, 5), uint4(1, 2, 5, 6),
+	uint4(1, 2, 5, 6), uint4(2, 3, 6, 7), uint4(2, 3, 6, 7), uint4(3, 3, 7, 3),
+	uint4(0, 0, 4, 0), uint4(0, 1, 4, 5), uint4(0, 1, 4, 5), uint4(1, 2, 5, 6),
+	uint4(1, 2, 5, 6), uint4(2, 2, 6, 7), uint4(2, 3, 6, 7), uint4(3, 3, 7, 3),
+	uint4(4, 4, 8, 4), uint4(4, 5, 8, 9), uint4(4, 5, 8, 9), uint4(5, 6, 9, 10),
+	uint4(5, 6, 9, 10), uint4(6, 7, 10, 11), uint4(6, 7, 10, 11), uint4(7, 7, 11, 7),
+	uint4(4, 4, 8, 4), uint4(4, 5, 8, 9), uint4(4, 5, 8, 9), uint4(5, 6, 9, 10),
+	uint4(5, 6, 9, 10), uint4(6, 7, 10, 11), uint4(6, 7, 10, 11), uint4(7, 7, 11, 7),
+	uint4(8, 8, 12, 8), uint4(8, 9, 12, 13), uint4(8, 9, 8, 13), uint4(9, 10, 13, 14),
+	uint4(9, 10, 13, 14), uint4(10, 11, 14, 10), uint4(10, 11, 14, 15), uint4(11, 11, 15, 11),
+	uint4(8, 8, 12, 8), uint4(8, 9, 12, 13), uint4(8, 9, 12, 13), uint4(9, 10, 13, 14),
+	uint4(9, 10, 13, 14), uint4(10, 11, 14, 15), uint4(10, 11, 14, 15), uint4(11, 11, 15, 11),
+	uint4(12, 12, 12, 12), uint4(12, 13, 12, 12), uint4(12, 13, 12, 12), uint4(13, 14, 13, 13),
+	uint4(13, 14, 13, 13), uint4(14, 15, 14, 14), uint4(14, 15, 14, 14), uint4(15, 15, 15, 15),
+	uint4(0, 0, 0, 0), uint4(0, 1, 0, 0), uint4(1, 2, 1, 1), uint4(1, 2, 1, 1),
+	uint4(2, 3, 2, 2), uint4(2, 3, 2, 2), uint4(3, 4, 3, 3), uint4(4, 4, 4, 4),
+	uint4(0, 0, 5, 0), uint4(0, 1, 5, 6), uint4(1, 2, 6, 7), uint4(1, 2, 6, 7),
+	uint4(2, 3, 7, 8), uint4(2, 3, 7, 8), uint4(3, 4, 8, 9), uint4(4, 4, 9, 4),
+	uint4(5, 5, 10, 5), uint4(5, 6, 10, 11), uint4(6, 7, 11, 6), uint4(6, 7, 11, 12),
+	uint4(7, 8, 12, 13), uint4(7, 8, 7, 13), uint4(8, 9, 13, 14), uint4(9, 9, 14, 9),
+	uint4(5, 5, 10, 5), uint4(5, 6, 10, 11), uint4(6, 7, 11, 12), uint4(6, 7, 11, 12),
+	uint4(7, 8, 12, 13), uint4(7, 8, 12, 13), uint4(8, 9, 13, 14), uint4(9, 9, 14, 9),
+	uint4(10, 10, 15, 10), uint4(10, 11, 15, 16), uint4(11, 12, 16, 17), uint4(11, 12, 16, 17),
+	uint4(12, 13, 17, 18), uint4(12, 13, 17, 18), uint4(13, 14, 18, 19), uint4(14, 14, 19, 14),
+	uint4(10, 10, 15, 10), uint4(10, 11, 15, 16), uint4(11, 11, 16, 17), uint4(11, 12, 16, 17),
+	uint4(12, 13, 17, 18), uint4(12, 13, 17, 18), uint4(13, 14, 18, 19), uint4(14, 14, 19, 14),
+	uint4(15, 15, 20, 15), uint4(15, 16, 20, 21), uint4(16, 17, 21, 22), uint4(16, 17, 21, 22),
+	uint4(17, 18, 22, 23), uint4(17, 18, 22, 23), uint4(18, 19, 23, 24), uint4(19, 19, 24, 19),
+	uint4(20, 20, 20, 20), uint4(20, 21, 20, 20), uint4(21, 22, 21, 21), uint4(21, 22, 21, 21),
+	uint4(22, 23, 22, 22), uint4(22, 23, 22, 22), uint4(23, 24, 23, 23), uint4(24, 24, 24, 24),
+	uint4(0, 0, 0, 0), uint4(0, 1, 0, 0), uint4(1, 2, 1, 1), uint4(2, 3, 2, 2),
+	uint4(2, 3, 2, 2), uint4(3, 4, 3, 3), uint4(4, 5, 4, 4), uint4(5, 5, 5, 5),
+	uint4(0, 0, 6, 0), uint4(0, 1, 6, 7), uint4(1, 2, 7, 8), uint4(2, 3, 8, 9),
+	uint4(2, 3, 8, 9), uint4(3, 4, 9, 10), uint4(4, 5, 10, 11), uint4(5, 5, 11, 5),
+	uint4(6, 6, 12, 6), uint4(6, 7, 12, 13), uint4(7, 8, 13, 14), uint4(8, 9, 14, 15),
+	uint4(8, 9, 14, 15), uint4(9, 10, 15, 16), uint4(10, 11, 16, 17), uint4(11, 11, 17, 11),
+	uint4(12, 12, 18, 12), uint4(12, 13, 18, 19), uint4(13, 14, 19, 20), uint4(14, 15, 20, 14),
+	uint4(14, 15, 14, 21), uint4(15, 16, 21, 22), uint4(16, 17, 22, 23), uint4(17, 17, 23, 17),
+	uint4(12, 12, 18, 12), uint4(12, 13, 18, 19), uint4(13, 14, 19, 20), uint4(14, 14, 20, 21),
+	uint4(14, 15, 20, 21), uint4(15, 16, 21, 22), uint4(16, 16, 22, 23), uint4(17, 17, 23, 17),
+	uint4(18, 18, 24, 18), uint4(18, 19, 24, 25), uint4(19, 20, 25, 26), uint4(20, 21, 26, 27),
+	uint4(20, 21, 26, 27), uint4(21, 22, 27, 28), uint4(22, 23, 28, 29), uint4(23, 23, 29, 23),
+	uint4(24, 24, 30, 24), uint4(24, 25, 30, 31), uint4(25, 26, 31, 32), uint4(26, 27, 32, 33),
+	uint4(26, 27, 26, 33), uint4(27, 28, 33, 34), uint4(28, 29, 34, 35), uint4(29, 29, 35, 29),
+	uint4(30, 30, 30, 30), uint4(30, 31, 30, 30), uint4(31, 32, 31, 31), uint4(32, 33, 32, 32),
+	uint4(32, 33, 32, 32), uint4(33, 34, 33, 33), uint4(34, 35, 34, 34), uint4(35, 35, 35, 35),
+	uint4(0, 0, 0, 0), uint4(1, 1, 1, 1), uint4(2, 2, 2, 2), uint4(3, 3, 3, 3),
+	uint4(4, 4, 4, 4), uint4(5, 5, 5, 5), uint4(6, 6, 6, 6), uint4(7, 7, 7, 7),
+	uint4(8, 8, 8, 8), uint4(9, 9, 9, 9), uint4(10, 10, 10, 10), uint4(11, 11, 11, 11),
+	uint4(12, 12, 12, 12), uint4(13, 13, 13, 13), uint4(14, 14, 14, 14), uint4(15, 15, 15, 15),
+	uint4(16, 16, 16, 16), uint4(17, 17, 17, 17), uint4(18, 18, 18, 18), uint4(19, 19, 19, 19),
+	uint4(20, 20, 20, 20), uint4(21, 21, 21, 21), uint4(22, 22, 22, 22), uint4(23, 23, 23, 23),
+	uint4(24, 24, 24, 24), uint4(25, 25, 25, 25), uint4(26, 26, 26, 26), uint4(27, 27, 27, 27),
+	uint4(28, 28, 28, 28), uint4(29, 29, 29, 29), uint4(30, 30, 30, 30), uint4(31, 31, 31, 31),
+	uint4(32, 32, 32, 32), uint4(33, 33, 33, 33), uint4(34, 34, 34, 34), uint4(35, 35, 35, 35),
+	uint4(36, 36, 36, 36), uint4(37, 37, 37, 37), uint4(38, 38, 38, 38), uint4(39, 39, 39, 39),
+	uint4(40, 40, 40, 40), uint4(41, 41, 41, 41), uint4(42, 42, 42, 42), uint4(43, 43, 43, 43),
+	uint4(44, 44, 44, 44), uint4(45, 45, 45, 45), uint4(46, 46, 46, 46), uint4(47, 47, 47, 47),
+	uint4(48, 48, 48, 48), uint4(49, 49, 49, 49), uint4(50, 50, 50, 50), uint4(51, 51, 51, 51),
+	uint4(52, 52, 52, 52), uint4(53, 53, 53, 53), uint4(54, 54, 54, 54), uint4(55, 55, 55, 55),
+	uint4(56, 56, 56, 56), uint4(57, 57, 57, 57), uint4(58, 58, 58, 58), uint4(59, 59, 59, 59),
+	uint4(60, 60, 60, 60), uint4(61, 61, 61, 61), uint4(62, 62, 62, 62), uint4(63, 63, 63, 63),
+};
+static const float4 infill_wt_8x8[256] =
+{
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.5625f, 0.4375f, 0.0f, 0.0f), float4(0.125f, 0.875f, 0.0f, 0.0f), float4(0.6875f, 0.3125f, 0.0f, 0.0f),
+	float4(0.3125f, 0.6875f, 0.0f, 0.0f), float4(0.875f, 0.125f, 0.0f, 0.0f), float4(0.4375f, 0.5625f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.5625f, 0.0f, 0.4375f, 0.0f), float4(0.3125f, 0.25f, 0.25f, 0.1875f), float4(0.0625f, 0.5f, 0.0625f, 0.375f), float4(0.375f, 0.1875f, 0.3125f, 0.125f),
+	float4(0.1875f, 0.375f, 0.125f, 0.3125f), float4(0.5f, 0.0625f, 0.375f, 0.0625f), float4(0.25f, 0.3125f, 0.1875f, 0.25f), float4(0.5625f, 0.0f, 0.4375f, 0.0f),
+	float4(0.125f, 0.0f, 0.875f, 0.0f), float4(0.0625f, 0.0625f, 0.5f, 0.375f), float4(0.0f, 0.125f, 0.125f, 0.75f), float4(0.0625f, 0.0625f, 0.625f, 0.25f),
+	float4(0.0625f, 0.0625f, 0.25f, 0.625f), float4(0.125f, 0.0f, 0.75f, 0.125f), float4(0.0625f, 0.0625f, 0.375f, 0.5f), float4(0.125f, 0.0f, 0.875f, 0.0f),
+	float4(0.6875f, 0.0f, 0.3125f, 0.0f), float4(0.375f, 0.3125f, 0.1875f, 0.125f), float4(0.0625f, 0.625f, 0.0625f, 0.25f), float4(0.5f, 0.1875f, 0.1875f, 0.125f),
+	float4(0.1875f, 0.5f, 0.125f, 0.1875f), float4(0.625f, 0.0625f, 0.25f, 0.0625f), float4(0.3125f, 0.375f, 0.125f, 0.1875f), float4(0.6875f, 0.0f, 0.3125f, 0.0f),
+	float4(0.3125f, 0.0f, 0.6875f, 0.0f), float4(0.1875f, 0.125f, 0.375f, 0.3125f), float4(0.0625f, 0.25f, 0.0625f, 0.625f), float4(0.1875f, 0.125f, 0.5f, 0.1875f),
+	float4(0.125f, 0.1875f, 0.1875f, 0.5f), float4(0.25f, 0.0625f, 0.625f, 0.0625f), float4(0.125f, 0.1875f, 0.3125f, 0.375f), float4(0.3125f, 0.0f, 0.6875f, 0.0f),
+	float4(0.875f, 0.0f, 0.125f, 0.0f), float4(0.5f, 0.375f, 0.0625f, 0.0625f), float4(0.125f, 0.75f, 0.0f, 0.125f), float4(0.625f, 0.25f, 0.0625f, 0.0625f),
+	float4(0.25f, 0.625f, 0.0625f, 0.0625f), float4(0.75f, 0.125f, 0.125f, 0.0f), float4(0.375f, 0.5f, 0.0625f, 0.0625f), float4(0.875f, 0.0f, 0.125f, 0.0f),
+	float4(0.4375f, 0.0f, 0.5625f, 0.0f), float4(0.25f, 0.1875f, 0.3125f, 0.25f), float4(0.0625f, 0.375f, 0.0625f, 0.5f), float4(0.3125f, 0.125f, 0.375f, 0.1875f),
+	float4(0.125f, 0.3125f, 0.1875f, 0.375f), float4(0.375f, 0.0625f, 0.5f, 0.0625f), float4(0.1875f, 0.25f, 0.25f, 0.3125f), float4(0.4375f, 0.0f, 0.5625f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.5625f, 0.4375f, 0.0f, 0.0f), float4(0.125f, 0.875f, 0.0f, 0.0f), float4(0.6875f, 0.3125f, 0.0f, 0.0f),
+	float4(0.3125f, 0.6875f, 0.0f, 0.0f), float4(0.875f, 0.125f, 0.0f, 0.0f), float4(0.4375f, 0.5625f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.4375f, 0.5625f, 0.0f, 0.0f), float4(0.875f, 0.125f, 0.0f, 0.0f), float4(0.3125f, 0.6875f, 0.0f, 0.0f),
+	float4(0.6875f, 0.3125f, 0.0f, 0.0f), float4(0.125f, 0.875f, 0.0f, 0.0f), float4(0.5625f, 0.4375f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.4375f, 0.0f, 0.5625f, 0.0f), float4(0.1875f, 0.25f, 0.25f, 0.3125f), float4(0.375f, 0.0625f, 0.5f, 0.0625f), float4(0.125f, 0.3125f, 0.1875f, 0.375f),
+	float4(0.3125f, 0.125f, 0.375f, 0.1875f), float4(0.0625f, 0.375f, 0.0625f, 0.5f), float4(0.25f, 0.1875f, 0.3125f, 0.25f), float4(0.4375f, 0.0f, 0.5625f, 0.0f),
+	float4(0.875f, 0.0f, 0.125f, 0.0f), float4(0.375f, 0.5f, 0.0625f, 0.0625f), float4(0.75f, 0.125f, 0.125f, 0.0f), float4(0.25f, 0.625f, 0.0625f, 0.0625f),
+	float4(0.625f, 0.25f, 0.0625f, 0.0625f), float4(0.125f, 0.75f, 0.0f, 0.125f), float4(0.5f, 0.375f, 0.0625f, 0.0625f), float4(0.875f, 0.0f, 0.125f, 0.0f),
+	float4(0.3125f, 0.0f, 0.6875f, 0.0f), float4(0.125f, 0.1875f, 0.3125f, 0.375f), float4(0.25f, 0.0625f, 0.625f, 0.0625f), float4(0.125f, 0.1875f, 0.1875f, 0.5f),
+	float4(0.1875f, 0.125f, 0.5f, 0.1875f), float4(0.0625f, 0.25f, 0.0625f, 0.625f), float4(0.1875f, 0.125f, 0.375f, 0.3125f), float4(0.3125f, 0.0f, 0.6875f, 0.0f),
+	float4(0.6875f, 0.0f, 0.3125f, 0.0f), float4(0.3125f, 0.375f, 0.125f, 0.1875f), float4(0.625f, 0.0625f, 0.25f, 0.0625f), float4(0.1875f, 0.5f, 0.125f, 0.1875f),
+	float4(0.5f, 0.1875f, 0.1875f, 0.125f), float4(0.0625f, 0.625f, 0.0625f, 0.25f), float4(0.375f, 0.3125f, 0.1875f, 0.125f), float4(0.6875f, 0.0f, 0.3125f, 0.0f),
+	float4(0.125f, 0.0f, 0.875f, 0.0f), float4(0.0625f, 0.0625f, 0.375f, 0.5f), float4(0.125f, 0.0f, 0.75f, 0.125f), float4(0.0625f, 0.0625f, 0.25f, 0.625f),
+	float4(0.0625f, 0.0625f, 0.625f, 0.25f), float4(0.0f, 0.125f, 0.125f, 0.75f), float4(0.0625f, 0.0625f, 0.5f, 0.375f), float4(0.125f, 0.0f, 0.875f, 0.0f),
+	float4(0.5625f, 0.0f, 0.4375f, 0.0f), float4(0.25f, 0.3125f, 0.1875f, 0.25f), float4(0.5f, 0.0625f, 0.375f, 0.0625f), float4(0.1875f, 0.375f, 0.125f, 0.3125f),
+	float4(0.375f, 0.1875f, 0.3125f, 0.125f), float4(0.0625f, 0.5f, 0.0625f, 0.375f), float4(0.3125f, 0.25f, 0.25f, 0.1875f), float4(0.5625f, 0.0f, 0.4375f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.4375f, 0.5625f, 0.0f, 0.0f), float4(0.875f, 0.125f, 0.0f, 0.0f), float4(0.3125f, 0.6875f, 0.0f, 0.0f),
+	float4(0.6875f, 0.3125f, 0.0f, 0.0f), float4(0.125f, 0.875f, 0.0f, 0.0f), float4(0.5625f, 0.4375f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.3125f, 0.6875f, 0.0f, 0.0f), float4(0.5625f, 0.4375f, 0.0f, 0.0f), float4(0.875f, 0.125f, 0.0f, 0.0f),
+	float4(0.125f, 0.875f, 0.0f, 0.0f), float4(0.4375f, 0.5625f, 0.0f, 0.0f), float4(0.75f, 0.25f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.3125f, 0.0f, 0.6875f, 0.0f), float4(0.125f, 0.1875f, 0.1875f, 0.5f), float4(0.1875f, 0.125f, 0.375f, 0.3125f), float4(0.25f, 0.0625f, 0.625f, 0.0625f),
+	float4(0.0625f, 0.25f, 0.0625f, 0.625f), float4(0.125f, 0.1875f, 0.3125f, 0.375f), float4(0.25f, 0.0625f, 0.5f, 0.1875f), float4(0.3125f, 0.0f, 0.6875f, 0.0f),
+	float4(0.5625f, 0.0f, 0.4375f, 0.0f), float4(0.1875f, 0.375f, 0.125f, 0.3125f), float4(0.3125f, 0.25f, 0.25f, 0.1875f), float4(0.5f, 0.0625f, 0.375f, 0.0625f),
+	float4(0.0625f, 0.5f, 0.0625f, 0.375f), float4(0.25f, 0.3125f, 0.1875f, 0.25f), float4(0.4375f, 0.125f, 0.3125f, 0.125f), float4(0.5625f, 0.0f, 0.4375f, 0.0f),
+	float4(0.875f, 0.0f, 0.125f, 0.0f), float4(0.25f, 0.625f, 0.0625f, 0.0625f), float4(0.5f, 0.375f, 0.0625f, 0.0625f), float4(0.75f, 0.125f, 0.125f, 0.0f),
+	float4(0.125f, 0.75f, 0.0f, 0.125f), float4(0.375f, 0.5f, 0.0625f, 0.0625f), float4(0.6875f, 0.1875f, 0.0625f, 0.0625f), float4(0.875f, 0.0f, 0.125f, 0.0f),
+	float4(0.125f, 0.0f, 0.875f, 0.0f), float4(0.0625f, 0.0625f, 0.25f, 0.625f), float4(0.0625f, 0.0625f, 0.5f, 0.375f), float4(0.125f, 0.0f, 0.75f, 0.125f),
+	float4(0.0f, 0.125f, 0.125f, 0.75f), float4(0.0625f, 0.0625f, 0.375f, 0.5f), float4(0.125f, 0.0f, 0.625f, 0.25f), float4(0.125f, 0.0f, 0.875f, 0.0f),
+	float4(0.4375f, 0.0f, 0.5625f, 0.0f), float4(0.125f, 0.3125f, 0.1875f, 0.375f), float4(0.25f, 0.1875f, 0.3125f, 0.25f), float4(0.375f, 0.0625f, 0.5f, 0.0625f),
+	float4(0.0625f, 0.375f, 0.0625f, 0.5f), float4(0.1875f, 0.25f, 0.25f, 0.3125f), float4(0.3125f, 0.125f, 0.4375f, 0.125f), float4(0.4375f, 0.0f, 0.5625f, 0.0f),
+	float4(0.75f, 0.0f, 0.25f, 0.0f), float4(0.25f, 0.5f, 0.0625f, 0.1875f), float4(0.4375f, 0.3125f, 0.125f, 0.125f), float4(0.6875f, 0.0625f, 0.1875f, 0.0625f),
+	float4(0.125f, 0.625f, 0.0f, 0.25f), float4(0.3125f, 0.4375f, 0.125f, 0.125f), float4(0.5625f, 0.1875f, 0.1875f, 0.0625f), float4(0.75f, 0.0f, 0.25f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.3125f, 0.6875f, 0.0f, 0.0f), float4(0.5625f, 0.4375f, 0.0f, 0.0f), float4(0.875f, 0.125f, 0.0f, 0.0f),
+	float4(0.125f, 0.875f, 0.0f, 0.0f), float4(0.4375f, 0.5625f, 0.0f, 0.0f), float4(0.75f, 0.25f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+};
+static const uint4 pseudo_inverse_idx_8x8[564] =
+{
+	uint4(0, 1, 2, 3), uint4(5, 8, 9, 10), uint4(11, 13, 16, 17), uint4(24, 25, 40, 41),
+	uint4(0, 1, 2, 3), uint4(4, 5, 6, 7), uint4(8, 9, 10, 11), uint4(13, 19, 26, 27),
+	uint4(0, 1, 2, 3), uint4(4, 5, 6, 7), uint4(10, 12, 13, 14), uint4(15, 20, 28, 29),
+	uint4(2, 4, 5, 6), uint4(7, 10, 12, 13), uint4(14, 15, 22, 23), uint4(30, 31, 46, 47),
+	uint4(0, 1, 8, 9), uint4(16, 17, 19, 24), uint4(25, 26, 27, 32), uint4(40, 41, 48, 56),
+	uint4(2, 3, 10, 11), uint4(16, 17, 18, 19), uint4(21, 24, 25, 26), uint4(27, 29, 42, 43),
+	uint4(4, 5, 12, 13), uint4(18, 20, 21, 22), uint4(23, 26, 28, 29), uint4(30, 31, 44, 45),
+	uint4(6, 7, 14, 15), uint4(20, 22, 23, 28), uint4(29, 30, 31, 39), uint4(46, 47, 55, 63),
+	uint4(0, 8, 16, 17), uint4(24, 32, 33, 34), uint4(35, 40, 41, 43), uint4(48, 49, 56, 57),
+	uint4(18, 19, 32, 33), uint4(34, 35, 37, 40), uint4(41, 42, 43, 45), uint4(50, 51, 58, 59),
+	uint4(20, 21, 34, 36), uint4(37, 38, 39, 42), uint4(44, 45, 46, 47), uint4(52, 53, 60, 61),
+	uint4(7, 15, 22, 23), uint4(31, 36, 37, 38), uint4(39, 44, 46, 47), uint4(54, 55, 62, 63),
+	uint4(16, 17, 32, 33), uint4(40, 41, 48, 49), uint4(50, 51, 53, 56), uint4(57, 58, 59, 61),
+	uint4(34, 35, 43, 48), uint4(49, 50, 51, 53), uint4(56, 57, 58, 59), uint4(60, 61, 62, 63),
+	uint4(36, 37, 44, 50), uint4(52, 53, 54, 55), uint4(56, 57, 58, 59), uint4(60, 61, 62, 63),
+	uint4(22, 23, 38, 39), uint4(46, 47, 50, 52), uint4(53, 54, 55, 58), uint4(60, 61, 62, 63),
+	uint4(0, 1, 2, 3), uint4(4, 8, 9, 10), uint4(12, 16, 17, 18), uint4(20, 24, 32, 33),
+	uint4(0, 1, 2, 3), uint4(4, 5, 6, 8), uint4(9, 10, 12, 16), uint4(17, 18, 20, 34),
+	uint4(0, 1, 2, 3), uint4(4, 5, 6, 7), uint4(9, 10, 11, 12), uint4(13, 14, 19, 20),
+	uint4(1, 2, 3, 4), uint4(5, 6, 7, 11), uint4(13, 14, 15, 19), uint4(21, 22, 23, 37),
+	uint4(3, 4, 5, 6), uint4(7, 11, 13, 14), uint4(15, 19, 21, 22), uint4(23, 31, 38, 39),
+	uint4(0, 1, 2, 8), uint4(9, 10, 16, 17), uint4(18, 20, 24, 32), uint4(33, 34, 40, 48),
+	uint4(0, 1, 2, 8), uint4(9, 10, 11, 12), uint4(16, 17, 18, 20), uint4(22, 25, 33, 34),
+	uint4(3, 4, 9, 10), uint4(11, 12, 13, 14), uint4(17, 18, 19, 20), uint4(21, 22, 35, 36),
+	uint4(5, 6, 7, 11), uint4(12, 13, 14, 15), uint4(17, 19, 21, 22), uint4(23, 30, 37, 38),
+	uint4(5, 6, 7, 13), uint4(14, 15, 19, 21), uint4(22, 23, 31, 37), uint4(38, 39, 47, 55),
+	uint4(0, 8, 9, 16), uint4(17, 24, 25, 26), uint4(32, 33, 34, 40), uint4(41, 48, 49, 56),
+	uint4(9, 10, 17, 18), uint4(24, 25, 26, 28), uint4(32, 33, 34, 36), uint4(41, 42, 49, 50),
+	uint4(19, 20, 26, 27), uint4(28, 29, 30, 34), uint4(35, 36, 37, 38), uint4(43, 44, 51, 52),
+	uint4(13, 14, 21, 22), uint4(27, 29, 30, 31), uint4(35, 37, 38, 39), uint4(45, 46, 53, 54),
+	uint4(7, 14, 15, 22), uint4(23, 29, 30, 31), uint4(37, 38, 39, 46), uint4(47, 54, 55, 63),
+	uint4(8, 16, 24, 25), uint4(26, 32, 40, 41), uint4(42, 44, 48, 49), uint4(50, 56, 57, 58),
+	uint4(25, 26, 33, 40), uint4(41, 42, 44, 46), uint4(48, 49, 50, 51), uint4(52, 56, 57, 58),
+	uint4(27, 28, 41, 42), uint4(43, 44, 45, 46), uint4(49, 50, 51, 52), uint4(53, 54, 59, 60),
+	uint4(13, 29, 30, 38), uint4(43, 45, 46, 47), uint4(51, 52, 53, 54), uint4(55, 61, 62, 63),
+	uint4(15, 23, 29, 30), uint4(31, 39, 43, 45), uint4(46, 47, 53, 54), uint4(55, 61, 62, 63),
+	uint4(24, 25, 26, 32), uint4(40, 41, 42, 48), uint4(49, 50, 52, 56), uint4(57, 58, 59, 60),
+	uint4(26, 40, 41, 42), uint4(44, 48, 49, 50), uint4(52, 56, 57, 58), uint4(59, 60, 61, 62),
+	uint4(43, 44, 49, 50), uint4(51, 52, 53, 54), uint4(56, 57, 58, 59), uint4(60, 61, 62, 63),
+	uint4(29, 43, 45, 46), uint4(47, 51, 53, 54), uint4(55, 57, 58, 59), uint4(60, 61, 62, 63),
+	uint4(29, 30, 31, 39), uint4(45, 46, 47, 51), uint4(53, 54, 55, 59), uint4(60, 61, 62, 63),
+	uint4(0, 1, 2, 3), uint4(4, 8, 9, 10), uint4(11, 16, 17, 18), uint4(24, 25, 32, 40),
+	uint4(0, 1, 2, 3), uint4(4, 5, 8, 9), uint4(10, 11, 16, 17), uint4(18, 19, 25, 26),
+	uint4(0, 1, 2, 3), uint4(4, 5, 6, 7), uint4(9, 10, 11, 17), uint4(18, 19, 26, 27),
+	uint4(0, 1, 2, 3), uint4(4, 5, 6, 7), uint4(12, 13, 14, 20), uint4(21, 22, 28, 29),
+	uint4(2, 3, 4, 5), uint4(6, 7, 12, 13), uint4(14, 15, 20, 21), uint4(22, 23, 29, 30),
+	uint4(3, 4, 5, 6), uint4(7, 13, 14, 15), uint4(20, 21, 23, 29), uint4(31, 39, 47, 55),
+	uint4(0, 1, 2, 8), uint4(9, 10, 11, 16), uint4(17, 18, 19, 24), uint4(25, 26, 32, 40),
+	uint4(0, 1, 2, 3), uint4(8, 9, 10, 11), uint4(16, 17, 18, 19), uint4(24, 25, 26, 27),
+	uint4(1, 2, 3, 8), uint4(9, 10, 11, 12), uint4(13, 16, 17, 18), uint4(19, 25, 26, 27),
+	uint4(4, 5, 6, 9), uint4(10, 11, 12, 13), uint4(14, 15, 20, 21), uint4(22, 28, 29, 30),
+	uint4(4, 5, 6, 7), uint4(12, 13, 14, 15), uint4(20, 21, 22, 23), uint4(28, 29, 30, 31),
+	uint4(5, 6, 7, 12), uint4(13, 14, 15, 20), uint4(21, 23, 28, 29), uint4(31, 39, 47, 55),
+	uint4(0, 8, 9, 10), uint4(16, 17, 18, 19), uint4(24, 25, 26, 27), uint4(32, 40, 48, 56),
+	uint4(1, 2, 8, 9), uint4(10, 11, 16, 17), uint4(18, 19, 24, 25), uint4(26, 27, 33, 41),
+	uint4(3, 10, 11, 17), uint4(18, 19, 24, 25), uint4(26, 27, 28, 29), uint4(30, 35, 43, 51),
+	uint4(4, 12, 13, 20), uint4(21, 22, 25, 26), uint4(27, 28, 29, 30), uint4(31, 36, 44, 52),
+	uint4(6, 12, 13, 14), uint4(15, 20, 21, 22), uint4(23, 28, 29, 30), uint4(31, 37, 46, 54),
+	uint4(7, 14, 15, 21), uint4(22, 23, 28, 29), uint4(30, 31, 36, 37), uint4(38, 39, 47, 55),
+	uint4(0, 8, 16, 24), uint4(32, 33, 34, 35), uint4(40, 41, 42, 43), uint4(48, 49, 50, 56),
+	uint4(9, 17, 25, 32), uint4(33, 34, 35, 40), uint4(41, 42, 43, 48), uint4(49, 50, 51, 57),
+	uint4(11, 19, 27, 32), uint4(33, 34, 35, 36), uint4(37, 38, 41, 42), uint4(43, 50, 51, 59),
+	uint4(12, 20, 28, 33), uint4(34, 35, 36, 37), uint4(38, 39, 44, 45), uint4(46, 52, 53, 60),
+	uint4(29, 30, 31, 36), uint4(37, 38, 39, 44), uint4(45, 46, 47, 52), uint4(53, 54, 55, 62),
+	uint4(15, 22, 23, 31), uint4(36, 37, 38, 39), uint4(44, 45, 46, 47), uint4(53, 54, 55, 63),
+	uint4(16, 24, 32, 33), uint4(34, 40, 41, 42), uint4(43, 48, 49, 50), uint4(51, 56, 57, 58),
+	uint4(32, 33, 34, 35), uint4(40, 41, 42, 43), uint4(48, 49, 50, 51), uint4(56, 57, 58, 59),
+	uint4(33, 34, 35, 41), uint4(42, 43, 44, 48), uint4(49, 50, 51, 53), uint4(54, 57, 58, 59),
+	uint4(36, 37, 38, 43), uint4(44, 45, 46, 51), uint4(52, 53, 54, 55), uint4(59, 60, 61, 62),
+	uint4(36, 37, 38, 39), uint4(44, 45, 46, 47), uint4(52, 53, 54, 55), uint4(60, 61, 62, 63),
+	uint4(23, 31, 36, 37), uint4(38, 39, 44, 45), uint4(46, 47, 52, 53), uint4(54, 55, 61, 63),
+	uint4(24, 32, 34, 40), uint4(41, 42, 43, 48), uint4(49, 56, 57, 58), uint4(59, 60, 61, 62),
+	uint4(33, 34, 35, 40), uint4(41, 42, 43, 48), uint4(49, 56, 57, 58), uint4(59, 60, 61, 62),
+	uint4(35, 36, 42, 43), uint4(44, 49, 50, 51), uint4(52, 56, 57, 58), uint4(59, 60, 61, 62),
+	uint4(36, 37, 44, 45), uint4(46, 50, 52, 53), uint4(54, 57, 58, 59), uint4(60, 61, 62, 63),
+	uint4(36, 37, 38, 44), uint4(45, 46, 47, 52), uint4(53, 54, 58, 59), uint4(60, 61, 62, 63),
+	uint4(31, 37, 38, 39), uint4(44, 45, 46, 47), uint4(52, 53, 55, 59), uint4(60, 61, 62, 63),
+	uint4(0, 0, 0, 0), uint4(0, 0, 0, 0), uint4(0, 0, 0, 0), uint4(0, 0, 0, 0),
+	uint4(1, 1, 1, 1), uint4(1, 1, 1, 1), uint4(1, 1, 1, 1), uint4(1, 1, 1, 1),
+	uint4(2, 2, 2, 2), uint4(2, 2, 2, 2), uint4(2, 2, 2, 2), uint4(2, 2, 2, 2),
+	uint4(3, 3, 3, 3), uint4(3, 3, 3, 3), uint4(3, 3, 3, 3), uint4(3, 3, 3, 3),
+	uint4(4, 4, 4, 4), uint4(4, 4, 4, 4), uint4(4, 4, 4, 4), uint4(4, 4, 4, 4),
+	uint4(5, 5, 5, 5), uint4(5, 5, 5, 5), uint4(5, 5, 5, 5), uint4(5, 5, 5, 5),
+	uint4(6, 6, 6, 6), uint4(6, 6, 6, 6), uint4(6, 6, 6, 6), uint4(6, 6, 6, 6),
+	uint4(7, 7, 7, 7), uint4(7, 7, 7, 7), uint4(7, 7, 7, 7), uint4(7, 7, 7, 7),
+	uint4(8, 8, 8, 8), uint4(8, 8, 8, 8), uint4(8, 8, 8, 8), uint4(8, 8, 8, 8),
+	uint4(9, 9, 9, 9), uint4(9, 9, 9, 9), uint4(9, 9, 9, 9), uint4(9, 9, 9, 9),
+	uint4(10, 10, 10, 10), uint4(10, 10, 10, 10), uint4(10, 10, 10, 10), uint4(10, 10, 10, 10),
+	uint4(11, 11, 11, 11), uint4(11, 11, 11, 11), uint4(11, 11, 11, 11), uint4(11, 11, 11, 11),
+	uint4(12, 12, 12, 12), uint4(12, 12, 12, 12), uint4(12, 12, 12, 12), uint4(12, 12, 12, 12),
+	uint4(13, 13, 13, 13), uint4(13, 13, 13, 13), uint4(13, 13, 13, 13), uint4(13, 13, 13, 13),
+	uint4(14, 14, 14, 14), uint4(14, 14, 14, 14), uint4(14, 14, 14, 14), uint4(14, 14, 14, 14),
+	uint4(15, 15, 15, 15), uint4(15, 15, 15, 15), uint4(15, 15, 15, 15), uint4(15, 15, 15, 15),
+	uint4(16, 16, 16, 16), uint4(16, 16, 16, 16), uint4(16, 16, 16, 16), uint4(16, 16, 16, 16),
+	uint4(17, 17, 17, 17), uint4(17, 17, 17, 17), uint4(17, 17, 17, 17), uint4(17, 17, 17, 17),
+	uint4(18, 18, 18, 18), uint4(18, 18, 18, 18), uint4(18, 18, 18, 18), uint4(18, 18, 18, 18),
+	uint4(19, 19, 19, 19), uint4(19, 19, 19, 19), uint4(19, 19, 19, 19), uint4(19, 19, 19, 19),
+	uint4(20, 20, 20, 20), uint4(20, 20, 20, 20), uint4(20, 20, 20, 20), uint4(20, 20, 20, 20),
+	uint4(21, 21, 21, 21), uint4(21, 21, 21, 21), uint4(21, 21, 21, 21), uint4(21, 21, 21, 21),
+	uint4(22, 22, 22, 22), uint4(22, 22, 22, 22), uint4(22, 22, 22, 22), uint4(22, 22, 22, 22),
+	uint4(23, 23, 23, 23), uint4(23, 23, 23, 23), uint4(23, 23, 23, 23), uint4(23, 23, 23, 23),
+	uint4(24, 24, 24, 24), uint4(24, 24, 24, 24), uint4(24, 24, 24, 24), uint4(24, 24, 24, 24),
+	uint4(25, 25, 25, 25), uint4(25, 25, 25, 25), uint4(25, 25, 25, 25), uint4(25, 25, 25, 25),
+	uint4(26, 26, 26, 26), uint4(26, 26, 26, 26), uint4(26, 26, 26, 26), uint4(26, 26, 26, 26),
+	uint4(27, 27, 27, 27), uint4(27, 27, 27, 27), uint4(27, 27, 27, 27), uint4(27, 27, 27, 27),
+	uint4(28, 28, 28, 28), uint4(28, 28, 28, 28), uint4(28, 28, 28, 28), uint4(28, 28, 28, 28),
+	uint4(29, 29, 29, 29), uint4(29, 29, 29, 29), uint4(29, 29, 29, 29), uint4(29, 29, 29, 29),
+	uint4(30, 30, 30, 30), uint4(30, 30, 30, 30), uint4(30, 30, 30, 30), uint4(30, 30, 30, 30),
+	uint4(31, 31, 31, 31), uint4(31, 31, 31, 31), uint4(31, 31, 31, 31), uint4(31, 31, 31, 31),
+	uint4(32, 32, 32, 32), uint4(32, 32, 32, 32), uint4(32, 32, 32, 32), uint4(32, 32, 32, 32),
+	uint4(33, 33, 33, 33), uint4(33, 33, 33, 33), uint4(33, 33, 33, 33), uint4(33, 33, 33, 33),
+	uint4(34, 34, 34, 34), uint4(34, 34, 34, 34), uint4(34, 34, 34, 34), uint4(34, 34, 34, 34),
+	uint4(35, 35, 35, 35), uint4(35, 35, 35, 35), uint4(35, 35, 35, 35), uint4(35, 35, 35, 35),
+	uint4(36, 36, 36, 36), uint4(36, 36, 36, 36), uint4(36, 36, 36, 36), uint4(36, 36, 36, 36),
+	uint4(37, 37, 37, 37), uint4(37, 37, 37, 37), uint4(37, 37, 37, 37), uint4(37, 37, 37, 37),
+	uint4(38, 38, 38, 38), uint4(38, 38, 38, 38), uint4(38, 38, 38, 38), uint4(38, 38, 38, 38),
+	uint4(39, 39, 39, 39), uint4(39, 39, 39, 39), uint4(39, 39, 39, 39), uint4(39, 39, 39, 39),
+	uint4(40, 40, 40, 40), uint4(40, 40, 40, 40), uint4(40, 40, 40, 40), uint4(40, 40, 40, 40),
+	uint4(41, 41, 41, 41), uint4(41, 41, 41, 41), uint4(41, 41, 41, 41), uint4(41, 41, 41, 41),
+	uint4(42, 42, 42, 42), uint4(42, 42, 42, 42), uint4(42, 42, 42, 42), uint4(42, 42, 42, 42),
+	uint4(43, 43, 43, 43), uint4(43, 43, 43, 43), uint4(43, 43, 43, 43), uint4(43, 43, 43, 43),
+	uint4(44, 44, 44, 44), uint4(44, 44, 44, 44), uint4(44, 44, 44, 44), uint4(44, 44, 44, 44),
+	uint4(45, 45, 45, 45), uint4(45, 45, 45, 45), uint4(45, 45, 45, 45), uint4(45, 45, 45, 45),
+	uint4(46, 46, 46, 46), uint4(46, 46, 46, 46), uint4(46, 46, 46, 46), uint4(46, 46, 46, 46),
+	uint4(47, 47, 47, 47), uint4(47, 47, 47, 47), uint4(47, 47, 47, 47), uint4(47, 47, 47, 47),
+	uint4(48, 48, 48, 48), uint4(48, 48, 48, 48), uint4(48, 48, 48, 48), uint4(48, 48, 48, 48),
+	uint4(49, 49, 49, 49), uint4(49, 49, 49, 49), uint4(49, 49, 49, 49), uint4(49, 49, 49, 49),
+	uint4(50, 50, 50, 50), uint4(50, 50, 50, 50), uint4(50, 50, 50, 50), uint4(50, 50, 50, 50),
+	uint4(51, 51, 51, 51), uint4(51, 51, 51, 51), uint4(51, 51, 51, 51), uint4(51, 51, 51, 51),
+	uint4(52, 52, 52, 52), uint4(52, 52, 52, 52), uint4(52, 52, 52, 52), uint4(52, 52, 52, 52),
+	uint4(53, 53, 53, 53), uint4(53, 53, 53, 53), uint4(53, 53, 53, 53), uint4(53, 53, 53, 53),
+	uint4(54, 54, 54, 54), uint4(54, 54, 54, 54), uint4(54, 54, 54, 54), uint4(54, 54, 54, 54),
+	uint4(55, 55, 55, 55), uint4(55, 55, 55, 55), uint4(55, 55, 55, 55), uint4(55, 55, 55, 55),
+	uint4(56, 56, 56, 56), uint4(56, 56, 56, 56), uint4(56, 56, 56, 56), uint4(56, 56, 56, 56),
+	uint4(57, 57, 57, 57), uint4(57, 57, 57, 57), uint4(57, 57, 57, 57), uint4(57, 57, 57, 57),
+	uint4(58, 58, 58, 58), uint4(58, 58, 58, 58), uint4(58, 58, 58, 58), uint4(58, 58, 58, 58),
+	uint4(59, 59, 59, 59), uint4(59, 59, 59, 59), uint4(59, 59, 59, 59), uint4(59, 59, 59, 59),
+	uint4(60, 60, 60, 60), uint4(60, 60, 60, 60), uint4(60, 60, 60, 60), uint4(60, 60, 60, 60),
+	uint4(61, 61, 61, 61), uint4(61, 61, 61, 61), uint4(61, 61, 61, 61), uint4(61, 61, 61, 61),
+	uint4(62, 62, 62, 62), uint4(62, 62, 62, 62), uint4(62, 62, 62, 62), uint4(62, 62, 62, 62),
+	uint4(63, 63, 63, 63), uint4(63, 63, 63, 63), uint4(63, 63, 63, 63), uint4(63, 63, 63, 63),
+};
+static const float4 pseudo_inverse_wt_8x8[564] =
+{
+	float4(0.648601f, 0.293619f, -0.061363f, -0.0967727f), float4(0.0407929f, 0.293619f, 0.129993f, -0.0336319f),
+	float4(-0.0389895f, 0.0190164f, -0.061363f, -0.0336319f), float4(-0.0967727f, -0.0389895f, 0.0407929f, 0.0190164f),
+	float4(-0.162786f, 0.1769f, 0.516586f, 0.364721f), float4(0.0660199f, -0.153978f, -0.0527605f, 0.0484574f),
+	float4(-0.0762643f, 0.0828681f, 0.242f, 0.153425f), float4(-0.0740922f, -0.0578715f, -0.0827696f, -0.0616452f),
+	float4(0.0484574f, -0.0527605f, -0.153978f, 0.0660199f), float4(0.364721f, 0.516586f, 0.1769f, -0.162786f),
+	float4(-0.0740922f, 0.153425f, 0.242f, 0.0828681f), float4(-0.0762643f, -0.0578715f, -0.0616452f, -0.0827696f),
+	float4(0.0407929f, -0.0967727f, -0.061363f, 0.293619f), float4(0.648601f, 0.0190164f, -0.0389895f, -0.0336319f),
+	float4(0.129993f, 0.293619f, -0.0336319f, -0.061363f), float4(-0.0389895f, -0.0967727f, 0.0190164f, 0.0407929f),
+	float4(-0.162786f, -0.0762643f, 0.1769f, 0.0828681f), float4(0.516586f, 0.242f, -0.0827696f, 0.364721f),
+	float4(0.153425f, -0.0578715f, -0.0616452f, 0.0660199f), float4(-0.153978f, -0.0740922f, -0.0527605f, 0.0484574f),
+	float4(-0.126806f, -0.0917832f, 0.130919f, 0.108986f), float4(-0.126806f, 0.130919f, 0.388645f, 0.309755f),
+	float4(-0.10597f, -0.0917832f, 0.108986f, 0.309755f), float4(0.23047f, -0.0863684f, -0.10597f, -0.0863684f),
+	float4(-0.0917832f, -0.126806f, 0.108986f, 0.130919f), float4(-0.10597f, 0.309755f, 0.388645f, 0.130919f),
+	float4(-0.126806f, -0.0863684f, 0.23047f, 0.309755f), float4(0.108986f, -0.0917832f, -0.0863684f, -0.10597f),
+	float4(-0.0762643f, -0.162786f, 0.0828681f, 0.1769f), float4(-0.0827696f, 0.242f, 0.516586f, -0.0616452f),
+	float4(-0.0578715f, 0.153425f, 0.364721f, 0.0660199f), float4(-0.0740922f, -0.153978f, -0.0527605f, 0.0484574f),
+	float4(0.0484574f, -0.0527605f, -0.153978f, -0.0740922f), float4(0.0660199f, 0.364721f, 0.153425f, -0.0578715f),
+	float4(-0.0616452f, 0.516586f, 0.242f, -0.0827696f), float4(0.1769f, 0.0828681f, -0.162786f, -0.0762643f),
+	float4(-0.10597f, -0.0863684f, -0.0917832f, 0.108986f), float4(0.309755f, 0.23047f, -0.0863684f, -0.126806f),
+	float4(0.130919f, 0.388645f, 0.309755f, -0.10597f), float4(0.130919f, 0.108986f, -0.126806f, -0.0917832f),
+	float4(-0.0863684f, -0.10597f, -0.0863684f, 0.23047f), float4(0.309755f, 0.108986f, -0.0917832f, -0.10597f),
+	float4(0.309755f, 0.388645f, 0.130919f, -0.126806f), float4(0.108986f, 0.130919f, -0.0917832f, -0.126806f),
+	float4(0.0484574f, -0.0527605f, -0.0740922f, -0.153978f), float4(0.0660199f, -0.0616452f, -0.0578715f, 0.153425f),
+	float4(0.364721f, -0.0827696f, 0.242f, 0.516586f), float4(0.0828681f, 0.1769f, -0.0762643f, -0.162786f),
+	float4(0.0407929f, 0.0190164f, -0.0967727f, -0.0389895f), float4(-0.061363f, -0.0336319f, 0.293619f, 0.129993f),
+	float4(-0.0336319f, -0.0389895f, 0.0190164f, 0.648601f), float4(0.293619f, -0.061363f, -0.0967727f, 0.0407929f),
+	float4(-0.0827696f, -0.0616452f, -0.0578715f, -0.0762643f), float4(0.0828681f, 0.242f, 0.153425f, -0.0740922f),
+	float4(-0.162786f, 0.1769f, 0.516586f, 0.364721f), float4(0.0660199f, -0.153978f, -0.0527605f, 0.0484574f),
+	float4(-0.0616452f, -0.0827696f, -0.0578715f, -0.0740922f), float4(0.153425f, 0.242f, 0.0828681f, -0.0762643f),
+	float4(0.0484574f, -0.0527605f, -0.153978f, 0.0660199f), float4(0.364721f, 0.516586f, 0.1769f, -0.162786f),
+	float4(0.0190164f, 0.0407929f, -0.0389895f, -0.0967727f), float4(-0.0336319f, -0.061363f, 0.0190164f, -0.0389895f),
+	float4(-0.0336319f, 0.129993f, 0.293619f, 0.0407929f), float4(-0.0967727f, -0.061363f, 0.293619f, 0.648601f),
+	float4(0.778316f, 0.238573f, -0.150407f, -0.0117129f), float4(0.0390145f, 0.238573f, 0.0689767f, -0.0430578f),
+	float4(0.0126678f, -0.150407f, -0.0430578f, 0.0286503f), float4(-0.00901097f, -0.0117129f, 0.0390145f, 0.0126678f),
+	float4(-0.181228f, 0.414154f, 0.728016f, 0.0565595f), float4(-0.188972f, 0.040529f, 0.0432165f, -0.0562447f),
+	float4(0.131424f, 0.211442f, -0.0618883f, 0.0343587f), float4(-0.0836478f, -0.135436f, 0.0428507f, 0.0375885f),
+	float4(0.0653392f, -0.14943f, -0.140021f, 0.65401f), float4(0.65401f, -0.140021f, -0.14943f, 0.0653392f),
+	float4(-0.0509142f, -0.03493f, 0.224172f, 0.224172f), float4(-0.03493f, -0.0509142f, -0.131294f, -0.131294f),
+	float4(0.0432165f, 0.040529f, -0.188972f, 0.0565595f), float4(0.728016f, 0.414154f, -0.181228f, -0.0618883f),
+	float4(0.211442f, 0.131424f, -0.0562447f, 0.0428507f), float4(-0.135436f, -0.0836478f, 0.0343587f, 0.0375885f),
+	float4(0.0390145f, -0.0117129f, -0.150407f, 0.238573f), float4(0.778316f, 0.0126678f, -0.0430578f, 0.0689767f),
+	float4(0.238573f, -0.00901097f, 0.0286503f, -0.0430578f), float4(-0.150407f, -0.0117129f, 0.0126678f, 0.0390145f),
+	float4(-0.181228f, -0.0562447f, 0.0343587f, 0.414154f), float4(0.131424f, -0.0836478f, 0.728016f, 0.211442f),
+	float4(-0.135436f, 0.0375885f, 0.0565595f, -0.188972f), float4(-0.0618883f, 0.0428507f, 0.040529f, 0.0432165f),
+	float4(0.0437f, -0.0963401f, -0.172034f, -0.0963401f), float4(0.21652f, 0.403025f, 0.0519346f, -0.0928351f),
+	float4(-0.172034f, 0.403025f, 0.661026f, -0.184131f), float4(0.0414703f, 0.0519346f, -0.0928351f, -0.184131f),
+	float4(-0.140275f, -0.140275f, -0.0726629f, -0.0830265f), float4(0.309799f, 0.309799f, -0.0830265f, -0.0726629f),
+	float4(-0.14189f, -0.103848f, 0.630979f, 0.630979f), float4(-0.103848f, -0.14189f, -0.124381f, -0.124381f),
+	float4(-0.172034f, -0.0963401f, 0.0437f, -0.0928351f), float4(0.0519346f, 0.403025f, 0.21652f, -0.0963401f),
+	float4(0.0414703f, -0.184131f, 0.661026f, 0.403025f), float4(-0.172034f, 0.0519346f, -0.184131f, -0.0928351f),
+	float4(0.0343587f, -0.0562447f, -0.181228f, -0.0836478f), float4(0.131424f, 0.414154f, 0.0375885f, -0.135436f),
+	float4(0.211442f, 0.728016f, 0.0565595f, 0.0428507f), float4(-0.0618883f, -0.188972f, 0.040529f, 0.0432165f),
+	float4(0.0653392f, -0.14943f, -0.0509142f, -0.140021f), float4(-0.03493f, 0.65401f, 0.224172f, -0.131294f),
+	float4(0.65401f, 0.224172f, -0.131294f, -0.140021f), float4(-0.03493f, -0.14943f, -0.0509142f, 0.0653392f),
+	float4(-0.0726629f, -0.14189f, -0.0830265f, -0.103848f), float4(-0.140275f, 0.309799f, 0.630979f, -0.124381f),
+	float4(-0.140275f, 0.309799f, 0.630979f, -0.124381f), float4(-0.0830265f, -0.103848f, -0.0726629f, -0.14189f),
+	float4(-0.100452f, -0.100452f, -0.100452f, 0.525113f), float4(0.525113f, -0.100452f, -0.0770795f, -0.100452f),
+	float4(0.525113f, 0.525113f, -0.100452f, -0.0770795f), float4(-0.100452f, -0.100452f, -0.0770795f, -0.0770795f),
+	float4(-0.14189f, -0.0726629f, -0.103848f, -0.0830265f), float4(-0.124381f, 0.630979f, 0.309799f, -0.140275f),
+	float4(-0.124381f, 0.630979f, 0.309799f, -0.140275f), float4(-0.103848f, -0.0830265f, -0.14189f, -0.0726629f),
+	float4(0.0653392f, -0.0509142f, -0.14943f, -0.03493f), float4(-0.140021f, -0.131294f, 0.224172f, 0.65401f),
+	float4(-0.131294f, 0.224172f, 0.65401f, -0.03493f), float4(-0.140021f, -0.0509142f, -0.14943f, 0.0653392f),
+	float4(0.0432165f, 0.040529f, -0.188972f, -0.0618883f), float4(0.0428507f, 0.0565595f, 0.728016f, 0.211442f),
+	float4(-0.135436f, 0.0375885f, 0.414154f, 0.131424f), float4(-0.0836478f, -0.181228f, -0.0562447f, 0.0343587f),
+	float4(-0.0928351f, -0.184131f, 0.0519346f, -0.172034f), float4(0.403025f, 0.661026f, -0.184131f, 0.0414703f),
+	float4(-0.0963401f, 0.21652f, 0.403025f, 0.0519346f), float4(-0.0928351f, 0.0437f, -0.0963401f, -0.172034f),
+	float4(-0.124381f, -0.124381f, -0.14189f, -0.103848f), float4(0.630979f, 0.630979f, -0.103848f, -0.14189f),
+	float4(-0.0726629f, -0.0830265f, 0.309799f, 0.309799f), float4(-0.0830265f, -0.0726629f, -0.140275f, -0.140275f),
+	float4(0.0414703f, -0.184131f, -0.0928351f, 0.0519346f), float4(-0.184131f, 0.661026f, 0.403025f, -0.172034f),
+	float4(-0.0928351f, 0.0519346f, 0.403025f, 0.21652f), float4(-0.0963401f, -0.172034f, -0.0963401f, 0.0437f),
+	float4(0.0432165f, 0.040529f, 0.0428507f, -0.0618883f), float4(-0.188972f, 0.0565595f, 0.0375885f, -0.135436f),
+	float4(0.211442f, 0.728016f, -0.0836478f, 0.131424f), float4(0.414154f, 0.0343587f, -0.0562447f, -0.181228f),
+	float4(0.0390145f, 0.0126678f, -0.00901097f, -0.0117129f), float4(-0.150407f, -0.0430578f, 0.0286503f, 0.238573f),
+	float4(0.0689767f, -0.0430578f, 0.0126678f, 0.778316f), float4(0.238573f, -0.150407f, -0.0117129f, 0.0390145f),
+	float4(0.0375885f, 0.0343587f, -0.0836478f, -0.135436f), float4(0.0428507f, -0.0562447f, 0.131424f, 0.211442f),
+	float4(-0.0618883f, -0.181228f, 0.414154f, 0.728016f), float4(0.0565595f, -0.188972f, 0.040529f, 0.0432165f),
+	float4(-0.131294f, -0.131294f, -0.0509142f, -0.03493f), float4(0.224172f, 0.224172f, -0.03493f, -0.0509142f),
+	float4(0.0653392f, -0.14943f, -0.140021f, 0.65401f), float4(0.65401f, -0.140021f, -0.14943f, 0.0653392f),
+	float4(0.0375885f, 0.0428507f, -0.135436f, -0.0836478f), float4(0.0343587f, -0.0618883f, 0.211442f, 0.131424f),
+	float4(-0.0562447f, 0.0432165f, 0.040529f, -0.188972f), float4(0.0565595f, 0.728016f, 0.414154f, -0.181228f),
+	float4(-0.00901097f, 0.0126678f, 0.0390145f, -0.0117129f), float4(0.0286503f, -0.0430578f, -0.150407f, 0.0126678f),
+	float4(-0.0430578f, 0.0689767f, 0.238573f, 0.0390145f), float4(-0.0117129f, -0.150407f, 0.238573f, 0.778316f),
+	float4(0.933329f, 0.0996205f, -0.124185f, 0.0635217f), float4(-0.00713838f, 0.0996205f, 0.0352663f, -0.027988f),
+	float4(0.0126019f, -0.124185f, -0.027988f, 0.010745f), float4(0.0635217f, 0.0126019f, -0.00713838f, -0.00520178f),
+	float4(-0.279338f, 0.893846f, 0.634514f, -0.324499f), float4(0.0357366f, 0.0263514f, -0.0218689f, 0.0547606f),
+	float4(0.0975945f, -0.0409896f, 0.0424864f, -0.102034f), float4(-0.08229f, 0.0315533f, 0.0530764f, 0.0394828f),
+	float4(0.0752984f, -0.240839f, 0.292715f, 0.98195f), float4(-0.107164f, -0.0794439f, 0.0588501f, -0.0144923f),
+	float4(-0.0157343f, 0.0206681f, 0.0924346f, 0.0267576f), float4(-0.0317358f, -0.113574f, 0.0170602f, 0.0574779f),
+	float4(-0.0189151f, 0.0599349f, -0.0724248f, -0.108845f), float4(0.970181f, 0.316686f, -0.234104f, 0.0579637f),
+	float4(0.0890073f, 0.0281325f, -0.031331f, -0.113556f), float4(-0.0323006f, 0.0347652f, 0.0575193f, 0.0173346f),
+	float4(0.0208921f, 0.0314528f, -0.279616f, 0.546503f), float4(0.868266f, -0.215027f, -0.0282928f, 0.0704259f),
+	float4(0.112751f, -0.0290758f, 0.0315521f, -0.079979f), float4(-0.132095f, 0.027308f, 0.0383906f, 0.0621484f),
+	float4(-0.00543526f, 0.0489067f, -0.0955937f, 0.0759871f), float4(0.94903f, -0.00824732f, -0.00669011f, 0.103652f),
+	float4(-0.00671237f, 0.0164954f, -0.125107f, -0.00835353f), float4(0.0632632f, -0.00611552f, -0.00482654f, 0.00364947f),
+	float4(-0.279338f, -0.0218689f, 0.0424864f, 0.893846f), float4(0.0547606f, -0.102034f, 0.0530764f, 0.634514f),
+	float4(0.0975945f, -0.08229f, 0.0394828f, -0.324499f), float4(-0.0409896f, 0.0315533f, 0.0357366f, 0.0263514f),
+	float4(0.0467038f, -0.254559f, -0.174991f, 0.0885835f), float4(-0.254559f, 0.899165f, 0.559192f, -0.290243f),
+	float4(-0.174991f, 0.559192f, 0.419276f, -0.201133f), float4(0.0885835f, -0.290243f, -0.201133f, 0.0958954f),
+	float4(0.0522191f, -0.0831999f, -0.251073f, 0.0636589f), float4(-0.224712f, 0.282842f, 0.905569f, -0.0864167f),
+	float4(-0.0540475f, 0.0427876f, -0.137066f, 0.184609f), float4(0.61377f, 0.0732496f, -0.0986892f, -0.310816f),
+	float4(-0.251149f, -0.0830201f, 0.0556711f, 0.0406586f), float4(-0.0513973f, -0.0870165f, 0.899438f, 0.295256f),
+	float4(-0.20166f, 0.0516066f, 0.609597f, 0.193027f), float4(-0.160484f, -0.308974f, -0.102884f, 0.077859f),
+	float4(0.0867229f, -0.17117f, -0.267137f, 0.0807338f), float4(-0.265527f, 0.510946f, 0.803335f, -0.205305f),
+	float4(-0.184548f, 0.385292f, 0.654455f, -0.162284f), float4(0.0878905f, -0.184469f, -0.308036f, 0.0526259f),
+	float4(0.0247951f, -0.0285671f, -0.280611f, 0.0473979f), float4(-0.0912416f, 0.0983434f, 0.90114f, 0.0316545f),
+	float4(-0.0661905f, 0.640693f, -0.0162538f, 0.0339447f), float4(-0.32526f, 0.0319845f, 0.0250001f, -0.0188782f),
+	float4(0.0752984f, -0.240839f, -0.0157343f, 0.0267576f), float4(0.292715f, 0.0206681f, -0.0317358f, 0.0170602f),
+	float4(0.98195f, 0.0924346f, -0.113574f, 0.0574779f), float4(-0.107164f, -0.0794439f, 0.0588501f, -0.0144923f),
+	float4(0.0636589f, 0.0427876f, 0.0522191f, -0.224712f), float4(-0.137066f, 0.0732496f, -0.0831999f, 0.282842f),
+	float4(0.184609f, -0.0986892f, -0.251073f, 0.905569f), float4(0.61377f, -0.310816f, -0.0864167f, -0.0540475f),
+	float4(0.0708844f, -0.0835665f, -0.257262f, -0.0835665f), float4(0.102514f, 0.324037f, 0.0708844f, -0.257262f),
+	float4(0.324037f, 1.0327f, -0.122297f, -0.0995124f), float4(0.0762318f, -0.122297f, -0.0995124f, 0.0762318f),
+	float4(0.0710603f, -0.25604f, -0.0866793f, 0.32107f), float4(0.10942f, -0.066112f, 0.0742058f, -0.0934503f),
+	float4(-0.123763f, 1.02363f, 0.343713f, -0.260673f), float4(0.0574934f, -0.131336f, -0.0935208f, 0.0748467f),
+	float4(0.0659146f, 0.0676148f, -0.125842f, -0.198275f), float4(0.0551766f, -0.086828f, 0.161054f, 0.219426f),
+	float4(-0.0501077f, -0.275652f, 0.54414f, 0.914088f), float4(-0.199735f, -0.0682011f, -0.0664751f, 0.0517111f),
+	float4(0.0748263f, -0.0395941f, -0.241168f, -0.0301144f), float4(0.0527823f, 0.296229f, 0.0431717f, -0.0851623f),
+	float4(0.0510255f, 0.990351f, -0.0167933f, 0.03291f), float4(-0.0281732f, -0.0985796f, -0.0765285f, 0.0577318f),
+	float4(-0.0189151f, 0.0599349f, -0.0724248f, -0.108845f), float4(0.970181f, 0.0890073f, -0.113556f, 0.0575193f),
+	float4(0.316686f, 0.0281325f, -0.0323006f, 0.0173346f), float4(-0.234104f, -0.031331f, 0.0347652f, 0.0579637f),
+	float4(0.0406586f, -0.0513973f, -0.0870165f, -0.251149f), float4(0.899438f, 0.609597f, -0.308974f, -0.0830201f),
+	float4(0.295256f, 0.193027f, -0.102884f, 0.0556711f), float4(-0.20166f, -0.160484f, 0.077859f, 0.0516066f),
+	float4(0.0742058f, -0.0934503f, -0.123763f, 0.0710603f), float4(-0.25604f, 0.32107f, 1.02363f, -0.131336f),
+	float4(-0.0935208f, 0.0748467f, -0.0866793f, 0.10942f), float4(0.343713f, -0.066112f, -0.260673f, 0.0574934f),
+	float4(0.0760517f, -0.0955165f, -0.128425f, 0.0760517f), float4(-0.0955165f, -0.128425f, 1.03885f, 0.320465f),
+	float4(-0.256823f, 0.0726285f, 0.320465f, 0.0968894f), float4(-0.0784305f, -0.256823f, -0.0784305f, 0.0726285f),
+	float4(-0.0581521f, -0.140451f, 0.0604205f, -0.319741f), float4(0.622536f, 0.895427f, -0.254979f, -0.103638f),
+	float4(0.210467f, 0.284436f, -0.0801815f, 0.0733439f), float4(-0.148948f, -0.222306f, 0.0683064f, 0.0542498f),
+	float4(0.0573991f, -0.0195322f, -0.0710468f, -0.101847f), float4(0.0617917f, -0.120431f, 0.0958869f, 0.967482f),
+	float4(0.0215339f, -0.0435987f, 0.0360193f, 0.313466f), float4(0.0231282f, -0.021782f, -0.235657f, 0.0588625f),
+	float4(0.0208921f, 0.0314528f, -0.279616f, -0.0282928f), float4(0.0315521f, 0.546503f, 0.0704259f, -0.079979f),
+	float4(0.0383906f, 0.868266f, 0.112751f, -0.132095f), float4(0.0621484f, -0.215027f, -0.0290758f, 0.027308f),
+	float4(0.0867229f, -0.265527f, -0.184548f, 0.0878905f), float4(-0.17117f, 0.510946f, 0.385292f, -0.184469f),
+	float4(-0.267137f, 0.803335f, 0.654455f, -0.308036f), float4(0.0807338f, -0.205305f, -0.162284f, 0.0526259f),
+	float4(0.0676148f, -0.086828f, -0.275652f, -0.125842f), float4(0.161054f, 0.54414f, -0.0682011f, 0.0659146f),
+	float4(-0.198275f, 0.219426f, 0.914088f, -0.0664751f), float4(0.0517111f, 0.0551766f, -0.0501077f, -0.199735f),
+	float4(-0.319741f, -0.103638f, 0.0733439f, -0.0581521f), float4(0.622536f, 0.210467f, -0.148948f, -0.140451f),
+	float4(0.895427f, 0.284436f, -0.222306f, 0.0542498f), float4(0.0604205f, -0.254979f, -0.0801815f, 0.0683064f),
+	float4(0.0956228f, -0.169385f, -0.252277f, 0.0578193f), float4(-0.169385f, 0.29626f, 0.527491f, -0.123373f),
+	float4(-0.252277f, 0.527491f, 0.792647f, -0.193547f), float4(0.0578193f, -0.123373f, -0.193547f, 0.047233f),
+	float4(0.0207365f, 0.0298288f, -0.0205734f, 0.037202f), float4(-0.0237379f, -0.281879f, 0.0273771f, -0.0474222f),
+	float4(0.0259956f, 0.561843f, 0.0435285f, -0.0910456f), float4(0.0769401f, 0.888384f, 0.0212949f, -0.221897f),
+	float4(-0.00543526f, 0.0489067f, -0.00671237f, -0.0955937f), float4(-0.00824732f, 0.0164954f, -0.00835353f, 0.0759871f),
+	float4(-0.00669011f, 0.94903f, 0.103652f, -0.125107f), float4(0.0632632f, -0.00611552f, -0.00482654f, 0.00364947f),
+	float4(0.0473979f, 0.0316545f, -0.0162538f, 0.0247951f), float4(-0.0912416f, -0.0661905f, 0.0339447f, -0.0285671f),
+	float4(0.0983434f, -0.280611f, 0.90114f, 0.640693f), float4(-0.32526f, 0.0319845f, 0.0250001f, -0.0188782f),
+	float4(0.0431717f, -0.0167933f, -0.0301144f, -0.0851623f), float4(0.03291f, -0.0395941f, 0.0527823f, 0.0510255f),
+	float4(-0.0281732f, 0.0748263f, -0.241168f, 0.296229f), float4(0.990351f, -0.0985796f, -0.0765285f, 0.0577318f),
+	float4(0.0617917f, 0.0215339f, -0.120431f, -0.0435987f), float4(0.0231282f, -0.0195322f, 0.0958869f, 0.0360193f),
+	float4(-0.021782f, 0.0573991f, -0.0710468f, -0.101847f), float4(0.967482f, 0.313466f, -0.235657f, 0.0588625f),
+	float4(-0.0205734f, 0.0273771f, 0.0435285f, 0.037202f), float4(-0.0474222f, -0.0910456f, 0.0212949f, -0.0237379f),
+	float4(0.0259956f, 0.0769401f, 0.0207365f, 0.0298288f), float4(-0.281879f, 0.561843f, 0.888384f, -0.221897f),
+	float4(-0.00525383f, -0.00612136f, 0.00436395f, 0.049703f), float4(-0.00612136f, 0.00751117f, -0.00494764f, -0.0990645f),
+	float4(0.00436395f, -0.00494764f, 0.0742421f, -0.00525383f), float4(0.049703f, -0.0990645f, 0.0742421f, 0.962659f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+};
+
+#define WEIGHT_GRID_COUNT_10X5 4
+#define MAX_GRID_WEIGHTS_10X5 40
+static const uint4 weight_grids_10x5[WEIGHT_GRID_COUNT_10X5] = { uint4(4, 4, 0, 0), uint4(5, 5, 16, 50), uint4(6, 5, 41, 100), uint4(8, 5, 71, 150) };
+static const uint4 decimation_idx_10x5[111] =
+{
+	uint4(0, 1, 10, 11), uint4(3, 4, 13, 14), uint4(6, 7, 16, 17), uint4(9, 9, 19, 19),
+	uint4(10, 11, 20, 21), uint4(13, 14, 23, 24), uint4(16, 17, 26, 27), uint4(19, 19, 29, 29),
+	uint4(20, 21, 30, 31), uint4(23, 24, 33, 34), uint4(26, 27, 36, 37), uint4(29, 29, 39, 39),
+	uint4(40, 41, 40, 41), uint4(43, 44, 43, 44), uint4(46, 47, 46, 47), uint4(49, 49, 49, 49),
+	uint4(0, 1, 10, 11), uint4(2, 3, 12, 13), uint4(4, 5, 14, 15), uint4(6, 7, 16, 17),
+	uint4(9, 9, 19, 19), uint4(10, 11, 20, 21), uint4(12, 13, 22, 23), uint4(14, 15, 24, 25),
+	uint4(16, 17, 26, 27), uint4(19, 19, 29, 29), uint4(20, 21, 30, 31), uint4(22, 23, 32, 33),
+	uint4(24, 25, 34, 35), uint4(26, 27, 36, 37), uint4(29, 29, 39, 39), uint4(30, 31, 40, 41),
+	uint4(32, 33, 42, 43), uint4(34, 35, 44, 45), uint4(36, 37, 46, 47), uint4(39, 39, 49, 49),
+	uint4(40, 41, 40, 41), uint4(42, 43, 42, 43), uint4(44, 45, 44, 45), uint4(46, 47, 46, 47),
+	uint4(49, 49, 49, 49), uint4(0, 1, 10, 11), uint4(1, 2, 11, 12), uint4(3, 4, 13, 14),
+	uint4(5, 6, 15, 16), uint4(7, 8, 17, 18), uint4(9, 9, 19, 19), uint4(10, 11, 20, 21),
+	uint4(11, 12, 21, 22), uint4(13, 14, 23, 24), uint4(15, 16, 25, 26), uint4(17, 18, 27, 28),
+	uint4(19, 19, 29, 29), uint4(20, 21, 30, 31), uint4(21, 22, 31, 32), uint4(23, 24, 33, 34),
+	uint4(25, 26, 35, 36), uint4(27, 28, 37, 38), uint4(29, 29, 39, 39), uint4(30, 31, 40, 41),
+	uint4(31, 32, 41, 42), uint4(33, 34, 43, 44), uint4(35, 36, 45, 46), uint4(37, 38, 47, 48),
+	uint4(39, 39, 49, 49), uint4(40, 41, 40, 41), uint4(41, 42, 41, 42), uint4(43, 44, 43, 44),
+	uint4(45, 46, 45, 46), uint4(47, 48, 47, 48), uint4(49, 49, 49, 49), uint4(0, 1, 10, 11),
+	uint4(1, 2, 11, 12), uint4(2, 3, 12, 13), uint4(3, 4, 13, 14), uint4(5, 6, 15, 16),
+	uint4(6, 7, 16, 17), uint4(7, 8, 17, 18), uint4(9, 9, 19, 19), uint4(10, 11, 20, 21),
+	uint4(11, 12, 21, 22), uint4(12, 13, 22, 23), uint4(13, 14, 23, 24), uint4(15, 16, 25, 26),
+	uint4(16, 17, 26, 27), uint4(17, 18, 27, 28), uint4(19, 19, 29, 29), uint4(20, 21, 30, 31),
+	uint4(21, 22, 31, 32), uint4(22, 23, 32, 33), uint4(23, 24, 33, 34), uint4(25, 26, 35, 36),
+	uint4(26, 27, 36, 37), uint4(27, 28, 37, 38), uint4(29, 29, 39, 39), uint4(30, 31, 40, 41),
+	uint4(31, 32, 41, 42), uint4(32, 33, 42, 43), uint4(33, 34, 43, 44), uint4(35, 36, 45, 46),
+	uint4(36, 37, 46, 47), uint4(37, 38, 47, 48), uint4(39, 39, 49, 49), uint4(40, 41, 40, 41),
+	uint4(41, 42, 41, 42), uint4(42, 43, 42, 43), uint4(43, 44, 43, 44), uint4(45, 46, 45, 46),
+	uint4(46, 47, 46, 47), uint4(47, 48, 47, 48), uint4(49, 49, 49, 49),
+};
+static const float4 decimation_wt_10x5[111] =
+{
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.666666627f, 0.0f, 0.333333373f, 0.0f), float4(0.666666627f, 0.0f, 0.333333373f, 0.0f),
+	float4(0.666666627f, 0.0f, 0.333333373f, 0.0f), float4(0.666666627f, 0.0f, 0.333333373f, 0.0f),
+	float4(0.333333254f, 0.0f, 0.666666746f, 0.0f), float4(0.333333254f, 0.0f, 0.666666746f, 0.0f),
+	float4(0.333333254f, 0.0f, 0.666666746f, 0.0f), float4(0.333333254f, 0.0f, 0.666666746f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.75f, 0.25f, 0.0f, 0.0f),
+	float4(0.5f, 0.5f, 0.0f, 0.0f), float4(0.25f, 0.75f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.75f, 0.25f, 0.0f, 0.0f), float4(0.5f, 0.5f, 0.0f, 0.0f),
+	float4(0.25f, 0.75f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.75f, 0.25f, 0.0f, 0.0f),
+	float4(0.5f, 0.5f, 0.0f, 0.0f), float4(0.25f, 0.75f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.75f, 0.25f, 0.0f, 0.0f), float4(0.5f, 0.5f, 0.0f, 0.0f),
+	float4(0.25f, 0.75f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.75f, 0.25f, 0.0f, 0.0f),
+	float4(0.5f, 0.5f, 0.0f, 0.0f), float4(0.25f, 0.75f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.200000048f, 0.799999952f, 0.0f, 0.0f), float4(0.400000095f, 0.599999905f, 0.0f, 0.0f),
+	float4(0.599999905f, 0.400000095f, 0.0f, 0.0f), float4(0.800000191f, 0.199999809f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.200000048f, 0.799999952f, 0.0f, 0.0f), float4(0.400000095f, 0.599999905f, 0.0f, 0.0f),
+	float4(0.599999905f, 0.400000095f, 0.0f, 0.0f), float4(0.800000191f, 0.199999809f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.200000048f, 0.799999952f, 0.0f, 0.0f), float4(0.400000095f, 0.599999905f, 0.0f, 0.0f),
+	float4(0.599999905f, 0.400000095f, 0.0f, 0.0f), float4(0.800000191f, 0.199999809f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.200000048f, 0.799999952f, 0.0f, 0.0f), float4(0.400000095f, 0.599999905f, 0.0f, 0.0f),
+	float4(0.599999905f, 0.400000095f, 0.0f, 0.0f), float4(0.800000191f, 0.199999809f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.200000048f, 0.799999952f, 0.0f, 0.0f), float4(0.400000095f, 0.599999905f, 0.0f, 0.0f),
+	float4(0.599999905f, 0.400000095f, 0.0f, 0.0f), float4(0.800000191f, 0.199999809f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.714285731f, 0.285714269f, 0.0f, 0.0f), float4(0.428571463f, 0.571428537f, 0.0f, 0.0f),
+	float4(0.142857075f, 0.857142925f, 0.0f, 0.0f), float4(0.857142925f, 0.142857075f, 0.0f, 0.0f),
+	float4(0.571428776f, 0.428571224f, 0.0f, 0.0f), float4(0.285714149f, 0.714285851f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.714285731f, 0.285714269f, 0.0f, 0.0f), float4(0.428571463f, 0.571428537f, 0.0f, 0.0f),
+	float4(0.142857075f, 0.857142925f, 0.0f, 0.0f), float4(0.857142925f, 0.142857075f, 0.0f, 0.0f),
+	float4(0.571428776f, 0.428571224f, 0.0f, 0.0f), float4(0.285714149f, 0.714285851f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.714285731f, 0.285714269f, 0.0f, 0.0f), float4(0.428571463f, 0.571428537f, 0.0f, 0.0f),
+	float4(0.142857075f, 0.857142925f, 0.0f, 0.0f), float4(0.857142925f, 0.142857075f, 0.0f, 0.0f),
+	float4(0.571428776f, 0.428571224f, 0.0f, 0.0f), float4(0.285714149f, 0.714285851f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.714285731f, 0.285714269f, 0.0f, 0.0f), float4(0.428571463f, 0.571428537f, 0.0f, 0.0f),
+	float4(0.142857075f, 0.857142925f, 0.0f, 0.0f), float4(0.857142925f, 0.142857075f, 0.0f, 0.0f),
+	float4(0.571428776f, 0.428571224f, 0.0f, 0.0f), float4(0.285714149f, 0.714285851f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.714285731f, 0.285714269f, 0.0f, 0.0f), float4(0.428571463f, 0.571428537f, 0.0f, 0.0f),
+	float4(0.142857075f, 0.857142925f, 0.0f, 0.0f), float4(0.857142925f, 0.142857075f, 0.0f, 0.0f),
+	float4(0.571428776f, 0.428571224f, 0.0f, 0.0f), float4(0.285714149f, 0.714285851f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f),
+};
+static const uint4 infill_idx_10x5[200] =
+{
+	uint4(0, 0, 0, 0), uint4(0, 1, 0, 0), uint4(0, 1, 0, 0), uint4(1, 1, 1, 1),
+	uint4(1, 2, 1, 1), uint4(1, 2, 1, 1), uint4(2, 2, 2, 2), uint4(2, 3, 2, 2),
+	uint4(2, 3, 2, 2), uint4(3, 3, 3, 3), uint4(0, 0, 4, 0), uint4(0, 1, 4, 5),
+	uint4(0, 1, 4, 5), uint4(1, 1, 5, 1), uint4(1, 2, 5, 6), uint4(1, 2, 5, 6),
+	uint4(2, 2, 6, 2), uint4(2, 3, 6, 7), uint4(2, 3, 6, 7), uint4(3, 3, 7, 3),
+	uint4(4, 4, 8, 4), uint4(4, 5, 8, 9), uint4(4, 5, 8, 9), uint4(5, 5, 9, 5),
+	uint4(5, 6, 9, 10), uint4(5, 6, 9, 10), uint4(6, 6, 10, 6), uint4(6, 7, 10, 11),
+	uint4(6, 7, 10, 11), uint4(7, 7, 11, 7), uint4(8, 8, 12, 8), uint4(8, 9, 12, 13),
+	uint4(8, 9, 12, 13), uint4(9, 9, 13, 9), uint4(9, 10, 13, 14), uint4(9, 10, 13, 14),
+	uint4(10, 10, 14, 10), uint4(10, 11, 14, 15), uint4(10, 11, 14, 15), uint4(11, 11, 15, 11),
+	uint4(12, 12, 12, 12), uint4(12, 13, 12, 12), uint4(12, 13, 12, 12), uint4(13, 13, 13, 13),
+	uint4(13, 14, 13, 13), uint4(13, 14, 13, 13), uint4(14, 14, 14, 14), uint4(14, 15, 14, 14),
+	uint4(14, 15, 14, 14), uint4(15, 15, 15, 15), uint4(0, 0, 0, 0), uint4(0, 1, 0, 0),
+	uint4(0, 1, 0, 0), uint4(1, 2, 1, 1), uint4(1, 2, 1, 1), uint4(2, 3, 2, 2),
+	uint4(2, 3, 2, 2), uint4(3, 4, 3, 3), uint4(3, 4, 3, 3), uint4(4, 4, 4, 4),
+	uint4(5, 5, 5, 5), uint4(5, 6, 5, 5), uint4(5, 6, 5, 5), uint4(6, 7, 6, 6),
+	uint4(6, 7, 6, 6), uint4(7, 8, 7, 7), uint4(7, 8, 7, 7), uint4(8, 9, 8, 8),
+	uint4(8, 9, 8, 8), uint4(9, 9, 9, 9), uint4(10, 10, 10, 10), uint4(10, 11, 10, 10),
+	uint4(10, 11, 10, 10), uint4(11, 12, 11, 11), uint4(11, 12, 11, 11), uint4(12, 13, 12, 12),
+	uint4(12, 13, 12, 12), uint4(13, 14, 13, 13), uint4(13, 14, 13, 13), uint4(14, 14, 14, 14),
+	uint4(15, 15, 15, 15), uint4(15, 16, 15, 15), uint4(15, 16, 15, 15), uint4(16, 17, 16, 16),
+	uint4(16, 17, 16, 16), uint4(17, 18, 17, 17), uint4(17, 18, 17, 17), uint4(18, 19, 18, 18),
+	uint4(18, 19, 18, 18), uint4(19, 19, 19, 19), uint4(20, 20, 20, 20), uint4(20, 21, 20, 20),
+	uint4(20, 21, 20, 20), uint4(21, 22, 21, 21), uint4(21, 22, 21, 21), uint4(22, 23, 22, 22),
+	uint4(22, 23, 22, 22), uint4(23, 24, 23, 23), uint4(23, 24, 23, 23), uint4(24, 24, 24, 24),
+	uint4(0, 0, 0, 0), uint4(0, 1, 0, 0), uint4(1, 2, 1, 1), uint4(1, 2, 1, 1),
+	uint4(2, 3, 2, 2), uint4(2, 3, 2, 2), uint4(3, 4, 3, 3), uint4(3, 4, 3, 3),
+	uint4(4, 5, 4, 4), uint4(5, 5, 5, 5), uint4(6, 6, 6, 6), uint4(6, 7, 6, 6),
+	uint4(7, 8, 7, 7), uint4(7, 8, 7, 7), uint4(8, 9, 8, 8), uint4(8, 9, 8, 8),
+	uint4(9, 10, 9, 9), uint4(9, 10, 9, 9), uint4(10, 11, 10, 10), uint4(11, 11, 11, 11),
+	uint4(12, 12, 12, 12), uint4(12, 13, 12, 12), uint4(13, 14, 13, 13), uint4(13, 14, 13, 13),
+	uint4(14, 15, 14, 14), uint4(14, 15, 14, 14), uint4(15, 16, 15, 15), uint4(15, 16, 15, 15),
+	uint4(16, 17, 16, 16), uint4(17, 17, 17, 17), uint4(18, 18, 18, 18), uint4(18, 19, 18, 18),
+	uint4(19, 20, 19, 19), uint4(19, 20, 19, 19), uint4(20, 21, 20, 20), uint4(20, 21, 20, 20),
+	uint4(21, 22, 21, 21), uint4(21, 22, 21, 21), uint4(22, 23, 22, 22), uint4(23, 23, 23, 23),
+	uint4(24, 24, 24, 24), uint4(24, 25, 24, 24), uint4(25, 26, 25, 25), uint4(25, 26, 25, 25),
+	uint4(26, 27, 26, 26), uint4(26, 27, 26, 26), uint4(27, 28, 27, 27), uint4(27, 28, 27, 27),
+	uint4(28, 29, 28, 28), uint4(29, 29, 29, 29), uint4(0, 0, 0, 0), uint4(0, 1, 0, 0),
+	uint4(1, 2, 1, 1), uint4(2, 3, 2, 2), uint4(3, 4, 3, 3), uint4(3, 4, 3, 3),
+	uint4(4, 5, 4, 4), uint4(5, 6, 5, 5), uint4(6, 7, 6, 6), uint4(7, 7, 7, 7),
+	uint4(8, 8, 8, 8), uint4(8, 9, 8, 8), uint4(9, 10, 9, 9), uint4(10, 11, 10, 10),
+	uint4(11, 12, 11, 11), uint4(11, 12, 11, 11), uint4(12, 13, 12, 12), uint4(13, 14, 13, 13),
+	uint4(14, 15, 14, 14), uint4(15, 15, 15, 15), uint4(16, 16, 16, 16), uint4(16, 17, 16, 16),
+	uint4(17, 18, 17, 17), uint4(18, 19, 18, 18), uint4(19, 20, 19, 19), uint4(19, 20, 19, 19),
+	uint4(20, 21, 20, 20), uint4(21, 22, 21, 21), uint4(22, 23, 22, 22), uint4(23, 23, 23, 23),
+	uint4(24, 24, 24, 24), uint4(24, 25, 24, 24), uint4(25, 26, 25, 25), uint4(26, 27, 26, 26),
+	uint4(27, 28, 27, 27), uint4(27, 28, 27, 27), uint4(28, 29, 28, 28), uint4(29, 30, 29, 29),
+	uint4(30, 31, 30, 30), uint4(31, 31, 31, 31), uint4(32, 32, 32, 32), uint4(32, 33, 32, 32),
+	uint4(33, 34, 33, 33), uint4(34, 35, 34, 34), uint4(35, 36, 35, 35), uint4(35, 36, 35, 35),
+	uint4(36, 37, 36, 36), uint4(37, 38, 37, 37), uint4(38, 39, 38, 38), uint4(39, 39, 39, 39),
+};
+static const float4 infill_wt_10x5[200] =
+{
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.6875f, 0.3125f, 0.0f, 0.0f), float4(0.3125f, 0.6875f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.6875f, 0.3125f, 0.0f, 0.0f), float4(0.3125f, 0.6875f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.6875f, 0.3125f, 0.0f, 0.0f),
+	float4(0.3125f, 0.6875f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.25f, 0.0f, 0.75f, 0.0f), float4(0.1875f, 0.0625f, 0.5f, 0.25f),
+	float4(0.0625f, 0.1875f, 0.25f, 0.5f), float4(0.25f, 0.0f, 0.75f, 0.0f), float4(0.1875f, 0.0625f, 0.5f, 0.25f), float4(0.0625f, 0.1875f, 0.25f, 0.5f),
+	float4(0.25f, 0.0f, 0.75f, 0.0f), float4(0.1875f, 0.0625f, 0.5f, 0.25f), float4(0.0625f, 0.1875f, 0.25f, 0.5f), float4(0.25f, 0.0f, 0.75f, 0.0f),
+	float4(0.5f, 0.0f, 0.5f, 0.0f), float4(0.375f, 0.125f, 0.3125f, 0.1875f), float4(0.1875f, 0.3125f, 0.125f, 0.375f), float4(0.5f, 0.0f, 0.5f, 0.0f),
+	float4(0.375f, 0.125f, 0.3125f, 0.1875f), float4(0.1875f, 0.3125f, 0.125f, 0.375f), float4(0.5f, 0.0f, 0.5f, 0.0f), float4(0.375f, 0.125f, 0.3125f, 0.1875f),
+	float4(0.1875f, 0.3125f, 0.125f, 0.375f), float4(0.5f, 0.0f, 0.5f, 0.0f), float4(0.75f, 0.0f, 0.25f, 0.0f), float4(0.5f, 0.25f, 0.1875f, 0.0625f),
+	float4(0.25f, 0.5f, 0.0625f, 0.1875f), float4(0.75f, 0.0f, 0.25f, 0.0f), float4(0.5f, 0.25f, 0.1875f, 0.0625f), float4(0.25f, 0.5f, 0.0625f, 0.1875f),
+	float4(0.75f, 0.0f, 0.25f, 0.0f), float4(0.5f, 0.25f, 0.1875f, 0.0625f), float4(0.25f, 0.5f, 0.0625f, 0.1875f), float4(0.75f, 0.0f, 0.25f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.6875f, 0.3125f, 0.0f, 0.0f), float4(0.3125f, 0.6875f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.6875f, 0.3125f, 0.0f, 0.0f), float4(0.3125f, 0.6875f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.6875f, 0.3125f, 0.0f, 0.0f),
+	float4(0.3125f, 0.6875f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.5625f, 0.4375f, 0.0f, 0.0f),
+	float4(0.125f, 0.875f, 0.0f, 0.0f), float4(0.6875f, 0.3125f, 0.0f, 0.0f), float4(0.1875f, 0.8125f, 0.0f, 0.0f), float4(0.75f, 0.25f, 0.0f, 0.0f),
+	float4(0.3125f, 0.6875f, 0.0f, 0.0f), float4(0.875f, 0.125f, 0.0f, 0.0f), float4(0.4375f, 0.5625f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.5625f, 0.4375f, 0.0f, 0.0f), float4(0.125f, 0.875f, 0.0f, 0.0f), float4(0.6875f, 0.3125f, 0.0f, 0.0f),
+	float4(0.1875f, 0.8125f, 0.0f, 0.0f), float4(0.75f, 0.25f, 0.0f, 0.0f), float4(0.3125f, 0.6875f, 0.0f, 0.0f), float4(0.875f, 0.125f, 0.0f, 0.0f),
+	float4(0.4375f, 0.5625f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.5625f, 0.4375f, 0.0f, 0.0f),
+	float4(0.125f, 0.875f, 0.0f, 0.0f), float4(0.6875f, 0.3125f, 0.0f, 0.0f), float4(0.1875f, 0.8125f, 0.0f, 0.0f), float4(0.75f, 0.25f, 0.0f, 0.0f),
+	float4(0.3125f, 0.6875f, 0.0f, 0.0f), float4(0.875f, 0.125f, 0.0f, 0.0f), float4(0.4375f, 0.5625f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.5625f, 0.4375f, 0.0f, 0.0f), float4(0.125f, 0.875f, 0.0f, 0.0f), float4(0.6875f, 0.3125f, 0.0f, 0.0f),
+	float4(0.1875f, 0.8125f, 0.0f, 0.0f), float4(0.75f, 0.25f, 0.0f, 0.0f), float4(0.3125f, 0.6875f, 0.0f, 0.0f), float4(0.875f, 0.125f, 0.0f, 0.0f),
+	float4(0.4375f, 0.5625f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.5625f, 0.4375f, 0.0f, 0.0f),
+	float4(0.125f, 0.875f, 0.0f, 0.0f), float4(0.6875f, 0.3125f, 0.0f, 0.0f), float4(0.1875f, 0.8125f, 0.0f, 0.0f), float4(0.75f, 0.25f, 0.0f, 0.0f),
+	float4(0.3125f, 0.6875f, 0.0f, 0.0f), float4(0.875f, 0.125f, 0.0f, 0.0f), float4(0.4375f, 0.5625f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.4375f, 0.5625f, 0.0f, 0.0f), float4(0.875f, 0.125f, 0.0f, 0.0f), float4(0.3125f, 0.6875f, 0.0f, 0.0f),
+	float4(0.75f, 0.25f, 0.0f, 0.0f), float4(0.1875f, 0.8125f, 0.0f, 0.0f), float4(0.6875f, 0.3125f, 0.0f, 0.0f), float4(0.125f, 0.875f, 0.0f, 0.0f),
+	float4(0.5625f, 0.4375f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.4375f, 0.5625f, 0.0f, 0.0f),
+	float4(0.875f, 0.125f, 0.0f, 0.0f), float4(0.3125f, 0.6875f, 0.0f, 0.0f), float4(0.75f, 0.25f, 0.0f, 0.0f), float4(0.1875f, 0.8125f, 0.0f, 0.0f),
+	float4(0.6875f, 0.3125f, 0.0f, 0.0f), float4(0.125f, 0.875f, 0.0f, 0.0f), float4(0.5625f, 0.4375f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.4375f, 0.5625f, 0.0f, 0.0f), float4(0.875f, 0.125f, 0.0f, 0.0f), float4(0.3125f, 0.6875f, 0.0f, 0.0f),
+	float4(0.75f, 0.25f, 0.0f, 0.0f), float4(0.1875f, 0.8125f, 0.0f, 0.0f), float4(0.6875f, 0.3125f, 0.0f, 0.0f), float4(0.125f, 0.875f, 0.0f, 0.0f),
+	float4(0.5625f, 0.4375f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.4375f, 0.5625f, 0.0f, 0.0f),
+	float4(0.875f, 0.125f, 0.0f, 0.0f), float4(0.3125f, 0.6875f, 0.0f, 0.0f), float4(0.75f, 0.25f, 0.0f, 0.0f), float4(0.1875f, 0.8125f, 0.0f, 0.0f),
+	float4(0.6875f, 0.3125f, 0.0f, 0.0f), float4(0.125f, 0.875f, 0.0f, 0.0f), float4(0.5625f, 0.4375f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.4375f, 0.5625f, 0.0f, 0.0f), float4(0.875f, 0.125f, 0.0f, 0.0f), float4(0.3125f, 0.6875f, 0.0f, 0.0f),
+	float4(0.75f, 0.25f, 0.0f, 0.0f), float4(0.1875f, 0.8125f, 0.0f, 0.0f), float4(0.6875f, 0.3125f, 0.0f, 0.0f), float4(0.125f, 0.875f, 0.0f, 0.0f),
+	float4(0.5625f, 0.4375f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.25f, 0.75f, 0.0f, 0.0f),
+	float4(0.4375f, 0.5625f, 0.0f, 0.0f), float4(0.6875f, 0.3125f, 0.0f, 0.0f), float4(0.875f, 0.125f, 0.0f, 0.0f), float4(0.125f, 0.875f, 0.0f, 0.0f),
+	float4(0.3125f, 0.6875f, 0.0f, 0.0f), float4(0.5625f, 0.4375f, 0.0f, 0.0f), float4(0.75f, 0.25f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.25f, 0.75f, 0.0f, 0.0f), float4(0.4375f, 0.5625f, 0.0f, 0.0f), float4(0.6875f, 0.3125f, 0.0f, 0.0f),
+	float4(0.875f, 0.125f, 0.0f, 0.0f), float4(0.125f, 0.875f, 0.0f, 0.0f), float4(0.3125f, 0.6875f, 0.0f, 0.0f), float4(0.5625f, 0.4375f, 0.0f, 0.0f),
+	float4(0.75f, 0.25f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.25f, 0.75f, 0.0f, 0.0f),
+	float4(0.4375f, 0.5625f, 0.0f, 0.0f), float4(0.6875f, 0.3125f, 0.0f, 0.0f), float4(0.875f, 0.125f, 0.0f, 0.0f), float4(0.125f, 0.875f, 0.0f, 0.0f),
+	float4(0.3125f, 0.6875f, 0.0f, 0.0f), float4(0.5625f, 0.4375f, 0.0f, 0.0f), float4(0.75f, 0.25f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.25f, 0.75f, 0.0f, 0.0f), float4(0.4375f, 0.5625f, 0.0f, 0.0f), float4(0.6875f, 0.3125f, 0.0f, 0.0f),
+	float4(0.875f, 0.125f, 0.0f, 0.0f), float4(0.125f, 0.875f, 0.0f, 0.0f), float4(0.3125f, 0.6875f, 0.0f, 0.0f), float4(0.5625f, 0.4375f, 0.0f, 0.0f),
+	float4(0.75f, 0.25f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.25f, 0.75f, 0.0f, 0.0f),
+	float4(0.4375f, 0.5625f, 0.0f, 0.0f), float4(0.6875f, 0.3125f, 0.0f, 0.0f), float4(0.875f, 0.125f, 0.0f, 0.0f), float4(0.125f, 0.875f, 0.0f, 0.0f),
+	float4(0.3125f, 0.6875f, 0.0f, 0.0f), float4(0.5625f, 0.4375f, 0.0f, 0.0f), float4(0.75f, 0.25f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+};
+static const uint4 pseudo_inverse_idx_10x5[444] =
+{
+	uint4(0, 1, 2, 3), uint4(4, 5, 6, 7), uint4(10, 11, 20, 21), uint4(22, 23, 30, 31),
+	uint4(0, 1, 2, 3), uint4(4, 5, 6, 7), uint4(9, 12, 13, 14), uint4(22, 23, 24, 33),
+	uint4(0, 2, 3, 4), uint4(5, 6, 7, 8), uint4(9, 15, 16, 17), uint4(25, 26, 27, 36),
+	uint4(2, 3, 4, 5), uint4(6, 7, 8, 9), uint4(18, 19, 26, 28), uint4(29, 36, 38, 39),
+	uint4(0, 1, 10, 11), uint4(12, 13, 14, 20), uint4(21, 22, 23, 24), uint4(30, 31, 32, 40),
+	uint4(2, 3, 4, 10), uint4(11, 12, 13, 14), uint4(15, 16, 22, 23), uint4(24, 32, 33, 34),
+	uint4(5, 6, 7, 13), uint4(14, 15, 16, 17), uint4(19, 25, 26, 27), uint4(29, 35, 36, 37),
+	uint4(6, 8, 9, 15), uint4(16, 17, 18, 19), uint4(26, 28, 29, 35), uint4(36, 38, 39, 49),
+	uint4(0, 10, 11, 13), uint4(14, 20, 21, 23), uint4(30, 31, 32, 33), uint4(34, 40, 41, 43),
+	uint4(12, 13, 14, 20), uint4(22, 23, 24, 30), uint4(32, 33, 34, 35), uint4(36, 42, 43, 44),
+	uint4(15, 16, 17, 25), uint4(26, 27, 33, 34), uint4(35, 36, 37, 38), uint4(39, 45, 46, 47),
+	uint4(9, 17, 18, 19), uint4(25, 26, 27, 28), uint4(29, 35, 36, 37), uint4(38, 39, 48, 49),
+	uint4(10, 11, 13, 20), uint4(21, 23, 30, 31), uint4(40, 41, 42, 43), uint4(44, 45, 46, 47),
+	uint4(13, 22, 23, 24), uint4(32, 33, 34, 40), uint4(41, 42, 43, 44), uint4(45, 46, 47, 49),
+	uint4(16, 25, 26, 27), uint4(35, 36, 37, 40), uint4(42, 43, 44, 45), uint4(46, 47, 48, 49),
+	uint4(18, 19, 26, 27), uint4(28, 29, 38, 39), uint4(42, 43, 44, 45), uint4(46, 47, 48, 49),
+	uint4(0, 1, 2, 3), uint4(4, 5, 6, 7), uint4(8, 9, 0, 0), uint4(0, 0, 0, 0),
+	uint4(0, 1, 2, 3), uint4(4, 5, 6, 7), uint4(8, 9, 0, 0), uint4(0, 0, 0, 0),
+	uint4(0, 1, 2, 3), uint4(4, 5, 6, 7), uint4(8, 9, 0, 0), uint4(0, 0, 0, 0),
+	uint4(0, 1, 2, 3), uint4(4, 5, 6, 7), uint4(8, 9, 0, 0), uint4(0, 0, 0, 0),
+	uint4(0, 1, 2, 3), uint4(4, 5, 6, 7), uint4(8, 9, 0, 0), uint4(0, 0, 0, 0),
+	uint4(10, 11, 12, 13), uint4(14, 15, 16, 17), uint4(18, 19, 10, 10), uint4(10, 10, 10, 10),
+	uint4(10, 11, 12, 13), uint4(14, 15, 16, 17), uint4(18, 19, 10, 10), uint4(10, 10, 10, 10),
+	uint4(10, 11, 12, 13), uint4(14, 15, 16, 17), uint4(18, 19, 10, 10), uint4(10, 10, 10, 10),
+	uint4(10, 11, 12, 13), uint4(14, 15, 16, 17), uint4(18, 19, 10, 10), uint4(10, 10, 10, 10),
+	uint4(10, 11, 12, 13), uint4(14, 15, 16, 17), uint4(18, 19, 10, 10), uint4(10, 10, 10, 10),
+	uint4(20, 21, 22, 23), uint4(24, 25, 26, 27), uint4(28, 29, 20, 20), uint4(20, 20, 20, 20),
+	uint4(20, 21, 22, 23), uint4(24, 25, 26, 27), uint4(28, 29, 20, 20), uint4(20, 20, 20, 20),
+	uint4(20, 21, 22, 23), uint4(24, 25, 26, 27), uint4(28, 29, 20, 20), uint4(20, 20, 20, 20),
+	uint4(20, 21, 22, 23), uint4(24, 25, 26, 27), uint4(28, 29, 20, 20), uint4(20, 20, 20, 20),
+	uint4(20, 21, 22, 23), uint4(24, 25, 26, 27), uint4(28, 29, 20, 20), uint4(20, 20, 20, 20),
+	uint4(30, 31, 32, 33), uint4(34, 35, 36, 37), uint4(38, 39, 30, 30), uint4(30, 30, 30, 30),
+	uint4(30, 31, 32, 33), uint4(34, 35, 36, 37), uint4(38, 39, 30, 30), uint4(30, 30, 30, 30),
+	uint4(30, 31, 32, 33), uint4(34, 35, 36, 37), uint4(38, 39, 30, 30), uint4(30, 30, 30, 30),
+	uint4(30, 31, 32, 33), uint4(34, 35, 36, 37), uint4(38, 39, 30, 30), uint4(30, 30, 30, 30),
+	uint4(30, 31, 32, 33), uint4(34, 35, 36, 37), uint4(38, 39, 30, 30), uint4(30, 30, 30, 30),
+	uint4(40, 41, 42, 43), uint4(44, 45, 46, 47), uint4(48, 49, 40, 40), uint4(40, 40, 40, 40),
+	uint4(40, 41, 42, 43), uint4(44, 45, 46, 47), uint4(48, 49, 40, 40), uint4(40, 40, 40, 40),
+	uint4(40, 41, 42, 43), uint4(44, 45, 46, 47), uint4(48, 49, 40, 40), uint4(40, 40, 40, 40),
+	uint4(40, 41, 42, 43), uint4(44, 45, 46, 47), uint4(48, 49, 40, 40), uint4(40, 40, 40, 40),
+	uint4(40, 41, 42, 43), uint4(44, 45, 46, 47), uint4(48, 49, 40, 40), uint4(40, 40, 40, 40),
+	uint4(0, 1, 2, 3), uint4(4, 5, 6, 7), uint4(8, 9, 0, 0), uint4(0, 0, 0, 0),
+	uint4(0, 1, 2, 3), uint4(4, 5, 6, 7), uint4(8, 9, 0, 0), uint4(0, 0, 0, 0),
+	uint4(0, 1, 2, 3), uint4(4, 5, 6, 7), uint4(8, 9, 0, 0), uint4(0, 0, 0, 0),
+	uint4(0, 1, 2, 3), uint4(4, 5, 6, 7), uint4(8, 9, 0, 0), uint4(0, 0, 0, 0),
+	uint4(0, 1, 2, 3), uint4(4, 5, 6, 7), uint4(8, 9, 0, 0), uint4(0, 0, 0, 0),
+	uint4(0, 1, 2, 3), uint4(4, 5, 6, 7), uint4(8, 9, 0, 0), uint4(0, 0, 0, 0),
+	uint4(10, 11, 12, 13), uint4(14, 15, 16, 17), uint4(18, 19, 10, 10), uint4(10, 10, 10, 10),
+	uint4(10, 11, 12, 13), uint4(14, 15, 16, 17), uint4(18, 19, 10, 10), uint4(10, 10, 10, 10),
+	uint4(10, 11, 12, 13), uint4(14, 15, 16, 17), uint4(18, 19, 10, 10), uint4(10, 10, 10, 10),
+	uint4(10, 11, 12, 13), uint4(14, 15, 16, 17), uint4(18, 19, 10, 10), uint4(10, 10, 10, 10),
+	uint4(10, 11, 12, 13), uint4(14, 15, 16, 17), uint4(18, 19, 10, 10), uint4(10, 10, 10, 10),
+	uint4(10, 11, 12, 13), uint4(14, 15, 16, 17), uint4(18, 19, 10, 10), uint4(10, 10, 10, 10),
+	uint4(20, 21, 22, 23), uint4(24, 25, 26, 27), uint4(28, 29, 20, 20), uint4(20, 20, 20, 20),
+	uint4(20, 21, 22, 23), uint4(24, 25, 26, 27), uint4(28, 29, 20, 20), uint4(20, 20, 20, 20),
+	uint4(20, 21, 22, 23), uint4(24, 25, 26, 27), uint4(28, 29, 20, 20), uint4(20, 20, 20, 20),
+	uint4(20, 21, 22, 23), uint4(24, 25, 26, 27), uint4(28, 29, 20, 20), uint4(20, 20, 20, 20),
+	uint4(20, 21, 22, 23), uint4(24, 25, 26, 27), uint4(28, 29, 20, 20), uint4(20, 20, 20, 20),
+	uint4(20, 21, 22, 23), uint4(24, 25, 26, 27), uint4(28, 29, 20, 20), uint4(20, 20, 20, 20),
+	uint4(30, 31, 32, 33), uint4(34, 35, 36, 37), uint4(38, 39, 30, 30), uint4(30, 30, 30, 30),
+	uint4(30, 31, 32, 33), uint4(34, 35, 36, 37), uint4(38, 39, 30, 30), uint4(30, 30, 30, 30),
+	uint4(30, 31, 32, 33), uint4(34, 35, 36, 37), uint4(38, 39, 30, 30), uint4(30, 30, 30, 30),
+	uint4(30, 31, 32, 33), uint4(34, 35, 36, 37), uint4(38, 39, 30, 30), uint4(30, 30, 30, 30),
+	uint4(30, 31, 32, 33), uint4(34, 35, 36, 37), uint4(38, 39, 30, 30), uint4(30, 30, 30, 30),
+	uint4(30, 31, 32, 33), uint4(34, 35, 36, 37), uint4(38, 39, 30, 30), uint4(30, 30, 30, 30),
+	uint4(40, 41, 42, 43), uint4(44, 45, 46, 47), uint4(48, 49, 40, 40), uint4(40, 40, 40, 40),
+	uint4(40, 41, 42, 43), uint4(44, 45, 46, 47), uint4(48, 49, 40, 40), uint4(40, 40, 40, 40),
+	uint4(40, 41, 42, 43), uint4(44, 45, 46, 47), uint4(48, 49, 40, 40), uint4(40, 40, 40, 40),
+	uint4(40, 41, 42, 43), uint4(44, 45, 46, 47), uint4(48, 49, 40, 40), uint4(40, 40, 40, 40),
+	uint4(40, 41, 42, 43), uint4(44, 45, 46, 47), uint4(48, 49, 40, 40), uint4(40, 40, 40, 40),
+	uint4(40, 41, 42, 43), uint4(44, 45, 46, 47), uint4(48, 49, 40, 40), uint4(40, 40, 40, 40),
+	uint4(0, 1, 2, 3), uint4(4, 5, 6, 7), uint4(8, 9, 0, 0), uint4(0, 0, 0, 0),
+	uint4(0, 1, 2, 3), uint4(4, 5, 6, 7), uint4(8, 9, 0, 0), uint4(0, 0, 0, 0),
+	uint4(0, 1, 2, 3), uint4(4, 5, 6, 7), uint4(8, 9, 0, 0), uint4(0, 0, 0, 0),
+	uint4(0, 1, 2, 3), uint4(4, 5, 6, 7), uint4(8, 9, 0, 0), uint4(0, 0, 0, 0),
+	uint4(0, 1, 2, 3), uint4(4, 5, 6, 7), uint4(8, 9, 0, 0), uint4(0, 0, 0, 0),
+	uint4(0, 1, 2, 3), uint4(4, 5, 6, 7), uint4(8, 9, 0, 0), uint4(0, 0, 0, 0),
+	uint4(0, 1, 2, 3), uint4(4, 5, 6, 7), uint4(8, 9, 0, 0), uint4(0, 0, 0, 0),
+	uint4(0, 1, 2, 3), uint4(4, 5, 6, 7), uint4(8, 9, 0, 0), uint4(0, 0, 0, 0),
+	uint4(10, 11, 12, 13), uint4(14, 15, 16, 17), uint4(18, 19, 10, 10), uint4(10, 10, 10, 10),
+	uint4(10, 11, 12, 13), uint4(14, 15, 16, 17), uint4(18, 19, 10, 10), uint4(10, 10, 10, 10),
+	uint4(10, 11, 12, 13), uint4(14, 15, 16, 17), uint4(18, 19, 10, 10), uint4(10, 10, 10, 10),
+	uint4(10, 11, 12, 13), uint4(14, 15, 16, 17), uint4(18, 19, 10, 10), uint4(10, 10, 10, 10),
+	uint4(10, 11, 12, 13), uint4(14, 15, 16, 17), uint4(18, 19, 10, 10), uint4(10, 10, 10, 10),
+	uint4(10, 11, 12, 13), uint4(14, 15, 16, 17), uint4(18, 19, 10, 10), uint4(10, 10, 10, 10),
+	uint4(10, 11, 12, 13), uint4(14, 15, 16, 17), uint4(18, 19, 10, 10), uint4(10, 10, 10, 10),
+	uint4(10, 11, 12, 13), uint4(14, 15, 16, 17), uint4(18, 19, 10, 10), uint4(10, 10, 10, 10),
+	uint4(20, 21, 22, 23), uint4(24, 25, 26, 27), uint4(28, 29, 20, 20), uint4(20, 20, 20, 20),
+	uint4(20, 21, 22, 23), uint4(24, 25, 26, 27), uint4(28, 29, 20, 20), uint4(20, 20, 20, 20),
+	uint4(20, 21, 22, 23), uint4(24, 25, 26, 27), uint4(28, 29, 20, 20), uint4(20, 20, 20, 20),
+	uint4(20, 21, 22, 23), uint4(24, 25, 26, 27), uint4(28, 29, 20, 20), uint4(20, 20, 20, 20),
+	uint4(20, 21, 22, 23), uint4(24, 25, 26, 27), uint4(28, 29, 20, 20), uint4(20, 20, 20, 20),
+	uint4(20, 21, 22, 23), uint4(24, 25, 26, 27), uint4(28, 29, 20, 20), uint4(20, 20, 20, 20),
+	uint4(20, 21, 22, 23), uint4(24, 25, 26, 27), uint4(28, 29, 20, 20), uint4(20, 20, 20, 20),
+	uint4(20, 21, 22, 23), uint4(24, 25, 26, 27), uint4(28, 29, 20, 20), uint4(20, 20, 20, 20),
+	uint4(30, 31, 32, 33), uint4(34, 35, 36, 37), uint4(38, 39, 30, 30), uint4(30, 30, 30, 30),
+	uint4(30, 31, 32, 33), uint4(34, 35, 36, 37), uint4(38, 39, 30, 30), uint4(30, 30, 30, 30),
+	uint4(30, 31, 32, 33), uint4(34, 35, 36, 37), uint4(38, 39, 30, 30), uint4(30, 30, 30, 30),
+	uint4(30, 31, 32, 33), uint4(34, 35, 36, 37), uint4(38, 39, 30, 30), uint4(30, 30, 30, 30),
+	uint4(30, 31, 32, 33), uint4(34, 35, 36, 37), uint4(38, 39, 30, 30), uint4(30, 30, 30, 30),
+	uint4(30, 31, 32, 33), uint4(34, 35, 36, 37), uint4(38, 39, 30, 30), uint4(30, 30, 30, 30),
+	uint4(30, 31, 32, 33), uint4(34, 35, 36, 37), uint4(38, 39, 30, 30), uint4(30, 30, 30, 30),
+	uint4(30, 31, 32, 33), uint4(34, 35, 36, 37), uint4(38, 39, 30, 30), uint4(30, 30, 30, 30),
+	uint4(40, 41, 42, 43), uint4(44, 45, 46, 47), uint4(48, 49, 40, 40), uint4(40, 40, 40, 40),
+	uint4(40, 41, 42, 43), uint4(44, 45, 46, 47), uint4(48, 49, 40, 40), uint4(40, 40, 40, 40),
+	uint4(40, 41, 42, 43), uint4(44, 45, 46, 47), uint4(48, 49, 40, 40), uint4(40, 40, 40, 40),
+	uint4(40, 41, 42, 43), uint4(44, 45, 46, 47), uint4(48, 49, 40, 40), uint4(40, 40, 40, 40),
+	uint4(40, 41, 42, 43), uint4(44, 45, 46, 47), uint4(48, 49, 40, 40), uint4(40, 40, 40, 40),
+	uint4(40, 41, 42, 43), uint4(44, 45, 46, 47), uint4(48, 49, 40, 40), uint4(40, 40, 40, 40),
+	uint4(40, 41, 42, 43), uint4(44, 45, 46, 47), uint4(48, 49, 40, 40), uint4(40, 40, 40, 40),
+	uint4(40, 41, 42, 43), uint4(44, 45, 46, 47), uint4(48, 49, 40, 40), uint4(40, 40, 40, 40),
+};
+static const float4 pseudo_inverse_wt_10x5[444] =
+{
+	float4(0.663937f, 0.41322f, 0.112359f, -0.138358f), float4(-0.0859952f, -0.0231601f, 0.0292024f, 0.0175898f),
+	float4(0.0389126f, 0.0406383f, -0.0567192f, -0.0430205f), float4(-0.0163546f, 0.0143901f, 0.0394991f, 0.0239155f),
+	float4(-0.138358f, 0.0638877f, 0.306582f, 0.508828f), float4(0.316249f, 0.0851544f, -0.107424f, -0.0647034f),
+	float4(0.0292829f, 0.0288639f, 0.0261111f, 0.0289654f), float4(-0.0207247f, -0.0456731f, -0.0344905f, 0.0306383f),
+	float4(0.0292024f, -0.0647285f, -0.107424f, 0.0851795f), float4(0.316304f, 0.508908f, 0.306519f, 0.0636514f),
+	float4(-0.138738f, 0.0287611f, 0.0258034f, 0.02917f), float4(-0.021794f, -0.0458916f, -0.0338474f, 0.0306383f),
+	float4(0.0176451f, 0.0292829f, -0.0232236f, -0.0862314f), float4(-0.138738f, 0.112629f, 0.41427f, 0.665638f),
+	float4(0.0366799f, 0.0321833f, 0.0119848f, -0.0294549f), float4(-0.0615249f, -0.0113684f, 0.0222377f, 0.0394448f),
+	float4(-0.169429f, -0.104603f, 0.670473f, 0.394235f), float4(0.130963f, -0.145275f, -0.0853242f, 0.318282f),
+	float4(0.24184f, 0.0930975f, -0.078365f, -0.0575079f), float4(-0.221429f, -0.134621f, -0.0518851f, 0.0559184f),
+	float4(-0.0807812f, -0.134794f, -0.0830829f, -0.145267f), float4(0.0834725f, 0.301409f, 0.530148f, 0.31114f),
+	float4(0.102474f, -0.116534f, 0.11642f, 0.254744f), float4(0.192725f, -0.0919274f, -0.170869f, -0.103828f),
+	float4(-0.0833824f, -0.135232f, -0.0804367f, -0.116533f), float4(0.103041f, 0.312246f, 0.531821f, 0.299749f),
+	float4(-0.153438f, 0.122355f, 0.255932f, 0.189157f), float4(-0.0841563f, -0.0966108f, -0.170869f, -0.101177f),
+	float4(0.0401466f, -0.110495f, -0.178968f, -0.0901477f), float4(-0.153429f, 0.138353f, 0.416441f, 0.708223f),
+	float4(-0.0647987f, 0.166209f, 0.345038f, 0.0354802f), float4(0.0622237f, -0.125362f, -0.22141f, 0.0559907f),
+	float4(0.0559907f, -0.22141f, -0.125362f, 0.0622237f), float4(0.0354802f, 0.345038f, 0.166209f, -0.0647987f),
+	float4(0.708223f, 0.416441f, 0.138353f, -0.153429f), float4(-0.0901477f, -0.178968f, -0.110495f, 0.0401466f),
+	float4(-0.101177f, -0.170869f, -0.0966108f, -0.0841563f), float4(0.189157f, 0.255932f, 0.122355f, -0.153438f),
+	float4(0.299749f, 0.531821f, 0.312246f, 0.103041f), float4(-0.116533f, -0.0804367f, -0.135232f, -0.0833824f),
+	float4(-0.103828f, -0.170869f, -0.0919274f, 0.192725f), float4(0.254744f, 0.11642f, -0.116534f, 0.102474f),
+	float4(0.31114f, 0.530148f, 0.301409f, 0.0834725f), float4(-0.145267f, -0.0830829f, -0.134794f, -0.0807812f),
+	float4(0.0559184f, -0.0518851f, -0.134621f, -0.221429f), float4(-0.0575079f, -0.078365f, 0.0930975f, 0.24184f),
+	float4(0.318282f, -0.0853242f, -0.145275f, 0.130963f), float4(0.394235f, 0.670473f, -0.104603f, -0.169429f),
+	float4(0.0394448f, 0.0222377f, -0.0113684f, -0.0615249f), float4(-0.0294549f, 0.0119848f, 0.0321833f, 0.0366799f),
+	float4(0.665638f, 0.41427f, 0.112629f, -0.138738f), float4(-0.0862314f, -0.0232236f, 0.0292829f, 0.0176451f),
+	float4(0.0306383f, -0.0338474f, -0.0458916f, -0.021794f), float4(0.02917f, 0.0258034f, 0.0287611f, -0.138738f),
+	float4(0.0636514f, 0.306519f, 0.508908f, 0.316304f), float4(0.0851795f, -0.107424f, -0.0647285f, 0.0292024f),
+	float4(0.0306383f, -0.0344905f, -0.0456731f, -0.0207247f), float4(0.0289654f, 0.0261111f, 0.0288639f, 0.0292829f),
+	float4(-0.0647034f, -0.107424f, 0.0851544f, 0.316249f), float4(0.508828f, 0.306582f, 0.0638877f, -0.138358f),
+	float4(0.0239155f, 0.0394991f, 0.0143901f, -0.0163546f), float4(-0.0430205f, -0.0567192f, 0.0406383f, 0.0389126f),
+	float4(0.0175898f, 0.0292024f, -0.0231601f, -0.0859952f), float4(-0.138358f, 0.112359f, 0.41322f, 0.663937f),
+	float4(0.806966f, 0.361729f, -0.083508f, -0.1263f), float4(0.00876986f, 0.0402884f, 0.00680623f, -0.0144002f),
+	float4(-0.00491713f, 0.0045659f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(-0.210719f, 0.226928f, 0.664574f, 0.473278f), float4(-0.0328629f, -0.150971f, -0.0255047f, 0.053961f),
+	float4(0.0184257f, -0.0171096f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.059421f, -0.0639919f, -0.187405f, 0.106533f), float4(0.63325f, 0.563274f, 0.0951583f, -0.201329f),
+	float4(-0.0687466f, 0.0638362f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(-0.0171096f, 0.0184257f, 0.053961f, -0.0306749f), float4(-0.182337f, 0.0167249f, 0.464611f, 0.660294f),
+	float4(0.225466f, -0.209361f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0045659f, -0.00491713f, -0.0144002f, 0.00818596f), float4(0.0486588f, -0.00446323f, -0.123987f, -0.0823658f),
+	float4(0.362119f, 0.806604f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.806966f, 0.361729f, -0.083508f, -0.1263f), float4(0.00876986f, 0.0402884f, 0.00680623f, -0.0144002f),
+	float4(-0.00491713f, 0.0045659f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(-0.210719f, 0.226928f, 0.664574f, 0.473278f), float4(-0.0328629f, -0.150971f, -0.0255047f, 0.053961f),
+	float4(0.0184257f, -0.0171096f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.059421f, -0.0639919f, -0.187405f, 0.106533f), float4(0.63325f, 0.563274f, 0.0951583f, -0.201329f),
+	float4(-0.0687466f, 0.0638362f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(-0.0171096f, 0.0184257f, 0.053961f, -0.0306749f), float4(-0.182337f, 0.0167249f, 0.464611f, 0.660294f),
+	float4(0.225466f, -0.209361f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0045659f, -0.00491713f, -0.0144002f, 0.00818596f), float4(0.0486588f, -0.00446323f, -0.123987f, -0.0823658f),
+	float4(0.362119f, 0.806604f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.806966f, 0.361729f, -0.083508f, -0.1263f), float4(0.00876986f, 0.0402884f, 0.00680623f, -0.0144002f),
+	float4(-0.00491713f, 0.0045659f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(-0.210719f, 0.226928f, 0.664574f, 0.473278f), float4(-0.0328629f, -0.150971f, -0.0255047f, 0.053961f),
+	float4(0.0184257f, -0.0171096f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.059421f, -0.0639919f, -0.187405f, 0.106533f), float4(0.63325f, 0.563274f, 0.0951583f, -0.201329f),
+	float4(-0.0687466f, 0.0638362f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(-0.0171096f, 0.0184257f, 0.053961f, -0.0306749f), float4(-0.182337f, 0.0167249f, 0.464611f, 0.660294f),
+	float4(0.225466f, -0.209361f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0045659f, -0.00491713f, -0.0144002f, 0.00818596f), float4(0.0486588f, -0.00446323f, -0.123987f, -0.0823658f),
+	float4(0.362119f, 0.806604f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.806966f, 0.361729f, -0.083508f, -0.1263f), float4(0.00876986f, 0.0402884f, 0.00680623f, -0.0144002f),
+	float4(-0.00491713f, 0.0045659f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(-0.210719f, 0.226928f, 0.664574f, 0.473278f), float4(-0.0328629f, -0.150971f, -0.0255047f, 0.053961f),
+	float4(0.0184257f, -0.0171096f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.059421f, -0.0639919f, -0.187405f, 0.106533f), float4(0.63325f, 0.563274f, 0.0951583f, -0.201329f),
+	float4(-0.0687466f, 0.0638362f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(-0.0171096f, 0.0184257f, 0.053961f, -0.0306749f), float4(-0.182337f, 0.0167249f, 0.464611f, 0.660294f),
+	float4(0.225466f, -0.209361f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0045659f, -0.00491713f, -0.0144002f, 0.00818596f), float4(0.0486588f, -0.00446323f, -0.123987f, -0.0823658f),
+	float4(0.362119f, 0.806604f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.806966f, 0.361729f, -0.083508f, -0.1263f), float4(0.00876986f, 0.0402884f, 0.00680623f, -0.0144002f),
+	float4(-0.00491713f, 0.0045659f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(-0.210719f, 0.226928f, 0.664574f, 0.473278f), float4(-0.0328629f, -0.150971f, -0.0255047f, 0.053961f),
+	float4(0.0184257f, -0.0171096f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.059421f, -0.0639919f, -0.187405f, 0.106533f), float4(0.63325f, 0.563274f, 0.0951583f, -0.201329f),
+	float4(-0.0687466f, 0.0638362f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(-0.0171096f, 0.0184257f, 0.053961f, -0.0306749f), float4(-0.182337f, 0.0167249f, 0.464611f, 0.660294f),
+	float4(0.225466f, -0.209361f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0045659f, -0.00491713f, -0.0144002f, 0.00818596f), float4(0.0486588f, -0.00446323f, -0.123987f, -0.0823658f),
+	float4(0.362119f, 0.806604f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.881097f, 0.271779f, -0.168531f, -0.0173142f), float4(0.0449523f, -0.00396968f, -0.0121205f, 0.00256117f),
+	float4(0.00274958f, -0.00120294f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(-0.202135f, 0.462023f, 0.815906f, 0.0838225f), float4(-0.217626f, 0.0192183f, 0.0586787f, -0.0123993f),
+	float4(-0.0133115f, 0.00582376f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0666954f, -0.152447f, -0.142f, 0.672005f), float4(0.757724f, -0.0669137f, -0.204306f, 0.0431715f),
+	float4(0.0463474f, -0.020277f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(-0.020277f, 0.0463474f, 0.0431715f, -0.204306f), float4(-0.00671648f, 0.747206f, 0.596858f, -0.126121f),
+	float4(-0.135399f, 0.0592372f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.00582376f, -0.0133115f, -0.0123993f, 0.0586787f), float4(0.00192904f, -0.214605f, 0.105405f, 0.811345f),
+	float4(0.457127f, -0.199993f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(-0.00120294f, 0.00274958f, 0.00256117f, -0.0121205f), float4(-0.000398458f, 0.0443283f, -0.0217723f, -0.167589f),
+	float4(0.27279f, 0.880654f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.881097f, 0.271779f, -0.168531f, -0.0173142f), float4(0.0449523f, -0.00396968f, -0.0121205f, 0.00256117f),
+	float4(0.00274958f, -0.00120294f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(-0.202135f, 0.462023f, 0.815906f, 0.0838225f), float4(-0.217626f, 0.0192183f, 0.0586787f, -0.0123993f),
+	float4(-0.0133115f, 0.00582376f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0666954f, -0.152447f, -0.142f, 0.672005f), float4(0.757724f, -0.0669137f, -0.204306f, 0.0431715f),
+	float4(0.0463474f, -0.020277f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(-0.020277f, 0.0463474f, 0.0431715f, -0.204306f), float4(-0.00671648f, 0.747206f, 0.596858f, -0.126121f),
+	float4(-0.135399f, 0.0592372f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.00582376f, -0.0133115f, -0.0123993f, 0.0586787f), float4(0.00192904f, -0.214605f, 0.105405f, 0.811345f),
+	float4(0.457127f, -0.199993f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(-0.00120294f, 0.00274958f, 0.00256117f, -0.0121205f), float4(-0.000398458f, 0.0443283f, -0.0217723f, -0.167589f),
+	float4(0.27279f, 0.880654f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.881097f, 0.271779f, -0.168531f, -0.0173142f), float4(0.0449523f, -0.00396968f, -0.0121205f, 0.00256117f),
+	float4(0.00274958f, -0.00120294f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(-0.202135f, 0.462023f, 0.815906f, 0.0838225f), float4(-0.217626f, 0.0192183f, 0.0586787f, -0.0123993f),
+	float4(-0.0133115f, 0.00582376f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0666954f, -0.152447f, -0.142f, 0.672005f), float4(0.757724f, -0.0669137f, -0.204306f, 0.0431715f),
+	float4(0.0463474f, -0.020277f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(-0.020277f, 0.0463474f, 0.0431715f, -0.204306f), float4(-0.00671648f, 0.747206f, 0.596858f, -0.126121f),
+	float4(-0.135399f, 0.0592372f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.00582376f, -0.0133115f, -0.0123993f, 0.0586787f), float4(0.00192904f, -0.214605f, 0.105405f, 0.811345f),
+	float4(0.457127f, -0.199993f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(-0.00120294f, 0.00274958f, 0.00256117f, -0.0121205f), float4(-0.000398458f, 0.0443283f, -0.0217723f, -0.167589f),
+	float4(0.27279f, 0.880654f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.881097f, 0.271779f, -0.168531f, -0.0173142f), float4(0.0449523f, -0.00396968f, -0.0121205f, 0.00256117f),
+	float4(0.00274958f, -0.00120294f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(-0.202135f, 0.462023f, 0.815906f, 0.0838225f), float4(-0.217626f, 0.0192183f, 0.0586787f, -0.0123993f),
+	float4(-0.0133115f, 0.00582376f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0666954f, -0.152447f, -0.142f, 0.672005f), float4(0.757724f, -0.0669137f, -0.204306f, 0.0431715f),
+	float4(0.0463474f, -0.020277f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(-0.020277f, 0.0463474f, 0.0431715f, -0.204306f), float4(-0.00671648f, 0.747206f, 0.596858f, -0.126121f),
+	float4(-0.135399f, 0.0592372f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.00582376f, -0.0133115f, -0.0123993f, 0.0586787f), float4(0.00192904f, -0.214605f, 0.105405f, 0.811345f),
+	float4(0.457127f, -0.199993f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(-0.00120294f, 0.00274958f, 0.00256117f, -0.0121205f), float4(-0.000398458f, 0.0443283f, -0.0217723f, -0.167589f),
+	float4(0.27279f, 0.880654f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.881097f, 0.271779f, -0.168531f, -0.0173142f), float4(0.0449523f, -0.00396968f, -0.0121205f, 0.00256117f),
+	float4(0.00274958f, -0.00120294f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(-0.202135f, 0.462023f, 0.815906f, 0.0838225f), float4(-0.217626f, 0.0192183f, 0.0586787f, -0.0123993f),
+	float4(-0.0133115f, 0.00582376f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0666954f, -0.152447f, -0.142f, 0.672005f), float4(0.757724f, -0.0669137f, -0.204306f, 0.0431715f),
+	float4(0.0463474f, -0.020277f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(-0.020277f, 0.0463474f, 0.0431715f, -0.204306f), float4(-0.00671648f, 0.747206f, 0.596858f, -0.126121f),
+	float4(-0.135399f, 0.0592372f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.00582376f, -0.0133115f, -0.0123993f, 0.0586787f), float4(0.00192904f, -0.214605f, 0.105405f, 0.811345f),
+	float4(0.457127f, -0.199993f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(-0.00120294f, 0.00274958f, 0.00256117f, -0.0121205f), float4(-0.000398458f, 0.0443283f, -0.0217723f, -0.167589f),
+	float4(0.27279f, 0.880654f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.989975f, 0.0400995f, -0.068742f, 0.0562435f), float4(-0.0204703f, 0.00268365f, 0.000673908f, -0.000823665f),
+	float4(0.000480471f, -0.000120118f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(-0.276526f, 1.1061f, 0.389538f, -0.318713f), float4(0.115999f, -0.0152074f, -0.00381881f, 0.00466744f),
+	float4(-0.00272267f, 0.000680668f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0928675f, -0.37147f, 0.636806f, 0.933523f), float4(-0.339764f, 0.0445429f, 0.0111854f, -0.0136711f),
+	float4(0.00797481f, -0.0019937f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(-0.0243293f, 0.0973173f, -0.16683f, 0.136497f), float4(1.11499f, -0.146175f, -0.0367068f, 0.0448639f),
+	float4(-0.0261706f, 0.00654265f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.00654265f, -0.0261706f, 0.0448639f, -0.0367068f), float4(-0.146175f, 1.11499f, 0.136497f, -0.16683f),
+	float4(0.0973173f, -0.0243293f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(-0.0019937f, 0.00797481f, -0.0136711f, 0.0111854f), float4(0.0445429f, -0.339764f, 0.933523f, 0.636806f),
+	float4(-0.37147f, 0.0928675f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.000680668f, -0.00272267f, 0.00466744f, -0.00381881f), float4(-0.0152074f, 0.115999f, -0.318713f, 0.389538f),
+	float4(1.1061f, -0.276526f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(-0.000120118f, 0.000480471f, -0.000823665f, 0.000673908f), float4(0.00268365f, -0.0204703f, 0.0562435f, -0.068742f),
+	float4(0.0400995f, 0.989975f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.989975f, 0.0400995f, -0.068742f, 0.0562435f), float4(-0.0204703f, 0.00268365f, 0.000673908f, -0.000823665f),
+	float4(0.000480471f, -0.000120118f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(-0.276526f, 1.1061f, 0.389538f, -0.318713f), float4(0.115999f, -0.0152074f, -0.00381881f, 0.00466744f),
+	float4(-0.00272267f, 0.000680668f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0928675f, -0.37147f, 0.636806f, 0.933523f), float4(-0.339764f, 0.0445429f, 0.0111854f, -0.0136711f),
+	float4(0.00797481f, -0.0019937f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(-0.0243293f, 0.0973173f, -0.16683f, 0.136497f), float4(1.11499f, -0.146175f, -0.0367068f, 0.0448639f),
+	float4(-0.0261706f, 0.00654265f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.00654265f, -0.0261706f, 0.0448639f, -0.0367068f), float4(-0.146175f, 1.11499f, 0.136497f, -0.16683f),
+	float4(0.0973173f, -0.0243293f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(-0.0019937f, 0.00797481f, -0.0136711f, 0.0111854f), float4(0.0445429f, -0.339764f, 0.933523f, 0.636806f),
+	float4(-0.37147f, 0.0928675f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.000680668f, -0.00272267f, 0.00466744f, -0.00381881f), float4(-0.0152074f, 0.115999f, -0.318713f, 0.389538f),
+	float4(1.1061f, -0.276526f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(-0.000120118f, 0.000480471f, -0.000823665f, 0.000673908f), float4(0.00268365f, -0.0204703f, 0.0562435f, -0.068742f),
+	float4(0.0400995f, 0.989975f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.989975f, 0.0400995f, -0.068742f, 0.0562435f), float4(-0.0204703f, 0.00268365f, 0.000673908f, -0.000823665f),
+	float4(0.000480471f, -0.000120118f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(-0.276526f, 1.1061f, 0.389538f, -0.318713f), float4(0.115999f, -0.0152074f, -0.00381881f, 0.00466744f),
+	float4(-0.00272267f, 0.000680668f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0928675f, -0.37147f, 0.636806f, 0.933523f), float4(-0.339764f, 0.0445429f, 0.0111854f, -0.0136711f),
+	float4(0.00797481f, -0.0019937f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(-0.0243293f, 0.0973173f, -0.16683f, 0.136497f), float4(1.11499f, -0.146175f, -0.0367068f, 0.0448639f),
+	float4(-0.0261706f, 0.00654265f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.00654265f, -0.0261706f, 0.0448639f, -0.0367068f), float4(-0.146175f, 1.11499f, 0.136497f, -0.16683f),
+	float4(0.0973173f, -0.0243293f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(-0.0019937f, 0.00797481f, -0.0136711f, 0.0111854f), float4(0.0445429f, -0.339764f, 0.933523f, 0.636806f),
+	float4(-0.37147f, 0.0928675f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.000680668f, -0.00272267f, 0.00466744f, -0.00381881f), float4(-0.0152074f, 0.115999f, -0.318713f, 0.389538f),
+	float4(1.1061f, -0.276526f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(-0.000120118f, 0.000480471f, -0.000823665f, 0.000673908f), float4(0.00268365f, -0.0204703f, 0.0562435f, -0.068742f),
+	float4(0.0400995f, 0.989975f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.989975f, 0.0400995f, -0.068742f, 0.0562435f), float4(-0.0204703f, 0.00268365f, 0.000673908f, -0.000823665f),
+	float4(0.000480471f, -0.000120118f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(-0.276526f, 1.1061f, 0.389538f, -0.318713f), float4(0.115999f, -0.0152074f, -0.00381881f, 0.00466744f),
+	float4(-0.00272267f, 0.000680668f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0928675f, -0.37147f, 0.636806f, 0.933523f), float4(-0.339764f, 0.0445429f, 0.0111854f, -0.0136711f),
+	float4(0.00797481f, -0.0019937f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(-0.0243293f, 0.0973173f, -0.16683f, 0.136497f), float4(1.11499f, -0.146175f, -0.0367068f, 0.0448639f),
+	float4(-0.0261706f, 0.00654265f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.00654265f, -0.0261706f, 0.0448639f, -0.0367068f), float4(-0.146175f, 1.11499f, 0.136497f, -0.16683f),
+	float4(0.0973173f, -0.0243293f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(-0.0019937f, 0.00797481f, -0.0136711f, 0.0111854f), float4(0.0445429f, -0.339764f, 0.933523f, 0.636806f),
+	float4(-0.37147f, 0.0928675f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.000680668f, -0.00272267f, 0.00466744f, -0.00381881f), float4(-0.0152074f, 0.115999f, -0.318713f, 0.389538f),
+	float4(1.1061f, -0.276526f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(-0.000120118f, 0.000480471f, -0.000823665f, 0.000673908f), float4(0.00268365f, -0.0204703f, 0.0562435f, -0.068742f),
+	float4(0.0400995f, 0.989975f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.989975f, 0.0400995f, -0.068742f, 0.0562435f), float4(-0.0204703f, 0.00268365f, 0.000673908f, -0.000823665f),
+	float4(0.000480471f, -0.000120118f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(-0.276526f, 1.1061f, 0.389538f, -0.318713f), float4(0.115999f, -0.0152074f, -0.00381881f, 0.00466744f),
+	float4(-0.00272267f, 0.000680668f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0928675f, -0.37147f, 0.636806f, 0.933523f), float4(-0.339764f, 0.0445429f, 0.0111854f, -0.0136711f),
+	float4(0.00797481f, -0.0019937f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(-0.0243293f, 0.0973173f, -0.16683f, 0.136497f), float4(1.11499f, -0.146175f, -0.0367068f, 0.0448639f),
+	float4(-0.0261706f, 0.00654265f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.00654265f, -0.0261706f, 0.0448639f, -0.0367068f), float4(-0.146175f, 1.11499f, 0.136497f, -0.16683f),
+	float4(0.0973173f, -0.0243293f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(-0.0019937f, 0.00797481f, -0.0136711f, 0.0111854f), float4(0.0445429f, -0.339764f, 0.933523f, 0.636806f),
+	float4(-0.37147f, 0.0928675f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.000680668f, -0.00272267f, 0.00466744f, -0.00381881f), float4(-0.0152074f, 0.115999f, -0.318713f, 0.389538f),
+	float4(1.1061f, -0.276526f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(-0.000120118f, 0.000480471f, -0.000823665f, 0.000673908f), float4(0.00268365f, -0.0204703f, 0.0562435f, -0.068742f),
+	float4(0.0400995f, 0.989975f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+};
+
+#define WEIGHT_GRID_COUNT_10X6 4
+#define MAX_GRID_WEIGHTS_10X6 48
+static const uint4 weight_grids_10x6[WEIGHT_GRID_COUNT_10X6] = { uint4(4, 4, 0, 0), uint4(5, 5, 16, 60), uint4(6, 6, 41, 120), uint4(8, 6, 77, 180) };
+static const uint4 decimation_idx_10x6[125] =
+{
+	uint4(0, 1, 10, 11), uint4(3, 4, 13, 14), uint4(6, 7, 16, 17), uint4(9, 9, 19, 19),
+	uint4(10, 11, 20, 21), uint4(13, 14, 23, 24), uint4(16, 17, 26, 27), uint4(19, 19, 29, 29),
+	uint4(30, 31, 40, 41), uint4(33, 34, 43, 44), uint4(36, 37, 46, 47), uint4(39, 39, 49, 49),
+	uint4(50, 51, 50, 51), uint4(53, 54, 53, 54), uint4(56, 57, 56, 57), uint4(59, 59, 59, 59),
+	uint4(0, 1, 10, 11), uint4(2, 3, 12, 13), uint4(4, 5, 14, 15), uint4(6, 7, 16, 17),
+	uint4(9, 9, 19, 19), uint4(10, 11, 20, 21), uint4(12, 13, 22, 23), uint4(14, 15, 24, 25),
+	uint4(16, 17, 26, 27), uint4(19, 19, 29, 29), uint4(20, 21, 30, 31), uint4(22, 23, 32, 33),
+	uint4(24, 25, 34, 35), uint4(26, 27, 36, 37), uint4(29, 29, 39, 39), uint4(30, 31, 40, 41),
+	uint4(32, 33, 42, 43), uint4(34, 35, 44, 45), uint4(36, 37, 46, 47), uint4(39, 39, 49, 49),
+	uint4(50, 51, 50, 51), uint4(52, 53, 52, 53), uint4(54, 55, 54, 55), uint4(56, 57, 56, 57),
+	uint4(59, 59, 59, 59), uint4(0, 1, 10, 11), uint4(1, 2, 11, 12), uint4(3, 4, 13, 14),
+	uint4(5, 6, 15, 16), uint4(7, 8, 17, 18), uint4(9, 9, 19, 19), uint4(10, 11, 20, 21),
+	uint4(11, 12, 21, 22), uint4(13, 14, 23, 24), uint4(15, 16, 25, 26), uint4(17, 18, 27, 28),
+	uint4(19, 19, 29, 29), uint4(20, 21, 30, 31), uint4(21, 22, 31, 32), uint4(23, 24, 33, 34),
+	uint4(25, 26, 35, 36), uint4(27, 28, 37, 38), uint4(29, 29, 39, 39), uint4(30, 31, 40, 41),
+	uint4(31, 32, 41, 42), uint4(33, 34, 43, 44), uint4(35, 36, 45, 46), uint4(37, 38, 47, 48),
+	uint4(39, 39, 49, 49), uint4(40, 41, 50, 51), uint4(41, 42, 51, 52), uint4(43, 44, 53, 54),
+	uint4(45, 46, 55, 56), uint4(47, 48, 57, 58), uint4(49, 49, 59, 59), uint4(50, 51, 50, 51),
+	uint4(51, 52, 51, 52), uint4(53, 54, 53, 54), uint4(55, 56, 55, 56), uint4(57, 58, 57, 58),
+	uint4(59, 59, 59, 59), uint4(0, 1, 10, 11), uint4(1, 2, 11, 12), uint4(2, 3, 12, 13),
+	uint4(3, 4, 13, 14), uint4(5, 6, 15, 16), uint4(6, 7, 16, 17), uint4(7, 8, 17, 18),
+	uint4(9, 9, 19, 19), uint4(10, 11, 20, 21), uint4(11, 12, 21, 22), uint4(12, 13, 22, 23),
+	uint4(13, 14, 23, 24), uint4(15, 16, 25, 26), uint4(16, 17, 26, 27), uint4(17, 18, 27, 28),
+	uint4(19, 19, 29, 29), uint4(20, 21, 30, 31), uint4(21, 22, 31, 32), uint4(22, 23, 32, 33),
+	uint4(23, 24, 33, 34), uint4(25, 26, 35, 36), uint4(26, 27, 36, 37), uint4(27, 28, 37, 38),
+	uint4(29, 29, 39, 39), uint4(30, 31, 40, 41), uint4(31, 32, 41, 42), uint4(32, 33, 42, 43),
+	uint4(33, 34, 43, 44), uint4(35, 36, 45, 46), uint4(36, 37, 46, 47), uint4(37, 38, 47, 48),
+	uint4(39, 39, 49, 49), uint4(40, 41, 50, 51), uint4(41, 42, 51, 52), uint4(42, 43, 52, 53),
+	uint4(43, 44, 53, 54), uint4(45, 46, 55, 56), uint4(46, 47, 56, 57), uint4(47, 48, 57, 58),
+	uint4(49, 49, 59, 59), uint4(50, 51, 50, 51), uint4(51, 52, 51, 52), uint4(52, 53, 52, 53),
+	uint4(53, 54, 53, 54), uint4(55, 56, 55, 56), uint4(56, 57, 56, 57), uint4(57, 58, 57, 58),
+	uint4(59, 59, 59, 59),
+};
+static const float4 decimation_wt_10x6[125] =
+{
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.333333373f, 0.0f, 0.666666627f, 0.0f), float4(0.333333373f, 0.0f, 0.666666627f, 0.0f),
+	float4(0.333333373f, 0.0f, 0.666666627f, 0.0f), float4(0.333333373f, 0.0f, 0.666666627f, 0.0f),
+	float4(0.666666746f, 0.0f, 0.333333254f, 0.0f), float4(0.666666746f, 0.0f, 0.333333254f, 0.0f),
+	float4(0.666666746f, 0.0f, 0.333333254f, 0.0f), float4(0.666666746f, 0.0f, 0.333333254f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.75f, 0.25f, 0.0f, 0.0f),
+	float4(0.5f, 0.5f, 0.0f, 0.0f), float4(0.25f, 0.75f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.75f, 0.0f, 0.25f, 0.0f),
+	float4(0.5625f, 0.1875f, 0.1875f, 0.0625f), float4(0.375f, 0.375f, 0.125f, 0.125f),
+	float4(0.1875f, 0.5625f, 0.0625f, 0.1875f), float4(0.75f, 0.0f, 0.25f, 0.0f),
+	float4(0.5f, 0.0f, 0.5f, 0.0f), float4(0.375f, 0.125f, 0.375f, 0.125f),
+	float4(0.25f, 0.25f, 0.25f, 0.25f), float4(0.125f, 0.375f, 0.125f, 0.375f),
+	float4(0.5f, 0.0f, 0.5f, 0.0f), float4(0.25f, 0.0f, 0.75f, 0.0f),
+	float4(0.1875f, 0.0625f, 0.5625f, 0.1875f), float4(0.125f, 0.125f, 0.375f, 0.375f),
+	float4(0.0625f, 0.1875f, 0.1875f, 0.5625f), float4(0.25f, 0.0f, 0.75f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.75f, 0.25f, 0.0f, 0.0f),
+	float4(0.5f, 0.5f, 0.0f, 0.0f), float4(0.25f, 0.75f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.200000048f, 0.799999952f, 0.0f, 0.0f), float4(0.400000095f, 0.599999905f, 0.0f, 0.0f),
+	float4(0.599999905f, 0.400000095f, 0.0f, 0.0f), float4(0.800000191f, 0.199999809f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.200000048f, 0.799999952f, 0.0f, 0.0f), float4(0.400000095f, 0.599999905f, 0.0f, 0.0f),
+	float4(0.599999905f, 0.400000095f, 0.0f, 0.0f), float4(0.800000191f, 0.199999809f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.200000048f, 0.799999952f, 0.0f, 0.0f), float4(0.400000095f, 0.599999905f, 0.0f, 0.0f),
+	float4(0.599999905f, 0.400000095f, 0.0f, 0.0f), float4(0.800000191f, 0.199999809f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.200000048f, 0.799999952f, 0.0f, 0.0f), float4(0.400000095f, 0.599999905f, 0.0f, 0.0f),
+	float4(0.599999905f, 0.400000095f, 0.0f, 0.0f), float4(0.800000191f, 0.199999809f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.200000048f, 0.799999952f, 0.0f, 0.0f), float4(0.400000095f, 0.599999905f, 0.0f, 0.0f),
+	float4(0.599999905f, 0.400000095f, 0.0f, 0.0f), float4(0.800000191f, 0.199999809f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.200000048f, 0.799999952f, 0.0f, 0.0f), float4(0.400000095f, 0.599999905f, 0.0f, 0.0f),
+	float4(0.599999905f, 0.400000095f, 0.0f, 0.0f), float4(0.800000191f, 0.199999809f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.714285731f, 0.285714269f, 0.0f, 0.0f), float4(0.428571463f, 0.571428537f, 0.0f, 0.0f),
+	float4(0.142857075f, 0.857142925f, 0.0f, 0.0f), float4(0.857142925f, 0.142857075f, 0.0f, 0.0f),
+	float4(0.571428776f, 0.428571224f, 0.0f, 0.0f), float4(0.285714149f, 0.714285851f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.714285731f, 0.285714269f, 0.0f, 0.0f), float4(0.428571463f, 0.571428537f, 0.0f, 0.0f),
+	float4(0.142857075f, 0.857142925f, 0.0f, 0.0f), float4(0.857142925f, 0.142857075f, 0.0f, 0.0f),
+	float4(0.571428776f, 0.428571224f, 0.0f, 0.0f), float4(0.285714149f, 0.714285851f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.714285731f, 0.285714269f, 0.0f, 0.0f), float4(0.428571463f, 0.571428537f, 0.0f, 0.0f),
+	float4(0.142857075f, 0.857142925f, 0.0f, 0.0f), float4(0.857142925f, 0.142857075f, 0.0f, 0.0f),
+	float4(0.571428776f, 0.428571224f, 0.0f, 0.0f), float4(0.285714149f, 0.714285851f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.714285731f, 0.285714269f, 0.0f, 0.0f), float4(0.428571463f, 0.571428537f, 0.0f, 0.0f),
+	float4(0.142857075f, 0.857142925f, 0.0f, 0.0f), float4(0.857142925f, 0.142857075f, 0.0f, 0.0f),
+	float4(0.571428776f, 0.428571224f, 0.0f, 0.0f), float4(0.285714149f, 0.714285851f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.714285731f, 0.285714269f, 0.0f, 0.0f), float4(0.428571463f, 0.571428537f, 0.0f, 0.0f),
+	float4(0.142857075f, 0.857142925f, 0.0f, 0.0f), float4(0.857142925f, 0.142857075f, 0.0f, 0.0f),
+	float4(0.571428776f, 0.428571224f, 0.0f, 0.0f), float4(0.285714149f, 0.714285851f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.714285731f, 0.285714269f, 0.0f, 0.0f), float4(0.428571463f, 0.571428537f, 0.0f, 0.0f),
+	float4(0.142857075f, 0.857142925f, 0.0f, 0.0f), float4(0.857142925f, 0.142857075f, 0.0f, 0.0f),
+	float4(0.571428776f, 0.428571224f, 0.0f, 0.0f), float4(0.285714149f, 0.714285851f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f),
+};
+static const uint4 infill_idx_10x6[240] =
+{
+	uint4(0, 0, 0, 0), uint4(0, 1, 0, 0), uint4(0, 1, 0, 0), uint4(1, 1, 1, 1),
+	uint4(1, 2, 1, 1), uint4(1, 2, 1, 1), uint4(2, 2, 2, 2), uint4(2, 3, 2, 2),
+	uint4(2, 3, 2, 2), uint4(3, 3, 3, 3), uint4(0, 0, 4, 0), uint4(0, 1, 4, 5),
+	uint4(0, 1, 4, 5), uint4(1, 1, 5, 1), uint4(1, 2, 5, 6), uint4(1, 2, 5, 6),
+	uint4(2, 2, 6, 2), uint4(2, 3, 6, 7), uint4(2, 3, 6, 7), uint4(3, 3, 7, 3),
+	uint4(4, 4, 8, 4), uint4(4, 5, 8, 9), uint4(4, 5, 8, 9), uint4(5, 5, 9, 5),
+	uint4(5, 6, 9, 10), uint4(5, 6, 9, 10), uint4(6, 6, 10, 6), uint4(6, 7, 10, 11),
+	uint4(6, 7, 10, 11), uint4(7, 7, 11, 7), uint4(4, 4, 8, 4), uint4(4, 5, 8, 9),
+	uint4(4, 5, 8, 9), uint4(5, 5, 9, 5), uint4(5, 6, 9, 10), uint4(5, 6, 9, 10),
+	uint4(6, 6, 10, 6), uint4(6, 7, 10, 11), uint4(6, 7, 10, 11), uint4(7, 7, 11, 7),
+	uint4(8, 8, 12, 8), uint4(8, 9, 12, 13), uint4(8, 9, 12, 13), uint4(9, 9, 13, 9),
+	uint4(9, 10, 13, 14), uint4(9, 10, 13, 14), uint4(10, 10, 14, 10), uint4(10, 11, 14, 15),
+	uint4(10, 11, 14, 15), uint4(11, 11, 15, 11), uint4(12, 12, 12, 12), uint4(12, 13, 12, 12),
+	uint4(12, 13, 12, 12), uint4(13, 13, 13, 13), uint4(13, 14, 13, 13), uint4(13, 14, 13, 13),
+	uint4(14, 14, 14, 14), uint4(14, 15, 14, 14), uint4(14, 15, 14, 14), uint4(15, 15, 15, 15),
+	uint4(0, 0, 0, 0), uint4(0, 1, 0, 0), uint4(0, 1, 0, 0), uint4(1, 2, 1, 1),
+	uint4(1, 2, 1, 1), uint4(2, 3, 2, 2), uint4(2, 3, 2, 2), uint4(3, 4, 3, 3),
+	uint4(3, 4, 3, 3), uint4(4, 4, 4, 4), uint4(0, 0, 5, 0), uint4(0, 1, 5, 6),
+	uint4(0, 1, 5, 6), uint4(1, 2, 6, 7), uint4(1, 2, 6, 7), uint4(2, 3, 7, 8),
+	uint4(2, 3, 7, 8), uint4(3, 3, 8, 9), uint4(3, 4, 8, 9), uint4(4, 4, 9, 4),
+	uint4(5, 5, 10, 5), uint4(5, 6, 10, 11), uint4(5, 6, 10, 11), uint4(6, 7, 11, 12),
+	uint4(6, 7, 11, 12), uint4(7, 8, 12, 13), uint4(7, 8, 12, 13), uint4(8, 9, 13, 14),
+	uint4(8, 9, 13, 14), uint4(9, 9, 14, 9), uint4(10, 10, 15, 10), uint4(10, 11, 15, 16),
+	uint4(10, 11, 15, 16), uint4(11, 12, 16, 17), uint4(11, 12, 16, 17), uint4(12, 13, 17, 18),
+	uint4(12, 13, 17, 18), uint4(13, 14, 18, 19), uint4(13, 14, 18, 19), uint4(14, 14, 19, 14),
+	uint4(15, 15, 20, 15), uint4(15, 16, 20, 21), uint4(15, 16, 15, 21), uint4(16, 17, 21, 22),
+	uint4(16, 17, 21, 22), uint4(17, 18, 22, 23), uint4(17, 18, 22, 23), uint4(18, 19, 23, 18),
+	uint4(18, 19, 23, 24), uint4(19, 19, 24, 19), uint4(20, 20, 20, 20), uint4(20, 21, 20, 20),
+	uint4(20, 21, 20, 20), uint4(21, 22, 21, 21), uint4(21, 22, 21, 21), uint4(22, 23, 22, 22),
+	uint4(22, 23, 22, 22), uint4(23, 24, 23, 23), uint4(23, 24, 23, 23), uint4(24, 24, 24, 24),
+	uint4(0, 0, 0, 0), uint4(0, 1, 0, 0), uint4(1, 2, 1, 1), uint4(1, 2, 1, 1),
+	uint4(2, 3, 2, 2), uint4(2, 3, 2, 2), uint4(3, 4, 3, 3), uint4(3, 4, 3, 3),
+	uint4(4, 5, 4, 4), uint4(5, 5, 5, 5), uint4(6, 6, 6, 6), uint4(6, 7, 6, 6),
+	uint4(7, 8, 7, 7), uint4(7, 8, 7, 7), uint4(8, 9, 8, 8), uint4(8, 9, 8, 8),
+	uint4(9, 10, 9, 9), uint4(9, 10, 9, 9), uint4(10, 11, 10, 10), uint4(11, 11, 11, 11),
+	uint4(12, 12, 12, 12), uint4(12, 13, 12, 12), uint4(13, 14, 13, 13), uint4(13, 14, 13, 13),
+	uint4(14, 15, 14, 14), uint4(14, 15, 14, 14), uint4(15, 16, 15, 15), uint4(15, 16, 15, 15),
+	uint4(16, 17, 16, 16), uint4(17, 17, 17, 17), uint4(18, 18, 18, 18), uint4(18, 19, 18, 18),
+	uint4(19, 20, 19, 19), uint4(19, 20, 19, 19), uint4(20, 21, 20, 20), uint4(20, 21, 20, 20),
+	uint4(21, 22, 21, 21), uint4(21, 22, 21, 21), uint4(22, 23, 22, 22), uint4(23, 23, 23, 23),
+	uint4(24, 24, 24, 24), uint4(24, 25, 24, 24), uint4(25, 26, 25, 25), uint4(25, 26, 25, 25),
+	uint4(26, 27, 26, 26), uint4(26, 27, 26, 26), uint4(27, 28, 27, 27), uint4(27, 28, 27, 27),
+	uint4(28, 29, 28, 28), uint4(29, 29, 29, 29), uint4(30, 30, 30, 30), uint4(30, 31, 30, 30),
+	uint4(31, 32, 31, 31), uint4(31, 32, 31, 31), uint4(32, 33, 32, 32), uint4(32, 33, 32, 32),
+	uint4(33, 34, 33, 33), uint4(33, 34, 33, 33), uint4(34, 35, 34, 34), uint4(35, 35, 35, 35),
+	uint4(0, 0, 0, 0), uint4(0, 1, 0, 0), uint4(1, 2, 1, 1), uint4(2, 3, 2, 2),
+	uint4(3, 4, 3, 3), uint4(3, 4, 3, 3), uint4(4, 5, 4, 4), uint4(5, 6, 5, 5),
+	uint4(6, 7, 6, 6), uint4(7, 7, 7, 7), uint4(8, 8, 8, 8), uint4(8, 9, 8, 8),
+	uint4(9, 10, 9, 9), uint4(10, 11, 10, 10), uint4(11, 12, 11, 11), uint4(11, 12, 11, 11),
+	uint4(12, 13, 12, 12), uint4(13, 14, 13, 13), uint4(14, 15, 14, 14), uint4(15, 15, 15, 15),
+	uint4(16, 16, 16, 16), uint4(16, 17, 16, 16), uint4(17, 18, 17, 17), uint4(18, 19, 18, 18),
+	uint4(19, 20, 19, 19), uint4(19, 20, 19, 19), uint4(20, 21, 20, 20), uint4(21, 22, 21, 21),
+	uint4(22, 23, 22, 22), uint4(23, 23, 23, 23), uint4(24, 24, 24, 24), uint4(24, 25, 24, 24),
+	uint4(25, 26, 25, 25), uint4(26, 27, 26, 26), uint4(27, 28, 27, 27), uint4(27, 28, 27, 27),
+	uint4(28, 29, 28, 28), uint4(29, 30, 29, 29), uint4(30, 31, 30, 30), uint4(31, 31, 31, 31),
+	uint4(32, 32, 32, 32), uint4(32, 33, 32, 32), uint4(33, 34, 33, 33), uint4(34, 35, 34, 34),
+	uint4(35, 36, 35, 35), uint4(35, 36, 35, 35), uint4(36, 37, 36, 36), uint4(37, 38, 37, 37),
+	uint4(38, 39, 38, 38), uint4(39, 39, 39, 39), uint4(40, 40, 40, 40), uint4(40, 41, 40, 40),
+	uint4(41, 42, 41, 41), uint4(42, 43, 42, 42), uint4(43, 44, 43, 43), uint4(43, 44, 43, 43),
+	uint4(44, 45, 44, 44), uint4(45, 46, 45, 45), uint4(46, 47, 46, 46), uint4(47, 47, 47, 47),
+};
+static const float4 infill_wt_10x6[240] =
+{
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.6875f, 0.3125f, 0.0f, 0.0f), float4(0.3125f, 0.6875f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.6875f, 0.3125f, 0.0f, 0.0f), float4(0.3125f, 0.6875f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.6875f, 0.3125f, 0.0f, 0.0f),
+	float4(0.3125f, 0.6875f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.375f, 0.0f, 0.625f, 0.0f), float4(0.25f, 0.125f, 0.4375f, 0.1875f),
+	float4(0.125f, 0.25f, 0.1875f, 0.4375f), float4(0.375f, 0.0f, 0.625f, 0.0f), float4(0.25f, 0.125f, 0.4375f, 0.1875f), float4(0.125f, 0.25f, 0.1875f, 0.4375f),
+	float4(0.375f, 0.0f, 0.625f, 0.0f), float4(0.25f, 0.125f, 0.4375f, 0.1875f), float4(0.125f, 0.25f, 0.1875f, 0.4375f), float4(0.375f, 0.0f, 0.625f, 0.0f),
+	float4(0.8125f, 0.0f, 0.1875f, 0.0f), float4(0.5625f, 0.25f, 0.125f, 0.0625f), float4(0.25f, 0.5625f, 0.0625f, 0.125f), float4(0.8125f, 0.0f, 0.1875f, 0.0f),
+	float4(0.5625f, 0.25f, 0.125f, 0.0625f), float4(0.25f, 0.5625f, 0.0625f, 0.125f), float4(0.8125f, 0.0f, 0.1875f, 0.0f), float4(0.5625f, 0.25f, 0.125f, 0.0625f),
+	float4(0.25f, 0.5625f, 0.0625f, 0.125f), float4(0.8125f, 0.0f, 0.1875f, 0.0f), float4(0.1875f, 0.0f, 0.8125f, 0.0f), float4(0.125f, 0.0625f, 0.5625f, 0.25f),
+	float4(0.0625f, 0.125f, 0.25f, 0.5625f), float4(0.1875f, 0.0f, 0.8125f, 0.0f), float4(0.125f, 0.0625f, 0.5625f, 0.25f), float4(0.0625f, 0.125f, 0.25f, 0.5625f),
+	float4(0.1875f, 0.0f, 0.8125f, 0.0f), float4(0.125f, 0.0625f, 0.5625f, 0.25f), float4(0.0625f, 0.125f, 0.25f, 0.5625f), float4(0.1875f, 0.0f, 0.8125f, 0.0f),
+	float4(0.625f, 0.0f, 0.375f, 0.0f), float4(0.4375f, 0.1875f, 0.25f, 0.125f), float4(0.1875f, 0.4375f, 0.125f, 0.25f), float4(0.625f, 0.0f, 0.375f, 0.0f),
+	float4(0.4375f, 0.1875f, 0.25f, 0.125f), float4(0.1875f, 0.4375f, 0.125f, 0.25f), float4(0.625f, 0.0f, 0.375f, 0.0f), float4(0.4375f, 0.1875f, 0.25f, 0.125f),
+	float4(0.1875f, 0.4375f, 0.125f, 0.25f), float4(0.625f, 0.0f, 0.375f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.6875f, 0.3125f, 0.0f, 0.0f),
+	float4(0.3125f, 0.6875f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.6875f, 0.3125f, 0.0f, 0.0f), float4(0.3125f, 0.6875f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.6875f, 0.3125f, 0.0f, 0.0f), float4(0.3125f, 0.6875f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.5625f, 0.4375f, 0.0f, 0.0f), float4(0.125f, 0.875f, 0.0f, 0.0f), float4(0.6875f, 0.3125f, 0.0f, 0.0f),
+	float4(0.1875f, 0.8125f, 0.0f, 0.0f), float4(0.75f, 0.25f, 0.0f, 0.0f), float4(0.3125f, 0.6875f, 0.0f, 0.0f), float4(0.875f, 0.125f, 0.0f, 0.0f),
+	float4(0.4375f, 0.5625f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.1875f, 0.0f, 0.8125f, 0.0f), float4(0.125f, 0.0625f, 0.4375f, 0.375f),
+	float4(0.0f, 0.1875f, 0.125f, 0.6875f), float4(0.125f, 0.0625f, 0.5625f, 0.25f), float4(0.0625f, 0.125f, 0.125f, 0.6875f), float4(0.125f, 0.0625f, 0.625f, 0.1875f),
+	float4(0.0625f, 0.125f, 0.25f, 0.5625f), float4(0.1875f, 0.0f, 0.6875f, 0.125f), float4(0.0625f, 0.125f, 0.375f, 0.4375f), float4(0.1875f, 0.0f, 0.8125f, 0.0f),
+	float4(0.375f, 0.0f, 0.625f, 0.0f), float4(0.1875f, 0.1875f, 0.375f, 0.25f), float4(0.0625f, 0.3125f, 0.0625f, 0.5625f), float4(0.25f, 0.125f, 0.4375f, 0.1875f),
+	float4(0.0625f, 0.3125f, 0.125f, 0.5f), float4(0.3125f, 0.0625f, 0.4375f, 0.1875f), float4(0.125f, 0.25f, 0.1875f, 0.4375f), float4(0.3125f, 0.0625f, 0.5625f, 0.0625f),
+	float4(0.1875f, 0.1875f, 0.25f, 0.375f), float4(0.375f, 0.0f, 0.625f, 0.0f), float4(0.625f, 0.0f, 0.375f, 0.0f), float4(0.375f, 0.25f, 0.1875f, 0.1875f),
+	float4(0.0625f, 0.5625f, 0.0625f, 0.3125f), float4(0.4375f, 0.1875f, 0.25f, 0.125f), float4(0.125f, 0.5f, 0.0625f, 0.3125f), float4(0.5f, 0.125f, 0.25f, 0.125f),
+	float4(0.1875f, 0.4375f, 0.125f, 0.25f), float4(0.5625f, 0.0625f, 0.3125f, 0.0625f), float4(0.25f, 0.375f, 0.1875f, 0.1875f), float4(0.625f, 0.0f, 0.375f, 0.0f),
+	float4(0.8125f, 0.0f, 0.1875f, 0.0f), float4(0.4375f, 0.375f, 0.125f, 0.0625f), float4(0.125f, 0.6875f, 0.0f, 0.1875f), float4(0.5625f, 0.25f, 0.125f, 0.0625f),
+	float4(0.125f, 0.6875f, 0.0625f, 0.125f), float4(0.625f, 0.1875f, 0.125f, 0.0625f), float4(0.25f, 0.5625f, 0.0625f, 0.125f), float4(0.6875f, 0.125f, 0.1875f, 0.0f),
+	float4(0.375f, 0.4375f, 0.0625f, 0.125f), float4(0.8125f, 0.0f, 0.1875f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.5625f, 0.4375f, 0.0f, 0.0f),
+	float4(0.125f, 0.875f, 0.0f, 0.0f), float4(0.6875f, 0.3125f, 0.0f, 0.0f), float4(0.1875f, 0.8125f, 0.0f, 0.0f), float4(0.75f, 0.25f, 0.0f, 0.0f),
+	float4(0.3125f, 0.6875f, 0.0f, 0.0f), float4(0.875f, 0.125f, 0.0f, 0.0f), float4(0.4375f, 0.5625f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.4375f, 0.5625f, 0.0f, 0.0f), float4(0.875f, 0.125f, 0.0f, 0.0f), float4(0.3125f, 0.6875f, 0.0f, 0.0f),
+	float4(0.75f, 0.25f, 0.0f, 0.0f), float4(0.1875f, 0.8125f, 0.0f, 0.0f), float4(0.6875f, 0.3125f, 0.0f, 0.0f), float4(0.125f, 0.875f, 0.0f, 0.0f),
+	float4(0.5625f, 0.4375f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.4375f, 0.5625f, 0.0f, 0.0f),
+	float4(0.875f, 0.125f, 0.0f, 0.0f), float4(0.3125f, 0.6875f, 0.0f, 0.0f), float4(0.75f, 0.25f, 0.0f, 0.0f), float4(0.1875f, 0.8125f, 0.0f, 0.0f),
+	float4(0.6875f, 0.3125f, 0.0f, 0.0f), float4(0.125f, 0.875f, 0.0f, 0.0f), float4(0.5625f, 0.4375f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.4375f, 0.5625f, 0.0f, 0.0f), float4(0.875f, 0.125f, 0.0f, 0.0f), float4(0.3125f, 0.6875f, 0.0f, 0.0f),
+	float4(0.75f, 0.25f, 0.0f, 0.0f), float4(0.1875f, 0.8125f, 0.0f, 0.0f), float4(0.6875f, 0.3125f, 0.0f, 0.0f), float4(0.125f, 0.875f, 0.0f, 0.0f),
+	float4(0.5625f, 0.4375f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.4375f, 0.5625f, 0.0f, 0.0f),
+	float4(0.875f, 0.125f, 0.0f, 0.0f), float4(0.3125f, 0.6875f, 0.0f, 0.0f), float4(0.75f, 0.25f, 0.0f, 0.0f), float4(0.1875f, 0.8125f, 0.0f, 0.0f),
+	float4(0.6875f, 0.3125f, 0.0f, 0.0f), float4(0.125f, 0.875f, 0.0f, 0.0f), float4(0.5625f, 0.4375f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.4375f, 0.5625f, 0.0f, 0.0f), float4(0.875f, 0.125f, 0.0f, 0.0f), float4(0.3125f, 0.6875f, 0.0f, 0.0f),
+	float4(0.75f, 0.25f, 0.0f, 0.0f), float4(0.1875f, 0.8125f, 0.0f, 0.0f), float4(0.6875f, 0.3125f, 0.0f, 0.0f), float4(0.125f, 0.875f, 0.0f, 0.0f),
+	float4(0.5625f, 0.4375f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.4375f, 0.5625f, 0.0f, 0.0f),
+	float4(0.875f, 0.125f, 0.0f, 0.0f), float4(0.3125f, 0.6875f, 0.0f, 0.0f), float4(0.75f, 0.25f, 0.0f, 0.0f), float4(0.1875f, 0.8125f, 0.0f, 0.0f),
+	float4(0.6875f, 0.3125f, 0.0f, 0.0f), float4(0.125f, 0.875f, 0.0f, 0.0f), float4(0.5625f, 0.4375f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.25f, 0.75f, 0.0f, 0.0f), float4(0.4375f, 0.5625f, 0.0f, 0.0f), float4(0.6875f, 0.3125f, 0.0f, 0.0f),
+	float4(0.875f, 0.125f, 0.0f, 0.0f), float4(0.125f, 0.875f, 0.0f, 0.0f), float4(0.3125f, 0.6875f, 0.0f, 0.0f), float4(0.5625f, 0.4375f, 0.0f, 0.0f),
+	float4(0.75f, 0.25f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.25f, 0.75f, 0.0f, 0.0f),
+	float4(0.4375f, 0.5625f, 0.0f, 0.0f), float4(0.6875f, 0.3125f, 0.0f, 0.0f), float4(0.875f, 0.125f, 0.0f, 0.0f), float4(0.125f, 0.875f, 0.0f, 0.0f),
+	float4(0.3125f, 0.6875f, 0.0f, 0.0f), float4(0.5625f, 0.4375f, 0.0f, 0.0f), float4(0.75f, 0.25f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.25f, 0.75f, 0.0f, 0.0f), float4(0.4375f, 0.5625f, 0.0f, 0.0f), float4(0.6875f, 0.3125f, 0.0f, 0.0f),
+	float4(0.875f, 0.125f, 0.0f, 0.0f), float4(0.125f, 0.875f, 0.0f, 0.0f), float4(0.3125f, 0.6875f, 0.0f, 0.0f), float4(0.5625f, 0.4375f, 0.0f, 0.0f),
+	float4(0.75f, 0.25f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.25f, 0.75f, 0.0f, 0.0f),
+	float4(0.4375f, 0.5625f, 0.0f, 0.0f), float4(0.6875f, 0.3125f, 0.0f, 0.0f), float4(0.875f, 0.125f, 0.0f, 0.0f), float4(0.125f, 0.875f, 0.0f, 0.0f),
+	float4(0.3125f, 0.6875f, 0.0f, 0.0f), float4(0.5625f, 0.4375f, 0.0f, 0.0f), float4(0.75f, 0.25f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.25f, 0.75f, 0.0f, 0.0f), float4(0.4375f, 0.5625f, 0.0f, 0.0f), float4(0.6875f, 0.3125f, 0.0f, 0.0f),
+	float4(0.875f, 0.125f, 0.0f, 0.0f), float4(0.125f, 0.875f, 0.0f, 0.0f), float4(0.3125f, 0.6875f, 0.0f, 0.0f), float4(0.5625f, 0.4375f, 0.0f, 0.0f),
+	float4(0.75f, 0.25f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.25f, 0.75f, 0.0f, 0.0f),
+	float4(0.4375f, 0.5625f, 0.0f, 0.0f), float4(0.6875f, 0.3125f, 0.0f, 0.0f), float4(0.875f, 0.125f, 0.0f, 0.0f), float4(0.125f, 0.875f, 0.0f, 0.0f),
+	float4(0.3125f, 0.6875f, 0.0f, 0.0f), float4(0.5625f, 0.4375f, 0.0f, 0.0f), float4(0.75f, 0.25f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+};
+static const uint4 pseudo_inverse_idx_10x6[500] =
+{
+	uint4(0, 1, 2, 3), uint4(4, 5, 6, 10), uint4(11, 12, 13, 20), uint4(21, 22, 23, 40),
+	uint4(0, 1, 2, 3), uint4(4, 5, 6, 7), uint4(9, 10, 12, 13), uint4(14, 22, 23, 24),
+	uint4(0, 2, 3, 4), uint4(5, 6, 7, 8), uint4(9, 15, 16, 17), uint4(19, 25, 26, 27),
+	uint4(3, 4, 5, 6), uint4(7, 8, 9, 16), uint4(17, 18, 19, 26), uint4(27, 28, 29, 49),
+	uint4(0, 1, 10, 11), uint4(12, 13, 14, 20), uint4(21, 22, 23, 24), uint4(30, 40, 41, 50),
+	uint4(2, 3, 4, 10), uint4(12, 13, 14, 16), uint4(20, 22, 23, 24), uint4(25, 26, 43, 44),
+	uint4(5, 6, 7, 13), uint4(15, 16, 17, 19), uint4(23, 24, 25, 26), uint4(27, 29, 45, 46),
+	uint4(8, 9, 15, 16), uint4(17, 18, 19, 25), uint4(26, 27, 28, 29), uint4(39, 48, 49, 59),
+	uint4(0, 10, 11, 20), uint4(30, 31, 32, 33), uint4(34, 40, 41, 42), uint4(43, 44, 50, 51),
+	uint4(13, 14, 30, 32), uint4(33, 34, 35, 36), uint4(40, 42, 43, 44), uint4(46, 52, 53, 54),
+	uint4(15, 16, 33, 34), uint4(35, 36, 37, 39), uint4(43, 45, 46, 47), uint4(49, 55, 56, 57),
+	uint4(9, 18, 19, 29), uint4(35, 36, 37, 38), uint4(39, 45, 46, 47), uint4(48, 49, 58, 59),
+	uint4(10, 30, 31, 32), uint4(33, 40, 41, 42), uint4(43, 50, 51, 52), uint4(53, 54, 55, 56),
+	uint4(32, 33, 34, 40), uint4(42, 43, 44, 50), uint4(51, 52, 53, 54), uint4(55, 56, 57, 59),
+	uint4(35, 36, 37, 45), uint4(46, 47, 49, 50), uint4(52, 53, 54, 55), uint4(56, 57, 58, 59),
+	uint4(19, 36, 37, 38), uint4(39, 46, 47, 48), uint4(49, 53, 54, 55), uint4(56, 57, 58, 59),
+	uint4(0, 1, 2, 3), uint4(4, 5, 6, 7), uint4(11, 12, 13, 20), uint4(23, 30, 31, 40),
+	uint4(0, 1, 2, 3), uint4(4, 5, 6, 7), uint4(8, 9, 11, 12), uint4(22, 23, 32, 33),
+	uint4(0, 1, 2, 3), uint4(4, 5, 6, 7), uint4(8, 9, 12, 17), uint4(24, 25, 34, 35),
+	uint4(0, 1, 2, 3), uint4(4, 5, 6, 7), uint4(8, 9, 17, 18), uint4(26, 27, 36, 37),
+	uint4(2, 3, 4, 6), uint4(7, 8, 9, 16), uint4(17, 18, 26, 28), uint4(29, 38, 39, 49),
+	uint4(0, 1, 3, 10), uint4(11, 12, 13, 15), uint4(20, 21, 23, 30), uint4(31, 33, 40, 41),
+	uint4(0, 2, 3, 10), uint4(11, 12, 13, 15), uint4(20, 21, 22, 23), uint4(32, 33, 42, 43),
+	uint4(4, 5, 11, 12), uint4(13, 14, 15, 16), uint4(17, 18, 19, 24), uint4(25, 34, 35, 44),
+	uint4(6, 7, 9, 12), uint4(14, 16, 17, 18), uint4(19, 26, 27, 28), uint4(29, 36, 37, 47),
+	uint4(6, 8, 9, 14), uint4(16, 17, 18, 19), uint4(26, 28, 29, 36), uint4(38, 39, 48, 49),
+	uint4(0, 10, 11, 13), uint4(20, 21, 22, 23), uint4(30, 31, 32, 33), uint4(40, 41, 43, 50),
+	uint4(11, 12, 13, 20), uint4(21, 22, 23, 25), uint4(30, 31, 32, 33), uint4(35, 41, 42, 43),
+	uint4(14, 15, 17, 22), uint4(23, 24, 25, 26), uint4(27, 32, 33, 34), uint4(35, 37, 44, 45),
+	uint4(16, 17, 18, 24), uint4(26, 27, 28, 29), uint4(34, 36, 37, 38), uint4(39, 46, 47, 48),
+	uint4(9, 16, 18, 19), uint4(26, 27, 28, 29), uint4(36, 37, 38, 39), uint4(46, 48, 49, 59),
+	uint4(10, 11, 20, 21), uint4(23, 30, 31, 33), uint4(40, 41, 42, 43), uint4(45, 50, 51, 53),
+	uint4(12, 22, 23, 30), uint4(31, 32, 33, 40), uint4(41, 42, 43, 44), uint4(45, 50, 52, 53),
+	uint4(24, 25, 34, 35), uint4(40, 41, 42, 43), uint4(44, 45, 46, 47), uint4(48, 49, 54, 55),
+	uint4(17, 26, 27, 34), uint4(35, 36, 37, 38), uint4(39, 44, 46, 47), uint4(48, 49, 56, 57),
+	uint4(18, 19, 26, 28), uint4(29, 36, 38, 39), uint4(44, 46, 47, 48), uint4(49, 56, 58, 59),
+	uint4(10, 20, 21, 30), uint4(33, 41, 42, 43), uint4(50, 51, 52, 53), uint4(54, 55, 56, 57),
+	uint4(22, 23, 32, 33), uint4(41, 42, 50, 51), uint4(52, 53, 54, 55), uint4(56, 57, 58, 59),
+	uint4(24, 25, 34, 42), uint4(43, 47, 50, 51), uint4(52, 53, 54, 55), uint4(56, 57, 58, 59),
+	uint4(26, 27, 36, 37), uint4(47, 48, 50, 51), uint4(52, 53, 54, 55), uint4(56, 57, 58, 59),
+	uint4(19, 28, 29, 36), uint4(38, 39, 46, 47), uint4(48, 52, 53, 54), uint4(56, 57, 58, 59),
+	uint4(0, 1, 2, 3), uint4(4, 5, 6, 7), uint4(8, 9, 0, 0), uint4(0, 0, 0, 0),
+	uint4(0, 1, 2, 3), uint4(4, 5, 6, 7), uint4(8, 9, 0, 0), uint4(0, 0, 0, 0),
+	uint4(0, 1, 2, 3), uint4(4, 5, 6, 7), uint4(8, 9, 0, 0), uint4(0, 0, 0, 0),
+	uint4(0, 1, 2, 3), uint4(4, 5, 6, 7), uint4(8, 9, 0, 0), uint4(0, 0, 0, 0),
+	uint4(0, 1, 2, 3), uint4(4, 5, 6, 7), uint4(8, 9, 0, 0), uint4(0, 0, 0, 0),
+	uint4(0, 1, 2, 3), uint4(4, 5, 6, 7), uint4(8, 9, 0, 0), uint4(0, 0, 0, 0),
+	uint4(10, 11, 12, 13), uint4(14, 15, 16, 17), uint4(18, 19, 10, 10), uint4(10, 10, 10, 10),
+	uint4(10, 11, 12, 13), uint4(14, 15, 16, 17), uint4(18, 19, 10, 10), uint4(10, 10, 10, 10),
+	uint4(10, 11, 12, 13), uint4(14, 15, 16, 17), uint4(18, 19, 10, 10), uint4(10, 10, 10, 10),
+	uint4(10, 11, 12, 13), uint4(14, 15, 16, 17), uint4(18, 19, 10, 10), uint4(10, 10, 10, 10),
+	uint4(10, 11, 12, 13), uint4(14, 15, 16, 17), uint4(18, 19, 10, 10), uint4(10, 10, 10, 10),
+	uint4(10, 11, 12, 13), uint4(14, 15, 16, 17), uint4(18, 19, 10, 10), uint4(10, 10, 10, 10),
+	uint4(20, 21, 22, 23), uint4(24, 25, 26, 27), uint4(28, 29, 20, 20), uint4(20, 20, 20, 20),
+	uint4(20, 21, 22, 23), uint4(24, 25, 26, 27), uint4(28, 29, 20, 20), uint4(20, 20, 20, 20),
+	uint4(20, 21, 22, 23), uint4(24, 25, 26, 27), uint4(28, 29, 20, 20), uint4(20, 20, 20, 20),
+	uint4(20, 21, 22, 23), uint4(24, 25, 26, 27), uint4(28, 29, 20, 20), uint4(20, 20, 20, 20),
+	uint4(20, 21, 22, 23), uint4(24, 25, 26, 27), uint4(28, 29, 20, 20), uint4(20, 20, 20, 20),
+	uint4(20, 21, 22, 23), uint4(24, 25, 26, 27), uint4(28, 29, 20, 20), uint4(20, 20, 20, 20),
+	uint4(30, 31, 32, 33), uint4(34, 35, 36, 37), uint4(38, 39, 30, 30), uint4(30, 30, 30, 30),
+	uint4(30, 31, 32, 33), uint4(34, 35, 36, 37), uint4(38, 39, 30, 30), uint4(30, 30, 30, 30),
+	uint4(30, 31, 32, 33), uint4(34, 35, 36, 37), uint4(38, 39, 30, 30), uint4(30, 30, 30, 30),
+	uint4(30, 31, 32, 33), uint4(34, 35, 36, 37), uint4(38, 39, 30, 30), uint4(30, 30, 30, 30),
+	uint4(30, 31, 32, 33), uint4(34, 35, 36, 37), uint4(38, 39, 30, 30), uint4(30, 30, 30, 30),
+	uint4(30, 31, 32, 33), uint4(34, 35, 36, 37), uint4(38, 39, 30, 30), uint4(30, 30, 30, 30),
+	uint4(40, 41, 42, 43), uint4(44, 45, 46, 47), uint4(48, 49, 40, 40), uint4(40, 40, 40, 40),
+	uint4(40, 41, 42, 43), uint4(44, 45, 46, 47), uint4(48, 49, 40, 40), uint4(40, 40, 40, 40),
+	uint4(40, 41, 42, 43), uint4(44, 45, 46, 47), uint4(48, 49, 40, 40), uint4(40, 40, 40, 40),
+	uint4(40, 41, 42, 43), uint4(44, 45, 46, 47), uint4(48, 49, 40, 40), uint4(40, 40, 40, 40),
+	uint4(40, 41, 42, 43), uint4(44, 45, 46, 47), uint4(48, 49, 40, 40), uint4(40, 40, 40, 40),
+	uint4(40, 41, 42, 43), uint4(44, 45, 46, 47), uint4(48, 49, 40, 40), uint4(40, 40, 40, 40),
+	uint4(50, 51, 52, 53), uint4(54, 55, 56, 57), uint4(58, 59, 50, 50), uint4(50, 50, 50, 50),
+	uint4(50, 51, 52, 53), uint4(54, 55, 56, 57), uint4(58, 59, 50, 50), uint4(50, 50, 50, 50),
+	uint4(50, 51, 52, 53), uint4(54, 55, 56, 57), uint4(58, 59, 50, 50), uint4(50, 50, 50, 50),
+	uint4(50, 51, 52, 53), uint4(54, 55, 56, 57), uint4(58, 59, 50, 50), uint4(50, 50, 50, 50),
+	uint4(50, 51, 52, 53), uint4(54, 55, 56, 57), uint4(58, 59, 50, 50), uint4(50, 50, 50, 50),
+	uint4(50, 51, 52, 53), uint4(54, 55, 56, 57), uint4(58, 59, 50, 50), uint4(50, 50, 50, 50),
+	uint4(0, 1, 2, 3), uint4(4, 5, 6, 7), uint4(8, 9, 0, 0), uint4(0, 0, 0, 0),
+	uint4(0, 1, 2, 3), uint4(4, 5, 6, 7), uint4(8, 9, 0, 0), uint4(0, 0, 0, 0),
+	uint4(0, 1, 2, 3), uint4(4, 5, 6, 7), uint4(8, 9, 0, 0), uint4(0, 0, 0, 0),
+	uint4(0, 1, 2, 3), uint4(4, 5, 6, 7), uint4(8, 9, 0, 0), uint4(0, 0, 0, 0),
+	uint4(0, 1, 2, 3), uint4(4, 5, 6, 7), uint4(8, 9, 0, 0), uint4(0, 0, 0, 0),
+	uint4(0, 1, 2, 3), uint4(4, 5, 6, 7), uint4(8, 9, 0, 0), uint4(0, 0, 0, 0),
+	uint4(0, 1, 2, 3), uint4(4, 5, 6, 7), uint4(8, 9, 0, 0), uint4(0, 0, 0, 0),
+	uint4(0, 1, 2, 3), uint4(4, 5, 6, 7), uint4(8, 9, 0, 0), uint4(0, 0, 0, 0),
+	uint4(10, 11, 12, 13), uint4(14, 15, 16, 17), uint4(18, 19, 10, 10), uint4(10, 10, 10, 10),
+	uint4(10, 11, 12, 13), uint4(14, 15, 16, 17), uint4(18, 19, 10, 10), uint4(10, 10, 10, 10),
+	uint4(10, 11, 12, 13), uint4(14, 15, 16, 17), uint4(18, 19, 10, 10), uint4(10, 10, 10, 10),
+	uint4(10, 11, 12, 13), uint4(14, 15, 16, 17), uint4(18, 19, 10, 10), uint4(10, 10, 10, 10),
+	uint4(10, 11, 12, 13), uint4(14, 15, 16, 17), uint4(18, 19, 10, 10), uint4(10, 10, 10, 10),
+	uint4(10, 11, 12, 13), uint4(14, 15, 16, 17), uint4(18, 19, 10, 10), uint4(10, 10, 10, 10),
+	uint4(10, 11, 12, 13), uint4(14, 15, 16, 17), uint4(18, 19, 10, 10), uint4(10, 10, 10, 10),
+	uint4(10, 11, 12, 13), uint4(14, 15, 16, 17), uint4(18, 19, 10, 10), uint4(10, 10, 10, 10),
+	uint4(20, 21, 22, 23), uint4(24, 25, 26, 27), uint4(28, 29, 20, 20), uint4(20, 20, 20, 20),
+	uint4(20, 21, 22, 23), uint4(24, 25, 26, 27), uint4(28, 29, 20, 20), uint4(20, 20, 20, 20),
+	uint4(20, 21, 22, 23), uint4(24, 25, 26, 27), uint4(28, 29, 20, 20), uint4(20, 20, 20, 20),
+	uint4(20, 21, 22, 23), uint4(24, 25, 26, 27), uint4(28, 29, 20, 20), uint4(20, 20, 20, 20),
+	uint4(20, 21, 22, 23), uint4(24, 25, 26, 27), uint4(28, 29, 20, 20), uint4(20, 20, 20, 20),
+	uint4(20, 21, 22, 23), uint4(24, 25, 26, 27), uint4(28, 29, 20, 20), uint4(20, 20, 20, 20),
+	uint4(20, 21, 22, 23), uint4(24, 25, 26, 27), uint4(28, 29, 20, 20), uint4(20, 20, 20, 20),
+	uint4(20, 21, 22, 23), uint4(24, 25, 26, 27), uint4(28, 29, 20, 20), uint4(20, 20, 20, 20),
+	uint4(30, 31, 32, 33), uint4(34, 35, 36, 37), uint4(38, 39, 30, 30), uint4(30, 30, 30, 30),
+	uint4(30, 31, 32, 33), uint4(34, 35, 36, 37), uint4(38, 39, 30, 30), uint4(30, 30, 30, 30),
+	uint4(30, 31, 32, 33), uint4(34, 35, 36, 37), uint4(38, 39, 30, 30), uint4(30, 30, 30, 30),
+	uint4(30, 31, 32, 33), uint4(34, 35, 36, 37), uint4(38, 39, 30, 30), uint4(30, 30, 30, 30),
+	uint4(30, 31, 32, 33), uint4(34, 35, 36, 37), uint4(38, 39, 30, 30), uint4(30, 30, 30, 30),
+	uint4(30, 31, 32, 33), uint4(34, 35, 36, 37), uint4(38, 39, 30, 30), uint4(30, 30, 30, 30),
+	uint4(30, 31, 32, 33), uint4(34, 35, 36, 37), uint4(38, 39, 30, 30), uint4(30, 30, 30, 30),
+	uint4(30, 31, 32, 33), uint4(34, 35, 36, 37), uint4(38, 39, 30, 30), uint4(30, 30, 30, 30),
+	uint4(40, 41, 42, 43), uint4(44, 45, 46, 47), uint4(48, 49, 40, 40), uint4(40, 40, 40, 40),
+	uint4(40, 41, 42, 43), uint4(44, 45, 46, 47), uint4(48, 49, 40, 40), uint4(40, 40, 40, 40),
+	uint4(40, 41, 42, 43), uint4(44, 45, 46, 47), uint4(48, 49, 40, 40), uint4(40, 40, 40, 40),
+	uint4(40, 41, 42, 43), uint4(44, 45, 46, 47), uint4(48, 49, 40, 40), uint4(40, 40, 40, 40),
+	uint4(40, 41, 42, 43), uint4(44, 45, 46, 47), uint4(48, 49, 40, 40), uint4(40, 40, 40, 40),
+	uint4(40, 41, 42, 43), uint4(44, 45, 46, 47), uint4(48, 49, 40, 40), uint4(40, 40, 40, 40),
+	uint4(40, 41, 42, 43), uint4(44, 45, 46, 47), uint4(48, 49, 40, 40), uint4(40, 40, 40, 40),
+	uint4(40, 41, 42, 43), uint4(44, 45, 46, 47), uint4(48, 49, 40, 40), uint4(40, 40, 40, 40),
+	uint4(50, 51, 52, 53), uint4(54, 55, 56, 57), uint4(58, 59, 50, 50), uint4(50, 50, 50, 50),
+	uint4(50, 51, 52, 53), uint4(54, 55, 56, 57), uint4(58, 59, 50, 50), uint4(50, 50, 50, 50),
+	uint4(50, 51, 52, 53), uint4(54, 55, 56, 57), uint4(58, 59, 50, 50), uint4(50, 50, 50, 50),
+	uint4(50, 51, 52, 53), uint4(54, 55, 56, 57), uint4(58, 59, 50, 50), uint4(50, 50, 50, 50),
+	uint4(50, 51, 52, 53), uint4(54, 55, 56, 57), uint4(58, 59, 50, 50), uint4(50, 50, 50, 50),
+	uint4(50, 51, 52, 53), uint4(54, 55, 56, 57), uint4(58, 59, 50, 50), uint4(50, 50, 50, 50),
+	uint4(50, 51, 52, 53), uint4(54, 55, 56, 57), uint4(58, 59, 50, 50), uint4(50, 50, 50, 50),
+	uint4(50, 51, 52, 53), uint4(54, 55, 56, 57), uint4(58, 59, 50, 50), uint4(50, 50, 50, 50),
+};
+static const float4 pseudo_inverse_wt_10x6[500] =
+{
+	float4(0.623126f, 0.387398f, 0.104524f, -0.131204f), float4(-0.0814559f, -0.0217584f, 0.0279894f, 0.143096f),
+	float4(0.0814783f, 0.0307512f, -0.0308669f, -0.109867f), float4(-0.0694387f, -0.0181191f, 0.0223095f, 0.0230375f),
+	float4(-0.131204f, 0.0591134f, 0.287494f, 0.477811f), float4(0.296644f, 0.0792437f, -0.101923f, -0.0613257f),
+	float4(0.0279894f, -0.0308669f, 0.0602527f, 0.110179f), float4(0.0626546f, -0.0513006f, -0.083739f, -0.0528586f),
+	float4(0.0279894f, -0.0613257f, -0.101923f, 0.0792437f), float4(0.296644f, 0.477811f, 0.287494f, 0.0591134f),
+	float4(-0.131204f, 0.0626546f, 0.110179f, 0.0602527f), float4(-0.0308669f, -0.0528586f, -0.083739f, -0.0513006f),
+	float4(0.0279894f, -0.0217584f, -0.0814559f, -0.131204f), float4(0.104524f, 0.387398f, 0.623126f, -0.0308669f),
+	float4(0.0307512f, 0.0814783f, 0.143096f, 0.0223095f), float4(-0.0181191f, -0.0694387f, -0.109867f, 0.0230375f),
+	float4(-0.144921f, -0.090466f, 0.387288f, 0.24958f), float4(0.0587075f, -0.079001f, -0.0508462f, 0.535697f),
+	float4(0.338348f, 0.0878361f, -0.109513f, -0.0690696f), float4(-0.0340237f, -0.112325f, -0.0726805f, 0.0420324f),
+	float4(-0.0667328f, -0.1104f, -0.0688296f, -0.079001f), float4(0.184831f, 0.295407f, 0.190142f, -0.0610186f),
+	float4(-0.109513f, 0.250224f, 0.408752f, 0.257839f), float4(0.0662952f, -0.0846178f, -0.0850661f, -0.0549853f),
+	float4(-0.0688296f, -0.1104f, -0.0667328f, -0.0610186f), float4(0.190142f, 0.295407f, 0.184831f, -0.079001f),
+	float4(-0.0846178f, 0.0662952f, 0.257839f, 0.408752f), float4(0.250224f, -0.109513f, -0.0549853f, -0.0850661f),
+	float4(-0.090466f, -0.144921f, -0.0508462f, -0.079001f), float4(0.0587075f, 0.24958f, 0.387288f, -0.0690696f),
+	float4(-0.109513f, 0.0878361f, 0.338348f, 0.535697f), float4(-0.0340237f, -0.0726805f, -0.112325f, 0.0420324f),
+	float4(0.0420324f, -0.112325f, -0.0726805f, -0.0340237f), float4(0.535697f, 0.338348f, 0.0878361f, -0.109513f),
+	float4(-0.0690696f, 0.387288f, 0.24958f, 0.0587075f), float4(-0.079001f, -0.0508462f, -0.144921f, -0.090466f),
+	float4(-0.0850661f, -0.0549853f, -0.109513f, 0.250224f), float4(0.408752f, 0.257839f, 0.0662952f, -0.0846178f),
+	float4(-0.079001f, 0.184831f, 0.295407f, 0.190142f), float4(-0.0610186f, -0.0667328f, -0.1104f, -0.0688296f),
+	float4(-0.0549853f, -0.0850661f, -0.0846178f, 0.0662952f), float4(0.257839f, 0.408752f, 0.250224f, -0.109513f),
+	float4(-0.0610186f, 0.190142f, 0.295407f, 0.184831f), float4(-0.079001f, -0.0688296f, -0.1104f, -0.0667328f),
+	float4(0.0420324f, -0.0726805f, -0.112325f, -0.0340237f), float4(-0.0690696f, -0.109513f, 0.0878361f, 0.338348f),
+	float4(0.535697f, -0.0508462f, -0.079001f, 0.0587075f), float4(0.24958f, 0.387288f, -0.090466f, -0.144921f),
+	float4(0.0230375f, -0.109867f, -0.0694387f, -0.0181191f), float4(0.0223095f, 0.143096f, 0.0814783f, 0.0307512f),
+	float4(-0.0308669f, 0.623126f, 0.387398f, 0.104524f), float4(-0.131204f, -0.0814559f, -0.0217584f, 0.0279894f),
+	float4(-0.0513006f, -0.083739f, -0.0528586f, -0.0308669f), float4(0.0602527f, 0.110179f, 0.0626546f, -0.131204f),
+	float4(0.0591134f, 0.287494f, 0.477811f, 0.296644f), float4(0.0792437f, -0.101923f, -0.0613257f, 0.0279894f),
+	float4(-0.0528586f, -0.083739f, -0.0513006f, 0.0626546f), float4(0.110179f, 0.0602527f, -0.0308669f, 0.0279894f),
+	float4(-0.0613257f, -0.101923f, 0.0792437f, 0.296644f), float4(0.477811f, 0.287494f, 0.0591134f, -0.131204f),
+	float4(0.0230375f, 0.0223095f, -0.0181191f, -0.0694387f), float4(-0.109867f, -0.0308669f, 0.0307512f, 0.0814783f),
+	float4(0.143096f, 0.0279894f, -0.0217584f, -0.0814559f), float4(-0.131204f, 0.104524f, 0.387398f, 0.623126f),
+	float4(0.80299f, 0.360508f, -0.081973f, -0.124932f), float4(0.00860994f, 0.0398003f, 0.00674646f, -0.014197f),
+	float4(0.0297821f, -0.0224714f, 0.0074176f, -0.0328564f), float4(0.00650897f, 0.028391f, 0.0145328f, -0.0133808f),
+	float4(-0.208396f, 0.226276f, 0.660948f, 0.470615f), float4(-0.0326248f, -0.150092f, -0.0254088f, 0.0535897f),
+	float4(0.0183766f, -0.0168366f, -0.018847f, 0.0340991f), float4(-0.0213329f, -0.0184214f, 0.0248684f, 0.0182425f),
+	float4(0.0586883f, -0.063824f, -0.186336f, 0.106562f), float4(0.631205f, 0.561497f, 0.0952112f, -0.200237f),
+	float4(-0.068594f, 0.0630495f, -0.0138106f, -0.0161376f), float4(-0.0183819f, -0.0217657f, 0.0181897f, 0.0192697f),
+	float4(-0.0168635f, 0.0183615f, 0.0535864f, -0.0305682f), float4(-0.181318f, 0.0167242f, 0.462229f, 0.656996f),
+	float4(0.224919f, -0.207158f, 0.0334184f, -0.0189156f), float4(-0.0181906f, -0.0214848f, 0.0174316f, 0.0246872f),
+	float4(-0.0141736f, 0.00812779f, 0.0480708f, -0.122718f), float4(-0.0809304f, 0.360866f, 0.802663f, 0.00699731f),
+	float4(-0.0223274f, 0.0297865f, 0.00644788f, -0.00635073f), float4(-0.0328634f, 0.0145469f, 0.0283752f, -0.0133656f),
+	float4(-0.180395f, -0.0779808f, 0.0327676f, 0.930416f), float4(0.374014f, -0.0725853f, -0.162951f, 0.0446718f),
+	float4(0.215766f, 0.0457583f, -0.0371696f, -0.187134f), float4(-0.098192f, 0.0302025f, 0.0880877f, 0.0363182f),
+	float4(0.0569487f, -0.145388f, -0.106486f, -0.262319f), float4(0.282265f, 0.719224f, 0.56111f, -0.153886f),
+	float4(-0.0722349f, 0.0956222f, 0.142391f, 0.114917f), float4(-0.164907f, -0.114561f, 0.0688925f, 0.0541295f),
+	float4(-0.107585f, -0.0948127f, -0.0683326f, -0.176101f), float4(0.1063f, 0.686391f, 0.597669f, 0.092413f),
+	float4(-0.1917f, -0.0746832f, 0.0698073f, 0.144463f), float4(0.169583f, -0.142839f, -0.150415f, 0.0654005f),
+	float4(-0.105899f, -0.145134f, 0.0568125f, 0.0498346f), float4(-0.194415f, 0.550989f, 0.71526f, 0.280725f),
+	float4(-0.260911f, 0.115931f, 0.143377f, 0.0956211f), float4(-0.0723312f, -0.110797f, -0.162832f, 0.067364f),
+	float4(0.0325611f, -0.0780023f, -0.180351f, 0.0565529f), float4(-0.159991f, -0.0714554f, 0.374453f, 0.930013f),
+	float4(-0.0373962f, 0.0457704f, 0.215783f, 0.0291277f), float4(-0.0983245f, -0.186998f, 0.0364865f, 0.087944f),
+	float4(0.0556665f, -0.28761f, -0.122142f, 0.0419548f), float4(0.611505f, 0.327135f, -0.0778585f, -0.087986f),
+	float4(0.611515f, 0.327123f, -0.0778845f, -0.0879658f), float4(-0.28759f, -0.122163f, 0.0419875f, 0.0556629f),
+	float4(-0.092219f, -0.225811f, -0.176293f, -0.138432f), float4(0.140779f, 0.539648f, 0.373492f, -0.105997f),
+	float4(-0.138474f, 0.140829f, 0.539761f, 0.373404f), float4(-0.13845f, -0.0921254f, -0.22557f, -0.176435f),
+	float4(-0.234362f, -0.201848f, 0.0753581f, -0.154337f), float4(0.077539f, 0.503827f, 0.399717f, 0.0764065f),
+	float4(-0.15612f, -0.154631f, 0.0777664f, 0.504957f), float4(0.529562f, -0.168111f, -0.231939f, -0.206799f),
+	float4(-0.175035f, -0.222549f, -0.0909164f, -0.141189f), float4(0.365907f, 0.534358f, 0.139474f, -0.137119f),
+	float4(-0.131808f, 0.370146f, 0.534688f, 0.139622f), float4(-0.137243f, -0.166807f, -0.221923f, -0.0906557f),
+	float4(0.0556293f, 0.0416508f, -0.12245f, -0.287349f), float4(-0.086199f, -0.0766095f, 0.327443f, 0.611195f),
+	float4(-0.0872023f, -0.0766878f, 0.327408f, 0.611224f), float4(0.0397033f, -0.122512f, -0.287292f, 0.0555927f),
+	float4(0.0880877f, 0.0363197f, -0.187118f, -0.0982096f), float4(0.0302132f, 0.215863f, 0.0456434f, -0.0369911f),
+	float4(0.930586f, 0.373835f, -0.0730487f, -0.162666f), float4(0.0461511f, -0.180419f, -0.0779667f, 0.0326959f),
+	float4(0.0688912f, -0.164697f, -0.114601f, -0.072564f), float4(0.0960122f, 0.143329f, 0.114312f, -0.262897f),
+	float4(0.282871f, 0.720795f, 0.560144f, -0.0580402f), float4(-0.158956f, 0.0570302f, -0.145564f, -0.106243f),
+	float4(-0.141104f, -0.109188f, 0.157311f, 0.0689605f), float4(0.0661087f, -0.0706915f, -0.182218f, 0.110058f),
+	float4(0.710427f, 0.617326f, 0.0917838f, -0.202867f), float4(-0.0791365f, 0.0736765f, -0.111378f, -0.0978809f),
+	float4(0.0673164f, -0.115309f, -0.16222f, -0.0582845f), float4(0.0576209f, 0.105822f, 0.143126f, 0.0954108f),
+	float4(-0.0721778f, -0.205816f, 0.54512f, 0.713474f), float4(0.280014f, -0.260257f, -0.104741f, -0.14458f),
+	float4(0.0364924f, 0.0879406f, 0.0304895f, -0.0983756f), float4(-0.186949f, -0.0344669f, 0.0458307f, 0.215739f),
+	float4(0.0597187f, -0.15834f, -0.0709358f, 0.37466f), float4(0.929823f, 0.0322355f, -0.0780527f, -0.180293f),
+	float4(-0.0133806f, 0.0283888f, 0.0145351f, -0.0328677f), float4(0.00648808f, 0.029802f, -0.0224197f, 0.00738576f),
+	float4(0.802992f, 0.360507f, -0.0819788f, -0.124924f), float4(0.00864206f, 0.0398262f, 0.00674545f, -0.0142139f),
+	float4(0.0248447f, 0.0182486f, -0.0214206f, -0.0183655f), float4(-0.0188992f, 0.0339635f, -0.208403f, 0.22628f),
+	float4(0.660963f, 0.470594f, -0.0327089f, -0.150161f), float4(-0.0254106f, 0.0536285f, 0.0183885f, -0.0168515f),
+	float4(0.0179114f, 0.0137952f, -0.0201268f, -0.0130188f), float4(0.0131267f, -0.0147232f, 0.0587294f, -0.0638479f),
+	float4(-0.186425f, 0.106684f, 0.631696f, 0.561896f), float4(0.0952079f, -0.20048f, -0.0686685f, 0.0631431f),
+	float4(0.0180204f, 0.0244623f, -0.0168016f, -0.0215877f), float4(0.0338255f, -0.0187534f, -0.0168836f, 0.0183704f),
+	float4(0.0536245f, -0.0306272f, -0.181546f, 0.0164737f), float4(0.462049f, 0.656887f, 0.224885f, -0.207118f),
+	float4(-0.0133509f, 0.0145627f, 0.0283592f, 0.00598708f), float4(-0.00635287f, -0.0328645f, 0.00670894f, -0.0224516f),
+	float4(0.0297371f, -0.0141858f, 0.0081468f, 0.0481441f), float4(-0.122661f, -0.080897f, 0.360877f, 0.80265f),
+	float4(0.881097f, 0.271779f, -0.168531f, -0.0173142f), float4(0.0449523f, -0.00396968f, -0.0121205f, 0.00256117f),
+	float4(0.00274958f, -0.00120294f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(-0.202135f, 0.462023f, 0.815906f, 0.0838225f), float4(-0.217626f, 0.0192183f, 0.0586787f, -0.0123993f),
+	float4(-0.0133115f, 0.00582376f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0666954f, -0.152447f, -0.142f, 0.672005f), float4(0.757724f, -0.0669137f, -0.204306f, 0.0431715f),
+	float4(0.0463474f, -0.020277f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(-0.020277f, 0.0463474f, 0.0431715f, -0.204306f), float4(-0.00671648f, 0.747206f, 0.596858f, -0.126121f),
+	float4(-0.135399f, 0.0592372f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.00582376f, -0.0133115f, -0.0123993f, 0.0586787f), float4(0.00192904f, -0.214605f, 0.105405f, 0.811345f),
+	float4(0.457127f, -0.199993f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(-0.00120294f, 0.00274958f, 0.00256117f, -0.0121205f), float4(-0.000398458f, 0.0443283f, -0.0217723f, -0.167589f),
+	float4(0.27279f, 0.880654f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.881097f, 0.271779f, -0.168531f, -0.0173142f), float4(0.0449523f, -0.00396968f, -0.0121205f, 0.00256117f),
+	float4(0.00274958f, -0.00120294f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(-0.202135f, 0.462023f, 0.815906f, 0.0838225f), float4(-0.217626f, 0.0192183f, 0.0586787f, -0.0123993f),
+	float4(-0.0133115f, 0.00582376f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0666954f, -0.152447f, -0.142f, 0.672005f), float4(0.757724f, -0.0669137f, -0.204306f, 0.0431715f),
+	float4(0.0463474f, -0.020277f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(-0.020277f, 0.0463474f, 0.0431715f, -0.204306f), float4(-0.00671648f, 0.747206f, 0.596858f, -0.126121f),
+	float4(-0.135399f, 0.0592372f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.00582376f, -0.0133115f, -0.0123993f, 0.0586787f), float4(0.00192904f, -0.214605f, 0.105405f, 0.811345f),
+	float4(0.457127f, -0.199993f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(-0.00120294f, 0.00274958f, 0.00256117f, -0.0121205f), float4(-0.000398458f, 0.0443283f, -0.0217723f, -0.167589f),
+	float4(0.27279f, 0.880654f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.881097f, 0.271779f, -0.168531f, -0.0173142f), float4(0.0449523f, -0.00396968f, -0.0121205f, 0.00256117f),
+	float4(0.00274958f, -0.00120294f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(-0.202135f, 0.462023f, 0.815906f, 0.0838225f), float4(-0.217626f, 0.0192183f, 0.0586787f, -0.0123993f),
+	float4(-0.0133115f, 0.00582376f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0666954f, -0.152447f, -0.142f, 0.672005f), float4(0.757724f, -0.0669137f, -0.204306f, 0.0431715f),
+	float4(0.0463474f, -0.020277f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(-0.020277f, 0.0463474f, 0.0431715f, -0.204306f), float4(-0.00671648f, 0.747206f, 0.596858f, -0.126121f),
+	float4(-0.135399f, 0.0592372f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.00582376f, -0.0133115f, -0.0123993f, 0.0586787f), float4(0.00192904f, -0.214605f, 0.105405f, 0.811345f),
+	float4(0.457127f, -0.199993f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(-0.00120294f, 0.00274958f, 0.00256117f, -0.0121205f), float4(-0.000398458f, 0.0443283f, -0.0217723f, -0.167589f),
+	float4(0.27279f, 0.880654f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.881097f, 0.271779f, -0.168531f, -0.0173142f), float4(0.0449523f, -0.00396968f, -0.0121205f, 0.00256117f),
+	float4(0.00274958f, -0.00120294f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(-0.202135f, 0.462023f, 0.815906f, 0.0838225f), float4(-0.217626f, 0.0192183f, 0.0586787f, -0.0123993f),
+	float4(-0.0133115f, 0.00582376f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0666954f, -0.152447f, -0.142f, 0.672005f), float4(0.757724f, -0.0669137f, -0.204306f, 0.0431715f),
+	float4(0.0463474f, -0.020277f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(-0.020277f, 0.0463474f, 0.0431715f, -0.204306f), float4(-0.00671648f, 0.747206f, 0.596858f, -0.126121f),
+	float4(-0.135399f, 0.0592372f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.00582376f, -0.0133115f, -0.0123993f, 0.0586787f), float4(0.00192904f, -0.214605f, 0.105405f, 0.811345f),
+	float4(0.457127f, -0.199993f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(-0.00120294f, 0.00274958f, 0.00256117f, -0.0121205f), float4(-0.000398458f, 0.0443283f, -0.0217723f, -0.167589f),
+	float4(0.27279f, 0.880654f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.881097f, 0.271779f, -0.168531f, -0.0173142f), float4(0.0449523f, -0.00396968f, -0.0121205f, 0.00256117f),
+	float4(0.00274958f, -0.00120294f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(-0.202135f, 0.462023f, 0.815906f, 0.0838225f), float4(-0.217626f, 0.0192183f, 0.0586787f, -0.0123993f),
+	float4(-0.0133115f, 0.00582376f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0666954f, -0.152447f, -0.142f, 0.672005f), float4(0.757724f, -0.0669137f, -0.204306f, 0.0431715f),
+	float4(0.0463474f, -0.020277f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(-0.020277f, 0.0463474f, 0.0431715f, -0.204306f), float4(-0.00671648f, 0.747206f, 0.596858f, -0.126121f),
+	float4(-0.135399f, 0.0592372f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.00582376f, -0.0133115f, -0.0123993f, 0.0586787f), float4(0.00192904f, -0.214605f, 0.105405f, 0.811345f),
+	float4(0.457127f, -0.199993f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(-0.00120294f, 0.00274958f, 0.00256117f, -0.0121205f), float4(-0.000398458f, 0.0443283f, -0.0217723f, -0.167589f),
+	float4(0.27279f, 0.880654f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.881097f, 0.271779f, -0.168531f, -0.0173142f), float4(0.0449523f, -0.00396968f, -0.0121205f, 0.00256117f),
+	float4(0.00274958f, -0.00120294f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(-0.202135f, 0.462023f, 0.815906f, 0.0838225f), float4(-0.217626f, 0.0192183f, 0.0586787f, -0.0123993f),
+	float4(-0.0133115f, 0.00582376f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0666954f, -0.152447f, -0.142f, 0.672005f), float4(0.757724f, -0.0669137f, -0.204306f, 0.0431715f),
+	float4(0.0463474f, -0.020277f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(-0.020277f, 0.0463474f, 0.0431715f, -0.204306f), float4(-0.00671648f, 0.747206f, 0.596858f, -0.126121f),
+	float4(-0.135399f, 0.0592372f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.00582376f, -0.0133115f, -0.0123993f, 0.0586787f), float4(0.00192904f, -0.214605f, 0.105405f, 0.811345f),
+	float4(0.457127f, -0.199993f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(-0.00120294f, 0.00274958f, 0.00256117f, -0.0121205f), float4(-0.000398458f, 0.0443283f, -0.0217723f, -0.167589f),
+	float4(0.27279f, 0.880654f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.989975f, 0.0400995f, -0.068742f, 0.0562435f), float4(-0.0204703f, 0.00268365f, 0.000673908f, -0.000823665f),
+	float4(0.000480471f, -0.000120118f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(-0.276526f, 1.1061f, 0.389538f, -0.318713f), float4(0.115999f, -0.0152074f, -0.00381881f, 0.00466744f),
+	float4(-0.00272267f, 0.000680668f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0928675f, -0.37147f, 0.636806f, 0.933523f), float4(-0.339764f, 0.0445429f, 0.0111854f, -0.0136711f),
+	float4(0.00797481f, -0.0019937f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(-0.0243293f, 0.0973173f, -0.16683f, 0.136497f), float4(1.11499f, -0.146175f, -0.0367068f, 0.0448639f),
+	float4(-0.0261706f, 0.00654265f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.00654265f, -0.0261706f, 0.0448639f, -0.0367068f), float4(-0.146175f, 1.11499f, 0.136497f, -0.16683f),
+	float4(0.0973173f, -0.0243293f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(-0.0019937f, 0.00797481f, -0.0136711f, 0.0111854f), float4(0.0445429f, -0.339764f, 0.933523f, 0.636806f),
+	float4(-0.37147f, 0.0928675f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.000680668f, -0.00272267f, 0.00466744f, -0.00381881f), float4(-0.0152074f, 0.115999f, -0.318713f, 0.389538f),
+	float4(1.1061f, -0.276526f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(-0.000120118f, 0.000480471f, -0.000823665f, 0.000673908f), float4(0.00268365f, -0.0204703f, 0.0562435f, -0.068742f),
+	float4(0.0400995f, 0.989975f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.989975f, 0.0400995f, -0.068742f, 0.0562435f), float4(-0.0204703f, 0.00268365f, 0.000673908f, -0.000823665f),
+	float4(0.000480471f, -0.000120118f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(-0.276526f, 1.1061f, 0.389538f, -0.318713f), float4(0.115999f, -0.0152074f, -0.00381881f, 0.00466744f),
+	float4(-0.00272267f, 0.000680668f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0928675f, -0.37147f, 0.636806f, 0.933523f), float4(-0.339764f, 0.0445429f, 0.0111854f, -0.0136711f),
+	float4(0.00797481f, -0.0019937f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(-0.0243293f, 0.0973173f, -0.16683f, 0.136497f), float4(1.11499f, -0.146175f, -0.0367068f, 0.0448639f),
+	float4(-0.0261706f, 0.00654265f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.00654265f, -0.0261706f, 0.0448639f, -0.0367068f), float4(-0.146175f, 1.11499f, 0.136497f, -0.16683f),
+	float4(0.0973173f, -0.0243293f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(-0.0019937f, 0.00797481f, -0.0136711f, 0.0111854f), float4(0.0445429f, -0.339764f, 0.933523f, 0.636806f),
+	float4(-0.37147f, 0.0928675f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.000680668f, -0.00272267f, 0.00466744f, -0.00381881f), float4(-0.0152074f, 0.115999f, -0.318713f, 0.389538f),
+	float4(1.1061f, -0.276526f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(-0.000120118f, 0.000480471f, -0.000823665f, 0.000673908f), float4(0.00268365f, -0.0204703f, 0.0562435f, -0.068742f),
+	float4(0.0400995f, 0.989975f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.989975f, 0.0400995f, -0.068742f, 0.0562435f), float4(-0.0204703f, 0.00268365f, 0.000673908f, -0.000823665f),
+	float4(0.000480471f, -0.000120118f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(-0.276526f, 1.1061f, 0.389538f, -0.318713f), float4(0.115999f, -0.0152074f, -0.00381881f, 0.00466744f),
+	float4(-0.00272267f, 0.000680668f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0928675f, -0.37147f, 0.636806f, 0.933523f), float4(-0.339764f, 0.0445429f, 0.0111854f, -0.0136711f),
+	float4(0.00797481f, -0.0019937f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(-0.0243293f, 0.0973173f, -0.16683f, 0.136497f), float4(1.11499f, -0.146175f, -0.0367068f, 0.0448639f),
+	float4(-0.0261706f, 0.00654265f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.00654265f, -0.0261706f, 0.0448639f, -0.0367068f), float4(-0.146175f, 1.11499f, 0.136497f, -0.16683f),
+	float4(0.0973173f, -0.0243293f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(-0.0019937f, 0.00797481f, -0.0136711f, 0.0111854f), float4(0.0445429f, -0.339764f, 0.933523f, 0.636806f),
+	float4(-0.37147f, 0.0928675f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.000680668f, -0.00272267f, 0.00466744f, -0.00381881f), float4(-0.0152074f, 0.115999f, -0.318713f, 0.389538f),
+	float4(1.1061f, -0.276526f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(-0.000120118f, 0.000480471f, -0.000823665f, 0.000673908f), float4(0.00268365f, -0.0204703f, 0.0562435f, -0.068742f),
+	float4(0.0400995f, 0.989975f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.989975f, 0.0400995f, -0.068742f, 0.0562435f), float4(-0.0204703f, 0.00268365f, 0.000673908f, -0.000823665f),
+	float4(0.000480471f, -0.000120118f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(-0.276526f, 1.1061f, 0.389538f, -0.318713f), float4(0.115999f, -0.0152074f, -0.00381881f, 0.00466744f),
+	float4(-0.00272267f, 0.000680668f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0928675f, -0.37147f, 0.636806f, 0.933523f), float4(-0.339764f, 0.0445429f, 0.0111854f, -0.0136711f),
+	float4(0.00797481f, -0.0019937f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(-0.0243293f, 0.0973173f, -0.16683f, 0.136497f), float4(1.11499f, -0.146175f, -0.0367068f, 0.0448639f),
+	float4(-0.0261706f, 0.00654265f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.00654265f, -0.0261706f, 0.0448639f, -0.0367068f), float4(-0.146175f, 1.11499f, 0.136497f, -0.16683f),
+	float4(0.0973173f, -0.0243293f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(-0.0019937f, 0.00797481f, -0.0136711f, 0.0111854f), float4(0.0445429f, -0.339764f, 0.933523f, 0.636806f),
+	float4(-0.37147f, 0.0928675f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.000680668f, -0.00272267f, 0.00466744f, -0.00381881f), float4(-0.0152074f, 0.115999f, -0.318713f, 0.389538f),
+	float4(1.1061f, -0.276526f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(-0.000120118f, 0.000480471f, -0.000823665f, 0.000673908f), float4(0.00268365f, -0.0204703f, 0.0562435f, -0.068742f),
+	float4(0.0400995f, 0.989975f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.989975f, 0.0400995f, -0.068742f, 0.0562435f), float4(-0.0204703f, 0.00268365f, 0.000673908f, -0.000823665f),
+	float4(0.000480471f, -0.000120118f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(-0.276526f, 1.1061f, 0.389538f, -0.318713f), float4(0.115999f, -0.0152074f, -0.00381881f, 0.00466744f),
+	float4(-0.00272267f, 0.000680668f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0928675f, -0.37147f, 0.636806f, 0.933523f), float4(-0.339764f, 0.0445429f, 0.0111854f, -0.0136711f),
+	float4(0.00797481f, -0.0019937f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(-0.0243293f, 0.0973173f, -0.16683f, 0.136497f), float4(1.11499f, -0.146175f, -0.0367068f, 0.0448639f),
+	float4(-0.0261706f, 0.00654265f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.00654265f, -0.0261706f, 0.0448639f, -0.0367068f), float4(-0.146175f, 1.11499f, 0.136497f, -0.16683f),
+	float4(0.0973173f, -0.0243293f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(-0.0019937f, 0.00797481f, -0.0136711f, 0.0111854f), float4(0.0445429f, -0.339764f, 0.933523f, 0.636806f),
+	float4(-0.37147f, 0.0928675f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.000680668f, -0.00272267f, 0.00466744f, -0.00381881f), float4(-0.0152074f, 0.115999f, -0.318713f, 0.389538f),
+	float4(1.1061f, -0.276526f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(-0.000120118f, 0.000480471f, -0.000823665f, 0.000673908f), float4(0.00268365f, -0.0204703f, 0.0562435f, -0.068742f),
+	float4(0.0400995f, 0.989975f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.989975f, 0.0400995f, -0.068742f, 0.0562435f), float4(-0.0204703f, 0.00268365f, 0.000673908f, -0.000823665f),
+	float4(0.000480471f, -0.000120118f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(-0.276526f, 1.1061f, 0.389538f, -0.318713f), float4(0.115999f, -0.0152074f, -0.00381881f, 0.00466744f),
+	float4(-0.00272267f, 0.000680668f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0928675f, -0.37147f, 0.636806f, 0.933523f), float4(-0.339764f, 0.0445429f, 0.0111854f, -0.0136711f),
+	float4(0.00797481f, -0.0019937f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(-0.0243293f, 0.0973173f, -0.16683f, 0.136497f), float4(1.11499f, -0.146175f, -0.0367068f, 0.0448639f),
+	float4(-0.0261706f, 0.00654265f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.00654265f, -0.0261706f, 0.0448639f, -0.0367068f), float4(-0.146175f, 1.11499f, 0.136497f, -0.16683f),
+	float4(0.0973173f, -0.0243293f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(-0.0019937f, 0.00797481f, -0.0136711f, 0.0111854f), float4(0.0445429f, -0.339764f, 0.933523f, 0.636806f),
+	float4(-0.37147f, 0.0928675f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.000680668f, -0.00272267f, 0.00466744f, -0.00381881f), float4(-0.0152074f, 0.115999f, -0.318713f, 0.389538f),
+	float4(1.1061f, -0.276526f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(-0.000120118f, 0.000480471f, -0.000823665f, 0.000673908f), float4(0.00268365f, -0.0204703f, 0.0562435f, -0.068742f),
+	float4(0.0400995f, 0.989975f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+};
+
+#define WEIGHT_GRID_COUNT_10X8 4
+#define MAX_GRID_WEIGHTS_10X8 64
+static const uint4 weight_grids_10x8[WEIGHT_GRID_COUNT_10X8] = { uint4(4, 4, 0, 0), uint4(5, 5, 16, 80), uint4(6, 6, 41, 160), uint4(8, 8, 77, 240) };
+static const uint4 decimation_idx_10x8[141] =
+{
+	uint4(0, 1, 10, 11), uint4(3, 4, 13, 14), uint4(6, 7, 16, 17), uint4(9, 9, 19, 19),
+	uint4(20, 21, 30, 31), uint4(23, 24, 33, 34), uint4(26, 27, 36, 37), uint4(29, 29, 39, 39),
+	uint4(40, 41, 50, 51), uint4(43, 44, 53, 54), uint4(46, 47, 56, 57), uint4(49, 49, 59, 59),
+	uint4(70, 71, 70, 71), uint4(73, 74, 73, 74), uint4(76, 77, 76, 77), uint4(79, 79, 79, 79),
+	uint4(0, 1, 10, 11), uint4(2, 3, 12, 13), uint4(4, 5, 14, 15), uint4(6, 7, 16, 17),
+	uint4(9, 9, 19, 19), uint4(10, 11, 20, 21), uint4(12, 13, 22, 23), uint4(14, 15, 24, 25),
+	uint4(16, 17, 26, 27), uint4(19, 19, 29, 29), uint4(30, 31, 40, 41), uint4(32, 33, 42, 43),
+	uint4(34, 35, 44, 45), uint4(36, 37, 46, 47), uint4(39, 39, 49, 49), uint4(50, 51, 60, 61),
+	uint4(52, 53, 62, 63), uint4(54, 55, 64, 65), uint4(56, 57, 66, 67), uint4(59, 59, 69, 69),
+	uint4(70, 71, 70, 71), uint4(72, 73, 72, 73), uint4(74, 75, 74, 75), uint4(76, 77, 76, 77),
+	uint4(79, 79, 79, 79), uint4(0, 1, 10, 11), uint4(1, 2, 11, 12), uint4(3, 4, 13, 14),
+	uint4(5, 6, 15, 16), uint4(7, 8, 17, 18), uint4(9, 9, 19, 19), uint4(10, 11, 20, 21),
+	uint4(11, 12, 21, 22), uint4(13, 14, 23, 24), uint4(15, 16, 25, 26), uint4(17, 18, 27, 28),
+	uint4(19, 19, 29, 29), uint4(20, 21, 30, 31), uint4(21, 22, 31, 32), uint4(23, 24, 33, 34),
+	uint4(25, 26, 35, 36), uint4(27, 28, 37, 38), uint4(29, 29, 39, 39), uint4(40, 41, 50, 51),
+	uint4(41, 42, 51, 52), uint4(43, 44, 53, 54), uint4(45, 46, 55, 56), uint4(47, 48, 57, 58),
+	uint4(49, 49, 59, 59), uint4(50, 51, 60, 61), uint4(51, 52, 61, 62), uint4(53, 54, 63, 64),
+	uint4(55, 56, 65, 66), uint4(57, 58, 67, 68), uint4(59, 59, 69, 69), uint4(70, 71, 70, 71),
+	uint4(71, 72, 71, 72), uint4(73, 74, 73, 74), uint4(75, 76, 75, 76), uint4(77, 78, 77, 78),
+	uint4(79, 79, 79, 79), uint4(0, 1, 10, 11), uint4(1, 2, 11, 12), uint4(2, 3, 12, 13),
+	uint4(3, 4, 13, 14), uint4(5, 6, 15, 16), uint4(6, 7, 16, 17), uint4(7, 8, 17, 18),
+	uint4(9, 9, 19, 19), uint4(10, 11, 20, 21), uint4(11, 12, 21, 22), uint4(12, 13, 22, 23),
+	uint4(13, 14, 23, 24), uint4(15, 16, 25, 26), uint4(16, 17, 26, 27), uint4(17, 18, 27, 28),
+	uint4(19, 19, 29, 29), uint4(20, 21, 30, 31), uint4(21, 22, 31, 32), uint4(22, 23, 32, 33),
+	uint4(23, 24, 33, 34), uint4(25, 26, 35, 36), uint4(26, 27, 36, 37), uint4(27, 28, 37, 38),
+	uint4(29, 29, 39, 39), uint4(30, 31, 40, 41), uint4(31, 32, 41, 42), uint4(32, 33, 42, 43),
+	uint4(33, 34, 43, 44), uint4(35, 36, 45, 46), uint4(36, 37, 46, 47), uint4(37, 38, 47, 48),
+	uint4(39, 39, 49, 49), uint4(40, 41, 50, 51), uint4(41, 42, 51, 52), uint4(42, 43, 52, 53),
+	uint4(43, 44, 53, 54), uint4(45, 46, 55, 56), uint4(46, 47, 56, 57), uint4(47, 48, 57, 58),
+	uint4(49, 49, 59, 59), uint4(50, 51, 60, 61), uint4(51, 52, 61, 62), uint4(52, 53, 62, 63),
+	uint4(53, 54, 63, 64), uint4(55, 56, 65, 66), uint4(56, 57, 66, 67), uint4(57, 58, 67, 68),
+	uint4(59, 59, 69, 69), uint4(60, 61, 70, 71), uint4(61, 62, 71, 72), uint4(62, 63, 72, 73),
+	uint4(63, 64, 73, 74), uint4(65, 66, 75, 76), uint4(66, 67, 76, 77), uint4(67, 68, 77, 78),
+	uint4(69, 69, 79, 79), uint4(70, 71, 70, 71), uint4(71, 72, 71, 72), uint4(72, 73, 72, 73),
+	uint4(73, 74, 73, 74), uint4(75, 76, 75, 76), uint4(76, 77, 76, 77), uint4(77, 78, 77, 78),
+	uint4(79, 79, 79, 79),
+};
+static const float4 decimation_wt_10x8[141] =
+{
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.666666746f, 0.0f, 0.333333254f, 0.0f), float4(0.666666746f, 0.0f, 0.333333254f, 0.0f),
+	float4(0.666666746f, 0.0f, 0.333333254f, 0.0f), float4(0.666666746f, 0.0f, 0.333333254f, 0.0f),
+	float4(0.333333492f, 0.0f, 0.666666508f, 0.0f), float4(0.333333492f, 0.0f, 0.666666508f, 0.0f),
+	float4(0.333333492f, 0.0f, 0.666666508f, 0.0f), float4(0.333333492f, 0.0f, 0.666666508f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.75f, 0.25f, 0.0f, 0.0f),
+	float4(0.5f, 0.5f, 0.0f, 0.0f), float4(0.25f, 0.75f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.25f, 0.0f, 0.75f, 0.0f),
+	float4(0.1875f, 0.0625f, 0.5625f, 0.1875f), float4(0.125f, 0.125f, 0.375f, 0.375f),
+	float4(0.0625f, 0.1875f, 0.1875f, 0.5625f), float4(0.25f, 0.0f, 0.75f, 0.0f),
+	float4(0.5f, 0.0f, 0.5f, 0.0f), float4(0.375f, 0.125f, 0.375f, 0.125f),
+	float4(0.25f, 0.25f, 0.25f, 0.25f), float4(0.125f, 0.375f, 0.125f, 0.375f),
+	float4(0.5f, 0.0f, 0.5f, 0.0f), float4(0.75f, 0.0f, 0.25f, 0.0f),
+	float4(0.5625f, 0.1875f, 0.1875f, 0.0625f), float4(0.375f, 0.375f, 0.125f, 0.125f),
+	float4(0.1875f, 0.5625f, 0.0625f, 0.1875f), float4(0.75f, 0.0f, 0.25f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.75f, 0.25f, 0.0f, 0.0f),
+	float4(0.5f, 0.5f, 0.0f, 0.0f), float4(0.25f, 0.75f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.200000048f, 0.799999952f, 0.0f, 0.0f), float4(0.400000095f, 0.599999905f, 0.0f, 0.0f),
+	float4(0.599999905f, 0.400000095f, 0.0f, 0.0f), float4(0.800000191f, 0.199999809f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.600000024f, 0.0f, 0.399999976f, 0.0f),
+	float4(0.120000035f, 0.479999989f, 0.0800000131f, 0.319999963f), float4(0.240000069f, 0.359999955f, 0.160000026f, 0.23999995f),
+	float4(0.359999955f, 0.240000069f, 0.23999995f, 0.160000026f), float4(0.480000138f, 0.119999893f, 0.320000052f, 0.0799999163f),
+	float4(0.600000024f, 0.0f, 0.399999976f, 0.0f), float4(0.200000048f, 0.0f, 0.799999952f, 0.0f),
+	float4(0.0400000177f, 0.160000026f, 0.160000026f, 0.639999926f), float4(0.0800000355f, 0.120000012f, 0.320000052f, 0.4799999f),
+	float4(0.120000012f, 0.0800000355f, 0.4799999f, 0.320000052f), float4(0.160000071f, 0.039999973f, 0.640000105f, 0.159999833f),
+	float4(0.200000048f, 0.0f, 0.799999952f, 0.0f), float4(0.800000191f, 0.0f, 0.199999809f, 0.0f),
+	float4(0.160000071f, 0.640000105f, 0.039999973f, 0.159999833f), float4(0.320000142f, 0.480000049f, 0.0799999461f, 0.119999863f),
+	float4(0.480000049f, 0.320000142f, 0.119999863f, 0.0799999461f), float4(0.640000284f, 0.159999892f, 0.159999892f, 0.0399999246f),
+	float4(0.800000191f, 0.0f, 0.199999809f, 0.0f), float4(0.400000095f, 0.0f, 0.599999905f, 0.0f),
+	float4(0.0800000355f, 0.320000052f, 0.120000012f, 0.4799999f), float4(0.160000071f, 0.240000024f, 0.240000024f, 0.359999895f),
+	float4(0.240000024f, 0.160000071f, 0.359999895f, 0.240000024f), float4(0.320000142f, 0.0799999461f, 0.480000049f, 0.119999863f),
+	float4(0.400000095f, 0.0f, 0.599999905f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.200000048f, 0.799999952f, 0.0f, 0.0f), float4(0.400000095f, 0.599999905f, 0.0f, 0.0f),
+	float4(0.599999905f, 0.400000095f, 0.0f, 0.0f), float4(0.800000191f, 0.199999809f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.714285731f, 0.285714269f, 0.0f, 0.0f), float4(0.428571463f, 0.571428537f, 0.0f, 0.0f),
+	float4(0.142857075f, 0.857142925f, 0.0f, 0.0f), float4(0.857142925f, 0.142857075f, 0.0f, 0.0f),
+	float4(0.571428776f, 0.428571224f, 0.0f, 0.0f), float4(0.285714149f, 0.714285851f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.714285731f, 0.285714269f, 0.0f, 0.0f), float4(0.428571463f, 0.571428537f, 0.0f, 0.0f),
+	float4(0.142857075f, 0.857142925f, 0.0f, 0.0f), float4(0.857142925f, 0.142857075f, 0.0f, 0.0f),
+	float4(0.571428776f, 0.428571224f, 0.0f, 0.0f), float4(0.285714149f, 0.714285851f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.714285731f, 0.285714269f, 0.0f, 0.0f), float4(0.428571463f, 0.571428537f, 0.0f, 0.0f),
+	float4(0.142857075f, 0.857142925f, 0.0f, 0.0f), float4(0.857142925f, 0.142857075f, 0.0f, 0.0f),
+	float4(0.571428776f, 0.428571224f, 0.0f, 0.0f), float4(0.285714149f, 0.714285851f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.714285731f, 0.285714269f, 0.0f, 0.0f), float4(0.428571463f, 0.571428537f, 0.0f, 0.0f),
+	float4(0.142857075f, 0.857142925f, 0.0f, 0.0f), float4(0.857142925f, 0.142857075f, 0.0f, 0.0f),
+	float4(0.571428776f, 0.428571224f, 0.0f, 0.0f), float4(0.285714149f, 0.714285851f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.714285731f, 0.285714269f, 0.0f, 0.0f), float4(0.428571463f, 0.571428537f, 0.0f, 0.0f),
+	float4(0.142857075f, 0.857142925f, 0.0f, 0.0f), float4(0.857142925f, 0.142857075f, 0.0f, 0.0f),
+	float4(0.571428776f, 0.428571224f, 0.0f, 0.0f), float4(0.285714149f, 0.714285851f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.714285731f, 0.285714269f, 0.0f, 0.0f), float4(0.428571463f, 0.571428537f, 0.0f, 0.0f),
+	float4(0.142857075f, 0.857142925f, 0.0f, 0.0f), float4(0.857142925f, 0.142857075f, 0.0f, 0.0f),
+	float4(0.571428776f, 0.428571224f, 0.0f, 0.0f), float4(0.285714149f, 0.714285851f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.714285731f, 0.285714269f, 0.0f, 0.0f), float4(0.428571463f, 0.571428537f, 0.0f, 0.0f),
+	float4(0.142857075f, 0.857142925f, 0.0f, 0.0f), float4(0.857142925f, 0.142857075f, 0.0f, 0.0f),
+	float4(0.571428776f, 0.428571224f, 0.0f, 0.0f), float4(0.285714149f, 0.714285851f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.714285731f, 0.285714269f, 0.0f, 0.0f), float4(0.428571463f, 0.571428537f, 0.0f, 0.0f),
+	float4(0.142857075f, 0.857142925f, 0.0f, 0.0f), float4(0.857142925f, 0.142857075f, 0.0f, 0.0f),
+	float4(0.571428776f, 0.428571224f, 0.0f, 0.0f), float4(0.285714149f, 0.714285851f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f),
+};
+static const uint4 infill_idx_10x8[320] =
+{
+	uint4(0, 0, 0, 0), uint4(0, 1, 0, 0), uint4(0, 1, 0, 0), uint4(1, 1, 1, 1),
+	uint4(1, 2, 1, 1), uint4(1, 2, 1, 1), uint4(2, 2, 2, 2), uint4(2, 3, 2, 2),
+	uint4(2, 3, 2, 2), uint4(3, 3, 3, 3), uint4(0, 0, 4, 0), uint4(0, 1, 4, 5),
+	uint4(0, 1, 4, 5), uint4(1, 1, 5, 1), uint4(1, 2, 5, 6), uint4(1, 2, 5, 6),
+	uint4(2, 2, 6, 2), uint4(2, 3, 6, 7), uint4(2, 3, 6, 7), uint4(3, 3, 7, 3),
+	uint4(0, 0, 4, 0), uint4(0, 1, 4, 5), uint4(0, 1, 4, 5), uint4(1, 1, 5, 1),
+	uint4(1, 2, 5, 6), uint4(1, 2, 5, 6), uint4(2, 2, 6, 2), uint4(2, 3, 6, 7),
+	uint4(2, 3, 6, 7), uint4(3, 3, 7, 3), uint4(4, 4, 8, 4), uint4(4, 5, 8, 9),
+	uint4(4, 5, 8, 9), uint4(5, 5, 9, 5), uint4(5, 6, 9, 10), uint4(5, 6, 9, 10),
+	uint4(6, 6, 10, 6), uint4(6, 7, 10, 11), uint4(6, 7, 10, 11), uint4(7, 7, 11, 7),
+	uint4(4, 4, 8, 4), uint4(4, 5, 8, 9), uint4(4, 5, 8, 9), uint4(5, 5, 9, 5),
+	uint4(5, 6, 9, 10), uint4(5, 6, 9, 10), uint4(6, 6, 10, 6), uint4(6, 7, 10, 11),
+	uint4(6, 7, 10, 11), uint4(7, 7, 11, 7), uint4(8, 8, 12, 8), uint4(8, 9, 12, 13),
+	uint4(8, 9, 12, 13), uint4(9, 9, 13, 9), uint4(9, 10, 13, 14), uint4(9, 10, 13, 14),
+	uint4(10, 10, 14, 10), uint4(10, 11, 14, 15), uint4(10, 11, 14, 15), uint4(11, 11, 15, 11),
+	uint4(8, 8, 12, 8), uint4(8, 9, 12, 13), uint4(8, 9, 12, 13), uint4(9, 9, 13, 9),
+	uint4(9, 10, 13, 14), uint4(9, 10, 13, 14), uint4(10, 10, 14, 10), uint4(10, 11, 14, 15),
+	uint4(10, 11, 14, 15), uint4(11, 11, 15, 11), uint4(12, 12, 12, 12), uint4(12, 13, 12, 12),
+	uint4(12, 13, 12, 12), uint4(13, 13, 13, 13), uint4(13, 14, 13, 13), uint4(13, 14, 13, 13),
+	uint4(14, 14, 14, 14), uint4(14, 15, 14, 14), uint4(14, 15, 14, 14), uint4(15, 15, 15, 15),
+	uint4(0, 0, 0, 0), uint4(0, 1, 0, 0), uint4(0, 1, 0, 0), uint4(1, 2, 1, 1),
+	uint4(1, 2, 1, 1), uint4(2, 3, 2, 2), uint4(2, 3, 2, 2), uint4(3, 4, 3, 3),
+	uint4(3, 4, 3, 3), uint4(4, 4, 4, 4), uint4(0, 0, 5, 0), uint4(0, 1, 5, 6),
+	uint4(0, 1, 5, 6), uint4(1, 2, 6, 7), uint4(1, 2, 6, 7), uint4(2, 3, 7, 8),
+	uint4(2, 3, 7, 8), uint4(3, 4, 8, 9), uint4(3, 4, 8, 9), uint4(4, 4, 9, 4),
+	uint4(5, 5, 10, 5), uint4(5, 6, 10, 11), uint4(5, 6, 5, 11), uint4(6, 7, 11, 12),
+	uint4(6, 7, 6, 12), uint4(7, 8, 12, 13), uint4(7, 8, 12, 13), uint4(8, 9, 13, 8),
+	uint4(8, 9, 13, 14), uint4(9, 9, 14, 9), uint4(5, 5, 10, 5), uint4(5, 6, 10, 11),
+	uint4(5, 6, 10, 11), uint4(6, 7, 11, 12), uint4(6, 7, 11, 12), uint4(7, 8, 12, 13),
+	uint4(7, 8, 12, 13), uint4(8, 9, 13, 14), uint4(8, 9, 13, 14), uint4(9, 9, 14, 9),
+	uint4(10, 10, 15, 10), uint4(10, 11, 15, 16), uint4(10, 11, 15, 16), uint4(11, 12, 16, 17),
+	uint4(11, 12, 16, 17), uint4(12, 13, 17, 18), uint4(12, 13, 17, 18), uint4(13, 14, 18, 19),
+	uint4(13, 14, 18, 19), uint4(14, 14, 19, 14), uint4(10, 10, 15, 10), uint4(10, 11, 15, 16),
+	uint4(10, 11, 15, 16), uint4(11, 12, 16, 17), uint4(11, 12, 16, 17), uint4(12, 12, 17, 18),
+	uint4(12, 13, 17, 18), uint4(13, 13, 18, 19), uint4(13, 14, 18, 19), uint4(14, 14, 19, 14),
+	uint4(15, 15, 20, 15), uint4(15, 16, 20, 21), uint4(15, 16, 20, 21), uint4(16, 17, 21, 22),
+	uint4(16, 17, 21, 22), uint4(17, 18, 22, 23), uint4(17, 18, 22, 23), uint4(18, 19, 23, 24),
+	uint4(18, 19, 23, 24), uint4(19, 19, 24, 19), uint4(20, 20, 20, 20), uint4(20, 21, 20, 20),
+	uint4(20, 21, 20, 20), uint4(21, 22, 21, 21), uint4(21, 22, 21, 21), uint4(22, 23, 22, 22),
+	uint4(22, 23, 22, 22), uint4(23, 24, 23, 23), uint4(23, 24, 23, 23), uint4(24, 24, 24, 24),
+	uint4(0, 0, 0, 0), uint4(0, 1, 0, 0), uint4(1, 2, 1, 1), uint4(1, 2, 1, 1),
+	uint4(2, 3, 2, 2), uint4(2, 3, 2, 2), uint4(3, 4, 3, 3), uint4(3, 4, 3, 3),
+	uint4(4, 5, 4, 4), uint4(5, 5, 5, 5), uint4(0, 0, 6, 0), uint4(0, 1, 6, 7),
+	uint4(1, 2, 7, 8), uint4(1, 2, 7, 8), uint4(2, 3, 8, 9), uint4(2, 3, 8, 9),
+	uint4(3, 4, 9, 10), uint4(3, 4, 9, 10), uint4(4, 5, 10, 11), uint4(5, 5, 11, 5),
+	uint4(6, 6, 12, 6), uint4(6, 7, 12, 13), uint4(7, 8, 13, 14), uint4(7, 8, 13, 14),
+	uint4(8, 9, 14, 15), uint4(8, 9, 14, 15), uint4(9, 10, 15, 16), uint4(9, 10, 15, 16),
+	uint4(10, 11, 16, 17), uint4(11, 11, 17, 11), uint4(12, 12, 18, 12), uint4(12, 13, 18, 19),
+	uint4(13, 14, 19, 13), uint4(13, 14, 19, 20), uint4(14, 15, 20, 21), uint4(14, 15, 14, 21),
+	uint4(15, 16, 21, 22), uint4(15, 16, 15, 22), uint4(16, 17, 22, 23), uint4(17, 17, 23, 17),
+	uint4(12, 12, 18, 12), uint4(12, 13, 18, 19), uint4(13, 13, 19, 20), uint4(13, 14, 19, 20),
+	uint4(14, 14, 20, 21), uint4(14, 15, 20, 21), uint4(15, 16, 21, 22), uint4(15, 16, 21, 22),
+	uint4(16, 17, 22, 23), uint4(17, 17, 23, 17), uint4(18, 18, 24, 18), uint4(18, 19, 24, 25),
+	uint4(19, 20, 25, 26), uint4(19, 20, 25, 26), uint4(20, 21, 26, 27), uint4(20, 21, 26, 27),
+	uint4(21, 22, 27, 28), uint4(21, 22, 27, 28), uint4(22, 23, 28, 29), uint4(23, 23, 29, 23),
+	uint4(24, 24, 30, 24), uint4(24, 25, 30, 31), uint4(25, 26, 31, 32), uint4(25, 26, 31, 32),
+	uint4(26, 27, 32, 33), uint4(26, 27, 32, 33), uint4(27, 28, 33, 34), uint4(27, 28, 27, 34),
+	uint4(28, 29, 34, 35), uint4(29, 29, 35, 29), uint4(30, 30, 30, 30), uint4(30, 31, 30, 30),
+	uint4(31, 32, 31, 31), uint4(31, 32, 31, 31), uint4(32, 33, 32, 32), uint4(32, 33, 32, 32),
+	uint4(33, 34, 33, 33), uint4(33, 34, 33, 33), uint4(34, 35, 34, 34), uint4(35, 35, 35, 35),
+	uint4(0, 0, 0, 0), uint4(0, 1, 0, 0), uint4(1, 2, 1, 1), uint4(2, 3, 2, 2),
+	uint4(3, 4, 3, 3), uint4(3, 4, 3, 3), uint4(4, 5, 4, 4), uint4(5, 6, 5, 5),
+	uint4(6, 7, 6, 6), uint4(7, 7, 7, 7), uint4(8, 8, 8, 8), uint4(8, 9, 8, 8),
+	uint4(9, 10, 9, 9), uint4(10, 11, 10, 10), uint4(11, 12, 11, 11), uint4(11, 12, 11, 11),
+	uint4(12, 13, 12, 12), uint4(13, 14, 13, 13), uint4(14, 15, 14, 14), uint4(15, 15, 15, 15),
+	uint4(16, 16, 16, 16), uint4(16, 17, 16, 16), uint4(17, 18, 17, 17), uint4(18, 19, 18, 18),
+	uint4(19, 20, 19, 19), uint4(19, 20, 19, 19), uint4(20, 21, 20, 20), uint4(21, 22, 21, 21),
+	uint4(22, 23, 22, 22), uint4(23, 23, 23, 23), uint4(24, 24, 24, 24), uint4(24, 25, 24, 24),
+	uint4(25, 26, 25, 25), uint4(26, 27, 26, 26), uint4(27, 28, 27, 27), uint4(27, 28, 27, 27),
+	uint4(28, 29, 28, 28), uint4(29, 30, 29, 29), uint4(30, 31, 30, 30), uint4(31, 31, 31, 31),
+	uint4(32, 32, 32, 32), uint4(32, 33, 32, 32), uint4(33, 34, 33, 33), uint4(34, 35, 34, 34),
+	uint4(35, 36, 35, 35), uint4(35, 36, 35, 35), uint4(36, 37, 36, 36), uint4(37, 38, 37, 37),
+	uint4(38, 39, 38, 38), uint4(39, 39, 39, 39), uint4(40, 40, 40, 40), uint4(40, 41, 40, 40),
+	uint4(41, 42, 41, 41), uint4(42, 43, 42, 42), uint4(43, 44, 43, 43), uint4(43, 44, 43, 43),
+	uint4(44, 45, 44, 44), uint4(45, 46, 45, 45), uint4(46, 47, 46, 46), uint4(47, 47, 47, 47),
+	uint4(48, 48, 48, 48), uint4(48, 49, 48, 48), uint4(49, 50, 49, 49), uint4(50, 51, 50, 50),
+	uint4(51, 52, 51, 51), uint4(51, 52, 51, 51), uint4(52, 53, 52, 52), uint4(53, 54, 53, 53),
+	uint4(54, 55, 54, 54), uint4(55, 55, 55, 55), uint4(56, 56, 56, 56), uint4(56, 57, 56, 56),
+	uint4(57, 58, 57, 57), uint4(58, 59, 58, 58), uint4(59, 60, 59, 59), uint4(59, 60, 59, 59),
+	uint4(60, 61, 60, 60), uint4(61, 62, 61, 61), uint4(62, 63, 62, 62), uint4(63, 63, 63, 63),
+};
+static const float4 infill_wt_10x8[320] =
+{
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.6875f, 0.3125f, 0.0f, 0.0f), float4(0.3125f, 0.6875f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.6875f, 0.3125f, 0.0f, 0.0f), float4(0.3125f, 0.6875f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.6875f, 0.3125f, 0.0f, 0.0f),
+	float4(0.3125f, 0.6875f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.5625f, 0.0f, 0.4375f, 0.0f), float4(0.375f, 0.1875f, 0.3125f, 0.125f),
+	float4(0.1875f, 0.375f, 0.125f, 0.3125f), float4(0.5625f, 0.0f, 0.4375f, 0.0f), float4(0.375f, 0.1875f, 0.3125f, 0.125f), float4(0.1875f, 0.375f, 0.125f, 0.3125f),
+	float4(0.5625f, 0.0f, 0.4375f, 0.0f), float4(0.375f, 0.1875f, 0.3125f, 0.125f), float4(0.1875f, 0.375f, 0.125f, 0.3125f), float4(0.5625f, 0.0f, 0.4375f, 0.0f),
+	float4(0.125f, 0.0f, 0.875f, 0.0f), float4(0.0625f, 0.0625f, 0.625f, 0.25f), float4(0.0625f, 0.0625f, 0.25f, 0.625f), float4(0.125f, 0.0f, 0.875f, 0.0f),
+	float4(0.0625f, 0.0625f, 0.625f, 0.25f), float4(0.0625f, 0.0625f, 0.25f, 0.625f), float4(0.125f, 0.0f, 0.875f, 0.0f), float4(0.0625f, 0.0625f, 0.625f, 0.25f),
+	float4(0.0625f, 0.0625f, 0.25f, 0.625f), float4(0.125f, 0.0f, 0.875f, 0.0f), float4(0.6875f, 0.0f, 0.3125f, 0.0f), float4(0.5f, 0.1875f, 0.1875f, 0.125f),
+	float4(0.1875f, 0.5f, 0.125f, 0.1875f), float4(0.6875f, 0.0f, 0.3125f, 0.0f), float4(0.5f, 0.1875f, 0.1875f, 0.125f), float4(0.1875f, 0.5f, 0.125f, 0.1875f),
+	float4(0.6875f, 0.0f, 0.3125f, 0.0f), float4(0.5f, 0.1875f, 0.1875f, 0.125f), float4(0.1875f, 0.5f, 0.125f, 0.1875f), float4(0.6875f, 0.0f, 0.3125f, 0.0f),
+	float4(0.3125f, 0.0f, 0.6875f, 0.0f), float4(0.1875f, 0.125f, 0.5f, 0.1875f), float4(0.125f, 0.1875f, 0.1875f, 0.5f), float4(0.3125f, 0.0f, 0.6875f, 0.0f),
+	float4(0.1875f, 0.125f, 0.5f, 0.1875f), float4(0.125f, 0.1875f, 0.1875f, 0.5f), float4(0.3125f, 0.0f, 0.6875f, 0.0f), float4(0.1875f, 0.125f, 0.5f, 0.1875f),
+	float4(0.125f, 0.1875f, 0.1875f, 0.5f), float4(0.3125f, 0.0f, 0.6875f, 0.0f), float4(0.875f, 0.0f, 0.125f, 0.0f), float4(0.625f, 0.25f, 0.0625f, 0.0625f),
+	float4(0.25f, 0.625f, 0.0625f, 0.0625f), float4(0.875f, 0.0f, 0.125f, 0.0f), float4(0.625f, 0.25f, 0.0625f, 0.0625f), float4(0.25f, 0.625f, 0.0625f, 0.0625f),
+	float4(0.875f, 0.0f, 0.125f, 0.0f), float4(0.625f, 0.25f, 0.0625f, 0.0625f), float4(0.25f, 0.625f, 0.0625f, 0.0625f), float4(0.875f, 0.0f, 0.125f, 0.0f),
+	float4(0.4375f, 0.0f, 0.5625f, 0.0f), float4(0.3125f, 0.125f, 0.375f, 0.1875f), float4(0.125f, 0.3125f, 0.1875f, 0.375f), float4(0.4375f, 0.0f, 0.5625f, 0.0f),
+	float4(0.3125f, 0.125f, 0.375f, 0.1875f), float4(0.125f, 0.3125f, 0.1875f, 0.375f), float4(0.4375f, 0.0f, 0.5625f, 0.0f), float4(0.3125f, 0.125f, 0.375f, 0.1875f),
+	float4(0.125f, 0.3125f, 0.1875f, 0.375f), float4(0.4375f, 0.0f, 0.5625f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.6875f, 0.3125f, 0.0f, 0.0f),
+	float4(0.3125f, 0.6875f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.6875f, 0.3125f, 0.0f, 0.0f), float4(0.3125f, 0.6875f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.6875f, 0.3125f, 0.0f, 0.0f), float4(0.3125f, 0.6875f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.5625f, 0.4375f, 0.0f, 0.0f), float4(0.125f, 0.875f, 0.0f, 0.0f), float4(0.6875f, 0.3125f, 0.0f, 0.0f),
+	float4(0.1875f, 0.8125f, 0.0f, 0.0f), float4(0.75f, 0.25f, 0.0f, 0.0f), float4(0.3125f, 0.6875f, 0.0f, 0.0f), float4(0.875f, 0.125f, 0.0f, 0.0f),
+	float4(0.4375f, 0.5625f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.4375f, 0.0f, 0.5625f, 0.0f), float4(0.25f, 0.1875f, 0.3125f, 0.25f),
+	float4(0.0625f, 0.375f, 0.0625f, 0.5f), float4(0.3125f, 0.125f, 0.375f, 0.1875f), float4(0.0625f, 0.375f, 0.125f, 0.4375f), float4(0.3125f, 0.125f, 0.4375f, 0.125f),
+	float4(0.125f, 0.3125f, 0.1875f, 0.375f), float4(0.375f, 0.0625f, 0.5f, 0.0625f), float4(0.1875f, 0.25f, 0.25f, 0.3125f), float4(0.4375f, 0.0f, 0.5625f, 0.0f),
+	float4(0.875f, 0.0f, 0.125f, 0.0f), float4(0.5f, 0.375f, 0.0625f, 0.0625f), float4(0.125f, 0.75f, 0.0f, 0.125f), float4(0.625f, 0.25f, 0.0625f, 0.0625f),
+	float4(0.1875f, 0.6875f, 0.0f, 0.125f), float4(0.6875f, 0.1875f, 0.0625f, 0.0625f), float4(0.25f, 0.625f, 0.0625f, 0.0625f), float4(0.75f, 0.125f, 0.125f, 0.0f),
+	float4(0.375f, 0.5f, 0.0625f, 0.0625f), float4(0.875f, 0.0f, 0.125f, 0.0f), float4(0.3125f, 0.0f, 0.6875f, 0.0f), float4(0.1875f, 0.125f, 0.375f, 0.3125f),
+	float4(0.0625f, 0.25f, 0.0625f, 0.625f), float4(0.1875f, 0.125f, 0.5f, 0.1875f), float4(0.0625f, 0.25f, 0.125f, 0.5625f), float4(0.25f, 0.0625f, 0.5f, 0.1875f),
+	float4(0.125f, 0.1875f, 0.1875f, 0.5f), float4(0.25f, 0.0625f, 0.625f, 0.0625f), float4(0.125f, 0.1875f, 0.3125f, 0.375f), float4(0.3125f, 0.0f, 0.6875f, 0.0f),
+	float4(0.6875f, 0.0f, 0.3125f, 0.0f), float4(0.375f, 0.3125f, 0.1875f, 0.125f), float4(0.0625f, 0.625f, 0.0625f, 0.25f), float4(0.5f, 0.1875f, 0.1875f, 0.125f),
+	float4(0.125f, 0.5625f, 0.0625f, 0.25f), float4(0.5f, 0.1875f, 0.25f, 0.0625f), float4(0.1875f, 0.5f, 0.125f, 0.1875f), float4(0.625f, 0.0625f, 0.25f, 0.0625f),
+	float4(0.3125f, 0.375f, 0.125f, 0.1875f), float4(0.6875f, 0.0f, 0.3125f, 0.0f), float4(0.125f, 0.0f, 0.875f, 0.0f), float4(0.0625f, 0.0625f, 0.5f, 0.375f),
+	float4(0.0f, 0.125f, 0.125f, 0.75f), float4(0.0625f, 0.0625f, 0.625f, 0.25f), float4(0.0f, 0.125f, 0.1875f, 0.6875f), float4(0.125f, 0.0f, 0.625f, 0.25f),
+	float4(0.0625f, 0.0625f, 0.25f, 0.625f), float4(0.125f, 0.0f, 0.75f, 0.125f), float4(0.0625f, 0.0625f, 0.375f, 0.5f), float4(0.125f, 0.0f, 0.875f, 0.0f),
+	float4(0.5625f, 0.0f, 0.4375f, 0.0f), float4(0.3125f, 0.25f, 0.25f, 0.1875f), float4(0.0625f, 0.5f, 0.0625f, 0.375f), float4(0.375f, 0.1875f, 0.3125f, 0.125f),
+	float4(0.125f, 0.4375f, 0.0625f, 0.375f), float4(0.4375f, 0.125f, 0.3125f, 0.125f), float4(0.1875f, 0.375f, 0.125f, 0.3125f), float4(0.5f, 0.0625f, 0.375f, 0.0625f),
+	float4(0.25f, 0.3125f, 0.1875f, 0.25f), float4(0.5625f, 0.0f, 0.4375f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.5625f, 0.4375f, 0.0f, 0.0f),
+	float4(0.125f, 0.875f, 0.0f, 0.0f), float4(0.6875f, 0.3125f, 0.0f, 0.0f), float4(0.1875f, 0.8125f, 0.0f, 0.0f), float4(0.75f, 0.25f, 0.0f, 0.0f),
+	float4(0.3125f, 0.6875f, 0.0f, 0.0f), float4(0.875f, 0.125f, 0.0f, 0.0f), float4(0.4375f, 0.5625f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.4375f, 0.5625f, 0.0f, 0.0f), float4(0.875f, 0.125f, 0.0f, 0.0f), float4(0.3125f, 0.6875f, 0.0f, 0.0f),
+	float4(0.75f, 0.25f, 0.0f, 0.0f), float4(0.1875f, 0.8125f, 0.0f, 0.0f), float4(0.6875f, 0.3125f, 0.0f, 0.0f), float4(0.125f, 0.875f, 0.0f, 0.0f),
+	float4(0.5625f, 0.4375f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.3125f, 0.0f, 0.6875f, 0.0f), float4(0.125f, 0.1875f, 0.3125f, 0.375f),
+	float4(0.25f, 0.0625f, 0.625f, 0.0625f), float4(0.125f, 0.1875f, 0.1875f, 0.5f), float4(0.25f, 0.0625f, 0.5f, 0.1875f), float4(0.0625f, 0.25f, 0.125f, 0.5625f),
+	float4(0.1875f, 0.125f, 0.5f, 0.1875f), float4(0.0625f, 0.25f, 0.0625f, 0.625f), float4(0.1875f, 0.125f, 0.375f, 0.3125f), float4(0.3125f, 0.0f, 0.6875f, 0.0f),
+	float4(0.5625f, 0.0f, 0.4375f, 0.0f), float4(0.25f, 0.3125f, 0.1875f, 0.25f), float4(0.5f, 0.0625f, 0.375f, 0.0625f), float4(0.1875f, 0.375f, 0.125f, 0.3125f),
+	float4(0.4375f, 0.125f, 0.3125f, 0.125f), float4(0.125f, 0.4375f, 0.0625f, 0.375f), float4(0.375f, 0.1875f, 0.3125f, 0.125f), float4(0.0625f, 0.5f, 0.0625f, 0.375f),
+	float4(0.3125f, 0.25f, 0.25f, 0.1875f), float4(0.5625f, 0.0f, 0.4375f, 0.0f), float4(0.875f, 0.0f, 0.125f, 0.0f), float4(0.375f, 0.5f, 0.0625f, 0.0625f),
+	float4(0.75f, 0.125f, 0.125f, 0.0f), float4(0.25f, 0.625f, 0.0625f, 0.0625f), float4(0.6875f, 0.1875f, 0.0625f, 0.0625f), float4(0.1875f, 0.6875f, 0.0f, 0.125f),
+	float4(0.625f, 0.25f, 0.0625f, 0.0625f), float4(0.125f, 0.75f, 0.0f, 0.125f), float4(0.5f, 0.375f, 0.0625f, 0.0625f), float4(0.875f, 0.0f, 0.125f, 0.0f),
+	float4(0.125f, 0.0f, 0.875f, 0.0f), float4(0.0625f, 0.0625f, 0.375f, 0.5f), float4(0.125f, 0.0f, 0.75f, 0.125f), float4(0.0625f, 0.0625f, 0.25f, 0.625f),
+	float4(0.125f, 0.0f, 0.625f, 0.25f), float4(0.0f, 0.125f, 0.1875f, 0.6875f), float4(0.0625f, 0.0625f, 0.625f, 0.25f), float4(0.0f, 0.125f, 0.125f, 0.75f),
+	float4(0.0625f, 0.0625f, 0.5f, 0.375f), float4(0.125f, 0.0f, 0.875f, 0.0f), float4(0.4375f, 0.0f, 0.5625f, 0.0f), float4(0.1875f, 0.25f, 0.25f, 0.3125f),
+	float4(0.375f, 0.0625f, 0.5f, 0.0625f), float4(0.125f, 0.3125f, 0.1875f, 0.375f), float4(0.3125f, 0.125f, 0.4375f, 0.125f), float4(0.0625f, 0.375f, 0.125f, 0.4375f),
+	float4(0.3125f, 0.125f, 0.375f, 0.1875f), float4(0.0625f, 0.375f, 0.0625f, 0.5f), float4(0.25f, 0.1875f, 0.3125f, 0.25f), float4(0.4375f, 0.0f, 0.5625f, 0.0f),
+	float4(0.75f, 0.0f, 0.25f, 0.0f), float4(0.3125f, 0.4375f, 0.125f, 0.125f), float4(0.6875f, 0.0625f, 0.1875f, 0.0625f), float4(0.25f, 0.5f, 0.0625f, 0.1875f),
+	float4(0.5625f, 0.1875f, 0.1875f, 0.0625f), float4(0.125f, 0.625f, 0.0625f, 0.1875f), float4(0.5f, 0.25f, 0.1875f, 0.0625f), float4(0.125f, 0.625f, 0.0f, 0.25f),
+	float4(0.4375f, 0.3125f, 0.125f, 0.125f), float4(0.75f, 0.0f, 0.25f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.4375f, 0.5625f, 0.0f, 0.0f),
+	float4(0.875f, 0.125f, 0.0f, 0.0f), float4(0.3125f, 0.6875f, 0.0f, 0.0f), float4(0.75f, 0.25f, 0.0f, 0.0f), float4(0.1875f, 0.8125f, 0.0f, 0.0f),
+	float4(0.6875f, 0.3125f, 0.0f, 0.0f), float4(0.125f, 0.875f, 0.0f, 0.0f), float4(0.5625f, 0.4375f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.25f, 0.75f, 0.0f, 0.0f), float4(0.4375f, 0.5625f, 0.0f, 0.0f), float4(0.6875f, 0.3125f, 0.0f, 0.0f),
+	float4(0.875f, 0.125f, 0.0f, 0.0f), float4(0.125f, 0.875f, 0.0f, 0.0f), float4(0.3125f, 0.6875f, 0.0f, 0.0f), float4(0.5625f, 0.4375f, 0.0f, 0.0f),
+	float4(0.75f, 0.25f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.25f, 0.75f, 0.0f, 0.0f),
+	float4(0.4375f, 0.5625f, 0.0f, 0.0f), float4(0.6875f, 0.3125f, 0.0f, 0.0f), float4(0.875f, 0.125f, 0.0f, 0.0f), float4(0.125f, 0.875f, 0.0f, 0.0f),
+	float4(0.3125f, 0.6875f, 0.0f, 0.0f), float4(0.5625f, 0.4375f, 0.0f, 0.0f), float4(0.75f, 0.25f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.25f, 0.75f, 0.0f, 0.0f), float4(0.4375f, 0.5625f, 0.0f, 0.0f), float4(0.6875f, 0.3125f, 0.0f, 0.0f),
+	float4(0.875f, 0.125f, 0.0f, 0.0f), float4(0.125f, 0.875f, 0.0f, 0.0f), float4(0.3125f, 0.6875f, 0.0f, 0.0f), float4(0.5625f, 0.4375f, 0.0f, 0.0f),
+	float4(0.75f, 0.25f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.25f, 0.75f, 0.0f, 0.0f),
+	float4(0.4375f, 0.5625f, 0.0f, 0.0f), float4(0.6875f, 0.3125f, 0.0f, 0.0f), float4(0.875f, 0.125f, 0.0f, 0.0f), float4(0.125f, 0.875f, 0.0f, 0.0f),
+	float4(0.3125f, 0.6875f, 0.0f, 0.0f), float4(0.5625f, 0.4375f, 0.0f, 0.0f), float4(0.75f, 0.25f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.25f, 0.75f, 0.0f, 0.0f), float4(0.4375f, 0.5625f, 0.0f, 0.0f), float4(0.6875f, 0.3125f, 0.0f, 0.0f),
+	float4(0.875f, 0.125f, 0.0f, 0.0f), float4(0.125f, 0.875f, 0.0f, 0.0f), float4(0.3125f, 0.6875f, 0.0f, 0.0f), float4(0.5625f, 0.4375f, 0.0f, 0.0f),
+	float4(0.75f, 0.25f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.25f, 0.75f, 0.0f, 0.0f),
+	float4(0.4375f, 0.5625f, 0.0f, 0.0f), float4(0.6875f, 0.3125f, 0.0f, 0.0f), float4(0.875f, 0.125f, 0.0f, 0.0f), float4(0.125f, 0.875f, 0.0f, 0.0f),
+	float4(0.3125f, 0.6875f, 0.0f, 0.0f), float4(0.5625f, 0.4375f, 0.0f, 0.0f), float4(0.75f, 0.25f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.25f, 0.75f, 0.0f, 0.0f), float4(0.4375f, 0.5625f, 0.0f, 0.0f), float4(0.6875f, 0.3125f, 0.0f, 0.0f),
+	float4(0.875f, 0.125f, 0.0f, 0.0f), float4(0.125f, 0.875f, 0.0f, 0.0f), float4(0.3125f, 0.6875f, 0.0f, 0.0f), float4(0.5625f, 0.4375f, 0.0f, 0.0f),
+	float4(0.75f, 0.25f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.25f, 0.75f, 0.0f, 0.0f),
+	float4(0.4375f, 0.5625f, 0.0f, 0.0f), float4(0.6875f, 0.3125f, 0.0f, 0.0f), float4(0.875f, 0.125f, 0.0f, 0.0f), float4(0.125f, 0.875f, 0.0f, 0.0f),
+	float4(0.3125f, 0.6875f, 0.0f, 0.0f), float4(0.5625f, 0.4375f, 0.0f, 0.0f), float4(0.75f, 0.25f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+};
+static const uint4 pseudo_inverse_idx_10x8[564] =
+{
+	uint4(0, 1, 2, 3), uint4(4, 6, 10, 11), uint4(12, 13, 14, 20), uint4(21, 30, 31, 50),
+	uint4(0, 1, 2, 3), uint4(4, 5, 6, 7), uint4(10, 12, 13, 14), uint4(16, 32, 33, 34),
+	uint4(2, 3, 4, 5), uint4(6, 7, 8, 9), uint4(13, 15, 16, 17), uint4(19, 35, 36, 37),
+	uint4(3, 5, 6, 7), uint4(8, 9, 15, 16), uint4(17, 18, 19, 28), uint4(29, 38, 39, 59),
+	uint4(0, 1, 10, 11), uint4(20, 21, 22, 23), uint4(24, 30, 31, 33), uint4(40, 50, 51, 60),
+	uint4(2, 3, 4, 12), uint4(13, 14, 20, 22), uint4(23, 24, 26, 32), uint4(33, 34, 53, 54),
+	uint4(5, 6, 7, 15), uint4(16, 17, 23, 25), uint4(26, 27, 29, 35), uint4(36, 37, 55, 56),
+	uint4(8, 9, 18, 19), uint4(25, 26, 27, 28), uint4(29, 36, 38, 39), uint4(49, 58, 59, 69),
+	uint4(10, 20, 21, 30), uint4(40, 41, 43, 50), uint4(51, 52, 53, 54), uint4(60, 61, 70, 71),
+	uint4(23, 24, 42, 43), uint4(44, 50, 52, 53), uint4(54, 56, 62, 63), uint4(64, 72, 73, 74),
+	uint4(25, 26, 45, 46), uint4(47, 53, 55, 56), uint4(57, 59, 65, 66), uint4(67, 75, 76, 77),
+	uint4(19, 28, 29, 39), uint4(46, 48, 49, 55), uint4(56, 57, 58, 59), uint4(68, 69, 78, 79),
+	uint4(20, 40, 41, 50), uint4(51, 60, 61, 62), uint4(63, 64, 70, 71), uint4(72, 73, 74, 76),
+	uint4(42, 43, 44, 60), uint4(62, 63, 64, 66), uint4(70, 71, 72, 73), uint4(74, 75, 76, 77),
+	uint4(45, 46, 47, 63), uint4(65, 66, 67, 69), uint4(72, 73, 74, 75), uint4(76, 77, 78, 79),
+	uint4(29, 48, 49, 58), uint4(59, 65, 66, 67), uint4(68, 69, 73, 75), uint4(76, 77, 78, 79),
+	uint4(0, 1, 2, 3), uint4(5, 7, 10, 11), uint4(12, 13, 20, 21), uint4(23, 30, 40, 41),
+	uint4(0, 1, 2, 3), uint4(5, 7, 10, 11), uint4(12, 13, 15, 20), uint4(21, 22, 23, 25),
+	uint4(0, 1, 2, 3), uint4(4, 5, 6, 7), uint4(8, 9, 12, 14), uint4(15, 17, 24, 25),
+	uint4(2, 3, 4, 6), uint4(7, 8, 9, 14), uint4(16, 17, 18, 19), uint4(26, 27, 28, 29),
+	uint4(2, 4, 6, 7), uint4(8, 9, 14, 16), uint4(17, 18, 19, 26), uint4(28, 29, 48, 49),
+	uint4(0, 1, 10, 11), uint4(12, 13, 20, 21), uint4(22, 23, 25, 30), uint4(40, 41, 50, 60),
+	uint4(1, 2, 3, 10), uint4(11, 12, 13, 15), uint4(20, 21, 22, 23), uint4(25, 40, 42, 43),
+	uint4(4, 5, 12, 13), uint4(14, 15, 16, 17), uint4(21, 22, 24, 25), uint4(26, 27, 44, 45),
+	uint4(6, 7, 8, 14), uint4(16, 17, 18, 19), uint4(24, 26, 27, 28), uint4(29, 46, 47, 49),
+	uint4(8, 9, 16, 17), uint4(18, 19, 24, 26), uint4(27, 28, 29, 39), uint4(48, 49, 59, 69),
+	uint4(0, 10, 20, 21), uint4(30, 31, 32, 33), uint4(40, 41, 42, 43), uint4(50, 51, 60, 70),
+	uint4(12, 22, 23, 30), uint4(31, 32, 33, 35), uint4(40, 41, 42, 43), uint4(45, 52, 53, 62),
+	uint4(14, 15, 24, 25), uint4(32, 34, 35, 37), uint4(42, 44, 45, 47), uint4(54, 55, 64, 65),
+	uint4(16, 17, 26, 27), uint4(34, 36, 37, 38), uint4(39, 44, 46, 47), uint4(48, 49, 56, 67),
+	uint4(9, 19, 28, 29), uint4(36, 37, 38, 39), uint4(46, 47, 48, 49), uint4(58, 59, 69, 79),
+	uint4(10, 20, 30, 31), uint4(40, 50, 51, 52), uint4(53, 55, 60, 61), uint4(62, 63, 70, 71),
+	uint4(30, 32, 33, 50), uint4(51, 52, 53, 55), uint4(57, 60, 61, 62), uint4(63, 65, 72, 73),
+	uint4(34, 35, 52, 54), uint4(55, 57, 58, 59), uint4(62, 63, 64, 65), uint4(66, 67, 74, 75),
+	uint4(36, 37, 39, 52), uint4(54, 56, 57, 58), uint4(59, 64, 66, 67), uint4(68, 69, 76, 77),
+	uint4(19, 29, 38, 39), uint4(49, 54, 56, 57), uint4(58, 59, 66, 67), uint4(68, 69, 78, 79),
+	uint4(30, 31, 40, 50), uint4(51, 53, 60, 61), uint4(62, 63, 70, 71), uint4(72, 73, 75, 77),
+	uint4(50, 51, 52, 53), uint4(60, 61, 62, 63), uint4(65, 70, 71, 72), uint4(73, 74, 75, 77),
+	uint4(54, 55, 62, 64), uint4(65, 67, 70, 71), uint4(72, 73, 74, 75), uint4(76, 77, 78, 79),
+	uint4(56, 57, 58, 59), uint4(64, 66, 67, 68), uint4(69, 72, 73, 74), uint4(76, 77, 78, 79),
+	uint4(38, 39, 56, 58), uint4(59, 64, 66, 67), uint4(68, 69, 72, 74), uint4(76, 77, 78, 79),
+	uint4(0, 1, 2, 3), uint4(4, 6, 10, 11), uint4(12, 13, 20, 21), uint4(22, 30, 31, 32),
+	uint4(0, 1, 2, 3), uint4(4, 6, 10, 11), uint4(12, 13, 14, 21), uint4(22, 24, 31, 32),
+	uint4(0, 1, 2, 3), uint4(4, 5, 6, 7), uint4(8, 11, 13, 14), uint4(23, 24, 33, 34),
+	uint4(1, 2, 3, 5), uint4(6, 7, 8, 9), uint4(15, 16, 18, 23), uint4(25, 26, 35, 36),
+	uint4(3, 5, 6, 7), uint4(8, 9, 15, 16), uint4(17, 18, 19, 26), uint4(27, 28, 37, 38),
+	uint4(3, 5, 6, 7), uint4(8, 9, 16, 17), uint4(18, 19, 27, 28), uint4(29, 37, 38, 39),
+	uint4(0, 1, 2, 10), uint4(11, 12, 14, 20), uint4(21, 22, 24, 30), uint4(31, 32, 40, 50),
+	uint4(0, 1, 2, 10), uint4(11, 12, 14, 20), uint4(21, 22, 23, 24), uint4(30, 31, 32, 34),
+	uint4(3, 4, 6, 11), uint4(12, 13, 14, 15), uint4(16, 21, 22, 23), uint4(24, 26, 33, 34),
+	uint4(5, 6, 13, 15), uint4(16, 17, 18, 19), uint4(23, 25, 26, 27), uint4(28, 33, 35, 36),
+	uint4(7, 8, 9, 15), uint4(16, 17, 18, 19), uint4(25, 26, 27, 28), uint4(29, 37, 38, 39),
+	uint4(7, 8, 9, 15), uint4(17, 18, 19, 25), uint4(27, 28, 29, 37), uint4(38, 39, 49, 59),
+	uint4(0, 1, 10, 11), uint4(12, 20, 21, 22), uint4(30, 31, 32, 34), uint4(40, 50, 51, 60),
+	uint4(2, 11, 12, 20), uint4(21, 22, 30, 31), uint4(32, 33, 34, 36), uint4(41, 42, 52, 62),
+	uint4(4, 13, 14, 16), uint4(21, 23, 24, 26), uint4(30, 31, 32, 33), uint4(34, 36, 43, 45),
+	uint4(5, 15, 16, 23), uint4(25, 26, 28, 33), uint4(35, 36, 37, 38), uint4(39, 43, 46, 55),
+	uint4(7, 15, 17, 18), uint4(25, 27, 28, 29), uint4(35, 36, 37, 38), uint4(39, 47, 48, 57),
+	uint4(8, 9, 17, 18), uint4(19, 27, 28, 29), uint4(35, 37, 38, 39), uint4(49, 58, 59, 69),
+	uint4(10, 20, 21, 30), uint4(32, 40, 41, 42), uint4(44, 50, 51, 52), uint4(60, 61, 62, 70),
+	uint4(12, 22, 31, 32), uint4(40, 41, 42, 44), uint4(46, 50, 51, 52), uint4(54, 61, 62, 64),
+	uint4(33, 34, 40, 41), uint4(42, 43, 44, 46), uint4(51, 53, 54, 55), uint4(56, 63, 64, 66),
+	uint4(25, 36, 41, 43), uint4(45, 46, 47, 48), uint4(49, 53, 55, 56), uint4(58, 65, 66, 75),
+	uint4(27, 37, 38, 43), uint4(45, 46, 47, 48), uint4(49, 55, 57, 58), uint4(59, 65, 67, 68),
+	uint4(19, 28, 29, 37), uint4(39, 45, 47, 48), uint4(49, 57, 58, 59), uint4(67, 68, 69, 79),
+	uint4(30, 40, 41, 42), uint4(50, 51, 52, 54), uint4(60, 61, 62, 63), uint4(64, 70, 71, 72),
+	uint4(40, 41, 42, 44), uint4(50, 51, 52, 53), uint4(54, 60, 61, 62), uint4(63, 64, 71, 72),
+	uint4(43, 44, 46, 51), uint4(52, 53, 54, 56), uint4(61, 62, 63, 64), uint4(65, 66, 73, 74),
+	uint4(43, 45, 46, 53), uint4(55, 56, 57, 58), uint4(63, 65, 66, 67), uint4(68, 69, 75, 76),
+	uint4(47, 48, 49, 55), uint4(56, 57, 58, 59), uint4(65, 66, 67, 68), uint4(69, 75, 77, 78),
+	uint4(39, 47, 48, 49), uint4(55, 57, 58, 59), uint4(65, 66, 67, 68), uint4(69, 77, 78, 79),
+	uint4(30, 40, 41, 42), uint4(50, 51, 52, 60), uint4(61, 62, 70, 71), uint4(72, 73, 74, 76),
+	uint4(41, 42, 50, 51), uint4(52, 54, 60, 61), uint4(62, 70, 71, 72), uint4(73, 74, 75, 76),
+	uint4(43, 44, 53, 54), uint4(63, 64, 66, 70), uint4(71, 72, 73, 74), uint4(75, 76, 77, 78),
+	uint4(45, 46, 55, 56), uint4(57, 65, 66, 67), uint4(71, 72, 73, 75), uint4(76, 77, 78, 79),
+	uint4(47, 48, 49, 55), uint4(56, 57, 58, 59), uint4(66, 67, 73, 75), uint4(76, 77, 78, 79),
+	uint4(39, 47, 48, 49), uint4(57, 58, 59, 67), uint4(68, 69, 73, 75), uint4(76, 77, 78, 79),
+	uint4(0, 1, 2, 3), uint4(4, 5, 6, 7), uint4(8, 9, 0, 0), uint4(0, 0, 0, 0),
+	uint4(0, 1, 2, 3), uint4(4, 5, 6, 7), uint4(8, 9, 0, 0), uint4(0, 0, 0, 0),
+	uint4(0, 1, 2, 3), uint4(4, 5, 6, 7), uint4(8, 9, 0, 0), uint4(0, 0, 0, 0),
+	uint4(0, 1, 2, 3), uint4(4, 5, 6, 7), uint4(8, 9, 0, 0), uint4(0, 0, 0, 0),
+	uint4(0, 1, 2, 3), uint4(4, 5, 6, 7), uint4(8, 9, 0, 0), uint4(0, 0, 0, 0),
+	uint4(0, 1, 2, 3), uint4(4, 5, 6, 7), uint4(8, 9, 0, 0), uint4(0, 0, 0, 0),
+	uint4(0, 1, 2, 3), uint4(4, 5, 6, 7), uint4(8, 9, 0, 0), uint4(0, 0, 0, 0),
+	uint4(0, 1, 2, 3), uint4(4, 5, 6, 7), uint4(8, 9, 0, 0), uint4(0, 0, 0, 0),
+	uint4(10, 11, 12, 13), uint4(14, 15, 16, 17), uint4(18, 19, 10, 10), uint4(10, 10, 10, 10),
+	uint4(10, 11, 12, 13), uint4(14, 15, 16, 17), uint4(18, 19, 10, 10), uint4(10, 10, 10, 10),
+	uint4(10, 11, 12, 13), uint4(14, 15, 16, 17), uint4(18, 19, 10, 10), uint4(10, 10, 10, 10),
+	uint4(10, 11, 12, 13), uint4(14, 15, 16, 17), uint4(18, 19, 10, 10), uint4(10, 10, 10, 10),
+	uint4(10, 11, 12, 13), uint4(14, 15, 16, 17), uint4(18, 19, 10, 10), uint4(10, 10, 10, 10),
+	uint4(10, 11, 12, 13), uint4(14, 15, 16, 17), uint4(18, 19, 10, 10), uint4(10, 10, 10, 10),
+	uint4(10, 11, 12, 13), uint4(14, 15, 16, 17), uint4(18, 19, 10, 10), uint4(10, 10, 10, 10),
+	uint4(10, 11, 12, 13), uint4(14, 15, 16, 17), uint4(18, 19, 10, 10), uint4(10, 10, 10, 10),
+	uint4(20, 21, 22, 23), uint4(24, 25, 26, 27), uint4(28, 29, 20, 20), uint4(20, 20, 20, 20),
+	uint4(20, 21, 22, 23), uint4(24, 25, 26, 27), uint4(28, 29, 20, 20), uint4(20, 20, 20, 20),
+	uint4(20, 21, 22, 23), uint4(24, 25, 26, 27), uint4(28, 29, 20, 20), uint4(20, 20, 20, 20),
+	uint4(20, 21, 22, 23), uint4(24, 25, 26, 27), uint4(28, 29, 20, 20), uint4(20, 20, 20, 20),
+	uint4(20, 21, 22, 23), uint4(24, 25, 26, 27), uint4(28, 29, 20, 20), uint4(20, 20, 20, 20),
+	uint4(20, 21, 22, 23), uint4(24, 25, 26, 27), uint4(28, 29, 20, 20), uint4(20, 20, 20, 20),
+	uint4(20, 21, 22, 23), uint4(24, 25, 26, 27), uint4(28, 29, 20, 20), uint4(20, 20, 20, 20),
+	uint4(20, 21, 22, 23), uint4(24, 25, 26, 27), uint4(28, 29, 20, 20), uint4(20, 20, 20, 20),
+	uint4(30, 31, 32, 33), uint4(34, 35, 36, 37), uint4(38, 39, 30, 30), uint4(30, 30, 30, 30),
+	uint4(30, 31, 32, 33), uint4(34, 35, 36, 37), uint4(38, 39, 30, 30), uint4(30, 30, 30, 30),
+	uint4(30, 31, 32, 33), uint4(34, 35, 36, 37), uint4(38, 39, 30, 30), uint4(30, 30, 30, 30),
+	uint4(30, 31, 32, 33), uint4(34, 35, 36, 37), uint4(38, 39, 30, 30), uint4(30, 30, 30, 30),
+	uint4(30, 31, 32, 33), uint4(34, 35, 36, 37), uint4(38, 39, 30, 30), uint4(30, 30, 30, 30),
+	uint4(30, 31, 32, 33), uint4(34, 35, 36, 37), uint4(38, 39, 30, 30), uint4(30, 30, 30, 30),
+	uint4(30, 31, 32, 33), uint4(34, 35, 36, 37), uint4(38, 39, 30, 30), uint4(30, 30, 30, 30),
+	uint4(30, 31, 32, 33), uint4(34, 35, 36, 37), uint4(38, 39, 30, 30), uint4(30, 30, 30, 30),
+	uint4(40, 41, 42, 43), uint4(44, 45, 46, 47), uint4(48, 49, 40, 40), uint4(40, 40, 40, 40),
+	uint4(40, 41, 42, 43), uint4(44, 45, 46, 47), uint4(48, 49, 40, 40), uint4(40, 40, 40, 40),
+	uint4(40, 41, 42, 43), uint4(44, 45, 46, 47), uint4(48, 49, 40, 40), uint4(40, 40, 40, 40),
+	uint4(40, 41, 42, 43), uint4(44, 45, 46, 47), uint4(48, 49, 40, 40), uint4(40, 40, 40, 40),
+	uint4(40, 41, 42, 43), uint4(44, 45, 46, 47), uint4(48, 49, 40, 40), uint4(40, 40, 40, 40),
+	uint4(40, 41, 42, 43), uint4(44, 45, 46, 47), uint4(48, 49, 40, 40), uint4(40, 40, 40, 40),
+	uint4(40, 41, 42, 43), uint4(44, 45, 46, 47), uint4(48, 49, 40, 40), uint4(40, 40, 40, 40),
+	uint4(40, 41, 42, 43), uint4(44, 45, 46, 47), uint4(48, 49, 40, 40), uint4(40, 40, 40, 40),
+	uint4(50, 51, 52, 53), uint4(54, 55, 56, 57), uint4(58, 59, 50, 50), uint4(50, 50, 50, 50),
+	uint4(50, 51, 52, 53), uint4(54, 55, 56, 57), uint4(58, 59, 50, 50), uint4(50, 50, 50, 50),
+	uint4(50, 51, 52, 53), uint4(54, 55, 56, 57), uint4(58, 59, 50, 50), uint4(50, 50, 50, 50),
+	uint4(50, 51, 52, 53), uint4(54, 55, 56, 57), uint4(58, 59, 50, 50), uint4(50, 50, 50, 50),
+	uint4(50, 51, 52, 53), uint4(54, 55, 56, 57), uint4(58, 59, 50, 50), uint4(50, 50, 50, 50),
+	uint4(50, 51, 52, 53), uint4(54, 55, 56, 57), uint4(58, 59, 50, 50), uint4(50, 50, 50, 50),
+	uint4(50, 51, 52, 53), uint4(54, 55, 56, 57), uint4(58, 59, 50, 50), uint4(50, 50, 50, 50),
+	uint4(50, 51, 52, 53), uint4(54, 55, 56, 57), uint4(58, 59, 50, 50), uint4(50, 50, 50, 50),
+	uint4(60, 61, 62, 63), uint4(64, 65, 66, 67), uint4(68, 69, 60, 60), uint4(60, 60, 60, 60),
+	uint4(60, 61, 62, 63), uint4(64, 65, 66, 67), uint4(68, 69, 60, 60), uint4(60, 60, 60, 60),
+	uint4(60, 61, 62, 63), uint4(64, 65, 66, 67), uint4(68, 69, 60, 60), uint4(60, 60, 60, 60),
+	uint4(60, 61, 62, 63), uint4(64, 65, 66, 67), uint4(68, 69, 60, 60), uint4(60, 60, 60, 60),
+	uint4(60, 61, 62, 63), uint4(64, 65, 66, 67), uint4(68, 69, 60, 60), uint4(60, 60, 60, 60),
+	uint4(60, 61, 62, 63), uint4(64, 65, 66, 67), uint4(68, 69, 60, 60), uint4(60, 60, 60, 60),
+	uint4(60, 61, 62, 63), uint4(64, 65, 66, 67), uint4(68, 69, 60, 60), uint4(60, 60, 60, 60),
+	uint4(60, 61, 62, 63), uint4(64, 65, 66, 67), uint4(68, 69, 60, 60), uint4(60, 60, 60, 60),
+	uint4(70, 71, 72, 73), uint4(74, 75, 76, 77), uint4(78, 79, 70, 70), uint4(70, 70, 70, 70),
+	uint4(70, 71, 72, 73), uint4(74, 75, 76, 77), uint4(78, 79, 70, 70), uint4(70, 70, 70, 70),
+	uint4(70, 71, 72, 73), uint4(74, 75, 76, 77), uint4(78, 79, 70, 70), uint4(70, 70, 70, 70),
+	uint4(70, 71, 72, 73), uint4(74, 75, 76, 77), uint4(78, 79, 70, 70), uint4(70, 70, 70, 70),
+	uint4(70, 71, 72, 73), uint4(74, 75, 76, 77), uint4(78, 79, 70, 70), uint4(70, 70, 70, 70),
+	uint4(70, 71, 72, 73), uint4(74, 75, 76, 77), uint4(78, 79, 70, 70), uint4(70, 70, 70, 70),
+	uint4(70, 71, 72, 73), uint4(74, 75, 76, 77), uint4(78, 79, 70, 70), uint4(70, 70, 70, 70),
+	uint4(70, 71, 72, 73), uint4(74, 75, 76, 77), uint4(78, 79, 70, 70), uint4(70, 70, 70, 70),
+};
+static const float4 pseudo_inverse_wt_10x8[564] =
+{
+	float4(0.543982f, 0.338354f, 0.0916001f, -0.114028f), float4(-0.0708105f, 0.0242678f, 0.24845f, 0.144361f),
+	float4(0.049915f, -0.0541745f, -0.0315834f, -0.0470814f), float4(-0.0496323f, -0.078669f, -0.0550842f, 0.0316667f),
+	float4(-0.114028f, 0.051869f, 0.250945f, 0.416842f), float4(0.258908f, 0.0693866f, -0.0885479f, -0.053293f),
+	float4(-0.0541745f, 0.107191f, 0.191645f, 0.111258f), float4(-0.0423293f, -0.0402213f, -0.0588009f, -0.0411049f),
+	float4(-0.053293f, -0.0885479f, 0.0693866f, 0.258908f), float4(0.416842f, 0.250945f, 0.051869f, -0.114028f),
+	float4(-0.0423293f, 0.111258f, 0.191645f, 0.107191f), float4(-0.0541745f, -0.0411049f, -0.0588009f, -0.0402213f),
+	float4(0.0242678f, -0.0708105f, -0.114028f, 0.0916001f), float4(0.338354f, 0.543982f, -0.0315834f, -0.0541745f),
+	float4(0.049915f, 0.144361f, 0.24845f, -0.0496323f), float4(-0.0470814f, -0.0550842f, -0.078669f, 0.0316667f),
+	float4(-0.131519f, -0.0833006f, 0.145321f, 0.0999554f), float4(0.422162f, 0.283211f, 0.0603205f, -0.0786297f),
+	float4(-0.0526311f, 0.299861f, 0.208998f, -0.0573151f), float4(0.0581831f, -0.120613f, -0.0821203f, -0.041506f),
+	float4(-0.0601845f, -0.0978957f, -0.0619612f, 0.0737069f), float4(0.109834f, 0.0754257f, -0.0786297f, 0.207598f),
+	float4(0.317564f, 0.212813f, -0.059847f, 0.154058f), float4(0.226427f, 0.157513f, -0.0881655f, -0.0600188f),
+	float4(-0.0619612f, -0.0978957f, -0.0601845f, 0.0754257f), float4(0.109834f, 0.0737069f, -0.059847f, 0.212813f),
+	float4(0.317564f, 0.207598f, -0.0786297f, 0.157513f), float4(0.226427f, 0.154058f, -0.0600188f, -0.0881655f),
+	float4(-0.0833006f, -0.131519f, 0.0999554f, 0.145321f), float4(-0.0526311f, -0.0786297f, 0.0603205f, 0.283211f),
+	float4(0.422162f, -0.0573151f, 0.208998f, 0.299861f), float4(0.0581831f, -0.0821203f, -0.120613f, -0.041506f),
+	float4(-0.041506f, -0.120613f, -0.0821203f, 0.0581831f), float4(0.299861f, 0.208998f, -0.0573151f, 0.422162f),
+	float4(0.283211f, 0.0603205f, -0.0786297f, -0.0526311f), float4(0.145321f, 0.0999554f, -0.131519f, -0.0833006f),
+	float4(-0.0881655f, -0.0600188f, 0.154058f, 0.226427f), float4(0.157513f, -0.0786297f, 0.207598f, 0.317564f),
+	float4(0.212813f, -0.059847f, 0.0737069f, 0.109834f), float4(0.0754257f, -0.0601845f, -0.0978957f, -0.0619612f),
+	float4(-0.0600188f, -0.0881655f, 0.157513f, 0.226427f), float4(0.154058f, -0.059847f, 0.212813f, 0.317564f),
+	float4(0.207598f, -0.0786297f, 0.0754257f, 0.109834f), float4(0.0737069f, -0.0619612f, -0.0978957f, -0.0601845f),
+	float4(-0.041506f, -0.0821203f, -0.120613f, 0.0581831f), float4(-0.0573151f, 0.208998f, 0.299861f, -0.0526311f),
+	float4(-0.0786297f, 0.0603205f, 0.283211f, 0.422162f), float4(0.0999554f, 0.145321f, -0.0833006f, -0.131519f),
+	float4(0.0316667f, -0.078669f, -0.0550842f, -0.0470814f), float4(-0.0496323f, 0.24845f, 0.144361f, 0.049915f),
+	float4(-0.0541745f, -0.0315834f, 0.543982f, 0.338354f), float4(0.0916001f, -0.114028f, -0.0708105f, 0.0242678f),
+	float4(-0.0402213f, -0.0588009f, -0.0411049f, -0.0541745f), float4(0.107191f, 0.191645f, 0.111258f, -0.0423293f),
+	float4(-0.114028f, 0.051869f, 0.250945f, 0.416842f), float4(0.258908f, 0.0693866f, -0.0885479f, -0.053293f),
+	float4(-0.0411049f, -0.0588009f, -0.0402213f, -0.0423293f), float4(0.111258f, 0.191645f, 0.107191f, -0.0541745f),
+	float4(-0.053293f, -0.0885479f, 0.0693866f, 0.258908f), float4(0.416842f, 0.250945f, 0.051869f, -0.114028f),
+	float4(0.0316667f, -0.0550842f, -0.078669f, -0.0496323f), float4(-0.0470814f, -0.0315834f, -0.0541745f, 0.049915f),
+	float4(0.144361f, 0.24845f, 0.0242678f, -0.0708105f), float4(-0.114028f, 0.0916001f, 0.338354f, 0.543982f),
+	float4(0.71035f, 0.318014f, -0.0743212f, -0.111995f), float4(0.0350869f, -0.012501f, 0.218597f, 0.101556f),
+	float4(-0.015485f, -0.0388437f, -0.135878f, -0.0634742f), float4(0.0219587f, -0.00988246f, 0.0359522f, 0.0172877f),
+	float4(-0.186417f, 0.199495f, 0.585408f, 0.417936f), float4(-0.130956f, 0.0466218f, -0.0555356f, 0.0582686f),
+	float4(0.172073f, 0.142145f, -0.0344221f, 0.0382929f), float4(-0.0349528f, -0.108198f, -0.085922f, 0.0292966f),
+	float4(0.0517346f, -0.05537f, -0.162475f, 0.0957984f), float4(0.557997f, 0.495998f, 0.0841813f, -0.176692f),
+	float4(-0.0602083f, 0.0562758f, -0.0481449f, 0.193622f), float4(0.134775f, -0.0501896f, -0.0999264f, -0.10323f),
+	float4(0.0466217f, -0.0275263f, -0.160215f, 0.409305f), float4(0.581307f, 0.198101f, -0.185106f, -0.0597309f),
+	float4(0.136638f, 0.170143f, 0.0576124f, -0.0549179f), float4(-0.0885101f, -0.10845f, -0.035047f, 0.0383561f),
+	float4(-0.0124999f, 0.0429388f, -0.109674f, -0.0732179f), float4(0.318389f, 0.709997f, 0.0162449f, -0.0373911f),
+	float4(-0.0149662f, 0.101733f, 0.218432f, 0.0226035f), float4(-0.063451f, -0.135892f, 0.017265f, 0.0359702f),
+	float4(-0.163877f, -0.0719419f, 0.375073f, 0.163182f), float4(-0.0487095f, -0.0547903f, 0.658549f, 0.302494f),
+	float4(-0.0535611f, -0.114563f, 0.0381759f, 0.047864f), float4(-0.174306f, -0.0825654f, 0.036473f, 0.0393357f),
+	float4(-0.0472376f, -0.135009f, -0.0964268f, -0.100905f), float4(0.108674f, 0.318253f, 0.204913f, -0.0785167f),
+	float4(-0.174564f, 0.176432f, 0.527429f, 0.418819f), float4(-0.140117f, 0.0492395f, -0.127494f, -0.0974651f),
+	float4(-0.128531f, -0.117294f, -0.0916818f, 0.0639366f), float4(0.27224f, 0.285114f, 0.0625026f, -0.0930903f),
+	float4(-0.050848f, -0.151903f, 0.484894f, 0.508703f), float4(0.0510508f, -0.152163f, -0.144662f, -0.124308f),
+	float4(-0.0940863f, -0.135328f, -0.0473466f, -0.0706656f), float4(0.2069f, 0.318554f, 0.108775f, -0.101004f),
+	float4(-0.130776f, 0.421625f, 0.528104f, 0.176656f), float4(-0.174793f, -0.0943402f, -0.127501f, 0.0492595f),
+	float4(-0.0719185f, -0.163897f, -0.0552491f, -0.0488051f), float4(0.163148f, 0.375101f, 0.0365343f, -0.115131f),
+	float4(-0.0537205f, 0.30244f, 0.6586f, 0.0478501f), float4(-0.0825189f, -0.174348f, 0.0364445f, 0.0393255f),
+	float4(0.0601153f, -0.137615f, -0.126888f, -0.0650136f), float4(0.613442f, 0.273078f, -0.0672858f, -0.0833927f),
+	float4(0.613354f, 0.273154f, -0.0670459f, -0.0836568f), float4(-0.127132f, -0.0647671f, -0.137748f, 0.0601701f),
+	float4(-0.0980028f, -0.0649718f, -0.0907153f, -0.133043f), float4(0.166888f, 0.466819f, 0.349217f, -0.0919602f),
+	float4(-0.132735f, 0.166619f, 0.465972f, 0.350149f), float4(-0.0888156f, -0.0675741f, -0.0897592f, -0.0994846f),
+	float4(-0.108518f, -0.111006f, -0.0697955f, -0.151814f), float4(-0.132108f, 0.517749f, 0.430301f, -0.141552f),
+	float4(-0.12832f, 0.504332f, 0.416195f, -0.140336f), float4(-0.106438f, -0.075827f, -0.127552f, -0.132007f),
+	float4(-0.0656631f, -0.0978195f, -0.0988728f, -0.0660349f), float4(-0.129097f, 0.336778f, 0.460783f, 0.164752f),
+	float4(-0.131278f, -0.119888f, 0.341988f, 0.461103f), float4(0.164854f, -0.131395f, -0.0881075f, -0.0973945f),
+	float4(0.0601393f, -0.137633f, -0.0649379f, -0.127009f), float4(-0.0802315f, -0.0657884f, 0.273606f, 0.613001f),
+	float4(-0.0816285f, -0.0658774f, 0.273578f, 0.613033f), float4(-0.0650291f, -0.126918f, -0.137595f, 0.0600919f),
+	float4(0.0393356f, 0.0364382f, -0.174498f, -0.0823691f), float4(0.0478087f, 0.658896f, 0.302132f, -0.054633f),
+	float4(-0.114241f, 0.0353392f, 0.375281f, 0.162947f), float4(-0.0493876f, -0.0542839f, -0.163964f, -0.0718354f),
+	float4(0.0499643f, -0.129697f, -0.0964159f, -0.175893f), float4(0.177817f, 0.531527f, 0.417575f, -0.128375f),
+	float4(0.0487924f, -0.101697f, 0.10957f, 0.320836f), float4(0.202992f, -0.086372f, -0.13615f, -0.0958058f),
+	float4(-0.175431f, -0.146353f, -0.167497f, 0.535318f), float4(0.459887f, -0.174882f, -0.0585819f, 0.0577181f),
+	float4(-0.101449f, 0.0711471f, 0.302102f, 0.314907f), float4(0.0649177f, -0.109153f, -0.142743f, -0.129502f),
+	float4(-0.0914544f, -0.126668f, 0.0489897f, 0.0485311f), float4(-0.15458f, 0.411074f, 0.526742f, 0.176195f),
+	float4(-0.174352f, -0.0833893f, 0.200106f, 0.317812f), float4(0.108516f, -0.100781f, -0.0910943f, -0.134641f),
+	float4(0.0393234f, 0.0364575f, -0.0825939f, -0.174277f), float4(0.047876f, 0.0424958f, -0.112478f, -0.0533667f),
+	float4(0.302559f, 0.658485f, -0.0535371f, -0.04861f), float4(0.163216f, 0.375043f, -0.07198f, -0.163844f),
+	float4(0.03599f, 0.0172491f, -0.00987199f, -0.135948f), float4(-0.063402f, 0.0218941f, 0.218556f, 0.101603f),
+	float4(-0.01535f, -0.0389442f, 0.710367f, 0.317993f), float4(-0.0743808f, -0.111962f, 0.0352547f, -0.0125921f),
+	float4(0.0385766f, -0.0352481f, -0.109073f, -0.0856558f), float4(-0.0553668f, 0.0580779f, 0.171523f, 0.142554f),
+	float4(-0.0327459f, -0.186488f, 0.199582f, 0.585651f), float4(0.417804f, -0.0272396f, -0.131642f, 0.0469763f),
+	float4(-0.110363f, -0.0928007f, -0.0461253f, 0.187453f), float4(0.128604f, -0.0469417f, 0.0519942f, -0.0556856f),
+	float4(-0.163365f, 0.0962775f, 0.560931f, 0.498527f), float4(0.0843916f, -0.177916f, -0.0606545f, 0.0566072f),
+	float4(-0.0862831f, -0.107949f, -0.0348764f, 0.038196f), float4(-0.0573605f, 0.138033f, 0.170451f, 0.0577207f),
+	float4(-0.0550095f, 0.0469747f, -0.0276903f, -0.161312f), float4(0.408689f, 0.581106f, 0.19803f, -0.185047f),
+	float4(0.0172989f, 0.0359392f, 0.0220816f, -0.0634942f), float4(-0.135852f, 0.0157013f, -0.0377174f, -0.0150452f),
+	float4(0.101705f, 0.218455f, -0.0125808f, 0.04319f), float4(-0.10953f, -0.0731681f, 0.318407f, 0.709982f),
+	float4(0.852931f, 0.263298f, -0.162815f, -0.0166095f), float4(0.0435359f, -0.0117598f, 0.0960898f, 0.0147807f),
+	float4(-0.00860986f, -0.00856692f, -0.110165f, -0.0348515f), float4(0.0229783f, 0.0564948f, 0.0163829f, -0.0110141f),
+	float4(-0.195305f, 0.447006f, 0.789066f, 0.0802486f), float4(-0.211262f, 0.0570283f, -0.0288592f, 0.0700665f),
+	float4(0.0583248f, 0.0426408f, -0.0431864f, -0.0542038f), float4(-0.100049f, 0.0221623f, 0.0299149f, 0.0498133f),
+	float4(0.0646157f, -0.148096f, -0.138596f, 0.648648f), float4(0.731644f, -0.0656701f, -0.197881f, 0.0425283f),
+	float4(0.0453301f, -0.0286099f, 0.0297451f, 0.116783f), float4(-0.0783344f, -0.099607f, 0.0383023f, 0.0451722f),
+	float4(0.0451374f, 0.0421931f, -0.198001f, 0.728117f), float4(0.580933f, -0.124121f, -0.132633f, 0.0578676f),
+	float4(0.0860355f, 0.0266664f, -0.0256388f, 0.0249124f), float4(-0.07912f, -0.068348f, 0.0404147f, 0.0377342f),
+	float4(0.0572918f, -0.210159f, 0.0997951f, 0.784866f), float4(0.442529f, -0.193354f, -0.0350402f, 0.0443386f),
+	float4(0.0585714f, 0.0690592f, -0.0284324f, -0.0223553f), float4(-0.0996546f, -0.0537565f, 0.049831f, 0.0299128f),
+	float4(-0.0117982f, 0.0433132f, -0.020639f, -0.161951f), float4(0.26422f, 0.852529f, -0.00885068f, -0.00867517f),
+	float4(0.0149765f, 0.0960072f, 0.0228866f, -0.0349542f), float4(-0.110127f, -0.0110188f, 0.016382f, 0.0564981f),
+	float4(-0.247929f, -0.0821451f, 0.0394601f, 0.799992f), float4(0.270962f, -0.16012f, 0.0330461f, 0.567151f),
+	float4(0.185231f, -0.108641f, 0.0275268f, -0.290776f), float4(-0.0874765f, 0.0518463f, 0.0323831f, 0.0235723f),
+	float4(0.0593646f, -0.120471f, -0.219193f, -0.17518f), float4(0.384681f, 0.771592f, -0.158115f, -0.123324f),
+	float4(0.278372f, 0.524193f, 0.0888871f, -0.132803f), float4(0.0676242f, -0.154171f, -0.260702f, 0.0532211f),
+	float4(-0.182999f, -0.196867f, 0.060607f, -0.111758f), float4(-0.150034f, 0.660005f, 0.624685f, -0.0643996f),
+	float4(-0.198254f, -0.0791999f, -0.0803305f, 0.409838f), float4(0.518526f, -0.131998f, -0.201465f, -0.235628f),
+	float4(-0.201154f, -0.163986f, -0.202153f, 0.681563f), float4(0.603441f, -0.136938f, -0.10224f, 0.0464988f),
+	float4(-0.118055f, 0.432629f, 0.364459f, -0.0713846f), float4(-0.0699602f, 0.0717612f, -0.221469f, -0.202712f),
+	float4(-0.218678f, -0.11972f, 0.058993f, -0.172138f), float4(0.0556855f, 0.768314f, 0.382269f, -0.174077f),
+	float4(-0.111667f, 0.100465f, 0.521862f, 0.27598f), float4(-0.122269f, -0.260826f, -0.154377f, 0.0676909f),
+	float4(0.0393847f, -0.0822675f, -0.247867f, 0.0358695f), float4(-0.159441f, 0.27147f, 0.799759f, 0.0232281f),
+	float4(-0.108159f, 0.185725f, 0.566933f, 0.0518743f), float4(-0.0874312f, -0.290791f, 0.0324474f, 0.0235063f),
+	float4(0.0669602f, 0.0217265f, -0.216012f, -0.071694f), float4(0.0456517f, 0.270335f, 0.0753979f, -0.05047f),
+	float4(0.895187f, 0.260521f, -0.169893f, 0.0451968f), float4(-0.0997556f, -0.0726184f, -0.0191362f, 0.0546647f),
+	float4(0.0605027f, -0.107025f, -0.213092f, -0.067032f), float4(0.155868f, 0.248902f, -0.210263f, 0.494542f),
+	float4(0.821694f, 0.0667044f, -0.218701f, 0.0566103f), float4(-0.0789497f, -0.0847597f, -0.07618f, 0.0555923f),
+	float4(0.0456623f, -0.158555f, -0.14487f, 0.0567405f), float4(-0.0523813f, 0.201776f, 0.180214f, -0.0511711f),
+	float4(0.0615835f, -0.14482f, -0.106153f, 0.640504f), float4(0.735148f, -0.189319f, -0.0818741f, -0.0568489f),
+	float4(0.0541484f, -0.183907f, -0.160112f, -0.0678142f), float4(0.258685f, 0.193849f, -0.0506498f, -0.185568f),
+	float4(0.695864f, 0.625443f, -0.103023f, -0.141528f), float4(0.060136f, 0.0548851f, -0.0992471f, -0.0628869f),
+	float4(0.0605438f, 0.0551314f, -0.213428f, -0.10723f), float4(-0.0775314f, 0.248663f, 0.15547f, -0.06686f),
+	float4(-0.206635f, 0.0707562f, 0.821046f, 0.493829f), float4(-0.209938f, -0.087952f, -0.081341f, -0.0716843f),
+	float4(0.0217148f, 0.0669662f, 0.0457162f, -0.0716578f), float4(-0.216029f, -0.0504264f, 0.075475f, 0.270301f),
+	float4(0.0427012f, -0.169762f, 0.260665f, 0.895121f), float4(-0.0999788f, -0.0196359f, -0.0723923f, 0.0550651f),
+	float4(0.0540535f, -0.0676793f, -0.0180216f, -0.10088f), float4(0.0178016f, 0.887314f, 0.257332f, -0.168373f),
+	float4(0.0429951f, 0.287592f, 0.0791789f, -0.0562284f), float4(-0.216597f, -0.0611753f, 0.0426764f, 0.0544845f),
+	float4(0.0582646f, -0.0680844f, -0.0790558f, -0.0852408f), float4(-0.209937f, 0.493646f, 0.814159f, -0.207955f),
+	float4(0.0679986f, -0.0737584f, 0.17184f, 0.276514f), float4(-0.0651142f, -0.113536f, -0.201791f, 0.0540964f),
+	float4(-0.0743337f, -0.0890453f, 0.0702235f, -0.164933f), float4(-0.121643f, 0.729518f, 0.701947f, -0.22896f),
+	float4(-0.0617145f, 0.239934f, 0.214951f, -0.0583166f), float4(-0.0685509f, -0.161437f, -0.179551f, 0.0599447f),
+	float4(-0.0632482f, -0.0998124f, 0.0528016f, -0.233359f), float4(0.677152f, 0.620909f, -0.107138f, -0.143442f),
+	float4(0.061026f, -0.0834799f, 0.264435f, 0.203808f), float4(-0.047012f, -0.196178f, -0.139421f, 0.0468986f),
+	float4(-0.0688883f, -0.0885963f, -0.0815948f, 0.0712704f), float4(-0.204733f, 0.0666258f, 0.816792f, 0.491701f),
+	float4(-0.209184f, -0.0718259f, 0.257565f, 0.159783f), float4(-0.0683852f, 0.0711894f, -0.192322f, -0.127992f),
+	float4(0.0541019f, -0.017873f, -0.0677448f, 0.0185026f), float4(-0.101114f, 0.0423489f, -0.168987f, 0.257691f),
+	float4(0.887177f, -0.0521762f, 0.0817415f, 0.28645f), float4(0.0405521f, -0.0580581f, -0.217894f, 0.0551073f),
+	float4(0.0294099f, -0.258905f, -0.0798153f, 0.0429781f), float4(0.504642f, 0.169038f, -0.0898563f, 0.0245392f),
+	float4(0.801475f, 0.232874f, -0.148511f, -0.0203866f), float4(0.035863f, -0.201757f, -0.0633622f, 0.0377516f),
+	float4(0.056732f, -0.128674f, -0.21564f, 0.0464517f), float4(-0.102143f, 0.229155f, 0.43114f, 0.0666499f),
+	float4(-0.117494f, -0.168213f, 0.404245f, 0.72536f), float4(0.0991201f, -0.175284f, -0.086485f, -0.15129f),
+	float4(-0.212223f, -0.209037f, 0.052958f, -0.0689214f), float4(-0.0691346f, 0.369051f, 0.468766f, -0.114649f),
+	float4(-0.124479f, -0.155215f, 0.592312f, 0.688021f), float4(-0.0995508f, -0.17447f, -0.151843f, -0.17144f),
+	float4(0.0832689f, -0.202196f, -0.184138f, -0.105715f), float4(0.404264f, 0.326671f, -0.101212f, -0.0829045f),
+	float4(-0.185761f, 0.736718f, 0.521295f, -0.0792154f), float4(-0.149831f, 0.0623089f, -0.176305f, -0.137451f),
+	float4(-0.244295f, -0.1461f, 0.064483f, -0.130805f), float4(0.0705402f, 0.488888f, 0.260226f, -0.11614f),
+	float4(-0.23083f, 0.112904f, 0.693385f, 0.455812f), float4(-0.189558f, 0.0666947f, -0.193594f, -0.113923f),
+	float4(0.0296892f, 0.0489668f, -0.0761712f, -0.260525f), float4(0.0272535f, -0.101896f, 0.16257f, 0.507554f),
+	float4(0.0473276f, -0.0233136f, -0.141503f, 0.222092f), float4(0.805939f, 0.0463091f, -0.0578205f, -0.20395f),
+	float4(-0.00520197f, 0.0459579f, 0.01579f, -0.00517296f), float4(-0.0896514f, -0.033007f, 0.0110631f, 0.0645738f),
+	float4(0.0328009f, -0.0140014f, 0.863566f, 0.265577f), float4(-0.166342f, -0.0170136f, 0.0444488f, -0.012015f),
+	float4(0.019388f, 0.0329469f, 0.0193652f, -0.0341056f), float4(-0.0659671f, 0.0266743f, -0.0166727f, 0.0324417f),
+	float4(0.0449113f, -0.199526f, 0.456317f, 0.805813f), float4(0.083099f, -0.214596f, 0.0189826f, 0.0580455f),
+	float4(0.0400851f, 0.0379438f, -0.071259f, -0.084449f), float4(0.0639155f, 0.0529278f, -0.0299091f, 0.0659464f),
+	float4(-0.150254f, -0.141258f, 0.655924f, 0.740575f), float4(-0.0654363f, -0.200267f, 0.0406439f, 0.0444945f),
+	float4(0.0347761f, 0.0311005f, -0.0697757f, -0.0548382f), float4(0.0234252f, 0.0279701f, 0.0719256f, -0.0429154f),
+	float4(0.0457045f, 0.0429735f, -0.199435f, 0.731791f), float4(0.586035f, -0.119083f, -0.130321f, 0.0566924f),
+	float4(0.0445011f, 0.0257853f, -0.0134058f, 0.0219768f), float4(-0.0143186f, -0.0890691f, -0.0457929f, 0.0244307f),
+	float4(-0.0155069f, 0.0985362f, 0.0562151f, -0.206409f), float4(0.105099f, 0.790672f, 0.445444f, -0.194299f),
+	float4(-0.00528658f, -0.0073893f, 0.0145714f, 0.0464796f), float4(0.0154866f, -0.0307819f, -0.0906124f, -0.0249296f),
+	float4(0.037391f, 0.0626403f, -0.0115728f, 0.0424276f), float4(-0.0217424f, -0.162925f, 0.268012f, 0.862411f),
+	float4(0.989975f, 0.0400995f, -0.068742f, 0.0562435f), float4(-0.0204703f, 0.00268365f, 0.000673908f, -0.000823665f),
+	float4(0.000480471f, -0.000120118f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(-0.276526f, 1.1061f, 0.389538f, -0.318713f), float4(0.115999f, -0.0152074f, -0.00381881f, 0.00466744f),
+	float4(-0.00272267f, 0.000680668f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0928675f, -0.37147f, 0.636806f, 0.933523f), float4(-0.339764f, 0.0445429f, 0.0111854f, -0.0136711f),
+	float4(0.00797481f, -0.0019937f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(-0.0243293f, 0.0973173f, -0.16683f, 0.136497f), float4(1.11499f, -0.146175f, -0.0367068f, 0.0448639f),
+	float4(-0.0261706f, 0.00654265f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.00654265f, -0.0261706f, 0.0448639f, -0.0367068f), float4(-0.146175f, 1.11499f, 0.136497f, -0.16683f),
+	float4(0.0973173f, -0.0243293f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(-0.0019937f, 0.00797481f, -0.0136711f, 0.0111854f), float4(0.0445429f, -0.339764f, 0.933523f, 0.636806f),
+	float4(-0.37147f, 0.0928675f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.000680668f, -0.00272267f, 0.00466744f, -0.00381881f), float4(-0.0152074f, 0.115999f, -0.318713f, 0.389538f),
+	float4(1.1061f, -0.276526f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(-0.000120118f, 0.000480471f, -0.000823665f, 0.000673908f), float4(0.00268365f, -0.0204703f, 0.0562435f, -0.068742f),
+	float4(0.0400995f, 0.989975f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.989975f, 0.0400995f, -0.068742f, 0.0562435f), float4(-0.0204703f, 0.00268365f, 0.000673908f, -0.000823665f),
+	float4(0.000480471f, -0.000120118f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(-0.276526f, 1.1061f, 0.389538f, -0.318713f), float4(0.115999f, -0.0152074f, -0.00381881f, 0.00466744f),
+	float4(-0.00272267f, 0.000680668f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0928675f, -0.37147f, 0.636806f, 0.933523f), float4(-0.339764f, 0.0445429f, 0.0111854f, -0.0136711f),
+	float4(0.00797481f, -0.0019937f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(-0.0243293f, 0.0973173f, -0.16683f, 0.136497f), float4(1.11499f, -0.146175f, -0.0367068f, 0.0448639f),
+	float4(-0.0261706f, 0.00654265f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.00654265f, -0.0261706f, 0.0448639f, -0.0367068f), float4(-0.146175f, 1.11499f, 0.136497f, -0.16683f),
+	float4(0.0973173f, -0.0243293f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(-0.0019937f, 0.00797481f, -0.0136711f, 0.0111854f), float4(0.0445429f, -0.339764f, 0.933523f, 0.636806f),
+	float4(-0.37147f, 0.0928675f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.000680668f, -0.00272267f, 0.00466744f, -0.00381881f), float4(-0.0152074f, 0.115999f, -0.318713f, 0.389538f),
+	float4(1.1061f, -0.276526f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(-0.000120118f, 0.000480471f, -0.000823665f, 0.000673908f), float4(0.00268365f, -0.0204703f, 0.0562435f, -0.068742f),
+	float4(0.0400995f, 0.989975f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.989975f, 0.0400995f, -0.068742f, 0.0562435f), float4(-0.0204703f, 0.00268365f, 0.000673908f, -0.000823665f),
+	float4(0.000480471f, -0.000120118f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(-0.276526f, 1.1061f, 0.389538f, -0.318713f), float4(0.115999f, -0.0152074f, -0.00381881f, 0.00466744f),
+	float4(-0.00272267f, 0.000680668f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0928675f, -0.37147f, 0.636806f, 0.933523f), float4(-0.339764f, 0.0445429f, 0.0111854f, -0.0136711f),
+	float4(0.00797481f, -0.0019937f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(-0.0243293f, 0.0973173f, -0.16683f, 0.136497f), float4(1.11499f, -0.146175f, -0.0367068f, 0.0448639f),
+	float4(-0.0261706f, 0.00654265f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.00654265f, -0.0261706f, 0.0448639f, -0.0367068f), float4(-0.146175f, 1.11499f, 0.136497f, -0.16683f),
+	float4(0.0973173f, -0.0243293f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(-0.0019937f, 0.00797481f, -0.0136711f, 0.0111854f), float4(0.0445429f, -0.339764f, 0.933523f, 0.636806f),
+	float4(-0.37147f, 0.0928675f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.000680668f, -0.00272267f, 0.00466744f, -0.00381881f), float4(-0.0152074f, 0.115999f, -0.318713f, 0.389538f),
+	float4(1.1061f, -0.276526f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(-0.000120118f, 0.000480471f, -0.000823665f, 0.000673908f), float4(0.00268365f, -0.0204703f, 0.0562435f, -0.068742f),
+	float4(0.0400995f, 0.989975f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.989975f, 0.0400995f, -0.068742f, 0.0562435f), float4(-0.0204703f, 0.00268365f, 0.000673908f, -0.000823665f),
+	float4(0.000480471f, -0.000120118f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(-0.276526f, 1.1061f, 0.389538f, -0.318713f), float4(0.115999f, -0.0152074f, -0.00381881f, 0.00466744f),
+	float4(-0.00272267f, 0.000680668f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0928675f, -0.37147f, 0.636806f, 0.933523f), float4(-0.339764f, 0.0445429f, 0.0111854f, -0.0136711f),
+	float4(0.00797481f, -0.0019937f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(-0.0243293f, 0.0973173f, -0.16683f, 0.136497f), float4(1.11499f, -0.146175f, -0.0367068f, 0.0448639f),
+	float4(-0.0261706f, 0.00654265f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.00654265f, -0.0261706f, 0.0448639f, -0.0367068f), float4(-0.146175f, 1.11499f, 0.136497f, -0.16683f),
+	float4(0.0973173f, -0.0243293f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(-0.0019937f, 0.00797481f, -0.0136711f, 0.0111854f), float4(0.0445429f, -0.339764f, 0.933523f, 0.636806f),
+	float4(-0.37147f, 0.0928675f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.000680668f, -0.00272267f, 0.00466744f, -0.00381881f), float4(-0.0152074f, 0.115999f, -0.318713f, 0.389538f),
+	float4(1.1061f, -0.276526f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(-0.000120118f, 0.000480471f, -0.000823665f, 0.000673908f), float4(0.00268365f, -0.0204703f, 0.0562435f, -0.068742f),
+	float4(0.0400995f, 0.989975f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.989975f, 0.0400995f, -0.068742f, 0.0562435f), float4(-0.0204703f, 0.00268365f, 0.000673908f, -0.000823665f),
+	float4(0.000480471f, -0.000120118f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(-0.276526f, 1.1061f, 0.389538f, -0.318713f), float4(0.115999f, -0.0152074f, -0.00381881f, 0.00466744f),
+	float4(-0.00272267f, 0.000680668f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0928675f, -0.37147f, 0.636806f, 0.933523f), float4(-0.339764f, 0.0445429f, 0.0111854f, -0.0136711f),
+	float4(0.00797481f, -0.0019937f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(-0.0243293f, 0.0973173f, -0.16683f, 0.136497f), float4(1.11499f, -0.146175f, -0.0367068f, 0.0448639f),
+	float4(-0.0261706f, 0.00654265f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.00654265f, -0.0261706f, 0.0448639f, -0.0367068f), float4(-0.146175f, 1.11499f, 0.136497f, -0.16683f),
+	float4(0.0973173f, -0.0243293f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(-0.0019937f, 0.00797481f, -0.0136711f, 0.0111854f), float4(0.0445429f, -0.339764f, 0.933523f, 0.636806f),
+	float4(-0.37147f, 0.0928675f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.000680668f, -0.00272267f, 0.00466744f, -0.00381881f), float4(-0.0152074f, 0.115999f, -0.318713f, 0.389538f),
+	float4(1.1061f, -0.276526f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(-0.000120118f, 0.000480471f, -0.000823665f, 0.000673908f), float4(0.00268365f, -0.0204703f, 0.0562435f, -0.068742f),
+	float4(0.0400995f, 0.989975f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.989975f, 0.0400995f, -0.068742f, 0.0562435f), float4(-0.0204703f, 0.00268365f, 0.000673908f, -0.000823665f),
+	float4(0.000480471f, -0.000120118f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(-0.276526f, 1.1061f, 0.389538f, -0.318713f), float4(0.115999f, -0.0152074f, -0.00381881f, 0.00466744f),
+	float4(-0.00272267f, 0.000680668f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0928675f, -0.37147f, 0.636806f, 0.933523f), float4(-0.339764f, 0.0445429f, 0.0111854f, -0.0136711f),
+	float4(0.00797481f, -0.0019937f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(-0.0243293f, 0.0973173f, -0.16683f, 0.136497f), float4(1.11499f, -0.146175f, -0.0367068f, 0.0448639f),
+	float4(-0.0261706f, 0.00654265f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.00654265f, -0.0261706f, 0.0448639f, -0.0367068f), float4(-0.146175f, 1.11499f, 0.136497f, -0.16683f),
+	float4(0.0973173f, -0.0243293f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(-0.0019937f, 0.00797481f, -0.0136711f, 0.0111854f), float4(0.0445429f, -0.339764f, 0.933523f, 0.636806f),
+	float4(-0.37147f, 0.0928675f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.000680668f, -0.00272267f, 0.00466744f, -0.00381881f), float4(-0.0152074f, 0.115999f, -0.318713f, 0.389538f),
+	float4(1.1061f, -0.276526f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(-0.000120118f, 0.000480471f, -0.000823665f, 0.000673908f), float4(0.00268365f, -0.0204703f, 0.0562435f, -0.068742f),
+	float4(0.0400995f, 0.989975f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.989975f, 0.0400995f, -0.068742f, 0.0562435f), float4(-0.0204703f, 0.00268365f, 0.000673908f, -0.000823665f),
+	float4(0.000480471f, -0.000120118f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(-0.276526f, 1.1061f, 0.389538f, -0.318713f), float4(0.115999f, -0.0152074f, -0.00381881f, 0.00466744f),
+	float4(-0.00272267f, 0.000680668f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0928675f, -0.37147f, 0.636806f, 0.933523f), float4(-0.339764f, 0.0445429f, 0.0111854f, -0.0136711f),
+	float4(0.00797481f, -0.0019937f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(-0.0243293f, 0.0973173f, -0.16683f, 0.136497f), float4(1.11499f, -0.146175f, -0.0367068f, 0.0448639f),
+	float4(-0.0261706f, 0.00654265f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.00654265f, -0.0261706f, 0.0448639f, -0.0367068f), float4(-0.146175f, 1.11499f, 0.136497f, -0.16683f),
+	float4(0.0973173f, -0.0243293f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(-0.0019937f, 0.00797481f, -0.0136711f, 0.0111854f), float4(0.0445429f, -0.339764f, 0.933523f, 0.636806f),
+	float4(-0.37147f, 0.0928675f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.000680668f, -0.00272267f, 0.00466744f, -0.00381881f), float4(-0.0152074f, 0.115999f, -0.318713f, 0.389538f),
+	float4(1.1061f, -0.276526f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(-0.000120118f, 0.000480471f, -0.000823665f, 0.000673908f), float4(0.00268365f, -0.0204703f, 0.0562435f, -0.068742f),
+	float4(0.0400995f, 0.989975f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.989975f, 0.0400995f, -0.068742f, 0.0562435f), float4(-0.0204703f, 0.00268365f, 0.000673908f, -0.000823665f),
+	float4(0.000480471f, -0.000120118f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(-0.276526f, 1.1061f, 0.389538f, -0.318713f), float4(0.115999f, -0.0152074f, -0.00381881f, 0.00466744f),
+	float4(-0.00272267f, 0.000680668f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0928675f, -0.37147f, 0.636806f, 0.933523f), float4(-0.339764f, 0.0445429f, 0.0111854f, -0.0136711f),
+	float4(0.00797481f, -0.0019937f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(-0.0243293f, 0.0973173f, -0.16683f, 0.136497f), float4(1.11499f, -0.146175f, -0.0367068f, 0.0448639f),
+	float4(-0.0261706f, 0.00654265f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.00654265f, -0.0261706f, 0.0448639f, -0.0367068f), float4(-0.146175f, 1.11499f, 0.136497f, -0.16683f),
+	float4(0.0973173f, -0.0243293f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(-0.0019937f, 0.00797481f, -0.0136711f, 0.0111854f), float4(0.0445429f, -0.339764f, 0.933523f, 0.636806f),
+	float4(-0.37147f, 0.0928675f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.000680668f, -0.00272267f, 0.00466744f, -0.00381881f), float4(-0.0152074f, 0.115999f, -0.318713f, 0.389538f),
+	float4(1.1061f, -0.276526f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(-0.000120118f, 0.000480471f, -0.000823665f, 0.000673908f), float4(0.00268365f, -0.0204703f, 0.0562435f, -0.068742f),
+	float4(0.0400995f, 0.989975f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+};
+
+#define WEIGHT_GRID_COUNT_10X10 4
+#define MAX_GRID_WEIGHTS_10X10 64
+static const uint4 weight_grids_10x10[WEIGHT_GRID_COUNT_10X10] = { uint4(4, 4, 0, 0), uint4(5, 5, 16, 100), uint4(6, 6, 41, 200), uint4(8, 8, 77, 300) };
+static const uint4 decimation_idx_10x10[141] =
+{
+	uint4(0, 1, 10, 11), uint4(3, 4, 13, 14), uint4(6, 7, 16, 17), uint4(9, 9, 19, 19),
+	uint4(30, 31, 40, 41), uint4(33, 34, 43, 44), uint4(36, 37, 46, 47), uint4(39, 39, 49, 49),
+	uint4(60, 61, 70, 71), uint4(63, 64, 73, 74), uint4(66, 67, 76, 77), uint4(69, 69, 79, 79),
+	uint4(90, 91, 90, 91), uint4(93, 94, 93, 94), uint4(96, 97, 96, 97), uint4(99, 99, 99, 99),
+	uint4(0, 1, 10, 11), uint4(2, 3, 12, 13), uint4(4, 5, 14, 15), uint4(6, 7, 16, 17),
+	uint4(9, 9, 19, 19), uint4(20, 21, 30, 31), uint4(22, 23, 32, 33), uint4(24, 25, 34, 35),
+	uint4(26, 27, 36, 37), uint4(29, 29, 39, 39), uint4(40, 41, 50, 51), uint4(42, 43, 52, 53),
+	uint4(44, 45, 54, 55), uint4(46, 47, 56, 57), uint4(49, 49, 59, 59), uint4(60, 61, 70, 71),
+	uint4(62, 63, 72, 73), uint4(64, 65, 74, 75), uint4(66, 67, 76, 77), uint4(69, 69, 79, 79),
+	uint4(90, 91, 90, 91), uint4(92, 93, 92, 93), uint4(94, 95, 94, 95), uint4(96, 97, 96, 97),
+	uint4(99, 99, 99, 99), uint4(0, 1, 10, 11), uint4(1, 2, 11, 12), uint4(3, 4, 13, 14),
+	uint4(5, 6, 15, 16), uint4(7, 8, 17, 18), uint4(9, 9, 19, 19), uint4(10, 11, 20, 21),
+	uint4(11, 12, 21, 22), uint4(13, 14, 23, 24), uint4(15, 16, 25, 26), uint4(17, 18, 27, 28),
+	uint4(19, 19, 29, 29), uint4(30, 31, 40, 41), uint4(31, 32, 41, 42), uint4(33, 34, 43, 44),
+	uint4(35, 36, 45, 46), uint4(37, 38, 47, 48), uint4(39, 39, 49, 49), uint4(50, 51, 60, 61),
+	uint4(51, 52, 61, 62), uint4(53, 54, 63, 64), uint4(55, 56, 65, 66), uint4(57, 58, 67, 68),
+	uint4(59, 59, 69, 69), uint4(70, 71, 80, 81), uint4(71, 72, 81, 82), uint4(73, 74, 83, 84),
+	uint4(75, 76, 85, 86), uint4(77, 78, 87, 88), uint4(79, 79, 89, 89), uint4(90, 91, 90, 91),
+	uint4(91, 92, 91, 92), uint4(93, 94, 93, 94), uint4(95, 96, 95, 96), uint4(97, 98, 97, 98),
+	uint4(99, 99, 99, 99), uint4(0, 1, 10, 11), uint4(1, 2, 11, 12), uint4(2, 3, 12, 13),
+	uint4(3, 4, 13, 14), uint4(5, 6, 15, 16), uint4(6, 7, 16, 17), uint4(7, 8, 17, 18),
+	uint4(9, 9, 19, 19), uint4(10, 11, 20, 21), uint4(11, 12, 21, 22), uint4(12, 13, 22, 23),
+	uint4(13, 14, 23, 24), uint4(15, 16, 25, 26), uint4(16, 17, 26, 27), uint4(17, 18, 27, 28),
+	uint4(19, 19, 29, 29), uint4(20, 21, 30, 31), uint4(21, 22, 31, 32), uint4(22, 23, 32, 33),
+	uint4(23, 24, 33, 34), uint4(25, 26, 35, 36), uint4(26, 27, 36, 37), uint4(27, 28, 37, 38),
+	uint4(29, 29, 39, 39), uint4(30, 31, 40, 41), uint4(31, 32, 41, 42), uint4(32, 33, 42, 43),
+	uint4(33, 34, 43, 44), uint4(35, 36, 45, 46), uint4(36, 37, 46, 47), uint4(37, 38, 47, 48),
+	uint4(39, 39, 49, 49), uint4(50, 51, 60, 61), uint4(51, 52, 61, 62), uint4(52, 53, 62, 63),
+	uint4(53, 54, 63, 64), uint4(55, 56, 65, 66), uint4(56, 57, 66, 67), uint4(57, 58, 67, 68),
+	uint4(59, 59, 69, 69), uint4(60, 61, 70, 71), uint4(61, 62, 71, 72), uint4(62, 63, 72, 73),
+	uint4(63, 64, 73, 74), uint4(65, 66, 75, 76), uint4(66, 67, 76, 77), uint4(67, 68, 77, 78),
+	uint4(69, 69, 79, 79), uint4(70, 71, 80, 81), uint4(71, 72, 81, 82), uint4(72, 73, 82, 83),
+	uint4(73, 74, 83, 84), uint4(75, 76, 85, 86), uint4(76, 77, 86, 87), uint4(77, 78, 87, 88),
+	uint4(79, 79, 89, 89), uint4(90, 91, 90, 91), uint4(91, 92, 91, 92), uint4(92, 93, 92, 93),
+	uint4(93, 94, 93, 94), uint4(95, 96, 95, 96), uint4(96, 97, 96, 97), uint4(97, 98, 97, 98),
+	uint4(99, 99, 99, 99),
+};
+static const float4 decimation_wt_10x10[141] =
+{
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.75f, 0.25f, 0.0f, 0.0f),
+	float4(0.5f, 0.5f, 0.0f, 0.0f), float4(0.25f, 0.75f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.75f, 0.0f, 0.25f, 0.0f),
+	float4(0.5625f, 0.1875f, 0.1875f, 0.0625f), float4(0.375f, 0.375f, 0.125f, 0.125f),
+	float4(0.1875f, 0.5625f, 0.0625f, 0.1875f), float4(0.75f, 0.0f, 0.25f, 0.0f),
+	float4(0.5f, 0.0f, 0.5f, 0.0f), float4(0.375f, 0.125f, 0.375f, 0.125f),
+	float4(0.25f, 0.25f, 0.25f, 0.25f), float4(0.125f, 0.375f, 0.125f, 0.375f),
+	float4(0.5f, 0.0f, 0.5f, 0.0f), float4(0.25f, 0.0f, 0.75f, 0.0f),
+	float4(0.1875f, 0.0625f, 0.5625f, 0.1875f), float4(0.125f, 0.125f, 0.375f, 0.375f),
+	float4(0.0625f, 0.1875f, 0.1875f, 0.5625f), float4(0.25f, 0.0f, 0.75f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.75f, 0.25f, 0.0f, 0.0f),
+	float4(0.5f, 0.5f, 0.0f, 0.0f), float4(0.25f, 0.75f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.200000048f, 0.799999952f, 0.0f, 0.0f), float4(0.400000095f, 0.599999905f, 0.0f, 0.0f),
+	float4(0.599999905f, 0.400000095f, 0.0f, 0.0f), float4(0.800000191f, 0.199999809f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.200000048f, 0.0f, 0.799999952f, 0.0f),
+	float4(0.0400000177f, 0.160000026f, 0.160000026f, 0.639999926f), float4(0.0800000355f, 0.120000012f, 0.320000052f, 0.4799999f),
+	float4(0.120000012f, 0.0800000355f, 0.4799999f, 0.320000052f), float4(0.160000071f, 0.039999973f, 0.640000105f, 0.159999833f),
+	float4(0.200000048f, 0.0f, 0.799999952f, 0.0f), float4(0.400000095f, 0.0f, 0.599999905f, 0.0f),
+	float4(0.0800000355f, 0.320000052f, 0.120000012f, 0.4799999f), float4(0.160000071f, 0.240000024f, 0.240000024f, 0.359999895f),
+	float4(0.240000024f, 0.160000071f, 0.359999895f, 0.240000024f), float4(0.320000142f, 0.0799999461f, 0.480000049f, 0.119999863f),
+	float4(0.400000095f, 0.0f, 0.599999905f, 0.0f), float4(0.599999905f, 0.0f, 0.400000095f, 0.0f),
+	float4(0.120000012f, 0.4799999f, 0.0800000355f, 0.320000052f), float4(0.240000024f, 0.359999895f, 0.160000071f, 0.240000024f),
+	float4(0.359999895f, 0.240000024f, 0.240000024f, 0.160000071f), float4(0.480000049f, 0.119999863f, 0.320000142f, 0.0799999461f),
+	float4(0.599999905f, 0.0f, 0.400000095f, 0.0f), float4(0.800000191f, 0.0f, 0.199999809f, 0.0f),
+	float4(0.160000071f, 0.640000105f, 0.039999973f, 0.159999833f), float4(0.320000142f, 0.480000049f, 0.0799999461f, 0.119999863f),
+	float4(0.480000049f, 0.320000142f, 0.119999863f, 0.0799999461f), float4(0.640000284f, 0.159999892f, 0.159999892f, 0.0399999246f),
+	float4(0.800000191f, 0.0f, 0.199999809f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.200000048f, 0.799999952f, 0.0f, 0.0f), float4(0.400000095f, 0.599999905f, 0.0f, 0.0f),
+	float4(0.599999905f, 0.400000095f, 0.0f, 0.0f), float4(0.800000191f, 0.199999809f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.714285731f, 0.285714269f, 0.0f, 0.0f), float4(0.428571463f, 0.571428537f, 0.0f, 0.0f),
+	float4(0.142857075f, 0.857142925f, 0.0f, 0.0f), float4(0.857142925f, 0.142857075f, 0.0f, 0.0f),
+	float4(0.571428776f, 0.428571224f, 0.0f, 0.0f), float4(0.285714149f, 0.714285851f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.714285731f, 0.0f, 0.285714269f, 0.0f),
+	float4(0.510204077f, 0.204081625f, 0.204081625f, 0.0816326439f), float4(0.306122482f, 0.408163249f, 0.122448981f, 0.163265288f),
+	float4(0.102040768f, 0.612244964f, 0.0408163033f, 0.244897962f), float4(0.612244964f, 0.102040768f, 0.244897962f, 0.0408163033f),
+	float4(0.408163428f, 0.306122303f, 0.163265347f, 0.122448914f), float4(0.204081535f, 0.510204196f, 0.0816326067f, 0.204081655f),
+	float4(0.714285731f, 0.0f, 0.285714269f, 0.0f), float4(0.428571463f, 0.0f, 0.571428537f, 0.0f),
+	float4(0.306122482f, 0.122448981f, 0.408163249f, 0.163265288f), float4(0.183673501f, 0.244897962f, 0.244897962f, 0.326530576f),
+	float4(0.0612244643f, 0.367347002f, 0.0816326067f, 0.489795923f), float4(0.367347002f, 0.0612244643f, 0.489795923f, 0.0816326067f),
+	float4(0.244898066f, 0.183673397f, 0.326530695f, 0.244897828f), float4(0.122448929f, 0.306122541f, 0.163265213f, 0.408163309f),
+	float4(0.428571463f, 0.0f, 0.571428537f, 0.0f), float4(0.142857075f, 0.0f, 0.857142925f, 0.0f),
+	float4(0.102040768f, 0.0408163033f, 0.612244964f, 0.244897962f), float4(0.0612244643f, 0.0816326067f, 0.367347002f, 0.489795923f),
+	float4(0.0204081442f, 0.122448929f, 0.122448929f, 0.734694004f), float4(0.122448929f, 0.0204081442f, 0.734694004f, 0.122448929f),
+	float4(0.0816326439f, 0.0612244308f, 0.489796132f, 0.367346793f), float4(0.0408162884f, 0.10204079f, 0.244897857f, 0.612245083f),
+	float4(0.142857075f, 0.0f, 0.857142925f, 0.0f), float4(0.857142925f, 0.0f, 0.142857075f, 0.0f),
+	float4(0.612244964f, 0.244897962f, 0.102040768f, 0.0408163033f), float4(0.367347002f, 0.489795923f, 0.0612244643f, 0.0816326067f),
+	float4(0.122448929f, 0.734694004f, 0.0204081442f, 0.122448929f), float4(0.734694004f, 0.122448929f, 0.122448929f, 0.0204081442f),
+	float4(0.489796132f, 0.367346793f, 0.0816326439f, 0.0612244308f), float4(0.244897857f, 0.612245083f, 0.0408162884f, 0.10204079f),
+	float4(0.857142925f, 0.0f, 0.142857075f, 0.0f), float4(0.571428776f, 0.0f, 0.428571224f, 0.0f),
+	float4(0.408163428f, 0.163265347f, 0.306122303f, 0.122448914f), float4(0.244898066f, 0.326530695f, 0.183673397f, 0.244897828f),
+	float4(0.0816326439f, 0.489796132f, 0.0612244308f, 0.367346793f), float4(0.489796132f, 0.0816326439f, 0.367346793f, 0.0612244308f),
+	float4(0.326530844f, 0.244897932f, 0.244897932f, 0.183673292f), float4(0.163265288f, 0.408163488f, 0.122448862f, 0.306122363f),
+	float4(0.571428776f, 0.0f, 0.428571224f, 0.0f), float4(0.285714149f, 0.0f, 0.714285851f, 0.0f),
+	float4(0.204081535f, 0.0816326067f, 0.510204196f, 0.204081655f), float4(0.122448929f, 0.163265213f, 0.306122541f, 0.408163309f),
+	float4(0.0408162884f, 0.244897857f, 0.10204079f, 0.612245083f), float4(0.244897857f, 0.0408162884f, 0.612245083f, 0.10204079f),
+	float4(0.163265288f, 0.122448862f, 0.408163488f, 0.306122363f), float4(0.0816325769f, 0.20408158f, 0.20408158f, 0.510204256f),
+	float4(0.285714149f, 0.0f, 0.714285851f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.714285731f, 0.285714269f, 0.0f, 0.0f), float4(0.428571463f, 0.571428537f, 0.0f, 0.0f),
+	float4(0.142857075f, 0.857142925f, 0.0f, 0.0f), float4(0.857142925f, 0.142857075f, 0.0f, 0.0f),
+	float4(0.571428776f, 0.428571224f, 0.0f, 0.0f), float4(0.285714149f, 0.714285851f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f),
+};
+static const uint4 infill_idx_10x10[400] =
+{
+	uint4(0, 0, 0, 0), uint4(0, 1, 0, 0), uint4(0, 1, 0, 0), uint4(1, 1, 1, 1),
+	uint4(1, 2, 1, 1), uint4(1, 2, 1, 1), uint4(2, 2, 2, 2), uint4(2, 3, 2, 2),
+	uint4(2, 3, 2, 2), uint4(3, 3, 3, 3), uint4(0, 0, 4, 0), uint4(0, 1, 4, 5),
+	uint4(0, 1, 4, 5), uint4(1, 1, 5, 1), uint4(1, 2, 5, 6), uint4(1, 2, 5, 6),
+	uint4(2, 2, 6, 2), uint4(2, 3, 6, 7), uint4(2, 3, 6, 7), uint4(3, 3, 7, 3),
+	uint4(0, 0, 4, 0), uint4(0, 1, 4, 5), uint4(0, 1, 4, 5), uint4(1, 1, 5, 1),
+	uint4(1, 2, 5, 6), uint4(1, 2, 5, 6), uint4(2, 2, 6, 2), uint4(2, 3, 6, 7),
+	uint4(2, 3, 6, 7), uint4(3, 3, 7, 3), uint4(4, 4, 4, 4), uint4(4, 5, 4, 4),
+	uint4(4, 5, 4, 4), uint4(5, 5, 5, 5), uint4(5, 6, 5, 5), uint4(5, 6, 5, 5),
+	uint4(6, 6, 6, 6), uint4(6, 7, 6, 6), uint4(6, 7, 6, 6), uint4(7, 7, 7, 7),
+	uint4(4, 4, 8, 4), uint4(4, 5, 8, 9), uint4(4, 5, 8, 9), uint4(5, 5, 9, 5),
+	uint4(5, 6, 9, 10), uint4(5, 6, 9, 10), uint4(6, 6, 10, 6), uint4(6, 7, 10, 11),
+	uint4(6, 7, 10, 11), uint4(7, 7, 11, 7), uint4(4, 4, 8, 4), uint4(4, 5, 8, 9),
+	uint4(4, 5, 8, 9), uint4(5, 5, 9, 5), uint4(5, 6, 9, 10), uint4(5, 6, 9, 10),
+	uint4(6, 6, 10, 6), uint4(6, 7, 10, 11), uint4(6, 7, 10, 11), uint4(7, 7, 11, 7),
+	uint4(8, 8, 8, 8), uint4(8, 9, 8, 8), uint4(8, 9, 8, 8), uint4(9, 9, 9, 9),
+	uint4(9, 10, 9, 9), uint4(9, 10, 9, 9), uint4(10, 10, 10, 10), uint4(10, 11, 10, 10),
+	uint4(10, 11, 10, 10), uint4(11, 11, 11, 11), uint4(8, 8, 12, 8), uint4(8, 9, 12, 13),
+	uint4(8, 9, 12, 13), uint4(9, 9, 13, 9), uint4(9, 10, 13, 14), uint4(9, 10, 13, 14),
+	uint4(10, 10, 14, 10), uint4(10, 11, 14, 15), uint4(10, 11, 14, 15), uint4(11, 11, 15, 11),
+	uint4(8, 8, 12, 8), uint4(8, 9, 12, 13), uint4(8, 9, 12, 13), uint4(9, 9, 13, 9),
+	uint4(9, 10, 13, 14), uint4(9, 10, 13, 14), uint4(10, 10, 14, 10), uint4(10, 11, 14, 15),
+	uint4(10, 11, 14, 15), uint4(11, 11, 15, 11), uint4(12, 12, 12, 12), uint4(12, 13, 12, 12),
+	uint4(12, 13, 12, 12), uint4(13, 13, 13, 13), uint4(13, 14, 13, 13), uint4(13, 14, 13, 13),
+	uint4(14, 14, 14, 14), uint4(14, 15, 14, 14), uint4(14, 15, 14, 14), uint4(15, 15, 15, 15),
+	uint4(0, 0, 0, 0), uint4(0, 1, 0, 0), uint4(0, 1, 0, 0), uint4(1, 2, 1, 1),
+	uint4(1, 2, 1, 1), uint4(2, 3, 2, 2), uint4(2, 3, 2, 2), uint4(3, 4, 3, 3),
+	uint4(3, 4, 3, 3), uint4(4, 4, 4, 4), uint4(0, 0, 5, 0), uint4(0, 1, 5, 6),
+	uint4(0, 1, 5, 6), uint4(1, 2, 6, 7), uint4(1, 2, 6, 7), uint4(2, 3, 7, 8),
+	uint4(2, 3, 7, 8), uint4(3, 4, 8, 9), uint4(3, 4, 8, 9), uint4(4, 4, 9, 4),
+	uint4(0, 0, 5, 0), uint4(0, 1, 5, 6), uint4(0, 1, 5, 6), uint4(1, 2, 6, 7),
+	uint4(1, 2, 6, 7), uint4(2, 2, 7, 8), uint4(2, 3, 7, 8), uint4(3, 3, 8, 9),
+	uint4(3, 4, 8, 9), uint4(4, 4, 9, 4), uint4(5, 5, 10, 5), uint4(5, 6, 10, 11),
+	uint4(5, 6, 10, 11), uint4(6, 7, 11, 12), uint4(6, 7, 11, 12), uint4(7, 8, 12, 13),
+	uint4(7, 8, 12, 13), uint4(8, 9, 13, 14), uint4(8, 9, 13, 14), uint4(9, 9, 14, 9),
+	uint4(5, 5, 10, 5), uint4(5, 6, 10, 11), uint4(5, 6, 10, 11), uint4(6, 7, 11, 12),
+	uint4(6, 7, 11, 12), uint4(7, 8, 12, 13), uint4(7, 8, 12, 13), uint4(8, 8, 13, 14),
+	uint4(8, 9, 13, 14), uint4(9, 9, 14, 9), uint4(10, 10, 15, 10), uint4(10, 11, 15, 16),
+	uint4(10, 11, 10, 16), uint4(11, 12, 16, 17), uint4(11, 12, 16, 17), uint4(12, 13, 17, 18),
+	uint4(12, 13, 17, 18), uint4(13, 14, 18, 19), uint4(13, 14, 18, 19), uint4(14, 14, 19, 14),
+	uint4(10, 10, 15, 10), uint4(10, 11, 15, 16), uint4(10, 11, 15, 16), uint4(11, 12, 16, 17),
+	uint4(11, 12, 16, 17), uint4(12, 13, 17, 18), uint4(12, 13, 17, 18), uint4(13, 14, 18, 19),
+	uint4(13, 14, 18, 19), uint4(14, 14, 19, 14), uint4(15, 15, 20, 15), uint4(15, 16, 20, 21),
+	uint4(15, 16, 15, 21), uint4(16, 17, 21, 22), uint4(16, 17, 16, 22), uint4(17, 18, 22, 23),
+	uint4(17, 18, 22, 23), uint4(18, 19, 23, 18), uint4(18, 19, 23, 24), uint4(19, 19, 24, 19),
+	uint4(15, 15, 20, 15), uint4(15, 16, 20, 21), uint4(15, 16, 20, 21), uint4(16, 17, 21, 22),
+	uint4(16, 17, 21, 22), uint4(17, 18, 22, 23), uint4(17, 18, 22, 23), uint4(18, 19, 23, 24),
+	uint4(18, 19, 23, 24), uint4(19, 19, 24, 19), uint4(20, 20, 20, 20), uint4(20, 21, 20, 20),
+	uint4(20, 21, 20, 20), uint4(21, 22, 21, 21), uint4(21, 22, 21, 21), uint4(22, 23, 22, 22),
+	uint4(22, 23, 22, 22), uint4(23, 24, 23, 23), uint4(23, 24, 23, 23), uint4(24, 24, 24, 24),
+	uint4(0, 0, 0, 0), uint4(0, 1, 0, 0), uint4(1, 2, 1, 1), uint4(1, 2, 1, 1),
+	uint4(2, 3, 2, 2), uint4(2, 3, 2, 2), uint4(3, 4, 3, 3), uint4(3, 4, 3, 3),
+	uint4(4, 5, 4, 4), uint4(5, 5, 5, 5), uint4(0, 0, 6, 0), uint4(0, 1, 6, 7),
+	uint4(1, 2, 7, 8), uint4(1, 2, 7, 8), uint4(2, 3, 8, 9), uint4(2, 3, 8, 9),
+	uint4(3, 4, 9, 10), uint4(3, 4, 9, 10), uint4(4, 5, 10, 11), uint4(5, 5, 11, 5),
+	uint4(6, 6, 12, 6), uint4(6, 7, 12, 13), uint4(7, 8, 13, 7), uint4(7, 8, 13, 14),
+	uint4(8, 9, 14, 15), uint4(8, 9, 8, 15), uint4(9, 10, 15, 16), uint4(9, 10, 9, 16),
+	uint4(10, 11, 16, 17), uint4(11, 11, 17, 11), uint4(6, 6, 12, 6), uint4(6, 7, 12, 13),
+	uint4(7, 8, 13, 14), uint4(7, 8, 13, 14), uint4(8, 9, 14, 15), uint4(8, 9, 14, 15),
+	uint4(9, 10, 15, 16), uint4(9, 10, 15, 16), uint4(10, 11, 16, 17), uint4(11, 11, 17, 11),
+	uint4(12, 12, 18, 12), uint4(12, 13, 18, 19), uint4(13, 14, 19, 20), uint4(13, 14, 19, 20),
+	uint4(14, 15, 20, 21), uint4(14, 15, 20, 21), uint4(15, 16, 21, 22), uint4(15, 16, 15, 22),
+	uint4(16, 17, 22, 23), uint4(17, 17, 23, 17), uint4(12, 12, 18, 12), uint4(12, 13, 18, 19),
+	uint4(13, 13, 19, 20), uint4(13, 14, 19, 20), uint4(14, 15, 20, 21), uint4(14, 15, 20, 21),
+	uint4(15, 16, 21, 22), uint4(15, 16, 21, 22), uint4(16, 17, 22, 23), uint4(17, 17, 23, 17),
+	uint4(18, 18, 24, 18), uint4(18, 19, 24, 25), uint4(19, 20, 25, 26), uint4(19, 20, 25, 26),
+	uint4(20, 21, 26, 27), uint4(20, 21, 26, 27), uint4(21, 22, 27, 28), uint4(21, 22, 27, 28),
+	uint4(22, 23, 28, 29), uint4(23, 23, 29, 23), uint4(18, 18, 24, 18), uint4(18, 19, 24, 25),
+	uint4(19, 19, 25, 26), uint4(19, 20, 25, 26), uint4(20, 20, 26, 27), uint4(20, 21, 26, 27),
+	uint4(21, 22, 27, 28), uint4(21, 22, 27, 28), uint4(22, 23, 28, 29), uint4(23, 23, 29, 23),
+	uint4(24, 24, 30, 24), uint4(24, 25, 30, 31), uint4(25, 26, 31, 32), uint4(25, 26, 31, 32),
+	uint4(26, 27, 32, 33), uint4(26, 27, 32, 33), uint4(27, 28, 33, 34), uint4(27, 28, 33, 34),
+	uint4(28, 29, 34, 35), uint4(29, 29, 35, 29), uint4(30, 30, 30, 30), uint4(30, 31, 30, 30),
+	uint4(31, 32, 31, 31), uint4(31, 32, 31, 31), uint4(32, 33, 32, 32), uint4(32, 33, 32, 32),
+	uint4(33, 34, 33, 33), uint4(33, 34, 33, 33), uint4(34, 35, 34, 34), uint4(35, 35, 35, 35),
+	uint4(0, 0, 0, 0), uint4(0, 1, 0, 0), uint4(1, 2, 1, 1), uint4(2, 3, 2, 2),
+	uint4(3, 4, 3, 3), uint4(3, 4, 3, 3), uint4(4, 5, 4, 4), uint4(5, 6, 5, 5),
+	uint4(6, 7, 6, 6), uint4(7, 7, 7, 7), uint4(0, 0, 8, 0), uint4(0, 1, 8, 9),
+	uint4(1, 2, 9, 10), uint4(2, 3, 10, 11), uint4(3, 3, 11, 12), uint4(3, 4, 11, 12),
+	uint4(4, 5, 12, 13), uint4(5, 6, 13, 14), uint4(6, 7, 14, 15), uint4(7, 7, 15, 7),
+	uint4(8, 8, 16, 8), uint4(8, 9, 16, 17), uint4(9, 10, 17, 18), uint4(10, 11, 18, 19),
+	uint4(11, 12, 19, 20), uint4(11, 12, 19, 20), uint4(12, 13, 20, 21), uint4(13, 14, 21, 22),
+	uint4(14, 15, 22, 23), uint4(15, 15, 23, 15), uint4(16, 16, 24, 16), uint4(16, 17, 24, 25),
+	uint4(17, 18, 25, 26), uint4(18, 19, 26, 27), uint4(19, 20, 27, 28), uint4(19, 20, 27, 28),
+	uint4(20, 21, 28, 29), uint4(21, 22, 29, 30), uint4(22, 23, 30, 31), uint4(23, 23, 31, 23),
+	uint4(24, 24, 32, 24), uint4(24, 25, 24, 33), uint4(25, 26, 33, 34), uint4(26, 27, 34, 35),
+	uint4(27, 28, 35, 27), uint4(27, 28, 27, 36), uint4(28, 29, 36, 37), uint4(29, 30, 37, 38),
+	uint4(30, 31, 38, 39), uint4(31, 31, 39, 31), uint4(24, 24, 32, 24), uint4(24, 25, 32, 33),
+	uint4(25, 26, 33, 34), uint4(26, 27, 34, 35), uint4(27, 27, 35, 36), uint4(27, 28, 35, 36),
+	uint4(28, 29, 36, 37), uint4(29, 30, 37, 38), uint4(30, 30, 38, 39), uint4(31, 31, 39, 31),
+	uint4(32, 32, 40, 32), uint4(32, 33, 40, 41), uint4(33, 34, 41, 42), uint4(34, 35, 42, 43),
+	uint4(35, 36, 43, 44), uint4(35, 36, 43, 44), uint4(36, 37, 44, 45), uint4(37, 38, 45, 46),
+	uint4(38, 39, 46, 47), uint4(39, 39, 47, 39), uint4(40, 40, 48, 40), uint4(40, 41, 48, 49),
+	uint4(41, 42, 49, 50), uint4(42, 43, 50, 51), uint4(43, 44, 51, 52), uint4(43, 44, 51, 52),
+	uint4(44, 45, 52, 53), uint4(45, 46, 53, 54), uint4(46, 47, 54, 55), uint4(47, 47, 55, 47),
+	uint4(48, 48, 56, 48), uint4(48, 49, 56, 57), uint4(49, 50, 57, 58), uint4(50, 51, 58, 59),
+	uint4(51, 52, 59, 60), uint4(51, 52, 51, 60), uint4(52, 53, 60, 61), uint4(53, 54, 61, 62),
+	uint4(54, 55, 62, 63), uint4(55, 55, 63, 55), uint4(56, 56, 56, 56), uint4(56, 57, 56, 56),
+	uint4(57, 58, 57, 57), uint4(58, 59, 58, 58), uint4(59, 60, 59, 59), uint4(59, 60, 59, 59),
+	uint4(60, 61, 60, 60), uint4(61, 62, 61, 61), uint4(62, 63, 62, 62), uint4(63, 63, 63, 63),
+};
+static const float4 infill_wt_10x10[400] =
+{
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.6875f, 0.3125f, 0.0f, 0.0f), float4(0.3125f, 0.6875f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.6875f, 0.3125f, 0.0f, 0.0f), float4(0.3125f, 0.6875f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.6875f, 0.3125f, 0.0f, 0.0f),
+	float4(0.3125f, 0.6875f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.6875f, 0.0f, 0.3125f, 0.0f), float4(0.5f, 0.1875f, 0.1875f, 0.125f),
+	float4(0.1875f, 0.5f, 0.125f, 0.1875f), float4(0.6875f, 0.0f, 0.3125f, 0.0f), float4(0.5f, 0.1875f, 0.1875f, 0.125f), float4(0.1875f, 0.5f, 0.125f, 0.1875f),
+	float4(0.6875f, 0.0f, 0.3125f, 0.0f), float4(0.5f, 0.1875f, 0.1875f, 0.125f), float4(0.1875f, 0.5f, 0.125f, 0.1875f), float4(0.6875f, 0.0f, 0.3125f, 0.0f),
+	float4(0.3125f, 0.0f, 0.6875f, 0.0f), float4(0.1875f, 0.125f, 0.5f, 0.1875f), float4(0.125f, 0.1875f, 0.1875f, 0.5f), float4(0.3125f, 0.0f, 0.6875f, 0.0f),
+	float4(0.1875f, 0.125f, 0.5f, 0.1875f), float4(0.125f, 0.1875f, 0.1875f, 0.5f), float4(0.3125f, 0.0f, 0.6875f, 0.0f), float4(0.1875f, 0.125f, 0.5f, 0.1875f),
+	float4(0.125f, 0.1875f, 0.1875f, 0.5f), float4(0.3125f, 0.0f, 0.6875f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.6875f, 0.3125f, 0.0f, 0.0f),
+	float4(0.3125f, 0.6875f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.6875f, 0.3125f, 0.0f, 0.0f), float4(0.3125f, 0.6875f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.6875f, 0.3125f, 0.0f, 0.0f), float4(0.3125f, 0.6875f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.6875f, 0.0f, 0.3125f, 0.0f), float4(0.5f, 0.1875f, 0.1875f, 0.125f), float4(0.1875f, 0.5f, 0.125f, 0.1875f), float4(0.6875f, 0.0f, 0.3125f, 0.0f),
+	float4(0.5f, 0.1875f, 0.1875f, 0.125f), float4(0.1875f, 0.5f, 0.125f, 0.1875f), float4(0.6875f, 0.0f, 0.3125f, 0.0f), float4(0.5f, 0.1875f, 0.1875f, 0.125f),
+	float4(0.1875f, 0.5f, 0.125f, 0.1875f), float4(0.6875f, 0.0f, 0.3125f, 0.0f), float4(0.3125f, 0.0f, 0.6875f, 0.0f), float4(0.1875f, 0.125f, 0.5f, 0.1875f),
+	float4(0.125f, 0.1875f, 0.1875f, 0.5f), float4(0.3125f, 0.0f, 0.6875f, 0.0f), float4(0.1875f, 0.125f, 0.5f, 0.1875f), float4(0.125f, 0.1875f, 0.1875f, 0.5f),
+	float4(0.3125f, 0.0f, 0.6875f, 0.0f), float4(0.1875f, 0.125f, 0.5f, 0.1875f), float4(0.125f, 0.1875f, 0.1875f, 0.5f), float4(0.3125f, 0.0f, 0.6875f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.6875f, 0.3125f, 0.0f, 0.0f), float4(0.3125f, 0.6875f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.6875f, 0.3125f, 0.0f, 0.0f), float4(0.3125f, 0.6875f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.6875f, 0.3125f, 0.0f, 0.0f),
+	float4(0.3125f, 0.6875f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.6875f, 0.0f, 0.3125f, 0.0f), float4(0.5f, 0.1875f, 0.1875f, 0.125f),
+	float4(0.1875f, 0.5f, 0.125f, 0.1875f), float4(0.6875f, 0.0f, 0.3125f, 0.0f), float4(0.5f, 0.1875f, 0.1875f, 0.125f), float4(0.1875f, 0.5f, 0.125f, 0.1875f),
+	float4(0.6875f, 0.0f, 0.3125f, 0.0f), float4(0.5f, 0.1875f, 0.1875f, 0.125f), float4(0.1875f, 0.5f, 0.125f, 0.1875f), float4(0.6875f, 0.0f, 0.3125f, 0.0f),
+	float4(0.3125f, 0.0f, 0.6875f, 0.0f), float4(0.1875f, 0.125f, 0.5f, 0.1875f), float4(0.125f, 0.1875f, 0.1875f, 0.5f), float4(0.3125f, 0.0f, 0.6875f, 0.0f),
+	float4(0.1875f, 0.125f, 0.5f, 0.1875f), float4(0.125f, 0.1875f, 0.1875f, 0.5f), float4(0.3125f, 0.0f, 0.6875f, 0.0f), float4(0.1875f, 0.125f, 0.5f, 0.1875f),
+	float4(0.125f, 0.1875f, 0.1875f, 0.5f), float4(0.3125f, 0.0f, 0.6875f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.6875f, 0.3125f, 0.0f, 0.0f),
+	float4(0.3125f, 0.6875f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.6875f, 0.3125f, 0.0f, 0.0f), float4(0.3125f, 0.6875f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.6875f, 0.3125f, 0.0f, 0.0f), float4(0.3125f, 0.6875f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.5625f, 0.4375f, 0.0f, 0.0f), float4(0.125f, 0.875f, 0.0f, 0.0f), float4(0.6875f, 0.3125f, 0.0f, 0.0f),
+	float4(0.1875f, 0.8125f, 0.0f, 0.0f), float4(0.75f, 0.25f, 0.0f, 0.0f), float4(0.3125f, 0.6875f, 0.0f, 0.0f), float4(0.875f, 0.125f, 0.0f, 0.0f),
+	float4(0.4375f, 0.5625f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.5625f, 0.0f, 0.4375f, 0.0f), float4(0.3125f, 0.25f, 0.25f, 0.1875f),
+	float4(0.0625f, 0.5f, 0.0625f, 0.375f), float4(0.375f, 0.1875f, 0.3125f, 0.125f), float4(0.125f, 0.4375f, 0.0625f, 0.375f), float4(0.4375f, 0.125f, 0.3125f, 0.125f),
+	float4(0.1875f, 0.375f, 0.125f, 0.3125f), float4(0.5f, 0.0625f, 0.375f, 0.0625f), float4(0.25f, 0.3125f, 0.1875f, 0.25f), float4(0.5625f, 0.0f, 0.4375f, 0.0f),
+	float4(0.125f, 0.0f, 0.875f, 0.0f), float4(0.0625f, 0.0625f, 0.5f, 0.375f), float4(0.0f, 0.125f, 0.125f, 0.75f), float4(0.0625f, 0.0625f, 0.625f, 0.25f),
+	float4(0.0f, 0.125f, 0.1875f, 0.6875f), float4(0.125f, 0.0f, 0.625f, 0.25f), float4(0.0625f, 0.0625f, 0.25f, 0.625f), float4(0.125f, 0.0f, 0.75f, 0.125f),
+	float4(0.0625f, 0.0625f, 0.375f, 0.5f), float4(0.125f, 0.0f, 0.875f, 0.0f), float4(0.6875f, 0.0f, 0.3125f, 0.0f), float4(0.375f, 0.3125f, 0.1875f, 0.125f),
+	float4(0.0625f, 0.625f, 0.0625f, 0.25f), float4(0.5f, 0.1875f, 0.1875f, 0.125f), float4(0.125f, 0.5625f, 0.0625f, 0.25f), float4(0.5f, 0.1875f, 0.25f, 0.0625f),
+	float4(0.1875f, 0.5f, 0.125f, 0.1875f), float4(0.625f, 0.0625f, 0.25f, 0.0625f), float4(0.3125f, 0.375f, 0.125f, 0.1875f), float4(0.6875f, 0.0f, 0.3125f, 0.0f),
+	float4(0.1875f, 0.0f, 0.8125f, 0.0f), float4(0.125f, 0.0625f, 0.4375f, 0.375f), float4(0.0f, 0.1875f, 0.125f, 0.6875f), float4(0.125f, 0.0625f, 0.5625f, 0.25f),
+	float4(0.0625f, 0.125f, 0.125f, 0.6875f), float4(0.125f, 0.0625f, 0.625f, 0.1875f), float4(0.0625f, 0.125f, 0.25f, 0.5625f), float4(0.1875f, 0.0f, 0.6875f, 0.125f),
+	float4(0.0625f, 0.125f, 0.375f, 0.4375f), float4(0.1875f, 0.0f, 0.8125f, 0.0f), float4(0.75f, 0.0f, 0.25f, 0.0f), float4(0.4375f, 0.3125f, 0.125f, 0.125f),
+	float4(0.125f, 0.625f, 0.0f, 0.25f), float4(0.5f, 0.25f, 0.1875f, 0.0625f), float4(0.125f, 0.625f, 0.0625f, 0.1875f), float4(0.5625f, 0.1875f, 0.1875f, 0.0625f),
+	float4(0.25f, 0.5f, 0.0625f, 0.1875f), float4(0.6875f, 0.0625f, 0.1875f, 0.0625f), float4(0.3125f, 0.4375f, 0.125f, 0.125f), float4(0.75f, 0.0f, 0.25f, 0.0f),
+	float4(0.3125f, 0.0f, 0.6875f, 0.0f), float4(0.1875f, 0.125f, 0.375f, 0.3125f), float4(0.0625f, 0.25f, 0.0625f, 0.625f), float4(0.1875f, 0.125f, 0.5f, 0.1875f),
+	float4(0.0625f, 0.25f, 0.125f, 0.5625f), float4(0.25f, 0.0625f, 0.5f, 0.1875f), float4(0.125f, 0.1875f, 0.1875f, 0.5f), float4(0.25f, 0.0625f, 0.625f, 0.0625f),
+	float4(0.125f, 0.1875f, 0.3125f, 0.375f), float4(0.3125f, 0.0f, 0.6875f, 0.0f), float4(0.875f, 0.0f, 0.125f, 0.0f), float4(0.5f, 0.375f, 0.0625f, 0.0625f),
+	float4(0.125f, 0.75f, 0.0f, 0.125f), float4(0.625f, 0.25f, 0.0625f, 0.0625f), float4(0.1875f, 0.6875f, 0.0f, 0.125f), float4(0.6875f, 0.1875f, 0.0625f, 0.0625f),
+	float4(0.25f, 0.625f, 0.0625f, 0.0625f), float4(0.75f, 0.125f, 0.125f, 0.0f), float4(0.375f, 0.5f, 0.0625f, 0.0625f), float4(0.875f, 0.0f, 0.125f, 0.0f),
+	float4(0.4375f, 0.0f, 0.5625f, 0.0f), float4(0.25f, 0.1875f, 0.3125f, 0.25f), float4(0.0625f, 0.375f, 0.0625f, 0.5f), float4(0.3125f, 0.125f, 0.375f, 0.1875f),
+	float4(0.0625f, 0.375f, 0.125f, 0.4375f), float4(0.3125f, 0.125f, 0.4375f, 0.125f), float4(0.125f, 0.3125f, 0.1875f, 0.375f), float4(0.375f, 0.0625f, 0.5f, 0.0625f),
+	float4(0.1875f, 0.25f, 0.25f, 0.3125f), float4(0.4375f, 0.0f, 0.5625f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.5625f, 0.4375f, 0.0f, 0.0f),
+	float4(0.125f, 0.875f, 0.0f, 0.0f), float4(0.6875f, 0.3125f, 0.0f, 0.0f), float4(0.1875f, 0.8125f, 0.0f, 0.0f), float4(0.75f, 0.25f, 0.0f, 0.0f),
+	float4(0.3125f, 0.6875f, 0.0f, 0.0f), float4(0.875f, 0.125f, 0.0f, 0.0f), float4(0.4375f, 0.5625f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.4375f, 0.5625f, 0.0f, 0.0f), float4(0.875f, 0.125f, 0.0f, 0.0f), float4(0.3125f, 0.6875f, 0.0f, 0.0f),
+	float4(0.75f, 0.25f, 0.0f, 0.0f), float4(0.1875f, 0.8125f, 0.0f, 0.0f), float4(0.6875f, 0.3125f, 0.0f, 0.0f), float4(0.125f, 0.875f, 0.0f, 0.0f),
+	float4(0.5625f, 0.4375f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.4375f, 0.0f, 0.5625f, 0.0f), float4(0.1875f, 0.25f, 0.25f, 0.3125f),
+	float4(0.375f, 0.0625f, 0.5f, 0.0625f), float4(0.125f, 0.3125f, 0.1875f, 0.375f), float4(0.3125f, 0.125f, 0.4375f, 0.125f), float4(0.0625f, 0.375f, 0.125f, 0.4375f),
+	float4(0.3125f, 0.125f, 0.375f, 0.1875f), float4(0.0625f, 0.375f, 0.0625f, 0.5f), float4(0.25f, 0.1875f, 0.3125f, 0.25f), float4(0.4375f, 0.0f, 0.5625f, 0.0f),
+	float4(0.875f, 0.0f, 0.125f, 0.0f), float4(0.375f, 0.5f, 0.0625f, 0.0625f), float4(0.75f, 0.125f, 0.125f, 0.0f), float4(0.25f, 0.625f, 0.0625f, 0.0625f),
+	float4(0.6875f, 0.1875f, 0.0625f, 0.0625f), float4(0.1875f, 0.6875f, 0.0f, 0.125f), float4(0.625f, 0.25f, 0.0625f, 0.0625f), float4(0.125f, 0.75f, 0.0f, 0.125f),
+	float4(0.5f, 0.375f, 0.0625f, 0.0625f), float4(0.875f, 0.0f, 0.125f, 0.0f), float4(0.3125f, 0.0f, 0.6875f, 0.0f), float4(0.125f, 0.1875f, 0.3125f, 0.375f),
+	float4(0.25f, 0.0625f, 0.625f, 0.0625f), float4(0.125f, 0.1875f, 0.1875f, 0.5f), float4(0.25f, 0.0625f, 0.5f, 0.1875f), float4(0.0625f, 0.25f, 0.125f, 0.5625f),
+	float4(0.1875f, 0.125f, 0.5f, 0.1875f), float4(0.0625f, 0.25f, 0.0625f, 0.625f), float4(0.1875f, 0.125f, 0.375f, 0.3125f), float4(0.3125f, 0.0f, 0.6875f, 0.0f),
+	float4(0.75f, 0.0f, 0.25f, 0.0f), float4(0.3125f, 0.4375f, 0.125f, 0.125f), float4(0.6875f, 0.0625f, 0.1875f, 0.0625f), float4(0.25f, 0.5f, 0.0625f, 0.1875f),
+	float4(0.5625f, 0.1875f, 0.1875f, 0.0625f), float4(0.125f, 0.625f, 0.0625f, 0.1875f), float4(0.5f, 0.25f, 0.1875f, 0.0625f), float4(0.125f, 0.625f, 0.0f, 0.25f),
+	float4(0.4375f, 0.3125f, 0.125f, 0.125f), float4(0.75f, 0.0f, 0.25f, 0.0f), float4(0.1875f, 0.0f, 0.8125f, 0.0f), float4(0.0625f, 0.125f, 0.375f, 0.4375f),
+	float4(0.1875f, 0.0f, 0.6875f, 0.125f), float4(0.0625f, 0.125f, 0.25f, 0.5625f), float4(0.125f, 0.0625f, 0.625f, 0.1875f), float4(0.0625f, 0.125f, 0.125f, 0.6875f),
+	float4(0.125f, 0.0625f, 0.5625f, 0.25f), float4(0.0f, 0.1875f, 0.125f, 0.6875f), float4(0.125f, 0.0625f, 0.4375f, 0.375f), float4(0.1875f, 0.0f, 0.8125f, 0.0f),
+	float4(0.6875f, 0.0f, 0.3125f, 0.0f), float4(0.3125f, 0.375f, 0.125f, 0.1875f), float4(0.625f, 0.0625f, 0.25f, 0.0625f), float4(0.1875f, 0.5f, 0.125f, 0.1875f),
+	float4(0.5f, 0.1875f, 0.25f, 0.0625f), float4(0.125f, 0.5625f, 0.0625f, 0.25f), float4(0.5f, 0.1875f, 0.1875f, 0.125f), float4(0.0625f, 0.625f, 0.0625f, 0.25f),
+	float4(0.375f, 0.3125f, 0.1875f, 0.125f), float4(0.6875f, 0.0f, 0.3125f, 0.0f), float4(0.125f, 0.0f, 0.875f, 0.0f), float4(0.0625f, 0.0625f, 0.375f, 0.5f),
+	float4(0.125f, 0.0f, 0.75f, 0.125f), float4(0.0625f, 0.0625f, 0.25f, 0.625f), float4(0.125f, 0.0f, 0.625f, 0.25f), float4(0.0f, 0.125f, 0.1875f, 0.6875f),
+	float4(0.0625f, 0.0625f, 0.625f, 0.25f), float4(0.0f, 0.125f, 0.125f, 0.75f), float4(0.0625f, 0.0625f, 0.5f, 0.375f), float4(0.125f, 0.0f, 0.875f, 0.0f),
+	float4(0.5625f, 0.0f, 0.4375f, 0.0f), float4(0.25f, 0.3125f, 0.1875f, 0.25f), float4(0.5f, 0.0625f, 0.375f, 0.0625f), float4(0.1875f, 0.375f, 0.125f, 0.3125f),
+	float4(0.4375f, 0.125f, 0.3125f, 0.125f), float4(0.125f, 0.4375f, 0.0625f, 0.375f), float4(0.375f, 0.1875f, 0.3125f, 0.125f), float4(0.0625f, 0.5f, 0.0625f, 0.375f),
+	float4(0.3125f, 0.25f, 0.25f, 0.1875f), float4(0.5625f, 0.0f, 0.4375f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.4375f, 0.5625f, 0.0f, 0.0f),
+	float4(0.875f, 0.125f, 0.0f, 0.0f), float4(0.3125f, 0.6875f, 0.0f, 0.0f), float4(0.75f, 0.25f, 0.0f, 0.0f), float4(0.1875f, 0.8125f, 0.0f, 0.0f),
+	float4(0.6875f, 0.3125f, 0.0f, 0.0f), float4(0.125f, 0.875f, 0.0f, 0.0f), float4(0.5625f, 0.4375f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.25f, 0.75f, 0.0f, 0.0f), float4(0.4375f, 0.5625f, 0.0f, 0.0f), float4(0.6875f, 0.3125f, 0.0f, 0.0f),
+	float4(0.875f, 0.125f, 0.0f, 0.0f), float4(0.125f, 0.875f, 0.0f, 0.0f), float4(0.3125f, 0.6875f, 0.0f, 0.0f), float4(0.5625f, 0.4375f, 0.0f, 0.0f),
+	float4(0.75f, 0.25f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.25f, 0.0f, 0.75f, 0.0f), float4(0.0625f, 0.1875f, 0.1875f, 0.5625f),
+	float4(0.125f, 0.125f, 0.3125f, 0.4375f), float4(0.1875f, 0.0625f, 0.5f, 0.25f), float4(0.25f, 0.0f, 0.625f, 0.125f), float4(0.0625f, 0.1875f, 0.0625f, 0.6875f),
+	float4(0.0625f, 0.1875f, 0.25f, 0.5f), float4(0.125f, 0.125f, 0.4375f, 0.3125f), float4(0.1875f, 0.0625f, 0.5625f, 0.1875f), float4(0.25f, 0.0f, 0.75f, 0.0f),
+	float4(0.4375f, 0.0f, 0.5625f, 0.0f), float4(0.125f, 0.3125f, 0.125f, 0.4375f), float4(0.1875f, 0.25f, 0.25f, 0.3125f), float4(0.3125f, 0.125f, 0.375f, 0.1875f),
+	float4(0.375f, 0.0625f, 0.5f, 0.0625f), float4(0.0625f, 0.375f, 0.0625f, 0.5f), float4(0.125f, 0.3125f, 0.1875f, 0.375f), float4(0.25f, 0.1875f, 0.3125f, 0.25f),
+	float4(0.3125f, 0.125f, 0.4375f, 0.125f), float4(0.4375f, 0.0f, 0.5625f, 0.0f), float4(0.6875f, 0.0f, 0.3125f, 0.0f), float4(0.1875f, 0.5f, 0.0625f, 0.25f),
+	float4(0.3125f, 0.375f, 0.125f, 0.1875f), float4(0.5f, 0.1875f, 0.1875f, 0.125f), float4(0.625f, 0.0625f, 0.25f, 0.0625f), float4(0.0625f, 0.625f, 0.0625f, 0.25f),
+	float4(0.1875f, 0.5f, 0.125f, 0.1875f), float4(0.375f, 0.3125f, 0.1875f, 0.125f), float4(0.5f, 0.1875f, 0.25f, 0.0625f), float4(0.6875f, 0.0f, 0.3125f, 0.0f),
+	float4(0.875f, 0.0f, 0.125f, 0.0f), float4(0.25f, 0.625f, 0.0f, 0.125f), float4(0.375f, 0.5f, 0.0625f, 0.0625f), float4(0.625f, 0.25f, 0.0625f, 0.0625f),
+	float4(0.75f, 0.125f, 0.125f, 0.0f), float4(0.125f, 0.75f, 0.0f, 0.125f), float4(0.25f, 0.625f, 0.0625f, 0.0625f), float4(0.5f, 0.375f, 0.0625f, 0.0625f),
+	float4(0.6875f, 0.1875f, 0.0625f, 0.0625f), float4(0.875f, 0.0f, 0.125f, 0.0f), float4(0.125f, 0.0f, 0.875f, 0.0f), float4(0.0625f, 0.0625f, 0.1875f, 0.6875f),
+	float4(0.0625f, 0.0625f, 0.375f, 0.5f), float4(0.0625f, 0.0625f, 0.625f, 0.25f), float4(0.125f, 0.0f, 0.75f, 0.125f), float4(0.0f, 0.125f, 0.125f, 0.75f),
+	float4(0.0625f, 0.0625f, 0.25f, 0.625f), float4(0.0625f, 0.0625f, 0.5f, 0.375f), float4(0.125f, 0.0f, 0.625f, 0.25f), float4(0.125f, 0.0f, 0.875f, 0.0f),
+	float4(0.3125f, 0.0f, 0.6875f, 0.0f), float4(0.0625f, 0.25f, 0.1875f, 0.5f), float4(0.125f, 0.1875f, 0.3125f, 0.375f), float4(0.1875f, 0.125f, 0.5f, 0.1875f),
+	float4(0.25f, 0.0625f, 0.625f, 0.0625f), float4(0.0625f, 0.25f, 0.0625f, 0.625f), float4(0.125f, 0.1875f, 0.1875f, 0.5f), float4(0.1875f, 0.125f, 0.375f, 0.3125f),
+	float4(0.25f, 0.0625f, 0.5f, 0.1875f), float4(0.3125f, 0.0f, 0.6875f, 0.0f), float4(0.5625f, 0.0f, 0.4375f, 0.0f), float4(0.125f, 0.4375f, 0.125f, 0.3125f),
+	float4(0.25f, 0.3125f, 0.1875f, 0.25f), float4(0.375f, 0.1875f, 0.3125f, 0.125f), float4(0.5f, 0.0625f, 0.375f, 0.0625f), float4(0.0625f, 0.5f, 0.0625f, 0.375f),
+	float4(0.1875f, 0.375f, 0.125f, 0.3125f), float4(0.3125f, 0.25f, 0.25f, 0.1875f), float4(0.4375f, 0.125f, 0.3125f, 0.125f), float4(0.5625f, 0.0f, 0.4375f, 0.0f),
+	float4(0.75f, 0.0f, 0.25f, 0.0f), float4(0.1875f, 0.5625f, 0.0625f, 0.1875f), float4(0.3125f, 0.4375f, 0.125f, 0.125f), float4(0.5f, 0.25f, 0.1875f, 0.0625f),
+	float4(0.6875f, 0.0625f, 0.1875f, 0.0625f), float4(0.125f, 0.625f, 0.0f, 0.25f), float4(0.25f, 0.5f, 0.0625f, 0.1875f), float4(0.4375f, 0.3125f, 0.125f, 0.125f),
+	float4(0.5625f, 0.1875f, 0.1875f, 0.0625f), float4(0.75f, 0.0f, 0.25f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.25f, 0.75f, 0.0f, 0.0f),
+	float4(0.4375f, 0.5625f, 0.0f, 0.0f), float4(0.6875f, 0.3125f, 0.0f, 0.0f), float4(0.875f, 0.125f, 0.0f, 0.0f), float4(0.125f, 0.875f, 0.0f, 0.0f),
+	float4(0.3125f, 0.6875f, 0.0f, 0.0f), float4(0.5625f, 0.4375f, 0.0f, 0.0f), float4(0.75f, 0.25f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+};
+static const uint4 pseudo_inverse_idx_10x10[564] =
+{
+	uint4(0, 1, 2, 3), uint4(4, 10, 11, 12), uint4(13, 14, 20, 21), uint4(30, 31, 40, 41),
+	uint4(0, 1, 2, 3), uint4(4, 5, 6, 7), uint4(10, 12, 13, 14), uint4(16, 23, 33, 34),
+	uint4(2, 3, 4, 5), uint4(6, 7, 8, 9), uint4(13, 15, 16, 17), uint4(19, 26, 35, 36),
+	uint4(5, 6, 7, 8), uint4(9, 15, 16, 17), uint4(18, 19, 28, 29), uint4(38, 39, 48, 49),
+	uint4(0, 1, 10, 20), uint4(21, 30, 31, 32), uint4(33, 40, 41, 43), uint4(50, 60, 61, 70),
+	uint4(3, 4, 22, 23), uint4(24, 30, 32, 33), uint4(34, 35, 36, 42), uint4(43, 44, 53, 63),
+	uint4(5, 6, 25, 26), uint4(27, 33, 34, 35), uint4(36, 37, 39, 45), uint4(46, 47, 56, 66),
+	uint4(8, 9, 19, 28), uint4(29, 36, 37, 38), uint4(39, 46, 48, 49), uint4(59, 68, 69, 79),
+	uint4(20, 30, 31, 40), uint4(50, 51, 53, 60), uint4(61, 62, 63, 70), uint4(71, 80, 90, 91),
+	uint4(33, 43, 50, 52), uint4(53, 54, 60, 62), uint4(63, 64, 65, 66), uint4(72, 73, 74, 93),
+	uint4(36, 46, 55, 56), uint4(57, 63, 64, 65), uint4(66, 67, 69, 75), uint4(76, 77, 95, 96),
+	uint4(29, 38, 39, 49), uint4(56, 58, 59, 66), uint4(67, 68, 69, 78), uint4(79, 89, 98, 99),
+	uint4(50, 51, 60, 61), uint4(70, 71, 80, 81), uint4(82, 83, 84, 90), uint4(91, 92, 93, 94),
+	uint4(63, 64, 73, 80), uint4(82, 83, 84, 86), uint4(90, 91, 92, 93), uint4(94, 95, 96, 97),
+	uint4(65, 66, 76, 83), uint4(85, 86, 87, 89), uint4(92, 93, 94, 95), uint4(96, 97, 98, 99),
+	uint4(58, 59, 68, 69), uint4(78, 79, 85, 86), uint4(87, 88, 89, 95), uint4(96, 97, 98, 99),
+	uint4(0, 1, 2, 3), uint4(5, 10, 11, 12), uint4(13, 20, 21, 23), uint4(30, 31, 32, 50),
+	uint4(0, 1, 2, 3), uint4(5, 7, 10, 11), uint4(12, 13, 15, 22), uint4(23, 31, 32, 33),
+	uint4(1, 2, 3, 4), uint4(5, 6, 7, 8), uint4(9, 12, 14, 15), uint4(17, 24, 34, 35),
+	uint4(2, 4, 6, 7), uint4(8, 9, 14, 16), uint4(17, 18, 19, 26), uint4(27, 34, 36, 37),
+	uint4(4, 6, 7, 8), uint4(9, 16, 17, 18), uint4(19, 28, 29, 36), uint4(37, 38, 39, 59),
+	uint4(0, 1, 10, 11), uint4(13, 20, 21, 22), uint4(23, 30, 31, 32), uint4(33, 50, 51, 70),
+	uint4(2, 3, 12, 13), uint4(20, 21, 22, 23), uint4(25, 30, 31, 32), uint4(33, 35, 52, 53),
+	uint4(4, 5, 7, 14), uint4(15, 22, 23, 24), uint4(25, 27, 32, 34), uint4(35, 37, 54, 55),
+	uint4(6, 7, 16, 17), uint4(24, 26, 27, 28), uint4(29, 34, 36, 37), uint4(38, 39, 56, 57),
+	uint4(8, 9, 18, 19), uint4(24, 26, 27, 28), uint4(29, 36, 37, 38), uint4(39, 58, 59, 79),
+	uint4(10, 20, 21, 30), uint4(40, 41, 42, 43), uint4(50, 51, 53, 60), uint4(70, 71, 80, 90),
+	uint4(22, 23, 32, 40), uint4(41, 42, 43, 45), uint4(50, 51, 52, 53), uint4(55, 70, 72, 73),
+	uint4(24, 25, 35, 42), uint4(44, 45, 47, 52), uint4(53, 54, 55, 56), uint4(57, 65, 74, 75),
+	uint4(26, 27, 37, 44), uint4(46, 47, 48, 49), uint4(54, 56, 57, 58), uint4(59, 67, 76, 77),
+	uint4(19, 28, 29, 39), uint4(46, 48, 49, 56), uint4(57, 58, 59, 69), uint4(78, 79, 89, 99),
+	uint4(20, 40, 41, 43), uint4(60, 61, 62, 63), uint4(70, 71, 72, 73), uint4(80, 81, 90, 91),
+	uint4(42, 43, 60, 61), uint4(62, 63, 65, 70), uint4(71, 72, 73, 75), uint4(82, 83, 92, 93),
+	uint4(44, 45, 62, 64), uint4(65, 67, 72, 73), uint4(74, 75, 76, 77), uint4(84, 85, 94, 95),
+	uint4(46, 47, 64, 66), uint4(67, 68, 69, 74), uint4(76, 77, 78, 79), uint4(86, 87, 96, 97),
+	uint4(29, 48, 49, 66), uint4(67, 68, 69, 76), uint4(77, 78, 79, 86), uint4(88, 89, 98, 99),
+	uint4(40, 60, 61, 63), uint4(70, 71, 73, 80), uint4(81, 82, 83, 90), uint4(91, 92, 93, 95),
+	uint4(42, 62, 63, 72), uint4(73, 80, 81, 82), uint4(83, 85, 90, 91), uint4(92, 93, 95, 97),
+	uint4(64, 65, 75, 82), uint4(84, 85, 87, 91), uint4(92, 93, 94, 95), uint4(96, 97, 98, 99),
+	uint4(66, 67, 68, 76), uint4(77, 84, 86, 87), uint4(88, 89, 92, 94), uint4(96, 97, 98, 99),
+	uint4(49, 67, 68, 69), uint4(76, 78, 79, 86), uint4(87, 88, 89, 94), uint4(96, 97, 98, 99),
+	uint4(0, 1, 2, 3), uint4(4, 6, 10, 11), uint4(12, 14, 20, 21), uint4(22, 30, 40, 41),
+	uint4(0, 1, 2, 3), uint4(4, 6, 10, 11), uint4(12, 14, 20, 21), uint4(22, 24, 41, 42),
+	uint4(0, 1, 2, 3), uint4(4, 5, 6, 8), uint4(11, 13, 14, 15), uint4(16, 23, 24, 26),
+	uint4(1, 2, 3, 5), uint4(6, 7, 8, 9), uint4(13, 15, 16, 18), uint4(23, 25, 26, 45),
+	uint4(3, 5, 6, 7), uint4(8, 9, 15, 17), uint4(18, 19, 25, 27), uint4(28, 29, 47, 48),
+	uint4(3, 5, 6, 7), uint4(8, 9, 15, 17), uint4(18, 19, 27, 28), uint4(29, 39, 49, 69),
+	uint4(0, 1, 2, 10), uint4(11, 12, 14, 20), uint4(21, 22, 24, 30), uint4(40, 41, 42, 60),
+	uint4(1, 2, 10, 11), uint4(12, 13, 14, 20), uint4(21, 22, 24, 31), uint4(33, 41, 42, 62),
+	uint4(3, 4, 11, 12), uint4(13, 14, 16, 20), uint4(21, 22, 23, 24), uint4(26, 34, 43, 44),
+	uint4(5, 6, 13, 15), uint4(16, 17, 18, 23), uint4(25, 26, 27, 28), uint4(29, 35, 45, 46),
+	uint4(7, 8, 15, 16), uint4(17, 18, 19, 25), uint4(27, 28, 29, 36), uint4(45, 47, 48, 67),
+	uint4(7, 8, 9, 15), uint4(17, 18, 19, 25), uint4(27, 28, 29, 39), uint4(47, 48, 49, 69),
+	uint4(0, 10, 11, 20), uint4(30, 31, 32, 40), uint4(41, 42, 50, 51), uint4(60, 61, 62, 80),
+	uint4(2, 11, 12, 21), uint4(22, 30, 31, 32), uint4(34, 40, 41, 42), uint4(43, 44, 61, 62),
+	uint4(13, 14, 23, 24), uint4(31, 32, 33, 34), uint4(36, 41, 42, 43), uint4(44, 46, 63, 64),
+	uint4(15, 16, 25, 26), uint4(33, 35, 36, 37), uint4(38, 43, 45, 46), uint4(48, 55, 65, 66),
+	uint4(7, 17, 18, 27), uint4(28, 35, 37, 38), uint4(39, 45, 46, 47), uint4(48, 49, 67, 68),
+	uint4(9, 18, 19, 29), uint4(37, 38, 39, 47), uint4(48, 49, 58, 59), uint4(67, 68, 69, 89),
+	uint4(10, 20, 30, 31), uint4(32, 50, 51, 52), uint4(54, 60, 61, 62), uint4(70, 80, 81, 90),
+	uint4(31, 32, 50, 51), uint4(52, 53, 54, 60), uint4(61, 62, 64, 71), uint4(72, 81, 82, 92),
+	uint4(33, 34, 51, 52), uint4(53, 54, 55, 56), uint4(61, 62, 63, 64), uint4(66, 73, 83, 84),
+	uint4(35, 36, 53, 55), uint4(56, 57, 58, 63), uint4(65, 66, 67, 68), uint4(75, 76, 85, 86),
+	uint4(37, 38, 55, 56), uint4(57, 58, 59, 65), uint4(67, 68, 69, 77), uint4(78, 87, 88, 97),
+	uint4(19, 29, 37, 38), uint4(39, 55, 57, 58), uint4(59, 67, 68, 69), uint4(79, 88, 89, 99),
+	uint4(30, 50, 51, 52), uint4(60, 70, 71, 72), uint4(74, 80, 81, 82), uint4(84, 90, 91, 92),
+	uint4(51, 52, 54, 61), uint4(63, 70, 71, 72), uint4(74, 76, 80, 81), uint4(82, 84, 91, 92),
+	uint4(53, 54, 64, 70), uint4(71, 72, 73, 74), uint4(76, 81, 82, 83), uint4(84, 86, 93, 94),
+	uint4(55, 56, 65, 73), uint4(75, 76, 77, 78), uint4(79, 83, 85, 86), uint4(87, 88, 95, 96),
+	uint4(37, 57, 58, 68), uint4(73, 75, 77, 78), uint4(79, 85, 86, 87), uint4(88, 89, 97, 98),
+	uint4(39, 57, 58, 59), uint4(69, 75, 77, 78), uint4(79, 85, 87, 88), uint4(89, 97, 98, 99),
+	uint4(30, 50, 51, 60), uint4(70, 71, 72, 80), uint4(81, 82, 90, 91), uint4(92, 93, 94, 96),
+	uint4(51, 52, 70, 71), uint4(72, 74, 80, 81), uint4(82, 84, 90, 91), uint4(92, 93, 94, 96),
+	uint4(73, 74, 76, 81), uint4(83, 84, 85, 86), uint4(90, 91, 92, 93), uint4(94, 95, 96, 98),
+	uint4(55, 73, 75, 76), uint4(83, 85, 86, 88), uint4(91, 92, 93, 95), uint4(96, 97, 98, 99),
+	uint4(57, 58, 75, 77), uint4(78, 79, 85, 87), uint4(88, 89, 93, 95), uint4(96, 97, 98, 99),
+	uint4(58, 59, 69, 77), uint4(78, 79, 85, 87), uint4(88, 89, 93, 95), uint4(96, 97, 98, 99),
+	uint4(0, 1, 2, 3), uint4(4, 10, 11, 12), uint4(13, 20, 21, 22), uint4(30, 31, 32, 40),
+	uint4(0, 1, 2, 3), uint4(4, 11, 12, 13), uint4(20, 21, 22, 23), uint4(30, 31, 32, 41),
+	uint4(0, 1, 2, 3), uint4(4, 5, 13, 14), uint4(21, 22, 23, 24), uint4(31, 32, 33, 43),
+	uint4(0, 1, 2, 3), uint4(4, 5, 6, 7), uint4(8, 12, 13, 14), uint4(22, 24, 34, 44),
+	uint4(1, 2, 3, 4), uint4(5, 6, 7, 8), uint4(9, 14, 15, 24), uint4(25, 34, 35, 45),
+	uint4(4, 5, 6, 7), uint4(8, 9, 15, 16), uint4(25, 26, 27, 28), uint4(36, 37, 38, 46),
+	uint4(5, 6, 7, 8), uint4(9, 16, 17, 18), uint4(26, 27, 28, 29), uint4(37, 38, 39, 48),
+	uint4(5, 6, 7, 8), uint4(9, 16, 17, 18), uint4(19, 27, 28, 29), uint4(37, 38, 39, 49),
+	uint4(0, 2, 3, 10), uint4(11, 12, 13, 14), uint4(20, 21, 22, 23), uint4(30, 31, 32, 40),
+	uint4(1, 2, 3, 10), uint4(11, 12, 13, 14), uint4(21, 22, 23, 30), uint4(31, 32, 33, 41),
+	uint4(2, 3, 4, 10), uint4(11, 12, 13, 14), uint4(21, 22, 23, 24), uint4(32, 33, 34, 43),
+	uint4(3, 4, 5, 11), uint4(12, 13, 14, 15), uint4(16, 17, 22, 24), uint4(25, 32, 34, 44),
+	uint4(5, 6, 12, 13), uint4(14, 15, 16, 17), uint4(18, 24, 25, 27), uint4(34, 35, 37, 45),
+	uint4(5, 6, 7, 15), uint4(16, 17, 18, 19), uint4(25, 26, 27, 28), uint4(36, 37, 38, 46),
+	uint4(6, 7, 8, 15), uint4(16, 17, 18, 19), uint4(26, 27, 28, 36), uint4(37, 38, 39, 48),
+	uint4(6, 7, 9, 15), uint4(16, 17, 18, 19), uint4(26, 27, 28, 29), uint4(37, 38, 39, 49),
+	uint4(0, 10, 12, 13), uint4(20, 22, 23, 30), uint4(31, 32, 33, 34), uint4(40, 41, 42, 50),
+	uint4(1, 11, 12, 20), uint4(21, 22, 23, 30), uint4(31, 32, 33, 34), uint4(40, 41, 42, 43),
+	uint4(3, 11, 12, 13), uint4(14, 21, 22, 23), uint4(24, 31, 32, 33), uint4(34, 41, 42, 43),
+	uint4(4, 12, 13, 14), uint4(21, 22, 23, 24), uint4(25, 31, 32, 33), uint4(34, 35, 44, 54),
+	uint4(5, 15, 16, 24), uint4(25, 26, 27, 28), uint4(34, 35, 36, 37), uint4(38, 45, 47, 55),
+	uint4(6, 15, 16, 17), uint4(18, 25, 26, 27), uint4(28, 35, 36, 37), uint4(38, 46, 47, 48),
+	uint4(8, 16, 17, 18), uint4(26, 27, 28, 29), uint4(35, 36, 37, 38), uint4(39, 47, 48, 49),
+	uint4(9, 16, 17, 19), uint4(26, 27, 29, 35), uint4(36, 37, 38, 39), uint4(47, 48, 49, 59),
+	uint4(0, 10, 20, 21), uint4(22, 30, 31, 40), uint4(41, 42, 43, 44), uint4(50, 60, 70, 80),
+	uint4(11, 21, 22, 23), uint4(30, 31, 40, 41), uint4(42, 43, 44, 50), uint4(51, 52, 61, 71),
+	uint4(12, 13, 21, 22), uint4(23, 31, 32, 33), uint4(40, 41, 42, 43), uint4(44, 45, 52, 53),
+	uint4(14, 23, 24, 32), uint4(33, 34, 41, 42), uint4(43, 44, 45, 47), uint4(54, 55, 64, 74),
+	uint4(15, 25, 26, 35), uint4(36, 37, 42, 44), uint4(45, 46, 47, 48), uint4(54, 55, 65, 75),
+	uint4(16, 17, 25, 26), uint4(27, 36, 37, 38), uint4(44, 45, 46, 47), uint4(48, 49, 56, 57),
+	uint4(18, 26, 27, 28), uint4(38, 39, 45, 46), uint4(47, 48, 49, 56), uint4(57, 58, 68, 78),
+	uint4(9, 19, 29, 39), uint4(45, 46, 47, 48), uint4(49, 56, 57, 58), uint4(59, 69, 79, 89),
+	uint4(10, 20, 30, 40), uint4(41, 42, 43, 50), uint4(51, 52, 53, 54), uint4(60, 70, 80, 90),
+	uint4(21, 31, 41, 42), uint4(43, 50, 51, 52), uint4(53, 54, 60, 61), uint4(71, 72, 73, 81),
+	uint4(42, 43, 50, 51), uint4(52, 53, 54, 55), uint4(61, 62, 63, 72), uint4(73, 74, 82, 83),
+	uint4(24, 34, 44, 45), uint4(51, 52, 53, 54), uint4(55, 57, 62, 63), uint4(64, 73, 74, 84),
+	uint4(25, 35, 44, 45), uint4(52, 54, 55, 56), uint4(57, 58, 65, 66), uint4(67, 75, 76, 85),
+	uint4(46, 47, 54, 55), uint4(56, 57, 58, 59), uint4(66, 67, 68, 76), uint4(77, 78, 86, 87),
+	uint4(28, 38, 47, 48), uint4(49, 55, 56, 57), uint4(58, 59, 68, 69), uint4(76, 77, 78, 88),
+	uint4(19, 29, 39, 49), uint4(55, 56, 57, 58), uint4(59, 68, 69, 77), uint4(78, 79, 89, 99),
+	uint4(40, 50, 51, 52), uint4(60, 61, 62, 63), uint4(64, 70, 72, 73), uint4(80, 82, 83, 90),
+	uint4(50, 51, 52, 60), uint4(61, 62, 63, 64), uint4(70, 71, 72, 73), uint4(81, 82, 83, 91),
+	uint4(51, 52, 53, 60), uint4(61, 62, 63, 64), uint4(71, 72, 73, 74), uint4(81, 82, 83, 84),
+	uint4(44, 52, 54, 61), uint4(62, 63, 64, 65), uint4(71, 72, 73, 74), uint4(75, 83, 84, 94),
+	uint4(45, 55, 64, 65), uint4(66, 67, 68, 74), uint4(75, 76, 77, 78), uint4(85, 86, 87, 95),
+	uint4(56, 57, 58, 65), uint4(66, 67, 68, 75), uint4(76, 77, 78, 85), uint4(86, 87, 88, 96),
+	uint4(56, 57, 58, 59), uint4(65, 66, 67, 68), uint4(69, 76, 77, 78), uint4(79, 87, 88, 98),
+	uint4(49, 57, 58, 59), uint4(65, 66, 67, 68), uint4(69, 76, 77, 79), uint4(86, 87, 89, 99),
+	uint4(50, 60, 61, 62), uint4(70, 71, 72, 73), uint4(80, 81, 82, 83), uint4(84, 90, 92, 93),
+	uint4(51, 60, 61, 62), uint4(63, 71, 72, 73), uint4(80, 81, 82, 83), uint4(84, 91, 92, 93),
+	uint4(53, 61, 62, 63), uint4(71, 72, 73, 74), uint4(80, 81, 82, 83), uint4(84, 92, 93, 94),
+	uint4(54, 62, 64, 65), uint4(72, 74, 75, 81), uint4(82, 83, 84, 85), uint4(86, 87, 93, 94),
+	uint4(55, 65, 67, 74), uint4(75, 77, 82, 83), uint4(84, 85, 86, 87), uint4(88, 94, 95, 96),
+	uint4(56, 65, 66, 67), uint4(75, 76, 77, 78), uint4(85, 86, 87, 88), uint4(89, 95, 96, 97),
+	uint4(58, 66, 67, 68), uint4(69, 76, 77, 78), uint4(85, 86, 87, 88), uint4(89, 96, 97, 98),
+	uint4(59, 67, 68, 69), uint4(76, 77, 78, 79), uint4(85, 86, 87, 88), uint4(89, 96, 97, 99),
+	uint4(50, 60, 61, 62), uint4(70, 71, 72, 80), uint4(81, 82, 83, 90), uint4(91, 92, 93, 94),
+	uint4(51, 60, 61, 62), uint4(70, 71, 72, 73), uint4(81, 82, 83, 90), uint4(91, 92, 93, 94),
+	uint4(53, 61, 62, 63), uint4(71, 72, 73, 74), uint4(83, 84, 90, 91), uint4(92, 93, 94, 95),
+	uint4(54, 64, 65, 74), uint4(75, 84, 85, 90), uint4(91, 92, 93, 94), uint4(95, 96, 97, 98),
+	uint4(55, 65, 75, 77), uint4(85, 86, 87, 91), uint4(92, 93, 94, 95), uint4(96, 97, 98, 99),
+	uint4(56, 66, 67, 68), uint4(75, 76, 77, 78), uint4(85, 86, 94, 95), uint4(96, 97, 98, 99),
+	uint4(58, 67, 68, 69), uint4(76, 77, 78, 79), uint4(86, 87, 88, 95), uint4(96, 97, 98, 99),
+	uint4(59, 68, 69, 76), uint4(77, 78, 79, 86), uint4(87, 88, 89, 95), uint4(96, 97, 98, 99),
+};
+static const float4 pseudo_inverse_wt_10x10[564] =
+{
+	float4(0.451361f, 0.281863f, 0.0784647f, -0.0910337f), float4(-0.05677f, 0.281863f, 0.193514f, 0.0306905f),
+	float4(-0.0576585f, -0.0394079f, 0.0784647f, 0.0306905f), float4(-0.0910337f, -0.0576585f, -0.05677f, -0.0394079f),
+	float4(-0.0910337f, 0.0448078f, 0.207818f, 0.343659f), float4(0.214333f, 0.0591412f, -0.0701851f, -0.0424365f),
+	float4(-0.0576585f, 0.14403f, 0.215097f, 0.147445f), float4(-0.0445617f, 0.0608217f, -0.0677407f, -0.0428812f),
+	float4(-0.0424365f, -0.0701851f, 0.0591412f, 0.214333f), float4(0.343659f, 0.207818f, 0.0448078f, -0.0910337f),
+	float4(-0.0445617f, 0.147445f, 0.215097f, 0.14403f), float4(-0.0576585f, 0.0608217f, -0.0428812f, -0.0677407f),
+	float4(-0.05677f, -0.0910337f, 0.0784647f, 0.281863f), float4(0.451361f, -0.0394079f, -0.0576585f, 0.0306905f),
+	float4(0.193514f, 0.281863f, 0.0306905f, 0.0784647f), float4(-0.0576585f, -0.0910337f, -0.0394079f, -0.05677f),
+	float4(-0.0910337f, -0.0576585f, 0.0448078f, 0.207818f), float4(0.14403f, 0.343659f, 0.215097f, 0.0608217f),
+	float4(-0.0677407f, 0.214333f, 0.147445f, -0.0428812f), float4(0.0591412f, -0.0701851f, -0.0445617f, -0.0424365f),
+	float4(-0.0677407f, -0.0428812f, 0.106924f, 0.15807f), float4(0.109376f, -0.0677407f, 0.15807f, 0.260712f),
+	float4(0.162982f, 0.0457052f, -0.0520251f, 0.109376f), float4(0.162982f, 0.111947f, 0.0457052f, -0.0520251f),
+	float4(-0.0428812f, -0.0677407f, 0.109376f, 0.15807f), float4(0.106924f, -0.0520251f, 0.0457052f, 0.162982f),
+	float4(0.260712f, 0.15807f, -0.0677407f, 0.111947f), float4(0.162982f, 0.109376f, 0.0457052f, -0.0520251f),
+	float4(-0.0576585f, -0.0910337f, 0.0448078f, 0.14403f), float4(0.207818f, -0.0677407f, 0.0608217f, 0.215097f),
+	float4(0.343659f, -0.0428812f, 0.147445f, 0.214333f), float4(0.0591412f, -0.0445617f, -0.0701851f, -0.0424365f),
+	float4(-0.0424365f, -0.0701851f, -0.0445617f, 0.0591412f), float4(0.214333f, 0.147445f, -0.0428812f, 0.343659f),
+	float4(0.215097f, 0.0608217f, -0.0677407f, 0.207818f), float4(0.14403f, 0.0448078f, -0.0910337f, -0.0576585f),
+	float4(-0.0520251f, 0.0457052f, -0.0428812f, 0.109376f), float4(0.162982f, 0.111947f, -0.0677407f, 0.15807f),
+	float4(0.260712f, 0.162982f, 0.0457052f, -0.0520251f), float4(0.106924f, 0.15807f, 0.109376f, -0.0677407f),
+	float4(-0.0520251f, 0.0457052f, 0.111947f, 0.162982f), float4(0.109376f, -0.0520251f, 0.0457052f, 0.162982f),
+	float4(0.260712f, 0.15807f, -0.0677407f, 0.109376f), float4(0.15807f, 0.106924f, -0.0428812f, -0.0677407f),
+	float4(-0.0424365f, -0.0445617f, -0.0701851f, 0.0591412f), float4(-0.0428812f, 0.147445f, 0.214333f, -0.0677407f),
+	float4(0.0608217f, 0.215097f, 0.343659f, 0.14403f), float4(0.207818f, 0.0448078f, -0.0576585f, -0.0910337f),
+	float4(-0.05677f, -0.0394079f, -0.0910337f, -0.0576585f), float4(0.0784647f, 0.0306905f, 0.281863f, 0.193514f),
+	float4(0.0306905f, -0.0576585f, -0.0394079f, 0.451361f), float4(0.281863f, 0.0784647f, -0.0910337f, -0.05677f),
+	float4(-0.0677407f, -0.0428812f, 0.0608217f, -0.0576585f), float4(0.14403f, 0.215097f, 0.147445f, -0.0445617f),
+	float4(-0.0910337f, 0.0448078f, 0.207818f, 0.343659f), float4(0.214333f, 0.0591412f, -0.0701851f, -0.0424365f),
+	float4(-0.0428812f, -0.0677407f, 0.0608217f, -0.0445617f), float4(0.147445f, 0.215097f, 0.14403f, -0.0576585f),
+	float4(-0.0424365f, -0.0701851f, 0.0591412f, 0.214333f), float4(0.343659f, 0.207818f, 0.0448078f, -0.0910337f),
+	float4(-0.0394079f, -0.05677f, -0.0576585f, -0.0910337f), float4(0.0306905f, 0.0784647f, -0.0394079f, -0.0576585f),
+	float4(0.0306905f, 0.193514f, 0.281863f, -0.05677f), float4(-0.0910337f, 0.0784647f, 0.281863f, 0.451361f),
+	float4(0.651245f, 0.292803f, -0.0656385f, -0.100403f), float4(0.0328476f, 0.292803f, 0.128643f, -0.0355161f),
+	float4(-0.040918f, -0.0656385f, -0.0355161f, 0.0185665f), float4(-0.100403f, -0.040918f, 0.0185665f, 0.0328476f),
+	float4(-0.16805f, 0.18264f, 0.53333f, 0.378497f), float4(-0.123877f, 0.0439461f, -0.0784491f, 0.0851465f),
+	float4(0.248742f, 0.161027f, -0.0561018f, -0.0358455f), float4(-0.0564418f, -0.0320909f, -0.086181f, -0.0611474f),
+	float4(-0.0526363f, -0.153695f, 0.0856501f, 0.514801f), float4(0.458588f, 0.0785845f, -0.162358f, -0.0556492f),
+	float4(0.05106f, -0.0718599f, 0.198145f, 0.212208f), float4(-0.0780037f, -0.049108f, -0.0983822f, -0.0831982f),
+	float4(0.0439405f, -0.1469f, 0.372995f, 0.530539f), float4(0.181742f, -0.167056f, -0.0520095f, 0.16011f),
+	float4(0.248085f, 0.0848723f, -0.0783401f, -0.0527748f), float4(-0.0343697f, 0.0346971f, -0.0587133f, -0.0854079f),
+	float4(0.0388926f, -0.0988946f, -0.0648039f, 0.293077f), float4(0.650958f, -0.0407965f, -0.0354487f, 0.128672f),
+	float4(0.292793f, -0.0357326f, -0.0653718f, 0.0176557f), float4(0.0184603f, -0.0409677f, -0.100396f, 0.0324007f),
+	float4(-0.16805f, -0.0784491f, 0.18264f, 0.0851465f), float4(-0.0320909f, 0.53333f, 0.248742f, -0.0358455f),
+	float4(-0.086181f, 0.378497f, 0.161027f, -0.0564418f), float4(-0.0611474f, -0.123877f, -0.0561018f, 0.0439461f),
+	float4(-0.133466f, -0.0954512f, 0.137828f, 0.113462f), float4(-0.133466f, 0.137828f, 0.409121f, 0.322375f),
+	float4(-0.0936977f, -0.0954512f, 0.113462f, 0.322375f), float4(0.236787f, -0.0719488f, -0.0936977f, -0.0719488f),
+	float4(-0.156638f, -0.13712f, 0.0600252f, 0.174852f), float4(0.118131f, -0.120523f, 0.0584657f, 0.433674f),
+	float4(0.373383f, -0.131505f, -0.0965529f, 0.339419f), float4(0.280533f, -0.105743f, -0.0966555f, -0.0812451f),
+	float4(-0.0946291f, -0.131252f, 0.10862f, 0.135649f), float4(-0.120187f, 0.311869f, 0.40255f, 0.136171f),
+	float4(-0.130208f, -0.0951657f, 0.231812f, 0.319742f), float4(0.112215f, -0.0953118f, -0.0648711f, -0.102632f),
+	float4(-0.0787052f, -0.167705f, 0.0854387f, 0.182331f), float4(0.0318957f, -0.0827095f, -0.0332016f, 0.249583f),
+	float4(0.532367f, -0.0600946f, -0.0562218f, 0.16113f), float4(0.378482f, -0.0579116f, -0.122349f, 0.0428217f),
+	float4(-0.0526363f, -0.153695f, -0.0718599f, 0.0856501f), float4(0.514801f, 0.198145f, -0.049108f, -0.0983822f),
+	float4(0.458588f, 0.212208f, -0.0831982f, 0.0785845f), float4(-0.162358f, -0.0780037f, -0.0556492f, 0.05106f),
+	float4(-0.120523f, -0.0965529f, 0.0584657f, -0.156638f), float4(0.174852f, 0.433674f, 0.339419f, -0.0966555f),
+	float4(-0.13712f, 0.118131f, 0.373383f, 0.280533f), float4(-0.0812451f, 0.0600252f, -0.131505f, -0.105743f),
+	float4(-0.110179f, -0.0960598f, 0.0658767f, -0.110179f), float4(0.397214f, 0.345229f, -0.113532f, -0.0960598f),
+	float4(0.0658767f, 0.345229f, 0.292964f, 0.0630016f), float4(-0.117541f, 0.0630016f, -0.113532f, -0.117541f),
+	float4(-0.085961f, -0.110782f, 0.0546591f, -0.113976f), float4(0.307251f, 0.400048f, 0.166614f, -0.132282f),
+	float4(-0.0990907f, 0.25432f, 0.41229f, 0.113538f), float4(-0.11961f, 0.0492845f, -0.0911536f, -0.117256f),
+	float4(-0.0519655f, -0.0735722f, -0.151615f, 0.0847481f), float4(-0.082073f, 0.206331f, 0.508484f, -0.0685338f),
+	float4(-0.0828236f, 0.218707f, 0.4534f, 0.0789264f), float4(-0.0771256f, -0.158746f, -0.0544154f, 0.049915f),
+	float4(0.0439405f, -0.1469f, -0.0520095f, 0.0346971f), float4(0.372995f, 0.16011f, -0.0527748f, -0.0587133f),
+	float4(0.530539f, 0.248085f, -0.0343697f, -0.0854079f), float4(0.181742f, 0.0848723f, -0.167056f, -0.0783401f),
+	float4(-0.120187f, -0.0951657f, -0.0946291f, 0.10862f), float4(0.311869f, 0.231812f, -0.0648711f, -0.131252f),
+	float4(0.135649f, 0.40255f, 0.319742f, -0.102632f), float4(0.136171f, 0.112215f, -0.130208f, -0.0953118f),
+	float4(-0.113976f, -0.0990907f, -0.085961f, 0.307251f), float4(0.25432f, -0.0911536f, -0.110782f, 0.0546591f),
+	float4(0.400048f, 0.41229f, 0.0492845f, -0.117256f), float4(0.166614f, 0.113538f, -0.132282f, -0.11961f),
+	float4(-0.082718f, -0.105028f, -0.082718f, 0.23382f), float4(0.316747f, 0.110738f, -0.0952699f, -0.105028f),
+	float4(0.316747f, 0.401293f, 0.13528f, -0.130734f), float4(0.110738f, 0.13528f, -0.0952699f, -0.130734f),
+	float4(0.0428252f, -0.0597268f, -0.143663f, -0.0622636f), float4(-0.0587648f, 0.157463f, 0.373692f, -0.0845317f),
+	float4(-0.034033f, 0.247854f, 0.52974f, -0.0312743f), float4(0.0848413f, 0.181427f, -0.078171f, -0.166887f),
+	float4(0.0388926f, -0.0988946f, -0.0407965f, 0.0176557f), float4(-0.0648039f, -0.0354487f, 0.0184603f, 0.293077f),
+	float4(0.128672f, -0.0357326f, -0.0409677f, 0.650958f), float4(0.292793f, -0.0653718f, -0.100396f, 0.0324007f),
+	float4(0.0318957f, -0.0827095f, -0.0600946f, -0.0332016f), float4(-0.0562218f, -0.0787052f, 0.0854387f, 0.249583f),
+	float4(0.16113f, -0.0579116f, -0.167705f, 0.182331f), float4(0.532367f, 0.378482f, -0.122349f, 0.0428217f),
+	float4(-0.082073f, -0.0685338f, -0.0828236f, -0.0735722f), float4(0.206331f, 0.218707f, -0.0771256f, -0.0519655f),
+	float4(-0.151615f, 0.0847481f, 0.508484f, 0.4534f), float4(0.0789264f, -0.158746f, -0.0544154f, 0.049915f),
+	float4(-0.0622636f, -0.0845317f, -0.0312743f, -0.0587648f), float4(-0.034033f, -0.0597268f, 0.157463f, 0.247854f),
+	float4(0.0848413f, -0.078171f, 0.0428252f, -0.143663f), float4(0.373692f, 0.52974f, 0.181427f, -0.166887f),
+	float4(0.0380289f, 0.0190804f, -0.0400279f, -0.0991362f), float4(0.0190804f, -0.0352885f, -0.0646896f, -0.0400279f),
+	float4(-0.0352885f, 0.128856f, 0.293f, 0.0380289f), float4(-0.0991362f, -0.0646896f, 0.293f, 0.65069f),
+	float4(0.77754f, 0.239367f, -0.149449f, -0.015518f), float4(0.0397956f, -0.0104352f, 0.239367f, 0.069409f),
+	float4(-0.0432377f, 0.0107406f, -0.149449f, -0.0432377f), float4(0.0282398f, -0.015518f, 0.0397956f, 0.0107406f),
+	float4(-0.179212f, 0.409555f, 0.723399f, 0.0750136f), float4(-0.192731f, 0.0505461f, -0.0560962f, 0.131057f),
+	float4(0.212222f, -0.052639f, 0.033452f, -0.0814578f), float4(-0.133423f, 0.0400912f, 0.0207247f, 0.0362922f),
+	float4(0.0588881f, -0.134662f, -0.12616f, 0.589522f), float4(0.666996f, -0.0532903f, -0.175154f, 0.0401119f),
+	float4(-0.0468413f, 0.206346f, 0.192793f, -0.0397438f), float4(-0.0558216f, -0.11088f, -0.122142f, 0.0426079f),
+	float4(0.039982f, 0.0374184f, -0.175241f, 0.645949f), float4(0.515085f, -0.110657f, -0.117897f, 0.0515772f),
+	float4(-0.0647109f, 0.220561f, 0.170736f, -0.0384449f), float4(0.0270413f, -0.125609f, -0.113016f, 0.0338184f),
+	float4(0.0507389f, -0.186961f, 0.0963638f, 0.719298f), float4(0.40494f, -0.177216f, -0.0602765f, 0.209395f),
+	float4(0.1282f, -0.0548181f, 0.0413221f, -0.134382f), float4(-0.0823323f, 0.0338668f, 0.0336167f, 0.0234119f),
+	float4(-0.0104786f, 0.0386167f, -0.0199206f, -0.148617f), float4(0.240311f, 0.777132f, 0.0123022f, -0.0426233f),
+	float4(0.0700152f, 0.239095f, 0.0284624f, -0.043036f), float4(-0.149544f, -0.0152929f, 0.0400593f, -0.0105245f),
+	float4(-0.179212f, -0.0560962f, 0.033452f, 0.409555f), float4(0.131057f, -0.0814578f, 0.0207247f, 0.723399f),
+	float4(0.212222f, -0.133423f, 0.0362922f, 0.0750136f), float4(-0.192731f, -0.052639f, 0.0400912f, 0.0505461f),
+	float4(-0.0933113f, -0.167587f, -0.0933113f, 0.209726f), float4(0.392532f, 0.0637267f, -0.10035f, -0.167587f),
+	float4(0.392532f, 0.650826f, -0.177259f, 0.0637267f), float4(0.0494065f, -0.10035f, -0.177259f, 0.0492183f),
+	float4(-0.118676f, -0.139634f, -0.0613131f, -0.0701919f), float4(0.261094f, 0.33595f, -0.085804f, 0.0508458f),
+	float4(-0.119355f, -0.0867228f, 0.530732f, 0.606122f), float4(-0.168735f, 0.0981937f, -0.11237f, -0.132208f),
+	float4(-0.154156f, -0.121184f, -0.0783167f, 0.332863f), float4(0.2683f, -0.0744923f, -0.0642869f, -0.165685f),
+	float4(0.602715f, 0.545328f, -0.0903916f, -0.123912f), float4(0.052836f, 0.0784268f, -0.161899f, -0.120181f),
+	float4(-0.16987f, -0.0947453f, -0.101448f, 0.0618622f), float4(0.397538f, 0.212563f, -0.0947412f, -0.1775f),
+	float4(0.654434f, 0.396236f, -0.169287f, 0.0554731f), float4(0.0545156f, -0.164456f, -0.113012f, 0.0587481f),
+	float4(0.0339811f, -0.0557641f, -0.179378f, 0.0210236f), float4(-0.0826058f, 0.130413f, 0.40988f, 0.0362753f),
+	float4(-0.134263f, 0.211379f, 0.723786f, 0.0739596f), float4(0.0368914f, -0.0497272f, -0.193941f, 0.0509649f),
+	float4(0.0588881f, -0.134662f, -0.0468413f, -0.12616f), float4(0.589522f, 0.206346f, -0.11088f, 0.666996f),
+	float4(0.192793f, -0.122142f, -0.0532903f, -0.0397438f), float4(-0.175154f, -0.0558216f, 0.0426079f, 0.0401119f),
+	float4(0.0508458f, -0.0613131f, -0.119355f, -0.0701919f), float4(-0.0867228f, -0.118676f, 0.261094f, 0.530732f),
+	float4(-0.11237f, -0.139634f, 0.33595f, 0.606122f), float4(0.0981937f, -0.132208f, -0.085804f, -0.168735f),
+	float4(-0.0737869f, -0.0910311f, -0.0953674f, -0.113891f), float4(-0.0737869f, -0.0953674f, 0.510342f, 0.479046f),
+	float4(-0.134647f, -0.0910311f, -0.113891f, 0.479046f), float4(0.557444f, -0.133015f, -0.134647f, -0.133015f),
+	float4(-0.104232f, -0.0777485f, -0.0687486f, -0.117168f), float4(-0.147609f, 0.473973f, 0.422878f, -0.117437f),
+	float4(-0.0780059f, -0.138321f, 0.565161f, 0.402512f), float4(-0.103044f, -0.07035f, -0.127545f, -0.108276f),
+	float4(0.057481f, -0.13467f, -0.0696041f, -0.0988061f), float4(-0.0807265f, -0.141079f, 0.592448f, 0.290483f),
+	float4(-0.132281f, -0.162532f, 0.117048f, 0.558786f), float4(0.372796f, -0.154951f, -0.198651f, -0.10143f),
+	float4(0.0592913f, -0.0451224f, -0.135528f, -0.127164f), float4(-0.123731f, 0.200235f, 0.592344f, -0.111621f),
+	float4(0.185073f, 0.670204f, -0.0381839f, -0.0539973f), float4(0.0485286f, -0.0527407f, -0.176317f, 0.0404401f),
+	float4(0.039982f, 0.0374184f, -0.175241f, -0.0647109f), float4(0.0270413f, 0.645949f, 0.220561f, -0.125609f),
+	float4(0.0338184f, 0.515085f, 0.170736f, -0.113016f), float4(-0.110657f, -0.117897f, -0.0384449f, 0.0515772f),
+	float4(-0.0783167f, -0.165685f, -0.154156f, 0.332863f), float4(0.602715f, 0.0784268f, -0.161899f, -0.121184f),
+	float4(0.2683f, 0.545328f, -0.120181f, -0.0744923f), float4(-0.0903916f, -0.0642869f, -0.123912f, 0.052836f),
+	float4(-0.147609f, -0.138321f, -0.104232f, -0.0687486f), float4(0.473973f, 0.565161f, -0.07035f, -0.127545f),
+	float4(-0.0777485f, -0.117168f, 0.422878f, 0.402512f), float4(-0.108276f, -0.117437f, -0.0780059f, -0.103044f),
+	float4(-0.126076f, -0.109827f, -0.126076f, 0.548574f), float4(0.408191f, -0.048832f, -0.0832131f, -0.109827f),
+	float4(0.408191f, 0.360132f, -0.0991401f, -0.0661522f), float4(-0.048832f, -0.0991401f, -0.0832131f, -0.0661522f),
+	float4(-0.198186f, -0.0934484f, -0.156133f, 0.0956745f), float4(0.588755f, 0.322034f, -0.1491f, -0.12104f),
+	float4(0.540386f, 0.265194f, -0.119092f, -0.0904833f), float4(-0.0734759f, -0.122815f, -0.0634718f, 0.0523732f),
+	float4(0.0403224f, 0.0378018f, 0.0328774f, -0.0620047f), float4(-0.176398f, 0.0321925f, -0.122491f, 0.222955f),
+	float4(0.644833f, -0.11152f, 0.171635f, 0.514551f), float4(-0.110513f, -0.0386619f, -0.117758f, 0.0515154f),
+	float4(0.0507389f, -0.186961f, -0.0602765f, 0.0413221f), float4(0.0963638f, 0.719298f, 0.209395f, -0.134382f),
+	float4(0.0336167f, 0.40494f, 0.1282f, -0.0823323f), float4(0.0234119f, -0.177216f, -0.0548181f, 0.0338668f),
+	float4(-0.101448f, -0.1775f, 0.0545156f, 0.0618622f), float4(0.0554731f, -0.16987f, 0.397538f, 0.654434f),
+	float4(-0.164456f, 0.0587481f, -0.0947453f, 0.212563f), float4(0.396236f, -0.113012f, -0.0947412f, -0.169287f),
+	float4(-0.141079f, -0.162532f, 0.117048f, 0.057481f), float4(-0.13467f, -0.0988061f, 0.592448f, 0.558786f),
+	float4(-0.198651f, -0.0696041f, -0.0807265f, 0.290483f), float4(0.372796f, -0.10143f, -0.132281f, -0.154951f),
+	float4(-0.156133f, -0.12104f, 0.0956745f, -0.198186f), float4(0.588755f, 0.540386f, -0.0904833f, -0.122815f),
+	float4(0.0523732f, -0.0934484f, 0.322034f, 0.265194f), float4(-0.0734759f, -0.0634718f, -0.1491f, -0.119092f),
+	float4(0.0586519f, -0.173379f, -0.0980706f, 0.0616479f), float4(0.0586519f, -0.173379f, 0.652005f, 0.394021f),
+	float4(-0.16832f, -0.0980706f, 0.0616479f, 0.394021f), float4(0.210676f, -0.0938503f, -0.16832f, -0.0938503f),
+	float4(0.0511421f, 0.0403029f, -0.0610974f, -0.186589f), float4(0.0964355f, 0.0354579f, -0.133866f, 0.210142f),
+	float4(0.718968f, 0.0203124f, -0.0818371f, 0.128614f), float4(0.404743f, 0.0336595f, -0.0550031f, -0.177126f),
+	float4(-0.0104786f, 0.0386167f, 0.0123022f, -0.0199206f), float4(-0.148617f, -0.0426233f, 0.0284624f, 0.240311f),
+	float4(0.0700152f, -0.043036f, 0.777132f, 0.239095f), float4(-0.149544f, -0.0152929f, 0.0400593f, -0.0105245f),
+	float4(0.0210236f, 0.0362753f, 0.0339811f, -0.0826058f), float4(-0.134263f, 0.0368914f, -0.0557641f, 0.130413f),
+	float4(0.211379f, -0.0497272f, -0.179378f, 0.40988f), float4(0.723786f, 0.0739596f, -0.193941f, 0.0509649f),
+	float4(-0.123731f, -0.111621f, 0.0485286f, -0.0451224f), float4(0.200235f, 0.185073f, -0.0381839f, -0.0527407f),
+	float4(0.0592913f, -0.135528f, -0.127164f, 0.592344f), float4(0.670204f, -0.0539973f, -0.176317f, 0.0404401f),
+	float4(0.0321925f, 0.0328774f, -0.122491f, -0.11152f), float4(-0.0620047f, 0.222955f, 0.171635f, -0.0386619f),
+	float4(0.0403224f, 0.0378018f, -0.176398f, 0.644833f), float4(0.514551f, -0.110513f, -0.117758f, 0.0515154f),
+	float4(0.0354579f, 0.0203124f, 0.0403029f, -0.133866f), float4(-0.0818371f, 0.0336595f, -0.0610974f, 0.210142f),
+	float4(0.128614f, -0.0550031f, 0.0511421f, -0.186589f), float4(0.0964355f, 0.718968f, 0.404743f, -0.177126f),
+	float4(0.0124792f, 0.0385377f, -0.0199352f, 0.0283742f), float4(-0.0427912f, -0.148546f, 0.0124792f, -0.0427912f),
+	float4(0.0703796f, 0.240158f, -0.0105666f, 0.0385377f), float4(-0.0199352f, -0.148546f, 0.240158f, 0.776666f),
+	float4(0.979865f, 0.0395832f, -0.0682778f, 0.0555689f), float4(-0.0199585f, 0.0395832f, 0.00550193f, -0.00678f),
+	float4(0.00560077f, -0.0682778f, -0.00678f, 0.00609422f), float4(0.0555689f, 0.00560077f, -0.0043446f, -0.0199585f),
+	float4(-0.273844f, 1.09424f, 0.38659f, -0.314535f), float4(0.112928f, 0.0278883f, 0.0396432f, -0.0329026f),
+	float4(0.0185335f, -0.0716611f, -0.0303017f, 0.021385f), float4(-0.0185795f, 0.0602984f, 0.0280895f, -0.0235957f),
+	float4(0.091607f, -0.36597f, 0.628169f, 0.921783f), float4(-0.331837f, 0.0431814f, 0.0733414f, -0.0310079f),
+	float4(0.0284094f, -0.0440001f, -0.0729346f, 0.0264367f), float4(-0.0221688f, 0.0308969f, 0.0590283f, -0.0193146f),
+	float4(-0.0237149f, 0.0947049f, -0.163113f, 0.136615f), float4(1.09772f, -0.144248f, -0.0361622f, 0.044183f),
+	float4(-0.0258722f, 0.0153434f, -0.021812f, 0.064091f), float4(0.0159375f, -0.0914943f, 0.0736861f, -0.0248443f),
+	float4(-0.0252842f, 0.0437743f, -0.0371055f, -0.142867f), float4(1.10739f, 0.13691f, -0.164874f, 0.0960351f),
+	float4(-0.0240379f, -0.0189245f, 0.0354687f, 0.0276145f), float4(-0.0580931f, -0.0213478f, 0.0461963f, -0.0147184f),
+	float4(0.0438078f, -0.335685f, 0.921532f, 0.628863f), float4(-0.366417f, 0.0917112f, -0.0218024f, 0.0697199f),
+	float4(0.0170812f, -0.0732825f, -0.0427764f, 0.0281122f), float4(0.0592261f, 0.0299615f, -0.0219359f, -0.0188913f),
+	float4(0.11447f, -0.314381f, 0.386282f, 1.09432f), float4(-0.273851f, -0.0318471f, 0.0385945f, 0.0289943f),
+	float4(0.0216602f, -0.0309214f, -0.0722314f, 0.0187779f), float4(0.0284446f, 0.0608853f, -0.0188358f, -0.0226046f),
+	float4(-0.0202238f, 0.0555396f, -0.0682225f, 0.0395815f), float4(0.979881f, 0.00542175f, -0.00659944f, 0.00525924f),
+	float4(0.0395815f, 0.00622041f, -0.00659944f, -0.0682225f), float4(-0.00441191f, 0.00542175f, 0.0555396f, -0.0202238f),
+	float4(-0.273844f, 0.0185335f, -0.0185795f, 1.09424f), float4(0.0278883f, -0.0716611f, 0.0602984f, -0.0235957f),
+	float4(0.38659f, 0.0396432f, -0.0303017f, 0.0280895f), float4(-0.314535f, -0.0329026f, 0.021385f, 0.112928f),
+	float4(-0.32757f, -0.103225f, 0.103272f, -0.32757f), float4(1.28504f, 0.399148f, -0.33509f, 0.131172f),
+	float4(0.399148f, 0.147727f, -0.140845f, 0.103272f), float4(-0.33509f, -0.140845f, 0.118939f, 0.131172f),
+	float4(-0.185016f, -0.246645f, 0.126493f, 0.109237f), float4(-0.428078f, 0.749757f, 0.959575f, -0.375759f),
+	float4(-0.137195f, 0.263298f, 0.404382f, -0.162275f), float4(-0.186867f, -0.327698f, 0.106031f, 0.107185f),
+	float4(-0.0577765f, -0.349322f, 0.0943915f, 0.124359f), float4(-0.217801f, 0.215684f, 1.25005f, -0.225281f),
+	float4(-0.0499092f, 0.0507789f, -0.0763929f, 0.477888f), float4(-0.0471698f, 0.0518779f, -0.384929f, 0.12906f),
+	float4(-0.251841f, -0.0416032f, 0.0537518f, -0.0521957f), float4(-0.10028f, 1.19805f, 0.177892f, -0.179996f),
+	float4(0.102536f, -0.0598015f, 0.389218f, -0.0626333f), float4(0.0426483f, -0.313189f, 0.0423302f, 0.104338f),
+	float4(0.0973095f, -0.251457f, -0.180421f, -0.360606f), float4(0.971055f, 0.738323f, -0.420679f, 0.107248f),
+	float4(-0.135017f, 0.405743f, 0.258646f, -0.136287f), float4(-0.328096f, -0.183821f, 0.104816f, 0.10495f),
+	float4(0.104788f, -0.104641f, -0.326121f, 0.125779f), float4(-0.338648f, 0.402524f, 1.2803f, -0.326121f),
+	float4(-0.142256f, 0.150698f, 0.402524f, 0.119197f), float4(-0.142256f, -0.338648f, 0.104788f, 0.125779f),
+	float4(-0.0188358f, 0.0187779f, -0.273851f, -0.0226046f), float4(0.0608853f, -0.0722314f, 0.0289943f, 1.09432f),
+	float4(0.0284446f, -0.0309214f, 0.0385945f, 0.386282f), float4(0.0216602f, -0.0318471f, -0.314381f, 0.11447f),
+	float4(0.091607f, -0.36597f, 0.0284094f, -0.0221688f), float4(0.628169f, -0.0440001f, 0.0308969f, 0.921783f),
+	float4(0.0733414f, -0.0729346f, 0.0590283f, -0.0193146f), float4(-0.331837f, -0.0310079f, 0.0264367f, 0.0431814f),
+	float4(0.109237f, -0.428078f, -0.137195f, -0.185016f), float4(0.749757f, 0.263298f, -0.186867f, -0.246645f),
+	float4(0.959575f, 0.404382f, -0.327698f, 0.107185f), float4(0.126493f, -0.375759f, -0.162275f, 0.106031f),
+	float4(0.0806536f, 0.144668f, -0.242915f, -0.313808f), float4(0.123247f, -0.242915f, 0.375714f, 0.541603f),
+	float4(-0.176949f, -0.313808f, 0.541603f, 0.952774f), float4(-0.311641f, 0.123247f, -0.176949f, -0.311641f),
+	float4(0.109365f, 0.0558866f, -0.0819009f, -0.388525f), float4(0.0565209f, -0.0874822f, 0.122786f, 0.664169f),
+	float4(-0.0595208f, 0.0697529f, -0.120748f, 0.0531479f), float4(1.03304f, -0.112004f, -0.348019f, 0.056219f),
+	float4(0.0761456f, -0.369204f, -0.0702826f, -0.0577161f), float4(0.691487f, 0.124117f, -0.092148f, 0.057707f),
+	float4(-0.113871f, 1.0109f, 0.05277f, -0.117687f), float4(0.069135f, -0.339864f, 0.0539912f, 0.055359f),
+	float4(0.0821913f, 0.117159f, -0.317086f, -0.239819f), float4(0.140305f, -0.185475f, 0.540299f, 0.378483f),
+	float4(-0.239819f, -0.304489f, 0.953001f, 0.540299f), float4(-0.317086f, -0.304489f, -0.185475f, 0.117159f),
+	float4(0.107248f, 0.104816f, -0.136287f, -0.420679f), float4(-0.183821f, 0.258646f, 0.738323f, -0.180421f),
+	float4(0.10495f, -0.328096f, 0.405743f, 0.971055f), float4(-0.251457f, -0.135017f, -0.360606f, 0.0973095f),
+	float4(0.0917112f, -0.0219359f, 0.0281122f, -0.366417f), float4(0.0299615f, -0.0427764f, 0.628863f, -0.0188913f),
+	float4(0.0592261f, -0.0732825f, 0.0697199f, 0.921532f), float4(0.0170812f, -0.0218024f, -0.335685f, 0.0438078f),
+	float4(-0.0237149f, 0.0947049f, -0.163113f, 0.0153434f), float4(0.0159375f, 0.136615f, -0.021812f, 1.09772f),
+	float4(0.064091f, -0.0914943f, 0.0736861f, -0.0248443f), float4(-0.144248f, -0.0361622f, 0.044183f, -0.0258722f),
+	float4(0.124359f, -0.217801f, -0.0763929f, 0.0518779f), float4(-0.0577765f, 0.215684f, -0.349322f, 1.25005f),
+	float4(0.477888f, -0.384929f, 0.12906f, 0.0943915f), float4(-0.225281f, -0.0471698f, -0.0499092f, 0.0507789f),
+	float4(0.0565209f, 0.0697529f, 0.0558866f, -0.0874822f), float4(-0.120748f, -0.0819009f, 0.122786f, 0.0531479f),
+	float4(0.109365f, -0.388525f, 0.664169f, 1.03304f), float4(-0.348019f, 0.056219f, -0.0595208f, -0.112004f),
+	float4(0.104348f, -0.0575362f, -0.180228f, -0.0575362f), float4(0.0805896f, 0.13598f, 0.104348f, -0.180228f),
+	float4(0.13598f, 1.3032f, -0.217788f, 0.0617497f), float4(-0.217788f, 0.0715162f, -0.0470148f, 0.0617497f),
+	float4(0.0992313f, -0.187281f, -0.0586278f, 0.141884f), float4(0.0807989f, -0.0586278f, 0.0592631f, -0.218499f),
+	float4(1.29937f, 0.141884f, -0.187281f, 0.0992313f), float4(0.0710872f, -0.218499f, -0.0450238f, 0.0592631f),
+	float4(0.069135f, 0.057707f, 0.0539912f, -0.117687f), float4(-0.092148f, 0.05277f, 0.124117f, -0.0702826f),
+	float4(0.055359f, -0.339864f, 1.0109f, 0.691487f), float4(-0.369204f, 0.0761456f, -0.113871f, -0.0577161f),
+	float4(0.102536f, 0.0423302f, -0.0626333f, -0.179996f), float4(0.177892f, -0.0416032f, 0.104338f, -0.313189f),
+	float4(0.389218f, 1.19805f, -0.251841f, 0.0426483f), float4(-0.0598015f, -0.10028f, -0.0521957f, 0.0537518f),
+	float4(-0.0240379f, 0.0960351f, -0.164874f, 0.13691f), float4(-0.0147184f, 0.0461963f, -0.0580931f, 0.0354687f),
+	float4(1.10739f, -0.0213478f, 0.0276145f, -0.0189245f), float4(-0.142867f, -0.0371055f, 0.0437743f, -0.0252842f),
+	float4(-0.0252842f, 0.0437743f, -0.0371055f, -0.142867f), float4(-0.0189245f, 0.0276145f, -0.0213478f, 1.10739f),
+	float4(0.0354687f, -0.0580931f, 0.0461963f, -0.0147184f), float4(0.13691f, -0.164874f, 0.0960351f, -0.0240379f),
+	float4(0.0537518f, -0.0521957f, -0.10028f, -0.0598015f), float4(0.0426483f, -0.251841f, 1.19805f, 0.389218f),
+	float4(-0.313189f, 0.104338f, -0.0416032f, 0.177892f), float4(-0.179996f, -0.0626333f, 0.0423302f, 0.102536f),
+	float4(-0.0577161f, -0.113871f, 0.0761456f, -0.369204f), float4(0.691487f, 1.0109f, -0.339864f, 0.055359f),
+	float4(-0.0702826f, 0.124117f, 0.05277f, -0.092148f), float4(-0.117687f, 0.0539912f, 0.057707f, 0.069135f),
+	float4(0.0592631f, -0.0450238f, -0.218499f, 0.0710872f), float4(0.0992313f, -0.187281f, 0.141884f, 1.29937f),
+	float4(-0.218499f, 0.0592631f, -0.0586278f, 0.0807989f), float4(0.141884f, -0.0586278f, -0.187281f, 0.0992313f),
+	float4(0.0617497f, -0.0470148f, 0.0715162f, -0.217788f), float4(0.0617497f, -0.217788f, 1.3032f, 0.13598f),
+	float4(-0.180228f, 0.104348f, 0.13598f, 0.0805896f), float4(-0.0575362f, -0.180228f, -0.0575362f, 0.104348f),
+	float4(-0.112004f, -0.0595208f, 0.056219f, -0.348019f), float4(1.03304f, 0.664169f, -0.388525f, 0.109365f),
+	float4(0.0531479f, 0.122786f, -0.0819009f, -0.120748f), float4(-0.0874822f, 0.0558866f, 0.0697529f, 0.0565209f),
+	float4(0.0507789f, -0.0499092f, -0.0471698f, -0.225281f), float4(0.0943915f, 0.12906f, -0.384929f, 0.477888f),
+	float4(1.25005f, -0.349322f, 0.215684f, -0.0577765f), float4(0.0518779f, -0.0763929f, -0.217801f, 0.124359f),
+	float4(-0.0258722f, 0.044183f, -0.0361622f, -0.144248f), float4(-0.0248443f, 0.0736861f, -0.0914943f, 0.064091f),
+	float4(1.09772f, -0.021812f, 0.136615f, 0.0159375f), float4(0.0153434f, -0.163113f, 0.0947049f, -0.0237149f),
+	float4(0.0438078f, -0.335685f, -0.0218024f, 0.0170812f), float4(0.921532f, 0.0697199f, -0.0732825f, 0.0592261f),
+	float4(-0.0188913f, 0.628863f, -0.0427764f, 0.0299615f), float4(-0.366417f, 0.0281122f, -0.0219359f, 0.0917112f),
+	float4(0.0973095f, -0.360606f, -0.135017f, -0.251457f), float4(0.971055f, 0.405743f, -0.328096f, 0.10495f),
+	float4(-0.180421f, 0.738323f, 0.258646f, -0.183821f), float4(-0.420679f, -0.136287f, 0.104816f, 0.107248f),
+	float4(0.117159f, -0.185475f, -0.304489f, 0.0821913f), float4(-0.317086f, 0.540299f, 0.953001f, -0.304489f),
+	float4(-0.239819f, 0.378483f, 0.540299f, -0.185475f), float4(0.140305f, -0.239819f, -0.317086f, 0.117159f),
+	float4(0.055359f, 0.0539912f, -0.339864f, 0.069135f), float4(-0.117687f, 0.05277f, 1.0109f, -0.113871f),
+	float4(0.057707f, -0.092148f, 0.124117f, 0.691487f), float4(-0.0577161f, -0.0702826f, -0.369204f, 0.0761456f),
+	float4(0.056219f, -0.348019f, -0.112004f, 1.03304f), float4(0.0531479f, -0.120748f, 0.0697529f, -0.0595208f),
+	float4(0.664169f, 0.122786f, -0.0874822f, 0.0565209f), float4(-0.388525f, -0.0819009f, 0.0558866f, 0.109365f),
+	float4(-0.311641f, -0.176949f, 0.123247f, -0.311641f), float4(0.952774f, 0.541603f, -0.313808f, -0.176949f),
+	float4(0.541603f, 0.375714f, -0.242915f, 0.123247f), float4(-0.313808f, -0.242915f, 0.144668f, 0.0806536f),
+	float4(0.106031f, -0.162275f, -0.375759f, 0.126493f), float4(0.107185f, -0.327698f, 0.404382f, 0.959575f),
+	float4(-0.246645f, -0.186867f, 0.263298f, 0.749757f), float4(-0.185016f, -0.137195f, -0.428078f, 0.109237f),
+	float4(0.0431814f, 0.0264367f, -0.0310079f, -0.331837f), float4(-0.0193146f, 0.0590283f, -0.0729346f, 0.0733414f),
+	float4(0.921783f, 0.0308969f, -0.0440001f, 0.628169f), float4(-0.0221688f, 0.0284094f, -0.36597f, 0.091607f),
+	float4(0.11447f, -0.314381f, -0.0318471f, 0.0216602f), float4(0.386282f, 0.0385945f, -0.0309214f, 0.0284446f),
+	float4(1.09432f, 0.0289943f, -0.0722314f, 0.0608853f), float4(-0.0226046f, -0.273851f, 0.0187779f, -0.0188358f),
+	float4(0.125779f, 0.104788f, -0.338648f, -0.142256f), float4(0.119197f, 0.402524f, 0.150698f, -0.142256f),
+	float4(-0.326121f, 1.2803f, 0.402524f, -0.338648f), float4(0.125779f, -0.326121f, -0.104641f, 0.104788f),
+	float4(0.10495f, 0.104816f, -0.183821f, -0.328096f), float4(-0.136287f, 0.258646f, 0.405743f, -0.135017f),
+	float4(0.107248f, -0.420679f, 0.738323f, 0.971055f), float4(-0.360606f, -0.180421f, -0.251457f, 0.0973095f),
+	float4(0.104338f, 0.0423302f, -0.313189f, 0.0426483f), float4(-0.0626333f, 0.389218f, -0.0598015f, 0.102536f),
+	float4(-0.179996f, 0.177892f, 1.19805f, -0.10028f), float4(-0.0521957f, 0.0537518f, -0.0416032f, -0.251841f),
+	float4(0.12906f, -0.384929f, 0.0518779f, -0.0471698f), float4(0.477888f, -0.0763929f, 0.0507789f, -0.0499092f),
+	float4(-0.225281f, 1.25005f, 0.215684f, -0.217801f), float4(0.124359f, 0.0943915f, -0.349322f, -0.0577765f),
+	float4(0.107185f, 0.106031f, -0.327698f, -0.186867f), float4(-0.162275f, 0.404382f, 0.263298f, -0.137195f),
+	float4(-0.375759f, 0.959575f, 0.749757f, -0.428078f), float4(0.109237f, 0.126493f, -0.246645f, -0.185016f),
+	float4(0.131172f, 0.118939f, -0.140845f, -0.33509f), float4(0.103272f, -0.140845f, 0.147727f, 0.399148f),
+	float4(0.131172f, -0.33509f, 0.399148f, 1.28504f), float4(-0.32757f, 0.103272f, -0.103225f, -0.32757f),
+	float4(0.112928f, 0.021385f, -0.0329026f, -0.314535f), float4(0.0280895f, -0.0303017f, 0.0396432f, 0.38659f),
+	float4(-0.0235957f, 0.0602984f, -0.0716611f, 0.0278883f), float4(1.09424f, -0.0185795f, 0.0185335f, -0.273844f),
+	float4(-0.0202238f, 0.0555396f, 0.00542175f, -0.00441191f), float4(-0.0682225f, -0.00659944f, 0.00622041f, 0.0395815f),
+	float4(0.00525924f, -0.00659944f, 0.00542175f, 0.979881f), float4(0.0395815f, -0.0682225f, 0.0555396f, -0.0202238f),
+	float4(-0.0226046f, -0.0188358f, 0.0608853f, 0.0284446f), float4(0.0187779f, -0.0722314f, -0.0309214f, 0.0216602f),
+	float4(0.0289943f, 0.0385945f, -0.0318471f, -0.273851f), float4(1.09432f, 0.386282f, -0.314381f, 0.11447f),
+	float4(-0.0188913f, -0.0219359f, 0.0299615f, 0.0592261f), float4(0.0281122f, -0.0427764f, -0.0732825f, 0.0170812f),
+	float4(0.0697199f, -0.0218024f, 0.0917112f, -0.366417f), float4(0.628863f, 0.921532f, -0.335685f, 0.0438078f),
+	float4(-0.0147184f, 0.0461963f, -0.0213478f, -0.0580931f), float4(0.0276145f, 0.0354687f, -0.0189245f, -0.0240379f),
+	float4(0.0960351f, -0.164874f, 0.13691f, 1.10739f), float4(-0.142867f, -0.0371055f, 0.0437743f, -0.0252842f),
+	float4(-0.0248443f, 0.0736861f, -0.0914943f, 0.0159375f), float4(0.064091f, -0.021812f, 0.0153434f, -0.0258722f),
+	float4(0.044183f, -0.0361622f, -0.144248f, 1.09772f), float4(0.136615f, -0.163113f, 0.0947049f, -0.0237149f),
+	float4(-0.0193146f, 0.0590283f, 0.0308969f, -0.0221688f), float4(0.0264367f, -0.0729346f, -0.0440001f, 0.0284094f),
+	float4(-0.0310079f, 0.0733414f, 0.0431814f, -0.331837f), float4(0.921783f, 0.628169f, -0.36597f, 0.091607f),
+	float4(-0.0235957f, 0.0280895f, 0.0602984f, -0.0185795f), float4(0.021385f, -0.0303017f, -0.0716611f, 0.0185335f),
+	float4(-0.0329026f, 0.0396432f, 0.0278883f, 0.112928f), float4(-0.314535f, 0.38659f, 1.09424f, -0.273844f),
+	float4(-0.0199585f, 0.00560077f, 0.0555689f, -0.0043446f), float4(0.00609422f, -0.00678f, -0.0682778f, 0.00560077f),
+	float4(-0.00678f, 0.00550193f, 0.0395832f, -0.0199585f), float4(0.0555689f, -0.0682778f, 0.0395832f, 0.979865f),
+};
+
+#define WEIGHT_GRID_COUNT_12X10 4
+#define MAX_GRID_WEIGHTS_12X10 64
+static const uint4 weight_grids_12x10[WEIGHT_GRID_COUNT_12X10] = { uint4(4, 4, 0, 0), uint4(5, 5, 16, 120), uint4(6, 6, 41, 240), uint4(8, 8, 77, 360) };
+static const uint4 decimation_idx_12x10[141] =
+{
+	uint4(0, 1, 12, 13), uint4(3, 4, 15, 16), uint4(7, 8, 19, 20), uint4(11, 11, 23, 23),
+	uint4(36, 37, 48, 49), uint4(39, 40, 51, 52), uint4(43, 44, 55, 56), uint4(47, 47, 59, 59),
+	uint4(72, 73, 84, 85), uint4(75, 76, 87, 88), uint4(79, 80, 91, 92), uint4(83, 83, 95, 95),
+	uint4(108, 109, 108, 109), uint4(111, 112, 111, 112), uint4(115, 116, 115, 116), uint4(119, 119, 119, 119),
+	uint4(0, 1, 12, 13), uint4(2, 3, 14, 15), uint4(5, 6, 17, 18), uint4(8, 9, 20, 21),
+	uint4(11, 11, 23, 23), uint4(24, 25, 36, 37), uint4(26, 27, 38, 39), uint4(29, 30, 41, 42),
+	uint4(32, 33, 44, 45), uint4(35, 35, 47, 47), uint4(48, 49, 60, 61), uint4(50, 51, 62, 63),
+	uint4(53, 54, 65, 66), uint4(56, 57, 68, 69), uint4(59, 59, 71, 71), uint4(72, 73, 84, 85),
+	uint4(74, 75, 86, 87), uint4(77, 78, 89, 90), uint4(80, 81, 92, 93), uint4(83, 83, 95, 95),
+	uint4(108, 109, 108, 109), uint4(110, 111, 110, 111), uint4(113, 114, 113, 114), uint4(116, 117, 116, 117),
+	uint4(119, 119, 119, 119), uint4(0, 1, 12, 13), uint4(2, 3, 14, 15), uint4(4, 5, 16, 17),
+	uint4(6, 7, 18, 19), uint4(8, 9, 20, 21), uint4(11, 11, 23, 23), uint4(12, 13, 24, 25),
+	uint4(14, 15, 26, 27), uint4(16, 17, 28, 29), uint4(18, 19, 30, 31), uint4(20, 21, 32, 33),
+	uint4(23, 23, 35, 35), uint4(36, 37, 48, 49), uint4(38, 39, 50, 51), uint4(40, 41, 52, 53),
+	uint4(42, 43, 54, 55), uint4(44, 45, 56, 57), uint4(47, 47, 59, 59), uint4(60, 61, 72, 73),
+	uint4(62, 63, 74, 75), uint4(64, 65, 76, 77), uint4(66, 67, 78, 79), uint4(68, 69, 80, 81),
+	uint4(71, 71, 83, 83), uint4(84, 85, 96, 97), uint4(86, 87, 98, 99), uint4(88, 89, 100, 101),
+	uint4(90, 91, 102, 103), uint4(92, 93, 104, 105), uint4(95, 95, 107, 107), uint4(108, 109, 108, 109),
+	uint4(110, 111, 110, 111), uint4(112, 113, 112, 113), uint4(114, 115, 114, 115), uint4(116, 117, 116, 117),
+	uint4(119, 119, 119, 119), uint4(0, 1, 12, 13), uint4(1, 2, 13, 14), uint4(3, 4, 15, 16),
+	uint4(4, 5, 16, 17), uint4(6, 7, 18, 19), uint4(7, 8, 19, 20), uint4(9, 10, 21, 22),
+	uint4(11, 11, 23, 23), uint4(12, 13, 24, 25), uint4(13, 14, 25, 26), uint4(15, 16, 27, 28),
+	uint4(16, 17, 28, 29), uint4(18, 19, 30, 31), uint4(19, 20, 31, 32), uint4(21, 22, 33, 34),
+	uint4(23, 23, 35, 35), uint4(24, 25, 36, 37), uint4(25, 26, 37, 38), uint4(27, 28, 39, 40),
+	uint4(28, 29, 40, 41), uint4(30, 31, 42, 43), uint4(31, 32, 43, 44), uint4(33, 34, 45, 46),
+	uint4(35, 35, 47, 47), uint4(36, 37, 48, 49), uint4(37, 38, 49, 50), uint4(39, 40, 51, 52),
+	uint4(40, 41, 52, 53), uint4(42, 43, 54, 55), uint4(43, 44, 55, 56), uint4(45, 46, 57, 58),
+	uint4(47, 47, 59, 59), uint4(60, 61, 72, 73), uint4(61, 62, 73, 74), uint4(63, 64, 75, 76),
+	uint4(64, 65, 76, 77), uint4(66, 67, 78, 79), uint4(67, 68, 79, 80), uint4(69, 70, 81, 82),
+	uint4(71, 71, 83, 83), uint4(72, 73, 84, 85), uint4(73, 74, 85, 86), uint4(75, 76, 87, 88),
+	uint4(76, 77, 88, 89), uint4(78, 79, 90, 91), uint4(79, 80, 91, 92), uint4(81, 82, 93, 94),
+	uint4(83, 83, 95, 95), uint4(84, 85, 96, 97), uint4(85, 86, 97, 98), uint4(87, 88, 99, 100),
+	uint4(88, 89, 100, 101), uint4(90, 91, 102, 103), uint4(91, 92, 103, 104), uint4(93, 94, 105, 106),
+	uint4(95, 95, 107, 107), uint4(108, 109, 108, 109), uint4(109, 110, 109, 110), uint4(111, 112, 111, 112),
+	uint4(112, 113, 112, 113), uint4(114, 115, 114, 115), uint4(115, 116, 115, 116), uint4(117, 118, 117, 118),
+	uint4(119, 119, 119, 119),
+};
+static const float4 decimation_wt_12x10[141] =
+{
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.333333254f, 0.666666746f, 0.0f, 0.0f),
+	float4(0.666666508f, 0.333333492f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.333333254f, 0.666666746f, 0.0f, 0.0f),
+	float4(0.666666508f, 0.333333492f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.333333254f, 0.666666746f, 0.0f, 0.0f),
+	float4(0.666666508f, 0.333333492f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.333333254f, 0.666666746f, 0.0f, 0.0f),
+	float4(0.666666508f, 0.333333492f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.25f, 0.75f, 0.0f, 0.0f),
+	float4(0.5f, 0.5f, 0.0f, 0.0f), float4(0.75f, 0.25f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.75f, 0.0f, 0.25f, 0.0f),
+	float4(0.1875f, 0.5625f, 0.0625f, 0.1875f), float4(0.375f, 0.375f, 0.125f, 0.125f),
+	float4(0.5625f, 0.1875f, 0.1875f, 0.0625f), float4(0.75f, 0.0f, 0.25f, 0.0f),
+	float4(0.5f, 0.0f, 0.5f, 0.0f), float4(0.125f, 0.375f, 0.125f, 0.375f),
+	float4(0.25f, 0.25f, 0.25f, 0.25f), float4(0.375f, 0.125f, 0.375f, 0.125f),
+	float4(0.5f, 0.0f, 0.5f, 0.0f), float4(0.25f, 0.0f, 0.75f, 0.0f),
+	float4(0.0625f, 0.1875f, 0.1875f, 0.5625f), float4(0.125f, 0.125f, 0.375f, 0.375f),
+	float4(0.1875f, 0.0625f, 0.5625f, 0.1875f), float4(0.25f, 0.0f, 0.75f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.25f, 0.75f, 0.0f, 0.0f),
+	float4(0.5f, 0.5f, 0.0f, 0.0f), float4(0.75f, 0.25f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.799999952f, 0.200000048f, 0.0f, 0.0f), float4(0.599999905f, 0.400000095f, 0.0f, 0.0f),
+	float4(0.400000095f, 0.599999905f, 0.0f, 0.0f), float4(0.199999809f, 0.800000191f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.200000048f, 0.0f, 0.799999952f, 0.0f),
+	float4(0.160000026f, 0.0400000177f, 0.639999926f, 0.160000026f), float4(0.120000012f, 0.0800000355f, 0.4799999f, 0.320000052f),
+	float4(0.0800000355f, 0.120000012f, 0.320000052f, 0.4799999f), float4(0.039999973f, 0.160000071f, 0.159999833f, 0.640000105f),
+	float4(0.200000048f, 0.0f, 0.799999952f, 0.0f), float4(0.400000095f, 0.0f, 0.599999905f, 0.0f),
+	float4(0.320000052f, 0.0800000355f, 0.4799999f, 0.120000012f), float4(0.240000024f, 0.160000071f, 0.359999895f, 0.240000024f),
+	float4(0.160000071f, 0.240000024f, 0.240000024f, 0.359999895f), float4(0.0799999461f, 0.320000142f, 0.119999863f, 0.480000049f),
+	float4(0.400000095f, 0.0f, 0.599999905f, 0.0f), float4(0.599999905f, 0.0f, 0.400000095f, 0.0f),
+	float4(0.4799999f, 0.120000012f, 0.320000052f, 0.0800000355f), float4(0.359999895f, 0.240000024f, 0.240000024f, 0.160000071f),
+	float4(0.240000024f, 0.359999895f, 0.160000071f, 0.240000024f), float4(0.119999863f, 0.480000049f, 0.0799999461f, 0.320000142f),
+	float4(0.599999905f, 0.0f, 0.400000095f, 0.0f), float4(0.800000191f, 0.0f, 0.199999809f, 0.0f),
+	float4(0.640000105f, 0.160000071f, 0.159999833f, 0.039999973f), float4(0.480000049f, 0.320000142f, 0.119999863f, 0.0799999461f),
+	float4(0.320000142f, 0.480000049f, 0.0799999461f, 0.119999863f), float4(0.159999892f, 0.640000284f, 0.0399999246f, 0.159999892f),
+	float4(0.800000191f, 0.0f, 0.199999809f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.799999952f, 0.200000048f, 0.0f, 0.0f), float4(0.599999905f, 0.400000095f, 0.0f, 0.0f),
+	float4(0.400000095f, 0.599999905f, 0.0f, 0.0f), float4(0.199999809f, 0.800000191f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.428571463f, 0.571428537f, 0.0f, 0.0f), float4(0.857142925f, 0.142857075f, 0.0f, 0.0f),
+	float4(0.285714149f, 0.714285851f, 0.0f, 0.0f), float4(0.714285851f, 0.285714149f, 0.0f, 0.0f),
+	float4(0.142857075f, 0.857142925f, 0.0f, 0.0f), float4(0.571428299f, 0.428571701f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.714285731f, 0.0f, 0.285714269f, 0.0f),
+	float4(0.306122482f, 0.408163249f, 0.122448981f, 0.163265288f), float4(0.612244964f, 0.102040768f, 0.244897962f, 0.0408163033f),
+	float4(0.204081535f, 0.510204196f, 0.0816326067f, 0.204081655f), float4(0.510204196f, 0.204081535f, 0.204081655f, 0.0816326067f),
+	float4(0.102040768f, 0.612244964f, 0.0408163033f, 0.244897962f), float4(0.408163071f, 0.306122661f, 0.163265213f, 0.122449048f),
+	float4(0.714285731f, 0.0f, 0.285714269f, 0.0f), float4(0.428571463f, 0.0f, 0.571428537f, 0.0f),
+	float4(0.183673501f, 0.244897962f, 0.244897962f, 0.326530576f), float4(0.367347002f, 0.0612244643f, 0.489795923f, 0.0816326067f),
+	float4(0.122448929f, 0.306122541f, 0.163265213f, 0.408163309f), float4(0.306122541f, 0.122448929f, 0.408163309f, 0.163265213f),
+	float4(0.0612244643f, 0.367347002f, 0.0816326067f, 0.489795923f), float4(0.244897857f, 0.183673605f, 0.326530427f, 0.244898096f),
+	float4(0.428571463f, 0.0f, 0.571428537f, 0.0f), float4(0.142857075f, 0.0f, 0.857142925f, 0.0f),
+	float4(0.0612244643f, 0.0816326067f, 0.367347002f, 0.489795923f), float4(0.122448929f, 0.0204081442f, 0.734694004f, 0.122448929f),
+	float4(0.0408162884f, 0.10204079f, 0.244897857f, 0.612245083f), float4(0.10204079f, 0.0408162884f, 0.612245083f, 0.244897857f),
+	float4(0.0204081442f, 0.122448929f, 0.122448929f, 0.734694004f), float4(0.0816325769f, 0.0612244979f, 0.489795715f, 0.367347211f),
+	float4(0.142857075f, 0.0f, 0.857142925f, 0.0f), float4(0.857142925f, 0.0f, 0.142857075f, 0.0f),
+	float4(0.367347002f, 0.489795923f, 0.0612244643f, 0.0816326067f), float4(0.734694004f, 0.122448929f, 0.122448929f, 0.0204081442f),
+	float4(0.244897857f, 0.612245083f, 0.0408162884f, 0.10204079f), float4(0.612245083f, 0.244897857f, 0.10204079f, 0.0408162884f),
+	float4(0.122448929f, 0.734694004f, 0.0204081442f, 0.122448929f), float4(0.489795715f, 0.367347211f, 0.0816325769f, 0.0612244979f),
+	float4(0.857142925f, 0.0f, 0.142857075f, 0.0f), float4(0.571428776f, 0.0f, 0.428571224f, 0.0f),
+	float4(0.244898066f, 0.326530695f, 0.183673397f, 0.244897828f), float4(0.489796132f, 0.0816326439f, 0.367346793f, 0.0612244308f),
+	float4(0.163265288f, 0.408163488f, 0.122448862f, 0.306122363f), float4(0.408163488f, 0.163265288f, 0.306122363f, 0.122448862f),
+	float4(0.0816326439f, 0.489796132f, 0.0612244308f, 0.367346793f), float4(0.326530576f, 0.2448982f, 0.244897723f, 0.183673501f),
+	float4(0.571428776f, 0.0f, 0.428571224f, 0.0f), float4(0.285714149f, 0.0f, 0.714285851f, 0.0f),
+	float4(0.122448929f, 0.163265213f, 0.306122541f, 0.408163309f), float4(0.244897857f, 0.0408162884f, 0.612245083f, 0.10204079f),
+	float4(0.0816325769f, 0.20408158f, 0.20408158f, 0.510204256f), float4(0.20408158f, 0.0816325769f, 0.510204256f, 0.20408158f),
+	float4(0.0408162884f, 0.244897857f, 0.10204079f, 0.612245083f), float4(0.163265154f, 0.122448996f, 0.40816316f, 0.30612269f),
+	float4(0.285714149f, 0.0f, 0.714285851f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.428571463f, 0.571428537f, 0.0f, 0.0f), float4(0.857142925f, 0.142857075f, 0.0f, 0.0f),
+	float4(0.285714149f, 0.714285851f, 0.0f, 0.0f), float4(0.714285851f, 0.285714149f, 0.0f, 0.0f),
+	float4(0.142857075f, 0.857142925f, 0.0f, 0.0f), float4(0.571428299f, 0.428571701f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f),
+};
+static const uint4 infill_idx_12x10[480] =
+{
+	uint4(0, 0, 0, 0), uint4(0, 1, 0, 0), uint4(0, 1, 0, 0), uint4(0, 1, 0, 0),
+	uint4(1, 2, 1, 1), uint4(1, 2, 1, 1), uint4(1, 2, 1, 1), uint4(1, 2, 1, 1),
+	uint4(2, 3, 2, 2), uint4(2, 3, 2, 2), uint4(2, 3, 2, 2), uint4(3, 3, 3, 3),
+	uint4(0, 0, 4, 0), uint4(0, 1, 4, 5), uint4(0, 1, 4, 5), uint4(0, 1, 4, 5),
+	uint4(1, 2, 5, 1), uint4(1, 2, 5, 6), uint4(1, 2, 5, 6), uint4(1, 2, 1, 6),
+	uint4(2, 3, 6, 7), uint4(2, 3, 6, 7), uint4(2, 3, 6, 7), uint4(3, 3, 7, 3),
+	uint4(0, 0, 4, 0), uint4(0, 1, 4, 5), uint4(0, 1, 4, 5), uint4(0, 1, 4, 5),
+	uint4(1, 1, 5, 6), uint4(1, 2, 5, 6), uint4(1, 2, 5, 6), uint4(1, 2, 5, 6),
+	uint4(2, 3, 6, 7), uint4(2, 3, 6, 7), uint4(2, 3, 6, 7), uint4(3, 3, 7, 3),
+	uint4(4, 4, 4, 4), uint4(4, 5, 4, 4), uint4(4, 5, 4, 4), uint4(4, 5, 4, 4),
+	uint4(5, 6, 5, 5), uint4(5, 6, 5, 5), uint4(5, 6, 5, 5), uint4(5, 6, 5, 5),
+	uint4(6, 7, 6, 6), uint4(6, 7, 6, 6), uint4(6, 7, 6, 6), uint4(7, 7, 7, 7),
+	uint4(4, 4, 8, 4), uint4(4, 5, 8, 9), uint4(4, 5, 8, 9), uint4(4, 5, 8, 9),
+	uint4(5, 6, 9, 5), uint4(5, 6, 9, 10), uint4(5, 6, 9, 10), uint4(5, 6, 5, 10),
+	uint4(6, 7, 10, 11), uint4(6, 7, 10, 11), uint4(6, 7, 10, 11), uint4(7, 7, 11, 7),
+	uint4(4, 4, 8, 4), uint4(4, 5, 8, 9), uint4(4, 5, 8, 9), uint4(4, 5, 8, 9),
+	uint4(5, 5, 9, 10), uint4(5, 6, 9, 10), uint4(5, 6, 9, 10), uint4(5, 6, 9, 10),
+	uint4(6, 7, 10, 11), uint4(6, 7, 10, 11), uint4(6, 7, 10, 11), uint4(7, 7, 11, 7),
+	uint4(8, 8, 8, 8), uint4(8, 9, 8, 8), uint4(8, 9, 8, 8), uint4(8, 9, 8, 8),
+	uint4(9, 10, 9, 9), uint4(9, 10, 9, 9), uint4(9, 10, 9, 9), uint4(9, 10, 9, 9),
+	uint4(10, 11, 10, 10), uint4(10, 11, 10, 10), uint4(10, 11, 10, 10), uint4(11, 11, 11, 11),
+	uint4(8, 8, 12, 8), uint4(8, 9, 12, 13), uint4(8, 9, 12, 13), uint4(8, 9, 12, 13),
+	uint4(9, 10, 13, 9), uint4(9, 10, 13, 14), uint4(9, 10, 13, 14), uint4(9, 10, 9, 14),
+	uint4(10, 11, 14, 15), uint4(10, 11, 14, 15), uint4(10, 11, 14, 15), uint4(11, 11, 15, 11),
+	uint4(8, 8, 12, 8), uint4(8, 9, 12, 13), uint4(8, 9, 12, 13), uint4(8, 9, 12, 13),
+	uint4(9, 9, 13, 14), uint4(9, 10, 13, 14), uint4(9, 10, 13, 14), uint4(9, 10, 13, 14),
+	uint4(10, 11, 14, 15), uint4(10, 11, 14, 15), uint4(10, 11, 14, 15), uint4(11, 11, 15, 11),
+	uint4(12, 12, 12, 12), uint4(12, 13, 12, 12), uint4(12, 13, 12, 12), uint4(12, 13, 12, 12),
+	uint4(13, 14, 13, 13), uint4(13, 14, 13, 13), uint4(13, 14, 13, 13), uint4(13, 14, 13, 13),
+	uint4(14, 15, 14, 14), uint4(14, 15, 14, 14), uint4(14, 15, 14, 14), uint4(15, 15, 15, 15),
+	uint4(0, 0, 0, 0), uint4(0, 1, 0, 0), uint4(0, 1, 0, 0), uint4(1, 2, 1, 1),
+	uint4(1, 2, 1, 1), uint4(1, 2, 1, 1), uint4(2, 3, 2, 2), uint4(2, 3, 2, 2),
+	uint4(2, 3, 2, 2), uint4(3, 4, 3, 3), uint4(3, 4, 3, 3), uint4(4, 4, 4, 4),
+	uint4(0, 0, 5, 0), uint4(0, 1, 5, 6), uint4(0, 1, 5, 6), uint4(1, 2, 6, 1),
+	uint4(1, 2, 6, 7), uint4(1, 2, 6, 7), uint4(2, 3, 7, 8), uint4(2, 3, 7, 8),
+	uint4(2, 3, 2, 8), uint4(3, 4, 8, 9), uint4(3, 4, 8, 9), uint4(4, 4, 9, 4),
+	uint4(0, 0, 5, 0), uint4(0, 1, 5, 6), uint4(0, 1, 5, 6), uint4(1, 1, 6, 7),
+	uint4(1, 2, 6, 7), uint4(1, 2, 6, 7), uint4(2, 2, 7, 8), uint4(2, 3, 7, 8),
+	uint4(2, 3, 7, 8), uint4(3, 3, 8, 9), uint4(3, 4, 8, 9), uint4(4, 4, 9, 4),
+	uint4(5, 5, 10, 5), uint4(5, 6, 10, 11), uint4(5, 6, 10, 11), uint4(6, 7, 11, 6),
+	uint4(6, 7, 11, 12), uint4(6, 7, 11, 12), uint4(7, 8, 12, 13), uint4(7, 8, 12, 13),
+	uint4(7, 8, 7, 13), uint4(8, 9, 13, 14), uint4(8, 9, 13, 14), uint4(9, 9, 14, 9),
+	uint4(5, 5, 10, 5), uint4(5, 6, 10, 11), uint4(5, 6, 10, 11), uint4(6, 6, 11, 12),
+	uint4(6, 7, 11, 12), uint4(6, 7, 11, 12), uint4(7, 8, 12, 13), uint4(7, 8, 12, 13),
+	uint4(7, 8, 12, 13), uint4(8, 9, 13, 14), uint4(8, 9, 13, 14), uint4(9, 9, 14, 9),
+	uint4(10, 10, 15, 10), uint4(10, 11, 15, 16), uint4(10, 11, 15, 16), uint4(11, 12, 16, 11),
+	uint4(11, 12, 16, 17), uint4(11, 12, 16, 17), uint4(12, 13, 17, 18), uint4(12, 13, 17, 18),
+	uint4(12, 13, 12, 18), uint4(13, 14, 18, 19), uint4(13, 14, 18, 19), uint4(14, 14, 19, 14),
+	uint4(10, 10, 15, 10), uint4(10, 11, 15, 16), uint4(10, 11, 15, 16), uint4(11, 11, 16, 17),
+	uint4(11, 12, 16, 17), uint4(11, 12, 16, 17), uint4(12, 13, 17, 18), uint4(12, 13, 17, 18),
+	uint4(12, 13, 17, 18), uint4(13, 14, 18, 19), uint4(13, 14, 18, 19), uint4(14, 14, 19, 14),
+	uint4(15, 15, 20, 15), uint4(15, 16, 20, 21), uint4(15, 16, 15, 21), uint4(16, 17, 21, 16),
+	uint4(16, 17, 21, 22), uint4(16, 17, 16, 22), uint4(17, 18, 22, 17), uint4(17, 18, 22, 23),
+	uint4(17, 18, 17, 23), uint4(18, 19, 23, 24), uint4(18, 19, 23, 24), uint4(19, 19, 24, 19),
+	uint4(15, 15, 20, 15), uint4(15, 16, 20, 21), uint4(15, 16, 20, 21), uint4(16, 16, 21, 22),
+	uint4(16, 17, 21, 22), uint4(16, 17, 21, 22), uint4(17, 18, 22, 23), uint4(17, 18, 22, 23),
+	uint4(17, 18, 22, 23), uint4(18, 19, 23, 24), uint4(18, 19, 23, 24), uint4(19, 19, 24, 19),
+	uint4(20, 20, 20, 20), uint4(20, 21, 20, 20), uint4(20, 21, 20, 20), uint4(21, 22, 21, 21),
+	uint4(21, 22, 21, 21), uint4(21, 22, 21, 21), uint4(22, 23, 22, 22), uint4(22, 23, 22, 22),
+	uint4(22, 23, 22, 22), uint4(23, 24, 23, 23), uint4(23, 24, 23, 23), uint4(24, 24, 24, 24),
+	uint4(0, 0, 0, 0), uint4(0, 1, 0, 0), uint4(0, 1, 0, 0), uint4(1, 2, 1, 1),
+	uint4(1, 2, 1, 1), uint4(2, 3, 2, 2), uint4(2, 3, 2, 2), uint4(3, 4, 3, 3),
+	uint4(3, 4, 3, 3), uint4(4, 5, 4, 4), uint4(4, 5, 4, 4), uint4(5, 5, 5, 5),
+	uint4(0, 0, 6, 0), uint4(0, 1, 6, 7), uint4(0, 1, 6, 7), uint4(1, 2, 7, 8),
+	uint4(1, 2, 7, 8), uint4(2, 3, 8, 9), uint4(2, 3, 8, 9), uint4(3, 4, 9, 10),
+	uint4(3, 4, 9, 10), uint4(4, 4, 10, 11), uint4(4, 5, 10, 11), uint4(5, 5, 11, 5),
+	uint4(6, 6, 12, 6), uint4(6, 7, 12, 13), uint4(6, 7, 6, 13), uint4(7, 8, 13, 14),
+	uint4(7, 8, 7, 14), uint4(8, 9, 14, 15), uint4(8, 9, 8, 15), uint4(9, 10, 15, 9),
+	uint4(9, 10, 15, 16), uint4(10, 11, 16, 10), uint4(10, 11, 16, 17), uint4(11, 11, 17, 11),
+	uint4(6, 6, 12, 6), uint4(6, 7, 12, 13), uint4(6, 7, 12, 13), uint4(7, 8, 13, 14),
+	uint4(7, 8, 13, 14), uint4(8, 9, 14, 15), uint4(8, 9, 14, 15), uint4(9, 10, 15, 16),
+	uint4(9, 10, 15, 16), uint4(10, 10, 16, 17), uint4(10, 11, 16, 17), uint4(11, 11, 17, 11),
+	uint4(12, 12, 18, 12), uint4(12, 13, 18, 19), uint4(12, 13, 12, 19), uint4(13, 14, 19, 20),
+	uint4(13, 14, 19, 20), uint4(14, 15, 20, 21), uint4(14, 15, 20, 21), uint4(15, 16, 21, 22),
+	uint4(15, 16, 21, 22), uint4(16, 17, 22, 16), uint4(16, 17, 22, 23), uint4(17, 17, 23, 17),
+	uint4(12, 12, 18, 12), uint4(12, 13, 18, 19), uint4(12, 13, 18, 19), uint4(13, 14, 19, 20),
+	uint4(13, 14, 19, 20), uint4(14, 15, 20, 21), uint4(14, 15, 20, 21), uint4(15, 16, 21, 22),
+	uint4(15, 16, 21, 22), uint4(16, 16, 22, 23), uint4(16, 17, 22, 23), uint4(17, 17, 23, 17),
+	uint4(18, 18, 24, 18), uint4(18, 19, 24, 25), uint4(18, 19, 18, 25), uint4(19, 20, 25, 26),
+	uint4(19, 20, 25, 26), uint4(20, 21, 26, 27), uint4(20, 21, 26, 27), uint4(21, 22, 27, 28),
+	uint4(21, 22, 27, 28), uint4(22, 23, 28, 22), uint4(22, 23, 28, 29), uint4(23, 23, 29, 23),
+	uint4(18, 18, 24, 18), uint4(18, 19, 24, 25), uint4(18, 19, 24, 25), uint4(19, 20, 25, 26),
+	uint4(19, 20, 25, 26), uint4(20, 20, 26, 27), uint4(20, 21, 26, 27), uint4(21, 21, 27, 28),
+	uint4(21, 22, 27, 28), uint4(22, 22, 28, 29), uint4(22, 23, 28, 29), uint4(23, 23, 29, 23),
+	uint4(24, 24, 30, 24), uint4(24, 25, 30, 31), uint4(24, 25, 24, 31), uint4(25, 26, 31, 32),
+	uint4(25, 26, 31, 32), uint4(26, 27, 32, 33), uint4(26, 27, 32, 33), uint4(27, 28, 33, 34),
+	uint4(27, 28, 33, 34), uint4(28, 29, 34, 28), uint4(28, 29, 34, 35), uint4(29, 29, 35, 29),
+	uint4(30, 30, 30, 30), uint4(30, 31, 30, 30), uint4(30, 31, 30, 30), uint4(31, 32, 31, 31),
+	uint4(31, 32, 31, 31), uint4(32, 33, 32, 32), uint4(32, 33, 32, 32), uint4(33, 34, 33, 33),
+	uint4(33, 34, 33, 33), uint4(34, 35, 34, 34), uint4(34, 35, 34, 34), uint4(35, 35, 35, 35),
+	uint4(0, 0, 0, 0), uint4(0, 1, 0, 0), uint4(1, 2, 1, 1), uint4(1, 2, 1, 1),
+	uint4(2, 3, 2, 2), uint4(3, 4, 3, 3), uint4(3, 4, 3, 3), uint4(4, 5, 4, 4),
+	uint4(5, 6, 5, 5), uint4(5, 6, 5, 5), uint4(6, 7, 6, 6), uint4(7, 7, 7, 7),
+	uint4(0, 0, 8, 0), uint4(0, 1, 8, 9), uint4(1, 2, 9, 10), uint4(1, 2, 9, 10),
+	uint4(2, 3, 10, 11), uint4(3, 4, 11, 12), uint4(3, 4, 11, 12), uint4(4, 5, 12, 13),
+	uint4(5, 5, 13, 14), uint4(5, 6, 13, 14), uint4(6, 7, 14, 15), uint4(7, 7, 15, 7),
+	uint4(8, 8, 16, 8), uint4(8, 9, 16, 17), uint4(9, 10, 17, 18), uint4(9, 10, 17, 18),
+	uint4(10, 11, 18, 19), uint4(11, 12, 19, 20), uint4(11, 12, 19, 20), uint4(12, 13, 20, 21),
+	uint4(13, 13, 21, 22), uint4(13, 14, 21, 22), uint4(14, 15, 22, 23), uint4(15, 15, 23, 15),
+	uint4(16, 16, 24, 16), uint4(16, 17, 24, 25), uint4(17, 18, 25, 26), uint4(17, 18, 17, 26),
+	uint4(18, 19, 26, 27), uint4(19, 20, 27, 28), uint4(19, 20, 27, 28), uint4(20, 21, 28, 29),
+	uint4(21, 22, 29, 21), uint4(21, 22, 29, 30), uint4(22, 23, 30, 31), uint4(23, 23, 31, 23),
+	uint4(24, 24, 32, 24), uint4(24, 25, 32, 33), uint4(25, 26, 33, 34), uint4(25, 26, 25, 34),
+	uint4(26, 27, 34, 35), uint4(27, 28, 35, 27), uint4(27, 28, 27, 36), uint4(28, 29, 36, 37),
+	uint4(29, 30, 37, 29), uint4(29, 30, 29, 38), uint4(30, 31, 38, 39), uint4(31, 31, 39, 31),
+	uint4(24, 24, 32, 24), uint4(24, 25, 32, 33), uint4(25, 25, 33, 34), uint4(25, 26, 33, 34),
+	uint4(26, 27, 34, 35), uint4(27, 27, 35, 36), uint4(27, 28, 35, 36), uint4(28, 29, 36, 37),
+	uint4(29, 29, 37, 38), uint4(29, 30, 37, 38), uint4(30, 31, 38, 39), uint4(31, 31, 39, 31),
+	uint4(32, 32, 40, 32), uint4(32, 33, 40, 41), uint4(33, 34, 41, 42), uint4(33, 34, 41, 42),
+	uint4(34, 35, 42, 43), uint4(35, 36, 43, 44), uint4(35, 36, 43, 44), uint4(36, 37, 44, 45),
+	uint4(37, 37, 45, 46), uint4(37, 38, 45, 46), uint4(38, 39, 46, 47), uint4(39, 39, 47, 39),
+	uint4(40, 40, 48, 40), uint4(40, 41, 48, 49), uint4(41, 42, 49, 50), uint4(41, 42, 41, 50),
+	uint4(42, 43, 50, 51), uint4(43, 44, 51, 52), uint4(43, 44, 51, 52), uint4(44, 45, 52, 53),
+	uint4(45, 46, 53, 45), uint4(45, 46, 53, 54), uint4(46, 47, 54, 55), uint4(47, 47, 55, 47),
+	uint4(48, 48, 56, 48), uint4(48, 49, 56, 57), uint4(49, 50, 57, 58), uint4(49, 50, 49, 58),
+	uint4(50, 51, 58, 59), uint4(51, 52, 59, 60), uint4(51, 52, 59, 60), uint4(52, 53, 60, 61),
+	uint4(53, 54, 61, 53), uint4(53, 54, 61, 62), uint4(54, 55, 62, 63), uint4(55, 55, 63, 55),
+	uint4(56, 56, 56, 56), uint4(56, 57, 56, 56), uint4(57, 58, 57, 57), uint4(57, 58, 57, 57),
+	uint4(58, 59, 58, 58), uint4(59, 60, 59, 59), uint4(59, 60, 59, 59), uint4(60, 61, 60, 60),
+	uint4(61, 62, 61, 61), uint4(61, 62, 61, 61), uint4(62, 63, 62, 62), uint4(63, 63, 63, 63),
+};
+static const float4 infill_wt_12x10[480] =
+{
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.75f, 0.25f, 0.0f, 0.0f), float4(0.4375f, 0.5625f, 0.0f, 0.0f), float4(0.1875f, 0.8125f, 0.0f, 0.0f),
+	float4(0.9375f, 0.0625f, 0.0f, 0.0f), float4(0.625f, 0.375f, 0.0f, 0.0f), float4(0.375f, 0.625f, 0.0f, 0.0f), float4(0.0625f, 0.9375f, 0.0f, 0.0f),
+	float4(0.8125f, 0.1875f, 0.0f, 0.0f), float4(0.5625f, 0.4375f, 0.0f, 0.0f), float4(0.25f, 0.75f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.6875f, 0.0f, 0.3125f, 0.0f), float4(0.5f, 0.1875f, 0.25f, 0.0625f), float4(0.3125f, 0.375f, 0.125f, 0.1875f), float4(0.125f, 0.5625f, 0.0625f, 0.25f),
+	float4(0.625f, 0.0625f, 0.3125f, 0.0f), float4(0.4375f, 0.25f, 0.1875f, 0.125f), float4(0.25f, 0.4375f, 0.125f, 0.1875f), float4(0.0625f, 0.625f, 0.0f, 0.3125f),
+	float4(0.5625f, 0.125f, 0.25f, 0.0625f), float4(0.375f, 0.3125f, 0.1875f, 0.125f), float4(0.1875f, 0.5f, 0.0625f, 0.25f), float4(0.6875f, 0.0f, 0.3125f, 0.0f),
+	float4(0.3125f, 0.0f, 0.6875f, 0.0f), float4(0.25f, 0.0625f, 0.5f, 0.1875f), float4(0.125f, 0.1875f, 0.3125f, 0.375f), float4(0.0625f, 0.25f, 0.125f, 0.5625f),
+	float4(0.3125f, 0.0f, 0.625f, 0.0625f), float4(0.1875f, 0.125f, 0.4375f, 0.25f), float4(0.125f, 0.1875f, 0.25f, 0.4375f), float4(0.0f, 0.3125f, 0.0625f, 0.625f),
+	float4(0.25f, 0.0625f, 0.5625f, 0.125f), float4(0.1875f, 0.125f, 0.375f, 0.3125f), float4(0.0625f, 0.25f, 0.1875f, 0.5f), float4(0.3125f, 0.0f, 0.6875f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.75f, 0.25f, 0.0f, 0.0f), float4(0.4375f, 0.5625f, 0.0f, 0.0f), float4(0.1875f, 0.8125f, 0.0f, 0.0f),
+	float4(0.9375f, 0.0625f, 0.0f, 0.0f), float4(0.625f, 0.375f, 0.0f, 0.0f), float4(0.375f, 0.625f, 0.0f, 0.0f), float4(0.0625f, 0.9375f, 0.0f, 0.0f),
+	float4(0.8125f, 0.1875f, 0.0f, 0.0f), float4(0.5625f, 0.4375f, 0.0f, 0.0f), float4(0.25f, 0.75f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.6875f, 0.0f, 0.3125f, 0.0f), float4(0.5f, 0.1875f, 0.25f, 0.0625f), float4(0.3125f, 0.375f, 0.125f, 0.1875f), float4(0.125f, 0.5625f, 0.0625f, 0.25f),
+	float4(0.625f, 0.0625f, 0.3125f, 0.0f), float4(0.4375f, 0.25f, 0.1875f, 0.125f), float4(0.25f, 0.4375f, 0.125f, 0.1875f), float4(0.0625f, 0.625f, 0.0f, 0.3125f),
+	float4(0.5625f, 0.125f, 0.25f, 0.0625f), float4(0.375f, 0.3125f, 0.1875f, 0.125f), float4(0.1875f, 0.5f, 0.0625f, 0.25f), float4(0.6875f, 0.0f, 0.3125f, 0.0f),
+	float4(0.3125f, 0.0f, 0.6875f, 0.0f), float4(0.25f, 0.0625f, 0.5f, 0.1875f), float4(0.125f, 0.1875f, 0.3125f, 0.375f), float4(0.0625f, 0.25f, 0.125f, 0.5625f),
+	float4(0.3125f, 0.0f, 0.625f, 0.0625f), float4(0.1875f, 0.125f, 0.4375f, 0.25f), float4(0.125f, 0.1875f, 0.25f, 0.4375f), float4(0.0f, 0.3125f, 0.0625f, 0.625f),
+	float4(0.25f, 0.0625f, 0.5625f, 0.125f), float4(0.1875f, 0.125f, 0.375f, 0.3125f), float4(0.0625f, 0.25f, 0.1875f, 0.5f), float4(0.3125f, 0.0f, 0.6875f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.75f, 0.25f, 0.0f, 0.0f), float4(0.4375f, 0.5625f, 0.0f, 0.0f), float4(0.1875f, 0.8125f, 0.0f, 0.0f),
+	float4(0.9375f, 0.0625f, 0.0f, 0.0f), float4(0.625f, 0.375f, 0.0f, 0.0f), float4(0.375f, 0.625f, 0.0f, 0.0f), float4(0.0625f, 0.9375f, 0.0f, 0.0f),
+	float4(0.8125f, 0.1875f, 0.0f, 0.0f), float4(0.5625f, 0.4375f, 0.0f, 0.0f), float4(0.25f, 0.75f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.6875f, 0.0f, 0.3125f, 0.0f), float4(0.5f, 0.1875f, 0.25f, 0.0625f), float4(0.3125f, 0.375f, 0.125f, 0.1875f), float4(0.125f, 0.5625f, 0.0625f, 0.25f),
+	float4(0.625f, 0.0625f, 0.3125f, 0.0f), float4(0.4375f, 0.25f, 0.1875f, 0.125f), float4(0.25f, 0.4375f, 0.125f, 0.1875f), float4(0.0625f, 0.625f, 0.0f, 0.3125f),
+	float4(0.5625f, 0.125f, 0.25f, 0.0625f), float4(0.375f, 0.3125f, 0.1875f, 0.125f), float4(0.1875f, 0.5f, 0.0625f, 0.25f), float4(0.6875f, 0.0f, 0.3125f, 0.0f),
+	float4(0.3125f, 0.0f, 0.6875f, 0.0f), float4(0.25f, 0.0625f, 0.5f, 0.1875f), float4(0.125f, 0.1875f, 0.3125f, 0.375f), float4(0.0625f, 0.25f, 0.125f, 0.5625f),
+	float4(0.3125f, 0.0f, 0.625f, 0.0625f), float4(0.1875f, 0.125f, 0.4375f, 0.25f), float4(0.125f, 0.1875f, 0.25f, 0.4375f), float4(0.0f, 0.3125f, 0.0625f, 0.625f),
+	float4(0.25f, 0.0625f, 0.5625f, 0.125f), float4(0.1875f, 0.125f, 0.375f, 0.3125f), float4(0.0625f, 0.25f, 0.1875f, 0.5f), float4(0.3125f, 0.0f, 0.6875f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.75f, 0.25f, 0.0f, 0.0f), float4(0.4375f, 0.5625f, 0.0f, 0.0f), float4(0.1875f, 0.8125f, 0.0f, 0.0f),
+	float4(0.9375f, 0.0625f, 0.0f, 0.0f), float4(0.625f, 0.375f, 0.0f, 0.0f), float4(0.375f, 0.625f, 0.0f, 0.0f), float4(0.0625f, 0.9375f, 0.0f, 0.0f),
+	float4(0.8125f, 0.1875f, 0.0f, 0.0f), float4(0.5625f, 0.4375f, 0.0f, 0.0f), float4(0.25f, 0.75f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.625f, 0.375f, 0.0f, 0.0f), float4(0.25f, 0.75f, 0.0f, 0.0f), float4(0.9375f, 0.0625f, 0.0f, 0.0f),
+	float4(0.5625f, 0.4375f, 0.0f, 0.0f), float4(0.1875f, 0.8125f, 0.0f, 0.0f), float4(0.8125f, 0.1875f, 0.0f, 0.0f), float4(0.4375f, 0.5625f, 0.0f, 0.0f),
+	float4(0.0625f, 0.9375f, 0.0f, 0.0f), float4(0.75f, 0.25f, 0.0f, 0.0f), float4(0.375f, 0.625f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.5625f, 0.0f, 0.4375f, 0.0f), float4(0.375f, 0.1875f, 0.25f, 0.1875f), float4(0.125f, 0.4375f, 0.125f, 0.3125f), float4(0.5f, 0.0625f, 0.4375f, 0.0f),
+	float4(0.3125f, 0.25f, 0.25f, 0.1875f), float4(0.125f, 0.4375f, 0.0625f, 0.375f), float4(0.4375f, 0.125f, 0.375f, 0.0625f), float4(0.25f, 0.3125f, 0.1875f, 0.25f),
+	float4(0.0625f, 0.5f, 0.0f, 0.4375f), float4(0.4375f, 0.125f, 0.3125f, 0.125f), float4(0.1875f, 0.375f, 0.1875f, 0.25f), float4(0.5625f, 0.0f, 0.4375f, 0.0f),
+	float4(0.125f, 0.0f, 0.875f, 0.0f), float4(0.0625f, 0.0625f, 0.5625f, 0.3125f), float4(0.0625f, 0.0625f, 0.1875f, 0.6875f), float4(0.125f, 0.0f, 0.8125f, 0.0625f),
+	float4(0.0625f, 0.0625f, 0.5f, 0.375f), float4(0.0f, 0.125f, 0.1875f, 0.6875f), float4(0.125f, 0.0f, 0.6875f, 0.1875f), float4(0.0625f, 0.0625f, 0.375f, 0.5f),
+	float4(0.0f, 0.125f, 0.0625f, 0.8125f), float4(0.125f, 0.0f, 0.625f, 0.25f), float4(0.0625f, 0.0625f, 0.3125f, 0.5625f), float4(0.125f, 0.0f, 0.875f, 0.0f),
+	float4(0.6875f, 0.0f, 0.3125f, 0.0f), float4(0.4375f, 0.25f, 0.1875f, 0.125f), float4(0.1875f, 0.5f, 0.0625f, 0.25f), float4(0.625f, 0.0625f, 0.3125f, 0.0f),
+	float4(0.375f, 0.3125f, 0.1875f, 0.125f), float4(0.125f, 0.5625f, 0.0625f, 0.25f), float4(0.5625f, 0.125f, 0.25f, 0.0625f), float4(0.3125f, 0.375f, 0.125f, 0.1875f),
+	float4(0.0625f, 0.625f, 0.0f, 0.3125f), float4(0.5f, 0.1875f, 0.25f, 0.0625f), float4(0.25f, 0.4375f, 0.125f, 0.1875f), float4(0.6875f, 0.0f, 0.3125f, 0.0f),
+	float4(0.1875f, 0.0f, 0.8125f, 0.0f), float4(0.125f, 0.0625f, 0.5f, 0.3125f), float4(0.0625f, 0.125f, 0.1875f, 0.625f), float4(0.1875f, 0.0f, 0.75f, 0.0625f),
+	float4(0.125f, 0.0625f, 0.4375f, 0.375f), float4(0.0625f, 0.125f, 0.125f, 0.6875f), float4(0.125f, 0.0625f, 0.6875f, 0.125f), float4(0.0625f, 0.125f, 0.375f, 0.4375f),
+	float4(0.0f, 0.1875f, 0.0625f, 0.75f), float4(0.125f, 0.0625f, 0.625f, 0.1875f), float4(0.0625f, 0.125f, 0.3125f, 0.5f), float4(0.1875f, 0.0f, 0.8125f, 0.0f),
+	float4(0.75f, 0.0f, 0.25f, 0.0f), float4(0.5f, 0.25f, 0.125f, 0.125f), float4(0.1875f, 0.5625f, 0.0625f, 0.1875f), float4(0.6875f, 0.0625f, 0.25f, 0.0f),
+	float4(0.4375f, 0.3125f, 0.125f, 0.125f), float4(0.125f, 0.625f, 0.0625f, 0.1875f), float4(0.625f, 0.125f, 0.1875f, 0.0625f), float4(0.3125f, 0.4375f, 0.125f, 0.125f),
+	float4(0.0625f, 0.6875f, 0.0f, 0.25f), float4(0.5625f, 0.1875f, 0.1875f, 0.0625f), float4(0.3125f, 0.4375f, 0.0625f, 0.1875f), float4(0.75f, 0.0f, 0.25f, 0.0f),
+	float4(0.3125f, 0.0f, 0.6875f, 0.0f), float4(0.1875f, 0.125f, 0.4375f, 0.25f), float4(0.0625f, 0.25f, 0.1875f, 0.5f), float4(0.3125f, 0.0f, 0.625f, 0.0625f),
+	float4(0.1875f, 0.125f, 0.375f, 0.3125f), float4(0.0625f, 0.25f, 0.125f, 0.5625f), float4(0.25f, 0.0625f, 0.5625f, 0.125f), float4(0.125f, 0.1875f, 0.3125f, 0.375f),
+	float4(0.0f, 0.3125f, 0.0625f, 0.625f), float4(0.25f, 0.0625f, 0.5f, 0.1875f), float4(0.125f, 0.1875f, 0.25f, 0.4375f), float4(0.3125f, 0.0f, 0.6875f, 0.0f),
+	float4(0.875f, 0.0f, 0.125f, 0.0f), float4(0.5625f, 0.3125f, 0.0625f, 0.0625f), float4(0.25f, 0.625f, 0.0f, 0.125f), float4(0.8125f, 0.0625f, 0.125f, 0.0f),
+	float4(0.5f, 0.375f, 0.0625f, 0.0625f), float4(0.1875f, 0.6875f, 0.0f, 0.125f), float4(0.6875f, 0.1875f, 0.125f, 0.0f), float4(0.375f, 0.5f, 0.0625f, 0.0625f),
+	float4(0.0625f, 0.8125f, 0.0f, 0.125f), float4(0.6875f, 0.1875f, 0.0625f, 0.0625f), float4(0.3125f, 0.5625f, 0.0625f, 0.0625f), float4(0.875f, 0.0f, 0.125f, 0.0f),
+	float4(0.4375f, 0.0f, 0.5625f, 0.0f), float4(0.25f, 0.1875f, 0.375f, 0.1875f), float4(0.125f, 0.3125f, 0.125f, 0.4375f), float4(0.4375f, 0.0f, 0.5f, 0.0625f),
+	float4(0.25f, 0.1875f, 0.3125f, 0.25f), float4(0.0625f, 0.375f, 0.125f, 0.4375f), float4(0.375f, 0.0625f, 0.4375f, 0.125f), float4(0.1875f, 0.25f, 0.25f, 0.3125f),
+	float4(0.0f, 0.4375f, 0.0625f, 0.5f), float4(0.3125f, 0.125f, 0.4375f, 0.125f), float4(0.1875f, 0.25f, 0.1875f, 0.375f), float4(0.4375f, 0.0f, 0.5625f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.625f, 0.375f, 0.0f, 0.0f), float4(0.25f, 0.75f, 0.0f, 0.0f), float4(0.9375f, 0.0625f, 0.0f, 0.0f),
+	float4(0.5625f, 0.4375f, 0.0f, 0.0f), float4(0.1875f, 0.8125f, 0.0f, 0.0f), float4(0.8125f, 0.1875f, 0.0f, 0.0f), float4(0.4375f, 0.5625f, 0.0f, 0.0f),
+	float4(0.0625f, 0.9375f, 0.0f, 0.0f), float4(0.75f, 0.25f, 0.0f, 0.0f), float4(0.375f, 0.625f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.5625f, 0.4375f, 0.0f, 0.0f), float4(0.0625f, 0.9375f, 0.0f, 0.0f), float4(0.625f, 0.375f, 0.0f, 0.0f),
+	float4(0.1875f, 0.8125f, 0.0f, 0.0f), float4(0.75f, 0.25f, 0.0f, 0.0f), float4(0.25f, 0.75f, 0.0f, 0.0f), float4(0.8125f, 0.1875f, 0.0f, 0.0f),
+	float4(0.375f, 0.625f, 0.0f, 0.0f), float4(0.9375f, 0.0625f, 0.0f, 0.0f), float4(0.4375f, 0.5625f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.4375f, 0.0f, 0.5625f, 0.0f), float4(0.25f, 0.1875f, 0.3125f, 0.25f), float4(0.0f, 0.4375f, 0.0625f, 0.5f), float4(0.25f, 0.1875f, 0.375f, 0.1875f),
+	float4(0.0625f, 0.375f, 0.125f, 0.4375f), float4(0.3125f, 0.125f, 0.4375f, 0.125f), float4(0.125f, 0.3125f, 0.125f, 0.4375f), float4(0.375f, 0.0625f, 0.4375f, 0.125f),
+	float4(0.1875f, 0.25f, 0.1875f, 0.375f), float4(0.4375f, 0.0f, 0.5f, 0.0625f), float4(0.1875f, 0.25f, 0.25f, 0.3125f), float4(0.4375f, 0.0f, 0.5625f, 0.0f),
+	float4(0.875f, 0.0f, 0.125f, 0.0f), float4(0.5f, 0.375f, 0.0625f, 0.0625f), float4(0.0625f, 0.8125f, 0.0f, 0.125f), float4(0.5625f, 0.3125f, 0.0625f, 0.0625f),
+	float4(0.1875f, 0.6875f, 0.0f, 0.125f), float4(0.6875f, 0.1875f, 0.0625f, 0.0625f), float4(0.25f, 0.625f, 0.0f, 0.125f), float4(0.6875f, 0.1875f, 0.125f, 0.0f),
+	float4(0.3125f, 0.5625f, 0.0625f, 0.0625f), float4(0.8125f, 0.0625f, 0.125f, 0.0f), float4(0.375f, 0.5f, 0.0625f, 0.0625f), float4(0.875f, 0.0f, 0.125f, 0.0f),
+	float4(0.3125f, 0.0f, 0.6875f, 0.0f), float4(0.1875f, 0.125f, 0.375f, 0.3125f), float4(0.0f, 0.3125f, 0.0625f, 0.625f), float4(0.1875f, 0.125f, 0.4375f, 0.25f),
+	float4(0.0625f, 0.25f, 0.125f, 0.5625f), float4(0.25f, 0.0625f, 0.5f, 0.1875f), float4(0.0625f, 0.25f, 0.1875f, 0.5f), float4(0.25f, 0.0625f, 0.5625f, 0.125f),
+	float4(0.125f, 0.1875f, 0.25f, 0.4375f), float4(0.3125f, 0.0f, 0.625f, 0.0625f), float4(0.125f, 0.1875f, 0.3125f, 0.375f), float4(0.3125f, 0.0f, 0.6875f, 0.0f),
+	float4(0.75f, 0.0f, 0.25f, 0.0f), float4(0.4375f, 0.3125f, 0.125f, 0.125f), float4(0.0625f, 0.6875f, 0.0f, 0.25f), float4(0.5f, 0.25f, 0.125f, 0.125f),
+	float4(0.125f, 0.625f, 0.0625f, 0.1875f), float4(0.5625f, 0.1875f, 0.1875f, 0.0625f), float4(0.1875f, 0.5625f, 0.0625f, 0.1875f), float4(0.625f, 0.125f, 0.1875f, 0.0625f),
+	float4(0.3125f, 0.4375f, 0.0625f, 0.1875f), float4(0.6875f, 0.0625f, 0.25f, 0.0f), float4(0.3125f, 0.4375f, 0.125f, 0.125f), float4(0.75f, 0.0f, 0.25f, 0.0f),
+	float4(0.1875f, 0.0f, 0.8125f, 0.0f), float4(0.125f, 0.0625f, 0.4375f, 0.375f), float4(0.0f, 0.1875f, 0.0625f, 0.75f), float4(0.125f, 0.0625f, 0.5f, 0.3125f),
+	float4(0.0625f, 0.125f, 0.125f, 0.6875f), float4(0.125f, 0.0625f, 0.625f, 0.1875f), float4(0.0625f, 0.125f, 0.1875f, 0.625f), float4(0.125f, 0.0625f, 0.6875f, 0.125f),
+	float4(0.0625f, 0.125f, 0.3125f, 0.5f), float4(0.1875f, 0.0f, 0.75f, 0.0625f), float4(0.0625f, 0.125f, 0.375f, 0.4375f), float4(0.1875f, 0.0f, 0.8125f, 0.0f),
+	float4(0.6875f, 0.0f, 0.3125f, 0.0f), float4(0.375f, 0.3125f, 0.1875f, 0.125f), float4(0.0625f, 0.625f, 0.0f, 0.3125f), float4(0.4375f, 0.25f, 0.1875f, 0.125f),
+	float4(0.125f, 0.5625f, 0.0625f, 0.25f), float4(0.5f, 0.1875f, 0.25f, 0.0625f), float4(0.1875f, 0.5f, 0.0625f, 0.25f), float4(0.5625f, 0.125f, 0.25f, 0.0625f),
+	float4(0.25f, 0.4375f, 0.125f, 0.1875f), float4(0.625f, 0.0625f, 0.3125f, 0.0f), float4(0.3125f, 0.375f, 0.125f, 0.1875f), float4(0.6875f, 0.0f, 0.3125f, 0.0f),
+	float4(0.125f, 0.0f, 0.875f, 0.0f), float4(0.0625f, 0.0625f, 0.5f, 0.375f), float4(0.0f, 0.125f, 0.0625f, 0.8125f), float4(0.0625f, 0.0625f, 0.5625f, 0.3125f),
+	float4(0.0f, 0.125f, 0.1875f, 0.6875f), float4(0.125f, 0.0f, 0.625f, 0.25f), float4(0.0625f, 0.0625f, 0.1875f, 0.6875f), float4(0.125f, 0.0f, 0.6875f, 0.1875f),
+	float4(0.0625f, 0.0625f, 0.3125f, 0.5625f), float4(0.125f, 0.0f, 0.8125f, 0.0625f), float4(0.0625f, 0.0625f, 0.375f, 0.5f), float4(0.125f, 0.0f, 0.875f, 0.0f),
+	float4(0.5625f, 0.0f, 0.4375f, 0.0f), float4(0.3125f, 0.25f, 0.25f, 0.1875f), float4(0.0625f, 0.5f, 0.0f, 0.4375f), float4(0.375f, 0.1875f, 0.25f, 0.1875f),
+	float4(0.125f, 0.4375f, 0.0625f, 0.375f), float4(0.4375f, 0.125f, 0.3125f, 0.125f), float4(0.125f, 0.4375f, 0.125f, 0.3125f), float4(0.4375f, 0.125f, 0.375f, 0.0625f),
+	float4(0.1875f, 0.375f, 0.1875f, 0.25f), float4(0.5f, 0.0625f, 0.4375f, 0.0f), float4(0.25f, 0.3125f, 0.1875f, 0.25f), float4(0.5625f, 0.0f, 0.4375f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.5625f, 0.4375f, 0.0f, 0.0f), float4(0.0625f, 0.9375f, 0.0f, 0.0f), float4(0.625f, 0.375f, 0.0f, 0.0f),
+	float4(0.1875f, 0.8125f, 0.0f, 0.0f), float4(0.75f, 0.25f, 0.0f, 0.0f), float4(0.25f, 0.75f, 0.0f, 0.0f), float4(0.8125f, 0.1875f, 0.0f, 0.0f),
+	float4(0.375f, 0.625f, 0.0f, 0.0f), float4(0.9375f, 0.0625f, 0.0f, 0.0f), float4(0.4375f, 0.5625f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.375f, 0.625f, 0.0f, 0.0f), float4(0.75f, 0.25f, 0.0f, 0.0f), float4(0.0625f, 0.9375f, 0.0f, 0.0f),
+	float4(0.4375f, 0.5625f, 0.0f, 0.0f), float4(0.8125f, 0.1875f, 0.0f, 0.0f), float4(0.1875f, 0.8125f, 0.0f, 0.0f), float4(0.5625f, 0.4375f, 0.0f, 0.0f),
+	float4(0.9375f, 0.0625f, 0.0f, 0.0f), float4(0.25f, 0.75f, 0.0f, 0.0f), float4(0.625f, 0.375f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.25f, 0.0f, 0.75f, 0.0f), float4(0.125f, 0.125f, 0.25f, 0.5f), float4(0.1875f, 0.0625f, 0.5625f, 0.1875f), float4(0.0f, 0.25f, 0.0625f, 0.6875f),
+	float4(0.125f, 0.125f, 0.3125f, 0.4375f), float4(0.1875f, 0.0625f, 0.625f, 0.125f), float4(0.0625f, 0.1875f, 0.125f, 0.625f), float4(0.125f, 0.125f, 0.4375f, 0.3125f),
+	float4(0.25f, 0.0f, 0.6875f, 0.0625f), float4(0.0625f, 0.1875f, 0.1875f, 0.5625f), float4(0.1875f, 0.0625f, 0.4375f, 0.3125f), float4(0.25f, 0.0f, 0.75f, 0.0f),
+	float4(0.4375f, 0.0f, 0.5625f, 0.0f), float4(0.1875f, 0.25f, 0.1875f, 0.375f), float4(0.3125f, 0.125f, 0.4375f, 0.125f), float4(0.0f, 0.4375f, 0.0625f, 0.5f),
+	float4(0.1875f, 0.25f, 0.25f, 0.3125f), float4(0.375f, 0.0625f, 0.4375f, 0.125f), float4(0.0625f, 0.375f, 0.125f, 0.4375f), float4(0.25f, 0.1875f, 0.3125f, 0.25f),
+	float4(0.4375f, 0.0f, 0.5f, 0.0625f), float4(0.125f, 0.3125f, 0.125f, 0.4375f), float4(0.25f, 0.1875f, 0.375f, 0.1875f), float4(0.4375f, 0.0f, 0.5625f, 0.0f),
+	float4(0.6875f, 0.0f, 0.3125f, 0.0f), float4(0.25f, 0.4375f, 0.125f, 0.1875f), float4(0.5f, 0.1875f, 0.25f, 0.0625f), float4(0.0625f, 0.625f, 0.0f, 0.3125f),
+	float4(0.3125f, 0.375f, 0.125f, 0.1875f), float4(0.5625f, 0.125f, 0.25f, 0.0625f), float4(0.125f, 0.5625f, 0.0625f, 0.25f), float4(0.375f, 0.3125f, 0.1875f, 0.125f),
+	float4(0.625f, 0.0625f, 0.3125f, 0.0f), float4(0.1875f, 0.5f, 0.0625f, 0.25f), float4(0.4375f, 0.25f, 0.1875f, 0.125f), float4(0.6875f, 0.0f, 0.3125f, 0.0f),
+	float4(0.875f, 0.0f, 0.125f, 0.0f), float4(0.3125f, 0.5625f, 0.0625f, 0.0625f), float4(0.6875f, 0.1875f, 0.0625f, 0.0625f), float4(0.0625f, 0.8125f, 0.0f, 0.125f),
+	float4(0.375f, 0.5f, 0.0625f, 0.0625f), float4(0.6875f, 0.1875f, 0.125f, 0.0f), float4(0.1875f, 0.6875f, 0.0f, 0.125f), float4(0.5f, 0.375f, 0.0625f, 0.0625f),
+	float4(0.8125f, 0.0625f, 0.125f, 0.0f), float4(0.25f, 0.625f, 0.0f, 0.125f), float4(0.5625f, 0.3125f, 0.0625f, 0.0625f), float4(0.875f, 0.0f, 0.125f, 0.0f),
+	float4(0.125f, 0.0f, 0.875f, 0.0f), float4(0.0625f, 0.0625f, 0.3125f, 0.5625f), float4(0.125f, 0.0f, 0.625f, 0.25f), float4(0.0f, 0.125f, 0.0625f, 0.8125f),
+	float4(0.0625f, 0.0625f, 0.375f, 0.5f), float4(0.125f, 0.0f, 0.6875f, 0.1875f), float4(0.0f, 0.125f, 0.1875f, 0.6875f), float4(0.0625f, 0.0625f, 0.5f, 0.375f),
+	float4(0.125f, 0.0f, 0.8125f, 0.0625f), float4(0.0625f, 0.0625f, 0.1875f, 0.6875f), float4(0.0625f, 0.0625f, 0.5625f, 0.3125f), float4(0.125f, 0.0f, 0.875f, 0.0f),
+	float4(0.3125f, 0.0f, 0.6875f, 0.0f), float4(0.125f, 0.1875f, 0.25f, 0.4375f), float4(0.25f, 0.0625f, 0.5f, 0.1875f), float4(0.0f, 0.3125f, 0.0625f, 0.625f),
+	float4(0.125f, 0.1875f, 0.3125f, 0.375f), float4(0.25f, 0.0625f, 0.5625f, 0.125f), float4(0.0625f, 0.25f, 0.125f, 0.5625f), float4(0.1875f, 0.125f, 0.375f, 0.3125f),
+	float4(0.3125f, 0.0f, 0.625f, 0.0625f), float4(0.0625f, 0.25f, 0.1875f, 0.5f), float4(0.1875f, 0.125f, 0.4375f, 0.25f), float4(0.3125f, 0.0f, 0.6875f, 0.0f),
+	float4(0.5625f, 0.0f, 0.4375f, 0.0f), float4(0.1875f, 0.375f, 0.1875f, 0.25f), float4(0.4375f, 0.125f, 0.3125f, 0.125f), float4(0.0625f, 0.5f, 0.0f, 0.4375f),
+	float4(0.25f, 0.3125f, 0.1875f, 0.25f), float4(0.4375f, 0.125f, 0.375f, 0.0625f), float4(0.125f, 0.4375f, 0.0625f, 0.375f), float4(0.3125f, 0.25f, 0.25f, 0.1875f),
+	float4(0.5f, 0.0625f, 0.4375f, 0.0f), float4(0.125f, 0.4375f, 0.125f, 0.3125f), float4(0.375f, 0.1875f, 0.25f, 0.1875f), float4(0.5625f, 0.0f, 0.4375f, 0.0f),
+	float4(0.75f, 0.0f, 0.25f, 0.0f), float4(0.3125f, 0.4375f, 0.0625f, 0.1875f), float4(0.5625f, 0.1875f, 0.1875f, 0.0625f), float4(0.0625f, 0.6875f, 0.0f, 0.25f),
+	float4(0.3125f, 0.4375f, 0.125f, 0.125f), float4(0.625f, 0.125f, 0.1875f, 0.0625f), float4(0.125f, 0.625f, 0.0625f, 0.1875f), float4(0.4375f, 0.3125f, 0.125f, 0.125f),
+	float4(0.6875f, 0.0625f, 0.25f, 0.0f), float4(0.1875f, 0.5625f, 0.0625f, 0.1875f), float4(0.5f, 0.25f, 0.125f, 0.125f), float4(0.75f, 0.0f, 0.25f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.375f, 0.625f, 0.0f, 0.0f), float4(0.75f, 0.25f, 0.0f, 0.0f), float4(0.0625f, 0.9375f, 0.0f, 0.0f),
+	float4(0.4375f, 0.5625f, 0.0f, 0.0f), float4(0.8125f, 0.1875f, 0.0f, 0.0f), float4(0.1875f, 0.8125f, 0.0f, 0.0f), float4(0.5625f, 0.4375f, 0.0f, 0.0f),
+	float4(0.9375f, 0.0625f, 0.0f, 0.0f), float4(0.25f, 0.75f, 0.0f, 0.0f), float4(0.625f, 0.375f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+};
+static const uint4 pseudo_inverse_idx_12x10[564] =
+{
+	uint4(0, 1, 2, 4), uint4(5, 12, 13, 14), uint4(16, 17, 24, 25), uint4(36, 37, 48, 49),
+	uint4(0, 2, 3, 4), uint4(5, 6, 7, 8), uint4(12, 14, 15, 16), uint4(17, 28, 39, 40),
+	uint4(3, 4, 5, 6), uint4(7, 8, 9, 11), uint4(18, 19, 20, 21), uint4(23, 31, 43, 44),
+	uint4(6, 7, 9, 10), uint4(11, 18, 19, 21), uint4(22, 23, 34, 35), uint4(46, 47, 58, 59),
+	uint4(0, 1, 24, 25), uint4(26, 36, 37, 38), uint4(40, 48, 49, 50), uint4(52, 60, 72, 73),
+	uint4(3, 4, 26, 27), uint4(28, 29, 36, 38), uint4(39, 40, 41, 42), uint4(50, 51, 52, 53),
+	uint4(7, 8, 30, 31), uint4(32, 33, 41, 42), uint4(43, 44, 45, 47), uint4(54, 55, 56, 57),
+	uint4(10, 11, 33, 34), uint4(35, 43, 45, 46), uint4(47, 55, 57, 58), uint4(59, 71, 82, 83),
+	uint4(36, 37, 48, 60), uint4(61, 62, 64, 72), uint4(73, 74, 76, 84), uint4(85, 86, 108, 109),
+	uint4(62, 63, 64, 65), uint4(72, 74, 75, 76), uint4(77, 78, 86, 87), uint4(88, 89, 111, 112),
+	uint4(66, 67, 68, 69), uint4(77, 78, 79, 80), uint4(81, 83, 90, 91), uint4(92, 93, 115, 116),
+	uint4(46, 47, 59, 67), uint4(69, 70, 71, 79), uint4(81, 82, 83, 93), uint4(94, 95, 118, 119),
+	uint4(60, 61, 72, 73), uint4(84, 85, 96, 97), uint4(98, 100, 101, 108), uint4(109, 110, 112, 113),
+	uint4(75, 76, 88, 96), uint4(98, 99, 100, 101), uint4(108, 110, 111, 112), uint4(113, 114, 115, 116),
+	uint4(79, 80, 91, 102), uint4(103, 104, 105, 107), uint4(111, 112, 113, 114), uint4(115, 116, 117, 119),
+	uint4(70, 71, 82, 83), uint4(94, 95, 102, 103), uint4(105, 106, 107, 114), uint4(115, 117, 118, 119),
+	uint4(0, 1, 2, 3), uint4(4, 6, 12, 13), uint4(15, 16, 24, 25), uint4(26, 36, 37, 60),
+	uint4(0, 1, 2, 3), uint4(4, 6, 7, 12), uint4(14, 15, 16, 18), uint4(26, 27, 38, 39),
+	uint4(2, 3, 4, 5), uint4(6, 7, 8, 9), uint4(14, 16, 17, 18), uint4(19, 21, 41, 42),
+	uint4(4, 5, 7, 8), uint4(9, 10, 11, 17), uint4(19, 20, 21, 23), uint4(32, 43, 44, 45),
+	uint4(5, 7, 8, 9), uint4(10, 11, 19, 20), uint4(22, 23, 33, 34), uint4(35, 46, 47, 71),
+	uint4(0, 1, 12, 13), uint4(15, 24, 25, 27), uint4(28, 36, 37, 38), uint4(39, 60, 61, 84),
+	uint4(2, 3, 14, 15), uint4(24, 25, 26, 27), uint4(28, 30, 36, 38), uint4(39, 40, 42, 63),
+	uint4(5, 6, 17, 18), uint4(26, 27, 28, 29), uint4(30, 31, 32, 33), uint4(40, 41, 42, 43),
+	uint4(8, 9, 20, 21), uint4(29, 31, 32, 33), uint4(34, 35, 41, 43), uint4(44, 45, 47, 68),
+	uint4(10, 11, 20, 22), uint4(23, 31, 32, 33), uint4(34, 35, 44, 46), uint4(47, 70, 71, 95),
+	uint4(12, 24, 25, 36), uint4(48, 49, 51, 60), uint4(61, 63, 64, 72), uint4(84, 85, 96, 108),
+	uint4(26, 27, 39, 48), uint4(49, 50, 51, 52), uint4(54, 60, 62, 63), uint4(64, 66, 86, 87),
+	uint4(29, 30, 50, 51), uint4(52, 53, 54, 55), uint4(57, 62, 64, 65), uint4(66, 67, 89, 90),
+	uint4(32, 33, 53, 55), uint4(56, 57, 58, 59), uint4(65, 67, 68, 69), uint4(70, 71, 92, 93),
+	uint4(23, 34, 35, 47), uint4(56, 58, 59, 67), uint4(68, 70, 71, 83), uint4(94, 95, 107, 119),
+	uint4(24, 48, 49, 72), uint4(73, 75, 84, 85), uint4(86, 87, 88, 96), uint4(97, 99, 108, 109),
+	uint4(50, 51, 72, 74), uint4(75, 76, 78, 84), uint4(86, 87, 88, 90), uint4(98, 99, 110, 111),
+	uint4(53, 54, 76, 77), uint4(78, 79, 87, 88), uint4(89, 90, 91, 93), uint4(101, 102, 113, 114),
+	uint4(56, 57, 79, 80), uint4(81, 83, 89, 91), uint4(92, 93, 94, 95), uint4(104, 105, 116, 117),
+	uint4(35, 58, 59, 80), uint4(81, 82, 83, 91), uint4(92, 94, 95, 104), uint4(106, 107, 118, 119),
+	uint4(48, 72, 73, 84), uint4(85, 86, 96, 97), uint4(99, 100, 108, 109), uint4(110, 111, 112, 114),
+	uint4(74, 75, 76, 87), uint4(96, 98, 99, 100), uint4(102, 108, 109, 110), uint4(111, 112, 114, 115),
+	uint4(77, 78, 98, 100), uint4(101, 102, 103, 105), uint4(110, 111, 112, 113), uint4(114, 115, 116, 117),
+	uint4(80, 81, 92, 93), uint4(101, 103, 104, 105), uint4(107, 112, 113, 115), uint4(116, 117, 118, 119),
+	uint4(59, 82, 83, 93), uint4(94, 95, 103, 104), uint4(106, 107, 113, 115), uint4(116, 117, 118, 119),
+	uint4(0, 1, 2, 3), uint4(5, 12, 13, 14), uint4(15, 24, 25, 26), uint4(27, 36, 48, 49),
+	uint4(0, 1, 2, 3), uint4(4, 5, 7, 12), uint4(13, 14, 15, 17), uint4(25, 26, 27, 29),
+	uint4(0, 1, 2, 3), uint4(4, 5, 7, 8), uint4(9, 14, 15, 16), uint4(17, 19, 28, 29),
+	uint4(2, 3, 4, 6), uint4(7, 8, 9, 10), uint4(11, 16, 18, 19), uint4(20, 21, 30, 31),
+	uint4(4, 6, 7, 8), uint4(9, 10, 11, 20), uint4(21, 22, 23, 30), uint4(32, 33, 34, 57),
+	uint4(6, 8, 9, 10), uint4(11, 20, 21, 22), uint4(23, 32, 33, 34), uint4(35, 47, 58, 59),
+	uint4(0, 1, 12, 13), uint4(15, 24, 25, 26), uint4(27, 29, 36, 37), uint4(38, 48, 49, 72),
+	uint4(2, 3, 12, 13), uint4(14, 15, 17, 24), uint4(25, 26, 27, 29), uint4(38, 48, 50, 51),
+	uint4(4, 5, 14, 16), uint4(17, 19, 25, 26), uint4(27, 28, 29, 30), uint4(31, 41, 52, 53),
+	uint4(6, 7, 16, 18), uint4(19, 21, 28, 30), uint4(31, 32, 33, 34), uint4(42, 54, 55, 57),
+	uint4(8, 9, 18, 20), uint4(21, 22, 23, 30), uint4(32, 33, 34, 35), uint4(45, 56, 57, 59),
+	uint4(10, 11, 20, 21), uint4(22, 23, 30, 32), uint4(33, 34, 35, 46), uint4(47, 58, 59, 83),
+	uint4(0, 12, 13, 24), uint4(25, 36, 37, 38), uint4(39, 48, 49, 50), uint4(51, 60, 72, 73),
+	uint4(14, 15, 26, 27), uint4(36, 37, 38, 39), uint4(41, 48, 49, 50), uint4(51, 53, 74, 75),
+	uint4(16, 17, 29, 38), uint4(39, 40, 41, 43), uint4(50, 51, 52, 53), uint4(55, 64, 76, 77),
+	uint4(18, 19, 30, 31), uint4(40, 42, 43, 44), uint4(45, 52, 54, 55), uint4(56, 57, 78, 79),
+	uint4(20, 21, 32, 33), uint4(42, 44, 45, 46), uint4(47, 54, 56, 57), uint4(58, 59, 80, 81),
+	uint4(11, 22, 23, 34), uint4(35, 44, 45, 46), uint4(47, 56, 57, 58), uint4(59, 71, 82, 83),
+	uint4(12, 36, 37, 60), uint4(61, 62, 63, 72), uint4(73, 74, 75, 84), uint4(85, 96, 97, 108),
+	uint4(38, 39, 60, 61), uint4(62, 63, 65, 72), uint4(73, 74, 75, 77), uint4(86, 87, 98, 99),
+	uint4(40, 41, 62, 63), uint4(64, 65, 67, 74), uint4(75, 76, 77, 79), uint4(88, 89, 100, 101),
+	uint4(42, 43, 64, 66), uint4(67, 68, 69, 70), uint4(76, 78, 79, 80), uint4(81, 90, 102, 103),
+	uint4(44, 45, 66, 68), uint4(69, 70, 71, 78), uint4(80, 81, 82, 83), uint4(92, 93, 104, 105),
+	uint4(23, 46, 47, 68), uint4(69, 70, 71, 80), uint4(81, 82, 83, 94), uint4(95, 106, 107, 119),
+	uint4(36, 60, 61, 72), uint4(73, 74, 84, 85), uint4(86, 87, 89, 96), uint4(97, 99, 108, 109),
+	uint4(61, 62, 63, 74), uint4(84, 85, 86, 87), uint4(89, 96, 97, 98), uint4(99, 101, 110, 111),
+	uint4(64, 65, 76, 77), uint4(85, 86, 87, 88), uint4(89, 91, 98, 100), uint4(101, 103, 112, 113),
+	uint4(66, 67, 78, 79), uint4(88, 89, 90, 91), uint4(92, 93, 100, 102), uint4(103, 105, 114, 115),
+	uint4(68, 69, 70, 81), uint4(90, 92, 93, 94), uint4(95, 102, 104, 105), uint4(106, 107, 116, 117),
+	uint4(47, 70, 71, 81), uint4(82, 83, 90, 92), uint4(93, 94, 95, 104), uint4(106, 107, 118, 119),
+	uint4(60, 61, 72, 84), uint4(85, 86, 87, 96), uint4(97, 98, 99, 108), uint4(109, 110, 111, 113),
+	uint4(62, 85, 86, 87), uint4(89, 96, 97, 98), uint4(99, 108, 109, 110), uint4(111, 112, 113, 115),
+	uint4(88, 89, 98, 99), uint4(100, 101, 103, 108), uint4(109, 110, 111, 112), uint4(113, 115, 116, 117),
+	uint4(90, 91, 100, 102), uint4(103, 104, 105, 110), uint4(111, 112, 114, 115), uint4(116, 117, 118, 119),
+	uint4(90, 92, 93, 94), uint4(102, 104, 105, 106), uint4(107, 112, 114, 115), uint4(116, 117, 118, 119),
+	uint4(70, 71, 83, 92), uint4(93, 94, 95, 104), uint4(105, 106, 107, 114), uint4(116, 117, 118, 119),
+	uint4(0, 1, 2, 3), uint4(4, 5, 12, 13), uint4(14, 15, 24, 25), uint4(26, 36, 37, 48),
+	uint4(0, 1, 2, 3), uint4(4, 5, 14, 15), uint4(24, 25, 26, 27), uint4(36, 37, 38, 39),
+	uint4(0, 1, 2, 3), uint4(4, 5, 6, 7), uint4(8, 15, 16, 27), uint4(28, 39, 40, 51),
+	uint4(1, 3, 4, 5), uint4(6, 7, 8, 16), uint4(17, 19, 27, 28), uint4(29, 40, 41, 53),
+	uint4(3, 4, 5, 6), uint4(7, 8, 10, 16), uint4(18, 19, 30, 31), uint4(32, 42, 43, 54),
+	uint4(3, 4, 5, 6), uint4(7, 8, 9, 10), uint4(11, 19, 20, 31), uint4(32, 43, 44, 56),
+	uint4(6, 7, 8, 9), uint4(10, 11, 22, 23), uint4(32, 33, 34, 44), uint4(45, 46, 57, 58),
+	uint4(6, 7, 8, 9), uint4(10, 11, 21, 22), uint4(23, 32, 33, 34), uint4(35, 45, 47, 59),
+	uint4(0, 1, 2, 12), uint4(13, 14, 15, 24), uint4(25, 26, 27, 36), uint4(37, 38, 48, 49),
+	uint4(1, 2, 12, 13), uint4(14, 15, 16, 24), uint4(25, 26, 27, 36), uint4(37, 38, 39, 50),
+	uint4(3, 4, 5, 12), uint4(13, 14, 15, 16), uint4(17, 27, 28, 29), uint4(39, 40, 41, 51),
+	uint4(4, 5, 15, 16), uint4(17, 18, 19, 20), uint4(27, 28, 29, 39), uint4(40, 41, 52, 53),
+	uint4(6, 7, 15, 16), uint4(17, 18, 19, 20), uint4(30, 31, 32, 42), uint4(43, 44, 54, 55),
+	uint4(6, 7, 8, 10), uint4(18, 19, 20, 22), uint4(23, 30, 31, 32), uint4(42, 43, 44, 56),
+	uint4(9, 10, 11, 19), uint4(20, 21, 22, 23), uint4(32, 33, 34, 35), uint4(44, 45, 46, 47),
+	uint4(9, 10, 11, 20), uint4(21, 22, 23, 32), uint4(33, 34, 35, 45), uint4(46, 47, 58, 59),
+	uint4(0, 2, 12, 13), uint4(14, 24, 25, 26), uint4(36, 37, 38, 39), uint4(48, 49, 50, 60),
+	uint4(2, 13, 14, 24), uint4(25, 26, 27, 36), uint4(37, 38, 39, 40), uint4(41, 49, 50, 51),
+	uint4(3, 13, 15, 16), uint4(17, 25, 27, 28), uint4(29, 37, 39, 40), uint4(41, 51, 52, 53),
+	uint4(15, 16, 17, 27), uint4(28, 29, 31, 39), uint4(40, 41, 42, 43), uint4(44, 51, 52, 53),
+	uint4(18, 19, 20, 28), uint4(30, 31, 32, 39), uint4(40, 41, 42, 43), uint4(44, 54, 55, 56),
+	uint4(8, 18, 19, 20), uint4(22, 30, 31, 32), uint4(34, 42, 43, 44), uint4(46, 55, 56, 58),
+	uint4(9, 21, 22, 32), uint4(33, 34, 35, 43), uint4(44, 45, 46, 47), uint4(56, 57, 58, 59),
+	uint4(11, 21, 22, 23), uint4(33, 34, 35, 43), uint4(44, 45, 46, 47), uint4(57, 58, 59, 71),
+	uint4(0, 12, 24, 25), uint4(26, 36, 37, 38), uint4(48, 49, 50, 51), uint4(60, 72, 84, 96),
+	uint4(13, 14, 24, 25), uint4(26, 37, 38, 39), uint4(48, 49, 50, 51), uint4(52, 53, 61, 62),
+	uint4(15, 27, 28, 29), uint4(39, 48, 49, 51), uint4(52, 53, 55, 61), uint4(62, 63, 75, 87),
+	uint4(16, 17, 28, 29), uint4(40, 41, 51, 52), uint4(53, 54, 55, 56), uint4(63, 64, 65, 67),
+	uint4(18, 30, 31, 42), uint4(43, 51, 52, 53), uint4(54, 55, 56, 58), uint4(64, 66, 67, 68),
+	uint4(20, 30, 31, 32), uint4(34, 44, 52, 54), uint4(55, 56, 57, 58), uint4(59, 68, 80, 92),
+	uint4(21, 22, 33, 34), uint4(44, 45, 46, 54), uint4(55, 56, 57, 58), uint4(59, 68, 69, 70),
+	uint4(23, 33, 34, 35), uint4(45, 46, 47, 56), uint4(57, 58, 59, 69), uint4(71, 83, 95, 107),
+	uint4(12, 24, 36, 48), uint4(50, 60, 61, 62), uint4(63, 72, 73, 74), uint4(84, 85, 86, 96),
+	uint4(49, 50, 51, 60), uint4(61, 62, 63, 64), uint4(65, 73, 74, 75), uint4(85, 86, 97, 98),
+	uint4(27, 39, 51, 60), uint4(61, 62, 63, 64), uint4(65, 67, 75, 85), uint4(87, 88, 89, 99),
+	uint4(51, 52, 53, 55), uint4(61, 63, 64, 65), uint4(66, 67, 68, 76), uint4(77, 88, 89, 101),
+	uint4(52, 54, 55, 56), uint4(63, 64, 65, 66), uint4(67, 68, 78, 79), uint4(90, 91, 102, 103),
+	uint4(32, 44, 56, 57), uint4(58, 64, 66, 67), uint4(68, 70, 71, 80), uint4(90, 91, 92, 104),
+	uint4(57, 58, 66, 67), uint4(68, 69, 70, 71), uint4(80, 81, 82, 93), uint4(94, 95, 105, 106),
+	uint4(23, 35, 47, 59), uint4(68, 69, 70, 71), uint4(81, 82, 83, 93), uint4(94, 95, 107, 119),
+	uint4(48, 60, 61, 62), uint4(72, 73, 74, 75), uint4(76, 84, 85, 86), uint4(96, 97, 98, 108),
+	uint4(60, 61, 62, 63), uint4(72, 73, 74, 75), uint4(76, 84, 85, 86), uint4(87, 97, 98, 110),
+	uint4(61, 63, 64, 73), uint4(75, 76, 77, 85), uint4(87, 88, 89, 97), uint4(99, 100, 101, 111),
+	uint4(63, 64, 65, 75), uint4(76, 77, 78, 79), uint4(80, 87, 88, 89), uint4(91, 99, 100, 101),
+	uint4(66, 67, 68, 75), uint4(76, 77, 78, 79), uint4(80, 88, 90, 91), uint4(92, 102, 103, 104),
+	uint4(66, 67, 68, 78), uint4(79, 80, 82, 90), uint4(91, 92, 94, 102), uint4(103, 104, 106, 116),
+	uint4(68, 69, 70, 78), uint4(79, 80, 81, 82), uint4(83, 92, 93, 94), uint4(95, 105, 106, 117),
+	uint4(59, 69, 70, 71), uint4(80, 81, 82, 83), uint4(93, 94, 95, 105), uint4(106, 107, 117, 119),
+	uint4(60, 61, 72, 73), uint4(74, 84, 85, 86), uint4(87, 96, 97, 98), uint4(99, 108, 109, 110),
+	uint4(72, 73, 74, 75), uint4(84, 85, 86, 87), uint4(96, 97, 98, 99), uint4(100, 108, 109, 110),
+	uint4(63, 75, 76, 77), uint4(87, 88, 89, 96), uint4(97, 99, 100, 101), uint4(109, 111, 112, 113),
+	uint4(64, 65, 75, 76), uint4(77, 87, 88, 89), uint4(99, 100, 101, 102), uint4(103, 104, 112, 113),
+	uint4(66, 67, 78, 79), uint4(80, 90, 91, 92), uint4(99, 100, 101, 102), uint4(103, 104, 114, 115),
+	uint4(68, 78, 79, 80), uint4(90, 91, 92, 102), uint4(103, 104, 105, 106), uint4(107, 114, 115, 116),
+	uint4(69, 80, 81, 82), uint4(83, 92, 93, 94), uint4(95, 103, 104, 105), uint4(106, 107, 117, 118),
+	uint4(70, 71, 81, 82), uint4(83, 92, 93, 94), uint4(95, 104, 105, 106), uint4(107, 117, 118, 119),
+	uint4(60, 72, 74, 84), uint4(85, 86, 87, 96), uint4(97, 98, 108, 109), uint4(110, 111, 112, 113),
+	uint4(61, 62, 73, 74), uint4(75, 85, 86, 87), uint4(96, 97, 108, 109), uint4(110, 111, 112, 113),
+	uint4(63, 75, 76, 87), uint4(88, 99, 100, 108), uint4(109, 110, 111, 112), uint4(113, 114, 115, 116),
+	uint4(65, 76, 77, 87), uint4(88, 89, 100, 101), uint4(103, 109, 111, 112), uint4(113, 114, 115, 116),
+	uint4(66, 78, 79, 90), uint4(91, 92, 100, 102), uint4(103, 111, 112, 113), uint4(114, 115, 116, 118),
+	uint4(68, 79, 80, 91), uint4(92, 103, 104, 111), uint4(112, 113, 114, 115), uint4(116, 117, 118, 119),
+	uint4(80, 81, 82, 83), uint4(92, 93, 94, 95), uint4(104, 105, 114, 115), uint4(116, 117, 118, 119),
+	uint4(71, 82, 83, 93), uint4(94, 95, 104, 105), uint4(106, 107, 114, 115), uint4(116, 117, 118, 119),
+};
+static const float4 pseudo_inverse_wt_12x10[564] =
+{
+	float4(0.41368f, 0.283674f, 0.121167f, -0.097937f), float4(-0.0559044f, 0.256911f, 0.166365f, 0.0827777f),
+	float4(-0.0574064f, -0.0359337f, 0.0687888f, 0.0571625f), float4(-0.0879801f, -0.0601465f, -0.0545609f, -0.0351956f),
+	float4(-0.106343f, 0.135047f, 0.242332f, 0.297279f), float4(0.169696f, 0.0676289f, -0.0599545f, -0.0641652f),
+	float4(-0.0658129f, 0.0777002f, 0.152359f, 0.17468f), float4(0.109286f, 0.058656f, -0.0521071f, -0.0639431f),
+	float4(-0.0641652f, -0.0599545f, 0.0676289f, 0.169696f), float4(0.297279f, 0.242332f, 0.135047f, -0.106343f),
+	float4(0.109286f, 0.17468f, 0.152359f, 0.0777002f), float4(-0.0658129f, 0.058656f, -0.0639431f, -0.0521071f),
+	float4(-0.0559044f, -0.097937f, 0.121167f, 0.283674f), float4(0.41368f, -0.0359337f, -0.0574064f, 0.0827777f),
+	float4(0.166365f, 0.256911f, 0.0571625f, 0.0687888f), float4(-0.0601465f, -0.0879801f, -0.0351956f, -0.0545609f),
+	float4(-0.0879801f, -0.0601465f, 0.190962f, 0.12294f), float4(0.0618751f, 0.317754f, 0.217779f, 0.0928107f),
+	float4(-0.0756348f, 0.197058f, 0.127499f, 0.0633631f), float4(-0.0442497f, 0.052222f, -0.0684746f, -0.0467842f),
+	float4(-0.0521071f, -0.0639431f, 0.0573978f, 0.113588f), float4(0.129418f, 0.0814903f, -0.0821456f, 0.103838f),
+	float4(0.186497f, 0.228797f, 0.130324f, 0.0515453f), float4(0.0596294f, 0.117091f, 0.134193f, 0.0838376f),
+	float4(-0.0639431f, -0.0521071f, 0.0814903f, 0.129418f), float4(0.113588f, 0.0573978f, 0.0515453f, 0.130324f),
+	float4(0.228797f, 0.186497f, 0.103838f, -0.0821456f), float4(0.0838376f, 0.134193f, 0.117091f, 0.0596294f),
+	float4(-0.0601465f, -0.0879801f, 0.0618751f, 0.12294f), float4(0.190962f, -0.0756348f, 0.0928107f, 0.217779f),
+	float4(0.317754f, -0.0442497f, 0.0633631f, 0.127499f), float4(0.197058f, 0.052222f, -0.0467842f, -0.0684746f),
+	float4(-0.0684746f, -0.0467842f, 0.052222f, 0.197058f), float4(0.127499f, 0.0633631f, -0.0442497f, 0.317754f),
+	float4(0.217779f, 0.0928107f, -0.0756348f, 0.190962f), float4(0.12294f, 0.0618751f, -0.0879801f, -0.0601465f),
+	float4(0.0596294f, 0.117091f, 0.134193f, 0.0838376f), float4(-0.0821456f, 0.103838f, 0.186497f, 0.228797f),
+	float4(0.130324f, 0.0515453f, 0.0573978f, 0.113588f), float4(0.129418f, 0.0814903f, -0.0521071f, -0.0639431f),
+	float4(0.0838376f, 0.134193f, 0.117091f, 0.0596294f), float4(0.0515453f, 0.130324f, 0.228797f, 0.186497f),
+	float4(0.103838f, -0.0821456f, 0.0814903f, 0.129418f), float4(0.113588f, 0.0573978f, -0.0639431f, -0.0521071f),
+	float4(-0.0467842f, -0.0684746f, 0.052222f, -0.0442497f), float4(0.0633631f, 0.127499f, 0.197058f, -0.0756348f),
+	float4(0.0928107f, 0.217779f, 0.317754f, 0.0618751f), float4(0.12294f, 0.190962f, -0.0601465f, -0.0879801f),
+	float4(-0.0545609f, -0.0351956f, -0.0879801f, -0.0601465f), float4(0.0687888f, 0.0571625f, 0.256911f, 0.166365f),
+	float4(0.0827777f, -0.0574064f, -0.0359337f, 0.41368f), float4(0.283674f, 0.121167f, -0.097937f, -0.0559044f),
+	float4(-0.0521071f, -0.0639431f, 0.058656f, -0.0658129f), float4(0.0777002f, 0.152359f, 0.17468f, 0.109286f),
+	float4(-0.106343f, 0.135047f, 0.242332f, 0.297279f), float4(0.169696f, 0.0676289f, -0.0599545f, -0.0641652f),
+	float4(-0.0639431f, -0.0521071f, 0.058656f, 0.109286f), float4(0.17468f, 0.152359f, 0.0777002f, -0.0658129f),
+	float4(-0.0641652f, -0.0599545f, 0.0676289f, 0.169696f), float4(0.297279f, 0.242332f, 0.135047f, -0.106343f),
+	float4(-0.0351956f, -0.0545609f, -0.0601465f, -0.0879801f), float4(0.0571625f, 0.0687888f, -0.0359337f, -0.0574064f),
+	float4(0.0827777f, 0.166365f, 0.256911f, -0.0559044f), float4(-0.097937f, 0.121167f, 0.283674f, 0.41368f),
+	float4(0.588476f, 0.316681f, 0.0448867f, -0.125199f), float4(-0.0585382f, 0.0316237f, 0.265754f, 0.163147f),
+	float4(-0.053151f, -0.0272693f, -0.0569678f, -0.0467836f), float4(0.0197964f, -0.0895633f, -0.0511509f, 0.0283112f),
+	float4(-0.13631f, 0.0971271f, 0.330564f, 0.446557f), float4(0.208768f, -0.112818f, -0.0426232f, -0.0617926f),
+	float4(0.161027f, 0.179399f, 0.0927111f, -0.0428653f), float4(-0.0573204f, -0.0373925f, -0.0475812f, -0.0636421f),
+	float4(-0.100573f, -0.103523f, 0.162836f, 0.429195f), float4(0.428999f, 0.16225f, -0.1045f, -0.1012f),
+	float4(-0.0486139f, 0.0740858f, 0.169816f, 0.169957f), float4(0.0748465f, -0.0476476f, -0.0763326f, -0.0758575f),
+	float4(-0.0430795f, -0.113666f, 0.210357f, 0.449901f), float4(0.332789f, 0.097236f, -0.138317f, -0.0417447f),
+	float4(0.0905715f, 0.174502f, 0.157687f, -0.0626774f), float4(-0.0490259f, -0.0303206f, -0.0717057f, -0.0541874f),
+	float4(0.032105f, -0.0593949f, -0.127043f, 0.0433209f), float4(0.315778f, 0.588236f, -0.0246834f, -0.0472762f),
+	float4(0.166009f, 0.266314f, -0.0266823f, -0.0411451f), float4(-0.055608f, -0.0468829f, -0.087997f, 0.0292387f),
+	float4(-0.149174f, -0.0804782f, 0.167829f, 0.0696996f), float4(-0.0410383f, 0.484832f, 0.275486f, -0.0998338f),
+	float4(-0.0493183f, 0.345382f, 0.192625f, 0.0398685f), float4(-0.0700064f, -0.109379f, -0.0682878f, 0.0374927f),
+	float4(-0.0862512f, -0.114228f, 0.0796831f, 0.145995f), float4(-0.111202f, 0.0672078f, 0.292762f, 0.357753f),
+	float4(0.176816f, -0.085117f, -0.0770705f, 0.179323f), float4(0.242781f, 0.110786f, -0.0673358f, -0.080662f),
+	float4(-0.121531f, -0.120746f, 0.132768f, 0.132823f), float4(-0.0875664f, -0.0746556f, 0.128134f, 0.330924f),
+	float4(0.329519f, 0.12465f, -0.0802188f, -0.0757459f), float4(0.109035f, 0.260397f, 0.259557f, 0.106515f),
+	float4(-0.128206f, -0.0937423f, 0.150201f, 0.0814408f), float4(-0.0897234f, 0.186511f, 0.376805f, 0.256624f),
+	float4(0.0674392f, -0.121746f, -0.0712737f, 0.117492f), float4(0.257166f, 0.188918f, -0.084941f, -0.0843558f),
+	float4(-0.0792758f, -0.147586f, -0.0470145f, 0.0672728f), float4(0.167936f, -0.0549189f, -0.111117f, 0.0568334f),
+	float4(0.270146f, 0.483458f, -0.0768713f, 0.187766f), float4(0.342104f, -0.0536153f, -0.113411f, 0.0404238f),
+	float4(-0.046902f, -0.135384f, -0.075366f, 0.0783745f), float4(0.460837f, 0.241818f, -0.0927438f, 0.411315f),
+	float4(0.251971f, -0.0819104f, -0.0450432f, 0.0736592f), float4(-0.1412f, -0.0794872f, -0.0490675f, 0.0430648f),
+	float4(-0.0856083f, -0.103267f, 0.0720951f, -0.105709f), float4(0.0812044f, 0.268118f, 0.337157f, 0.153158f),
+	float4(-0.0807686f, -0.092153f, 0.226221f, 0.293383f), float4(0.161661f, -0.0699887f, -0.0796787f, -0.116588f),
+	float4(-0.0802767f, -0.0800734f, -0.070484f, -0.0584482f), float4(0.133959f, 0.326365f, 0.326659f, 0.134884f),
+	float4(-0.0689249f, -0.0585426f, 0.092276f, 0.282754f), float4(0.282805f, 0.0927162f, -0.0905709f, -0.0910958f),
+	float4(-0.106924f, -0.0739464f, -0.0793391f, 0.150276f), float4(0.331143f, 0.262113f, 0.0756608f, -0.110792f),
+	float4(-0.0694132f, 0.160172f, 0.291421f, 0.222429f), float4(0.0866083f, -0.0998056f, -0.108838f, -0.0895863f),
+	float4(-0.0489094f, -0.0770516f, -0.140917f, 0.0825771f), float4(-0.0971411f, 0.252936f, 0.482228f, -0.0470507f),
+	float4(-0.0850645f, 0.200353f, 0.428762f, 0.0729238f), float4(-0.0847328f, -0.152729f, -0.0529195f, 0.0468899f),
+	float4(0.0374815f, -0.127773f, -0.0656562f, 0.338789f), float4(0.186919f, -0.0737661f, 0.479518f, 0.268111f),
+	float4(0.0567032f, -0.10979f, -0.0543001f, 0.166572f), float4(0.0668031f, -0.0464601f, -0.146374f, -0.0786853f),
+	float4(-0.0834532f, -0.10428f, -0.0861288f, 0.183721f), float4(0.250951f, 0.115502f, -0.0679079f, -0.120276f),
+	float4(0.254788f, 0.373903f, 0.185188f, -0.08883f), float4(0.0808663f, 0.149029f, -0.0930555f, -0.127218f),
+	float4(-0.0951035f, -0.095455f, 0.103465f, 0.252546f), float4(0.253281f, 0.105672f, -0.0793322f, 0.123814f),
+	float4(0.32696f, 0.328343f, 0.127243f, -0.0867038f), float4(0.131776f, 0.13172f, -0.119805f, -0.120579f),
+	float4(-0.0966529f, -0.0756788f, 0.109645f, 0.238393f), float4(0.176324f, -0.0744167f, -0.0842977f, 0.175564f),
+	float4(0.355022f, 0.290507f, 0.0666757f, -0.110371f), float4(0.14487f, 0.0790702f, -0.11335f, -0.0855824f),
+	float4(0.0404335f, -0.0744677f, -0.138268f, -0.0680049f), float4(0.0395681f, 0.188098f, 0.336628f, -0.0489764f),
+	float4(-0.0990933f, 0.273929f, 0.481984f, -0.0407318f), float4(0.0693179f, 0.166842f, -0.0800282f, -0.1483f),
+	float4(0.0328516f, -0.0871743f, -0.0467126f, -0.054587f), float4(-0.0406317f, -0.0266764f, 0.266667f, 0.166124f),
+	float4(-0.0474344f, -0.0247439f, 0.587921f, 0.31563f), float4(0.0433392f, -0.126925f, -0.0593467f, 0.0320629f),
+	float4(-0.0527379f, -0.0699921f, -0.0298375f, -0.0482153f), float4(-0.0627994f, 0.157852f, 0.174832f, 0.0906898f),
+	float4(-0.0418639f, -0.138188f, 0.097202f, 0.332592f), float4(0.449623f, 0.210248f, -0.113557f, -0.0430432f),
+	float4(-0.0738135f, -0.0742548f, -0.0477066f, 0.074928f), float4(0.170263f, 0.170122f, 0.0741735f, -0.0486714f),
+	float4(-0.101106f, -0.104388f, 0.162168f, 0.428724f), float4(0.428916f, 0.162744f, -0.103428f, -0.100486f),
+	float4(-0.0625003f, -0.0467959f, -0.0366704f, -0.0567194f), float4(-0.0429735f, 0.0928194f, 0.179699f, 0.16119f),
+	float4(-0.0618735f, -0.042595f, -0.112725f, 0.208678f), float4(0.446323f, 0.330384f, 0.0970654f, -0.136254f),
+	float4(0.0357698f, -0.0499609f, -0.0873033f, 0.0198036f), float4(-0.046369f, -0.0562315f, -0.027293f, -0.0532177f),
+	float4(0.163251f, 0.266009f, 0.0316031f, -0.0585191f), float4(-0.125149f, 0.0448719f, 0.316561f, 0.588249f),
+	float4(0.699644f, 0.328507f, -0.0956486f, -0.0768893f), float4(0.0290082f, 0.216356f, 0.107571f, -0.0542329f),
+	float4(-0.0162887f, -0.132991f, -0.0618109f, 0.0219376f), float4(0.0181853f, -0.0135442f, 0.0354414f, 0.016931f),
+	float4(-0.148668f, 0.207191f, 0.613887f, 0.343629f), float4(-0.0309807f, -0.129994f, 0.0416203f, -0.047866f),
+	float4(0.0587873f, 0.216278f, 0.0832545f, -0.0309941f), float4(-0.0396044f, -0.115874f, -0.066561f, 0.0340316f),
+	float4(0.0427422f, -0.0597509f, -0.176886f, 0.149118f), float4(0.546538f, 0.486566f, -0.155765f, -0.0424658f),
+	float4(0.0504695f, -0.0667993f, 0.0687193f, 0.189189f), float4(0.1326f, -0.0530618f, -0.0998781f, -0.101433f),
+	float4(0.0504319f, -0.0424913f, -0.155773f, 0.489403f), float4(0.54936f, 0.149695f, -0.178127f, -0.0601385f),
+	float4(0.0431012f, -0.0530103f, 0.125661f, 0.183091f), float4(0.0677024f, -0.0646802f, -0.0941475f, -0.110313f),
+	float4(0.0416534f, -0.130995f, -0.0319559f, 0.343523f), float4(0.614474f, 0.207372f, -0.148842f, 0.0833728f),
+	float4(0.215211f, 0.0583841f, -0.0475554f, 0.031844f), float4(-0.0660488f, -0.117502f, -0.0400835f, 0.0333495f),
+	float4(0.0292752f, -0.0768633f, -0.0958086f, 0.328458f), float4(0.699691f, -0.0163143f, -0.0539413f, 0.107681f),
+	float4(0.216271f, 0.0180559f, 0.0223777f, -0.0616819f), float4(-0.133114f, -0.0133737f, 0.0167113f, 0.0356499f),
+	float4(-0.159535f, -0.076379f, 0.36687f, 0.163305f), float4(-0.0511194f, 0.647175f, 0.308475f, -0.0900272f),
+	float4(-0.0815348f, 0.0334746f, 0.0661287f, 0.0470531f), float4(-0.0318236f, -0.172284f, -0.0842962f, 0.0483826f),
+	float4(-0.140741f, -0.082506f, -0.0833593f, 0.112727f), float4(0.29666f, 0.207146f, -0.0806063f, -0.149263f),
+	float4(0.179426f, 0.566252f, 0.339326f, -0.139394f), float4(0.0807641f, 0.0452511f, -0.149636f, -0.102274f),
+	float4(-0.123421f, -0.111164f, -0.0852808f, 0.267189f), float4(0.277799f, -0.0809812f, -0.0536755f, -0.16948f),
+	float4(0.114396f, 0.480373f, 0.497589f, 0.0577169f), float4(-0.14673f, 0.0671178f, -0.143326f, -0.123725f),
+	float4(-0.125119f, -0.137268f, -0.0811294f, 0.311929f), float4(0.297115f, -0.0958117f, -0.141861f, 0.461666f),
+	float4(0.531552f, 0.125605f, -0.188641f, -0.0596075f), float4(0.071992f, -0.143411f, -0.170325f, 0.0645363f),
+	float4(-0.0821463f, -0.143297f, -0.0908882f, 0.206857f), float4(0.301339f, 0.114494f, -0.0847251f, -0.130596f),
+	float4(0.337456f, 0.573207f, 0.181455f, -0.151212f), float4(0.0712126f, -0.0789003f, -0.162055f, 0.0486969f),
+	float4(-0.076184f, -0.159723f, -0.0510676f, -0.0295433f), float4(0.162866f, 0.36721f, 0.0313104f, -0.0811013f),
+	float4(-0.0917392f, 0.307977f, 0.647656f, 0.0480243f), float4(0.0653995f, -0.0833797f, -0.173155f, 0.0488182f),
+	float4(0.0528152f, -0.121273f, -0.0519021f, -0.112295f), float4(-0.0597675f, 0.537417f, 0.229197f, -0.0586347f),
+	float4(-0.070365f, 0.603055f, 0.297558f, -0.0777366f), float4(-0.0874027f, -0.0613997f, -0.16921f, -0.0732089f),
+	float4(-0.0996628f, -0.0687562f, -0.0923071f, -0.0767114f), float4(-0.129846f, 0.170808f, 0.451613f, 0.284148f),
+	float4(-0.0879884f, -0.141688f, 0.153714f, 0.517186f), float4(0.34732f, -0.113792f, -0.138956f, -0.0949081f),
+	float4(-0.0887673f, -0.0881455f, -0.120758f, -0.126245f), float4(0.103729f, 0.424782f, 0.350709f, -0.113436f),
+	float4(-0.142082f, 0.0882988f, 0.502387f, 0.424481f), float4(-0.145123f, -0.0623424f, -0.111054f, -0.0931164f),
+	float4(-0.111311f, -0.104898f, -0.0662011f, -0.087233f), float4(-0.12364f, 0.333069f, 0.407823f, 0.0900302f),
+	float4(-0.133702f, -0.146126f, 0.423548f, 0.497696f), float4(0.168191f, -0.159913f, -0.0934161f, -0.110897f),
+	float4(-0.0722199f, -0.108227f, -0.0793071f, -0.10223f), float4(-0.0917798f, 0.303597f, 0.481514f, 0.182282f),
+	float4(-0.138514f, -0.121146f, 0.273794f, 0.550842f), float4(0.163547f, -0.150963f, -0.0998046f, -0.153398f),
+	float4(0.0531486f, -0.051094f, -0.121915f, -0.0590992f), float4(-0.113046f, -0.075215f, -0.0661228f, 0.226322f),
+	float4(0.539588f, -0.0691329f, -0.086171f, 0.295095f), float4(0.605379f, -0.0623847f, -0.0719458f, -0.17047f),
+	float4(0.0382014f, -0.169206f, -0.0667078f, 0.615466f), float4(0.255002f, -0.0822499f, -0.0741143f, 0.492127f),
+	float4(0.209901f, -0.0535723f, -0.0652421f, -0.103044f), float4(-0.0544793f, -0.11117f, -0.0473752f, 0.0484311f),
+	float4(-0.140793f, -0.0885067f, -0.150581f, 0.195872f), float4(0.521313f, 0.295499f, -0.111537f, -0.118863f),
+	float4(0.151087f, 0.402902f, 0.256599f, -0.0734891f), float4(-0.0854513f, -0.0668932f, -0.0905304f, -0.061055f),
+	float4(-0.117514f, -0.0973395f, -0.144326f, 0.131681f), float4(0.486144f, 0.424818f, -0.130096f, -0.105935f),
+	float4(0.0841391f, 0.35267f, 0.28961f, -0.0978784f), float4(-0.0755012f, -0.0578242f, -0.0904936f, -0.0959541f),
+	float4(-0.0894207f, -0.107176f, -0.129615f, 0.418175f), float4(0.480711f, 0.133088f, -0.137249f, -0.0515751f),
+	float4(-0.0900205f, 0.297464f, 0.357205f, 0.0858919f), float4(-0.108135f, -0.101819f, -0.0747435f, -0.074676f),
+	float4(-0.101302f, -0.15464f, -0.110689f, 0.292799f), float4(0.516637f, 0.194927f, -0.149944f, -0.0759487f),
+	float4(0.256589f, 0.404318f, 0.151301f, -0.119608f), float4(-0.06904f, -0.0827209f, -0.0620463f, -0.0892816f),
+	float4(0.0385355f, -0.065119f, -0.170416f, -0.0734493f), float4(-0.0812809f, 0.255128f, 0.615397f, -0.0653578f),
+	float4(-0.0542728f, 0.209729f, 0.492432f, -0.0547134f), float4(-0.102903f, -0.0474906f, -0.111127f, 0.0483965f),
+	float4(0.0483733f, -0.176021f, -0.0718241f, 0.0790129f), float4(0.0525647f, -0.0333146f, 0.644784f, 0.30668f),
+	float4(-0.090855f, -0.080223f, 0.0309248f, 0.364126f), float4(0.161837f, -0.0502965f, -0.158367f, -0.075685f),
+	float4(-0.0554874f, -0.1533f, -0.0855383f, 0.0943907f), float4(-0.149748f, 0.180219f, 0.568249f, 0.333826f),
+	float4(-0.129097f, -0.0832738f, 0.1125f, 0.296117f), float4(0.203605f, -0.0885702f, -0.140783f, -0.0808773f),
+	float4(-0.166149f, -0.143912f, 0.0637755f, 0.0868066f), float4(-0.0589603f, -0.186026f, 0.12585f, 0.5275f),
+	float4(0.458848f, -0.140762f, -0.0932663f, 0.2921f), float4(0.306573f, -0.079132f, -0.134954f, -0.123018f),
+	float4(-0.121767f, -0.137342f, 0.0825451f, 0.0686262f), float4(-0.144901f, 0.0565734f, 0.492132f, 0.477882f),
+	float4(0.114193f, -0.168551f, -0.0790649f, 0.273908f), float4(0.263176f, -0.0841846f, -0.109628f, -0.12157f),
+	float4(-0.0866965f, -0.14955f, -0.054336f, 0.094381f), float4(-0.137997f, 0.337075f, 0.563482f, 0.178705f),
+	float4(-0.14851f, -0.0796274f, 0.205157f, 0.293664f), float4(0.111548f, -0.0826018f, -0.0817191f, -0.139313f),
+	float4(0.0486978f, -0.0720701f, -0.175831f, -0.0332058f), float4(0.0525422f, 0.0789756f, 0.033147f, -0.0810235f),
+	float4(-0.0897207f, 0.307043f, 0.644492f, -0.0506817f), float4(0.162061f, 0.363972f, -0.0757951f, -0.158272f),
+	float4(0.0362317f, 0.0142931f, -0.0161935f, -0.132518f), float4(-0.0614259f, 0.0221629f, 0.0178561f, 0.21691f),
+	float4(0.107878f, -0.0541613f, -0.0164887f, 0.69941f), float4(0.328362f, -0.0956932f, -0.0768018f, 0.0292268f),
+	float4(0.0315165f, -0.0398145f, -0.116474f, -0.065319f), float4(0.0315092f, -0.0478319f, 0.058808f, 0.216291f),
+	float4(0.0840211f, -0.1487f, 0.207204f, 0.613952f), float4(0.343271f, -0.0318404f, -0.130812f, 0.0415853f),
+	float4(-0.109469f, -0.093584f, -0.0651265f, 0.0678116f), float4(0.184119f, 0.126739f, -0.0534153f, 0.0430286f),
+	float4(-0.0600601f, -0.177876f, 0.149623f, 0.548885f), float4(0.488978f, -0.155589f, -0.0424411f, 0.0503726f),
+	float4(-0.100321f, -0.0993527f, -0.0534512f, 0.133395f), float4(0.190019f, 0.0689342f, -0.0669796f, 0.050387f),
+	float4(-0.0424315f, -0.155586f, 0.48625f, 0.546155f), float4(0.14901f, -0.176769f, -0.059712f, 0.0427128f),
+	float4(0.0336853f, -0.0661126f, -0.115305f, -0.0394437f), float4(-0.031238f, 0.0836426f, 0.216894f, 0.0590418f),
+	float4(-0.0479981f, 0.0415728f, -0.129915f, -0.0309376f), float4(0.343477f, 0.613591f, 0.20709f, -0.148599f),
+	float4(0.01436f, 0.0361797f, -0.0161875f, 0.0180692f), float4(0.0218574f, -0.0615234f, -0.132439f, -0.0163865f),
+	float4(-0.0543163f, 0.107817f, 0.216952f, 0.0289901f), float4(-0.0768569f, -0.0955998f, 0.328391f, 0.699384f),
+	float4(0.914577f, 0.194366f, -0.16472f, 0.0361438f), float4(0.0155497f, -0.0110351f, 0.0322894f, 0.0357117f),
+	float4(-0.0248622f, 0.00718733f, -0.0645743f, -0.0261001f), float4(0.00705569f, 0.0536707f, 0.0172726f, -0.0198893f),
+	float4(-0.237761f, 0.637739f, 0.805768f, -0.176727f), float4(-0.0760498f, 0.0539762f, 0.0518349f, -0.0213578f),
+	float4(0.0184453f, -0.0292434f, -0.0453259f, 0.024331f), float4(-0.0182396f, 0.0305895f, 0.0340578f, -0.0181786f),
+	float4(0.0544041f, -0.145876f, 0.0468759f, 0.907407f), float4(0.281738f, -0.199946f, 0.0193594f, 0.0393163f),
+	float4(-0.0180612f, 0.047958f, 0.0214708f, -0.0760296f), float4(-0.0218847f, 0.057165f, 0.0226075f, -0.0227822f),
+	float4(0.039326f, -0.244647f, 0.533899f, 0.869799f), float4(-0.0836681f, -0.170724f, 0.0783701f, 0.0179973f),
+	float4(0.0325025f, -0.0163914f, 0.0198808f, -0.0297153f), float4(-0.0580531f, 0.0231252f, 0.0451468f, -0.0160566f),
+	float4(0.0783961f, -0.170707f, -0.083671f, 0.869786f), float4(0.533921f, -0.244598f, 0.03917f, -0.0162958f),
+	float4(0.0323349f, 0.0182489f, -0.0580879f, -0.0296667f), float4(0.0202025f, 0.045227f, 0.0230007f, -0.0160626f),
+	float4(-0.0180584f, 0.0392941f, 0.0193407f, -0.199896f), float4(0.281666f, 0.907229f, 0.0475858f, -0.145307f),
+	float4(0.0542024f, 0.0205582f, 0.0460699f, -0.0220639f), float4(-0.0772248f, 0.0230569f, 0.058067f, -0.0227376f),
+	float4(0.0537753f, -0.0757601f, -0.17604f, 0.802648f), float4(0.635236f, -0.236927f, 0.0543571f, -0.0187351f),
+	float4(0.0291288f, -0.0570573f, -0.0422286f, -0.0218055f), float4(0.0434808f, 0.0425148f, -0.0163297f, -0.0169994f),
+	float4(-0.0110005f, 0.0154975f, 0.0360068f, -0.164145f), float4(0.195518f, 0.916261f, 0.0112494f, -0.0184002f),
+	float4(0.0462794f, -0.00796507f, 0.0176016f, -0.015094f), float4(-0.0597242f, -0.00998095f, 0.0503874f, -0.0186611f),
+	float4(-0.261806f, -0.0479917f, 0.0556315f, 1.03587f), float4(0.166677f, -0.169605f, 0.0335008f, 0.361336f),
+	float4(0.124483f, -0.0676794f, 0.0253985f, -0.302139f), float4(-0.0754848f, 0.0305448f, 0.11139f, 0.027062f),
+	float4(-0.173114f, -0.205749f, -0.258334f, 0.77103f), float4(0.871091f, -0.171975f, -0.0841805f, -0.0792586f),
+	float4(0.190235f, 0.280596f, -0.115119f, 0.0838661f), float4(-0.194976f, -0.213991f, 0.0863006f, 0.081925f),
+	float4(-0.270583f, -0.0848407f, 0.0602934f, 0.0627076f), float4(-0.186557f, 0.0537455f, 1.00133f, 0.305181f),
+	float4(-0.215157f, 0.413426f, 0.105756f, -0.0752088f), float4(-0.311081f, -0.112879f, 0.0736108f, 0.124382f),
+	float4(-0.127829f, -0.208013f, -0.245236f, 0.572957f), float4(0.929077f, -0.0665451f, -0.149182f, 0.0644719f),
+	float4(-0.0972431f, 0.191017f, 0.353657f, 0.0753374f), float4(-0.150663f, -0.27315f, 0.0635728f, 0.0971946f),
+	float4(-0.208227f, -0.127515f, 0.0641837f, -0.149422f), float4(-0.0664616f, 0.929526f, 0.572289f, -0.246483f),
+	float4(0.35377f, 0.19085f, -0.0982903f, -0.273393f), float4(-0.15028f, 0.0760711f, 0.0971837f, 0.0635737f),
+	float4(0.0611741f, -0.0860845f, -0.273425f, 0.0590883f), float4(-0.217081f, 0.307914f, 1.00665f, -0.167381f),
+	float4(0.0698246f, -0.0757033f, 0.106442f, 0.417748f), float4(0.0746412f, -0.114424f, -0.314165f, 0.12351f),
+	float4(-0.261256f, -0.197119f, 0.10267f, -0.0955295f), float4(-0.194833f, 0.987054f, 0.696024f, -0.289007f),
+	float4(-0.130363f, 0.317437f, 0.212998f, -0.0930034f), float4(0.0971082f, -0.240998f, -0.21983f, 0.0979415f),
+	float4(0.0374097f, -0.0576457f, -0.243714f, 0.0413768f), float4(-0.207376f, 0.252623f, 0.99817f, 0.0290308f),
+	float4(-0.0767236f, 0.110065f, 0.346949f, 0.038336f), float4(-0.0630993f, -0.29094f, 0.0203747f, 0.10788f),
+	float4(0.0888285f, -0.0207165f, -0.352599f, -0.0497467f), float4(0.0654959f, 0.597959f, 0.0814867f, -0.101387f),
+	float4(0.878068f, 0.178792f, -0.135021f, 0.0335046f), float4(-0.322633f, -0.064928f, 0.0548375f, 0.0454414f),
+	float4(0.0663902f, -0.254297f, -0.282898f, -0.159348f), float4(0.462274f, 0.537516f, -0.0893241f, -0.216904f),
+	float4(0.608314f, 0.682754f, -0.167166f, -0.0945794f), float4(0.0668553f, -0.205349f, -0.257532f, 0.0718369f),
+	float4(0.0986455f, 0.0977762f, -0.365581f, -0.110653f), float4(0.0814351f, -0.120911f, 0.564485f, 0.201515f),
+	float4(-0.138914f, -0.174232f, 0.890062f, 0.31734f), float4(-0.223314f, -0.356666f, -0.106486f, 0.0727454f),
+	float4(0.0992761f, -0.200411f, -0.331665f, -0.164574f), float4(0.356371f, 0.54058f, -0.130262f, -0.24632f),
+	float4(0.481712f, 0.868714f, -0.114329f, -0.162912f), float4(0.0835986f, 0.116368f, -0.204239f, -0.308697f),
+	float4(-0.33191f, -0.200041f, 0.0998637f, -0.13023f), float4(0.540517f, 0.356461f, -0.163787f, 0.0834841f),
+	float4(-0.163033f, -0.114285f, 0.868887f, 0.481439f), float4(-0.246734f, -0.308555f, -0.204448f, 0.114865f),
+	float4(0.100055f, 0.0823758f, -0.111997f, -0.367902f), float4(0.089748f, -0.138674f, 0.201192f, 0.561759f),
+	float4(-0.120773f, -0.223939f, 0.318268f, 0.891589f), float4(-0.17567f, -0.105968f, -0.352383f, 0.0835623f),
+	float4(0.0857145f, -0.323084f, -0.234283f, -0.0869701f), float4(0.530986f, 0.460037f, -0.156335f, -0.0965621f),
+	float4(-0.167357f, 0.68533f, 0.613509f, -0.220648f), float4(0.0895338f, -0.255203f, -0.243339f, 0.0765664f),
+	float4(0.0833793f, 0.0799699f, -0.0789106f, -0.3403f), float4(-0.0991397f, 0.0855143f, 0.603087f, 0.0195637f),
+	float4(0.0338482f, -0.136591f, 0.174952f, 0.87417f), float4(0.0547893f, -0.0558431f, -0.323896f, 0.0447728f),
+	float4(-0.0236762f, 0.0935195f, -0.157982f, -0.0269055f), float4(0.021005f, 0.122475f, 0.0388318f, -0.0329213f),
+	float4(1.03913f, 0.212892f, -0.175708f, 0.0319268f), float4(-0.146166f, -0.0343863f, 0.0442586f, -0.0250333f),
+	float4(0.0602872f, 0.0671134f, 0.0400999f, -0.109383f), float4(-0.127361f, 0.0633364f, 0.140479f, -0.0430222f),
+	float4(-0.234649f, 0.669505f, 0.869125f, -0.158907f), float4(-0.0699324f, 0.0520972f, -0.10751f, -0.0357171f),
+	float4(0.101021f, -0.155952f, -0.0504709f, 0.0433709f), float4(0.1458f, 0.0501626f, -0.145998f, 1.05235f),
+	float4(0.302493f, -0.227746f, 0.0591291f, 0.0659648f), float4(-0.0390254f, -0.148654f, -0.0434894f, 0.0452256f),
+	float4(0.0574967f, 0.0925857f, -0.102744f, -0.150216f), float4(0.102215f, 0.102597f, -0.300335f, 0.663707f),
+	float4(0.964895f, -0.0895842f, -0.249517f, 0.110711f), float4(0.0570245f, -0.142347f, -0.114213f, 0.0818996f),
+	float4(0.092578f, -0.150148f, -0.10282f, 0.102453f), float4(0.102425f, 0.112624f, -0.249012f, -0.0897742f),
+	float4(0.964245f, 0.664675f, -0.295281f, 0.0584753f), float4(0.0820297f, -0.11435f, -0.142097f, 0.0598178f),
+	float4(0.0999842f, 0.0431017f, -0.050198f, -0.152883f), float4(0.0362957f, 0.144738f, 0.0584767f, -0.225398f),
+	float4(0.299317f, 1.03491f, 0.0903601f, -0.203294f), float4(0.0718045f, -0.15765f, -0.0427241f, 0.0464482f),
+	float4(0.0877555f, 0.0640625f, -0.143472f, -0.125263f), float4(-0.0543925f, 0.160223f, 0.0709164f, 0.0666218f),
+	float4(-0.0880835f, -0.214115f, 0.854955f, 0.782607f), float4(-0.275044f, 0.0586086f, -0.136127f, -0.09641f),
+	float4(0.0907129f, 0.0240617f, -0.0246185f, -0.160601f), float4(-0.0366663f, 0.0380101f, 0.124293f, 0.0433664f),
+	float4(-0.173196f, 0.189765f, 1.04684f, 0.025265f), float4(-0.145064f, -0.0339947f, 0.0438932f, -0.026073f),
+	float4(-0.026073f, 0.0438932f, -0.0339947f, -0.145064f), float4(0.025265f, 1.04684f, 0.189765f, -0.173196f),
+	float4(0.0433664f, 0.124293f, 0.0380101f, -0.0366663f), float4(-0.160601f, -0.0246185f, 0.0240617f, 0.0907129f),
+	float4(-0.09641f, -0.136127f, 0.0586086f, -0.275044f), float4(0.782607f, 0.854955f, -0.214115f, -0.0880835f),
+	float4(0.0666218f, 0.0709164f, 0.160223f, -0.0543925f), float4(-0.125263f, -0.143472f, 0.0640625f, 0.0877555f),
+	float4(0.0464482f, -0.0427241f, -0.15765f, 0.0718045f), float4(-0.203294f, 0.0903601f, 1.03491f, 0.299317f),
+	float4(-0.225398f, 0.0584767f, 0.144738f, 0.0362957f), float4(-0.152883f, -0.050198f, 0.0431017f, 0.0999842f),
+	float4(0.0598178f, -0.142097f, -0.11435f, 0.0820297f), float4(0.0584753f, -0.295281f, 0.664675f, 0.964245f),
+	float4(-0.0897742f, -0.249012f, 0.112624f, 0.102425f), float4(0.102453f, -0.10282f, -0.150148f, 0.092578f),
+	float4(0.0818996f, -0.114213f, -0.142347f, 0.0570245f), float4(0.110711f, -0.249517f, -0.0895842f, 0.964895f),
+	float4(0.663707f, -0.300335f, 0.102597f, 0.102215f), float4(-0.150216f, -0.102744f, 0.0925857f, 0.0574967f),
+	float4(0.0452256f, -0.0434894f, -0.148654f, -0.0390254f), float4(0.0659648f, 0.0591291f, -0.227746f, 0.302493f),
+	float4(1.05235f, -0.145998f, 0.0501626f, 0.1458f), float4(0.0433709f, -0.0504709f, -0.155952f, 0.101021f),
+	float4(-0.0357171f, -0.10751f, 0.0520972f, -0.0699324f), float4(-0.158907f, 0.869125f, 0.669505f, -0.234649f),
+	float4(-0.0430222f, 0.140479f, 0.0633364f, -0.127361f), float4(-0.109383f, 0.0400999f, 0.0671134f, 0.0602872f),
+	float4(-0.0250333f, 0.0442586f, -0.0343863f, -0.146166f), float4(0.0319268f, -0.175708f, 0.212892f, 1.03913f),
+	float4(-0.0329213f, 0.0388318f, 0.122475f, 0.021005f), float4(-0.0269055f, -0.157982f, 0.0935195f, -0.0236762f),
+	float4(0.0447728f, -0.323896f, -0.0558431f, 0.0547893f), float4(0.87417f, 0.174952f, -0.136591f, 0.0338482f),
+	float4(0.0195637f, 0.603087f, 0.0855143f, -0.0991397f), float4(-0.3403f, -0.0789106f, 0.0799699f, 0.0833793f),
+	float4(0.0765664f, -0.243339f, -0.255203f, 0.0895338f), float4(-0.220648f, 0.613509f, 0.68533f, -0.167357f),
+	float4(-0.0965621f, -0.156335f, 0.460037f, 0.530986f), float4(-0.0869701f, -0.234283f, -0.323084f, 0.0857145f),
+	float4(0.0835623f, -0.352383f, -0.105968f, -0.17567f), float4(0.891589f, 0.318268f, -0.223939f, -0.120773f),
+	float4(0.561759f, 0.201192f, -0.138674f, 0.089748f), float4(-0.367902f, -0.111997f, 0.0823758f, 0.100055f),
+	float4(0.114865f, -0.204448f, -0.308555f, -0.246734f), float4(0.481439f, 0.868887f, -0.114285f, -0.163033f),
+	float4(0.0834841f, -0.163787f, 0.356461f, 0.540517f), float4(-0.13023f, 0.0998637f, -0.200041f, -0.33191f),
+	float4(-0.308697f, -0.204239f, 0.116368f, 0.0835986f), float4(-0.162912f, -0.114329f, 0.868714f, 0.481712f),
+	float4(-0.24632f, -0.130262f, 0.54058f, 0.356371f), float4(-0.164574f, -0.331665f, -0.200411f, 0.0992761f),
+	float4(0.0727454f, -0.106486f, -0.356666f, -0.223314f), float4(0.31734f, 0.890062f, -0.174232f, -0.138914f),
+	float4(0.201515f, 0.564485f, -0.120911f, 0.0814351f), float4(-0.110653f, -0.365581f, 0.0977762f, 0.0986455f),
+	float4(0.0718369f, -0.257532f, -0.205349f, 0.0668553f), float4(-0.0945794f, -0.167166f, 0.682754f, 0.608314f),
+	float4(-0.216904f, -0.0893241f, 0.537516f, 0.462274f), float4(-0.159348f, -0.282898f, -0.254297f, 0.0663902f),
+	float4(0.0454414f, 0.0548375f, -0.064928f, -0.322633f), float4(0.0335046f, -0.135021f, 0.178792f, 0.878068f),
+	float4(-0.101387f, 0.0814867f, 0.597959f, 0.0654959f), float4(-0.0497467f, -0.352599f, -0.0207165f, 0.0888285f),
+	float4(0.10788f, 0.0203747f, -0.29094f, -0.0630993f), float4(0.038336f, 0.346949f, 0.110065f, -0.0767236f),
+	float4(0.0290308f, 0.99817f, 0.252623f, -0.207376f), float4(0.0413768f, -0.243714f, -0.0576457f, 0.0374097f),
+	float4(0.0979415f, -0.21983f, -0.240998f, 0.0971082f), float4(-0.0930034f, 0.212998f, 0.317437f, -0.130363f),
+	float4(-0.289007f, 0.696024f, 0.987054f, -0.194833f), float4(-0.0955295f, 0.10267f, -0.197119f, -0.261256f),
+	float4(0.12351f, -0.314165f, -0.114424f, 0.0746412f), float4(0.417748f, 0.106442f, -0.0757033f, 0.0698246f),
+	float4(-0.167381f, 1.00665f, 0.307914f, -0.217081f), float4(0.0590883f, -0.273425f, -0.0860845f, 0.0611741f),
+	float4(0.0635737f, 0.0971837f, 0.0760711f, -0.15028f), float4(-0.273393f, -0.0982903f, 0.19085f, 0.35377f),
+	float4(-0.246483f, 0.572289f, 0.929526f, -0.0664616f), float4(-0.149422f, 0.0641837f, -0.127515f, -0.208227f),
+	float4(0.0971946f, 0.0635728f, -0.27315f, -0.150663f), float4(0.0753374f, 0.353657f, 0.191017f, -0.0972431f),
+	float4(0.0644719f, -0.149182f, -0.0665451f, 0.929077f), float4(0.572957f, -0.245236f, -0.208013f, -0.127829f),
+	float4(0.124382f, 0.0736108f, -0.112879f, -0.311081f), float4(-0.0752088f, 0.105756f, 0.413426f, -0.215157f),
+	float4(0.305181f, 1.00133f, 0.0537455f, -0.186557f), float4(0.0627076f, 0.0602934f, -0.0848407f, -0.270583f),
+	float4(0.081925f, 0.0863006f, -0.213991f, -0.194976f), float4(0.0838661f, -0.115119f, 0.280596f, 0.190235f),
+	float4(-0.0792586f, -0.0841805f, -0.171975f, 0.871091f), float4(0.77103f, -0.258334f, -0.205749f, -0.173114f),
+	float4(0.027062f, 0.11139f, 0.0305448f, -0.0754848f), float4(-0.302139f, 0.0253985f, -0.0676794f, 0.124483f),
+	float4(0.361336f, 0.0335008f, -0.169605f, 0.166677f), float4(1.03587f, 0.0556315f, -0.0479917f, -0.261806f),
+	float4(-0.0186611f, 0.0503874f, -0.00998095f, -0.0597242f), float4(-0.015094f, 0.0176016f, -0.00796507f, 0.0462794f),
+	float4(-0.0184002f, 0.0112494f, 0.916261f, 0.195518f), float4(-0.164145f, 0.0360068f, 0.0154975f, -0.0110005f),
+	float4(-0.0169994f, -0.0163297f, 0.0425148f, 0.0434808f), float4(-0.0218055f, -0.0422286f, -0.0570573f, 0.0291288f),
+	float4(-0.0187351f, 0.0543571f, -0.236927f, 0.635236f), float4(0.802648f, -0.17604f, -0.0757601f, 0.0537753f),
+	float4(-0.0227376f, 0.058067f, 0.0230569f, -0.0772248f), float4(-0.0220639f, 0.0460699f, 0.0205582f, 0.0542024f),
+	float4(-0.145307f, 0.0475858f, 0.907229f, 0.281666f), float4(-0.199896f, 0.0193407f, 0.0392941f, -0.0180584f),
+	float4(-0.0160626f, 0.0230007f, 0.045227f, 0.0202025f), float4(-0.0296667f, -0.0580879f, 0.0182489f, 0.0323349f),
+	float4(-0.0162958f, 0.03917f, -0.244598f, 0.533921f), float4(0.869786f, -0.083671f, -0.170707f, 0.0783961f),
+	float4(-0.0160566f, 0.0451468f, 0.0231252f, -0.0580531f), float4(-0.0297153f, 0.0198808f, -0.0163914f, 0.0325025f),
+	float4(0.0179973f, 0.0783701f, -0.170724f, -0.0836681f), float4(0.869799f, 0.533899f, -0.244647f, 0.039326f),
+	float4(-0.0227822f, 0.0226075f, 0.057165f, -0.0218847f), float4(-0.0760296f, 0.0214708f, 0.047958f, -0.0180612f),
+	float4(0.0393163f, 0.0193594f, -0.199946f, 0.281738f), float4(0.907407f, 0.0468759f, -0.145876f, 0.0544041f),
+	float4(-0.0181786f, 0.0340578f, 0.0305895f, -0.0182396f), float4(0.024331f, -0.0453259f, -0.0292434f, 0.0184453f),
+	float4(-0.0213578f, 0.0518349f, 0.0539762f, -0.0760498f), float4(-0.176727f, 0.805768f, 0.637739f, -0.237761f),
+	float4(-0.0198893f, 0.0172726f, 0.0536707f, 0.00705569f), float4(-0.0261001f, -0.0645743f, 0.00718733f, -0.0248622f),
+	float4(0.0357117f, 0.0322894f, -0.0110351f, 0.0155497f), float4(0.0361438f, -0.16472f, 0.194366f, 0.914577f),
+};
+
+#define WEIGHT_GRID_COUNT_12X12 4
+#define MAX_GRID_WEIGHTS_12X12 64
+static const uint4 weight_grids_12x12[WEIGHT_GRID_COUNT_12X12] = { uint4(4, 4, 0, 0), uint4(5, 5, 16, 144), uint4(6, 6, 41, 288), uint4(8, 8, 77, 432) };
+static const uint4 decimation_idx_12x12[141] =
+{
+	uint4(0, 1, 12, 13), uint4(3, 4, 15, 16), uint4(7, 8, 19, 20), uint4(11, 11, 23, 23),
+	uint4(36, 37, 48, 49), uint4(39, 40, 51, 52), uint4(43, 44, 55, 56), uint4(47, 47, 59, 59),
+	uint4(84, 85, 96, 97), uint4(87, 88, 99, 100), uint4(91, 92, 103, 104), uint4(95, 95, 107, 107),
+	uint4(132, 133, 132, 133), uint4(135, 136, 135, 136), uint4(139, 140, 139, 140), uint4(143, 143, 143, 143),
+	uint4(0, 1, 12, 13), uint4(2, 3, 14, 15), uint4(5, 6, 17, 18), uint4(8, 9, 20, 21),
+	uint4(11, 11, 23, 23), uint4(24, 25, 36, 37), uint4(26, 27, 38, 39), uint4(29, 30, 41, 42),
+	uint4(32, 33, 44, 45), uint4(35, 35, 47, 47), uint4(60, 61, 72, 73), uint4(62, 63, 74, 75),
+	uint4(65, 66, 77, 78), uint4(68, 69, 80, 81), uint4(71, 71, 83, 83), uint4(96, 97, 108, 109),
+	uint4(98, 99, 110, 111), uint4(101, 102, 113, 114), uint4(104, 105, 116, 117), uint4(107, 107, 119, 119),
+	uint4(132, 133, 132, 133), uint4(134, 135, 134, 135), uint4(137, 138, 137, 138), uint4(140, 141, 140, 141),
+	uint4(143, 143, 143, 143), uint4(0, 1, 12, 13), uint4(2, 3, 14, 15), uint4(4, 5, 16, 17),
+	uint4(6, 7, 18, 19), uint4(8, 9, 20, 21), uint4(11, 11, 23, 23), uint4(24, 25, 36, 37),
+	uint4(26, 27, 38, 39), uint4(28, 29, 40, 41), uint4(30, 31, 42, 43), uint4(32, 33, 44, 45),
+	uint4(35, 35, 47, 47), uint4(48, 49, 60, 61), uint4(50, 51, 62, 63), uint4(52, 53, 64, 65),
+	uint4(54, 55, 66, 67), uint4(56, 57, 68, 69), uint4(59, 59, 71, 71), uint4(72, 73, 84, 85),
+	uint4(74, 75, 86, 87), uint4(76, 77, 88, 89), uint4(78, 79, 90, 91), uint4(80, 81, 92, 93),
+	uint4(83, 83, 95, 95), uint4(96, 97, 108, 109), uint4(98, 99, 110, 111), uint4(100, 101, 112, 113),
+	uint4(102, 103, 114, 115), uint4(104, 105, 116, 117), uint4(107, 107, 119, 119), uint4(132, 133, 132, 133),
+	uint4(134, 135, 134, 135), uint4(136, 137, 136, 137), uint4(138, 139, 138, 139), uint4(140, 141, 140, 141),
+	uint4(143, 143, 143, 143), uint4(0, 1, 12, 13), uint4(1, 2, 13, 14), uint4(3, 4, 15, 16),
+	uint4(4, 5, 16, 17), uint4(6, 7, 18, 19), uint4(7, 8, 19, 20), uint4(9, 10, 21, 22),
+	uint4(11, 11, 23, 23), uint4(12, 13, 24, 25), uint4(13, 14, 25, 26), uint4(15, 16, 27, 28),
+	uint4(16, 17, 28, 29), uint4(18, 19, 30, 31), uint4(19, 20, 31, 32), uint4(21, 22, 33, 34),
+	uint4(23, 23, 35, 35), uint4(36, 37, 48, 49), uint4(37, 38, 49, 50), uint4(39, 40, 51, 52),
+	uint4(40, 41, 52, 53), uint4(42, 43, 54, 55), uint4(43, 44, 55, 56), uint4(45, 46, 57, 58),
+	uint4(47, 47, 59, 59), uint4(48, 49, 60, 61), uint4(49, 50, 61, 62), uint4(51, 52, 63, 64),
+	uint4(52, 53, 64, 65), uint4(54, 55, 66, 67), uint4(55, 56, 67, 68), uint4(57, 58, 69, 70),
+	uint4(59, 59, 71, 71), uint4(72, 73, 84, 85), uint4(73, 74, 85, 86), uint4(75, 76, 87, 88),
+	uint4(76, 77, 88, 89), uint4(78, 79, 90, 91), uint4(79, 80, 91, 92), uint4(81, 82, 93, 94),
+	uint4(83, 83, 95, 95), uint4(84, 85, 96, 97), uint4(85, 86, 97, 98), uint4(87, 88, 99, 100),
+	uint4(88, 89, 100, 101), uint4(90, 91, 102, 103), uint4(91, 92, 103, 104), uint4(93, 94, 105, 106),
+	uint4(95, 95, 107, 107), uint4(108, 109, 120, 121), uint4(109, 110, 121, 122), uint4(111, 112, 123, 124),
+	uint4(112, 113, 124, 125), uint4(114, 115, 126, 127), uint4(115, 116, 127, 128), uint4(117, 118, 129, 130),
+	uint4(119, 119, 131, 131), uint4(132, 133, 132, 133), uint4(133, 134, 133, 134), uint4(135, 136, 135, 136),
+	uint4(136, 137, 136, 137), uint4(138, 139, 138, 139), uint4(139, 140, 139, 140), uint4(141, 142, 141, 142),
+	uint4(143, 143, 143, 143),
+};
+static const float4 decimation_wt_12x12[141] =
+{
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.333333254f, 0.666666746f, 0.0f, 0.0f),
+	float4(0.666666508f, 0.333333492f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.333333254f, 0.0f, 0.666666746f, 0.0f), float4(0.11111106f, 0.222222194f, 0.222222194f, 0.444444537f),
+	float4(0.22222212f, 0.111111134f, 0.444444388f, 0.222222358f), float4(0.333333254f, 0.0f, 0.666666746f, 0.0f),
+	float4(0.666666508f, 0.0f, 0.333333492f, 0.0f), float4(0.22222212f, 0.444444388f, 0.111111134f, 0.222222358f),
+	float4(0.444444239f, 0.222222269f, 0.222222269f, 0.111111216f), float4(0.666666508f, 0.0f, 0.333333492f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.333333254f, 0.666666746f, 0.0f, 0.0f),
+	float4(0.666666508f, 0.333333492f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.25f, 0.75f, 0.0f, 0.0f),
+	float4(0.5f, 0.5f, 0.0f, 0.0f), float4(0.75f, 0.25f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.25f, 0.0f, 0.75f, 0.0f),
+	float4(0.0625f, 0.1875f, 0.1875f, 0.5625f), float4(0.125f, 0.125f, 0.375f, 0.375f),
+	float4(0.1875f, 0.0625f, 0.5625f, 0.1875f), float4(0.25f, 0.0f, 0.75f, 0.0f),
+	float4(0.5f, 0.0f, 0.5f, 0.0f), float4(0.125f, 0.375f, 0.125f, 0.375f),
+	float4(0.25f, 0.25f, 0.25f, 0.25f), float4(0.375f, 0.125f, 0.375f, 0.125f),
+	float4(0.5f, 0.0f, 0.5f, 0.0f), float4(0.75f, 0.0f, 0.25f, 0.0f),
+	float4(0.1875f, 0.5625f, 0.0625f, 0.1875f), float4(0.375f, 0.375f, 0.125f, 0.125f),
+	float4(0.5625f, 0.1875f, 0.1875f, 0.0625f), float4(0.75f, 0.0f, 0.25f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.25f, 0.75f, 0.0f, 0.0f),
+	float4(0.5f, 0.5f, 0.0f, 0.0f), float4(0.75f, 0.25f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.799999952f, 0.200000048f, 0.0f, 0.0f), float4(0.599999905f, 0.400000095f, 0.0f, 0.0f),
+	float4(0.400000095f, 0.599999905f, 0.0f, 0.0f), float4(0.199999809f, 0.800000191f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.799999952f, 0.0f, 0.200000048f, 0.0f),
+	float4(0.639999926f, 0.160000026f, 0.160000026f, 0.0400000177f), float4(0.4799999f, 0.320000052f, 0.120000012f, 0.0800000355f),
+	float4(0.320000052f, 0.4799999f, 0.0800000355f, 0.120000012f), float4(0.159999833f, 0.640000105f, 0.039999973f, 0.160000071f),
+	float4(0.799999952f, 0.0f, 0.200000048f, 0.0f), float4(0.599999905f, 0.0f, 0.400000095f, 0.0f),
+	float4(0.4799999f, 0.120000012f, 0.320000052f, 0.0800000355f), float4(0.359999895f, 0.240000024f, 0.240000024f, 0.160000071f),
+	float4(0.240000024f, 0.359999895f, 0.160000071f, 0.240000024f), float4(0.119999863f, 0.480000049f, 0.0799999461f, 0.320000142f),
+	float4(0.599999905f, 0.0f, 0.400000095f, 0.0f), float4(0.400000095f, 0.0f, 0.599999905f, 0.0f),
+	float4(0.320000052f, 0.0800000355f, 0.4799999f, 0.120000012f), float4(0.240000024f, 0.160000071f, 0.359999895f, 0.240000024f),
+	float4(0.160000071f, 0.240000024f, 0.240000024f, 0.359999895f), float4(0.0799999461f, 0.320000142f, 0.119999863f, 0.480000049f),
+	float4(0.400000095f, 0.0f, 0.599999905f, 0.0f), float4(0.199999809f, 0.0f, 0.800000191f, 0.0f),
+	float4(0.159999833f, 0.039999973f, 0.640000105f, 0.160000071f), float4(0.119999863f, 0.0799999461f, 0.480000049f, 0.320000142f),
+	float4(0.0799999461f, 0.119999863f, 0.320000142f, 0.480000049f), float4(0.0399999246f, 0.159999892f, 0.159999892f, 0.640000284f),
+	float4(0.199999809f, 0.0f, 0.800000191f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.799999952f, 0.200000048f, 0.0f, 0.0f), float4(0.599999905f, 0.400000095f, 0.0f, 0.0f),
+	float4(0.400000095f, 0.599999905f, 0.0f, 0.0f), float4(0.199999809f, 0.800000191f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.428571463f, 0.571428537f, 0.0f, 0.0f), float4(0.857142925f, 0.142857075f, 0.0f, 0.0f),
+	float4(0.285714149f, 0.714285851f, 0.0f, 0.0f), float4(0.714285851f, 0.285714149f, 0.0f, 0.0f),
+	float4(0.142857075f, 0.857142925f, 0.0f, 0.0f), float4(0.571428299f, 0.428571701f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.428571463f, 0.0f, 0.571428537f, 0.0f),
+	float4(0.183673501f, 0.244897962f, 0.244897962f, 0.326530576f), float4(0.367347002f, 0.0612244643f, 0.489795923f, 0.0816326067f),
+	float4(0.122448929f, 0.306122541f, 0.163265213f, 0.408163309f), float4(0.306122541f, 0.122448929f, 0.408163309f, 0.163265213f),
+	float4(0.0612244643f, 0.367347002f, 0.0816326067f, 0.489795923f), float4(0.244897857f, 0.183673605f, 0.326530427f, 0.244898096f),
+	float4(0.428571463f, 0.0f, 0.571428537f, 0.0f), float4(0.857142925f, 0.0f, 0.142857075f, 0.0f),
+	float4(0.367347002f, 0.489795923f, 0.0612244643f, 0.0816326067f), float4(0.734694004f, 0.122448929f, 0.122448929f, 0.0204081442f),
+	float4(0.244897857f, 0.612245083f, 0.0408162884f, 0.10204079f), float4(0.612245083f, 0.244897857f, 0.10204079f, 0.0408162884f),
+	float4(0.122448929f, 0.734694004f, 0.0204081442f, 0.122448929f), float4(0.489795715f, 0.367347211f, 0.0816325769f, 0.0612244979f),
+	float4(0.857142925f, 0.0f, 0.142857075f, 0.0f), float4(0.285714149f, 0.0f, 0.714285851f, 0.0f),
+	float4(0.122448929f, 0.163265213f, 0.306122541f, 0.408163309f), float4(0.244897857f, 0.0408162884f, 0.612245083f, 0.10204079f),
+	float4(0.0816325769f, 0.20408158f, 0.20408158f, 0.510204256f), float4(0.20408158f, 0.0816325769f, 0.510204256f, 0.20408158f),
+	float4(0.0408162884f, 0.244897857f, 0.10204079f, 0.612245083f), float4(0.163265154f, 0.122448996f, 0.40816316f, 0.30612269f),
+	float4(0.285714149f, 0.0f, 0.714285851f, 0.0f), float4(0.714285851f, 0.0f, 0.285714149f, 0.0f),
+	float4(0.306122541f, 0.408163309f, 0.122448929f, 0.163265213f), float4(0.612245083f, 0.10204079f, 0.244897857f, 0.0408162884f),
+	float4(0.20408158f, 0.510204256f, 0.0816325769f, 0.20408158f), float4(0.510204256f, 0.20408158f, 0.20408158f, 0.0816325769f),
+	float4(0.10204079f, 0.612245083f, 0.0408162884f, 0.244897857f), float4(0.40816316f, 0.30612269f, 0.163265154f, 0.122448996f),
+	float4(0.714285851f, 0.0f, 0.285714149f, 0.0f), float4(0.142857075f, 0.0f, 0.857142925f, 0.0f),
+	float4(0.0612244643f, 0.0816326067f, 0.367347002f, 0.489795923f), float4(0.122448929f, 0.0204081442f, 0.734694004f, 0.122448929f),
+	float4(0.0408162884f, 0.10204079f, 0.244897857f, 0.612245083f), float4(0.10204079f, 0.0408162884f, 0.612245083f, 0.244897857f),
+	float4(0.0204081442f, 0.122448929f, 0.122448929f, 0.734694004f), float4(0.0816325769f, 0.0612244979f, 0.489795715f, 0.367347211f),
+	float4(0.142857075f, 0.0f, 0.857142925f, 0.0f), float4(0.571428299f, 0.0f, 0.428571701f, 0.0f),
+	float4(0.244897857f, 0.326530427f, 0.183673605f, 0.244898096f), float4(0.489795715f, 0.0816325769f, 0.367347211f, 0.0612244979f),
+	float4(0.163265154f, 0.40816316f, 0.122448996f, 0.30612269f), float4(0.40816316f, 0.163265154f, 0.30612269f, 0.122448996f),
+	float4(0.0816325769f, 0.489795715f, 0.0612244979f, 0.367347211f), float4(0.326530308f, 0.244897991f, 0.244897991f, 0.18367371f),
+	float4(0.571428299f, 0.0f, 0.428571701f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.428571463f, 0.571428537f, 0.0f, 0.0f), float4(0.857142925f, 0.142857075f, 0.0f, 0.0f),
+	float4(0.285714149f, 0.714285851f, 0.0f, 0.0f), float4(0.714285851f, 0.285714149f, 0.0f, 0.0f),
+	float4(0.142857075f, 0.857142925f, 0.0f, 0.0f), float4(0.571428299f, 0.428571701f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f),
+};
+static const uint4 infill_idx_12x12[576] =
+{
+	uint4(0, 0, 0, 0), uint4(0, 1, 0, 0), uint4(0, 1, 0, 0), uint4(0, 1, 0, 0),
+	uint4(1, 2, 1, 1), uint4(1, 2, 1, 1), uint4(1, 2, 1, 1), uint4(1, 2, 1, 1),
+	uint4(2, 3, 2, 2), uint4(2, 3, 2, 2), uint4(2, 3, 2, 2), uint4(3, 3, 3, 3),
+	uint4(0, 0, 4, 0), uint4(0, 1, 4, 5), uint4(0, 1, 4, 5), uint4(0, 1, 4, 5),
+	uint4(1, 2, 5, 1), uint4(1, 2, 5, 6), uint4(1, 2, 5, 6), uint4(1, 2, 1, 6),
+	uint4(2, 3, 6, 7), uint4(2, 3, 6, 7), uint4(2, 3, 6, 7), uint4(3, 3, 7, 3),
+	uint4(0, 0, 4, 0), uint4(0, 1, 4, 5), uint4(0, 1, 4, 5), uint4(0, 1, 4, 5),
+	uint4(1, 1, 5, 6), uint4(1, 2, 5, 6), uint4(1, 2, 5, 6), uint4(1, 2, 5, 6),
+	uint4(2, 3, 6, 7), uint4(2, 3, 6, 7), uint4(2, 3, 6, 7), uint4(3, 3, 7, 3),
+	uint4(0, 0, 4, 0), uint4(0, 1, 4, 5), uint4(0, 1, 4, 5), uint4(0, 1, 4, 5),
+	uint4(1, 1, 5, 6), uint4(1, 2, 5, 6), uint4(1, 2, 5, 6), uint4(1, 2, 5, 6),
+	uint4(2, 3, 6, 7), uint4(2, 3, 6, 7), uint4(2, 3, 6, 7), uint4(3, 3, 7, 3),
+	uint4(4, 4, 8, 4), uint4(4, 5, 8, 4), uint4(4, 5, 4, 9), uint4(4, 5, 4, 9),
+	uint4(5, 6, 9, 5), uint4(5, 6, 9, 5), uint4(5, 6, 5, 10), uint4(5, 6, 5, 10),
+	uint4(6, 7, 10, 6), uint4(6, 7, 10, 6), uint4(6, 7, 6, 11), uint4(7, 7, 11, 7),
+	uint4(4, 4, 8, 4), uint4(4, 5, 8, 9), uint4(4, 5, 8, 9), uint4(4, 5, 8, 9),
+	uint4(5, 6, 9, 5), uint4(5, 6, 9, 10), uint4(5, 6, 9, 10), uint4(5, 6, 5, 10),
+	uint4(6, 7, 10, 11), uint4(6, 7, 10, 11), uint4(6, 7, 10, 11), uint4(7, 7, 11, 7),
+	uint4(4, 4, 8, 4), uint4(4, 5, 8, 9), uint4(4, 5, 8, 9), uint4(4, 5, 8, 9),
+	uint4(5, 5, 9, 10), uint4(5, 6, 9, 10), uint4(5, 6, 9, 10), uint4(5, 6, 9, 10),
+	uint4(6, 7, 10, 11), uint4(6, 7, 10, 11), uint4(6, 7, 10, 11), uint4(7, 7, 11, 7),
+	uint4(4, 4, 8, 4), uint4(4, 4, 8, 9), uint4(4, 5, 8, 9), uint4(4, 5, 8, 9),
+	uint4(5, 5, 9, 10), uint4(5, 5, 9, 10), uint4(5, 6, 9, 10), uint4(5, 6, 9, 10),
+	uint4(6, 6, 10, 11), uint4(6, 6, 10, 11), uint4(6, 7, 10, 11), uint4(7, 7, 11, 7),
+	uint4(8, 8, 12, 8), uint4(8, 9, 12, 13), uint4(8, 9, 12, 13), uint4(8, 9, 12, 13),
+	uint4(9, 10, 13, 9), uint4(9, 10, 13, 14), uint4(9, 10, 13, 14), uint4(9, 10, 9, 14),
+	uint4(10, 11, 14, 15), uint4(10, 11, 14, 15), uint4(10, 11, 14, 15), uint4(11, 11, 15, 11),
+	uint4(8, 8, 12, 8), uint4(8, 9, 12, 13), uint4(8, 9, 12, 13), uint4(8, 9, 12, 13),
+	uint4(9, 10, 13, 9), uint4(9, 10, 13, 14), uint4(9, 10, 13, 14), uint4(9, 10, 9, 14),
+	uint4(10, 11, 14, 15), uint4(10, 11, 14, 15), uint4(10, 11, 14, 15), uint4(11, 11, 15, 11),
+	uint4(8, 8, 12, 8), uint4(8, 9, 12, 13), uint4(8, 9, 12, 13), uint4(8, 9, 12, 13),
+	uint4(9, 9, 13, 14), uint4(9, 10, 13, 14), uint4(9, 10, 13, 14), uint4(9, 10, 13, 14),
+	uint4(10, 11, 14, 15), uint4(10, 11, 14, 15), uint4(10, 11, 14, 15), uint4(11, 11, 15, 11),
+	uint4(12, 12, 12, 12), uint4(12, 13, 12, 12), uint4(12, 13, 12, 12), uint4(12, 13, 12, 12),
+	uint4(13, 14, 13, 13), uint4(13, 14, 13, 13), uint4(13, 14, 13, 13), uint4(13, 14, 13, 13),
+	uint4(14, 15, 14, 14), uint4(14, 15, 14, 14), uint4(14, 15, 14, 14), uint4(15, 15, 15, 15),
+	uint4(0, 0, 0, 0), uint4(0, 1, 0, 0), uint4(0, 1, 0, 0), uint4(1, 2, 1, 1),
+	uint4(1, 2, 1, 1), uint4(1, 2, 1, 1), uint4(2, 3, 2, 2), uint4(2, 3, 2, 2),
+	uint4(2, 3, 2, 2), uint4(3, 4, 3, 3), uint4(3, 4, 3, 3), uint4(4, 4, 4, 4),
+	uint4(0, 0, 5, 0), uint4(0, 1, 5, 6), uint4(0, 1, 5, 6), uint4(1, 2, 6, 1),
+	uint4(1, 2, 6, 7), uint4(1, 2, 6, 7), uint4(2, 3, 7, 8), uint4(2, 3, 7, 8),
+	uint4(2, 3, 2, 8), uint4(3, 4, 8, 9), uint4(3, 4, 8, 9), uint4(4, 4, 9, 4),
+	uint4(0, 0, 5, 0), uint4(0, 1, 5, 6), uint4(0, 1, 5, 6), uint4(1, 1, 6, 7),
+	uint4(1, 2, 6, 7), uint4(1, 2, 6, 7), uint4(2, 3, 7, 8), uint4(2, 3, 7, 8),
+	uint4(2, 3, 7, 8), uint4(3, 4, 8, 9), uint4(3, 4, 8, 9), uint4(4, 4, 9, 4),
+	uint4(5, 5, 10, 5), uint4(5, 6, 10, 5), uint4(5, 6, 5, 11), uint4(6, 7, 11, 6),
+	uint4(6, 7, 11, 6), uint4(6, 7, 6, 12), uint4(7, 8, 12, 7), uint4(7, 8, 7, 13),
+	uint4(7, 8, 7, 13), uint4(8, 9, 13, 8), uint4(8, 9, 8, 14), uint4(9, 9, 14, 9),
+	uint4(5, 5, 10, 5), uint4(5, 6, 10, 11), uint4(5, 6, 10, 11), uint4(6, 7, 11, 6),
+	uint4(6, 7, 11, 12), uint4(6, 7, 11, 12), uint4(7, 8, 12, 13), uint4(7, 8, 12, 13),
+	uint4(7, 8, 7, 13), uint4(8, 9, 13, 14), uint4(8, 9, 13, 14), uint4(9, 9, 14, 9),
+	uint4(5, 5, 10, 5), uint4(5, 6, 10, 11), uint4(5, 6, 10, 11), uint4(6, 6, 11, 12),
+	uint4(6, 7, 11, 12), uint4(6, 7, 11, 12), uint4(7, 8, 12, 13), uint4(7, 8, 12, 13),
+	uint4(7, 8, 12, 13), uint4(8, 9, 13, 14), uint4(8, 9, 13, 14), uint4(9, 9, 14, 9),
+	uint4(10, 10, 15, 10), uint4(10, 11, 15, 16), uint4(10, 11, 15, 16), uint4(11, 12, 16, 11),
+	uint4(11, 12, 16, 17), uint4(11, 12, 16, 17), uint4(12, 13, 17, 18), uint4(12, 13, 17, 18),
+	uint4(12, 13, 12, 18), uint4(13, 14, 18, 19), uint4(13, 14, 18, 19), uint4(14, 14, 19, 14),
+	uint4(10, 10, 15, 10), uint4(10, 11, 15, 16), uint4(10, 11, 15, 16), uint4(11, 11, 16, 17),
+	uint4(11, 12, 16, 17), uint4(11, 12, 16, 17), uint4(12, 13, 17, 18), uint4(12, 13, 17, 18),
+	uint4(12, 13, 17, 18), uint4(13, 14, 18, 19), uint4(13, 14, 18, 19), uint4(14, 14, 19, 14),
+	uint4(10, 10, 15, 10), uint4(10, 10, 15, 16), uint4(10, 11, 15, 16), uint4(11, 11, 16, 17),
+	uint4(11, 11, 16, 17), uint4(11, 12, 16, 17), uint4(12, 12, 17, 18), uint4(12, 13, 17, 18),
+	uint4(12, 13, 17, 18), uint4(13, 13, 18, 19), uint4(13, 14, 18, 19), uint4(14, 14, 19, 14),
+	uint4(15, 15, 20, 15), uint4(15, 16, 20, 21), uint4(15, 16, 20, 21), uint4(16, 17, 21, 16),
+	uint4(16, 17, 21, 22), uint4(16, 17, 21, 22), uint4(17, 18, 22, 23), uint4(17, 18, 22, 23),
+	uint4(17, 18, 17, 23), uint4(18, 19, 23, 24), uint4(18, 19, 23, 24), uint4(19, 19, 24, 19),
+	uint4(15, 15, 20, 15), uint4(15, 16, 20, 21), uint4(15, 16, 20, 21), uint4(16, 16, 21, 22),
+	uint4(16, 17, 21, 22), uint4(16, 17, 21, 22), uint4(17, 18, 22, 23), uint4(17, 18, 22, 23),
+	uint4(17, 18, 22, 23), uint4(18, 19, 23, 24), uint4(18, 19, 23, 24), uint4(19, 19, 24, 19),
+	uint4(20, 20, 20, 20), uint4(20, 21, 20, 20), uint4(20, 21, 20, 20), uint4(21, 22, 21, 21),
+	uint4(21, 22, 21, 21), uint4(21, 22, 21, 21), uint4(22, 23, 22, 22), uint4(22, 23, 22, 22),
+	uint4(22, 23, 22, 22), uint4(23, 24, 23, 23), uint4(23, 24, 23, 23), uint4(24, 24, 24, 24),
+	uint4(0, 0, 0, 0), uint4(0, 1, 0, 0), uint4(0, 1, 0, 0), uint4(1, 2, 1, 1),
+	uint4(1, 2, 1, 1), uint4(2, 3, 2, 2), uint4(2, 3, 2, 2), uint4(3, 4, 3, 3),
+	uint4(3, 4, 3, 3), uint4(4, 5, 4, 4), uint4(4, 5, 4, 4), uint4(5, 5, 5, 5),
+	uint4(0, 0, 6, 0), uint4(0, 1, 6, 7), uint4(0, 1, 0, 7), uint4(1, 2, 7, 8),
+	uint4(1, 2, 7, 8), uint4(2, 3, 8, 9), uint4(2, 3, 8, 9), uint4(3, 4, 9, 10),
+	uint4(3, 4, 9, 10), uint4(4, 5, 10, 4), uint4(4, 5, 10, 11), uint4(5, 5, 11, 5),
+	uint4(0, 0, 6, 0), uint4(0, 0, 6, 7), uint4(0, 1, 6, 7), uint4(1, 1, 7, 8),
+	uint4(1, 2, 7, 8), uint4(2, 2, 8, 9), uint4(2, 3, 8, 9), uint4(3, 3, 9, 10),
+	uint4(3, 4, 9, 10), uint4(4, 4, 10, 11), uint4(4, 5, 10, 11), uint4(5, 5, 11, 5),
+	uint4(6, 6, 12, 6), uint4(6, 7, 12, 13), uint4(6, 7, 6, 13), uint4(7, 8, 13, 14),
+	uint4(7, 8, 13, 14), uint4(8, 9, 14, 15), uint4(8, 9, 14, 15), uint4(9, 10, 15, 16),
+	uint4(9, 10, 15, 16), uint4(10, 11, 16, 10), uint4(10, 11, 16, 17), uint4(11, 11, 17, 11),
+	uint4(6, 6, 12, 6), uint4(6, 7, 12, 13), uint4(6, 7, 12, 13), uint4(7, 8, 13, 14),
+	uint4(7, 8, 13, 14), uint4(8, 9, 14, 15), uint4(8, 9, 14, 15), uint4(9, 10, 15, 16),
+	uint4(9, 10, 15, 16), uint4(10, 10, 16, 17), uint4(10, 11, 16, 17), uint4(11, 11, 17, 11),
+	uint4(12, 12, 18, 12), uint4(12, 13, 18, 19), uint4(12, 13, 12, 19), uint4(13, 14, 19, 20),
+	uint4(13, 14, 19, 20), uint4(14, 15, 20, 21), uint4(14, 15, 20, 21), uint4(15, 16, 21, 22),
+	uint4(15, 16, 21, 22), uint4(16, 17, 22, 16), uint4(16, 17, 22, 23), uint4(17, 17, 23, 17),
+	uint4(12, 12, 18, 12), uint4(12, 13, 18, 19), uint4(12, 13, 18, 19), uint4(13, 14, 19, 20),
+	uint4(13, 14, 19, 20), uint4(14, 15, 20, 21), uint4(14, 15, 20, 21), uint4(15, 16, 21, 22),
+	uint4(15, 16, 21, 22), uint4(16, 16, 22, 23), uint4(16, 17, 22, 23), uint4(17, 17, 23, 17),
+	uint4(18, 18, 24, 18), uint4(18, 19, 24, 25), uint4(18, 19, 18, 25), uint4(19, 20, 25, 26),
+	uint4(19, 20, 25, 26), uint4(20, 21, 26, 27), uint4(20, 21, 26, 27), uint4(21, 22, 27, 28),
+	uint4(21, 22, 27, 28), uint4(22, 23, 28, 22), uint4(22, 23, 28, 29), uint4(23, 23, 29, 23),
+	uint4(18, 18, 24, 18), uint4(18, 19, 24, 25), uint4(18, 19, 24, 25), uint4(19, 20, 25, 26),
+	uint4(19, 20, 25, 26), uint4(20, 21, 26, 27), uint4(20, 21, 26, 27), uint4(21, 22, 27, 28),
+	uint4(21, 22, 27, 28), uint4(22, 22, 28, 29), uint4(22, 23, 28, 29), uint4(23, 23, 29, 23),
+	uint4(24, 24, 30, 24), uint4(24, 25, 30, 24), uint4(24, 25, 24, 31), uint4(25, 26, 31, 25),
+	uint4(25, 26, 25, 32), uint4(26, 27, 32, 26), uint4(26, 27, 26, 33), uint4(27, 28, 33, 27),
+	uint4(27, 28, 27, 34), uint4(28, 29, 34, 28), uint4(28, 29, 28, 35), uint4(29, 29, 35, 29),
+	uint4(24, 24, 30, 24), uint4(24, 25, 30, 31), uint4(24, 25, 30, 31), uint4(25, 26, 31, 32),
+	uint4(25, 26, 31, 32), uint4(26, 27, 32, 33), uint4(26, 27, 32, 33), uint4(27, 28, 33, 34),
+	uint4(27, 28, 33, 34), uint4(28, 28, 34, 35), uint4(28, 29, 34, 35), uint4(29, 29, 35, 29),
+	uint4(30, 30, 30, 30), uint4(30, 31, 30, 30), uint4(30, 31, 30, 30), uint4(31, 32, 31, 31),
+	uint4(31, 32, 31, 31), uint4(32, 33, 32, 32), uint4(32, 33, 32, 32), uint4(33, 34, 33, 33),
+	uint4(33, 34, 33, 33), uint4(34, 35, 34, 34), uint4(34, 35, 34, 34), uint4(35, 35, 35, 35),
+	uint4(0, 0, 0, 0), uint4(0, 1, 0, 0), uint4(1, 2, 1, 1), uint4(1, 2, 1, 1),
+	uint4(2, 3, 2, 2), uint4(3, 4, 3, 3), uint4(3, 4, 3, 3), uint4(4, 5, 4, 4),
+	uint4(5, 6, 5, 5), uint4(5, 6, 5, 5), uint4(6, 7, 6, 6), uint4(7, 7, 7, 7),
+	uint4(0, 0, 8, 0), uint4(0, 1, 8, 9), uint4(1, 2, 9, 10), uint4(1, 2, 9, 10),
+	uint4(2, 3, 10, 11), uint4(3, 4, 11, 12), uint4(3, 4, 11, 12), uint4(4, 5, 12, 13),
+	uint4(5, 5, 13, 14), uint4(5, 6, 13, 14), uint4(6, 7, 14, 15), uint4(7, 7, 15, 7),
+	uint4(8, 8, 16, 8), uint4(8, 9, 16, 17), uint4(9, 10, 17, 18), uint4(9, 10, 9, 18),
+	uint4(10, 11, 18, 19), uint4(11, 12, 19, 20), uint4(11, 12, 19, 20), uint4(12, 13, 20, 21),
+	uint4(13, 14, 21, 13), uint4(13, 14, 21, 22), uint4(14, 15, 22, 23), uint4(15, 15, 23, 15),
+	uint4(8, 8, 16, 8), uint4(8, 9, 16, 17), uint4(9, 9, 17, 18), uint4(9, 10, 17, 18),
+	uint4(10, 11, 18, 19), uint4(11, 11, 19, 20), uint4(11, 12, 19, 20), uint4(12, 12, 20, 21),
+	uint4(13, 13, 21, 22), uint4(13, 14, 21, 22), uint4(14, 14, 22, 23), uint4(15, 15, 23, 15),
+	uint4(16, 16, 24, 16), uint4(16, 17, 24, 25), uint4(17, 18, 25, 26), uint4(17, 18, 25, 26),
+	uint4(18, 19, 26, 27), uint4(19, 20, 27, 28), uint4(19, 20, 27, 28), uint4(20, 21, 28, 29),
+	uint4(21, 21, 29, 30), uint4(21, 22, 29, 30), uint4(22, 23, 30, 31), uint4(23, 23, 31, 23),
+	uint4(24, 24, 32, 24), uint4(24, 25, 32, 33), uint4(25, 26, 33, 34), uint4(25, 26, 25, 34),
+	uint4(26, 27, 34, 35), uint4(27, 28, 35, 36), uint4(27, 28, 35, 36), uint4(28, 29, 36, 37),
+	uint4(29, 30, 37, 29), uint4(29, 30, 37, 38), uint4(30, 31, 38, 39), uint4(31, 31, 39, 31),
+	uint4(24, 24, 32, 24), uint4(24, 25, 32, 33), uint4(25, 26, 33, 34), uint4(25, 26, 33, 34),
+	uint4(26, 27, 34, 35), uint4(27, 28, 35, 36), uint4(27, 28, 35, 36), uint4(28, 29, 36, 37),
+	uint4(29, 29, 37, 38), uint4(29, 30, 37, 38), uint4(30, 31, 38, 39), uint4(31, 31, 39, 31),
+	uint4(32, 32, 40, 32), uint4(32, 33, 40, 41), uint4(33, 34, 41, 42), uint4(33, 34, 33, 42),
+	uint4(34, 35, 42, 43), uint4(35, 36, 43, 44), uint4(35, 36, 43, 44), uint4(36, 37, 44, 45),
+	uint4(37, 38, 45, 37), uint4(37, 38, 45, 46), uint4(38, 39, 46, 47), uint4(39, 39, 47, 39),
+	uint4(40, 40, 48, 40), uint4(40, 41, 40, 49), uint4(41, 42, 49, 41), uint4(41, 42, 41, 50),
+	uint4(42, 43, 42, 51), uint4(43, 44, 51, 43), uint4(43, 44, 43, 52), uint4(44, 45, 52, 44),
+	uint4(45, 46, 53, 45), uint4(45, 46, 45, 54), uint4(46, 47, 54, 46), uint4(47, 47, 55, 47),
+	uint4(40, 40, 48, 40), uint4(40, 41, 48, 49), uint4(41, 42, 49, 50), uint4(41, 42, 49, 50),
+	uint4(42, 43, 50, 51), uint4(43, 44, 51, 52), uint4(43, 44, 51, 52), uint4(44, 45, 52, 53),
+	uint4(45, 45, 53, 54), uint4(45, 46, 53, 54), uint4(46, 47, 54, 55), uint4(47, 47, 55, 47),
+	uint4(48, 48, 56, 48), uint4(48, 49, 56, 57), uint4(49, 50, 57, 58), uint4(49, 50, 49, 58),
+	uint4(50, 51, 58, 59), uint4(51, 52, 59, 60), uint4(51, 52, 59, 60), uint4(52, 53, 60, 61),
+	uint4(53, 54, 61, 53), uint4(53, 54, 61, 62), uint4(54, 55, 62, 63), uint4(55, 55, 63, 55),
+	uint4(56, 56, 56, 56), uint4(56, 57, 56, 56), uint4(57, 58, 57, 57), uint4(57, 58, 57, 57),
+	uint4(58, 59, 58, 58), uint4(59, 60, 59, 59), uint4(59, 60, 59, 59), uint4(60, 61, 60, 60),
+	uint4(61, 62, 61, 61), uint4(61, 62, 61, 61), uint4(62, 63, 62, 62), uint4(63, 63, 63, 63),
+};
+static const float4 infill_wt_12x12[576] =
+{
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.75f, 0.25f, 0.0f, 0.0f), float4(0.4375f, 0.5625f, 0.0f, 0.0f), float4(0.1875f, 0.8125f, 0.0f, 0.0f),
+	float4(0.9375f, 0.0625f, 0.0f, 0.0f), float4(0.625f, 0.375f, 0.0f, 0.0f), float4(0.375f, 0.625f, 0.0f, 0.0f), float4(0.0625f, 0.9375f, 0.0f, 0.0f),
+	float4(0.8125f, 0.1875f, 0.0f, 0.0f), float4(0.5625f, 0.4375f, 0.0f, 0.0f), float4(0.25f, 0.75f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.75f, 0.0f, 0.25f, 0.0f), float4(0.5625f, 0.1875f, 0.1875f, 0.0625f), float4(0.3125f, 0.4375f, 0.125f, 0.125f), float4(0.125f, 0.625f, 0.0625f, 0.1875f),
+	float4(0.6875f, 0.0625f, 0.25f, 0.0f), float4(0.5f, 0.25f, 0.125f, 0.125f), float4(0.3125f, 0.4375f, 0.0625f, 0.1875f), float4(0.0625f, 0.6875f, 0.0f, 0.25f),
+	float4(0.625f, 0.125f, 0.1875f, 0.0625f), float4(0.4375f, 0.3125f, 0.125f, 0.125f), float4(0.1875f, 0.5625f, 0.0625f, 0.1875f), float4(0.75f, 0.0f, 0.25f, 0.0f),
+	float4(0.4375f, 0.0f, 0.5625f, 0.0f), float4(0.3125f, 0.125f, 0.4375f, 0.125f), float4(0.1875f, 0.25f, 0.25f, 0.3125f), float4(0.0625f, 0.375f, 0.125f, 0.4375f),
+	float4(0.4375f, 0.0f, 0.5f, 0.0625f), float4(0.25f, 0.1875f, 0.375f, 0.1875f), float4(0.1875f, 0.25f, 0.1875f, 0.375f), float4(0.0f, 0.4375f, 0.0625f, 0.5f),
+	float4(0.375f, 0.0625f, 0.4375f, 0.125f), float4(0.25f, 0.1875f, 0.3125f, 0.25f), float4(0.125f, 0.3125f, 0.125f, 0.4375f), float4(0.4375f, 0.0f, 0.5625f, 0.0f),
+	float4(0.1875f, 0.0f, 0.8125f, 0.0f), float4(0.125f, 0.0625f, 0.625f, 0.1875f), float4(0.0625f, 0.125f, 0.375f, 0.4375f), float4(0.0625f, 0.125f, 0.125f, 0.6875f),
+	float4(0.1875f, 0.0f, 0.75f, 0.0625f), float4(0.125f, 0.0625f, 0.5f, 0.3125f), float4(0.0625f, 0.125f, 0.3125f, 0.5f), float4(0.0f, 0.1875f, 0.0625f, 0.75f),
+	float4(0.125f, 0.0625f, 0.6875f, 0.125f), float4(0.125f, 0.0625f, 0.4375f, 0.375f), float4(0.0625f, 0.125f, 0.1875f, 0.625f), float4(0.1875f, 0.0f, 0.8125f, 0.0f),
+	float4(0.9375f, 0.0f, 0.0625f, 0.0f), float4(0.6875f, 0.25f, 0.0625f, 0.0f), float4(0.4375f, 0.5f, 0.0f, 0.0625f), float4(0.1875f, 0.75f, 0.0f, 0.0625f),
+	float4(0.875f, 0.0625f, 0.0625f, 0.0f), float4(0.5625f, 0.375f, 0.0625f, 0.0f), float4(0.375f, 0.5625f, 0.0f, 0.0625f), float4(0.0625f, 0.875f, 0.0f, 0.0625f),
+	float4(0.75f, 0.1875f, 0.0625f, 0.0f), float4(0.5f, 0.4375f, 0.0625f, 0.0f), float4(0.25f, 0.6875f, 0.0f, 0.0625f), float4(0.9375f, 0.0f, 0.0625f, 0.0f),
+	float4(0.625f, 0.0f, 0.375f, 0.0f), float4(0.5f, 0.125f, 0.25f, 0.125f), float4(0.25f, 0.375f, 0.1875f, 0.1875f), float4(0.125f, 0.5f, 0.0625f, 0.3125f),
+	float4(0.5625f, 0.0625f, 0.375f, 0.0f), float4(0.375f, 0.25f, 0.25f, 0.125f), float4(0.25f, 0.375f, 0.125f, 0.25f), float4(0.0625f, 0.5625f, 0.0f, 0.375f),
+	float4(0.5f, 0.125f, 0.3125f, 0.0625f), float4(0.375f, 0.25f, 0.1875f, 0.1875f), float4(0.1875f, 0.4375f, 0.0625f, 0.3125f), float4(0.625f, 0.0f, 0.375f, 0.0f),
+	float4(0.375f, 0.0f, 0.625f, 0.0f), float4(0.3125f, 0.0625f, 0.4375f, 0.1875f), float4(0.1875f, 0.1875f, 0.25f, 0.375f), float4(0.0625f, 0.3125f, 0.125f, 0.5f),
+	float4(0.375f, 0.0f, 0.5625f, 0.0625f), float4(0.25f, 0.125f, 0.375f, 0.25f), float4(0.125f, 0.25f, 0.25f, 0.375f), float4(0.0f, 0.375f, 0.0625f, 0.5625f),
+	float4(0.3125f, 0.0625f, 0.5f, 0.125f), float4(0.1875f, 0.1875f, 0.375f, 0.25f), float4(0.125f, 0.25f, 0.125f, 0.5f), float4(0.375f, 0.0f, 0.625f, 0.0f),
+	float4(0.0625f, 0.0f, 0.9375f, 0.0f), float4(0.0625f, 0.0f, 0.6875f, 0.25f), float4(0.0f, 0.0625f, 0.4375f, 0.5f), float4(0.0f, 0.0625f, 0.1875f, 0.75f),
+	float4(0.0625f, 0.0f, 0.875f, 0.0625f), float4(0.0625f, 0.0f, 0.5625f, 0.375f), float4(0.0f, 0.0625f, 0.375f, 0.5625f), float4(0.0f, 0.0625f, 0.0625f, 0.875f),
+	float4(0.0625f, 0.0f, 0.75f, 0.1875f), float4(0.0625f, 0.0f, 0.5f, 0.4375f), float4(0.0f, 0.0625f, 0.25f, 0.6875f), float4(0.0625f, 0.0f, 0.9375f, 0.0f),
+	float4(0.8125f, 0.0f, 0.1875f, 0.0f), float4(0.625f, 0.1875f, 0.125f, 0.0625f), float4(0.375f, 0.4375f, 0.0625f, 0.125f), float4(0.125f, 0.6875f, 0.0625f, 0.125f),
+	float4(0.75f, 0.0625f, 0.1875f, 0.0f), float4(0.5f, 0.3125f, 0.125f, 0.0625f), float4(0.3125f, 0.5f, 0.0625f, 0.125f), float4(0.0625f, 0.75f, 0.0f, 0.1875f),
+	float4(0.6875f, 0.125f, 0.125f, 0.0625f), float4(0.4375f, 0.375f, 0.125f, 0.0625f), float4(0.1875f, 0.625f, 0.0625f, 0.125f), float4(0.8125f, 0.0f, 0.1875f, 0.0f),
+	float4(0.5625f, 0.0f, 0.4375f, 0.0f), float4(0.4375f, 0.125f, 0.3125f, 0.125f), float4(0.25f, 0.3125f, 0.1875f, 0.25f), float4(0.125f, 0.4375f, 0.0625f, 0.375f),
+	float4(0.5f, 0.0625f, 0.4375f, 0.0f), float4(0.375f, 0.1875f, 0.25f, 0.1875f), float4(0.1875f, 0.375f, 0.1875f, 0.25f), float4(0.0625f, 0.5f, 0.0f, 0.4375f),
+	float4(0.4375f, 0.125f, 0.375f, 0.0625f), float4(0.3125f, 0.25f, 0.25f, 0.1875f), float4(0.125f, 0.4375f, 0.125f, 0.3125f), float4(0.5625f, 0.0f, 0.4375f, 0.0f),
+	float4(0.25f, 0.0f, 0.75f, 0.0f), float4(0.1875f, 0.0625f, 0.5625f, 0.1875f), float4(0.125f, 0.125f, 0.3125f, 0.4375f), float4(0.0625f, 0.1875f, 0.125f, 0.625f),
+	float4(0.25f, 0.0f, 0.6875f, 0.0625f), float4(0.1875f, 0.0625f, 0.4375f, 0.3125f), float4(0.125f, 0.125f, 0.25f, 0.5f), float4(0.0f, 0.25f, 0.0625f, 0.6875f),
+	float4(0.1875f, 0.0625f, 0.625f, 0.125f), float4(0.125f, 0.125f, 0.4375f, 0.3125f), float4(0.0625f, 0.1875f, 0.1875f, 0.5625f), float4(0.25f, 0.0f, 0.75f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.75f, 0.25f, 0.0f, 0.0f), float4(0.4375f, 0.5625f, 0.0f, 0.0f), float4(0.1875f, 0.8125f, 0.0f, 0.0f),
+	float4(0.9375f, 0.0625f, 0.0f, 0.0f), float4(0.625f, 0.375f, 0.0f, 0.0f), float4(0.375f, 0.625f, 0.0f, 0.0f), float4(0.0625f, 0.9375f, 0.0f, 0.0f),
+	float4(0.8125f, 0.1875f, 0.0f, 0.0f), float4(0.5625f, 0.4375f, 0.0f, 0.0f), float4(0.25f, 0.75f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.625f, 0.375f, 0.0f, 0.0f), float4(0.25f, 0.75f, 0.0f, 0.0f), float4(0.9375f, 0.0625f, 0.0f, 0.0f),
+	float4(0.5625f, 0.4375f, 0.0f, 0.0f), float4(0.1875f, 0.8125f, 0.0f, 0.0f), float4(0.8125f, 0.1875f, 0.0f, 0.0f), float4(0.4375f, 0.5625f, 0.0f, 0.0f),
+	float4(0.0625f, 0.9375f, 0.0f, 0.0f), float4(0.75f, 0.25f, 0.0f, 0.0f), float4(0.375f, 0.625f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.625f, 0.0f, 0.375f, 0.0f), float4(0.375f, 0.25f, 0.25f, 0.125f), float4(0.1875f, 0.4375f, 0.0625f, 0.3125f), float4(0.5625f, 0.0625f, 0.375f, 0.0f),
+	float4(0.375f, 0.25f, 0.1875f, 0.1875f), float4(0.125f, 0.5f, 0.0625f, 0.3125f), float4(0.5f, 0.125f, 0.3125f, 0.0625f), float4(0.25f, 0.375f, 0.1875f, 0.1875f),
+	float4(0.0625f, 0.5625f, 0.0f, 0.375f), float4(0.5f, 0.125f, 0.25f, 0.125f), float4(0.25f, 0.375f, 0.125f, 0.25f), float4(0.625f, 0.0f, 0.375f, 0.0f),
+	float4(0.25f, 0.0f, 0.75f, 0.0f), float4(0.1875f, 0.0625f, 0.4375f, 0.3125f), float4(0.0625f, 0.1875f, 0.1875f, 0.5625f), float4(0.25f, 0.0f, 0.6875f, 0.0625f),
+	float4(0.125f, 0.125f, 0.4375f, 0.3125f), float4(0.0625f, 0.1875f, 0.125f, 0.625f), float4(0.1875f, 0.0625f, 0.625f, 0.125f), float4(0.125f, 0.125f, 0.3125f, 0.4375f),
+	float4(0.0f, 0.25f, 0.0625f, 0.6875f), float4(0.1875f, 0.0625f, 0.5625f, 0.1875f), float4(0.125f, 0.125f, 0.25f, 0.5f), float4(0.25f, 0.0f, 0.75f, 0.0f),
+	float4(0.9375f, 0.0f, 0.0625f, 0.0f), float4(0.5625f, 0.375f, 0.0625f, 0.0f), float4(0.25f, 0.6875f, 0.0f, 0.0625f), float4(0.875f, 0.0625f, 0.0625f, 0.0f),
+	float4(0.5f, 0.4375f, 0.0625f, 0.0f), float4(0.1875f, 0.75f, 0.0f, 0.0625f), float4(0.75f, 0.1875f, 0.0625f, 0.0f), float4(0.4375f, 0.5f, 0.0f, 0.0625f),
+	float4(0.0625f, 0.875f, 0.0f, 0.0625f), float4(0.6875f, 0.25f, 0.0625f, 0.0f), float4(0.375f, 0.5625f, 0.0f, 0.0625f), float4(0.9375f, 0.0f, 0.0625f, 0.0f),
+	float4(0.5625f, 0.0f, 0.4375f, 0.0f), float4(0.375f, 0.1875f, 0.25f, 0.1875f), float4(0.125f, 0.4375f, 0.125f, 0.3125f), float4(0.5f, 0.0625f, 0.4375f, 0.0f),
+	float4(0.3125f, 0.25f, 0.25f, 0.1875f), float4(0.125f, 0.4375f, 0.0625f, 0.375f), float4(0.4375f, 0.125f, 0.375f, 0.0625f), float4(0.25f, 0.3125f, 0.1875f, 0.25f),
+	float4(0.0625f, 0.5f, 0.0f, 0.4375f), float4(0.4375f, 0.125f, 0.3125f, 0.125f), float4(0.1875f, 0.375f, 0.1875f, 0.25f), float4(0.5625f, 0.0f, 0.4375f, 0.0f),
+	float4(0.1875f, 0.0f, 0.8125f, 0.0f), float4(0.125f, 0.0625f, 0.5f, 0.3125f), float4(0.0625f, 0.125f, 0.1875f, 0.625f), float4(0.1875f, 0.0f, 0.75f, 0.0625f),
+	float4(0.125f, 0.0625f, 0.4375f, 0.375f), float4(0.0625f, 0.125f, 0.125f, 0.6875f), float4(0.125f, 0.0625f, 0.6875f, 0.125f), float4(0.0625f, 0.125f, 0.375f, 0.4375f),
+	float4(0.0f, 0.1875f, 0.0625f, 0.75f), float4(0.125f, 0.0625f, 0.625f, 0.1875f), float4(0.0625f, 0.125f, 0.3125f, 0.5f), float4(0.1875f, 0.0f, 0.8125f, 0.0f),
+	float4(0.8125f, 0.0f, 0.1875f, 0.0f), float4(0.5f, 0.3125f, 0.125f, 0.0625f), float4(0.1875f, 0.625f, 0.0625f, 0.125f), float4(0.75f, 0.0625f, 0.1875f, 0.0f),
+	float4(0.4375f, 0.375f, 0.125f, 0.0625f), float4(0.125f, 0.6875f, 0.0625f, 0.125f), float4(0.6875f, 0.125f, 0.125f, 0.0625f), float4(0.375f, 0.4375f, 0.0625f, 0.125f),
+	float4(0.0625f, 0.75f, 0.0f, 0.1875f), float4(0.625f, 0.1875f, 0.125f, 0.0625f), float4(0.3125f, 0.5f, 0.0625f, 0.125f), float4(0.8125f, 0.0f, 0.1875f, 0.0f),
+	float4(0.4375f, 0.0f, 0.5625f, 0.0f), float4(0.25f, 0.1875f, 0.375f, 0.1875f), float4(0.125f, 0.3125f, 0.125f, 0.4375f), float4(0.4375f, 0.0f, 0.5f, 0.0625f),
+	float4(0.25f, 0.1875f, 0.3125f, 0.25f), float4(0.0625f, 0.375f, 0.125f, 0.4375f), float4(0.375f, 0.0625f, 0.4375f, 0.125f), float4(0.1875f, 0.25f, 0.25f, 0.3125f),
+	float4(0.0f, 0.4375f, 0.0625f, 0.5f), float4(0.3125f, 0.125f, 0.4375f, 0.125f), float4(0.1875f, 0.25f, 0.1875f, 0.375f), float4(0.4375f, 0.0f, 0.5625f, 0.0f),
+	float4(0.0625f, 0.0f, 0.9375f, 0.0f), float4(0.0625f, 0.0f, 0.5625f, 0.375f), float4(0.0f, 0.0625f, 0.25f, 0.6875f), float4(0.0625f, 0.0f, 0.875f, 0.0625f),
+	float4(0.0625f, 0.0f, 0.5f, 0.4375f), float4(0.0f, 0.0625f, 0.1875f, 0.75f), float4(0.0625f, 0.0f, 0.75f, 0.1875f), float4(0.0f, 0.0625f, 0.4375f, 0.5f),
+	float4(0.0f, 0.0625f, 0.0625f, 0.875f), float4(0.0625f, 0.0f, 0.6875f, 0.25f), float4(0.0f, 0.0625f, 0.375f, 0.5625f), float4(0.0625f, 0.0f, 0.9375f, 0.0f),
+	float4(0.75f, 0.0f, 0.25f, 0.0f), float4(0.5f, 0.25f, 0.125f, 0.125f), float4(0.1875f, 0.5625f, 0.0625f, 0.1875f), float4(0.6875f, 0.0625f, 0.25f, 0.0f),
+	float4(0.4375f, 0.3125f, 0.125f, 0.125f), float4(0.125f, 0.625f, 0.0625f, 0.1875f), float4(0.625f, 0.125f, 0.1875f, 0.0625f), float4(0.3125f, 0.4375f, 0.125f, 0.125f),
+	float4(0.0625f, 0.6875f, 0.0f, 0.25f), float4(0.5625f, 0.1875f, 0.1875f, 0.0625f), float4(0.3125f, 0.4375f, 0.0625f, 0.1875f), float4(0.75f, 0.0f, 0.25f, 0.0f),
+	float4(0.375f, 0.0f, 0.625f, 0.0f), float4(0.25f, 0.125f, 0.375f, 0.25f), float4(0.125f, 0.25f, 0.125f, 0.5f), float4(0.375f, 0.0f, 0.5625f, 0.0625f),
+	float4(0.1875f, 0.1875f, 0.375f, 0.25f), float4(0.0625f, 0.3125f, 0.125f, 0.5f), float4(0.3125f, 0.0625f, 0.5f, 0.125f), float4(0.1875f, 0.1875f, 0.25f, 0.375f),
+	float4(0.0f, 0.375f, 0.0625f, 0.5625f), float4(0.3125f, 0.0625f, 0.4375f, 0.1875f), float4(0.125f, 0.25f, 0.25f, 0.375f), float4(0.375f, 0.0f, 0.625f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.625f, 0.375f, 0.0f, 0.0f), float4(0.25f, 0.75f, 0.0f, 0.0f), float4(0.9375f, 0.0625f, 0.0f, 0.0f),
+	float4(0.5625f, 0.4375f, 0.0f, 0.0f), float4(0.1875f, 0.8125f, 0.0f, 0.0f), float4(0.8125f, 0.1875f, 0.0f, 0.0f), float4(0.4375f, 0.5625f, 0.0f, 0.0f),
+	float4(0.0625f, 0.9375f, 0.0f, 0.0f), float4(0.75f, 0.25f, 0.0f, 0.0f), float4(0.375f, 0.625f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.5625f, 0.4375f, 0.0f, 0.0f), float4(0.0625f, 0.9375f, 0.0f, 0.0f), float4(0.625f, 0.375f, 0.0f, 0.0f),
+	float4(0.1875f, 0.8125f, 0.0f, 0.0f), float4(0.75f, 0.25f, 0.0f, 0.0f), float4(0.25f, 0.75f, 0.0f, 0.0f), float4(0.8125f, 0.1875f, 0.0f, 0.0f),
+	float4(0.375f, 0.625f, 0.0f, 0.0f), float4(0.9375f, 0.0625f, 0.0f, 0.0f), float4(0.4375f, 0.5625f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.5625f, 0.0f, 0.4375f, 0.0f), float4(0.3125f, 0.25f, 0.25f, 0.1875f), float4(0.0625f, 0.5f, 0.0f, 0.4375f), float4(0.375f, 0.1875f, 0.25f, 0.1875f),
+	float4(0.125f, 0.4375f, 0.0625f, 0.375f), float4(0.4375f, 0.125f, 0.3125f, 0.125f), float4(0.125f, 0.4375f, 0.125f, 0.3125f), float4(0.4375f, 0.125f, 0.375f, 0.0625f),
+	float4(0.1875f, 0.375f, 0.1875f, 0.25f), float4(0.5f, 0.0625f, 0.4375f, 0.0f), float4(0.25f, 0.3125f, 0.1875f, 0.25f), float4(0.5625f, 0.0f, 0.4375f, 0.0f),
+	float4(0.0625f, 0.0f, 0.9375f, 0.0f), float4(0.0625f, 0.0f, 0.5f, 0.4375f), float4(0.0f, 0.0625f, 0.0625f, 0.875f), float4(0.0625f, 0.0f, 0.5625f, 0.375f),
+	float4(0.0f, 0.0625f, 0.1875f, 0.75f), float4(0.0625f, 0.0f, 0.6875f, 0.25f), float4(0.0f, 0.0625f, 0.25f, 0.6875f), float4(0.0625f, 0.0f, 0.75f, 0.1875f),
+	float4(0.0f, 0.0625f, 0.375f, 0.5625f), float4(0.0625f, 0.0f, 0.875f, 0.0625f), float4(0.0f, 0.0625f, 0.4375f, 0.5f), float4(0.0625f, 0.0f, 0.9375f, 0.0f),
+	float4(0.625f, 0.0f, 0.375f, 0.0f), float4(0.375f, 0.25f, 0.1875f, 0.1875f), float4(0.0625f, 0.5625f, 0.0f, 0.375f), float4(0.375f, 0.25f, 0.25f, 0.125f),
+	float4(0.125f, 0.5f, 0.0625f, 0.3125f), float4(0.5f, 0.125f, 0.25f, 0.125f), float4(0.1875f, 0.4375f, 0.0625f, 0.3125f), float4(0.5f, 0.125f, 0.3125f, 0.0625f),
+	float4(0.25f, 0.375f, 0.125f, 0.25f), float4(0.5625f, 0.0625f, 0.375f, 0.0f), float4(0.25f, 0.375f, 0.1875f, 0.1875f), float4(0.625f, 0.0f, 0.375f, 0.0f),
+	float4(0.1875f, 0.0f, 0.8125f, 0.0f), float4(0.125f, 0.0625f, 0.4375f, 0.375f), float4(0.0f, 0.1875f, 0.0625f, 0.75f), float4(0.125f, 0.0625f, 0.5f, 0.3125f),
+	float4(0.0625f, 0.125f, 0.125f, 0.6875f), float4(0.125f, 0.0625f, 0.625f, 0.1875f), float4(0.0625f, 0.125f, 0.1875f, 0.625f), float4(0.125f, 0.0625f, 0.6875f, 0.125f),
+	float4(0.0625f, 0.125f, 0.3125f, 0.5f), float4(0.1875f, 0.0f, 0.75f, 0.0625f), float4(0.0625f, 0.125f, 0.375f, 0.4375f), float4(0.1875f, 0.0f, 0.8125f, 0.0f),
+	float4(0.75f, 0.0f, 0.25f, 0.0f), float4(0.4375f, 0.3125f, 0.125f, 0.125f), float4(0.0625f, 0.6875f, 0.0f, 0.25f), float4(0.5f, 0.25f, 0.125f, 0.125f),
+	float4(0.125f, 0.625f, 0.0625f, 0.1875f), float4(0.5625f, 0.1875f, 0.1875f, 0.0625f), float4(0.1875f, 0.5625f, 0.0625f, 0.1875f), float4(0.625f, 0.125f, 0.1875f, 0.0625f),
+	float4(0.3125f, 0.4375f, 0.0625f, 0.1875f), float4(0.6875f, 0.0625f, 0.25f, 0.0f), float4(0.3125f, 0.4375f, 0.125f, 0.125f), float4(0.75f, 0.0f, 0.25f, 0.0f),
+	float4(0.25f, 0.0f, 0.75f, 0.0f), float4(0.125f, 0.125f, 0.4375f, 0.3125f), float4(0.0f, 0.25f, 0.0625f, 0.6875f), float4(0.1875f, 0.0625f, 0.4375f, 0.3125f),
+	float4(0.0625f, 0.1875f, 0.125f, 0.625f), float4(0.1875f, 0.0625f, 0.5625f, 0.1875f), float4(0.0625f, 0.1875f, 0.1875f, 0.5625f), float4(0.1875f, 0.0625f, 0.625f, 0.125f),
+	float4(0.125f, 0.125f, 0.25f, 0.5f), float4(0.25f, 0.0f, 0.6875f, 0.0625f), float4(0.125f, 0.125f, 0.3125f, 0.4375f), float4(0.25f, 0.0f, 0.75f, 0.0f),
+	float4(0.8125f, 0.0f, 0.1875f, 0.0f), float4(0.4375f, 0.375f, 0.125f, 0.0625f), float4(0.0625f, 0.75f, 0.0f, 0.1875f), float4(0.5f, 0.3125f, 0.125f, 0.0625f),
+	float4(0.125f, 0.6875f, 0.0625f, 0.125f), float4(0.625f, 0.1875f, 0.125f, 0.0625f), float4(0.1875f, 0.625f, 0.0625f, 0.125f), float4(0.6875f, 0.125f, 0.125f, 0.0625f),
+	float4(0.3125f, 0.5f, 0.0625f, 0.125f), float4(0.75f, 0.0625f, 0.1875f, 0.0f), float4(0.375f, 0.4375f, 0.0625f, 0.125f), float4(0.8125f, 0.0f, 0.1875f, 0.0f),
+	float4(0.375f, 0.0f, 0.625f, 0.0f), float4(0.1875f, 0.1875f, 0.375f, 0.25f), float4(0.0f, 0.375f, 0.0625f, 0.5625f), float4(0.25f, 0.125f, 0.375f, 0.25f),
+	float4(0.0625f, 0.3125f, 0.125f, 0.5f), float4(0.3125f, 0.0625f, 0.4375f, 0.1875f), float4(0.125f, 0.25f, 0.125f, 0.5f), float4(0.3125f, 0.0625f, 0.5f, 0.125f),
+	float4(0.125f, 0.25f, 0.25f, 0.375f), float4(0.375f, 0.0f, 0.5625f, 0.0625f), float4(0.1875f, 0.1875f, 0.25f, 0.375f), float4(0.375f, 0.0f, 0.625f, 0.0f),
+	float4(0.9375f, 0.0f, 0.0625f, 0.0f), float4(0.5f, 0.4375f, 0.0625f, 0.0f), float4(0.0625f, 0.875f, 0.0f, 0.0625f), float4(0.5625f, 0.375f, 0.0625f, 0.0f),
+	float4(0.1875f, 0.75f, 0.0f, 0.0625f), float4(0.6875f, 0.25f, 0.0625f, 0.0f), float4(0.25f, 0.6875f, 0.0f, 0.0625f), float4(0.75f, 0.1875f, 0.0625f, 0.0f),
+	float4(0.375f, 0.5625f, 0.0f, 0.0625f), float4(0.875f, 0.0625f, 0.0625f, 0.0f), float4(0.4375f, 0.5f, 0.0f, 0.0625f), float4(0.9375f, 0.0f, 0.0625f, 0.0f),
+	float4(0.4375f, 0.0f, 0.5625f, 0.0f), float4(0.25f, 0.1875f, 0.3125f, 0.25f), float4(0.0f, 0.4375f, 0.0625f, 0.5f), float4(0.25f, 0.1875f, 0.375f, 0.1875f),
+	float4(0.0625f, 0.375f, 0.125f, 0.4375f), float4(0.3125f, 0.125f, 0.4375f, 0.125f), float4(0.125f, 0.3125f, 0.125f, 0.4375f), float4(0.375f, 0.0625f, 0.4375f, 0.125f),
+	float4(0.1875f, 0.25f, 0.1875f, 0.375f), float4(0.4375f, 0.0f, 0.5f, 0.0625f), float4(0.1875f, 0.25f, 0.25f, 0.3125f), float4(0.4375f, 0.0f, 0.5625f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.5625f, 0.4375f, 0.0f, 0.0f), float4(0.0625f, 0.9375f, 0.0f, 0.0f), float4(0.625f, 0.375f, 0.0f, 0.0f),
+	float4(0.1875f, 0.8125f, 0.0f, 0.0f), float4(0.75f, 0.25f, 0.0f, 0.0f), float4(0.25f, 0.75f, 0.0f, 0.0f), float4(0.8125f, 0.1875f, 0.0f, 0.0f),
+	float4(0.375f, 0.625f, 0.0f, 0.0f), float4(0.9375f, 0.0625f, 0.0f, 0.0f), float4(0.4375f, 0.5625f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.375f, 0.625f, 0.0f, 0.0f), float4(0.75f, 0.25f, 0.0f, 0.0f), float4(0.0625f, 0.9375f, 0.0f, 0.0f),
+	float4(0.4375f, 0.5625f, 0.0f, 0.0f), float4(0.8125f, 0.1875f, 0.0f, 0.0f), float4(0.1875f, 0.8125f, 0.0f, 0.0f), float4(0.5625f, 0.4375f, 0.0f, 0.0f),
+	float4(0.9375f, 0.0625f, 0.0f, 0.0f), float4(0.25f, 0.75f, 0.0f, 0.0f), float4(0.625f, 0.375f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.375f, 0.0f, 0.625f, 0.0f), float4(0.125f, 0.25f, 0.25f, 0.375f), float4(0.3125f, 0.0625f, 0.4375f, 0.1875f), float4(0.0f, 0.375f, 0.0625f, 0.5625f),
+	float4(0.1875f, 0.1875f, 0.25f, 0.375f), float4(0.3125f, 0.0625f, 0.5f, 0.125f), float4(0.0625f, 0.3125f, 0.125f, 0.5f), float4(0.1875f, 0.1875f, 0.375f, 0.25f),
+	float4(0.375f, 0.0f, 0.5625f, 0.0625f), float4(0.125f, 0.25f, 0.125f, 0.5f), float4(0.25f, 0.125f, 0.375f, 0.25f), float4(0.375f, 0.0f, 0.625f, 0.0f),
+	float4(0.75f, 0.0f, 0.25f, 0.0f), float4(0.3125f, 0.4375f, 0.0625f, 0.1875f), float4(0.5625f, 0.1875f, 0.1875f, 0.0625f), float4(0.0625f, 0.6875f, 0.0f, 0.25f),
+	float4(0.3125f, 0.4375f, 0.125f, 0.125f), float4(0.625f, 0.125f, 0.1875f, 0.0625f), float4(0.125f, 0.625f, 0.0625f, 0.1875f), float4(0.4375f, 0.3125f, 0.125f, 0.125f),
+	float4(0.6875f, 0.0625f, 0.25f, 0.0f), float4(0.1875f, 0.5625f, 0.0625f, 0.1875f), float4(0.5f, 0.25f, 0.125f, 0.125f), float4(0.75f, 0.0f, 0.25f, 0.0f),
+	float4(0.0625f, 0.0f, 0.9375f, 0.0f), float4(0.0f, 0.0625f, 0.375f, 0.5625f), float4(0.0625f, 0.0f, 0.6875f, 0.25f), float4(0.0f, 0.0625f, 0.0625f, 0.875f),
+	float4(0.0f, 0.0625f, 0.4375f, 0.5f), float4(0.0625f, 0.0f, 0.75f, 0.1875f), float4(0.0f, 0.0625f, 0.1875f, 0.75f), float4(0.0625f, 0.0f, 0.5f, 0.4375f),
+	float4(0.0625f, 0.0f, 0.875f, 0.0625f), float4(0.0f, 0.0625f, 0.25f, 0.6875f), float4(0.0625f, 0.0f, 0.5625f, 0.375f), float4(0.0625f, 0.0f, 0.9375f, 0.0f),
+	float4(0.4375f, 0.0f, 0.5625f, 0.0f), float4(0.1875f, 0.25f, 0.1875f, 0.375f), float4(0.3125f, 0.125f, 0.4375f, 0.125f), float4(0.0f, 0.4375f, 0.0625f, 0.5f),
+	float4(0.1875f, 0.25f, 0.25f, 0.3125f), float4(0.375f, 0.0625f, 0.4375f, 0.125f), float4(0.0625f, 0.375f, 0.125f, 0.4375f), float4(0.25f, 0.1875f, 0.3125f, 0.25f),
+	float4(0.4375f, 0.0f, 0.5f, 0.0625f), float4(0.125f, 0.3125f, 0.125f, 0.4375f), float4(0.25f, 0.1875f, 0.375f, 0.1875f), float4(0.4375f, 0.0f, 0.5625f, 0.0f),
+	float4(0.8125f, 0.0f, 0.1875f, 0.0f), float4(0.3125f, 0.5f, 0.0625f, 0.125f), float4(0.625f, 0.1875f, 0.125f, 0.0625f), float4(0.0625f, 0.75f, 0.0f, 0.1875f),
+	float4(0.375f, 0.4375f, 0.0625f, 0.125f), float4(0.6875f, 0.125f, 0.125f, 0.0625f), float4(0.125f, 0.6875f, 0.0625f, 0.125f), float4(0.4375f, 0.375f, 0.125f, 0.0625f),
+	float4(0.75f, 0.0625f, 0.1875f, 0.0f), float4(0.1875f, 0.625f, 0.0625f, 0.125f), float4(0.5f, 0.3125f, 0.125f, 0.0625f), float4(0.8125f, 0.0f, 0.1875f, 0.0f),
+	float4(0.1875f, 0.0f, 0.8125f, 0.0f), float4(0.0625f, 0.125f, 0.3125f, 0.5f), float4(0.125f, 0.0625f, 0.625f, 0.1875f), float4(0.0f, 0.1875f, 0.0625f, 0.75f),
+	float4(0.0625f, 0.125f, 0.375f, 0.4375f), float4(0.125f, 0.0625f, 0.6875f, 0.125f), float4(0.0625f, 0.125f, 0.125f, 0.6875f), float4(0.125f, 0.0625f, 0.4375f, 0.375f),
+	float4(0.1875f, 0.0f, 0.75f, 0.0625f), float4(0.0625f, 0.125f, 0.1875f, 0.625f), float4(0.125f, 0.0625f, 0.5f, 0.3125f), float4(0.1875f, 0.0f, 0.8125f, 0.0f),
+	float4(0.5625f, 0.0f, 0.4375f, 0.0f), float4(0.1875f, 0.375f, 0.1875f, 0.25f), float4(0.4375f, 0.125f, 0.3125f, 0.125f), float4(0.0625f, 0.5f, 0.0f, 0.4375f),
+	float4(0.25f, 0.3125f, 0.1875f, 0.25f), float4(0.4375f, 0.125f, 0.375f, 0.0625f), float4(0.125f, 0.4375f, 0.0625f, 0.375f), float4(0.3125f, 0.25f, 0.25f, 0.1875f),
+	float4(0.5f, 0.0625f, 0.4375f, 0.0f), float4(0.125f, 0.4375f, 0.125f, 0.3125f), float4(0.375f, 0.1875f, 0.25f, 0.1875f), float4(0.5625f, 0.0f, 0.4375f, 0.0f),
+	float4(0.9375f, 0.0f, 0.0625f, 0.0f), float4(0.375f, 0.5625f, 0.0f, 0.0625f), float4(0.6875f, 0.25f, 0.0625f, 0.0f), float4(0.0625f, 0.875f, 0.0f, 0.0625f),
+	float4(0.4375f, 0.5f, 0.0f, 0.0625f), float4(0.75f, 0.1875f, 0.0625f, 0.0f), float4(0.1875f, 0.75f, 0.0f, 0.0625f), float4(0.5f, 0.4375f, 0.0625f, 0.0f),
+	float4(0.875f, 0.0625f, 0.0625f, 0.0f), float4(0.25f, 0.6875f, 0.0f, 0.0625f), float4(0.5625f, 0.375f, 0.0625f, 0.0f), float4(0.9375f, 0.0f, 0.0625f, 0.0f),
+	float4(0.25f, 0.0f, 0.75f, 0.0f), float4(0.125f, 0.125f, 0.25f, 0.5f), float4(0.1875f, 0.0625f, 0.5625f, 0.1875f), float4(0.0f, 0.25f, 0.0625f, 0.6875f),
+	float4(0.125f, 0.125f, 0.3125f, 0.4375f), float4(0.1875f, 0.0625f, 0.625f, 0.125f), float4(0.0625f, 0.1875f, 0.125f, 0.625f), float4(0.125f, 0.125f, 0.4375f, 0.3125f),
+	float4(0.25f, 0.0f, 0.6875f, 0.0625f), float4(0.0625f, 0.1875f, 0.1875f, 0.5625f), float4(0.1875f, 0.0625f, 0.4375f, 0.3125f), float4(0.25f, 0.0f, 0.75f, 0.0f),
+	float4(0.625f, 0.0f, 0.375f, 0.0f), float4(0.25f, 0.375f, 0.125f, 0.25f), float4(0.5f, 0.125f, 0.25f, 0.125f), float4(0.0625f, 0.5625f, 0.0f, 0.375f),
+	float4(0.25f, 0.375f, 0.1875f, 0.1875f), float4(0.5f, 0.125f, 0.3125f, 0.0625f), float4(0.125f, 0.5f, 0.0625f, 0.3125f), float4(0.375f, 0.25f, 0.1875f, 0.1875f),
+	float4(0.5625f, 0.0625f, 0.375f, 0.0f), float4(0.1875f, 0.4375f, 0.0625f, 0.3125f), float4(0.375f, 0.25f, 0.25f, 0.125f), float4(0.625f, 0.0f, 0.375f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.375f, 0.625f, 0.0f, 0.0f), float4(0.75f, 0.25f, 0.0f, 0.0f), float4(0.0625f, 0.9375f, 0.0f, 0.0f),
+	float4(0.4375f, 0.5625f, 0.0f, 0.0f), float4(0.8125f, 0.1875f, 0.0f, 0.0f), float4(0.1875f, 0.8125f, 0.0f, 0.0f), float4(0.5625f, 0.4375f, 0.0f, 0.0f),
+	float4(0.9375f, 0.0625f, 0.0f, 0.0f), float4(0.25f, 0.75f, 0.0f, 0.0f), float4(0.625f, 0.375f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+};
+static const uint4 pseudo_inverse_idx_12x12[564] =
+{
+	uint4(0, 1, 2, 4), uint4(5, 12, 13, 14), uint4(16, 17, 24, 25), uint4(48, 49, 60, 61),
+	uint4(0, 2, 3, 4), uint4(5, 6, 8, 12), uint4(14, 15, 16, 17), uint4(18, 27, 28, 52),
+	uint4(3, 5, 6, 7), uint4(8, 9, 11, 18), uint4(19, 20, 21, 23), uint4(31, 32, 55, 56),
+	uint4(6, 7, 9, 10), uint4(11, 18, 19, 21), uint4(22, 23, 33, 34), uint4(35, 58, 59, 71),
+	uint4(0, 1, 24, 25), uint4(36, 37, 38, 48), uint4(49, 50, 52, 60), uint4(61, 72, 73, 96),
+	uint4(4, 27, 28, 29), uint4(38, 39, 40, 41), uint4(48, 50, 51, 52), uint4(53, 62, 63, 64),
+	uint4(7, 30, 31, 32), uint4(42, 43, 44, 45), uint4(54, 55, 56, 57), uint4(59, 67, 68, 69),
+	uint4(10, 11, 34, 35), uint4(43, 45, 46, 47), uint4(55, 57, 58, 59), uint4(70, 71, 83, 107),
+	uint4(36, 60, 72, 73), uint4(84, 85, 86, 88), uint4(96, 97, 98, 100), uint4(108, 109, 132, 133),
+	uint4(74, 75, 76, 84), uint4(86, 87, 88, 89), uint4(98, 99, 100, 101), uint4(111, 112, 113, 136),
+	uint4(79, 80, 81, 90), uint4(91, 92, 93, 95), uint4(102, 103, 104, 105), uint4(114, 115, 116, 139),
+	uint4(47, 70, 71, 82), uint4(83, 91, 93, 94), uint4(95, 105, 106, 107), uint4(118, 119, 142, 143),
+	uint4(72, 84, 85, 108), uint4(109, 110, 120, 121), uint4(122, 124, 125, 132), uint4(133, 134, 136, 137),
+	uint4(87, 88, 111, 112), uint4(120, 122, 123, 124), uint4(125, 132, 134, 135), uint4(136, 137, 138, 140),
+	uint4(91, 115, 116, 125), uint4(126, 127, 128, 129), uint4(131, 135, 137, 138), uint4(139, 140, 141, 143),
+	uint4(82, 83, 94, 95), uint4(118, 119, 126, 127), uint4(129, 130, 131, 138), uint4(139, 141, 142, 143),
+	uint4(0, 1, 2, 3), uint4(4, 12, 13, 14), uint4(15, 16, 24, 25), uint4(36, 37, 48, 49),
+	uint4(0, 1, 2, 3), uint4(4, 6, 7, 12), uint4(13, 14, 15, 16), uint4(18, 27, 38, 39),
+	uint4(2, 3, 4, 5), uint4(6, 7, 8, 9), uint4(14, 16, 17, 18), uint4(19, 21, 41, 42),
+	uint4(4, 5, 7, 8), uint4(9, 10, 11, 17), uint4(19, 20, 21, 22), uint4(23, 32, 44, 45),
+	uint4(5, 7, 8, 9), uint4(10, 11, 19, 20), uint4(22, 23, 35, 44), uint4(46, 47, 58, 59),
+	uint4(0, 1, 12, 13), uint4(24, 25, 27, 36), uint4(37, 38, 39, 48), uint4(49, 72, 73, 84),
+	uint4(2, 3, 15, 24), uint4(26, 27, 28, 36), uint4(37, 38, 39, 40), uint4(42, 50, 51, 75),
+	uint4(5, 6, 28, 29), uint4(30, 31, 38, 39), uint4(40, 41, 42, 43), uint4(44, 45, 53, 54),
+	uint4(8, 9, 20, 31), uint4(32, 33, 35, 41), uint4(43, 44, 45, 46), uint4(47, 56, 57, 80),
+	uint4(10, 11, 22, 23), uint4(32, 34, 35, 44), uint4(45, 46, 47, 58), uint4(59, 82, 83, 95),
+	uint4(24, 25, 36, 48), uint4(49, 60, 61, 63), uint4(72, 73, 75, 84), uint4(85, 96, 108, 109),
+	uint4(27, 39, 50, 51), uint4(60, 62, 63, 64), uint4(72, 74, 75, 76), uint4(86, 87, 99, 111),
+	uint4(29, 53, 54, 62), uint4(64, 65, 66, 67), uint4(76, 77, 78, 79), uint4(81, 89, 90, 114),
+	uint4(32, 44, 56, 57), uint4(67, 68, 69, 71), uint4(79, 80, 81, 83), uint4(92, 93, 104, 116),
+	uint4(34, 35, 47, 58), uint4(59, 68, 70, 71), uint4(80, 82, 83, 94), uint4(95, 107, 118, 119),
+	uint4(48, 60, 61, 84), uint4(85, 96, 97, 98), uint4(99, 108, 109, 111), uint4(120, 121, 132, 133),
+	uint4(63, 86, 87, 96), uint4(97, 98, 99, 100), uint4(102, 108, 110, 111), uint4(112, 123, 134, 135),
+	uint4(89, 90, 98, 99), uint4(100, 101, 102, 103), uint4(104, 105, 112, 113), uint4(114, 115, 137, 138),
+	uint4(68, 92, 93, 101), uint4(103, 104, 105, 106), uint4(107, 115, 116, 117), uint4(119, 128, 140, 141),
+	uint4(59, 70, 71, 94), uint4(95, 104, 105, 106), uint4(107, 116, 118, 119), uint4(130, 131, 142, 143),
+	uint4(84, 85, 96, 97), uint4(99, 108, 120, 121), uint4(123, 124, 132, 133), uint4(134, 135, 136, 138),
+	uint4(98, 99, 111, 120), uint4(121, 122, 123, 124), uint4(126, 132, 133, 134), uint4(135, 136, 138, 139),
+	uint4(101, 102, 122, 124), uint4(125, 126, 127, 129), uint4(134, 135, 136, 137), uint4(138, 139, 140, 141),
+	uint4(104, 105, 116, 125), uint4(127, 128, 129, 130), uint4(131, 136, 137, 139), uint4(140, 141, 142, 143),
+	uint4(94, 95, 106, 107), uint4(118, 119, 127, 128), uint4(129, 130, 131, 139), uint4(140, 141, 142, 143),
+	uint4(0, 1, 2, 3), uint4(5, 12, 13, 14), uint4(15, 17, 24, 25), uint4(36, 37, 60, 61),
+	uint4(0, 1, 2, 3), uint4(4, 5, 7, 12), uint4(13, 14, 15, 17), uint4(25, 26, 38, 39),
+	uint4(0, 1, 2, 3), uint4(4, 5, 7, 9), uint4(14, 16, 17, 19), uint4(28, 29, 40, 41),
+	uint4(2, 4, 6, 7), uint4(8, 9, 10, 11), uint4(16, 18, 19, 21), uint4(30, 31, 42, 43),
+	uint4(4, 6, 7, 8), uint4(9, 10, 11, 18), uint4(20, 21, 22, 23), uint4(33, 34, 44, 45),
+	uint4(6, 8, 9, 10), uint4(11, 18, 20, 21), uint4(22, 23, 34, 35), uint4(46, 47, 70, 71),
+	uint4(0, 1, 12, 13), uint4(14, 24, 25, 26), uint4(27, 36, 37, 39), uint4(48, 60, 61, 84),
+	uint4(2, 3, 14, 15), uint4(24, 25, 26, 27), uint4(29, 36, 37, 38), uint4(39, 41, 62, 63),
+	uint4(4, 5, 16, 17), uint4(26, 27, 28, 29), uint4(31, 38, 39, 40), uint4(41, 43, 64, 65),
+	uint4(6, 7, 18, 19), uint4(28, 30, 31, 32), uint4(33, 40, 42, 43), uint4(44, 45, 66, 67),
+	uint4(8, 9, 20, 21), uint4(30, 32, 33, 34), uint4(35, 42, 44, 45), uint4(46, 47, 68, 69),
+	uint4(10, 11, 21, 22), uint4(23, 32, 33, 34), uint4(35, 44, 46, 47), uint4(59, 70, 71, 95),
+	uint4(0, 12, 24, 25), uint4(36, 48, 49, 50), uint4(51, 60, 61, 62), uint4(63, 84, 85, 108),
+	uint4(26, 27, 38, 39), uint4(48, 49, 50, 51), uint4(53, 60, 61, 62), uint4(63, 65, 86, 87),
+	uint4(28, 29, 40, 41), uint4(50, 51, 52, 53), uint4(55, 62, 63, 64), uint4(65, 67, 88, 89),
+	uint4(30, 31, 42, 43), uint4(52, 54, 55, 56), uint4(57, 64, 66, 67), uint4(68, 69, 90, 91),
+	uint4(32, 33, 44, 45), uint4(54, 56, 57, 58), uint4(59, 66, 68, 69), uint4(70, 71, 92, 93),
+	uint4(11, 23, 34, 35), uint4(47, 56, 57, 58), uint4(59, 68, 69, 70), uint4(71, 94, 95, 119),
+	uint4(24, 48, 49, 72), uint4(73, 74, 75, 84), uint4(85, 86, 87, 96), uint4(108, 109, 120, 132),
+	uint4(50, 51, 72, 73), uint4(74, 75, 77, 84), uint4(85, 86, 87, 89), uint4(98, 99, 110, 111),
+	uint4(52, 53, 74, 75), uint4(76, 77, 79, 86), uint4(87, 88, 89, 91), uint4(100, 101, 112, 113),
+	uint4(54, 55, 76, 78), uint4(79, 80, 81, 88), uint4(90, 91, 92, 93), uint4(102, 103, 114, 115),
+	uint4(56, 57, 78, 80), uint4(81, 82, 83, 90), uint4(92, 93, 94, 95), uint4(104, 105, 116, 117),
+	uint4(35, 58, 59, 80), uint4(81, 82, 83, 92), uint4(93, 94, 95, 107), uint4(118, 119, 131, 143),
+	uint4(48, 72, 73, 84), uint4(96, 97, 99, 108), uint4(109, 110, 111, 120), uint4(121, 122, 132, 133),
+	uint4(74, 75, 96, 97), uint4(98, 99, 101, 108), uint4(109, 110, 111, 113), uint4(122, 123, 134, 135),
+	uint4(76, 77, 98, 99), uint4(100, 101, 103, 110), uint4(111, 112, 113, 115), uint4(124, 125, 136, 137),
+	uint4(78, 79, 100, 102), uint4(103, 104, 105, 112), uint4(114, 115, 116, 117), uint4(126, 127, 138, 139),
+	uint4(80, 81, 102, 104), uint4(105, 106, 107, 114), uint4(116, 117, 118, 119), uint4(128, 129, 140, 141),
+	uint4(59, 82, 83, 95), uint4(104, 106, 107, 116), uint4(117, 118, 119, 129), uint4(130, 131, 142, 143),
+	uint4(72, 73, 96, 97), uint4(108, 109, 120, 121), uint4(122, 123, 125, 132), uint4(133, 134, 135, 137),
+	uint4(98, 99, 109, 110), uint4(120, 121, 122, 123), uint4(125, 132, 133, 134), uint4(135, 136, 137, 139),
+	uint4(100, 101, 112, 113), uint4(122, 124, 125, 127), uint4(132, 133, 134, 135), uint4(136, 137, 139, 141),
+	uint4(102, 103, 114, 115), uint4(124, 126, 127, 129), uint4(134, 136, 138, 139), uint4(140, 141, 142, 143),
+	uint4(104, 105, 117, 118), uint4(126, 128, 129, 130), uint4(131, 136, 138, 139), uint4(140, 141, 142, 143),
+	uint4(82, 83, 106, 107), uint4(118, 119, 126, 128), uint4(129, 130, 131, 138), uint4(140, 141, 142, 143),
+	uint4(0, 1, 2, 3), uint4(4, 5, 12, 13), uint4(14, 15, 24, 25), uint4(26, 36, 37, 48),
+	uint4(0, 1, 2, 3), uint4(4, 5, 12, 13), uint4(14, 15, 24, 25), uint4(26, 27, 37, 38),
+	uint4(0, 1, 2, 3), uint4(4, 5, 7, 14), uint4(15, 16, 17, 25), uint4(27, 28, 29, 39),
+	uint4(1, 3, 4, 5), uint4(6, 7, 8, 15), uint4(16, 17, 18, 19), uint4(27, 28, 29, 41),
+	uint4(3, 4, 5, 6), uint4(7, 8, 10, 16), uint4(17, 18, 19, 20), uint4(30, 31, 32, 42),
+	uint4(4, 6, 7, 8), uint4(9, 10, 11, 18), uint4(19, 20, 21, 22), uint4(30, 31, 32, 44),
+	uint4(6, 7, 8, 9), uint4(10, 11, 20, 21), uint4(22, 23, 32, 33), uint4(34, 35, 45, 46),
+	uint4(6, 7, 8, 9), uint4(10, 11, 21, 22), uint4(23, 32, 33, 34), uint4(35, 45, 47, 59),
+	uint4(0, 1, 2, 12), uint4(13, 14, 15, 24), uint4(25, 26, 27, 36), uint4(37, 38, 48, 60),
+	uint4(0, 1, 2, 12), uint4(13, 14, 15, 24), uint4(25, 26, 27, 28), uint4(36, 37, 38, 50),
+	uint4(3, 4, 5, 13), uint4(15, 16, 17, 24), uint4(25, 27, 28, 29), uint4(39, 40, 51, 63),
+	uint4(4, 5, 15, 16), uint4(17, 19, 27, 28), uint4(29, 30, 31, 32), uint4(40, 41, 53, 65),
+	uint4(6, 7, 16, 18), uint4(19, 20, 27, 28), uint4(29, 30, 31, 32), uint4(42, 43, 54, 66),
+	uint4(6, 7, 8, 10), uint4(18, 19, 20, 22), uint4(30, 31, 32, 34), uint4(43, 44, 56, 68),
+	uint4(9, 10, 11, 19), uint4(20, 21, 22, 23), uint4(31, 32, 33, 34), uint4(35, 45, 46, 57),
+	uint4(9, 10, 11, 20), uint4(21, 22, 23, 32), uint4(33, 34, 35, 45), uint4(46, 47, 59, 71),
+	uint4(0, 12, 14, 24), uint4(25, 36, 37, 38), uint4(39, 48, 49, 50), uint4(60, 61, 62, 84),
+	uint4(2, 13, 14, 36), uint4(37, 38, 39, 40), uint4(41, 48, 49, 50), uint4(51, 60, 61, 62),
+	uint4(3, 15, 27, 36), uint4(37, 38, 39, 40), uint4(41, 49, 51, 52), uint4(53, 63, 64, 65),
+	uint4(15, 16, 17, 39), uint4(40, 41, 42, 43), uint4(44, 51, 52, 53), uint4(54, 55, 64, 65),
+	uint4(18, 19, 20, 39), uint4(40, 41, 42, 43), uint4(44, 52, 53, 54), uint4(55, 56, 66, 67),
+	uint4(8, 19, 20, 32), uint4(42, 43, 44, 45), uint4(46, 47, 54, 55), uint4(56, 66, 67, 68),
+	uint4(21, 22, 23, 42), uint4(43, 44, 45, 46), uint4(47, 56, 57, 58), uint4(59, 69, 70, 71),
+	uint4(11, 22, 23, 34), uint4(35, 44, 45, 46), uint4(47, 57, 58, 59), uint4(69, 70, 71, 95),
+	uint4(12, 36, 37, 38), uint4(48, 49, 50, 60), uint4(61, 62, 63, 72), uint4(73, 84, 85, 96),
+	uint4(37, 38, 48, 49), uint4(50, 51, 60, 61), uint4(62, 63, 64, 65), uint4(74, 85, 86, 98),
+	uint4(37, 39, 40, 49), uint4(51, 52, 53, 61), uint4(63, 64, 65, 75), uint4(76, 87, 88, 99),
+	uint4(39, 40, 41, 51), uint4(52, 53, 55, 63), uint4(64, 65, 66, 67), uint4(68, 77, 88, 89),
+	uint4(42, 43, 44, 52), uint4(54, 55, 56, 63), uint4(64, 65, 66, 67), uint4(68, 78, 90, 91),
+	uint4(43, 44, 46, 54), uint4(55, 56, 58, 66), uint4(67, 68, 70, 79), uint4(80, 91, 92, 104),
+	uint4(45, 46, 56, 57), uint4(58, 59, 66, 67), uint4(68, 69, 70, 71), uint4(81, 93, 94, 105),
+	uint4(23, 45, 46, 47), uint4(57, 58, 59, 68), uint4(69, 70, 71, 82), uint4(83, 94, 95, 107),
+	uint4(36, 48, 49, 60), uint4(61, 72, 73, 74), uint4(75, 84, 85, 86), uint4(96, 97, 98, 120),
+	uint4(38, 49, 50, 62), uint4(72, 73, 74, 75), uint4(76, 77, 84, 85), uint4(86, 87, 97, 98),
+	uint4(39, 51, 52, 63), uint4(64, 73, 75, 76), uint4(77, 85, 87, 88), uint4(89, 97, 99, 100),
+	uint4(41, 52, 53, 65), uint4(75, 76, 77, 78), uint4(79, 87, 88, 89), uint4(91, 99, 100, 101),
+	uint4(54, 55, 66, 75), uint4(76, 77, 78, 79), uint4(80, 88, 90, 91), uint4(92, 102, 103, 104),
+	uint4(44, 55, 56, 67), uint4(68, 78, 79, 80), uint4(82, 90, 91, 92), uint4(94, 103, 104, 106),
+	uint4(45, 57, 58, 69), uint4(78, 79, 80, 81), uint4(82, 83, 92, 93), uint4(94, 95, 105, 106),
+	uint4(47, 58, 59, 70), uint4(71, 80, 81, 82), uint4(83, 93, 94, 95), uint4(105, 106, 107, 131),
+	uint4(48, 72, 73, 74), uint4(84, 85, 86, 96), uint4(97, 98, 99, 108), uint4(109, 120, 121, 132),
+	uint4(72, 73, 74, 84), uint4(85, 86, 87, 96), uint4(97, 98, 99, 100), uint4(101, 120, 121, 122),
+	uint4(75, 76, 77, 87), uint4(88, 89, 96, 97), uint4(98, 99, 100, 101), uint4(111, 123, 124, 135),
+	uint4(76, 77, 87, 88), uint4(89, 90, 91, 99), uint4(100, 101, 102, 103), uint4(104, 123, 124, 125),
+	uint4(78, 79, 88, 89), uint4(90, 91, 92, 99), uint4(100, 101, 102, 103), uint4(104, 126, 127, 128),
+	uint4(78, 79, 80, 90), uint4(91, 92, 94, 102), uint4(103, 104, 105, 106), uint4(107, 116, 128, 140),
+	uint4(81, 82, 83, 92), uint4(93, 94, 95, 102), uint4(103, 104, 105, 106), uint4(107, 129, 130, 141),
+	uint4(59, 81, 82, 83), uint4(93, 94, 95, 104), uint4(105, 106, 107, 118), uint4(119, 129, 131, 143),
+	uint4(72, 84, 96, 97), uint4(98, 108, 109, 110), uint4(111, 120, 121, 122), uint4(123, 132, 133, 134),
+	uint4(85, 86, 97, 98), uint4(108, 109, 110, 111), uint4(112, 120, 121, 122), uint4(123, 132, 133, 134),
+	uint4(75, 87, 99, 100), uint4(109, 111, 112, 113), uint4(121, 123, 124, 125), uint4(133, 135, 136, 137),
+	uint4(77, 89, 100, 101), uint4(111, 112, 113, 114), uint4(115, 116, 123, 124), uint4(125, 127, 136, 137),
+	uint4(78, 90, 102, 103), uint4(111, 112, 113, 114), uint4(115, 116, 124, 126), uint4(127, 128, 138, 139),
+	uint4(80, 92, 103, 104), uint4(114, 115, 116, 118), uint4(119, 126, 127, 128), uint4(130, 138, 139, 140),
+	uint4(93, 105, 106, 115), uint4(116, 117, 118, 119), uint4(128, 129, 130, 131), uint4(140, 141, 142, 143),
+	uint4(83, 95, 105, 106), uint4(107, 116, 117, 118), uint4(119, 128, 129, 130), uint4(131, 141, 142, 143),
+	uint4(72, 84, 96, 98), uint4(108, 109, 110, 111), uint4(120, 121, 122, 132), uint4(133, 134, 135, 136),
+	uint4(97, 98, 108, 109), uint4(110, 111, 120, 121), uint4(122, 123, 132, 133), uint4(134, 135, 136, 137),
+	uint4(99, 111, 112, 113), uint4(121, 122, 123, 124), uint4(125, 132, 133, 134), uint4(135, 136, 137, 139),
+	uint4(101, 111, 112, 113), uint4(123, 124, 125, 126), uint4(127, 133, 135, 136), uint4(137, 138, 139, 140),
+	uint4(102, 114, 115, 116), uint4(124, 125, 126, 127), uint4(128, 135, 136, 137), uint4(138, 139, 140, 142),
+	uint4(104, 114, 115, 116), uint4(118, 126, 127, 128), uint4(129, 136, 138, 139), uint4(140, 141, 142, 143),
+	uint4(105, 106, 116, 117), uint4(118, 119, 128, 129), uint4(130, 131, 138, 139), uint4(140, 141, 142, 143),
+	uint4(95, 106, 107, 117), uint4(118, 119, 128, 129), uint4(130, 131, 138, 139), uint4(140, 141, 142, 143),
+};
+static const float4 pseudo_inverse_wt_12x12[564] =
+{
+	float4(0.372894f, 0.256923f, 0.11196f, -0.0838196f), float4(-0.0479783f, 0.256923f, 0.177167f, 0.0684179f),
+	float4(-0.054934f, -0.0373133f, 0.11196f, 0.0684179f), float4(-0.0838196f, -0.054934f, -0.0479783f, -0.0373133f),
+	float4(-0.0909879f, 0.117909f, 0.210752f, 0.258298f), float4(0.147865f, 0.0595181f, -0.0548545f, -0.0634288f),
+	float4(0.0875184f, 0.151387f, 0.169957f, 0.115237f), float4(0.0547473f, 0.069936f, 0.0873885f, -0.0613613f),
+	float4(-0.0548693f, 0.0625896f, 0.152984f, 0.265976f), float4(0.216841f, 0.121196f, -0.0940065f, 0.0905414f),
+	float4(0.174722f, 0.155608f, 0.0899838f, -0.0651758f), float4(0.0894662f, 0.0715613f, -0.0641045f, -0.0519881f),
+	float4(-0.0498354f, -0.0866447f, 0.111029f, 0.257482f), float4(0.374645f, -0.0291646f, -0.0564322f, 0.0675533f),
+	float4(0.177163f, 0.257482f, 0.0316313f, 0.0675533f), float4(0.111029f, -0.0564322f, -0.0866447f, -0.0498354f),
+	float4(-0.0909879f, -0.0634288f, 0.117909f, 0.0875184f), float4(0.210752f, 0.151387f, 0.069936f, 0.258298f),
+	float4(0.169957f, 0.0873885f, -0.0613613f, 0.147865f), float4(0.115237f, 0.0595181f, 0.0547473f, -0.0548545f),
+	float4(-0.0669801f, 0.0671836f, 0.080691f, 0.0612792f), float4(0.0671836f, 0.143792f, 0.157299f, 0.0884918f),
+	float4(-0.0669801f, 0.080691f, 0.157299f, 0.196055f), float4(0.102549f, 0.0612792f, 0.0884918f, 0.102549f),
+	float4(-0.0704557f, 0.0596726f, 0.0790957f, 0.0655247f), float4(0.0877525f, 0.156531f, 0.14296f, 0.0655247f),
+	float4(0.10246f, 0.195916f, 0.156531f, 0.0790957f), float4(-0.0704557f, 0.10246f, 0.0877525f, 0.0596726f),
+	float4(-0.0651758f, -0.0940065f, 0.0899838f, 0.121196f), float4(-0.0519881f, 0.0715613f, 0.155608f, 0.216841f),
+	float4(-0.0641045f, 0.0894662f, 0.174722f, 0.265976f), float4(0.0905414f, 0.152984f, 0.0625896f, -0.0548693f),
+	float4(-0.0548693f, 0.0625896f, 0.152984f, 0.0905414f), float4(0.265976f, 0.174722f, 0.0894662f, -0.0641045f),
+	float4(0.216841f, 0.155608f, 0.0715613f, -0.0519881f), float4(0.121196f, 0.0899838f, -0.0940065f, -0.0651758f),
+	float4(0.0596726f, 0.0877525f, 0.10246f, -0.0704557f), float4(0.0790957f, 0.156531f, 0.195916f, 0.10246f),
+	float4(0.0655247f, 0.14296f, 0.156531f, 0.0877525f), float4(0.0655247f, 0.0790957f, 0.0596726f, -0.0704557f),
+	float4(0.102549f, 0.0884918f, 0.0612792f, 0.102549f), float4(0.196055f, 0.157299f, 0.080691f, -0.0669801f),
+	float4(0.0884918f, 0.157299f, 0.143792f, 0.0671836f), float4(0.0612792f, 0.080691f, 0.0671836f, -0.0669801f),
+	float4(-0.0548545f, 0.0547473f, 0.0595181f, 0.115237f), float4(0.147865f, -0.0613613f, 0.0873885f, 0.169957f),
+	float4(0.258298f, 0.069936f, 0.151387f, 0.210752f), float4(0.0875184f, 0.117909f, -0.0634288f, -0.0909879f),
+	float4(-0.0498354f, -0.0866447f, -0.0564322f, 0.111029f), float4(0.0675533f, 0.0316313f, 0.257482f, 0.177163f),
+	float4(0.0675533f, -0.0564322f, -0.0291646f, 0.374645f), float4(0.257482f, 0.111029f, -0.0866447f, -0.0498354f),
+	float4(-0.0519881f, -0.0641045f, 0.0715613f, 0.0894662f), float4(-0.0651758f, 0.0899838f, 0.155608f, 0.174722f),
+	float4(0.0905414f, -0.0940065f, 0.121196f, 0.216841f), float4(0.265976f, 0.152984f, 0.0625896f, -0.0548693f),
+	float4(-0.0613613f, 0.0873885f, 0.069936f, 0.0547473f), float4(0.115237f, 0.169957f, 0.151387f, 0.0875184f),
+	float4(-0.0634288f, -0.0548545f, 0.0595181f, 0.147865f), float4(0.258298f, 0.210752f, 0.117909f, -0.0909879f),
+	float4(-0.0373133f, -0.0479783f, -0.054934f, -0.0838196f), float4(0.0684179f, 0.11196f, -0.0373133f, -0.054934f),
+	float4(0.0684179f, 0.177167f, 0.256923f, -0.0479783f), float4(-0.0838196f, 0.11196f, 0.256923f, 0.372894f),
+	float4(0.546154f, 0.291775f, 0.0373956f, -0.121464f), float4(-0.0571087f, 0.291775f, 0.142328f, 0.0453478f),
+	float4(-0.061046f, -0.0358397f, 0.0373956f, 0.0453478f), float4(-0.121464f, -0.061046f, -0.0571087f, -0.0358397f),
+	float4(-0.13219f, 0.0857047f, 0.3036f, 0.412438f), float4(0.193889f, -0.102444f, -0.0394645f, -0.0687358f),
+	float4(0.0584775f, 0.14035f, 0.203848f, 0.120464f), float4(-0.0536706f, 0.0403117f, -0.0626121f, -0.0900821f),
+	float4(-0.0905942f, -0.0935848f, 0.14851f, 0.390604f), float4(0.391355f, 0.150764f, -0.0898276f, -0.0880478f),
+	float4(-0.0411839f, 0.0619374f, 0.20423f, 0.204699f), float4(0.0633438f, -0.0527173f, -0.080613f, -0.0807094f),
+	float4(-0.0377111f, -0.0991878f, 0.187498f, 0.399114f), float4(0.294401f, 0.0844289f, -0.125544f, -0.0518344f),
+	float4(0.11632f, 0.196725f, 0.177977f, 0.0539683f), float4(-0.0700399f, 0.0380726f, -0.0883545f, -0.0648752f),
+	float4(0.0286951f, -0.0541738f, -0.115348f, 0.043553f), float4(0.297198f, 0.550843f, -0.0329162f, -0.0548984f),
+	float4(0.148251f, 0.297198f, 0.043553f, 0.0299186f), float4(-0.0548984f, -0.115348f, -0.0329162f, -0.0541738f),
+	float4(-0.13219f, -0.0687358f, 0.0857047f, 0.0584775f), float4(0.3036f, 0.14035f, -0.0626121f, 0.412438f),
+	float4(0.203848f, 0.0403117f, -0.0900821f, 0.193889f), float4(0.120464f, -0.102444f, -0.0536706f, -0.0394645f),
+	float4(-0.0733029f, -0.098517f, 0.0773387f, -0.0733029f), float4(0.164924f, 0.215149f, 0.11614f, -0.098517f),
+	float4(0.0773387f, 0.215149f, 0.303203f, 0.128103f), float4(-0.072273f, 0.11614f, 0.128103f, -0.072273f),
+	float4(-0.0904544f, -0.0905563f, 0.0675681f, 0.215803f), float4(0.215524f, 0.0666427f, -0.0629258f, -0.065578f),
+	float4(0.123488f, 0.273469f, 0.273101f, 0.122542f), float4(-0.0672587f, -0.0643955f, 0.127695f, 0.127484f),
+	float4(-0.0966198f, -0.070077f, 0.0811726f, 0.11888f), float4(0.220507f, 0.170179f, -0.070077f, -0.0737182f),
+	float4(0.130734f, 0.309278f, 0.220507f, 0.0811726f), float4(-0.0966198f, 0.130734f, 0.11888f, -0.0737182f),
+	float4(-0.0700399f, -0.125544f, 0.0539683f, 0.0844289f), float4(-0.0648752f, 0.177977f, 0.294401f, -0.0883545f),
+	float4(0.0380726f, 0.196725f, 0.399114f, 0.11632f), float4(0.187498f, -0.0518344f, -0.0991878f, -0.0377111f),
+	float4(-0.0905942f, -0.0411839f, -0.0935848f, 0.14851f), float4(0.0619374f, 0.390604f, 0.20423f, -0.080613f),
+	float4(0.391355f, 0.204699f, -0.0807094f, 0.150764f), float4(0.0633438f, -0.0898276f, -0.0880478f, -0.0527173f),
+	float4(-0.0629258f, -0.065578f, 0.0675681f, 0.123488f), float4(-0.0904544f, 0.215803f, 0.273469f, 0.127695f),
+	float4(-0.0905563f, 0.215524f, 0.273101f, 0.127484f), float4(0.0666427f, 0.122542f, -0.0672587f, -0.0643955f),
+	float4(-0.0511635f, 0.103594f, 0.103643f, -0.0511635f), float4(0.103594f, 0.248876f, 0.248901f, 0.103643f),
+	float4(0.103643f, 0.248901f, 0.248876f, 0.103594f), float4(-0.0511635f, 0.103643f, 0.103594f, -0.0511635f),
+	float4(-0.0643955f, -0.0672587f, 0.122542f, 0.0666427f), float4(0.127484f, 0.273101f, 0.215524f, -0.0905563f),
+	float4(0.127695f, 0.273469f, 0.215803f, -0.0904544f), float4(0.123488f, 0.0675681f, -0.065578f, -0.0629258f),
+	float4(-0.0527173f, -0.0880478f, -0.0898276f, 0.0633438f), float4(0.150764f, -0.0807094f, 0.204699f, 0.391355f),
+	float4(-0.080613f, 0.20423f, 0.390604f, 0.0619374f), float4(0.14851f, -0.0935848f, -0.0411839f, -0.0905942f),
+	float4(-0.0377111f, -0.0991878f, -0.0518344f, 0.187498f), float4(0.11632f, 0.399114f, 0.196725f, 0.0380726f),
+	float4(-0.0883545f, 0.294401f, 0.177977f, -0.0648752f), float4(0.0844289f, 0.0539683f, -0.125544f, -0.0700399f),
+	float4(-0.0737182f, 0.11888f, 0.130734f, -0.0966198f), float4(0.0811726f, 0.220507f, 0.309278f, 0.130734f),
+	float4(-0.0737182f, -0.070077f, 0.170179f, 0.220507f), float4(0.11888f, 0.0811726f, -0.070077f, -0.0966198f),
+	float4(0.127484f, 0.127695f, -0.0643955f, -0.0672587f), float4(0.122542f, 0.273101f, 0.273469f, 0.123488f),
+	float4(-0.065578f, -0.0629258f, 0.0666427f, 0.215524f), float4(0.215803f, 0.0675681f, -0.0905563f, -0.0904544f),
+	float4(-0.072273f, 0.128103f, 0.11614f, -0.072273f), float4(0.128103f, 0.303203f, 0.215149f, 0.0773387f),
+	float4(-0.098517f, 0.11614f, 0.215149f, 0.164924f), float4(-0.0733029f, 0.0773387f, -0.098517f, -0.0733029f),
+	float4(-0.0394645f, -0.0536706f, -0.102444f, 0.120464f), float4(0.193889f, -0.0900821f, 0.0403117f, 0.203848f),
+	float4(0.412438f, -0.0626121f, 0.14035f, 0.3036f), float4(0.0584775f, 0.0857047f, -0.0687358f, -0.13219f),
+	float4(-0.0541738f, -0.0329162f, -0.115348f, -0.0548984f), float4(0.0299186f, 0.043553f, 0.297198f, 0.148251f),
+	float4(-0.0548984f, -0.0329162f, 0.550843f, 0.297198f), float4(0.043553f, -0.115348f, -0.0541738f, 0.0286951f),
+	float4(-0.0648752f, -0.0883545f, 0.0380726f, -0.0700399f), float4(0.0539683f, 0.177977f, 0.196725f, 0.11632f),
+	float4(-0.0518344f, -0.125544f, 0.0844289f, 0.294401f), float4(0.399114f, 0.187498f, -0.0991878f, -0.0377111f),
+	float4(-0.0807094f, -0.080613f, -0.0527173f, 0.0633438f), float4(0.204699f, 0.20423f, 0.0619374f, -0.0411839f),
+	float4(-0.0880478f, -0.0898276f, 0.150764f, 0.391355f), float4(0.390604f, 0.14851f, -0.0935848f, -0.0905942f),
+	float4(-0.0900821f, -0.0626121f, 0.0403117f, -0.0536706f), float4(0.120464f, 0.203848f, 0.14035f, 0.0584775f),
+	float4(-0.0687358f, -0.0394645f, -0.102444f, 0.193889f), float4(0.412438f, 0.3036f, 0.0857047f, -0.13219f),
+	float4(-0.0358397f, -0.0571087f, -0.061046f, -0.121464f), float4(0.0453478f, 0.0373956f, -0.0358397f, -0.061046f),
+	float4(0.0453478f, 0.142328f, 0.291775f, -0.0571087f), float4(-0.121464f, 0.0373956f, 0.291775f, 0.546154f),
+	float4(0.640541f, 0.296033f, -0.0976905f, -0.0754454f), float4(0.0296558f, 0.296033f, 0.132031f, -0.0210172f),
+	float4(-0.041109f, 0.0156835f, -0.0976905f, -0.0210172f), float4(-0.0754454f, -0.041109f, 0.0296558f, 0.0156835f),
+	float4(-0.146906f, 0.186046f, 0.566562f, 0.315209f), float4(-0.0335281f, -0.12429f, 0.0394118f, -0.0632702f),
+	float4(0.0920372f, 0.235694f, 0.167159f, -0.0638364f), float4(-0.049238f, -0.0832249f, -0.061493f, -0.0347938f),
+	float4(0.0436556f, -0.0555005f, -0.168822f, 0.134857f), float4(0.505675f, 0.451371f, -0.143282f, 0.047817f),
+	float4(-0.0649466f, 0.215259f, 0.226469f, -0.0591507f), float4(-0.0603187f, -0.0493092f, -0.0569133f, -0.06018f),
+	float4(0.0477914f, -0.143287f, 0.452637f, 0.506959f), float4(0.135198f, -0.169255f, -0.0556556f, 0.0437437f),
+	float4(-0.0591864f, 0.225002f, 0.213451f, -0.0641753f), float4(-0.0540539f, -0.0650455f, -0.048002f, -0.0598089f),
+	float4(0.0394345f, -0.124634f, -0.0338643f, 0.31518f), float4(0.566779f, 0.186125f, -0.146947f, -0.063452f),
+	float4(0.167248f, 0.235341f, 0.0919403f, -0.063192f), float4(-0.0841319f, -0.0495928f, -0.0343187f, -0.061269f),
+	float4(0.0297199f, -0.075438f, -0.0977286f, 0.296019f), float4(0.640549f, 0.0156118f, -0.0411281f, -0.0209547f),
+	float4(0.132048f, 0.296019f, -0.0209547f, -0.0977286f), float4(-0.0411281f, -0.075438f, 0.0156118f, 0.0297199f),
+	float4(-0.146906f, -0.0632702f, 0.186046f, 0.0920372f), float4(-0.049238f, 0.566562f, 0.235694f, -0.0832249f),
+	float4(-0.061493f, 0.315209f, 0.167159f, -0.0347938f), float4(-0.0335281f, -0.12429f, -0.0638364f, 0.0394118f),
+	float4(-0.131486f, -0.0684229f, 0.194148f, 0.0741541f), float4(-0.131486f, 0.194148f, 0.509127f, 0.26325f),
+	float4(-0.105246f, -0.0684229f, 0.0741541f, 0.26325f), float4(0.141696f, -0.0735246f, -0.105246f, -0.0735246f),
+	float4(-0.114696f, -0.100213f, 0.160328f, 0.110754f), float4(-0.150512f, 0.134684f, 0.422019f, 0.369781f),
+	float4(-0.127314f, -0.0795433f, 0.0802504f, 0.240875f), float4(0.250273f, -0.0784102f, -0.0868535f, -0.0768312f),
+	float4(-0.105446f, -0.120038f, 0.116811f, 0.167848f), float4(-0.12739f, 0.389387f, 0.441699f, 0.140492f),
+	float4(-0.158415f, -0.072334f, 0.200415f, 0.252874f), float4(0.0846089f, -0.0827671f, -0.0758729f, -0.0888475f),
+	float4(-0.0682347f, -0.132478f, 0.0736614f, 0.195774f), float4(-0.111401f, 0.262451f, 0.513292f, 0.195774f),
+	float4(-0.132478f, -0.0591826f, 0.139509f, 0.262451f), float4(0.0736614f, -0.0682347f, -0.0591826f, -0.111401f),
+	float4(-0.063192f, -0.146947f, -0.0495928f, 0.0919403f), float4(0.186125f, -0.061269f, -0.0841319f, 0.235341f),
+	float4(0.566779f, -0.0343187f, 0.167248f, 0.31518f), float4(-0.0338643f, -0.063452f, -0.124634f, 0.0394345f),
+	float4(0.0436556f, -0.0555005f, -0.168822f, -0.0649466f), float4(0.134857f, 0.505675f, 0.215259f, -0.0603187f),
+	float4(-0.0569133f, 0.451371f, 0.226469f, -0.0493092f), float4(-0.06018f, -0.143282f, -0.0591507f, 0.047817f),
+	float4(-0.150512f, -0.0795433f, 0.134684f, 0.0802504f), float4(-0.114696f, 0.160328f, 0.422019f, 0.240875f),
+	float4(-0.0868535f, -0.100213f, 0.110754f, 0.369781f), float4(0.250273f, -0.0768312f, -0.127314f, -0.0784102f),
+	float4(-0.109782f, -0.0944531f, 0.113747f, 0.0656215f), float4(-0.109782f, 0.113747f, 0.399211f, 0.350299f),
+	float4(-0.0987162f, -0.0944531f, 0.0656215f, 0.350299f), float4(0.299701f, -0.0879803f, -0.0987162f, -0.0879803f),
+	float4(-0.103303f, -0.112898f, 0.115021f, 0.104267f), float4(-0.10123f, 0.33432f, 0.382739f, 0.104267f),
+	float4(-0.112898f, -0.0885947f, 0.287126f, 0.33432f), float4(0.115021f, -0.103303f, -0.0885947f, -0.10123f),
+	float4(-0.0827671f, -0.158415f, 0.0846089f, 0.140492f), float4(-0.0888475f, 0.252874f, 0.441699f, 0.167848f),
+	float4(-0.120038f, -0.0758729f, 0.200415f, 0.389387f), float4(0.116811f, -0.105446f, -0.072334f, -0.12739f),
+	float4(0.0437437f, -0.0556556f, -0.0641753f, -0.169255f), float4(0.135198f, -0.0598089f, -0.0650455f, 0.213451f),
+	float4(0.506959f, -0.048002f, -0.0540539f, 0.225002f), float4(0.452637f, -0.0591864f, -0.143287f, 0.0477914f),
+	float4(0.0477914f, -0.143287f, -0.0591864f, 0.452637f), float4(0.225002f, -0.0540539f, -0.048002f, 0.506959f),
+	float4(0.213451f, -0.0650455f, -0.0598089f, 0.135198f), float4(-0.169255f, -0.0641753f, -0.0556556f, 0.0437437f),
+	float4(-0.12739f, -0.072334f, -0.105446f, 0.116811f), float4(0.389387f, 0.200415f, -0.0758729f, -0.120038f),
+	float4(0.167848f, 0.441699f, 0.252874f, -0.0888475f), float4(0.140492f, 0.0846089f, -0.158415f, -0.0827671f),
+	float4(-0.10123f, -0.0885947f, -0.103303f, 0.115021f), float4(0.33432f, 0.287126f, -0.0885947f, -0.112898f),
+	float4(0.104267f, 0.382739f, 0.33432f, -0.10123f), float4(0.104267f, 0.115021f, -0.112898f, -0.103303f),
+	float4(-0.0879803f, -0.0987162f, -0.0879803f, 0.299701f), float4(0.350299f, 0.0656215f, -0.0944531f, -0.0987162f),
+	float4(0.350299f, 0.399211f, 0.113747f, -0.109782f), float4(0.0656215f, 0.113747f, -0.0944531f, -0.109782f),
+	float4(-0.0784102f, -0.127314f, -0.0768312f, 0.250273f), float4(0.369781f, 0.110754f, -0.100213f, -0.0868535f),
+	float4(0.240875f, 0.422019f, 0.160328f, -0.114696f), float4(0.0802504f, 0.134684f, -0.0795433f, -0.150512f),
+	float4(0.047817f, -0.0591507f, -0.143282f, -0.06018f), float4(-0.0493092f, 0.226469f, 0.451371f, -0.0569133f),
+	float4(-0.0603187f, 0.215259f, 0.505675f, 0.134857f), float4(-0.0649466f, -0.168822f, -0.0555005f, 0.0436556f),
+	float4(0.0394345f, -0.124634f, -0.063452f, -0.0338643f), float4(0.31518f, 0.167248f, -0.0343187f, 0.566779f),
+	float4(0.235341f, -0.0841319f, -0.061269f, 0.186125f), float4(0.0919403f, -0.0495928f, -0.146947f, -0.063192f),
+	float4(-0.111401f, -0.0591826f, -0.0682347f, 0.0736614f), float4(0.262451f, 0.139509f, -0.0591826f, -0.132478f),
+	float4(0.195774f, 0.513292f, 0.262451f, -0.111401f), float4(0.195774f, 0.0736614f, -0.132478f, -0.0682347f),
+	float4(-0.0888475f, -0.0758729f, -0.0827671f, 0.0846089f), float4(0.252874f, 0.200415f, -0.072334f, -0.158415f),
+	float4(0.140492f, 0.441699f, 0.389387f, -0.12739f), float4(0.167848f, 0.116811f, -0.120038f, -0.105446f),
+	float4(-0.0768312f, -0.0868535f, -0.0784102f, 0.250273f), float4(0.240875f, 0.0802504f, -0.0795433f, -0.127314f),
+	float4(0.369781f, 0.422019f, 0.134684f, -0.150512f), float4(0.110754f, 0.160328f, -0.100213f, -0.114696f),
+	float4(-0.0735246f, -0.105246f, -0.0735246f, 0.141696f), float4(0.26325f, 0.0741541f, -0.0684229f, -0.105246f),
+	float4(0.26325f, 0.509127f, 0.194148f, -0.131486f), float4(0.0741541f, 0.194148f, -0.0684229f, -0.131486f),
+	float4(0.0394118f, -0.0638364f, -0.12429f, -0.0335281f), float4(-0.0347938f, 0.167159f, 0.315209f, -0.061493f),
+	float4(-0.0832249f, 0.235694f, 0.566562f, -0.049238f), float4(0.0920372f, 0.186046f, -0.0632702f, -0.146906f),
+	float4(0.0297199f, 0.0156118f, -0.075438f, -0.0411281f), float4(-0.0977286f, -0.0209547f, 0.296019f, 0.132048f),
+	float4(-0.0209547f, -0.0411281f, 0.0156118f, 0.640549f), float4(0.296019f, -0.0977286f, -0.075438f, 0.0297199f),
+	float4(-0.061269f, -0.0343187f, -0.0495928f, -0.0841319f), float4(-0.063192f, 0.0919403f, 0.235341f, 0.167248f),
+	float4(-0.063452f, -0.146947f, 0.186125f, 0.566779f), float4(0.31518f, -0.0338643f, -0.124634f, 0.0394345f),
+	float4(-0.0598089f, -0.048002f, -0.0650455f, -0.0540539f), float4(-0.0641753f, 0.213451f, 0.225002f, -0.0591864f),
+	float4(0.0437437f, -0.0556556f, -0.169255f, 0.135198f), float4(0.506959f, 0.452637f, -0.143287f, 0.0477914f),
+	float4(-0.06018f, -0.0569133f, -0.0493092f, -0.0603187f), float4(-0.0591507f, 0.226469f, 0.215259f, -0.0649466f),
+	float4(0.047817f, -0.143282f, 0.451371f, 0.505675f), float4(0.134857f, -0.168822f, -0.0555005f, 0.0436556f),
+	float4(-0.0347938f, -0.061493f, -0.0832249f, -0.049238f), float4(-0.0638364f, 0.167159f, 0.235694f, 0.0920372f),
+	float4(-0.0632702f, 0.0394118f, -0.12429f, -0.0335281f), float4(0.315209f, 0.566562f, 0.186046f, -0.146906f),
+	float4(0.0156835f, 0.0296558f, -0.041109f, -0.0754454f), float4(-0.0210172f, -0.0976905f, 0.0156835f, -0.041109f),
+	float4(-0.0210172f, 0.132031f, 0.296033f, 0.0296558f), float4(-0.0754454f, -0.0976905f, 0.296033f, 0.640541f),
+	float4(0.857585f, 0.185339f, -0.151503f, 0.0313859f), float4(0.0137117f, -0.00976889f, 0.185339f, 0.0272805f),
+	float4(-0.0351727f, 0.0109122f, -0.151503f, -0.0351727f), float4(0.0359858f, 0.0313859f, 0.0109122f, 0.0137117f),
+	float4(-0.218008f, 0.582393f, 0.738674f, -0.152218f), float4(-0.0666478f, 0.0473848f, -0.0441146f, 0.12923f),
+	float4(0.189455f, -0.0574693f, 0.04047f, -0.109513f), float4(-0.153072f, 0.035653f, 0.0255918f, 0.038895f),
+	float4(0.0480122f, -0.12775f, 0.0525411f, 0.83835f), float4(0.260283f, -0.184469f, 0.0358234f, -0.0225569f),
+	float4(0.197021f, 0.0776787f, -0.047186f, 0.0317946f), float4(-0.162281f, -0.0551935f, 0.0278587f, 0.0346732f),
+	float4(0.0344493f, -0.225651f, 0.499413f, 0.812309f), float4(-0.0743733f, -0.157694f, 0.0710568f, -0.0489591f),
+	float4(0.0774837f, 0.193826f, -0.0331853f, -0.0262426f), float4(0.0491021f, -0.0836903f, -0.143506f, 0.0299477f),
+	float4(0.0712699f, -0.157625f, -0.074398f, 0.812202f), float4(0.499572f, -0.224944f, 0.0363076f, -0.0262484f),
+	float4(-0.0331803f, 0.193837f, 0.0774734f, -0.0480226f), float4(-0.143455f, -0.0837774f, 0.0498412f, 0.029899f),
+	float4(0.0357344f, -0.184065f, 0.259719f, 0.835746f), float4(0.0430122f, -0.134506f, 0.0500759f, -0.047211f),
+	float4(0.077693f, 0.193597f, 0.0395374f, -0.0412464f), float4(0.0276743f, -0.0549016f, -0.16497f, 0.0350745f),
+	float4(0.0498787f, -0.0700573f, -0.16182f, 0.755963f), float4(0.597509f, -0.222815f, -0.0504343f, 0.122289f),
+	float4(0.156504f, -0.0555033f, 0.0484819f, -0.117659f), float4(-0.113041f, 0.0320388f, 0.0266429f, 0.0212319f),
+	float4(-0.0101897f, 0.0143004f, 0.0330202f, -0.154592f), float4(0.183296f, 0.860148f, -0.0217591f, 0.0190406f),
+	float4(0.183296f, -0.0103592f, 0.0261567f, -0.0217591f), float4(-0.154592f, -0.0103592f, 0.0330202f, 0.0143004f),
+	float4(-0.218008f, -0.0441146f, 0.04047f, 0.582393f), float4(0.12923f, -0.109513f, 0.0255918f, 0.738674f),
+	float4(0.189455f, -0.153072f, 0.038895f, -0.152218f), float4(-0.0574693f, 0.035653f, -0.0666478f, 0.0473848f),
+	float4(0.0775638f, -0.177969f, -0.223561f, -0.177969f), float4(0.447303f, 0.520105f, -0.121264f, -0.223561f),
+	float4(0.520105f, 0.739205f, -0.187804f, -0.0851043f), float4(0.0726885f, -0.121264f, -0.187804f, -0.0851043f),
+	float4(-0.244993f, -0.0722448f, 0.0601354f, -0.129193f), float4(0.60279f, 0.169014f, -0.126078f, 0.0626549f),
+	float4(-0.144469f, 0.791542f, 0.242232f, -0.171197f), float4(-0.168272f, -0.0942258f, -0.0886761f, 0.0571987f),
+	float4(-0.124834f, -0.199253f, -0.154568f, 0.364021f), float4(0.520499f, -0.107481f, -0.200469f, 0.429978f),
+	float4(0.704319f, -0.0770146f, -0.125867f, 0.0588909f), float4(-0.0587371f, -0.145759f, -0.0815859f, 0.0540311f),
+	float4(-0.199168f, -0.124946f, -0.107367f, 0.520319f), float4(0.364284f, -0.155299f, 0.0587058f, -0.125733f),
+	float4(-0.0770529f, 0.704104f, 0.430307f, -0.201045f), float4(-0.145585f, -0.05903f, -0.0815385f, 0.0539521f),
+	float4(0.0597559f, -0.0717713f, -0.242555f, 0.0558751f), float4(-0.12534f, 0.167992f, 0.605863f, -0.0908743f),
+	float4(-0.170273f, 0.240917f, 0.793901f, -0.144625f), float4(-0.0930984f, -0.167837f, -0.0874031f, 0.0565328f),
+	float4(-0.188293f, -0.142554f, 0.0611457f, -0.0497035f), float4(-0.100265f, 0.549597f, 0.36616f, -0.142554f),
+	float4(-0.0650195f, -0.139102f, 0.609802f, 0.549597f), float4(-0.188293f, -0.139102f, -0.100265f, -0.0650195f),
+	float4(0.0320388f, -0.0555033f, -0.222815f, 0.0212319f), float4(-0.113041f, 0.156504f, 0.597509f, 0.0266429f),
+	float4(-0.117659f, 0.122289f, 0.755963f, 0.0484819f), float4(-0.0504343f, -0.16182f, -0.0700573f, 0.0498787f),
+	float4(0.0480122f, -0.12775f, 0.0317946f, 0.0525411f), float4(-0.0225569f, 0.83835f, 0.197021f, -0.162281f),
+	float4(0.0346732f, 0.260283f, 0.0776787f, -0.0551935f), float4(-0.184469f, -0.047186f, 0.0278587f, 0.0358234f),
+	float4(0.0626549f, -0.129193f, -0.144469f, -0.244993f), float4(0.60279f, 0.791542f, -0.168272f, -0.0886761f),
+	float4(0.0571987f, -0.0722448f, 0.169014f, 0.242232f), float4(-0.0942258f, 0.0601354f, -0.126078f, -0.171197f),
+	float4(0.055921f, -0.136759f, 0.0448661f, 0.055921f), float4(-0.136759f, 0.0448661f, 0.808594f, 0.287853f),
+	float4(-0.186724f, -0.0440188f, 0.287853f, 0.0678835f), float4(-0.0658828f, -0.186724f, -0.0658828f, 0.0495544f),
+	float4(0.0526806f, -0.086515f, -0.13129f, -0.2301f), float4(0.473897f, 0.825069f, -0.0739762f, -0.160104f),
+	float4(0.0777291f, -0.0840809f, 0.17249f, 0.305136f), float4(-0.0750447f, -0.0602634f, -0.104537f, -0.202f),
+	float4(-0.131176f, -0.0866724f, 0.0528106f, 0.0776769f), float4(-0.160099f, -0.0739816f, 0.825062f, 0.473913f),
+	float4(-0.230254f, -0.0602651f, -0.0750443f, 0.305131f), float4(0.172482f, -0.0840613f, -0.201988f, -0.104546f),
+	float4(0.0550006f, -0.0435646f, -0.137011f, 0.0454412f), float4(-0.186756f, 0.28788f, 0.809185f, 0.0454412f),
+	float4(-0.137011f, 0.0550006f, -0.0658818f, 0.0679209f), float4(0.28788f, 0.0495361f, -0.0658818f, -0.186756f),
+	float4(-0.144625f, -0.0908743f, 0.0558751f, 0.0565328f), float4(-0.0874031f, -0.167837f, 0.793901f, 0.605863f),
+	float4(-0.242555f, -0.0930984f, 0.240917f, 0.167992f), float4(-0.0717713f, -0.170273f, -0.12534f, 0.0597559f),
+	float4(0.0500759f, -0.0412464f, -0.134506f, 0.0395374f), float4(0.0430122f, 0.0350745f, -0.16497f, 0.193597f),
+	float4(0.835746f, -0.0549016f, 0.077693f, 0.259719f), float4(0.0276743f, -0.047211f, -0.184065f, 0.0357344f),
+	float4(0.0344493f, -0.225651f, -0.0489591f, 0.0491021f), float4(0.499413f, 0.0774837f, -0.0836903f, 0.812309f),
+	float4(0.193826f, -0.143506f, 0.0299477f, -0.0743733f), float4(-0.0331853f, -0.157694f, -0.0262426f, 0.0710568f),
+	float4(-0.154568f, -0.200469f, -0.124834f, 0.364021f), float4(0.429978f, -0.0587371f, -0.199253f, 0.520499f),
+	float4(0.704319f, -0.145759f, -0.0815859f, 0.0540311f), float4(-0.0770146f, -0.107481f, -0.125867f, 0.0588909f),
+	float4(0.0526806f, -0.2301f, -0.0840809f, -0.086515f), float4(0.473897f, 0.17249f, -0.104537f, -0.13129f),
+	float4(0.825069f, 0.305136f, -0.202f, -0.0739762f), float4(-0.0750447f, -0.160104f, -0.0602634f, 0.0777291f),
+	float4(0.0665975f, -0.123166f, -0.221254f, -0.123166f), float4(0.269805f, 0.421194f, -0.0762966f, -0.221254f),
+	float4(0.421194f, 0.828475f, -0.114138f, -0.126613f), float4(0.0656715f, -0.114138f, -0.0762966f, -0.126613f),
+	float4(-0.221249f, -0.123177f, 0.0666388f, -0.0762969f), float4(0.421198f, 0.269807f, -0.123177f, 0.0656727f),
+	float4(-0.126612f, -0.114139f, 0.82847f, 0.421198f), float4(-0.221249f, -0.114139f, -0.126612f, -0.0762969f),
+	float4(-0.0840613f, -0.230254f, 0.0528106f, -0.104546f), float4(0.172482f, 0.473913f, -0.0866724f, -0.201988f),
+	float4(0.305131f, 0.825062f, -0.131176f, -0.0750443f), float4(-0.0739816f, -0.0602651f, -0.160099f, 0.0776769f),
+	float4(-0.201045f, -0.155299f, -0.05903f, 0.430307f), float4(0.364284f, -0.124946f, 0.0539521f, -0.0815385f),
+	float4(-0.145585f, 0.704104f, 0.520319f, -0.199168f), float4(-0.0770529f, -0.125733f, -0.107367f, 0.0587058f),
+	float4(0.0363076f, 0.0498412f, -0.0480226f, -0.224944f), float4(-0.0837774f, 0.0774734f, 0.499572f, 0.029899f),
+	float4(-0.143455f, 0.193837f, 0.812202f, -0.0331803f), float4(-0.074398f, -0.0262484f, -0.157625f, 0.0712699f),
+	float4(0.0712699f, -0.157625f, -0.0262484f, -0.074398f), float4(-0.0331803f, 0.812202f, 0.193837f, -0.143455f),
+	float4(0.029899f, 0.499572f, 0.0774734f, -0.0837774f), float4(-0.224944f, -0.0480226f, 0.0498412f, 0.0363076f),
+	float4(0.0587058f, -0.107367f, -0.125733f, -0.0770529f), float4(-0.199168f, 0.520319f, 0.704104f, -0.145585f),
+	float4(-0.0815385f, 0.0539521f, -0.124946f, 0.364284f), float4(0.430307f, -0.05903f, -0.155299f, -0.201045f),
+	float4(0.0776769f, -0.160099f, -0.0602651f, -0.0739816f), float4(-0.0750443f, -0.131176f, 0.825062f, 0.305131f),
+	float4(-0.201988f, -0.0866724f, 0.473913f, 0.172482f), float4(-0.104546f, 0.0528106f, -0.230254f, -0.0840613f),
+	float4(0.0656727f, -0.0762969f, -0.126612f, -0.114139f), float4(-0.221249f, 0.421198f, 0.82847f, -0.114139f),
+	float4(-0.126612f, -0.123177f, 0.269807f, 0.421198f), float4(-0.0762969f, 0.0666388f, -0.123177f, -0.221249f),
+	float4(-0.126613f, -0.0762966f, -0.114138f, 0.0656715f), float4(-0.126613f, -0.114138f, 0.828475f, 0.421194f),
+	float4(-0.221254f, -0.0762966f, 0.421194f, 0.269805f), float4(-0.123166f, -0.221254f, -0.123166f, 0.0665975f),
+	float4(0.0777291f, -0.0602634f, -0.160104f, -0.0750447f), float4(-0.0739762f, -0.202f, 0.305136f, 0.825069f),
+	float4(-0.13129f, -0.104537f, 0.17249f, 0.473897f), float4(-0.086515f, -0.0840809f, -0.2301f, 0.0526806f),
+	float4(0.0588909f, -0.125867f, -0.107481f, -0.0770146f), float4(0.0540311f, -0.0815859f, -0.145759f, 0.704319f),
+	float4(0.520499f, -0.199253f, -0.0587371f, 0.429978f), float4(0.364021f, -0.124834f, -0.200469f, -0.154568f),
+	float4(0.0710568f, -0.0262426f, -0.157694f, -0.0331853f), float4(-0.0743733f, 0.0299477f, -0.143506f, 0.193826f),
+	float4(0.812309f, -0.0836903f, 0.0774837f, 0.499413f), float4(0.0491021f, -0.0489591f, -0.225651f, 0.0344493f),
+	float4(0.0357344f, -0.184065f, -0.047211f, 0.0276743f), float4(0.259719f, 0.077693f, -0.0549016f, 0.835746f),
+	float4(0.193597f, -0.16497f, 0.0350745f, 0.0430122f), float4(0.0395374f, -0.134506f, -0.0412464f, 0.0500759f),
+	float4(0.0597559f, -0.12534f, -0.170273f, -0.0717713f), float4(0.167992f, 0.240917f, -0.0930984f, -0.242555f),
+	float4(0.605863f, 0.793901f, -0.167837f, -0.0874031f), float4(0.0565328f, 0.0558751f, -0.0908743f, -0.144625f),
+	float4(-0.186756f, -0.0658818f, 0.0495361f, 0.28788f), float4(0.0679209f, -0.0658818f, 0.0550006f, -0.137011f),
+	float4(0.0454412f, 0.809185f, 0.28788f, -0.186756f), float4(0.0454412f, -0.137011f, -0.0435646f, 0.0550006f),
+	float4(-0.104546f, -0.201988f, -0.0840613f, 0.172482f), float4(0.305131f, -0.0750443f, -0.0602651f, -0.230254f),
+	float4(0.473913f, 0.825062f, -0.0739816f, -0.160099f), float4(0.0776769f, 0.0528106f, -0.0866724f, -0.131176f),
+	float4(-0.202f, -0.104537f, -0.0602634f, -0.0750447f), float4(0.305136f, 0.17249f, -0.0840809f, 0.0777291f),
+	float4(-0.160104f, -0.0739762f, 0.825069f, 0.473897f), float4(-0.2301f, -0.13129f, -0.086515f, 0.0526806f),
+	float4(0.0495544f, -0.0658828f, -0.186724f, -0.0658828f), float4(0.0678835f, 0.287853f, -0.0440188f, -0.186724f),
+	float4(0.287853f, 0.808594f, 0.0448661f, -0.136759f), float4(0.055921f, 0.0448661f, -0.136759f, 0.055921f),
+	float4(-0.171197f, -0.126078f, 0.0601354f, -0.0942258f), float4(0.242232f, 0.169014f, -0.0722448f, 0.0571987f),
+	float4(-0.0886761f, -0.168272f, 0.791542f, 0.60279f), float4(-0.244993f, -0.144469f, -0.129193f, 0.0626549f),
+	float4(0.0358234f, 0.0278587f, -0.047186f, -0.184469f), float4(-0.0551935f, 0.0776787f, 0.260283f, 0.0346732f),
+	float4(-0.162281f, 0.197021f, 0.83835f, -0.0225569f), float4(0.0525411f, 0.0317946f, -0.12775f, 0.0480122f),
+	float4(0.0498787f, -0.0700573f, -0.16182f, -0.0504343f), float4(0.0484819f, 0.755963f, 0.122289f, -0.117659f),
+	float4(0.0266429f, 0.597509f, 0.156504f, -0.113041f), float4(0.0212319f, -0.222815f, -0.0555033f, 0.0320388f),
+	float4(-0.0497035f, -0.0650195f, -0.100265f, -0.139102f), float4(-0.188293f, 0.549597f, 0.609802f, -0.139102f),
+	float4(-0.0650195f, -0.142554f, 0.36616f, 0.549597f), float4(-0.100265f, 0.0611457f, -0.142554f, -0.188293f),
+	float4(0.0565328f, -0.0874031f, -0.167837f, -0.0930984f), float4(-0.144625f, 0.793901f, 0.240917f, -0.170273f),
+	float4(-0.0908743f, 0.605863f, 0.167992f, -0.12534f), float4(0.0558751f, -0.242555f, -0.0717713f, 0.0597559f),
+	float4(0.0539521f, -0.0815385f, -0.05903f, -0.145585f), float4(-0.201045f, 0.430307f, 0.704104f, -0.0770529f),
+	float4(-0.125733f, 0.0587058f, -0.155299f, 0.364284f), float4(0.520319f, -0.107367f, -0.124946f, -0.199168f),
+	float4(0.0540311f, -0.0815859f, -0.145759f, -0.0587371f), float4(0.0588909f, -0.125867f, -0.0770146f, 0.704319f),
+	float4(0.429978f, -0.200469f, -0.107481f, 0.520499f), float4(0.364021f, -0.154568f, -0.199253f, -0.124834f),
+	float4(0.0571987f, -0.0886761f, -0.0942258f, -0.168272f), float4(-0.171197f, 0.242232f, 0.791542f, -0.144469f),
+	float4(0.0626549f, -0.126078f, 0.169014f, 0.60279f), float4(-0.129193f, 0.0601354f, -0.0722448f, -0.244993f),
+	float4(-0.0851043f, -0.187804f, -0.121264f, -0.0851043f), float4(-0.187804f, 0.739205f, 0.520105f, -0.223561f),
+	float4(-0.121264f, 0.520105f, 0.447303f, -0.177969f), float4(0.0726885f, -0.223561f, -0.177969f, 0.0775638f),
+	float4(0.0473848f, -0.0666478f, 0.035653f, -0.0574693f), float4(-0.152218f, 0.038895f, -0.153072f, 0.189455f),
+	float4(0.738674f, 0.0255918f, -0.109513f, 0.12923f), float4(0.582393f, 0.04047f, -0.0441146f, -0.218008f),
+	float4(-0.0101897f, 0.0143004f, 0.0330202f, -0.0103592f), float4(-0.154592f, -0.0217591f, 0.0261567f, -0.0103592f),
+	float4(0.183296f, 0.0190406f, -0.0217591f, 0.860148f), float4(0.183296f, -0.154592f, 0.0330202f, 0.0143004f),
+	float4(0.0212319f, 0.0266429f, 0.0320388f, -0.113041f), float4(-0.117659f, 0.0484819f, -0.0555033f, 0.156504f),
+	float4(0.122289f, -0.0504343f, -0.222815f, 0.597509f), float4(0.755963f, -0.16182f, -0.0700573f, 0.0498787f),
+	float4(0.0350745f, -0.16497f, -0.0549016f, 0.0276743f), float4(-0.0412464f, 0.0395374f, 0.193597f, 0.077693f),
+	float4(-0.047211f, 0.0500759f, -0.134506f, 0.0430122f), float4(0.835746f, 0.259719f, -0.184065f, 0.0357344f),
+	float4(0.029899f, 0.0498412f, -0.0837774f, -0.143455f), float4(-0.0480226f, 0.0774734f, 0.193837f, -0.0331803f),
+	float4(-0.0262484f, 0.0363076f, -0.224944f, 0.499572f), float4(0.812202f, -0.074398f, -0.157625f, 0.0712699f),
+	float4(0.0299477f, -0.143506f, -0.0836903f, 0.0491021f), float4(-0.0262426f, -0.0331853f, 0.193826f, 0.0774837f),
+	float4(-0.0489591f, 0.0710568f, -0.157694f, -0.0743733f), float4(0.812309f, 0.499413f, -0.225651f, 0.0344493f),
+	float4(0.0346732f, 0.0278587f, -0.0551935f, -0.162281f), float4(0.0317946f, -0.047186f, 0.0776787f, 0.197021f),
+	float4(-0.0225569f, 0.0358234f, -0.184469f, 0.260283f), float4(0.83835f, 0.0525411f, -0.12775f, 0.0480122f),
+	float4(0.038895f, 0.0255918f, 0.035653f, -0.153072f), float4(-0.109513f, 0.04047f, -0.0574693f, 0.189455f),
+	float4(0.12923f, -0.0441146f, 0.0473848f, -0.0666478f), float4(-0.152218f, 0.738674f, 0.582393f, -0.218008f),
+	float4(0.0137117f, 0.0109122f, 0.0313859f, 0.0359858f), float4(-0.0351727f, -0.151503f, 0.0109122f, -0.0351727f),
+	float4(0.0272805f, 0.185339f, -0.00976889f, 0.0137117f), float4(0.0313859f, -0.151503f, 0.185339f, 0.857585f),
+};
+
+#define WEIGHT_GRID_COUNT_3X3X3 1
+#define MAX_GRID_WEIGHTS_3X3X3 27
+static const uint4 weight_grids_3x3x3[WEIGHT_GRID_COUNT_3X3X3] = { uint4(3, 3, 0, 0) };
+static const uint weight_grids_z_3x3x3[WEIGHT_GRID_COUNT_3X3X3] = { 3 };
+static const uint4 decimation_idx_3x3x3[27] =
+{
+	uint4(0, 1, 3, 4), uint4(1, 2, 4, 5), uint4(2, 2, 5, 5), uint4(3, 4, 6, 7),
+	uint4(4, 5, 7, 8), uint4(5, 5, 8, 8), uint4(6, 7, 6, 7), uint4(7, 8, 7, 8),
+	uint4(8, 8, 8, 8), uint4(9, 10, 12, 13), uint4(10, 11, 13, 14), uint4(11, 11, 14, 14),
+	uint4(12, 13, 15, 16), uint4(13, 14, 16, 17), uint4(14, 14, 17, 17), uint4(15, 16, 15, 16),
+	uint4(16, 17, 16, 17), uint4(17, 17, 17, 17), uint4(18, 19, 21, 22), uint4(19, 20, 22, 23),
+	uint4(20, 20, 23, 23), uint4(21, 22, 24, 25), uint4(22, 23, 25, 26), uint4(23, 23, 26, 26),
+	uint4(24, 25, 24, 25), uint4(25, 26, 25, 26), uint4(26, 26, 26, 26),
+};
+static const float4 decimation_wt_3x3x3[27] =
+{
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f),
+};
+static const uint4 infill_idx_3x3x3[27] =
+{
+	uint4(0, 0, 0, 0), uint4(1, 1, 1, 1), uint4(2, 2, 2, 2), uint4(3, 3, 3, 3),
+	uint4(4, 4, 4, 4), uint4(5, 5, 5, 5), uint4(6, 6, 6, 6), uint4(7, 7, 7, 7),
+	uint4(8, 8, 8, 8), uint4(9, 9, 9, 9), uint4(10, 10, 10, 10), uint4(11, 11, 11, 11),
+	uint4(12, 12, 12, 12), uint4(13, 13, 13, 13), uint4(14, 14, 14, 14), uint4(15, 15, 15, 15),
+	uint4(16, 16, 16, 16), uint4(17, 17, 17, 17), uint4(18, 18, 18, 18), uint4(19, 19, 19, 19),
+	uint4(20, 20, 20, 20), uint4(21, 21, 21, 21), uint4(22, 22, 22, 22), uint4(23, 23, 23, 23),
+	uint4(24, 24, 24, 24), uint4(25, 25, 25, 25), uint4(26, 26, 26, 26),
+};
+static const float4 infill_wt_3x3x3[27] =
+{
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+};
+static const uint4 pseudo_inverse_idx_3x3x3[108] =
+{
+	uint4(0, 0, 0, 0), uint4(0, 0, 0, 0), uint4(0, 0, 0, 0), uint4(0, 0, 0, 0),
+	uint4(1, 1, 1, 1), uint4(1, 1, 1, 1), uint4(1, 1, 1, 1), uint4(1, 1, 1, 1),
+	uint4(2, 2, 2, 2), uint4(2, 2, 2, 2), uint4(2, 2, 2, 2), uint4(2, 2, 2, 2),
+	uint4(3, 3, 3, 3), uint4(3, 3, 3, 3), uint4(3, 3, 3, 3), uint4(3, 3, 3, 3),
+	uint4(4, 4, 4, 4), uint4(4, 4, 4, 4), uint4(4, 4, 4, 4), uint4(4, 4, 4, 4),
+	uint4(5, 5, 5, 5), uint4(5, 5, 5, 5), uint4(5, 5, 5, 5), uint4(5, 5, 5, 5),
+	uint4(6, 6, 6, 6), uint4(6, 6, 6, 6), uint4(6, 6, 6, 6), uint4(6, 6, 6, 6),
+	uint4(7, 7, 7, 7), uint4(7, 7, 7, 7), uint4(7, 7, 7, 7), uint4(7, 7, 7, 7),
+	uint4(8, 8, 8, 8), uint4(8, 8, 8, 8), uint4(8, 8, 8, 8), uint4(8, 8, 8, 8),
+	uint4(9, 9, 9, 9), uint4(9, 9, 9, 9), uint4(9, 9, 9, 9), uint4(9, 9, 9, 9),
+	uint4(10, 10, 10, 10), uint4(10, 10, 10, 10), uint4(10, 10, 10, 10), uint4(10, 10, 10, 10),
+	uint4(11, 11, 11, 11), uint4(11, 11, 11, 11), uint4(11, 11, 11, 11), uint4(11, 11, 11, 11),
+	uint4(12, 12, 12, 12), uint4(12, 12, 12, 12), uint4(12, 12, 12, 12), uint4(12, 12, 12, 12),
+	uint4(13, 13, 13, 13), uint4(13, 13, 13, 13), uint4(13, 13, 13, 13), uint4(13, 13, 13, 13),
+	uint4(14, 14, 14, 14), uint4(14, 14, 14, 14), uint4(14, 14, 14, 14), uint4(14, 14, 14, 14),
+	uint4(15, 15, 15, 15), uint4(15, 15, 15, 15), uint4(15, 15, 15, 15), uint4(15, 15, 15, 15),
+	uint4(16, 16, 16, 16), uint4(16, 16, 16, 16), uint4(16, 16, 16, 16), uint4(16, 16, 16, 16),
+	uint4(17, 17, 17, 17), uint4(17, 17, 17, 17), uint4(17, 17, 17, 17), uint4(17, 17, 17, 17),
+	uint4(18, 18, 18, 18), uint4(18, 18, 18, 18), uint4(18, 18, 18, 18), uint4(18, 18, 18, 18),
+	uint4(19, 19, 19, 19), uint4(19, 19, 19, 19), uint4(19, 19, 19, 19), uint4(19, 19, 19, 19),
+	uint4(20, 20, 20, 20), uint4(20, 20, 20, 20), uint4(20, 20, 20, 20), uint4(20, 20, 20, 20),
+	uint4(21, 21, 21, 21), uint4(21, 21, 21, 21), uint4(21, 21, 21, 21), uint4(21, 21, 21, 21),
+	uint4(22, 22, 22, 22), uint4(22, 22, 22, 22), uint4(22, 22, 22, 22), uint4(22, 22, 22, 22),
+	uint4(23, 23, 23, 23), uint4(23, 23, 23, 23), uint4(23, 23, 23, 23), uint4(23, 23, 23, 23),
+	uint4(24, 24, 24, 24), uint4(24, 24, 24, 24), uint4(24, 24, 24, 24), uint4(24, 24, 24, 24),
+	uint4(25, 25, 25, 25), uint4(25, 25, 25, 25), uint4(25, 25, 25, 25), uint4(25, 25, 25, 25),
+	uint4(26, 26, 26, 26), uint4(26, 26, 26, 26), uint4(26, 26, 26, 26), uint4(26, 26, 26, 26),
+};
+static const float4 pseudo_inverse_wt_3x3x3[108] =
+{
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+};
+
+#define WEIGHT_GRID_COUNT_4X4X4 2
+#define MAX_GRID_WEIGHTS_4X4X4 64
+static const uint4 weight_grids_4x4x4[WEIGHT_GRID_COUNT_4X4X4] = { uint4(3, 3, 0, 0), uint4(4, 4, 27, 64) };
+static const uint weight_grids_z_4x4x4[WEIGHT_GRID_COUNT_4X4X4] = { 3, 4 };
+static const uint4 decimation_idx_4x4x4[91] =
+{
+	uint4(0, 1, 4, 5), uint4(1, 2, 5, 6), uint4(3, 3, 7, 7), uint4(4, 5, 8, 9),
+	uint4(5, 6, 9, 10), uint4(7, 7, 11, 11), uint4(12, 13, 12, 13), uint4(13, 14, 13, 14),
+	uint4(15, 15, 15, 15), uint4(32, 33, 36, 37), uint4(33, 34, 37, 38), uint4(35, 35, 39, 39),
+	uint4(36, 37, 40, 41), uint4(37, 38, 41, 42), uint4(39, 39, 43, 43), uint4(44, 45, 44, 45),
+	uint4(45, 46, 45, 46), uint4(47, 47, 47, 47), uint4(48, 49, 52, 53), uint4(49, 50, 53, 54),
+	uint4(51, 51, 55, 55), uint4(52, 53, 56, 57), uint4(53, 54, 57, 58), uint4(55, 55, 59, 59),
+	uint4(60, 61, 60, 61), uint4(61, 62, 61, 62), uint4(63, 63, 63, 63), uint4(0, 1, 4, 5),
+	uint4(1, 2, 5, 6), uint4(2, 3, 6, 7), uint4(3, 3, 7, 7), uint4(4, 5, 8, 9),
+	uint4(5, 6, 9, 10), uint4(6, 7, 10, 11), uint4(7, 7, 11, 11), uint4(8, 9, 12, 13),
+	uint4(9, 10, 13, 14), uint4(10, 11, 14, 15), uint4(11, 11, 15, 15), uint4(12, 13, 12, 13),
+	uint4(13, 14, 13, 14), uint4(14, 15, 14, 15), uint4(15, 15, 15, 15), uint4(16, 17, 20, 21),
+	uint4(17, 18, 21, 22), uint4(18, 19, 22, 23), uint4(19, 19, 23, 23), uint4(20, 21, 24, 25),
+	uint4(21, 22, 25, 26), uint4(22, 23, 26, 27), uint4(23, 23, 27, 27), uint4(24, 25, 28, 29),
+	uint4(25, 26, 29, 30), uint4(26, 27, 30, 31), uint4(27, 27, 31, 31), uint4(28, 29, 28, 29),
+	uint4(29, 30, 29, 30), uint4(30, 31, 30, 31), uint4(31, 31, 31, 31), uint4(32, 33, 36, 37),
+	uint4(33, 34, 37, 38), uint4(34, 35, 38, 39), uint4(35, 35, 39, 39), uint4(36, 37, 40, 41),
+	uint4(37, 38, 41, 42), uint4(38, 39, 42, 43), uint4(39, 39, 43, 43), uint4(40, 41, 44, 45),
+	uint4(41, 42, 45, 46), uint4(42, 43, 46, 47), uint4(43, 43, 47, 47), uint4(44, 45, 44, 45),
+	uint4(45, 46, 45, 46), uint4(46, 47, 46, 47), uint4(47, 47, 47, 47), uint4(48, 49, 52, 53),
+	uint4(49, 50, 53, 54), uint4(50, 51, 54, 55), uint4(51, 51, 55, 55), uint4(52, 53, 56, 57),
+	uint4(53, 54, 57, 58), uint4(54, 55, 58, 59), uint4(55, 55, 59, 59), uint4(56, 57, 60, 61),
+	uint4(57, 58, 61, 62), uint4(58, 59, 62, 63), uint4(59, 59, 63, 63), uint4(60, 61, 60, 61),
+	uint4(61, 62, 61, 62), uint4(62, 63, 62, 63), uint4(63, 63, 63, 63),
+};
+static const float4 decimation_wt_4x4x4[91] =
+{
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.5f, 0.5f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.5f, 0.0f, 0.5f, 0.0f),
+	float4(0.25f, 0.25f, 0.25f, 0.25f), float4(0.5f, 0.0f, 0.5f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.5f, 0.5f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.5f, 0.5f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.5f, 0.0f, 0.5f, 0.0f), float4(0.25f, 0.25f, 0.25f, 0.25f),
+	float4(0.5f, 0.0f, 0.5f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.5f, 0.5f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.5f, 0.5f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.5f, 0.0f, 0.5f, 0.0f),
+	float4(0.25f, 0.25f, 0.25f, 0.25f), float4(0.5f, 0.0f, 0.5f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.5f, 0.5f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f),
+};
+static const uint4 infill_idx_4x4x4[128] =
+{
+	uint4(0, 0, 0, 0), uint4(0, 1, 0, 0), uint4(1, 2, 1, 1), uint4(2, 2, 2, 2),
+	uint4(0, 3, 0, 0), uint4(0, 0, 4, 0), uint4(1, 4, 5, 1), uint4(2, 5, 2, 2),
+	uint4(3, 6, 3, 3), uint4(3, 4, 7, 3), uint4(4, 4, 8, 4), uint4(5, 8, 5, 5),
+	uint4(6, 6, 6, 6), uint4(6, 7, 6, 6), uint4(7, 8, 7, 7), uint4(8, 8, 8, 8),
+	uint4(0, 9, 0, 0), uint4(0, 0, 10, 0), uint4(1, 10, 11, 1), uint4(2, 11, 2, 2),
+	uint4(0, 0, 12, 0), uint4(0, 0, 0, 13), uint4(1, 1, 13, 14), uint4(2, 2, 14, 2),
+	uint4(3, 12, 15, 3), uint4(3, 3, 13, 16), uint4(4, 13, 4, 17), uint4(5, 14, 17, 5),
+	uint4(6, 15, 6, 6), uint4(6, 6, 16, 6), uint4(7, 16, 17, 7), uint4(8, 17, 8, 8),
+	uint4(9, 18, 9, 9), uint4(9, 10, 19, 9), uint4(10, 10, 20, 10), uint4(11, 20, 11, 11),
+	uint4(9, 12, 21, 9), uint4(9, 9, 13, 22), uint4(10, 13, 10, 23), uint4(11, 14, 23, 11),
+	uint4(12, 12, 24, 12), uint4(12, 13, 12, 25), uint4(13, 13, 13, 26), uint4(14, 14, 26, 14),
+	uint4(15, 24, 15, 15), uint4(15, 16, 25, 15), uint4(16, 16, 26, 16), uint4(17, 26, 17, 17),
+	uint4(18, 18, 18, 18), uint4(18, 19, 18, 18), uint4(19, 20, 19, 19), uint4(20, 20, 20, 20),
+	uint4(18, 21, 18, 18), uint4(18, 18, 22, 18), uint4(19, 22, 23, 19), uint4(20, 23, 20, 20),
+	uint4(21, 24, 21, 21), uint4(21, 22, 25, 21), uint4(22, 22, 26, 22), uint4(23, 26, 23, 23),
+	uint4(24, 24, 24, 24), uint4(24, 25, 24, 24), uint4(25, 26, 25, 25), uint4(26, 26, 26, 26),
+	uint4(0, 0, 0, 0), uint4(1, 1, 1, 1), uint4(2, 2, 2, 2), uint4(3, 3, 3, 3),
+	uint4(4, 4, 4, 4), uint4(5, 5, 5, 5), uint4(6, 6, 6, 6), uint4(7, 7, 7, 7),
+	uint4(8, 8, 8, 8), uint4(9, 9, 9, 9), uint4(10, 10, 10, 10), uint4(11, 11, 11, 11),
+	uint4(12, 12, 12, 12), uint4(13, 13, 13, 13), uint4(14, 14, 14, 14), uint4(15, 15, 15, 15),
+	uint4(16, 16, 16, 16), uint4(17, 17, 17, 17), uint4(18, 18, 18, 18), uint4(19, 19, 19, 19),
+	uint4(20, 20, 20, 20), uint4(21, 21, 21, 21), uint4(22, 22, 22, 22), uint4(23, 23, 23, 23),
+	uint4(24, 24, 24, 24), uint4(25, 25, 25, 25), uint4(26, 26, 26, 26), uint4(27, 27, 27, 27),
+	uint4(28, 28, 28, 28), uint4(29, 29, 29, 29), uint4(30, 30, 30, 30), uint4(31, 31, 31, 31),
+	uint4(32, 32, 32, 32), uint4(33, 33, 33, 33), uint4(34, 34, 34, 34), uint4(35, 35, 35, 35),
+	uint4(36, 36, 36, 36), uint4(37, 37, 37, 37), uint4(38, 38, 38, 38), uint4(39, 39, 39, 39),
+	uint4(40, 40, 40, 40), uint4(41, 41, 41, 41), uint4(42, 42, 42, 42), uint4(43, 43, 43, 43),
+	uint4(44, 44, 44, 44), uint4(45, 45, 45, 45), uint4(46, 46, 46, 46), uint4(47, 47, 47, 47),
+	uint4(48, 48, 48, 48), uint4(49, 49, 49, 49), uint4(50, 50, 50, 50), uint4(51, 51, 51, 51),
+	uint4(52, 52, 52, 52), uint4(53, 53, 53, 53), uint4(54, 54, 54, 54), uint4(55, 55, 55, 55),
+	uint4(56, 56, 56, 56), uint4(57, 57, 57, 57), uint4(58, 58, 58, 58), uint4(59, 59, 59, 59),
+	uint4(60, 60, 60, 60), uint4(61, 61, 61, 61), uint4(62, 62, 62, 62), uint4(63, 63, 63, 63),
+};
+static const float4 infill_wt_4x4x4[128] =
+{
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.3125f, 0.6875f, 0.0f, 0.0f), float4(0.6875f, 0.3125f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.3125f, 0.6875f, 0.0f, 0.0f), float4(0.3125f, 0.0f, 0.6875f, 0.0f), float4(0.3125f, 0.375f, 0.3125f, 0.0f), float4(0.3125f, 0.6875f, 0.0f, 0.0f),
+	float4(0.6875f, 0.3125f, 0.0f, 0.0f), float4(0.3125f, 0.375f, 0.3125f, 0.0f), float4(0.6875f, 0.0f, 0.3125f, 0.0f), float4(0.6875f, 0.3125f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.3125f, 0.6875f, 0.0f, 0.0f), float4(0.6875f, 0.3125f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.3125f, 0.6875f, 0.0f, 0.0f), float4(0.3125f, 0.0f, 0.6875f, 0.0f), float4(0.3125f, 0.375f, 0.3125f, 0.0f), float4(0.3125f, 0.6875f, 0.0f, 0.0f),
+	float4(0.3125f, 0.0f, 0.6875f, 0.0f), float4(0.3125f, 0.0f, 0.0f, 0.6875f), float4(0.3125f, 0.0f, 0.375f, 0.3125f), float4(0.3125f, 0.0f, 0.6875f, 0.0f),
+	float4(0.3125f, 0.375f, 0.3125f, 0.0f), float4(0.3125f, 0.0f, 0.375f, 0.3125f), float4(0.3125f, 0.375f, 0.0f, 0.3125f), float4(0.3125f, 0.375f, 0.3125f, 0.0f),
+	float4(0.3125f, 0.6875f, 0.0f, 0.0f), float4(0.3125f, 0.0f, 0.6875f, 0.0f), float4(0.3125f, 0.375f, 0.3125f, 0.0f), float4(0.3125f, 0.6875f, 0.0f, 0.0f),
+	float4(0.6875f, 0.3125f, 0.0f, 0.0f), float4(0.3125f, 0.375f, 0.3125f, 0.0f), float4(0.6875f, 0.0f, 0.3125f, 0.0f), float4(0.6875f, 0.3125f, 0.0f, 0.0f),
+	float4(0.3125f, 0.375f, 0.3125f, 0.0f), float4(0.3125f, 0.0f, 0.375f, 0.3125f), float4(0.3125f, 0.375f, 0.0f, 0.3125f), float4(0.3125f, 0.375f, 0.3125f, 0.0f),
+	float4(0.6875f, 0.0f, 0.3125f, 0.0f), float4(0.3125f, 0.375f, 0.0f, 0.3125f), float4(0.6875f, 0.0f, 0.0f, 0.3125f), float4(0.6875f, 0.0f, 0.3125f, 0.0f),
+	float4(0.6875f, 0.3125f, 0.0f, 0.0f), float4(0.3125f, 0.375f, 0.3125f, 0.0f), float4(0.6875f, 0.0f, 0.3125f, 0.0f), float4(0.6875f, 0.3125f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.3125f, 0.6875f, 0.0f, 0.0f), float4(0.6875f, 0.3125f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.3125f, 0.6875f, 0.0f, 0.0f), float4(0.3125f, 0.0f, 0.6875f, 0.0f), float4(0.3125f, 0.375f, 0.3125f, 0.0f), float4(0.3125f, 0.6875f, 0.0f, 0.0f),
+	float4(0.6875f, 0.3125f, 0.0f, 0.0f), float4(0.3125f, 0.375f, 0.3125f, 0.0f), float4(0.6875f, 0.0f, 0.3125f, 0.0f), float4(0.6875f, 0.3125f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.3125f, 0.6875f, 0.0f, 0.0f), float4(0.6875f, 0.3125f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+};
+static const uint4 pseudo_inverse_idx_4x4x4[364] =
+{
+	uint4(0, 1, 2, 4), uint4(5, 6, 8, 9), uint4(16, 17, 20, 21), uint4(24, 32, 33, 36),
+	uint4(0, 1, 2, 3), uint4(5, 6, 7, 10), uint4(17, 18, 19, 21), uint4(22, 23, 26, 34),
+	uint4(1, 2, 3, 6), uint4(7, 11, 15, 18), uint4(19, 22, 23, 27), uint4(35, 39, 43, 51),
+	uint4(0, 4, 5, 8), uint4(9, 10, 12, 13), uint4(20, 21, 24, 25), uint4(26, 28, 29, 40),
+	uint4(0, 1, 4, 5), uint4(6, 7, 8, 9), uint4(10, 11, 13, 14), uint4(15, 21, 26, 31),
+	uint4(1, 2, 3, 5), uint4(6, 7, 10, 11), uint4(15, 22, 23, 26), uint4(27, 31, 43, 47),
+	uint4(4, 8, 9, 12), uint4(13, 14, 15, 24), uint4(25, 28, 29, 30), uint4(44, 45, 46, 60),
+	uint4(4, 5, 8, 9), uint4(10, 12, 13, 14), uint4(15, 25, 26, 29), uint4(30, 31, 46, 47),
+	uint4(3, 5, 6, 7), uint4(9, 10, 11, 12), uint4(13, 14, 15, 26), uint4(27, 30, 31, 47),
+	uint4(0, 16, 17, 20), uint4(21, 32, 33, 34), uint4(36, 37, 40, 41), uint4(48, 49, 52, 53),
+	uint4(0, 1, 16, 17), uint4(18, 19, 21, 32), uint4(33, 34, 35, 38), uint4(49, 50, 51, 55),
+	uint4(1, 2, 3, 17), uint4(18, 19, 22, 23), uint4(34, 35, 38, 39), uint4(43, 51, 55, 59),
+	uint4(0, 4, 16, 20), uint4(21, 24, 28, 32), uint4(36, 40, 41, 44), uint4(52, 56, 60, 61),
+	uint4(0, 1, 4, 16), uint4(21, 22, 25, 26), uint4(37, 38, 41, 42), uint4(47, 59, 62, 63),
+	uint4(2, 3, 7, 11), uint4(19, 22, 23, 27), uint4(31, 35, 39, 42), uint4(43, 47, 59, 63),
+	uint4(4, 8, 12, 20), uint4(24, 25, 28, 29), uint4(40, 41, 44, 45), uint4(46, 60, 61, 62),
+	uint4(8, 12, 13, 14), uint4(25, 28, 29, 30), uint4(42, 44, 45, 46), uint4(47, 61, 62, 63),
+	uint4(10, 11, 14, 15), uint4(22, 23, 26, 27), uint4(29, 30, 31, 42), uint4(43, 46, 47, 63),
+	uint4(16, 32, 33, 36), uint4(37, 48, 49, 50), uint4(51, 52, 53, 54), uint4(56, 57, 58, 60),
+	uint4(16, 17, 32, 33), uint4(34, 37, 38, 48), uint4(49, 50, 51, 53), uint4(54, 55, 58, 59),
+	uint4(3, 17, 18, 19), uint4(33, 34, 35, 38), uint4(39, 48, 49, 50), uint4(51, 54, 55, 59),
+	uint4(16, 20, 32, 36), uint4(37, 40, 41, 48), uint4(52, 53, 56, 57), uint4(58, 60, 61, 62),
+	uint4(32, 37, 42, 48), uint4(49, 50, 52, 53), uint4(54, 56, 57, 58), uint4(59, 61, 62, 63),
+	uint4(23, 34, 35, 37), uint4(38, 39, 42, 43), uint4(50, 51, 53, 54), uint4(55, 58, 59, 63),
+	uint4(12, 20, 24, 28), uint4(36, 40, 41, 44), uint4(45, 48, 52, 56), uint4(57, 60, 61, 62),
+	uint4(25, 29, 40, 41), uint4(42, 44, 45, 46), uint4(53, 56, 57, 58), uint4(60, 61, 62, 63),
+	uint4(27, 31, 39, 42), uint4(43, 45, 46, 47), uint4(54, 55, 57, 58), uint4(59, 61, 62, 63),
+	uint4(0, 0, 0, 0), uint4(0, 0, 0, 0), uint4(0, 0, 0, 0), uint4(0, 0, 0, 0),
+	uint4(1, 1, 1, 1), uint4(1, 1, 1, 1), uint4(1, 1, 1, 1), uint4(1, 1, 1, 1),
+	uint4(2, 2, 2, 2), uint4(2, 2, 2, 2), uint4(2, 2, 2, 2), uint4(2, 2, 2, 2),
+	uint4(3, 3, 3, 3), uint4(3, 3, 3, 3), uint4(3, 3, 3, 3), uint4(3, 3, 3, 3),
+	uint4(4, 4, 4, 4), uint4(4, 4, 4, 4), uint4(4, 4, 4, 4), uint4(4, 4, 4, 4),
+	uint4(5, 5, 5, 5), uint4(5, 5, 5, 5), uint4(5, 5, 5, 5), uint4(5, 5, 5, 5),
+	uint4(6, 6, 6, 6), uint4(6, 6, 6, 6), uint4(6, 6, 6, 6), uint4(6, 6, 6, 6),
+	uint4(7, 7, 7, 7), uint4(7, 7, 7, 7), uint4(7, 7, 7, 7), uint4(7, 7, 7, 7),
+	uint4(8, 8, 8, 8), uint4(8, 8, 8, 8), uint4(8, 8, 8, 8), uint4(8, 8, 8, 8),
+	uint4(9, 9, 9, 9), uint4(9, 9, 9, 9), uint4(9, 9, 9, 9), uint4(9, 9, 9, 9),
+	uint4(10, 10, 10, 10), uint4(10, 10, 10, 10), uint4(10, 10, 10, 10), uint4(10, 10, 10, 10),
+	uint4(11, 11, 11, 11), uint4(11, 11, 11, 11), uint4(11, 11, 11, 11), uint4(11, 11, 11, 11),
+	uint4(12, 12, 12, 12), uint4(12, 12, 12, 12), uint4(12, 12, 12, 12), uint4(12, 12, 12, 12),
+	uint4(13, 13, 13, 13), uint4(13, 13, 13, 13), uint4(13, 13, 13, 13), uint4(13, 13, 13, 13),
+	uint4(14, 14, 14, 14), uint4(14, 14, 14, 14), uint4(14, 14, 14, 14), uint4(14, 14, 14, 14),
+	uint4(15, 15, 15, 15), uint4(15, 15, 15, 15), uint4(15, 15, 15, 15), uint4(15, 15, 15, 15),
+	uint4(16, 16, 16, 16), uint4(16, 16, 16, 16), uint4(16, 16, 16, 16), uint4(16, 16, 16, 16),
+	uint4(17, 17, 17, 17), uint4(17, 17, 17, 17), uint4(17, 17, 17, 17), uint4(17, 17, 17, 17),
+	uint4(18, 18, 18, 18), uint4(18, 18, 18, 18), uint4(18, 18, 18, 18), uint4(18, 18, 18, 18),
+	uint4(19, 19, 19, 19), uint4(19, 19, 19, 19), uint4(19, 19, 19, 19), uint4(19, 19, 19, 19),
+	uint4(20, 20, 20, 20), uint4(20, 20, 20, 20), uint4(20, 20, 20, 20), uint4(20, 20, 20, 20),
+	uint4(21, 21, 21, 21), uint4(21, 21, 21, 21), uint4(21, 21, 21, 21), uint4(21, 21, 21, 21),
+	uint4(22, 22, 22, 22), uint4(22, 22, 22, 22), uint4(22, 22, 22, 22), uint4(22, 22, 22, 22),
+	uint4(23, 23, 23, 23), uint4(23, 23, 23, 23), uint4(23, 23, 23, 23), uint4(23, 23, 23, 23),
+	uint4(24, 24, 24, 24), uint4(24, 24, 24, 24), uint4(24, 24, 24, 24), uint4(24, 24, 24, 24),
+	uint4(25, 25, 25, 25), uint4(25, 25, 25, 25), uint4(25, 25, 25, 25), uint4(25, 25, 25, 25),
+	uint4(26, 26, 26, 26), uint4(26, 26, 26, 26), uint4(26, 26, 26, 26), uint4(26, 26, 26, 26),
+	uint4(27, 27, 27, 27), uint4(27, 27, 27, 27), uint4(27, 27, 27, 27), uint4(27, 27, 27, 27),
+	uint4(28, 28, 28, 28), uint4(28, 28, 28, 28), uint4(28, 28, 28, 28), uint4(28, 28, 28, 28),
+	uint4(29, 29, 29, 29), uint4(29, 29, 29, 29), uint4(29, 29, 29, 29), uint4(29, 29, 29, 29),
+	uint4(30, 30, 30, 30), uint4(30, 30, 30, 30), uint4(30, 30, 30, 30), uint4(30, 30, 30, 30),
+	uint4(31, 31, 31, 31), uint4(31, 31, 31, 31), uint4(31, 31, 31, 31), uint4(31, 31, 31, 31),
+	uint4(32, 32, 32, 32), uint4(32, 32, 32, 32), uint4(32, 32, 32, 32), uint4(32, 32, 32, 32),
+	uint4(33, 33, 33, 33), uint4(33, 33, 33, 33), uint4(33, 33, 33, 33), uint4(33, 33, 33, 33),
+	uint4(34, 34, 34, 34), uint4(34, 34, 34, 34), uint4(34, 34, 34, 34), uint4(34, 34, 34, 34),
+	uint4(35, 35, 35, 35), uint4(35, 35, 35, 35), uint4(35, 35, 35, 35), uint4(35, 35, 35, 35),
+	uint4(36, 36, 36, 36), uint4(36, 36, 36, 36), uint4(36, 36, 36, 36), uint4(36, 36, 36, 36),
+	uint4(37, 37, 37, 37), uint4(37, 37, 37, 37), uint4(37, 37, 37, 37), uint4(37, 37, 37, 37),
+	uint4(38, 38, 38, 38), uint4(38, 38, 38, 38), uint4(38, 38, 38, 38), uint4(38, 38, 38, 38),
+	uint4(39, 39, 39, 39), uint4(39, 39, 39, 39), uint4(39, 39, 39, 39), uint4(39, 39, 39, 39),
+	uint4(40, 40, 40, 40), uint4(40, 40, 40, 40), uint4(40, 40, 40, 40), uint4(40, 40, 40, 40),
+	uint4(41, 41, 41, 41), uint4(41, 41, 41, 41), uint4(41, 41, 41, 41), uint4(41, 41, 41, 41),
+	uint4(42, 42, 42, 42), uint4(42, 42, 42, 42), uint4(42, 42, 42, 42), uint4(42, 42, 42, 42),
+	uint4(43, 43, 43, 43), uint4(43, 43, 43, 43), uint4(43, 43, 43, 43), uint4(43, 43, 43, 43),
+	uint4(44, 44, 44, 44), uint4(44, 44, 44, 44), uint4(44, 44, 44, 44), uint4(44, 44, 44, 44),
+	uint4(45, 45, 45, 45), uint4(45, 45, 45, 45), uint4(45, 45, 45, 45), uint4(45, 45, 45, 45),
+	uint4(46, 46, 46, 46), uint4(46, 46, 46, 46), uint4(46, 46, 46, 46), uint4(46, 46, 46, 46),
+	uint4(47, 47, 47, 47), uint4(47, 47, 47, 47), uint4(47, 47, 47, 47), uint4(47, 47, 47, 47),
+	uint4(48, 48, 48, 48), uint4(48, 48, 48, 48), uint4(48, 48, 48, 48), uint4(48, 48, 48, 48),
+	uint4(49, 49, 49, 49), uint4(49, 49, 49, 49), uint4(49, 49, 49, 49), uint4(49, 49, 49, 49),
+	uint4(50, 50, 50, 50), uint4(50, 50, 50, 50), uint4(50, 50, 50, 50), uint4(50, 50, 50, 50),
+	uint4(51, 51, 51, 51), uint4(51, 51, 51, 51), uint4(51, 51, 51, 51), uint4(51, 51, 51, 51),
+	uint4(52, 52, 52, 52), uint4(52, 52, 52, 52), uint4(52, 52, 52, 52), uint4(52, 52, 52, 52),
+	uint4(53, 53, 53, 53), uint4(53, 53, 53, 53), uint4(53, 53, 53, 53), uint4(53, 53, 53, 53),
+	uint4(54, 54, 54, 54), uint4(54, 54, 54, 54), uint4(54, 54, 54, 54), uint4(54, 54, 54, 54),
+	uint4(55, 55, 55, 55), uint4(55, 55, 55, 55), uint4(55, 55, 55, 55), uint4(55, 55, 55, 55),
+	uint4(56, 56, 56, 56), uint4(56, 56, 56, 56), uint4(56, 56, 56, 56), uint4(56, 56, 56, 56),
+	uint4(57, 57, 57, 57), uint4(57, 57, 57, 57), uint4(57, 57, 57, 57), uint4(57, 57, 57, 57),
+	uint4(58, 58, 58, 58), uint4(58, 58, 58, 58), uint4(58, 58, 58, 58), uint4(58, 58, 58, 58),
+	uint4(59, 59, 59, 59), uint4(59, 59, 59, 59), uint4(59, 59, 59, 59), uint4(59, 59, 59, 59),
+	uint4(60, 60, 60, 60), uint4(60, 60, 60, 60), uint4(60, 60, 60, 60), uint4(60, 60, 60, 60),
+	uint4(61, 61, 61, 61), uint4(61, 61, 61, 61), uint4(61, 61, 61, 61), uint4(61, 61, 61, 61),
+	uint4(62, 62, 62, 62), uint4(62, 62, 62, 62), uint4(62, 62, 62, 62), uint4(62, 62, 62, 62),
+	uint4(63, 63, 63, 63), uint4(63, 63, 63, 63), uint4(63, 63, 63, 63), uint4(63, 63, 63, 63),
+};
+static const float4 pseudo_inverse_wt_4x4x4[364] =
+{
+	float4(0.673024f, 0.141988f, -0.0650891f, 0.141988f), float4(0.147189f, -0.0614067f, -0.0650891f, -0.0614067f),
+	float4(0.141988f, 0.147189f, 0.147189f, 0.178794f), float4(-0.0614067f, -0.0650891f, -0.0614067f, -0.0614067f),
+	float4(-0.0993921f, 0.567063f, 0.562426f, -0.11423f), float4(-0.0713364f, 0.235249f, -0.0679396f, -0.0358014f),
+	float4(-0.0713364f, 0.235249f, -0.0679396f, -0.0599216f), float4(0.244626f, -0.0610098f, -0.0302807f, -0.0358014f),
+	float4(-0.0752903f, 0.16968f, 0.794283f, -0.0718158f), float4(0.155002f, -0.0878773f, 0.0170682f, -0.0718158f),
+	float4(0.155002f, -0.0640259f, 0.17861f, -0.075859f), float4(-0.0878773f, -0.075859f, -0.0667524f, 0.0170682f),
+	float4(-0.0993921f, 0.567063f, -0.0713364f, 0.562426f), float4(0.235249f, -0.0358014f, -0.11423f, -0.0679396f),
+	float4(-0.0713364f, -0.0599216f, 0.235249f, 0.244626f), float4(-0.0302807f, -0.0679396f, -0.0610098f, -0.0358014f),
+	float4(-0.0918264f, -0.0689721f, -0.0689721f, 0.530771f), float4(0.267849f, -0.0366078f, -0.0350682f, 0.267849f),
+	float4(0.527829f, -0.0734538f, -0.0366078f, -0.0734538f), float4(-0.101241f, -0.0553779f, 0.228243f, -0.0569506f),
+	float4(-0.0281544f, -0.0746114f, -0.13558f, -0.0377278f), float4(0.258884f, 0.609598f, -0.0841847f, 0.609598f),
+	float4(-0.13558f, -0.0292233f, -0.0841847f, -0.0292233f), float4(0.258884f, -0.0746114f, -0.0377278f, -0.0281544f),
+	float4(-0.0752903f, 0.16968f, -0.0718158f, 0.794283f), float4(0.155002f, -0.0878773f, 0.0170682f, -0.0718158f),
+	float4(-0.0640259f, 0.155002f, 0.17861f, -0.075859f), float4(-0.0878773f, -0.075859f, -0.0667524f, 0.0170682f),
+	float4(-0.0281544f, -0.0377278f, -0.0746114f, 0.258884f), float4(-0.0841847f, -0.13558f, 0.609598f, 0.609598f),
+	float4(-0.13558f, -0.0292233f, -0.0292233f, -0.0841847f), float4(0.258884f, -0.0746114f, -0.0377278f, -0.0281544f),
+	float4(0.0170682f, -0.0667524f, -0.075859f, -0.0878773f), float4(-0.075859f, 0.17861f, 0.155002f, 0.0170682f),
+	float4(-0.0878773f, 0.155002f, 0.794283f, -0.0640259f), float4(-0.0718158f, -0.0718158f, 0.16968f, -0.0752903f),
+	float4(-0.0993921f, 0.567063f, -0.0713364f, -0.0713364f), float4(-0.0599216f, 0.562426f, 0.235249f, -0.0358014f),
+	float4(0.235249f, 0.244626f, -0.0358014f, -0.0302807f), float4(-0.11423f, -0.0679396f, -0.0679396f, -0.0610098f),
+	float4(-0.0918264f, -0.0689721f, -0.0689721f, 0.530771f), float4(0.267849f, -0.0366078f, -0.0553779f, -0.0350682f),
+	float4(0.267849f, 0.527829f, -0.0734538f, 0.228243f), float4(-0.0366078f, -0.0734538f, -0.101241f, -0.0569506f),
+	float4(-0.0281544f, -0.0746114f, -0.13558f, -0.0377278f), float4(0.258884f, 0.609598f, -0.0292233f, -0.0841847f),
+	float4(-0.0841847f, 0.609598f, -0.0292233f, 0.258884f), float4(-0.0377278f, -0.13558f, -0.0746114f, -0.0281544f),
+	float4(-0.0918264f, -0.0689721f, -0.0689721f, 0.530771f), float4(-0.0553779f, 0.267849f, -0.0366078f, -0.0350682f),
+	float4(0.267849f, 0.527829f, 0.228243f, -0.0734538f), float4(-0.0366078f, -0.0734538f, -0.101241f, -0.0569506f),
+	float4(-0.045856f, -0.0431916f, -0.0431916f, -0.0431916f), float4(0.399351f, 0.200397f, 0.200397f, 0.200397f),
+	float4(0.200397f, 0.200397f, 0.200397f, 0.399351f), float4(-0.0431916f, -0.0431916f, -0.0431916f, -0.045856f),
+	float4(-0.0569506f, -0.101241f, -0.0734538f, -0.0366078f), float4(-0.0734538f, 0.228243f, 0.527829f, 0.267849f),
+	float4(-0.0350682f, -0.0366078f, 0.267849f, -0.0553779f), float4(0.530771f, -0.0689721f, -0.0689721f, -0.0918264f),
+	float4(-0.0281544f, -0.0746114f, -0.13558f, -0.0377278f), float4(0.258884f, -0.0292233f, 0.609598f, -0.0841847f),
+	float4(-0.0841847f, -0.0292233f, 0.609598f, 0.258884f), float4(-0.0377278f, -0.13558f, -0.0746114f, -0.0281544f),
+	float4(-0.0569506f, -0.101241f, -0.0734538f, -0.0366078f), float4(0.228243f, -0.0734538f, 0.527829f, 0.267849f),
+	float4(-0.0553779f, -0.0366078f, 0.267849f, 0.530771f), float4(-0.0689721f, -0.0350682f, -0.0689721f, -0.0918264f),
+	float4(-0.0610098f, -0.0679396f, -0.0679396f, -0.11423f), float4(-0.0302807f, -0.0358014f, 0.244626f, 0.235249f),
+	float4(-0.0358014f, 0.235249f, 0.562426f, -0.0599216f), float4(-0.0713364f, -0.0713364f, 0.567063f, -0.0993921f),
+	float4(-0.0752903f, 0.16968f, -0.0718158f, -0.0718158f), float4(-0.0640259f, 0.794283f, 0.155002f, -0.0878773f),
+	float4(0.0170682f, 0.155002f, 0.17861f, -0.075859f), float4(-0.0878773f, -0.075859f, -0.0667524f, 0.0170682f),
+	float4(-0.0281544f, -0.0377278f, -0.0746114f, 0.258884f), float4(-0.0841847f, -0.0292233f, -0.0292233f, -0.13558f),
+	float4(0.609598f, 0.609598f, -0.13558f, -0.0841847f), float4(0.258884f, -0.0746114f, -0.0377278f, -0.0281544f),
+	float4(0.0170682f, -0.0667524f, -0.075859f, -0.0878773f), float4(-0.075859f, 0.17861f, 0.155002f, -0.0640259f),
+	float4(-0.0718158f, 0.0170682f, -0.0878773f, 0.155002f), float4(0.794283f, -0.0718158f, 0.16968f, -0.0752903f),
+	float4(-0.0281544f, -0.0377278f, -0.0746114f, 0.258884f), float4(-0.0292233f, -0.0841847f, -0.0292233f, -0.13558f),
+	float4(0.609598f, -0.0841847f, 0.609598f, 0.258884f), float4(-0.0377278f, -0.13558f, -0.0746114f, -0.0281544f),
+	float4(-0.0569506f, 0.228243f, -0.0553779f, -0.101241f), float4(-0.0734538f, -0.0366078f, -0.0734538f, 0.527829f),
+	float4(0.267849f, -0.0366078f, 0.267849f, 0.530771f), float4(-0.0689721f, -0.0350682f, -0.0689721f, -0.0918264f),
+	float4(-0.0358014f, -0.0610098f, -0.0679396f, -0.0302807f), float4(0.244626f, 0.235249f, -0.0599216f, -0.0713364f),
+	float4(-0.0679396f, -0.11423f, -0.0358014f, 0.235249f), float4(0.562426f, -0.0713364f, 0.567063f, -0.0993921f),
+	float4(0.0170682f, -0.0667524f, -0.075859f, -0.0878773f), float4(-0.075859f, 0.17861f, -0.0640259f, 0.155002f),
+	float4(-0.0718158f, 0.0170682f, -0.0878773f, 0.155002f), float4(-0.0718158f, 0.794283f, 0.16968f, -0.0752903f),
+	float4(-0.0302807f, -0.0358014f, -0.0610098f, 0.244626f), float4(-0.0599216f, -0.0679396f, 0.235249f, -0.0713364f),
+	float4(-0.0358014f, -0.0679396f, 0.235249f, -0.0713364f), float4(-0.11423f, 0.562426f, 0.567063f, -0.0993921f),
+	float4(-0.0614067f, -0.0650891f, -0.0614067f, 0.178794f), float4(0.147189f, -0.0614067f, 0.147189f, 0.141988f),
+	float4(-0.0614067f, -0.0650891f, -0.0614067f, 0.147189f), float4(0.141988f, -0.0650891f, 0.141988f, 0.673024f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.0f, 0.0f, 0.0f, 0.0f), float4(0.0f, 0.0f, 0.0f, 0.0f),
+};
+
+#define WEIGHT_GRID_COUNT_5X5X5 2
+#define MAX_GRID_WEIGHTS_5X5X5 64
+static const uint4 weight_grids_5x5x5[WEIGHT_GRID_COUNT_5X5X5] = { uint4(3, 3, 0, 0), uint4(4, 4, 27, 125) };
+static const uint weight_grids_z_5x5x5[WEIGHT_GRID_COUNT_5X5X5] = { 3, 4 };
+static const uint4 decimation_idx_5x5x5[91] =
+{
+	uint4(0, 1, 5, 6), uint4(2, 3, 7, 8), uint4(4, 4, 9, 9), uint4(10, 11, 15, 16),
+	uint4(12, 13, 17, 18), uint4(14, 14, 19, 19), uint4(20, 21, 20, 21), uint4(22, 23, 22, 23),
+	uint4(24, 24, 24, 24), uint4(50, 51, 55, 56), uint4(52, 53, 57, 58), uint4(54, 54, 59, 59),
+	uint4(60, 61, 65, 66), uint4(62, 63, 67, 68), uint4(64, 64, 69, 69), uint4(70, 71, 70, 71),
+	uint4(72, 73, 72, 73), uint4(74, 74, 74, 74), uint4(100, 101, 105, 106), uint4(102, 103, 107, 108),
+	uint4(104, 104, 109, 109), uint4(110, 111, 115, 116), uint4(112, 113, 117, 118), uint4(114, 114, 119, 119),
+	uint4(120, 121, 120, 121), uint4(122, 123, 122, 123), uint4(124, 124, 124, 124), uint4(0, 1, 5, 6),
+	uint4(1, 2, 6, 7), uint4(2, 3, 7, 8), uint4(4, 4, 9, 9), uint4(5, 6, 10, 11),
+	uint4(6, 7, 11, 12), uint4(7, 8, 12, 13), uint4(9, 9, 14, 14), uint4(10, 11, 15, 16),
+	uint4(11, 12, 16, 17), uint4(12, 13, 17, 18), uint4(14, 14, 19, 19), uint4(20, 21, 20, 21),
+	uint4(21, 22, 21, 22), uint4(22, 23, 22, 23), uint4(24, 24, 24, 24), uint4(25, 26, 30, 31),
+	uint4(26, 27, 31, 32), uint4(27, 28, 32, 33), uint4(29, 29, 34, 34), uint4(30, 31, 35, 36),
+	uint4(31, 32, 36, 37), uint4(32, 33, 37, 38), uint4(34, 34, 39, 39), uint4(35, 36, 40, 41),
+	uint4(36, 37, 41, 42), uint4(37, 38, 42, 43), uint4(39, 39, 44, 44), uint4(45, 46, 45, 46),
+	uint4(46, 47, 46, 47), uint4(47, 48, 47, 48), uint4(49, 49, 49, 49), uint4(75, 76, 80, 81),
+	uint4(76, 77, 81, 82), uint4(77, 78, 82, 83), uint4(79, 79, 84, 84), uint4(80, 81, 85, 86),
+	uint4(81, 82, 86, 87), uint4(82, 83, 87, 88), uint4(84, 84, 89, 89), uint4(85, 86, 90, 91),
+	uint4(86, 87, 91, 92), uint4(87, 88, 92, 93), uint4(89, 89, 94, 94), uint4(95, 96, 95, 96),
+	uint4(96, 97, 96, 97), uint4(97, 98, 97, 98), uint4(99, 99, 99, 99), uint4(100, 101, 105, 106),
+	uint4(101, 102, 106, 107), uint4(102, 103, 107, 108), uint4(104, 104, 109, 109), uint4(105, 106, 110, 111),
+	uint4(106, 107, 111, 112), uint4(107, 108, 112, 113), uint4(109, 109, 114, 114), uint4(110, 111, 115, 116),
+	uint4(111, 112, 116, 117), uint4(112, 113, 117, 118), uint4(114, 114, 119, 119), uint4(120, 121, 120, 121),
+	uint4(121, 122, 121, 122), uint4(122, 123, 122, 123), uint4(124, 124, 124, 124),
+};
+static const float4 decimation_wt_5x5x5[91] =
+{
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.666666627f, 0.333333373f, 0.0f, 0.0f), float4(0.333333254f, 0.666666746f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.666666627f, 0.0f, 0.333333373f, 0.0f),
+	float4(0.444444388f, 0.222222239f, 0.222222239f, 0.111111134f), float4(0.222222149f, 0.444444478f, 0.111111097f, 0.222222269f),
+	float4(0.666666627f, 0.0f, 0.333333373f, 0.0f), float4(0.333333254f, 0.0f, 0.666666746f, 0.0f),
+	float4(0.222222149f, 0.111111097f, 0.444444478f, 0.222222269f), float4(0.11111106f, 0.222222194f, 0.222222194f, 0.444444537f),
+	float4(0.333333254f, 0.0f, 0.666666746f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.666666627f, 0.333333373f, 0.0f, 0.0f), float4(0.333333254f, 0.666666746f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.666666627f, 0.333333373f, 0.0f, 0.0f), float4(0.333333254f, 0.666666746f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.666666627f, 0.0f, 0.333333373f, 0.0f),
+	float4(0.444444388f, 0.222222239f, 0.222222239f, 0.111111134f), float4(0.222222149f, 0.444444478f, 0.111111097f, 0.222222269f),
+	float4(0.666666627f, 0.0f, 0.333333373f, 0.0f), float4(0.333333254f, 0.0f, 0.666666746f, 0.0f),
+	float4(0.222222149f, 0.111111097f, 0.444444478f, 0.222222269f), float4(0.11111106f, 0.222222194f, 0.222222194f, 0.444444537f),
+	float4(0.333333254f, 0.0f, 0.666666746f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.666666627f, 0.333333373f, 0.0f, 0.0f), float4(0.333333254f, 0.666666746f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.666666627f, 0.333333373f, 0.0f, 0.0f), float4(0.333333254f, 0.666666746f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.666666627f, 0.0f, 0.333333373f, 0.0f),
+	float4(0.444444388f, 0.222222239f, 0.222222239f, 0.111111134f), float4(0.222222149f, 0.444444478f, 0.111111097f, 0.222222269f),
+	float4(0.666666627f, 0.0f, 0.333333373f, 0.0f), float4(0.333333254f, 0.0f, 0.666666746f, 0.0f),
+	float4(0.222222149f, 0.111111097f, 0.444444478f, 0.222222269f), float4(0.11111106f, 0.222222194f, 0.222222194f, 0.444444537f),
+	float4(0.333333254f, 0.0f, 0.666666746f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.666666627f, 0.333333373f, 0.0f, 0.0f), float4(0.333333254f, 0.666666746f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.666666627f, 0.333333373f, 0.0f, 0.0f), float4(0.333333254f, 0.666666746f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.666666627f, 0.0f, 0.333333373f, 0.0f),
+	float4(0.444444388f, 0.222222239f, 0.222222239f, 0.111111134f), float4(0.222222149f, 0.444444478f, 0.111111097f, 0.222222269f),
+	float4(0.666666627f, 0.0f, 0.333333373f, 0.0f), float4(0.333333254f, 0.0f, 0.666666746f, 0.0f),
+	float4(0.222222149f, 0.111111097f, 0.444444478f, 0.222222269f), float4(0.11111106f, 0.222222194f, 0.222222194f, 0.444444537f),
+	float4(0.333333254f, 0.0f, 0.666666746f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.666666627f, 0.333333373f, 0.0f, 0.0f), float4(0.333333254f, 0.666666746f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f),
+};
+static const uint4 infill_idx_5x5x5[250] =
+{
+	uint4(0, 0, 0, 0), uint4(0, 1, 0, 0), uint4(1, 1, 1, 1), uint4(1, 2, 1, 1),
+	uint4(2, 2, 2, 2), uint4(0, 3, 0, 0), uint4(0, 0, 4, 0), uint4(1, 4, 1, 1),
+	uint4(1, 1, 5, 1), uint4(2, 5, 2, 2), uint4(3, 3, 3, 3), uint4(3, 4, 3, 3),
+	uint4(4, 4, 4, 4), uint4(4, 5, 4, 4), uint4(5, 5, 5, 5), uint4(3, 6, 3, 3),
+	uint4(3, 3, 7, 3), uint4(4, 7, 4, 4), uint4(4, 4, 8, 4), uint4(5, 8, 5, 5),
+	uint4(6, 6, 6, 6), uint4(6, 7, 6, 6), uint4(7, 7, 7, 7), uint4(7, 8, 7, 7),
+	uint4(8, 8, 8, 8), uint4(0, 9, 0, 0), uint4(0, 0, 10, 0), uint4(1, 10, 1, 1),
+	uint4(1, 1, 11, 1), uint4(2, 11, 2, 2), uint4(0, 0, 12, 0), uint4(0, 0, 0, 13),
+	uint4(1, 1, 13, 1), uint4(1, 1, 1, 14), uint4(2, 2, 14, 2), uint4(3, 12, 3, 3),
+	uint4(3, 3, 13, 3), uint4(4, 13, 4, 4), uint4(4, 4, 14, 4), uint4(5, 14, 5, 5),
+	uint4(3, 3, 15, 3), uint4(3, 3, 3, 16), uint4(4, 4, 16, 4), uint4(4, 4, 4, 17),
+	uint4(5, 5, 17, 5), uint4(6, 15, 6, 6), uint4(6, 6, 16, 6), uint4(7, 16, 7, 7),
+	uint4(7, 7, 17, 7), uint4(8, 17, 8, 8), uint4(9, 9, 9, 9), uint4(9, 10, 9, 9),
+	uint4(10, 10, 10, 10), uint4(10, 11, 10, 10), uint4(11, 11, 11, 11), uint4(9, 12, 9, 9),
+	uint4(9, 9, 13, 9), uint4(10, 13, 10, 10), uint4(10, 10, 14, 10), uint4(11, 14, 11, 11),
+	uint4(12, 12, 12, 12), uint4(12, 13, 12, 12), uint4(13, 13, 13, 13), uint4(13, 14, 13, 13),
+	uint4(14, 14, 14, 14), uint4(12, 15, 12, 12), uint4(12, 12, 16, 12), uint4(13, 16, 13, 13),
+	uint4(13, 13, 17, 13), uint4(14, 17, 14, 14), uint4(15, 15, 15, 15), uint4(15, 16, 15, 15),
+	uint4(16, 16, 16, 16), uint4(16, 17, 16, 16), uint4(17, 17, 17, 17), uint4(9, 18, 9, 9),
+	uint4(9, 9, 19, 9), uint4(10, 19, 10, 10), uint4(10, 10, 20, 10), uint4(11, 20, 11, 11),
+	uint4(9, 9, 21, 9), uint4(9, 9, 9, 22), uint4(10, 10, 22, 10), uint4(10, 10, 10, 23),
+	uint4(11, 11, 23, 11), uint4(12, 21, 12, 12), uint4(12, 12, 22, 12), uint4(13, 22, 13, 13),
+	uint4(13, 13, 23, 13), uint4(14, 23, 14, 14), uint4(12, 12, 24, 12), uint4(12, 12, 12, 25),
+	uint4(13, 13, 25, 13), uint4(13, 13, 13, 26), uint4(14, 14, 26, 14), uint4(15, 24, 15, 15),
+	uint4(15, 15, 25, 15), uint4(16, 25, 16, 16), uint4(16, 16, 26, 16), uint4(17, 26, 17, 17),
+	uint4(18, 18, 18, 18), uint4(18, 19, 18, 18), uint4(19, 19, 19, 19), uint4(19, 20, 19, 19),
+	uint4(20, 20, 20, 20), uint4(18, 21, 18, 18), uint4(18, 18, 22, 18), uint4(19, 22, 19, 19),
+	uint4(19, 19, 23, 19), uint4(20, 23, 20, 20), uint4(21, 21, 21, 21), uint4(21, 22, 21, 21),
+	uint4(22, 22, 22, 22), uint4(22, 23, 22, 22), uint4(23, 23, 23, 23), uint4(21, 24, 21, 21),
+	uint4(21, 21, 25, 21), uint4(22, 25, 22, 22), uint4(22, 22, 26, 22), uint4(23, 26, 23, 23),
+	uint4(24, 24, 24, 24), uint4(24, 25, 24, 24), uint4(25, 25, 25, 25), uint4(25, 26, 25, 25),
+	uint4(26, 26, 26, 26), uint4(0, 0, 0, 0), uint4(0, 1, 0, 0), uint4(1, 2, 1, 1),
+	uint4(2, 3, 2, 2), uint4(3, 3, 3, 3), uint4(0, 4, 0, 0), uint4(0, 0, 5, 0),
+	uint4(1, 5, 6, 1), uint4(2, 6, 7, 2), uint4(3, 7, 3, 3), uint4(4, 8, 4, 4),
+	uint4(4, 5, 9, 4), uint4(5, 5, 10, 5), uint4(6, 10, 11, 6), uint4(7, 11, 7, 7),
+	uint4(8, 12, 8, 8), uint4(8, 9, 13, 8), uint4(9, 10, 14, 9), uint4(10, 10, 15, 10),
+	uint4(11, 15, 11, 11), uint4(12, 12, 12, 12), uint4(12, 13, 12, 12), uint4(13, 14, 13, 13),
+	uint4(14, 15, 14, 14), uint4(15, 15, 15, 15), uint4(0, 16, 0, 0), uint4(0, 0, 17, 0),
+	uint4(1, 17, 18, 1), uint4(2, 18, 19, 2), uint4(3, 19, 3, 3), uint4(0, 0, 20, 0),
+	uint4(0, 0, 0, 21), uint4(1, 1, 21, 22), uint4(2, 2, 22, 23), uint4(3, 3, 23, 3),
+	uint4(4, 20, 24, 4), uint4(4, 4, 21, 25), uint4(5, 21, 5, 26), uint4(6, 22, 26, 27),
+	uint4(7, 23, 27, 7), uint4(8, 24, 28, 8), uint4(8, 8, 25, 29), uint4(9, 25, 26, 30),
+	uint4(10, 26, 10, 31), uint4(11, 27, 31, 11), uint4(12, 28, 12, 12), uint4(12, 12, 29, 12),
+	uint4(13, 29, 30, 13), uint4(14, 30, 31, 14), uint4(15, 31, 15, 15), uint4(16, 32, 16, 16),
+	uint4(16, 17, 33, 16), uint4(17, 17, 34, 17), uint4(18, 34, 35, 18), uint4(19, 35, 19, 19),
+	uint4(16, 20, 36, 16), uint4(16, 16, 21, 37), uint4(17, 21, 17, 38), uint4(18, 22, 38, 39),
+	uint4(19, 23, 39, 19), uint4(20, 20, 40, 20), uint4(20, 21, 20, 41), uint4(21, 21, 21, 42),
+	uint4(22, 22, 42, 43), uint4(23, 23, 43, 23), uint4(24, 40, 44, 24), uint4(24, 25, 41, 45),
+	uint4(25, 25, 42, 46), uint4(26, 42, 26, 47), uint4(27, 43, 47, 27), uint4(28, 44, 28, 28),
+	uint4(28, 29, 45, 28), uint4(29, 29, 46, 29), uint4(30, 46, 47, 30), uint4(31, 47, 31, 31),
+	uint4(32, 48, 32, 32), uint4(32, 33, 49, 32), uint4(33, 34, 50, 33), uint4(34, 34, 51, 34),
+	uint4(35, 51, 35, 35), uint4(32, 36, 52, 32), uint4(32, 32, 37, 53), uint4(33, 37, 38, 54),
+	uint4(34, 38, 34, 55), uint4(35, 39, 55, 35), uint4(36, 40, 56, 36), uint4(36, 37, 41, 57),
+	uint4(37, 37, 42, 58), uint4(38, 42, 38, 59), uint4(39, 43, 59, 39), uint4(40, 40, 60, 40),
+	uint4(40, 41, 40, 61), uint4(41, 42, 41, 62), uint4(42, 42, 42, 63), uint4(43, 43, 63, 43),
+	uint4(44, 60, 44, 44), uint4(44, 45, 61, 44), uint4(45, 46, 62, 45), uint4(46, 46, 63, 46),
+	uint4(47, 63, 47, 47), uint4(48, 48, 48, 48), uint4(48, 49, 48, 48), uint4(49, 50, 49, 49),
+	uint4(50, 51, 50, 50), uint4(51, 51, 51, 51), uint4(48, 52, 48, 48), uint4(48, 48, 53, 48),
+	uint4(49, 53, 54, 49), uint4(50, 54, 55, 50), uint4(51, 55, 51, 51), uint4(52, 56, 52, 52),
+	uint4(52, 53, 57, 52), uint4(53, 53, 58, 53), uint4(54, 58, 59, 54), uint4(55, 59, 55, 55),
+	uint4(56, 60, 56, 56), uint4(56, 57, 61, 56), uint4(57, 58, 62, 57), uint4(58, 58, 63, 58),
+	uint4(59, 63, 59, 59), uint4(60, 60, 60, 60), uint4(60, 61, 60, 60), uint4(61, 62, 61, 61),
+	uint4(62, 63, 62, 62), uint4(63, 63, 63, 63),
+};
+static const float4 infill_wt_5x5x5[250] =
+{
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.5f, 0.5f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.5f, 0.5f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.5f, 0.5f, 0.0f, 0.0f), float4(0.5f, 0.0f, 0.5f, 0.0f), float4(0.5f, 0.5f, 0.0f, 0.0f),
+	float4(0.5f, 0.0f, 0.5f, 0.0f), float4(0.5f, 0.5f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.5f, 0.5f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.5f, 0.5f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.5f, 0.5f, 0.0f, 0.0f),
+	float4(0.5f, 0.0f, 0.5f, 0.0f), float4(0.5f, 0.5f, 0.0f, 0.0f), float4(0.5f, 0.0f, 0.5f, 0.0f), float4(0.5f, 0.5f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.5f, 0.5f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.5f, 0.5f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.5f, 0.5f, 0.0f, 0.0f), float4(0.5f, 0.0f, 0.5f, 0.0f), float4(0.5f, 0.5f, 0.0f, 0.0f),
+	float4(0.5f, 0.0f, 0.5f, 0.0f), float4(0.5f, 0.5f, 0.0f, 0.0f), float4(0.5f, 0.0f, 0.5f, 0.0f), float4(0.5f, 0.0f, 0.0f, 0.5f),
+	float4(0.5f, 0.0f, 0.5f, 0.0f), float4(0.5f, 0.0f, 0.0f, 0.5f), float4(0.5f, 0.0f, 0.5f, 0.0f), float4(0.5f, 0.5f, 0.0f, 0.0f),
+	float4(0.5f, 0.0f, 0.5f, 0.0f), float4(0.5f, 0.5f, 0.0f, 0.0f), float4(0.5f, 0.0f, 0.5f, 0.0f), float4(0.5f, 0.5f, 0.0f, 0.0f),
+	float4(0.5f, 0.0f, 0.5f, 0.0f), float4(0.5f, 0.0f, 0.0f, 0.5f), float4(0.5f, 0.0f, 0.5f, 0.0f), float4(0.5f, 0.0f, 0.0f, 0.5f),
+	float4(0.5f, 0.0f, 0.5f, 0.0f), float4(0.5f, 0.5f, 0.0f, 0.0f), float4(0.5f, 0.0f, 0.5f, 0.0f), float4(0.5f, 0.5f, 0.0f, 0.0f),
+	float4(0.5f, 0.0f, 0.5f, 0.0f), float4(0.5f, 0.5f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.5f, 0.5f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.5f, 0.5f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.5f, 0.5f, 0.0f, 0.0f),
+	float4(0.5f, 0.0f, 0.5f, 0.0f), float4(0.5f, 0.5f, 0.0f, 0.0f), float4(0.5f, 0.0f, 0.5f, 0.0f), float4(0.5f, 0.5f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.5f, 0.5f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.5f, 0.5f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.5f, 0.5f, 0.0f, 0.0f), float4(0.5f, 0.0f, 0.5f, 0.0f), float4(0.5f, 0.5f, 0.0f, 0.0f),
+	float4(0.5f, 0.0f, 0.5f, 0.0f), float4(0.5f, 0.5f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.5f, 0.5f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.5f, 0.5f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.5f, 0.5f, 0.0f, 0.0f),
+	float4(0.5f, 0.0f, 0.5f, 0.0f), float4(0.5f, 0.5f, 0.0f, 0.0f), float4(0.5f, 0.0f, 0.5f, 0.0f), float4(0.5f, 0.5f, 0.0f, 0.0f),
+	float4(0.5f, 0.0f, 0.5f, 0.0f), float4(0.5f, 0.0f, 0.0f, 0.5f), float4(0.5f, 0.0f, 0.5f, 0.0f), float4(0.5f, 0.0f, 0.0f, 0.5f),
+	float4(0.5f, 0.0f, 0.5f, 0.0f), float4(0.5f, 0.5f, 0.0f, 0.0f), float4(0.5f, 0.0f, 0.5f, 0.0f), float4(0.5f, 0.5f, 0.0f, 0.0f),
+	float4(0.5f, 0.0f, 0.5f, 0.0f), float4(0.5f, 0.5f, 0.0f, 0.0f), float4(0.5f, 0.0f, 0.5f, 0.0f), float4(0.5f, 0.0f, 0.0f, 0.5f),
+	float4(0.5f, 0.0f, 0.5f, 0.0f), float4(0.5f, 0.0f, 0.0f, 0.5f), float4(0.5f, 0.0f, 0.5f, 0.0f), float4(0.5f, 0.5f, 0.0f, 0.0f),
+	float4(0.5f, 0.0f, 0.5f, 0.0f), float4(0.5f, 0.5f, 0.0f, 0.0f), float4(0.5f, 0.0f, 0.5f, 0.0f), float4(0.5f, 0.5f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.5f, 0.5f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.5f, 0.5f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.5f, 0.5f, 0.0f, 0.0f), float4(0.5f, 0.0f, 0.5f, 0.0f), float4(0.5f, 0.5f, 0.0f, 0.0f),
+	float4(0.5f, 0.0f, 0.5f, 0.0f), float4(0.5f, 0.5f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.5f, 0.5f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.5f, 0.5f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.5f, 0.5f, 0.0f, 0.0f),
+	float4(0.5f, 0.0f, 0.5f, 0.0f), float4(0.5f, 0.5f, 0.0f, 0.0f), float4(0.5f, 0.0f, 0.5f, 0.0f), float4(0.5f, 0.5f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.5f, 0.5f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.5f, 0.5f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.25f, 0.75f, 0.0f, 0.0f), float4(0.5f, 0.5f, 0.0f, 0.0f),
+	float4(0.75f, 0.25f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.25f, 0.75f, 0.0f, 0.0f), float4(0.25f, 0.0f, 0.75f, 0.0f),
+	float4(0.25f, 0.25f, 0.5f, 0.0f), float4(0.25f, 0.5f, 0.25f, 0.0f), float4(0.25f, 0.75f, 0.0f, 0.0f), float4(0.5f, 0.5f, 0.0f, 0.0f),
+	float4(0.25f, 0.25f, 0.5f, 0.0f), float4(0.5f, 0.0f, 0.5f, 0.0f), float4(0.5f, 0.25f, 0.25f, 0.0f), float4(0.5f, 0.5f, 0.0f, 0.0f),
+	float4(0.75f, 0.25f, 0.0f, 0.0f), float4(0.25f, 0.5f, 0.25f, 0.0f), float4(0.5f, 0.25f, 0.25f, 0.0f), float4(0.75f, 0.0f, 0.25f, 0.0f),
+	float4(0.75f, 0.25f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.25f, 0.75f, 0.0f, 0.0f), float4(0.5f, 0.5f, 0.0f, 0.0f),
+	float4(0.75f, 0.25f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.25f, 0.75f, 0.0f, 0.0f), float4(0.25f, 0.0f, 0.75f, 0.0f),
+	float4(0.25f, 0.25f, 0.5f, 0.0f), float4(0.25f, 0.5f, 0.25f, 0.0f), float4(0.25f, 0.75f, 0.0f, 0.0f), float4(0.25f, 0.0f, 0.75f, 0.0f),
+	float4(0.25f, 0.0f, 0.0f, 0.75f), float4(0.25f, 0.0f, 0.25f, 0.5f), float4(0.25f, 0.0f, 0.5f, 0.25f), float4(0.25f, 0.0f, 0.75f, 0.0f),
+	float4(0.25f, 0.25f, 0.5f, 0.0f), float4(0.25f, 0.0f, 0.25f, 0.5f), float4(0.25f, 0.25f, 0.0f, 0.5f), float4(0.25f, 0.25f, 0.25f, 0.25f),
+	float4(0.25f, 0.25f, 0.5f, 0.0f), float4(0.25f, 0.5f, 0.25f, 0.0f), float4(0.25f, 0.0f, 0.5f, 0.25f), float4(0.25f, 0.25f, 0.25f, 0.25f),
+	float4(0.25f, 0.5f, 0.0f, 0.25f), float4(0.25f, 0.5f, 0.25f, 0.0f), float4(0.25f, 0.75f, 0.0f, 0.0f), float4(0.25f, 0.0f, 0.75f, 0.0f),
+	float4(0.25f, 0.25f, 0.5f, 0.0f), float4(0.25f, 0.5f, 0.25f, 0.0f), float4(0.25f, 0.75f, 0.0f, 0.0f), float4(0.5f, 0.5f, 0.0f, 0.0f),
+	float4(0.25f, 0.25f, 0.5f, 0.0f), float4(0.5f, 0.0f, 0.5f, 0.0f), float4(0.5f, 0.25f, 0.25f, 0.0f), float4(0.5f, 0.5f, 0.0f, 0.0f),
+	float4(0.25f, 0.25f, 0.5f, 0.0f), float4(0.25f, 0.0f, 0.25f, 0.5f), float4(0.25f, 0.25f, 0.0f, 0.5f), float4(0.25f, 0.25f, 0.25f, 0.25f),
+	float4(0.25f, 0.25f, 0.5f, 0.0f), float4(0.5f, 0.0f, 0.5f, 0.0f), float4(0.25f, 0.25f, 0.0f, 0.5f), float4(0.5f, 0.0f, 0.0f, 0.5f),
+	float4(0.5f, 0.0f, 0.25f, 0.25f), float4(0.5f, 0.0f, 0.5f, 0.0f), float4(0.5f, 0.25f, 0.25f, 0.0f), float4(0.25f, 0.25f, 0.25f, 0.25f),
+	float4(0.5f, 0.0f, 0.25f, 0.25f), float4(0.5f, 0.25f, 0.0f, 0.25f), float4(0.5f, 0.25f, 0.25f, 0.0f), float4(0.5f, 0.5f, 0.0f, 0.0f),
+	float4(0.25f, 0.25f, 0.5f, 0.0f), float4(0.5f, 0.0f, 0.5f, 0.0f), float4(0.5f, 0.25f, 0.25f, 0.0f), float4(0.5f, 0.5f, 0.0f, 0.0f),
+	float4(0.75f, 0.25f, 0.0f, 0.0f), float4(0.25f, 0.5f, 0.25f, 0.0f), float4(0.5f, 0.25f, 0.25f, 0.0f), float4(0.75f, 0.0f, 0.25f, 0.0f),
+	float4(0.75f, 0.25f, 0.0f, 0.0f), float4(0.25f, 0.5f, 0.25f, 0.0f), float4(0.25f, 0.0f, 0.5f, 0.25f), float4(0.25f, 0.25f, 0.25f, 0.25f),
+	float4(0.25f, 0.5f, 0.0f, 0.25f), float4(0.25f, 0.5f, 0.25f, 0.0f), float4(0.5f, 0.25f, 0.25f, 0.0f), float4(0.25f, 0.25f, 0.25f, 0.25f),
+	float4(0.5f, 0.0f, 0.25f, 0.25f), float4(0.5f, 0.25f, 0.0f, 0.25f), float4(0.5f, 0.25f, 0.25f, 0.0f), float4(0.75f, 0.0f, 0.25f, 0.0f),
+	float4(0.25f, 0.5f, 0.0f, 0.25f), float4(0.5f, 0.25f, 0.0f, 0.25f), float4(0.75f, 0.0f, 0.0f, 0.25f), float4(0.75f, 0.0f, 0.25f, 0.0f),
+	float4(0.75f, 0.25f, 0.0f, 0.0f), float4(0.25f, 0.5f, 0.25f, 0.0f), float4(0.5f, 0.25f, 0.25f, 0.0f), float4(0.75f, 0.0f, 0.25f, 0.0f),
+	float4(0.75f, 0.25f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.25f, 0.75f, 0.0f, 0.0f), float4(0.5f, 0.5f, 0.0f, 0.0f),
+	float4(0.75f, 0.25f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.25f, 0.75f, 0.0f, 0.0f), float4(0.25f, 0.0f, 0.75f, 0.0f),
+	float4(0.25f, 0.25f, 0.5f, 0.0f), float4(0.25f, 0.5f, 0.25f, 0.0f), float4(0.25f, 0.75f, 0.0f, 0.0f), float4(0.5f, 0.5f, 0.0f, 0.0f),
+	float4(0.25f, 0.25f, 0.5f, 0.0f), float4(0.5f, 0.0f, 0.5f, 0.0f), float4(0.5f, 0.25f, 0.25f, 0.0f), float4(0.5f, 0.5f, 0.0f, 0.0f),
+	float4(0.75f, 0.25f, 0.0f, 0.0f), float4(0.25f, 0.5f, 0.25f, 0.0f), float4(0.5f, 0.25f, 0.25f, 0.0f), float4(0.75f, 0.0f, 0.25f, 0.0f),
+	float4(0.75f, 0.25f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.25f, 0.75f, 0.0f, 0.0f), float4(0.5f, 0.5f, 0.0f, 0.0f),
+	float4(0.75f, 0.25f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+};
+static const uint4 pseudo_inverse_idx_5x5x5[364] =
+{
+	uint4(0, 1, 2, 5), uint4(6, 7, 10, 11), uint4(25, 26, 27, 30), uint4(31, 35, 50, 51),
+	uint4(0, 1, 2, 3), uint4(4, 7, 8, 9), uint4(14, 27, 28, 29), uint4(32, 33, 34, 54),
+	uint4(2, 3, 4, 8), uint4(9, 14, 19, 28), uint4(29, 33, 34, 39), uint4(54, 59, 64, 79),
+	uint4(0, 5, 10, 11), uint4(15, 16, 20, 21), uint4(22, 35, 36, 40), uint4(41, 45, 46, 70),
+	uint4(0, 6, 7, 11), uint4(12, 13, 17, 18), uint4(19, 23, 24, 37), uint4(38, 42, 43, 49),
+	uint4(2, 3, 4, 8), uint4(9, 13, 14, 18), uint4(19, 24, 34, 39), uint4(44, 49, 69, 74),
+	uint4(10, 15, 16, 20), uint4(21, 22, 23, 40), uint4(41, 45, 46, 47), uint4(70, 71, 72, 95),
+	uint4(10, 11, 15, 16), uint4(17, 18, 20, 21), uint4(22, 23, 24, 46), uint4(47, 48, 49, 74),
+	uint4(9, 12, 13, 14), uint4(17, 18, 19, 21), uint4(22, 23, 24, 43), uint4(44, 48, 49, 74),
+	uint4(0, 25, 50, 51), uint4(55, 56, 75, 76), uint4(80, 81, 100, 101), uint4(102, 105, 106, 110),
+	uint4(0, 26, 27, 51), uint4(52, 53, 57, 58), uint4(77, 78, 79, 82), uint4(83, 103, 104, 109),
+	uint4(2, 3, 4, 28), uint4(29, 34, 53, 54), uint4(59, 78, 79, 83), uint4(84, 104, 109, 114),
+	uint4(0, 30, 35, 55), uint4(60, 61, 65, 66), uint4(85, 86, 90, 91), uint4(95, 115, 120, 121),
+	uint4(2, 31, 32, 36), uint4(37, 56, 57, 61), uint4(62, 63, 67, 68), uint4(87, 88, 92, 93),
+	uint4(3, 4, 9, 29), uint4(33, 34, 38, 39), uint4(58, 59, 63, 64), uint4(69, 89, 94, 124),
+	uint4(10, 15, 20, 35), uint4(40, 45, 46, 65), uint4(70, 71, 90, 95), uint4(96, 120, 121, 122),
+	uint4(15, 20, 21, 41), uint4(42, 45, 46, 47), uint4(66, 67, 71, 72), uint4(73, 97, 98, 124),
+	uint4(14, 18, 19, 22), uint4(23, 24, 43, 44), uint4(48, 49, 68, 69), uint4(73, 74, 99, 124),
+	uint4(50, 75, 76, 80), uint4(81, 100, 101, 102), uint4(103, 105, 106, 107), uint4(110, 111, 112, 115),
+	uint4(50, 75, 76, 77), uint4(78, 83, 100, 101), uint4(102, 103, 104, 106), uint4(107, 108, 109, 114),
+	uint4(29, 52, 53, 54), uint4(77, 78, 79, 83), uint4(84, 101, 102, 103), uint4(104, 108, 109, 114),
+	uint4(50, 75, 80, 81), uint4(85, 90, 100, 105), uint4(106, 110, 111, 115), uint4(116, 120, 121, 122),
+	uint4(75, 81, 82, 86), uint4(87, 100, 101, 105), uint4(106, 107, 111, 112), uint4(113, 117, 118, 124),
+	uint4(54, 78, 79, 83), uint4(84, 88, 89, 102), uint4(103, 104, 108, 109), uint4(113, 114, 119, 124),
+	uint4(45, 60, 65, 70), uint4(85, 90, 91, 95), uint4(96, 105, 110, 115), uint4(116, 120, 121, 122),
+	uint4(70, 90, 91, 92), uint4(95, 96, 97, 110), uint4(115, 116, 117, 120), uint4(121, 122, 123, 124),
+	uint4(69, 73, 74, 89), uint4(93, 94, 98, 99), uint4(113, 114, 117, 118), uint4(119, 122, 123, 124),
+	uint4(0, 1, 2, 5), uint4(6, 7, 10, 11), uint4(12, 25, 26, 30), uint4(31, 50, 52, 60),
+	uint4(0, 1, 2, 3), uint4(6, 7, 8, 13), uint4(26, 27, 28, 31), uint4(32, 33, 53, 58),
+	uint4(1, 2, 3, 4), uint4(7, 8, 9, 13), uint4(27, 28, 29, 32), uint4(33, 34, 53, 58),
+	uint4(2, 3, 4, 8), uint4(9, 14, 19, 28), uint4(29, 33, 34, 39), uint4(54, 59, 64, 79),
+	uint4(0, 5, 6, 10), uint4(11, 15, 16, 17), uint4(30, 31, 35, 36), uint4(40, 41, 65, 66),
+	uint4(0, 1, 5, 6), uint4(7, 8, 11, 12), uint4(13, 16, 17, 18), uint4(31, 37, 42, 43),
+	uint4(1, 2, 3, 6), uint4(7, 8, 9, 12), uint4(13, 14, 18, 19), uint4(32, 38, 39, 44),
+	uint4(3, 4, 7, 8), uint4(9, 13, 14, 18), uint4(19, 24, 34, 38), uint4(39, 44, 49, 69),
+	uint4(5, 10, 11, 15), uint4(16, 17, 20, 21), uint4(35, 36, 40, 41), uint4(45, 46, 65, 66),
+	uint4(5, 6, 10, 11), uint4(12, 15, 16, 17), uint4(18, 21, 22, 23), uint4(36, 42, 47, 48),
+	uint4(6, 7, 8, 11), uint4(12, 13, 16, 17), uint4(18, 19, 23, 24), uint4(37, 38, 43, 49),
+	uint4(3, 4, 7, 8), uint4(9, 13, 14, 18), uint4(19, 24, 34, 38), uint4(39, 44, 49, 69),
+	uint4(10, 15, 16, 20), uint4(21, 22, 23, 40), uint4(41, 45, 46, 47), uint4(70, 71, 72, 95),
+	uint4(11, 15, 16, 17), uint4(18, 20, 21, 22), uint4(23, 24, 42, 46), uint4(47, 48, 49, 73),
+	uint4(11, 15, 16, 17), uint4(18, 20, 21, 22), uint4(23, 24, 42, 46), uint4(47, 48, 49, 73),
+	uint4(9, 12, 13, 14), uint4(17, 18, 19, 21), uint4(22, 23, 24, 43), uint4(44, 48, 49, 74),
+	uint4(0, 25, 26, 30), uint4(31, 50, 51, 55), uint4(56, 75, 76, 77), uint4(80, 81, 82, 85),
+	uint4(0, 1, 25, 26), uint4(27, 28, 31, 51), uint4(52, 53, 57, 76), uint4(77, 78, 82, 83),
+	uint4(1, 2, 3, 26), uint4(27, 28, 29, 32), uint4(52, 53, 54, 58), uint4(59, 78, 79, 84),
+	uint4(3, 4, 27, 28), uint4(29, 34, 53, 54), uint4(58, 59, 78, 79), uint4(84, 89, 104, 109),
+	uint4(0, 5, 25, 30), uint4(31, 35, 40, 55), uint4(60, 61, 65, 66), uint4(80, 85, 90, 91),
+	uint4(0, 31, 32, 36), uint4(37, 56, 57, 61), uint4(62, 63, 67, 68), uint4(87, 88, 92, 93),
+	uint4(1, 2, 3, 27), uint4(31, 32, 33, 34), uint4(38, 58, 62, 63), uint4(64, 69, 93, 94),
+	uint4(3, 4, 9, 29), uint4(33, 34, 38, 39), uint4(44, 59, 63, 64), uint4(69, 84, 89, 94),
+	uint4(5, 10, 15, 30), uint4(35, 36, 40, 45), uint4(60, 65, 66, 70), uint4(71, 90, 95, 96),
+	uint4(5, 10, 15, 31), uint4(35, 36, 41, 42), uint4(46, 62, 66, 67), uint4(72, 93, 97, 98),
+	uint4(6, 12, 18, 31), uint4(37, 38, 42, 43), uint4(49, 62, 68, 69), uint4(73, 74, 93, 99),
+	uint4(8, 9, 13, 14), uint4(19, 34, 38, 39), uint4(44, 49, 63, 64), uint4(69, 74, 94, 99),
+	uint4(15, 20, 35, 40), uint4(45, 46, 65, 66), uint4(70, 71, 90, 95), uint4(96, 97, 120, 121),
+	uint4(15, 20, 21, 41), uint4(45, 46, 47, 48), uint4(66, 67, 71, 72), uint4(73, 96, 97, 98),
+	uint4(16, 17, 21, 22), uint4(23, 42, 46, 47), uint4(48, 49, 67, 72), uint4(73, 74, 98, 99),
+	uint4(18, 19, 23, 24), uint4(38, 39, 43, 44), uint4(47, 48, 49, 68), uint4(69, 73, 74, 99),
+	uint4(25, 50, 51, 55), uint4(56, 75, 76, 77), uint4(80, 81, 82, 85), uint4(100, 101, 105, 106),
+	uint4(25, 26, 50, 51), uint4(52, 57, 75, 76), uint4(77, 78, 82, 101), uint4(102, 103, 107, 108),
+	uint4(26, 27, 28, 51), uint4(52, 53, 57, 58), uint4(76, 77, 78, 79), uint4(83, 103, 104, 109),
+	uint4(3, 4, 27, 28), uint4(29, 34, 53, 54), uint4(58, 59, 78, 79), uint4(84, 89, 104, 109),
+	uint4(25, 30, 50, 55), uint4(56, 60, 75, 80), uint4(85, 86, 90, 105), uint4(110, 111, 115, 116),
+	uint4(25, 31, 50, 51), uint4(56, 62, 75, 81), uint4(82, 86, 87, 93), uint4(106, 112, 117, 118),
+	uint4(26, 27, 31, 51), uint4(52, 57, 58, 62), uint4(78, 82, 83, 88), uint4(93, 109, 114, 119),
+	uint4(28, 29, 34, 53), uint4(54, 58, 59, 64), uint4(79, 84, 88, 89), uint4(94, 109, 114, 119),
+	uint4(30, 35, 40, 55), uint4(60, 61, 65, 80), uint4(85, 86, 90, 91), uint4(95, 115, 120, 121),
+	uint4(30, 31, 35, 60), uint4(61, 62, 66, 86), uint4(90, 91, 92, 93), uint4(97, 121, 122, 123),
+	uint4(31, 32, 36, 37), uint4(56, 57, 61, 62), uint4(63, 67, 68, 87), uint4(88, 92, 93, 124),
+	uint4(33, 34, 38, 39), uint4(44, 59, 63, 64), uint4(69, 84, 89, 93), uint4(94, 99, 119, 124),
+	uint4(15, 20, 35, 40), uint4(45, 46, 65, 66), uint4(70, 71, 90, 95), uint4(96, 97, 120, 121),
+	uint4(40, 45, 46, 65), uint4(66, 67, 70, 71), uint4(72, 95, 96, 97), uint4(98, 121, 122, 123),
+	uint4(41, 42, 46, 47), uint4(48, 67, 71, 72), uint4(73, 93, 96, 97), uint4(98, 99, 123, 124),
+	uint4(38, 39, 43, 44), uint4(47, 48, 49, 68), uint4(69, 73, 74, 93), uint4(94, 98, 99, 124),
+	uint4(50, 75, 76, 80), uint4(81, 100, 101, 102), uint4(103, 105, 106, 107), uint4(110, 111, 112, 115),
+	uint4(51, 75, 76, 77), uint4(78, 82, 100, 101), uint4(102, 103, 104, 106), uint4(107, 108, 109, 113),
+	uint4(51, 75, 76, 77), uint4(78, 82, 100, 101), uint4(102, 103, 104, 106), uint4(107, 108, 109, 113),
+	uint4(29, 52, 53, 54), uint4(77, 78, 79, 83), uint4(84, 101, 102, 103), uint4(104, 108, 109, 114),
+	uint4(55, 75, 80, 85), uint4(86, 90, 100, 105), uint4(106, 110, 111, 115), uint4(116, 117, 120, 121),
+	uint4(75, 81, 86, 87), uint4(100, 101, 105, 106), uint4(107, 108, 111, 112), uint4(113, 116, 117, 118),
+	uint4(76, 77, 82, 88), uint4(101, 102, 103, 106), uint4(107, 108, 109, 112), uint4(113, 114, 118, 119),
+	uint4(58, 59, 78, 79), uint4(83, 84, 88, 89), uint4(103, 104, 107, 108), uint4(109, 113, 114, 119),
+	uint4(55, 75, 80, 85), uint4(86, 90, 100, 105), uint4(106, 110, 111, 115), uint4(116, 117, 120, 121),
+	uint4(80, 85, 86, 87), uint4(105, 106, 110, 111), uint4(112, 115, 116, 117), uint4(118, 121, 122, 123),
+	uint4(81, 82, 87, 93), uint4(106, 107, 108, 111), uint4(112, 113, 116, 117), uint4(118, 119, 123, 124),
+	uint4(58, 59, 83, 84), uint4(88, 89, 93, 94), uint4(107, 108, 109, 113), uint4(114, 118, 119, 124),
+	uint4(45, 60, 65, 70), uint4(85, 90, 91, 95), uint4(96, 105, 110, 115), uint4(116, 120, 121, 122),
+	uint4(66, 71, 90, 91), uint4(92, 95, 96, 97), uint4(111, 115, 116, 117), uint4(120, 121, 122, 123),
+	uint4(66, 71, 91, 92), uint4(93, 96, 97, 98), uint4(111, 116, 117, 118), uint4(121, 122, 123, 124),
+	uint4(64, 69, 72, 73), uint4(74, 93, 94, 98), uint4(99, 112, 114, 118), uint4(119, 122, 123, 124),
+};
+static const float4 pseudo_inverse_wt_5x5x5[364] =
+{
+	float4(0.378917f, 0.175569f, -0.0277786f, 0.175569f), float4(0.177597f, -0.0257509f, -0.0277786f, -0.0257509f),
+	float4(0.175569f, 0.177597f, -0.0257509f, 0.177597f), float4(0.182668f, -0.0257509f, -0.0277786f, -0.0257509f),
+	float4(-0.0277786f, 0.16078f, 0.349339f, 0.157428f), float4(-0.0344835f, 0.164704f, 0.160119f, -0.0317925f),
+	float4(-0.0291015f, 0.164704f, 0.160119f, -0.0317925f), float4(0.166432f, 0.167035f, -0.0248761f, -0.0291015f),
+	float4(-0.0344835f, 0.242695f, 0.519873f, -0.0408666f), float4(0.236312f, -0.0472497f, -0.0213597f, -0.0408666f),
+	float4(0.236312f, -0.032242f, 0.244936f, -0.0386251f), float4(-0.0472497f, -0.0386251f, -0.0300006f, -0.0213597f),
+	float4(-0.0277786f, 0.16078f, 0.349339f, 0.164704f), float4(0.157428f, 0.160119f, -0.0344835f, -0.0317925f),
+	float4(-0.0291015f, 0.164704f, 0.166432f, 0.160119f), float4(0.167035f, -0.0317925f, -0.0248761f, -0.0291015f),
+	float4(-0.0237232f, 0.138181f, 0.140076f, 0.140076f), float4(0.300085f, 0.13884f, 0.13884f, 0.135042f),
+	float4(-0.0262032f, -0.0262032f, -0.0300006f, 0.14434f), float4(0.141014f, 0.141014f, 0.142408f, -0.0226347f),
+	float4(-0.0291015f, -0.0381756f, -0.0472497f, 0.195325f), float4(0.186251f, 0.198673f, 0.419751f, -0.0348278f),
+	float4(0.186251f, -0.0472497f, -0.0348278f, 0.198673f), float4(0.195325f, -0.0381756f, -0.0257537f, -0.0291015f),
+	float4(-0.0344835f, 0.242695f, -0.0408666f, 0.519873f), float4(0.236312f, -0.0472497f, -0.0213597f, -0.0408666f),
+	float4(-0.032242f, 0.236312f, 0.244936f, -0.0386251f), float4(-0.0472497f, -0.0386251f, -0.0300006f, -0.0213597f),
+	float4(-0.0291015f, -0.0257537f, -0.0381756f, 0.195325f), float4(0.198673f, -0.0348278f, -0.0472497f, 0.186251f),
+	float4(0.419751f, 0.186251f, -0.0472497f, -0.0348278f), float4(0.198673f, 0.195325f, -0.0381756f, -0.0291015f),
+	float4(-0.0213597f, -0.0300006f, -0.0386251f, -0.0472497f), float4(-0.0386251f, 0.244936f, 0.236312f, -0.0213597f),
+	float4(-0.0472497f, 0.236312f, 0.519873f, -0.032242f), float4(-0.0408666f, -0.0408666f, 0.242695f, -0.0344835f),
+	float4(-0.0277786f, 0.16078f, 0.349339f, 0.164704f), float4(0.164704f, 0.166432f, 0.157428f, 0.160119f),
+	float4(0.160119f, 0.167035f, -0.0344835f, -0.0317925f), float4(-0.0291015f, -0.0317925f, -0.0248761f, -0.0291015f),
+	float4(-0.0237232f, 0.138181f, 0.140076f, 0.140076f), float4(0.300085f, 0.13884f, 0.14434f, 0.141014f),
+	float4(0.13884f, 0.135042f, -0.0262032f, 0.141014f), float4(0.142408f, -0.0262032f, -0.0300006f, -0.0226347f),
+	float4(-0.0291015f, -0.0381756f, -0.0472497f, 0.195325f), float4(0.186251f, -0.0348278f, 0.198673f, 0.419751f),
+	float4(0.198673f, -0.0348278f, 0.186251f, -0.0257537f), float4(0.195325f, -0.0472497f, -0.0381756f, -0.0291015f),
+	float4(-0.0237232f, 0.138181f, 0.140076f, 0.140076f), float4(0.300085f, 0.14434f, 0.13884f, 0.141014f),
+	float4(0.13884f, 0.141014f, 0.135042f, 0.142408f), float4(-0.0262032f, -0.0262032f, -0.0300006f, -0.0226347f),
+	float4(-0.016475f, 0.109722f, 0.108275f, 0.108275f), float4(0.110809f, 0.108275f, 0.110809f, 0.110809f),
+	float4(0.233025f, 0.110809f, 0.110809f, 0.108275f), float4(0.110809f, 0.108275f, 0.108275f, 0.109722f),
+	float4(-0.0226347f, -0.0300006f, -0.0262032f, -0.0262032f), float4(0.142408f, 0.135042f, 0.141014f, 0.13884f),
+	float4(0.141014f, 0.13884f, 0.14434f, 0.300085f), float4(0.140076f, 0.140076f, 0.138181f, -0.0237232f),
+	float4(-0.0291015f, -0.0381756f, -0.0472497f, -0.0257537f), float4(0.195325f, 0.186251f, -0.0348278f, 0.198673f),
+	float4(0.419751f, 0.198673f, -0.0348278f, 0.186251f), float4(0.195325f, -0.0472497f, -0.0381756f, -0.0291015f),
+	float4(-0.0226347f, -0.0300006f, -0.0262032f, 0.142408f), float4(0.141014f, -0.0262032f, 0.135042f, 0.13884f),
+	float4(0.141014f, 0.14434f, 0.13884f, 0.300085f), float4(0.140076f, 0.140076f, 0.138181f, -0.0237232f),
+	float4(-0.0291015f, -0.0248761f, -0.0317925f, -0.0291015f), float4(-0.0317925f, -0.0344835f, 0.167035f, 0.160119f),
+	float4(0.160119f, 0.157428f, 0.166432f, 0.164704f), float4(0.164704f, 0.349339f, 0.16078f, -0.0277786f),
+	float4(-0.0344835f, 0.242695f, -0.0408666f, -0.0408666f), float4(-0.032242f, 0.519873f, 0.236312f, -0.0472497f),
+	float4(-0.0213597f, 0.236312f, 0.244936f, -0.0386251f), float4(-0.0472497f, -0.0386251f, -0.0300006f, -0.0213597f),
+	float4(-0.0291015f, -0.0381756f, 0.195325f, 0.198673f), float4(-0.0348278f, -0.0257537f, -0.0472497f, 0.186251f),
+	float4(0.419751f, 0.186251f, -0.0472497f, -0.0348278f), float4(0.198673f, 0.195325f, -0.0381756f, -0.0291015f),
+	float4(-0.0213597f, -0.0300006f, -0.0386251f, -0.0472497f), float4(-0.0386251f, 0.244936f, 0.236312f, -0.032242f),
+	float4(-0.0408666f, -0.0213597f, -0.0472497f, 0.236312f), float4(0.519873f, -0.0408666f, 0.242695f, -0.0344835f),
+	float4(-0.0291015f, -0.0381756f, 0.195325f, -0.0257537f), float4(0.198673f, -0.0348278f, -0.0472497f, 0.186251f),
+	float4(-0.0348278f, 0.419751f, 0.198673f, 0.186251f), float4(0.195325f, -0.0472497f, -0.0381756f, -0.0291015f),
+	float4(-0.0226347f, 0.142408f, 0.141014f, 0.141014f), float4(0.14434f, -0.0300006f, -0.0262032f, -0.0262032f),
+	float4(0.135042f, 0.13884f, 0.13884f, 0.300085f), float4(0.140076f, 0.140076f, 0.138181f, -0.0237232f),
+	float4(-0.0291015f, -0.0248761f, -0.0317925f, 0.167035f), float4(0.160119f, 0.166432f, 0.164704f, -0.0291015f),
+	float4(-0.0317925f, -0.0344835f, 0.160119f, 0.157428f), float4(0.164704f, 0.349339f, 0.16078f, -0.0277786f),
+	float4(-0.0213597f, -0.0300006f, -0.0386251f, -0.0472497f), float4(-0.0386251f, 0.244936f, -0.032242f, 0.236312f),
+	float4(-0.0408666f, -0.0213597f, -0.0472497f, 0.236312f), float4(-0.0408666f, 0.519873f, 0.242695f, -0.0344835f),
+	float4(-0.0291015f, -0.0248761f, 0.167035f, 0.166432f), float4(-0.0317925f, 0.160119f, 0.164704f, -0.0291015f),
+	float4(-0.0317925f, 0.160119f, 0.164704f, -0.0344835f), float4(0.157428f, 0.349339f, 0.16078f, -0.0277786f),
+	float4(-0.0257509f, -0.0257509f, -0.0277786f, -0.0257509f), float4(0.182668f, 0.177597f, 0.177597f, 0.175569f),
+	float4(-0.0257509f, -0.0277786f, -0.0257509f, 0.177597f), float4(0.175569f, -0.0277786f, 0.175569f, 0.378917f),
+	float4(0.82467f, 0.0949704f, -0.0609429f, 0.0949704f), float4(0.0949704f, -0.0563796f, -0.0609429f, -0.0563796f),
+	float4(-0.0609429f, 0.0949704f, 0.0949704f, 0.0949704f), float4(0.131499f, -0.0609429f, -0.0609429f, -0.0609429f),
+	float4(-0.148263f, 0.821075f, 0.448521f, -0.178538f), float4(-0.0634138f, 0.209665f, -0.123398f, -0.059169f),
+	float4(-0.0634138f, 0.209665f, -0.123398f, -0.0624425f), float4(0.220403f, -0.114632f, -0.059169f, -0.0541959f),
+	float4(-0.178765f, 0.449348f, 0.820273f, -0.156428f), float4(-0.123689f, 0.209978f, -0.0650008f, -0.0591764f),
+	float4(-0.123689f, 0.209978f, -0.0650008f, -0.115023f), float4(0.220528f, -0.0645613f, -0.0591764f, -0.0542247f),
+	float4(-0.0645719f, 0.107913f, 0.900934f, -0.0650113f), float4(0.0902191f, -0.0703175f, 0.0283602f, -0.0650113f),
+	float4(0.0902191f, -0.0645719f, 0.107913f, -0.0650113f), float4(-0.0703175f, -0.0650113f, -0.0645719f, 0.0283602f),
+	float4(-0.148263f, 0.821075f, -0.0634138f, 0.448521f), float4(0.209665f, -0.178538f, -0.123398f, -0.059169f),
+	float4(-0.0634138f, -0.0624425f, 0.209665f, 0.220403f), float4(-0.123398f, -0.114632f, -0.059169f, -0.0541959f),
+	float4(-0.148263f, -0.0634138f, -0.0634138f, 0.821075f), float4(0.209665f, -0.059169f, 0.209665f, 0.448521f),
+	float4(-0.123398f, -0.059169f, -0.123398f, -0.178538f), float4(-0.0624425f, 0.220403f, -0.0541959f, -0.114632f),
+	float4(-0.0925227f, -0.13545f, -0.0922257f, -0.0925227f), float4(0.617937f, 0.61717f, -0.0937703f, -0.13545f),
+	float4(0.61717f, -0.137761f, -0.0922257f, -0.0937703f), float4(-0.0595776f, 0.295445f, -0.0603381f, -0.0603381f),
+	float4(-0.0708986f, -0.180019f, -0.0604105f, 0.228551f), float4(0.873182f, -0.137935f, 0.461676f, 0.0283555f),
+	float4(-0.215827f, 0.0393843f, -0.0708986f, -0.0604105f), float4(0.228551f, -0.137935f, 0.0283555f, -0.0604105f),
+	float4(-0.178765f, 0.449348f, -0.123689f, 0.820273f), float4(0.209978f, -0.0591764f, -0.156428f, -0.0650008f),
+	float4(-0.123689f, -0.115023f, 0.209978f, 0.220528f), float4(-0.0650008f, -0.0645613f, -0.0591764f, -0.0542247f),
+	float4(-0.0925227f, -0.0925227f, -0.13545f, 0.617937f), float4(-0.13545f, -0.0922257f, 0.61717f, 0.61717f),
+	float4(-0.0922257f, -0.0937703f, -0.137761f, -0.0937703f), float4(-0.0595776f, 0.295445f, -0.0603381f, -0.0603381f),
+	float4(-0.178765f, -0.123689f, -0.0591764f, -0.123689f), float4(0.449348f, 0.209978f, -0.0591764f, 0.209978f),
+	float4(0.820273f, -0.0650008f, -0.0650008f, -0.156428f), float4(-0.115023f, -0.0542247f, 0.220528f, -0.0645613f),
+	float4(0.0283555f, 0.0393843f, -0.0604105f, -0.137935f), float4(-0.215827f, 0.228551f, 0.461676f, -0.0708986f),
+	float4(0.873182f, -0.180019f, 0.0283555f, -0.0604105f), float4(-0.137935f, 0.228551f, -0.0708986f, -0.0604105f),
+	float4(-0.0645719f, 0.107913f, -0.0650113f, 0.900934f), float4(0.0902191f, -0.0703175f, 0.0283602f, -0.0650113f),
+	float4(-0.0645719f, 0.0902191f, 0.107913f, -0.0650113f), float4(-0.0703175f, -0.0650113f, -0.0645719f, 0.0283602f),
+	float4(-0.0604105f, -0.0708986f, 0.228551f, -0.137935f), float4(0.0283555f, -0.180019f, 0.873182f, 0.461676f),
+	float4(-0.215827f, 0.0393843f, -0.0604105f, -0.0708986f), float4(0.228551f, -0.137935f, 0.0283555f, -0.0604105f),
+	float4(-0.0604105f, 0.0283555f, -0.137935f, 0.228551f), float4(-0.0708986f, 0.0393843f, -0.215827f, 0.461676f),
+	float4(0.873182f, -0.180019f, -0.0604105f, 0.0283555f), float4(-0.137935f, 0.228551f, -0.0708986f, -0.0604105f),
+	float4(0.0283602f, -0.0645719f, -0.0650113f, -0.0703175f), float4(-0.0650113f, 0.107913f, 0.0902191f, 0.0283602f),
+	float4(-0.0703175f, 0.0902191f, 0.900934f, -0.0645719f), float4(-0.0650113f, -0.0650113f, 0.107913f, -0.0645719f),
+	float4(-0.148263f, 0.821075f, -0.0634138f, -0.0634138f), float4(-0.0624425f, 0.448521f, 0.209665f, 0.209665f),
+	float4(0.220403f, -0.178538f, -0.123398f, -0.059169f), float4(-0.123398f, -0.114632f, -0.0541959f, -0.059169f),
+	float4(-0.148263f, -0.0634138f, -0.0634138f, 0.821075f), float4(0.209665f, -0.059169f, -0.0624425f, 0.209665f),
+	float4(0.448521f, -0.123398f, 0.220403f, -0.059169f), float4(-0.123398f, -0.178538f, -0.0541959f, -0.114632f),
+	float4(-0.0925227f, -0.13545f, -0.0922257f, -0.0925227f), float4(0.617937f, 0.61717f, -0.0937703f, -0.0595776f),
+	float4(-0.13545f, 0.61717f, -0.137761f, 0.295445f), float4(-0.0603381f, -0.0922257f, -0.0937703f, -0.0603381f),
+	float4(-0.0708986f, -0.180019f, -0.0604105f, 0.228551f), float4(0.873182f, -0.0708986f, -0.137935f, 0.461676f),
+	float4(-0.0604105f, 0.228551f, 0.0283555f, -0.215827f), float4(-0.137935f, -0.0604105f, 0.0393843f, 0.0283555f),
+	float4(-0.148263f, -0.0634138f, -0.0634138f, 0.821075f), float4(-0.0624425f, 0.209665f, -0.059169f, 0.209665f),
+	float4(0.448521f, 0.220403f, -0.123398f, -0.0541959f), float4(-0.059169f, -0.123398f, -0.178538f, -0.114632f),
+	float4(-0.099558f, 0.69983f, 0.179229f, 0.179229f), float4(0.179229f, 0.179229f, 0.179229f, 0.179229f),
+	float4(0.412567f, -0.0854202f, -0.0854202f, -0.0854202f), float4(-0.0854202f, -0.0854202f, -0.0854202f, -0.104204f),
+	float4(-0.079933f, -0.114632f, -0.0793502f, -0.0541959f), float4(-0.074983f, 0.577456f, 0.575543f, -0.0793502f),
+	float4(0.269546f, 0.269546f, -0.10777f, 0.577456f), float4(-0.114632f, -0.0541959f, -0.074983f, -0.079933f),
+	float4(-0.0645613f, -0.156428f, -0.0650008f, -0.0650008f), float4(0.220528f, 0.820273f, -0.0542247f, 0.209978f),
+	float4(-0.0591764f, 0.209978f, -0.115023f, 0.449348f), float4(-0.123689f, -0.0591764f, -0.123689f, -0.178765f),
+	float4(-0.0925227f, -0.13545f, -0.0922257f, -0.0925227f), float4(0.617937f, -0.0595776f, 0.61717f, -0.0937703f),
+	float4(-0.13545f, 0.61717f, 0.295445f, -0.137761f), float4(-0.0603381f, -0.0922257f, -0.0937703f, -0.0603381f),
+	float4(-0.079933f, -0.114632f, -0.0793502f, -0.074983f), float4(-0.0541959f, 0.577456f, 0.575543f, 0.269546f),
+	float4(-0.0793502f, -0.10777f, 0.269546f, 0.577456f), float4(-0.114632f, -0.074983f, -0.0541959f, -0.079933f),
+	float4(-0.079933f, -0.114632f, -0.0793502f, -0.074983f), float4(0.577456f, 0.269546f, 0.269546f, 0.575543f),
+	float4(-0.0793502f, -0.10777f, 0.577456f, -0.0541959f), float4(-0.0541959f, -0.114632f, -0.074983f, -0.079933f),
+	float4(-0.0603381f, -0.0937703f, -0.0603381f, -0.137761f), float4(-0.0937703f, -0.0922257f, 0.295445f, 0.61717f),
+	float4(0.61717f, -0.0922257f, -0.0595776f, -0.13545f), float4(0.617937f, -0.13545f, -0.0925227f, -0.0925227f),
+	float4(-0.0708986f, -0.180019f, -0.0604105f, 0.228551f), float4(0.873182f, -0.0708986f, -0.137935f, -0.0604105f),
+	float4(0.461676f, 0.228551f, 0.0283555f, -0.215827f), float4(-0.137935f, -0.0604105f, 0.0393843f, 0.0283555f),
+	float4(-0.0645613f, -0.156428f, -0.0650008f, 0.220528f), float4(-0.0650008f, 0.820273f, 0.209978f, -0.0591764f),
+	float4(-0.0542247f, -0.115023f, 0.209978f, 0.449348f), float4(-0.123689f, -0.0591764f, -0.123689f, -0.178765f),
+	float4(-0.0603381f, -0.0603381f, -0.0937703f, -0.137761f), float4(-0.0937703f, 0.295445f, -0.0922257f, 0.61717f),
+	float4(0.61717f, -0.0922257f, -0.0595776f, -0.13545f), float4(0.617937f, -0.13545f, -0.0925227f, -0.0925227f),
+	float4(-0.0645613f, -0.0650008f, -0.0650008f, -0.156428f), float4(-0.0542247f, -0.0591764f, 0.220528f, 0.209978f),
+	float4(-0.0591764f, 0.209978f, 0.820273f, -0.115023f), float4(-0.123689f, -0.123689f, 0.449348f, -0.178765f),
+	float4(-0.178765f, 0.449348f, -0.123689f, -0.123689f), float4(-0.115023f, 0.820273f, 0.209978f, -0.0591764f),
+	float4(0.209978f, 0.220528f, -0.0542247f, -0.0591764f), float4(-0.156428f, -0.0650008f, -0.0650008f, -0.0645613f),
+	float4(-0.0925227f, -0.0925227f, -0.13545f, 0.617937f), float4(-0.13545f, -0.0595776f, -0.0922257f, 0.61717f),
+	float4(0.61717f, -0.0922257f, 0.295445f, -0.0937703f), float4(-0.137761f, -0.0937703f, -0.0603381f, -0.0603381f),
+	float4(-0.178765f, -0.123689f, -0.0591764f, -0.123689f), float4(0.449348f, 0.209978f, -0.115023f, -0.0542247f),
+	float4(-0.0591764f, 0.209978f, 0.820273f, -0.0650008f), float4(0.220528f, -0.0650008f, -0.156428f, -0.0645613f),
+	float4(0.0283555f, 0.0393843f, -0.0604105f, -0.137935f), float4(-0.215827f, 0.0283555f, 0.228551f, 0.461676f),
+	float4(-0.0604105f, -0.137935f, -0.0708986f, 0.873182f), float4(0.228551f, -0.0604105f, -0.180019f, -0.0708986f),
+	float4(-0.0925227f, -0.0925227f, -0.13545f, 0.617937f), float4(-0.0595776f, -0.13545f, -0.0922257f, 0.61717f),
+	float4(0.61717f, 0.295445f, -0.0922257f, -0.0937703f), float4(-0.137761f, -0.0603381f, -0.0937703f, -0.0603381f),
+	float4(-0.079933f, -0.074983f, -0.114632f, -0.0541959f), float4(0.577456f, -0.10777f, -0.0793502f, 0.575543f),
+	float4(0.269546f, 0.269546f, 0.577456f, -0.074983f), float4(-0.0793502f, -0.114632f, -0.0541959f, -0.079933f),
+	float4(-0.079933f, -0.0541959f, -0.074983f, -0.0541959f), float4(-0.114632f, 0.577456f, 0.269546f, -0.10777f),
+	float4(-0.0793502f, 0.269546f, 0.575543f, 0.577456f), float4(-0.074983f, -0.0793502f, -0.114632f, -0.079933f),
+	float4(-0.0603381f, -0.0937703f, -0.0922257f, -0.0603381f), float4(-0.137761f, 0.295445f, 0.61717f, -0.13545f),
+	float4(-0.0937703f, 0.61717f, -0.0595776f, 0.617937f), float4(-0.0925227f, -0.0922257f, -0.13545f, -0.0925227f),
+	float4(-0.178765f, -0.123689f, -0.0591764f, -0.123689f), float4(0.449348f, -0.115023f, 0.209978f, -0.0591764f),
+	float4(0.209978f, -0.0542247f, 0.820273f, 0.220528f), float4(-0.0650008f, -0.0650008f, -0.156428f, -0.0645613f),
+	float4(-0.079933f, -0.074983f, -0.0541959f, -0.114632f), float4(0.577456f, -0.10777f, 0.269546f, 0.269546f),
+	float4(-0.0793502f, 0.575543f, 0.577456f, -0.074983f), float4(-0.0541959f, -0.0793502f, -0.114632f, -0.079933f),
+	float4(-0.104204f, -0.0854202f, -0.0854202f, -0.0854202f), float4(-0.0854202f, -0.0854202f, -0.0854202f, 0.412567f),
+	float4(0.179229f, 0.179229f, 0.179229f, 0.179229f), float4(0.179229f, 0.179229f, 0.69983f, -0.099558f),
+	float4(-0.114632f, -0.178538f, -0.0541959f, -0.123398f), float4(-0.059169f, -0.123398f, 0.220403f, 0.448521f),
+	float4(0.209665f, -0.059169f, 0.209665f, -0.0624425f), float4(0.821075f, -0.0634138f, -0.0634138f, -0.148263f),
+	float4(0.0283555f, 0.0393843f, -0.0604105f, -0.137935f), float4(-0.215827f, 0.0283555f, 0.228551f, -0.0604105f),
+	float4(0.461676f, -0.137935f, -0.0708986f, 0.873182f), float4(0.228551f, -0.0604105f, -0.180019f, -0.0708986f),
+	float4(-0.0603381f, -0.0937703f, -0.0922257f, -0.0603381f), float4(0.295445f, -0.0595776f, -0.137761f, 0.61717f),
+	float4(-0.13545f, -0.0937703f, 0.61717f, 0.617937f), float4(-0.0925227f, -0.0922257f, -0.13545f, -0.0925227f),
+	float4(-0.114632f, -0.0541959f, -0.178538f, -0.123398f), float4(-0.059169f, 0.220403f, -0.123398f, 0.448521f),
+	float4(0.209665f, -0.0624425f, -0.059169f, 0.209665f), float4(0.821075f, -0.0634138f, -0.0634138f, -0.148263f),
+	float4(-0.0541959f, -0.059169f, -0.114632f, -0.123398f), float4(-0.059169f, -0.123398f, -0.178538f, 0.220403f),
+	float4(0.209665f, 0.209665f, 0.448521f, -0.0624425f), float4(-0.0634138f, -0.0634138f, 0.821075f, -0.148263f),
+	float4(-0.0645719f, 0.107913f, -0.0650113f, -0.0650113f), float4(-0.0645719f, 0.900934f, 0.0902191f, -0.0703175f),
+	float4(0.0283602f, 0.0902191f, 0.107913f, -0.0650113f), float4(-0.0703175f, -0.0650113f, -0.0645719f, 0.0283602f),
+	float4(-0.0604105f, -0.0708986f, 0.228551f, -0.137935f), float4(0.0283555f, -0.0604105f, -0.180019f, 0.873182f),
+	float4(0.461676f, -0.215827f, 0.0393843f, -0.0708986f), float4(0.228551f, -0.137935f, 0.0283555f, -0.0604105f),
+	float4(-0.0604105f, 0.0283555f, -0.137935f, 0.228551f), float4(-0.0708986f, -0.0604105f, 0.0393843f, -0.215827f),
+	float4(0.461676f, 0.873182f, -0.180019f, 0.0283555f), float4(-0.137935f, 0.228551f, -0.0708986f, -0.0604105f),
+	float4(0.0283602f, -0.0645719f, -0.0650113f, -0.0703175f), float4(-0.0650113f, 0.107913f, 0.0902191f, -0.0645719f),
+	float4(-0.0650113f, 0.0283602f, -0.0703175f, 0.0902191f), float4(0.900934f, -0.0650113f, 0.107913f, -0.0645719f),
+	float4(-0.0604105f, -0.0708986f, 0.228551f, -0.137935f), float4(-0.0604105f, 0.0283555f, -0.180019f, 0.873182f),
+	float4(-0.0708986f, 0.461676f, 0.228551f, -0.215827f), float4(-0.137935f, -0.0604105f, 0.0393843f, 0.0283555f),
+	float4(-0.0645613f, 0.220528f, -0.0542247f, -0.115023f), float4(-0.156428f, -0.0650008f, -0.0650008f, 0.820273f),
+	float4(0.209978f, -0.0591764f, 0.209978f, 0.449348f), float4(-0.123689f, -0.0591764f, -0.123689f, -0.178765f),
+	float4(-0.0603381f, -0.0603381f, 0.295445f, -0.0595776f), float4(-0.0937703f, -0.137761f, -0.0937703f, -0.0922257f),
+	float4(0.61717f, 0.61717f, -0.0922257f, -0.13545f), float4(0.617937f, -0.13545f, -0.0925227f, -0.0925227f),
+	float4(-0.0542247f, -0.0591764f, -0.0645613f, -0.0650008f), float4(0.220528f, 0.209978f, -0.115023f, -0.123689f),
+	float4(-0.0650008f, -0.156428f, -0.0591764f, 0.209978f), float4(0.820273f, -0.123689f, 0.449348f, -0.178765f),
+	float4(-0.0604105f, 0.0283555f, -0.137935f, 0.228551f), float4(-0.0604105f, -0.0708986f, 0.0393843f, -0.215827f),
+	float4(0.0283555f, 0.461676f, -0.137935f, 0.873182f), float4(0.228551f, -0.0604105f, -0.180019f, -0.0708986f),
+	float4(-0.0603381f, -0.0603381f, 0.295445f, -0.0595776f), float4(-0.0937703f, -0.0922257f, -0.137761f, 0.61717f),
+	float4(-0.13545f, -0.0937703f, 0.61717f, 0.617937f), float4(-0.0925227f, -0.0922257f, -0.13545f, -0.0925227f),
+	float4(-0.114632f, -0.0541959f, 0.220403f, -0.0624425f), float4(-0.178538f, -0.123398f, -0.059169f, -0.123398f),
+	float4(0.448521f, 0.209665f, -0.059169f, 0.209665f), float4(0.821075f, -0.0634138f, -0.0634138f, -0.148263f),
+	float4(-0.0541959f, -0.059169f, -0.114632f, -0.123398f), float4(0.220403f, 0.209665f, -0.0624425f, -0.0634138f),
+	float4(-0.059169f, -0.123398f, -0.178538f, 0.209665f), float4(0.448521f, -0.0634138f, 0.821075f, -0.148263f),
+	float4(0.0283602f, -0.0645719f, -0.0650113f, -0.0703175f), float4(-0.0650113f, 0.107913f, -0.0645719f, 0.0902191f),
+	float4(-0.0650113f, 0.0283602f, -0.0703175f, 0.0902191f), float4(-0.0650113f, 0.900934f, 0.107913f, -0.0645719f),
+	float4(-0.0542247f, -0.0591764f, -0.0645613f, 0.220528f), float4(-0.115023f, -0.0650008f, 0.209978f, -0.123689f),
+	float4(-0.0591764f, -0.0650008f, 0.209978f, -0.123689f), float4(-0.156428f, 0.820273f, 0.449348f, -0.178765f),
+	float4(-0.0541959f, -0.059169f, -0.114632f, 0.220403f), float4(-0.0624425f, -0.123398f, 0.209665f, -0.0634138f),
+	float4(-0.059169f, -0.123398f, 0.209665f, -0.0634138f), float4(-0.178538f, 0.448521f, 0.821075f, -0.148263f),
+	float4(-0.0609429f, -0.0563796f, -0.0609429f, -0.0563796f), float4(-0.0609429f, 0.131499f, 0.0949704f, 0.0949704f),
+	float4(0.0949704f, -0.0609429f, -0.0609429f, 0.0949704f), float4(0.0949704f, -0.0609429f, 0.0949704f, 0.82467f),
+};
+
+#define WEIGHT_GRID_COUNT_6X6X6 2
+#define MAX_GRID_WEIGHTS_6X6X6 64
+static const uint4 weight_grids_6x6x6[WEIGHT_GRID_COUNT_6X6X6] = { uint4(3, 3, 0, 0), uint4(4, 4, 27, 216) };
+static const uint weight_grids_z_6x6x6[WEIGHT_GRID_COUNT_6X6X6] = { 3, 4 };
+static const uint4 decimation_idx_6x6x6[91] =
+{
+	uint4(0, 1, 6, 7), uint4(2, 3, 8, 9), uint4(5, 5, 11, 11), uint4(12, 13, 18, 19),
+	uint4(14, 15, 20, 21), uint4(17, 17, 23, 23), uint4(30, 31, 30, 31), uint4(32, 33, 32, 33),
+	uint4(35, 35, 35, 35), uint4(108, 109, 114, 115), uint4(110, 111, 116, 117), uint4(113, 113, 119, 119),
+	uint4(120, 121, 126, 127), uint4(122, 123, 128, 129), uint4(125, 125, 131, 131), uint4(138, 139, 138, 139),
+	uint4(140, 141, 140, 141), uint4(143, 143, 143, 143), uint4(180, 181, 186, 187), uint4(182, 183, 188, 189),
+	uint4(185, 185, 191, 191), uint4(192, 193, 198, 199), uint4(194, 195, 200, 201), uint4(197, 197, 203, 203),
+	uint4(210, 211, 210, 211), uint4(212, 213, 212, 213), uint4(215, 215, 215, 215), uint4(0, 1, 6, 7),
+	uint4(1, 2, 7, 8), uint4(3, 4, 9, 10), uint4(5, 5, 11, 11), uint4(6, 7, 12, 13),
+	uint4(7, 8, 13, 14), uint4(9, 10, 15, 16), uint4(11, 11, 17, 17), uint4(18, 19, 24, 25),
+	uint4(19, 20, 25, 26), uint4(21, 22, 27, 28), uint4(23, 23, 29, 29), uint4(30, 31, 30, 31),
+	uint4(31, 32, 31, 32), uint4(33, 34, 33, 34), uint4(35, 35, 35, 35), uint4(72, 73, 78, 79),
+	uint4(73, 74, 79, 80), uint4(75, 76, 81, 82), uint4(77, 77, 83, 83), uint4(78, 79, 84, 85),
+	uint4(79, 80, 85, 86), uint4(81, 82, 87, 88), uint4(83, 83, 89, 89), uint4(90, 91, 96, 97),
+	uint4(91, 92, 97, 98), uint4(93, 94, 99, 100), uint4(95, 95, 101, 101), uint4(102, 103, 102, 103),
+	uint4(103, 104, 103, 104), uint4(105, 106, 105, 106), uint4(107, 107, 107, 107), uint4(108, 109, 114, 115),
+	uint4(109, 110, 115, 116), uint4(111, 112, 117, 118), uint4(113, 113, 119, 119), uint4(114, 115, 120, 121),
+	uint4(115, 116, 121, 122), uint4(117, 118, 123, 124), uint4(119, 119, 125, 125), uint4(126, 127, 132, 133),
+	uint4(127, 128, 133, 134), uint4(129, 130, 135, 136), uint4(131, 131, 137, 137), uint4(138, 139, 138, 139),
+	uint4(139, 140, 139, 140), uint4(141, 142, 141, 142), uint4(143, 143, 143, 143), uint4(180, 181, 186, 187),
+	uint4(181, 182, 187, 188), uint4(183, 184, 189, 190), uint4(185, 185, 191, 191), uint4(186, 187, 192, 193),
+	uint4(187, 188, 193, 194), uint4(189, 190, 195, 196), uint4(191, 191, 197, 197), uint4(198, 199, 204, 205),
+	uint4(199, 200, 205, 206), uint4(201, 202, 207, 208), uint4(203, 203, 209, 209), uint4(210, 211, 210, 211),
+	uint4(211, 212, 211, 212), uint4(213, 214, 213, 214), uint4(215, 215, 215, 215),
+};
+static const float4 decimation_wt_6x6x6[91] =
+{
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.5f, 0.5f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.5f, 0.0f, 0.5f, 0.0f),
+	float4(0.25f, 0.25f, 0.25f, 0.25f), float4(0.5f, 0.0f, 0.5f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.5f, 0.5f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.5f, 0.5f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.5f, 0.0f, 0.5f, 0.0f), float4(0.25f, 0.25f, 0.25f, 0.25f),
+	float4(0.5f, 0.0f, 0.5f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.5f, 0.5f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.5f, 0.5f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.5f, 0.0f, 0.5f, 0.0f),
+	float4(0.25f, 0.25f, 0.25f, 0.25f), float4(0.5f, 0.0f, 0.5f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.5f, 0.5f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.333333373f, 0.666666627f, 0.0f, 0.0f), float4(0.666666746f, 0.333333254f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.333333373f, 0.0f, 0.666666627f, 0.0f),
+	float4(0.111111134f, 0.222222239f, 0.222222239f, 0.444444388f), float4(0.222222269f, 0.111111097f, 0.444444478f, 0.222222149f),
+	float4(0.333333373f, 0.0f, 0.666666627f, 0.0f), float4(0.666666746f, 0.0f, 0.333333254f, 0.0f),
+	float4(0.222222269f, 0.444444478f, 0.111111097f, 0.222222149f), float4(0.444444537f, 0.222222194f, 0.222222194f, 0.11111106f),
+	float4(0.666666746f, 0.0f, 0.333333254f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.333333373f, 0.666666627f, 0.0f, 0.0f), float4(0.666666746f, 0.333333254f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.333333373f, 0.666666627f, 0.0f, 0.0f), float4(0.666666746f, 0.333333254f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.333333373f, 0.0f, 0.666666627f, 0.0f),
+	float4(0.111111134f, 0.222222239f, 0.222222239f, 0.444444388f), float4(0.222222269f, 0.111111097f, 0.444444478f, 0.222222149f),
+	float4(0.333333373f, 0.0f, 0.666666627f, 0.0f), float4(0.666666746f, 0.0f, 0.333333254f, 0.0f),
+	float4(0.222222269f, 0.444444478f, 0.111111097f, 0.222222149f), float4(0.444444537f, 0.222222194f, 0.222222194f, 0.11111106f),
+	float4(0.666666746f, 0.0f, 0.333333254f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.333333373f, 0.666666627f, 0.0f, 0.0f), float4(0.666666746f, 0.333333254f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.333333373f, 0.666666627f, 0.0f, 0.0f), float4(0.666666746f, 0.333333254f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.333333373f, 0.0f, 0.666666627f, 0.0f),
+	float4(0.111111134f, 0.222222239f, 0.222222239f, 0.444444388f), float4(0.222222269f, 0.111111097f, 0.444444478f, 0.222222149f),
+	float4(0.333333373f, 0.0f, 0.666666627f, 0.0f), float4(0.666666746f, 0.0f, 0.333333254f, 0.0f),
+	float4(0.222222269f, 0.444444478f, 0.111111097f, 0.222222149f), float4(0.444444537f, 0.222222194f, 0.222222194f, 0.11111106f),
+	float4(0.666666746f, 0.0f, 0.333333254f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.333333373f, 0.666666627f, 0.0f, 0.0f), float4(0.666666746f, 0.333333254f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.333333373f, 0.666666627f, 0.0f, 0.0f), float4(0.666666746f, 0.333333254f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.333333373f, 0.0f, 0.666666627f, 0.0f),
+	float4(0.111111134f, 0.222222239f, 0.222222239f, 0.444444388f), float4(0.222222269f, 0.111111097f, 0.444444478f, 0.222222149f),
+	float4(0.333333373f, 0.0f, 0.666666627f, 0.0f), float4(0.666666746f, 0.0f, 0.333333254f, 0.0f),
+	float4(0.222222269f, 0.444444478f, 0.111111097f, 0.222222149f), float4(0.444444537f, 0.222222194f, 0.222222194f, 0.11111106f),
+	float4(0.666666746f, 0.0f, 0.333333254f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.333333373f, 0.666666627f, 0.0f, 0.0f), float4(0.666666746f, 0.333333254f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f),
+};
+static const uint4 infill_idx_6x6x6[432] =
+{
+	uint4(0, 0, 0, 0), uint4(0, 1, 0, 0), uint4(0, 1, 0, 0), uint4(1, 2, 1, 1),
+	uint4(1, 2, 1, 1), uint4(2, 2, 2, 2), uint4(0, 3, 0, 0), uint4(0, 0, 4, 0),
+	uint4(0, 1, 4, 0), uint4(1, 4, 5, 1), uint4(1, 2, 5, 1), uint4(2, 5, 2, 2),
+	uint4(0, 3, 0, 0), uint4(0, 3, 4, 0), uint4(0, 0, 4, 0), uint4(1, 4, 5, 1),
+	uint4(1, 4, 5, 1), uint4(2, 5, 2, 2), uint4(3, 6, 3, 3), uint4(3, 4, 7, 3),
+	uint4(3, 4, 7, 3), uint4(4, 4, 8, 4), uint4(4, 5, 8, 4), uint4(5, 8, 5, 5),
+	uint4(3, 6, 3, 3), uint4(3, 6, 7, 3), uint4(3, 4, 7, 3), uint4(4, 7, 8, 4),
+	uint4(4, 4, 8, 4), uint4(5, 8, 5, 5), uint4(6, 6, 6, 6), uint4(6, 7, 6, 6),
+	uint4(6, 7, 6, 6), uint4(7, 8, 7, 7), uint4(7, 8, 7, 7), uint4(8, 8, 8, 8),
+	uint4(0, 9, 0, 0), uint4(0, 0, 10, 0), uint4(0, 1, 10, 0), uint4(1, 10, 11, 1),
+	uint4(1, 2, 11, 1), uint4(2, 11, 2, 2), uint4(0, 0, 12, 0), uint4(0, 0, 0, 13),
+	uint4(0, 1, 0, 13), uint4(1, 1, 13, 14), uint4(1, 2, 1, 14), uint4(2, 2, 14, 2),
+	uint4(0, 3, 12, 0), uint4(0, 3, 0, 13), uint4(0, 0, 4, 13), uint4(1, 4, 13, 14),
+	uint4(1, 4, 5, 14), uint4(2, 5, 14, 2), uint4(3, 12, 15, 3), uint4(3, 3, 13, 16),
+	uint4(3, 4, 13, 16), uint4(4, 13, 4, 17), uint4(4, 5, 14, 17), uint4(5, 14, 17, 5),
+	uint4(3, 6, 15, 3), uint4(3, 6, 3, 16), uint4(3, 4, 7, 16), uint4(4, 7, 16, 17),
+	uint4(4, 4, 8, 17), uint4(5, 8, 17, 5), uint4(6, 15, 6, 6), uint4(6, 6, 16, 6),
+	uint4(6, 7, 16, 6), uint4(7, 16, 17, 7), uint4(7, 8, 17, 7), uint4(8, 17, 8, 8),
+	uint4(0, 9, 0, 0), uint4(0, 9, 10, 0), uint4(0, 0, 10, 0), uint4(1, 10, 11, 1),
+	uint4(1, 10, 11, 1), uint4(2, 11, 2, 2), uint4(0, 9, 12, 0), uint4(0, 9, 0, 13),
+	uint4(0, 0, 10, 13), uint4(1, 10, 13, 14), uint4(1, 10, 11, 14), uint4(2, 11, 14, 2),
+	uint4(0, 0, 12, 0), uint4(0, 0, 12, 13), uint4(0, 0, 0, 13), uint4(1, 1, 13, 14),
+	uint4(1, 1, 13, 14), uint4(2, 2, 14, 2), uint4(3, 12, 15, 3), uint4(3, 12, 13, 16),
+	uint4(3, 3, 13, 16), uint4(4, 13, 4, 17), uint4(4, 13, 14, 17), uint4(5, 14, 17, 5),
+	uint4(3, 12, 15, 3), uint4(3, 12, 15, 16), uint4(3, 3, 13, 16), uint4(4, 13, 16, 17),
+	uint4(4, 13, 4, 17), uint4(5, 14, 17, 5), uint4(6, 15, 6, 6), uint4(6, 15, 16, 6),
+	uint4(6, 6, 16, 6), uint4(7, 16, 17, 7), uint4(7, 16, 17, 7), uint4(8, 17, 8, 8),
+	uint4(9, 18, 9, 9), uint4(9, 10, 19, 9), uint4(9, 10, 19, 9), uint4(10, 10, 20, 10),
+	uint4(10, 11, 20, 10), uint4(11, 20, 11, 11), uint4(9, 12, 21, 9), uint4(9, 9, 13, 22),
+	uint4(9, 10, 13, 22), uint4(10, 13, 10, 23), uint4(10, 11, 14, 23), uint4(11, 14, 23, 11),
+	uint4(9, 12, 21, 9), uint4(9, 12, 13, 22), uint4(9, 9, 13, 22), uint4(10, 13, 10, 23),
+	uint4(10, 13, 14, 23), uint4(11, 14, 23, 11), uint4(12, 12, 24, 12), uint4(12, 13, 12, 25),
+	uint4(12, 13, 12, 25), uint4(13, 13, 13, 26), uint4(13, 14, 13, 26), uint4(14, 14, 26, 14),
+	uint4(12, 15, 24, 12), uint4(12, 15, 16, 25), uint4(12, 13, 16, 25), uint4(13, 16, 13, 26),
+	uint4(13, 13, 17, 26), uint4(14, 17, 26, 14), uint4(15, 24, 15, 15), uint4(15, 16, 25, 15),
+	uint4(15, 16, 25, 15), uint4(16, 16, 26, 16), uint4(16, 17, 26, 16), uint4(17, 26, 17, 17),
+	uint4(9, 18, 9, 9), uint4(9, 18, 19, 9), uint4(9, 10, 19, 9), uint4(10, 19, 20, 10),
+	uint4(10, 10, 20, 10), uint4(11, 20, 11, 11), uint4(9, 18, 21, 9), uint4(9, 18, 9, 22),
+	uint4(9, 10, 19, 22), uint4(10, 19, 22, 23), uint4(10, 10, 20, 23), uint4(11, 20, 23, 11),
+	uint4(9, 12, 21, 9), uint4(9, 12, 21, 22), uint4(9, 9, 13, 22), uint4(10, 13, 22, 23),
+	uint4(10, 13, 10, 23), uint4(11, 14, 23, 11), uint4(12, 21, 24, 12), uint4(12, 21, 22, 25),
+	uint4(12, 13, 22, 25), uint4(13, 22, 13, 26), uint4(13, 13, 23, 26), uint4(14, 23, 26, 14),
+	uint4(12, 12, 24, 12), uint4(12, 12, 24, 25), uint4(12, 13, 12, 25), uint4(13, 13, 25, 26),
+	uint4(13, 13, 13, 26), uint4(14, 14, 26, 14), uint4(15, 24, 15, 15), uint4(15, 24, 25, 15),
+	uint4(15, 16, 25, 15), uint4(16, 25, 26, 16), uint4(16, 16, 26, 16), uint4(17, 26, 17, 17),
+	uint4(18, 18, 18, 18), uint4(18, 19, 18, 18), uint4(18, 19, 18, 18), uint4(19, 20, 19, 19),
+	uint4(19, 20, 19, 19), uint4(20, 20, 20, 20), uint4(18, 21, 18, 18), uint4(18, 18, 22, 18),
+	uint4(18, 19, 22, 18), uint4(19, 22, 23, 19), uint4(19, 20, 23, 19), uint4(20, 23, 20, 20),
+	uint4(18, 21, 18, 18), uint4(18, 21, 22, 18), uint4(18, 18, 22, 18), uint4(19, 22, 23, 19),
+	uint4(19, 22, 23, 19), uint4(20, 23, 20, 20), uint4(21, 24, 21, 21), uint4(21, 22, 25, 21),
+	uint4(21, 22, 25, 21), uint4(22, 22, 26, 22), uint4(22, 23, 26, 22), uint4(23, 26, 23, 23),
+	uint4(21, 24, 21, 21), uint4(21, 24, 25, 21), uint4(21, 22, 25, 21), uint4(22, 25, 26, 22),
+	uint4(22, 22, 26, 22), uint4(23, 26, 23, 23), uint4(24, 24, 24, 24), uint4(24, 25, 24, 24),
+	uint4(24, 25, 24, 24), uint4(25, 26, 25, 25), uint4(25, 26, 25, 25), uint4(26, 26, 26, 26),
+	uint4(0, 0, 0, 0), uint4(0, 1, 0, 0), uint4(1, 2, 1, 1), uint4(1, 2, 1, 1),
+	uint4(2, 3, 2, 2), uint4(3, 3, 3, 3), uint4(0, 4, 0, 0), uint4(0, 0, 5, 0),
+	uint4(1, 5, 6, 1), uint4(1, 2, 6, 1), uint4(2, 6, 7, 2), uint4(3, 7, 3, 3),
+	uint4(4, 8, 4, 4), uint4(4, 5, 9, 4), uint4(5, 5, 10, 5), uint4(5, 6, 10, 5),
+	uint4(6, 7, 11, 6), uint4(7, 11, 7, 7), uint4(4, 8, 4, 4), uint4(4, 8, 9, 4),
+	uint4(5, 9, 10, 5), uint4(5, 5, 10, 5), uint4(6, 10, 11, 6), uint4(7, 11, 7, 7),
+	uint4(8, 12, 8, 8), uint4(8, 9, 13, 8), uint4(9, 13, 14, 9), uint4(9, 10, 14, 9),
+	uint4(10, 10, 15, 10), uint4(11, 15, 11, 11), uint4(12, 12, 12, 12), uint4(12, 13, 12, 12),
+	uint4(13, 14, 13, 13), uint4(13, 14, 13, 13), uint4(14, 15, 14, 14), uint4(15, 15, 15, 15),
+	uint4(0, 16, 0, 0), uint4(0, 0, 17, 0), uint4(1, 17, 18, 1), uint4(1, 2, 18, 1),
+	uint4(2, 18, 19, 2), uint4(3, 19, 3, 3), uint4(0, 0, 20, 0), uint4(0, 0, 0, 21),
+	uint4(1, 1, 21, 22), uint4(1, 2, 1, 22), uint4(2, 2, 22, 23), uint4(3, 3, 23, 3),
+	uint4(4, 20, 24, 4), uint4(4, 4, 21, 25), uint4(5, 21, 5, 26), uint4(5, 6, 22, 26),
+	uint4(6, 22, 23, 27), uint4(7, 23, 27, 7), uint4(4, 8, 24, 4), uint4(4, 8, 4, 25),
+	uint4(5, 9, 25, 26), uint4(5, 5, 10, 26), uint4(6, 10, 26, 27), uint4(7, 11, 27, 7),
+	uint4(8, 24, 28, 8), uint4(8, 8, 25, 29), uint4(9, 25, 29, 30), uint4(9, 10, 26, 30),
+	uint4(10, 26, 10, 31), uint4(11, 27, 31, 11), uint4(12, 28, 12, 12), uint4(12, 12, 29, 12),
+	uint4(13, 29, 30, 13), uint4(13, 14, 30, 13), uint4(14, 30, 31, 14), uint4(15, 31, 15, 15),
+	uint4(16, 32, 16, 16), uint4(16, 17, 33, 16), uint4(17, 17, 34, 17), uint4(17, 18, 34, 17),
+	uint4(18, 19, 35, 18), uint4(19, 35, 19, 19), uint4(16, 20, 36, 16), uint4(16, 16, 21, 37),
+	uint4(17, 21, 17, 38), uint4(17, 18, 22, 38), uint4(18, 22, 23, 39), uint4(19, 23, 39, 19),
+	uint4(20, 20, 40, 20), uint4(20, 21, 20, 41), uint4(21, 21, 21, 42), uint4(21, 22, 21, 42),
+	uint4(22, 23, 22, 43), uint4(23, 23, 43, 23), uint4(20, 24, 40, 20), uint4(20, 24, 25, 41),
+	uint4(21, 25, 21, 42), uint4(21, 21, 26, 42), uint4(22, 26, 27, 43), uint4(23, 27, 43, 23),
+	uint4(24, 28, 44, 24), uint4(24, 25, 29, 45), uint4(25, 29, 25, 46), uint4(25, 26, 30, 46),
+	uint4(26, 26, 31, 47), uint4(27, 31, 47, 27), uint4(28, 44, 28, 28), uint4(28, 29, 45, 28),
+	uint4(29, 29, 46, 29), uint4(29, 30, 46, 29), uint4(30, 31, 47, 30), uint4(31, 47, 31, 31),
+	uint4(16, 32, 16, 16), uint4(16, 32, 33, 16), uint4(17, 33, 34, 17), uint4(17, 17, 34, 17),
+	uint4(18, 34, 35, 18), uint4(19, 35, 19, 19), uint4(16, 32, 36, 16), uint4(16, 32, 16, 37),
+	uint4(17, 33, 37, 38), uint4(17, 17, 34, 38), uint4(18, 34, 38, 39), uint4(19, 35, 39, 19),
+	uint4(20, 36, 40, 20), uint4(20, 36, 37, 41), uint4(21, 37, 21, 42), uint4(21, 21, 38, 42),
+	uint4(22, 38, 39, 43), uint4(23, 39, 43, 23), uint4(20, 20, 40, 20), uint4(20, 20, 40, 41),
+	uint4(21, 21, 41, 42), uint4(21, 21, 21, 42), uint4(22, 22, 42, 43), uint4(23, 23, 43, 23),
+	uint4(24, 40, 44, 24), uint4(24, 40, 41, 45), uint4(25, 41, 45, 46), uint4(25, 25, 42, 46),
+	uint4(26, 42, 26, 47), uint4(27, 43, 47, 27), uint4(28, 44, 28, 28), uint4(28, 44, 45, 28),
+	uint4(29, 45, 46, 29), uint4(29, 29, 46, 29), uint4(30, 46, 47, 30), uint4(31, 47, 31, 31),
+	uint4(32, 48, 32, 32), uint4(32, 33, 49, 32), uint4(33, 49, 50, 33), uint4(33, 34, 50, 33),
+	uint4(34, 34, 51, 34), uint4(35, 51, 35, 35), uint4(32, 36, 52, 32), uint4(32, 32, 37, 53),
+	uint4(33, 37, 53, 54), uint4(33, 34, 38, 54), uint4(34, 38, 34, 55), uint4(35, 39, 55, 35),
+	uint4(36, 52, 56, 36), uint4(36, 37, 53, 57), uint4(37, 53, 37, 58), uint4(37, 38, 54, 58),
+	uint4(38, 38, 55, 59), uint4(39, 55, 59, 39), uint4(36, 40, 56, 36), uint4(36, 40, 41, 57),
+	uint4(37, 41, 57, 58), uint4(37, 37, 42, 58), uint4(38, 42, 38, 59), uint4(39, 43, 59, 39),
+	uint4(40, 40, 60, 40), uint4(40, 41, 40, 61), uint4(41, 41, 61, 62), uint4(41, 42, 41, 62),
+	uint4(42, 42, 42, 63), uint4(43, 43, 63, 43), uint4(44, 60, 44, 44), uint4(44, 45, 61, 44),
+	uint4(45, 61, 62, 45), uint4(45, 46, 62, 45), uint4(46, 46, 63, 46), uint4(47, 63, 47, 47),
+	uint4(48, 48, 48, 48), uint4(48, 49, 48, 48), uint4(49, 50, 49, 49), uint4(49, 50, 49, 49),
+	uint4(50, 51, 50, 50), uint4(51, 51, 51, 51), uint4(48, 52, 48, 48), uint4(48, 48, 53, 48),
+	uint4(49, 53, 54, 49), uint4(49, 50, 54, 49), uint4(50, 54, 55, 50), uint4(51, 55, 51, 51),
+	uint4(52, 56, 52, 52), uint4(52, 53, 57, 52), uint4(53, 53, 58, 53), uint4(53, 54, 58, 53),
+	uint4(54, 55, 59, 54), uint4(55, 59, 55, 55), uint4(52, 56, 52, 52), uint4(52, 56, 57, 52),
+	uint4(53, 57, 58, 53), uint4(53, 53, 58, 53), uint4(54, 58, 59, 54), uint4(55, 59, 55, 55),
+	uint4(56, 60, 56, 56), uint4(56, 57, 61, 56), uint4(57, 61, 62, 57), uint4(57, 58, 62, 57),
+	uint4(58, 58, 63, 58), uint4(59, 63, 59, 59), uint4(60, 60, 60, 60), uint4(60, 61, 60, 60),
+	uint4(61, 62, 61, 61), uint4(61, 62, 61, 61), uint4(62, 63, 62, 62), uint4(63, 63, 63, 63),
+};
+static const float4 infill_wt_6x6x6[432] =
+{
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.625f, 0.375f, 0.0f, 0.0f), float4(0.1875f, 0.8125f, 0.0f, 0.0f), float4(0.8125f, 0.1875f, 0.0f, 0.0f),
+	float4(0.375f, 0.625f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.625f, 0.375f, 0.0f, 0.0f), float4(0.625f, 0.0f, 0.375f, 0.0f),
+	float4(0.1875f, 0.4375f, 0.375f, 0.0f), float4(0.625f, 0.1875f, 0.1875f, 0.0f), float4(0.375f, 0.25f, 0.375f, 0.0f), float4(0.625f, 0.375f, 0.0f, 0.0f),
+	float4(0.1875f, 0.8125f, 0.0f, 0.0f), float4(0.1875f, 0.4375f, 0.375f, 0.0f), float4(0.1875f, 0.0f, 0.8125f, 0.0f), float4(0.1875f, 0.625f, 0.1875f, 0.0f),
+	float4(0.1875f, 0.1875f, 0.625f, 0.0f), float4(0.1875f, 0.8125f, 0.0f, 0.0f), float4(0.8125f, 0.1875f, 0.0f, 0.0f), float4(0.625f, 0.1875f, 0.1875f, 0.0f),
+	float4(0.1875f, 0.625f, 0.1875f, 0.0f), float4(0.8125f, 0.0f, 0.1875f, 0.0f), float4(0.375f, 0.4375f, 0.1875f, 0.0f), float4(0.8125f, 0.1875f, 0.0f, 0.0f),
+	float4(0.375f, 0.625f, 0.0f, 0.0f), float4(0.375f, 0.25f, 0.375f, 0.0f), float4(0.1875f, 0.1875f, 0.625f, 0.0f), float4(0.375f, 0.4375f, 0.1875f, 0.0f),
+	float4(0.375f, 0.0f, 0.625f, 0.0f), float4(0.375f, 0.625f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.625f, 0.375f, 0.0f, 0.0f),
+	float4(0.1875f, 0.8125f, 0.0f, 0.0f), float4(0.8125f, 0.1875f, 0.0f, 0.0f), float4(0.375f, 0.625f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.625f, 0.375f, 0.0f, 0.0f), float4(0.625f, 0.0f, 0.375f, 0.0f), float4(0.1875f, 0.4375f, 0.375f, 0.0f), float4(0.625f, 0.1875f, 0.1875f, 0.0f),
+	float4(0.375f, 0.25f, 0.375f, 0.0f), float4(0.625f, 0.375f, 0.0f, 0.0f), float4(0.625f, 0.0f, 0.375f, 0.0f), float4(0.625f, 0.0f, 0.0f, 0.375f),
+	float4(0.1875f, 0.4375f, 0.0f, 0.375f), float4(0.625f, 0.0f, 0.1875f, 0.1875f), float4(0.375f, 0.25f, 0.0f, 0.375f), float4(0.625f, 0.0f, 0.375f, 0.0f),
+	float4(0.1875f, 0.4375f, 0.375f, 0.0f), float4(0.1875f, 0.4375f, 0.0f, 0.375f), float4(0.1875f, 0.0f, 0.4375f, 0.375f), float4(0.1875f, 0.4375f, 0.1875f, 0.1875f),
+	float4(0.1875f, 0.1875f, 0.25f, 0.375f), float4(0.1875f, 0.4375f, 0.375f, 0.0f), float4(0.625f, 0.1875f, 0.1875f, 0.0f), float4(0.625f, 0.0f, 0.1875f, 0.1875f),
+	float4(0.1875f, 0.4375f, 0.1875f, 0.1875f), float4(0.625f, 0.1875f, 0.0f, 0.1875f), float4(0.375f, 0.25f, 0.1875f, 0.1875f), float4(0.625f, 0.1875f, 0.1875f, 0.0f),
+	float4(0.375f, 0.25f, 0.375f, 0.0f), float4(0.375f, 0.25f, 0.0f, 0.375f), float4(0.1875f, 0.1875f, 0.25f, 0.375f), float4(0.375f, 0.25f, 0.1875f, 0.1875f),
+	float4(0.375f, 0.0f, 0.25f, 0.375f), float4(0.375f, 0.25f, 0.375f, 0.0f), float4(0.625f, 0.375f, 0.0f, 0.0f), float4(0.625f, 0.0f, 0.375f, 0.0f),
+	float4(0.1875f, 0.4375f, 0.375f, 0.0f), float4(0.625f, 0.1875f, 0.1875f, 0.0f), float4(0.375f, 0.25f, 0.375f, 0.0f), float4(0.625f, 0.375f, 0.0f, 0.0f),
+	float4(0.1875f, 0.8125f, 0.0f, 0.0f), float4(0.1875f, 0.4375f, 0.375f, 0.0f), float4(0.1875f, 0.0f, 0.8125f, 0.0f), float4(0.1875f, 0.625f, 0.1875f, 0.0f),
+	float4(0.1875f, 0.1875f, 0.625f, 0.0f), float4(0.1875f, 0.8125f, 0.0f, 0.0f), float4(0.1875f, 0.4375f, 0.375f, 0.0f), float4(0.1875f, 0.4375f, 0.0f, 0.375f),
+	float4(0.1875f, 0.0f, 0.4375f, 0.375f), float4(0.1875f, 0.4375f, 0.1875f, 0.1875f), float4(0.1875f, 0.1875f, 0.25f, 0.375f), float4(0.1875f, 0.4375f, 0.375f, 0.0f),
+	float4(0.1875f, 0.0f, 0.8125f, 0.0f), float4(0.1875f, 0.0f, 0.4375f, 0.375f), float4(0.1875f, 0.0f, 0.0f, 0.8125f), float4(0.1875f, 0.0f, 0.625f, 0.1875f),
+	float4(0.1875f, 0.0f, 0.1875f, 0.625f), float4(0.1875f, 0.0f, 0.8125f, 0.0f), float4(0.1875f, 0.625f, 0.1875f, 0.0f), float4(0.1875f, 0.4375f, 0.1875f, 0.1875f),
+	float4(0.1875f, 0.0f, 0.625f, 0.1875f), float4(0.1875f, 0.625f, 0.0f, 0.1875f), float4(0.1875f, 0.1875f, 0.4375f, 0.1875f), float4(0.1875f, 0.625f, 0.1875f, 0.0f),
+	float4(0.1875f, 0.1875f, 0.625f, 0.0f), float4(0.1875f, 0.1875f, 0.25f, 0.375f), float4(0.1875f, 0.0f, 0.1875f, 0.625f), float4(0.1875f, 0.1875f, 0.4375f, 0.1875f),
+	float4(0.1875f, 0.1875f, 0.0f, 0.625f), float4(0.1875f, 0.1875f, 0.625f, 0.0f), float4(0.1875f, 0.8125f, 0.0f, 0.0f), float4(0.1875f, 0.4375f, 0.375f, 0.0f),
+	float4(0.1875f, 0.0f, 0.8125f, 0.0f), float4(0.1875f, 0.625f, 0.1875f, 0.0f), float4(0.1875f, 0.1875f, 0.625f, 0.0f), float4(0.1875f, 0.8125f, 0.0f, 0.0f),
+	float4(0.8125f, 0.1875f, 0.0f, 0.0f), float4(0.625f, 0.1875f, 0.1875f, 0.0f), float4(0.1875f, 0.625f, 0.1875f, 0.0f), float4(0.8125f, 0.0f, 0.1875f, 0.0f),
+	float4(0.375f, 0.4375f, 0.1875f, 0.0f), float4(0.8125f, 0.1875f, 0.0f, 0.0f), float4(0.625f, 0.1875f, 0.1875f, 0.0f), float4(0.625f, 0.0f, 0.1875f, 0.1875f),
+	float4(0.1875f, 0.4375f, 0.1875f, 0.1875f), float4(0.625f, 0.1875f, 0.0f, 0.1875f), float4(0.375f, 0.25f, 0.1875f, 0.1875f), float4(0.625f, 0.1875f, 0.1875f, 0.0f),
+	float4(0.1875f, 0.625f, 0.1875f, 0.0f), float4(0.1875f, 0.4375f, 0.1875f, 0.1875f), float4(0.1875f, 0.0f, 0.625f, 0.1875f), float4(0.1875f, 0.625f, 0.0f, 0.1875f),
+	float4(0.1875f, 0.1875f, 0.4375f, 0.1875f), float4(0.1875f, 0.625f, 0.1875f, 0.0f), float4(0.8125f, 0.0f, 0.1875f, 0.0f), float4(0.625f, 0.1875f, 0.0f, 0.1875f),
+	float4(0.1875f, 0.625f, 0.0f, 0.1875f), float4(0.8125f, 0.0f, 0.0f, 0.1875f), float4(0.375f, 0.4375f, 0.0f, 0.1875f), float4(0.8125f, 0.0f, 0.1875f, 0.0f),
+	float4(0.375f, 0.4375f, 0.1875f, 0.0f), float4(0.375f, 0.25f, 0.1875f, 0.1875f), float4(0.1875f, 0.1875f, 0.4375f, 0.1875f), float4(0.375f, 0.4375f, 0.0f, 0.1875f),
+	float4(0.375f, 0.0f, 0.4375f, 0.1875f), float4(0.375f, 0.4375f, 0.1875f, 0.0f), float4(0.8125f, 0.1875f, 0.0f, 0.0f), float4(0.625f, 0.1875f, 0.1875f, 0.0f),
+	float4(0.1875f, 0.625f, 0.1875f, 0.0f), float4(0.8125f, 0.0f, 0.1875f, 0.0f), float4(0.375f, 0.4375f, 0.1875f, 0.0f), float4(0.8125f, 0.1875f, 0.0f, 0.0f),
+	float4(0.375f, 0.625f, 0.0f, 0.0f), float4(0.375f, 0.25f, 0.375f, 0.0f), float4(0.1875f, 0.1875f, 0.625f, 0.0f), float4(0.375f, 0.4375f, 0.1875f, 0.0f),
+	float4(0.375f, 0.0f, 0.625f, 0.0f), float4(0.375f, 0.625f, 0.0f, 0.0f), float4(0.375f, 0.25f, 0.375f, 0.0f), float4(0.375f, 0.25f, 0.0f, 0.375f),
+	float4(0.1875f, 0.1875f, 0.25f, 0.375f), float4(0.375f, 0.25f, 0.1875f, 0.1875f), float4(0.375f, 0.0f, 0.25f, 0.375f), float4(0.375f, 0.25f, 0.375f, 0.0f),
+	float4(0.1875f, 0.1875f, 0.625f, 0.0f), float4(0.1875f, 0.1875f, 0.25f, 0.375f), float4(0.1875f, 0.0f, 0.1875f, 0.625f), float4(0.1875f, 0.1875f, 0.4375f, 0.1875f),
+	float4(0.1875f, 0.1875f, 0.0f, 0.625f), float4(0.1875f, 0.1875f, 0.625f, 0.0f), float4(0.375f, 0.4375f, 0.1875f, 0.0f), float4(0.375f, 0.25f, 0.1875f, 0.1875f),
+	float4(0.1875f, 0.1875f, 0.4375f, 0.1875f), float4(0.375f, 0.4375f, 0.0f, 0.1875f), float4(0.375f, 0.0f, 0.4375f, 0.1875f), float4(0.375f, 0.4375f, 0.1875f, 0.0f),
+	float4(0.375f, 0.0f, 0.625f, 0.0f), float4(0.375f, 0.0f, 0.25f, 0.375f), float4(0.1875f, 0.1875f, 0.0f, 0.625f), float4(0.375f, 0.0f, 0.4375f, 0.1875f),
+	float4(0.375f, 0.0f, 0.0f, 0.625f), float4(0.375f, 0.0f, 0.625f, 0.0f), float4(0.375f, 0.625f, 0.0f, 0.0f), float4(0.375f, 0.25f, 0.375f, 0.0f),
+	float4(0.1875f, 0.1875f, 0.625f, 0.0f), float4(0.375f, 0.4375f, 0.1875f, 0.0f), float4(0.375f, 0.0f, 0.625f, 0.0f), float4(0.375f, 0.625f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.625f, 0.375f, 0.0f, 0.0f), float4(0.1875f, 0.8125f, 0.0f, 0.0f), float4(0.8125f, 0.1875f, 0.0f, 0.0f),
+	float4(0.375f, 0.625f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.625f, 0.375f, 0.0f, 0.0f), float4(0.625f, 0.0f, 0.375f, 0.0f),
+	float4(0.1875f, 0.4375f, 0.375f, 0.0f), float4(0.625f, 0.1875f, 0.1875f, 0.0f), float4(0.375f, 0.25f, 0.375f, 0.0f), float4(0.625f, 0.375f, 0.0f, 0.0f),
+	float4(0.1875f, 0.8125f, 0.0f, 0.0f), float4(0.1875f, 0.4375f, 0.375f, 0.0f), float4(0.1875f, 0.0f, 0.8125f, 0.0f), float4(0.1875f, 0.625f, 0.1875f, 0.0f),
+	float4(0.1875f, 0.1875f, 0.625f, 0.0f), float4(0.1875f, 0.8125f, 0.0f, 0.0f), float4(0.8125f, 0.1875f, 0.0f, 0.0f), float4(0.625f, 0.1875f, 0.1875f, 0.0f),
+	float4(0.1875f, 0.625f, 0.1875f, 0.0f), float4(0.8125f, 0.0f, 0.1875f, 0.0f), float4(0.375f, 0.4375f, 0.1875f, 0.0f), float4(0.8125f, 0.1875f, 0.0f, 0.0f),
+	float4(0.375f, 0.625f, 0.0f, 0.0f), float4(0.375f, 0.25f, 0.375f, 0.0f), float4(0.1875f, 0.1875f, 0.625f, 0.0f), float4(0.375f, 0.4375f, 0.1875f, 0.0f),
+	float4(0.375f, 0.0f, 0.625f, 0.0f), float4(0.375f, 0.625f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.625f, 0.375f, 0.0f, 0.0f),
+	float4(0.1875f, 0.8125f, 0.0f, 0.0f), float4(0.8125f, 0.1875f, 0.0f, 0.0f), float4(0.375f, 0.625f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.375f, 0.625f, 0.0f, 0.0f), float4(0.8125f, 0.1875f, 0.0f, 0.0f), float4(0.1875f, 0.8125f, 0.0f, 0.0f),
+	float4(0.625f, 0.375f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.375f, 0.625f, 0.0f, 0.0f), float4(0.375f, 0.0f, 0.625f, 0.0f),
+	float4(0.375f, 0.4375f, 0.1875f, 0.0f), float4(0.1875f, 0.1875f, 0.625f, 0.0f), float4(0.375f, 0.25f, 0.375f, 0.0f), float4(0.375f, 0.625f, 0.0f, 0.0f),
+	float4(0.8125f, 0.1875f, 0.0f, 0.0f), float4(0.375f, 0.4375f, 0.1875f, 0.0f), float4(0.8125f, 0.0f, 0.1875f, 0.0f), float4(0.1875f, 0.625f, 0.1875f, 0.0f),
+	float4(0.625f, 0.1875f, 0.1875f, 0.0f), float4(0.8125f, 0.1875f, 0.0f, 0.0f), float4(0.1875f, 0.8125f, 0.0f, 0.0f), float4(0.1875f, 0.1875f, 0.625f, 0.0f),
+	float4(0.1875f, 0.625f, 0.1875f, 0.0f), float4(0.1875f, 0.0f, 0.8125f, 0.0f), float4(0.1875f, 0.4375f, 0.375f, 0.0f), float4(0.1875f, 0.8125f, 0.0f, 0.0f),
+	float4(0.625f, 0.375f, 0.0f, 0.0f), float4(0.375f, 0.25f, 0.375f, 0.0f), float4(0.625f, 0.1875f, 0.1875f, 0.0f), float4(0.1875f, 0.4375f, 0.375f, 0.0f),
+	float4(0.625f, 0.0f, 0.375f, 0.0f), float4(0.625f, 0.375f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.375f, 0.625f, 0.0f, 0.0f),
+	float4(0.8125f, 0.1875f, 0.0f, 0.0f), float4(0.1875f, 0.8125f, 0.0f, 0.0f), float4(0.625f, 0.375f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+	float4(0.375f, 0.625f, 0.0f, 0.0f), float4(0.375f, 0.0f, 0.625f, 0.0f), float4(0.375f, 0.4375f, 0.1875f, 0.0f), float4(0.1875f, 0.1875f, 0.625f, 0.0f),
+	float4(0.375f, 0.25f, 0.375f, 0.0f), float4(0.375f, 0.625f, 0.0f, 0.0f), float4(0.375f, 0.0f, 0.625f, 0.0f), float4(0.375f, 0.0f, 0.0f, 0.625f),
+	float4(0.375f, 0.0f, 0.4375f, 0.1875f), float4(0.1875f, 0.1875f, 0.0f, 0.625f), float4(0.375f, 0.0f, 0.25f, 0.375f), float4(0.375f, 0.0f, 0.625f, 0.0f),
+	float4(0.375f, 0.4375f, 0.1875f, 0.0f), float4(0.375f, 0.0f, 0.4375f, 0.1875f), float4(0.375f, 0.4375f, 0.0f, 0.1875f), float4(0.1875f, 0.1875f, 0.4375f, 0.1875f),
+	float4(0.375f, 0.25f, 0.1875f, 0.1875f), float4(0.375f, 0.4375f, 0.1875f, 0.0f), float4(0.1875f, 0.1875f, 0.625f, 0.0f), float4(0.1875f, 0.1875f, 0.0f, 0.625f),
+	float4(0.1875f, 0.1875f, 0.4375f, 0.1875f), float4(0.1875f, 0.0f, 0.1875f, 0.625f), float4(0.1875f, 0.1875f, 0.25f, 0.375f), float4(0.1875f, 0.1875f, 0.625f, 0.0f),
+	float4(0.375f, 0.25f, 0.375f, 0.0f), float4(0.375f, 0.0f, 0.25f, 0.375f), float4(0.375f, 0.25f, 0.1875f, 0.1875f), float4(0.1875f, 0.1875f, 0.25f, 0.375f),
+	float4(0.375f, 0.25f, 0.0f, 0.375f), float4(0.375f, 0.25f, 0.375f, 0.0f), float4(0.375f, 0.625f, 0.0f, 0.0f), float4(0.375f, 0.0f, 0.625f, 0.0f),
+	float4(0.375f, 0.4375f, 0.1875f, 0.0f), float4(0.1875f, 0.1875f, 0.625f, 0.0f), float4(0.375f, 0.25f, 0.375f, 0.0f), float4(0.375f, 0.625f, 0.0f, 0.0f),
+	float4(0.8125f, 0.1875f, 0.0f, 0.0f), float4(0.375f, 0.4375f, 0.1875f, 0.0f), float4(0.8125f, 0.0f, 0.1875f, 0.0f), float4(0.1875f, 0.625f, 0.1875f, 0.0f),
+	float4(0.625f, 0.1875f, 0.1875f, 0.0f), float4(0.8125f, 0.1875f, 0.0f, 0.0f), float4(0.375f, 0.4375f, 0.1875f, 0.0f), float4(0.375f, 0.0f, 0.4375f, 0.1875f),
+	float4(0.375f, 0.4375f, 0.0f, 0.1875f), float4(0.1875f, 0.1875f, 0.4375f, 0.1875f), float4(0.375f, 0.25f, 0.1875f, 0.1875f), float4(0.375f, 0.4375f, 0.1875f, 0.0f),
+	float4(0.8125f, 0.0f, 0.1875f, 0.0f), float4(0.375f, 0.4375f, 0.0f, 0.1875f), float4(0.8125f, 0.0f, 0.0f, 0.1875f), float4(0.1875f, 0.625f, 0.0f, 0.1875f),
+	float4(0.625f, 0.1875f, 0.0f, 0.1875f), float4(0.8125f, 0.0f, 0.1875f, 0.0f), float4(0.1875f, 0.625f, 0.1875f, 0.0f), float4(0.1875f, 0.1875f, 0.4375f, 0.1875f),
+	float4(0.1875f, 0.625f, 0.0f, 0.1875f), float4(0.1875f, 0.0f, 0.625f, 0.1875f), float4(0.1875f, 0.4375f, 0.1875f, 0.1875f), float4(0.1875f, 0.625f, 0.1875f, 0.0f),
+	float4(0.625f, 0.1875f, 0.1875f, 0.0f), float4(0.375f, 0.25f, 0.1875f, 0.1875f), float4(0.625f, 0.1875f, 0.0f, 0.1875f), float4(0.1875f, 0.4375f, 0.1875f, 0.1875f),
+	float4(0.625f, 0.0f, 0.1875f, 0.1875f), float4(0.625f, 0.1875f, 0.1875f, 0.0f), float4(0.8125f, 0.1875f, 0.0f, 0.0f), float4(0.375f, 0.4375f, 0.1875f, 0.0f),
+	float4(0.8125f, 0.0f, 0.1875f, 0.0f), float4(0.1875f, 0.625f, 0.1875f, 0.0f), float4(0.625f, 0.1875f, 0.1875f, 0.0f), float4(0.8125f, 0.1875f, 0.0f, 0.0f),
+	float4(0.1875f, 0.8125f, 0.0f, 0.0f), float4(0.1875f, 0.1875f, 0.625f, 0.0f), float4(0.1875f, 0.625f, 0.1875f, 0.0f), float4(0.1875f, 0.0f, 0.8125f, 0.0f),
+	float4(0.1875f, 0.4375f, 0.375f, 0.0f), float4(0.1875f, 0.8125f, 0.0f, 0.0f), float4(0.1875f, 0.1875f, 0.625f, 0.0f), float4(0.1875f, 0.1875f, 0.0f, 0.625f),
+	float4(0.1875f, 0.1875f, 0.4375f, 0.1875f), float4(0.1875f, 0.0f, 0.1875f, 0.625f), float4(0.1875f, 0.1875f, 0.25f, 0.375f), float4(0.1875f, 0.1875f, 0.625f, 0.0f),
+	float4(0.1875f, 0.625f, 0.1875f, 0.0f), float4(0.1875f, 0.1875f, 0.4375f, 0.1875f), float4(0.1875f, 0.625f, 0.0f, 0.1875f), float4(0.1875f, 0.0f, 0.625f, 0.1875f),
+	float4(0.1875f, 0.4375f, 0.1875f, 0.1875f), float4(0.1875f, 0.625f, 0.1875f, 0.0f), float4(0.1875f, 0.0f, 0.8125f, 0.0f), float4(0.1875f, 0.0f, 0.1875f, 0.625f),
+	float4(0.1875f, 0.0f, 0.625f, 0.1875f), float4(0.1875f, 0.0f, 0.0f, 0.8125f), float4(0.1875f, 0.0f, 0.4375f, 0.375f), float4(0.1875f, 0.0f, 0.8125f, 0.0f),
+	float4(0.1875f, 0.4375f, 0.375f, 0.0f), float4(0.1875f, 0.1875f, 0.25f, 0.375f), float4(0.1875f, 0.4375f, 0.1875f, 0.1875f), float4(0.1875f, 0.0f, 0.4375f, 0.375f),
+	float4(0.1875f, 0.4375f, 0.0f, 0.375f), float4(0.1875f, 0.4375f, 0.375f, 0.0f), float4(0.1875f, 0.8125f, 0.0f, 0.0f), float4(0.1875f, 0.1875f, 0.625f, 0.0f),
+	float4(0.1875f, 0.625f, 0.1875f, 0.0f), float4(0.1875f, 0.0f, 0.8125f, 0.0f), float4(0.1875f, 0.4375f, 0.375f, 0.0f), float4(0.1875f, 0.8125f, 0.0f, 0.0f),
+	float4(0.625f, 0.375f, 0.0f, 0.0f), float4(0.375f, 0.25f, 0.375f, 0.0f), float4(0.625f, 0.1875f, 0.1875f, 0.0f), float4(0.1875f, 0.4375f, 0.375f, 0.0f),
+	float4(0.625f, 0.0f, 0.375f, 0.0f), float4(0.625f, 0.375f, 0.0f, 0.0f), float4(0.375f, 0.25f, 0.375f, 0.0f), float4(0.375f, 0.0f, 0.25f, 0.375f),
+	float4(0.375f, 0.25f, 0.1875f, 0.1875f), float4(0.1875f, 0.1875f, 0.25f, 0.375f), float4(0.375f, 0.25f, 0.0f, 0.375f), float4(0.375f, 0.25f, 0.375f, 0.0f),
+	float4(0.625f, 0.1875f, 0.1875f, 0.0f), float4(0.375f, 0.25f, 0.1875f, 0.1875f), float4(0.625f, 0.1875f, 0.0f, 0.1875f), float4(0.1875f, 0.4375f, 0.1875f, 0.1875f),
+	float4(0.625f, 0.0f, 0.1875f, 0.1875f), float4(0.625f, 0.1875f, 0.1875f, 0.0f), float4(0.1875f, 0.4375f, 0.375f, 0.0f), float4(0.1875f, 0.1875f, 0.25f, 0.375f),
+	float4(0.1875f, 0.4375f, 0.1875f, 0.1875f), float4(0.1875f, 0.0f, 0.4375f, 0.375f), float4(0.1875f, 0.4375f, 0.0f, 0.375f), float4(0.1875f, 0.4375f, 0.375f, 0.0f),
+	float4(0.625f, 0.0f, 0.375f, 0.0f), float4(0.375f, 0.25f, 0.0f, 0.375f), float4(0.625f, 0.0f, 0.1875f, 0.1875f), float4(0.1875f, 0.4375f, 0.0f, 0.375f),
+	float4(0.625f, 0.0f, 0.0f, 0.375f), float4(0.625f, 0.0f, 0.375f, 0.0f), float4(0.625f, 0.375f, 0.0f, 0.0f), float4(0.375f, 0.25f, 0.375f, 0.0f),
+	float4(0.625f, 0.1875f, 0.1875f, 0.0f), float4(0.1875f, 0.4375f, 0.375f, 0.0f), float4(0.625f, 0.0f, 0.375f, 0.0f), float4(0.625f, 0.375f, 0.0f, 0.0f),
+	float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.375f, 0.625f, 0.0f, 0.0f), float4(0.8125f, 0.1875f, 0.0f, 0.0f), float4(0.1875f, 0.8125f, 0.0f, 0.0f),
+	float4(0.625f, 0.375f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.375f, 0.625f, 0.0f, 0.0f), float4(0.375f, 0.0f, 0.625f, 0.0f),
+	float4(0.375f, 0.4375f, 0.1875f, 0.0f), float4(0.1875f, 0.1875f, 0.625f, 0.0f), float4(0.375f, 0.25f, 0.375f, 0.0f), float4(0.375f, 0.625f, 0.0f, 0.0f),
+	float4(0.8125f, 0.1875f, 0.0f, 0.0f), float4(0.375f, 0.4375f, 0.1875f, 0.0f), float4(0.8125f, 0.0f, 0.1875f, 0.0f), float4(0.1875f, 0.625f, 0.1875f, 0.0f),
+	float4(0.625f, 0.1875f, 0.1875f, 0.0f), float4(0.8125f, 0.1875f, 0.0f, 0.0f), float4(0.1875f, 0.8125f, 0.0f, 0.0f), float4(0.1875f, 0.1875f, 0.625f, 0.0f),
+	float4(0.1875f, 0.625f, 0.1875f, 0.0f), float4(0.1875f, 0.0f, 0.8125f, 0.0f), float4(0.1875f, 0.4375f, 0.375f, 0.0f), float4(0.1875f, 0.8125f, 0.0f, 0.0f),
+	float4(0.625f, 0.375f, 0.0f, 0.0f), float4(0.375f, 0.25f, 0.375f, 0.0f), float4(0.625f, 0.1875f, 0.1875f, 0.0f), float4(0.1875f, 0.4375f, 0.375f, 0.0f),
+	float4(0.625f, 0.0f, 0.375f, 0.0f), float4(0.625f, 0.375f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f), float4(0.375f, 0.625f, 0.0f, 0.0f),
+	float4(0.8125f, 0.1875f, 0.0f, 0.0f), float4(0.1875f, 0.8125f, 0.0f, 0.0f), float4(0.625f, 0.375f, 0.0f, 0.0f), float4(1.0f, 0.0f, 0.0f, 0.0f),
+};
+static const uint4 pseudo_inverse_idx_6x6x6[364] =
+{
+	uint4(0, 1, 3, 6), uint4(7, 14, 36, 37), uint4(42, 43, 50, 74), uint4(80, 84, 85, 86),
+	uint4(1, 2, 3, 4), uint4(5, 8, 9, 10), uint4(11, 38, 39, 40), uint4(41, 44, 45, 46),
+	uint4(2, 4, 5, 10), uint4(11, 16, 23, 40), uint4(41, 46, 47, 59), uint4(76, 89, 113, 119),
+	uint4(6, 12, 13, 18), uint4(19, 24, 25, 30), uint4(31, 48, 49, 54), uint4(55, 60, 61, 66),
+	uint4(7, 8, 13, 14), uint4(15, 20, 21, 22), uint4(27, 50, 51, 56), uint4(57, 58, 63, 64),
+	uint4(5, 10, 11, 16), uint4(17, 22, 23, 28), uint4(29, 35, 47, 52), uint4(53, 58, 59, 65),
+	uint4(12, 24, 25, 26), uint4(30, 31, 33, 60), uint4(61, 66, 67, 69), uint4(96, 104, 138, 139),
+	uint4(25, 26, 27, 28), uint4(30, 31, 32, 33), uint4(34, 35, 62, 63), uint4(67, 68, 69, 70),
+	uint4(16, 17, 21, 26), uint4(28, 29, 32, 34), uint4(35, 59, 64, 65), uint4(69, 70, 71, 143),
+	uint4(36, 72, 73, 78), uint4(79, 108, 109, 114), uint4(115, 144, 145, 150), uint4(151, 180, 181, 186),
+	uint4(37, 38, 73, 74), uint4(75, 80, 81, 110), uint4(111, 112, 116, 117), uint4(118, 147, 153, 154),
+	uint4(5, 40, 41, 47), uint4(76, 77, 82, 83), uint4(112, 113, 118, 119), uint4(148, 149, 155, 185),
+	uint4(42, 48, 78, 84), uint4(85, 90, 91, 120), uint4(121, 126, 127, 132), uint4(133, 162, 163, 169),
+	uint4(44, 49, 50, 79), uint4(80, 86, 87, 92), uint4(93, 122, 123, 128), uint4(129, 136, 166, 171),
+	uint4(46, 52, 53, 82), uint4(83, 88, 89, 94), uint4(95, 124, 125, 130), uint4(131, 137, 167, 173),
+	uint4(30, 60, 66, 67), uint4(96, 97, 102, 103), uint4(132, 133, 138, 139), uint4(168, 174, 175, 210),
+	uint4(61, 62, 68, 97), uint4(98, 99, 103, 104), uint4(105, 134, 135, 140), uint4(141, 142, 177, 178),
+	uint4(29, 34, 35, 64), uint4(65, 70, 71, 100), uint4(101, 106, 107, 136), uint4(137, 142, 143, 179),
+	uint4(72, 144, 145, 146), uint4(150, 151, 156, 180), uint4(181, 183, 186, 187), uint4(189, 194, 198, 199),
+	uint4(145, 146, 147, 148), uint4(152, 153, 180, 181), uint4(182, 183, 184, 185), uint4(187, 188, 189, 190),
+	uint4(76, 77, 111, 119), uint4(146, 148, 149, 154), uint4(155, 182, 184, 185), uint4(189, 190, 191, 203),
+	uint4(150, 156, 157, 162), uint4(163, 168, 180, 186), uint4(187, 192, 193, 198), uint4(199, 204, 205, 210),
+	uint4(151, 152, 157, 158), uint4(159, 164, 165, 188), uint4(193, 194, 195, 200), uint4(201, 202, 207, 208),
+	uint4(149, 154, 155, 160), uint4(161, 166, 167, 184), uint4(185, 190, 191, 196), uint4(197, 202, 203, 209),
+	uint4(96, 102, 126, 139), uint4(156, 168, 169, 174), uint4(175, 192, 199, 204), uint4(205, 210, 211, 213),
+	uint4(169, 170, 171, 174), uint4(175, 176, 177, 204), uint4(205, 206, 207, 210), uint4(211, 212, 213, 214),
+	uint4(107, 129, 130, 131), uint4(135, 141, 165, 172), uint4(173, 178, 179, 201), uint4(208, 209, 214, 215),
+	uint4(0, 1, 2, 6), uint4(7, 8, 12, 13), uint4(36, 37, 38, 42), uint4(43, 72, 73, 78),
+	uint4(0, 1, 2, 4), uint4(7, 8, 9, 10), uint4(37, 38, 39, 40), uint4(43, 44, 45, 46),
+	uint4(1, 3, 4, 5), uint4(8, 9, 10, 11), uint4(38, 39, 40, 41), uint4(44, 45, 46, 76),
+	uint4(3, 4, 5, 10), uint4(11, 17, 29, 40), uint4(41, 46, 47, 53), uint4(77, 83, 89, 149),
+	uint4(0, 6, 7, 12), uint4(13, 19, 24, 25), uint4(42, 43, 48, 49), uint4(54, 55, 60, 61),
+	uint4(0, 1, 6, 7), uint4(8, 9, 13, 14), uint4(22, 27, 28, 50), uint4(51, 56, 57, 64),
+	uint4(2, 3, 8, 9), uint4(10, 14, 15, 16), uint4(17, 21, 22, 23), uint4(45, 51, 52, 58),
+	uint4(4, 5, 9, 10), uint4(11, 15, 16, 17), uint4(22, 29, 47, 52), uint4(53, 59, 65, 95),
+	uint4(6, 13, 18, 19), uint4(24, 25, 26, 30), uint4(31, 48, 49, 54), uint4(55, 60, 61, 66),
+	uint4(12, 13, 14, 18), uint4(19, 20, 21, 25), uint4(26, 27, 32, 33), uint4(55, 56, 62, 63),
+	uint4(7, 8, 13, 16), uint4(21, 22, 26, 27), uint4(28, 29, 34, 35), uint4(50, 58, 63, 64),
+	uint4(10, 11, 15, 16), uint4(22, 23, 28, 29), uint4(35, 53, 58, 59), uint4(65, 71, 95, 101),
+	uint4(18, 24, 25, 30), uint4(31, 32, 34, 60), uint4(61, 66, 67, 68), uint4(102, 103, 104, 174),
+	uint4(19, 20, 24, 25), uint4(26, 27, 30, 31), uint4(32, 34, 62, 67), uint4(68, 69, 70, 105),
+	uint4(20, 25, 26, 27), uint4(28, 31, 33, 34), uint4(35, 63, 68, 69), uint4(70, 71, 105, 106),
+	uint4(11, 21, 22, 23), uint4(27, 28, 29, 31), uint4(33, 34, 35, 64), uint4(65, 70, 71, 107),
+	uint4(0, 36, 37, 42), uint4(43, 72, 73, 78), uint4(79, 109, 114, 115), uint4(144, 145, 150, 151),
+	uint4(0, 1, 36, 37), uint4(38, 73, 74, 80), uint4(81, 109, 112, 116), uint4(117, 147, 148, 154),
+	uint4(2, 3, 38, 39), uint4(40, 45, 74, 75), uint4(76, 77, 81, 82), uint4(111, 112, 113, 118),
+	uint4(4, 5, 39, 40), uint4(41, 47, 75, 76), uint4(77, 82, 83, 112), uint4(119, 125, 149, 155),
+	uint4(0, 6, 36, 42), uint4(48, 54, 78, 84), uint4(85, 91, 121, 127), uint4(132, 162, 168, 169),
+	uint4(43, 44, 49, 50), uint4(79, 80, 85, 86), uint4(87, 92, 93, 122), uint4(123, 128, 136, 172),
+	uint4(9, 39, 44, 45), uint4(46, 51, 52, 81), uint4(82, 87, 88, 89), uint4(94, 124, 130, 131),
+	uint4(5, 11, 41, 46), uint4(47, 52, 53, 59), uint4(82, 83, 89, 119), uint4(130, 137, 167, 173),
+	uint4(12, 18, 48, 54), uint4(55, 60, 84, 90), uint4(91, 96, 97, 102), uint4(126, 132, 133, 138),
+	uint4(19, 49, 54, 55), uint4(56, 61, 62, 91), uint4(92, 97, 98, 99), uint4(104, 134, 135, 141),
+	uint4(14, 21, 50, 51), uint4(56, 57, 58, 63), uint4(64, 93, 94, 99), uint4(100, 101, 106, 136),
+	uint4(17, 23, 52, 53), uint4(58, 59, 65, 89), uint4(94, 95, 100, 101), uint4(107, 131, 137, 143),
+	uint4(24, 30, 54, 60), uint4(66, 67, 90, 96), uint4(97, 102, 103, 132), uint4(139, 140, 174, 175),
+	uint4(30, 31, 61, 62), uint4(66, 67, 68, 69), uint4(97, 103, 104, 135), uint4(139, 142, 177, 178),
+	uint4(32, 33, 62, 63), uint4(68, 69, 70, 99), uint4(100, 104, 105, 106), uint4(107, 141, 142, 143),
+	uint4(29, 34, 35, 64), uint4(65, 69, 70, 71), uint4(100, 101, 106, 107), uint4(136, 137, 142, 179),
+	uint4(36, 73, 78, 79), uint4(108, 109, 114, 115), uint4(144, 145, 150, 151), uint4(156, 180, 181, 186),
+	uint4(72, 73, 74, 108), uint4(109, 110, 111, 115), uint4(116, 145, 146, 147), uint4(152, 153, 182, 183),
+	uint4(37, 38, 73, 76), uint4(80, 111, 112, 118), uint4(146, 147, 148, 149), uint4(153, 154, 184, 185),
+	uint4(40, 41, 75, 76), uint4(83, 112, 113, 118), uint4(119, 125, 148, 149), uint4(155, 161, 185, 191),
+	uint4(72, 78, 84, 108), uint4(114, 115, 120, 121), uint4(126, 150, 156, 157), uint4(162, 163, 192, 198),
+	uint4(79, 109, 114, 115), uint4(116, 121, 122, 151), uint4(152, 157, 158, 159), uint4(164, 165, 194, 201),
+	uint4(74, 80, 81, 111), uint4(116, 117, 118, 123), uint4(124, 153, 154, 159), uint4(160, 161, 166, 196),
+	uint4(77, 82, 83, 89), uint4(113, 118, 119, 124), uint4(125, 131, 155, 160), uint4(161, 167, 197, 203),
+	uint4(42, 48, 78, 85), uint4(96, 126, 132, 133), uint4(156, 162, 163, 168), uint4(169, 174, 204, 210),
+	uint4(84, 85, 91, 121), uint4(126, 127, 128, 133), uint4(134, 163, 164, 169), uint4(170, 171, 176, 206),
+	uint4(43, 79, 87, 92), uint4(93, 122, 123, 128), uint4(129, 130, 135, 136), uint4(165, 166, 171, 172),
+	uint4(46, 47, 53, 83), uint4(88, 94, 124, 130), uint4(131, 137, 161, 167), uint4(173, 179, 209, 215),
+	uint4(60, 66, 90, 96), uint4(103, 132, 133, 138), uint4(139, 140, 168, 174), uint4(175, 176, 210, 211),
+	uint4(97, 102, 103, 104), uint4(133, 134, 138, 139), uint4(140, 141, 170, 175), uint4(176, 177, 212, 213),
+	uint4(61, 67, 68, 98), uint4(99, 103, 134, 135), uint4(141, 142, 176, 177), uint4(178, 179, 214, 215),
+	uint4(64, 65, 70, 71), uint4(100, 101, 106, 136), uint4(137, 142, 143, 172), uint4(173, 178, 179, 215),
+	uint4(108, 144, 145, 150), uint4(151, 180, 181, 182), uint4(184, 186, 187, 188), uint4(192, 193, 194, 204),
+	uint4(109, 110, 144, 145), uint4(146, 147, 152, 180), uint4(181, 182, 184, 187), uint4(188, 189, 190, 195),
+	uint4(110, 145, 146, 147), uint4(148, 153, 181, 183), uint4(184, 185, 188, 189), uint4(190, 191, 195, 196),
+	uint4(41, 111, 112, 113), uint4(147, 148, 149, 154), uint4(155, 181, 183, 184), uint4(185, 190, 191, 197),
+	uint4(114, 120, 144, 150), uint4(156, 157, 162, 180), uint4(186, 187, 192, 193), uint4(199, 200, 204, 205),
+	uint4(151, 152, 157, 165), uint4(180, 181, 186, 187), uint4(188, 189, 193, 194), uint4(199, 202, 207, 208),
+	uint4(152, 153, 159, 160), uint4(182, 183, 188, 189), uint4(190, 194, 195, 196), uint4(197, 201, 202, 203),
+	uint4(149, 154, 155, 160), uint4(161, 166, 167, 184), uint4(185, 189, 190, 191), uint4(196, 197, 202, 209),
+	uint4(120, 150, 156, 162), uint4(163, 168, 186, 193), uint4(198, 199, 200, 204), uint4(205, 206, 210, 211),
+	uint4(157, 163, 164, 170), uint4(192, 193, 194, 198), uint4(199, 200, 201, 205), uint4(206, 207, 212, 213),
+	uint4(151, 158, 159, 164), uint4(165, 187, 188, 193), uint4(201, 202, 206, 207), uint4(208, 209, 214, 215),
+	uint4(154, 155, 160, 161), uint4(166, 167, 172, 173), uint4(190, 191, 196, 202), uint4(203, 208, 209, 215),
+	uint4(66, 126, 132, 138), uint4(162, 168, 169, 174), uint4(175, 186, 198, 204), uint4(205, 210, 211, 212),
+	uint4(169, 170, 171, 174), uint4(175, 176, 177, 199), uint4(204, 205, 206, 207), uint4(210, 211, 212, 214),
+	uint4(169, 170, 171, 172), uint4(175, 176, 177, 178), uint4(205, 206, 207, 208), uint4(211, 213, 214, 215),
+	uint4(137, 142, 143, 167), uint4(172, 173, 177, 178), uint4(179, 202, 203, 208), uint4(209, 213, 214, 215),
+};
+static const float4 pseudo_inverse_wt_6x6x6[364] =
+{
+	float4(0.255758f, 0.147415f, -0.0263051f, 0.147415f), float4(0.150093f, 0.0268184f, 0.147415f, 0.150093f),
+	float4(0.150093f, 0.152691f, 0.0294157f, 0.0268184f), float4(0.0294157f, 0.0268184f, 0.0294157f, 0.0324458f),
+	float4(0.0814151f, 0.21508f, 0.212318f, 0.0722071f), float4(-0.0478876f, 0.103581f, 0.161046f, 0.0811624f),
+	float4(-0.0389323f, 0.103581f, 0.161046f, 0.0811624f), float4(-0.0389323f, 0.107811f, 0.163698f, 0.0822366f),
+	float4(-0.0382755f, 0.217639f, 0.376955f, 0.0553099f), float4(0.214626f, -0.0415463f, -0.0441226f, 0.0553099f),
+	float4(0.214626f, 0.0634569f, 0.222773f, -0.0399343f), float4(-0.0415463f, 0.0428937f, -0.0441226f, -0.0399343f),
+	float4(0.0814151f, 0.21508f, 0.103581f, 0.212318f), float4(0.161046f, 0.0722071f, 0.0811624f, -0.0478876f),
+	float4(-0.0389323f, 0.103581f, 0.107811f, 0.161046f), float4(0.163698f, 0.0811624f, 0.0822366f, -0.0389323f),
+	float4(0.07415f, 0.0746081f, 0.0746081f, 0.191008f), float4(0.140273f, 0.140273f, 0.189473f, 0.0706341f),
+	float4(0.0706341f, 0.0938606f, 0.0960845f, 0.0960845f), float4(0.143348f, 0.077467f, 0.077467f, 0.0739309f),
+	float4(-0.0559226f, 0.103802f, 0.0918332f, 0.20108f), float4(0.264215f, 0.125977f, 0.264215f, -0.0464051f),
+	float4(0.0918332f, -0.0559226f, -0.0464051f, 0.0628417f), float4(0.125977f, 0.0628417f, 0.20108f, 0.103802f),
+	float4(-0.0382755f, 0.217639f, 0.0553099f, -0.0415463f), float4(0.376955f, 0.214626f, -0.0441226f, 0.0553099f),
+	float4(0.0634569f, 0.214626f, 0.222773f, -0.0399343f), float4(-0.0415463f, 0.0428937f, -0.0441226f, -0.0399343f),
+	float4(0.103802f, 0.20108f, 0.125977f, -0.0464051f), float4(-0.0559226f, 0.0918332f, 0.264215f, 0.264215f),
+	float4(0.0918332f, -0.0559226f, 0.0628417f, 0.0628417f), float4(-0.0464051f, 0.125977f, 0.20108f, 0.103802f),
+	float4(-0.0399343f, -0.0441226f, 0.0428937f, -0.0399343f), float4(0.222773f, 0.214626f, -0.0441226f, 0.214626f),
+	float4(0.376955f, -0.0415463f, 0.0634569f, 0.0553099f), float4(-0.0415463f, 0.0553099f, 0.217639f, -0.0382755f),
+	float4(0.0814151f, 0.21508f, 0.103581f, 0.103581f), float4(0.107811f, 0.212318f, 0.161046f, 0.161046f),
+	float4(0.163698f, 0.0722071f, 0.0811624f, 0.0811624f), float4(0.0822366f, -0.0478876f, -0.0389323f, -0.0389323f),
+	float4(0.07415f, 0.0746081f, 0.0746081f, 0.191008f), float4(0.140273f, 0.0938606f, 0.0960845f, 0.140273f),
+	float4(0.189473f, 0.0706341f, 0.0960845f, 0.143348f), float4(0.077467f, 0.0706341f, 0.077467f, 0.0739309f),
+	float4(-0.0559226f, 0.103802f, 0.0918332f, -0.0464051f), float4(0.20108f, 0.264215f, 0.0628417f, 0.125977f),
+	float4(0.125977f, 0.264215f, 0.0628417f, 0.20108f), float4(-0.0464051f, 0.0918332f, 0.103802f, -0.0559226f),
+	float4(0.07415f, 0.0746081f, 0.0746081f, 0.191008f), float4(0.0938606f, 0.140273f, 0.0960845f, 0.140273f),
+	float4(0.0960845f, 0.189473f, 0.143348f, 0.0706341f), float4(0.077467f, 0.0706341f, 0.077467f, 0.0739309f),
+	float4(0.056688f, 0.056688f, 0.0548134f, 0.056688f), float4(0.0548134f, 0.139971f, 0.104488f, 0.104488f),
+	float4(0.104488f, 0.104488f, 0.104488f, 0.104488f), float4(0.139971f, 0.056688f, 0.056688f, 0.056688f),
+	float4(0.0739309f, 0.077467f, 0.0706341f, 0.077467f), float4(0.0706341f, 0.143348f, 0.189473f, 0.0960845f),
+	float4(0.140273f, 0.0960845f, 0.140273f, 0.0938606f), float4(0.191008f, 0.0746081f, 0.0746081f, 0.07415f),
+	float4(-0.0559226f, 0.103802f, 0.0918332f, -0.0464051f), float4(0.20108f, 0.0628417f, 0.264215f, 0.125977f),
+	float4(0.125977f, 0.0628417f, 0.264215f, 0.20108f), float4(-0.0464051f, 0.0918332f, 0.103802f, -0.0559226f),
+	float4(0.0739309f, 0.077467f, 0.0706341f, 0.077467f), float4(0.143348f, 0.0960845f, 0.0706341f, 0.189473f),
+	float4(0.140273f, 0.0960845f, 0.0938606f, 0.140273f), float4(0.191008f, 0.0746081f, 0.0746081f, 0.07415f),
+	float4(-0.0389323f, -0.0389323f, -0.0478876f, 0.0822366f), float4(0.0811624f, 0.0811624f, 0.0722071f, 0.163698f),
+	float4(0.161046f, 0.161046f, 0.212318f, 0.107811f), float4(0.103581f, 0.103581f, 0.21508f, 0.0814151f),
+	float4(-0.0382755f, 0.217639f, 0.0553099f, -0.0415463f), float4(0.0553099f, 0.0634569f, -0.0415463f, 0.376955f),
+	float4(0.214626f, -0.0441226f, 0.214626f, 0.222773f), float4(-0.0399343f, 0.0428937f, -0.0441226f, -0.0399343f),
+	float4(0.103802f, 0.20108f, 0.125977f, -0.0464051f), float4(0.0628417f, 0.0628417f, -0.0559226f, 0.0918332f),
+	float4(0.264215f, 0.264215f, 0.0918332f, -0.0559226f), float4(-0.0464051f, 0.125977f, 0.20108f, 0.103802f),
+	float4(-0.0399343f, -0.0441226f, 0.0428937f, -0.0415463f), float4(-0.0399343f, 0.222773f, 0.214626f, 0.0634569f),
+	float4(0.0553099f, -0.0441226f, 0.214626f, 0.376955f), float4(-0.0415463f, 0.0553099f, 0.217639f, -0.0382755f),
+	float4(0.103802f, 0.20108f, 0.0628417f, 0.125977f), float4(0.0628417f, -0.0464051f, -0.0559226f, 0.0918332f),
+	float4(-0.0464051f, 0.264215f, 0.125977f, 0.264215f), float4(0.20108f, 0.0918332f, 0.103802f, -0.0559226f),
+	float4(0.0739309f, 0.077467f, 0.077467f, 0.143348f), float4(0.0960845f, 0.0960845f, 0.0938606f, 0.0706341f),
+	float4(0.0706341f, 0.189473f, 0.140273f, 0.140273f), float4(0.191008f, 0.0746081f, 0.0746081f, 0.07415f),
+	float4(-0.0389323f, 0.0822366f, 0.0811624f, 0.163698f), float4(0.161046f, 0.107811f, 0.103581f, -0.0389323f),
+	float4(-0.0478876f, 0.0811624f, 0.0722071f, 0.161046f), float4(0.212318f, 0.103581f, 0.21508f, 0.0814151f),
+	float4(-0.0399343f, -0.0441226f, 0.0428937f, -0.0415463f), float4(-0.0399343f, 0.222773f, 0.0634569f, 0.214626f),
+	float4(0.0553099f, -0.0441226f, -0.0415463f, 0.214626f), float4(0.0553099f, 0.376955f, 0.217639f, -0.0382755f),
+	float4(0.0822366f, 0.163698f, 0.107811f, -0.0389323f), float4(0.0811624f, 0.161046f, 0.103581f, -0.0389323f),
+	float4(0.0811624f, 0.161046f, 0.103581f, -0.0478876f), float4(0.0722071f, 0.212318f, 0.21508f, 0.0814151f),
+	float4(-0.0263051f, 0.0324458f, 0.0294157f, 0.0268184f), float4(0.0294157f, 0.0268184f, 0.0294157f, 0.152691f),
+	float4(0.150093f, 0.150093f, 0.147415f, 0.0268184f), float4(0.150093f, 0.147415f, 0.147415f, 0.255758f),
+	float4(0.556445f, 0.163224f, -0.0564556f, 0.163224f), float4(0.167864f, -0.0530729f, -0.0564556f, -0.0530729f),
+	float4(0.163224f, 0.167864f, -0.0530729f, 0.167864f), float4(0.189547f, -0.0564556f, -0.0530729f, -0.0530729f),
+	float4(-0.0727082f, 0.413368f, 0.541658f, -0.0978144f), float4(-0.0587613f, 0.231266f, 0.0641326f, -0.0696499f),
+	float4(-0.0587613f, 0.231266f, 0.0641326f, -0.0696499f), float4(-0.0512932f, 0.24037f, 0.0770523f, -0.0649579f),
+	float4(-0.0986485f, 0.546977f, 0.411744f, -0.0879511f), float4(-0.0651502f, 0.0568519f, 0.230337f, -0.0635454f),
+	float4(-0.0651502f, 0.0568519f, 0.230337f, -0.0635454f), float4(-0.0670509f, 0.0699423f, 0.243631f, -0.0507297f),
+	float4(-0.0684235f, 0.206478f, 0.697192f, -0.0676369f), float4(0.193666f, -0.0836739f, 0.0138295f, -0.0676369f),
+	float4(0.193666f, -0.058153f, 0.213678f, -0.0706632f), float4(-0.0836739f, -0.0706632f, -0.0599309f, 0.0138295f),
+	float4(-0.0727082f, 0.413368f, -0.0587613f, 0.541658f), float4(0.231266f, 0.0641326f, -0.0978144f, -0.0696499f),
+	float4(-0.0587613f, -0.0512932f, 0.231266f, 0.24037f), float4(0.0641326f, 0.0770523f, -0.0696499f, -0.0649579f),
+	float4(-0.0652843f, -0.0559774f, -0.0559774f, 0.374924f), float4(0.2464f, -0.0524412f, 0.2464f, 0.496109f),
+	float4(-0.0614125f, -0.0614125f, -0.0727221f, 0.215714f), float4(0.0880727f, 0.0880727f, 0.0585329f, -0.0578189f),
+	float4(-0.0615783f, -0.0700865f, 0.0815995f, 0.432212f), float4(0.125276f, -0.076354f, 0.428167f, 0.429887f),
+	float4(-0.0774188f, -0.0768831f, 0.0795838f, -0.0666454f), float4(-0.0579983f, 0.0985029f, 0.250705f, 0.104318f),
+	float4(-0.071232f, -0.108449f, -0.0558562f, 0.259905f), float4(0.456675f, -0.0448475f, 0.0619084f, 0.609658f),
+	float4(-0.0769802f, -0.114078f, -0.0746381f, -0.0471948f), float4(0.262737f, 0.0726818f, -0.0819514f, -0.0464163f),
+	float4(-0.0986485f, -0.0651502f, 0.546977f, 0.0568519f), float4(0.411744f, 0.230337f, -0.0507297f, -0.0879511f),
+	float4(-0.0635454f, -0.0651502f, -0.0670509f, 0.0568519f), float4(0.0699423f, 0.230337f, 0.243631f, -0.0635454f),
+	float4(-0.0615783f, 0.0815995f, -0.076354f, -0.0700865f), float4(0.432212f, 0.428167f, -0.0768831f, 0.125276f),
+	float4(0.429887f, 0.0795838f, -0.0774188f, -0.0666454f), float4(-0.0579983f, 0.0985029f, 0.250705f, 0.104318f),
+	float4(-0.0731048f, -0.0619155f, -0.0619155f, -0.0532346f), float4(0.501478f, 0.247647f, -0.0532346f, 0.247647f),
+	float4(0.374874f, -0.0626312f, -0.0626312f, -0.0764304f), float4(-0.0574688f, 0.082814f, 0.082814f, 0.211236f),
+	float4(-0.0819514f, -0.114078f, -0.0464163f, 0.0726818f), float4(0.262737f, 0.609658f, -0.0746381f, 0.456675f),
+	float4(-0.108449f, -0.0769802f, -0.0471948f, 0.0619084f), float4(0.259905f, -0.071232f, -0.0448475f, -0.0558562f),
+	float4(-0.0684235f, 0.206478f, -0.0676369f, 0.697192f), float4(0.193666f, -0.0836739f, 0.0138295f, -0.0676369f),
+	float4(-0.058153f, 0.193666f, 0.213678f, -0.0706632f), float4(-0.0836739f, -0.0706632f, -0.0599309f, 0.0138295f),
+	float4(-0.0558562f, -0.0448475f, -0.071232f, 0.259905f), float4(0.0619084f, -0.0769802f, -0.108449f, 0.456675f),
+	float4(0.609658f, -0.114078f, -0.0471948f, -0.0746381f), float4(0.262737f, 0.0726818f, -0.0819514f, -0.0464163f),
+	float4(-0.0464163f, -0.0819514f, 0.0726818f, 0.262737f), float4(-0.0746381f, -0.114078f, 0.609658f, 0.456675f),
+	float4(-0.108449f, -0.0471948f, -0.0769802f, 0.0619084f), float4(0.259905f, -0.071232f, -0.0448475f, -0.0558562f),
+	float4(0.0138295f, -0.0599309f, -0.0706632f, -0.0836739f), float4(-0.0706632f, 0.213678f, 0.193666f, 0.0138295f),
+	float4(-0.0836739f, 0.193666f, 0.697192f, -0.058153f), float4(-0.0676369f, -0.0676369f, 0.206478f, -0.0684235f),
+	float4(-0.0727082f, 0.413368f, -0.0587613f, -0.0587613f), float4(-0.0512932f, 0.541658f, 0.231266f, 0.231266f),
+	float4(0.24037f, 0.0641326f, 0.0641326f, 0.0770523f), float4(-0.0978144f, -0.0696499f, -0.0696499f, -0.0649579f),
+	float4(-0.0652843f, -0.0559774f, -0.0559774f, 0.374924f), float4(0.2464f, 0.2464f, 0.496109f, 0.215714f),
+	float4(0.0880727f, -0.0524412f, -0.0614125f, 0.0880727f), float4(0.0585329f, -0.0614125f, -0.0727221f, -0.0578189f),
+	float4(-0.0615783f, -0.0700865f, 0.0815995f, 0.432212f), float4(0.125276f, -0.0579983f, -0.076354f, 0.428167f),
+	float4(0.429887f, -0.0774188f, 0.0985029f, 0.250705f), float4(-0.0768831f, 0.0795838f, -0.0666454f, 0.104318f),
+	float4(-0.071232f, -0.108449f, -0.0558562f, 0.259905f), float4(0.456675f, -0.0746381f, -0.0448475f, 0.0619084f),
+	float4(0.609658f, -0.0471948f, 0.262737f, -0.0769802f), float4(0.0726818f, -0.0464163f, -0.114078f, -0.0819514f),
+	float4(-0.0652843f, -0.0559774f, -0.0559774f, 0.374924f), float4(0.2464f, -0.0524412f, 0.2464f, 0.496109f),
+	float4(0.215714f, 0.0880727f, 0.0880727f, 0.0585329f), float4(-0.0614125f, -0.0614125f, -0.0727221f, -0.0578189f),
+	float4(0.275975f, 0.180632f, 0.180632f, 0.183927f), float4(0.180632f, 0.183927f, 0.183927f, 0.357735f),
+	float4(0.0497407f, 0.0497407f, 0.0483206f, 0.0497407f), float4(0.0483206f, 0.0483206f, -0.0404281f, -0.0523449f),
+	float4(-0.0501953f, -0.0501953f, 0.0815983f, 0.350998f), float4(0.096861f, 0.237001f, 0.110751f, 0.237001f),
+	float4(0.110751f, 0.355128f, 0.340978f, -0.0784154f), float4(0.0794084f, 0.0794084f, 0.0720846f, -0.0650753f),
+	float4(-0.0764304f, -0.0626312f, -0.0626312f, 0.211236f), float4(0.374874f, 0.082814f, 0.247647f, -0.0532346f),
+	float4(0.082814f, 0.247647f, 0.501478f, -0.0532346f), float4(-0.0574688f, -0.0619155f, -0.0619155f, -0.0731048f),
+	float4(-0.0615783f, -0.0700865f, 0.0815995f, 0.432212f), float4(-0.0579983f, 0.125276f, -0.076354f, 0.428167f),
+	float4(0.0985029f, 0.429887f, 0.250705f, -0.0774188f), float4(-0.0768831f, 0.0795838f, 0.104318f, -0.0666454f),
+	float4(-0.0501953f, 0.0815983f, -0.0501953f, 0.350998f), float4(0.237001f, 0.096861f, 0.110751f, 0.237001f),
+	float4(0.355128f, 0.110751f, 0.340978f, 0.0794084f), float4(-0.0784154f, 0.0794084f, 0.0720846f, -0.0650753f),
+	float4(-0.0650753f, -0.0784154f, 0.0720846f, 0.0794084f), float4(0.0794084f, 0.340978f, 0.110751f, 0.110751f),
+	float4(0.096861f, 0.355128f, 0.237001f, 0.237001f), float4(0.350998f, -0.0501953f, -0.0501953f, 0.0815983f),
+	float4(-0.0666454f, -0.0774188f, 0.104318f, 0.0795838f), float4(0.250705f, 0.429887f, 0.125276f, -0.0768831f),
+	float4(0.0985029f, 0.428167f, -0.0579983f, 0.432212f), float4(-0.0700865f, -0.076354f, 0.0815995f, -0.0615783f),
+	float4(-0.071232f, -0.108449f, -0.0558562f, 0.259905f), float4(0.456675f, -0.0746381f, -0.0448475f, 0.0619084f),
+	float4(-0.0471948f, 0.609658f, 0.262737f, -0.0769802f), float4(0.0726818f, -0.0464163f, -0.114078f, -0.0819514f),
+	float4(-0.0764304f, -0.0626312f, 0.211236f, 0.082814f), float4(-0.0626312f, 0.374874f, 0.247647f, -0.0532346f),
+	float4(0.082814f, 0.247647f, 0.501478f, -0.0574688f), float4(-0.0532346f, -0.0619155f, -0.0619155f, -0.0731048f),
+	float4(-0.0666454f, -0.0774188f, 0.104318f, 0.250705f), float4(0.0795838f, 0.429887f, 0.125276f, 0.0985029f),
+	float4(-0.0579983f, -0.0768831f, 0.428167f, 0.432212f), float4(-0.0700865f, -0.076354f, 0.0815995f, -0.0615783f),
+	float4(-0.0635454f, -0.0635454f, -0.0879511f, 0.243631f), float4(0.230337f, -0.0507297f, 0.230337f, 0.411744f),
+	float4(0.0699423f, 0.0568519f, 0.0568519f, 0.546977f), float4(-0.0670509f, -0.0651502f, -0.0651502f, -0.0986485f),
+	float4(-0.0986485f, -0.0651502f, -0.0651502f, -0.0670509f), float4(0.546977f, 0.0568519f, 0.0568519f, 0.0699423f),
+	float4(0.411744f, 0.230337f, 0.230337f, 0.243631f), float4(-0.0507297f, -0.0879511f, -0.0635454f, -0.0635454f),
+	float4(-0.0615783f, 0.0815995f, -0.076354f, -0.0700865f), float4(0.432212f, 0.428167f, -0.0768831f, -0.0579983f),
+	float4(0.0985029f, 0.125276f, 0.429887f, 0.0795838f), float4(0.250705f, 0.104318f, -0.0774188f, -0.0666454f),
+	float4(-0.0731048f, -0.0619155f, -0.0619155f, -0.0532346f), float4(-0.0574688f, 0.501478f, 0.247647f, 0.082814f),
+	float4(-0.0532346f, 0.247647f, 0.374874f, -0.0626312f), float4(0.082814f, 0.211236f, -0.0626312f, -0.0764304f),
+	float4(-0.0819514f, -0.114078f, -0.0464163f, 0.0726818f), float4(-0.0769802f, 0.262737f, 0.609658f, -0.0471948f),
+	float4(0.0619084f, -0.0448475f, -0.0746381f, 0.456675f), float4(0.259905f, -0.0558562f, -0.108449f, -0.071232f),
+	float4(-0.0615783f, 0.0815995f, -0.076354f, -0.0700865f), float4(0.432212f, -0.0579983f, 0.428167f, 0.0985029f),
+	float4(-0.0768831f, 0.125276f, 0.429887f, 0.250705f), float4(0.0795838f, 0.104318f, -0.0774188f, -0.0666454f),
+	float4(0.0815983f, -0.0501953f, -0.0501953f, 0.350998f), float4(0.237001f, 0.237001f, 0.355128f, 0.096861f),
+	float4(0.110751f, 0.110751f, 0.340978f, 0.0794084f), float4(0.0794084f, 0.0720846f, -0.0784154f, -0.0650753f),
+	float4(-0.0650753f, 0.0720846f, 0.0794084f, -0.0784154f), float4(0.0794084f, 0.340978f, 0.110751f, 0.355128f),
+	float4(0.237001f, 0.110751f, 0.096861f, 0.237001f), float4(0.350998f, -0.0501953f, 0.0815983f, -0.0501953f),
+	float4(-0.0666454f, 0.104318f, 0.0795838f, -0.0768831f), float4(-0.0774188f, 0.250705f, 0.429887f, 0.0985029f),
+	float4(0.428167f, -0.076354f, 0.125276f, -0.0579983f), float4(0.432212f, 0.0815995f, -0.0700865f, -0.0615783f),
+	float4(-0.0731048f, -0.0619155f, -0.0619155f, -0.0574688f), float4(-0.0532346f, 0.501478f, 0.247647f, 0.082814f),
+	float4(-0.0532346f, 0.247647f, 0.082814f, 0.374874f), float4(0.211236f, -0.0626312f, -0.0626312f, -0.0764304f),
+	float4(-0.0650753f, 0.0720846f, 0.0794084f, 0.0794084f), float4(-0.0784154f, 0.340978f, 0.355128f, 0.110751f),
+	float4(0.237001f, 0.110751f, 0.237001f, 0.096861f), float4(0.350998f, 0.0815983f, -0.0501953f, -0.0501953f),
+	float4(-0.0523449f, -0.0404281f, 0.0483206f, 0.0483206f), float4(0.0497407f, 0.0483206f, 0.0497407f, 0.0497407f),
+	float4(0.357735f, 0.183927f, 0.183927f, 0.180632f), float4(0.183927f, 0.180632f, 0.180632f, 0.275975f),
+	float4(-0.0578189f, -0.0727221f, -0.0614125f, -0.0614125f), float4(0.0585329f, 0.0880727f, 0.0880727f, 0.215714f),
+	float4(0.496109f, 0.2464f, -0.0524412f, 0.2464f), float4(0.374924f, -0.0559774f, -0.0559774f, -0.0652843f),
+	float4(-0.0819514f, -0.114078f, -0.0464163f, 0.0726818f), float4(-0.0769802f, 0.262737f, -0.0471948f, 0.609658f),
+	float4(0.0619084f, -0.0448475f, -0.0746381f, 0.456675f), float4(0.259905f, -0.0558562f, -0.108449f, -0.071232f),
+	float4(0.104318f, -0.0666454f, 0.0795838f, -0.0768831f), float4(0.250705f, 0.0985029f, -0.0774188f, 0.429887f),
+	float4(0.428167f, -0.076354f, -0.0579983f, 0.125276f), float4(0.432212f, 0.0815995f, -0.0700865f, -0.0615783f),
+	float4(-0.0578189f, -0.0727221f, -0.0614125f, 0.0585329f), float4(0.0880727f, -0.0614125f, 0.0880727f, 0.215714f),
+	float4(0.496109f, 0.2464f, -0.0524412f, 0.2464f), float4(0.374924f, -0.0559774f, -0.0559774f, -0.0652843f),
+	float4(-0.0649579f, -0.0696499f, -0.0696499f, -0.0978144f), float4(0.0770523f, 0.0641326f, 0.0641326f, 0.24037f),
+	float4(0.231266f, 0.231266f, 0.541658f, -0.0512932f), float4(-0.0587613f, -0.0587613f, 0.413368f, -0.0727082f),
+	float4(-0.0684235f, 0.206478f, -0.0676369f, -0.0676369f), float4(-0.058153f, 0.697192f, 0.193666f, -0.0836739f),
+	float4(0.0138295f, 0.193666f, 0.213678f, -0.0706632f), float4(-0.0836739f, -0.0706632f, -0.0599309f, 0.0138295f),
+	float4(-0.0558562f, -0.0448475f, -0.071232f, 0.259905f), float4(0.0619084f, -0.0769802f, -0.0471948f, -0.108449f),
+	float4(0.456675f, 0.609658f, -0.114078f, -0.0746381f), float4(0.262737f, 0.0726818f, -0.0819514f, -0.0464163f),
+	float4(-0.0464163f, -0.0819514f, 0.0726818f, 0.262737f), float4(-0.0746381f, -0.0471948f, -0.114078f, 0.609658f),
+	float4(0.456675f, -0.108449f, -0.0769802f, 0.0619084f), float4(0.259905f, -0.071232f, -0.0448475f, -0.0558562f),
+	float4(0.0138295f, -0.0599309f, -0.0706632f, -0.0836739f), float4(-0.0706632f, 0.213678f, 0.193666f, -0.058153f),
+	float4(-0.0676369f, 0.0138295f, -0.0836739f, 0.193666f), float4(0.697192f, -0.0676369f, 0.206478f, -0.0684235f),
+	float4(-0.0558562f, -0.0448475f, -0.071232f, 0.259905f), float4(0.0619084f, -0.0471948f, -0.0769802f, -0.108449f),
+	float4(0.456675f, -0.0746381f, 0.609658f, 0.262737f), float4(0.0726818f, -0.0464163f, -0.114078f, -0.0819514f),
+	float4(0.211236f, 0.082814f, 0.082814f, -0.0574688f), float4(-0.0764304f, -0.0626312f, -0.0626312f, 0.374874f),
+	float4(0.247647f, -0.0532346f, 0.247647f, 0.501478f), float4(-0.0532346f, -0.0619155f, -0.0619155f, -0.0731048f),
+	float4(0.104318f, 0.250705f, 0.0985029f, -0.0579983f), float4(-0.0666454f, -0.0774188f, 0.0795838f, 0.429887f),
+	float4(0.125276f, -0.0768831f, 0.428167f, 0.432212f), float4(-0.0700865f, -0.076354f, 0.0815995f, -0.0615783f),
+	float4(-0.0635454f, 0.243631f, 0.230337f, 0.0699423f), float4(0.0568519f, -0.0670509f, -0.0651502f, -0.0635454f),
+	float4(-0.0879511f, -0.0507297f, 0.230337f, 0.411744f), float4(0.0568519f, 0.546977f, -0.0651502f, -0.0986485f),
+	float4(-0.0464163f, -0.0819514f, 0.0726818f, 0.262737f), float4(-0.0471948f, -0.0746381f, -0.114078f, -0.0769802f),
+	float4(0.609658f, 0.0619084f, -0.0448475f, 0.456675f), float4(0.259905f, -0.0558562f, -0.108449f, -0.071232f),
+	float4(0.104318f, 0.250705f, 0.0985029f, -0.0579983f), float4(-0.0666454f, 0.0795838f, -0.0768831f, -0.0774188f),
+	float4(0.429887f, 0.428167f, -0.076354f, 0.125276f), float4(0.432212f, 0.0815995f, -0.0700865f, -0.0615783f),
+	float4(-0.0578189f, 0.0585329f, 0.0880727f, 0.0880727f), float4(0.215714f, -0.0727221f, -0.0614125f, -0.0614125f),
+	float4(0.496109f, 0.2464f, -0.0524412f, 0.2464f), float4(0.374924f, -0.0559774f, -0.0559774f, -0.0652843f),
+	float4(-0.0649579f, -0.0696499f, 0.0770523f, 0.0641326f), float4(0.24037f, 0.231266f, -0.0512932f, -0.0587613f),
+	float4(-0.0696499f, -0.0978144f, 0.0641326f, 0.231266f), float4(0.541658f, -0.0587613f, 0.413368f, -0.0727082f),
+	float4(0.0138295f, -0.0599309f, -0.0706632f, -0.0836739f), float4(-0.0706632f, 0.213678f, -0.058153f, 0.193666f),
+	float4(-0.0676369f, 0.0138295f, -0.0836739f, 0.193666f), float4(-0.0676369f, 0.697192f, 0.206478f, -0.0684235f),
+	float4(0.243631f, 0.0699423f, -0.0670509f, -0.0635454f), float4(0.230337f, 0.0568519f, -0.0651502f, -0.0507297f),
+	float4(-0.0635454f, 0.230337f, 0.0568519f, -0.0651502f), float4(-0.0879511f, 0.411744f, 0.546977f, -0.0986485f),
+	float4(-0.0649579f, 0.0770523f, 0.24037f, -0.0512932f), float4(-0.0696499f, 0.0641326f, 0.231266f, -0.0587613f),
+	float4(-0.0696499f, 0.0641326f, 0.231266f, -0.0587613f), float4(-0.0978144f, 0.541658f, 0.413368f, -0.0727082f),
+	float4(-0.0530729f, -0.0530729f, -0.0564556f, -0.0530729f), float4(0.189547f, 0.167864f, -0.0530729f, 0.167864f),
+	float4(0.163224f, -0.0530729f, -0.0564556f, 0.167864f), float4(0.163224f, -0.0564556f, 0.163224f, 0.556445f),
+};
+
+#endif // ASTC_DECIMATION_TABLE_HLSL
@@ -0,0 +1,835 @@
+// OpenCL C port of ASTC_Encode.hlsl, ASTC_BlockEncode.hlsl and ASTC_IntegerSequenceEncoding.hlsl for the opencl backend,
+// one work-item per block, built with the same THREAD_NUM_X/Y, BLOCK_DIM_X/Y, HAS_ALPHA, IS_NORMALMAP, VOID_EXTENT_TOLERANCE defines.
+// a frozen, hand-maintained fork of the fast blockmode only, changes to the hlsl are not carried over here.
+
+#ifndef THREAD_NUM_X
+#define THREAD_NUM_X 8
+#endif
+
+#ifndef THREAD_NUM_Y
+#define THREAD_NUM_Y 8
+#endif
+
+#ifndef BLOCK_DIM_X
+#define BLOCK_DIM_X 4
+#endif
+
+#ifndef BLOCK_DIM_Y
+#define BLOCK_DIM_Y 4
+#endif
+
+#ifndef HAS_ALPHA
+#define HAS_ALPHA 0
+#endif
+
+#ifndef IS_NORMALMAP
+#define IS_NORMALMAP 0
+#endif
+
+#ifndef VOID_EXTENT_TOLERANCE
+#define VOID_EXTENT_TOLERANCE 0
+#endif
+
+// opencl 1.2 has no srgb image format, the texels are converted in the kernel
+#ifndef IS_SRGB
+#define IS_SRGB 0
+#endif
+
+#define BLOCK_SIZE ((BLOCK_DIM_X) * (BLOCK_DIM_Y))
+
+#define X_GRIDS 4
+#define Y_GRIDS 4
+
+#define DECIMATED_GRID (BLOCK_DIM_X != X_GRIDS || BLOCK_DIM_Y != Y_GRIDS)
+
+#define SMALL_VALUE 0.00001f
+
+/*
+* supported color_endpoint_mode
+*/
+#define CEM_LDR_RGB_DIRECT 8
+#define CEM_LDR_RGBA_DIRECT 12
+
+#define	QUANT_2 0
+#define	QUANT_3 1
+#define	QUANT_4 2
+#define	QUANT_5 3
+#define	QUANT_6 4
+#define	QUANT_8 5
+#define	QUANT_10 6
+#define	QUANT_12 7
+#define	QUANT_16 8
+#define	QUANT_20 9
+#define	QUANT_24 10
+#define	QUANT_32 11
+#define	QUANT_40 12
+#define	QUANT_48 13
+#define	QUANT_64 14
+#define	QUANT_80 15
+#define	QUANT_96 16
+#define	QUANT_128 17
+#define	QUANT_160 18
+#define	QUANT_192 19
+#define	QUANT_256 20
+#define	QUANT_MAX 21
+
+// from [ARM:astc-encoder] quantization_and_transfer_table quant_and_xfer_tables
+#define WEIGHT_QUANTIZE_NUM 32
+
+__constant int scramble_table[12 * WEIGHT_QUANTIZE_NUM] = {
+	// quantization method 0, range 0..1
+	//{
+		0, 1,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	//},
+	// quantization method 1, range 0..2
+	//{
+		0, 1, 2,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	//},
+	// quantization method 2, range 0..3
+	//{
+		0, 1, 2, 3,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	//},
+	// quantization method 3, range 0..4
+	//{
+		0, 1, 2, 3, 4,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	//},
+	// quantization method 4, range 0..5
+	//{
+		0, 2, 4, 5, 3, 1,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	//},
+	// quantization method 5, range 0..7
+	//{
+		0, 1, 2, 3, 4, 5, 6, 7,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	//},
+	// quantization method 6, range 0..9
+	//{
+		0, 2, 4, 6, 8, 9, 7, 5, 3, 1,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	//},
+	// quantization method 7, range 0..11
+	//{
+		0, 4, 8, 2, 6, 10, 11, 7, 3, 9, 5, 1,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	//},
+	// quantization method 8, range 0..15
+	//{
+		0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	//},
+	// quantization method 9, range 0..19
+	//{
+		0, 4, 8, 12, 16, 2, 6, 10, 14, 18, 19, 15, 11, 7, 3, 17, 13, 9, 5, 1,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	//},
+	// quantization method 10, range 0..23
+	//{
+		0, 8, 16, 2, 10, 18, 4, 12, 20, 6, 14, 22, 23, 15, 7, 21, 13, 5, 19,
+		11, 3, 17, 9, 1, 0, 0, 0, 0, 0, 0, 0, 0,
+	//},
+	// quantization method 11, range 0..31
+	//{
+		0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19,
+		20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31,
+	//}
+
+};
+
+__constant int bits_trits_quints_table[QUANT_MAX * 3] =
+{
+	1, 0, 0,  // RANGE_2
+	0, 1, 0,  // RANGE_3
+	2, 0, 0,  // RANGE_4
+	0, 0, 1,  // RANGE_5
+	1, 1, 0,  // RANGE_6
+	3, 0, 0,  // RANGE_8
+	1, 0, 1,  // RANGE_10
+	2, 1, 0,  // RANGE_12
+	4, 0, 0,  // RANGE_16
+	2, 0, 1,  // RANGE_20
+	3, 1, 0,  // RANGE_24
+	5, 0, 0,  // RANGE_32
+	3, 0, 1,  // RANGE_40
+	4, 1, 0,  // RANGE_48
+	6, 0, 0,  // RANGE_64
+	4, 0, 1,  // RANGE_80
+	5, 1, 0,  // RANGE_96
+	7, 0, 0,  // RANGE_128
+	5, 0, 1,  // RANGE_160
+	6, 1, 0,  // RANGE_192
+	8, 0, 0   // RANGE_256
+};
+
+__constant int integer_from_trits[243] =
+{
+	0,1,2,    4,5,6,    8,9,10, 
+	16,17,18, 20,21,22, 24,25,26,
+	3,7,15,   19,23,27, 12,13,14, 
+	32,33,34, 36,37,38, 40,41,42,
+	48,49,50, 52,53,54, 56,57,58,
+	35,39,47, 51,55,59, 44,45,46, 
+	64,65,66, 68,69,70, 72,73,74,
+	80,81,82, 84,85,86, 88,89,90,
+	67,71,79, 83,87,91, 76,77,78,
+
+	128,129,130, 132,133,134, 136,137,138,
+	144,145,146, 148,149,150, 152,153,154,
+	131,135,143, 147,151,155, 140,141,142,
+	160,161,162, 164,165,166, 168,169,170,
+	176,177,178, 180,181,182, 184,185,186,
+	163,167,175, 179,183,187, 172,173,174,
+	192,193,194, 196,197,198, 200,201,202,
+	208,209,210, 212,213,214, 216,217,218,
+	195,199,207, 211,215,219, 204,205,206,
+
+	96,97,98, 	 100,101,102, 104,105,106,
+	112,113,114, 116,117,118, 120,121,122,
+	99,103,111,  115,119,123, 108,109,110, 
+	224,225,226, 228,229,230, 232,233,234,
+	240,241,242, 244,245,246, 248,249,250,
+	227,231,239, 243,247,251, 236,237,238,
+	28,29,30, 	 60,61,62, 	  92,93,94, 
+	156,157,158, 188,189,190, 220,221,222,
+	31,63,127, 	 159,191,255, 252,253,254,
+
+};
+
+__constant int integer_from_quints[125] =
+{
+	0,1,2,3,4, 			8,9,10,11,12, 			16,17,18,19,20,			24,25,26,27,28, 		5,13,21,29,6,
+	32,33,34,35,36, 	40,41,42,43,44, 		48,49,50,51,52, 		56,57,58,59,60, 		37,45,53,61,14,	
+	64,65,66,67,68, 	72,73,74,75,76, 		80,81,82,83,84, 		88,89,90,91,92, 		69,77,85,93,22,
+	96,97,98,99,100, 	104,105,106,107,108,	112,113,114,115,116,	120,121,122,123,124, 	101,109,117,125,30,	
+	102,103,70,71,38, 	110,111,78,79,46, 		118,119,86,87,54, 		126,127,94,95,62, 		39,47,55,63,31
+};
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// integer sequence encoding
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// 把number的低bitcount位写到bytes的bitoffset偏移处开始的位置
+// number must be <= 255; bitcount must be <= 8
+void orbits8_ptr(uint4* outputs, uint* bitoffset, uint number, uint bitcount)
+{
+	uint newpos = *bitoffset + bitcount;
+
+	uint nidx = newpos >> 5;
+	uint uidx = *bitoffset >> 5;
+	uint bit_idx = *bitoffset & 31;
+
+	uint bytes[4] = { outputs->x, outputs->y, outputs->z, outputs->w };
+	bytes[uidx] |= (number << bit_idx);
+	if (nidx > uidx) {
+		bytes[uidx + 1] |= (number >> (32 - bit_idx));
+	}
+
+	outputs->x = bytes[0];
+	outputs->y = bytes[1];
+	outputs->z = bytes[2];
+	outputs->w = bytes[3];
+
+	*bitoffset = newpos;
+}
+
+void split_high_low(uint n, uint i, int* high, uint* low)
+{
+	uint low_mask = (uint)((1 << i) - 1);
+	*low = n & low_mask;
+	*high = (n >> i) & 0xFF;
+}
+
+/**
+ * Reverse bits of a byte.
+ */
+uint reverse_byte(uint p)
+{
+	p = ((p & 0xF) << 4) | ((p >> 4) & 0xF);
+	p = ((p & 0x33) << 2) | ((p >> 2) & 0x33);
+	p = ((p & 0x55) << 1) | ((p >> 1) & 0x55);
+	return p;
+}
+
+/**
+ * Encode a group of 5 numbers using trits and bits.
+ */
+void encode_trits(uint bitcount,
+	uint b0,
+	uint b1,
+	uint b2,
+	uint b3,
+	uint b4,
+	uint4* outputs, uint* outpos)
+{
+	int t0, t1, t2, t3, t4;
+	uint m0, m1, m2, m3, m4;
+
+	split_high_low(b0, bitcount, &t0, &m0);
+	split_high_low(b1, bitcount, &t1, &m1);
+	split_high_low(b2, bitcount, &t2, &m2);
+	split_high_low(b3, bitcount, &t3, &m3);
+	split_high_low(b4, bitcount, &t4, &m4);
+
+	uint packhigh = integer_from_trits[t4 * 81 + t3 * 27 + t2 * 9 + t1 * 3 + t0];
+
+	orbits8_ptr(outputs, outpos, m0, bitcount);
+	orbits8_ptr(outputs, outpos, packhigh & 3, 2);
+
+	orbits8_ptr(outputs, outpos, m1, bitcount);
+	orbits8_ptr(outputs, outpos, (packhigh >> 2) & 3, 2);
+
+	orbits8_ptr(outputs, outpos, m2, bitcount);
+	orbits8_ptr(outputs, outpos, (packhigh >> 4) & 1, 1);
+
+	orbits8_ptr(outputs, outpos, m3, bitcount);
+	orbits8_ptr(outputs, outpos, (packhigh >> 5) & 3, 2);
+
+	orbits8_ptr(outputs, outpos, m4, bitcount);
+	orbits8_ptr(outputs, outpos, (packhigh >> 7) & 1, 1);
+}
+
+/**
+ * Encode a group of 3 numbers using quints and bits.
+ */
+void encode_quints(uint bitcount,
+	uint b0,
+	uint b1,
+	uint b2,
+	uint4* outputs, uint* outpos)
+{
+	int q0, q1, q2;
+	uint m0, m1, m2;
+
+	split_high_low(b0, bitcount, &q0, &m0);
+	split_high_low(b1, bitcount, &q1, &m1);
+	split_high_low(b2, bitcount, &q2, &m2);
+
+	uint packhigh = integer_from_quints[q2 * 25 + q1 * 5 + q0];
+
+	orbits8_ptr(outputs, outpos, m0, bitcount);
+	orbits8_ptr(outputs, outpos, packhigh & 7, 3);
+
+	orbits8_ptr(outputs, outpos, m1, bitcount);
+	orbits8_ptr(outputs, outpos, (packhigh >> 3) & 3, 2);
+
+	orbits8_ptr(outputs, outpos, m2, bitcount);
+	orbits8_ptr(outputs, outpos, (packhigh >> 5) & 3, 2);
+}
+
+void bise_endpoints(uint numbers[8], int range, uint4* outputs)
+{
+	uint bitpos = 0;
+	uint bits = bits_trits_quints_table[range * 3 + 0];
+	uint trits = bits_trits_quints_table[range * 3 + 1];
+	uint quints = bits_trits_quints_table[range * 3 + 2];
+
+#if HAS_ALPHA
+	int count = 8;
+#else
+	int count = 6;
+#endif
+
+	if (trits == 1)
+	{
+		encode_trits(bits, numbers[0], numbers[1], numbers[2], numbers[3], numbers[4], outputs, &bitpos);
+		encode_trits(bits, numbers[5], numbers[6], numbers[7], 0, 0, outputs, &bitpos);
+	}
+	else if (quints == 1)
+	{
+		encode_quints(bits, numbers[0], numbers[1], numbers[2], outputs, &bitpos);
+		encode_quints(bits, numbers[3], numbers[4], numbers[5], outputs, &bitpos);
+		encode_quints(bits, numbers[6], numbers[7], 0, outputs, &bitpos);
+	}
+	else
+	{
+		for (int i = 0; i < count; ++i)
+		{
+			orbits8_ptr(outputs, &bitpos, numbers[i], bits);
+		}
+	}
+}
+
+void bise_weights(uint numbers[16], int range, uint4* outputs)
+{
+	uint bitpos = 0;
+	uint bits = bits_trits_quints_table[range * 3 + 0];
+	uint trits = bits_trits_quints_table[range * 3 + 1];
+	uint quints = bits_trits_quints_table[range * 3 + 2];
+
+	if (trits == 1)
+	{
+		encode_trits(bits, numbers[0], numbers[1], numbers[2], numbers[3], numbers[4], outputs, &bitpos);
+		encode_trits(bits, numbers[5], numbers[6], numbers[7], numbers[8], numbers[9], outputs, &bitpos);
+		encode_trits(bits, numbers[10], numbers[11], numbers[12], numbers[13], numbers[14], outputs, &bitpos);
+		encode_trits(bits, numbers[15], 0, 0, 0, 0, outputs, &bitpos);
+	}
+	else if (quints == 1)
+	{
+		encode_quints(bits, numbers[0], numbers[1], numbers[2], outputs, &bitpos);
+		encode_quints(bits, numbers[3], numbers[4], numbers[5], outputs, &bitpos);
+		encode_quints(bits, numbers[6], numbers[7], numbers[8], outputs, &bitpos);
+		encode_quints(bits, numbers[9], numbers[10], numbers[11], outputs, &bitpos);
+		encode_quints(bits, numbers[12], numbers[13], numbers[14], outputs, &bitpos);
+		encode_quints(bits, numbers[15], 0, 0, outputs, &bitpos);
+	}
+	else
+	{
+		for (int i = 0; i < 16; ++i)
+		{
+			orbits8_ptr(outputs, &bitpos, numbers[i], bits);
+		}
+	}
+}
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// calc the dominant axis
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// hlsl mul(m, v) with the rows of m
+float4 mul(float4 m[4], float4 v)
+{
+	return (float4)(dot(m[0], v), dot(m[1], v), dot(m[2], v), dot(m[3], v));
+}
+
+// v / length(v) like the shader, the opencl builtin may rescale first
+float4 normalize_hlsl(float4 v)
+{
+	return v / length(v);
+}
+
+// hlsl mul(a, b) of two matrices with the rows of a and b
+void mul_matrix(float4 a[4], float4 b[4], float4 r[4])
+{
+	for (int i = 0; i < 4; ++i)
+	{
+		r[i] = b[0] * a[i].x + b[1] * a[i].y + b[2] * a[i].z + b[3] * a[i].w;
+	}
+}
+
+#define EIGEN_ITERATIONS 4
+#define EIGEN_CONVERGED 0.99999f
+
+float4 eigen_vector(float4 m[4])
+{
+	// a flat block has no principal axis, any one spans it
+	float trace = m[0].x + m[1].y + m[2].z + m[3].w;
+	if (trace < SMALL_VALUE)
+	{
+		return (float4)(0.57735f, 0.57735f, 0.57735f, 0.0f);
+	}
+
+	int i = 0;
+	for (i = 0; i < 4; ++i)
+	{
+		m[i] /= trace;
+	}
+	float4 m2[4];
+	float4 m4[4];
+	mul_matrix(m, m, m2);
+	mul_matrix(m2, m2, m4);
+
+	// start from the largest column of m * m
+	float4 v = m2[0];
+	float diag[4] = { m2[0].x, m2[1].y, m2[2].z, m2[3].w };
+	float largest = diag[0];
+	for (i = 1; i < 4; ++i)
+	{
+		if (diag[i] > largest)
+		{
+			largest = diag[i];
+			v = m2[i];
+		}
+	}
+	v = normalize_hlsl(v);
+
+	for (i = 0; i < EIGEN_ITERATIONS; ++i)
+	{
+		float4 w = mul(m4, v);
+		float len = length(w);
+		if (len < SMALL_VALUE)
+		{
+			break;
+		}
+		w = w / len;
+		float cosine = dot(w, v);
+		v = w;
+		if (cosine > EIGEN_CONVERGED)
+		{
+			break;
+		}
+	}
+	return v;
+}
+
+void find_min_max(float4 texels[BLOCK_SIZE], float4 pt_mean, float4 vec_k, float4* e0, float4* e1)
+{
+	float a = 1e31f;
+	float b = -1e31f;
+	for (int i = 0; i < BLOCK_SIZE; ++i)
+	{
+		float4 texel = texels[i] - pt_mean;
+		float t = dot(texel, vec_k);
+		a = min(a, t);
+		b = max(b, t);
+	}
+
+	*e0 = clamp(vec_k * a + pt_mean, 0.0f, 255.0f);
+	*e1 = clamp(vec_k * b + pt_mean, 0.0f, 255.0f);
+
+	// if the direction-vector ends up pointing from light to dark, FLIP IT!
+	// this will make the first endpoint the darkest one.
+	float4 e0u = rint(*e0);
+	float4 e1u = rint(*e1);
+	if (e0u.x + e0u.y + e0u.z > e1u.x + e1u.y + e1u.z)
+	{
+		float4 tmp = *e0;
+		*e0 = *e1;
+		*e1 = tmp;
+	}
+
+#if !HAS_ALPHA
+	e0->w = 255.0f;
+	e1->w = 255.0f;
+#endif
+}
+
+void principal_component_analysis(float4 texels[BLOCK_SIZE], float4* e0, float4* e1)
+{
+	int i = 0;
+	float4 pt_mean = 0;
+	for (i = 0; i < BLOCK_SIZE; ++i)
+	{
+		pt_mean += texels[i];
+	}
+	pt_mean /= BLOCK_SIZE;
+
+	float cov[4][4] = { { 0 } };
+	for (int k = 0; k < BLOCK_SIZE; ++k)
+	{
+		float4 texel = texels[k] - pt_mean;
+		float t[4] = { texel.x, texel.y, texel.z, texel.w };
+		for (i = 0; i < 4; ++i)
+		{
+			for (int j = 0; j < 4; ++j)
+			{
+				cov[i][j] += t[i] * t[j];
+			}
+		}
+	}
+
+	float4 m[4];
+	for (i = 0; i < 4; ++i)
+	{
+		m[i] = (float4)(cov[i][0], cov[i][1], cov[i][2], cov[i][3]) / (BLOCK_SIZE - 1);
+	}
+
+	float4 vec_k = eigen_vector(m);
+
+	find_min_max(texels, pt_mean, vec_k, e0, e1);
+}
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// calculate quantized weights
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+uint quantize_weight(uint weight_range, float weight)
+{
+	uint q = (uint)rint(weight * weight_range);
+	return clamp(q, 0u, weight_range);
+}
+
+float4 sample_texel(float4 texels[BLOCK_SIZE], uint4 index, float4 coff)
+{
+	float4 sum = texels[index.x] * coff.x;
+	sum += texels[index.y] * coff.y;
+	sum += texels[index.z] * coff.z;
+	sum += texels[index.w] * coff.w;
+	return sum;
+}
+
+// grid_sample_taps() of ASTC_BlockEncode.hlsl
+void grid_sample_taps(uint i, uint4* index, float4* coff)
+{
+	float u = (float)((i % X_GRIDS) * (BLOCK_DIM_X - 1)) / (X_GRIDS - 1);
+	float v = (float)((i / X_GRIDS) * (BLOCK_DIM_Y - 1)) / (Y_GRIDS - 1);
+	uint x0 = (uint)u;
+	uint y0 = (uint)v;
+	uint x1 = (x0 + 1 < BLOCK_DIM_X) ? x0 + 1 : x0;
+	uint y1 = (y0 + 1 < BLOCK_DIM_Y) ? y0 + 1 : y0;
+	float fx = u - x0;
+	float fy = v - y0;
+	*index = (uint4)(y0 * BLOCK_DIM_X + x0, y0 * BLOCK_DIM_X + x1, y1 * BLOCK_DIM_X + x0, y1 * BLOCK_DIM_X + x1);
+	*coff = (float4)((1.0f - fx) * (1.0f - fy), fx * (1.0f - fy), (1.0f - fx) * fy, fx * fy);
+}
+
+void calculate_normal_weights(float4 texels[BLOCK_SIZE],
+	float4 ep0,
+	float4 ep1,
+	float projw[X_GRIDS * Y_GRIDS])
+{
+	int i = 0;
+	float4 vec_k = ep1 - ep0;
+	if (length(vec_k) < SMALL_VALUE)
+	{
+		for (i = 0; i < X_GRIDS * Y_GRIDS; ++i)
+		{
+			projw[i] = 0;
+		}
+	}
+	else
+	{
+		vec_k = normalize_hlsl(vec_k);
+		float minw = 1e31f;
+		float maxw = -1e31f;
+#if DECIMATED_GRID
+		for (i = 0; i < X_GRIDS * Y_GRIDS; ++i)
+		{
+			uint4 index;
+			float4 coff;
+			grid_sample_taps(i, &index, &coff);
+			float4 sum = sample_texel(texels, index, coff);
+			float w = dot(vec_k, sum - ep0);
+			minw = min(w, minw);
+			maxw = max(w, maxw);
+			projw[i] = w;
+		}
+#else
+		// ensure "X_GRIDS * Y_GRIDS == BLOCK_SIZE"
+		for (i = 0; i < BLOCK_SIZE; ++i)
+		{
+			float4 texel = texels[i];
+			float w = dot(vec_k, texel - ep0);
+			minw = min(w, minw);
+			maxw = max(w, maxw);
+			projw[i] = w;
+		}
+#endif
+
+		float invlen = maxw - minw;
+		invlen = max(SMALL_VALUE, invlen);
+		invlen = 1.0f / invlen;
+		for (i = 0; i < X_GRIDS * Y_GRIDS; ++i)
+		{
+			projw[i] = (projw[i] - minw) * invlen;
+		}
+	}
+}
+
+void calculate_quantized_weights(float4 texels[BLOCK_SIZE],
+	uint weight_range,
+	float4 ep0,
+	float4 ep1,
+	uint weights[X_GRIDS * Y_GRIDS])
+{
+	float projw[X_GRIDS * Y_GRIDS];
+	calculate_normal_weights(texels, ep0, ep1, projw);
+	for (int i = 0; i < X_GRIDS * Y_GRIDS; ++i)
+	{
+		weights[i] = quantize_weight(weight_range, projw[i]);
+	}
+}
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// encode single partition
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+uint4 assemble_block(uint blockmode, uint color_endpoint_mode, uint4 ep_ise, uint4 wt_ise)
+{
+	uint4 phy_blk = (uint4)(0, 0, 0, 0);
+	// weights ise
+	phy_blk.w |= reverse_byte(wt_ise.x & 0xFF) << 24;
+	phy_blk.w |= reverse_byte((wt_ise.x >> 8) & 0xFF) << 16;
+	phy_blk.w |= reverse_byte((wt_ise.x >> 16) & 0xFF) << 8;
+	phy_blk.w |= reverse_byte((wt_ise.x >> 24) & 0xFF);
+
+	phy_blk.z |= reverse_byte(wt_ise.y & 0xFF) << 24;
+	phy_blk.z |= reverse_byte((wt_ise.y >> 8) & 0xFF) << 16;
+	phy_blk.z |= reverse_byte((wt_ise.y >> 16) & 0xFF) << 8;
+	phy_blk.z |= reverse_byte((wt_ise.y >> 24) & 0xFF);
+
+	// blockmode is 11 bit, cem is 4 bit
+	phy_blk.x = blockmode;
+	phy_blk.x |= (color_endpoint_mode & 0xF) << 13;
+
+	// endpoints start from bit 17
+	phy_blk.x |= (ep_ise.x & 0x7FFF) << 17;
+	phy_blk.y = ((ep_ise.x >> 15) & 0x1FFFF);
+	phy_blk.y |= (ep_ise.y & 0x7FFF) << 17;
+	phy_blk.z |= ((ep_ise.y >> 15) & 0x1FFFF);
+
+	return phy_blk;
+}
+
+uint assemble_blockmode(uint weight_quantmethod)
+{
+	// the first row of "Table C.2.8 - 2D Block Mode Layout", see the shader
+	uint a = (Y_GRIDS - 2) & 0x3;
+	uint b = (X_GRIDS - 4) & 0x3;
+
+	uint d = 0;  // dual plane
+
+	uint h = (weight_quantmethod < 6) ? 0 : 1;	// "a precision bit H"
+	uint r = (weight_quantmethod % 6) + 2;		// "The weight ranges are encoded using a 3 bit value R"
+
+	// block mode
+	uint blockmode = (r >> 1) & 0x3;
+	blockmode |= (r & 0x1) << 4;
+	blockmode |= (a & 0x3) << 5;
+	blockmode |= (b & 0x3) << 7;
+	blockmode |= h << 9;
+	blockmode |= d << 10;
+	return blockmode;
+}
+
+uint4 endpoint_ise(float4 ep0, float4 ep1, uint endpoint_quantmethod)
+{
+	// for QUANT_256 quantization
+	uint4 e0q = convert_uint4(rint(ep0));
+	uint4 e1q = convert_uint4(rint(ep1));
+	uint ep_quantized[8] = { e0q.x, e1q.x, e0q.y, e1q.y, e0q.z, e1q.z, e0q.w, e1q.w };
+#if !HAS_ALPHA
+	ep_quantized[6] = 0;
+	ep_quantized[7] = 0;
+#endif
+
+	// endpoints quantized ise encode
+	uint4 ep_ise = 0;
+	bise_endpoints(ep_quantized, endpoint_quantmethod, &ep_ise);
+	return ep_ise;
+}
+
+uint4 weight_ise(float4 texels[BLOCK_SIZE], uint weight_range, float4 ep0, float4 ep1, uint weight_quantmethod)
+{
+	// encode weights
+	uint wt_quantized[X_GRIDS * Y_GRIDS];
+	calculate_quantized_weights(texels, weight_range, ep0, ep1, wt_quantized);
+
+	for (int i = 0; i < X_GRIDS * Y_GRIDS; ++i)
+	{
+		int w = weight_quantmethod * WEIGHT_QUANTIZE_NUM + wt_quantized[i];
+		wt_quantized[i] = scramble_table[w];
+	}
+
+	// weights quantized ise encode
+	uint4 wt_ise = 0;
+	bise_weights(wt_quantized, weight_quantmethod, &wt_ise);
+	return wt_ise;
+}
+
+// the first 64 bits of a 2d ldr void-extent block: blockmode 0x1FC, ldr, and all extent coordinates set (no extent)
+#define VOID_EXTENT_HEADER_LO 0xFFFFFDFC
+#define VOID_EXTENT_HEADER_HI 0xFFFFFFFF
+
+bool is_void_extent_block(float4 texels[BLOCK_SIZE], float tolerance, float4* color)
+{
+	float4 cmin = texels[0];
+	float4 cmax = texels[0];
+	for (int i = 1; i < BLOCK_SIZE; ++i)
+	{
+		cmin = fmin(cmin, texels[i]);
+		cmax = fmax(cmax, texels[i]);
+	}
+
+	float4 span = cmax - cmin;
+	*color = (cmin + cmax) * 0.5f;
+#if !HAS_ALPHA
+	span.w = 0;
+	(*color).w = 255.0f;
+#endif
+	return fmax(fmax(span.x, span.y), fmax(span.z, span.w)) <= tolerance;
+}
+
+uint4 encode_void_extent(float4 color)
+{
+	uint4 c = convert_uint4(rint(clamp(color, 0.0f, 255.0f) * 257.0f));
+	return (uint4)(VOID_EXTENT_HEADER_LO, VOID_EXTENT_HEADER_HI, c.x | (c.y << 16), c.z | (c.w << 16));
+}
+
+uint4 encode_block(float4 texels[BLOCK_SIZE])
+{
+	float4 color;
+	if (is_void_extent_block(texels, VOID_EXTENT_TOLERANCE, &color))
+	{
+		return encode_void_extent(color);
+	}
+
+	float4 ep0, ep1;
+	principal_component_analysis(texels, &ep0, &ep1);
+
+	// for fast compression!
+#if HAS_ALPHA
+	uint4 best_blockmode = (uint4)(QUANT_6, QUANT_256, 6, 7);
+#else
+	uint4 best_blockmode = (uint4)(QUANT_12, QUANT_256, 12, 7);
+#endif
+
+	uint weight_quantmethod = best_blockmode.x;
+	uint endpoint_quantmethod = best_blockmode.y;
+	uint weight_range = best_blockmode.z;
+
+	uint blockmode = assemble_blockmode(weight_quantmethod);
+
+	uint4 ep_ise = endpoint_ise(ep0, ep1, endpoint_quantmethod);
+
+	uint4 wt_ise = weight_ise(texels, weight_range - 1, ep0, ep1, weight_quantmethod);
+
+	// assemble to astcblock
+#if HAS_ALPHA
+	uint color_endpoint_mode = CEM_LDR_RGBA_DIRECT;
+#else
+	uint color_endpoint_mode = CEM_LDR_RGB_DIRECT;
+#endif
+	return assemble_block(blockmode, color_endpoint_mode, ep_ise, wt_ise);
+}
+
+#if IS_SRGB
+float4 srgb_to_linear(float4 c)
+{
+	return select(pow((c + 0.055f) / 1.055f, 2.4f), c / 12.92f, c <= 0.04045f);
+}
+#endif
+
+__kernel __attribute__((reqd_work_group_size(THREAD_NUM_X, THREAD_NUM_Y, 1)))
+void MainCS(__read_only image2d_t InTexture,
+	__global uint4* OutBuffer,
+	int InTexelHeight,
+	int InTexelWidth,
+	int InGroupNumX)
+{
+	const sampler_t point_sampler = CLK_NORMALIZED_COORDS_FALSE | CLK_ADDRESS_CLAMP | CLK_FILTER_NEAREST;
+
+	// DTid of the shader
+	uint2 DTid = (uint2)(get_global_id(0), get_global_id(1));
+
+	uint blockID = DTid.y * InGroupNumX * THREAD_NUM_X + DTid.x;
+	uint BlockNum = (InTexelWidth + BLOCK_DIM_X - 1) / BLOCK_DIM_X;
+	uint TotalBlockNum = BlockNum * ((InTexelHeight + BLOCK_DIM_Y - 1) / BLOCK_DIM_Y);
+	if (blockID >= TotalBlockNum) {
+		return;
+	}
+
+	uint2 blockPos;
+	blockPos.y = (uint)(blockID / BlockNum);
+	blockPos.x = blockID - blockPos.y * BlockNum;
+
+	float4 texels[BLOCK_SIZE];
+	for (int k = 0; k < BLOCK_SIZE; ++k)
+	{
+		uint y = k / BLOCK_DIM_X;
+		uint x = k - y * BLOCK_DIM_X;
+		uint2 pixelPos = blockPos * (uint2)(BLOCK_DIM_X, BLOCK_DIM_Y) + (uint2)(x, y);
+		float4 texel = 0;
+		if (pixelPos.x < (uint)InTexelWidth && pixelPos.y < (uint)InTexelHeight) {
+			texel = read_imagef(InTexture, point_sampler, convert_int2(pixelPos));
+#if IS_SRGB
+			texel.xyz = srgb_to_linear(texel).xyz;
+#endif
+		}
+#if IS_NORMALMAP
+		texel.z = 1.0f;
+		texel.w = 1.0f;
+#endif
+		texels[k] = texel * 255.0f;
+	}
+	OutBuffer[blockID] = encode_block(texels);
+}
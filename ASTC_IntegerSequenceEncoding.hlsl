@@ -1,76 +1,3 @@
- /**
-  * Table that describes the number of trits or quints along with bits required
-  * for storing each range.
-  */
-static const int bits_trits_quints_table[QUANT_MAX * 3] =
-{
-	1, 0, 0,  // RANGE_2
-	0, 1, 0,  // RANGE_3
-	2, 0, 0,  // RANGE_4
-	0, 0, 1,  // RANGE_5
-	1, 1, 0,  // RANGE_6
-	3, 0, 0,  // RANGE_8
-	1, 0, 1,  // RANGE_10
-	2, 1, 0,  // RANGE_12
-	4, 0, 0,  // RANGE_16
-	2, 0, 1,  // RANGE_20
-	3, 1, 0,  // RANGE_24
-	5, 0, 0,  // RANGE_32
-	3, 0, 1,  // RANGE_40
-	4, 1, 0,  // RANGE_48
-	6, 0, 0,  // RANGE_64
-	4, 0, 1,  // RANGE_80
-	5, 1, 0,  // RANGE_96
-	7, 0, 0,  // RANGE_128
-	5, 0, 1,  // RANGE_160
-	6, 1, 0,  // RANGE_192
-	8, 0, 0   // RANGE_256
-};
-
-static const int integer_from_trits[243] =
-{
-	0,1,2,    4,5,6,    8,9,10, 
-	16,17,18, 20,21,22, 24,25,26,
-	3,7,15,   19,23,27, 12,13,14, 
-	32,33,34, 36,37,38, 40,41,42,
-	48,49,50, 52,53,54, 56,57,58,
-	35,39,47, 51,55,59, 44,45,46, 
-	64,65,66, 68,69,70, 72,73,74,
-	80,81,82, 84,85,86, 88,89,90,
-	67,71,79, 83,87,91, 76,77,78,
-
-	128,129,130, 132,133,134, 136,137,138,
-	144,145,146, 148,149,150, 152,153,154,
-	131,135,143, 147,151,155, 140,141,142,
-	160,161,162, 164,165,166, 168,169,170,
-	176,177,178, 180,181,182, 184,185,186,
-	163,167,175, 179,183,187, 172,173,174,
-	192,193,194, 196,197,198, 200,201,202,
-	208,209,210, 212,213,214, 216,217,218,
-	195,199,207, 211,215,219, 204,205,206,
-
-	96,97,98, 	 100,101,102, 104,105,106,
-	112,113,114, 116,117,118, 120,121,122,
-	99,103,111,  115,119,123, 108,109,110, 
-	224,225,226, 228,229,230, 232,233,234,
-	240,241,242, 244,245,246, 248,249,250,
-	227,231,239, 243,247,251, 236,237,238,
-	28,29,30, 	 60,61,62, 	  92,93,94, 
-	156,157,158, 188,189,190, 220,221,222,
-	31,63,127, 	 159,191,255, 252,253,254,
-
-};
-
-static const int integer_from_quints[125] =
-{
-	0,1,2,3,4, 			8,9,10,11,12, 			16,17,18,19,20,			24,25,26,27,28, 		5,13,21,29,6,
-	32,33,34,35,36, 	40,41,42,43,44, 		48,49,50,51,52, 		56,57,58,59,60, 		37,45,53,61,14,	
-	64,65,66,67,68, 	72,73,74,75,76, 		80,81,82,83,84, 		88,89,90,91,92, 		69,77,85,93,22,
-	96,97,98,99,100, 	104,105,106,107,108,	112,113,114,115,116,	120,121,122,123,124, 	101,109,117,125,30,	
-	102,103,70,71,38, 	110,111,78,79,46, 		118,119,86,87,54, 		126,127,94,95,62, 		39,47,55,63,31
-};
-
-
 // Compute the number of bits required to store a number of items in a specific
 // range using the bounded integer sequence encoding.
 uint compute_ise_bitcount(uint items, int range)
@@ -95,7 +22,7 @@ uint compute_ise_bitcount(uint items, int range)
 
 // 把number的低bitcount位写到bytes的bitoffset偏移处开始的位置
 // number must be <= 255; bitcount must be <= 8
-void orbits8_ptr(inout uint4 outputs, inout uint bitoffset, uint number, uint bitcount)
+void orbits8_ptr(ASTC_INOUT(uint4) outputs, ASTC_INOUT(uint) bitoffset, uint number, uint bitcount)
 {
 	//bitcount = clamp(bitcount, 0, 8);
 	//number &= (1 << bitcount) - 1;
@@ -107,7 +34,11 @@ void orbits8_ptr(inout uint4 outputs, inout uint bitoffset, uint number, uint bi
 
 	uint bytes[4] = {outputs.x, outputs.y, outputs.z, outputs.w};
 	bytes[uidx] |= (number << bit_idx);
-	bytes[uidx + 1] |= (nidx > uidx) ? (number >> (32 - bit_idx)) : 0;
+	// only touch the next word when the bits straddle it, bytes[4] is out of range in c++
+	if (nidx > uidx)
+	{
+		bytes[uidx + 1] |= (number >> (32 - bit_idx));
+	}
 
 	outputs.x = bytes[0];
 	outputs.y = bytes[1];
@@ -118,7 +49,7 @@ void orbits8_ptr(inout uint4 outputs, inout uint bitoffset, uint number, uint bi
 
 }
 
-void split_high_low(uint n, uint i, out int high, out uint low)
+void split_high_low(uint n, uint i, ASTC_OUT(int) high, ASTC_OUT(uint) low)
 {
 	uint low_mask = (uint)((1 << i) - 1);
 	low = n & low_mask;
@@ -145,7 +76,7 @@ void encode_trits(uint bitcount,
 	uint b2,
 	uint b3,
 	uint b4,
-	inout uint4 outputs, inout uint outpos)
+	ASTC_INOUT(uint4) outputs, ASTC_INOUT(uint) outpos)
 {
 	int t0, t1, t2, t3, t4;
 	uint m0, m1, m2, m3, m4;
@@ -182,7 +113,7 @@ void encode_quints(uint bitcount,
 	uint b0,
 	uint b1,
 	uint b2,
-	inout uint4 outputs, inout uint outpos)
+	ASTC_INOUT(uint4) outputs, ASTC_INOUT(uint) outpos)
 {
 	int q0, q1, q2;
 	uint m0, m1, m2;
@@ -204,7 +135,7 @@ void encode_quints(uint bitcount,
 
 }
 
-void bise_endpoints(uint numbers[8], int range, inout uint4 outputs)
+void bise_endpoints(uint numbers[8], int range, ASTC_INOUT(uint4) outputs)
 {
 	uint bitpos = 0;
 	uint bits = bits_trits_quints_table[range * 3 + 0];
@@ -240,7 +171,7 @@ void bise_endpoints(uint numbers[8], int range, inout uint4 outputs)
 
 }
 
-void bise_weights(uint numbers[16], int range, inout uint4 outputs)
+void bise_weights(uint numbers[16], int range, ASTC_INOUT(uint4) outputs)
 {
 	uint bitpos = 0;
 	uint bits = bits_trits_quints_table[range * 3 + 0];
@@ -275,3 +206,56 @@ void bise_weights(uint numbers[16], int range, inout uint4 outputs)
 
 }
 
+// the weights of a block, the weights of any grid of the footprint or the interleaved weights of both planes
+// of a dual plane block, "Table C.2.7" allows at most 64
+#define MAX_BLOCK_WEIGHTS ((MAX_GRID_WEIGHTS > 64) ? MAX_GRID_WEIGHTS : 64)
+
+// number "i" of a sequence of "count", the numbers past it are 0
+uint sequence_number(uint numbers[MAX_BLOCK_WEIGHTS], uint count, uint i)
+{
+	if (i < count)
+	{
+		return numbers[i];
+	}
+	return 0;
+}
+
+// the "count" weights of a block: the weights of its grid, or twice that interleaved for a dual plane block
+void bise_block_weights(uint numbers[MAX_BLOCK_WEIGHTS], uint count, int range, ASTC_INOUT(uint4) outputs)
+{
+	uint bitpos = 0;
+	uint bits = bits_trits_quints_table[range * 3 + 0];
+	uint trits = bits_trits_quints_table[range * 3 + 1];
+	uint quints = bits_trits_quints_table[range * 3 + 2];
+
+	uint i = 0;
+	if (trits == 1)
+	{
+		for (i = 0; i < count; i += 5)
+		{
+			encode_trits(bits, sequence_number(numbers, count, i), sequence_number(numbers, count, i + 1), sequence_number(numbers, count, i + 2),
+				sequence_number(numbers, count, i + 3), sequence_number(numbers, count, i + 4), outputs, bitpos);
+		}
+	}
+	else if (quints == 1)
+	{
+		for (i = 0; i < count; i += 3)
+		{
+			encode_quints(bits, sequence_number(numbers, count, i), sequence_number(numbers, count, i + 1), sequence_number(numbers, count, i + 2), outputs, bitpos);
+		}
+	}
+	else
+	{
+		for (i = 0; i < count; ++i)
+		{
+			orbits8_ptr(outputs, bitpos, numbers[i], bits);
+		}
+	}
+}
+
+// the 12 or 16 endpoints of a two partition block, the numbers past the endpoint count are 0.
+// trailing zeros encode to zero bits, so the bits of the whole 16 number sequence are the same as the shorter one
+void bise_partition_endpoints(uint numbers[16], int range, ASTC_INOUT(uint4) outputs)
+{
+	bise_weights(numbers, range, outputs);
+}
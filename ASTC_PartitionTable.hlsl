@@ -0,0 +1,5191 @@
+// generated by astc_table_gen.cpp, the 2 partition patterns of "C.2.21 Partition Pattern Generation" for every footprint.
+// the ones leaving a partition empty and the ones that only swap the partitions of an earlier pattern are left out.
+// a pattern takes PARTITION_2_WORDS_<W>X<H>[X<D>] consecutive words of the flat word stream of the uint4s:
+// bit i is the partition of texel i, the top 10 bits of its last word are the partition index.
+#ifndef ASTC_PARTITION_TABLE_HLSL
+#define ASTC_PARTITION_TABLE_HLSL
+
+#define PARTITION_2_COUNT_4X4 437
+#define PARTITION_2_WORDS_4X4 1
+static const uint4 partition_2_4x4[110] =
+{
+	uint4(0x00403376, 0x00801133, 0x00C066CD, 0x01006C00), uint4(0x01401137, 0x01C09983, 0x02003377, 0x0240FEEC),
+	uint4(0x0280CCEE, 0x02C00024, 0x03407FFF, 0x0380C933), uint4(0x03C00F80, 0x04001111, 0x044000FF, 0x04800F03),
+	uint4(0x05008888, 0x05408881, 0x05C07EC1, 0x06007733), uint4(0x0640888B, 0x0680070F, 0x06C0555D, 0x0700CCCC),
+	uint4(0x0740ECC8, 0x078077FF, 0x0840FF03, 0x090000F0), uint4(0x09402677, 0x09C00FFF, 0x0A800FF3, 0x0AC008CE),
+	uint4(0x0B00B888, 0x0B400136, 0x0BC0FFEE, 0x0C004444), uint4(0x0C40E813, 0x0C80FE80, 0x0CC00008, 0x0D40EEE0),
+	uint4(0x0D80EBFD, 0x0DC00001, 0x0E008003, 0x0E800ECF), uint4(0x0EC00810, 0x0F400133, 0x0F807770, 0x0FC001E8),
+	uint4(0x10400002, 0x10807773, 0x11003337, 0x1140037F), uint4(0x11800014, 0x11C0AE6E, 0x1200137F, 0x12408CEE),
+	uint4(0x12800120, 0x12C012C0, 0x130000EC, 0x1380FFF0), uint4(0x14C066EE, 0x15C0F02A, 0x1640100F, 0x168037F0),
+	uint4(0x16C0377F, 0x1780F0E0, 0x17C0662D, 0x1880017E), uint4(0x18C04666, 0x1900FEC3, 0x19408B7B, 0x1AC00137),
+	uint4(0x1B00DB7F, 0x1B408893, 0x1B80CCC5, 0x1BC0277F), uint4(0x1C401000, 0x1C8017FF, 0x1CC09CEE, 0x1D007310),
+	uint4(0x1DC0C801, 0x1E407477, 0x1E8011B4, 0x1F00E00F), uint4(0x1F40C007, 0x2000FB37, 0x2040B377, 0x20800281),
+	uint4(0x20C08889, 0x21803367, 0x21C0540F, 0x2240CC80), uint4(0x2280C01D, 0x22C03A82, 0x2380C813, 0x23C06777),
+	uint4(0x24000240, 0x248000E0, 0x24C07B7F, 0x2540C800), uint4(0x25808FF0, 0x25C07648, 0x2700008C, 0x2780088A),
+	uint4(0x27C0CD93, 0x2840F0FF, 0x29401007, 0x29C0B7EC), uint4(0x2A00EEDB, 0x2A40C40D, 0x2A8000C0, 0x2AC00007),
+	uint4(0x2B00ECF8, 0x2B801348, 0x2BC0980B, 0x2C400102), uint4(0x2D40C001, 0x2DC02222, 0x2E00B333, 0x2FC00446),
+	uint4(0x30808FEC, 0x30C05555, 0x31007766, 0x31800CFF), uint4(0x31C0BB67, 0x32C037F4, 0x33000013, 0x33807003),
+	uint4(0x33C000F7, 0x34008013, 0x3480CEFF, 0x34C03A20), uint4(0x3540C802, 0x358007F8, 0x35C0AA24, 0x36000110),
+	uint4(0x368080C0, 0x3700FC08, 0x37809B77, 0x3880FFC8), uint4(0x38C00112, 0x39802401, 0x39C011FD, 0x3A00FFF1),
+	uint4(0x3AC0A881, 0x3B003544, 0x3BC03777, 0x3D40A377), uint4(0x3D80F00F, 0x3DC01FE9, 0x3E00BB33, 0x3E40EEFF),
+	uint4(0x3E801F32, 0x3F00FF71, 0x3F40EFFC, 0x3F80001C), uint4(0x3FC0376E, 0x4040EF22, 0x408000B7, 0x4100C803),
+	uint4(0x418074EE, 0x4200FC0F, 0x4380FE03, 0x43C099BA), uint4(0x4440088C, 0x45408808, 0x45802774, 0x45C03366),
+	uint4(0x4600C000, 0x4640CCCE, 0x470017FE, 0x48C036ED), uint4(0x4940708E, 0x4AC09BA2, 0x4B803C03, 0x4C008877),
+	uint4(0x4C403FEF, 0x4C807748, 0x4CC000EE, 0x4D4017F0), uint4(0x4E800CF0, 0x4FC05198, 0x5100003F, 0x51408001),
+	uint4(0x51800070, 0x51C06ECE, 0x5240CDFB, 0x52808137), uint4(0x53C00222, 0x5440B376, 0x54C04489, 0x55408811),
+	uint4(0x55C0DBFF, 0x56000088, 0x56C0264C, 0x5700ED93), uint4(0x57C0EEE2, 0x5800F71E, 0x58800D36, 0x58C03BBB),
+	uint4(0x59C06666, 0x5A801322, 0x5C00B113, 0x5C800FCF), uint4(0x5D40F001, 0x5D8030FF, 0x5DC055DD, 0x5E004801),
+	uint4(0x5F003784, 0x6080BFC3, 0x60C020DD, 0x61007EC9), uint4(0x6140FC00, 0x62809377, 0x62C0130C, 0x63C00811),
+	uint4(0x6500EEE3, 0x66400200, 0x66C09893, 0x6700EEE6), uint4(0x68800EC0, 0x68C0DBF6, 0x69803E83, 0x69C0FC01),
+	uint4(0x6A80FECF, 0x6B800BEF, 0x6C00FB77, 0x6D80D378), uint4(0x6E400003, 0x6EC01FFF, 0x6F408887, 0x6FC09BBB),
+	uint4(0x7140E8FF, 0x71C0899B, 0x73C066ED, 0x75C0ECC9), uint4(0x7680F017, 0x76C0001F, 0x77007331, 0x7780CCC6),
+	uint4(0x77C07700, 0x790076C8, 0x79C0F2EE, 0x7A00FC8F), uint4(0x7A40D7FF, 0x7A800781, 0x7AC0C113, 0x7BC03003),
+	uint4(0x7C000017, 0x7C80D037, 0x7D00178E, 0x7E00FF01), uint4(0x7F804CC0, 0x7FC00009, 0x8040F813, 0x8140C883),
+	uint4(0x8180F87F, 0x82C0C44B, 0x830036C9, 0x83808301), uint4(0x83C020FE, 0x8440FEEE, 0x84800F8F, 0x84C02408),
+	uint4(0x85808CCC, 0x86C0BF01, 0x8780CFF0, 0x888008E0), uint4(0x88C0A245, 0x8940F00E, 0x8A40F008, 0x8B80F7ED),
+	uint4(0x8DC00888, 0x9080310F, 0x91404466, 0x91C0B337), uint4(0x9280477E, 0x92C0220D, 0x93C06643, 0x944000CE),
+	uint4(0x9480FF80, 0x94C0EFDD, 0x9580FD93, 0x9600EEE8), uint4(0x9640008F, 0x9680CFF9, 0x97406FFF, 0x97C098A8),
+	uint4(0x98C0F446, 0x9900F003, 0x998083FD, 0x99C00401), uint4(0x9AC033A6, 0x9B803408, 0x9C40F08C, 0x9CC08AAA),
+	uint4(0x9DC00449, 0x9E40CC4D, 0x9E804FFF, 0x9F8070FE), uint4(0x9FC09913, 0xA0C07519, 0xA1C0AABF, 0xA240137E),
+	uint4(0xA3C0DDDF, 0xA4808EF8, 0xA540C4CC, 0xA580CF1F), uint4(0xA5C0EEC9, 0xA600FFB7, 0xA6806CC8, 0xA800203F),
+	uint4(0xA840C9B7, 0xA880347F, 0xAA40C889, 0xAAC06CDD), uint4(0xAB00CEEF, 0xAB80FFC7, 0xAC80EECE, 0xAD407FEE),
+	uint4(0xAD800F0F, 0xADC01199, 0xAE00FFB9, 0xAF00B001), uint4(0xAFC003E8, 0xB040016C, 0xB0C07EEE, 0xB240DBB7),
+	uint4(0xB3002244, 0xB3C064CD, 0xB400EC87, 0xB500C4F9), uint4(0xB580817F, 0xB5C06489, 0xB6803FFC, 0xB6C0EEAA),
+	uint4(0xB700FFC1, 0xB800710F, 0xB98043B9, 0xBBC044C8), uint4(0xBC80FCF8, 0xBD00FFF3, 0xBE8001B4, 0xBF0072FE),
+	uint4(0xBF80E77B, 0xC040EF80, 0xC080EC8F, 0xC14078CE), uint4(0xC180CBFF, 0xC280F9FD, 0xC3006EC9, 0xC540E6DC),
+	uint4(0xC5C003F6, 0xC700F803, 0xC780E81F, 0xC7C01333), uint4(0xC8401EEE, 0xC880EE2E, 0xC900EB7F, 0xC9C022FF),
+	uint4(0xCA803C00, 0xCAC04892, 0xCB0011FF, 0xCC808017), uint4(0xCCC08822, 0xCD40EC89, 0xCE8000D7, 0xCF008EFF),
+	uint4(0xCFC084C9, 0xD0403FEC, 0xD0800040, 0xD100C89B), uint4(0xD1C0FFC3, 0xD2007001, 0xD28080F3, 0xD3C0722D),
+	uint4(0xD440E011, 0xD500C026, 0xD900FF3E, 0xDA004000), uint4(0xDA40B77F, 0xDB40037C, 0xDC40EFC0, 0xDD801B6F),
+	uint4(0xDDC0FFDD, 0xDE006EEE, 0xDE807F03, 0xDFC0FFBB), uint4(0xE040FBFF, 0xE080E868, 0xE0C099BB, 0xE180FC1F),
+	uint4(0xE1C07FEF, 0xE280EC03, 0xE3C02AAB, 0xE4807ECB), uint4(0xE4C09933, 0xE5C09DFC, 0xE6C0199B, 0xE7002C00),
+	uint4(0xE880898F, 0xE980E2EE, 0xEA40B7FF, 0xEA80C3F1), uint4(0xEBC08241, 0xEC408898, 0xECC0E644, 0xED00987F),
+	uint4(0xED80E007, 0xEDC0767D, 0xEE800FEE, 0xEF80836C), uint4(0xEFC0CEF7, 0xF0C000FD, 0xF1000FC8, 0xF180ED81),
+	uint4(0xF1C057C8, 0xF2C0FDD5, 0xF40037C8, 0xF5C0FF9F), uint4(0xF6C06E71, 0xF700136C, 0xF84000EF, 0xF880F8E0),
+	uint4(0xF8C0F002, 0xF98003C1, 0xF9C09998, 0xFB800FC0), uint4(0xFBC09333, 0xFC40FFE1, 0xFD407FE1, 0xFD800F01),
+	uint4(0xFDC073E6, 0xFE00EF00, 0xFEC03224, 0xFF80006C), uint4(0xFFC08022, 0x00000000, 0x00000000, 0x00000000),
+};
+
+#define PARTITION_2_COUNT_5X4 559
+#define PARTITION_2_WORDS_5X4 1
+static const uint4 partition_2_5x4[140] =
+{
+	uint4(0x00418CE6, 0x00808463, 0x00C31B8D, 0x01033200), uint4(0x01408467, 0x01CCA503, 0x02018CE7, 0x024FFBDC),
+	uint4(0x028E73DE, 0x02C84044, 0x0343BFFF, 0x038E6673), uint4(0x03C07F00, 0x04008421, 0x044001FF, 0x04807C03),
+	uint4(0x05042108, 0x054C6311, 0x05C3FB91, 0x060BDE73), uint4(0x064C631B, 0x06801C1F, 0x06CAD4AD, 0x070E739C),
+	uint4(0x074F7398, 0x078BDFFF, 0x07CC6318, 0x084FFC03), uint4(0x090003E0, 0x094118E7, 0x09C07FFF, 0x0A807FE3),
+	uint4(0x0AC8639E, 0x0B0DE318, 0x0B480466, 0x0BCFFFCE), uint4(0x0C021084, 0x0C4F6223, 0x0C8FFB10, 0x0CC84008),
+	uint4(0x0D477BC0, 0x0D8F6DFD, 0x0DC00001, 0x0E0C4003), uint4(0x0E88399F, 0x0EC02220, 0x0F400463, 0x0F83DEE0),
+	uint4(0x0FC007D8, 0x10400002, 0x108BDCE3, 0x10C6318C), uint4(0x1109CC67, 0x11400CFF, 0x11800024, 0x11CD7ACE),
+	uint4(0x12008CEF, 0x124C73DE, 0x12800440, 0x12C08990), uint4(0x130803DC, 0x138FFFE0, 0x14CB5BDE, 0x15CF804A),
+	uint4(0x16000633, 0x1648C00F, 0x16819DF0, 0x16C19CEF), uint4(0x178F83C0, 0x17C3185D, 0x1847BDFF, 0x188004FE),
+	uint4(0x18C218C6, 0x190FFB83, 0x194C2CFB, 0x1AC80467), uint4(0x1B0EEEEF, 0x1B4C6333, 0x1B863385, 0x1BC11CEF),
+	uint4(0x1C48C210, 0x1C809DFF, 0x1CC4F3DE, 0x1D0BCE30), uint4(0x1DC62201, 0x1E4390E7, 0x1E80C764, 0x1F0F001F),
+	uint4(0x1F4E0007, 0x200FEE67, 0x204D8CE7, 0x20880901), uint4(0x20CC6309, 0x210003FF, 0x2181CCC7, 0x21C2900F),
+	uint4(0x224E7310, 0x228E402D, 0x22C9EB02, 0x23866023), uint4(0x23C31CE7, 0x24000890, 0x2447BDEF, 0x248003D0),
+	uint4(0x24C3EEEF, 0x254E6000, 0x258C7FE0, 0x25CBDA98), uint4(0x264C631C, 0x268E6210, 0x2700431C, 0x274F7BCE),
+	uint4(0x2780631A, 0x27CE7723, 0x284F81FF, 0x2948C217), uint4(0x29CDDDCC, 0x2A0F7BBB, 0x2A46101D, 0x2A800190),
+	uint4(0x2AC84007, 0x2B0F73E8, 0x2B888C88, 0x2BC4A01B), uint4(0x2C480402, 0x2D4E4001, 0x2DC10842, 0x2E05CE63),
+	uint4(0x2E4FFFEF, 0x2F07FFFF, 0x2F8F83FF, 0x2FC01086), uint4(0x308C3FDC, 0x30CAD6B5, 0x31039CC6, 0x318873FF),
+	uint4(0x31C5AEC7, 0x32039DFF, 0x32C9DFE4, 0x33000023), uint4(0x33838003, 0x33C001E7, 0x340C0023, 0x34863BFF),
+	uint4(0x34C1EA50, 0x354E6202, 0x35805DF8, 0x35C56A54), uint4(0x36000420, 0x36400467, 0x368C0380, 0x370FF018),
+	uint4(0x378CEEF7, 0x384FFB99, 0x3887FF98, 0x38C00422), uint4(0x39462211, 0x39811201, 0x39C087FD, 0x3A0FFFE1),
+	uint4(0x3AC56311, 0x3B019484, 0x3BC19CE7, 0x3D4D0CE7), uint4(0x3D8F801F, 0x3DC0BFD9, 0x3E0DEE73, 0x3E4739FF),
+	uint4(0x3E80FC62, 0x3F0FFCE1, 0x3F4F7FFC, 0x3F80002C), uint4(0x3FC9DCCE, 0x404F7C42, 0x40800367, 0x410E6203),
+	uint4(0x41400218, 0x4183D1CE, 0x420FF21F, 0x4248001F), uint4(0x42C00008, 0x4387FA03, 0x43CCE77A, 0x4448631C),
+	uint4(0x44C38C20, 0x45442218, 0x45895CF4, 0x45C98CC6), uint4(0x460E0000, 0x464E739E, 0x46842118, 0x47009DFE),
+	uint4(0x47C42210, 0x48C9D9CD, 0x4943831E, 0x49C8CCEF), uint4(0x4A089DFF, 0x4ACCEF52, 0x4B0C4200, 0x4B81F003),
+	uint4(0x4C0420F7, 0x4C41BFDF, 0x4C839C98, 0x4CC803DE), uint4(0x4D489DE0, 0x4E8073E0, 0x4F4E6201, 0x4FC28528),
+	uint4(0x50C80023, 0x5100006F, 0x51444001, 0x518000F0), uint4(0x51C3398E, 0x524E77FB, 0x528C4467, 0x5309CCE7),
+	uint4(0x53C84A42, 0x544DCCE6, 0x54CA1109, 0x55446231), uint4(0x5587FF1F, 0x55C6EDFF, 0x56000108, 0x56C9588C),
+	uint4(0x570F7733, 0x574C0001, 0x578C6210, 0x57CF79C2), uint4(0x58079C3E, 0x58887666, 0x58C1AD7B, 0x59C318C6),
+	uint4(0x5A4FFF98, 0x5A808C42, 0x5B400007, 0x5C0DC423), uint4(0x5C807F8F, 0x5D4F8001, 0x5D8183FF, 0x5DC295AD),
+	uint4(0x5E022201, 0x5F01DF04, 0x5F444000, 0x608DBF83), uint4(0x60C101AD, 0x6103BB99, 0x614FF200, 0x61C46210),
+	uint4(0x628CCCE7, 0x62C0CC0C, 0x63C02021, 0x650779C3), uint4(0x65440201, 0x65C04221, 0x66400800, 0x66804218),
+	uint4(0x66CCE123, 0x670739C6, 0x68803B90, 0x68C6ADE6), uint4(0x690C0000, 0x6981BB13, 0x69CFF001, 0x6A87FB9F),
+	uint4(0x6B806DDF, 0x6C0FEEE7, 0x6D8E8CE8, 0x6DCEEFFF), uint4(0x6E400003, 0x6EC0BFFF, 0x6F4C6107, 0x6FCCEF7B),
+	uint4(0x7043BFEF, 0x714F61FF, 0x7188C610, 0x71CC673B), uint4(0x7387BDDE, 0x73C319DD, 0x7449DEEF, 0x75CF7399),
+	uint4(0x764F6000, 0x768F8027, 0x76C8003F, 0x77038C61), uint4(0x77867386, 0x77CBDC00, 0x788F800C, 0x790B9998),
+	uint4(0x79807FEF, 0x79CF89DE, 0x7A0FF30F, 0x7A469DFF), uint4(0x7A801F01, 0x7ACE4423, 0x7BC9C203, 0x7C000027),
+	uint4(0x7C8E8277, 0x7D009D1E, 0x7D4739CE, 0x7DC04210), uint4(0x7E0FFC01, 0x7E4BDEF3, 0x7F07F201, 0x7F827380),
+	uint4(0x7FC84219, 0x804FE023, 0x810803FF, 0x814E6313), uint4(0x8187E0FF, 0x81C73399, 0x8240003F, 0x82C6109B),
+	uint4(0x83019999, 0x838C0E01, 0x83C103FE, 0x844FFBDE), uint4(0x84807F1F, 0x84C11008, 0x854431CE, 0x858C739C),
+	uint4(0x868FC0FF, 0x86CDFC01, 0x878E7FE0, 0x888863C0), uint4(0x88C50A85, 0x894F801E, 0x89898213, 0x89C04002),
+	uint4(0x8A4F8218, 0x8A8C2D18, 0x8B8F9FDD, 0x8CC803FC), uint4(0x8DC02108, 0x8E4003F0, 0x8F00639E, 0x8FC99CE7),
+	uint4(0x9081840F, 0x90CB5AD6, 0x914210C6, 0x91CDCE77), uint4(0x92821EEE, 0x92C9480D, 0x93CB1883, 0x9440439E),
+	uint4(0x9487FF00, 0x94C73FBD, 0x9587F723, 0x96077BD8), uint4(0x9640031F, 0x968E3FF9, 0x97433FFF, 0x97800200),
+	uint4(0x97CCE358, 0x980001E0, 0x98CF9086, 0x990F8003), uint4(0x998C0FFD, 0x99C01001, 0x9A0F800F, 0x9AC18F56),
+	uint4(0x9B819218, 0x9BC943FE, 0x9C47810C, 0x9CCC6B5A), uint4(0x9DC01089, 0x9E4E309D, 0x9E823FFF, 0x9F008673),
+	uint4(0x9F8383FE, 0x9FC4A423, 0xA0CBD639, 0xA14001FC), uint4(0xA1CD6B7F, 0xA2488CEE, 0xA3000044, 0xA3C6F7BF),
+	uint4(0xA48C7BF8, 0xA54E119C, 0xA58E7C3F, 0xA5C73B99), uint4(0xA60FFF77, 0xA6408400, 0xA6833398, 0xA708C21F),
+	uint4(0xA801006F, 0xA8462777, 0xA88192EF, 0xA8C86221), uint4(0xAA4E6319, 0xAAC373BD, 0xAB0E7BDF, 0xAB87FF87),
+	uint4(0xABC80027, 0xAC8F7B9E, 0xAD07BCE7, 0xAD4BFFDE), uint4(0xAD807C1F, 0xADC08529, 0xAE0FFF79, 0xAE4073FF),
+	uint4(0xAF0DC211, 0xAF800380, 0xAFC00FD8, 0xB04004CC), uint4(0xB0CBF9CE, 0xB1440001, 0xB1CFBFFC, 0xB24EED67),
+	uint4(0xB3010884, 0xB3CB538D, 0xB40F7317, 0xB50613F9), uint4(0xB5442319, 0xB58C04FF, 0xB5C31109, 0xB681BFFC),
+	uint4(0xB6CF7B4A, 0xB70FFF81, 0xB803841F, 0xB8C5AD6B), uint4(0xB9820D79, 0xBB07FFF8, 0xBBC21188, 0xBC8FB1F8),
+	uint4(0xBD0FFFF3, 0xBD8000FF, 0xBE804764, 0xBEC42129), uint4(0xBF038BFE, 0xBF871CFB, 0xC0000210, 0xC04F7F00),
+	uint4(0xC08F710F, 0xC108006F, 0xC14BA39E, 0xC1862DEF), uint4(0xC2084CFF, 0xC287E5FD, 0xC3037B99, 0xC3808000),
+	uint4(0xC4803FE0, 0xC5471BBC, 0xC5C00FF6, 0xC60C4210), uint4(0xC70FE003, 0xC78F603F, 0xC7C08C63, 0xC840BBDE),
+	uint4(0xC88F385E, 0xC90F6EFF, 0xC9C109FF, 0xCA81B200), uint4(0xCAC22132, 0xCB0887FF, 0xCB87BFFF, 0xCC8C0027),
+	uint4(0xCCC42042, 0xCD473319, 0xCDC5AD7B, 0xCE8003A7), uint4(0xCF0439FF, 0xCF82339C, 0xCFCC1199, 0xD041FFDC),
+	uint4(0xD0800080, 0xD0C7B99C, 0xD10E613B, 0xD1CFFF93), uint4(0xD2038001, 0xD28C41E3, 0xD3484633, 0xD3C3885D),
+	uint4(0xD4470021, 0xD50E0046, 0xD6880DFF, 0xD74F9C3E), uint4(0xD88F0000, 0xD90FBC7E, 0xD98FF00F, 0xD9C94A52),
+	uint4(0xDA020000, 0xDA4DDCEF, 0xDB0043FE, 0xDB400CFC), uint4(0xDB8B8233, 0xDC473D90, 0xDD88ECCF, 0xDDCFBDAD),
+	uint4(0xDE033BDE, 0xDE83FC03, 0xDEC7BDED, 0xDFCFFF7B), uint4(0xE04FEFFF, 0xE08F60D8, 0xE0CCE77B, 0xE1480CFF),
+	uint4(0xE18FF23F, 0xE1C3BFDF, 0xE2877203, 0xE34C611B), uint4(0xE3C1294B, 0xE483FB9B, 0xE4CCE673, 0xE5C4F7FC),
+	uint4(0xE6C8A52B, 0xE7013200, 0xE7C4A631, 0xE8400021), uint4(0xE88C671F, 0xE9473DFF, 0xE9870BDE, 0xE9C66200),
+	uint4(0xEA0F6001, 0xEA4DDDFF, 0xEA8E0FF1, 0xEB439CF7), uint4(0xEB8FFF80, 0xEBC44881, 0xEC446338, 0xECCF5A94),
+	uint4(0xED0CE0EF, 0xED874007, 0xEDC398ED, 0xEE883FDE), uint4(0xEECE633B, 0xEF8C4CCC, 0xEFCE7BF7, 0xF0C801ED),
+	uint4(0xF1007F98, 0xF18F7511, 0xF1CADF88, 0xF28C4223), uint4(0xF2C7F7B5, 0xF3CBDEE3, 0xF4019D98, 0xF50FC000),
+	uint4(0xF5CFFF3F, 0xF68E7BFF, 0xF6CB78E1, 0xF7008CCC), uint4(0xF84003DF, 0xF887E3C0, 0xF8CFC212, 0xF947BD88),
+	uint4(0xF9800F91, 0xF9CCE738, 0xFA47FC01, 0xFB807F80), uint4(0xFBCCCE73, 0xFC4FFFC1, 0xFC878218, 0xFD43BFD1),
+	uint4(0xFD803C01, 0xFDCB8DC6, 0xFE0F7E00, 0xFEC98844), uint4(0xFF084023, 0xFF8000DC, 0xFFCC4052, 0x00000000),
+};
+
+#define PARTITION_2_COUNT_5X5 659
+#define PARTITION_2_WORDS_5X5 2
+static const uint4 partition_2_5x5[330] =
+{
+	uint4(0x01918CE6, 0x00400000, 0x00008463, 0x00800000), uint4(0x00331B8D, 0x00C00000, 0x00333200, 0x01000000),
+	uint4(0x00108467, 0x01400000, 0x00BCA503, 0x01C00000), uint4(0x00118CE7, 0x02000000, 0x01FFFBDC, 0x02400000),
+	uint4(0x01CE73DE, 0x02800000, 0x01884044, 0x02C00000), uint4(0x0073BFFF, 0x03400000, 0x00CE6673, 0x03800000),
+	uint4(0x00007F00, 0x03C00000, 0x00108421, 0x04000000), uint4(0x000001FF, 0x04400000, 0x00007C03, 0x04800000),
+	uint4(0x00842108, 0x05000000, 0x01CC6311, 0x05400000), uint4(0x0003FB91, 0x05C00000, 0x017BDE73, 0x06000000),
+	uint4(0x018C631B, 0x06400000, 0x00001C1F, 0x06800000), uint4(0x014AD4AD, 0x06C00000, 0x01CE739C, 0x07000000),
+	uint4(0x01EF7398, 0x07400000, 0x017BDFFF, 0x07800000), uint4(0x018C6318, 0x07C00000, 0x01FFFC03, 0x08400000),
+	uint4(0x01000000, 0x08800000, 0x000003E0, 0x09000000), uint4(0x002118E7, 0x09400000, 0x00407FFF, 0x09C00000),
+	uint4(0x01F07FE3, 0x0A800000, 0x0008639E, 0x0AC00000), uint4(0x018DE318, 0x0B000000, 0x01080466, 0x0B400000),
+	uint4(0x000FFFCE, 0x0BC00000, 0x00421084, 0x0C000000), uint4(0x00FF6223, 0x0C400000, 0x00FFFB10, 0x0C800000),
+	uint4(0x01884008, 0x0CC00000, 0x00677BC0, 0x0D400000), uint4(0x00FF6DFD, 0x0D800000, 0x00000001, 0x0DC00000),
+	uint4(0x01CC4003, 0x0E000000, 0x0198399F, 0x0E800000), uint4(0x00402220, 0x0EC00000, 0x01FF8000, 0x0F000000),
+	uint4(0x01000463, 0x0F400000, 0x0063DEE0, 0x0F800000), uint4(0x000007D8, 0x0FC00000, 0x01800002, 0x10400000),
+	uint4(0x017BDCE3, 0x10800000, 0x00C6318C, 0x10C00000), uint4(0x0119CC67, 0x11000000, 0x00300CFF, 0x11400000),
+	uint4(0x00000024, 0x11800000, 0x01ED7ACE, 0x11C00000), uint4(0x00008CEF, 0x12000000, 0x000C73DE, 0x12400000),
+	uint4(0x00000440, 0x12800000, 0x00008990, 0x12C00000), uint4(0x018803DC, 0x13000000, 0x0004218C, 0x13400000),
+	uint4(0x000FFFE0, 0x13800000, 0x000FFFFF, 0x14400000), uint4(0x000F8000, 0x14800000, 0x016B5BDE, 0x14C00000),
+	uint4(0x00FF804A, 0x15C00000, 0x01F00633, 0x16000000), uint4(0x0138C00F, 0x16400000, 0x00319DF0, 0x16800000),
+	uint4(0x00319CEF, 0x16C00000, 0x00EF7BDE, 0x17000000), uint4(0x01CF83C0, 0x17800000, 0x00F3185D, 0x17C00000),
+	uint4(0x01F7BDFF, 0x18400000, 0x010004FE, 0x18800000), uint4(0x004218C6, 0x18C00000, 0x01FFFB83, 0x19000000),
+	uint4(0x018C2CFB, 0x19400000, 0x01008CEF, 0x1A400000), uint4(0x01080467, 0x1AC00000, 0x01EEEEEF, 0x1B000000),
+	uint4(0x008C6333, 0x1B400000, 0x01C63385, 0x1B800000), uint4(0x00011CEF, 0x1BC00000, 0x0138C210, 0x1C400000),
+	uint4(0x00009DFF, 0x1C800000, 0x0094F3DE, 0x1CC00000), uint4(0x000BCE30, 0x1D000000, 0x00462201, 0x1DC00000),
+	uint4(0x0000001F, 0x1E000000, 0x007390E7, 0x1E400000), uint4(0x01E0C764, 0x1E800000, 0x01FF001F, 0x1F000000),
+	uint4(0x01FE0007, 0x1F400000, 0x002FEE67, 0x20000000), uint4(0x01ED8CE7, 0x20400000, 0x00080901, 0x20800000),
+	uint4(0x009C6309, 0x20C00000, 0x01F003FF, 0x21000000), uint4(0x0111CCC7, 0x21800000, 0x00D2900F, 0x21C00000),
+	uint4(0x01EE7310, 0x22400000, 0x002E402D, 0x22800000), uint4(0x0039EB02, 0x22C00000, 0x00766023, 0x23800000),
+	uint4(0x01631CE7, 0x23C00000, 0x00000890, 0x24000000), uint4(0x00F7BDEF, 0x24400000, 0x01C003D0, 0x24800000),
+	uint4(0x0003EEEF, 0x24C00000, 0x01F08C67, 0x25000000), uint4(0x01FE6000, 0x25400000, 0x01FC7FE0, 0x25800000),
+	uint4(0x016BDA98, 0x25C00000, 0x010C631C, 0x26400000), uint4(0x00CE6210, 0x26800000, 0x008C6318, 0x26C00000),
+	uint4(0x0000431C, 0x27000000, 0x00EF7BCE, 0x27400000), uint4(0x0190631A, 0x27800000, 0x010E7723, 0x27C00000),
+	uint4(0x01FF81FF, 0x28400000, 0x0138C217, 0x29400000), uint4(0x01DDDDCC, 0x29C00000, 0x01FF7BBB, 0x2A000000),
+	uint4(0x01C6101D, 0x2A400000, 0x01C00190, 0x2A800000), uint4(0x01884007, 0x2AC00000, 0x01EF73E8, 0x2B000000),
+	uint4(0x00C88C88, 0x2B800000, 0x01B4A01B, 0x2BC00000), uint4(0x001001FF, 0x2C000000, 0x01080402, 0x2C400000),
+	uint4(0x007E4001, 0x2D400000, 0x001003FF, 0x2D800000), uint4(0x00210842, 0x2DC00000, 0x0035CE63, 0x2E000000),
+	uint4(0x000FFFEF, 0x2E400000, 0x0077FFFF, 0x2F000000), uint4(0x01FF83FF, 0x2F800000, 0x00001086, 0x2FC00000),
+	uint4(0x00C42108, 0x30400000, 0x01FC3FDC, 0x30800000), uint4(0x015AD6B5, 0x30C00000, 0x00739CC6, 0x31000000),
+	uint4(0x000873FF, 0x31800000, 0x00D5AEC7, 0x31C00000), uint4(0x00339DFF, 0x32000000, 0x0039DFE4, 0x32C00000),
+	uint4(0x00F00023, 0x33000000, 0x00038003, 0x33800000), uint4(0x000001E7, 0x33C00000, 0x01EC0023, 0x34000000),
+	uint4(0x00CE739C, 0x34400000, 0x01F63BFF, 0x34800000), uint4(0x0101EA50, 0x34C00000, 0x01EE6202, 0x35400000),
+	uint4(0x00005DF8, 0x35800000, 0x00A56A54, 0x35C00000), uint4(0x00000420, 0x36000000, 0x00000467, 0x36400000),
+	uint4(0x01FC0380, 0x36800000, 0x01FFF018, 0x37000000), uint4(0x01CCEEF7, 0x37800000, 0x00000CFF, 0x38000000),
+	uint4(0x00FFFB99, 0x38400000, 0x0077FF98, 0x38800000), uint4(0x01000422, 0x38C00000, 0x00462211, 0x39400000),
+	uint4(0x01011201, 0x39800000, 0x011087FD, 0x39C00000), uint4(0x007FFFE1, 0x3A000000, 0x01356311, 0x3AC00000),
+	uint4(0x00719484, 0x3B000000, 0x01319CE7, 0x3BC00000), uint4(0x00F79C61, 0x3C000000, 0x00707FFF, 0x3C800000),
+	uint4(0x01ED0CE7, 0x3D400000, 0x01FF801F, 0x3D800000), uint4(0x0100BFD9, 0x3DC00000, 0x000DEE73, 0x3E000000),
+	uint4(0x00C739FF, 0x3E400000, 0x00F0FC62, 0x3E800000), uint4(0x007FFCE1, 0x3F000000, 0x01CF7FFC, 0x3F400000),
+	uint4(0x0100002C, 0x3F800000, 0x0139DCCE, 0x3FC00000), uint4(0x000003FF, 0x40000000, 0x01EF7C42, 0x40400000),
+	uint4(0x01000367, 0x40800000, 0x01EE6203, 0x41000000), uint4(0x00000218, 0x41400000, 0x0103D1CE, 0x41800000),
+	uint4(0x01FFF21F, 0x42000000, 0x0198001F, 0x42400000), uint4(0x00400008, 0x42C00000, 0x0007FA03, 0x43800000),
+	uint4(0x019CE77A, 0x43C00000, 0x01F8631C, 0x44400000), uint4(0x00F38C20, 0x44C00000, 0x0037FFE0, 0x45000000),
+	uint4(0x00C42218, 0x45400000, 0x00395CF4, 0x45800000), uint4(0x01198CC6, 0x45C00000, 0x01FE0000, 0x46000000),
+	uint4(0x01CE739E, 0x46400000, 0x00842118, 0x46800000), uint4(0x01FFFFDC, 0x46C00000, 0x00009DFE, 0x47000000),
+	uint4(0x0108631C, 0x47800000, 0x00442210, 0x47C00000), uint4(0x01CE7318, 0x48400000, 0x01B9D9CD, 0x48C00000),
+	uint4(0x0003831E, 0x49400000, 0x01000001, 0x49800000), uint4(0x0088CCEF, 0x49C00000, 0x01889DFF, 0x4A000000),
+	uint4(0x0108001F, 0x4A800000, 0x009CEF52, 0x4AC00000), uint4(0x01CC4200, 0x4B000000, 0x0101F003, 0x4B800000),
+	uint4(0x01F0001E, 0x4BC00000, 0x018420F7, 0x4C000000), uint4(0x0011BFDF, 0x4C400000, 0x00339C98, 0x4C800000),
+	uint4(0x011803DE, 0x4CC00000, 0x01089DE0, 0x4D400000), uint4(0x004E6210, 0x4E400000, 0x01F073E0, 0x4E800000),
+	uint4(0x01CE6201, 0x4F400000, 0x000FFDE7, 0x4F800000), uint4(0x00528528, 0x4FC00000, 0x01880023, 0x50C00000),
+	uint4(0x0000006F, 0x51000000, 0x00444001, 0x51400000), uint4(0x01F000F0, 0x51800000, 0x0163398E, 0x51C00000),
+	uint4(0x01EE77FB, 0x52400000, 0x01CC4467, 0x52800000), uint4(0x00CE7318, 0x52C00000, 0x01B9CCE7, 0x53000000),
+	uint4(0x01084A42, 0x53C00000, 0x00DDCCE6, 0x54400000), uint4(0x00008467, 0x54800000, 0x012A1109, 0x54C00000),
+	uint4(0x00C46231, 0x55400000, 0x0147FF1F, 0x55800000), uint4(0x0036EDFF, 0x55C00000, 0x01000108, 0x56000000),
+	uint4(0x01B9588C, 0x56C00000, 0x01FF7733, 0x57000000), uint4(0x006C0001, 0x57400000, 0x00CC6210, 0x57800000),
+	uint4(0x01EF79C2, 0x57C00000, 0x01F79C3E, 0x58000000), uint4(0x01C87666, 0x58800000, 0x0031AD7B, 0x58C00000),
+	uint4(0x01F001FF, 0x59000000, 0x006318C6, 0x59C00000), uint4(0x01FFFF98, 0x5A400000, 0x00108C42, 0x5A800000),
+	uint4(0x00000007, 0x5B400000, 0x01BDC423, 0x5C000000), uint4(0x00F07F8F, 0x5C800000, 0x00FF8001, 0x5D400000),
+	uint4(0x00F183FF, 0x5D800000, 0x005295AD, 0x5DC00000), uint4(0x00222201, 0x5E000000, 0x01F00007, 0x5E400000),
+	uint4(0x007FFF90, 0x5E800000, 0x0031DF04, 0x5F000000), uint4(0x00444000, 0x5F400000, 0x000DBF83, 0x60800000),
+	uint4(0x002101AD, 0x60C00000, 0x0033BB99, 0x61000000), uint4(0x01FFF200, 0x61400000, 0x013FFC1F, 0x61800000),
+	uint4(0x00846210, 0x61C00000, 0x001003FC, 0x62000000), uint4(0x007318C6, 0x62400000, 0x01CCCCE7, 0x62800000),
+	uint4(0x0000CC0C, 0x62C00000, 0x00002021, 0x63C00000), uint4(0x001F7B9C, 0x64C00000, 0x002779C3, 0x65000000),
+	uint4(0x00440201, 0x65400000, 0x00804221, 0x65C00000), uint4(0x00000800, 0x66400000, 0x00004218, 0x66800000),
+	uint4(0x01BCE123, 0x66C00000, 0x00E739C6, 0x67000000), uint4(0x01000023, 0x67C00000, 0x01003B90, 0x68800000),
+	uint4(0x0046ADE6, 0x68C00000, 0x00FC0000, 0x69000000), uint4(0x01808CEF, 0x69400000, 0x0011BB13, 0x69800000),
+	uint4(0x007FF001, 0x69C00000, 0x00119DFE, 0x6A000000), uint4(0x0017FB9F, 0x6A800000, 0x00006DDF, 0x6B800000),
+	uint4(0x002FEEE7, 0x6C000000, 0x010FFFFE, 0x6C400000), uint4(0x00000002, 0x6D400000, 0x000E8CE8, 0x6D800000),
+	uint4(0x01EEEFFF, 0x6DC00000, 0x00400000, 0x6E000000), uint4(0x00000003, 0x6E400000, 0x0000BFFF, 0x6EC00000),
+	uint4(0x0077BDEF, 0x6F000000, 0x018C6107, 0x6F400000), uint4(0x00F0001F, 0x6F800000, 0x00DCEF7B, 0x6FC00000),
+	uint4(0x0073BFEF, 0x70400000, 0x01FF61FF, 0x71400000), uint4(0x0118C610, 0x71800000, 0x018C673B, 0x71C00000),
+	uint4(0x01439CE4, 0x72800000, 0x00F7BDDE, 0x73800000), uint4(0x002319DD, 0x73C00000, 0x0139DEEF, 0x74400000),
+	uint4(0x01F003E0, 0x74800000, 0x00FF8000, 0x75400000), uint4(0x01E0001F, 0x75800000, 0x006F7399, 0x75C00000),
+	uint4(0x01FF6000, 0x76400000, 0x01EF8027, 0x76800000), uint4(0x0188003F, 0x76C00000, 0x00738C61, 0x77000000),
+	uint4(0x01967386, 0x77800000, 0x007BDC00, 0x77C00000), uint4(0x01000003, 0x78400000, 0x013F800C, 0x78800000),
+	uint4(0x013B9998, 0x79000000, 0x01C07FEF, 0x79800000), uint4(0x01EF89DE, 0x79C00000, 0x01FFF30F, 0x7A000000),
+	uint4(0x00069DFF, 0x7A400000, 0x01C01F01, 0x7A800000), uint4(0x01EE4423, 0x7AC00000, 0x00739DEF, 0x7B000000),
+	uint4(0x0079C203, 0x7BC00000, 0x01F00027, 0x7C000000), uint4(0x01CE8277, 0x7C800000, 0x00009D1E, 0x7D000000),
+	uint4(0x00E739CE, 0x7D400000, 0x00007FEF, 0x7D800000), uint4(0x00004210, 0x7DC00000, 0x00FFFC01, 0x7E000000),
+	uint4(0x000BDEF3, 0x7E400000, 0x0001BFDF, 0x7E800000), uint4(0x0037F201, 0x7F000000, 0x00339DEF, 0x7F400000),
+	uint4(0x00D27380, 0x7F800000, 0x00884219, 0x7FC00000), uint4(0x000FE023, 0x80400000, 0x01C803FF, 0x81000000),
+	uint4(0x01EE6313, 0x81400000, 0x0017E0FF, 0x81800000), uint4(0x00673399, 0x81C00000, 0x0100003F, 0x82400000),
+	uint4(0x00D6109B, 0x82C00000, 0x01119999, 0x83000000), uint4(0x018C0E01, 0x83800000, 0x002103FE, 0x83C00000),
+	uint4(0x000FFBDE, 0x84400000, 0x00F07F1F, 0x84800000), uint4(0x00211008, 0x84C00000, 0x008431CE, 0x85400000),
+	uint4(0x018C739C, 0x85800000, 0x000FC0FF, 0x86800000), uint4(0x01DDFC01, 0x86C00000, 0x01FE7FE0, 0x87800000),
+	uint4(0x01C863C0, 0x88800000, 0x00950A85, 0x88C00000), uint4(0x018803FF, 0x89000000, 0x01FF801E, 0x89400000),
+	uint4(0x01198213, 0x89800000, 0x00104002, 0x89C00000), uint4(0x01CF8218, 0x8A400000, 0x018C2D18, 0x8A800000),
+	uint4(0x01FF9FDD, 0x8B800000, 0x01CC6318, 0x8BC00000), uint4(0x001FFFFF, 0x8C400000, 0x00400002, 0x8C800000),
+	uint4(0x018803FC, 0x8CC00000, 0x01F02108, 0x8DC00000), uint4(0x000003F0, 0x8E400000, 0x01F0639E, 0x8F000000),
+	uint4(0x01399CE7, 0x8FC00000, 0x0171840F, 0x90800000), uint4(0x006B5AD6, 0x90C00000, 0x01CC4000, 0x91000000),
+	uint4(0x004210C6, 0x91400000, 0x01BDCE77, 0x91C00000), uint4(0x01108463, 0x92400000, 0x00321EEE, 0x92800000),
+	uint4(0x01E9480D, 0x92C00000, 0x0113FFDC, 0x93800000), uint4(0x017B1883, 0x93C00000, 0x0000439E, 0x94400000),
+	uint4(0x00F7FF00, 0x94800000, 0x00E73FBD, 0x94C00000), uint4(0x01FFFFD8, 0x95000000, 0x0007F723, 0x95800000),
+	uint4(0x01E0431C, 0x95C00000, 0x00477BD8, 0x96000000), uint4(0x0000031F, 0x96400000, 0x01FE3FF9, 0x96800000),
+	uint4(0x00433FFF, 0x97400000, 0x00100200, 0x97800000), uint4(0x018CE358, 0x97C00000, 0x000001E0, 0x98000000),
+	uint4(0x00CC4000, 0x98400000, 0x010800E0, 0x98800000), uint4(0x017F9086, 0x98C00000, 0x01FF8003, 0x99000000),
+	uint4(0x007C0FFD, 0x99800000, 0x00001001, 0x99C00000), uint4(0x01FF800F, 0x9A000000, 0x01FFFFEF, 0x9A400000),
+	uint4(0x01118F56, 0x9AC00000, 0x007C0001, 0x9B000000), uint4(0x000003FE, 0x9B400000, 0x01919218, 0x9B800000),
+	uint4(0x012943FE, 0x9BC00000, 0x00F7810C, 0x9C400000), uint4(0x019C6B5A, 0x9CC00000, 0x00201089, 0x9DC00000),
+	uint4(0x01CE309D, 0x9E400000, 0x00323FFF, 0x9E800000), uint4(0x01E08673, 0x9F000000, 0x01F383FE, 0x9F800000),
+	uint4(0x0094A423, 0x9FC00000, 0x017BD639, 0xA0C00000), uint4(0x000001FC, 0xA1400000, 0x003F800F, 0xA1800000),
+	uint4(0x01AD6B7F, 0xA1C00000, 0x01DFFB9C, 0xA2000000), uint4(0x01088CEE, 0xA2400000, 0x00000044, 0xA3000000),
+	uint4(0x01F0431C, 0xA3800000, 0x00C6F7BF, 0xA3C00000), uint4(0x010C7BF8, 0xA4800000, 0x01CE119C, 0xA5400000),
+	uint4(0x000E7C3F, 0xA5800000, 0x00773B99, 0xA5C00000), uint4(0x01FFFF77, 0xA6000000, 0x00108400, 0xA6400000),
+	uint4(0x00633398, 0xA6800000, 0x0178C21F, 0xA7000000), uint4(0x0031006F, 0xA8000000, 0x00662777, 0xA8400000),
+	uint4(0x013192EF, 0xA8800000, 0x01C86221, 0xA8C00000), uint4(0x00CE6319, 0xAA400000, 0x00E373BD, 0xAAC00000),
+	uint4(0x018E7BDF, 0xAB000000, 0x0117FF87, 0xAB800000), uint4(0x01880027, 0xABC00000, 0x0066EDFF, 0xAC000000),
+	uint4(0x01EF7B9E, 0xAC800000, 0x00F7BCE7, 0xAD000000), uint4(0x010BFFDE, 0xAD400000, 0x00007C1F, 0xAD800000),
+	uint4(0x00408529, 0xADC00000, 0x000FFF79, 0xAE000000), uint4(0x000073FF, 0xAE400000, 0x00F7FFFF, 0xAEC00000),
+	uint4(0x007DC211, 0xAF000000, 0x01C00218, 0xAF400000), uint4(0x01800380, 0xAF800000, 0x01000FD8, 0xAFC00000),
+	uint4(0x010004CC, 0xB0400000, 0x016BF9CE, 0xB0C00000), uint4(0x00340001, 0xB1400000, 0x004FBFFC, 0xB1C00000),
+	uint4(0x01CEED67, 0xB2400000, 0x01F07C00, 0xB2800000), uint4(0x00210884, 0xB3000000, 0x016B538D, 0xB3C00000),
+	uint4(0x01FF7317, 0xB4000000, 0x0007BCE7, 0xB4800000), uint4(0x01C613F9, 0xB5000000, 0x01F42319, 0xB5400000),
+	uint4(0x01EC04FF, 0xB5800000, 0x00231109, 0xB5C00000), uint4(0x0001BFFC, 0xB6800000, 0x000F7B4A, 0xB6C00000),
+	uint4(0x007FFF81, 0xB7000000, 0x00F3841F, 0xB8000000), uint4(0x01C00000, 0xB8800000, 0x00B5AD6B, 0xB8C00000),
+	uint4(0x00620D79, 0xB9800000, 0x0007FFF8, 0xBB000000), uint4(0x00221188, 0xBBC00000, 0x01800466, 0xBC400000),
+	uint4(0x00FFB1F8, 0xBC800000, 0x01FFFFF3, 0xBD000000), uint4(0x01F000FF, 0xBD800000, 0x00631084, 0xBE000000),
+	uint4(0x01F04764, 0xBE800000, 0x00C42129, 0xBEC00000), uint4(0x01F38BFE, 0xBF000000, 0x01F71CFB, 0xBF800000),
+	uint4(0x00000210, 0xC0000000, 0x000F7F00, 0xC0400000), uint4(0x002F710F, 0xC0800000, 0x01C8006F, 0xC1000000),
+	uint4(0x007BA39E, 0xC1400000, 0x00C62DEF, 0xC1800000), uint4(0x01884CFF, 0xC2000000, 0x0137E5FD, 0xC2800000),
+	uint4(0x00337B99, 0xC3000000, 0x00108000, 0xC3800000), uint4(0x00FFFB98, 0xC3C00000, 0x01803FE0, 0xC4800000),
+	uint4(0x01E71BBC, 0xC5400000, 0x00400FF6, 0xC5C00000), uint4(0x018C4210, 0xC6000000, 0x01FFE003, 0xC7000000),
+	uint4(0x01FF603F, 0xC7800000, 0x00108C63, 0xC7C00000), uint4(0x0020BBDE, 0xC8400000, 0x000F385E, 0xC8800000),
+	uint4(0x01FF6EFF, 0xC9000000, 0x000F801F, 0xC9800000), uint4(0x006109FF, 0xC9C00000, 0x0000BBDE, 0xCA000000),
+	uint4(0x0001B200, 0xCA800000, 0x00222132, 0xCAC00000), uint4(0x011887FF, 0xCB000000, 0x00EE6201, 0xCB400000),
+	uint4(0x0077BFFF, 0xCB800000, 0x01EC0027, 0xCC800000), uint4(0x00142042, 0xCCC00000, 0x00673319, 0xCD400000),
+	uint4(0x00B5AD7B, 0xCDC00000, 0x01F003A7, 0xCE800000), uint4(0x00F439FF, 0xCF000000, 0x0002339C, 0xCF800000),
+	uint4(0x01CC1199, 0xCFC00000, 0x0001FFDC, 0xD0400000), uint4(0x01F00080, 0xD0800000, 0x00F7B99C, 0xD0C00000),
+	uint4(0x01CE613B, 0xD1000000, 0x01FFFF93, 0xD1C00000), uint4(0x00738001, 0xD2000000, 0x006739CE, 0xD2400000),
+	uint4(0x018C41E3, 0xD2800000, 0x01084633, 0xD3400000), uint4(0x0073885D, 0xD3C00000, 0x00F70021, 0xD4400000),
+	uint4(0x016B5AD6, 0xD4C00000, 0x01CE0046, 0xD5000000), uint4(0x01880DFF, 0xD6800000, 0x01FF9C3E, 0xD7400000),
+	uint4(0x000F0000, 0xD8800000, 0x01FFBC7E, 0xD9000000), uint4(0x010F7B98, 0xD9400000, 0x003FF00F, 0xD9800000),
+	uint4(0x01294A52, 0xD9C00000, 0x00020000, 0xDA000000), uint4(0x01FDDCEF, 0xDA400000, 0x0007F201, 0xDA800000),
+	uint4(0x000043FE, 0xDB000000, 0x00000CFC, 0xDB400000), uint4(0x013B8233, 0xDB800000, 0x00000108, 0xDBC00000),
+	uint4(0x00C73D90, 0xDC400000, 0x0008ECCF, 0xDD800000), uint4(0x01FFBDAD, 0xDDC00000, 0x01633BDE, 0xDE000000),
+	uint4(0x0003FC03, 0xDE800000, 0x0077BDED, 0xDEC00000), uint4(0x01C6109B, 0xDF400000, 0x01E07FEF, 0xDF800000),
+	uint4(0x000FFF7B, 0xDFC00000, 0x01DFEFFF, 0xE0400000), uint4(0x010F60D8, 0xE0800000, 0x018CE77B, 0xE0C00000),
+	uint4(0x01880CFF, 0xE1400000, 0x01FFF23F, 0xE1800000), uint4(0x0033BFDF, 0xE1C00000, 0x00077203, 0xE2800000),
+	uint4(0x018C611B, 0xE3400000, 0x00700023, 0xE3800000), uint4(0x0021294B, 0xE3C00000, 0x00080000, 0xE4000000),
+	uint4(0x0103FB9B, 0xE4800000, 0x018CE673, 0xE4C00000), uint4(0x01C00003, 0xE5400000, 0x0094F7FC, 0xE5C00000),
+	uint4(0x00700001, 0xE6000000, 0x0011BFFC, 0xE6400000), uint4(0x0118A52B, 0xE6C00000, 0x00113200, 0xE7000000),
+	uint4(0x0094A631, 0xE7C00000, 0x00000021, 0xE8400000), uint4(0x018C671F, 0xE8800000, 0x00873DFF, 0xE9400000),
+	uint4(0x01E70BDE, 0xE9800000, 0x00666200, 0xE9C00000), uint4(0x01FF6001, 0xEA000000, 0x01DDDDFF, 0xEA400000),
+	uint4(0x007E0FF1, 0xEA800000, 0x00739CF7, 0xEB400000), uint4(0x000FFF80, 0xEB800000, 0x00944881, 0xEBC00000),
+	uint4(0x01846338, 0xEC400000, 0x00FF5A94, 0xECC00000), uint4(0x000CE0EF, 0xED000000, 0x00174007, 0xED800000),
+	uint4(0x013398ED, 0xEDC00000, 0x01883FDE, 0xEE800000), uint4(0x01CE633B, 0xEEC00000, 0x00CC4CCC, 0xEF800000),
+	uint4(0x018E7BF7, 0xEFC00000, 0x00084318, 0xF0400000), uint4(0x01C800FF, 0xF0800000, 0x011801ED, 0xF0C00000),
+	uint4(0x01807F98, 0xF1000000, 0x003F7511, 0xF1800000), uint4(0x015ADF88, 0xF1C00000, 0x00777311, 0xF2000000),
+	uint4(0x018C4223, 0xF2800000, 0x0077F7B5, 0xF2C00000), uint4(0x000BDEE3, 0xF3C00000, 0x01119D98, 0xF4000000),
+	uint4(0x00042108, 0xF4400000, 0x01CFC000, 0xF5000000), uint4(0x01FFFF3F, 0xF5C00000, 0x018E7BFF, 0xF6800000),
+	uint4(0x016B78E1, 0xF6C00000, 0x01008CCC, 0xF7000000), uint4(0x000003DF, 0xF8400000, 0x00E7E3C0, 0xF8800000),
+	uint4(0x01EFC212, 0xF8C00000, 0x00F7BDFF, 0xF9000000), uint4(0x0077BD88, 0xF9400000, 0x00700F91, 0xF9800000),
+	uint4(0x01BCE738, 0xF9C00000, 0x0037FC01, 0xFA400000), uint4(0x00007F80, 0xFB800000, 0x018CCE73, 0xFBC00000),
+	uint4(0x007FFFC1, 0xFC400000, 0x00078218, 0xFC800000), uint4(0x0033BFD1, 0xFD400000, 0x01F03C01, 0xFD800000),
+	uint4(0x001B8DC6, 0xFDC00000, 0x018F7E00, 0xFE000000), uint4(0x0042118C, 0xFE800000, 0x01198844, 0xFEC00000),
+	uint4(0x01884023, 0xFF000000, 0x000000DC, 0xFF800000), uint4(0x01CC4052, 0xFFC00000, 0x00000000, 0x00000000),
+};
+
+#define PARTITION_2_COUNT_6X5 720
+#define PARTITION_2_WORDS_6X5 2
+static const uint4 partition_2_6x5[360] =
+{
+	uint4(0x398C31C6, 0x00400000, 0x200410C3, 0x00800000), uint4(0x2318672D, 0x00C00000, 0x0318CC20, 0x01000000),
+	uint4(0x218618E7, 0x01400000, 0x0BE69A03, 0x01C00000), uint4(0x010C31C7, 0x02000000, 0x3FFFEFBC, 0x02400000),
+	uint4(0x3CF3CFBE, 0x02800000, 0x18C30884, 0x02C00000), uint4(0x071CF7DF, 0x03400000, 0x0C719CF3, 0x03800000),
+	uint4(0x0003FE00, 0x03C00000, 0x21861861, 0x04000000), uint4(0x000003FF, 0x04400000, 0x0003F003, 0x04800000),
+	uint4(0x08208208, 0x05000000, 0x1C638E31, 0x05400000), uint4(0x001FEF31, 0x05C00000, 0x37DF7CF3, 0x06000000),
+	uint4(0x38E38E3B, 0x06400000, 0x0000703F, 0x06800000), uint4(0x1455596D, 0x06C00000, 0x3CF3CF3C, 0x07000000),
+	uint4(0x1EFBCF38, 0x07400000, 0x37DF7FFF, 0x07800000), uint4(0x38E38E38, 0x07C00000, 0x3FFFF803, 0x08400000),
+	uint4(0x30800000, 0x08800000, 0x00000FC0, 0x09000000), uint4(0x020A69E7, 0x09400000, 0x0403FFFF, 0x09C00000),
+	uint4(0x3F03FFC3, 0x0A800000, 0x20C38F3E, 0x0AC00000), uint4(0x18EF8E38, 0x0B000000, 0x30C218E6, 0x0B400000),
+	uint4(0x00FFFFAE, 0x0BC00000, 0x04104104, 0x0C000000), uint4(0x0F7B8C63, 0x0C400000, 0x2F7FEE30, 0x0C800000),
+	uint4(0x38C30828, 0x0CC00000, 0x3FFFF7DF, 0x0D000000), uint4(0x0639EF80, 0x0D400000, 0x2FFBBBFD, 0x0D800000),
+	uint4(0x00000001, 0x0DC00000, 0x3CE30803, 0x0E000000), uint4(0x3942E33F, 0x0E800000, 0x04008460, 0x0EC00000),
+	uint4(0x3FFC0000, 0x0F000000, 0x300010C3, 0x0F400000), uint4(0x069F7DC0, 0x0F800000, 0x00001FB8, 0x0FC00000),
+	uint4(0x18800002, 0x10400000, 0x37DF79E3, 0x10800000), uint4(0x0C30C30C, 0x10C00000, 0x31CF38E7, 0x11000000),
+	uint4(0x030031DF, 0x11400000, 0x00000044, 0x11800000), uint4(0x1E69EDAE, 0x11C00000, 0x000431CF, 0x12000000),
+	uint4(0x2061C79E, 0x12400000, 0x20001080, 0x12800000), uint4(0x20042310, 0x12C00000, 0x38C20FBC, 0x13000000),
+	uint4(0x0020830C, 0x13400000, 0x00FFFFC0, 0x13800000), uint4(0x1E79C718, 0x13C00000, 0x20820820, 0x14000000),
+	uint4(0x00FFFFFF, 0x14400000, 0x00FC0000, 0x14800000), uint4(0x36DB6FBE, 0x14C00000, 0x01041041, 0x15000000),
+	uint4(0x239E71CE, 0x15800000, 0x2FFC008A, 0x15C00000), uint4(0x1F821C73, 0x16000000, 0x33C7080F, 0x16400000),
+	uint4(0x030C7BD0, 0x16800000, 0x030C71CF, 0x16C00000), uint4(0x0E7BEFBE, 0x17000000, 0x3CFE0F80, 0x17800000),
+	uint4(0x0F1860BD, 0x17C00000, 0x3FBEFBFF, 0x18400000), uint4(0x308011DE, 0x18800000, 0x249269A6, 0x18C00000),
+	uint4(0x3FFFE703, 0x19000000, 0x3860B1DB, 0x19400000), uint4(0x308431CF, 0x1A400000, 0x30C210C7, 0x1AC00000),
+	uint4(0x3EF7BDCF, 0x1B000000, 0x08638E73, 0x1B400000), uint4(0x3C30CF05, 0x1B800000, 0x000871CF, 0x1BC00000),
+	uint4(0x20000001, 0x1C000000, 0x33C70C30, 0x1C400000), uint4(0x000473DF, 0x1C800000, 0x29A5C79E, 0x1CC00000),
+	uint4(0x00DF3C70, 0x1D000000, 0x3F000020, 0x1D400000), uint4(0x24B08421, 0x1DC00000, 0x0000003F, 0x1E000000),
+	uint4(0x071C41C7, 0x1E400000, 0x1E071EC4, 0x1E800000), uint4(0x175D75D7, 0x1EC00000, 0x3FF8003F, 0x1F000000),
+	uint4(0x3FF20007, 0x1F400000, 0x02FFBCE7, 0x20000000), uint4(0x3EEE31C7, 0x20400000, 0x00402201, 0x20800000),
+	uint4(0x09638609, 0x20C00000, 0x1F000FFF, 0x21000000), uint4(0x310F3187, 0x21800000, 0x2D96402F, 0x21C00000),
+	uint4(0x00FFF000, 0x22000000, 0x1EF3CE30, 0x22400000), uint4(0x02F3004D, 0x22800000, 0x03CFAE02, 0x22C00000),
+	uint4(0x07318843, 0x23800000, 0x369A79E7, 0x23C00000), uint4(0x00002110, 0x24000000, 0x0F3CF3CF, 0x24400000),
+	uint4(0x3C800FB0, 0x24800000, 0x001FBDEF, 0x24C00000), uint4(0x3F0430E7, 0x25000000, 0x3FF38800, 0x25400000),
+	uint4(0x3FE3FFC0, 0x25800000, 0x165D6D38, 0x25C00000), uint4(0x30E38E3C, 0x26400000, 0x0C718C30, 0x26800000),
+	uint4(0x08638E38, 0x26C00000, 0x00830E3C, 0x27000000), uint4(0x2EFBEFAE, 0x27400000, 0x39038E3A, 0x27800000),
+	uint4(0x10F3DE63, 0x27C00000, 0x3FFC03FF, 0x28400000), uint4(0x33C70437, 0x29400000, 0x3DEF7B8C, 0x29C00000),
+	uint4(0x1FFBEF7B, 0x2A000000, 0x1C30403D, 0x2A400000), uint4(0x1C800330, 0x2A800000, 0x38C30807, 0x2AC00000),
+	uint4(0x3EFBCFC8, 0x2B000000, 0x0CC63108, 0x2B800000), uint4(0x1B24803B, 0x2BC00000, 0x010003FF, 0x2C000000),
+	uint4(0x10421802, 0x2C400000, 0x3F00083F, 0x2C800000), uint4(0x07F30001, 0x2D400000, 0x21000FFF, 0x2D800000),
+	uint4(0x028A28A2, 0x2DC00000, 0x032D3CE3, 0x2E000000), uint4(0x00FDF7CF, 0x2E400000, 0x073DFFFF, 0x2F000000),
+	uint4(0x3FFC0FFF, 0x2F800000, 0x00004106, 0x2FC00000), uint4(0x0C208208, 0x30400000, 0x3FE0FFBC, 0x30800000),
+	uint4(0x35D55555, 0x30C00000, 0x271C7186, 0x31000000), uint4(0x00C3CFFF, 0x31800000, 0x2D2CB587, 0x31C00000),
+	uint4(0x031C73DF, 0x32000000, 0x3EFFF000, 0x32400000), uint4(0x23CF7FC4, 0x32C00000, 0x2F020863, 0x33000000),
+	uint4(0x001E0003, 0x33800000, 0x20800BE7, 0x33C00000), uint4(0x1EE20043, 0x34000000, 0x0C73CF3C, 0x34400000),
+	uint4(0x3F30E7DF, 0x34800000, 0x100FA490, 0x34C00000), uint4(0x10000800, 0x35000000, 0x1EF38C22, 0x35400000),
+	uint4(0x200173D8, 0x35800000, 0x2A29A494, 0x35C00000), uint4(0x20821040, 0x36000000, 0x208210C7, 0x36400000),
+	uint4(0x3FE00F20, 0x36800000, 0x1F7DC838, 0x37000000), uint4(0x3CE7BDF7, 0x37800000, 0x000010C7, 0x37C00000),
+	uint4(0x200031DF, 0x38000000, 0x0FFFEF39, 0x38400000), uint4(0x073FFF38, 0x38800000, 0x10821042, 0x38C00000),
+	uint4(0x04308431, 0x39400000, 0x10084421, 0x39800000), uint4(0x31841FFD, 0x39C00000, 0x07FFF7C1, 0x3A000000),
+	uint4(0x33A98611, 0x3AC00000, 0x070C5104, 0x3B000000), uint4(0x338E79E7, 0x3BC00000, 0x0F3E78E1, 0x3C000000),
+	uint4(0x0703FFFF, 0x3C800000, 0x10410410, 0x3CC00000), uint4(0x3EEA31C7, 0x3D400000, 0x3FFC003F, 0x3D800000),
+	uint4(0x3084FFB9, 0x3DC00000, 0x00EFBCF3, 0x3E000000), uint4(0x0C3AEBFF, 0x3E400000, 0x2F87F8E2, 0x3E800000),
+	uint4(0x07FFF1C1, 0x3F000000, 0x1C79F7DC, 0x3F400000), uint4(0x3000004C, 0x3F800000, 0x134D718E, 0x3FC00000),
+	uint4(0x00000FFF, 0x40000000, 0x3EFBF082, 0x40400000), uint4(0x30000EE7, 0x40800000, 0x3EF38C23, 0x41000000),
+	uint4(0x00020C38, 0x41400000, 0x301F438E, 0x41800000), uint4(0x1F7DC41F, 0x42000000, 0x39C2081F, 0x42400000),
+	uint4(0x02082082, 0x42800000, 0x04000008, 0x42C00000), uint4(0x203FEC03, 0x43800000, 0x396596DA, 0x43C00000),
+	uint4(0x3F41861C, 0x44400000, 0x0F1C3040, 0x44C00000), uint4(0x233FFFC0, 0x45000000, 0x0C208C38, 0x45400000),
+	uint4(0x03CB71F4, 0x45800000, 0x31CE3986, 0x45C00000), uint4(0x3FF00000, 0x46000000, 0x1C71C71E, 0x46400000),
+	uint4(0x08208218, 0x46800000, 0x3FFFFFBC, 0x46C00000), uint4(0x000473FE, 0x47000000, 0x30C38E3C, 0x47800000),
+	uint4(0x04208410, 0x47C00000, 0x3CF3CE38, 0x48400000), uint4(0x1BCF6BAD, 0x48C00000, 0x001E0E3E, 0x49400000),
+	uint4(0x30800001, 0x49800000, 0x084539CF, 0x49C00000), uint4(0x38C473FF, 0x4A000000, 0x30C2081F, 0x4A800000),
+	uint4(0x2965B692, 0x4AC00000, 0x3CE30C20, 0x4B000000), uint4(0x300FC803, 0x4B800000, 0x3F00083E, 0x4BC00000),
+	uint4(0x182081F7, 0x4C000000, 0x218CF7BF, 0x4C400000), uint4(0x231C7138, 0x4C800000, 0x11400F9E, 0x4CC00000),
+	uint4(0x30C67BC0, 0x4D400000, 0x30820820, 0x4D800000), uint4(0x04738C30, 0x4E400000, 0x3F83CFE0, 0x4E800000),
+	uint4(0x3CF38C21, 0x4F400000, 0x00FDF3C7, 0x4F800000), uint4(0x05961A68, 0x4FC00000, 0x38C20043, 0x50C00000),
+	uint4(0x000000CF, 0x51000000, 0x04210821, 0x51400000), uint4(0x3F0001F0, 0x51800000, 0x369AEB2E, 0x51C00000),
+	uint4(0x3EF3DFFB, 0x52400000, 0x1C6318E7, 0x52800000), uint4(0x0C71CE38, 0x52C00000, 0x3BCF39E7, 0x53000000),
+	uint4(0x104124A2, 0x53C00000, 0x0DEF39E6, 0x54400000), uint4(0x208410C7, 0x54800000, 0x12D24A09, 0x54C00000),
+	uint4(0x0C218471, 0x55400000, 0x343FFE3F, 0x55800000), uint4(0x0337BBDF, 0x55C00000, 0x30800208, 0x56000000),
+	uint4(0x1BCB692C, 0x56C00000, 0x1FFBDE73, 0x57000000), uint4(0x06620001, 0x57400000, 0x0C618430, 0x57800000),
+	uint4(0x1EFBE382, 0x57C00000, 0x3F3C707E, 0x58000000), uint4(0x1C43DCC6, 0x58800000, 0x030CB2DB, 0x58C00000),
+	uint4(0x3F0003FF, 0x59000000, 0x1F7DFFFF, 0x59400000), uint4(0x269A69A6, 0x59C00000, 0x3FFDFFFF, 0x5A000000),
+	uint4(0x3FFFFF38, 0x5A400000, 0x01043082, 0x5A800000), uint4(0x020820A2, 0x5AC00000, 0x20000007, 0x5B400000),
+	uint4(0x3FFFF003, 0x5BC00000, 0x3BEF1863, 0x5C000000), uint4(0x0F03FF2F, 0x5C800000, 0x24924924, 0x5CC00000),
+	uint4(0x2FFC0001, 0x5D400000, 0x0F0C0FFF, 0x5D800000), uint4(0x05965B6D, 0x5DC00000, 0x22108421, 0x5E000000),
+	uint4(0x3F000007, 0x5E400000, 0x077FFF30, 0x5E800000), uint4(0x038F7E04, 0x5F000000, 0x04210800, 0x5F400000),
+	uint4(0x279E79E7, 0x5FC00000, 0x00EEFF23, 0x60800000), uint4(0x02080B6D, 0x60C00000, 0x031CE739, 0x61000000),
+	uint4(0x3FFFCC00, 0x61400000, 0x33FFF03F, 0x61800000), uint4(0x08218410, 0x61C00000, 0x01000FFC, 0x62000000),
+	uint4(0x07186186, 0x62400000, 0x3CE739C7, 0x62800000), uint4(0x0087300C, 0x62C00000, 0x00008041, 0x63C00000),
+	uint4(0x0000083F, 0x64800000, 0x01FBEF3C, 0x64C00000), uint4(0x023BE383, 0x65000000, 0x04200421, 0x65400000),
+	uint4(0x08010461, 0x65C00000, 0x00002000, 0x66400000), uint4(0x00830C38, 0x66800000, 0x3BE58243, 0x66C00000),
+	uint4(0x0E38E386, 0x67000000, 0x30800043, 0x67C00000), uint4(0x3000EF30, 0x68800000, 0x2434B3C6, 0x68C00000),
+	uint4(0x0FE00000, 0x69000000, 0x380431CF, 0x69400000), uint4(0x210CE633, 0x69800000, 0x07FFC001, 0x69C00000),
+	uint4(0x210C73DE, 0x6A000000, 0x013FEF3F, 0x6A800000), uint4(0x0083B3BF, 0x6B800000, 0x02FFBDC7, 0x6C000000),
+	uint4(0x10FFF7DE, 0x6C400000, 0x20820827, 0x6D000000), uint4(0x20000002, 0x6D400000, 0x00F431E8, 0x6D800000),
+	uint4(0x3EF7BFFF, 0x6DC00000, 0x04000000, 0x6E000000), uint4(0x00000003, 0x6E400000, 0x0004FFFF, 0x6EC00000),
+	uint4(0x073CF3CF, 0x6F000000, 0x38E18207, 0x6F400000), uint4(0x0F00003F, 0x6F800000, 0x0D65B6DB, 0x6FC00000),
+	uint4(0x279CF7CF, 0x70400000, 0x1F7983DF, 0x71400000), uint4(0x31C71C30, 0x71800000, 0x18619E7B, 0x71C00000),
+	uint4(0x349C71C4, 0x72800000, 0x00000002, 0x73400000), uint4(0x0F3CF39E, 0x73800000, 0x229A6B9D, 0x73C00000),
+	uint4(0x33CD75CF, 0x74400000, 0x3F000FC0, 0x74800000), uint4(0x2FFC0000, 0x75400000, 0x3E80083F, 0x75800000),
+	uint4(0x067BCF39, 0x75C00000, 0x3FFB8800, 0x76400000), uint4(0x1EFC0047, 0x76800000, 0x38C2007F, 0x76C00000),
+	uint4(0x071C30C1, 0x77000000, 0x3933CF06, 0x77800000), uint4(0x27DF7000, 0x77C00000, 0x30000003, 0x78400000),
+	uint4(0x33FC000C, 0x78800000, 0x33DE6B18, 0x79000000), uint4(0x3C03FFCF, 0x79800000, 0x3EFC239E, 0x79C00000),
+	uint4(0x3FFFCE2F, 0x7A000000, 0x003673FF, 0x7A400000), uint4(0x1C807E01, 0x7A800000, 0x1E711063, 0x7AC00000),
+	uint4(0x071C73CF, 0x7B000000, 0x200431CF, 0x7B400000), uint4(0x07CF0C23, 0x7BC00000, 0x3F000047, 0x7C000000),
+	uint4(0x1C760CF7, 0x7C800000, 0x030C30C1, 0x7CC00000), uint4(0x0006723E, 0x7D000000, 0x0E3AEBAE, 0x7D400000),
+	uint4(0x0003F7CF, 0x7D800000, 0x00010410, 0x7DC00000), uint4(0x0FFFF001, 0x7E000000, 0x00DF7DF3, 0x7E400000),
+	uint4(0x000EFFBF, 0x7E800000, 0x033FCC01, 0x7F000000), uint4(0x231C73CF, 0x7F400000, 0x0D11CF00, 0x7F800000),
+	uint4(0x28430C39, 0x7FC00000, 0x00FF8043, 0x80400000), uint4(0x3CC00FFF, 0x81000000, 0x3EF38E13, 0x81400000),
+	uint4(0x213F81FF, 0x81800000, 0x06BAC719, 0x81C00000), uint4(0x3080005F, 0x82400000, 0x2DB0411B, 0x82C00000),
+	uint4(0x318C6319, 0x83000000, 0x38E03C21, 0x83800000), uint4(0x020807DE, 0x83C00000, 0x00FFE79E, 0x84400000),
+	uint4(0x0F03FE3F, 0x84800000, 0x228A4828, 0x84C00000), uint4(0x271CF7DF, 0x85000000, 0x0820C3AE, 0x85400000),
+	uint4(0x38E3CF3C, 0x85800000, 0x00800000, 0x86000000), uint4(0x00FF01FF, 0x86800000, 0x3DEFF001, 0x86C00000),
+	uint4(0x3FF3FFC0, 0x87800000, 0x208639EF, 0x87C00000), uint4(0x3EF38C22, 0x88400000, 0x3CC38FA0, 0x88800000),
+	uint4(0x09282505, 0x88C00000, 0x38C007DF, 0x89000000), uint4(0x3FFC083E, 0x89400000, 0x31CC0433, 0x89800000),
+	uint4(0x01010002, 0x89C00000, 0x3CFE0C38, 0x8A400000), uint4(0x38E0B238, 0x8A800000, 0x1FFC7FBD, 0x8B800000),
+	uint4(0x1C618638, 0x8BC00000, 0x01FFFFFF, 0x8C400000), uint4(0x04000002, 0x8C800000, 0x38C00FFC, 0x8CC00000),
+	uint4(0x20000FFF, 0x8D000000, 0x3F008208, 0x8DC00000), uint4(0x00000FF0, 0x8E400000, 0x00FFF020, 0x8E800000),
+	uint4(0x1F01871E, 0x8F000000, 0x33CE79E7, 0x8FC00000), uint4(0x378E180F, 0x90800000, 0x065965B6, 0x90C00000),
+	uint4(0x3CE30820, 0x91000000, 0x04104186, 0x91400000), uint4(0x3BEF3CF7, 0x91C00000, 0x308210C3, 0x92000000),
+	uint4(0x318618C3, 0x92400000, 0x23107DCE, 0x92800000), uint4(0x1E49200D, 0x92C00000, 0x319FFFBC, 0x93800000),
+	uint4(0x17DA6903, 0x93C00000, 0x00830F3E, 0x94400000), uint4(0x0F3DF620, 0x94800000, 0x2EBAF75D, 0x94C00000),
+	uint4(0x3FFFFFB8, 0x95000000, 0x1E71C630, 0x95400000), uint4(0x00BDDE63, 0x95800000, 0x1E01061C, 0x95C00000),
+	uint4(0x0439EFB8, 0x96000000, 0x00000E3F, 0x96400000), uint4(0x3FF0FFF9, 0x96800000, 0x0418F7DF, 0x97400000),
+	uint4(0x01000C00, 0x97800000, 0x38E78EB8, 0x97C00000), uint4(0x20820BE0, 0x98000000, 0x0C630800, 0x98400000),
+	uint4(0x30C209C0, 0x98800000, 0x37FC4106, 0x98C00000), uint4(0x3FFC0003, 0x99000000, 0x07E03FFD, 0x99800000),
+	uint4(0x00004001, 0x99C00000, 0x3FFC000F, 0x9A000000), uint4(0x3FFFF7CF, 0x9A400000, 0x318E36B6, 0x9AC00000),
+	uint4(0x07E00001, 0x9B000000, 0x00000FFE, 0x9B400000), uint4(0x190C4C38, 0x9B800000, 0x32490FFE, 0x9BC00000),
+	uint4(0x379E79E7, 0x9C000000, 0x2FBC020C, 0x9C400000), uint4(0x1961A69A, 0x9CC00000, 0x1F7DFFC0, 0x9D000000),
+	uint4(0x1C71CF3C, 0x9D400000, 0x22004909, 0x9DC00000), uint4(0x3CF0C13D, 0x9E400000, 0x0310F7FF, 0x9E800000),
+	uint4(0x3E061CF3, 0x9F000000, 0x3F1C0FFE, 0x9F800000), uint4(0x29A69863, 0x9FC00000, 0x175D5C79, 0xA0C00000),
+	uint4(0x000003FC, 0xA1400000, 0x03FC000F, 0xA1800000), uint4(0x1AEBAEFF, 0xA1C00000, 0x3DFFEF3C, 0xA2000000),
+	uint4(0x30C639EE, 0xA2400000, 0x20820823, 0xA2C00000), uint4(0x00000084, 0xA3000000, 0x3F830E3C, 0xA3800000),
+	uint4(0x0C35D75F, 0xA3C00000, 0x1C71C71C, 0xA4400000), uint4(0x1061E7F8, 0xA4800000, 0x3CF0433C, 0xA5400000),
+	uint4(0x00F3F05F, 0xA5800000, 0x27B8E739, 0xA5C00000), uint4(0x3FFFFEF7, 0xA6000000, 0x01861820, 0xA6400000),
+	uint4(0x0618C718, 0xA6800000, 0x37C7043F, 0xA7000000), uint4(0x238800CF, 0xA8000000, 0x063096D7, 0xA8400000),
+	uint4(0x330C4DEF, 0xA8800000, 0x3CC38C61, 0xA8C00000), uint4(0x0C738E39, 0xAA400000, 0x0E19C75D, 0xAAC00000),
+	uint4(0x1871E79F, 0xAB000000, 0x313FFF27, 0xAB800000), uint4(0x38C00047, 0xABC00000, 0x0635BBFF, 0xAC000000),
+	uint4(0x3EFBEF1E, 0xAC800000, 0x0F3EF9E7, 0xAD000000), uint4(0x105FFF9E, 0xAD400000, 0x0003F03F, 0xAD800000),
+	uint4(0x24861249, 0xADC00000, 0x00FFFEF9, 0xAE000000), uint4(0x0083CFFF, 0xAE400000, 0x0F3DF7DF, 0xAEC00000),
+	uint4(0x07EF0C31, 0xAF000000, 0x3C000C38, 0xAF400000), uint4(0x38000F00, 0xAF800000, 0x308037B8, 0xAFC00000),
+	uint4(0x1080118C, 0xB0400000, 0x3F000030, 0xB0800000), uint4(0x36DFEBAE, 0xB0C00000, 0x03200001, 0xB1400000),
+	uint4(0x04FEF7DC, 0xB1C00000, 0x3CF5B2C7, 0xB2400000), uint4(0x3F03F000, 0xB2800000, 0x22082104, 0xB3000000),
+	uint4(0x1659470D, 0xB3C00000, 0x3FFBCE37, 0xB4000000), uint4(0x00BEF9E7, 0xB4800000, 0x208618E3, 0xB4C00000),
+	uint4(0x1C304FF9, 0xB5000000, 0x3F208639, 0xB5400000), uint4(0x3EE211DF, 0xB5800000, 0x02184209, 0xB5C00000),
+	uint4(0x000CFFFC, 0xB6800000, 0x00FBEEAA, 0xB6C00000), uint4(0x07FFFF21, 0xB7000000, 0x2F9E183F, 0xB8000000),
+	uint4(0x1C000000, 0xB8800000, 0x2BAEBAEB, 0xB8C00000), uint4(0x061032F9, 0xB9800000, 0x18C20000, 0xBA400000),
+	uint4(0x20820863, 0xBAC00000, 0x003FFFF8, 0xBB000000), uint4(0x02104308, 0xBBC00000, 0x380010C6, 0xBC400000),
+	uint4(0x0FFCCBD8, 0xBC800000, 0x3FFFFFF3, 0xBD000000), uint4(0x3F0001FF, 0xBD800000, 0x06184104, 0xBE000000),
+	uint4(0x1F831EC4, 0xBE800000, 0x2CA28A69, 0xBEC00000), uint4(0x1F1C2FFE, 0xBF000000, 0x1F3A71FB, 0xBF800000),
+	uint4(0x00820C30, 0xC0000000, 0x00FBFE00, 0xC0400000), uint4(0x22F9C20F, 0xC0800000, 0x3CC000CF, 0xC1000000),
+	uint4(0x27DC871E, 0xC1400000, 0x0C30B3EF, 0xC1800000), uint4(0x38C339FF, 0xC2000000, 0x333F93FD, 0xC2800000),
+	uint4(0x0319EF39, 0xC3000000, 0x01040000, 0xC3800000), uint4(0x2F7FEF38, 0xC3C00000, 0x30000000, 0xC4000000),
+	uint4(0x3880FFC0, 0xC4800000, 0x00020843, 0xC5000000), uint4(0x1E386F7C, 0xC5400000, 0x24003FF6, 0xC5C00000),
+	uint4(0x38E30C30, 0xC6000000, 0x0E38E38E, 0xC6C00000), uint4(0x3FFF8003, 0xC7000000, 0x3FFB885F, 0xC7800000),
+	uint4(0x218430E3, 0xC7C00000, 0x0204EFBE, 0xC8400000), uint4(0x00F8E0BE, 0xC8800000, 0x3FFBBDDF, 0xC9000000),
+	uint4(0x00FC003F, 0xC9800000, 0x268A23FF, 0xC9C00000), uint4(0x0004EFBE, 0xCA000000, 0x000CCC00, 0xCA800000),
+	uint4(0x22908252, 0xCAC00000, 0x31C41FDF, 0xCB000000), uint4(0x0E738C21, 0xCB400000, 0x073CF7DF, 0xCB800000),
+	uint4(0x1EE20047, 0xCC800000, 0x01208082, 0xCCC00000), uint4(0x031C73CF, 0xCD000000, 0x2638C639, 0xCD400000),
+	uint4(0x2BAEB2DB, 0xCDC00000, 0x1F020F47, 0xCE800000), uint4(0x2F20E3DF, 0xCF000000, 0x0010C73C, 0xCF800000),
+	uint4(0x3CE24319, 0xCFC00000, 0x200FFFBC, 0xD0400000), uint4(0x3F000100, 0xD0800000, 0x0F3CEB3C, 0xD0C00000),
+	uint4(0x3CF3827B, 0xD1000000, 0x3FFFFF33, 0xD1C00000), uint4(0x279C0001, 0xD2000000, 0x0638E38E, 0xD2400000),
+	uint4(0x38E30BE3, 0xD2800000, 0x10C31C73, 0xD3400000), uint4(0x071C20BD, 0xD3C00000, 0x2FBA0061, 0xD4400000),
+	uint4(0x36DB6DB6, 0xD4C00000, 0x3CF00086, 0xD5000000), uint4(0x1F7CF3CF, 0xD6000000, 0x38C033FF, 0xD6800000),
+	uint4(0x3F7C707E, 0xD7400000, 0x00F80000, 0xD8800000), uint4(0x3FFCF0FE, 0xD9000000, 0x10F9E718, 0xD9400000),
+	uint4(0x03FFC80F, 0xD9800000, 0x12492492, 0xD9C00000), uint4(0x00100000, 0xDA000000, 0x3FEF79CF, 0xDA400000),
+	uint4(0x003FCC01, 0xDA800000, 0x2CB2CB2C, 0xDAC00000), uint4(0x20030FFE, 0xDB000000, 0x000031DC, 0xDB400000),
+	uint4(0x33DC0473, 0xDB800000, 0x00000208, 0xDBC00000), uint4(0x0C38F330, 0xDC400000, 0x3EFFF020, 0xDCC00000),
+	uint4(0x00C7B18F, 0xDD800000, 0x3FFEFB6D, 0xDDC00000), uint4(0x3698E79E, 0xDE000000, 0x001FF003, 0xDE800000),
+	uint4(0x073CF3ED, 0xDEC00000, 0x1C30413B, 0xDF400000), uint4(0x3E83F7CF, 0xDF800000, 0x00FDF6DB, 0xDFC00000),
+	uint4(0x000031DF, 0xE0000000, 0x3DFFBFFF, 0xE0400000), uint4(0x307B89B8, 0xE0800000, 0x18679EFB, 0xE0C00000),
+	uint4(0x38C231DF, 0xE1400000, 0x3FFFCC5F, 0xE1800000), uint4(0x239CF7BF, 0xE1C00000, 0x203BCC03, 0xE2800000),
+	uint4(0x000473FF, 0xE3000000, 0x38E3823B, 0xE3400000), uint4(0x27820863, 0xE3800000, 0x0208A2AB, 0xE3C00000),
+	uint4(0x00C00000, 0xE4000000, 0x301FEF1B, 0xE4800000), uint4(0x38E79CF3, 0xE4C00000, 0x3C800003, 0xE5400000),
+	uint4(0x0925D7DC, 0xE5C00000, 0x27820821, 0xE6000000), uint4(0x010CF7FC, 0xE6400000, 0x31C69A4B, 0xE6C00000),
+	uint4(0x0108C420, 0xE7000000, 0x09249451, 0xE7C00000), uint4(0x20000041, 0xE8400000, 0x38E39E3F, 0xE8800000),
+	uint4(0x06186186, 0xE9000000, 0x0838F3FF, 0xE9400000), uint4(0x3E382FBE, 0xE9800000, 0x06318C20, 0xE9C00000),
+	uint4(0x1FFB8801, 0xEA000000, 0x3DEF7BDF, 0xEA400000), uint4(0x07F237F1, 0xEA800000, 0x279E79F7, 0xEB400000),
+	uint4(0x00FFFF00, 0xEB800000, 0x09212121, 0xEBC00000), uint4(0x38A18678, 0xEC400000, 0x0FF96514, 0xECC00000),
+	uint4(0x20E781CF, 0xED000000, 0x013B0007, 0xED800000), uint4(0x131E61CD, 0xEDC00000, 0x1840F79E, 0xEE800000),
+	uint4(0x1CF1865B, 0xEEC00000, 0x230C31C7, 0xEF000000), uint4(0x0C63318C, 0xEF800000, 0x38F3EFF7, 0xEFC00000),
+	uint4(0x30C20000, 0xF0000000, 0x00410618, 0xF0400000), uint4(0x3CC001FF, 0xF0800000, 0x11400BED, 0xF0C00000),
+	uint4(0x3883FF38, 0xF1000000, 0x037BD231, 0xF1800000), uint4(0x15D77F28, 0xF1C00000, 0x2739CE31, 0xF2000000),
+	uint4(0x38E30C63, 0xF2800000, 0x073DDF75, 0xF2C00000), uint4(0x00FFF7CF, 0xF3000000, 0x00DF7DE3, 0xF3C00000),
+	uint4(0x318C7338, 0xF4000000, 0x00208208, 0xF4400000), uint4(0x29A69A69, 0xF4C00000, 0x3CFF0000, 0xF5000000),
+	uint4(0x30820000, 0xF5800000, 0x3FFFFE7F, 0xF5C00000), uint4(0x38F3EFFF, 0xF6800000, 0x36D9E1C1, 0xF6C00000),
+	uint4(0x3084318C, 0xF7000000, 0x00020FBF, 0xF8400000), uint4(0x0EBD8780, 0xF8800000, 0x3EFD0412, 0xF8C00000),
+	uint4(0x0F3CF3DF, 0xF9000000, 0x073CF328, 0xF9400000), uint4(0x27003F31, 0xF9800000, 0x3BE79E78, 0xF9C00000),
+	uint4(0x033FF001, 0xFA400000, 0x0F3EFBCF, 0xFB000000), uint4(0x2003FF00, 0xFB800000, 0x38673CF3, 0xFBC00000),
+	uint4(0x07FFFF81, 0xFC400000, 0x003E0C38, 0xFC800000), uint4(0x031CF791, 0xFD400000, 0x3F00F821, 0xFD800000),
+	uint4(0x015C3B86, 0xFDC00000, 0x38FBFC20, 0xFE000000), uint4(0x2FBFFFDF, 0xFE400000, 0x0410430C, 0xFE800000),
+	uint4(0x31CE2084, 0xFEC00000, 0x38C30863, 0xFF000000), uint4(0x200001BC, 0xFF800000, 0x1CE30892, 0xFFC00000),
+};
+
+#define PARTITION_2_COUNT_6X6 521
+#define PARTITION_2_WORDS_6X6 2
+static const uint4 partition_2_6x6[261] =
+{
+	uint4(0xCF3DF7DE, 0x00400001, 0xC31C73CF, 0x00800000), uint4(0xBCF38E73, 0x00C0000F, 0x30800000, 0x0100000E),
+	uint4(0xC31C73DF, 0x01400000, 0xE1860867, 0x01C00008), uint4(0xCF7DFFFF, 0x02000003, 0xFEF3CE30, 0x0240000F),
+	uint4(0x38F3CF3E, 0x0280000E, 0x0210C630, 0x02C00000), uint4(0x010C71CF, 0x03800008, 0xFFFA0000, 0x03C00007),
+	uint4(0x41041041, 0x04000000, 0x001FFFFF, 0x04400000), uint4(0x3F000007, 0x04800000, 0x3CF3CF3C, 0x04C0000F),
+	uint4(0x20000001, 0x05400008, 0xBCE30041, 0x05C0000F), uint4(0xDF7CF3CF, 0x06000007, 0x20820827, 0x06400008),
+	uint4(0xDF00003F, 0x0680000F, 0x71C73CF3, 0x06C00006), uint4(0x30C30C30, 0x0700000C, 0x38C30820, 0x0740000E),
+	uint4(0x82082082, 0x07C00000, 0xFFF00007, 0x0840000F), uint4(0x0003FFC0, 0x09000000, 0x9E79F7DF, 0x09400003),
+	uint4(0x3FFDF7DF, 0x09C00000, 0x3FFFF007, 0x0A800000), uint4(0x20C38F3E, 0x0AC00000, 0x40000000, 0x0B000000),
+	uint4(0x431CF7BE, 0x0B400000, 0xFFFC0FFF, 0x0B80000F), uint4(0xFFF7CF3C, 0x0BC0000F, 0x10410410, 0x0C000004),
+	uint4(0x200410C7, 0x0C40000E, 0xFCE20000, 0x0C80000F), uint4(0x20820820, 0x0CC00008, 0xBEFBEF80, 0x0D40000F),
+	uint4(0xCFFFFFB9, 0x0D80000C, 0x00000001, 0x0DC00008), uint4(0x000000CF, 0x0E000000, 0x3EF38C1F, 0x0E800000),
+	uint4(0x00001000, 0x0EC00000, 0xC0000000, 0x0F00000F), uint4(0x410C71CF, 0x0F400000, 0xFFFFFFC0, 0x0F80000F),
+	uint4(0x01FBCC00, 0x0FC00000, 0x00000044, 0x10400000), uint4(0xDF7DF3CF, 0x10800007, 0x38E38E38, 0x10C0000E),
+	uint4(0xC73CF3DF, 0x11000001, 0xC77FFFFF, 0x11400000), uint4(0x000033B8, 0x11800000, 0x9E7BEFBE, 0x11C00003),
+	uint4(0x30E3EFFC, 0x12400008, 0x01084200, 0x12800000), uint4(0x8CE30000, 0x12C00001, 0x007BCF38, 0x13000000),
+	uint4(0x20830C38, 0x13400000, 0xFFFFF000, 0x1380000F), uint4(0x30C38A28, 0x13C0000C, 0x9E79E79E, 0x14C00007),
+	uint4(0xDFFFFFBE, 0x15800007, 0x00004104, 0x15C00000), uint4(0x410C31C7, 0x16000000, 0x4000007F, 0x16400000),
+	uint4(0xFFFFFFC0, 0x16800007, 0xDF7FFFFF, 0x16C00003), uint4(0x0083EFC0, 0x17800000, 0x9E304EF9, 0x17C00007),
+	uint4(0x433FFFBC, 0x18800000, 0x1C71C71C, 0x18C00006), uint4(0xFEF38C07, 0x1900000F, 0xC77DF3C7, 0x19400000),
+	uint4(0x18618618, 0x19C00006, 0x010C73DF, 0x1AC00000), uint4(0xC73DFFFF, 0x1B000008, 0x000410C7, 0x1B400000),
+	uint4(0xF0C30C13, 0x1B800003, 0x00000043, 0x1C000000), uint4(0xDFFFFFFF, 0x1C800003, 0xF2CBCE3C, 0x1CC00008),
+	uint4(0xCF1C3040, 0x1D000007, 0x00000043, 0x1DC00008), uint4(0xB89FFFFF, 0x1E40000F, 0xC31C7BD0, 0x1E800000),
+	uint4(0x000001DF, 0x1F400000, 0xCF3CF7DF, 0x2000000B), uint4(0xCF3DF7DF, 0x20400003, 0x44400003, 0x20800000),
+	uint4(0x20820863, 0x20C00008, 0x0003FFFF, 0x21000000), uint4(0xCF3DC43F, 0x21800009, 0x1860803F, 0x21C0000E),
+	uint4(0xFF000000, 0x2200000F, 0x30800000, 0x2240000C), uint4(0x00001179, 0x22800000, 0xEEC0830E, 0x22C00003),
+	uint4(0x000010C7, 0x23800008, 0xC6730800, 0x24000000), uint4(0x00FFC800, 0x24800000, 0xEF7DFFFF, 0x24C0000F),
+	uint4(0xC71CF7FF, 0x25000000, 0x00000000, 0x2540000C), uint4(0xFEF32882, 0x25C00007, 0x20820C30, 0x26400000),
+	uint4(0x00000000, 0x26800008, 0x00000830, 0x27000000), uint4(0x2082086E, 0x27800008, 0xB98C31C7, 0x27C0000F),
+	uint4(0xDFFFEF38, 0x29C00007, 0x3CE79CE7, 0x2A00000F), uint4(0x18200EF9, 0x2A40000E, 0x000B8000, 0x2A800000),
+	uint4(0x000000DF, 0x2AC00000, 0x38C77020, 0x2B00000E), uint4(0xCF738C20, 0x2B800001, 0x60800FEF, 0x2BC00008),
+	uint4(0x01042084, 0x2C400000, 0x00000FBF, 0x2C800000), uint4(0x00000001, 0x2D400000, 0x8E38C30C, 0x2DC00003),
+	uint4(0x8003FFFF, 0x2F80000F, 0x30E38F3C, 0x2FC0000C), uint4(0x20820800, 0x30400008, 0xFFFFEF38, 0x30800003),
+	uint4(0x79E59659, 0x30C0000E, 0xFFFFEFBE, 0x3100000F), uint4(0x38FBFFFF, 0x31800008, 0xCF3DE71D, 0x31C00001),
+	uint4(0xDF7DF010, 0x32C00007, 0xC000000F, 0x3380000F), uint4(0x00FFFFDF, 0x33C00000, 0x3CFBFFFF, 0x3480000E),
+	uint4(0xCE38C308, 0x34C0000B, 0x20000046, 0x3540000C), uint4(0xDFFFFE00, 0x35800007, 0x0C30C718, 0x35C00003),
+	uint4(0x01041082, 0x36000000, 0x430C73DF, 0x36400000), uint4(0x00FF8000, 0x36800000, 0xF8000000, 0x3700000F),
+	uint4(0xC73DF7FF, 0x37800008, 0x431C73DF, 0x37C00000), uint4(0xBCE30803, 0x3840000F, 0xFFF38800, 0x3880000F),
+	uint4(0x410C3186, 0x38C00000, 0x20000043, 0x39400008), uint4(0x30800001, 0x39800003, 0x4103FEF3, 0x39C00000),
+	uint4(0xFFFFF0C1, 0x3A00000F, 0x08C20061, 0x3AC00003), uint4(0xD1410C30, 0x3B000000, 0x00000003, 0x3B400000),
+	uint4(0xFF7CF1C3, 0x3C00000F, 0xFFFBCC21, 0x3DC00003), uint4(0xBEFFFFFF, 0x3E40000F, 0x3FFCF0C6, 0x3E800000),
+	uint4(0xFFFDF001, 0x3F00000F, 0x000017B0, 0x3F800000), uint4(0x5D77CF3C, 0x3FC00003, 0x7D00410C, 0x4040000F),
+	uint4(0x006E73DF, 0x40800000, 0x200000CF, 0x4100000C), uint4(0xF083CFFE, 0x4180000F, 0x3080003F, 0x4200000F),
+	uint4(0x86186186, 0x42800001, 0x20800000, 0x42C00008), uint4(0xFEC0004F, 0x4380000F, 0xC31C71C6, 0x43C00000),
+	uint4(0xFF000FFF, 0x4400000F, 0x00820C38, 0x44400000), uint4(0x00000020, 0x45400008, 0x1F7DF7B0, 0x4580000A),
+	uint4(0xCF3DE79C, 0x45C00001, 0x38E38E3C, 0x4640000E), uint4(0xFFFFEF38, 0x46C0000F, 0xDFFFFFFE, 0x47000003),
+	uint4(0x00820C30, 0x47800000, 0x30820800, 0x4840000C), uint4(0xDEFBCF39, 0x48C00007, 0x30C30C30, 0x49000004),
+	uint4(0xC0000C3C, 0x4940000F, 0xC71DFBFF, 0x49C00001), uint4(0x0000007F, 0x4A800000, 0xC7186186, 0x4AC00000),
+	uint4(0xF800004F, 0x4B80000F, 0x0000003C, 0x4BC00000), uint4(0xFFFFEFBD, 0x4C400007, 0xDFF30800, 0x4C800007),
+	uint4(0x00FFEFBC, 0x4CC00000, 0xDFFFFFC0, 0x4D400003), uint4(0x30FBF000, 0x4E800000, 0x00820830, 0x4F000000),
+	uint4(0xFFFFFFDF, 0x4F80000F, 0xE38E38E2, 0x4FC0000C), uint4(0x000410CF, 0x50C00000, 0x000477FF, 0x51000000),
+	uint4(0x0001FFC0, 0x51800000, 0x3CE38E3C, 0x51C0000F), uint4(0x71CF79EF, 0x5240000E, 0x8410410C, 0x53C00001),
+	uint4(0x30C20841, 0x54C00006, 0x000410C3, 0x55400008), uint4(0xCF7FFFFF, 0x55C00008, 0x9CF38E30, 0x56C00007),
+	uint4(0x79CE31C7, 0x5700000F, 0xBEF3C1C4, 0x57C0000F), uint4(0xDF1C1FFE, 0x5800000F, 0x30C20800, 0x5840000E),
+	uint4(0xB98C73DC, 0x58800003, 0xEFBCF3CF, 0x58C0000B), uint4(0xFFFB8C00, 0x5A40000F, 0xC718618E, 0x5A800001),
+	uint4(0x0C30C30C, 0x5AC00003, 0xFFFFEE30, 0x5B80000F), uint4(0xFFFC0007, 0x5BC0000F, 0xC30C1047, 0x5C000000),
+	uint4(0x3FFF803F, 0x5C800000, 0xC0000003, 0x5D40000F), uint4(0x007FFFFF, 0x5D800000, 0x20000043, 0x5E00000C),
+	uint4(0xDF7E0418, 0x5F000003, 0xFFF300C7, 0x6080000F), uint4(0x00EFBEF9, 0x60C00001, 0xBCF38C21, 0x6100000F),
+	uint4(0x30000000, 0x6140000F, 0xFF0001FF, 0x6180000F), uint4(0x0003FFB8, 0x62000000, 0x9E79CF3C, 0x62400007),
+	uint4(0xC73DF7FF, 0x62800000, 0xCF7C0830, 0x62C00001), uint4(0x0000083F, 0x64800000, 0xBCF38E30, 0x64C0000F),
+	uint4(0x3CF3C705, 0x6500000F, 0x000410C3, 0x65C00000), uint4(0x04000020, 0x66400000, 0x400010CF, 0x66C00000),
+	uint4(0xC0000FFF, 0x6780000F, 0x000431CF, 0x67C00000), uint4(0xFEE30800, 0x68800003, 0xE73DF7FE, 0x68C00008),
+	uint4(0xBCE20047, 0x6980000F, 0xF8000003, 0x69C0000F), uint4(0xFEF388DF, 0x6A80000F, 0x67E3EFFF, 0x6B800000),
+	uint4(0xCF3DF7DF, 0x6C00000B, 0xFFFFFFBE, 0x6C40000F), uint4(0x0000001F, 0x6D000000, 0x0000008C, 0x6D400000),
+	uint4(0xCF7FFF00, 0x6D800001, 0xE73DFFFF, 0x6DC0000C), uint4(0x00042108, 0x6E000000, 0x0000004F, 0x6E400000),
+	uint4(0x208209DF, 0x6F400008, 0xE79C71C7, 0x6FC00008), uint4(0x00000C00, 0x70800000, 0x431CF7FF, 0x71000000),
+	uint4(0x201FFFFF, 0x7140000E, 0x618E39E7, 0x71C00008), uint4(0xFFFFFF38, 0x7280000F, 0x00000046, 0x73400000),
+	uint4(0xBCF3CF79, 0x73C0000F, 0x00000F3F, 0x75800000), uint4(0x38E30C23, 0x75C0000F, 0xC00033FF, 0x7680000F),
+	uint4(0x00001FFF, 0x76C00000, 0xCF3C71C3, 0x77000007), uint4(0x30E38EDC, 0x7780000C, 0xC000003F, 0x7800000F),
+	uint4(0xC00001F8, 0x7880000F, 0xFFFFF03F, 0x7980000F), uint4(0x8E7BEFBE, 0x79C00000, 0xB8C0003F, 0x7A00000F),
+	uint4(0xFFF20003, 0x7A800001, 0x40000047, 0x7BC00000), uint4(0x000433DF, 0x7C000000, 0xC21C73DF, 0x7C80000F),
+	uint4(0xC71C70C3, 0x7CC00001, 0xDF020E3E, 0x7D000003), uint4(0xFF000003, 0x7E00000F, 0xFF83EFFF, 0x7E800007),
+	uint4(0xB8800001, 0x7F00000F, 0x38E38E40, 0x7F80000E), uint4(0x000010C7, 0x8040000F, 0x20800007, 0x8140000C),
+	uint4(0xA001FFFF, 0x8180000F, 0x38C30821, 0x81C0000F), uint4(0x000017FF, 0x82400000, 0x30410FEF, 0x82C0000C),
+	uint4(0xBCE30801, 0x83000007, 0xC7000003, 0x83800003), uint4(0x00F7DF3C, 0x83C00000, 0xFEFBEFBE, 0x8440000F),
+	uint4(0x3FF0003F, 0x84800000, 0x10420000, 0x84C00002), uint4(0x30E3CF3E, 0x8540000C, 0x30C38E38, 0x8580000C),
+	uint4(0x800DFFFF, 0x8680000F, 0xFFFC0001, 0x86C00007), uint4(0xC73DFFFF, 0x87C00000, 0x000000CE, 0x88400008),
+	uint4(0x00C3CC00, 0x88800000, 0x8C318611, 0x88C00001), uint4(0x0000003C, 0x8940000C, 0xC0000047, 0x8980000F),
+	uint4(0x82000004, 0x89C00000, 0xC0000020, 0x8A40000F), uint4(0x679E0820, 0x8A800008, 0x1FFFEF39, 0x8B800000),
+	uint4(0x00000004, 0x8C800000, 0x00020820, 0x8DC00000), uint4(0x00FFFC00, 0x8E400000, 0x00830F3E, 0x8F000000),
+	uint4(0xC1000FFF, 0x90800000, 0x1871CF3C, 0x91400006), uint4(0xCF3CF3DF, 0x91C00003, 0xC31C71CF, 0x92400000),
+	uint4(0x3FFFFFBC, 0x92800004, 0x0C10007B, 0x92C00003), uint4(0x9C7182C7, 0x93C00007, 0x00030E3C, 0x94400000),
+	uint4(0xFFF20000, 0x9480000F, 0x7DE7BCF3, 0x94C0000F), uint4(0xFFFFCC00, 0x9500000F, 0x39CC31CF, 0x9580000F),
+	uint4(0x3CFBEFA0, 0x9600000F, 0x00020F3F, 0x96400000), uint4(0xFFFFFF03, 0x96800003, 0x00F80000, 0x97800000),
+	uint4(0xE29A4A20, 0x97C00008, 0x0003F0C0, 0x98000000), uint4(0x000DFFC0, 0x98800000, 0x10C38F3C, 0x98C00000),
+	uint4(0x00000007, 0x99000000, 0x0FFFFFF1, 0x99800000), uint4(0x10020001, 0x99C00002, 0xC000007F, 0x9A00000F),
+	uint4(0xEFB8E31C, 0x9AC00007, 0x00FFFFBC, 0x9B400000), uint4(0xF8000062, 0x9B800007, 0x820BFFFE, 0x9BC00001),
+	uint4(0x00020C30, 0x9C400000, 0x8618618E, 0x9CC00001), uint4(0x18430C61, 0x9DC00002, 0x30C10DF3, 0x9E40000C),
+	uint4(0xFFFFFFFF, 0x9E800008, 0xC003FFFC, 0x9F800000), uint4(0xC30C30C7, 0x9FC00000, 0x79C630C3, 0xA0C00006),
+	uint4(0x000FFF30, 0xA1400000, 0x000001FF, 0xA1800000), uint4(0xAEBEFFFF, 0xA1C0000B, 0xB4E30810, 0xA200000F),
+	uint4(0xCF7FFFBE, 0xA2400001, 0x4218C638, 0xA3000000), uint4(0x71CF3CF7, 0xA3C0000C, 0x3CFBFE00, 0xA480000C),
+	uint4(0x380F8E38, 0xA540000E, 0xFF003FFF, 0xA580000F), uint4(0x3CE30863, 0xA5C0000F, 0xF79CF7FF, 0xA600000E),
+	uint4(0xC3082082, 0xA6400000, 0xC0FFFFFF, 0xA780000F), uint4(0x084477FF, 0xA8000003, 0x631CF7FF, 0xA840000C),
+	uint4(0x1803FFFF, 0xA8800003, 0x00041043, 0xA8C00000), uint4(0x20820863, 0xAA40000C, 0x38E39C71, 0xAAC0000F),
+	uint4(0x3CF3EFFF, 0xAB00000E, 0x20000001, 0xAB400004), uint4(0xFFFB00DF, 0xAB80000F, 0x000011FF, 0xABC00000),
+	uint4(0xCFFFFFFF, 0xAC000009, 0x3CF38F3C, 0xAC80000F), uint4(0x08208208, 0xACC00002, 0xFFFFEFBC, 0xAD40000F),
+	uint4(0x3F00003F, 0xAD800000, 0x618610C3, 0xADC00008), uint4(0xF7DE79E3, 0xAE00000D, 0x30FBFFFF, 0xAE400000),
+	uint4(0x40000001, 0xAF000000, 0x00030000, 0xAF800000), uint4(0xCFFBCC20, 0xAFC00000, 0x4319CE30, 0xB0400000),
+	uint4(0xE79EFFFF, 0xB2400008, 0x3FFC0000, 0xB2800000), uint4(0x0C718618, 0xB3000003, 0x38E38E39, 0xB3C0000E),
+	uint4(0x38C201DF, 0xB400000F, 0xFFFFF7DF, 0xB480000F), uint4(0x1043FDE3, 0xB500000C, 0x433FFFFF, 0xB5800000),
+	uint4(0x38C20041, 0xB5C00006, 0x3FFFFFF8, 0xB6800000), uint4(0xBEBAEBAE, 0xB6C0000F, 0xFFF30001, 0xB700000F),
+	uint4(0xC304003F, 0xB8000003, 0xFFF30000, 0xB900000F), uint4(0x47BE71C3, 0xB9800004, 0x30C30820, 0xBBC00006),
+	uint4(0x431CF7FE, 0xBC400000, 0x38FFF020, 0xBC800008), uint4(0xFFFFFFC7, 0xBD00000F, 0x0001FFFF, 0xBD800000),
+	uint4(0x18E38E38, 0xBE000007, 0x010C7BD0, 0xBE800000), uint4(0x20821861, 0xBEC00008, 0xC60BFF3C, 0xBF000007),
+	uint4(0x3FFDF3AF, 0xBF800000, 0xFFFA0000, 0xC040000F), uint4(0x38C201FF, 0xC080000E, 0x47FFFFFF, 0xC1800008),
+	uint4(0xA33FFFF9, 0xC280000F, 0xBCE38C21, 0xC300000F), uint4(0xFFFFF000, 0xC4800000, 0x1C13BE78, 0xC540000F),
+	uint4(0x07FFFFFE, 0xC5C00008, 0x00000040, 0xC6800000), uint4(0x00FFFFC0, 0xC7400000, 0x00003FFF, 0xC780000C),
+	uint4(0xC71C71CF, 0xC7C00001, 0xBEFBEFBE, 0xC8400003), uint4(0xBE704FFC, 0xC880000F, 0xE77FFFFF, 0xC900000E),
+	uint4(0xB8800000, 0xC940000F, 0x041FFF7D, 0xC9C00001), uint4(0xFEFBCF3C, 0xCA000003, 0xB8800000, 0xCA800007),
+	uint4(0x208430C6, 0xCAC0000C, 0x4103FF7D, 0xCB000000), uint4(0x8E38E38E, 0xCC400003, 0x82084104, 0xCCC00000),
+	uint4(0x38C20043, 0xCD40000E, 0xFFFFFFB8, 0xCD80000F), uint4(0x000333BF, 0xCE800000, 0x3EFFFFFF, 0xCF00000E),
+	uint4(0x30C30C21, 0xCFC00006, 0x00010020, 0xD0800000), uint4(0xBEF38E30, 0xD0C0000D, 0x208217C7, 0xD100000C),
+	uint4(0xFFFF884F, 0xD1C0000F, 0x007FFFCF, 0xD2800000), uint4(0xCE184FF9, 0xD3C00003, 0x4010E7BE, 0xD500000F),
+	uint4(0xC7FFFFFF, 0xD5800000, 0x47FFFFFF, 0xD6800000), uint4(0x00FC0000, 0xD7800000, 0xFFFCF0FE, 0xD900000F),
+	uint4(0xBCE30C20, 0xD940000F, 0xF80001FF, 0xD980000F), uint4(0x20800000, 0xDA000000, 0x30000043, 0xDA80000F),
+	uint4(0x00FBFFFC, 0xDB000000, 0xC77FFFB8, 0xDB400000), uint4(0xC00010C7, 0xDB80000F, 0xEF43CFBF, 0xDD800001),
+	uint4(0xF7DF3CF3, 0xDDC0000D, 0xFF00000F, 0xDE80000F), uint4(0xF7DF7CF3, 0xDEC0000D, 0x30C10FEF, 0xDF40000C),
+	uint4(0xF79E79E7, 0xDFC0000D, 0xEFBDF7DF, 0xE040000D), uint4(0x0003EE20, 0xE080000C, 0x638E79EF, 0xE0C00008),
+	uint4(0x30003FFF, 0xE180000F, 0xFFFBEF3D, 0xE1C0000F), uint4(0x30000007, 0xE280000E, 0x000007C7, 0xE3400000),
+	uint4(0x000010CF, 0xE3800000, 0x0E38E3AF, 0xE3C00003), uint4(0x00000000, 0xE400000F, 0xFEF3880F, 0xE480000F),
+	uint4(0xF3CF7FB8, 0xE5C00008, 0x000010C3, 0xE8400000), uint4(0x0300001F, 0xE8800000, 0x0477CF3C, 0xE9800007),
+	uint4(0x20000003, 0xEA00000E, 0xFFFFFFBD, 0xEA400007), uint4(0x07FFFE01, 0xEA800000, 0xFFFF8040, 0xEB80000F),
+	uint4(0x0C218421, 0xEBC00001, 0x208618A2, 0xEC400008), uint4(0x1C618610, 0xECC00007, 0xC87BFFFF, 0xED00000D),
+	uint4(0x000000DF, 0xED800008, 0xFEFFDF7B, 0xEDC00007), uint4(0xFFFFEF3C, 0xEE800000, 0x208630C7, 0xEEC0000C),
+	uint4(0xC73DCE30, 0xEF800000, 0x1E7DF7DF, 0xEFC00007), uint4(0x80F7DF79, 0xF0C00000, 0x3FF38C20, 0xF1000000),
+	uint4(0x3B420001, 0xF180000F, 0xFFF30082, 0xF1C0000F), uint4(0x38C20043, 0xF200000F, 0xFFF38C00, 0xF4000007),
+	uint4(0x00000000, 0xF500000E, 0xFFFE1FFF, 0xF5C0000F), uint4(0x3CF7D343, 0xF6C0000F, 0xCF39CF38, 0xF7000001),
+	uint4(0x0083EFFF, 0xF8400000, 0x20E3EFC0, 0xF8800000), uint4(0x00082086, 0xF8C00000, 0x0FFB8801, 0xF9800000),
+	uint4(0xC3041000, 0xF9C00000, 0xFF000001, 0xFA40000F), uint4(0xFFFF0000, 0xFB80000F, 0x470C73CF, 0xFBC00000),
+	uint4(0x00000200, 0xFC000000, 0xFFFFE001, 0xFC40000F), uint4(0xFFFFEC01, 0xFD40000F, 0xFF000003, 0xFD800003),
+	uint4(0xEFF9EF3C, 0xFDC00007, 0xFFC00000, 0xFE00000F), uint4(0xCE38C210, 0xFEC00001, 0x000DEE30, 0xFF800000),
+	uint4(0x0830C30E, 0xFFC00002, 0x00000000, 0x00000000),
+};
+
+#define PARTITION_2_COUNT_8X5 584
+#define PARTITION_2_WORDS_8X5 2
+static const uint4 partition_2_8x5[292] =
+{
+	uint4(0x0F1F1F1E, 0x0040000F, 0x07070F0F, 0x00800003), uint4(0x7C787973, 0x00C0003C, 0xE0800000, 0x010000F0),
+	uint4(0x07070F1F, 0x01400003, 0xE1606127, 0x01C000E1), uint4(0x1F1F3F3F, 0x0200000F, 0xFCFCF8F0, 0x024000FE),
+	uint4(0xFCFCFCFE, 0x028000F8, 0x040C1830, 0x02C00002), uint4(0xC387070F, 0x038000C1, 0xFEE00000, 0x03C000FF),
+	uint4(0x01010101, 0x04000001, 0x077FFFFF, 0x04400000), uint4(0x00000007, 0x048000FF, 0xFCFCFCFC, 0x04C000FC),
+	uint4(0xC0C0C0C0, 0x050000C0, 0xC0C08081, 0x054000E0), uint4(0xF8F0C181, 0x05C000FC, 0x1F0F0F0F, 0x0600001F),
+	uint4(0xE0E0E0E7, 0x064000E0, 0x000000FF, 0x0680001F), uint4(0x31333373, 0x06C00031, 0xF0F0F0F0, 0x070000F0),
+	uint4(0xF0F0E0E0, 0x074000F8, 0x3F7F7F7F, 0x0780003F), uint4(0xC2C2C2C2, 0x07C000C2, 0x80808080, 0x08000080),
+	uint4(0xFC000007, 0x084000FF, 0x00FFFF00, 0x09000000), uint4(0x1E1F1F1F, 0x0940001E, 0xFFDFDFDF, 0x09C000FF),
+	uint4(0xFFFF0007, 0x0A8000FF, 0xF0F8FCFE, 0x0AC000E0), uint4(0x070F1E3E, 0x0B400003, 0xFF00FFFF, 0x0B8000FF),
+	uint4(0x7D7C7C7C, 0x0BC0007F, 0x10101010, 0x0C000010), uint4(0xC1810307, 0x0C4000E0, 0xF8E0C080, 0x0C8000FC),
+	uint4(0x20206060, 0x0CC00020, 0xFEFEFE00, 0x0D4000FE), uint4(0x3FFFFEF9, 0x0D8000CF, 0x40008001, 0x0DC00000),
+	uint4(0x0000030F, 0x0E000080, 0x7C7830DF, 0x0E8000FE), uint4(0x80010000, 0x0EC000C0, 0x0307070F, 0x0F400001),
+	uint4(0x3FBFBF00, 0x0F80003F, 0x3EFCF0C0, 0x0FC00001), uint4(0x00000104, 0x10400000, 0x1F1F0F0F, 0x1080001F),
+	uint4(0x78787878, 0x10C00078, 0x0F0F0F1F, 0x11000007), uint4(0x1F3FFFFF, 0x11400007, 0x00030E38, 0x11800000),
+	uint4(0x9EBE3E7E, 0x11C000DE, 0x1F3F7FFF, 0x1200000F), uint4(0xF8FEFFFC, 0x124000F0, 0x02040800, 0x12800001),
+	uint4(0x3870C080, 0x12C0000C, 0x1EFCFCF8, 0x13000000), uint4(0xE0F0F0F8, 0x134000E0, 0xFFFF0000, 0x138000FF),
+	uint4(0xF0F8E8E8, 0x13C000F0, 0xDEDEDEDE, 0x14C0009E), uint4(0x3F3F3E7E, 0x1580001F, 0x808484C4, 0x15C00000),
+	uint4(0x03030787, 0x16000001, 0x0000017F, 0x16400000), uint4(0x3F7FFF80, 0x1680003F, 0x1F3F3F7F, 0x16C0001F),
+	uint4(0xE0FEFF00, 0x17800000, 0x0C04FBF9, 0x17C0001E), uint4(0x0F3F7EFC, 0x18800003, 0x1C1C1C1C, 0x18C0001C),
+	uint4(0xFCF87007, 0x190000FE, 0x1F1FCFC7, 0x19400047), uint4(0x18181818, 0x19C00018, 0x03070F1F, 0x1AC00001),
+	uint4(0x8F1F3F7F, 0x1B0000C7, 0xC1C1C387, 0x1B4000C0), uint4(0xF0F0F013, 0x1B8000F0, 0x00000103, 0x1C000000),
+	uint4(0x3FFFFFFF, 0x1C80001F, 0xF2FCF8FC, 0x1CC000F2), uint4(0x07030100, 0x1D00000F, 0x80800103, 0x1DC000C0),
+	uint4(0x273F3F3F, 0x1E400038, 0x87C7EF10, 0x1E800003), uint4(0x9F9F9F9F, 0x1EC0009F, 0x0000071F, 0x1F400000),
+	uint4(0xCF8F1F1F, 0x200000CF, 0x0F1F1F1F, 0x2040000F), uint4(0x10C00003, 0x20800004, 0xE0E0E1E3, 0x20C000E0),
+	uint4(0x00FFFFFF, 0x21000000, 0x0F1C103F, 0x2180008F), uint4(0x180800FF, 0x21C00018, 0x00000000, 0x220000FF),
+	uint4(0xE0C0C080, 0x224000F0, 0x00010579, 0x22800080), uint4(0xF0C80C0E, 0x22C000EE, 0x80010307, 0x238000C0),
+	uint4(0x1F1F1F1F, 0x23C0001F, 0x1C30E080, 0x24000006), uint4(0xFFFCE000, 0x24800000, 0xDF9F3F7F, 0x24C000EF),
+	uint4(0x070F1F3F, 0x25000007, 0x80000000, 0x254000C0), uint4(0xFFFFFF00, 0x258000FF, 0xBCB2A2C2, 0x25C000BE),
+	uint4(0xC0800000, 0x268000C0, 0x80C0E0F0, 0x27000000), uint4(0xE0E0E1EE, 0x278000E0, 0xE3C30707, 0x27C000F9),
+	uint4(0x00007F3F, 0x29400000, 0x3F7E7CF8, 0x29C0001F), uint4(0xF9F9F3E7, 0x2A0000FC, 0x0800FBF9, 0x2A400018),
+	uint4(0x0278C000, 0x2A800000, 0x0000031F, 0x2AC00000), uint4(0xF1F70060, 0x2B0000F8, 0x1C3870E0, 0x2B80000F),
+	uint4(0x2000FFEF, 0x2BC00060, 0x01020204, 0x2C400001), uint4(0x0000FEFF, 0x2C800000, 0x00000001, 0x2D400000),
+	uint4(0x0E0C0C0C, 0x2DC0000E, 0x8F0F0F0F, 0x2E00008F), uint4(0x38383C3C, 0x2FC00030, 0xE0E0E0C0, 0x304000E0),
+	uint4(0xFFFEFCF8, 0x308000FF, 0xB9999999, 0x30C000B9), uint4(0x3F3E3E3E, 0x3100003F, 0xFEFFFFFF, 0x318000F8),
+	uint4(0x8F9E1C1D, 0x31C000CF, 0xDFDF0010, 0x32C0009F), uint4(0x01010307, 0x33000000, 0x0000000F, 0x33800000),
+	uint4(0xFF7F3F1F, 0x33C00000, 0xF8F8F8F8, 0x344000F8), uint4(0xFEFFFFFF, 0x348000FC, 0xCE8C8C08, 0x34C000CE),
+	uint4(0xC0800106, 0x354000E0, 0x3FFFF8C0, 0x3580009F), uint4(0x8C8C9C98, 0x35C000CC, 0x01010202, 0x36000001),
+	uint4(0x03070F1F, 0x36400003, 0xFFF88000, 0x36800000), uint4(0x000000C0, 0x370000F8, 0x8F9F1F3F, 0x378000C7),
+	uint4(0xF8F0E0C3, 0x384000FC, 0xFCF8E0C0, 0x388000FF), uint4(0x03030606, 0x38C00001, 0xC0808103, 0x394000E0),
+	uint4(0x60800001, 0x39800030, 0x00FFFBF3, 0x39C00001), uint4(0xFFFF0301, 0x3A0000FF, 0xF0E0C1A1, 0x3AC000C8),
+	uint4(0x10103030, 0x3B000011, 0x00000003, 0x3B400000), uint4(0x1F0F0703, 0x3C00003F, 0xFEFCF0E1, 0x3DC0007F),
+	uint4(0x8F8F0F0F, 0x3E0000CF, 0x7F7F7F7F, 0x3E40007E), uint4(0x7F0F0306, 0x3E8000FF, 0xFF1F0001, 0x3F0000FF),
+	uint4(0xFFFFFCF0, 0x3F4000FF, 0x00011EF0, 0x3F800000), uint4(0x1D3C3C7C, 0x3FC0001D, 0x0004040C, 0x404000FD),
+	uint4(0x1BE70F1F, 0x40800000, 0xC080030F, 0x410000E0), uint4(0x000080C0, 0x41400000, 0x207C7F7E, 0x41800030),
+	uint4(0xE08000FF, 0x420000F0, 0x06060606, 0x42800006), uint4(0x20004040, 0x42C00020, 0xF080010F, 0x438000FE),
+	uint4(0xC7C7C7C6, 0x43C000C3, 0x0000FFFF, 0x440000FF), uint4(0xE0E0F0F8, 0x444000C0, 0x00000060, 0x45400040),
+	uint4(0x1F1F1E30, 0x4580001F, 0x0F1E1E1C, 0x45C0000F), uint4(0xF8F8F8FC, 0x464000F8, 0x7FFFFFFE, 0x4700001F),
+	uint4(0xE0E0F0F0, 0x478000C0, 0xC0808000, 0x47C000C0), uint4(0xE0E0E0C0, 0x484000F0, 0x3E7C7CF9, 0x48C0001E),
+	uint4(0x307070F0, 0x49000030, 0x00C0F0FC, 0x49400000), uint4(0x071F2F7F, 0x49C00007, 0x7FFFFFFF, 0x4A00001F),
+	uint4(0x000001FF, 0x4A800000, 0xC6C68686, 0x4AC000C7), uint4(0x80000000, 0x4B000080, 0xC000010F, 0x4B8000F8),
+	uint4(0x0000C0FC, 0x4BC00000, 0x473FBFBF, 0x4C000040), uint4(0xFFFEFEFD, 0x4C40007F, 0x3C3020C0, 0x4C80001F),
+	uint4(0xFFFEFEFC, 0x4CC00000, 0x7FFFFF00, 0x4D40001F), uint4(0xFEFF0000, 0x4E8000F0, 0xE0E0E0F0, 0x4F0000C0),
+	uint4(0x80800001, 0x4F4000C0, 0xFFFF3F1F, 0x4F8000FF), uint4(0x23636362, 0x4FC00023, 0x0101030F, 0x50C00000),
+	uint4(0x01071F7F, 0x51000000, 0x00000103, 0x51400080), uint4(0x001FFF80, 0x51800000, 0x7878787C, 0x51C0007C),
+	uint4(0xF3F7E7EF, 0x524000F1, 0x03070F1F, 0x52800081), uint4(0x0404040C, 0x53C00004, 0x0F1F1F1E, 0x5440008F),
+	uint4(0x306061C1, 0x54C00030, 0xC1818303, 0x554000C0), uint4(0x00C0FFFF, 0x558000FF, 0x1F7FFFFF, 0x55C000CF),
+	uint4(0x40404040, 0x56000000, 0x3C383870, 0x56C0001C), uint4(0xF3E3C787, 0x570000F9, 0xFC7C0704, 0x57C000FE),
+	uint4(0x0701FFFE, 0x5800001F, 0xF0E0E0C0, 0x584000F0), uint4(0xE3870F1C, 0x588000F9, 0x6FCFCFCF, 0x58C0006F),
+	uint4(0x1E1E1E1E, 0x59C0001E, 0xFEF8F0C0, 0x5A4000FF), uint4(0x0606060E, 0x5A800007, 0x0C0C0C0C, 0x5AC0000C),
+	uint4(0xFFFEF8F0, 0x5B8000FF, 0xFF000007, 0x5BC000FF), uint4(0x03010107, 0x5C000083, 0xFFF8C07F, 0x5C8000FF),
+	uint4(0x30303030, 0x5CC00030, 0x1FFFFFFF, 0x5D800000), uint4(0x33737373, 0x5DC00033, 0xC0800103, 0x5E000060),
+	uint4(0xDFE01018, 0x5F00009F, 0x00000000, 0x5F400080), uint4(0xFCF0C307, 0x6080007F, 0xFBFBFBF9, 0x60C00000),
+	uint4(0xFCF8F0E1, 0x610000FC, 0xC0000000, 0x614000F0), uint4(0xC00007FF, 0x618000FF, 0x80808000, 0x61C000C0),
+	uint4(0x00FFFEF8, 0x62000000, 0x1E1C3C3C, 0x6240001E), uint4(0x0F1F1F3F, 0x62800007, 0x9F0060F0, 0x62C0000F),
+	uint4(0x00818101, 0x63C00040, 0x0000E0FF, 0x64800000), uint4(0xFCF8F8F0, 0x64C000FC, 0xFC7C1C05, 0x650000FC),
+	uint4(0x80000103, 0x65400080, 0x01010303, 0x65C00080), uint4(0x00000020, 0x66400004, 0x8080C0E0, 0x66800000),
+	uint4(0xC0C1430F, 0x66C000C0, 0x7C7C7C3C, 0x6700007C), uint4(0x0103070F, 0x67C00000, 0xF8F0E080, 0x6880007E),
+	uint4(0x4FDF9FBE, 0x68C00067, 0xF8E0C187, 0x6980007C), uint4(0x80000003, 0x69C000F8, 0x7FFFFFFE, 0x6A00003F),
+	uint4(0xFCF8E3DF, 0x6A8000FE, 0x38FEFFFF, 0x6B8000E7), uint4(0x8F1F1F1F, 0x6C0000CF, 0xFFFFFEFE, 0x6C4000FF),
+	uint4(0x0000001F, 0x6D000000, 0x0000020C, 0x6D400000), uint4(0x1F3F7CC0, 0x6D80000F, 0xCFDFBF7F, 0x6DC000E7),
+	uint4(0x01020408, 0x6E000000, 0x0000010F, 0x6E400000), uint4(0x7F7FFFFF, 0x6F00007F, 0xE0E0271F, 0x6F4000E0),
+	uint4(0x00003FFF, 0x6F800000, 0xE7C7C7C7, 0x6FC000E7), uint4(0x0000F000, 0x70800000, 0xC7C7C7C7, 0x70C000C7),
+	uint4(0x070F1F3F, 0x71000003, 0x877FFFFF, 0x714000E0), uint4(0x00000000, 0x71800001, 0xE3E3E7E7, 0x71C000E1),
+	uint4(0x3F3F3C38, 0x7280003F, 0x00000106, 0x73400000), uint4(0xFFFEFEFE, 0x738000FF, 0x7C7CFDF9, 0x73C0003C),
+	uint4(0x9FBFBF7F, 0x7440009F, 0x0000FCFF, 0x75800000), uint4(0xF8F0F0E3, 0x75C000F8, 0x00000000, 0x764000C0),
+	uint4(0x00030F3F, 0x76800000, 0x00013FFF, 0x76C00000), uint4(0x0F070703, 0x7700000F, 0xF8F8FB1C, 0x778000F0),
+	uint4(0xBF000000, 0x77C000BF, 0x00000778, 0x78800000), uint4(0x7CF8F0E0, 0x7900003E, 0xFFFF007F, 0x798000FF),
+	uint4(0x1E7EFEFE, 0x79C0000E, 0xF0C0807F, 0x7A0000F8), uint4(0xFCE00003, 0x7A80003F, 0x03030707, 0x7AC00001),
+	uint4(0x00000107, 0x7BC00000, 0x01030F1F, 0x7C000000), uint4(0x07070F9F, 0x7C800002, 0x07070303, 0x7CC00007),
+	uint4(0x00E0F8FE, 0x7D00001F, 0x7E7E7E7E, 0x7D40007E), uint4(0xFFFFFF7F, 0x7D8000FF, 0x00000003, 0x7E0000FF),
+	uint4(0x1F1F0F0F, 0x7E40009F, 0xE0FEFFFF, 0x7E80007F), uint4(0xE0800001, 0x7F0000F8, 0xF8F8F900, 0x7F8000F8),
+	uint4(0x808081C3, 0x7FC00000, 0x00010307, 0x804000C0), uint4(0xE0C08087, 0x814000E0, 0x001FFFFF, 0x818000E0),
+	uint4(0xF0F0E0E1, 0x81C000F8, 0x00011FFF, 0x82400000), uint4(0x1010FFEF, 0x82C00030, 0x78F0E0C1, 0x8300003C),
+	uint4(0x80000003, 0x83800087, 0xFDFDFCFC, 0x83C00000), uint4(0xFCC000FF, 0x848000FF, 0x10200040, 0x84C00010),
+	uint4(0x787C7C7E, 0x85400070, 0xF0F8F8F8, 0x858000F0), uint4(0x80808080, 0x85C000C0, 0x031FFFFF, 0x86800080),
+	uint4(0xFF000001, 0x86C000FF, 0x0F1F3F7F, 0x87C00007), uint4(0x8000030E, 0x884000C0, 0xF0FCF000, 0x888000C0),
+	uint4(0x0C181811, 0x88C0008C, 0x80808187, 0x89800000), uint4(0x00000004, 0x89C00002, 0x27E0E0E0, 0x8A8000E7),
+	uint4(0xFFFEFCF9, 0x8B80001F, 0xE0C0C0C0, 0x8BC000E0), uint4(0x00000004, 0x8C800000, 0x40606060, 0x8DC00040),
+	uint4(0xFFFFF000, 0x8E400000, 0xE0F0FCFE, 0x8F0000C0), uint4(0x0000FFFF, 0x90800001, 0xBCBCBCBC, 0x90C000BC),
+	uint4(0x1C1C3C3C, 0x91400018, 0x8F8F8F9F, 0x91C0008F), uint4(0x0707070F, 0x92400003, 0xBF3F3E7C, 0x9280003F),
+	uint4(0x8480817B, 0x92C0008C, 0x1C180B07, 0x93C0001C), uint4(0xC0F0F8FC, 0x94400080, 0xFCE08000, 0x948000FF),
+	uint4(0xF9FBF3F3, 0x94C000FD, 0xF3C3870F, 0x958000F9), uint4(0xFEFEFEE0, 0x960000FC, 0x00E0FCFF, 0x96400000),
+	uint4(0xFFFFFCC3, 0x968000FF, 0x7E000000, 0x97800000), uint4(0xE6E4E8E0, 0x97C000E2, 0x007F0300, 0x98000000),
+	uint4(0x031FFF00, 0x98800000, 0x30383C3C, 0x98C00010), uint4(0x00000007, 0x99000000, 0xFFFFFFF1, 0x9980000F),
+	uint4(0x00204081, 0x99C00010, 0x7E7E3E3E, 0x9A80007E), uint4(0xEECECC9C, 0x9AC0002F, 0xFFFFFEFC, 0x9B400000),
+	uint4(0xC000C1E2, 0x9B800038, 0x02FF7F7E, 0x9BC00002), uint4(0xC0E0F0F0, 0x9C400080, 0xC6C6C6CE, 0x9CC000C6),
+	uint4(0x10303161, 0x9DC00018, 0x3010F7F3, 0x9E4000F0), uint4(0x0307078F, 0x9F000003, 0x00FFFFFC, 0x9F800000),
+	uint4(0x43838387, 0x9FC00043, 0xB1A383C3, 0xA0C000B9), uint4(0x037FFCF0, 0xA1400000, 0x0000077F, 0xA1800000),
+	uint4(0xEFEFFFFF, 0xA1C000EE, 0xF8F0E0D0, 0xA20000F4), uint4(0x1F3F7EFE, 0xA240000F, 0x70707070, 0xA2800070),
+	uint4(0x00000307, 0xA2C00000, 0x060C1838, 0xA3000002), uint4(0xF3F3F3F7, 0xA3C000F1, 0xFEFFF8C0, 0xA48000FC),
+	uint4(0x20202020, 0xA4C00020, 0x0378F8F8, 0xA5400038), uint4(0x00033FFF, 0xA58000FF, 0xF8F0E1E3, 0xA5C000FC),
+	uint4(0xE7CF9F3F, 0xA60000F7, 0x02020202, 0xA6400003), uint4(0xF0F0E0E0, 0xA6800078, 0x0000007F, 0xA7000000),
+	uint4(0x11071F7F, 0xA8000008, 0xC7CF9F3F, 0xA84000E3), uint4(0x00BF3F7F, 0xA8800018, 0x81810103, 0xA8C000C0),
+	uint4(0x787971F1, 0xAAC000F8, 0xFCFEFFFF, 0xAB0000FC), uint4(0x40800001, 0xAB400020, 0xFEF0831F, 0xAB8000FF),
+	uint4(0x0001073F, 0xABC00000, 0x3FFFFFFF, 0xAC0000CF), uint4(0xFCF83CFC, 0xAC8000FC, 0x08080808, 0xACC00008),
+	uint4(0x7F3F3F1F, 0xAD00007F, 0xFFFEFEFC, 0xAD4000FF), uint4(0x000000FF, 0xAD8000FF, 0x61614343, 0xADC00021),
+	uint4(0xF7E7E7E3, 0xAE0000F7, 0xFEFFFFFF, 0xAE4000F0), uint4(0x80800001, 0xAF000080, 0x000080E0, 0xAF400000),
+	uint4(0x00F00000, 0xAF800000, 0x7EFCF0E0, 0xAFC0000F), uint4(0x061C3870, 0xB0400003, 0x7C7C7CFC, 0xB0C0007C),
+	uint4(0xFFFFFCF8, 0xB1C0007F, 0xE76F3F3F, 0xB24000E7), uint4(0x1C181818, 0xB300000C, 0x78787879, 0xB3C00038),
+	uint4(0xF0E0C79F, 0xB40000F8, 0x7F3F1F1F, 0xB480007F), uint4(0x10FFF7E3, 0xB5000010, 0xC0C0C1C3, 0xB54000C0),
+	uint4(0x0F3F7FFF, 0xB5800003, 0x306041C1, 0xB5C00038), uint4(0xFFFFFFF8, 0xB680007F, 0xEEEEEEEE, 0xB6C000FE),
+	uint4(0xFCF08001, 0xB70000FF, 0x010000FF, 0xB8000003), uint4(0xE7676767, 0xB8C000E7, 0xFCF0C000, 0xB90000FF),
+	uint4(0x2FE7C7C3, 0xB9800007, 0xFFFFFFC0, 0xBB0000FF), uint4(0x307060E0, 0xBBC00030, 0x070F1F3E, 0xBC400003),
+	uint4(0xFFFF00E0, 0xBC8000F8, 0xFFFFFF87, 0xBD0000FF), uint4(0x001FFFFF, 0xBD800000, 0x38383838, 0xBE000018),
+	uint4(0x83C7EF10, 0xBE800001, 0x60616161, 0xBEC00060), uint4(0x02FFFCFC, 0xBF000006, 0x3F1F0EEF, 0xBF80003F),
+	uint4(0x00008080, 0xC0000000, 0xF060477F, 0xC08000F8), uint4(0x3FFF7F7F, 0xC1800047, 0x40404040, 0xC1C00040),
+	uint4(0x0F7FFFF9, 0xC28000E3, 0xF8F8F0E1, 0xC30000FC), uint4(0xFFFF0000, 0xC480007F, 0x04FBF9F8, 0xC540001C),
+	uint4(0x7FFFBFBE, 0xC5C00007, 0x80808180, 0xC6800080), uint4(0x00000007, 0xC70000C0, 0x00033FFF, 0xC78000C0),
+	uint4(0x0707070F, 0xC7C00007, 0xFEFEFEFE, 0xC840007E), uint4(0x1C04FFFC, 0xC880007E, 0xDF3FFFFF, 0xC90000E7),
+	uint4(0xE0800000, 0xC94000F8, 0x077FFDFD, 0xC9C00004), uint4(0xFEFCFCFC, 0xCA00007E, 0xE0800000, 0xCA800078),
+	uint4(0x61C38386, 0xCAC00060, 0x00FFFDFD, 0xCB000001), uint4(0xC0800103, 0xCB4000E0, 0x0E0E0E0E, 0xCC40000E),
+	uint4(0x82848484, 0xCCC00042, 0xF0E0C1C3, 0xCD4000F8), uint4(0x80800000, 0xCE4000C0, 0xC0F30E3F, 0xCE800000),
+	uint4(0x70F0F0E1, 0xCFC00030, 0x00100020, 0xD0800000), uint4(0xE0611FC7, 0xD10000E0, 0xFFF8E10F, 0xD1C000FF),
+	uint4(0x7E7EFEFE, 0xD240007E, 0x1FFF3F0F, 0xD2800000), uint4(0x83838787, 0xD3400081, 0x0604FFF9, 0xD3C0000E),
+	uint4(0x01010303, 0xD4400000, 0xBEBEBEBE, 0xD4C000BE), uint4(0x040E1E3E, 0xD5000000, 0x3FFFFFFF, 0xD5800007),
+	uint4(0xFF7F7F7F, 0xD60000FF, 0xFF000000, 0xD7800000), uint4(0x3F0F03FE, 0xD90000FF, 0xF8F0F0E0, 0xD94000FC),
+	uint4(0x8000077F, 0xD98000F8, 0x8E8E8E8E, 0xD9C0008E), uint4(0x20004000, 0xDA000020, 0xC0000103, 0xDA8000F0),
+	uint4(0xFEFFFFFC, 0xDB000080, 0x1F3FFEF8, 0xDB400007), uint4(0xC0C0C0E0, 0xDBC00080, 0x7E786000, 0xDC40007F),
+	uint4(0x103C7EFF, 0xDD8000EF, 0x77737373, 0xDDC00077), uint4(0x0000000F, 0xDE8000FF, 0xF7F7F3F3, 0xDEC000F7),
+	uint4(0x3010FFEF, 0xDF400030, 0xE7E7E7E7, 0xDFC000F7), uint4(0xEFDFDFDF, 0xE04000EF, 0x003EF8E0, 0xE08000C0),
+	uint4(0xE3E7E7EF, 0xE0C000E3, 0xC0033FFF, 0xE18000F0), uint4(0xFEFEFCFD, 0xE1C000FF, 0xC0000007, 0xE28000F0),
+	uint4(0xC040DFC7, 0xE34000C0, 0x0001030F, 0xE3800000), uint4(0xCECECEEF, 0xE3C000CE, 0xFCF8E0CF, 0xE48000FE),
+	uint4(0xC7878F8F, 0xE4C000C3, 0x20606060, 0xE5800020), uint4(0xF3F7FEF8, 0xE5C000F3, 0xFFFFFEF8, 0xE640007F),
+	uint4(0x43434347, 0xE6C00043, 0xC0800000, 0xE7000070), uint4(0xC3838383, 0xE7C000C3, 0x00010303, 0xE8400000),
+	uint4(0xC0C0C0DF, 0xE88000C3, 0x1DFCFCFC, 0xE9800004), uint4(0x80000003, 0xEA0000E0, 0x7FFFFEFD, 0xEA4000BF),
+	uint4(0x3FFFF881, 0xEA800007, 0xFFF88100, 0xEB8000FF), uint4(0x08181021, 0xEBC0000C, 0xE1E1E2E2, 0xEC4000E0),
+	uint4(0x98181810, 0xECC0009C, 0x1E3F7FFF, 0xED0000C8), uint4(0x3F3D7D7B, 0xEDC0003E, 0xFFFEFCFC, 0xEE80007F),
+	uint4(0xE1E3C3C7, 0xEEC000E0, 0x0F1C3870, 0xEF800007), uint4(0xDFDF9F9F, 0xEFC000DE, 0x031FFFFF, 0xF0800000),
+	uint4(0xFDFDFDF9, 0xF0C00000, 0xFCF8F0E0, 0xF10000FF), uint4(0x10E0C081, 0xF18000FB, 0xBCF08242, 0xF1C000BF),
+	uint4(0xF0E0C183, 0xF20000F8, 0x0001070F, 0xF2800080), uint4(0xF9F9B9B9, 0xF2C000F9, 0x7CF8F0C0, 0xF400003F),
+	uint4(0x6060E0E0, 0xF4400060, 0x61616161, 0xF4C00061), uint4(0xFFE13FFF, 0xF5C000FF, 0xFD3D8D83, 0xF6C000FC),
+	uint4(0x0E1C3C78, 0xF700000F, 0x7C7C7C7C, 0xF740007C), uint4(0xE0FEFFFF, 0xF8400000, 0xF8FEFF00, 0xF88000E0),
+	uint4(0x02020206, 0xF8C00000, 0x7E78F0C0, 0xF940007F), uint4(0xFEF8E001, 0xF980000F, 0xC1C1C0C0, 0xF9C000C3),
+	uint4(0x00000001, 0xFA4000FF, 0xFFF00000, 0xFB8000FF), uint4(0x83070F0F, 0xFBC00087, 0x00000800, 0xFC000000),
+	uint4(0xFFFE8001, 0xFC4000FF, 0xFFFEF081, 0xFD40007F), uint4(0x3E5E7CBC, 0xFDC0002F, 0xF0800000, 0xFE0000FF),
+	uint4(0x30787878, 0xFE800030, 0x0E0C0810, 0xFEC0000E), uint4(0x031EF8F0, 0xFF800000, 0x0C0C0C0E, 0xFFC00008),
+};
+
+#define PARTITION_2_COUNT_8X6 640
+#define PARTITION_2_WORDS_8X6 2
+static const uint4 partition_2_8x6[320] =
+{
+	uint4(0x0F1F1F1E, 0x0040070F, 0x07070F0F, 0x00800303), uint4(0x7C787973, 0x00C07E3C, 0xE0800000, 0x010078F0),
+	uint4(0x07070F1F, 0x01400303, 0xE1606127, 0x01C0E3E1), uint4(0x1F1F3F3F, 0x02000F0F, 0xFCFCF8F0, 0x0240FFFE),
+	uint4(0xFCFCFCFE, 0x0280F8F8, 0x040C1830, 0x02C08002), uint4(0xFFFFFFFF, 0x03407FFF, 0xC387070F, 0x0380E0C1),
+	uint4(0xFEE00000, 0x03C01FFF, 0x01010101, 0x04000101), uint4(0x077FFFFF, 0x04400000, 0x00000007, 0x048000FF),
+	uint4(0xFCFCFCFC, 0x04C0FCFC, 0xC0C0C0C0, 0x0500C0C0), uint4(0xC0C08081, 0x0540E0E0, 0xF8F0C181, 0x05C0FEFC),
+	uint4(0x1F0F0F0F, 0x06001F1F, 0xE0E0E0E7, 0x0640E0E0), uint4(0x000000FF, 0x0680FF1F, 0x31333373, 0x06C01931),
+	uint4(0xF0F0F0F0, 0x0700F0F0, 0xF0F0E0E0, 0x0740F8F8), uint4(0x3F7F7F7F, 0x07803F3F, 0xC2C2C2C2, 0x07C0C2C2),
+	uint4(0x80808080, 0x08008080, 0xFC000007, 0x0840FFFF), uint4(0x00FFFF00, 0x09000000, 0x1E1F1F1F, 0x09400E1E),
+	uint4(0xFFDFDFDF, 0x09C000FF, 0xFFFF0007, 0x0A8000FF), uint4(0xF0F8FCFE, 0x0AC0C0E0, 0xC0C0C0C0, 0x0B00C1C0),
+	uint4(0x070F1E3E, 0x0B400103, 0xFF00FFFF, 0x0B80FFFF), uint4(0x7D7C7C7C, 0x0BC07F7F, 0x10101010, 0x0C001010),
+	uint4(0xC1810307, 0x0C40F8E0, 0xF8E0C080, 0x0C80FFFC), uint4(0x20206060, 0x0CC0A020, 0xFEFEFE00, 0x0D40FEFE),
+	uint4(0x3FFFFEF9, 0x0D80F3CF, 0x40008001, 0x0DC02000), uint4(0x0000030F, 0x0E00C080, 0x7C7830DF, 0x0E8000FE),
+	uint4(0x80010000, 0x0EC040C0, 0x00000000, 0x0F00FF00), uint4(0x0307070F, 0x0F400101, 0x3FBFBF00, 0x0F803F3F),
+	uint4(0x3EFCF0C0, 0x0FC00001, 0x00000104, 0x10400000), uint4(0x1F1F0F0F, 0x10801F1F, 0x78787878, 0x10C07878),
+	uint4(0x0F0F0F1F, 0x11000707, 0x1F3FFFFF, 0x11400307), uint4(0x00030E38, 0x11800000, 0x9EBE3E7E, 0x11C0CEDE),
+	uint4(0x1F3F7FFF, 0x1200070F, 0xF8FEFFFC, 0x1240E0F0), uint4(0x02040800, 0x12800001, 0x3870C080, 0x12C0060C),
+	uint4(0x1EFCFCF8, 0x13000000, 0xE0F0F0F8, 0x1340C0E0), uint4(0xFFFF0000, 0x1380FFFF, 0xF0F8E8E8, 0x13C0F0F0),
+	uint4(0xDEDEDEDE, 0x14C09E9E, 0x3F3F3E7E, 0x15801F1F), uint4(0x808484C4, 0x15C00000, 0x03030787, 0x16000101),
+	uint4(0x0000017F, 0x16400100, 0x3F7FFF80, 0x16801F3F), uint4(0x1F3F3F7F, 0x16C00F1F, 0xE0FEFF00, 0x17800000),
+	uint4(0x0C04FBF9, 0x17C01E1E, 0x0F3F7EFC, 0x18800103), uint4(0x1C1C1C1C, 0x18C0181C, 0xFCF87007, 0x1900FFFE),
+	uint4(0x1F1FCFC7, 0x1940C347, 0x18181818, 0x19C01818), uint4(0x03070F1F, 0x1AC00001, 0x8F1F3F7F, 0x1B00E3C7),
+	uint4(0xC1C1C387, 0x1B40C0C0, 0xF0F0F013, 0x1B800FF0), uint4(0x00000103, 0x1C000000, 0x00000000, 0x1C400100),
+	uint4(0x3FFFFFFF, 0x1C800F1F, 0xF2FCF8FC, 0x1CC0E3F2), uint4(0x07030100, 0x1D001F0F, 0x80800103, 0x1DC060C0),
+	uint4(0x273F3F3F, 0x1E403E38, 0x87C7EF10, 0x1E800303), uint4(0x9F9F9F9F, 0x1EC09F9F, 0x0000071F, 0x1F408000),
+	uint4(0xCF8F1F1F, 0x2000EFCF, 0x0F1F1F1F, 0x20400F0F), uint4(0x10C00003, 0x20800104, 0xE0E0E1E3, 0x20C0E0E0),
+	uint4(0x00FFFFFF, 0x21000000, 0x0F1C103F, 0x2180E78F), uint4(0x180800FF, 0x21C03818, 0x00000000, 0x2200FFFF),
+	uint4(0xE0C0C080, 0x2240F0F0, 0x00010579, 0x2280C080), uint4(0xF0C80C0E, 0x22C0CFEE, 0x80010307, 0x2380E0C0),
+	uint4(0x1F1F1F1F, 0x23C01F1F, 0x1C30E080, 0x24000306), uint4(0xFFFCE000, 0x24800000, 0xDF9F3F7F, 0x24C0FFEF),
+	uint4(0x070F1F3F, 0x25000307, 0x80000000, 0x2540F0C0), uint4(0xFFFFFF00, 0x25801FFF, 0xBCB2A2C2, 0x25C09FBE),
+	uint4(0xE0E0F0F0, 0x2640C0E0, 0xC0800000, 0x2680E0C0), uint4(0x80C0E0F0, 0x27000000, 0xE0E0E1EE, 0x2780E0E0),
+	uint4(0xE3C30707, 0x27C0FEF9, 0x00007F3F, 0x29400000), uint4(0x3F7E7CF8, 0x29C09F1F, 0xF9F9F3E7, 0x2A00FCFC),
+	uint4(0x0800FBF9, 0x2A403818, 0x0278C000, 0x2A800000), uint4(0x0000031F, 0x2AC00000, 0xF1F70060, 0x2B00F8F8),
+	uint4(0x1C3870E0, 0x2B80070F, 0x2000FFEF, 0x2BC06160), uint4(0x01020204, 0x2C400001, 0x0000FEFF, 0x2C800000),
+	uint4(0x00000001, 0x2D40C000, 0x0E0C0C0C, 0x2DC00E0E), uint4(0x8F0F0F0F, 0x2E00CF8F, 0x00FFFFFF, 0x2F80FE00),
+	uint4(0x38383C3C, 0x2FC03030, 0xE0E0E0C0, 0x3040E0E0), uint4(0xFFFEFCF8, 0x30800FFF, 0xB9999999, 0x30C0B9B9),
+	uint4(0x3F3E3E3E, 0x31003F3F, 0xFEFFFFFF, 0x3180E0F8), uint4(0x8F9E1C1D, 0x31C0C7CF, 0x7FFFFFFF, 0x32003F3F),
+	uint4(0xDFDF0010, 0x32C09F9F, 0x01010307, 0x33000000), uint4(0x0000000F, 0x3380FF00, 0xFF7F3F1F, 0x33C00000),
+	uint4(0x01010307, 0x34008000, 0xF8F8F8F8, 0x3440F8F8), uint4(0xFEFFFFFF, 0x348078FC, 0xCE8C8C08, 0x34C0EFCE),
+	uint4(0xC0800106, 0x3540F0E0, 0x3FFFF8C0, 0x35801F9F), uint4(0x8C8C9C98, 0x35C0CCCC, 0x01010202, 0x36000001),
+	uint4(0x03070F1F, 0x36400103, 0xFFF88000, 0x36800000), uint4(0x000000C0, 0x3700FFF8, 0x8F9F1F3F, 0x3780E3C7),
+	uint4(0x07070F1F, 0x37C00103, 0xF8F0E0C3, 0x3840FEFC), uint4(0xFCF8E0C0, 0x3880FFFF, 0x03030606, 0x38C00101),
+	uint4(0xC0808103, 0x394060E0, 0x60800001, 0x39800C30), uint4(0x00FFFBF3, 0x39C00101, 0xFFFF0301, 0x3A00FFFF),
+	uint4(0xF0E0C1A1, 0x3AC0CCC8, 0x10103030, 0x3B000311), uint4(0x00000003, 0x3B400000, 0x1F0F0703, 0x3C007F3F),
+	uint4(0x0F1F1F1F, 0x3D408F0F, 0x000000FF, 0x3D800000), uint4(0xFEFCF0E1, 0x3DC00F7F, 0x8F8F0F0F, 0x3E00CFCF),
+	uint4(0x7F7F7F7F, 0x3E407E7E, 0x7F0F0306, 0x3E8000FF), uint4(0xFF1F0001, 0x3F00FFFF, 0xFFFFFCF0, 0x3F40FFFF),
+	uint4(0x00011EF0, 0x3F800000, 0x1D3C3C7C, 0x3FC00D1D), uint4(0x0004040C, 0x4040FDFD, 0x1BE70F1F, 0x40800000),
+	uint4(0xC080030F, 0x4100F0E0, 0x000080C0, 0x41400000), uint4(0x207C7F7E, 0x41803F30, 0xE08000FF, 0x4200FCF0),
+	uint4(0x06060606, 0x42800606, 0x20004040, 0x42C02020), uint4(0xF080010F, 0x4380FFFE, 0xC7C7C7C6, 0x43C0C3C3),
+	uint4(0x0000FFFF, 0x4400FFFF, 0xE0E0F0F8, 0x444080C0), uint4(0x00000060, 0x45406040, 0x1F1F1E30, 0x4580E81F),
+	uint4(0x0F1E1E1C, 0x45C0070F, 0xF8F8F8FC, 0x4640F8F8), uint4(0xFFFEFCF8, 0x46C0FFFF, 0x7FFFFFFE, 0x47000F1F),
+	uint4(0xE0E0F0F0, 0x4780C0C0, 0xC0808000, 0x47C060C0), uint4(0xE0E0E0C0, 0x4840F0F0, 0x3E7C7CF9, 0x48C09F1E),
+	uint4(0x307070F0, 0x49001030, 0x00C0F0FC, 0x4940FF00), uint4(0x00000001, 0x49800000, 0x071F2F7F, 0x49C00707),
+	uint4(0x7FFFFFFF, 0x4A000F1F, 0x000001FF, 0x4A800000), uint4(0xC6C68686, 0x4AC0C3C7, 0x80000000, 0x4B00C080),
+	uint4(0xC000010F, 0x4B807FF8, 0x0000C0FC, 0x4BC00000), uint4(0x473FBFBF, 0x4C00C040, 0xFFFEFEFD, 0x4C401F7F),
+	uint4(0x3C3020C0, 0x4C801F1F, 0xFFFEFEFC, 0x4CC00000), uint4(0x7FFFFF00, 0x4D400F1F, 0xFEFF0000, 0x4E80C0F0),
+	uint4(0xE0E0E0F0, 0x4F00C0C0, 0x80800001, 0x4F40E0C0), uint4(0xFFFF3F1F, 0x4F80FFFF, 0x23636362, 0x4FC03323),
+	uint4(0x0101030F, 0x50C00000, 0x01071F7F, 0x51000000), uint4(0x00000103, 0x5140C080, 0x001FFF80, 0x51800000),
+	uint4(0x7878787C, 0x51C03C7C, 0xF3F7E7EF, 0x5240F9F1), uint4(0x03070F1F, 0x5280C081, 0x0404040C, 0x53C00604),
+	uint4(0x0F1F1F1E, 0x5440C78F, 0x306061C1, 0x54C01830), uint4(0xC1818303, 0x5540E0C0, 0x00C0FFFF, 0x5580FFFF),
+	uint4(0x1F7FFFFF, 0x55C0E3CF, 0x40404040, 0x56000000), uint4(0x3C383870, 0x56C01E1C, 0xF3E3C787, 0x5700FDF9),
+	uint4(0x00000003, 0x57408000, 0xC0808000, 0x5780E0C0), uint4(0xFC7C0704, 0x57C0FEFE, 0x0701FFFE, 0x58003F1F),
+	uint4(0xF0E0E0C0, 0x5840F8F0, 0xE3870F1C, 0x58800EF9), uint4(0x6FCFCFCF, 0x58C02F6F, 0x1E1E1E1E, 0x59C01E1E),
+	uint4(0xFEF8F0C0, 0x5A40FFFF, 0x0606060E, 0x5A800707), uint4(0x0C0C0C0C, 0x5AC00C0C, 0x0000071F, 0x5B400000),
+	uint4(0xFFFEF8F0, 0x5B80FFFF, 0xFF000007, 0x5BC0FFFF), uint4(0x03010107, 0x5C008383, 0xFFF8C07F, 0x5C8000FF),
+	uint4(0x30303030, 0x5CC03030, 0x00000003, 0x5D40FF00), uint4(0x1FFFFFFF, 0x5D800000, 0x33737373, 0x5DC03333),
+	uint4(0xC0800103, 0x5E003060, 0xDFE01018, 0x5F000F9F), uint4(0x00000000, 0x5F40C080, 0xFCF0C307, 0x60803F7F),
+	uint4(0xFBFBFBF9, 0x60C00400, 0xFCF8F0E1, 0x61007EFC), uint4(0xC0000000, 0x6140FCF0, 0xC00007FF, 0x6180FFFF),
+	uint4(0x80808000, 0x61C0C0C0, 0x00FFFEF8, 0x62000000), uint4(0x1E1C3C3C, 0x62401E1E, 0x0F1F1F3F, 0x62808307),
+	uint4(0x9F0060F0, 0x62C0070F, 0x00818101, 0x63C04040), uint4(0x0000E0FF, 0x64800000, 0xFCF8F8F0, 0x64C0FEFC),
+	uint4(0xFC7C1C05, 0x6500FCFC, 0x80000103, 0x65404080), uint4(0x01010303, 0x65C08080, 0x00000020, 0x66400004),
+	uint4(0x8080C0E0, 0x66800000, 0xC0C1430F, 0x66C0C1C0), uint4(0x7C7C7C3C, 0x67007C7C, 0x0000FFFF, 0x6780FF00),
+	uint4(0x0103070F, 0x67C00000, 0xF8F0E080, 0x68800F7E), uint4(0x4FDF9FBE, 0x68C06367, 0xF8E0C187, 0x69803E7C),
+	uint4(0x80000003, 0x69C0FFF8, 0x7FFFFFFE, 0x6A001F3F), uint4(0xFCF8E3DF, 0x6A80FFFE, 0x38FEFFFF, 0x6B8081E7),
+	uint4(0x8F1F1F1F, 0x6C00EFCF, 0xFFFFFEFE, 0x6C40FFFF), uint4(0x0000001F, 0x6D000000, 0x0000020C, 0x6D400000),
+	uint4(0x1F3F7CC0, 0x6D80C70F, 0xCFDFBF7F, 0x6DC0F3E7), uint4(0x01020408, 0x6E000000, 0x0000010F, 0x6E400000),
+	uint4(0xFFFFFFFF, 0x6EC00F7F, 0x7F7FFFFF, 0x6F007F7F), uint4(0xE0E0271F, 0x6F40E0E0, 0x00003FFF, 0x6F800000),
+	uint4(0xE7C7C7C7, 0x6FC0E3E7, 0x0000F000, 0x70800000), uint4(0xC7C7C7C7, 0x70C0C7C7, 0x070F1F3F, 0x71000103),
+	uint4(0x877FFFFF, 0x7140F8E0, 0x00000000, 0x71800101), uint4(0xE3E3E7E7, 0x71C0E1E1, 0x3F3F3C38, 0x72803F3F),
+	uint4(0x00000106, 0x73400000, 0xFFFEFEFE, 0x7380FFFF), uint4(0x7C7CFDF9, 0x73C03E3C, 0x9FBFBF7F, 0x74408F9F),
+	uint4(0x0000FCFF, 0x75800000, 0xF8F0F0E3, 0x75C0FCF8), uint4(0x00000000, 0x7640F0C0, 0x00030F3F, 0x7680FF00),
+	uint4(0x00013FFF, 0x76C00000, 0x0F070703, 0x77001F0F), uint4(0xF8F8FB1C, 0x7780F0F0, 0xBF000000, 0x77C03FBF),
+	uint4(0x000000FF, 0x7800FF00, 0x00000778, 0x7880FF00), uint4(0x7CF8F0E0, 0x79003F3E, 0xFFFF007F, 0x7980FFFF),
+	uint4(0x1E7EFEFE, 0x79C0020E, 0xF0C0807F, 0x7A00FEF8), uint4(0x7FFFFFFF, 0x7A408F1F, 0xFCE00003, 0x7A80073F),
+	uint4(0x03030707, 0x7AC0C101, 0x00000107, 0x7BC00100), uint4(0x01030F1F, 0x7C000000, 0x07070F9F, 0x7C80FF02),
+	uint4(0x07070303, 0x7CC00707, 0x00E0F8FE, 0x7D000F1F), uint4(0x7E7E7E7E, 0x7D407E7E, 0xFFFFFF7F, 0x7D80FFFF),
+	uint4(0x00000003, 0x7E00FFFF, 0x1F1F0F0F, 0x7E40BF9F), uint4(0xE0FEFFFF, 0x7E801F7F, 0xE0800001, 0x7F00FEF8),
+	uint4(0xF8F8F900, 0x7F8078F8, 0x808081C3, 0x7FC00000), uint4(0x00010307, 0x8040FCC0, 0xE0C08087, 0x8140F0E0),
+	uint4(0x001FFFFF, 0x8180FEE0, 0xF0F0E0E1, 0x81C07CF8), uint4(0x00011FFF, 0x82400000, 0x1010FFEF, 0x82C03030),
+	uint4(0x78F0E0C1, 0x83001E3C, 0x80000003, 0x8380CF87), uint4(0xFDFDFCFC, 0x83C00000, 0xFEFEFEFE, 0x8440FFFE),
+	uint4(0xFCC000FF, 0x848000FF, 0x10200040, 0x84C00810), uint4(0x787C7C7E, 0x85407070, 0xF0F8F8F8, 0x8580F0F0),
+	uint4(0x80808080, 0x85C0C0C0, 0x031FFFFF, 0x8680FE80), uint4(0xFF000001, 0x86C0DFFF, 0x0F1F3F7F, 0x87C00307),
+	uint4(0x8000030E, 0x8840E0C0, 0xF0FCF000, 0x888000C0), uint4(0x0C181811, 0x88C0868C, 0x0000C0FC, 0x8940F000),
+	uint4(0x80808187, 0x8980BF00, 0x00000004, 0x89C00202), uint4(0x0000C0E0, 0x8A40FF00, 0x27E0E0E0, 0x8A80E1E7),
+	uint4(0xFFFEFCF9, 0x8B80001F, 0xE0C0C0C0, 0x8BC0E0E0), uint4(0x00000004, 0x8C800000, 0x40606060, 0x8DC04040),
+	uint4(0xFFFFF000, 0x8E400000, 0xE0F0FCFE, 0x8F0000C0), uint4(0x1F3F3F3F, 0x8FC00F1F, 0x0000FFFF, 0x90800301),
+	uint4(0xBCBCBCBC, 0x90C0BCBC, 0x1C1C3C3C, 0x91401818), uint4(0x8F8F8F9F, 0x91C0CF8F, 0x0707070F, 0x92400303),
+	uint4(0xBF3F3E7C, 0x9280103F, 0x8480817B, 0x92C08C8C), uint4(0x1C180B07, 0x93C01E1C, 0xC0F0F8FC, 0x94400080),
+	uint4(0xFCE08000, 0x9480FFFF, 0xF9FBF3F3, 0x94C0FDFD), uint4(0xFFFCF0C0, 0x9500FFFF, 0xF3C3870F, 0x9580FCF9),
+	uint4(0xFEFEFEE0, 0x9600FCFC, 0x00E0FCFF, 0x96400000), uint4(0xFFFFFCC3, 0x96800FFF, 0x7E000000, 0x97800000),
+	uint4(0xE6E4E8E0, 0x97C0E3E2, 0x007F0300, 0x98000000), uint4(0x031FFF00, 0x98800000, 0x30383C3C, 0x98C00010),
+	uint4(0x00000007, 0x99000000, 0xFFFFFFF1, 0x9980000F), uint4(0x00204081, 0x99C00810, 0x0000017F, 0x9A00FF00),
+	uint4(0x7E7E3E3E, 0x9A807E7E, 0xEECECC9C, 0x9AC01F2F), uint4(0xFFFFFEFC, 0x9B400000, 0xC000C1E2, 0x9B801F38),
+	uint4(0x02FF7F7E, 0x9BC00602, 0xC0E0F0F0, 0x9C400080), uint4(0xC6C6C6CE, 0x9CC0C6C6, 0x10303161, 0x9DC00818),
+	uint4(0x3010F7F3, 0x9E40F0F0, 0xFFFFFFFF, 0x9E80637F), uint4(0x0307078F, 0x9F000103, 0x00FFFFFC, 0x9F800300),
+	uint4(0x43838387, 0x9FC04343, 0xB1A383C3, 0xA0C019B9), uint4(0x037FFCF0, 0xA1400000, 0x0000077F, 0xA1800000),
+	uint4(0xEFEFFFFF, 0xA1C0EEEE, 0xF8F0E0D0, 0xA200FEF4), uint4(0x1F3F7EFE, 0xA240070F, 0x70707070, 0xA2807070),
+	uint4(0x00000307, 0xA2C00000, 0x060C1838, 0xA3000102), uint4(0xF3F3F3F7, 0xA3C0F1F1, 0xFEFFF8C0, 0xA480F0FC),
+	uint4(0x20202020, 0xA4C02020, 0x0378F8F8, 0xA540F838), uint4(0x00033FFF, 0xA580FFFF, 0xF8F0E1E3, 0xA5C07CFC),
+	uint4(0xE7CF9F3F, 0xA600FBF7, 0x02020202, 0xA6400303), uint4(0xF0F0E0E0, 0xA6807878, 0x0000007F, 0xA7000000),
+	uint4(0xFFFFFFFF, 0xA780FF00, 0x11071F7F, 0xA8000C08), uint4(0xC7CF9F3F, 0xA840F1E3, 0x00BF3F7F, 0xA8800C18),
+	uint4(0x81810103, 0xA8C080C0, 0xE0E0E1E3, 0xAA40F0E0), uint4(0x787971F1, 0xAAC0BCF8, 0xFCFEFFFF, 0xAB00F8FC),
+	uint4(0x40800001, 0xAB401020, 0xFEF0831F, 0xAB80FFFF), uint4(0x0001073F, 0xABC00000, 0x3FFFFFFF, 0xAC00E7CF),
+	uint4(0xFCF83CFC, 0xAC80FCFC, 0x08080808, 0xACC00808), uint4(0x7F3F3F1F, 0xAD00FF7F, 0xFFFEFEFC, 0xAD40FFFF),
+	uint4(0x000000FF, 0xAD8000FF, 0x61614343, 0xADC02121), uint4(0xF7E7E7E3, 0xAE00F7F7, 0xFEFFFFFF, 0xAE4080F0),
+	uint4(0x80800001, 0xAF00C180, 0x000080E0, 0xAF400000), uint4(0x00F00000, 0xAF800000, 0x7EFCF0E0, 0xAFC0030F),
+	uint4(0x061C3870, 0xB0400103, 0x7C7C7CFC, 0xB0C03C7C), uint4(0xFFFFFCF8, 0xB1C07F7F, 0xE76F3F3F, 0xB240E3E7),
+	uint4(0xFF000000, 0xB28000FF, 0x1C181818, 0xB3000C0C), uint4(0x78787879, 0xB3C03838, 0xF0E0C79F, 0xB400FCF8),
+	uint4(0x7F3F1F1F, 0xB480FF7F, 0x10FFF7E3, 0xB5003010), uint4(0xC0C0C1C3, 0xB54040C0, 0x0F3F7FFF, 0xB5808103),
+	uint4(0x306041C1, 0xB5C01838, 0xFFFFFFF8, 0xB680007F), uint4(0xEEEEEEEE, 0xB6C0FEFE, 0xFCF08001, 0xB700FFFF),
+	uint4(0x010000FF, 0xB8000F03, 0xE7676767, 0xB8C0E7E7), uint4(0xFCF0C000, 0xB900FFFF, 0x2FE7C7C3, 0xB9801107),
+	uint4(0xFFFFFFC0, 0xBB00FFFF, 0x307060E0, 0xBBC01830), uint4(0x070F1F3E, 0xBC400103, 0xFFFF00E0, 0xBC80E0F8),
+	uint4(0xFFFFFF87, 0xBD00FFFF, 0x001FFFFF, 0xBD800000), uint4(0x38383838, 0xBE001C18, 0x83C7EF10, 0xBE800001),
+	uint4(0x60616161, 0xBEC06060, 0x02FFFCFC, 0xBF001F06), uint4(0x3F1F0EEF, 0xBF80403F, 0x00008080, 0xC0000000),
+	uint4(0xFEE00000, 0xC040FFFF, 0xF060477F, 0xC080F8F8), uint4(0xE0F0F8FC, 0xC14000C0, 0x3FFF7F7F, 0xC1806147),
+	uint4(0x40404040, 0xC1C04040, 0x1F3FFFFF, 0xC2008307), uint4(0x0F7FFFF9, 0xC280FEE3, 0xF8F8F0E1, 0xC300FEFC),
+	uint4(0xFFFF0000, 0xC480037F, 0x04FBF9F8, 0xC5403C1C), uint4(0x7FFFBFBE, 0xC5C02007, 0x80808080, 0xC600C080),
+	uint4(0x80808180, 0xC6808080, 0x00000007, 0xC700FFC0), uint4(0xFFFFFF00, 0xC7400000, 0x00033FFF, 0xC780F0C0),
+	uint4(0x0707070F, 0xC7C00707, 0xFEFEFEFE, 0xC8400E7E), uint4(0x1C04FFFC, 0xC880FE7E, 0xDF3FFFFF, 0xC900FBE7),
+	uint4(0xE0800000, 0xC940FEF8, 0x077FFDFD, 0xC9C00404), uint4(0xFEFCFCFC, 0xCA000F7E, 0xE0800000, 0xCA801E78),
+	uint4(0x61C38386, 0xCAC03060, 0x00FFFDFD, 0xCB000101), uint4(0xC0800103, 0xCB40E0E0, 0x0E0E0E0E, 0xCC400E0E),
+	uint4(0x00030F3F, 0xCC808000, 0x82848484, 0xCCC04242), uint4(0xF0E0C1C3, 0xCD4078F8, 0xFFFFFEF8, 0xCD80FFFF),
+	uint4(0x80800000, 0xCE40C0C0, 0xC0F30E3F, 0xCE800000), uint4(0xFFFFFFFF, 0xCF0078FE, 0xF8F8F8F8, 0xCF8078F8),
+	uint4(0x70F0F0E1, 0xCFC09830, 0xFEFCF8F0, 0xD0407FFF), uint4(0x00100020, 0xD0800000, 0xFCF8F8F0, 0xD0C0F6FE),
+	uint4(0xE0611FC7, 0xD100F0E0, 0xFFF8E10F, 0xD1C0FFFF), uint4(0x7E7EFEFE, 0xD2407E7E, 0x1FFF3F0F, 0xD2808000),
+	uint4(0x83838787, 0xD3408181, 0x0604FFF9, 0xD3C00F0E), uint4(0x01010303, 0xD440E000, 0xBEBEBEBE, 0xD4C0BEBE),
+	uint4(0x040E1E3E, 0xD500FD00, 0x3FFFFFFF, 0xD5800307), uint4(0xFF7F7F7F, 0xD600FFFF, 0x3FFFFFFF, 0xD6800107),
+	uint4(0x0701FFFE, 0xD7407F1F, 0xFF000000, 0xD7800000), uint4(0x3F0F03FE, 0xD900FFFF, 0xF8F0F0E0, 0xD940FEFC),
+	uint4(0x8000077F, 0xD980FFF8, 0x8E8E8E8E, 0xD9C08E8E), uint4(0x20004000, 0xDA000020, 0x1F3F3F7F, 0xDA408F1F),
+	uint4(0xC0000103, 0xDA80FCF0, 0xFEFFFFFC, 0xDB000080), uint4(0x1F3FFEF8, 0xDB400307, 0x00010307, 0xDB807F00),
+	uint4(0xC0C0C0E0, 0xDBC08080, 0x7E786000, 0xDC407F7F), uint4(0x103C7EFF, 0xDD8087EF, 0x77737373, 0xDDC07777),
+	uint4(0xFCFCFCFC, 0xDE007CFC, 0x0000000F, 0xDE80FFFF), uint4(0xF7F7F3F3, 0xDEC077F7, 0x3010FFEF, 0xDF407030),
+	uint4(0xE7E7E7E7, 0xDFC0F7F7, 0xEFDFDFDF, 0xE040F7EF), uint4(0x003EF8E0, 0xE080F0C0, 0xE3E7E7EF, 0xE0C0E1E3),
+	uint4(0xC0033FFF, 0xE180FCF0, 0xFEFEFCFD, 0xE1C07FFF), uint4(0xC0000007, 0xE280F8F0, 0xC040DFC7, 0xE340C0C0),
+	uint4(0x0001030F, 0xE3800000, 0xCECECEEF, 0xE3C0CCCE), uint4(0x00000000, 0xE400FC00, 0xFCF8E0CF, 0xE480FFFE),
+	uint4(0xC7878F8F, 0xE4C0C3C3, 0x20606060, 0xE5802020), uint4(0xF3F7FEF8, 0xE5C0E3F3, 0xFFFFFEF8, 0xE6403F7F),
+	uint4(0x43434347, 0xE6C00343, 0xC0800000, 0xE7001870), uint4(0xC3838383, 0xE7C0C3C3, 0x00010303, 0xE8400000),
+	uint4(0xC0C0C0DF, 0xE88040C3, 0xFFFFFFFF, 0xE9407EFF), uint4(0x1DFCFCFC, 0xE9801C04, 0x80000000, 0xE9C0E0C0),
+	uint4(0x80000003, 0xEA00F8E0, 0x7FFFFEFD, 0xEA409FBF), uint4(0x3FFFF881, 0xEA80C007, 0xC0C0C0C0, 0xEB00E0C0),
+	uint4(0xFFF88100, 0xEB80FFFF, 0x08181021, 0xEBC0840C), uint4(0xE1E1E2E2, 0xEC40E0E0, 0x98181810, 0xECC0DC9C),
+	uint4(0x1E3F7FFF, 0xED00F7C8, 0x0000031F, 0xED80E000), uint4(0x3F3D7D7B, 0xEDC01F3E, 0xFFFEFCFC, 0xEE80037F),
+	uint4(0xE1E3C3C7, 0xEEC0F0E0, 0x0F1C3870, 0xEF808307), uint4(0xDFDF9F9F, 0xEFC0DCDE, 0x031FFFFF, 0xF0800000),
+	uint4(0xFDFDFDF9, 0xF0C00200, 0xFCF8F0E0, 0xF10000FF), uint4(0x10E0C081, 0xF180FCFB, 0xBCF08242, 0xF1C03FBF),
+	uint4(0xF0E0C183, 0xF200FCF8, 0x0001070F, 0xF2808080), uint4(0xF9F9B9B9, 0xF2C0F9F9, 0x7CF8F0C0, 0xF4001F3F),
+	uint4(0x6060E0E0, 0xF4406060, 0x61616161, 0xF4C06161), uint4(0x00000000, 0xF500F800, 0xFFE13FFF, 0xF5C0FFFF),
+	uint4(0xFEFFFFFF, 0xF680F8FC, 0xFD3D8D83, 0xF6C0BCFC), uint4(0x0E1C3C78, 0xF700070F, 0x7C7C7C7C, 0xF7407C7C),
+	uint4(0xE0FEFFFF, 0xF8400000, 0xF8FEFF00, 0xF88080E0), uint4(0x02020206, 0xF8C00000, 0x7E78F0C0, 0xF9407F7F),
+	uint4(0xFEF8E001, 0xF980000F, 0xC1C1C0C0, 0xF9C0C3C3), uint4(0x00000001, 0xFA40FFFF, 0xFFF00000, 0xFB80FFFF),
+	uint4(0x83070F0F, 0xFBC08187, 0x00000800, 0xFC000000), uint4(0xFFFE8001, 0xFC40FFFF, 0xFFFEF081, 0xFD403F7F),
+	uint4(0x00000003, 0xFD800FFF, 0x3E5E7CBC, 0xFDC01F2F), uint4(0xF0800000, 0xFE00FFFF, 0x30787878, 0xFE803030),
+	uint4(0x0E0C0810, 0xFEC0070E, 0x80808080, 0xFF400080), uint4(0x031EF8F0, 0xFF800000, 0x0C0C0C0E, 0xFFC08808),
+};
+
+#define PARTITION_2_COUNT_8X8 701
+#define PARTITION_2_WORDS_8X8 3
+static const uint4 partition_2_8x8[526] =
+{
+	uint4(0x0F1F1F1E, 0x0707070F, 0x00400000, 0x07070F0F), uint4(0x01010303, 0x00800000, 0x7C787973, 0x3F3E7E3C),
+	uint4(0x00C00000, 0xE0800000, 0x1E3C78F0, 0x01000000), uint4(0x07070F1F, 0x00010303, 0x01400000, 0xE1606127),
+	uint4(0xE7E3E3E1, 0x01C00000, 0x1F1F3F3F, 0x07070F0F), uint4(0x02000000, 0xFCFCF8F0, 0xFFFFFFFE, 0x02400000),
+	uint4(0xFCFCFCFE, 0xF0F8F8F8, 0x02800000, 0x040C1830), uint4(0xC0808002, 0x02C00000, 0xFFFFFFFF, 0x3F3F7FFF),
+	uint4(0x03400000, 0xC387070F, 0xF8F0E0C1, 0x03800000), uint4(0xFEE00000, 0x00001FFF, 0x03C00000, 0x01010101),
+	uint4(0x01010101, 0x04000000, 0x077FFFFF, 0x00000000), uint4(0x04400000, 0x00000007, 0x000000FF, 0x04800000),
+	uint4(0xFCFCFCFC, 0xFCFCFCFC, 0x04C00000, 0xC0C0C0C0), uint4(0xC0C0C0C0, 0x05000000, 0xC0C08081, 0xF0E0E0E0),
+	uint4(0x05400000, 0xF8F0C181, 0x031FFEFC, 0x05C00000), uint4(0x1F0F0F0F, 0x3F3F1F1F, 0x06000000, 0xE0E0E0E7),
+	uint4(0xE0E0E0E0, 0x06400000, 0x000000FF, 0x0000FF1F), uint4(0x06800000, 0x31333373, 0x18191931, 0x06C00000),
+	uint4(0xF0F0F0F0, 0xF0F0F0F0, 0x07000000, 0xF0F0E0E0), uint4(0xFCFCF8F8, 0x07400000, 0x3F7F7F7F, 0x3F3F3F3F),
+	uint4(0x07800000, 0xC2C2C2C2, 0xC2C2C2C2, 0x07C00000), uint4(0x80808080, 0x80808080, 0x08000000, 0xFC000007),
+	uint4(0xFFFFFFFF, 0x08400000, 0x00FFFF00, 0x00000000), uint4(0x09000000, 0x1E1F1F1F, 0x0C0E0E1E, 0x09400000),
+	uint4(0xFFDFDFDF, 0x000000FF, 0x09C00000, 0xFFFF0007), uint4(0x000000FF, 0x0A800000, 0xF0F8FCFE, 0x0080C0E0),
+	uint4(0x0AC00000, 0xC0C0C0C0, 0x40CFC1C0, 0x0B000000), uint4(0x070F1E3E, 0x00000103, 0x0B400000, 0xFF00FFFF),
+	uint4(0xFFFFFFFF, 0x0B800000, 0x7D7C7C7C, 0x00FF7F7F), uint4(0x0BC00000, 0x10101010, 0x10101010, 0x0C000000),
+	uint4(0xC1810307, 0xFEFCF8E0, 0x0C400000, 0xF8E0C080), uint4(0xFFFFFFFC, 0x0C800000, 0x20206060, 0xE0A0A020),
+	uint4(0x0CC00000, 0xFEFEFE00, 0x3E7EFEFE, 0x0D400000), uint4(0x3FFFFEF9, 0xFFFCF3CF, 0x0D800000, 0x40008001),
+	uint4(0x10002000, 0x0DC00000, 0x0000030F, 0xF0E0C080), uint4(0x0E000000, 0x7C7830DF, 0xC18000FE, 0x0E800000),
+	uint4(0x80010000, 0x102040C0, 0x0EC00000, 0x00000000), uint4(0xFFFFFF00, 0x0F000000, 0x0307070F, 0x00000101),
+	uint4(0x0F400000, 0x3FBFBF00, 0x1E1F3F3F, 0x0F800000), uint4(0x3EFCF0C0, 0x00000001, 0x0FC00000, 0x00000104),
+	uint4(0x80000000, 0x10400000, 0x1F1F0F0F, 0x9F1F1F1F), uint4(0x10800000, 0x78787878, 0x78787878, 0x10C00000),
+	uint4(0x0F0F0F1F, 0x07070707, 0x11000000, 0x1F3FFFFF), uint4(0x01000307, 0x11400000, 0x00030E38, 0x00000000),
+	uint4(0x11800000, 0x9EBE3E7E, 0xEEEECEDE, 0x11C00000), uint4(0x1F3F7FFF, 0x0103070F, 0x12000000, 0xF8FEFFFC),
+	uint4(0x00C0E0F0, 0x12400000, 0x02040800, 0x00000001), uint4(0x12800000, 0x3870C080, 0x0103060C, 0x12C00000),
+	uint4(0x1EFCFCF8, 0xC0800000, 0x13000000, 0xE0F0F0F8), uint4(0x80C0C0E0, 0x13400000, 0xFFFF0000, 0x00FFFFFF),
+	uint4(0x13800000, 0xF0F8E8E8, 0xF4F4F0F0, 0x13C00000), uint4(0xDEDEDEDE, 0x9C9C9E9E, 0x14C00000, 0x3F3F3E7E),
+	uint4(0x0F1F1F1F, 0x15800000, 0x808484C4, 0xF7F70000), uint4(0x15C00000, 0x03030787, 0xFF000101, 0x16000000),
+	uint4(0x0000017F, 0x83830100, 0x16400000, 0x3F7FFF80), uint4(0x070F1F3F, 0x16800000, 0x1F3F3F7F, 0x070F0F1F),
+	uint4(0x16C00000, 0xE0FEFF00, 0xFFFF0000, 0x17800000), uint4(0x0C04FBF9, 0x7F3E1E1E, 0x17C00000, 0xFFFFFFFF),
+	uint4(0x7F7F7FFF, 0x18400000, 0x0F3F7EFC, 0x00000103), uint4(0x18800000, 0x1C1C1C1C, 0x1818181C, 0x18C00000),
+	uint4(0xFCF87007, 0xFFFFFFFE, 0x19000000, 0x1F1FCFC7), uint4(0xC0C0C347, 0x19400000, 0x00000000, 0x00FF0000),
+	uint4(0x19800000, 0x18181818, 0x18181818, 0x19C00000), uint4(0x03070F1F, 0x80000001, 0x1AC00000, 0x8F1F3F7F),
+	uint4(0xF8F1E3C7, 0x1B000000, 0xC1C1C387, 0xE0C0C0C0), uint4(0x1B400000, 0xF0F0F013, 0xF0F00FF0, 0x1B800000),
+	uint4(0x1F3F3F7F, 0x040E0F1F, 0x1BC00000, 0x00000103), uint4(0x00000000, 0x1C000000, 0x00000000, 0x07030100),
+	uint4(0x1C400000, 0x3FFFFFFF, 0x01030F1F, 0x1C800000), uint4(0xF2FCF8FC, 0xC3E3E3F2, 0x1CC00000, 0x07030100),
+	uint4(0x7F3F1F0F, 0x1D000000, 0x00000000, 0xFFFF0000), uint4(0x1D800000, 0x80800103, 0x307060C0, 0x1DC00000),
+	uint4(0x0000FFFF, 0x00000000, 0x1E000000, 0x273F3F3F), uint4(0x3F3F3E38, 0x1E400000, 0x87C7EF10, 0xFF010303),
+	uint4(0x1E800000, 0x9F9F9F9F, 0x9F9F9F9F, 0x1EC00000), uint4(0x0000FFFF, 0xFFFE0000, 0x1F000000, 0x0000071F),
+	uint4(0xFCF08000, 0x1F400000, 0xCF8F1F1F, 0x00FFEFCF), uint4(0x20000000, 0x0F1F1F1F, 0xE6C70F0F, 0x20400000),
+	uint4(0x10C00003, 0x60000104, 0x20800000, 0xE0E0E1E3), uint4(0xE1E0E0E0, 0x20C00000, 0x00FFFFFF, 0x1F000000),
+	uint4(0x21000000, 0x0F1C103F, 0x020FE78F, 0x21800000), uint4(0x180800FF, 0x7B393818, 0x21C00000, 0x00000000),
+	uint4(0x00FFFFFF, 0x22000000, 0xE0C0C080, 0xFCF8F0F0), uint4(0x22400000, 0x00010579, 0xFCF0C080, 0x22800000),
+	uint4(0xF0C80C0E, 0x0787CFEE, 0x22C00000, 0x80010307), uint4(0x3C78E0C0, 0x23800000, 0x1F1F1F1F, 0x1E1E1F1F),
+	uint4(0x23C00000, 0x1C30E080, 0x00000306, 0x24000000), uint4(0xFFFCE000, 0xC0000000, 0x24800000, 0xDF9F3F7F),
+	uint4(0x031FFFEF, 0x24C00000, 0x070F1F3F, 0x00010307), uint4(0x25000000, 0x80000000, 0xFEF8F0C0, 0x25400000),
+	uint4(0xFFFFFF00, 0xFFE01FFF, 0x25800000, 0xBCB2A2C2), uint4(0x9E9F9FBE, 0x25C00000, 0xFFFFFFFF, 0x00FFFFFF),
+	uint4(0x26000000, 0xE0E0F0F0, 0xC0C0C0E0, 0x26400000), uint4(0xC0800000, 0xF0F0E0C0, 0x26800000, 0xE0E0E0E0),
+	uint4(0xE0E0E0E0, 0x26C00000, 0x80C0E0F0, 0x00000000), uint4(0x27000000, 0xE0E0E1EE, 0xEC20E0E0, 0x27800000),
+	uint4(0xE3C30707, 0xE0F8FEF9, 0x27C00000, 0x077FFFFF), uint4(0xFFFF0000, 0x28400000, 0x00007F3F, 0x03010000),
+	uint4(0x29400000, 0x3F7E7CF8, 0xE7CF9F1F, 0x29C00000), uint4(0xF9F9F3E7, 0xFFFEFCFC, 0x2A000000, 0x0800FBF9),
+	uint4(0xF8783818, 0x2A400000, 0x0278C000, 0x80000000), uint4(0x2A800000, 0x0000031F, 0xC0800000, 0x2AC00000),
+	uint4(0xF1F70060, 0xFCFCF8F8, 0x2B000000, 0x1C3870E0), uint4(0xC081070F, 0x2B800000, 0x2000FFEF, 0xE3E16160),
+	uint4(0x2BC00000, 0x01020204, 0x00000001, 0x2C400000), uint4(0x0000FEFF, 0xFF000000, 0x2C800000, 0x00000001),
+	uint4(0xFEF0C000, 0x2D400000, 0x00FFFFFF, 0x00000000), uint4(0x2D800000, 0x0E0C0C0C, 0x06060E0E, 0x2DC00000),
+	uint4(0x8F0F0F0F, 0x2F4FCF8F, 0x2E000000, 0xFFFFFFFF), uint4(0x3F7FFFFF, 0x2F000000, 0x00FFFFFF, 0xFFFFFE00),
+	uint4(0x2F800000, 0x38383C3C, 0x20203030, 0x2FC00000), uint4(0xE0E0E0C0, 0xF0E0E0E0, 0x30400000, 0xFFFEFCF8),
+	uint4(0xFFC00FFF, 0x30800000, 0xB9999999, 0xBBB9B9B9), uint4(0x30C00000, 0x3F3E3E3E, 0x3F3F3F3F, 0x31000000),
+	uint4(0xFEFFFFFF, 0x0080E0F8, 0x31800000, 0x8F9E1C1D), uint4(0x7367C7CF, 0x31C00000, 0x7FFFFFFF, 0x0F1F3F3F),
+	uint4(0x32000000, 0x00000000, 0xFEFFFFFF, 0x32400000), uint4(0xDFDF0010, 0x0F0F9F9F, 0x32C00000, 0x01010307),
+	uint4(0x00000000, 0x33000000, 0x0000000F, 0x031FFF00), uint4(0x33800000, 0xFF7F3F1F, 0x00000000, 0x33C00000),
+	uint4(0x01010307, 0xF8E08000, 0x34000000, 0xF8F8F8F8), uint4(0xF8F8F8F8, 0x34400000, 0xFEFFFFFF, 0x207078FC),
+	uint4(0x34800000, 0xCE8C8C08, 0x072FEFCE, 0x34C00000), uint4(0xC0800106, 0xFCF8F0E0, 0x35400000, 0x3FFFF8C0),
+	uint4(0x01001F9F, 0x35800000, 0x8C8C9C98, 0xCECECCCC), uint4(0x35C00000, 0x01010202, 0x00000001, 0x36000000),
+	uint4(0x03070F1F, 0x00000103, 0x36400000, 0xFFF88000), uint4(0xFCE00000, 0x36800000, 0x000000C0, 0xFFFFFFF8),
+	uint4(0x37000000, 0x8F9F1F3F, 0xF1E1E3C7, 0x37800000), uint4(0x07070F1F, 0x00000103, 0x37C00000, 0x1F3FFFFF),
+	uint4(0x00000307, 0x38000000, 0xF8F0E0C3, 0xFFFFFEFC), uint4(0x38400000, 0xFCF8E0C0, 0x7FFFFFFF, 0x38800000),
+	uint4(0x03030606, 0x00000101, 0x38C00000, 0xC0808103), uint4(0x387060E0, 0x39400000, 0x60800001, 0x01060C30),
+	uint4(0x39800000, 0x00FFFBF3, 0x01010101, 0x39C00000), uint4(0xFFFF0301, 0xFFFFFFFF, 0x3A000000, 0xF0E0C1A1),
+	uint4(0x87CECCC8, 0x3AC00000, 0x10103030, 0x07070311), uint4(0x3B000000, 0x00000003, 0x00000000, 0x3B400000),
+	uint4(0x1F1F1F1F, 0x0F0F1F1F, 0x3BC00000, 0x1F0F0703), uint4(0xFFFF7F3F, 0x3C000000, 0xFFFFFFFF, 0x0700FFFF),
+	uint4(0x3C800000, 0x0F1F1F1F, 0xF8E48F0F, 0x3D400000), uint4(0x000000FF, 0xFFFF0000, 0x3D800000, 0xFEFCF0E1),
+	uint4(0x00010F7F, 0x3DC00000, 0x8F8F0F0F, 0xEFEFCFCF), uint4(0x3E000000, 0x7F7F7F7F, 0x7C7C7E7E, 0x3E400000),
+	uint4(0x7F0F0306, 0x1F0300FF, 0x3E800000, 0xFF1F0001), uint4(0xFFFFFFFF, 0x3F000000, 0xFFFFFCF0, 0xFCFEFFFF),
+	uint4(0x3F400000, 0x00011EF0, 0x00000000, 0x3F800000), uint4(0x1D3C3C7C, 0x070D0D1D, 0x3FC00000, 0x0004040C),
+	uint4(0xFCFCFDFD, 0x40400000, 0x1BE70F1F, 0x00000000), uint4(0x40800000, 0xC080030F, 0xFCF8F0E0, 0x41000000),
+	uint4(0x000080C0, 0x00000000, 0x41400000, 0x207C7F7E), uint4(0x3C3F3F30, 0x41800000, 0xE08000FF, 0xFFFFFCF0),
+	uint4(0x42000000, 0x0000FFFF, 0x81800000, 0x42400000), uint4(0x06060606, 0x06060606, 0x42800000, 0x20004040),
+	uint4(0x00202020, 0x42C00000, 0xF080010F, 0x077FFFFE), uint4(0x43800000, 0xC7C7C7C6, 0xC3C3C3C3, 0x43C00000),
+	uint4(0x0000FFFF, 0xFFFFFFFF, 0x44000000, 0xE0E0F0F8), uint4(0x008080C0, 0x44400000, 0xFFFFFF00, 0x3FFFFFFF),
+	uint4(0x45000000, 0x00000060, 0x70606040, 0x45400000), uint4(0x1F1F1E30, 0x0F8CE81F, 0x45800000, 0x0F1E1E1C),
+	uint4(0x8307070F, 0x45C00000, 0x00000000, 0xFFF00000), uint4(0x46000000, 0xF8F8F8FC, 0xF8F8F8F8, 0x46400000),
+	uint4(0xE0E0E0E0, 0x6060E0E0, 0x46800000, 0xFFFEFCF8), uint4(0xFFFFFFFF, 0x46C00000, 0x7FFFFFFE, 0x01030F1F),
+	uint4(0x47000000, 0xE0E0F0F0, 0x8080C0C0, 0x47800000), uint4(0xC0808000, 0x306060C0, 0x47C00000, 0xE0E0E0C0),
+	uint4(0xF8F0F0F0, 0x48400000, 0x3E7C7CF9, 0xC78F9F1E), uint4(0x48C00000, 0x307070F0, 0xFF101030, 0x49000000),
+	uint4(0x00C0F0FC, 0x031FFF00, 0x49400000, 0x00000001), uint4(0x00000000, 0x49800000, 0x071F2F7F, 0x82810707),
+	uint4(0x49C00000, 0x7FFFFFFF, 0xC1030F1F, 0x4A000000), uint4(0x000001FF, 0x9F000000, 0x4A800000, 0xC6C68686),
+	uint4(0xE3E3C3C7, 0x4AC00000, 0x80000000, 0xE0E0C080), uint4(0x4B000000, 0xC000010F, 0x000F7FF8, 0x4B800000),
+	uint4(0x0000C0FC, 0x00000000, 0x4BC00000, 0x473FBFBF), uint4(0xE0E0C040, 0x4C000000, 0xFFFEFEFD, 0x070F1F7F),
+	uint4(0x4C400000, 0x3C3020C0, 0x0F1F1F1F, 0x4C800000), uint4(0xFFFEFEFC, 0x00000000, 0x4CC00000, 0x7FFFFF00),
+	uint4(0x81030F1F, 0x4D400000, 0xFEFF0000, 0x0000C0F0), uint4(0x4E800000, 0xE0E0E0F0, 0x80C0C0C0, 0x4F000000),
+	uint4(0x80800001, 0xF8F0E0C0, 0x4F400000, 0xFFFF3F1F), uint4(0xFFFFFFFF, 0x4F800000, 0x23636362, 0x31313323),
+	uint4(0x4FC00000, 0x0101030F, 0x80800000, 0x50C00000), uint4(0x01071F7F, 0x00000000, 0x51000000, 0x00000103),
+	uint4(0x6060C080, 0x51400000, 0x001FFF80, 0xFE000000), uint4(0x51800000, 0x7878787C, 0x3E3C3C7C, 0x51C00000),
+	uint4(0xF3F7E7EF, 0xFCF8F9F1, 0x52400000, 0x03070F1F), uint4(0xE0E0C081, 0x52800000, 0xE0E0E0C0, 0xF0F0F0F0),
+	uint4(0x52C00000, 0x0F1F1F1F, 0x87870F0F, 0x53000000), uint4(0x000000FF, 0x00000000, 0x53400000, 0x0404040C),
+	uint4(0x82020604, 0x53C00000, 0x0F1F1F1E, 0xF7E7C78F), uint4(0x54400000, 0x07070F1F, 0x01010303, 0x54800000),
+	uint4(0x306061C1, 0x08181830, 0x54C00000, 0xC1818303), uint4(0x70E0E0C0, 0x55400000, 0x00C0FFFF, 0x7FFFFFFF),
+	uint4(0x55800000, 0x1F7FFFFF, 0x1E79E3CF, 0x55C00000), uint4(0x40404040, 0x00000000, 0x56000000, 0x3C383870),
+	uint4(0x8F8E1E1C, 0x56C00000, 0xF3E3C787, 0xFFFEFDF9), uint4(0x57000000, 0x00000003, 0x78E08000, 0x57400000),
+	uint4(0xC0808000, 0xF0E0E0C0, 0x57800000, 0xFC7C0704), uint4(0xFEFEFEFE, 0x57C00000, 0x0701FFFE, 0xFFFF3F1F),
+	uint4(0x58000000, 0xF0E0E0C0, 0xFCF8F8F0, 0x58400000), uint4(0xE3870F1C, 0xC0000EF9, 0x58800000, 0x6FCFCFCF),
+	uint4(0x1F0F2F6F, 0x58C00000, 0x1E1E1E1E, 0x1E1E1E1E), uint4(0x59C00000, 0xFEF8F0C0, 0xFFFFFFFF, 0x5A400000),
+	uint4(0x0606060E, 0x03030707, 0x5A800000, 0x0C0C0C0C), uint4(0x040C0C0C, 0x5AC00000, 0x0000071F, 0x00000000),
+	uint4(0x5B400000, 0xFFFEF8F0, 0xFFFFFFFF, 0x5B800000), uint4(0xFF000007, 0xFFFFFFFF, 0x5BC00000, 0x03010107),
+	uint4(0xE7C78383, 0x5C000000, 0xFFF8C07F, 0x070000FF), uint4(0x5C800000, 0x30303030, 0x30303030, 0x5CC00000),
+	uint4(0x00000003, 0xFFFFFF00, 0x5D400000, 0x1FFFFFFF), uint4(0x1F070000, 0x5D800000, 0x33737373, 0x31313333),
+	uint4(0x5DC00000, 0xC0800103, 0x0C183060, 0x5E000000), uint4(0xDFE01018, 0x0F0F0F9F, 0x5F000000, 0x00000000),
+	uint4(0x3060C080, 0x5F400000, 0xFCF0C307, 0xFBEF3F7F), uint4(0x60800000, 0xFBFBFBF9, 0x04040400, 0x60C00000),
+	uint4(0xFCF8F0E1, 0x1F3F7EFC, 0x61000000, 0xC0000000), uint4(0xFFFFFCF0, 0x61400000, 0xC00007FF, 0xFFFFFFFF),
+	uint4(0x61800000, 0x80808000, 0xE0C0C0C0, 0x61C00000), uint4(0x00FFFEF8, 0x00000000, 0x62000000, 0x1E1C3C3C),
+	uint4(0x1F1E1E1E, 0x62400000, 0x0F1F1F3F, 0xE1C18307), uint4(0x62800000, 0x9F0060F0, 0x0103070F, 0x62C00000),
+	uint4(0x00818101, 0x20004040, 0x63C00000, 0x00000000), uint4(0xFFFFFFFF, 0x64000000, 0x0000E0FF, 0x00000000),
+	uint4(0x64800000, 0xFCF8F8F0, 0x01FEFEFC, 0x64C00000), uint4(0xFC7C1C05, 0x3CFCFCFC, 0x65000000, 0x80000103),
+	uint4(0x30604080, 0x65400000, 0x01010303, 0xC0808080), uint4(0x65C00000, 0x00000020, 0x00000004, 0x66400000),
+	uint4(0x8080C0E0, 0x00000000, 0x66800000, 0xC0C1430F), uint4(0xC3C3C1C0, 0x66C00000, 0x7C7C7C3C, 0xFC7C7C7C),
+	uint4(0x67000000, 0x0000FFFF, 0xFFFFFF00, 0x67800000), uint4(0x0103070F, 0x00000000, 0x67C00000, 0xF8F0E080),
+	uint4(0x00000F7E, 0x68800000, 0x4FDF9FBE, 0x71716367), uint4(0x68C00000, 0x00000000, 0xFEC00000, 0x69000000),
+	uint4(0xF8E0C187, 0x070F3E7C, 0x69800000, 0x80000003), uint4(0xFFFFFFF8, 0x69C00000, 0x7FFFFFFE, 0x070F1F3F),
+	uint4(0x6A000000, 0xFCF8E3DF, 0x1FFFFFFE, 0x6A800000), uint4(0x38FEFFFF, 0x000081E7, 0x6B800000, 0x8F1F1F1F),
+	uint4(0x00F7EFCF, 0x6C000000, 0xFFFFFEFE, 0x00FFFFFF), uint4(0x6C400000, 0x0000001F, 0x00000000, 0x6D000000),
+	uint4(0x0000020C, 0x00000000, 0x6D400000, 0x1F3F7CC0), uint4(0x01F3C70F, 0x6D800000, 0xCFDFBF7F, 0xF8F9F3E7),
+	uint4(0x6DC00000, 0x01020408, 0x40800000, 0x6E000000), uint4(0x0000010F, 0x00000000, 0x6E400000, 0xFFFFFFFF),
+	uint4(0x00010F7F, 0x6EC00000, 0x7F7FFFFF, 0x3F7F7F7F), uint4(0x6F000000, 0xE0E0271F, 0xE0E0E0E0, 0x6F400000),
+	uint4(0x00003FFF, 0x3F000000, 0x6F800000, 0xE7C7C7C7), uint4(0xE3E3E3E7, 0x6FC00000, 0x0000F000, 0x00FF0000),
+	uint4(0x70800000, 0xC7C7C7C7, 0xC7C7C7C7, 0x70C00000), uint4(0x070F1F3F, 0x00000103, 0x71000000, 0x877FFFFF),
+	uint4(0xFFFEF8E0, 0x71400000, 0x00000000, 0x01010101), uint4(0x71800000, 0xE3E3E7E7, 0xE0E0E1E1, 0x71C00000),
+	uint4(0x3F3F3C38, 0x1E1F3F3F, 0x72800000, 0x00000106), uint4(0x00000000, 0x73400000, 0xFFFEFEFE, 0x7F7FFFFF),
+	uint4(0x73800000, 0x7C7CFDF9, 0x1E1E3E3C, 0x73C00000), uint4(0x9FBFBF7F, 0x878F8F9F, 0x74400000, 0x00FFFF00),
+	uint4(0xFF000000, 0x74800000, 0x0000FCFF, 0xC0000000), uint4(0x75800000, 0xF8F0F0E3, 0x7EFCFCF8, 0x75C00000),
+	uint4(0x00000000, 0xFFFCF0C0, 0x76400000, 0x00030F3F), uint4(0xFFFFFF00, 0x76800000, 0x00013FFF, 0x80000000),
+	uint4(0x76C00000, 0x0F070703, 0x3F1F1F0F, 0x77000000), uint4(0xF8F8FB1C, 0x00F0F0F0, 0x77800000, 0xBF000000),
+	uint4(0x3F3F3FBF, 0x77C00000, 0x000000FF, 0xFFFFFF00), uint4(0x78000000, 0x0000030F, 0x00000000, 0x78400000),
+	uint4(0x00000778, 0xFFFFFF00, 0x78800000, 0x7CF8F0E0), uint4(0x0F1F3F3E, 0x79000000, 0xFFFF007F, 0x0000FFFF),
+	uint4(0x79800000, 0x1E7EFEFE, 0xFEFF020E, 0x79C00000), uint4(0xF0C0807F, 0xFFFFFEF8, 0x7A000000, 0x7FFFFFFF),
+	uint4(0x0DF38F1F, 0x7A400000, 0xFCE00003, 0xC000073F), uint4(0x7A800000, 0x03030707, 0xF8F0C101, 0x7AC00000),
+	uint4(0x00000107, 0x9F070100, 0x7BC00000, 0x01030F1F), uint4(0xFF000000, 0x7C000000, 0x07070F9F, 0xF1F9FF02),
+	uint4(0x7C800000, 0x07070303, 0x0F0F0707, 0x7CC00000), uint4(0x00E0F8FE, 0x01030F1F, 0x7D000000, 0x7E7E7E7E),
+	uint4(0x7C7C7E7E, 0x7D400000, 0xFFFFFF7F, 0x0000FFFF), uint4(0x7D800000, 0x00000080, 0x00000000, 0x7DC00000),
+	uint4(0x00000003, 0xFFFFFFFF, 0x7E000000, 0x1F1F0F0F), uint4(0xBFBFBF9F, 0x7E400000, 0xE0FEFFFF, 0x01071F7F),
+	uint4(0x7E800000, 0xE0800001, 0x3FFFFEF8, 0x7F000000), uint4(0xF8F8F900, 0x001878F8, 0x7F800000, 0x808081C3),
+	uint4(0x00000000, 0x7FC00000, 0x00010307, 0x00FFFCC0), uint4(0x80400000, 0x00FFFFFF, 0xE0800000, 0x81000000),
+	uint4(0xE0C08087, 0xF8F8F0E0, 0x81400000, 0x001FFFFF), uint4(0x0F7FFEE0, 0x81800000, 0xF0F0E0E1, 0x3E7C7CF8),
+	uint4(0x81C00000, 0x00011FFF, 0x00000000, 0x82400000), uint4(0x1010FFEF, 0x71703030, 0x82C00000, 0x78F0E0C1),
+	uint4(0x070F1E3C, 0x83000000, 0x80000003, 0xE0C0CF87), uint4(0x83800000, 0xFDFDFCFC, 0x04040000, 0x83C00000),
+	uint4(0xFEFEFEFE, 0x02FFFFFE, 0x84400000, 0xFCC000FF), uint4(0x0F0000FF, 0x84800000, 0x10200040, 0x040C0810),
+	uint4(0x84C00000, 0x787C7C7E, 0x60607070, 0x85400000), uint4(0xF0F8F8F8, 0xE0E0F0F0, 0x85800000, 0x80808080),
+	uint4(0xC0C0C0C0, 0x85C00000, 0x031FFFFF, 0x00FFFE80), uint4(0x86800000, 0xFF000001, 0xE7EFDFFF, 0x86C00000),
+	uint4(0xFFFF0000, 0xFFF800FF, 0x87800000, 0x0F1F3F7F), uint4(0x00010307, 0x87C00000, 0x8000030E, 0xF8F0E0C0),
+	uint4(0x88400000, 0xF0FCF000, 0xFE0000C0, 0x88800000), uint4(0x0C181811, 0x4246868C, 0x88C00000, 0xFFFFFFFF),
+	uint4(0xC0000000, 0x89000000, 0x0000C0FC, 0xFFFFF000), uint4(0x89400000, 0x80808187, 0x878FBF00, 0x89800000),
+	uint4(0x00000004, 0x00000202, 0x89C00000, 0x0000C0E0), uint4(0xFCFFFF00, 0x8A400000, 0x27E0E0E0, 0xE0E0E1E7),
+	uint4(0x8A800000, 0xFFFEFCF9, 0xFFFF001F, 0x8B800000), uint4(0xE0C0C0C0, 0xE0E0E0E0, 0x8BC00000, 0x00000004),
+	uint4(0x00000000, 0x8C800000, 0x00FFFEF8, 0xC0000000), uint4(0x8CC00000, 0x40606060, 0xFF004040, 0x8DC00000),
+	uint4(0xFFFFF000, 0x00000000, 0x8E400000, 0xE0F0FCFE), uint4(0xFF0000C0, 0x8F000000, 0x1F3F3F3F, 0x8F0F0F1F),
+	uint4(0x8FC00000, 0x0000FFFF, 0x1F070301, 0x90800000), uint4(0xBCBCBCBC, 0xBCBCBCBC, 0x90C00000, 0x00000000),
+	uint4(0xE0C0C080, 0x91000000, 0x1C1C3C3C, 0x18181818), uint4(0x91400000, 0x8F8F8F9F, 0xCFCFCF8F, 0x91C00000),
+	uint4(0x0707070F, 0x01030303, 0x92400000, 0xBF3F3E7C), uint4(0x0E18103F, 0x92800000, 0x8480817B, 0xDC8C8C8C),
+	uint4(0x92C00000, 0xFEFCF8F0, 0x073FFFFF, 0x93800000), uint4(0x1C180B07, 0x3E1E1E1C, 0x93C00000, 0xC0F0F8FC),
+	uint4(0x00000080, 0x94400000, 0xFCE08000, 0xFFFFFFFF), uint4(0x94800000, 0xF9FBF3F3, 0x7E7CFDFD, 0x94C00000),
+	uint4(0xFFFCF0C0, 0xFFFFFFFF, 0x95000000, 0xF3C3870F), uint4(0x7FFFFCF9, 0x95800000, 0x80C0E0F0, 0xFF000000),
+	uint4(0x95C00000, 0xFEFEFEE0, 0x3C7CFCFC, 0x96000000), uint4(0x00E0FCFF, 0x00000000, 0x96400000, 0xFFFFFCC3),
+	uint4(0xFFF00FFF, 0x96800000, 0xFFFFFFFF, 0x3C3E7FFF), uint4(0x97400000, 0x7E000000, 0xE0000000, 0x97800000),
+	uint4(0xE6E4E8E0, 0xE1E1E3E2, 0x97C00000, 0x007F0300), uint4(0x00000000, 0x98000000, 0x00000000, 0xF0E0C080),
+	uint4(0x98400000, 0x031FFF00, 0x80000000, 0x98800000), uint4(0x30383C3C, 0xDFDF0010, 0x98C00000, 0x00000007),
+	uint4(0xFFFF0000, 0x99000000, 0xFFFFFFF1, 0xFCE0000F), uint4(0x99800000, 0x00204081, 0x00000810, 0x99C00000),
+	uint4(0x0000017F, 0xFFFFFF00, 0x9A000000, 0x7E7E3E3E), uint4(0xFEFE7E7E, 0x9A800000, 0xEECECC9C, 0x0F0F1F2F),
+	uint4(0x9AC00000, 0x00000001, 0xF8C00000, 0x9B000000), uint4(0xFFFFFEFC, 0x00000000, 0x9B400000, 0xC000C1E2),
+	uint4(0x030F1F38, 0x9B800000, 0x02FF7F7E, 0x0E060602), uint4(0x9BC00000, 0xC0E0F0F0, 0xFFFF0080, 0x9C400000),
+	uint4(0xC6C6C6CE, 0xC2C2C6C6, 0x9CC00000, 0x10303161), uint4(0x0C080818, 0x9DC00000, 0x3010F7F3, 0xF0F0F0F0),
+	uint4(0x9E400000, 0xFFFFFFFF, 0x1E38637F, 0x9E800000), uint4(0x0307078F, 0xFE010103, 0x9F000000, 0x00FFFFFC),
+	uint4(0xFF3F0300, 0x9F800000, 0x43838387, 0x41434343), uint4(0x9FC00000, 0xB1A383C3, 0x1E1D19B9, 0xA0C00000),
+	uint4(0x037FFCF0, 0x00000000, 0xA1400000, 0x0000077F), uint4(0xFFFF0000, 0xA1800000, 0xEFEFFFFF, 0xCECEEEEE),
+	uint4(0xA1C00000, 0xF8F0E0D0, 0xFBFFFEF4, 0xA2000000), uint4(0x1F3F7EFE, 0x0103070F, 0xA2400000, 0x70707070),
+	uint4(0x70707070, 0xA2800000, 0x00000307, 0x00000000), uint4(0xA2C00000, 0x060C1838, 0x00000102, 0xA3000000),
+	uint4(0xF3F3F3F7, 0xF0F1F1F1, 0xA3C00000, 0xFEFFF8C0), uint4(0xC0E0F0FC, 0xA4800000, 0x20202020, 0x20202020),
+	uint4(0xA4C00000, 0x0378F8F8, 0xF8F8F838, 0xA5400000), uint4(0x00033FFF, 0x80F0FFFF, 0xA5800000, 0xF8F0E1E3),
+	uint4(0x3F7E7CFC, 0xA5C00000, 0xE7CF9F3F, 0xFEFDFBF7), uint4(0xA6000000, 0x02020202, 0x01010303, 0xA6400000),
+	uint4(0xF0F0E0E0, 0x1C3C7878, 0xA6800000, 0x0000007F), uint4(0x07010000, 0xA7000000, 0xFFFFFFFF, 0x0000FF00),
+	uint4(0xA7800000, 0x11071F7F, 0x07060C08, 0xA8000000), uint4(0xC7CF9F3F, 0x7C78F1E3, 0xA8400000, 0x00BF3F7F),
+	uint4(0x070F0C18, 0xA8800000, 0x81810103, 0xD0A080C0), uint4(0xA8C00000, 0xE0E0E1E3, 0xF0F0F0E0, 0xAA400000),
+	uint4(0x787971F1, 0xFCBCBCF8, 0xAAC00000, 0xFCFEFFFF), uint4(0xF0F0F8FC, 0xAB000000, 0x40800001, 0x04081020),
+	uint4(0xAB400000, 0xFEF0831F, 0x1FFFFFFF, 0xAB800000), uint4(0x0001073F, 0xC0000000, 0xABC00000, 0x3FFFFFFF),
+	uint4(0x3C71E7CF, 0xAC000000, 0xFCF83CFC, 0xFCFCFCFC), uint4(0xAC800000, 0x08080808, 0x08080808, 0xACC00000),
+	uint4(0x7F3F3F1F, 0xFFFFFF7F, 0xAD000000, 0xFFFEFEFC), uint4(0x031FFFFF, 0xAD400000, 0x000000FF, 0x000000FF),
+	uint4(0xAD800000, 0x61614343, 0x21212121, 0xADC00000), uint4(0xF7E7E7E3, 0x00F7F7F7, 0xAE000000, 0xFEFFFFFF),
+	uint4(0x000080F0, 0xAE400000, 0x80800001, 0xCFC7C180), uint4(0xAF000000, 0x000080E0, 0x00000000, 0xAF400000),
+	uint4(0x00F00000, 0x00000000, 0xAF800000, 0x7EFCF0E0), uint4(0x0000030F, 0xAFC00000, 0x061C3870, 0x00000103),
+	uint4(0xB0400000, 0x7C7C7CFC, 0xBCBD3C7C, 0xB0C00000), uint4(0x00000001, 0x3CE00000, 0xB1400000, 0xFFFFFCF8),
+	uint4(0x00FF7F7F, 0xB1C00000, 0xE76F3F3F, 0xF0F1E3E7), uint4(0xB2400000, 0xFF000000, 0x000000FF, 0xB2800000),
+	uint4(0x1C181818, 0x060E0C0C, 0xB3000000, 0x78787879), uint4(0x3C3C3838, 0xB3C00000, 0xF0E0C79F, 0xFFFEFCF8),
+	uint4(0xB4000000, 0x7F3F1F1F, 0xFFFFFF7F, 0xB4800000), uint4(0x10FFF7E3, 0xF8783010, 0xB5000000, 0xC0C0C1C3),
+	uint4(0xFF4040C0, 0xB5400000, 0x0F3F7FFF, 0xF0E08103), uint4(0xB5800000, 0x306041C1, 0x0E1C1838, 0xB5C00000),
+	uint4(0xFFFFFFF8, 0x0107007F, 0xB6800000, 0xEEEEEEEE), uint4(0x00FEFEFE, 0xB6C00000, 0xFCF08001, 0xFFFFFFFF),
+	uint4(0xB7000000, 0x010000FF, 0x3F1F0F03, 0xB8000000), uint4(0xE7676767, 0xEFE7E7E7, 0xB8C00000, 0xFCF0C000),
+	uint4(0xFFFFFFFF, 0xB9000000, 0x2FE7C7C3, 0x38181107), uint4(0xB9800000, 0x00000000, 0x80000000, 0xB9C00000),
+	uint4(0xFFFFFFC0, 0x07FFFFFF, 0xBB000000, 0x307060E0), uint4(0x0C181830, 0xBBC00000, 0x070F1F3E, 0x00000103),
+	uint4(0xBC400000, 0xFFFF00E0, 0x7F7FE0F8, 0xBC800000), uint4(0x01020408, 0x00000000, 0xBCC00000, 0xFFFFFF87),
+	uint4(0xFFFFFFFF, 0xBD000000, 0x80808000, 0xE0E0C0C0), uint4(0xBD400000, 0x001FFFFF, 0xFF000000, 0xBD800000),
+	uint4(0x38383838, 0x1C1C1C18, 0xBE000000, 0x83C7EF10), uint4(0xFF000001, 0xBE800000, 0x60616161, 0x60606060),
+	uint4(0xBEC00000, 0x02FFFCFC, 0x7F3F1F06, 0xBF000000), uint4(0x3F1F0EEF, 0xFFFC403F, 0xBF800000, 0x00008080),
+	uint4(0x00000000, 0xC0000000, 0xFEE00000, 0x00FCFFFF), uint4(0xC0400000, 0xF060477F, 0xFEFCF8F8, 0xC0800000),
+	uint4(0x01071F7F, 0xE0800000, 0xC1000000, 0xE0F0F8FC), uint4(0x3F3F00C0, 0xC1400000, 0x3FFF7F7F, 0x70706147),
+	uint4(0xC1800000, 0x40404040, 0x40404040, 0xC1C00000), uint4(0x1F3FFFFF, 0xC0808307, 0xC2000000, 0x0F7FFFF9),
+	uint4(0x3FFFFEE3, 0xC2800000, 0xF8F8F0E1, 0x0F3EFEFC), uint4(0xC3000000, 0x00000000, 0x03010100, 0xC3800000),
+	uint4(0xFCF8F0E0, 0xFFFFFFFE, 0xC3C00000, 0xFFFF0000), uint4(0x0000037F, 0xC4800000, 0x04FBF9F8, 0xFE7E3C1C),
+	uint4(0xC5400000, 0x7FFFBFBE, 0x30202007, 0xC5C00000), uint4(0x80808080, 0xC0C0C080, 0xC6000000, 0xC0808080),
+	uint4(0xE0C0C0C0, 0xC6400000, 0x80808180, 0x9F808080), uint4(0xC6800000, 0x00000007, 0xFFFFFFC0, 0xC7000000),
+	uint4(0xFFFFFF00, 0x00000000, 0xC7400000, 0x00033FFF), uint4(0xFEFCF0C0, 0xC7800000, 0x0707070F, 0x03030707),
+	uint4(0xC7C00000, 0xFEFEFEFE, 0x02010E7E, 0xC8400000), uint4(0x1C04FFFC, 0xFEFEFE7E, 0xC8800000, 0xDF3FFFFF),
+	uint4(0xFFFCFBE7, 0xC9000000, 0xE0800000, 0xFFFFFEF8), uint4(0xC9400000, 0x000000FF, 0x00FFFF00, 0xC9800000),
+	uint4(0x077FFDFD, 0x0C0C0404, 0xC9C00000, 0xFEFCFCFC), uint4(0x00010F7E, 0xCA000000, 0xE0800000, 0x01071E78),
+	uint4(0xCA800000, 0x61C38386, 0x18303060, 0xCAC00000), uint4(0x00FFFDFD, 0x83010101, 0xCB000000, 0xC0800103),
+	uint4(0xF8F0E0E0, 0xCB400000, 0xFFFFFFFF, 0x3F7F7FFF), uint4(0xCB800000, 0x0E0E0E0E, 0x0E0E0E0E, 0xCC400000),
+	uint4(0x00030F3F, 0xF0E08000, 0xCC800000, 0x82848484), uint4(0x41424242, 0xCCC00000, 0xF0E0C1C3, 0x3E7C78F8),
+	uint4(0xCD400000, 0xFFFFFEF8, 0xFFFFFFFF, 0xCD800000), uint4(0x80800000, 0xE0E0C0C0, 0xCE400000, 0xC0F30E3F),
+	uint4(0xFC000000, 0xCE800000, 0xFFFFFFFF, 0xC06078FE), uint4(0xCF000000, 0xF8F8F8F8, 0x183878F8, 0xCF800000),
+	uint4(0x70F0F0E1, 0xF8E89830, 0xCFC00000, 0xFEFCF8F0), uint4(0x00077FFF, 0xD0400000, 0x00100020, 0xFB000000),
+	uint4(0xD0800000, 0xFCF8F8F0, 0xF7F7F6FE, 0xD0C00000), uint4(0xE0611FC7, 0xF0F0F0E0, 0xD1000000, 0xFFF8E10F),
+	uint4(0xFFFFFFFF, 0xD1C00000, 0x00000001, 0xFF1F0000), uint4(0xD2000000, 0x7E7EFEFE, 0x3E7E7E7E, 0xD2400000),
+	uint4(0x1FFF3F0F, 0xC0C08000, 0xD2800000, 0x83838787), uint4(0x80808181, 0xD3400000, 0x0604FFF9, 0x3F1F0F0E),
+	uint4(0xD3C00000, 0x01010303, 0x7FFEE000, 0xD4400000), uint4(0xBEBEBEBE, 0xBEBEBEBE, 0xD4C00000, 0x040E1E3E),
+	uint4(0xF8F8FD00, 0xD5000000, 0x3FFFFFFF, 0x00000307), uint4(0xD5800000, 0xFF7F7F7F, 0xFFFFFFFF, 0xD6000000),
+	uint4(0x3FFFFFFF, 0xC0000107, 0xD6800000, 0x0701FFFE), uint4(0xFFFF7F1F, 0xD7400000, 0xFF000000, 0x00000000),
+	uint4(0xD7800000, 0x00000000, 0x00FCFF00, 0xD8800000), uint4(0x3F0F03FE, 0xFFFFFFFF, 0xD9000000, 0xF8F0F0E0),
+	uint4(0xFFFEFEFC, 0xD9400000, 0x8000077F, 0xFFFFFFF8), uint4(0xD9800000, 0x8E8E8E8E, 0x8E8E8E8E, 0xD9C00000),
+	uint4(0x20004000, 0x00100020, 0xDA000000, 0x1F3F3F7F), uint4(0xE7CF8F1F, 0xDA400000, 0xC0000103, 0x077FFCF0),
+	uint4(0xDA800000, 0xFEFFFFFC, 0x00000080, 0xDB000000), uint4(0x1F3FFEF8, 0x00000307, 0xDB400000, 0x00010307),
+	uint4(0x1F3F7F00, 0xDB800000, 0xC0C0C0E0, 0x80808080), uint4(0xDBC00000, 0x7E786000, 0x7C7E7F7F, 0xDC400000),
+	uint4(0x103C7EFF, 0x010387EF, 0xDD800000, 0x77737373), uint4(0x77777777, 0xDDC00000, 0xFCFCFCFC, 0x3C3C7CFC),
+	uint4(0xDE000000, 0x0000000F, 0x031FFFFF, 0xDE800000), uint4(0xF7F7F3F3, 0x377777F7, 0xDEC00000, 0x3010FFEF),
+	uint4(0xF0F07030, 0xDF400000, 0xFFFFFF7F, 0xC000FFFF), uint4(0xDF800000, 0xE7E7E7E7, 0xFFF7F7F7, 0xDFC00000),
+	uint4(0xEFDFDFDF, 0xF7F7F7EF, 0xE0400000, 0x003EF8E0), uint4(0x07FCF0C0, 0xE0800000, 0xE3E7E7EF, 0xC1E1E1E3),
+	uint4(0xE0C00000, 0x1F3FFFFF, 0xC0800307, 0xE1400000), uint4(0xC0033FFF, 0xFFFFFCF0, 0xE1800000, 0xFEFEFCFD),
+	uint4(0x1F3F7FFF, 0xE1C00000, 0xC0000007, 0x0FFEF8F0), uint4(0xE2800000, 0x7FFFFFFF, 0x01030F1F, 0xE3000000),
+	uint4(0xC040DFC7, 0xC0C0C0C0, 0xE3400000, 0x0001030F), uint4(0x70800000, 0xE3800000, 0xCECECEEF, 0x8C8CCCCE),
+	uint4(0xE3C00000, 0x00000000, 0x0000FC00, 0xE4000000), uint4(0xFCF8E0CF, 0x031FFFFE, 0xE4800000, 0xC7878F8F),
+	uint4(0xE1E1C3C3, 0xE4C00000, 0x0307070F, 0x00010103), uint4(0xE5000000, 0x00000007, 0xC0000000, 0xE5400000),
+	uint4(0x20606060, 0x20202020, 0xE5800000, 0xF3F7FEF8), uint4(0xC3E3E3F3, 0xE5C00000, 0xFFFFFEF8, 0x070F3F7F),
+	uint4(0xE6400000, 0x43434347, 0x83030343, 0xE6C00000), uint4(0xC0800000, 0x070C1870, 0xE7000000, 0xC3838383),
+	uint4(0xC3C3C3C3, 0xE7C00000, 0x00010303, 0x00000000), uint4(0xE8400000, 0xC0C0C0DF, 0xC0C040C3, 0xE8800000),
+	uint4(0xFFFFFFFF, 0x707C7EFF, 0xE9400000, 0x1DFCFCFC), uint4(0xFC7C1C04, 0xE9800000, 0x80000000, 0x78F0E0C0),
+	uint4(0xE9C00000, 0x80000003, 0xFFFEF8E0, 0xEA000000), uint4(0x7FFFFEFD, 0xE7CF9FBF, 0xEA400000, 0x3FFFF881),
+	uint4(0xFFF8C007, 0xEA800000, 0xC0C0C0C0, 0xE0E0E0C0), uint4(0xEB000000, 0xFFF88100, 0x1FFFFFFF, 0xEB800000),
+	uint4(0x08181021, 0x43C2840C, 0xEBC00000, 0xE1E1E2E2), uint4(0x60E0E0E0, 0xEC400000, 0x98181810, 0xFEDEDC9C),
+	uint4(0xECC00000, 0x1E3F7FFF, 0x81C3F7C8, 0xED000000), uint4(0xFCF0C000, 0x3FFFFFFF, 0xED400000, 0x0000031F),
+	uint4(0x1FFCE000, 0xED800000, 0x3F3D7D7B, 0x1F1F1F3E), uint4(0xEDC00000, 0xFFFEFCFC, 0x8000037F, 0xEE800000),
+	uint4(0xE1E3C3C7, 0xF8F0F0E0, 0xEEC00000, 0x0F1F1F1F), uint4(0x07070F0F, 0xEF000000, 0x0F1C3870, 0xF0C08307),
+	uint4(0xEF800000, 0xDFDF9F9F, 0xF0D8DCDE, 0xEFC00000), uint4(0x031FFFFF, 0xE0800000, 0xF0800000, 0xFDFDFDF9),
+	uint4(0x03020200, 0xF0C00000, 0xFCF8F0E0, 0x000000FF), uint4(0xF1000000, 0x10E0C081, 0x7FFEFCFB, 0xF1800000),
+	uint4(0xBCF08242, 0x39393FBF, 0xF1C00000, 0xF0E0C183), uint4(0x7FFEFCF8, 0xF2000000, 0xFFFEFEFC, 0xFFFFFFFF),
+	uint4(0xF2400000, 0x0001070F, 0xC0C08080, 0xF2800000), uint4(0xF9F9B9B9, 0x7FFFF9F9, 0xF2C00000, 0x1F1F0F0F),
+	uint4(0xFF3F3F3F, 0xF3C00000, 0x7CF8F0C0, 0x03071F3F), uint4(0xF4000000, 0x6060E0E0, 0x20606060, 0xF4400000),
+	uint4(0x61616161, 0x61616161, 0xF4C00000, 0x00000000), uint4(0xFFFFF800, 0xF5000000, 0xFFE13FFF, 0xFFFFFFFF),
+	uint4(0xF5C00000, 0xFEFFFFFF, 0xE0F0F8FC, 0xF6800000), uint4(0xFD3D8D83, 0x9CBCBCFC, 0xF6C00000, 0x0E1C3C78),
+	uint4(0x0103070F, 0xF7000000, 0x7C7C7C7C, 0x7C7C7C7C), uint4(0xF7400000, 0xE0FEFFFF, 0x00000000, 0xF8400000),
+	uint4(0xF8FEFF00, 0xFFFF80E0, 0xF8800000, 0x02020206), uint4(0xFEFF0000, 0xF8C00000, 0x7E78F0C0, 0x3F7F7F7F),
+	uint4(0xF9400000, 0xFEF8E001, 0xFF00000F, 0xF9800000), uint4(0xC1C1C0C0, 0xC7C3C3C3, 0xF9C00000, 0x00000001),
+	uint4(0x3FFFFFFF, 0xFA400000, 0xFFF00000, 0x0000FFFF), uint4(0xFB800000, 0x83070F0F, 0xC3C18187, 0xFBC00000),
+	uint4(0x00000800, 0x00000000, 0xFC000000, 0xFFFE8001), uint4(0xFFFFFFFF, 0xFC400000, 0x000080C0, 0x077F0000),
+	uint4(0xFC800000, 0xFFFEF081, 0x0F1F3F7F, 0xFD400000), uint4(0x00000003, 0x00000FFF, 0xFD800000, 0x3E5E7CBC),
+	uint4(0x0F171F2F, 0xFDC00000, 0xF0800000, 0xF0FCFFFF), uint4(0xFE000000, 0x30787878, 0x30303030, 0xFE800000),
+	uint4(0x0E0C0810, 0x0707070E, 0xFEC00000, 0x0103070F), uint4(0xC0808000, 0xFF000000, 0x80808080, 0x00000080),
+	uint4(0xFF400000, 0x031EF8F0, 0x00000000, 0xFF800000), uint4(0x0C0C0C0E, 0xE0C88808, 0xFFC00000, 0x00000000),
+};
+
+#define PARTITION_2_COUNT_10X5 672
+#define PARTITION_2_WORDS_10X5 2
+static const uint4 partition_2_10x5[336] =
+{
+	uint4(0xC1F07C1E, 0x00400F03, 0xC0703C0F, 0x00800301), uint4(0x1789E673, 0x00C03C1F, 0x380C0200, 0x0100F078),
+	uint4(0xE0783E1F, 0x01420381, 0x46018427, 0x01C0E138), uint4(0xC1F0FC3F, 0x02000F07, 0x3FCFE3F0, 0x0243FEFF),
+	uint4(0x3FCFF3FE, 0x0283F8FF, 0x20C06030, 0x02C30281), uint4(0xDFFFFFFF, 0x0340FF3F, 0xF87C1F0F, 0x0383C1F0),
+	uint4(0xBE0C0000, 0x03C3FFFF, 0x60180601, 0x04020180), uint4(0xC7FFFFFF, 0x04400001, 0x00000007, 0x0483FF00),
+	uint4(0x1FC7F1FC, 0x04C1FC7F, 0x0C0300C0, 0x0500C030), uint4(0x3C0E0381, 0x0543E0F0, 0x3F0F0781, 0x05C3FCFE),
+	uint4(0xF0FC3F0F, 0x06031FC7, 0x3E0F83E7, 0x0643E0F8), uint4(0x000003FF, 0x06801F00, 0x6338CE73, 0x06C331CC),
+	uint4(0x3F0FC3F0, 0x0703F0FC, 0x3F0F83E0, 0x0743F8FC), uint4(0xF7FDFF7F, 0x07833FCF, 0xBC2F0BC2, 0x07C3C2F0),
+	uint4(0x08020080, 0x08008020, 0x20000007, 0x0843FFFF), uint4(0x3FFFFC00, 0x09000000, 0xA1F87E1F, 0x09401E07),
+	uint4(0xFDFF7FDF, 0x09C3FFFF, 0xFFF00007, 0x0A83FFFF), uint4(0x3F8FF3FE, 0x0AC3E0FC, 0x3C0F03C0, 0x0B03C0F0),
+	uint4(0xC0F0783E, 0x0B420381, 0xC00FFFFF, 0x0B83FFFF), uint4(0x77CDF27C, 0x0BC37FDF, 0x01004010, 0x0C001004),
+	uint4(0x78180C07, 0x0C43E0F0, 0x3E0F0380, 0x0C83FCFE), uint4(0x22098060, 0x0CC320C8, 0xFFFFFDFF, 0x0D03FFFF),
+	uint4(0xBFEFF800, 0x0D41FEFF, 0xCFFFFBF9, 0x0D83CFCF), uint4(0x00020001, 0x0DC00010, 0x20000C0F, 0x0E0380C0),
+	uint4(0x0780C3DF, 0x0E80FE1F, 0x301C0200, 0x0EC0C060), uint4(0xC0701C0F, 0x0F400100, 0xFBFEFC00, 0x0F833FCF),
+	uint4(0xBFCFC3C0, 0x0FC0010F, 0x00000404, 0x10400000), uint4(0xE1F83E0F, 0x10831F87, 0x0781E078, 0x10C0781E),
+	uint4(0xE0F83E1F, 0x11030783, 0xC3F3FDFF, 0x11400707), uint4(0x00303838, 0x11800000, 0xBBECFA7E, 0x11C3DEE7),
+	uint4(0xC3F1FCFF, 0x12000F07, 0x1FE7FDFC, 0x1241F07E), uint4(0x80402000, 0x12800100, 0x07030180, 0x12C00C0E),
+	uint4(0xBFCFF3F8, 0x13020007, 0x0F03C0F8, 0x1340E038), uint4(0xFFF00000, 0x1383FFFF, 0x3F8FA3E8, 0x13C3F0FC),
+	uint4(0xBDEF7BDE, 0x14C39EF7, 0x40100401, 0x15000100), uint4(0xDFF7FDFF, 0x1541FF7F, 0xC3F0F87E, 0x15801F0F),
+	uint4(0x084210C4, 0x15C00020, 0xF03C1F87, 0x16020180), uint4(0x2008067F, 0x164300C0, 0xE7FFFD80, 0x16803F0F),
+	uint4(0xC3F0FC7F, 0x16C01F07, 0x3FEFFC00, 0x178200F8), uint4(0x004FEFF9, 0x17C01E03, 0xCFF3FDFF, 0x1842FFBF),
+	uint4(0xC3F1F9FC, 0x18800303, 0x21C8721C, 0x18C01C87), uint4(0x1F81C007, 0x1903FEFF, 0xC1F33DC7, 0x19404707),
+	uint4(0x01806018, 0x19C01806, 0xC0703C1F, 0x1AC00100), uint4(0xF1F0FC7F, 0x1B03C7E3, 0x7C1F0F87, 0x1B43C0F0),
+	uint4(0x3F07C013, 0x1B80F0FC, 0x00000403, 0x1C000000), uint4(0x300C0300, 0x1C4300C0, 0xCFF7FFFF, 0x1C801F0F),
+	uint4(0x9FC7E1FC, 0x1CC1F27C, 0xF03C0700, 0x1D030FC1), uint4(0x380C0603, 0x1DC0C060, 0xC3F8FC3F, 0x1E403809),
+	uint4(0xFC7FBC10, 0x1E8303E1, 0xF9FE7F9F, 0x1EC39FE7), uint4(0x00001C1F, 0x1F420000, 0xF8FC7E1F, 0x2003CFF3),
+	uint4(0xC1F07C1F, 0x20420F03, 0x0C080003, 0x20800404), uint4(0x3E0784E3, 0x20C3E0F8, 0x3FFFFFFF, 0x21000000),
+	uint4(0xC1C0403F, 0x21838F83, 0x008002FF, 0x21C21886), uint4(0x00000000, 0x2203FF00, 0x3C0F0380, 0x2243F0F8),
+	uint4(0x00101479, 0x22838080, 0x3C8C300E, 0x22C3EEFC), uint4(0x20100C07, 0x2381C0E0, 0xE1F07C1F, 0x23C21F87),
+	uint4(0x03038180, 0x24000607, 0xC7F1FC7F, 0x24407F1F), uint4(0xFFCF8300, 0x2480003F, 0xF9FCFE7F, 0x24C3EFF7),
+	uint4(0xC0F07C3F, 0x25000701, 0x20000000, 0x2543C0E0), uint4(0xFFFFFC00, 0x2583FFFF, 0x3B2E8BC2, 0x25C3BEEF),
+	uint4(0x3E0FC3F0, 0x2643E0F8, 0x380C0300, 0x2683C0F0), uint4(0x3E0F83E0, 0x26C3E0F8, 0x3C0F83F0, 0x270300E0),
+	uint4(0x9FE7F8FE, 0x2743FEFF, 0x3E0F87EE, 0x2783E0F8), uint4(0xFC3C1C07, 0x27C3F9F8, 0x100DFF3F, 0x294300C0),
+	uint4(0xC7E1F0F8, 0x29C31F8F, 0x7F9FCFE7, 0x2A03FCFE), uint4(0x000FEFF9, 0x2A401802, 0x878F0300, 0x2A800000),
+	uint4(0x20000C1F, 0x2AC30080, 0x7F700060, 0x2B03F8FC), uint4(0x0381C0E0, 0x2B820F07, 0x000FFFEF, 0x2BC06008),
+	uint4(0x40200804, 0x2C420180, 0x000FFBFF, 0x2C800000), uint4(0x00000001, 0x2D430000, 0x80C0300C, 0x2DC20E83),
+	uint4(0xF0FC3E0F, 0x2E018FE3, 0xDFF7FCFF, 0x2E43FFFF), uint4(0xFFFFFFFF, 0x2F01FFFF, 0x0380F03C, 0x2FC0300E),
+	uint4(0x0E0380C0, 0x3040E038, 0xFFEFF3F8, 0x3080FFFF), uint4(0x799E6799, 0x30C3B9EE, 0xC3E0F83E, 0x31003F0F),
+	uint4(0xBFFFFFFF, 0x3183F8FF, 0xD9EC721D, 0x31C0CF63), uint4(0xCFF3FDFF, 0x32003F1F, 0xFDF00010, 0x32C39FF7),
+	uint4(0x60180E07, 0x33020080, 0x0000000F, 0x33800000), uint4(0xC7F0FC1F, 0x33C0007F, 0x40100C07, 0x34020000),
+	uint4(0x3F8FE3F8, 0x3443F8FE, 0x9FF7FFFF, 0x3480FC3F), uint4(0xB8CE3308, 0x34C3CEF3, 0x380C0606, 0x3543E0F0),
+	uint4(0xCFF7E3C0, 0x35839F0F, 0x18C67198, 0x35C1CC63), uint4(0x40100802, 0x36000100, 0xC0703C1F, 0x36400300),
+	uint4(0xFF8E0000, 0x368000FF, 0x10040100, 0x36C10040), uint4(0x000C03C0, 0x3703F8C0, 0xF9FC7F3F, 0x3783C7E3),
+	uint4(0xC0703C1F, 0x37C00301, 0x3F0F83C3, 0x3843FCFE), uint4(0x3F8F83C0, 0x3883FFFF, 0xC0301806, 0x38C00100),
+	uint4(0x180E0703, 0x3940E070, 0x180C0001, 0x39803018), uint4(0x3FFFEFF3, 0x39C00100, 0xDFF00C01, 0x3A03FFFF),
+	uint4(0x3E0F07A1, 0x3AC1C87C, 0x0100C030, 0x3B001104), uint4(0x00000003, 0x3B400000, 0x3FCFF3FC, 0x3B83FCFF),
+	uint4(0xC1F07C1F, 0x3BC21F07, 0xE0F81E03, 0x3C023F87), uint4(0xBFCFC3E1, 0x3DC07FFF, 0xF8FC3F0F, 0x3E03CFE3),
+	uint4(0xE7F9FF7F, 0x3E407E1F, 0xE0F00C06, 0x3E83FF9F), uint4(0xC1F00001, 0x3F03FFFF, 0xDFF7F1F0, 0x3F41FF7F),
+	uint4(0x001078F0, 0x3F800000, 0x43C0F07C, 0x3FC11D47), uint4(0x0040100C, 0x4043FD00, 0xFE7C3C1F, 0x40800006),
+	uint4(0x380C0E0F, 0x4103E0F0, 0x300E03C0, 0x41400080), uint4(0x07C1FC7E, 0x41833088, 0x0F03C0F0, 0x41C0F03C),
+	uint4(0x380803FF, 0x4203F0F8, 0x000FFDFF, 0x42420080), uint4(0x80601806, 0x42800601, 0x00010040, 0x42C02008),
+	uint4(0x3800040F, 0x4383FEFC, 0xFC7F1FC6, 0x43C1C3F1), uint4(0x000FFFFF, 0x4403FF00, 0x1E07C1F8, 0x4441C078),
+	uint4(0xC0300400, 0x44C00F01, 0x300C0360, 0x45404000), uint4(0xC1F07B30, 0x45831F07, 0xC1E0781C, 0x45C20F83),
+	uint4(0x1F87E1FC, 0x4641F87E, 0x0E0381E0, 0x4680E038), uint4(0xFFEFF3F8, 0x46C3FFFF, 0xCFFFFFFE, 0x47001F1F),
+	uint4(0x3E0FC3F0, 0x4783C0F8, 0x180E0300, 0x47C0C030), uint4(0x3E0F83C0, 0x4843F0F8, 0xA7C9F0F9, 0x48C31ECF),
+	uint4(0x0701C0F0, 0x4900300C, 0x3C0FC3FC, 0x494000C0), uint4(0x00000001, 0x49800000, 0xE1F0BC7F, 0x49C30781),
+	uint4(0xCFFFFFFF, 0x4A001F1F, 0x000007FF, 0x4A820080), uint4(0x9C6E1B86, 0x4AC1C771, 0x30080200, 0x4B0380E0),
+	uint4(0x2000040F, 0x4B83F8F0, 0x200F03FC, 0x4BC00000), uint4(0xC3FEFFBF, 0x4C004011, 0xDFEFFBFD, 0x4C407F3F),
+	uint4(0x030C83C0, 0x4C801F0F, 0xDFE7F9FC, 0x4CC0007F), uint4(0xCFFFFC00, 0x4D421F9F, 0xBFF00000, 0x4E83F0FF),
+	uint4(0x3E0F83F0, 0x4F03C0F8, 0x380C0201, 0x4F43C0E0), uint4(0xCFF0FC1F, 0x4F83FF7F, 0xE6318C62, 0x4FC22388),
+	uint4(0x40100C0F, 0x50C20000, 0x40707C7F, 0x51000000), uint4(0x20000403, 0x514180C0, 0x01FFFF80, 0x51800000),
+	uint4(0x2789E27C, 0x51C27C9E, 0xFF7F9FEF, 0x5243F1FC), uint4(0xE0703C1F, 0x528381C0, 0xE1F07C1F, 0x53030F83),
+	uint4(0x3048120C, 0x53C304C1, 0xE1F07C1E, 0x54438FC3), uint4(0x060184C1, 0x54C2300C, 0x781E0F03, 0x5541C0F0),
+	uint4(0x3C0FFFFF, 0x5583FF80, 0xC7F3FFFF, 0x55C3CFC7), uint4(0x04010040, 0x56000010, 0x2380E070, 0x56C31C8F),
+	uint4(0xFE3F1F87, 0x5703F9FC, 0x00000003, 0x57420000), uint4(0x380E0300, 0x5783C0F0, 0x07C01C04, 0x57C3FEFF),
+	uint4(0xC01FFFFE, 0x58001F01, 0x3E0F83C0, 0x5843F0FC), uint4(0xF8783C1C, 0x5883F9F8, 0xCCF73DCF, 0x58C06F1B),
+	uint4(0xE7F9FE7F, 0x59827F9F, 0xA1E87A1E, 0x59C21E87), uint4(0xBF8FC3C0, 0x5A43FFFF, 0x8060180E, 0x5A800701),
+	uint4(0x20C8320C, 0x5AC20C83, 0x00001C1F, 0x5B400000), uint4(0xFFEFE3F0, 0x5B83FFFF, 0xC0000007, 0x5BC3FFFF),
+	uint4(0xE0100407, 0x5C0383C0, 0xFF8F027F, 0x5C83FFFF), uint4(0x2308C230, 0x5CC2308C, 0xFFFFFFFF, 0x5D800007),
+	uint4(0xE739CE73, 0x5DC2338C, 0x180C0603, 0x5E006030), uint4(0xFE004018, 0x5F039FF7, 0x20000000, 0x5F4180C0),
+	uint4(0x3F0F0E07, 0x60807F7F, 0xEFBBEEF9, 0x60C000FE), uint4(0x3F8FC3E1, 0x6100FC7F, 0x30000000, 0x6143F0F0),
+	uint4(0x00001FFF, 0x6183FFF0, 0x380E0300, 0x61C1C060), uint4(0x3FFFFBF8, 0x62000000, 0x81C0F03C, 0x62401E07),
+	uint4(0xE1F07C3F, 0x628307C3, 0xC00180F0, 0x62C30FE7), uint4(0x08120401, 0x63C04000, 0x000F83FF, 0x64800000),
+	uint4(0x3F8FE3F0, 0x64C3FCFF, 0x07C07005, 0x6503FCFF), uint4(0x10080403, 0x65408060, 0x701C0E03, 0x65C180C0),
+	uint4(0x00000020, 0x66400400, 0x380F03E0, 0x668300E0), uint4(0x0C110C0F, 0x66C1C070, 0x07C1F03C, 0x67007C1F),
+	uint4(0x40301C0F, 0x67C00000, 0x3F0F8380, 0x68807EFE), uint4(0xCDF27CBE, 0x68C06713, 0x3E0F0787, 0x69807C7E),
+	uint4(0x00000003, 0x69C3F8E0, 0xCFF7FFFE, 0x6A003F1F), uint4(0x3F8F8FDF, 0x6A83FEFF, 0xE0F83C1F, 0x6B430783),
+	uint4(0x0FEFFFFF, 0x6B83E70E, 0xF1F07C1F, 0x6C03CFE3), uint4(0xDFF7F9FE, 0x6C41FF7F, 0x2008021F, 0x6D020080),
+	uint4(0x0000080C, 0x6D400000, 0xC3F1F2C0, 0x6D800F07), uint4(0xFDFEFF7F, 0x6DC3E7F3, 0x40201008, 0x6E020000),
+	uint4(0x0000040F, 0x6E400000, 0xFFFFFFFF, 0x6EC07FFF), uint4(0xC7F3FCFF, 0x6F007F1F, 0x0E009C1F, 0x6F43E078),
+	uint4(0x0000FFFF, 0x6F800000, 0xDC7F1FC7, 0x6FC1E779), uint4(0xDFFFFEFF, 0x7042FFBF, 0x000FC000, 0x70800000),
+	uint4(0xDC771DC7, 0x70C1C771, 0xC0F07C3F, 0x71000301), uint4(0xE7FFFFFF, 0x7143E0E1, 0x300C0300, 0x718301C0),
+	uint4(0xFE3F9FE7, 0x71C3E1F8, 0xC3F0F038, 0x72803F0F), uint4(0x00000406, 0x73400000, 0xCFE3F9FE, 0x7380FF3F),
+	uint4(0x07C3F5F9, 0x73C03C1F, 0xDBF2FC7F, 0x74439F67), uint4(0x200FF3FF, 0x75800000, 0x3F0FC3E3, 0x75C3F8FE),
+	uint4(0x00000000, 0x7643C0C0, 0x00303C3F, 0x76800000), uint4(0x0010FFFF, 0x76C20000, 0xC0701C03, 0x77000F03),
+	uint4(0x3F8FEC1C, 0x7783F0FE, 0xC0000000, 0x77C3BFEF), uint4(0x00000C0F, 0x78400000, 0x00001C78, 0x78800000),
+	uint4(0x0F83C1E0, 0x79023E1F, 0xFFF8007F, 0x7983FFFF), uint4(0x87E3FBFE, 0x79C00E07, 0x3C06027F, 0x7A03F8FC),
+	uint4(0xCFFFFFFF, 0x7A421F1F, 0x3E0C0003, 0x7A803F7F), uint4(0xC0301E07, 0x7AC30100, 0xC7F1FC7F, 0x7B003F0F),
+	uint4(0x300C0607, 0x7BC300C0, 0x40303C1F, 0x7C000000), uint4(0xF07C3F9F, 0x7C800281, 0xC0700C03, 0x7CC00701),
+	uint4(0x0E0FE3FE, 0x7D021F00, 0x87E1F87E, 0x7D407E1F), uint4(0xDFF3FC7F, 0x7D83FFFF, 0x300C0380, 0x7DC300C0),
+	uint4(0x00000003, 0x7E03FF00, 0xF1FC3F0F, 0x7E439FC7), uint4(0x3FEFFFFF, 0x7E827F78, 0x38080001, 0x7F03F8F8),
+	uint4(0x3F87E400, 0x7F81F8FE, 0x380E07C3, 0x7FC300E0), uint4(0x00100C07, 0x8043C000, 0x3C0E0187, 0x8143E0F8),
+	uint4(0x01FFFFFF, 0x8183E080, 0x1F0783E1, 0x81C0F83C), uint4(0x00107DFF, 0x82400000, 0x010FFFEF, 0x82C03004),
+	uint4(0x0F0783C1, 0x83003C1E, 0x300C0203, 0x838087E0), uint4(0x7FD7F1FC, 0x83C000FF, 0xBFE7F9FE, 0x8443FEFF),
+	uint4(0x3C0803FF, 0x8483FFFF, 0x22080240, 0x84C21084), uint4(0x07C1F07E, 0x8540701E, 0x3F8FE3F8, 0x8583F0FC),
+	uint4(0x180E0380, 0x85C1C060, 0xC1F3FFFF, 0x86838000), uint4(0xC0040201, 0x86C3FFFF, 0xFFF80000, 0x8783FFFF),
+	uint4(0xC1F0FC7F, 0x87C00703, 0x30080C0E, 0x8843C0E0), uint4(0x3FCFC000, 0x8883C0FC, 0x118C6211, 0x88C08C43),
+	uint4(0xFFF7FDFF, 0x890000FF, 0x380E0787, 0x89800060), uint4(0x00080204, 0x89C10200, 0xCE0F83E0, 0x8A80E709),
+	uint4(0xFFEFF3F9, 0x8B801FFF, 0x3C0F03C0, 0x8BC3E0F8), uint4(0x00000004, 0x8C800000, 0x06018060, 0x8DC04010),
+	uint4(0xFFFFC300, 0x8E4000FF, 0x00000200, 0x8E83FF00), uint4(0x0300C030, 0x8EC0300C, 0x3F0FF3FE, 0x8F03C0F8),
+	uint4(0xE3F0FC3F, 0x8FC21F87, 0x0007FCFF, 0x90820100), uint4(0x3BCEF3BC, 0x90C1BCEF, 0x20080000, 0x910380C0),
+	uint4(0x01C0F03C, 0x91401807, 0xF8FE3F9F, 0x91C38FE3), uint4(0xC0701C0F, 0x92400301, 0xF3F0F87C, 0x92803FEF),
+	uint4(0x0802047B, 0x92C18C21, 0x01802C07, 0x93C21C87), uint4(0x3F0FE3FC, 0x944380F0, 0x1E060000, 0x9481FF7F),
+	uint4(0x5FB7CDF3, 0x94C0FD3E, 0x1C070180, 0x9541F078), uint4(0xFC3E1E0F, 0x9583F9FC, 0xBFEFFBE0, 0x9601FCFF),
+	uint4(0x3E0FF3FF, 0x964000C0, 0xFFFFF3C3, 0x9680FFFF), uint4(0xB0000000, 0x9780001F, 0xBE4FA3E0, 0x97C3E2F9),
+	uint4(0x27F80E00, 0x98020080, 0x20000000, 0x984380C0), uint4(0xC1F3FC00, 0x98820080, 0x0380F03C, 0x98C0100C),
+	uint4(0x00000007, 0x99000000, 0xFFFFFFF1, 0x99800F3F), uint4(0x02010081, 0x99C01000, 0x0000047F, 0x9A000000),
+	uint4(0xFFF7FCFF, 0x9A43FFFF, 0x87E0F83E, 0x9A807E1F), uint4(0x9CEF339C, 0x9AC02F3B, 0xFFFFFBFC, 0x9B4000FF),
+	uint4(0x100F07E2, 0x9B803830, 0xBFFDFF7E, 0x9BC10200), uint4(0xE1F87E1F, 0x9C021F87, 0x0E03C0F0, 0x9C408030),
+	uint4(0xBC6F1BCE, 0x9CC3C6F1, 0x0300C461, 0x9DC01804), uint4(0x010FDFF3, 0x9E40F00C, 0xFFFFFFFF, 0x9E807F7F),
+	uint4(0xF07C1F8F, 0x9F000380, 0x3FFFFFFC, 0x9F800000), uint4(0xC8320C87, 0x9FC04310, 0x7A3E0FC3, 0xA0C3B9EC),
+	uint4(0xC7FFF3F0, 0xA1400000, 0x00001C7F, 0xA1800000), uint4(0xFEFFFFFF, 0xA1C1EEFB, 0x3F0F83D0, 0xA203F4FE),
+	uint4(0xC3F1F8FE, 0xA2420F87, 0x0701C070, 0xA280701C), uint4(0x20080E07, 0xA2C20080, 0x80C06038, 0xA3000201),
+	uint4(0xDF3FCFF7, 0xA3C1F17C, 0x1F87E1F8, 0xA441F87E), uint4(0x9FF7E1C0, 0xA481FC7F, 0x02008020, 0xA4C02008),
+	uint4(0xC78FE3F8, 0xA5403800, 0x0030FDFF, 0xA583FF00), uint4(0x3F0F87E3, 0xA5C0FC7E, 0xFCFE7F3F, 0xA603F7F9),
+	uint4(0x80200802, 0xA6400300, 0x1F0783E0, 0xA680783C), uint4(0x3000037F, 0xA70300C0, 0x40707C7F, 0xA8000804),
+	uint4(0xDCFE7F3F, 0xA840E371, 0x3BFCFC7F, 0xA8801800), uint4(0x781C0603, 0xA8C3C0E0, 0x3E0F87E3, 0xAA43E0F8),
+	uint4(0x179DC7F1, 0xAAC1F85E, 0x3FEFFFFF, 0xAB03FCFF), uint4(0x08040201, 0xAB402010, 0xBF0E0C1F, 0xAB83FFFF),
+	uint4(0x00101C3F, 0xABC00000, 0xEFF7FFFF, 0xAC01CFCF), uint4(0x3F80F1FC, 0xAC83FCFF, 0x00802008, 0xACC00802),
+	uint4(0xE3F8FE1F, 0xAD027F9F, 0xDFE7F9FC, 0xAD43FFFF), uint4(0x000003FF, 0xAD83FF00, 0x46110C43, 0xADC02118),
+	uint4(0xFE7F9FE3, 0xAE03F7FD, 0xBFFFFFFF, 0xAE43F0FF), uint4(0xDFFFFFFF, 0xAEC1FF7F, 0x380C0301, 0xAF0380E0),
+	uint4(0x300E03E0, 0xAF400000, 0x3F080000, 0xAF800000), uint4(0x9FCFC3E0, 0xAFC00F1F, 0x81C0E070, 0xB0400301),
+	uint4(0x00000300, 0xB0800000, 0x27C9F2FC, 0xB0C37CDF), uint4(0xDFF7F3F8, 0xB1C27F3F, 0xC6F0FC3F, 0xB241E739),
+	uint4(0x01806018, 0xB3000C07, 0x1789E279, 0xB3C1385E), uint4(0x3E0F1F9F, 0xB403F8FC, 0xE3F87E1F, 0xB4827F9F),
+	uint4(0xE0783E0F, 0xB4C20381, 0x3FFFDFE3, 0xB5001004), uint4(0x1C0F07C3, 0xB540C070, 0xC3F1FDFF, 0xB5820303),
+	uint4(0x060104C1, 0xB5C0380C, 0xFFFFFFF8, 0xB6807F7F), uint4(0x9EE7B8EE, 0xB6C1FE7B, 0x3F0E0201, 0xB703FFFF),
+	uint4(0x400001FF, 0xB8000300, 0xE6799E67, 0xB8C2E7B9), uint4(0x3F0F0300, 0xB903FFFF, 0xCE7F1FC3, 0xB980070B),
+	uint4(0xFFFFFFC0, 0xBB03FFFF, 0x070180E0, 0xBBC0300C), uint4(0xC0F07C3E, 0xBC400301, 0xCFF001E0, 0xBC80F83F),
+	uint4(0x40201008, 0xBCC00000, 0xFFFFFF87, 0xBD03FFFF), uint4(0x380E0300, 0xBD43C0E0, 0x01FFFFFF, 0xBD800000),
+	uint4(0x0380E038, 0xBE00180E, 0xFC7FBC10, 0xBE8301E0), uint4(0x26118461, 0xBEC26098, 0xBFFFF3FC, 0xBF000600),
+	uint4(0xC1F03BEF, 0xBF803F0F, 0x300E0380, 0xC00200C0), uint4(0x06011C7F, 0xC081F83C, 0x1F0FE3FC, 0xC140C038),
+	uint4(0xCFFDFE7F, 0xC180470F, 0x04010040, 0xC1C04010), uint4(0xE3F3FDFF, 0xC2030787, 0xC7F7FFF9, 0xC283E3C3),
+	uint4(0x3F8FC3E1, 0xC303FCFE, 0xFFF00000, 0xC4807FFF), uint4(0x3FBFE7F8, 0xC5401C01, 0xFFFEFFBE, 0xC5C0071F),
+	uint4(0x380E0780, 0xC68380E0, 0x0FC3F0FC, 0xC6C0FC3F), uint4(0x00000007, 0xC703C000, 0x2030FDFF, 0xC783C0C0),
+	uint4(0xE0781E0F, 0xC7C20781, 0xBFEFFBFE, 0xC8407EFF), uint4(0x004FFFFC, 0xC8807E07, 0xF3FBFDFF, 0xC903E7F7),
+	uint4(0x38080000, 0xC943F8F8, 0xE7FFF7FD, 0xC9C20481), uint4(0xBFCFF3FC, 0xCA007EFF, 0x38080000, 0xCA807878),
+	uint4(0x4C360D86, 0xCAC06018, 0x3FFFF7FD, 0xCB020100), uint4(0x380C0603, 0xCB43E0F0, 0xDFF7FFFF, 0xCB80FF3F),
+	uint4(0x80E0380E, 0xCC400E03, 0x00303C3F, 0xCC820000), uint4(0x88421084, 0xCCC04220, 0x1E0F07C3, 0xCD40F87C),
+	uint4(0xFFFFFBF8, 0xCD83FFFF, 0xCE739DE7, 0xCDC0E739), uint4(0x380C0300, 0xCE43C0E0, 0x3F30383F, 0xCE8200F0),
+	uint4(0xCFF3FDFF, 0xCF00FE3F, 0x3F8FE3F8, 0xCF80F87E), uint4(0x0F07C3E1, 0xCFC2301C, 0x01000020, 0xD0800000),
+	uint4(0x0F83E1F0, 0xD0C0FE3F, 0x06107FC7, 0xD103E078), uint4(0xFF8F870F, 0xD1C3FFFF, 0x87E3F8FE, 0xD2407E1F),
+	uint4(0xEFF0FC0F, 0xD28300C7, 0xF83E1F87, 0xD34381E0), uint4(0x804FFFF9, 0xD3C00E01, 0x60180E03, 0xD4420080),
+	uint4(0xBBEEFBBE, 0xD4C3BEEF, 0x00E0783E, 0xD5000001), uint4(0xCFFFFFFF, 0xD580070F, 0xC7F1FC7F, 0xD600FF3F),
+	uint4(0xC0000000, 0xD78000FF, 0xC0F00FFE, 0xD900FF0F), uint4(0x1F07C1E0, 0xD941FC7E, 0x00001C7F, 0xD983F8E0),
+	uint4(0x98E6398E, 0xD9C18E63, 0x00010000, 0xDA002008), uint4(0xC3F0FC7F, 0xDA431F87, 0x30000403, 0xDA83F0F0),
+	uint4(0xBFFFFFFC, 0xDB0380FF, 0xC3F3F9F8, 0xDB400707), uint4(0x301C0F07, 0xDB800040, 0x0C0300E0, 0xDBC08030),
+	uint4(0x87898300, 0xDC407F1F, 0xC0000200, 0xDCC3FFFF), uint4(0x03C1F8FF, 0xDD83EF04, 0xE739CE73, 0xDDC2779D),
+	uint4(0x1FCFF3FC, 0xDE00FC3F, 0x0000000F, 0xDE83FF00), uint4(0xCF7BCEF3, 0xDEC0F77D, 0x010FFFEF, 0xDF40300C),
+	uint4(0xDE779DE7, 0xDFC1F779, 0xFDFF7FDF, 0xE043EFFB), uint4(0x03EFE3E0, 0xE083C0C0, 0xFE7F9FEF, 0xE0C3E3F8),
+	uint4(0xC3F3FDFF, 0xE1420707, 0x3030FDFF, 0xE183F0F0), uint4(0xBFEFF3FD, 0xE1C0FF7F, 0x30000007, 0xE283F0F0),
+	uint4(0x040F7FC7, 0xE343C070, 0x20180E0F, 0xE3820080), uint4(0x8CE338EF, 0xE3C0CE33, 0x3F8F83CF, 0xE483FEFF),
+	uint4(0xF87E3F8F, 0xE4C3C3F1, 0x06018060, 0xE5802008), uint4(0xDF77F9F8, 0xE5C1F37C, 0x20080201, 0xE6020080),
+	uint4(0xFFFFFBF8, 0xE6407F3F, 0xC4310C47, 0xE6C24390), uint4(0x38080000, 0xE7007030, 0xD8360D83, 0xE7C0C330),
+	uint4(0x00100C03, 0xE8400000, 0x3C0703DF, 0xE883C3F0), uint4(0x81E0781E, 0xE9001E07, 0xCFF3FFFF, 0xE940FF3F),
+	uint4(0x7FCFF3FC, 0xE9800407, 0x30080000, 0xE9C3C0E0), uint4(0x20000003, 0xEA03E0E0, 0xEFF7FBFD, 0xEA43BFDF),
+	uint4(0xFFFFE381, 0xEA80070F, 0xE3FCFF3F, 0xEB421F87), uint4(0xFF8E0400, 0xEB83FFFF, 0x21884021, 0xEBC10C42),
+	uint4(0x7E1F8BE2, 0xEC41E0F8, 0x318C6310, 0xECC39CE6), uint4(0x83F1FCFF, 0xED03C807, 0x00000C1F, 0xED830000),
+	uint4(0xC3D1F47B, 0xEDC03E0F, 0xFFEFF3FC, 0xEE807FFF), uint4(0x5E370DC7, 0xEEC1E078, 0xC1F07C1F, 0xEF000F03),
+	uint4(0xC1C0E070, 0xEF830703, 0xFDFE7F9F, 0xEFC3DEF7), uint4(0x3C0F83E0, 0xF04380E0, 0xC1F3FFFF, 0xF0800000),
+	uint4(0x6FD3F4F9, 0xF0C000BF, 0x3F8FC3E0, 0xF103FFFF), uint4(0x0E0F0381, 0xF183FB04, 0x3F0E0A42, 0xF1C3BFEF),
+	uint4(0x3E0F0783, 0xF201F8FC, 0xFFEFFBFC, 0xF243FFFF), uint4(0x30181C0F, 0xF28380C0, 0x7F9EE7B9, 0xF2C3F9FE),
+	uint4(0xF1F83E0F, 0xF3C33FC7, 0x0F87C3C0, 0xF4003F1F), uint4(0x060380E0, 0xF4406018, 0x46118461, 0xF4C06118),
+	uint4(0x00000000, 0xF5030000, 0xFE10FFFF, 0xF5C3FFFF), uint4(0xBFFFFFFF, 0xF683FCFF, 0x43D23483, 0xF6C3FC3F),
+	uint4(0x81C0F078, 0xF7000F03, 0x07C1F07C, 0xF7407C1F), uint4(0x3FEFFFFF, 0xF84200F8, 0x1FE7FC00, 0xF881E07E),
+	uint4(0x902C0B06, 0xF8C10040, 0xCFF3FDFF, 0xF900FF3F), uint4(0x8783C2C0, 0xF9407F1F, 0xBF8F8301, 0xF9800F3F),
+	uint4(0x7C1F03C0, 0xF9C3C3F0, 0x00000001, 0xFA43FF00), uint4(0xFF080000, 0xFB83FFFF, 0xF07C3F0F, 0xFBC387E0),
+	uint4(0x00002000, 0xFC000000, 0xFFEE0001, 0xFC43FFFF), uint4(0xDFE7C381, 0xFD407F3F, 0x00000203, 0xFD80FF00),
+	uint4(0x85E1F0BC, 0xFDC22F0F, 0x38000200, 0xFE03FFFC), uint4(0xDFF7FFFF, 0xFE41FF7F, 0x0781E078, 0xFE80300C),
+	uint4(0x80C02010, 0xFEC00E03, 0x60381C0F, 0xFF0300C0), uint4(0xC1E3E3F0, 0xFF800000, 0x00C0310E, 0xFFC10883),
+};
+
+#define PARTITION_2_COUNT_10X6 710
+#define PARTITION_2_WORDS_10X6 3
+static const uint4 partition_2_10x6[533] =
+{
+	uint4(0xC1F07C1E, 0x001C0F03, 0x00400000, 0xC0703C0F), uint4(0x000C0301, 0x00800000, 0x1789E673, 0x01F83C1F),
+	uint4(0x00C00000, 0x380C0200, 0x01E0F078, 0x01000000), uint4(0xE0783E1F, 0x080E0381, 0x01400000, 0x46018427),
+	uint4(0x078CE138, 0x01C00000, 0xC1F0FC3F, 0x003C0F07), uint4(0x02000000, 0x3FCFE3F0, 0x0FFFFEFF, 0x02400000),
+	uint4(0x3FCFF3FE, 0x0FE3F8FF, 0x02800000, 0x20C06030), uint4(0x0E030281, 0x02C00000, 0xDFFFFFFF, 0x01FCFF3F),
+	uint4(0x03400000, 0xF87C1F0F, 0x0F83C1F0, 0x03800000), uint4(0xBE0C0000, 0x007FFFFF, 0x03C00000, 0x60180601),
+	uint4(0x08060180, 0x04000000, 0xC7FFFFFF, 0x00000001), uint4(0x04400000, 0x00000007, 0x0003FF00, 0x04800000),
+	uint4(0x1FC7F1FC, 0x07F1FC7F, 0x04C00000, 0x0C0300C0), uint4(0x0300C030, 0x05000000, 0x3C0E0381, 0x0F83E0F0),
+	uint4(0x05400000, 0x3F0F0781, 0x03FBFCFE, 0x05C00000), uint4(0xF0FC3F0F, 0x0C7F1FC7, 0x06000000, 0x3E0F83E7),
+	uint4(0x0F83E0F8, 0x06400000, 0x000003FF, 0x0FFC1F00), uint4(0x06800000, 0x6338CE73, 0x0C6731CC, 0x06C00000),
+	uint4(0x3F0FC3F0, 0x0FC3F0FC, 0x07000000, 0x3F0F83E0), uint4(0x0FE3F8FC, 0x07400000, 0xF7FDFF7F, 0x0CFF3FCF),
+	uint4(0x07800000, 0xBC2F0BC2, 0x0F0BC2F0, 0x07C00000), uint4(0x08020080, 0x02008020, 0x08000000, 0x20000007),
+	uint4(0x0FFFFFFF, 0x08400000, 0x3FFFFC00, 0x00000000), uint4(0x09000000, 0xA1F87E1F, 0x00381E07, 0x09400000),
+	uint4(0xFDFF7FDF, 0x0003FFFF, 0x09C00000, 0xFFF00007), uint4(0x0003FFFF, 0x0A800000, 0x3F8FF3FE, 0x0F03E0FC),
+	uint4(0x0AC00000, 0x3C0F03C0, 0x0F07C0F0, 0x0B000000), uint4(0xC0F0783E, 0x08060381, 0x0B400000, 0xC00FFFFF),
+	uint4(0x0FFFFFFF, 0x0B800000, 0x77CDF27C, 0x0DFF7FDF), uint4(0x0BC00000, 0x01004010, 0x00401004, 0x0C000000),
+	uint4(0x78180C07, 0x0FE3E0F0, 0x0C400000, 0x3E0F0380), uint4(0x0FFFFCFE, 0x0C800000, 0x22098060, 0x0E8320C8),
+	uint4(0x0CC00000, 0xFFFFFDFF, 0x0FFFFFFF, 0x0D000000), uint4(0xBFEFF800, 0x03F9FEFF, 0x0D400000, 0xCFFFFBF9),
+	uint4(0x0FCFCFCF, 0x0D800000, 0x00020001, 0x00800010), uint4(0x0DC00000, 0x20000C0F, 0x0F0380C0, 0x0E000000),
+	uint4(0x0780C3DF, 0x0400FE1F, 0x0E800000, 0x301C0200), uint4(0x0100C060, 0x0EC00000, 0x00000000, 0x0FFC0000),
+	uint4(0x0F000000, 0xC0701C0F, 0x00040100, 0x0F400000), uint4(0xFBFEFC00, 0x08FF3FCF, 0x0F800000, 0xBFCFC3C0),
+	uint4(0x0000010F, 0x0FC00000, 0x00000404, 0x00000000), uint4(0x10400000, 0xE1F83E0F, 0x0C7F1F87, 0x10800000),
+	uint4(0x0781E078, 0x01E0781E, 0x10C00000, 0xE0F83E1F), uint4(0x0C1F0783, 0x11000000, 0xC3F3FDFF, 0x000C0707),
+	uint4(0x11400000, 0x00303838, 0x00000000, 0x11800000), uint4(0xBBECFA7E, 0x0F3BDEE7, 0x11C00000, 0xC3F1FCFF),
+	uint4(0x001C0F07, 0x12000000, 0x1FE7FDFC, 0x0781F07E), uint4(0x12400000, 0x80402000, 0x00000100, 0x12800000),
+	uint4(0x07030180, 0x00180C0E, 0x12C00000, 0xBFCFF3F8), uint4(0x0C020007, 0x13000000, 0x0F03C0F8, 0x0300E038),
+	uint4(0x13400000, 0xFFF00000, 0x0FFFFFFF, 0x13800000), uint4(0x3F8FA3E8, 0x0FC3F0FC, 0x13C00000, 0xBDEF7BDE),
+	uint4(0x0E7B9EF7, 0x14C00000, 0x40100401, 0x00040100), uint4(0x15000000, 0xDFF7FDFF, 0x07FDFF7F, 0x15400000),
+	uint4(0xC3F0F87E, 0x007C1F0F, 0x15800000, 0x084210C4), uint4(0x00000020, 0x15C00000, 0xF03C1F87, 0x00060180),
+	uint4(0x16000000, 0x2008067F, 0x0C0700C0, 0x16400000), uint4(0xE7FFFD80, 0x007C3F0F, 0x16800000, 0xC3F0FC7F),
+	uint4(0x003C1F07, 0x16C00000, 0x3FEFFC00, 0x000200F8), uint4(0x17800000, 0x004FEFF9, 0x00781E03, 0x17C00000),
+	uint4(0xCFF3FDFF, 0x09FEFFBF, 0x18400000, 0xC3F1F9FC), uint4(0x00040303, 0x18800000, 0x21C8721C, 0x00601C87),
+	uint4(0x18C00000, 0x1F81C007, 0x0FFFFEFF, 0x19000000), uint4(0xC1F33DC7, 0x030C4707, 0x19400000, 0x01806018),
+	uint4(0x00601806, 0x19C00000, 0xC0703C1F, 0x08000100), uint4(0x1AC00000, 0xF1F0FC7F, 0x0F8FC7E3, 0x1B000000),
+	uint4(0x7C1F0F87, 0x0F03C0F0, 0x1B400000, 0x3F07C013), uint4(0x003CF0FC, 0x1B800000, 0x00000403, 0x00000000),
+	uint4(0x1C000000, 0x300C0300, 0x0C0700C0, 0x1C400000), uint4(0xCFF7FFFF, 0x003C1F0F, 0x1C800000, 0x9FC7E1FC),
+	uint4(0x038DF27C, 0x1CC00000, 0xF03C0700, 0x0C7F0FC1), uint4(0x1D000000, 0x380C0603, 0x0180C060, 0x1DC00000),
+	uint4(0xC3F8FC3F, 0x00F83809, 0x1E400000, 0xFC7FBC10), uint4(0x080F03E1, 0x1E800000, 0xF9FE7F9F, 0x0E7F9FE7),
+	uint4(0x1EC00000, 0x000FFFFF, 0x0C000000, 0x1F000000), uint4(0x00001C1F, 0x0E020000, 0x1F400000, 0xF8FC7E1F),
+	uint4(0x0FBFCFF3, 0x20000000, 0xC1F07C1F, 0x0C3E0F03), uint4(0x20400000, 0x0C080003, 0x00040404, 0x20800000),
+	uint4(0x3E0784E3, 0x0F83E0F8, 0x20C00000, 0x3FFFFFFF), uint4(0x00000000, 0x21000000, 0xC1C0403F, 0x0F9F8F83),
+	uint4(0x21800000, 0x008002FF, 0x08E21886, 0x21C00000), uint4(0x00000000, 0x0FFFFF00, 0x22000000, 0x3C0F0380),
+	uint4(0x0FC3F0F8, 0x22400000, 0x00101479, 0x0F038080), uint4(0x22800000, 0x3C8C300E, 0x0F3FEEFC, 0x22C00000),
+	uint4(0x20100C07, 0x0381C0E0, 0x23800000, 0xE1F07C1F), uint4(0x087E1F87, 0x23C00000, 0x03038180, 0x000C0607),
+	uint4(0x24000000, 0xC7F1FC7F, 0x01FC7F1F, 0x24400000), uint4(0xFFCF8300, 0x0000003F, 0x24800000, 0xF9FCFE7F),
+	uint4(0x03FFEFF7, 0x24C00000, 0xC0F07C3F, 0x000C0701), uint4(0x25000000, 0x20000000, 0x0FC3C0E0, 0x25400000),
+	uint4(0xFFFFFC00, 0x007FFFFF, 0x25800000, 0x3B2E8BC2), uint4(0x0E7FBEEF, 0x25C00000, 0x3E0FC3F0, 0x0F03E0F8),
+	uint4(0x26400000, 0x380C0300, 0x0F83C0F0, 0x26800000), uint4(0x3E0F83E0, 0x0F83E0F8, 0x26C00000, 0x3C0F83F0),
+	uint4(0x080300E0, 0x27000000, 0x9FE7F8FE, 0x0FFBFEFF), uint4(0x27400000, 0x3E0F87EE, 0x0383E0F8, 0x27800000),
+	uint4(0xFC3C1C07, 0x0FFBF9F8, 0x27C00000, 0x100DFF3F), uint4(0x0C0300C0, 0x29400000, 0xC7E1F0F8, 0x0E7F1F8F),
+	uint4(0x29C00000, 0x7F9FCFE7, 0x0FF3FCFE, 0x2A000000), uint4(0x000FEFF9, 0x00E01802, 0x2A400000, 0x878F0300),
+	uint4(0x00000000, 0x2A800000, 0x20000C1F, 0x0C030080), uint4(0x2AC00000, 0x7F700060, 0x0FE3F8FC, 0x2B000000),
+	uint4(0x0381C0E0, 0x0C1E0F07, 0x2B800000, 0x000FFFEF), uint4(0x01846008, 0x2BC00000, 0x40200804, 0x08020180),
+	uint4(0x2C400000, 0x000FFBFF, 0x00000000, 0x2C800000), uint4(0x00000001, 0x0F030000, 0x2D400000, 0x80C0300C),
+	uint4(0x083A0E83, 0x2DC00000, 0xF0FC3E0F, 0x033D8FE3), uint4(0x2E000000, 0xDFF7FCFF, 0x0FFFFFFF, 0x2E400000),
+	uint4(0xFFFFFFFF, 0x03FDFFFF, 0x2F000000, 0x3FFFFFFF), uint4(0x0FF80000, 0x2F800000, 0x0380F03C, 0x00C0300E),
+	uint4(0x2FC00000, 0x0E0380C0, 0x0380E038, 0x30400000), uint4(0xFFEFF3F8, 0x003CFFFF, 0x30800000, 0x799E6799),
+	uint4(0x0EE7B9EE, 0x30C00000, 0xC3E0F83E, 0x00FC3F0F), uint4(0x31000000, 0xBFFFFFFF, 0x0F83F8FF, 0x31800000),
+	uint4(0xD9EC721D, 0x031CCF63, 0x31C00000, 0xCFF3FDFF), uint4(0x00FC3F1F, 0x32000000, 0xFDF00010, 0x0E7F9FF7),
+	uint4(0x32C00000, 0x60180E07, 0x08020080, 0x33000000), uint4(0x0000000F, 0x03FC0000, 0x33800000, 0xC7F0FC1F),
+	uint4(0x0000007F, 0x33C00000, 0x40100C07, 0x0E020000), uint4(0x34000000, 0x3F8FE3F8, 0x0FE3F8FE, 0x34400000),
+	uint4(0x9FF7FFFF, 0x01E0FC3F, 0x34800000, 0xB8CE3308), uint4(0x0FBFCEF3, 0x34C00000, 0x00000000, 0x08000000),
+	uint4(0x35000000, 0x380C0606, 0x0FC3E0F0, 0x35400000), uint4(0xCFF7E3C0, 0x007F9F0F, 0x35800000, 0x18C67198),
+	uint4(0x0731CC63, 0x35C00000, 0x40100802, 0x00000100), uint4(0x36000000, 0xC0703C1F, 0x00040300, 0x36400000),
+	uint4(0xFF8E0000, 0x080000FF, 0x36800000, 0x10040100), uint4(0x04010040, 0x36C00000, 0x000C03C0, 0x0FFFF8C0),
+	uint4(0x37000000, 0x300C0300, 0x0C0300C0, 0x37400000), uint4(0xF9FC7F3F, 0x0F8FC7E3, 0x37800000, 0xC0703C1F),
+	uint4(0x00040301, 0x37C00000, 0x3F0F83C3, 0x0FFBFCFE), uint4(0x38400000, 0x3F8F83C0, 0x0FFFFFFF, 0x38800000),
+	uint4(0xC0301806, 0x00040100, 0x38C00000, 0x180E0703), uint4(0x0180E070, 0x39400000, 0x180C0001, 0x00303018),
+	uint4(0x39800000, 0x3FFFEFF3, 0x00040100, 0x39C00000), uint4(0xDFF00C01, 0x0FFFFFFF, 0x3A000000, 0x3E0F07A1),
+	uint4(0x0331C87C, 0x3AC00000, 0x0100C030, 0x000C1104), uint4(0x3B000000, 0x00000003, 0x00000000, 0x3B400000),
+	uint4(0x3FCFF3FC, 0x0FF3FCFF, 0x3B800000, 0xC1F07C1F), uint4(0x087E1F07, 0x3BC00000, 0xE0F81E03, 0x09FE3F87),
+	uint4(0x3C000000, 0xC1F07C1F, 0x0E3E0F03, 0x3D400000), uint4(0x000003FF, 0x00000000, 0x3D800000, 0xBFCFC3E1),
+	uint4(0x003C7FFF, 0x3DC00000, 0xF8FC3F0F, 0x0F3FCFE3), uint4(0x3E000000, 0xE7F9FF7F, 0x01F87E1F, 0x3E400000),
+	uint4(0xE0F00C06, 0x0803FF9F, 0x3E800000, 0xC1F00001), uint4(0x0FFFFFFF, 0x3F000000, 0xDFF7F1F0, 0x07FDFF7F),
+	uint4(0x3F400000, 0x001078F0, 0x00000000, 0x3F800000), uint4(0x43C0F07C, 0x04351D47, 0x3FC00000, 0x0040100C),
+	uint4(0x0FF7FD00, 0x40400000, 0xFE7C3C1F, 0x00000006), uint4(0x40800000, 0x380C0E0F, 0x0FC3E0F0, 0x41000000),
+	uint4(0x300E03C0, 0x00000080, 0x41400000, 0x07C1FC7E), uint4(0x00FF3088, 0x41800000, 0x0F03C0F0, 0x03C0F03C),
+	uint4(0x41C00000, 0x380803FF, 0x0FF3F0F8, 0x42000000), uint4(0x000FFDFF, 0x0C020080, 0x42400000, 0x80601806),
+	uint4(0x00180601, 0x42800000, 0x00010040, 0x00802008), uint4(0x42C00000, 0x3800040F, 0x0FFFFEFC, 0x43800000),
+	uint4(0xFC7F1FC6, 0x070DC3F1, 0x43C00000, 0x000FFFFF), uint4(0x0FFFFF00, 0x44000000, 0x1E07C1F8, 0x0601C078),
+	uint4(0x44400000, 0x3C0F03C0, 0x0F03C0F0, 0x44800000), uint4(0xC0300400, 0x007C0F01, 0x44C00000, 0x300C0360),
+	uint4(0x01804000, 0x45400000, 0xC1F07B30, 0x0FA31F07), uint4(0x45800000, 0xC1E0781C, 0x0C1E0F83, 0x45C00000),
+	uint4(0x1F87E1FC, 0x07E1F87E, 0x46400000, 0x0E0381E0), uint4(0x0380E038, 0x46800000, 0xFFEFF3F8, 0x0FFFFFFF),
+	uint4(0x46C00000, 0xCFFFFFFE, 0x003C1F1F, 0x47000000), uint4(0x3E0FC3F0, 0x0F03C0F8, 0x47800000, 0x180E0300),
+	uint4(0x0180C030, 0x47C00000, 0x3E0F83C0, 0x0FC3F0F8), uint4(0x48400000, 0xA7C9F0F9, 0x0E7F1ECF, 0x48C00000),
+	uint4(0x0701C0F0, 0x0040300C, 0x49000000, 0x3C0FC3FC), uint4(0x03FC00C0, 0x49400000, 0x00000001, 0x00000000),
+	uint4(0x49800000, 0xE1F0BC7F, 0x0C1F0781, 0x49C00000), uint4(0xCFFFFFFF, 0x083C1F1F, 0x4A000000, 0x000007FF),
+	uint4(0x0C020080, 0x4A800000, 0x9C6E1B86, 0x070DC771), uint4(0x4AC00000, 0x30080200, 0x0F0380E0, 0x4B000000),
+	uint4(0x2000040F, 0x01FFF8F0, 0x4B800000, 0x200F03FC), uint4(0x00000000, 0x4BC00000, 0xC3FEFFBF, 0x03004011),
+	uint4(0x4C000000, 0xDFEFFBFD, 0x007C7F3F, 0x4C400000), uint4(0x030C83C0, 0x007C1F0F, 0x4C800000, 0xDFE7F9FC),
+	uint4(0x0000007F, 0x4CC00000, 0xCFFFFC00, 0x0C3E1F9F), uint4(0x4D400000, 0x00000000, 0x08020000, 0x4D800000),
+	uint4(0xBFF00000, 0x0F03F0FF, 0x4E800000, 0x3E0F83F0), uint4(0x0F03C0F8, 0x4F000000, 0x380C0201, 0x0F83C0E0),
+	uint4(0x4F400000, 0xCFF0FC1F, 0x0FFFFF7F, 0x4F800000), uint4(0xE6318C62, 0x08CE2388, 0x4FC00000, 0x40100C0F),
+	uint4(0x0C020000, 0x50C00000, 0x40707C7F, 0x00000000), uint4(0x51000000, 0x20000403, 0x030180C0, 0x51400000),
+	uint4(0x01FFFF80, 0x00000000, 0x51800000, 0x2789E27C), uint4(0x08F27C9E, 0x51C00000, 0xFF7F9FEF, 0x0FE7F1FC),
+	uint4(0x52400000, 0xE0703C1F, 0x0F0381C0, 0x52800000), uint4(0xE1F07C1F, 0x0C3F0F83, 0x53000000, 0x3048120C),
+	uint4(0x0C1B04C1, 0x53C00000, 0xE1F07C1E, 0x0F1F8FC3), uint4(0x54400000, 0xC0703C1F, 0x000C0301, 0x54800000),
+	uint4(0x060184C1, 0x0862300C, 0x54C00000, 0x781E0F03), uint4(0x0781C0F0, 0x55400000, 0x3C0FFFFF, 0x0FFFFF80),
+	uint4(0x55800000, 0xC7F3FFFF, 0x078FCFC7, 0x55C00000), uint4(0x04010040, 0x00000010, 0x56000000, 0x2380E070),
+	uint4(0x0C7B1C8F, 0x56C00000, 0xFE3F1F87, 0x0FF7F9FC), uint4(0x57000000, 0x00000003, 0x0E020000, 0x57400000),
+	uint4(0x380E0300, 0x0783C0F0, 0x57800000, 0x07C01C04), uint4(0x0FFBFEFF, 0x57C00000, 0xC01FFFFE, 0x00FC1F01),
+	uint4(0x58000000, 0x3E0F83C0, 0x0FE3F0FC, 0x58400000), uint4(0xF8783C1C, 0x003BF9F8, 0x58800000, 0xCCF73DCF),
+	uint4(0x00BC6F1B, 0x58C00000, 0xE7F9FE7F, 0x09FE7F9F), uint4(0x59800000, 0xA1E87A1E, 0x087A1E87, 0x59C00000),
+	uint4(0xBF8FC3C0, 0x0FFFFFFF, 0x5A400000, 0x8060180E), uint4(0x001C0701, 0x5A800000, 0x20C8320C, 0x08320C83),
+	uint4(0x5AC00000, 0x00001C1F, 0x00000000, 0x5B400000), uint4(0xFFEFE3F0, 0x0FFFFFFF, 0x5B800000, 0xC0000007),
+	uint4(0x0FFFFFFF, 0x5BC00000, 0xE0100407, 0x0E0F83C0), uint4(0x5C000000, 0xFF8F027F, 0x0003FFFF, 0x5C800000),
+	uint4(0x2308C230, 0x08C2308C, 0x5CC00000, 0x00000003), uint4(0x0FFC0000, 0x5D400000, 0xFFFFFFFF, 0x00000007),
+	uint4(0x5D800000, 0xE739CE73, 0x08CE338C, 0x5DC00000), uint4(0x180C0603, 0x00C06030, 0x5E000000, 0xFE004018),
+	uint4(0x0C3F9FF7, 0x5F000000, 0x20000000, 0x030180C0), uint4(0x5F400000, 0x3F0F0E07, 0x0CFC7F7F, 0x60800000),
+	uint4(0xEFBBEEF9, 0x001000FE, 0x60C00000, 0x3F8FC3E1), uint4(0x01F8FC7F, 0x61000000, 0x30000000, 0x0FF3F0F0),
+	uint4(0x61400000, 0x00001FFF, 0x0FFFFFF0, 0x61800000), uint4(0x380E0300, 0x0701C060, 0x61C00000, 0x3FFFFBF8),
+	uint4(0x00000000, 0x62000000, 0x81C0F03C, 0x00781E07), uint4(0x62400000, 0xE1F07C3F, 0x0E0F07C3, 0x62800000),
+	uint4(0xC00180F0, 0x081F0FE7, 0x62C00000, 0x08120401), uint4(0x01004000, 0x63C00000, 0x000F83FF, 0x00000000),
+	uint4(0x64800000, 0x3F8FE3F0, 0x0FFBFCFF, 0x64C00000), uint4(0x07C07005, 0x0FF3FCFF, 0x65000000, 0x10080403),
+	uint4(0x01008060, 0x65400000, 0x701C0E03, 0x060180C0), uint4(0x65C00000, 0x00000020, 0x00000400, 0x66400000),
+	uint4(0x380F03E0, 0x080300E0, 0x66800000, 0x0C110C0F), uint4(0x0F05C070, 0x66C00000, 0x07C1F03C, 0x01F07C1F),
+	uint4(0x67000000, 0x000FFFFF, 0x0FFC0000, 0x67800000), uint4(0x40301C0F, 0x00000000, 0x67C00000, 0x3F0F8380),
+	uint4(0x003C7EFE, 0x68800000, 0xCDF27CBE, 0x018C6713), uint4(0x68C00000, 0x3E0F0787, 0x00F87C7E, 0x69800000),
+	uint4(0x00000003, 0x0FFFF8E0, 0x69C00000, 0xCFF7FFFE), uint4(0x007C3F1F, 0x6A000000, 0x3F8F8FDF, 0x0FFFFEFF),
+	uint4(0x6A800000, 0xE0F83C1F, 0x0C1F0783, 0x6B400000), uint4(0x0FEFFFFF, 0x0E07E70E, 0x6B800000, 0xF1F07C1F),
+	uint4(0x0FBFCFE3, 0x6C000000, 0xDFF7F9FE, 0x07FDFF7F), uint4(0x6C400000, 0x2008021F, 0x08020080, 0x6D000000),
+	uint4(0x0000080C, 0x00000000, 0x6D400000, 0xC3F1F2C0), uint4(0x0F1C0F07, 0x6D800000, 0xFDFEFF7F, 0x0FCFE7F3),
+	uint4(0x6DC00000, 0x40201008, 0x04020000, 0x6E000000), uint4(0x0000040F, 0x00000000, 0x6E400000, 0xFFFFFFFF),
+	uint4(0x003C7FFF, 0x6EC00000, 0xC7F3FCFF, 0x01FC7F1F), uint4(0x6F000000, 0x0E009C1F, 0x0F83E078, 0x6F400000),
+	uint4(0x0000FFFF, 0x00000000, 0x6F800000, 0xDC7F1FC7), uint4(0x078DE779, 0x6FC00000, 0xDFFFFEFF, 0x09FEFFBF),
+	uint4(0x70400000, 0x000FC000, 0x00000000, 0x70800000), uint4(0xDC771DC7, 0x071DC771, 0x70C00000, 0xC0F07C3F),
+	uint4(0x00040301, 0x71000000, 0xE7FFFFFF, 0x0FE3E0E1), uint4(0x71400000, 0x300C0300, 0x0C0701C0, 0x71800000),
+	uint4(0xFE3F9FE7, 0x0F87E1F8, 0x71C00000, 0xC3F0F038), uint4(0x00FC3F0F, 0x72800000, 0x00000406, 0x00000000),
+	uint4(0x73400000, 0xCFE3F9FE, 0x03FCFF3F, 0x73800000), uint4(0x07C3F5F9, 0x08F83C1F, 0x73C00000, 0xDBF2FC7F),
+	uint4(0x0E3F9F67, 0x74400000, 0x200FF3FF, 0x00000000), uint4(0x75800000, 0x3F0FC3E3, 0x0FF3F8FE, 0x75C00000),
+	uint4(0x00000000, 0x0FC3C0C0, 0x76400000, 0x00303C3F), uint4(0x0FFC0000, 0x76800000, 0x0010FFFF, 0x08020000),
+	uint4(0x76C00000, 0xC0701C03, 0x007C0F03, 0x77000000), uint4(0x3F8FEC1C, 0x0FC3F0FE, 0x77800000, 0xC0000000),
+	uint4(0x0CFFBFEF, 0x77C00000, 0x000003FF, 0x0FFC0000), uint4(0x78000000, 0x00000C0F, 0x00000000, 0x78400000),
+	uint4(0x00001C78, 0x0FFC0000, 0x78800000, 0x0F83C1E0), uint4(0x08FE3E1F, 0x79000000, 0xFFF8007F, 0x0FFFFFFF),
+	uint4(0x79800000, 0x87E3FBFE, 0x00080E07, 0x79C00000), uint4(0x3C06027F, 0x0FFBF8FC, 0x7A000000, 0xCFFFFFFF),
+	uint4(0x0E3E1F1F, 0x7A400000, 0x3E0C0003, 0x001C3F7F), uint4(0x7A800000, 0xC0301E07, 0x0F070100, 0x7AC00000),
+	uint4(0xC7F1FC7F, 0x00FC3F0F, 0x7B000000, 0x300C0607), uint4(0x0C0700C0, 0x7BC00000, 0x40303C1F, 0x00000000),
+	uint4(0x7C000000, 0xF07C3F9F, 0x0FFC0281, 0x7C800000), uint4(0xC0700C03, 0x001C0701, 0x7CC00000, 0x0E0FE3FE),
+	uint4(0x003E1F00, 0x7D000000, 0x87E1F87E, 0x01F87E1F), uint4(0x7D400000, 0xDFF3FC7F, 0x0FFFFFFF, 0x7D800000),
+	uint4(0x300C0380, 0x080300C0, 0x7DC00000, 0x00000003), uint4(0x0FFFFF00, 0x7E000000, 0xF1FC3F0F, 0x0EFF9FC7),
+	uint4(0x7E400000, 0x3FEFFFFF, 0x007E7F78, 0x7E800000), uint4(0x38080001, 0x0FFBF8F8, 0x7F000000, 0xC7F1FCFF),
+	uint4(0x007C3F0F, 0x7F400000, 0x3F87E400, 0x01E1F8FE), uint4(0x7F800000, 0x380E07C3, 0x0C0300E0, 0x7FC00000),
+	uint4(0x00100C07, 0x0FF3C000, 0x80400000, 0x3FFFFFFF), uint4(0x08000000, 0x81000000, 0x3C0E0187, 0x0FC3E0F8),
+	uint4(0x81400000, 0x01FFFFFF, 0x07FBE080, 0x81800000), uint4(0x1F0783E1, 0x01F0F83C, 0x81C00000, 0x00107DFF),
+	uint4(0x00000000, 0x82400000, 0x010FFFEF, 0x00C03004), uint4(0x82C00000, 0x0F0783C1, 0x00783C1E, 0x83000000),
+	uint4(0x300C0203, 0x0F3C87E0, 0x83800000, 0x7FD7F1FC), uint4(0x000000FF, 0x83C00000, 0xBFE7F9FE, 0x0FFFFEFF),
+	uint4(0x84400000, 0x3C0803FF, 0x0003FFFF, 0x84800000), uint4(0x22080240, 0x08221084, 0x84C00000, 0x07C1F07E),
+	uint4(0x01C0701E, 0x85400000, 0x3F8FE3F8, 0x0FC3F0FC), uint4(0x85800000, 0x180E0380, 0x0701C060, 0x85C00000),
+	uint4(0xC1F3FFFF, 0x0FFB8000, 0x86800000, 0xC0040201), uint4(0x0F7FFFFF, 0x86C00000, 0xFFF80000, 0x0003FFFF),
+	uint4(0x87800000, 0xC1F0FC7F, 0x000C0703, 0x87C00000), uint4(0x30080C0E, 0x0F83C0E0, 0x88400000, 0x3FCFC000),
+	uint4(0x0803C0FC, 0x88800000, 0x118C6211, 0x02188C43), uint4(0x88C00000, 0xFFF7FDFF, 0x080000FF, 0x89000000),
+	uint4(0x200F03FC, 0x0FC00000, 0x89400000, 0x380E0787), uint4(0x0EFC0060, 0x89800000, 0x00080204, 0x04090200),
+	uint4(0x89C00000, 0x300F03E0, 0x0FFC0080, 0x8A400000), uint4(0xCE0F83E0, 0x0F84E709, 0x8A800000, 0xFFEFF3F9),
+	uint4(0x00001FFF, 0x8B800000, 0x3C0F03C0, 0x0783E0F8), uint4(0x8BC00000, 0x00000004, 0x00000000, 0x8C800000),
+	uint4(0x06018060, 0x01004010, 0x8DC00000, 0xFFFFC300), uint4(0x000000FF, 0x8E400000, 0x00000200, 0x0FFFFF00),
+	uint4(0x8E800000, 0x0300C030, 0x00C0300C, 0x8EC00000), uint4(0x3F0FF3FE, 0x0C03C0F8, 0x8F000000, 0xE3F0FC3F),
+	uint4(0x0C3E1F87, 0x8FC00000, 0x0007FCFF, 0x080E0100), uint4(0x90800000, 0x3BCEF3BC, 0x06F1BCEF, 0x90C00000),
+	uint4(0x20080000, 0x0F0380C0, 0x91000000, 0x01C0F03C), uint4(0x00601807, 0x91400000, 0xF8FE3F9F, 0x0F3F8FE3),
+	uint4(0x91C00000, 0xC0701C0F, 0x080C0301, 0x92400000), uint4(0xF3F0F87C, 0x00403FEF, 0x92800000, 0x0802047B),
+	uint4(0x06318C21, 0x92C00000, 0xBFCFE3F0, 0x03FFFFFF), uint4(0x93800000, 0x01802C07, 0x087A1C87, 0x93C00000),
+	uint4(0x3F0FE3FC, 0x0C0380F0, 0x94400000, 0x1E060000), uint4(0x03FDFF7F, 0x94800000, 0x5FB7CDF3, 0x03F4FD3E),
+	uint4(0x94C00000, 0xFFCFC3C0, 0x0FFFFFFF, 0x95000000), uint4(0x1C070180, 0x07C1F078, 0x95400000, 0xFC3E1E0F),
+	uint4(0x07F3F9FC, 0x95800000, 0xBFEFFBE0, 0x03F1FCFF), uint4(0x96000000, 0x3E0FF3FF, 0x000000C0, 0x96400000),
+	uint4(0xFFFFF3C3, 0x0C3CFFFF, 0x96800000, 0xB0000000), uint4(0x0000001F, 0x97800000, 0xBE4FA3E0, 0x0F8FE2F9),
+	uint4(0x97C00000, 0x27F80E00, 0x08020080, 0x98000000), uint4(0x20000000, 0x0F0380C0, 0x98400000, 0xC1F3FC00),
+	uint4(0x0C020080, 0x98800000, 0x0380F03C, 0x0000100C), uint4(0x98C00000, 0x00000007, 0x00000000, 0x99000000),
+	uint4(0xFFFFFFF1, 0x0C000F3F, 0x99800000, 0x02010081), uint4(0x00201000, 0x99C00000, 0x0000047F, 0x0FFC0000),
+	uint4(0x9A000000, 0xFFF7FCFF, 0x0FFFFFFF, 0x9A400000), uint4(0x87E0F83E, 0x01F87E1F, 0x9A800000, 0x9CEF339C),
+	uint4(0x087C2F3B, 0x9AC00000, 0xFFFFFBFC, 0x000000FF), uint4(0x9B400000, 0x100F07E2, 0x007C3830, 0x9B800000),
+	uint4(0xBFFDFF7E, 0x04190200, 0x9BC00000, 0xE1F87E1F), uint4(0x087E1F87, 0x9C000000, 0x0E03C0F0, 0x00008030),
+	uint4(0x9C400000, 0xBC6F1BCE, 0x0F1BC6F1, 0x9CC00000), uint4(0x0300C461, 0x08201804, 0x9DC00000, 0x010FDFF3),
+	uint4(0x07C0F00C, 0x9E400000, 0xFFFFFFFF, 0x018C7F7F), uint4(0x9E800000, 0xF07C1F8F, 0x00040380, 0x9F000000),
+	uint4(0x3FFFFFFC, 0x000C0000, 0x9F800000, 0xC8320C87), uint4(0x010C4310, 0x9FC00000, 0x7A3E0FC3, 0x0C67B9EC),
+	uint4(0xA0C00000, 0xC7FFF3F0, 0x00000000, 0xA1400000), uint4(0x00001C7F, 0x00000000, 0xA1800000, 0xFEFFFFFF),
+	uint4(0x07B9EEFB, 0xA1C00000, 0x3F0F83D0, 0x0FFBF4FE), uint4(0xA2000000, 0xC3F1F8FE, 0x081E0F87, 0xA2400000),
+	uint4(0x0701C070, 0x01C0701C, 0xA2800000, 0x20080E07), uint4(0x08020080, 0xA2C00000, 0x80C06038, 0x00040201),
+	uint4(0xA3000000, 0xDF3FCFF7, 0x03C5F17C, 0xA3C00000), uint4(0x1F87E1F8, 0x07E1F87E, 0xA4400000, 0x9FF7E1C0),
+	uint4(0x07C1FC7F, 0xA4800000, 0x02008020, 0x00802008), uint4(0xA4C00000, 0xC78FE3F8, 0x0FE03800, 0xA5400000),
+	uint4(0x0030FDFF, 0x0FFFFF00, 0xA5800000, 0x3F0F87E3), uint4(0x01F0FC7E, 0xA5C00000, 0xFCFE7F3F, 0x0FEFF7F9),
+	uint4(0xA6000000, 0x80200802, 0x080C0300, 0xA6400000), uint4(0x1F0783E0, 0x01E0783C, 0xA6800000, 0x3000037F),
+	uint4(0x0C0300C0, 0xA7000000, 0xFFFFFFFF, 0x0FFC00FF), uint4(0xA7800000, 0x40707C7F, 0x00300804, 0xA8000000),
+	uint4(0xDCFE7F3F, 0x03C4E371, 0xA8400000, 0x3BFCFC7F), uint4(0x00301800, 0xA8800000, 0x781C0603, 0x0E03C0E0),
+	uint4(0xA8C00000, 0x3E0F87E3, 0x0FC3E0F8, 0xAA400000), uint4(0x179DC7F1, 0x06F1F85E, 0xAAC00000, 0x3FEFFFFF),
+	uint4(0x0FE3FCFF, 0xAB000000, 0x08040201, 0x00402010), uint4(0xAB400000, 0xBF0E0C1F, 0x0FFFFFFF, 0xAB800000),
+	uint4(0x00101C3F, 0x08000000, 0xABC00000, 0xEFF7FFFF), uint4(0x039DCFCF, 0xAC000000, 0x3F80F1FC, 0x0FF3FCFF),
+	uint4(0xAC800000, 0x00802008, 0x00200802, 0xACC00000), uint4(0xE3F8FE1F, 0x0BFE7F9F, 0xAD000000, 0xDFE7F9FC),
+	uint4(0x03FFFFFF, 0xAD400000, 0x000003FF, 0x0003FF00), uint4(0xAD800000, 0x46110C43, 0x00842118, 0xADC00000),
+	uint4(0xFE7F9FE3, 0x0FDFF7FD, 0xAE000000, 0xBFFFFFFF), uint4(0x0E03F0FF, 0xAE400000, 0xDFFFFFFF, 0x07FDFF7F),
+	uint4(0xAEC00000, 0x380C0301, 0x0F0780E0, 0xAF000000), uint4(0x300E03E0, 0x00000000, 0xAF400000, 0x3F080000),
+	uint4(0x00000000, 0xAF800000, 0x9FCFC3E0, 0x000C0F1F), uint4(0xAFC00000, 0x81C0E070, 0x00040301, 0xB0400000),
+	uint4(0x00000300, 0x00000000, 0xB0800000, 0x27C9F2FC), uint4(0x0CF37CDF, 0xB0C00000, 0x00000001, 0x0C000000),
+	uint4(0xB1400000, 0xDFF7F3F8, 0x0DFE7F3F, 0xB1C00000), uint4(0xC6F0FC3F, 0x0F8DE739, 0xB2400000, 0xC0000000),
+	uint4(0x0C03FFFF, 0xB2800000, 0x01806018, 0x00300C07), uint4(0xB3000000, 0x1789E279, 0x04E1385E, 0xB3C00000),
+	uint4(0x3E0F1F9F, 0x0FF3F8FC, 0xB4000000, 0xE3F87E1F), uint4(0x0BFE7F9F, 0xB4800000, 0xE0783E0F, 0x080E0381),
+	uint4(0xB4C00000, 0x3FFFDFE3, 0x00C01004, 0xB5000000), uint4(0x1C0F07C3, 0x0100C070, 0xB5400000, 0xC3F1FDFF),
+	uint4(0x0E060303, 0xB5800000, 0x060104C1, 0x0060380C), uint4(0xB5C00000, 0xFFFFFFF8, 0x00007F7F, 0xB6800000),
+	uint4(0x9EE7B8EE, 0x07F9FE7B, 0xB6C00000, 0x3F0E0201), uint4(0x0FFFFFFF, 0xB7000000, 0x400001FF, 0x003C0300),
+	uint4(0xB8000000, 0xE6799E67, 0x0B9EE7B9, 0xB8C00000), uint4(0x3F0F0300, 0x0FFFFFFF, 0xB9000000, 0xCE7F1FC3),
+	uint4(0x0044070B, 0xB9800000, 0xFFFFFFC0, 0x0FFFFFFF), uint4(0xBB000000, 0x070180E0, 0x0060300C, 0xBBC00000),
+	uint4(0xC0F07C3E, 0x00040301, 0xBC400000, 0xCFF001E0), uint4(0x0380F83F, 0xBC800000, 0x40201008, 0x00000000),
+	uint4(0xBCC00000, 0xFFFFFF87, 0x0FFFFFFF, 0xBD000000), uint4(0x380E0300, 0x0F03C0E0, 0xBD400000, 0x01FFFFFF),
+	uint4(0x00000000, 0xBD800000, 0x0380E038, 0x0070180E), uint4(0xBE000000, 0xFC7FBC10, 0x080301E0, 0xBE800000),
+	uint4(0x26118461, 0x09826098, 0xBEC00000, 0xBFFFF3FC), uint4(0x007C0600, 0xBF000000, 0xC1F03BEF, 0x01003F0F),
+	uint4(0xBF800000, 0x300E0380, 0x080200C0, 0xC0000000), uint4(0xBE0C0000, 0x0FFFFFFF, 0xC0400000, 0x06011C7F),
+	uint4(0x0FE1F83C, 0xC0800000, 0x40707C7F, 0x08000000), uint4(0xC1000000, 0x1F0FE3FC, 0x0000C038, 0xC1400000),
+	uint4(0xCFFDFE7F, 0x0184470F, 0xC1800000, 0x04010040), uint4(0x01004010, 0xC1C00000, 0xE3F3FDFF, 0x0E0F0787),
+	uint4(0xC2000000, 0xC7F7FFF9, 0x0FFBE3C3, 0xC2800000), uint4(0x3F8FC3E1, 0x03FBFCFE, 0xC3000000, 0x00000000),
+	uint4(0x00040000, 0xC3800000, 0x3F8FC3E0, 0x0FFFFEFF), uint4(0xC3C00000, 0xFFF00000, 0x000C7FFF, 0xC4800000),
+	uint4(0x40100C07, 0x08020000, 0xC5000000, 0x3FBFE7F8), uint4(0x00F01C01, 0xC5400000, 0xFFFEFFBE, 0x0080071F),
+	uint4(0xC5C00000, 0x380E0380, 0x0F0380E0, 0xC6000000), uint4(0x380E0780, 0x0E0380E0, 0xC6800000, 0x0FC3F0FC),
+	uint4(0x03F0FC3F, 0xC6C00000, 0x00000007, 0x0FFFC000), uint4(0xC7000000, 0xFFFFFC00, 0x000000FF, 0xC7400000),
+	uint4(0x2030FDFF, 0x0FC3C0C0, 0xC7800000, 0xE0781E0F), uint4(0x081E0781, 0xC7C00000, 0xBFEFFBFE, 0x00387EFF),
+	uint4(0xC8400000, 0x004FFFFC, 0x07F87E07, 0xC8800000), uint4(0xF3FBFDFF, 0x0FEFE7F7, 0xC9000000, 0x38080000),
+	uint4(0x0FFBF8F8, 0xC9400000, 0xE7FFF7FD, 0x08120481), uint4(0xC9C00000, 0xBFCFF3FC, 0x003C7EFF, 0xCA000000),
+	uint4(0x38080000, 0x00787878, 0xCA800000, 0x4C360D86), uint4(0x00C06018, 0xCAC00000, 0x3FFFF7FD, 0x08060100),
+	uint4(0xCB000000, 0x380C0603, 0x0F83E0F0, 0xCB400000), uint4(0xDFF7FFFF, 0x01FCFF3F, 0xCB800000, 0x80E0380E),
+	uint4(0x00380E03, 0xCC400000, 0x00303C3F, 0x0E020000), uint4(0xCC800000, 0x88421084, 0x01084220, 0xCCC00000),
+	uint4(0x1E0F07C3, 0x01E0F87C, 0xCD400000, 0xFFFFFBF8), uint4(0x0FFFFFFF, 0xCD800000, 0xCE739DE7, 0x039CE739),
+	uint4(0xCDC00000, 0x380C0300, 0x0F03C0E0, 0xCE400000), uint4(0x3F30383F, 0x000200F0, 0xCE800000, 0xCFF3FDFF),
+	uint4(0x01E0FE3F, 0xCF000000, 0x3F8FE3F8, 0x01E0F87E), uint4(0xCF800000, 0x0F07C3E1, 0x0E62301C, 0xCFC00000),
+	uint4(0xBFCFE3F0, 0x01FFFFFF, 0xD0400000, 0x01000020), uint4(0x00000000, 0xD0800000, 0x0F83E1F0, 0x03D8FE3F),
+	uint4(0xD0C00000, 0x06107FC7, 0x0FC3E078, 0xD1000000), uint4(0xFF8F870F, 0x0FFFFFFF, 0xD1C00000, 0x87E3F8FE),
+	uint4(0x01F87E1F, 0xD2400000, 0xEFF0FC0F, 0x0E0300C7), uint4(0xD2800000, 0xF83E1F87, 0x0E0781E0, 0xD3400000),
+	uint4(0x804FFFF9, 0x003C0E01, 0xD3C00000, 0x60180E03), uint4(0x0F820080, 0xD4400000, 0xBBEEFBBE, 0x0EFBBEEF),
+	uint4(0xD4C00000, 0x00E0783E, 0x0FF40001, 0xD5000000), uint4(0xCFFFFFFF, 0x000C070F, 0xD5800000, 0xC7F1FC7F),
+	uint4(0x07FCFF3F, 0xD6000000, 0xCFFFFFFF, 0x0804070F), uint4(0xD6800000, 0xC01FFFFE, 0x01FC1F01, 0xD7400000),
+	uint4(0xC0000000, 0x000000FF, 0xD7800000, 0xC0F00FFE), uint4(0x0FFCFF0F, 0xD9000000, 0x1F07C1E0, 0x07F9FC7E),
+	uint4(0xD9400000, 0x00001C7F, 0x0FFFF8E0, 0xD9800000), uint4(0x98E6398E, 0x06398E63, 0xD9C00000, 0x00010000),
+	uint4(0x00002008, 0xDA000000, 0xC3F0FC7F, 0x0E3F1F87), uint4(0xDA400000, 0x30000403, 0x0FF3F0F0, 0xDA800000),
+	uint4(0xBFFFFFFC, 0x000380FF, 0xDB000000, 0xC3F3F9F8), uint4(0x000C0707, 0xDB400000, 0x301C0F07, 0x0DFC0040),
+	uint4(0xDB800000, 0x0C0300E0, 0x02008030, 0xDBC00000), uint4(0x87898300, 0x01FC7F1F, 0xDC400000, 0xC0000200),
+	uint4(0x0FFFFFFF, 0xDCC00000, 0x03C1F8FF, 0x0E1FEF04), uint4(0xDD800000, 0xE739CE73, 0x09DE779D, 0xDDC00000),
+	uint4(0x1FCFF3FC, 0x01F0FC3F, 0xDE000000, 0x0000000F), uint4(0x03FFFF00, 0xDE800000, 0xCF7BCEF3, 0x01DCF77D),
+	uint4(0xDEC00000, 0x010FFFEF, 0x01C0300C, 0xDF400000), uint4(0xDE779DE7, 0x07DDF779, 0xDFC00000, 0xFDFF7FDF),
+	uint4(0x0FDFEFFB, 0xE0400000, 0x03EFE3E0, 0x0FC3C0C0), uint4(0xE0800000, 0xFE7F9FEF, 0x0F87E3F8, 0xE0C00000),
+	uint4(0xC3F3FDFF, 0x0C0E0707, 0xE1400000, 0x3030FDFF), uint4(0x0FF3F0F0, 0xE1800000, 0xBFEFF3FD, 0x01FCFF7F),
+	uint4(0xE1C00000, 0x30000007, 0x0FE3F0F0, 0xE2800000), uint4(0xCFFFFFFF, 0x003C1F1F, 0xE3000000, 0x040F7FC7),
+	uint4(0x0F03C070, 0xE3400000, 0x20180E0F, 0x08020080), uint4(0xE3800000, 0x8CE338EF, 0x0330CE33, 0xE3C00000),
+	uint4(0x00000000, 0x0FF00000, 0xE4000000, 0x3F8F83CF), uint4(0x03FFFEFF, 0xE4800000, 0xF87E3F8F, 0x0F0FC3F1),
+	uint4(0xE4C00000, 0x06018060, 0x00802008, 0xE5800000), uint4(0xDF77F9F8, 0x038DF37C, 0xE5C00000, 0x20080201),
+	uint4(0x08020080, 0xE6000000, 0xFFFFFBF8, 0x00FC7F3F), uint4(0xE6400000, 0xC4310C47, 0x0C0E4390, 0xE6C00000),
+	uint4(0x38080000, 0x00607030, 0xE7000000, 0xD8360D83), uint4(0x030CC330, 0xE7C00000, 0x00100C03, 0x00000000),
+	uint4(0xE8400000, 0x3C0703DF, 0x0103C3F0, 0xE8800000), uint4(0x81E0781E, 0x00781E07, 0xE9000000, 0xCFF3FFFF),
+	uint4(0x01F8FF3F, 0xE9400000, 0x7FCFF3FC, 0x00700407), uint4(0xE9800000, 0x30080000, 0x0783C0E0, 0xE9C00000),
+	uint4(0x20000003, 0x0FE3E0E0, 0xEA000000, 0xEFF7FBFD), uint4(0x0E7FBFDF, 0xEA400000, 0xFFFFE381, 0x0F00070F),
+	uint4(0xEA800000, 0x3C0F03C0, 0x0F83C0F0, 0xEB000000), uint4(0xE3FCFF3F, 0x087E1F87, 0xEB400000, 0xFF8E0400),
+	uint4(0x0FFFFFFF, 0xEB800000, 0x21884021, 0x02110C42), uint4(0xEBC00000, 0x7E1F8BE2, 0x0781E0F8, 0xEC400000),
+	uint4(0x318C6310, 0x0F739CE6, 0xECC00000, 0x83F1FCFF), uint4(0x0FDFC807, 0xED000000, 0x3F0F0300, 0x07FFFFFF),
+	uint4(0xED400000, 0x00000C1F, 0x0F830000, 0xED800000), uint4(0xC3D1F47B, 0x087C3E0F, 0xEDC00000, 0xFFEFF3FC),
+	uint4(0x080C7FFF, 0xEE800000, 0x5E370DC7, 0x07C1E078), uint4(0xEEC00000, 0xC1F07C1F, 0x003C0F03, 0xEF000000),
+	uint4(0xC1C0E070, 0x0E0F0703, 0xEF800000, 0xFDFE7F9F), uint4(0x0F73DEF7, 0xEFC00000, 0x3C0F83E0, 0x0C0380E0),
+	uint4(0xF0400000, 0xC1F3FFFF, 0x08000000, 0xF0800000), uint4(0x6FD3F4F9, 0x040800BF, 0xF0C00000, 0x3F8FC3E0),
+	uint4(0x0003FFFF, 0xF1000000, 0x0E0F0381, 0x0FF3FB04), uint4(0xF1800000, 0x3F0E0A42, 0x0CFFBFEF, 0xF1C00000),
+	uint4(0x3E0F0783, 0x03F1F8FC, 0xF2000000, 0xFFEFFBFC), uint4(0x0FFFFFFF, 0xF2400000, 0x30181C0F, 0x0E0380C0),
+	uint4(0xF2800000, 0x7F9EE7B9, 0x07E7F9FE, 0xF2C00000), uint4(0xF1F83E0F, 0x0CFF3FC7, 0xF3C00000, 0x0F87C3C0),
+	uint4(0x007C3F1F, 0xF4000000, 0x060380E0, 0x01806018), uint4(0xF4400000, 0x46118461, 0x01846118, 0xF4C00000),
+	uint4(0x00000000, 0x0FE30000, 0xF5000000, 0xFE10FFFF), uint4(0x0FFFFFFF, 0xF5C00000, 0xBFFFFFFF, 0x0FE3FCFF),
+	uint4(0xF6800000, 0x43D23483, 0x0EF3FC3F, 0xF6C00000), uint4(0x81C0F078, 0x001C0F03, 0xF7000000, 0x07C1F07C),
+	uint4(0x01F07C1F, 0xF7400000, 0x3FEFFFFF, 0x000200F8), uint4(0xF8400000, 0x1FE7FC00, 0x0201E07E, 0xF8800000),
+	uint4(0x902C0B06, 0x00010040, 0xF8C00000, 0xCFF3FDFF), uint4(0x01FCFF3F, 0xF9000000, 0x8783C2C0, 0x01FC7F1F),
+	uint4(0xF9400000, 0xBF8F8301, 0x00000F3F, 0xF9800000), uint4(0x7C1F03C0, 0x0F0FC3F0, 0xF9C00000, 0x00000001),
+	uint4(0x0FFFFF00, 0xFA400000, 0xCFF3FCFF, 0x0BFCFF3F), uint4(0xFB000000, 0xFF080000, 0x0FFFFFFF, 0xFB800000),
+	uint4(0xF07C3F0F, 0x0E0787E0, 0xFBC00000, 0x00002000), uint4(0x00000000, 0xFC000000, 0xFFEE0001, 0x0FFFFFFF),
+	uint4(0xFC400000, 0xDFE7C381, 0x00FC7F3F, 0xFD400000), uint4(0x00000203, 0x003CFF00, 0xFD800000, 0x85E1F0BC),
+	uint4(0x087E2F0F, 0xFDC00000, 0x38000200, 0x0FFFFFFC), uint4(0xFE000000, 0xDFF7FFFF, 0x03FDFF7F, 0xFE400000),
+	uint4(0x0781E078, 0x00C0300C, 0xFE800000, 0x80C02010), uint4(0x081C0E03, 0xFEC00000, 0x60381C0F, 0x0E0300C0),
+	uint4(0xFF000000, 0x380E0380, 0x0C0380E0, 0xFF400000), uint4(0xC1E3E3F0, 0x00000000, 0xFF800000, 0x00C0310E),
+	uint4(0x06210883, 0xFFC00000, 0x00000000, 0x00000000),
+};
+
+#define PARTITION_2_COUNT_10X8 759
+#define PARTITION_2_WORDS_10X8 3
+static const uint4 partition_2_10x8[570] =
+{
+	uint4(0xC1F07C1E, 0x701C0F03, 0x0040C1C0, 0xC0703C0F), uint4(0x100C0301, 0x00800040, 0x1789E673, 0xE1F83C1F),
+	uint4(0x00C00FC3, 0x380C0200, 0xC1E0F078, 0x01000783), uint4(0xE0783E1F, 0x180E0381, 0x01408020, 0x46018427),
+	uint4(0x378CE138, 0x01C0F9DE, 0xC1F0FC3F, 0x703C0F07), uint4(0x020001C0, 0x3FCFE3F0, 0xFFFFFEFF, 0x0240FFFF),
+	uint4(0x3FCFF3FE, 0x8FE3F8FF, 0x0280FC3F, 0x20C06030), uint4(0x0E030281, 0x02C0F038, 0xDFFFFFFF, 0xF1FCFF3F),
+	uint4(0x03400FC3, 0xF87C1F0F, 0x0F83C1F0, 0x03803E1F), uint4(0xBE0C0000, 0x007FFFFF, 0x03C00000, 0x60180601),
+	uint4(0x18060180, 0x04008060, 0xC7FFFFFF, 0x00000001), uint4(0x04400000, 0x00000007, 0x0003FF00, 0x04800000),
+	uint4(0x1FC7F1FC, 0xC7F1FC7F, 0x04C07F1F, 0x0C0300C0), uint4(0x0300C030, 0x0500300C, 0x3C0E0381, 0x0F83E0F0),
+	uint4(0x05407C3E, 0x3F0F0781, 0xF3FBFCFE, 0x05C000C1), uint4(0xF0FC3F0F, 0xFC7F1FC7, 0x0600CFF3, 0x3E0F83E7),
+	uint4(0x0F83E0F8, 0x0640F83E, 0x000003FF, 0x0FFC1F00), uint4(0x06800000, 0x6338CE73, 0x9C6731CC, 0x06C0C631),
+	uint4(0x3F0FC3F0, 0x0FC3F0FC, 0x0700FC3F, 0x3F0F83E0), uint4(0xCFE3F8FC, 0x0740FF3F, 0xF7FDFF7F, 0xFCFF3FCF),
+	uint4(0x0780CFF3, 0xBC2F0BC2, 0x2F0BC2F0, 0x07C0F0BC), uint4(0x08020080, 0x02008020, 0x08002008, 0x20000007),
+	uint4(0xFFFFFFFF, 0x0840FFFF, 0x00000000, 0x00000000), uint4(0x08808000, 0x3FFFFC00, 0x00000000, 0x09000000),
+	uint4(0xA1F87E1F, 0xE0381E07, 0x09400300, 0xFDFF7FDF), uint4(0x0003FFFF, 0x09C00000, 0xFFF00007, 0x0003FFFF),
+	uint4(0x0A800000, 0x3F8FF3FE, 0x0F03E0FC, 0x0AC0C038), uint4(0x3C0F03C0, 0xFF07C0F0, 0x0B00103C, 0xC0F0783E),
+	uint4(0x08060381, 0x0B40C030, 0xC00FFFFF, 0xFFFFFFFF), uint4(0x0B80FFFF, 0x77CDF27C, 0xFDFF7FDF, 0x0BC0003F),
+	uint4(0x01004010, 0x00401004, 0x0C000401, 0x78180C07), uint4(0xCFE3E0F0, 0x0C407F9F, 0x3E0F0380, 0xFFFFFCFE),
+	uint4(0x0C807FFF, 0x22098060, 0x0E8320C8, 0x0CC0F83A), uint4(0xFFFFFDFF, 0xFFFFFFFF, 0x0D00FFFF, 0xBFEFF800),
+	uint4(0xE3F9FEFF, 0x0D400F87, 0xCFFFFBF9, 0xCFCFCFCF), uint4(0x0D807FFF, 0x00020001, 0x00800010, 0x0DC00400),
+	uint4(0x20000C0F, 0x0F0380C0, 0x0E00FC3E, 0x0780C3DF), uint4(0x0400FE1F, 0x0E80F058, 0x301C0200, 0x0100C060),
+	uint4(0x0EC00402, 0x00000000, 0xFFFC0000, 0x0F00FFFF), uint4(0xC0701C0F, 0x00040100, 0x0F400000, 0xFBFEFC00),
+	uint4(0xF8FF3FCF, 0x0F8007A1, 0xBFCFC3C0, 0x0000010F), uint4(0x0FC00000, 0x00000404, 0x00000000, 0x1040E020),
+	uint4(0xE1F83E0F, 0xFC7F1F87, 0x1080E7F1, 0x0781E078), uint4(0x81E0781E, 0x10C01E07, 0xE0F83E1F, 0x7C1F0783),
+	uint4(0x1100C1F0, 0xC3F3FDFF, 0x000C0707, 0x11400040), uint4(0x00303838, 0x00000000, 0x11800000, 0xBBECFA7E),
+	uint4(0xEF3BDEE7, 0x11C07B9E, 0xC3F1FCFF, 0x301C0F07), uint4(0x12000040, 0x1FE7FDFC, 0x0781F07E, 0x1240401C),
+	uint4(0x80402000, 0x00000100, 0x12800000, 0x07030180), uint4(0x30180C0E, 0x12C00040, 0xBFCFF3F8, 0x0C020007),
+	uint4(0x1300F038, 0x0F03C0F8, 0x0300E038, 0x1340200C), uint4(0xFFF00000, 0xFFFFFFFF, 0x1380003F, 0x3F8FA3E8),
+	uint4(0x4FC3F0FC, 0x13C07D3F, 0xBDEF7BDE, 0xCE7B9EF7), uint4(0x14C0E739, 0x40100401, 0x10040100, 0x15000040),
+	uint4(0xDFF7FDFF, 0xF7FDFF7F, 0x15407FDF, 0xC3F0F87E), uint4(0xF07C1F0F, 0x158083C1, 0x084210C4, 0x70000020),
+	uint4(0x15C0FDFF, 0xF03C1F87, 0x00060180, 0x1600FFC0), uint4(0x2008067F, 0x3C0700C0, 0x1640E0F8, 0xE7FFFD80),
+	uint4(0xF07C3F0F, 0x168001C0, 0xC3F0FC7F, 0xF03C1F07), uint4(0x16C001C0, 0xBFEFFBFE, 0xEFFBFEFF, 0x17003F9F),
+	uint4(0x3FEFFC00, 0xF00200F8, 0x1780FFFF, 0x004FEFF9), uint4(0xE0781E03, 0x17C01FC3, 0xCFF3FDFF, 0xF9FEFFBF),
+	uint4(0x1840DFE7, 0xC3F1F9FC, 0x00040303, 0x1880C020), uint4(0x21C8721C, 0x80601C87, 0x18C00601, 0x1F81C007),
+	uint4(0xFFFFFEFF, 0x1900FFFF, 0xC1F33DC7, 0x030C4707), uint4(0x1940F01C, 0x00000000, 0xF0000000, 0x1980003F),
+	uint4(0x01806018, 0x80601806, 0x19C00601, 0xC3F1FCFF), uint4(0x301C0F07, 0x1A40C040, 0xC0703C1F, 0x08000100),
+	uint4(0x1AC0E030, 0xF1F0FC7F, 0x1F8FC7E3, 0x1B00FE3F), uint4(0x7C1F0F87, 0x0F03C0F0, 0x1B40781C, 0x3F07C013),
+	uint4(0x003CF0FC, 0x1B80FC0F, 0xC3F0FC7F, 0xE03C1F07), uint4(0x1BC00100, 0x00000403, 0x00000000, 0x1C000000),
+	uint4(0x300C0300, 0x3C0700C0, 0x1C40C1F0, 0xCFF7FFFF), uint4(0x303C1F0F, 0x1C800040, 0x9FC7E1FC, 0x338DF27C),
+	uint4(0x1CC0B0CE, 0xF03C0700, 0xFC7F0FC1, 0x1D00DFF3), uint4(0x00000000, 0xF0000000, 0x1D80FFFF, 0x380C0603),
+	uint4(0x0180C060, 0x1DC08C07, 0x000FFFFF, 0x00000000), uint4(0x1E000000, 0xC3F8FC3F, 0xF0F83809, 0x1E400FC3),
+	uint4(0xFC7FBC10, 0x180F03E1, 0x1E80FFC0, 0xF9FE7F9F), uint4(0xFE7F9FE7, 0x1EC0E7F9, 0x000FFFFF, 0xEC000000),
+	uint4(0x1F00FFFF, 0x00001C1F, 0x0E020000, 0x1F40FF3F), uint4(0xF8FC7E1F, 0xFFBFCFF3, 0x2000003F, 0xC1F07C1F),
+	uint4(0x7C3E0F03, 0x2040F9BC, 0x0C080003, 0x00040404), uint4(0x20801810, 0x3E0784E3, 0x0F83E0F8, 0x20C0385E),
+	uint4(0x3FFFFFFF, 0x00000000, 0x210007C0, 0xC1C0403F), uint4(0xFF9F8F83, 0x21800080, 0x008002FF, 0x98E21886),
+	uint4(0x21C09EE3, 0x00000000, 0xFFFFFF00, 0x2200003F), uint4(0x3C0F0380, 0x8FC3F0F8, 0x2240FF3F, 0x00101479),
+	uint4(0x0F038080, 0x22803F3F, 0x3C8C300E, 0x7F3FEEFC), uint4(0x22C0C1F8, 0x20100C07, 0x8381C0E0, 0x23800F07),
+	uint4(0xE1F07C1F, 0xE87E1F87, 0x23C0C7A1, 0x03038180), uint4(0x000C0607, 0x24000000, 0xC7F1FC7F, 0xF1FC7F1F),
+	uint4(0x24401FC7, 0xFFCF8300, 0x0000003F, 0x2480F000), uint4(0xF9FCFE7F, 0xF3FFEFF7, 0x24C000C1, 0xC0F07C3F),
+	uint4(0x100C0701, 0x25000000, 0x20000000, 0x8FC3C0E0), uint4(0x2540FFBF, 0xFFFFFC00, 0x007FFFFF, 0x2580FFFE),
+	uint4(0x3B2E8BC2, 0xFE7FBEEF, 0x25C0E7B9, 0xFFFFFFFF), uint4(0xFFFFFFFF, 0x2600003F, 0x3E0FC3F0, 0x0F03E0F8),
+	uint4(0x2640F03C, 0x380C0300, 0x0F83C0F0, 0x26803C1F), uint4(0x3E0F83E0, 0x0F83E0F8, 0x26C0783E, 0x3C0F83F0),
+	uint4(0x080300E0, 0x27000000, 0x9FE7F8FE, 0xEFFBFEFF), uint4(0x27403F9F, 0x3E0F87EE, 0x0383E0F8, 0x2780FB02),
+	uint4(0xFC3C1C07, 0x8FFBF9F8, 0x27C0F83F, 0xC7FFFFFF), uint4(0xF0000001, 0x2840FFFF, 0x100DFF3F, 0x1C0300C0),
+	uint4(0x2940C0F0, 0xC7E1F0F8, 0xFE7F1F8F, 0x29C0F9FC), uint4(0x7F9FCFE7, 0xEFF3FCFE, 0x2A00FFFF, 0x000FEFF9),
+	uint4(0x80E01802, 0x2A403E07, 0x878F0300, 0x00000000), uint4(0x2A80E020, 0x20000C1F, 0x0C030080, 0x2AC0F038),
+	uint4(0x7F700060, 0xCFE3F8FC, 0x2B00FF3F, 0x0381C0E0), uint4(0x1C1E0F07, 0x2B807038, 0x000FFFEF, 0x11846008),
+	uint4(0x2BC038CE, 0x40200804, 0x08020180, 0x2C40C030), uint4(0x000FFBFF, 0x00000000, 0x2C80FFC0, 0xC1F07C1F),
+	uint4(0xF07C1F07, 0x2CC007C1, 0x00000000, 0x00000000), uint4(0x2D008020, 0x00000001, 0x0F030000, 0x2D403FBF),
+	uint4(0x3FFFFFFF, 0x00000000, 0x2D800000, 0x80C0300C), uint4(0x683A0E83, 0x2DC081A0, 0xF0FC3E0F, 0xF33D8FE3),
+	uint4(0x2E000BC4, 0xDFF7FCFF, 0xFFFFFFFF, 0x2E40003F), uint4(0xFFFFFFFF, 0xF3FDFFFF, 0x2F000FC7, 0x3FFFFFFF),
+	uint4(0xFFF80000, 0x2F80FFFF, 0x0380F03C, 0x00C0300E), uint4(0x2FC00802, 0x0E0380C0, 0x0380E038, 0x30403C0E),
+	uint4(0xFFEFF3F8, 0x003CFFFF, 0x3080FFFC, 0x799E6799), uint4(0x9EE7B9EE, 0x30C0EEFB, 0xC3E0F83E, 0xF0FC3F0F),
+	uint4(0x31000FC3, 0xBFFFFFFF, 0x0F83F8FF, 0x31808038), uint4(0xD9EC721D, 0x731CCF63, 0x31C01CC6, 0xCFF3FDFF),
+	uint4(0xF0FC3F1F, 0x320003C1, 0x00000000, 0xFFFFFF00), uint4(0x3240FFBF, 0xFDF00010, 0xFE7F9FF7, 0x32C0C3F0),
+	uint4(0x60180E07, 0x08020080, 0x33000000, 0x0000000F), uint4(0xF3FC0000, 0x338000C1, 0xC7F0FC1F, 0x0000007F),
+	uint4(0x33C00000, 0x40100C07, 0x0E020000, 0x3400FE3E), uint4(0x3F8FE3F8, 0x8FE3F8FE, 0x34403E1F, 0x9FF7FFFF),
+	uint4(0x01E0FC3F, 0x34800807, 0xB8CE3308, 0xFFBFCEF3), uint4(0x34C081E2, 0x00000000, 0x08000000, 0x35000020),
+	uint4(0x380C0606, 0x8FC3E0F0, 0x3540FF3F, 0xCFF7E3C0), uint4(0x007F9F0F, 0x35800040, 0x18C67198, 0xE731CC63),
+	uint4(0x35C0338C, 0x40100802, 0x00000100, 0x36008000), uint4(0xC0703C1F, 0x00040300, 0x36400000, 0xFF8E0000),
+	uint4(0x080000FF, 0x3680FF3E, 0x10040100, 0x04010040), uint4(0x36C04010, 0x000C03C0, 0xFFFFF8C0, 0x37007FFF),
+	uint4(0x300C0300, 0x0C0300C0, 0x3740C030, 0xF9FC7F3F), uint4(0x1F8FC7E3, 0x3780FC7E, 0xC0703C1F, 0x00040301),
+	uint4(0x37C00000, 0xC3F3FDFF, 0x000C0707, 0x38000000), uint4(0x3F0F83C3, 0xFFFBFCFE, 0x3840FFFF, 0x3F8F83C0),
+	uint4(0xFFFFFFFF, 0x38801FCF, 0xC0301806, 0x00040100), uint4(0x38C08020, 0x180E0703, 0x0180E070, 0x39400E07),
+	uint4(0x180C0001, 0x60303018, 0x39800040, 0x3FFFEFF3), uint4(0x10040100, 0x39C0C060, 0xDFF00C01, 0xFFFFFFFF),
+	uint4(0x3A007FFF, 0x3E0F07A1, 0xE331C87C, 0x3AC0A1CC), uint4(0x0100C030, 0x700C1104, 0x3B0001C0, 0x00000003),
+	uint4(0x00000000, 0x3B400000, 0x3FCFF3FC, 0xCFF3FCFF), uint4(0x3B80FF3F, 0xC1F07C1F, 0xF87E1F07, 0x3BC083E0),
+	uint4(0xE0F81E03, 0xF9FE3F87, 0x3C003FCF, 0xFFFFFFFF), uint4(0x0FFFFFFF, 0x3C8001C0, 0xC1F07C1F, 0x4E3E0F03),
+	uint4(0x3D40FE3E, 0x000003FF, 0xF0000000, 0x3D80FFFF), uint4(0xBFCFC3E1, 0x103C7FFF, 0x3DC08000, 0xF8FC3F0F),
+	uint4(0xFF3FCFE3, 0x3E00FBFE, 0xE7F9FF7F, 0xC1F87E1F), uint4(0x3E401F07, 0xE0F00C06, 0x3803FF9F, 0x3E8087E0),
+	uint4(0xC1F00001, 0xFFFFFFFF, 0x3F007FFF, 0xDFF7F1F0), uint4(0xE7FDFF7F, 0x3F407F1F, 0x001078F0, 0x00000000),
+	uint4(0x3F800000, 0x43C0F07C, 0xD4351D47, 0x3FC0C1D0), uint4(0x0040100C, 0xCFF7FD00, 0x4040FF3F, 0xFE7C3C1F),
+	uint4(0x00000006, 0x40800000, 0x380C0E0F, 0x8FC3E0F0), uint4(0x4100FF3F, 0x300E03C0, 0x00000080, 0x41400000),
+	uint4(0x07C1FC7E, 0xF0FF3088, 0x41800F03, 0x0F03C0F0), uint4(0x03C0F03C, 0x41C03C0F, 0x380803FF, 0xFFF3F0F8),
+	uint4(0x4200FFFF, 0x000FFDFF, 0x0C020080, 0x4240E078), uint4(0x80601806, 0x60180601, 0x42800180, 0x00010040),
+	uint4(0x00802008, 0x42C00002, 0x3800040F, 0xFFFFFEFC), uint4(0x438001C7, 0xFC7F1FC6, 0x370DC3F1, 0x43C070DC),
+	uint4(0x000FFFFF, 0xFFFFFF00, 0x4400FFFF, 0x1E07C1F8), uint4(0x0601C078, 0x44404018, 0x3C0F03C0, 0x0F03C0F0),
+	uint4(0x4480F03C, 0xC0300400, 0xF07C0F01, 0x44C01FC3), uint4(0xFFFFFC00, 0xFFFFFFFF, 0x45000FCF, 0x300C0360),
+	uint4(0x01804000, 0x45401C06, 0xC1F07B30, 0xCFA31F07), uint4(0x458003F8, 0xC1E0781C, 0x7C1E0F83, 0x45C0E0F0),
+	uint4(0x00000000, 0x00000000, 0x4600FFFF, 0x1F87E1FC), uint4(0x87E1F87E, 0x46407E1F, 0x0E0381E0, 0x0380E038),
+	uint4(0x46801806, 0xFFEFF3F8, 0xFFFFFFFF, 0x46C0FFFF), uint4(0xCFFFFFFE, 0x303C1F1F, 0x47000040, 0x3E0FC3F0),
+	uint4(0x0F03C0F8, 0x4780E038, 0x180E0300, 0x0180C030), uint4(0x47C00C06, 0x3E0F83C0, 0x0FC3F0F8, 0x4840FE3F),
+	uint4(0xA7C9F0F9, 0xFE7F1ECF, 0x48C0F1F8, 0x0701C0F0), uint4(0x0040300C, 0x4900FFC1, 0x3C0FC3FC, 0xF3FC00C0),
+	uint4(0x494000C1, 0x00000001, 0x00000000, 0x4980C020), uint4(0xE1F0BC7F, 0x1C1F0781, 0x49C06098, 0xCFFFFFFF),
+	uint4(0x383C1F1F, 0x4A00F070, 0x000007FF, 0x0C020080), uint4(0x4A8067F0, 0x9C6E1B86, 0x370DC771, 0x4AC038DE),
+	uint4(0x30080200, 0x0F0380E0, 0x4B00F83E, 0x2000040F), uint4(0xF1FFF8F0, 0x4B800000, 0x200F03FC, 0x00000000),
+	uint4(0x4BC00000, 0xC3FEFFBF, 0x03004011, 0x4C00380E), uint4(0xDFEFFBFD, 0xF07C7F3F, 0x4C4081C0, 0x030C83C0),
+	uint4(0xF07C1F0F, 0x4C8003C1, 0xDFE7F9FC, 0x0000007F), uint4(0x4CC0C010, 0xCFFFFC00, 0x3C3E1F9F, 0x4D40E070),
+	uint4(0x00000000, 0x08020000, 0x4D808020, 0xBFF00000), uint4(0x0F03F0FF, 0x4E800020, 0x3E0F83F0, 0x0F03C0F8),
+	uint4(0x4F00E03C, 0x380C0201, 0x0F83C0E0, 0x4F40FE3F), uint4(0xCFF0FC1F, 0xFFFFFF7F, 0x4F80FFFF, 0xE6318C62),
+	uint4(0x18CE2388, 0x4FC08C63, 0x3F8FE3F8, 0x8FE3F8FE), uint4(0x5040FE3F, 0x40100C0F, 0x0C020000, 0x50C0E038),
+	uint4(0x40707C7F, 0x00000000, 0x51000000, 0x20000403), uint4(0x030180C0, 0x51401806, 0x01FFFF80, 0x00000000),
+	uint4(0x5180FF80, 0x2789E27C, 0xC8F27C9E, 0x51C08FA3), uint4(0xFF7F9FEF, 0x8FE7F1FC, 0x5240FF3F, 0xE0703C1F),
+	uint4(0x0F0381C0, 0x5280783E, 0x3E0F83C0, 0x0FC3F0F8), uint4(0x52C03C1F, 0xE1F07C1F, 0x7C3F0F83, 0x5300E1F8),
+	uint4(0x000003FF, 0x00000000, 0x53400000, 0x3048120C), uint4(0x2C1B04C1, 0x53C06090, 0xE1F07C1E, 0x7F1F8FC3),
+	uint4(0x54407DFE, 0xC0703C1F, 0x100C0301, 0x54800040), uint4(0x060184C1, 0x8862300C, 0x54C0C231, 0x781E0F03),
+	uint4(0x0781C0F0, 0x55401C0E, 0x3C0FFFFF, 0xFFFFFF80), uint4(0x55801FCF, 0xC7F3FFFF, 0x978FCFC7, 0x55C00787),
+	uint4(0x04010040, 0x00000010, 0x5600C020, 0x2380E070), uint4(0xEC7B1C8F, 0x56C0E3F8, 0xFE3F1F87, 0xEFF7F9FC),
+	uint4(0x5700FFFF, 0x00000003, 0x0E020000, 0x57401E1E), uint4(0x380E0300, 0x0783C0F0, 0x57807C1E, 0x07C01C04),
+	uint4(0xEFFBFEFF, 0x57C0FFBF, 0xC01FFFFE, 0xF0FC1F01), uint4(0x5800FFCF, 0x3E0F83C0, 0x8FE3F0FC, 0x5840FF3F),
+	uint4(0xF8783C1C, 0x003BF9F8, 0x58807030, 0xCCF73DCF), uint4(0xF0BC6F1B, 0x58C007C0, 0xE7F9FE7F, 0xF9FE7F9F),
+	uint4(0x59809FE7, 0xA1E87A1E, 0xE87A1E87, 0x59C087A1), uint4(0xBF8FC3C0, 0xFFFFFFFF, 0x5A40FFFF, 0x8060180E),
+	uint4(0x301C0701, 0x5A8000C0, 0x20C8320C, 0xC8320C83), uint4(0x5AC08120, 0x00001C1F, 0x00000000, 0x5B400000),
+	uint4(0xFFEFE3F0, 0xFFFFFFFF, 0x5B80FFFF, 0xC0000007), uint4(0xFFFFFFFF, 0x5BC0FFFF, 0xE0100407, 0x7E0F83C0),
+	uint4(0x5C00F9FC, 0xFF8F027F, 0x0003FFFF, 0x5C8001C0), uint4(0x2308C230, 0x08C2308C, 0x5CC08C23, 0x00000003),
+	uint4(0xFFFC0000, 0x5D40FFFF, 0xFFFFFFFF, 0x70000007), uint4(0x5D8007C0, 0xE739CE73, 0x18CE338C, 0x5DC08C63),
+	uint4(0x180C0603, 0x80C06030, 0x5E000301, 0xBF8F8380), uint4(0xFFFFFFFF, 0x5E803FFF, 0xFE004018, 0xFC3F9FF7),
+	uint4(0x5F0003E0, 0x20000000, 0x030180C0, 0x5F400C06), uint4(0x00000000, 0x00000000, 0x6040C020, 0x3F0F0E07),
+	uint4(0xFCFC7F7F, 0x6080FEFE, 0xEFBBEEF9, 0x401000FE), uint4(0x60C08120, 0x3F8FC3E1, 0xF1F8FC7F, 0x610007C3),
+	uint4(0x30000000, 0xFFF3F0F0, 0x6140FFFF, 0x00001FFF), uint4(0xFFFFFFF0, 0x6180FFFF, 0x380E0300, 0x0701C060),
+	uint4(0x61C0380C, 0x3FFFFBF8, 0x00000000, 0x62000000), uint4(0x81C0F03C, 0xE0781E07, 0x624007C1, 0xE1F07C3F),
+	uint4(0x1E0F07C3, 0x6280F87C, 0xC00180F0, 0x381F0FE7), uint4(0x62C00040, 0x08120401, 0x01004000, 0x63C00800),
+	uint4(0x00000000, 0xFFFFFF00, 0x6400FFFF, 0x000F83FF), uint4(0x00000000, 0x64800000, 0x3F8FE3F0, 0xEFFBFCFF),
+	uint4(0x64C0007F, 0x07C07005, 0xCFF3FCFF, 0x65000F0F), uint4(0x10080403, 0x01008060, 0x65400C06, 0x701C0E03),
+	uint4(0x060180C0, 0x65C03008, 0x00000020, 0x00000400), uint4(0x66400000, 0x380F03E0, 0x080300E0, 0x66800020),
+	uint4(0x0C110C0F, 0x3F05C070, 0x66C0F0FC, 0x07C1F03C), uint4(0xC1F07C1F, 0x67003F07, 0x000FFFFF, 0xFFFC0000),
+	uint4(0x6780FFFF, 0x40301C0F, 0x00000000, 0x67C08000), uint4(0x3F0F8380, 0x003C7EFE, 0x68800000, 0xCDF27CBE),
+	uint4(0x118C6713, 0x68C01C47, 0x00000000, 0x00000000), uint4(0x6900FFBC, 0x3E0F0787, 0xF0F87C7E, 0x698001C0),
+	uint4(0x00000003, 0xFFFFF8E0, 0x69C07FFF, 0xCFF7FFFE), uint4(0xF07C3F1F, 0x6A0001C0, 0x3F8F8FDF, 0xFFFFFEFF),
+	uint4(0x6A8007CF, 0xE0F83C1F, 0x7C1F0783, 0x6B40C1F0), uint4(0x0FEFFFFF, 0x0E07E70E, 0x6B800020, 0xF1F07C1F),
+	uint4(0x7FBFCFE3, 0x6C00003F, 0xDFF7F9FE, 0xF7FDFF7F), uint4(0x6C40003F, 0x2008021F, 0x08020080, 0x6D008020),
+	uint4(0x0000080C, 0x00000000, 0x6D400000, 0xC3F1F2C0), uint4(0x3F1C0F07, 0x6D80807F, 0xFDFEFF7F, 0x9FCFE7F3),
+	uint4(0x6DC0FE3F, 0x40201008, 0x04020000, 0x6E001008), uint4(0x0000040F, 0x00000000, 0x6E400000, 0xFFFFFFFF),
+	uint4(0x103C7FFF, 0x6EC00000, 0xC7F3FCFF, 0xF1FC7F1F), uint4(0x6F000FC7, 0x0E009C1F, 0x0F83E078, 0x6F40F83E),
+	uint4(0x0000FFFF, 0x00000000, 0x6F800FC0, 0xDC7F1FC7), uint4(0x378DE779, 0x6FC038DE, 0xDFFFFEFF, 0xF9FEFFBF),
+	uint4(0x70408FE3, 0x000FC000, 0xF0000000, 0x7080003F), uint4(0xDC771DC7, 0x771DC771, 0x70C071DC, 0xC0F07C3F),
+	uint4(0x00040301, 0x71000000, 0xE7FFFFFF, 0xEFE3E0E1), uint4(0x7140FFFF, 0x300C0300, 0x1C0701C0, 0x7180C070),
+	uint4(0xFE3F9FE7, 0x0F87E1F8, 0x71C0783E, 0xC3F0F038), uint4(0xF0FC3F0F, 0x72808781, 0x00000406, 0x00000000),
+	uint4(0x73400000, 0xCFE3F9FE, 0xF3FCFF3F, 0x73801FC7), uint4(0x07C3F5F9, 0xE8F83C1F, 0x73C087A1, 0xDBF2FC7F),
+	uint4(0xFE3F9F67, 0x7440E1F8, 0x3FFFFC00, 0x00000000), uint4(0x7480FFC0, 0x00000000, 0xF0000000, 0x7540BFDF),
+	uint4(0x200FF3FF, 0x00000000, 0x7580F020, 0x3F0FC3E3), uint4(0xCFF3F8FE, 0x75C01F9F, 0x00000000, 0xCFC3C0C0),
+	uint4(0x7640FFFF, 0x00303C3F, 0xFFFC0000, 0x7680FFFF), uint4(0x0010FFFF, 0x08020000, 0x76C0E030, 0xC0701C03),
+	uint4(0xF07C0F03, 0x77000FC1, 0x3F8FEC1C, 0x0FC3F0FE), uint4(0x7780000F, 0xC0000000, 0xFCFFBFEF, 0x77C08FF3),
+	uint4(0x000003FF, 0xFFFC0000, 0x7800FFFF, 0x00000C0F), uint4(0x00000000, 0x78408000, 0x00001C78, 0xFFFC0000),
+	uint4(0x78803FFF, 0x0F83C1E0, 0xF8FE3E1F, 0x7900C3F1), uint4(0xFFF8007F, 0x0FFFFFFF, 0x79800000, 0x87E3FBFE),
+	uint4(0xF0080E07, 0x79C0FFBF, 0x3C06027F, 0xFFFBF8FC), uint4(0x7A00FFFF, 0xCFFFFFFF, 0x3E3E1F1F, 0x7A40034F),
+	uint4(0x3E0C0003, 0x001C3F7F, 0x7A80F020, 0xC0301E07), uint4(0x0F070100, 0x7AC07E3F, 0xC7F1FC7F, 0xF0FC3F0F),
+	uint4(0x7B000FC3, 0x300C0607, 0x7C0700C0, 0x7BC0E7F0), uint4(0x40303C1F, 0x00000000, 0x7C00FFC0, 0xF07C3F9F),
+	uint4(0x9FFC0281, 0x7C80FC7F, 0xC0700C03, 0xF01C0701), uint4(0x7CC003C0, 0x0E0FE3FE, 0x303E1F00, 0x7D000040),
+	uint4(0x87E1F87E, 0xC1F87E1F, 0x7D401F07, 0xDFF3FC7F), uint4(0x0FFFFFFF, 0x7D800000, 0x300C0380, 0x080300C0),
+	uint4(0x7DC08020, 0x00000003, 0xFFFFFF00, 0x7E00FFFF), uint4(0xF1FC3F0F, 0xFEFF9FC7, 0x7E40EFFB, 0x3FEFFFFF),
+	uint4(0x707E7F78, 0x7E800040, 0x38080001, 0xFFFBF8F8), uint4(0x7F000FCF, 0xC7F1FCFF, 0xF07C3F0F, 0x7F4003C1),
+	uint4(0x3F87E400, 0x81E1F8FE, 0x7F800001, 0x380E07C3), uint4(0x0C0300E0, 0x7FC08010, 0x00100C07, 0xFFF3C000),
+	uint4(0x8040003F, 0x3FFFFFFF, 0x08000000, 0x8100F838), uint4(0x3C0E0187, 0x8FC3E0F8, 0x8140FE3F, 0x01FFFFFF),
+	uint4(0xF7FBE080, 0x818003C7, 0x1F0783E1, 0xC1F0F83C), uint4(0x81C08FA7, 0xFFFFFFFE, 0xFFFFFFFF, 0x8200FFFF),
+	uint4(0x00107DFF, 0x00000000, 0x8240C020, 0x010FFFEF), uint4(0x00C03004, 0x82C01C47, 0x0F0783C1, 0xF0783C1E),
+	uint4(0x8300C1E0, 0x300C0203, 0x0F3C87E0, 0x8380F83C), uint4(0x7FD7F1FC, 0x400000FF, 0x83C00100, 0xBFE7F9FE),
+	uint4(0xFFFFFEFF, 0x844000BF, 0x3C0803FF, 0x0003FFFF), uint4(0x848003C0, 0x22080240, 0xC8221084, 0x84C08120),
+	uint4(0x07C1F07E, 0x01C0701E, 0x85401806, 0x3F8FE3F8), uint4(0x0FC3F0FC, 0x8580F83E, 0x180E0380, 0x0701C060),
+	uint4(0x85C0300C, 0xC1F3FFFF, 0xFFFB8000, 0x8680003F), uint4(0xC0040201, 0xFF7FFFFF, 0x86C0F9FE, 0xFFF80000),
+	uint4(0x8003FFFF, 0x8780FFFF, 0xC1F0FC7F, 0x100C0703), uint4(0x87C00000, 0x30080C0E, 0x0F83C0E0, 0x8840FE3F),
+	uint4(0x3FCFC000, 0x0803C0FC, 0x8880FFB0, 0x118C6211), uint4(0x62188C43, 0x88C01084, 0xFFF7FDFF, 0x080000FF),
+	uint4(0x8900F030, 0x200F03FC, 0xFFC00000, 0x8940FFFF), uint4(0x380E0787, 0xFEFC0060, 0x8980E1F8, 0x00080204),
+	uint4(0x04090200, 0x89C00000, 0x300F03E0, 0xFFFC0080), uint4(0x8A40FF3F, 0xCE0F83E0, 0x0F84E709, 0x8A80F83E),
+	uint4(0xFFEFF3F9, 0xF0001FFF, 0x8B80FFFF, 0x3C0F03C0), uint4(0x0783E0F8, 0x8BC0781E, 0x00000004, 0x00000000),
+	uint4(0x8C800000, 0x3FFFFBF8, 0x00000000, 0x8CC0F030), uint4(0x06018060, 0x01004010, 0x8DC0FFC0, 0xFFFFC300),
+	uint4(0x000000FF, 0x8E400000, 0x00000200, 0xFFFFFF00), uint4(0x8E80C03F, 0x0300C030, 0x00C0300C, 0x8EC00C03),
+	uint4(0x3F0FF3FE, 0x0C03C0F8, 0x8F00FFE0, 0xE3F0FC3F), uint4(0xFC3E1F87, 0x8FC0E3F0, 0x0007FCFF, 0x780E0100),
+	uint4(0x9080C7E0, 0x3BCEF3BC, 0xC6F1BCEF, 0x90C02F1B), uint4(0x20080000, 0x0F0380C0, 0x9100F83C, 0x01C0F03C),
+	uint4(0x80601807, 0x91400601, 0xF8FE3F9F, 0xFF3F8FE3), uint4(0x91C0F3FC, 0xC0701C0F, 0x00040100, 0x92008020),
+	uint4(0xC0701C0F, 0x380C0301, 0x92408060, 0xF3F0F87C), uint4(0x80403FEF, 0x92800381, 0x0802047B, 0xC6318C21),
+	uint4(0x92C0F718, 0xBFCFE3F0, 0xF3FFFFFF, 0x938081C3), uint4(0x01802C07, 0xE87A1C87, 0x93C0CFB1, 0x3F0FE3FC),
+	uint4(0x0C0380F0, 0x94400000, 0x1E060000, 0xF3FDFF7F), uint4(0x94803FCF, 0x5FB7CDF3, 0xC3F4FD3E, 0x94C09F87),
+	uint4(0xFFCFC3C0, 0xFFFFFFFF, 0x9500FFFF, 0x1C070180), uint4(0x87C1F078, 0x95407F1F, 0xFC3E1E0F, 0xF7F3F9FC),
+	uint4(0x9580DFEF, 0x3C0F83F0, 0x080300E0, 0x95C0FFC0), uint4(0xBFEFFBE0, 0xC3F1FCFF, 0x96000F07, 0x3E0FF3FF),
+	uint4(0x000000C0, 0x96400000, 0xFFFFF3C3, 0x0C3CFFFF), uint4(0x9680FFFF, 0xDFFFFFFF, 0xE1FCFF3F, 0x97400F03),
+	uint4(0xB0000000, 0x0000001F, 0x9780F800, 0xBE4FA3E0), uint4(0x1F8FE2F9, 0x97C0F87E, 0x27F80E00, 0x08020080),
+	uint4(0x98008020, 0x20000000, 0x0F0380C0, 0x98403C1E), uint4(0xC1F3FC00, 0x0C020080, 0x9880E030, 0x0380F03C),
+	uint4(0xF000100C, 0x98C0F7FD, 0x00000007, 0xF0000000), uint4(0x9900FFFF, 0xFFFFFFF1, 0x0C000F3F, 0x9980FF3E),
+	uint4(0x02010081, 0x00201000, 0x99C00000, 0x0000047F), uint4(0xFFFC0000, 0x9A00FFFF, 0xFFF7FCFF, 0xFFFFFFFF),
+	uint4(0x9A40FFFF, 0x87E0F83E, 0xE1F87E1F, 0x9A803F8F), uint4(0x9CEF339C, 0xF87C2F3B, 0x9AC0C3E0, 0x00000001),
+	uint4(0x00000000, 0x9B007E3C, 0xFFFFFBFC, 0x000000FF), uint4(0x9B400000, 0x100F07E2, 0xF07C3830, 0x9B80C0C0),
+	uint4(0xBFFDFF7E, 0x64190200, 0x9BC0C3B0, 0xE1F87E1F), uint4(0xF87E1F87, 0x9C00C7E1, 0x0E03C0F0, 0xF0008030),
+	uint4(0x9C40BFEF, 0xBC6F1BCE, 0x2F1BC6F1, 0x9CC0709C), uint4(0xFFFFFC00, 0xFFFFFFFF, 0x9D007FFF, 0x3F8FE3F8),
+	uint4(0x8FE3F8FE, 0x9D407E3F, 0x0300C461, 0x88201804), uint4(0x9DC00300, 0x010FDFF3, 0x07C0F00C, 0x9E40FC3F),
+	uint4(0xFFFFFFFF, 0x818C7F7F, 0x9E800783, 0xF07C1F8F), uint4(0x10040380, 0x9F00FF80, 0x3FFFFFFC, 0xF00C0000),
+	uint4(0x9F80FFC3, 0xC8320C87, 0x310C4310, 0x9FC01044), uint4(0x7A3E0FC3, 0xDC67B9EC, 0xA0C0C7B1, 0xC7FFF3F0),
+	uint4(0x00000000, 0xA1400000, 0x00001C7F, 0xF0000000), uint4(0xA1803FFF, 0xFEFFFFFF, 0xE7B9EEFB, 0xA1C0739C),
+	uint4(0x3F0F83D0, 0xFFFBF4FE, 0xA200FEFF, 0xC3F1F8FE), uint4(0x381E0F87, 0xA240C070, 0x0701C070, 0x01C0701C),
+	uint4(0xA2801C07, 0x20080E07, 0x08020080, 0xA2C08020), uint4(0x80C06038, 0x00040201, 0xA3000000, 0xDF3FCFF7),
+	uint4(0x13C5F17C, 0xA3C03C0F, 0x1F87E1F8, 0x87E1F87E), uint4(0xA4407E1F, 0x9FF7E1C0, 0x07C1FC7F, 0xA480701E),
+	uint4(0x02008020, 0x00802008, 0xA4C00802, 0xC78FE3F8), uint4(0x8FE03800, 0xA540FE3F, 0x0030FDFF, 0x0FFFFF00),
+	uint4(0xA580E03F, 0x3F0F87E3, 0xE1F0FC7E, 0xA5C08FC7), uint4(0xFCFE7F3F, 0xDFEFF7F9, 0xA600FFBF, 0x80200802),
+	uint4(0x180C0300, 0xA6408060, 0x1F0783E0, 0xC1E0783C), uint4(0xA6800703, 0x3000037F, 0x1C0300C0, 0xA700C1F0),
+	uint4(0xFFFFFFFF, 0x0FFC00FF, 0xA7800000, 0x40707C7F), uint4(0x60300804, 0xA80081C0, 0xDCFE7F3F, 0x83C4E371),
+	uint4(0xA8401F07, 0x3BFCFC7F, 0xF0301800, 0xA88081C0), uint4(0x781C0603, 0x0E03C0E0, 0xA8C0F43A, 0x3E0F87E3),
+	uint4(0x0FC3E0F8, 0xAA403C1F, 0x179DC7F1, 0xC6F1F85E), uint4(0xAAC03F0B, 0x3FEFFFFF, 0x0FE3FCFF, 0xAB00FC3F),
+	uint4(0x08040201, 0x80402010, 0xAB400100, 0xBF0E0C1F), uint4(0xFFFFFFFF, 0xAB8007CF, 0x00101C3F, 0x08000000),
+	uint4(0xABC0F030, 0xEFF7FFFF, 0x139DCFCF, 0xAC000F07), uint4(0x3F80F1FC, 0xCFF3FCFF, 0xAC80FF3F, 0x00802008),
+	uint4(0x80200802, 0xACC00200, 0xE3F8FE1F, 0xFBFE7F9F), uint4(0xAD003FCF, 0xDFE7F9FC, 0xF3FFFFFF, 0xAD4040D1),
+	uint4(0x000003FF, 0x0003FF00, 0xAD800000, 0x46110C43), uint4(0x10842118, 0xADC00842, 0xFE7F9FE3, 0x7FDFF7FD),
+	uint4(0xAE00003F, 0xBFFFFFFF, 0x0E03F0FF, 0xAE400000), uint4(0xDFFFFFFF, 0xF7FDFF7F, 0xAEC03FCF, 0x380C0301),
+	uint4(0x7F0780E0, 0xAF0073FC, 0x300E03E0, 0x00000000), uint4(0xAF408000, 0x3F080000, 0x00000000, 0xAF800000),
+	uint4(0x9FCFC3E0, 0x000C0F1F, 0xAFC0C020, 0x81C0E070), uint4(0x00040301, 0xB0408000, 0x00000300, 0x00000000),
+	uint4(0xB0800000, 0x27C9F2FC, 0xDCF37CDF, 0xB0C0EF3B), uint4(0x00000001, 0x0C000000, 0xB1400F0E, 0xDFF7F3F8),
+	uint4(0xFDFE7F3F, 0xB1C0003F, 0xC6F0FC3F, 0x1F8DE739), uint4(0xB240FC3F, 0xC0000000, 0x0C03FFFF, 0xB2800000),
+	uint4(0x01806018, 0xE0300C07, 0xB3000180, 0x1789E279), uint4(0xC4E1385E, 0xB3C04F13, 0x3E0F1F9F, 0xEFF3F8FC),
+	uint4(0xB400FFFF, 0xE3F87E1F, 0xFBFE7F9F, 0xB480FFEF), uint4(0xE0783E0F, 0x180E0381, 0xB4C08060, 0x3FFFDFE3),
+	uint4(0x80C01004, 0xB5003E07, 0x1C0F07C3, 0x0100C070), uint4(0xB540FFC4, 0xC3F1FDFF, 0x0E060303, 0xB580FC3E),
+	uint4(0x060104C1, 0xC060380C, 0xB5C00381, 0xFFFFFFF8), uint4(0x70007F7F, 0xB6800040, 0x9EE7B8EE, 0xE7F9FE7B),
+	uint4(0xB6C0003F, 0x3F0E0201, 0xFFFFFFFF, 0xB7007FFF), uint4(0x400001FF, 0xF03C0300, 0xB8000FC1, 0xE6799E67),
+	uint4(0x7B9EE7B9, 0xB8C0BBEE, 0x3F0F0300, 0xFFFFFFFF), uint4(0xB900FFFF, 0xCE7F1FC3, 0x8044070B, 0xB9800E01),
+	uint4(0x00000000, 0x08000000, 0xB9C0E030, 0x00000000), uint4(0x0C020000, 0xBA40E030, 0x40301C0F, 0x00000000),
+	uint4(0xBAC00000, 0xFFFFFFC0, 0xFFFFFFFF, 0xBB0001CF), uint4(0x070180E0, 0x8060300C, 0xBBC00301, 0xC0F07C3E),
+	uint4(0x00040301, 0xBC408000, 0xCFF001E0, 0xF380F83F), uint4(0xBC801FF7, 0x40201008, 0x00000000, 0xBCC00000),
+	uint4(0xFFFFFF87, 0xFFFFFFFF, 0xBD00FFFF, 0x380E0300), uint4(0x0F03C0E0, 0xBD40F83E, 0x01FFFFFF, 0x00000000),
+	uint4(0xBD80FFC0, 0x0380E038, 0xC070180E, 0xBE000701), uint4(0xFC7FBC10, 0x080301E0, 0xBE80FFC0, 0x26118461),
+	uint4(0x09826098, 0xBEC09826, 0xBFFFF3FC, 0xF07C0600), uint4(0xBF001FC3, 0xC1F03BEF, 0xC1003F0F, 0xBF803FCF),
+	uint4(0x300E0380, 0x080200C0, 0xC0000000, 0xBE0C0000), uint4(0xCFFFFFFF, 0xC040803F, 0x06011C7F, 0xCFE1F83C),
+	uint4(0xC0803FBF, 0x40707C7F, 0x08000000, 0xC100F838), uint4(0x1F0FE3FC, 0xF000C038, 0xC1408FF3, 0xCFFDFE7F),
+	uint4(0x0184470F, 0xC1801C07, 0x04010040, 0x01004010), uint4(0xC1C01004, 0xE3F3FDFF, 0x0E0F0787, 0xC200F038),
+	uint4(0xC7F7FFF9, 0xFFFBE3C3, 0xC2800FCF, 0x3F8FC3E1), uint4(0xE3FBFCFE, 0xC30003C3, 0xDFF7FCFF, 0xFFFFFFFF),
+	uint4(0xC340FFFF, 0x00000000, 0x10040000, 0xC38000C0), uint4(0x3F8FC3E0, 0xFFFFFEFF, 0xC3C07FFF, 0xFFF00000),
+	uint4(0x000C7FFF, 0xC480C000, 0x40100C07, 0x08020000), uint4(0xC5004000, 0x3FBFE7F8, 0xE0F01C01, 0xC5407F87),
+	uint4(0xFFFEFFBE, 0x0080071F, 0xC5C00C02, 0x380E0380), uint4(0x0F0380E0, 0xC600F03C, 0x380E0380, 0x0F03C0F0),
+	uint4(0xC640F83C, 0x380E0780, 0x0E0380E0, 0xC680E7F8), uint4(0x0FC3F0FC, 0xC3F0FC3F, 0xC6C03F0F, 0x00000007),
+	uint4(0xFFFFC000, 0xC700FFFF, 0xFFFFFC00, 0x000000FF), uint4(0xC7400000, 0x2030FDFF, 0xCFC3C0C0, 0xC780FFBF),
+	uint4(0xE0781E0F, 0x381E0781, 0xC7C000C0, 0xBFEFFBFE), uint4(0x10387EFF, 0xC8400080, 0x004FFFFC, 0xE7F87E07),
+	uint4(0xC880FFBF, 0xF3FBFDFF, 0xCFEFE7F7, 0xC900FFFF), uint4(0x38080000, 0xFFFBF8F8, 0xC940FFFF, 0x000003FF),
+	uint4(0xFFFC0000, 0xC980003F, 0xE7FFF7FD, 0xC8120481), uint4(0xC9C08320, 0xBFCFF3FC, 0x103C7EFF, 0xCA000000),
+	uint4(0x38080000, 0x70787878, 0xCA800040, 0x4C360D86), uint4(0x00C06018, 0xCAC08603, 0x3FFFF7FD, 0x18060100),
+	uint4(0xCB00E0F0, 0x380C0603, 0x0F83E0F0, 0xCB403E1F), uint4(0xDFF7FFFF, 0xF1FCFF3F, 0xCB800FC7, 0x80E0380E),
+	uint4(0xE0380E03, 0xCC400380, 0x00303C3F, 0x0E020000), uint4(0xCC80FC3E, 0x88421084, 0x21084220, 0xCCC01044),
+	uint4(0x1E0F07C3, 0xC1E0F87C, 0xCD400F87, 0xFFFFFBF8), uint4(0xFFFFFFFF, 0xCD80FFFF, 0xCE739DE7, 0x739CE739),
+	uint4(0xCDC039CE, 0x380C0300, 0x0F03C0E0, 0xCE40F83E), uint4(0x3F30383F, 0x000200F0, 0xCE80FF00, 0xCFF3FDFF),
+	uint4(0x01E0FE3F, 0xCF00F006, 0x3F8FE3F8, 0x81E0F87E), uint4(0xCF800603, 0x0F07C3E1, 0x8E62301C, 0xCFC0FE3E),
+	uint4(0xBFCFE3F0, 0x71FFFFFF, 0xD0400000, 0x01000020), uint4(0x00000000, 0xD080FEC0, 0x0F83E1F0, 0x73D8FE3F),
+	uint4(0xD0C03DCF, 0x06107FC7, 0x0FC3E078, 0xD100FC3F), uint4(0xFF8F870F, 0xFFFFFFFF, 0xD1C0FFFF, 0x00000001),
+	uint4(0xF0000000, 0xD200FFC1, 0x87E3F8FE, 0xE1F87E1F), uint4(0xD2400F87, 0xEFF0FC0F, 0x0E0300C7, 0xD280F03C),
+	uint4(0xF83E1F87, 0x0E0781E0, 0xD340E038, 0x804FFFF9), uint4(0xF03C0E01, 0xD3C00FC1, 0x60180E03, 0xEF820080),
+	uint4(0xD4409FEF, 0xBBEEFBBE, 0xEEFBBEEF, 0xD4C0EFBB), uint4(0x00E0783E, 0x8FF40001, 0xD500FE3F, 0xCFFFFFFF),
+	uint4(0x000C070F, 0xD5800000, 0xC7F1FC7F, 0xF7FCFF3F), uint4(0xD6007FDF, 0xCFFFFFFF, 0x0804070F, 0xD680F030),
+	uint4(0xC01FFFFE, 0xF1FC1F01, 0xD740FFDF, 0xC0000000), uint4(0x000000FF, 0xD7800000, 0x00000000, 0xCFFC0000),
+	uint4(0xD880003F, 0xC0F00FFE, 0xFFFCFF0F, 0xD900FFFF), uint4(0x1F07C1E0, 0xE7F9FC7E, 0xD940FFDF, 0x00001C7F),
+	uint4(0xFFFFF8E0, 0xD9803FFF, 0x98E6398E, 0xE6398E63), uint4(0xD9C06398, 0x00010000, 0x00002008, 0xDA000001),
+	uint4(0xC3F0FC7F, 0xFE3F1F87, 0xDA40F9FC, 0x30000403), uint4(0xFFF3F0F0, 0xDA8001C7, 0xBFFFFFFC, 0x000380FF),
+	uint4(0xDB000000, 0xC3F3F9F8, 0x000C0707, 0xDB400000), uint4(0x301C0F07, 0xFDFC0040, 0xDB80C7F3, 0x0C0300E0),
+	uint4(0x02008030, 0xDBC02008, 0x380E0300, 0x0F03C0E0), uint4(0xDC00F83C, 0x87898300, 0xE1FC7F1F, 0xDC401F07),
+	uint4(0xC0000200, 0xFFFFFFFF, 0xDCC0FFFF, 0x03C1F8FF), uint4(0x3E1FEF04, 0xDD800070, 0xE739CE73, 0x79DE779D),
+	uint4(0xDDC0DDF7, 0x1FCFF3FC, 0xC1F0FC3F, 0xDE00CF23), uint4(0x0000000F, 0xF3FFFF00, 0xDE8000C1, 0xCF7BCEF3),
+	uint4(0x71DCF77D, 0xDEC00DC7, 0x010FFFEF, 0x01C0300C), uint4(0xDF407C0F, 0xDFF3FC7F, 0x0FFFFFFF, 0xDF80F000),
+	uint4(0xDE779DE7, 0x77DDF779, 0xDFC07FDF, 0xFDFF7FDF), uint4(0x7FDFEFFB, 0xE040FDFF, 0x03EFE3E0, 0xCFC3C0C0),
+	uint4(0xE08081FF, 0xFE7F9FEF, 0x1F87E3F8, 0xE0C0F07E), uint4(0xC3F3FDFF, 0x0C0E0707, 0xE140F038, 0x3030FDFF),
+	uint4(0xFFF3F0F0, 0xE180FFFF, 0xBFEFF3FD, 0xF1FCFF7F), uint4(0xE1C087C3, 0x30000007, 0xEFE3F0F0, 0xE28003CF),
+	uint4(0xCFFFFFFF, 0x303C1F1F, 0xE3000040, 0x040F7FC7), uint4(0x0F03C070, 0xE340F03C, 0x20180E0F, 0x08020080),
+	uint4(0xE3809C28, 0x8CE338EF, 0xC330CE33, 0xE3C02308), uint4(0x00000000, 0x0FF00000, 0xE4000030, 0x3F8F83CF),
+	uint4(0xF3FFFEFF, 0xE48080C1, 0xF87E3F8F, 0x1F0FC3F1), uint4(0xE4C0F87E, 0xC0701C0F, 0x10040300, 0xE5000000),
+	uint4(0x00000007, 0x00000000, 0xE540F020, 0x06018060), uint4(0x00802008, 0xE5800802, 0xDF77F9F8, 0x338DF37C),
+	uint4(0xE5C030CE, 0x20080201, 0x08020080, 0xE6000020), uint4(0xFFFFFBF8, 0xF0FC7F3F, 0xE64001C0, 0xC4310C47),
+	uint4(0x3C0E4390, 0xE6C0E0F0, 0x38080000, 0xC0607030), uint4(0xE70001C0, 0xD8360D83, 0x330CC330, 0xE7C030CC),
+	uint4(0x00100C03, 0x00000000, 0xE8400000, 0x3C0703DF), uint4(0x0103C3F0, 0xE880F03C, 0x81E0781E, 0xE0781E07),
+	uint4(0xE9000781, 0xCFF3FFFF, 0xC1F8FF3F, 0xE9401C07), uint4(0x7FCFF3FC, 0xC0700407, 0xE9807F07, 0x30080000),
+	uint4(0x0783C0E0, 0xE9C01E0F, 0x20000003, 0xEFE3E0E0), uint4(0xEA00FFFF, 0xEFF7FBFD, 0xFE7FBFDF, 0xEA40F9FC),
+	uint4(0xFFFFE381, 0x8F00070F, 0xEA803FFF, 0x3C0F03C0), uint4(0x0F83C0F0, 0xEB00F83E, 0xE3FCFF3F, 0xF87E1F87),
+	uint4(0xEB4007E1, 0xFF8E0400, 0xFFFFFFFF, 0xEB8007FF), uint4(0x21884021, 0x22110C42, 0xEBC010CC, 0x7E1F8BE2),
+	uint4(0x0781E0F8, 0xEC40982E, 0x318C6310, 0xEF739CE6), uint4(0xECC0FFBD, 0x83F1FCFF, 0x3FDFC807, 0xED00E07C),
+	uint4(0x3F0F0300, 0xF7FFFFFF, 0xED400FCF, 0x00000C1F), uint4(0xCF830000, 0xED8007CF, 0xC3D1F47B, 0xF87C3E0F),
+	uint4(0xEDC0C7E1, 0xFFEFF3FC, 0x080C7FFF, 0xEE80E030), uint4(0x5E370DC7, 0x07C1E078, 0xEEC07E1F, 0xC1F07C1F),
+	uint4(0x703C0F03, 0xEF0001C0, 0xC1C0E070, 0x0E0F0703), uint4(0xEF803C3C, 0xFDFE7F9F, 0x8F73DEF7, 0xEFC0FC3D),
+	uint4(0x00000000, 0x08020000, 0xF000E030, 0x3C0F83E0), uint4(0x0C0380E0, 0xF0408030, 0xC1F3FFFF, 0x08000000),
+	uint4(0xF080F838, 0x6FD3F4F9, 0x240800BF, 0xF0C040D0), uint4(0x3F8FC3E0, 0x0003FFFF, 0xF100C020, 0x0E0F0381),
+	uint4(0xEFF3FB04, 0xF1801FDF, 0x3F0E0A42, 0x9CFFBFEF), uint4(0xF1C0CE73, 0x3E0F0783, 0xE3F1F8FC, 0xF2001FCF),
+	uint4(0xFFEFFBFC, 0xFFFFFFFF, 0xF240FFFF, 0x30181C0F), uint4(0x0E0380C0, 0xF280F03C, 0x7F9EE7B9, 0xF7E7F9FE),
+	uint4(0xF2C01FCF, 0xF1F83E0F, 0xFCFF3FC7, 0xF3C0FFF3), uint4(0x0F87C3C0, 0x707C3F1F, 0xF40080C0, 0x060380E0),
+	uint4(0x01806018, 0xF4400806, 0x46118461, 0x11846118), uint4(0xF4C01846, 0x00000000, 0xFFE30000, 0xF500FFFF),
+	uint4(0x00000000, 0x08000000, 0xF580C020, 0xFE10FFFF), uint4(0xFFFFFFFF, 0xF5C0FFFF, 0xBFFFFFFF, 0x0FE3FCFF),
+	uint4(0xF680F83F, 0x43D23483, 0xCEF3FC3F, 0xF6C0E73B), uint4(0x81C0F078, 0x301C0F03, 0xF7008040, 0x07C1F07C),
+	uint4(0xC1F07C1F, 0xF7401F07, 0x3FEFFFFF, 0x000200F8), uint4(0xF8400000, 0x1FE7FC00, 0xF201E07E, 0xF8803FEF),
+	uint4(0x902C0B06, 0xF0010040, 0xF8C0FFBF, 0xCFF3FDFF), uint4(0xF1FCFF3F, 0xF9001FC7, 0x8783C2C0, 0xF1FC7F1F),
+	uint4(0xF9400FC7, 0xBF8F8301, 0x00000F3F, 0xF980FFC0), uint4(0x7C1F03C0, 0x3F0FC3F0, 0xF9C0F1FC, 0x00000001),
+	uint4(0xFFFFFF00, 0xFA400FCF, 0xCFF3FCFF, 0xFBFCFF3F), uint4(0xFB003FCF, 0xFF080000, 0x0FFFFFFF, 0xFB800000),
+	uint4(0xF07C3F0F, 0x1E0787E0, 0xFBC0F0FC, 0x00002000), uint4(0x00000000, 0xFC000000, 0xFFEE0001, 0xFFFFFFFF),
+	uint4(0xFC407FFF, 0x300E03C0, 0xF0000080, 0xFC8001C7), uint4(0xDFE7C381, 0xF0FC7F3F, 0xFD4003C1, 0x00000203),
+	uint4(0x003CFF00, 0xFD800000, 0x85E1F0BC, 0x787E2F0F), uint4(0xFDC043D1, 0x38000200, 0xCFFFFFFC, 0xFE00FC3F),
+	uint4(0xDFF7FFFF, 0xF3FDFF7F, 0xFE403FCF, 0x0781E078), uint4(0x00C0300C, 0xFE800C03, 0x80C02010, 0x781C0E03),
+	uint4(0xFEC0C1F0, 0x60381C0F, 0x0E0300C0, 0xFF00F038), uint4(0x380E0380, 0x0C0380E0, 0xFF40C030, 0xC1E3E3F0),
+	uint4(0x00000000, 0xFF800000, 0x00C0310E, 0x86210883), uint4(0xFFC0781C, 0x00000000, 0x00000000, 0x00000000),
+};
+
+#define PARTITION_2_COUNT_10X10 799
+#define PARTITION_2_WORDS_10X10 4
+static const uint4 partition_2_10x10[799] =
+{
+	uint4(0xC1F07C1E, 0x701C0F03, 0xCFC3C1C0, 0x0040000F), uint4(0xC0703C0F, 0x100C0301, 0x00000040, 0x00800008),
+	uint4(0x1789E673, 0xE1F83C1F, 0x5C2F0FC3, 0x00C00008), uint4(0x380C0200, 0xC1E0F078, 0x0C070783, 0x01000000),
+	uint4(0xE0783E1F, 0x180E0381, 0x0E018020, 0x01400008), uint4(0x46018427, 0x378CE138, 0xFCE7F9DE, 0x01C00000),
+	uint4(0xC1F0FC3F, 0x703C0F07, 0x0C0301C0, 0x02000000), uint4(0x3FCFE3F0, 0xFFFFFEFF, 0xFFFFFFFF, 0x0240000F),
+	uint4(0x3FCFF3FE, 0x8FE3F8FF, 0xC3F0FC3F, 0x0280000F), uint4(0x20C06030, 0x0E030281, 0x83E0F038, 0x02C00003),
+	uint4(0xDFFFFFFF, 0xF1FCFF3F, 0x3C1F0FC3, 0x03400000), uint4(0xF87C1F0F, 0x0F83C1F0, 0xF0783E1F, 0x03800001),
+	uint4(0xBE0C0000, 0x007FFFFF, 0x00000000, 0x03C00000), uint4(0x60180601, 0x18060180, 0x06018060, 0x04000008),
+	uint4(0xC7FFFFFF, 0x00000001, 0xFC000000, 0x0440000F), uint4(0x00000007, 0x0003FF00, 0x60000000, 0x04800000),
+	uint4(0x1FC7F1FC, 0xC7F1FC7F, 0xF1FC7F1F, 0x04C00007), uint4(0x0C0300C0, 0x0300C030, 0x00C0300C, 0x05000003),
+	uint4(0x3C0E0381, 0x0F83E0F0, 0xE1F07C3E, 0x05400003), uint4(0x3F0F0781, 0xF3FBFCFE, 0x000000C1, 0x05C00000),
+	uint4(0xF0FC3F0F, 0xFC7F1FC7, 0xFF3FCFF3, 0x0600000D), uint4(0x3E0F83E7, 0x0F83E0F8, 0x83E0F83E, 0x06400003),
+	uint4(0x000003FF, 0x0FFC1F00, 0x04000000, 0x06800000), uint4(0x6338CE73, 0x9C6731CC, 0x6198C631, 0x06C00006),
+	uint4(0x3F0FC3F0, 0x0FC3F0FC, 0xC3F0FC3F, 0x0700000F), uint4(0x3F0F83E0, 0xCFE3F8FC, 0xFBFEFF3F, 0x0740000F),
+	uint4(0xF7FDFF7F, 0xFCFF3FCF, 0xFF3FCFF3, 0x0780000C), uint4(0xBC2F0BC2, 0x2F0BC2F0, 0x0BC2F0BC, 0x07C0000F),
+	uint4(0x08020080, 0x02008020, 0x00802008, 0x08000002), uint4(0x20000007, 0xFFFFFFFF, 0x3FFFFFFF, 0x08400000),
+	uint4(0x00000000, 0x00000000, 0x03008000, 0x0880000C), uint4(0x3FFFFC00, 0x00000000, 0x00000000, 0x09000000),
+	uint4(0xA1F87E1F, 0xE0381E07, 0x300C0300, 0x09400000), uint4(0xFDFF7FDF, 0x0003FFFF, 0x40100000, 0x09C00000),
+	uint4(0xFFF00007, 0x0003FFFF, 0x7FFF0000, 0x0A800000), uint4(0x3F8FF3FE, 0x0F03E0FC, 0x0200C038, 0x0AC00000),
+	uint4(0x3C0F03C0, 0xFF07C0F0, 0x03C0103C, 0x0B00000F), uint4(0xC0F0783E, 0x08060381, 0x0300C030, 0x0B40000C),
+	uint4(0xC00FFFFF, 0xFFFFFFFF, 0x03FFFFFF, 0x0B800000), uint4(0x77CDF27C, 0xFDFF7FDF, 0x0400003F, 0x0BC00002),
+	uint4(0x01004010, 0x00401004, 0x40100401, 0x0C000000), uint4(0x78180C07, 0xCFE3E0F0, 0xFCFF7F9F, 0x0C400001),
+	uint4(0x3E0F0380, 0xFFFFFCFE, 0xFEFF7FFF, 0x0C800001), uint4(0x22098060, 0x0E8320C8, 0x83C0F83A, 0x0CC0000F),
+	uint4(0xFFFFFDFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x0D00000F), uint4(0xBFEFF800, 0xE3F9FEFF, 0x181E0F87, 0x0D400000),
+	uint4(0xCFFFFBF9, 0xCFCFCFCF, 0x7E7F7FFF, 0x0D80000E), uint4(0x00020001, 0x00800010, 0x00000400, 0x0DC00000),
+	uint4(0x20000C0F, 0x0F0380C0, 0xF3F8FC3E, 0x0E00000F), uint4(0x0780C3DF, 0x0400FE1F, 0xEFE3F058, 0x0E80000F),
+	uint4(0x301C0200, 0x0100C060, 0x20100402, 0x0EC00000), uint4(0x00000000, 0xFFFC0000, 0xFFFFFFFF, 0x0F00000F),
+	uint4(0xC0701C0F, 0x00040100, 0x03000000, 0x0F40000E), uint4(0xFBFEFC00, 0xF8FF3FCF, 0x701E07A1, 0x0F800000),
+	uint4(0xBFCFC3C0, 0x0000010F, 0x00000000, 0x0FC00000), uint4(0x00000404, 0x00000000, 0xC1C0E020, 0x10400001),
+	uint4(0xE1F83E0F, 0xFC7F1F87, 0xFF9FE7F1, 0x1080000E), uint4(0x0781E078, 0x81E0781E, 0xE0781E07, 0x10C00001),
+	uint4(0xE0F83E1F, 0x7C1F0783, 0x0F03C1F0, 0x1100000C), uint4(0xC3F3FDFF, 0x000C0707, 0xFC0F0040, 0x11400001),
+	uint4(0x00303838, 0x00000000, 0x00000000, 0x11800000), uint4(0xBBECFA7E, 0xEF3BDEE7, 0xD9F67B9E, 0x11C00003),
+	uint4(0xC3F1FCFF, 0x301C0F07, 0x00000040, 0x12000000), uint4(0x1FE7FDFC, 0x0781F07E, 0x0000401C, 0x12400004),
+	uint4(0x80402000, 0x00000100, 0x00000000, 0x12800008), uint4(0x07030180, 0x30180C0E, 0x00000040, 0x12C00008),
+	uint4(0xBFCFF3F8, 0x0C020007, 0x83C0F038, 0x1300000F), uint4(0x0F03C0F8, 0x0300E038, 0xFC00200C, 0x1340000F),
+	uint4(0xFFF00000, 0xFFFFFFFF, 0x0000003F, 0x13800000), uint4(0x3F8FA3E8, 0x4FC3F0FC, 0xD9F67D3F, 0x13C00007),
+	uint4(0xFFFFFFFF, 0xFFFFFFFF, 0x0000FFFF, 0x14400000), uint4(0x00000000, 0xFFFC0000, 0x0000FFFF, 0x14800000),
+	uint4(0xBDEF7BDE, 0xCE7B9EF7, 0x739CE739, 0x14C0000E), uint4(0x40100401, 0x10040100, 0x04010040, 0x15000000),
+	uint4(0xDFF7FDFF, 0xF7FDFF7F, 0xFDFF7FDF, 0x15400007), uint4(0xC3F0F87E, 0xF07C1F0F, 0x3E0F83C1, 0x15800008),
+	uint4(0x084210C4, 0x70000020, 0xDEF7FDFF, 0x15C0000B), uint4(0xF03C1F87, 0x00060180, 0xFBFFFFC0, 0x16000007),
+	uint4(0x2008067F, 0x3C0700C0, 0x3F87E0F8, 0x1640000F), uint4(0xE7FFFD80, 0xF07C3F0F, 0x0C0701C0, 0x16800000),
+	uint4(0xC3F0FC7F, 0xF03C1F07, 0x0C0701C0, 0x16C00000), uint4(0xBFEFFBFE, 0xEFFBFEFF, 0xF87E3F9F, 0x17000000),
+	uint4(0x3FEFFC00, 0xF00200F8, 0x03F0FFFF, 0x1780000C), uint4(0x004FEFF9, 0xE0781E03, 0xFCFF1FC3, 0x17C00007),
+	uint4(0xCFF3FDFF, 0xF9FEFFBF, 0xFF7FDFE7, 0x1840000C), uint4(0xC3F1F9FC, 0x00040303, 0x0380C020, 0x1880000F),
+	uint4(0x21C8721C, 0x80601C87, 0x60180601, 0x18C00000), uint4(0x1F81C007, 0xFFFFFEFF, 0x3FFFFFFF, 0x19000000),
+	uint4(0xC1F33DC7, 0x030C4707, 0x03C0F01C, 0x1940000F), uint4(0x00000000, 0xF0000000, 0x0000003F, 0x19800000),
+	uint4(0x01806018, 0x80601806, 0x60180601, 0x19C00000), uint4(0xC3F1FCFF, 0x301C0F07, 0x8380C040, 0x1A40000F),
+	uint4(0xC0703C1F, 0x08000100, 0x0380E030, 0x1AC0000F), uint4(0xF1F0FC7F, 0x1F8FC7E3, 0xFFFEFE3F, 0x1B000007),
+	uint4(0x7C1F0F87, 0x0F03C0F0, 0x80E0781C, 0x1B400001), uint4(0x3F07C013, 0x003CF0FC, 0xC3F0FC0F, 0x1B800007),
+	uint4(0xC3F0FC7F, 0xE03C1F07, 0xEC000100, 0x1BC0000F), uint4(0x00000403, 0x00000000, 0x00000000, 0x1C00000E),
+	uint4(0x300C0300, 0x3C0700C0, 0x7F0FC1F0, 0x1C40000C), uint4(0xCFF7FFFF, 0x303C1F0F, 0x00000040, 0x1C800000),
+	uint4(0x9FC7E1FC, 0x338DF27C, 0x06C1B0CE, 0x1CC0000E), uint4(0xF03C0700, 0xFC7F0FC1, 0x0000DFF3, 0x1D000004),
+	uint4(0x00000000, 0xF0000000, 0xFFFFFFFF, 0x1D80000F), uint4(0x380C0603, 0x0180C060, 0x72188C07, 0x1DC0000C),
+	uint4(0x000FFFFF, 0x00000000, 0x00000000, 0x1E000000), uint4(0xC3F8FC3F, 0xF0F83809, 0xFC3F0FC3, 0x1E400000),
+	uint4(0xFC7FBC10, 0x180F03E1, 0xE1FCFFC0, 0x1E800007), uint4(0xF9FE7F9F, 0xFE7F9FE7, 0x7F9FE7F9, 0x1EC0000E),
+	uint4(0x000FFFFF, 0xEC000000, 0xFFFFFFFF, 0x1F00000F), uint4(0x00001C1F, 0x0E020000, 0xFFFFFF3F, 0x1F40000F),
+	uint4(0xF8FC7E1F, 0xFFBFCFF3, 0x1004003F, 0x20000000), uint4(0xC1F07C1F, 0x7C3E0F03, 0xF3F4F9BC, 0x2040000F),
+	uint4(0x0C080003, 0x00040404, 0x08081810, 0x20800000), uint4(0x3E0784E3, 0x0F83E0F8, 0xDC63385E, 0x20C00000),
+	uint4(0x3FFFFFFF, 0x00000000, 0xFFFF07C0, 0x2100000F), uint4(0xC1C0403F, 0xFF9F8F83, 0x07030080, 0x2180000F),
+	uint4(0x008002FF, 0x98E21886, 0xFEFB9EE3, 0x21C0000B), uint4(0x00000000, 0xFFFFFF00, 0x0000003F, 0x22000000),
+	uint4(0x3C0F0380, 0x8FC3F0F8, 0xFBFCFF3F, 0x22400003), uint4(0x00101479, 0x0F038080, 0x00063F3F, 0x22800000),
+	uint4(0x3C8C300E, 0x7F3FEEFC, 0x1E07C1F8, 0x22C00000), uint4(0x20100C07, 0x8381C0E0, 0x1C1F0F07, 0x23800000),
+	uint4(0xE1F07C1F, 0xE87E1F87, 0x7B1EC7A1, 0x23C0000C), uint4(0x03038180, 0x000C0607, 0x00000000, 0x24000000),
+	uint4(0xC7F1FC7F, 0xF1FC7F1F, 0xF87F1FC7, 0x24400001), uint4(0xFFCF8300, 0x0000003F, 0xFFF8F000, 0x2480000F),
+	uint4(0xF9FCFE7F, 0xF3FFEFF7, 0x040200C1, 0x24C00000), uint4(0xC0F07C3F, 0x100C0701, 0xFBFF0000, 0x2500000F),
+	uint4(0x20000000, 0x8FC3C0E0, 0xFFFFFFBF, 0x2540000F), uint4(0xFFFFFC00, 0x007FFFFF, 0xFFFFFFFE, 0x2580000F),
+	uint4(0x3B2E8BC2, 0xFE7FBEEF, 0x719CE7B9, 0x25C00006), uint4(0xFFFFFFFF, 0xFFFFFFFF, 0x0000003F, 0x26000000),
+	uint4(0x3E0FC3F0, 0x0F03E0F8, 0x0380F03C, 0x2640000E), uint4(0x380C0300, 0x0F83C0F0, 0xF0F83C1F, 0x26800001),
+	uint4(0x3E0F83E0, 0x0F83E0F8, 0x84E0783E, 0x26C00001), uint4(0x3C0F83F0, 0x080300E0, 0x00000000, 0x27000000),
+	uint4(0x9FE7F8FE, 0xEFFBFEFF, 0xF87E3F9F, 0x27400000), uint4(0x3E0F87EE, 0x0383E0F8, 0x83E3FB02, 0x2780000F),
+	uint4(0xFC3C1C07, 0x8FFBF9F8, 0x0380F83F, 0x27C00008), uint4(0xC7FFFFFF, 0xF0000001, 0xFFFFFFFF, 0x2840000F),
+	uint4(0x100DFF3F, 0x1C0300C0, 0x3F07C0F0, 0x2940000C), uint4(0xC7E1F0F8, 0xFE7F1F8F, 0xEFF3F9FC, 0x29C0000F),
+	uint4(0x7F9FCFE7, 0xEFF3FCFE, 0xFDFFFFFF, 0x2A000007), uint4(0x000FEFF9, 0x80E01802, 0xE1F83E07, 0x2A40000F),
+	uint4(0x878F0300, 0x00000000, 0x31F0E020, 0x2A800000), uint4(0x20000C1F, 0x0C030080, 0x83C0F038, 0x2AC0000F),
+	uint4(0x7F700060, 0xCFE3F8FC, 0xFBFEFF3F, 0x2B00000F), uint4(0x0381C0E0, 0x1C1E0F07, 0xE0F07038, 0x2B800001),
+	uint4(0x000FFFEF, 0x11846008, 0x9DE738CE, 0x2BC0000F), uint4(0xC7FFFFFF, 0x00000001, 0xFC030000, 0x2C000000),
+	uint4(0x40200804, 0x08020180, 0x0180C030, 0x2C400006), uint4(0x000FFBFF, 0x00000000, 0x03FFFFC0, 0x2C800008),
+	uint4(0xC1F07C1F, 0xF07C1F07, 0x7C1F07C1, 0x2CC00000), uint4(0x00000000, 0x00000000, 0x03008020, 0x2D00000E),
+	uint4(0x00000001, 0x0F030000, 0x041F3FBF, 0x2D400000), uint4(0x3FFFFFFF, 0x00000000, 0x0C010000, 0x2D800008),
+	uint4(0x80C0300C, 0x683A0E83, 0x1A0681A0, 0x2DC00008), uint4(0xF0FC3E0F, 0xF33D8FE3, 0x3C0F0BC4, 0x2E000000),
+	uint4(0xDFF7FCFF, 0xFFFFFFFF, 0x0400003F, 0x2E400000), uint4(0xFFFFFFFF, 0xF3FDFFFF, 0x3C1F0FC7, 0x2F000000),
+	uint4(0x3FFFFFFF, 0xFFF80000, 0xFFFFFFFF, 0x2F800003), uint4(0x0380F03C, 0x00C0300E, 0x00000802, 0x2FC0000C),
+	uint4(0x0E0380C0, 0x0380E038, 0xC0F03C0E, 0x30400003), uint4(0xFFEFF3F8, 0x003CFFFF, 0xFFFFFFFC, 0x30800007),
+	uint4(0x799E6799, 0x9EE7B9EE, 0xEFBBEEFB, 0x30C0000E), uint4(0xC3E0F83E, 0xF0FC3F0F, 0xFC3F0FC3, 0x31000000),
+	uint4(0xBFFFFFFF, 0x0F83F8FF, 0x00008038, 0x31800000), uint4(0xD9EC721D, 0x731CCF63, 0xEC731CC6, 0x31C00000),
+	uint4(0xCFF3FDFF, 0xF0FC3F1F, 0x1C0F03C1, 0x32000000), uint4(0x00000000, 0xFFFFFF00, 0xE3FCFFBF, 0x3240000F),
+	uint4(0x3FF00000, 0x00000000, 0x00000000, 0x3280000F), uint4(0xFDF00010, 0xFE7F9FF7, 0x3E0FC3F0, 0x32C00000),
+	uint4(0x60180E07, 0x08020080, 0xFEFF0000, 0x33000009), uint4(0x0000000F, 0xF3FC0000, 0x000000C1, 0x33800000),
+	uint4(0xC7F0FC1F, 0x0000007F, 0x00000000, 0x33C00000), uint4(0x40100C07, 0x0E020000, 0xFDFEFE3E, 0x34000007),
+	uint4(0x3F8FE3F8, 0x8FE3F8FE, 0xE0783E1F, 0x34400000), uint4(0x9FF7FFFF, 0x01E0FC3F, 0x7FFF0807, 0x3480000E),
+	uint4(0xB8CE3308, 0xFFBFCEF3, 0x230081E2, 0x34C0000C), uint4(0x00000000, 0x08000000, 0x01000020, 0x35000004),
+	uint4(0x380C0606, 0x8FC3E0F0, 0xFDFEFF3F, 0x35400001), uint4(0xCFF7E3C0, 0x007F9F0F, 0x02000040, 0x3580000F),
+	uint4(0x18C67198, 0xE731CC63, 0x98CE338C, 0x35C00003), uint4(0x40100802, 0x00000100, 0x02008000, 0x36000008),
+	uint4(0xC0703C1F, 0x00040300, 0x02000000, 0x36400008), uint4(0xFF8E0000, 0x080000FF, 0x03FFFF3E, 0x36800000),
+	uint4(0x10040100, 0x04010040, 0x01004010, 0x36C00004), uint4(0x000C03C0, 0xFFFFF8C0, 0xFDFF7FFF, 0x37000007),
+	uint4(0x300C0300, 0x0C0300C0, 0x0300C030, 0x3740000C), uint4(0xF9FC7F3F, 0x1F8FC7E3, 0xE3F0FC7E, 0x3780000F),
+	uint4(0xC0703C1F, 0x00040301, 0x00000000, 0x37C00000), uint4(0xC3F3FDFF, 0x000C0707, 0x02000000, 0x3800000C),
+	uint4(0x3F0F83C3, 0xFFFBFCFE, 0xFCFFFFFF, 0x38400000), uint4(0x3F8F83C0, 0xFFFFFFFF, 0x3C1F1FCF, 0x38800000),
+	uint4(0xC0301806, 0x00040100, 0x03008020, 0x38C0000C), uint4(0x180E0703, 0x0180E070, 0x30180E07, 0x39400000),
+	uint4(0x180C0001, 0x60303018, 0x03000040, 0x39800006), uint4(0x3FFFEFF3, 0x10040100, 0x0381C060, 0x39C0000F),
+	uint4(0xDFF00C01, 0xFFFFFFFF, 0x0C1F7FFF, 0x3A000000), uint4(0x3E0F07A1, 0xE331C87C, 0x0F07A1CC, 0x3AC0000E),
+	uint4(0x0100C030, 0x700C1104, 0xDC1701C0, 0x3B000000), uint4(0x00000003, 0x00000000, 0x00000000, 0x3B400000),
+	uint4(0x3FCFF3FC, 0xCFF3FCFF, 0xF3FCFF3F, 0x3B80000F), uint4(0xC1F07C1F, 0xF87E1F07, 0x3F0F83E0, 0x3BC0000C),
+	uint4(0xE0F81E03, 0xF9FE3F87, 0xFE7F3FCF, 0x3C000008), uint4(0xFFFFFFFF, 0x0FFFFFFF, 0xFC1F01C0, 0x3C800003),
+	uint4(0xC1F07C1F, 0x4E3E0F03, 0x0FF6FE3E, 0x3D40000F), uint4(0x000003FF, 0xF0000000, 0xFFFFFFFF, 0x3D80000F),
+	uint4(0xBFCFC3E1, 0x103C7FFF, 0x03008000, 0x3DC0000E), uint4(0xF8FC3F0F, 0xFF3FCFE3, 0x0000FBFE, 0x3E000000),
+	uint4(0xE7F9FF7F, 0xC1F87E1F, 0xE0781F07, 0x3E400001), uint4(0xE0F00C06, 0x3803FF9F, 0x7E7F87E0, 0x3E800004),
+	uint4(0xC1F00001, 0xFFFFFFFF, 0x0C1F7FFF, 0x3F000000), uint4(0xDFF7F1F0, 0xE7FDFF7F, 0xC1F87F1F, 0x3F400007),
+	uint4(0x001078F0, 0x00000000, 0x83000000, 0x3F800007), uint4(0x43C0F07C, 0xD4351D47, 0x0F07C1D0, 0x3FC0000C),
+	uint4(0x3FFFFFFF, 0x00000000, 0x00000000, 0x40000000), uint4(0x0040100C, 0xCFF7FD00, 0xF3FCFF3F, 0x4040000F),
+	uint4(0xFE7C3C1F, 0x00000006, 0x03000000, 0x4080000F), uint4(0x380C0E0F, 0x8FC3E0F0, 0xFFFEFF3F, 0x4100000F),
+	uint4(0x300E03C0, 0x00000080, 0xFC000000, 0x4140000F), uint4(0x07C1FC7E, 0xF0FF3088, 0xF3A00F03, 0x4180000C),
+	uint4(0x0F03C0F0, 0x03C0F03C, 0xC0F03C0F, 0x41C00003), uint4(0x380803FF, 0xFFF3F0F8, 0xFFFFFFFF, 0x4200000F),
+	uint4(0x000FFDFF, 0x0C020080, 0x0FC1E078, 0x4240000F), uint4(0x80601806, 0x60180601, 0x18060180, 0x42800000),
+	uint4(0x00010040, 0x00802008, 0x40100002, 0x42C00000), uint4(0x3800040F, 0xFFFFFEFC, 0x000001C7, 0x4380000E),
+	uint4(0xFC7F1FC6, 0x370DC3F1, 0x05C170DC, 0x43C00003), uint4(0x000FFFFF, 0xFFFFFF00, 0xFFFFFFFF, 0x4400000F),
+	uint4(0x1E07C1F8, 0x0601C078, 0xFFFF4018, 0x4440000F), uint4(0x3C0F03C0, 0x0F03C0F0, 0x03C0F03C, 0x4480000F),
+	uint4(0xC0300400, 0xF07C0F01, 0xFCFF1FC3, 0x44C00007), uint4(0xFFFFFC00, 0xFFFFFFFF, 0x060F0FCF, 0x4500000E),
+	uint4(0x300C0360, 0x01804000, 0xE0701C06, 0x45400001), uint4(0xC1F07B30, 0xCFA31F07, 0x1C0703F8, 0x45800008),
+	uint4(0xC1E0781C, 0x7C1E0F83, 0x0F83E0F0, 0x45C0000F), uint4(0x00000000, 0x00000000, 0x03FFFFFF, 0x46000000),
+	uint4(0x1F87E1FC, 0x87E1F87E, 0xC1F07E1F, 0x46400007), uint4(0x0E0381E0, 0x0380E038, 0x80601806, 0x46800001),
+	uint4(0xFFEFF3F8, 0xFFFFFFFF, 0xFFFFFFFF, 0x46C0000F), uint4(0xCFFFFFFE, 0x303C1F1F, 0x00000040, 0x47000000),
+	uint4(0x3E0FC3F0, 0x0F03C0F8, 0x0300E038, 0x4780000C), uint4(0x180E0300, 0x0180C030, 0x60100C06, 0x47C00000),
+	uint4(0x3E0F83C0, 0x0FC3F0F8, 0xE3F8FE3F, 0x4840000F), uint4(0xA7C9F0F9, 0xFE7F1ECF, 0x8FE7F1F8, 0x48C00007),
+	uint4(0x0701C0F0, 0x0040300C, 0xDFFFFFC1, 0x4900000F), uint4(0x3C0FC3FC, 0xF3FC00C0, 0x000000C1, 0x49400000),
+	uint4(0x00000001, 0x00000000, 0x8380C020, 0x4980000F), uint4(0xE1F0BC7F, 0x1C1F0781, 0x84C06098, 0x49C00003),
+	uint4(0xCFFFFFFF, 0x383C1F1F, 0xE3E0F070, 0x4A00000F), uint4(0x000007FF, 0x0C020080, 0x038067F0, 0x4A80000F),
+	uint4(0x9C6E1B86, 0x370DC771, 0x8CE338DE, 0x4AC00003), uint4(0x30080200, 0x0F0380E0, 0xE3F0F83E, 0x4B00000F),
+	uint4(0x2000040F, 0xF1FFF8F0, 0xC3800000, 0x4B80000F), uint4(0x200F03FC, 0x00000000, 0xF3FF0000, 0x4BC0000F),
+	uint4(0xC3FEFFBF, 0x03004011, 0xC1E0380E, 0x4C000007), uint4(0xDFEFFBFD, 0xF07C7F3F, 0x060381C0, 0x4C40000C),
+	uint4(0x030C83C0, 0xF07C1F0F, 0x3E0F03C1, 0x4C80000E), uint4(0xDFE7F9FC, 0x0000007F, 0x0781C010, 0x4CC0000E),
+	uint4(0xCFFFFC00, 0x3C3E1F9F, 0x0380E070, 0x4D40000F), uint4(0x00000000, 0x08020000, 0x03008020, 0x4D80000C),
+	uint4(0x380C0300, 0x0F83C0F0, 0x70383C1F, 0x4E400000), uint4(0xBFF00000, 0x0F03F0FF, 0xFFFF0020, 0x4E80000F),
+	uint4(0x3E0F83F0, 0x0F03C0F8, 0x0380E03C, 0x4F00000E), uint4(0x380C0201, 0x0F83C0E0, 0xF3F8FE3F, 0x4F40000F),
+	uint4(0xCFF0FC1F, 0xFFFFFF7F, 0x0000FFFF, 0x4F800000), uint4(0xE6318C62, 0x18CE2388, 0xC6318C63, 0x4FC0000C),
+	uint4(0x3F8FE3F8, 0x8FE3F8FE, 0xE3F8FE3F, 0x5040000F), uint4(0x40100C0F, 0x0C020000, 0x83C0E038, 0x50C0000F),
+	uint4(0x40707C7F, 0x00000000, 0x00000000, 0x51000000), uint4(0x20000403, 0x030180C0, 0x60301806, 0x51400000),
+	uint4(0x01FFFF80, 0x00000000, 0xFFFFFF80, 0x51800000), uint4(0x2789E27C, 0xC8F27C9E, 0xFB3C8FA3, 0x51C0000C),
+	uint4(0xFF7F9FEF, 0x8FE7F1FC, 0xF3FCFF3F, 0x5240000F), uint4(0xE0703C1F, 0x0F0381C0, 0xE1F0783E, 0x52800003),
+	uint4(0x3E0F83C0, 0x0FC3F0F8, 0xE0F83C1F, 0x52C00001), uint4(0xE1F07C1F, 0x7C3F0F83, 0x0FC7E1F8, 0x5300000F),
+	uint4(0x000003FF, 0x00000000, 0x00000000, 0x53400000), uint4(0x3048120C, 0x2C1B04C1, 0x09826090, 0x53C00006),
+	uint4(0xE1F07C1E, 0x7F1F8FC3, 0x6C737DFE, 0x54400000), uint4(0xC0703C1F, 0x100C0301, 0x00000040, 0x5480000C),
+	uint4(0x060184C1, 0x8862300C, 0x130CC231, 0x54C0000E), uint4(0x781E0F03, 0x0781C0F0, 0xE0781C0E, 0x55400000),
+	uint4(0x3C0FFFFF, 0xFFFFFF80, 0x3F181FCF, 0x55800000), uint4(0xC7F3FFFF, 0x978FCFC7, 0x04070787, 0x55C00000),
+	uint4(0x04010040, 0x00000010, 0x0380C020, 0x5600000D), uint4(0x2380E070, 0xEC7B1C8F, 0x1FCFE3F8, 0x56C0000F),
+	uint4(0xFE3F1F87, 0xEFF7F9FC, 0xFFFFFFFF, 0x57000007), uint4(0x00000003, 0x0E020000, 0x3C3E1E1E, 0x57400000),
+	uint4(0x380E0300, 0x0783C0F0, 0xE0F07C1E, 0x57800003), uint4(0x07C01C04, 0xEFFBFEFF, 0xFDFEFFBF, 0x57C00003),
+	uint4(0xC01FFFFE, 0xF0FC1F01, 0xFFFFFFCF, 0x5800000F), uint4(0x3E0F83C0, 0x8FE3F0FC, 0xFBFCFF3F, 0x5840000F),
+	uint4(0xF8783C1C, 0x003BF9F8, 0xF1F07030, 0x58800003), uint4(0xCCF73DCF, 0xF0BC6F1B, 0x1C0F07C0, 0x58C00000),
+	uint4(0xC7FFFFFF, 0x00000001, 0xFFFF0000, 0x5900000F), uint4(0xFFFFFFFF, 0xFFFFFFFF, 0xFDFF7FFF, 0x59400007),
+	uint4(0xE7F9FE7F, 0xF9FE7F9F, 0xFE7F9FE7, 0x59800009), uint4(0xA1E87A1E, 0xE87A1E87, 0x7A1E87A1, 0x59C00008),
+	uint4(0xFFFFFFFF, 0xFFFFFFFF, 0xFDFF7FFF, 0x5A00000F), uint4(0xBF8FC3C0, 0xFFFFFFFF, 0xFFFFFFFF, 0x5A40000F),
+	uint4(0x8060180E, 0x301C0701, 0x0C0300C0, 0x5A800000), uint4(0x20C8320C, 0xC8320C83, 0x12048120, 0x5AC00008),
+	uint4(0x00001C1F, 0x00000000, 0x02000000, 0x5B40000E), uint4(0xFFEFE3F0, 0xFFFFFFFF, 0xFFFFFFFF, 0x5B800003),
+	uint4(0xC0000007, 0xFFFFFFFF, 0x3FFFFFFF, 0x5BC00000), uint4(0xE0100407, 0x7E0F83C0, 0x3FE7F9FC, 0x5C000000),
+	uint4(0xFF8F027F, 0x0003FFFF, 0xFC7F01C0, 0x5C80000F), uint4(0x2308C230, 0x08C2308C, 0xC2308C23, 0x5CC00008),
+	uint4(0x00000003, 0xFFFC0000, 0xFCFFFFFF, 0x5D400008), uint4(0xFFFFFFFF, 0x70000007, 0xFCFF07C0, 0x5D80000F),
+	uint4(0xE739CE73, 0x18CE338C, 0xC6318C63, 0x5DC00008), uint4(0x180C0603, 0x80C06030, 0x0C060301, 0x5E000008),
+	uint4(0x00001C1F, 0x00000000, 0xFFFF0000, 0x5E40000F), uint4(0xBF8F8380, 0xFFFFFFFF, 0x3C3F3FFF, 0x5E800000),
+	uint4(0xFE004018, 0xFC3F9FF7, 0x380F03E0, 0x5F000000), uint4(0x20000000, 0x030180C0, 0x30180C06, 0x5F400000),
+	uint4(0x00000000, 0x00000000, 0x0380C020, 0x6040000F), uint4(0x3F0F0E07, 0xFCFC7F7F, 0x0000FEFE, 0x60800008),
+	uint4(0xEFBBEEF9, 0x401000FE, 0x320C8120, 0x60C0000C), uint4(0x3F8FC3E1, 0xF1F8FC7F, 0x1C0F07C3, 0x61000000),
+	uint4(0x30000000, 0xFFF3F0F0, 0xFFFFFFFF, 0x6140000F), uint4(0x00001FFF, 0xFFFFFFF0, 0xF30FFFFF, 0x61800003),
+	uint4(0x380E0300, 0x0701C060, 0x80E0380C, 0x61C00001), uint4(0x3FFFFBF8, 0x00000000, 0x04010000, 0x62000000),
+	uint4(0x81C0F03C, 0xE0781E07, 0x3C1F07C1, 0x62400000), uint4(0xE1F07C3F, 0x1E0F07C3, 0xC3F0F87C, 0x6280000F),
+	uint4(0xC00180F0, 0x381F0FE7, 0x00000040, 0x62C00000), uint4(0x08120401, 0x01004000, 0x00200800, 0x63C00000),
+	uint4(0x00000000, 0xFFFFFF00, 0x0000FFFF, 0x64000000), uint4(0x000F83FF, 0x00000000, 0x00000000, 0x64800000),
+	uint4(0x3F8FE3F0, 0xEFFBFCFF, 0x0401007F, 0x64C00000), uint4(0x07C07005, 0xCFF3FCFF, 0x040C0F0F, 0x65000000),
+	uint4(0x10080403, 0x01008060, 0x30180C06, 0x65400000), uint4(0x701C0E03, 0x060180C0, 0x00403008, 0x65C00000),
+	uint4(0x00000020, 0x00000400, 0x00000000, 0x66400000), uint4(0x380F03E0, 0x080300E0, 0x00000020, 0x66800000),
+	uint4(0x0C110C0F, 0x3F05C070, 0x3FC7F0FC, 0x66C0000F), uint4(0x07C1F03C, 0xC1F07C1F, 0xF0FC3F07, 0x67000003),
+	uint4(0x000FFFFF, 0xFFFC0000, 0x03FFFFFF, 0x67800000), uint4(0x40301C0F, 0x00000000, 0x03008000, 0x67C0000F),
+	uint4(0xDFF7FDFF, 0xF7FDFF7F, 0xF9FF7FDF, 0x68400007), uint4(0x3F0F8380, 0x003C7EFE, 0x03000000, 0x6880000E),
+	uint4(0xCDF27CBE, 0x118C6713, 0xE0381C47, 0x68C00008), uint4(0x00000000, 0x00000000, 0x1CFFFFBC, 0x69000000),
+	uint4(0xC3F1FCFF, 0x301C0F07, 0xF3E0C040, 0x6940000F), uint4(0x3E0F0787, 0xF0F87C7E, 0x000101C0, 0x69800008),
+	uint4(0x00000003, 0xFFFFF8E0, 0x0C3F7FFF, 0x69C00000), uint4(0xCFF7FFFE, 0xF07C3F1F, 0x060301C0, 0x6A00000F),
+	uint4(0x3FFFFFFF, 0x00000000, 0x04000000, 0x6A400000), uint4(0x3F8F8FDF, 0xFFFFFEFF, 0x000307CF, 0x6A800000),
+	uint4(0x000FFFFF, 0x00000000, 0xFFFF0000, 0x6AC0000F), uint4(0xFFFFFC00, 0xFFFFFFFF, 0x0000FFFF, 0x6B000000),
+	uint4(0xE0F83C1F, 0x7C1F0783, 0x0F83C1F0, 0x6B40000E), uint4(0x0FEFFFFF, 0x0E07E70E, 0x00000020, 0x6B800000),
+	uint4(0xF1F07C1F, 0x7FBFCFE3, 0x0C06003F, 0x6C000000), uint4(0xDFF7F9FE, 0xF7FDFF7F, 0x0100003F, 0x6C400004),
+	uint4(0x2008021F, 0x08020080, 0x3E008020, 0x6D000008), uint4(0x0000080C, 0x00000000, 0x00000000, 0x6D400008),
+	uint4(0xC3F1F2C0, 0x3F1C0F07, 0x0000807F, 0x6D800000), uint4(0xFDFEFF7F, 0x9FCFE7F3, 0xFBFCFE3F, 0x6DC0000F),
+	uint4(0x40201008, 0x04020000, 0x60301008, 0x6E000000), uint4(0x0000040F, 0x00000000, 0x00000000, 0x6E400000),
+	uint4(0xFFFFFFFF, 0x103C7FFF, 0x00000000, 0x6EC00000), uint4(0xC7F3FCFF, 0xF1FC7F1F, 0xFC3F0FC7, 0x6F000000),
+	uint4(0x0E009C1F, 0x0F83E078, 0x83E0F83E, 0x6F40000F), uint4(0x0000FFFF, 0x00000000, 0x007F0FC0, 0x6F800000),
+	uint4(0xDC7F1FC7, 0x378DE779, 0xCCF338DE, 0x6FC00003), uint4(0xDFFFFEFF, 0xF9FEFFBF, 0x3E1F8FE3, 0x70400008),
+	uint4(0x000FC000, 0xF0000000, 0x0000003F, 0x70800000), uint4(0xDC771DC7, 0x771DC771, 0x1DC771DC, 0x70C00007),
+	uint4(0xC0F07C3F, 0x00040301, 0x00000000, 0x71000000), uint4(0xE7FFFFFF, 0xEFE3E0E1, 0xFFFFFFFF, 0x7140000F),
+	uint4(0x300C0300, 0x1C0701C0, 0x0F03C070, 0x7180000C), uint4(0xFE3F9FE7, 0x0F87E1F8, 0x81E0783E, 0x71C00003),
+	uint4(0xC3F0F038, 0xF0FC3F0F, 0x43988781, 0x7280000F), uint4(0xFFFFFFFF, 0xFFFFFFFF, 0xFC00FFFF, 0x72C0000F),
+	uint4(0x00000406, 0x00000000, 0xFC000000, 0x7340000D), uint4(0xCFE3F9FE, 0xF3FCFF3F, 0xFC7F1FC7, 0x73800001),
+	uint4(0x07C3F5F9, 0xE8F83C1F, 0x3E0E87A1, 0x73C0000C), uint4(0xDBF2FC7F, 0xFE3F9F67, 0x0F87E1F8, 0x7440000E),
+	uint4(0x3FFFFC00, 0x00000000, 0xFFFFFFC0, 0x7480000F), uint4(0x00000000, 0xF0000000, 0xFE7FBFDF, 0x7540000C),
+	uint4(0x200FF3FF, 0x00000000, 0xFFFCF020, 0x7580000F), uint4(0x3F0FC3E3, 0xCFF3F8FE, 0x3C3E1F9F, 0x75C00000),
+	uint4(0x00000000, 0xCFC3C0C0, 0xFFFFFFFF, 0x7640000F), uint4(0x00303C3F, 0xFFFC0000, 0xF1FEFFFF, 0x76800001),
+	uint4(0x0010FFFF, 0x08020000, 0x83C0E030, 0x76C0000F), uint4(0xC0701C03, 0xF07C0F03, 0xFC3F0FC1, 0x77000001),
+	uint4(0x3F8FEC1C, 0x0FC3F0FE, 0x83E3000F, 0x7780000F), uint4(0xC0000000, 0xFCFFBFEF, 0xFE3F8FF3, 0x77C00008),
+	uint4(0x000003FF, 0xFFFC0000, 0xFFFFFFFF, 0x7800000F), uint4(0x00000C0F, 0x00000000, 0x03008000, 0x7840000F),
+	uint4(0x00001C78, 0xFFFC0000, 0xC3873FFF, 0x7880000F), uint4(0x0F83C1E0, 0xF8FE3E1F, 0x1F8FC3F1, 0x7900000E),
+	uint4(0xFFF8007F, 0x0FFFFFFF, 0xFFF80000, 0x7980000F), uint4(0x87E3FBFE, 0xF0080E07, 0xFBFEFFBF, 0x79C0000F),
+	uint4(0x3C06027F, 0xFFFBF8FC, 0xFFFFFFFF, 0x7A00000F), uint4(0xCFFFFFFF, 0x3E3E1F1F, 0x0000034F, 0x7A400000),
+	uint4(0x3E0C0003, 0x001C3F7F, 0xFFF8F020, 0x7A800001), uint4(0xC0301E07, 0x0F070100, 0xFDFE7E3F, 0x7AC00003),
+	uint4(0xC7F1FC7F, 0xF0FC3F0F, 0x7C1F0FC3, 0x7B000000), uint4(0xC3F1FCFF, 0x301C0F07, 0x02000040, 0x7B40000C),
+	uint4(0xFFF00000, 0xFFFFFFFF, 0xFC00003F, 0x7B80000F), uint4(0x300C0607, 0x7C0700C0, 0xFCBFE7F0, 0x7BC00002),
+	uint4(0x40303C1F, 0x00000000, 0xFFFFFFC0, 0x7C00000F), uint4(0xF07C3F9F, 0x9FFC0281, 0x81F0FC7F, 0x7C800007),
+	uint4(0xC0700C03, 0xF01C0701, 0x3C0F03C0, 0x7CC00000), uint4(0x0E0FE3FE, 0x303E1F00, 0x00000040, 0x7D000000),
+	uint4(0x87E1F87E, 0xC1F87E1F, 0xF07C1F07, 0x7D400001), uint4(0xDFF3FC7F, 0x0FFFFFFF, 0x00000000, 0x7D800000),
+	uint4(0x300C0380, 0x080300C0, 0x02008020, 0x7DC00000), uint4(0x00000003, 0xFFFFFF00, 0xFCFFFFFF, 0x7E000000),
+	uint4(0xF1FC3F0F, 0xFEFF9FC7, 0x0000EFFB, 0x7E400000), uint4(0x3FEFFFFF, 0x707E7F78, 0x00000040, 0x7E800000),
+	uint4(0x38080001, 0xFFFBF8F8, 0x040F0FCF, 0x7F000000), uint4(0xC7F1FCFF, 0xF07C3F0F, 0x1C0F03C1, 0x7F400008),
+	uint4(0x3F87E400, 0x81E1F8FE, 0xE0F90001, 0x7F80000F), uint4(0x380E07C3, 0x0C0300E0, 0xF2608010, 0x7FC00008),
+	uint4(0x00100C07, 0xFFF3C000, 0x0000003F, 0x80400000), uint4(0xC00FFFFF, 0xFFFFFFFF, 0x0000FFFF, 0x80800000),
+	uint4(0x3FFFFFFF, 0x08000000, 0xFBF8F838, 0x8100000F), uint4(0x3C0E0187, 0x8FC3E0F8, 0x3BFCFE3F, 0x81400000),
+	uint4(0x01FFFFFF, 0xF7FBE080, 0x000303C7, 0x8180000F), uint4(0x1F0783E1, 0xC1F0F83C, 0x7E3E8FA7, 0x81C0000C),
+	uint4(0xFFFFFFFE, 0xFFFFFFFF, 0xF3FFFFFF, 0x8200000F), uint4(0x00107DFF, 0x00000000, 0x8380C020, 0x8240000F),
+	uint4(0x380E0380, 0x0E0380E0, 0x0380E038, 0x8280000E), uint4(0x010FFFEF, 0x00C03004, 0xCCF11C47, 0x82C00003),
+	uint4(0x0F0783C1, 0xF0783C1E, 0x0783C1E0, 0x8300000F), uint4(0x300C0203, 0x0F3C87E0, 0xC3E0F83C, 0x83800007),
+	uint4(0x7FD7F1FC, 0x400000FF, 0x700C0100, 0x83C00000), uint4(0xFFFFFFFF, 0x000000FF, 0x00000000, 0x84000000),
+	uint4(0xBFE7F9FE, 0xFFFFFEFF, 0x180200BF, 0x84400000), uint4(0x3C0803FF, 0x0003FFFF, 0xFC7F03C0, 0x8480000F),
+	uint4(0x22080240, 0xC8221084, 0x0E068120, 0x84C00008), uint4(0xDFFFFFFF, 0xF1FCFF3F, 0x3C1F0FC3, 0x85000008),
+	uint4(0x07C1F07E, 0x01C0701E, 0x00401806, 0x85400001), uint4(0x3F8FE3F8, 0x0FC3F0FC, 0x03E0F83E, 0x8580000F),
+	uint4(0x180E0380, 0x0701C060, 0x80E0300C, 0x85C00003), uint4(0x00000000, 0x00000000, 0x00000000, 0x86000008),
+	uint4(0xC1F3FFFF, 0xFFFB8000, 0x0000003F, 0x86800008), uint4(0xC0040201, 0xFF7FFFFF, 0xC7F3F9FE, 0x86C0000F),
+	uint4(0xFFF80000, 0x8003FFFF, 0xFFFFFFFF, 0x87800003), uint4(0xC1F0FC7F, 0x100C0703, 0x00000000, 0x87C00000),
+	uint4(0x30080C0E, 0x0F83C0E0, 0xFBFCFE3F, 0x8840000F), uint4(0x3FCFC000, 0x0803C0FC, 0x03F8FFB0, 0x8880000F),
+	uint4(0x118C6211, 0x62188C43, 0x8C431084, 0x88C00000), uint4(0xFFF7FDFF, 0x080000FF, 0xE3E0F030, 0x8900000F),
+	uint4(0x200F03FC, 0xFFC00000, 0xF3FFFFFF, 0x8940000F), uint4(0x380E0787, 0xFEFC0060, 0x0381E1F8, 0x8980000E),
+	uint4(0x00080204, 0x04090200, 0x04010000, 0x89C00002), uint4(0x300F03E0, 0xFFFC0080, 0x83F8FF3F, 0x8A40000F),
+	uint4(0xCE0F83E0, 0x0F84E709, 0x83E0F83E, 0x8A80000F), uint4(0xFFEFF3F9, 0xF0001FFF, 0x0DFFFFFF, 0x8B800000),
+	uint4(0x3C0F03C0, 0x0783E0F8, 0xC1F0781E, 0x8BC00003), uint4(0xFFFFFFFF, 0xFFFFFFFF, 0x1C01003F, 0x8C400000),
+	uint4(0x00000004, 0x00000000, 0x00100000, 0x8C800000), uint4(0x3FFFFBF8, 0x00000000, 0xE3E0F030, 0x8CC0000F),
+	uint4(0xFFFFFFFF, 0x0FFFFFFF, 0x0000FFC0, 0x8D800000), uint4(0x06018060, 0x01004010, 0xFBFFFFC0, 0x8DC0000D),
+	uint4(0xFFFFC300, 0x000000FF, 0x00000000, 0x8E400000), uint4(0x00000200, 0xFFFFFF00, 0x0000C03F, 0x8E800000),
+	uint4(0x0300C030, 0x00C0300C, 0xC0300C03, 0x8EC00000), uint4(0x3F0FF3FE, 0x0C03C0F8, 0xFBFFFFE0, 0x8F00000F),
+	uint4(0xE3F0FC3F, 0xFC3E1F87, 0x1F87E3F0, 0x8FC0000E), uint4(0x0007FCFF, 0x780E0100, 0x033FC7E0, 0x90800002),
+	uint4(0x3BCEF3BC, 0xC6F1BCEF, 0xF8BE2F1B, 0x90C00002), uint4(0x20080000, 0x0F0380C0, 0xE3F0F83C, 0x9100000F),
+	uint4(0x01C0F03C, 0x80601807, 0x20180601, 0x91400000), uint4(0xF8FE3F9F, 0xFF3F8FE3, 0x3FCFF3FC, 0x91C0000F),
+	uint4(0xC0701C0F, 0x00040100, 0x03008020, 0x9200000C), uint4(0xC0701C0F, 0x380C0301, 0x07018060, 0x9240000C),
+	uint4(0xF3F0F87C, 0x80403FEF, 0x3E0F0381, 0x9280000E), uint4(0x0802047B, 0xC6318C21, 0x73DCF718, 0x92C0000F),
+	uint4(0xBFCFE3F0, 0xF3FFFFFF, 0x038181C3, 0x9380000F), uint4(0x01802C07, 0xE87A1C87, 0xFDBFCFB1, 0x93C00002),
+	uint4(0x3F0FE3FC, 0x0C0380F0, 0x00000000, 0x94400000), uint4(0x1E060000, 0xF3FDFF7F, 0xFCFF3FCF, 0x94800003),
+	uint4(0x5FB7CDF3, 0xC3F4FD3E, 0xFA7E9F87, 0x94C00008), uint4(0xFFCFC3C0, 0xFFFFFFFF, 0xFFFFFFFF, 0x95000007),
+	uint4(0x1C070180, 0x87C1F078, 0xF9FC7F1F, 0x95400007), uint4(0xFC3E1E0F, 0xF7F3F9FC, 0x8000DFEF, 0x95800000),
+	uint4(0x3C0F83F0, 0x080300E0, 0xF3FEFFC0, 0x95C0000F), uint4(0xBFEFFBE0, 0xC3F1FCFF, 0x00180F07, 0x9600000F),
+	uint4(0x3E0FF3FF, 0x000000C0, 0x00000000, 0x96400000), uint4(0xFFFFF3C3, 0x0C3CFFFF, 0xFFFFFFFF, 0x96800007),
+	uint4(0xDFFFFFFF, 0xE1FCFF3F, 0xBC180F03, 0x9740000F), uint4(0xB0000000, 0x0000001F, 0x0001F800, 0x97800000),
+	uint4(0xBE4FA3E0, 0x1F8FE2F9, 0x83E0F87E, 0x97C0000F), uint4(0x27F80E00, 0x08020080, 0x02008020, 0x98000008),
+	uint4(0x20000000, 0x0F0380C0, 0xF0783C1E, 0x98400000), uint4(0xC1F3FC00, 0x0C020080, 0x0380E030, 0x9880000F),
+	uint4(0x0380F03C, 0xF000100C, 0x7F9FF7FD, 0x98C0000C), uint4(0x00000007, 0xF0000000, 0xFFFFFFFF, 0x99000003),
+	uint4(0xFFFFFFF1, 0x0C000F3F, 0x0C3FFF3E, 0x99800000), uint4(0x02010081, 0x00201000, 0xFC000000, 0x99C0000F),
+	uint4(0x0000047F, 0xFFFC0000, 0xFFFFFFFF, 0x9A00000F), uint4(0xFFF7FCFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x9A40000F),
+	uint4(0x87E0F83E, 0xE1F87E1F, 0xF8FE3F8F, 0x9A800003), uint4(0x9CEF339C, 0xF87C2F3B, 0x330BC3E0, 0x9AC0000E),
+	uint4(0x00000001, 0x00000000, 0x0C1F7E3C, 0x9B000000), uint4(0xFFFFFBFC, 0x000000FF, 0x00000000, 0x9B400000),
+	uint4(0x100F07E2, 0xF07C3830, 0xFBE1C0C0, 0x9B800007), uint4(0xBFFDFF7E, 0x64190200, 0x7B0EC3B0, 0x9BC0000C),
+	uint4(0xE1F87E1F, 0xF87E1F87, 0x7F1FC7E1, 0x9C00000C), uint4(0x0E03C0F0, 0xF0008030, 0xFCFFBFEF, 0x9C400003),
+	uint4(0xBC6F1BCE, 0x2F1BC6F1, 0x0DC3709C, 0x9CC00007), uint4(0xFFFFFC00, 0xFFFFFFFF, 0xFDFF7FFF, 0x9D000007),
+	uint4(0x3F8FE3F8, 0x8FE3F8FE, 0xE1F87E3F, 0x9D400007), uint4(0x0300C461, 0x88201804, 0x12040300, 0x9DC0000C),
+	uint4(0x010FDFF3, 0x07C0F00C, 0xC3F0FC3F, 0x9E40000F), uint4(0xFFFFFFFF, 0x818C7F7F, 0x1C0F0783, 0x9E800000),
+	uint4(0xF07C1F8F, 0x10040380, 0xF3FCFF80, 0x9F00000F), uint4(0x3FFFFFFC, 0xF00C0000, 0xFFFFFFC3, 0x9F80000F),
+	uint4(0xC8320C87, 0x310C4310, 0x84611044, 0x9FC00000), uint4(0x7A3E0FC3, 0xDC67B9EC, 0x791FC7B1, 0xA0C00000),
+	uint4(0xC7FFF3F0, 0x00000000, 0x00000000, 0xA1400000), uint4(0x00001C7F, 0xF0000000, 0x00073FFF, 0xA1800000),
+	uint4(0xFEFFFFFF, 0xE7B9EEFB, 0x31CC739C, 0xA1C00006), uint4(0x3F0F83D0, 0xFFFBF4FE, 0xEFFBFEFF, 0xA200000F),
+	uint4(0xC3F1F8FE, 0x381E0F87, 0x0300C070, 0xA240000C), uint4(0x0701C070, 0x01C0701C, 0xC0701C07, 0xA2800001),
+	uint4(0x20080E07, 0x08020080, 0x80008020, 0xA2C0000B), uint4(0x80C06038, 0x00040201, 0x00000000, 0xA3000000),
+	uint4(0x3C0F83F0, 0x080300E0, 0xFFFF0000, 0xA380000F), uint4(0xDF3FCFF7, 0x13C5F17C, 0xE0703C0F, 0xA3C00001),
+	uint4(0x1F87E1F8, 0x87E1F87E, 0xE1F87E1F, 0xA4400007), uint4(0x9FF7E1C0, 0x07C1FC7F, 0x0180701E, 0xA4800004),
+	uint4(0x02008020, 0x00802008, 0x80200802, 0xA4C00000), uint4(0xC78FE3F8, 0x8FE03800, 0xE3F8FE3F, 0xA540000F),
+	uint4(0x0030FDFF, 0x0FFFFF00, 0xFC00E03F, 0xA580000F), uint4(0x3F0F87E3, 0xE1F0FC7E, 0x7E1F8FC7, 0xA5C0000C),
+	uint4(0xFCFE7F3F, 0xDFEFF7F9, 0xFFFFFFBF, 0xA600000F), uint4(0x80200802, 0x180C0300, 0x06018060, 0xA6400008),
+	uint4(0x1F0783E0, 0xC1E0783C, 0x381E0703, 0xA6800000), uint4(0x3FFFFFFF, 0x00000000, 0xFC000000, 0xA6C0000F),
+	uint4(0x3000037F, 0x1C0300C0, 0xFF1FC1F0, 0xA700000C), uint4(0xFFFFFFFF, 0x0FFC00FF, 0x00000000, 0xA7800000),
+	uint4(0x40707C7F, 0x60300804, 0x0E0781C0, 0xA800000C), uint4(0xDCFE7F3F, 0x83C4E371, 0xF83C1F07, 0xA8400000),
+	uint4(0x3BFCFC7F, 0xF0301800, 0x0F8781C0, 0xA880000F), uint4(0x781C0603, 0x0E03C0E0, 0x63D0F43A, 0xA8C0000F),
+	uint4(0x3E0F87E3, 0x0FC3E0F8, 0xC0703C1F, 0xAA400000), uint4(0x179DC7F1, 0xC6F1F85E, 0x78DC3F0B, 0xAAC00003),
+	uint4(0x3FEFFFFF, 0x0FE3FCFF, 0x03E0FC3F, 0xAB00000F), uint4(0x08040201, 0x80402010, 0x04020100, 0xAB400008),
+	uint4(0xBF0E0C1F, 0xFFFFFFFF, 0x830307CF, 0xAB80000F), uint4(0x00101C3F, 0x08000000, 0xE3E0F030, 0xABC0000F),
+	uint4(0xEFF7FFFF, 0x139DCFCF, 0x3C1E0F07, 0xAC000000), uint4(0x3F80F1FC, 0xCFF3FCFF, 0xF3FCFF3F, 0xAC80000F),
+	uint4(0x00802008, 0x80200802, 0x20080200, 0xACC00000), uint4(0xE3F8FE1F, 0xFBFE7F9F, 0xFC7F3FCF, 0xAD000008),
+	uint4(0xDFE7F9FC, 0xF3FFFFFF, 0x018040D1, 0xAD400006), uint4(0x000003FF, 0x0003FF00, 0xFC000000, 0xAD80000F),
+	uint4(0x46110C43, 0x10842118, 0xC0300842, 0xADC00000), uint4(0xFE7F9FE3, 0x7FDFF7FD, 0x2008003F, 0xAE000000),
+	uint4(0xBFFFFFFF, 0x0E03F0FF, 0x80000000, 0xAE40000F), uint4(0xDFFFFFFF, 0xF7FDFF7F, 0xFCFF3FCF, 0xAEC00003),
+	uint4(0x380C0301, 0x7F0780E0, 0x8C1F73FC, 0xAF000000), uint4(0x300E03E0, 0x00000000, 0xFFF08000, 0xAF40000F),
+	uint4(0x3F080000, 0x00000000, 0xFBC00000, 0xAF80000F), uint4(0x9FCFC3E0, 0x000C0F1F, 0x8380C020, 0xAFC0000F),
+	uint4(0x81C0E070, 0x00040301, 0x03008000, 0xB0400007), uint4(0x00000300, 0x00000000, 0x03FF0000, 0xB080000E),
+	uint4(0x27C9F2FC, 0xDCF37CDF, 0x73BCEF3B, 0xB0C0000F), uint4(0x00000001, 0x0C000000, 0x040F0F0E, 0xB1400000),
+	uint4(0xDFF7F3F8, 0xFDFE7F3F, 0x2010003F, 0xB1C00000), uint4(0xC6F0FC3F, 0x1F8DE739, 0xC3F0FC3F, 0xB240000F),
+	uint4(0xC0000000, 0x0C03FFFF, 0xFFFF0000, 0xB280000F), uint4(0x01806018, 0xE0300C07, 0x18060180, 0xB3000000),
+	uint4(0x1789E279, 0xC4E1385E, 0x71BC4F13, 0xB3C00002), uint4(0x3E0F1F9F, 0xEFF3F8FC, 0xFFFFFFFF, 0xB400000F),
+	uint4(0xE3F87E1F, 0xFBFE7F9F, 0x0400FFEF, 0xB4800008), uint4(0xE0783E0F, 0x180E0381, 0x02008060, 0xB4C00008),
+	uint4(0x3FFFDFE3, 0x80C01004, 0xE1F83E07, 0xB5000007), uint4(0x1C0F07C3, 0x0100C070, 0x3FDFFFC4, 0xB540000F),
+	uint4(0xC3F1FDFF, 0x0E060303, 0xFFFCFC3E, 0xB580000F), uint4(0x060104C1, 0xC060380C, 0x1C0E0381, 0xB5C00008),
+	uint4(0xFFFFFFF8, 0x70007F7F, 0x00000040, 0xB6800000), uint4(0x9EE7B8EE, 0xE7F9FE7B, 0x8000003F, 0xB6C00000),
+	uint4(0x3F0E0201, 0xFFFFFFFF, 0x0C1F7FFF, 0xB7000000), uint4(0x400001FF, 0xF03C0300, 0xFCFF0FC1, 0xB8000007),
+	uint4(0x00000000, 0x00000000, 0x1DF00000, 0xB8800000), uint4(0xE6799E67, 0x7B9EE7B9, 0xBEEFBBEE, 0xB8C0000B),
+	uint4(0x3F0F0300, 0xFFFFFFFF, 0xFFFFFFFF, 0xB9000007), uint4(0xCE7F1FC3, 0x8044070B, 0xF03C0E01, 0xB9800001),
+	uint4(0x00000000, 0x08000000, 0x83C0E030, 0xB9C0000F), uint4(0x00000000, 0x0C020000, 0x83C0E030, 0xBA40000F),
+	uint4(0x40301C0F, 0x00000000, 0x00000000, 0xBAC00000), uint4(0xFFFFFFC0, 0xFFFFFFFF, 0x000001CF, 0xBB00000E),
+	uint4(0x070180E0, 0x8060300C, 0x100C0301, 0xBBC00000), uint4(0xC0F07C3E, 0x00040301, 0xF3E08000, 0xBC40000F),
+	uint4(0xCFF001E0, 0xF380F83F, 0xE07F1FF7, 0xBC800001), uint4(0x40201008, 0x00000000, 0x00000000, 0xBCC00000),
+	uint4(0xFFFFFF87, 0xFFFFFFFF, 0x3FFFFFFF, 0xBD00000C), uint4(0x380E0300, 0x0F03C0E0, 0xC3F0F83E, 0xBD400007),
+	uint4(0x01FFFFFF, 0x00000000, 0xFFFFFFC0, 0xBD80000F), uint4(0x0380E038, 0xC070180E, 0x701C0701, 0xBE000000),
+	uint4(0xFC7FBC10, 0x080301E0, 0xFBFFFFC0, 0xBE800007), uint4(0x26118461, 0x09826098, 0xC2709826, 0xBEC00009),
+	uint4(0xBFFFF3FC, 0xF07C0600, 0xFDFF1FC3, 0xBF00000F), uint4(0xC1F03BEF, 0xC1003F0F, 0xFDFF3FCF, 0xBF80000F),
+	uint4(0x300E0380, 0x080200C0, 0x00000000, 0xC0000000), uint4(0xBE0C0000, 0xCFFFFFFF, 0x0000803F, 0xC0400000),
+	uint4(0x06011C7F, 0xCFE1F83C, 0x00063FBF, 0xC0800008), uint4(0xC1F0FC7F, 0x100C0703, 0x0C000000, 0xC0C00000),
+	uint4(0x40707C7F, 0x08000000, 0xFBF8F838, 0xC100000F), uint4(0x1F0FE3FC, 0xF000C038, 0x3C1F8FF3, 0xC1400000),
+	uint4(0xCFFDFE7F, 0x0184470F, 0xF0781C07, 0xC1800001), uint4(0x04010040, 0x01004010, 0x00401004, 0xC1C00001),
+	uint4(0xE3F3FDFF, 0x0E0F0787, 0x83C0F038, 0xC200000F), uint4(0xC7F7FFF9, 0xFFFBE3C3, 0xE7870FCF, 0xC280000F),
+	uint4(0x3F8FC3E1, 0xE3FBFCFE, 0x040703C3, 0xC300000C), uint4(0xDFF7FCFF, 0xFFFFFFFF, 0x0000FFFF, 0xC3400000),
+	uint4(0x00000000, 0x10040000, 0x1C0300C0, 0xC3800000), uint4(0x3F8FC3E0, 0xFFFFFEFF, 0xFCFF7FFF, 0xC3C00009),
+	uint4(0x00000000, 0x00000000, 0x03008000, 0xC400000F), uint4(0xFFF00000, 0x000C7FFF, 0xC3C0C000, 0xC480000F),
+	uint4(0x40100C07, 0x08020000, 0xFC004000, 0xC500000D), uint4(0x3FBFE7F8, 0xE0F01C01, 0xFFFE7F87, 0xC540000F),
+	uint4(0xFFFEFFBE, 0x0080071F, 0xC0300C02, 0xC5C00000), uint4(0x380E0380, 0x0F0380E0, 0x03C0F03C, 0xC600000F),
+	uint4(0x380E0380, 0x0F03C0F0, 0x83E0F83C, 0xC640000F), uint4(0x380E0780, 0x0E0380E0, 0x0380E7F8, 0xC680000E),
+	uint4(0x0FC3F0FC, 0xC3F0FC3F, 0xF0FC3F0F, 0xC6C00003), uint4(0x00000007, 0xFFFFC000, 0xFFFFFFFF, 0xC7000003),
+	uint4(0xFFFFFC00, 0x000000FF, 0x00000000, 0xC7400000), uint4(0x2030FDFF, 0xCFC3C0C0, 0xFFFFFFBF, 0xC780000F),
+	uint4(0xE0781E0F, 0x381E0781, 0x0E0300C0, 0xC7C0000C), uint4(0xBFEFFBFE, 0x10387EFF, 0x38060080, 0xC8400000),
+	uint4(0x004FFFFC, 0xE7F87E07, 0x1C00FFBF, 0xC8800000), uint4(0xFFFFFC00, 0xFFFFFFFF, 0x03FFFFFF, 0xC8C00000),
+	uint4(0xF3FBFDFF, 0xCFEFE7F7, 0xFFFFFFFF, 0xC900000F), uint4(0x38080000, 0xFFFBF8F8, 0xFFFFFFFF, 0xC9400007),
+	uint4(0x000003FF, 0xFFFC0000, 0x0000003F, 0xC9800000), uint4(0xE7FFF7FD, 0xC8120481, 0x721C8320, 0xC9C00008),
+	uint4(0xBFCFF3FC, 0x103C7EFF, 0x00000000, 0xCA000000), uint4(0x38080000, 0x70787878, 0x00000040, 0xCA800000),
+	uint4(0x4C360D86, 0x00C06018, 0x320C8603, 0xCAC0000C), uint4(0x3FFFF7FD, 0x18060100, 0x0F83E0F0, 0xCB00000F),
+	uint4(0x380C0603, 0x0F83E0F0, 0xF87C3E1F, 0xCB400000), uint4(0xDFF7FFFF, 0xF1FCFF3F, 0x7C3F0FC7, 0xCB800000),
+	uint4(0x80E0380E, 0xE0380E03, 0x380E0380, 0xCC400000), uint4(0x00303C3F, 0x0E020000, 0xFDFCFC3E, 0xCC800001),
+	uint4(0x88421084, 0x21084220, 0x84211044, 0xCCC00000), uint4(0xC7F1FCFF, 0xF07C3F0F, 0x1C0F03C1, 0xCD000000),
+	uint4(0x1E0F07C3, 0xC1E0F87C, 0x3C1E0F87, 0xCD400008), uint4(0xFFFFFBF8, 0xFFFFFFFF, 0xFFFFFFFF, 0xCD80000F),
+	uint4(0xCE739DE7, 0x739CE739, 0x8CE739CE, 0xCDC00003), uint4(0x380C0300, 0x0F03C0E0, 0xC3F0F83E, 0xCE40000F),
+	uint4(0x3F30383F, 0x000200F0, 0xFDFFFF00, 0xCE800001), uint4(0xCFF3FDFF, 0x01E0FE3F, 0xFE7FF006, 0xCF000000),
+	uint4(0xDFF7FCFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xCF40000F), uint4(0x3F8FE3F8, 0x81E0F87E, 0xFC080603, 0xCF80000F),
+	uint4(0x0F07C3E1, 0x8E62301C, 0xF7FAFE3E, 0xCFC0000F), uint4(0xBFCFE3F0, 0x71FFFFFF, 0x00000000, 0xD0400008),
+	uint4(0x01000020, 0x00000000, 0xF7FFFEC0, 0xD080000F), uint4(0x0F83E1F0, 0x73D8FE3F, 0xCCF73DCF, 0xD0C00003),
+	uint4(0x06107FC7, 0x0FC3E078, 0xE3F8FC3F, 0xD100000F), uint4(0xFF8F870F, 0xFFFFFFFF, 0xFFFFFFFF, 0xD1C00007),
+	uint4(0x00000001, 0xF0000000, 0x0E1FFFC1, 0xD200000C), uint4(0x87E3F8FE, 0xE1F87E1F, 0xF83E0F87, 0xD2400000),
+	uint4(0xEFF0FC0F, 0x0E0300C7, 0xC3E0F03C, 0xD280000F), uint4(0xF83E1F87, 0x0E0781E0, 0x0380E038, 0xD3400006),
+	uint4(0x000FFFFF, 0xFFFFFF00, 0x0000FFFF, 0xD3800000), uint4(0x804FFFF9, 0xF03C0E01, 0xFC3F0FC1, 0xD3C00001),
+	uint4(0x3FFFFFFF, 0x00000000, 0x00000000, 0xD4000008), uint4(0x60180E03, 0xEF820080, 0xFE7F9FEF, 0xD4400008),
+	uint4(0xBBEEFBBE, 0xEEFBBEEF, 0xFBBEEFBB, 0xD4C0000E), uint4(0x00E0783E, 0x8FF40001, 0xC3F8FE3F, 0xD500000F),
+	uint4(0xCFFFFFFF, 0x000C070F, 0x00000000, 0xD5800000), uint4(0xC7FFFFFF, 0x00000001, 0x00000000, 0xD5C00000),
+	uint4(0xC7F1FC7F, 0xF7FCFF3F, 0xFFFF7FDF, 0xD600000F), uint4(0xCFFFFFFF, 0x0804070F, 0xE3E0F030, 0xD680000F),
+	uint4(0xC01FFFFE, 0xF1FC1F01, 0xFFFFFFDF, 0xD740000F), uint4(0xC0000000, 0x000000FF, 0xFFFF0000, 0xD780000F),
+	uint4(0x00000000, 0xCFFC0000, 0x0000003F, 0xD8800000), uint4(0xDE378DE3, 0x7F9FE378, 0xBFE7F9FE, 0xD8C0000F),
+	uint4(0xC0F00FFE, 0xFFFCFF0F, 0xFFFFFFFF, 0xD900000F), uint4(0x1F07C1E0, 0xE7F9FC7E, 0x0100FFDF, 0xD9400004),
+	uint4(0x00001C7F, 0xFFFFF8E0, 0x00073FFF, 0xD9800000), uint4(0x98E6398E, 0xE6398E63, 0x398E6398, 0xD9C00006),
+	uint4(0x00010000, 0x00002008, 0x00080001, 0xDA000000), uint4(0xC3F0FC7F, 0xFE3F1F87, 0xEBF7F9FC, 0xDA40000F),
+	uint4(0x30000403, 0xFFF3F0F0, 0x000001C7, 0xDA800000), uint4(0xBFFFFFFC, 0x000380FF, 0x00000000, 0xDB00000E),
+	uint4(0xC3F3F9F8, 0x000C0707, 0x00000000, 0xDB400000), uint4(0x301C0F07, 0xFDFC0040, 0x1F0FC7F3, 0xDB80000C),
+	uint4(0x0C0300E0, 0x02008030, 0x00002008, 0xDBC00000), uint4(0x380E0300, 0x0F03C0E0, 0x83E0F83C, 0xDC00000F),
+	uint4(0x87898300, 0xE1FC7F1F, 0x80701F07, 0xDC400001), uint4(0xC0000200, 0xFFFFFFFF, 0xF3FEFFFF, 0xDCC0000F),
+	uint4(0x03C1F8FF, 0x3E1FEF04, 0x00000070, 0xDD800000), uint4(0xE739CE73, 0x79DE779D, 0xDF77DDF7, 0xDDC0000F),
+	uint4(0x1FCFF3FC, 0xC1F0FC3F, 0x339CCF23, 0xDE00000F), uint4(0x0000000F, 0xF3FFFF00, 0x000000C1, 0xDE800000),
+	uint4(0xCF7BCEF3, 0x71DCF77D, 0x7C1F0DC7, 0xDEC00008), uint4(0x010FFFEF, 0x01C0300C, 0xE5F87C0F, 0xDF40000F),
+	uint4(0xDFF3FC7F, 0x0FFFFFFF, 0xFFFCF000, 0xDF80000F), uint4(0xDE779DE7, 0x77DDF779, 0x00007FDF, 0xDFC00000),
+	uint4(0xC3F3FDFF, 0x000C0707, 0x00000000, 0xE0000000), uint4(0xFDFF7FDF, 0x7FDFEFFB, 0xEFFBFDFF, 0xE040000F),
+	uint4(0x03EFE3E0, 0xCFC3C0C0, 0x838081FF, 0xE080000F), uint4(0xFE7F9FEF, 0x1F87E3F8, 0x01C0F07E, 0xE0C00007),
+	uint4(0xC3F3FDFF, 0x0C0E0707, 0xC3E0F038, 0xE140000F), uint4(0x3030FDFF, 0xFFF3F0F0, 0xFFFFFFFF, 0xE180000F),
+	uint4(0xBFEFF3FD, 0xF1FCFF7F, 0x1E0F87C3, 0xE1C0000C), uint4(0x00000000, 0xFFFFFF00, 0xFBFEFFBF, 0xE200000F),
+	uint4(0x30000007, 0xEFE3F0F0, 0x000003CF, 0xE280000C), uint4(0xCFFFFFFF, 0x303C1F1F, 0x00000040, 0xE3000008),
+	uint4(0x040F7FC7, 0x0F03C070, 0x03C0F03C, 0xE340000F), uint4(0x20180E0F, 0x08020080, 0x3E1F9C28, 0xE3800008),
+	uint4(0x8CE338EF, 0xC330CE33, 0x308C2308, 0xE3C00002), uint4(0x00000000, 0x0FF00000, 0x00000030, 0xE4000000),
+	uint4(0x3F8F83CF, 0xF3FFFEFF, 0x030080C1, 0xE480000F), uint4(0xF87E3F8F, 0x1F0FC3F1, 0xC3E0F87E, 0xE4C0000F),
+	uint4(0xC0701C0F, 0x10040300, 0x00000000, 0xE5000000), uint4(0x00000007, 0x00000000, 0xFFF8F020, 0xE5400003),
+	uint4(0x06018060, 0x00802008, 0x80200802, 0xE5800000), uint4(0xDF77F9F8, 0x338DF37C, 0x04C130CE, 0xE5C00003),
+	uint4(0x20080201, 0x08020080, 0x0E1F0020, 0xE6000008), uint4(0xFFFFFBF8, 0xF0FC7F3F, 0x000301C0, 0xE6400008),
+	uint4(0xC4310C47, 0x3C0E4390, 0x0781E0F0, 0xE6C0000F), uint4(0x38080000, 0xC0607030, 0x000101C0, 0xE7000000),
+	uint4(0xD8360D83, 0x330CC330, 0x04C330CC, 0xE7C00003), uint4(0x00100C03, 0x00000000, 0x00000000, 0xE8400000),
+	uint4(0x3C0703DF, 0x0103C3F0, 0x3FC0F03C, 0xE880000F), uint4(0x81E0781E, 0xE0781E07, 0x781E0781, 0xE9000000),
+	uint4(0xCFF3FFFF, 0xC1F8FF3F, 0xFC601C07, 0xE940000E), uint4(0x7FCFF3FC, 0xC0700407, 0xF3FC7F07, 0xE980000F),
+	uint4(0x30080000, 0x0783C0E0, 0x783C1E0F, 0xE9C00000), uint4(0x20000003, 0xEFE3E0E0, 0xFFFFFFFF, 0xEA000003),
+	uint4(0xEFF7FBFD, 0xFE7FBFDF, 0xE7F3F9FC, 0xEA40000F), uint4(0xFFFFE381, 0x8F00070F, 0x041F3FFF, 0xEA800008),
+	uint4(0x3C0F03C0, 0x0F83C0F0, 0x83E0F83E, 0xEB00000F), uint4(0xE3FCFF3F, 0xF87E1F87, 0x3C1F07E1, 0xEB400000),
+	uint4(0xFF8E0400, 0xFFFFFFFF, 0x000007FF, 0xEB800000), uint4(0x21884021, 0x22110C42, 0x846110CC, 0xEBC00000),
+	uint4(0x7E1F8BE2, 0x0781E0F8, 0x8360982E, 0xEC40000E), uint4(0x318C6310, 0xEF739CE6, 0x7CFFFFBD, 0xECC00008),
+	uint4(0x83F1FCFF, 0x3FDFC807, 0x0200E07C, 0xED000000), uint4(0x3F0F0300, 0xF7FFFFFF, 0x1C0F0FCF, 0xED400000),
+	uint4(0x00000C1F, 0xCF830000, 0x000307CF, 0xED800000), uint4(0xC3D1F47B, 0xF87C3E0F, 0x3F8FC7E1, 0xEDC00006),
+	uint4(0xFFEFF3FC, 0x080C7FFF, 0x03C0E030, 0xEE80000F), uint4(0x5E370DC7, 0x07C1E078, 0xE3F87E1F, 0xEEC00007),
+	uint4(0xC1F07C1F, 0x703C0F03, 0x0C0701C0, 0xEF000008), uint4(0xC1C0E070, 0x0E0F0703, 0xF0783C3C, 0xEF800000),
+	uint4(0xFDFE7F9F, 0x8F73DEF7, 0x03E0FC3D, 0xEFC0000F), uint4(0x00000000, 0x08020000, 0x0380E030, 0xF000000F),
+	uint4(0x3C0F83E0, 0x0C0380E0, 0x00008030, 0xF0400000), uint4(0xC1F3FFFF, 0x08000000, 0xFBF8F838, 0xF080000F),
+	uint4(0x6FD3F4F9, 0x240800BF, 0x0D8340D0, 0xF0C00006), uint4(0x3F8FC3E0, 0x0003FFFF, 0x83C0C020, 0xF100000F),
+	uint4(0x0E0F0381, 0xEFF3FB04, 0x040F1FDF, 0xF1800000), uint4(0x3F0E0A42, 0x9CFFBFEF, 0xE739CE73, 0xF1C00008),
+	uint4(0x3E0F0783, 0xE3F1F8FC, 0x7E3F1FCF, 0xF200000C), uint4(0xFFEFFBFC, 0xFFFFFFFF, 0xFDFFFFFF, 0xF2400003),
+	uint4(0x30181C0F, 0x0E0380C0, 0xC3E0F03C, 0xF280000F), uint4(0x7F9EE7B9, 0xF7E7F9FE, 0x7C3F1FCF, 0xF2C00000),
+	uint4(0xDFF7FCFF, 0xFFFFFFFF, 0x0000003F, 0xF3000000), uint4(0xF1F83E0F, 0xFCFF3FC7, 0x0000FFF3, 0xF3C00002),
+	uint4(0x0F87C3C0, 0x707C3F1F, 0x038180C0, 0xF400000F), uint4(0x060380E0, 0x01806018, 0x80200806, 0xF4400000),
+	uint4(0x46118461, 0x11846118, 0x84611846, 0xF4C00001), uint4(0x00000000, 0xFFE30000, 0x03F8FFFF, 0xF500000C),
+	uint4(0x00000000, 0x08000000, 0x0300C020, 0xF580000E), uint4(0xFE10FFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xF5C0000F),
+	uint4(0xBFFFFFFF, 0x0FE3FCFF, 0x03C0F83F, 0xF680000E), uint4(0x43D23483, 0xCEF3FC3F, 0x739CE73B, 0xF6C0000E),
+	uint4(0x81C0F078, 0x301C0F03, 0x03008040, 0xF700000C), uint4(0x07C1F07C, 0xC1F07C1F, 0xF07C1F07, 0xF7400001),
+	uint4(0x3FEFFFFF, 0x000200F8, 0x00000000, 0xF8400000), uint4(0x1FE7FC00, 0xF201E07E, 0xE0FE3FEF, 0xF8800003),
+	uint4(0x902C0B06, 0xF0010040, 0xFB7EFFBF, 0xF8C0000D), uint4(0xCFF3FDFF, 0xF1FCFF3F, 0xFC7F1FC7, 0xF9000000),
+	uint4(0x8783C2C0, 0xF1FC7F1F, 0xFC3F0FC7, 0xF9400000), uint4(0xBF8F8301, 0x00000F3F, 0x0C3FFFC0, 0xF980000C),
+	uint4(0x7C1F03C0, 0x3F0FC3F0, 0x3FC7F1FC, 0xF9C0000F), uint4(0x00000001, 0xFFFFFF00, 0x040F0FCF, 0xFA400000),
+	uint4(0xCFF3FCFF, 0xFBFCFF3F, 0xFC7F3FCF, 0xFB000000), uint4(0xFF080000, 0x0FFFFFFF, 0x82000000, 0xFB80000F),
+	uint4(0xF07C3F0F, 0x1E0787E0, 0x81E2F0FC, 0xFBC00007), uint4(0x00002000, 0x00000000, 0x00000000, 0xFC000000),
+	uint4(0xFFEE0001, 0xFFFFFFFF, 0x0C1F7FFF, 0xFC400000), uint4(0x300E03C0, 0xF0000080, 0x000001C7, 0xFC800000),
+	uint4(0xDFE7C381, 0xF0FC7F3F, 0x1C0703C1, 0xFD400000), uint4(0x00000203, 0x003CFF00, 0xFFFF0000, 0xFD800007),
+	uint4(0x85E1F0BC, 0x787E2F0F, 0x1C8B43D1, 0xFDC00002), uint4(0x38000200, 0xCFFFFFFC, 0x03C0FC3F, 0xFE000008),
+	uint4(0xDFF7FFFF, 0xF3FDFF7F, 0xFCFF3FCF, 0xFE400001), uint4(0x0781E078, 0x00C0300C, 0xC0300C03, 0xFE800000),
+	uint4(0x80C02010, 0x781C0E03, 0x0F83C1F0, 0xFEC0000F), uint4(0x60381C0F, 0x0E0300C0, 0x83C0F038, 0xFF00000F),
+	uint4(0x380E0380, 0x0C0380E0, 0x0300C030, 0xFF40000C), uint4(0xC1E3E3F0, 0x00000000, 0x04000000, 0xFF800008),
+	uint4(0x00C0310E, 0x86210883, 0xE1F0781C, 0xFFC00007),
+};
+
+#define PARTITION_2_COUNT_12X10 818
+#define PARTITION_2_WORDS_12X10 5
+static const uint4 partition_2_12x10[1023] =
+{
+	uint4(0x1F01F01E, 0x700F00F0, 0xF07C0700, 0x00FF3FC3), uint4(0x00400000, 0x0700F00F, 0x30030070, 0x80100100),
+	uint4(0x00E00C00, 0x00800000, 0x78279673, 0xE03C07C1), uint4(0x83F83E07, 0x00E17C2F, 0x00C00000, 0x80F00E00),
+	uint4(0x80F01E07, 0x01E03C07, 0x00803007, 0x01000000), uint4(0x07E0FE1F, 0x3E03E07E, 0xE00E01E0, 0x00E03E01),
+	uint4(0x01400000, 0x60C61827, 0x3CE1CE1C, 0x3E7DE3DE), uint4(0x0043F0E7, 0x01C00000, 0x1F03F03F, 0xF00F01F0),
+	uint4(0x00700700, 0x00003003, 0x02000000, 0xFCFF8FF0), uint4(0xFFFEFFCF, 0xFFFFFFFF, 0x00FFFFFF, 0x02400000),
+	uint4(0xFCFFCFFE, 0x8FF8FFCF, 0xFF0FF8FF, 0x00FF0FF0), uint4(0x02800000, 0x0CC18830, 0x0F02E04E, 0x7C0F80F8),
+	uint4(0x000E03E0, 0x02C00000, 0xFF3FF3FF, 0xF0FF0FF1), uint4(0x03F03F07, 0x0000F01F, 0x03400000, 0x87F07F0F),
+	uint4(0x03C17C3F, 0x0F81F03E, 0x0087C078, 0x03800000), uint4(0xE0F00000, 0xFFFFFFEF, 0x00000001, 0x00000000),
+	uint4(0x03C00000, 0x01E01E01, 0x1E01E01E, 0xE01E01E0), uint4(0x00E01E01, 0x04000000, 0x7F7FFFFF, 0x00000070),
+	uint4(0x00000000, 0x00FFF000, 0x04400000, 0x00000007), uint4(0x07FF8000, 0x00000000, 0x00018000, 0x04800000),
+	uint4(0xFC9FC9FC, 0xC9FC9FC9, 0x9FC9FC9F, 0x009FC9FC), uint4(0x04C00000, 0xC00C00C0, 0x00C00C00, 0x0C00C00C),
+	uint4(0x000C00C0, 0x05000000, 0xC0F80F81, 0x07E0FC0F), uint4(0x1F03E03E, 0x000F81F0, 0x05400000, 0xF0FC1F81),
+	uint4(0xE7FCFF8F, 0x00301F0F, 0x00000000, 0x05C00000), uint4(0x0FF0FF0F, 0xFF1FF1FF, 0xF3FF3FF1, 0x00F7FF3F),
+	uint4(0x06000000, 0xE0FE0FE7, 0x0FE0FE0F, 0xFE0FE0FE), uint4(0x000E07E0, 0x06400000, 0x00000FFF, 0xF01F0000),
+	uint4(0x0000007F, 0x00001000, 0x06800000, 0x33633673), uint4(0x93313316, 0x31831931, 0x00198198, 0x06C00000),
+	uint4(0xF07F07F0, 0x07F07F07, 0x7F07F07F, 0x007F07F0), uint4(0x07000000, 0xF0FE0FE0, 0x87F8FF0F, 0x7FC7FC7F),
+	uint4(0x003FE3FE, 0x07400000, 0x7FF7FF7F, 0xFF3FF3FF), uint4(0xF3FF3FF3, 0x00F3FF3F, 0x07800000, 0xC2FC2FC2),
+	uint4(0x2FC2FC2F, 0xFC2FC2FC, 0x00FC2FC2, 0x07C00000), uint4(0x80080080, 0x00800800, 0x08008008, 0x00080080),
+	uint4(0x08000000, 0x00000007, 0xFFFFFFCE, 0xFFFFFFFF), uint4(0x0000F7FF, 0x08400000, 0x00000000, 0x08000000),
+	uint4(0xE00C00C0, 0x00F00F00, 0x08800000, 0xFFFFF000), uint4(0x0000000F, 0x00000000, 0x00000000, 0x09000000),
+	uint4(0x1FE1FE1F, 0xEC1EC1EE, 0x80C80EC0, 0x0080C80C), uint4(0x09400000, 0xDFFDFFDF, 0x0FFFFFFF, 0x00000000),
+	uint4(0x00810810, 0x09C00000, 0xFF000007, 0x07FFFFFF), uint4(0x00000000, 0x0001FFFF, 0x0A800000, 0xF8FFCFFE),
+	uint4(0x0FE0FF0F, 0xF00F80FC, 0x00C00E00, 0x0AC00000), uint4(0xC0FC0FC0, 0x1FC0FC0F, 0x040FCFFC, 0x00FC03C0),
+	uint4(0x0B000000, 0x0FC1EC3E, 0x1E03E07C, 0xF00F00E0), uint4(0x00F00F00, 0x0B400000, 0x00FFFFFF, 0xFFFFFFF0),
+	uint4(0xFFFFFFFF, 0x00000FFF, 0x0B800000, 0x7CF7CE7C), uint4(0xFF7FF7DF, 0x000FFFF7, 0x00081000, 0x0BC00000),
+	uint4(0x10010010, 0x00100100, 0x01001001, 0x00010010), uint4(0x0C000000, 0x81E03C07, 0x87E07C1F, 0x1FE1FC3F),
+	uint4(0x0007F0FF, 0x0C400000, 0xE0FC0F80, 0xFFFCFF8F), uint4(0xDFF3FF7F, 0x0007F6FF, 0x0C800000, 0x20E60C60),
+	uint4(0x0F20F20E, 0xFE0FA0FA, 0x00FE0FC0, 0x0CC00000), uint4(0xFF3FF1FF, 0xFFFF7FF3, 0xFFFFFFFF, 0x00FFFFFF),
+	uint4(0x0D000000, 0xFEFFE000, 0xE1FE7FEF, 0x03E07E0F), uint4(0x0000601E, 0x0D400000, 0xFFBFEFF9, 0x3FCFF3FC),
+	uint4(0x9FF7FCFF, 0x00F9FE7F, 0x0D800000, 0x00080001), uint4(0x00000400, 0x01000002, 0x00000800, 0x0DC00000),
+	uint4(0x00C0380F, 0x0F80F00E, 0xFF0FE0FC, 0x003FCFF8), uint4(0x0E000000, 0x78030FDF, 0x0CFE87C0, 0x3C118010),
+	uint4(0x00FFB7E3, 0x0E800000, 0x01700600, 0x00C01803), uint4(0x81002004, 0x00C08810, 0x0EC00000, 0x00000000),
+	uint4(0xF0000000, 0xFFFFFFFF, 0x00FFFFFF, 0x0F000000), uint4(0x0700700F, 0x10010030, 0xC0080000, 0x00780F00),
+	uint4(0x0F400000, 0xBFFBF000, 0xFF3FF3FF, 0xC1EE1FE3), uint4(0x0081C81E, 0x0F800000, 0xFCFF0FC0, 0x000103E7),
+	uint4(0x00000000, 0x00000000, 0x0FC00000, 0x00800800), uint4(0x08008008, 0x80080080, 0x00800800, 0x10000000),
+	uint4(0x00001004, 0x00000000, 0x380600C0, 0x000701C0), uint4(0x10400000, 0x1FE0FE0F, 0xFF1FE1FE, 0xF9FF1FF1),
+	uint4(0x00FBFF9F, 0x10800000, 0x78078078, 0x80780780), uint4(0x07807807, 0x00078078, 0x10C00000, 0x0FE0FE1F),
+	uint4(0x7F07E0FE, 0xF07F07F0, 0x00703703, 0x11000000), uint4(0x3F0FF1FF, 0x300701F0, 0x00100000, 0x0007F00F),
+	uint4(0x11400000, 0x0300E038, 0x00000000, 0x00000000), uint4(0x00000000, 0x11800000, 0xBE73EE7E, 0xE3DE79E7),
+	uint4(0x1EE1EE3C, 0x008F69F6, 0x11C00000, 0x3F07F0FF), uint4(0x700F01F0, 0x00100300, 0x00000000, 0x12000000),
+	uint4(0xFE1FF1FC, 0x01F01F81, 0x9001C01E, 0x00D00C00), uint4(0x12400000, 0x04008000, 0x00010020, 0x80000000),
+	uint4(0x00200400, 0x12800000, 0x700C0180, 0x600C0380), uint4(0x80100300, 0x00600C00, 0x12C00000, 0xFC7FC7F8),
+	uint4(0x060041E7, 0x7C078070, 0x007E07C0, 0x13000000), uint4(0xF00F00F8, 0x00E00E00, 0x0800C00C, 0x00FFF000),
+	uint4(0x13400000, 0xFF000000, 0xFFFFFFFF, 0x000FFFFF), uint4(0x00000000, 0x13800000, 0xF83E83E8, 0x03F03F03),
+	uint4(0x1F43F43F, 0x001F61F6, 0x13C00000, 0x00C00C00), uint4(0x0C00C00C, 0xC00C00C0, 0x00C00C00, 0x14000000),
+	uint4(0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x00000000), uint4(0x14400000, 0x00000000, 0xF0000000, 0xFFFFFFFF),
+	uint4(0x00000000, 0x14800000, 0xDEFDEFDE, 0xE79E7DE7), uint4(0x79C79C79, 0x0079C79C, 0x14C00000, 0x01001001),
+	uint4(0x10010010, 0x00100100, 0x00001001, 0x15000000), uint4(0xFF1FF1FF, 0xF1FF1FF1, 0x1FF1FF1F, 0x001FF1FF),
+	uint4(0x15400000, 0x3F83E07E, 0xFC1F83F8, 0xE0FC1FC1), uint4(0x00E0FE0F, 0x15800000, 0x848848C4, 0x00000800),
+	uint4(0xFF7FF700, 0x00EF7EF7, 0x15C00000, 0x03F07F87), uint4(0x1E01E03F, 0xBFF40040, 0x001FEBFF, 0x16000000),
+	uint4(0x0020127F, 0x1F00F006, 0xF83F83F0, 0x00FCFF87), uint4(0x16400000, 0x7FFFF180, 0xF83FC3FE, 0x00700F01),
+	uint4(0x00003007, 0x16800000, 0x3F03F07F, 0xF01F01F0), uint4(0x00700F00, 0x00003007, 0x16C00000, 0xFEFFEFFE),
+	uint4(0xE7FEFFEF, 0x0FE1FE3F, 0x0003E07E, 0x17000000), uint4(0xFEFFF000, 0x0E00FE0F, 0xFFFFFF00, 0x00F00FF0),
+	uint4(0x17800000, 0x04FFBFF9, 0xE01E00C0, 0x07F03E01), uint4(0x001FF0FF, 0x17C00000, 0xFFCFFDFF, 0xFEFFEFFC),
+	uint4(0xF7FE7FE7, 0x00F3FF7F, 0x18400000, 0x3F07E1FC), uint4(0x180300F0, 0xF00E00C0, 0x00FC0F80, 0x18800000),
+	uint4(0x1CE1CE1C, 0x8C1CE1CE, 0xC18C18C1, 0x00C18C18), uint4(0x18C00000, 0xF8070007, 0xFFFE7FC1, 0xFFFFFFFF),
+	uint4(0x0000F7FF, 0x19000000, 0x1F0CF1C7, 0x304701F0), uint4(0x3C01C00C, 0x00FC07C0, 0x19400000, 0x00000000),
+	uint4(0x00000000, 0x000FFF00, 0x00000000, 0x19800000), uint4(0x18818818, 0x88188188, 0x81881881, 0x00818818),
+	uint4(0x19C00000, 0xFC1FC1FC, 0xC1FC1FC1, 0x1FC1FC1F), uint4(0x001FC1FC, 0x1A000000, 0x3F07F0FF, 0x700F01F0),
+	uint4(0xF01C0380, 0x00FE0F80, 0x1A400000, 0x0700F01F), uint4(0x0C018038, 0xF80F00E0, 0x00FC0F80, 0x1AC00000),
+	uint4(0x1FC3F87F, 0x3FC7F8FF, 0xFF8FF1FE, 0x001FF7FE), uint4(0x1B000000, 0xC1FC3F87, 0x07C07C1F, 0x1E01C03C),
+	uint4(0x000600E0, 0x1B400000, 0xF01F0013, 0xF0F0FF0F), uint4(0xFF00F000, 0x001F0FF0, 0x1B800000, 0x3F03F07F),
+	uint4(0xF01F01F0, 0x00400E00, 0x00FFB000, 0x1BC00000), uint4(0x00001003, 0x00000000, 0x00000000, 0x00F80C00),
+	uint4(0x1C000000, 0x00F00F00, 0x1F00F00F, 0xF07F03F0), uint4(0x00F1FF0F, 0x1C400000, 0xFF1FF3FF, 0xF01F03F0),
+	uint4(0x00100300, 0x00000000, 0x1C800000, 0xFC1F81FC), uint4(0x39F21F21, 0xEC3CE38E, 0x00F81EC1, 0x1CC00000),
+	uint4(0x03F01F00, 0xFF0FF07F, 0xF7FF3FF1, 0x00100000), uint4(0x1D000000, 0x00000C00, 0x00000000, 0x00000000),
+	uint4(0x00FFFFFF, 0x1D400000, 0x00000000, 0x00000000), uint4(0xFFFFFF00, 0x00FFFFFF, 0x1D800000, 0x80301603),
+	uint4(0x08C01803, 0xE30C7086, 0x00F1CE18, 0x1DC00000), uint4(0x00FFFFFF, 0x00000000, 0x00000000, 0x00000000),
+	uint4(0x1E000000, 0x3F63F83F, 0xE0380270, 0x03F03F03), uint4(0x0003F03F, 0x1E400000, 0xC7FEF010, 0x3703F87F),
+	uint4(0xFFF00160, 0x001F89FC, 0x1E800000, 0x9F39F39F), uint4(0xF39F39F3, 0x39F39F39, 0x0039F39F, 0x1EC00000),
+	uint4(0x00FFFFFF, 0x00000000, 0xFFFFFEF0, 0x00FFFFFF), uint4(0x1F000000, 0x0000701F, 0x0E000000, 0xFFCFF0F8),
+	uint4(0x00FFFFFF, 0x1F400000, 0xFFFFFFFF, 0xFFFFFFFF), uint4(0xFFFFFFFF, 0x003FF7FF, 0x1F800000, 0x8FF1FE1F),
+	uint4(0xFFCFFCFF, 0x000FFFFE, 0x00004004, 0x20000000), uint4(0x1F01F01F, 0xFE0FC0F0, 0xFE6FC7F0, 0x00FFCFF4),
+	uint4(0x20400000, 0xC0200803, 0x10040100, 0x06010040), uint4(0x00802008, 0x20800000, 0xE01E10E3, 0x07E0FE03),
+	uint4(0x8E19E0BE, 0x00837863, 0x20C00000, 0xFFFFFFFF), uint4(0x0000000F, 0x01F00000, 0x00FFF3FF, 0x21000000),
+	uint4(0x1C01003F, 0x7F8FE0F8, 0xC0200FFE, 0x00FC1F03), uint4(0x21800000, 0x08000EFF, 0x86182180, 0xE7BE3963),
+	uint4(0x00EFFEFB, 0x21C00000, 0x00000000, 0xFFFF0000), uint4(0x000FFFFF, 0x00000000, 0x22000000, 0xC0FC0F80),
+	uint4(0x0FF0FE0F, 0xFFCFF8FF, 0x000FE3FC, 0x22400000), uint4(0x01005079, 0x0F80E008, 0x0FCFF0FC, 0x00C00806),
+	uint4(0x22800000, 0xC870C00E, 0xF7EE7F07, 0x3077877C), uint4(0x00807207, 0x22C00000, 0x01C03007, 0x01C0380E),
+	uint4(0x03C0780E, 0x0000701F, 0x23800000, 0x1FC1FC1F), uint4(0xFE1FE1FE, 0xF1EE1EE1, 0x00F1EF1E, 0x23C00000),
+	uint4(0x300E0180, 0x300601C0, 0x00000000, 0x00000000), uint4(0x24000000, 0x7F07F07F, 0xF07F07F0, 0x07F07F07),
+	uint4(0x0007E07F, 0x24400000, 0xFCFE0F00, 0x00000FFF), uint4(0xFC0C0000, 0x00FFFFF8, 0x24800000, 0x9FF3FE7F),
+	uint4(0xF7EFFDFF, 0x00301F0F, 0x00801002, 0x24C00000), uint4(0x0F81FC3F, 0x30070070, 0x00000100, 0x00FFEFFF),
+	uint4(0x25000000, 0x00C00000, 0x0FC0F80E, 0xFFEFF8FF), uint4(0x00FFFFFF, 0x25400000, 0xFFFFF000, 0xF7FFFFFF),
+	uint4(0xFFFFE0C1, 0x00FFFFFF, 0x25800000, 0xB27A27C2), uint4(0xF3BE3BC7, 0x39E39F39, 0x0019C19C, 0x25C00000),
+	uint4(0xFFFFFFFF, 0xFFFFFFFF, 0x000FFFFF, 0x00000000), uint4(0x26000000, 0xE07F07F0, 0x07E07E07, 0x7C07C07C),
+	uint4(0x00780780, 0x26400000, 0x80F00F00, 0x03C07C0F), uint4(0x0F01F03E, 0x0007C0F8, 0x26800000, 0xE0FE0FE0),
+	uint4(0x0FE0FE0F, 0x1E03E07E, 0x000610E0, 0x26C00000), uint4(0xC0FE0FF0, 0x0F00F80F, 0x800C00E0, 0x00000000),
+	uint4(0x27000000, 0xFEDFECFE, 0xE7FEFFED, 0x4FE5FE3F), uint4(0x00C3EC7E, 0x27400000, 0xE0FE1FEE, 0x07E0FE0F),
+	uint4(0xFEC8200E, 0x00FE0FE3, 0x27800000, 0xC3F07C07), uint4(0xEFF9FE3F, 0x7E07F8FF, 0x00E00380, 0x27C00000),
+	uint4(0x7F7FFFFF, 0x00000070, 0xFFFFFF00, 0x00FFFFFF), uint4(0x28400000, 0x00F7FF3F, 0x07003001, 0xF03F01F0),
+	uint4(0x00F0FF07, 0x29400000, 0x7E87C0F8, 0xFF1FE3FC), uint4(0xFE7FCFF9, 0x007FBFF3, 0x29C00000, 0xF9FF3FE7),
+	uint4(0xCFFCFF9F, 0x3FF7FEFF, 0x001FF1FF, 0x2A000000), uint4(0x00FFBFF9, 0x80180080, 0x0F807803, 0x003F81F8),
+	uint4(0x2A400000, 0x78FC0F00, 0x00000020, 0xF80E0000), uint4(0x0000C1F0, 0x2A800000, 0x00C0381F, 0x0F00E00E),
+	uint4(0xFC0F80F0, 0x00FE0FC0, 0x2AC00000, 0xF7000060), uint4(0x8FF8FF1F, 0xFFCFFCFF, 0x00FFEFFE, 0x2B000000),
+	uint4(0x380700E0, 0x7E0F81C0, 0x1C0781F0, 0x000780F0), uint4(0x2B800000, 0x00FFFFEF, 0x18608208, 0x8E38E186),
+	uint4(0x00BE79E7, 0x2BC00000, 0x7F7FFFFF, 0x00000070), uint4(0x00000000, 0x0003F003, 0x2C000000, 0x02C02804),
+	uint4(0x0601E01C, 0x30030060, 0x00180180, 0x2C400000), uint4(0x00FFEFFF, 0x0000000C, 0xFFF00000, 0x00E00FFF),
+	uint4(0x2C800000, 0x1F01F01F, 0xF01F01F0, 0x01F01F01), uint4(0x0001F01F, 0x2CC00000, 0x00000000, 0x08008000),
+	uint4(0xE00E00C0, 0x00F80F00, 0x2D000000, 0x00000001), uint4(0x0F008000, 0x0FEFF0FC, 0x0000101F, 0x2D400000),
+	uint4(0xFFFFFFFF, 0x0000000F, 0x00000000, 0x00E03C01), uint4(0x2D800000, 0x0C40C40C, 0xE60E60E4, 0x20660660),
+	uint4(0x00206206, 0x2DC00000, 0x0FF0FE0F, 0xF18F38F7), uint4(0x02F04F0C, 0x0000F00F, 0x2E000000, 0xFF1FF0FF),
+	uint4(0xF3FF3FF1, 0x000FFF7F, 0x00001000, 0x2E400000), uint4(0xFFFFFFFF, 0xF1FF3FF7, 0x03F07F0F, 0x0000F01F),
+	uint4(0x2F000000, 0xFFFFFFFF, 0xE800000F, 0xFFFFFFFF), uint4(0x000FF7FF, 0x2F800000, 0x3803C03C, 0x00300380),
+	uint4(0x02002003, 0x00F00800, 0x2FC00000, 0xE00E00C0), uint4(0x00E00E00, 0x0F00E00E, 0x000F00F0, 0x30400000),
+	uint4(0xFEFFCFF8, 0xF0FFFFFF, 0xFFFFC000, 0x001FFFFF), uint4(0x30800000, 0x99399399, 0x93B93B93, 0x7BB7B93B),
+	uint4(0x007BB7BB, 0x30C00000, 0x3E83E03E, 0xF83F83F8), uint4(0xC3F83F83, 0x00C3FC3F, 0x31000000, 0xFFFFFFFF),
+	uint4(0x0FF8FFEF, 0xE00F80FE, 0x00000800, 0x31800000), uint4(0x9E31C21D, 0x70CF18F1, 0x8738670C, 0x0043B473),
+	uint4(0x31C00000, 0xFF0FF1FF, 0xF03F07F0, 0x00F01F03), uint4(0x0000700F, 0x32000000, 0x00000000, 0xFFFF0000),
+	uint4(0xFFEFFFFF, 0x00FF8FFC, 0x32400000, 0xFF000000), uint4(0x0000C00F, 0x00000000, 0x00FC0000, 0x32800000),
+	uint4(0xDF000010, 0xFF9FFDFF, 0xF0FF0FF9, 0x00C0FE0F), uint4(0x32C00000, 0x01E03E07, 0x0600601E, 0x00000020),
+	uint4(0x00E7FEFF, 0x33000000, 0x0000000F, 0xFC000000), uint4(0x00301F0F, 0x00000000, 0x33800000, 0x7FC3FC1F),
+	uint4(0x0000DFFC, 0xC00C0040, 0x00C00C00, 0x33C00000), uint4(0x01003007, 0x0E008010, 0x3F87E0F8, 0x001FF1FE),
+	uint4(0x34000000, 0xF8FF8FF8, 0x87F8FF8F, 0x0F81F83F), uint4(0x00038078, 0x34400000, 0xFF1FF3FF, 0x80FC0FE1),
+	uint4(0x02007007, 0x00F9FFFF, 0x34800000, 0x8C38C308), uint4(0xFFCEBCEB, 0x20722F3E, 0x00308300, 0x34C00000),
+	uint4(0x00000800, 0x00004004, 0x00020020, 0x00100100), uint4(0x35000000, 0x80F01E06, 0x0FE0FC0F, 0x3FC7F8FF),
+	uint4(0x00C7F9FE, 0x35400000, 0xFF1F83C0, 0xF39FC3F0), uint4(0x00100001, 0x00FC0E00, 0x35800000, 0x8C19C198),
+	uint4(0xC9CC98C9, 0xCCE8CE9C, 0x00CE6CCE, 0x35C00000), uint4(0x01802002, 0x0C018018, 0xE00C00C0, 0x00600E00),
+	uint4(0x36000000, 0x0780F81F, 0x1C038038, 0xC00C00C0), uint4(0x00E00E00, 0x36400000, 0xF8F80C00, 0x0000FFFF),
+	uint4(0xFFCFE0E0, 0x00800FFF, 0x36800000, 0x00D00D00), uint4(0x0D00D00D, 0xD00D00D0, 0x00D00D00, 0x36C00000),
+	uint4(0x00700FC0, 0xF3F87004, 0x1FF3FF3F, 0x001FF1FF), uint4(0x37000000, 0x00F00F00, 0x0F00F00F, 0xF00F00F0),
+	uint4(0x00F00F00, 0x37400000, 0x9FF1FF3F, 0x3FC7F8FF), uint4(0xFF1FE1FE, 0x00FF8FF0, 0x37800000, 0x0700F01F),
+	uint4(0x10030070, 0x00000000, 0x00000000, 0x37C00000), uint4(0x3F0FF1FF, 0x300701F0, 0xC0080000, 0x00F00E00),
+	uint4(0x38000000, 0xF0FE0FC3, 0xEFFCFF8F, 0x3FFFFFFF), uint4(0x0003F0FF, 0x38400000, 0xF8FE0FC0, 0xF7FFFFCF),
+	uint4(0x07F0FF3F, 0x0000F01F, 0x38800000, 0x03006006), uint4(0x1C018038, 0x600600C0, 0x00300300, 0x38C00000),
+	uint4(0x80381703, 0x00E01C01, 0x03807006, 0x0000C018), uint4(0x39400000, 0x80300C01, 0xC0300601, 0xC0180600),
+	uint4(0x00180300, 0x39800000, 0xFFFFBFF3, 0x1801000F), uint4(0x701E01C0, 0x007C0781, 0x39C00000, 0xFF003001),
+	uint4(0xFFFFFFF1, 0x1FFFFFFF, 0x0000301F, 0x3A000000), uint4(0xE03C13A1, 0xC1C81F03, 0xE87CCE8C, 0x00F83F07),
+	uint4(0x3AC00000, 0x10030030, 0x30110100, 0x00700700), uint4(0x00037017, 0x3B000000, 0x00000003, 0x00000000),
+	uint4(0x00000000, 0x00C00000, 0x3B400000, 0xFCFFCFFC), uint4(0xCFFCFFCF, 0xFFCFFCFF, 0x00FFCFFC, 0x3B800000),
+	uint4(0x1FC1FC1F, 0xFE1FC1FC, 0xE0FE0FE1, 0x00F0FF0F), uint4(0x3BC00000, 0x0FE07E03, 0xF63FE1FE, 0x0FF0FF27),
+	uint4(0x0063F27F, 0x3C000000, 0xFFFFFFFF, 0xFFFFFFFF), uint4(0x007000FF, 0x000FF01F, 0x3C800000, 0x00100100),
+	uint4(0x01001001, 0x10010010, 0x00100100, 0x3CC00000), uint4(0xF0FF0FF0, 0x0FF0FF0F, 0xFF0FF0FF, 0x00FF0FF0),
+	uint4(0x3D000000, 0x1F01F01F, 0xFE0F80F0, 0xFF8FE4F8), uint4(0x00FC3FF6, 0x3D400000, 0x00000FFF, 0x00000000),
+	uint4(0xFFFFFF00, 0x00FFFFFF, 0x3D800000, 0xFCFF0FE1), uint4(0xF07F3FEF, 0xE00C0100, 0x00380700, 0x3DC00000),
+	uint4(0x8FF0FF0F, 0xFFCFF8FF, 0xFEFFEFFC, 0x00000000), uint4(0x3E000000, 0x7FE7FF7F, 0xEC7EC7FE, 0x87C87CC7),
+	uint4(0x00078078, 0x3E400000, 0x0FC03406, 0x07FFE7FE), uint4(0xE1FE0360, 0x0011FE7F, 0x3E800000, 0x1F000001),
+	uint4(0xFFFFFFF0, 0x1FFFFFFF, 0x0000301F, 0x3F000000), uint4(0xFF1FC9F0, 0xF1FF1FF1, 0x1FC1FE1F, 0x001F01F8),
+	uint4(0x3F400000, 0x0101E0F0, 0x00000000, 0x00000000), uint4(0x001E0F00, 0x3F800000, 0x3C03C07C, 0xD11D11D0),
+	uint4(0x30710D10, 0x00303307, 0x3FC00000, 0xFFFFFFFF), uint4(0x0000000F, 0x00000000, 0x00000000, 0x40000000),
+	uint4(0x0400400C, 0xDFFD0000, 0xFFCFFCFF, 0x007FCFFC), uint4(0x40400000, 0xE7F0FC1F, 0x000001B7, 0xC0000000),
+	uint4(0x00FC0F00, 0x40800000, 0x80F03E0F, 0x0FE0FC0F), uint4(0xFFCFF8FF, 0x003FFFFE, 0x41000000, 0x00F80FC0),
+	uint4(0x0C00E00F, 0x00000080, 0x00FFF000, 0x41400000), uint4(0x7C07F87E, 0xFF30E200, 0x83C03F83, 0x00F3CFA0),
+	uint4(0x41800000, 0xF08F08F0, 0x08F08F08, 0x8F08F08F), uint4(0x008F08F0, 0x41C00000, 0x80200BFF, 0xC3F03E03),
+	uint4(0x3FF3FF3F, 0x00BFF3FF, 0x42000000, 0x00FFF9FF), uint4(0x0E006004, 0xF81F80F0, 0x00FC3FC1, 0x42400000),
+	uint4(0x06006006, 0x60060060, 0x00600600, 0x00006006), uint4(0x42800000, 0x00040040, 0x00200200, 0x00002002),
+	uint4(0x00010010, 0x42C00000, 0x80C0100F, 0xFFFEFF0F), uint4(0x00707F7F, 0x00F80C00, 0x43800000, 0xC73C73C6),
+	uint4(0x31C33C73, 0x9C39C31C, 0x00CC1DC1, 0x43C00000), uint4(0x00FFFFFF, 0xFFFF0000, 0xFFFFFFFF, 0x00FFFFFF),
+	uint4(0x44000000, 0xE01F01F8, 0x01C01E01, 0x10018018), uint4(0x00FFFFFF, 0x44400000, 0xC0FC0FC0, 0x0FC0FC0F),
+	uint4(0xFC0FC0FC, 0x00FC0FC0, 0x44800000, 0x03001000), uint4(0xF00F0070, 0x07F03F01, 0x001FF0FF, 0x44C00000),
+	uint4(0xFFFFF000, 0xFFFFFFFF, 0x83F0FF7F, 0x00F81E0F), uint4(0x45000000, 0x00F00F60, 0x0840C00F, 0x07006006),
+	uint4(0x00078070, 0x45400000, 0x1F81EF30, 0x8F1F81F0), uint4(0xC0FF8CFE, 0x00E07007, 0x45800000, 0x1E81E81C),
+	uint4(0x7E0FE0FC, 0xF83F07F0, 0x007C3783, 0x45C00000), uint4(0x00000000, 0x00000000, 0xFFFFF0C0, 0x00000FFF),
+	uint4(0x46000000, 0xF81F81FC, 0x81F81F81, 0x1F81F81F), uint4(0x001F01F0, 0x46400000, 0xE00E01E0, 0x00E00E00),
+	uint4(0x0600600E, 0x00060060, 0x46800000, 0xFEFFCFF8), uint4(0xFFFFFFFF, 0xFFFFFFFF, 0x00FFFFFF, 0x46C00000),
+	uint4(0xFF3FF7FE, 0xF01F07F0, 0x00100300, 0x00000000), uint4(0x47000000, 0xE0FF0FF0, 0x0FC0FE0F, 0xF80F80FC),
+	uint4(0x00F00F00, 0x47800000, 0x80380300, 0x00C00C01), uint4(0x03006006, 0x00018010, 0x47C00000, 0xE0FE0FC0),
+	uint4(0x0FF0FE0F, 0xFF8FF0FF, 0x00FF8FF8, 0x48400000), uint4(0x7CE7CCF9, 0xFF1EF3EE, 0x7C778FF9, 0x001E33E7),
+	uint4(0x48C00000, 0x700700F0, 0x00300300, 0xFFF01001), uint4(0x00FF7FFF, 0x49000000, 0xC0FF0FFC, 0xF400F00F),
+	uint4(0x00301F0F, 0x00000000, 0x49400000, 0x00000001), uint4(0x00000000, 0xF00E0080, 0x00FE0F80, 0x49800000),
+	uint4(0x1F42F87F, 0x73076076, 0x18218130, 0x008E18C0), uint4(0x49C00000, 0xFF3FF7FF, 0xF81F07F0, 0xFC1F03E0),
+	uint4(0x00FF8FE0, 0x4A000000, 0x00C013FF, 0x0E00E00C), uint4(0x19FF00F0, 0x00FC0F80, 0x4A800000, 0xC6386386),
+	uint4(0x39C79C69, 0x8E39E39C, 0x00CE3CE3, 0x4AC00000), uint4(0x00E00E00, 0x0F80F80F, 0xFE0FE0FC, 0x00FF8FF0),
+	uint4(0x4B000000, 0x0000100F, 0xF7F8FC0E, 0xC0000F07), uint4(0x00FF0F80, 0x4B800000, 0x00FC0FFC, 0x0000000E),
+	uint4(0x00000000, 0x00FFCFFF, 0x4BC00000, 0x3F7BFFBF), uint4(0x00400470, 0x0E00E00C, 0x001F01E0, 0x4C000000),
+	uint4(0xFE3FE7FD, 0xF87F8FF1, 0xE07C0FC1, 0x00701E03), uint4(0x4C400000, 0x30F20FC0, 0xF01F03C8, 0x80F01F01),
+	uint4(0x00F8FE0F, 0x4C800000, 0xFEDFE9FC, 0x0000DFFD), uint4(0x30010000, 0x00381381, 0x4CC00000, 0xFFFFF000),
+	uint4(0xFE1FE7FC, 0xF81F03F0, 0x00FC0F80, 0x4D400000), uint4(0x00C00C00, 0x0E00C00C, 0xE00E00E0, 0x00F00F00),
+	uint4(0x4D800000, 0x80F00F00, 0x0FC0FC0F, 0x0F01F03E), uint4(0x0001C038, 0x4E400000, 0xFF000C00, 0x0FF0FFEF),
+	uint4(0x800E00FC, 0x00FFFFFF, 0x4E800000, 0xE0FE0FF0), uint4(0x0FC0FE0F, 0xF80FC0FC, 0x00F80F80, 0x4F000000),
+	uint4(0x80F00E01, 0x0FC0F80F, 0xFF8FF0FE, 0x003FC7F8), uint4(0x4F400000, 0xFF03F01F, 0xF3FF1FF0, 0xFFFFFFFF),
+	uint4(0x00000000, 0x4F800000, 0x63463462, 0x36236236), uint4(0x23163163, 0x00331231, 0x4FC00000, 0xF8FF8FF8),
+	uint4(0x8FF8FF8F, 0xFF8FF8FF, 0x00FF8FF8, 0x50400000), uint4(0x0100300F, 0x0E00C018, 0xF80F80F0, 0x007E0FC0),
+	uint4(0x50C00000, 0x0701F07F, 0x00000010, 0x00000000), uint4(0x00000000, 0x51000000, 0x00C01C03, 0x01803006),
+	uint4(0x0600600C, 0x00018030, 0x51400000, 0x1FFFFF80), uint4(0x00000000, 0xFFE80000, 0x0003FFFF, 0x51800000),
+	uint4(0x78E78E7C, 0xC67C6786, 0x63E63C63, 0x0033E73C), uint4(0x51C00000, 0xF7FE7FEF, 0x9FF1FF3F, 0xFFCFF8FF),
+	uint4(0x007FCFFC, 0x52400000, 0x07C0FC1F, 0x0F81F03E), uint4(0x1E03E07C, 0x000F81F0, 0x52800000, 0xE0FE0FC0),
+	uint4(0x03F07E0F, 0x0F01F03F, 0x000780F8, 0x52C00000), uint4(0x1FC1FC1F, 0xFF0FE0FE, 0xF87F87F0, 0x00FC3FC7),
+	uint4(0x53000000, 0x00000FFF, 0x00000000, 0x00000000), uint4(0x00000000, 0x53400000, 0x0460460C, 0x63043043),
+	uint4(0x18210230, 0x00182182, 0x53C00000, 0x1FC1FC1E), uint4(0x7F8FF0FE, 0x1F77E7FC, 0x0001B073, 0x54400000),
+	uint4(0x0700F01F, 0x30038070, 0xC01C0180, 0x00F00C00), uint4(0x54800000, 0x60C618C1, 0x8E30C30C, 0x708718E1),
+	uint4(0x0038430C, 0x54C00000, 0x81783703, 0x01C03C13), uint4(0x0700E01E, 0x00038078, 0x55400000, 0xC0FFFFFF),
+	uint4(0xF7FFE00F, 0x07F0FF3F, 0x0000FF18, 0x55800000), uint4(0x7F8FF3FF, 0x37CFF1FC, 0x01E0791E, 0x00001007),
+	uint4(0x55C00000, 0x40040040, 0x08000400, 0xF00E00C0), uint4(0x00F40F80, 0x56000000, 0x38C38C70, 0xEF1CE3CE),
+	uint4(0x38F78E71, 0x003C73CF, 0x56C00000, 0xE3FC7F87), uint4(0xDFF9FF3F, 0x3FF7FE7F, 0x001FF3FF, 0x57000000),
+	uint4(0x00000003, 0x0E008000, 0x0781E038, 0x00C0F83E), uint4(0x57400000, 0x80780700, 0x03C03C03, 0x1F01E01E),
+	uint4(0x000F80F0, 0x57800000, 0x7C007004, 0xEFFE7FC0), uint4(0x3FE7FEFF, 0x000FF1FE, 0x57C00000, 0x01FFFFFE),
+	uint4(0xF01F0070, 0x3FF0FF03, 0x00FFF7FF, 0x58000000), uint4(0xE0FE0FC0, 0x8FF0FF0F, 0xFFCFF8FF, 0x00FFEFFC),
+	uint4(0x58400000, 0x87E0F81C, 0xEFF9FE3F, 0x1C030040), uint4(0x008FC1F0, 0x58800000, 0xCF1CF1CF, 0xF06F06F0),
+	uint4(0x01F00F02, 0x0080780F, 0x58C00000, 0x7F7FFFFF), uint4(0x00000070, 0x00000000, 0x00FFFFFF, 0x59000000),
+	uint4(0xFF7FFFFF, 0xF3FF7FF7, 0x1FF3FF3F, 0x001FF1FF), uint4(0x59400000, 0x7FE7FE7F, 0xFE7FE7FE, 0xE7FE7FE7),
+	uint4(0x00E7FE7F, 0x59800000, 0x1E61E61E, 0xE61E61E6), uint4(0x61E61E61, 0x0061E61E, 0x59C00000, 0xFF7FFFFF),
+	uint4(0xFBFFFFF7, 0xDFFFFFBF, 0x00FFFDFF, 0x5A000000), uint4(0xF8FF0FC0, 0xFFFFFFEF, 0xFFFFFFFF, 0x007FFFFF),
+	uint4(0x5A400000, 0x0600600E, 0x70070060, 0x00300300), uint4(0x00003003, 0x5A800000, 0x0C20C60C, 0xC20C20C2),
+	uint4(0x20420C20, 0x00204204, 0x5AC00000, 0x0000701F), uint4(0x00000000, 0x80000000, 0x00F80E00, 0x5B400000),
+	uint4(0xFEFF8FF0, 0xFFFFFFFF, 0xFFFFFFFF, 0x000FF7FF), uint4(0x5B800000, 0x00000007, 0xFFFFFFF0, 0xFFFFFFFF),
+	uint4(0x0000F7FF, 0x5BC00000, 0x01C01407, 0x3F83F03E), uint4(0xFE7FC7F8, 0x0000F7E7, 0x5C000000, 0xF87C0E7F),
+	uint4(0x0FFFFFFF, 0x00700000, 0x007FF07F, 0x5C800000), uint4(0x30630630, 0x06306306, 0x63063063, 0x00630630),
+	uint4(0x5CC00000, 0x00000003, 0xF0000000, 0x3FFFFFFF), uint4(0x00E3FCFF, 0x5D400000, 0xFFFFFFFF, 0x000001F7),
+	uint4(0x01F00700, 0x003FF0FF, 0x5D800000, 0x73673673), uint4(0x36336336, 0x23163163, 0x00231231, 0x5DC00000),
+	uint4(0x80301603, 0x00600C01, 0x80C01803, 0x00603C06), uint4(0x5E000000, 0x0000701F, 0x00000000, 0x00000000),
+	uint4(0x00FFFFFF, 0x5E400000, 0xF8FE0F80, 0xFFFFFFEF), uint4(0x0FF3FFFF, 0x00C0F03F, 0x5E800000, 0xE0010018),
+	uint4(0xFF9FFDFF, 0xC0FE0FF0, 0x0000E80F, 0x5F000000), uint4(0x00C00800, 0x01803006, 0x0300600C, 0x0000C018),
+	uint4(0x5F400000, 0x1FC1FC1F, 0xFC1FC1FC, 0xC1FC1FC1), uint4(0x00C1FC1F, 0x5FC00000, 0x00000000, 0x08000000),
+	uint4(0xF00E00C0, 0x00FC0F80, 0x60400000, 0xF0FC3E07), uint4(0xFC7F1FC7, 0xFFBFEFF3, 0x00200000, 0x60800000),
+	uint4(0xFBEFBEF9, 0x4000FFBE, 0x20420400, 0x0030C20C), uint4(0x60C00000, 0xF87F0FE1, 0xE0FC1FC3, 0x01F03F07),
+	uint4(0x0000700F, 0x61000000, 0x00C00000, 0xCFF0FC0F), uint4(0xFFFFFFFF, 0x00FFFFFF, 0x61400000, 0x00007FFF),
+	uint4(0xFFFFFC00, 0xFFFFFFFF, 0x000FC70F, 0x61800000), uint4(0x80380300, 0x01C01803, 0x0E00C01C, 0x000600E0),
+	uint4(0x61C00000, 0xFFFFEFF8, 0x0000000F, 0x00000000), uint4(0x00001001, 0x62000000, 0x1C83C83C, 0xE81E81E8),
+	uint4(0x81F81E81, 0x0080F81F, 0x62400000, 0x1FC1F83F), uint4(0x3F07F0FE, 0xFE1FC1F8, 0x00FF0FF0, 0x62800000),
+	uint4(0x000600F0, 0x7F0FF9F0, 0x801C03E0, 0x00000000), uint4(0x62C00000, 0x81081001, 0x00400000, 0x02000004),
+	uint4(0x00000020, 0x63C00000, 0x00000000, 0xFFFF0000), uint4(0xFFFFFFFF, 0x00000000, 0x64000000, 0x00FE0FFF),
+	uint4(0x0000000C, 0x00000000, 0x00000000, 0x64800000), uint4(0xF8FF8FF0, 0xEFFCFFCF, 0x001FFEFF, 0x00001001),
+	uint4(0x64C00000, 0x7C01C005, 0xCFFC3FC0, 0x03C0FC7F), uint4(0x0000100C, 0x65000000, 0x00201403, 0x00801801),
+	uint4(0x03006004, 0x0000C018, 0x65400000, 0x01703E03), uint4(0x01803013, 0x0C008018, 0x00800040, 0x65C00000),
+	uint4(0x00000020, 0x00040000, 0x00000000, 0x00000000), uint4(0x66400000, 0x80FC0FE0, 0x0F00F80F, 0xC00E00E0),
+	uint4(0x00800800, 0x66800000, 0xC104300F, 0x11C01C00), uint4(0x7C37C33C, 0x003CFFC7, 0x66C00000, 0x7C87C83C),
+	uint4(0xC87C87C8, 0x8FC87C87, 0x008FC8FC, 0x67000000), uint4(0x00FFFFFF, 0xF0000000, 0xFFFFFFFF, 0x00000FFF),
+	uint4(0x67800000, 0x0300700F, 0x00000010, 0xE00C0000), uint4(0x007C0F00, 0x67C00000, 0xFF1FF1FF, 0xF1FF1FF1),
+	uint4(0x1FF1FF1F, 0x001FE1FF, 0x68400000, 0xF0FE0F80), uint4(0xF07E7F8F, 0xC0080000, 0x00F80F00, 0x68800000),
+	uint4(0xDF09F0BE, 0x306704F0, 0xC7187186, 0x00E38C38), uint4(0x68C00000, 0x00000000, 0x00000000, 0xFFEFC080),
+	uint4(0x000070FF, 0x69000000, 0x3F07F0FF, 0x700F01F0), uint4(0xF0180300, 0x00FFCFE0, 0x69400000, 0xE0FC1F87),
+	uint4(0xE07C1F83, 0x80700F03, 0x00200C01, 0x69800000), uint4(0x00000003, 0xFFF8F808, 0x1FFFFFFF, 0x0000303F),
+	uint4(0x69C00000, 0xFF1FF3FE, 0xF03F07F0, 0x00700F01), uint4(0x003C1603, 0x6A000000, 0xFFFFF7FF, 0x0000000F),
+	uint4(0x00000000, 0x00001000, 0x6A400000, 0xF8FE3FDF), uint4(0xFFFEFFCF, 0x01F0FF7F, 0x00000003, 0x6A800000),
+	uint4(0x00FFFFFF, 0x00000000, 0x00000000, 0x00FFFFFF), uint4(0x6AC00000, 0xFFFFF000, 0xFFFFFFFF, 0xFFFFFFFF),
+	uint4(0x00000000, 0x6B000000, 0x0FE0FC1F, 0x7F07E0FE), uint4(0xF07F07F0, 0x00783783, 0x6B400000, 0xFE7FFFFF),
+	uint4(0x1FE70380, 0x800E00F8, 0x00000000, 0x6B800000), uint4(0x1FC1F81F, 0xFFCFF8FF, 0x000FF7FE, 0x00803006),
+	uint4(0x6C000000, 0xFF1FE1FE, 0xFDFF9FF9, 0x000FFFDF), uint4(0x00100100, 0x6C400000, 0x00E00E1F, 0x0E00E00E),
+	uint4(0xE00E00E0, 0x00E0FE00, 0x6D000000, 0x0000200C), uint4(0x00000000, 0x00000000, 0x00200C00, 0x6D400000),
+	uint4(0x3F87CEC0, 0x700F01F0, 0xE01FF3FC, 0x00C00000), uint4(0x6D800000, 0xDF7BF77F, 0x37E77CF7, 0x7F87F97F),
+	uint4(0x007FE7FC, 0x6DC00000, 0x02004008, 0x0200C018), uint4(0x04008010, 0x00018030, 0x6E000000, 0x0000100F),
+	uint4(0x00000000, 0x00000000, 0x00000000, 0x6E400000), uint4(0xFFFFFFFF, 0xF07F3FFF, 0x00000100, 0x00000000),
+	uint4(0x6EC00000, 0x7F0FF0FF, 0xF07F07F0, 0x03F07F07), uint4(0x0003F03F, 0x6F000000, 0xE002701F, 0x03E01E00),
+	uint4(0xFE0FE07E, 0x00FE0FE0, 0x6F400000, 0x0003FFFF), uint4(0x00000000, 0x83F00000, 0x00C0087F, 0x6F800000),
+	uint4(0xC73C73C7, 0x31E71E71, 0x8E39E39E, 0x008F38F3), uint4(0x6FC00000, 0xFF3FF2FF, 0xF2FF2FF1, 0xE3F63F67),
+	uint4(0x00E0FE1F, 0x70400000, 0x00FF0000, 0x00000000), uint4(0x000FFF00, 0x00000000, 0x70800000, 0xC79C79C7),
+	uint4(0x79C79C79, 0x9C79C79C, 0x009C79C7, 0x70C00000), uint4(0x0F01F03F, 0x10030070, 0x00000000, 0x00000000),
+	uint4(0x71000000, 0x7F3FF3FF, 0x83E03872, 0x3FF3FE3F), uint4(0x003FF3FF, 0x71400000, 0x00F00F00, 0x1F01F00F),
+	uint4(0xF01F01F0, 0x00F03F03, 0x71800000, 0xE3FE7FE7), uint4(0x13E17E37, 0x1E03E03E, 0x000E01E0, 0x71C00000),
+	uint4(0x3F03C838, 0xF03F03F0, 0xE1EC1F03, 0x00FD0F98), uint4(0x72800000, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF),
+	uint4(0x00FFF000, 0x72C00000, 0x00001006, 0x00000000), uint4(0x00000000, 0x00F7F000, 0x73400000, 0xFE0FE1FE),
+	uint4(0xF0FF0FF0, 0x07F07F0F, 0x0007F07F, 0x73800000), uint4(0x7CCFD9F9, 0xEC3CC7CC, 0xE1EE1EE3, 0x0070F60E),
+	uint4(0x73C00000, 0xBF0BF07F, 0xF39F19F1, 0xF8778F78), uint4(0x00F83F87, 0x74400000, 0xFFFFF000, 0x0000000F),
+	uint4(0xFFF00000, 0x00FFFFFF, 0x74800000, 0x00000000), uint4(0x00008000, 0xEFFDFF00, 0x00F3FE7F, 0x75400000),
+	uint4(0x00FFCFFF, 0x0000000E, 0xFC0E0000, 0x00FFFFFC), uint4(0x75800000, 0xF0FF0FE3, 0xCFF8FF8F, 0x07E1FC3F),
+	uint4(0x0000F03E, 0x75C00000, 0x00000000, 0x0FC0F00C), uint4(0xFFFFFCFF, 0x00FFFFFF, 0x76400000, 0x0300F03F),
+	uint4(0xF0000000, 0x7FFFFFFF, 0x0007C1FE, 0x76800000), uint4(0x0103F7FF, 0x0E00C008, 0xF80F00E0, 0x00FE0FC0),
+	uint4(0x76C00000, 0x07007003, 0xF00F00F0, 0x03F01F01), uint4(0x0007F03F, 0x77000000, 0xF8FFB01C, 0x0FF0FF8F),
+	uint4(0x0000F07F, 0x00FE0FE3, 0x77800000, 0x00000000), uint4(0xFFBFFBF0, 0xE3FF3FF3, 0x00E3FE3F, 0x77C00000),
+	uint4(0x00000FFF, 0xF0000000, 0xFFFFFFFF, 0x00FFFFFF), uint4(0x78000000, 0x0000300F, 0x00000000, 0xE0080000),
+	uint4(0x003C0F00, 0x78400000, 0x00007078, 0xF0000000), uint4(0x8FFFFFFF, 0x00FF0F87, 0x78800000, 0xF88F09E0),
+	uint4(0xFE3EC7CC, 0xF0FF1FE3, 0x00F87F8F, 0x79000000), uint4(0xFFE0007F, 0xFFFFFFFF, 0x0000007F, 0x00FFFFF8),
+	uint4(0x79800000, 0x7E0FE3FE, 0x200E01E0, 0xFFEFFF00), uint4(0x00FFEFFE, 0x79C00000, 0xC0180E7F, 0xEFF8FF07),
+	uint4(0xFFFFFFFF, 0x00FFFFFF, 0x7A000000, 0xFF3FF7FF), uint4(0xFE1F87F0, 0x00D0F3F8, 0x00000000, 0x7A400000),
+	uint4(0xE0F00803, 0x703F1FCF, 0xFC0E0000, 0x0007F3F8), uint4(0x7A800000, 0x03C07E07, 0x13014038, 0x1F83F03C),
+	uint4(0x000FF1FE, 0x7AC00000, 0x7F07F07F, 0xF03F03F0), uint4(0x03F03F03, 0x0001F01F, 0x7B000000, 0x3F07F0FF),
+	uint4(0x700F01F0, 0xC0180300, 0x00F00E00, 0x7B400000), uint4(0xFF000000, 0xFFFFFFFF, 0x000FFFFF, 0x00FFF000),
+	uint4(0x7B800000, 0x00F01E07, 0x1F00F00F, 0x39FF07F0), uint4(0x000BF0BF, 0x7BC00000, 0x0300F01F, 0x00000010),
+	uint4(0xFFF00000, 0x00FFFFFF, 0x7C000000, 0x07F0FF9F), uint4(0xF402E07F, 0x3F13F9FF, 0x001E01F0, 0x7C800000),
+	uint4(0x07803803, 0x78078078, 0x80F80F80, 0x0080F80F), uint4(0x7CC00000, 0xE03F87FE, 0xFE1F0000, 0x00100380),
+	uint4(0x00000000, 0x7D000000, 0x7EC7EC7E, 0xEC7EC7EC), uint4(0x87C87C87, 0x0087C87C, 0x7D400000, 0xFF0FF07F),
+	uint4(0xF7FF3FF1, 0x000000FF, 0x00000000, 0x7D800000), uint4(0x00300380, 0x03003003, 0x20020020, 0x00C00A00),
+	uint4(0x7DC00000, 0x00000003, 0xFFFF0000, 0x3FFFFFFF), uint4(0x0003F0FF, 0x7E000000, 0x1FF0FF0F, 0xFF9FF1FF),
+	uint4(0xFBFFBFFB, 0x00000000, 0x7E400000, 0xFEFFFFFF), uint4(0xFE7F1E07, 0x00100701, 0x00000000, 0x7E800000),
+	uint4(0x80E00801, 0xEFF8FE0F, 0x03F0FF7F, 0x0000100F), uint4(0x7F000000, 0x7F07F0FF, 0xF03F03F0, 0xC0F81F01),
+	uint4(0x00E07C0F, 0x7F400000, 0xF81F9000, 0x81F83F8F), uint4(0x00001807, 0x00FF80F9, 0x7F800000, 0x80F81FC3),
+	uint4(0x0700F80F, 0xE0090030, 0x00E3CE60, 0x7FC00000), uint4(0x01003007, 0xCFC0C000, 0x000FFFFF, 0x00000000),
+	uint4(0x80400000, 0x00FFFFFF, 0xFFFFFFF0, 0xFFFFFFFF), uint4(0x00000000, 0x80800000, 0x1F80F80F, 0xF83F81F8),
+	uint4(0x87F87F83, 0x008FF8FF, 0x80C00000, 0xFFFFFFFF), uint4(0x0800000F, 0xFE0F80E0, 0x00FFEFF8, 0x81000000),
+	uint4(0xC0F80187, 0x0FE0FE0F, 0xFF8FF8FF, 0x0000E7FC), uint4(0x81400000, 0x1FFFFFFF, 0xEFE0E000, 0x00F07F1F),
+	uint4(0x00FC0C03, 0x81800000, 0xF01E03E1, 0xCCF88F09), uint4(0x63E67CC7, 0x0031F23E, 0x81C00000, 0xFF7FF7FE),
+	uint4(0xF7FF7FF7, 0x7FF7FF7F, 0x007FC7FF, 0x82000000), uint4(0x0101F1FF, 0x00000000, 0xF00E0080, 0x00FE0F80),
+	uint4(0x82400000, 0x80F80F80, 0x0F80F80F, 0xF80F80F8), uint4(0x00780F80, 0x82800000, 0x10FFFBEF, 0x08308100),
+	uint4(0xC71C70C3, 0x00CF3CF1, 0x82C00000, 0xF01E03C1), uint4(0xE83C0780, 0xF07E0FC1, 0x003C1783, 0x83000000),
+	uint4(0x00F00E03, 0xF087F80F, 0xFE0FC0FC, 0x001F0FE0), uint4(0x83800000, 0xFD9FC9FC, 0x0000BFDB, 0x80480400),
+	uint4(0x0081C80C, 0x83C00000, 0xFFFFFFFF, 0x0000FFFF), uint4(0x00000000, 0x00000000, 0x84000000, 0xFE1FE1FE),
+	uint4(0xF7FE3FE3, 0x002FFF7F, 0x00006002, 0x84400000), uint4(0xC0E007FF, 0x0FFFFFCF, 0x00F00000, 0x007FF07F),
+	uint4(0x84800000, 0x20E00E40, 0x8E10E10E, 0xE04E0CE0), uint4(0x00E03E06, 0x84C00000, 0xFF3FF3FF, 0xF0FF0FF1),
+	uint4(0x83F83F07, 0x00E0FC1F, 0x85000000, 0x7C87CC7E), uint4(0x00700780, 0x06006007, 0x00040040, 0x85400000),
+	uint4(0xF8FF8FF8, 0x0FF0FF0F, 0xFE0FE0FF, 0x00FC0FE0), uint4(0x85800000, 0x80380380, 0x01C01801, 0x0C00C01C),
+	uint4(0x000E00E0, 0x85C00000, 0x00000000, 0x08008000), uint4(0x40040000, 0x00200000, 0x86000000, 0xFF7FFFFF),
+	uint4(0xF3FF7FF7, 0x9FF3FF3F, 0x00DFF9FF, 0x86400000), uint4(0x1F0FF7FF, 0xEF800030, 0x000FFFFF, 0x00E00000),
+	uint4(0x86800000, 0x00100201, 0xFFFFFFF0, 0xFE7FEFFD), uint4(0x003F17F3, 0x86C00000, 0xFFE00000, 0x0FFFFFFF),
+	uint4(0xFFFFF800, 0x000FF7FF, 0x87800000, 0x1FC3FC7F), uint4(0x3C07C0FC, 0xC00C01C0, 0x00C00C00, 0x87C00000),
+	uint4(0x00E03C0E, 0x0FC0F80F, 0xFF8FF0FE, 0x003FEFFC), uint4(0x88400000, 0xFC7F0400, 0x07C07F07, 0x7FEF0060),
+	uint4(0x007C07F8, 0x88800000, 0x18318211, 0x608C10C1), uint4(0x84204608, 0x00423043, 0x88C00000, 0xFF1FF1FF),
+	uint4(0x00003FF3, 0xFC0F0060, 0x00FF8FE0, 0x89000000), uint4(0x00FC0FFC, 0x0800000E, 0xFFFFFFFF, 0x00FFCFFF),
+	uint4(0x89400000, 0x80F81F87, 0xF0001803, 0xF87F8FFB), uint4(0x00380F81, 0x89800000, 0x00200204, 0x21020000),
+	uint4(0x00000010, 0x00081001, 0x89C00000, 0x007C07E0), uint4(0xF4006007, 0x7FC7FF7F, 0x007E07F8, 0x8A400000),
+	uint4(0xE07E0FE0, 0x10E70270, 0xFE0FE0FE, 0x00FE0FE0), uint4(0x8A800000, 0xFEFFCFF9, 0x001FFFFF, 0xFFFFFF00),
+	uint4(0x000031FF, 0x8B800000, 0xC03C07C0, 0x03E03E03), uint4(0x1E01E01E, 0x000F01F0, 0x8BC00000, 0xFFFFFFFF),
+	uint4(0xFFFFFFFF, 0x000FFFFF, 0x00007001, 0x8C400000), uint4(0x00000004, 0x08000000, 0x00000000, 0x00000010),
+	uint4(0x8C800000, 0xFFFFEFF8, 0x0000000F, 0xFC0F00C0), uint4(0x007F8FE0, 0x8CC00000, 0xFFFFFFFF, 0x0000000F),
+	uint4(0x80000000, 0x00C00C00, 0x8D000000, 0xFFFFFFFF), uint4(0xFFFFFFFF, 0xFFF000FF, 0x00000000, 0x8D800000),
+	uint4(0x60060060, 0x00400400, 0xFFF00004, 0x00F7EFFF), uint4(0x8DC00000, 0xFFFF0F00, 0x0000FFFF, 0x00000000),
+	uint4(0x00000000, 0x8E400000, 0x00000E00, 0xFFFF0000), uint4(0xF00FFFFF, 0x00000000, 0x8E800000, 0x30030030),
+	uint4(0x00300300, 0x03003003, 0x00030030, 0x8EC00000), uint4(0xF03FC3FE, 0x03C03E03, 0xBFF20030, 0x003FE3FF),
+	uint4(0x8F000000, 0x3FC3FC3F, 0xFE1FE1FE, 0xF8FF0FF0), uint4(0x00F87F87, 0x8FC00000, 0x009FF8FF, 0x3E01C004),
+	uint4(0xF1FE07E0, 0x00080F3F, 0x90800000, 0xBC3BC7BC), uint4(0xC1BC3BC3, 0x0BC1BC1B, 0x000BE0BE, 0x90C00000),
+	uint4(0x00E00C00, 0x0F80F00E, 0xFE0FC0FC, 0x00FF8FF0), uint4(0x91000000, 0x1C83C83C, 0x801801C8, 0x01801801),
+	uint4(0x00008018, 0x91400000, 0x8FF8FF9F, 0xF78F78F7), uint4(0x7CF7CF7C, 0x007CF7CF, 0x91C00000, 0x0780700F),
+	uint4(0x1C01C038, 0xE00E00C0, 0x00700F00, 0x92000000), uint4(0x0780780F, 0x3C03C07C, 0xE01E03E0, 0x00701F01),
+	uint4(0x92400000, 0x3FC3E87C, 0x003FFBFF, 0xC0E01801), uint4(0x00F8FE0F, 0x92800000, 0x8008107B, 0xC98C0840),
+	uint4(0xBDC98C98, 0x00BDCBDC, 0x92C00000, 0x00400400), uint4(0x04004004, 0x40040040, 0x00400400, 0x93400000),
+	uint4(0xFCFF8FF0, 0xF7FFFFEF, 0xE07C3F8F, 0x007C0F81), uint4(0x93800000, 0x18C0B807, 0xEE1CE1CC, 0x33E71EE1),
+	uint4(0x000BF1BF, 0x93C00000, 0xF0FF8FFC, 0x0F80FC0F), uint4(0x800C00F0, 0x00000000, 0x94400000, 0xE0980C00),
+	uint4(0xF1FF1FC1, 0x0FF0FF0F, 0x000FF0FF, 0x94800000), uint4(0xFB1F31F3, 0xDCFD8F99, 0xE7EC7CCF, 0x00E3EE7E),
+	uint4(0x94C00000, 0xFCFF0FC0, 0xFFFFFFFF, 0xFFFFFFFF), uint4(0x001FF7FF, 0x95000000, 0xC09C0D80, 0x01F01E01),
+	uint4(0x1FC1F81F, 0x001FE1FC, 0x95400000, 0xC3F87E0F), uint4(0xC3F97F3F, 0xF7FEFF9F, 0x00020000, 0x95800000),
+	uint4(0xC03E03F0, 0x03003803, 0xBFF00020, 0x003FC3FE), uint4(0x95C00000, 0xFEFFEFE0, 0xC1FC7FEF, 0x03C07C0F),
+	uint4(0x00FC0018, 0x96000000, 0xE0FFCFFF, 0x0800F00F), uint4(0x00000000, 0x00000000, 0x96400000, 0xFFFFCFC3),
+	uint4(0xF0FFFFFF, 0xFFFFF0F0, 0x001FFFFF, 0x96800000), uint4(0xFF3FF3FF, 0xF0FF0FF1, 0x03C03E07, 0x00FEF018),
+	uint4(0x97400000, 0x00000000, 0x000007EF, 0xFE000000), uint4(0x00000001, 0x97800000, 0xE4FE8FE0, 0x3FE2FE6F),
+	uint4(0x7E1FE1FE, 0x003E07E0, 0x97C00000, 0x7FE03E00), uint4(0x0E00E00E, 0xE00E00E0, 0x00E00E00, 0x98000000),
+	uint4(0x00C00800, 0x0780F00E, 0x0F01E03C, 0x0003C078), uint4(0x98400000, 0x1FCFF000, 0x0E00E03C, 0xF80F00F0),
+	uint4(0x00FC0F80, 0x98800000, 0x3803C03C, 0x00100300), uint4(0xFDFFDF00, 0x00F1FF9F, 0x98C00000, 0x00000007),
+	uint4(0x00000000, 0xFFFFFF00, 0x000FF7FF, 0x99000000), uint4(0xFFFFFFF1, 0x000F0FFF, 0x7FCFE0F0, 0x0000303F),
+	uint4(0x99800000, 0x20040081, 0x88100000, 0x00000000), uint4(0x00FFF000, 0x99C00000, 0x0000107F, 0xF0000000),
+	uint4(0xFFFFFFFF, 0x00FFFFFF, 0x9A000000, 0xFF1FF0FF), uint4(0xFFFF7FF3, 0xFFFFFFFF, 0x00FFFFFF, 0x9A400000),
+	uint4(0x7E03E03E, 0xE07E07E0, 0x0FE0FE07, 0x000FE0FE), uint4(0x9A800000, 0xCEBCC79C, 0xF42F4EE1, 0x70F60F61),
+	uint4(0x0078C70B, 0x9AC00000, 0x00000001, 0x00000000), uint4(0x1F8FC0C0, 0x0000301F, 0x9B000000, 0xFFFFEFFC),
+	uint4(0x0000FFFF, 0x00000000, 0x00800000, 0x9B400000), uint4(0x003C17E2, 0xF838CC0D, 0xF0300F01, 0x001FE3E1),
+	uint4(0x9B800000, 0xFFF7FF7E, 0x6102002F, 0x30E30610), uint4(0x0071E70E, 0x9BC00000, 0x1FE1FE1F, 0xFE1FE1FE),
+	uint4(0xF1FE1FE1, 0x00F1FF1F, 0x9C000000, 0xE00F00F0), uint4(0x00800C00, 0xEFFEFF00, 0x008FFCFF, 0x9C400000),
+	uint4(0xC67C63CE, 0x6BC63C63, 0x9C29C2BC, 0x009C39C3), uint4(0x9CC00000, 0xFF7FF800, 0xF3FF7FF7, 0x1FF3FF3F),
+	uint4(0x001FF1FF, 0x9D000000, 0xF87F8FF8, 0x83F87F87), uint4(0x1F83F83F, 0x001F81F8, 0x9D400000, 0x30031861),
+	uint4(0x80184104, 0xC0C80820, 0x00F04E04, 0x9DC00000), uint4(0x10FF7FF3, 0x00F00300, 0xFF07F01F, 0x00FF0FF0),
+	uint4(0x9E400000, 0xFF7FFFFF, 0x307FDFF3, 0x01E03806), uint4(0x0000700F, 0x9E800000, 0x07F07F8F, 0x1C03E03F),
+	uint4(0x7FE801C0, 0x003FC7FC, 0x9F000000, 0xFFFFFFFC), uint4(0x3000000F, 0x3FF03F00, 0x00FFFFFF, 0x9F800000),
+	uint4(0x83C83C87, 0x3C43C43C, 0xC41C43C4, 0x00C21C61), uint4(0x9FC00000, 0xA37837C3, 0x93B93B17, 0x31E31D31),
+	uint4(0x00C1E91F, 0xA0C00000, 0x7FFFCFF0, 0x00000030), uint4(0x00000000, 0x00000000, 0xA1400000, 0x0000707F),
+	uint4(0x00000000, 0x0FFFFF00, 0x00C00807, 0xA1800000), uint4(0xEFFFFFFF, 0xEDEEFEFF, 0x9CEDCEDE, 0x0098C9CC),
+	uint4(0xA1C00000, 0xF0FE0FD0, 0xEFF4FF8F, 0xFFBFFFFF), uint4(0x00FFBFFB, 0xA2000000, 0x3F47E4FE, 0x760F61F4),
+	uint4(0x70170360, 0x00700700, 0xA2400000, 0x70070070), uint4(0x00700700, 0x07007007, 0x00070070, 0xA2800000),
+	uint4(0x00E03E07, 0x0E00E00E, 0x200600E0, 0x00EE0C00), uint4(0xA2C00000, 0x0C018038, 0x10020060, 0x00000000),
+	uint4(0x00000000, 0xA3000000, 0xC0FE0FF0, 0x0F00F80F), uint4(0x800C00E0, 0x007FFFFF, 0xA3800000, 0xF3BF33F7),
+	uint4(0x19F19F39, 0x8F08F18F, 0x00878870, 0xA3C00000), uint4(0xF81F81F8, 0x81F81F81, 0x1F81F81F, 0x001F81F8),
+	uint4(0xA4400000, 0xFF1F8DC0, 0x01FC1FE1, 0x1C01E01F), uint4(0x00900180, 0xA4800000, 0x20420420, 0x04204204),
+	uint4(0x42042042, 0x00420420, 0xA4C00000, 0x787F8FF8), uint4(0x80380030, 0xFF8FF83F, 0x00FF8FF8, 0xA5400000),
+	uint4(0x0303F1FF, 0xFFFF0000, 0xF80FF0FF, 0x003FF800), uint4(0xA5800000, 0xF03E17E3, 0xC0FC1F83, 0xE3FC7E87),
+	uint4(0x00F1FE1F, 0xA5C00000, 0xCFF9FF3F, 0xBFF7FE7F), uint4(0xFFEFFDFF, 0x00FFFFFF, 0xA6000000, 0x02402402),
+	uint4(0x34034024, 0x20160160, 0x00201201, 0xA6400000), uint4(0xF01E03E0, 0x80780F01, 0x01C03C07, 0x0000E01E),
+	uint4(0xA6800000, 0xFFFFFFFF, 0x0000000F, 0x00000000), uint4(0x00FFF000, 0xA6C00000, 0x00000F7F, 0x0F00F003),
+	uint4(0xF07F01F0, 0x00F3FF1F, 0xA7000000, 0xFFFFFFFF), uint4(0xF000FFFF, 0x000000FF, 0x00000000, 0xA7800000),
+	uint4(0x7F07F07F, 0xF07F07F0, 0x07F07F07, 0x0007F07F), uint4(0xA7C00000, 0x0701F07F, 0xC0080110, 0xE07C0680),
+	uint4(0x00F03E07, 0xA8000000, 0xCF39F33F, 0x10E31C71), uint4(0x07C0780F, 0x0003E03C, 0xA8400000, 0xBFF3FC7F),
+	uint4(0xC018000F, 0xE0780F00, 0x00FC3F87, 0xA8800000), uint4(0x81F01E03, 0x0FC0F81F, 0xFD0FA0F8, 0x007D87D0),
+	uint4(0xA8C00000, 0xE0FE1FE3, 0x07E0FE0F, 0x0F01F03F), uint4(0x00030070, 0xAA400000, 0x793713F1, 0xC1F81781),
+	uint4(0x8FC8BC1B, 0x004DE8DC, 0xAAC00000, 0xFE3FF3FF), uint4(0x83FC3FC3, 0x3F03F03F, 0x003C03E0, 0xAB000000),
+	uint4(0x80100201, 0x00200400, 0x80400801, 0x00201402), uint4(0xAB400000, 0xF0F83C1F, 0xFFFFFFEF, 0x81F0FF7F),
+	uint4(0x00FE0F03, 0xAB800000, 0x0100703F, 0x08000000), uint4(0xFC0F00E0, 0x00FF8FE0, 0xABC00000, 0xFF9FF7FF),
+	uint4(0x71CF33F6, 0x03C0710E, 0x0000F01E, 0xAC000000), uint4(0xF8C3C1FC, 0xCFFCFFCF, 0xFFCFFCFF, 0x003FCFFC),
+	uint4(0xAC800000, 0x08408408, 0x84084084, 0x40840840), uint4(0x00408408, 0xACC00000, 0x3FE3FE1F, 0xF67FE7FE),
+	uint4(0x0FF0FF2F, 0x0023F07F, 0xAD000000, 0xFEDFE9FC), uint4(0xF7FFFFFD, 0x10311F0F, 0x00180180, 0xAD400000),
+	uint4(0x00000FFF, 0x0FFF0000, 0x00000000, 0x00FFF000), uint4(0xAD800000, 0x61843843, 0x1C218618, 0x421421C2),
+	uint4(0x00430430, 0xADC00000, 0xE7FE7FE3, 0x7FF7FF7F), uint4(0x000FF7FF, 0x00008008, 0xAE000000, 0xFFFFFFFF),
+	uint4(0x0FF0FFEF, 0x000C00F8, 0x00FE0800, 0xAE400000), uint4(0xFF3FF3FF, 0xF1FF1FF1, 0x0FF0FF1F, 0x000FF0FF),
+	uint4(0xAEC00000, 0x80F00701, 0x1F80F80F, 0x1CFFC7FC), uint4(0x0002301F, 0xAF000000, 0x00F80FE0, 0x0000C00F),
+	uint4(0xE0000000, 0x00FFFFF0, 0xAF400000, 0xF0E00000), uint4(0x0000000F, 0x80000000, 0x00FFEFC0, 0xAF800000),
+	uint4(0xFC7F0FE0, 0x300F07E1, 0xF00E0080, 0x00FE0F80), uint4(0xAFC00000, 0x1C038070, 0x10030060, 0x600C0080),
+	uint4(0x001C0300, 0xB0400000, 0x00000F00, 0x00000000), uint4(0x00000000, 0x00F80FFF, 0xB0800000, 0x7CE7CEFC),
+	uint4(0xCF7CF7CE, 0x7BC7BDF3, 0x007DC7BC, 0xB0C00000), uint4(0x00000001, 0x08000000, 0x03C0E070, 0x0000100F),
+	uint4(0xB1400000, 0xFF1FC3F8, 0xFE7FCFF9, 0x000FFFF7), uint4(0x00008010, 0xB1C00000, 0x6F03F03F, 0x31E70E70),
+	uint4(0xFF07F13E, 0x00FF0FF0, 0xB2400000, 0x00000000), uint4(0x0FFFFFF0, 0x000000F0, 0x00FFFFFF, 0xB2800000),
+	uint4(0x18018018, 0xC80C81C0, 0xC0680E80, 0x00C06C06), uint4(0xB3000000, 0x78278279, 0x81381781, 0x13C13C13),
+	uint4(0x0009C1BC, 0xB3C00000, 0xE0FC7F9F, 0xCFF8FF0F), uint4(0xFFFFFEFF, 0x00FFFFFF, 0xB4000000, 0x3FE1FE1F),
+	uint4(0xFE7FE7FE, 0xFFFEFFEF, 0x00201000, 0xB4800000), uint4(0x07E0FE0F, 0x3E03E07E, 0x601E01E0, 0x00200600),
+	uint4(0xB4C00000, 0xFFFF7FE3, 0x0010010F, 0x0F807803), uint4(0x001F81F8, 0xB5000000, 0xC03C17C3, 0x00C01C01),
+	uint4(0xFFF04004, 0x00FCFFDF, 0xB5400000, 0x3F07F1FF), uint4(0x1E03C0F0, 0xFF0FE0F8, 0x00FFFFFC, 0xB5800000),
+	uint4(0x608418C1, 0x88388308, 0xC0E81C81, 0x00A0780E), uint4(0xB5C00000, 0xFFFFFFF8, 0x087F1FF7, 0x00100700),
+	uint4(0x00000000, 0xB6800000, 0xEEDEECEE, 0xEDFEDEED), uint4(0x000FFEDF, 0x00020000, 0xB6C00000, 0xF0F80E01),
+	uint4(0xFFFFFFCF, 0x1FFFFFFF, 0x0000301F, 0xB7000000), uint4(0x00400DFF, 0xFC03C01C, 0xC3FC1FC0, 0x00DFFCFF),
+	uint4(0xB8000000, 0x00000000, 0x00000000, 0xC0000000), uint4(0x000071F0, 0xB8800000, 0x67E67E67, 0x7EE7EE7E),
+	uint4(0xEEFEE7EE, 0x00EEFEEF, 0xB8C00000, 0xF0FC0F00), uint4(0xFFFFFFCF, 0xFFFFFFFF, 0x009FF7FF, 0xB9000000),
+	uint4(0xE77C7FC3, 0x100702F0, 0x03801801, 0x0007C03C), uint4(0xB9800000, 0x00000000, 0x0C008000, 0xF80F00E0),
+	uint4(0x00FE0FC0, 0xB9C00000, 0x00800000, 0x0E00C008), uint4(0x780F00F0, 0x003E03C0, 0xBA400000, 0x03C07C0F),
+	uint4(0x0C00C01C, 0xC00C00C0, 0x00400C00, 0xBAC00000), uint4(0xFFFFFFC0, 0xFFFFFFFF, 0x0070FFFF, 0x00F80000),
+	uint4(0xBB000000, 0x700600E0, 0x80300300, 0x00C01801), uint4(0x0000400C, 0xBBC00000, 0x0F01F03E, 0x10030070),
+	uint4(0xE0000000, 0x00FFCFE0, 0xBC400000, 0xFF0001E0), uint4(0x00F80FFC, 0xC7FF7F0E, 0x0007807F, 0xBC800000),
+	uint4(0x02004008, 0x00000010, 0x00000000, 0x00000000), uint4(0xBCC00000, 0xFFFFFF87, 0xFFFFFFFF, 0xFFFFFFFF),
+	uint4(0x00F0F7FF, 0xBD000000, 0x80F80F00, 0x0FC0F80F), uint4(0x7E07E0FC, 0x001F03F0, 0xBD400000, 0x1FFFFFFF),
+	uint4(0x00000000, 0xFFF00000, 0x00FFFFFF, 0xBD800000), uint4(0x38038038, 0xC0180380, 0x81C81C01, 0x0081C81C),
+	uint4(0xBE000000, 0xC7FEF010, 0x0F01F83F, 0xFFFC00E0), uint4(0x001FE3FF, 0xBE800000, 0x61C61C61, 0x0E60E60E),
+	uint4(0xE60E60E6, 0x00E70E70, 0xBEC00000, 0xFFFFCFFC), uint4(0xF006002F, 0x07F03F01, 0x003FF1FF, 0xBF000000),
+	uint4(0x1F00EFEF, 0x0C3F03F0, 0x0FF0FC04, 0x00BFF1FF), uint4(0xBF800000, 0x00F80F80, 0x0E00F00F, 0xC00C00E0),
+	uint4(0x00800800, 0xC0000000, 0xE0F00000, 0xFFFFFFEF), uint4(0xE00FFCFF, 0x00000000, 0xC0400000, 0x6004707F),
+	uint4(0x81F80F00, 0x4FEFFC3F, 0x00E00C06, 0xC0800000), uint4(0x1F03F07F, 0x300700F0, 0x00000100, 0x00003000),
+	uint4(0xC0C00000, 0x0701F07F, 0x08000010, 0xFE0F80E0), uint4(0x00FFEFF8, 0xC1000000, 0xF03F83FC, 0x00C00E01),
+	uint4(0xE3FF3F00, 0x0080FC1F, 0xC1400000, 0xFF77FE7F), uint4(0x104703F0, 0x07007006, 0x0087C078, 0xC1800000),
+	uint4(0x40040040, 0x00400400, 0x04004004, 0x00040040), uint4(0xC1C00000, 0x3F4FF5FF, 0x370761F6, 0x7C078078),
+	uint4(0x007E07C0, 0xC2000000, 0x7F1FF7F9, 0xEFE3F0F0), uint4(0xC3F0FF3F, 0x00FF9F87, 0xC2800000, 0xF8FF0FE1),
+	uint4(0xE3FC7F8F, 0x00F03E0F, 0x00F01007, 0xC3000000), uint4(0xFF1FF0FF, 0xF3FF3FF1, 0xFFF7FF7F, 0x00000000),
+	uint4(0xC3400000, 0x00000000, 0x10000000, 0x00300100), uint4(0x00007003, 0xC3800000, 0xF8FF0FE0, 0xF7FEFFCF),
+	uint4(0x9FF3FF3F, 0x00E7FCFF, 0xC3C00000, 0x00000000), uint4(0x00000000, 0xE0080000, 0x00FC0F00, 0xC4000000),
+	uint4(0xFF9FF9FF, 0xF9FF9FF9, 0x9FF9FF9F, 0x009FF9FF), uint4(0xC4400000, 0xFF000000, 0x307FFFFF, 0xF00C0000),
+	uint4(0x00FF0FC0, 0xC4800000, 0xC03C03C0, 0x03C03C03), uint4(0x3C03C03C, 0x003C03C0, 0xC4C00000, 0x01C03807),
+	uint4(0x0600401C, 0x10000020, 0x00F7F000, 0xC5000000), uint4(0xFBFF9FF8, 0xC01C004F, 0x1FE07E03, 0x007FF3FE),
+	uint4(0xC5400000, 0xFFFBFFBE, 0x000707F7, 0x83082002), uint4(0x00C30C30, 0xC5C00000, 0x80F80F80, 0x0F80F80F),
+	uint4(0xFC0FC0FC, 0x00FC0FC0, 0xC6000000, 0x80F80F80), uint4(0x0FC0FC0F, 0xFE0FC0FC, 0x00FE0FE0, 0xC6400000),
+	uint4(0x80F81780, 0x0F80F80F, 0xF9FF80F8, 0x00F80F80), uint4(0xC6800000, 0xFC0FC0FC, 0xC0FC0FC0, 0x0FC0FC0F),
+	uint4(0x000FC0FC, 0xC6C00000, 0x00000007, 0xFFC00000), uint4(0xFFFFFFFF, 0x000FF7FF, 0xC7000000, 0xFFFFF000),
+	uint4(0x0000FFFF, 0x00000000, 0x00000000, 0xC7400000), uint4(0x0383F1FF, 0x0FC0F00E, 0xFFEFFCFF, 0x003FFFFF),
+	uint4(0xC7800000, 0x0760760F, 0x72072072, 0xC03C03A0), uint4(0x00F03E03, 0xC7C00000, 0xFEFFEFFE, 0xE07E3FEF),
+	uint4(0x00200100, 0x0000E006, 0xC8400000, 0x04FFFFFC), uint4(0xE07E01C0, 0xFFE7FE1F, 0x00007000, 0xC8800000),
+	uint4(0xFFFFF000, 0xFFFFFFFF, 0xFFFFFFFF, 0x00000FFF), uint4(0xC8C00000, 0x3FEFF9FF, 0xBFE7FDFF, 0xFFFFFCFF),
+	uint4(0x00FFFFFF, 0xC9000000, 0x80E00800, 0xEFF8FE0F), uint4(0xFFFFFFFF, 0x001FF7FF, 0xC9400000, 0x00000FFF),
+	uint4(0xF0000000, 0x000FFFFF, 0x00000000, 0xC9800000), uint4(0x7F7FDFFD, 0x46042072, 0xE0CE0C60, 0x00E1CE1C),
+	uint4(0xC9C00000, 0xFCFFCFFC, 0xF07E3FEF, 0x00000100), uint4(0x00000000, 0xCA000000, 0x80E00800, 0xE0781E07),
+	uint4(0x00100701, 0x00000000, 0xCA800000, 0xC3183186), uint4(0x08600610, 0x618C3083, 0x0030C60C, 0xCAC00000),
+	uint4(0xFFBFDBFD, 0x1201000F, 0x78370120, 0x007C3783), uint4(0xCB000000, 0x80F01E03, 0x07E0FC0F, 0x0F81F03E),
+	uint4(0x0003E07C, 0xCB400000, 0xFF1FF3FF, 0xF0FF0FF1), uint4(0x03F07F07, 0x0001F03F, 0xCB800000, 0x0E80E80E),
+	uint4(0xE80E80E8, 0x80E80E80, 0x0080E80E, 0xCC400000), uint4(0x0300F03F, 0x0E00C000, 0x7F0FE0F8, 0x0007F1FC),
+	uint4(0xCC800000, 0x84084084, 0x20420820, 0x84184204), uint4(0x00821821, 0xCCC00000, 0x7F07F0FF, 0xF03F03F0),
+	uint4(0x00F01F01, 0x0000700F, 0xCD000000, 0xE03C17C3), uint4(0x80F81F01, 0xC3E87C07, 0x00E0FC1E, 0xCD400000),
+	uint4(0xFFFFEFF8, 0xFFFFFFFF, 0xFFFFFFFF, 0x00FFFFFF), uint4(0xCD800000, 0xE78E79E7, 0x7CE7CE78, 0xCE7CE7CE),
+	uint4(0x00CE3CE7, 0xCDC00000, 0x80F00F00, 0x0FC0F80F), uint4(0xFE0FE0FC, 0x00FF0FF0, 0xCE400000, 0xF3C0E03F),
+	uint4(0x0E00FC0F, 0x7FC00080, 0x0007F1FF, 0xCE800000), uint4(0xFF0FF1FF, 0x80FE0FF0, 0xFC006007, 0x0083FE7F),
+	uint4(0xCF000000, 0xFF1FF0FF, 0xF7FF3FF1, 0xFFFFFF7F), uint4(0x00FFFFFF, 0xCF400000, 0xF87F8FF8, 0x80F81F83),
+	uint4(0x01803807, 0x00FFF008, 0xCF800000, 0xF01F03E1), uint4(0x8E308700, 0xFF8FE8F9, 0x003FD7FA, 0xCFC00000),
+	uint4(0xFCFF8FF0, 0xF7FFFFEF, 0x80000707, 0x00E00C00), uint4(0xD0400000, 0x10000020, 0x00000000, 0xFFB00000),
+	uint4(0x00FFDFFF, 0xD0800000, 0xF8CF8DF0, 0x68FECFCC), uint4(0x8F78F78F, 0x008F38F7, 0xD0C00000, 0x6101F7C7),
+	uint4(0x07E01E00, 0xFF0FF0FF, 0x00FF8FF8, 0xD1000000), uint4(0xF8FE1F0F, 0xFFFFFFFF, 0xFFFFFFFF, 0x001FFFFF),
+	uint4(0xD1C00000, 0x00000001, 0x08000000, 0x3FFC1F80), uint4(0x00F03E1F, 0xD2000000, 0x7E0FE0FE, 0xE07E07E0),
+	uint4(0x03E07E07, 0x0003E03E, 0xD2400000, 0xFFC3FC0F), uint4(0x0F0031F6, 0xFC0FC0F8, 0x00FF0FE0, 0xD2800000),
+	uint4(0x83F87F87, 0x1F81F83F, 0x38078078, 0x00180380), uint4(0xD3400000, 0x00FFFFFF, 0xFFFF0000, 0xFFFFFFFF),
+	uint4(0x00000000, 0xD3800000, 0x04FFFFF9, 0xF00E0060), uint4(0x03F01F00, 0x00C7F83F, 0xD3C00000, 0xFFFFFFFF),
+	uint4(0x0000000F, 0x00000000, 0x00E00800, 0xD4000000), uint4(0x01603603, 0x0E002012, 0xE7FEFEFE, 0x00E3FE7F),
+	uint4(0xD4400000, 0xBE7BE7BE, 0xE7BE7BE7, 0x7BE7BE7B), uint4(0x007BE7BE, 0xD4C00000, 0x0E01E03E, 0xD0000040),
+	uint4(0xFF8FF8FF, 0x00FF0FF8, 0xD5000000, 0xFF3FFFFF), uint4(0x300703F0, 0x00000000, 0x00000000, 0xD5800000),
+	uint4(0x7F7FFFFF, 0x00000070, 0x00000000, 0x00000000), uint4(0xD5C00000, 0x7F07F07F, 0xF0FF0FF0, 0x1FF1FF1F),
+	uint4(0x003FF3FF, 0xD6000000, 0x00300300, 0x03003003), uint4(0x30030030, 0x00300300, 0xD6400000, 0xFF7FFFFF),
+	uint4(0x180703F0, 0xFC0F00E0, 0x00FF8FE0, 0xD6800000), uint4(0x01FFFFFE, 0xF01F0070, 0x7FF1FF07, 0x00FFFFFF),
+	uint4(0xD7400000, 0x00000000, 0x0000FFF0, 0x00000000), uint4(0x00FFFFFF, 0xD7800000, 0x00000000, 0xF0000000),
+	uint4(0x800FFCFF, 0x00000000, 0xD8800000, 0xE31E31E3), uint4(0x73E31E31, 0x3E73E73E, 0x007EF3E7, 0xD8C00000),
+	uint4(0x0F003FFE, 0xF0FF03F0, 0xFFFFFF3F, 0x00FFFFFF), uint4(0xD9000000, 0xF01F01E0, 0xE9FC1F81, 0xFFFDFE9F),
+	uint4(0x00100100, 0xD9400000, 0x0000707F, 0xFFF8F80C), uint4(0x0FFFFFFF, 0x00000007, 0xD9800000, 0x8E98E98E),
+	uint4(0xE98E98E9, 0x98E98E98, 0x0098E98E, 0xD9C00000), uint4(0x00040000, 0x00200200, 0x00001000, 0x00000008),
+	uint4(0xDA000000, 0x3F83F07F, 0xFF1FE1FC, 0xFE7FCFF8), uint4(0x00FFAFF7, 0xDA400000, 0x00C01003, 0xCFF0FC0F),
+	uint4(0x00707F7F, 0x00000000, 0xDA800000, 0x78C78C78), uint4(0x8C78C78C, 0xC78C78C7, 0x00C78C78, 0xDAC00000),
+	uint4(0xFFFFFFFC, 0x0F80FFEF, 0x00000000, 0x00F80C00), uint4(0xDB000000, 0x3F0FE1F8, 0x300701F0, 0x00000000),
+	uint4(0x00000000, 0xDB400000, 0x01703F07, 0xF0001003), uint4(0xF1FF3FF7, 0x00F07F0F, 0xDB800000, 0xC00C00E0),
+	uint4(0x00800C00, 0x08008008, 0x00000000, 0xDBC00000), uint4(0x80F80F00, 0x0FC0F80F, 0xFE0FC0FC, 0x00FE0FE0),
+	uint4(0xDC000000, 0x78E60F00, 0xF07F07E8, 0x07C07E07), uint4(0x00C60070, 0xDC400000, 0x00C00E00, 0xFFFFFFF8),
+	uint4(0xFFFFFFFF, 0x00FFCFFE, 0xDCC00000, 0x3C07E0FF), uint4(0x7FEF0100, 0xC01F03F8, 0x00000800, 0xDD800000),
+	uint4(0x73E73673, 0x7E77E77E, 0xF77F77E7, 0x00FF7F77), uint4(0xDDC00000, 0xFC3FC3FC, 0xC8FC0FC1, 0xF3CE3CC7),
+	uint4(0x00FCCF9C, 0xDE000000, 0x0000000F, 0xFFFF0000), uint4(0x00301F0F, 0x00000000, 0xDE800000, 0xF72F36F3),
+	uint4(0x70F71F70, 0x03707707, 0x0021F01F, 0xDEC00000), uint4(0x10FFFFEF, 0x00300300, 0x1F00F007, 0x003F91F8),
+	uint4(0xDF400000, 0xFF0FF07F, 0xF7FF3FF1, 0xFC0C00FF), uint4(0x00FFFFFC, 0xDF800000, 0xE71E71E7, 0x79F79E79),
+	uint4(0xDFFDF7DF, 0x00000000, 0xDFC00000, 0x3F0FF1FF), uint4(0x300701F0, 0x00000000, 0x00000000, 0xE0000000),
+	uint4(0xDFFDFFDF, 0x7FEFFEFF, 0xFF7FF7FF, 0x00FFBFFB), uint4(0xE0400000, 0x3EFF8FE0, 0x0FC0F00C, 0xE07BFCFF),
+	uint4(0x00FE0F80, 0xE0800000, 0xE7FE7FEF, 0x17E37E3F), uint4(0x3C13E17E, 0x001C01C0, 0xE0C00000, 0x3F0FF1FF),
+	uint4(0x3E07C1F8, 0xFC0F80F0, 0x00FF0FE0, 0xE1400000), uint4(0x03C3F1FF, 0xCFF0FC0F, 0xFFFFFFFF, 0x003FFFFF),
+	uint4(0xE1800000, 0xFE7FCFFD, 0xF8FF9FE3, 0xE1FC3FC7), uint4(0x00F07E0F, 0xE1C00000, 0x00000000, 0xFFFF0000),
+	uint4(0xFFEFFFFF, 0x00FFEFFE, 0xE2000000, 0x00C00007), uint4(0x8FF0FC0F, 0x00F0FEFF, 0x00F00C00, 0xE2800000),
+	uint4(0xFF3FF7FF, 0xF01F07F0, 0x00100300, 0x00E00800), uint4(0xE3000000, 0x40FDFFC7, 0x07C01C00, 0xFC0FC0FC),
+	uint4(0x00FC0FC0, 0xE3400000, 0x01E03E0F, 0x0600E00E), uint4(0xE70E80A0, 0x00E0FE1F, 0xE3800000, 0xCECCECEF),
+	uint4(0xC8CE8CE8, 0x08C08C8C, 0x0008C08C, 0xE3C00000), uint4(0x00000000, 0xC0000000, 0x000F00FF, 0x00000000),
+	uint4(0xE4000000, 0xE0FF0FF0, 0x0FE0FE0F, 0xFC0FC0FC), uint4(0x00F80F80, 0xE4400000, 0xF87E03CF, 0xFFFEFFCF),
+	uint4(0xE0381F0F, 0x00FC0F00, 0xE4800000, 0x87F8FF8F), uint4(0x3FC3FC7F, 0x7E1FE1FC, 0x00BF07E0, 0xE4C00000),
+	uint4(0x0700700F, 0x10030030, 0x40080180, 0x00000400), uint4(0xE5000000, 0x00000007, 0x00000000, 0xFC0E0000),
+	uint4(0x000FF7F8, 0xE5400000, 0x60060060, 0x00200200), uint4(0x02002002, 0x00020020, 0xE5800000, 0xF79FE9F8),
+	uint4(0x31F31F31, 0x0C30E30E, 0x000C10C1, 0xE5C00000), uint4(0x00E00E01, 0x0E00E00E, 0x000E00E0, 0x00E03E1F),
+	uint4(0xE6000000, 0xFF7FEFF8, 0xF07F0FF3, 0x00700F03), uint4(0x00E00803, 0xE6400000, 0x43C43847, 0x36436434),
+	uint4(0x78370370, 0x003C1781, 0xE6C00000, 0x80600C00), uint4(0x80700C03, 0x00700C01, 0x00C00001, 0xE7000000),
+	uint4(0x83183183, 0x30C30C31, 0x0C30C30C, 0x000C10C3), uint4(0xE7C00000, 0x01003003, 0x00000000, 0xC0080080),
+	uint4(0x00C00C00, 0xE8400000, 0xC01C0FDF, 0x0FC3FC0F), uint4(0xFC07C004, 0x00FCFFC0, 0xE8800000, 0x1E01E01E),
+	uint4(0xE01E01E0, 0x01E01E01, 0x0001E01E, 0xE9000000), uint4(0xFF8FFFFF, 0xE0FF0FF0, 0x07007C07, 0x00FBF060),
+	uint4(0xE9400000, 0xFCFFCFFC, 0xC00401D7, 0x1FC07C01), uint4(0x00FFC7FC, 0xE9800000, 0x00E00C00, 0x03C0780F),
+	uint4(0x0780F01E, 0x0001E03C, 0xE9C00000, 0x00800003), uint4(0x8FE0F80E, 0x7FFFFEFF, 0x000FF3FF, 0xEA000000),
+	uint4(0xFFDFEBFD, 0xFFBFF7FE, 0xFE7FCFF9, 0x003F97F3), uint4(0xEA400000, 0xFFFF8F81, 0x0C0703F3, 0x0FFFF8FC),
+	uint4(0x00E0101F, 0xEA800000, 0xC0FC0FC0, 0x0FC0FC0F), uint4(0xFE0FE0FE, 0x00FE0FE0, 0xEB000000, 0x3FF3FF3F),
+	uint4(0xFE1FE1FE, 0xC1FE1FE1, 0x00C0FC1F, 0xEB400000), uint4(0xF8F81000, 0xFFFFFFFF, 0x01FFFFFF, 0x00000000),
+	uint4(0xEB800000, 0x18610421, 0x410C1082, 0x8430C208), uint4(0x00421861, 0xEBC00000, 0x7F8FF8FF, 0xF87F87F8),
+	uint4(0x83F87F87, 0x0083F83F, 0xEC000000, 0xE17E27E2), uint4(0x09E03E13, 0xE60EE0DE, 0x00FA0F60, 0xEC400000),
+	uint4(0x18318310, 0xCB9C3983, 0x7FEFDEBD, 0x0021F0FF), uint4(0xECC00000, 0x3F07F0FF, 0x7FC801E0, 0xF81FC3FF),
+	uint4(0x00C00E00, 0xED000000, 0xF0FC0F00, 0xF7FFFFCF), uint4(0x03F0FF1F, 0x0080700F, 0xED400000, 0x0000301F),
+	uint4(0x0F00C000, 0x01F0FC7E, 0x00000003, 0xED800000), uint4(0x3D87D07B, 0xF43E43F8, 0x31F21F61, 0x0018F38F),
+	uint4(0xEDC00000, 0xFE3FC3FC, 0x307FBFFB, 0x38030020), uint4(0x003C03C0, 0xEE800000, 0xE31C31C7, 0x09E09E11),
+	uint4(0x1F85F09F, 0x001F83F8, 0xEEC00000, 0x1F01F01F), uint4(0xF00F00F0, 0xC0780700, 0x00E03C07, 0xEF000000),
+	uint4(0x1C038070, 0x3F07C0F8, 0x0F03C078, 0x0083C078), uint4(0xEF800000, 0xDF79F79F, 0xC7DE7DF7, 0x7F07D87D),
+	uint4(0x00FC07E0, 0xEFC00000, 0x00800000, 0x0E00C008), uint4(0xF80F00E0, 0x00FC0F80, 0xF0000000, 0xC03E03E0),
+	uint4(0x03803803, 0x20030030, 0x00000000, 0xF0400000), uint4(0x1F0FF7FF, 0x08000030, 0xFE0F80E0, 0x00FFEFF8),
+	uint4(0xF0800000, 0xFDCFDCF9, 0x2000EFDE, 0x10310210), uint4(0x00183183, 0xF0C00000, 0xF87F07E0, 0x0FFF7FC7),
+	uint4(0x70060040, 0x007E07C0, 0xF1000000, 0xE07C0F81), uint4(0xCFFB0100, 0x07F1FEFF, 0x0080100F, 0xF1800000),
+	uint4(0xF0782642, 0xF7BF7BC7, 0x33973973, 0x00239339), uint4(0xF1C00000, 0xE0FC1F83, 0xC1F83F07, 0xC7F8FE0F),
+	uint4(0x00F1FE3F, 0xF2000000, 0xFEFFEFFC, 0xFFFFFFFF), uint4(0x3FF7FFFF, 0x008FF1FF, 0xF2400000, 0x01E07C0F),
+	uint4(0x0F80F00F, 0xFC0FC0F8, 0x00FF0FE0, 0xF2800000), uint4(0xF9FB9FB9, 0x93F97F9F, 0x07F0FF1F, 0x0081F83F),
+	uint4(0xF2C00000, 0xFF1FF0FF, 0xF7FF3FF1, 0x000FFFFF), uint4(0x00000000, 0xF3000000, 0x1FE0FE0F, 0xFF3FF1FF),
+	uint4(0xFFFF3FF3, 0x00080000, 0xF3C00000, 0xF81F07C0), uint4(0xF03F07C0, 0xE03C0701, 0x00FC0F81, 0xF4000000),
+	uint4(0x600E00E0, 0x00600600, 0x02006006, 0x00020020), uint4(0xF4400000, 0x61C61C61, 0x1C61C61C, 0xC61C61C6),
+	uint4(0x00C61C61, 0xF4C00000, 0x00000000, 0x8F000000), uint4(0xFFFFFFFF, 0x00F00FF8, 0xF5000000, 0x00800000),
+	uint4(0x0C00C008, 0xF00E00E0, 0x00F80F00, 0xF5800000), uint4(0xE1C3F7FF, 0xFFFFFFFF, 0xFFFFFFFF, 0x00FFFFFF),
+	uint4(0xF5C00000, 0xFFFFFFFF, 0x8FFCFFEF, 0xFE0FF0FF), uint4(0x00F80FC0, 0xF6800000, 0x3D08D083, 0xC3FC0FD0),
+	uint4(0xF9CFBCFB, 0x0079C79C, 0xF6C00000, 0x1C03C078), uint4(0x780F00E0, 0xE01C03C0, 0x00F00F00, 0xF7000000),
+	uint4(0x7C07C07C, 0xC07C07C0, 0x07C07C07, 0x0007C07C), uint4(0xF7400000, 0xFEFFFFFF, 0x0E00FE0F, 0x00000000),
+	uint4(0x00000000, 0xF8400000, 0xFE9FF000, 0x01E01F81), uint4(0x0FFEFF08, 0x000F80FE, 0xF8800000, 0x02302306),
+	uint4(0x01001021, 0xFFEFFF00, 0x00F7EF7E, 0xF8C00000), uint4(0xFF0FF1FF, 0xF0FF0FF0, 0x07F07F07, 0x0003F07F),
+	uint4(0xF9000000, 0x78CF0EC0, 0xF07F87E8, 0x03F07F07), uint4(0x0003F03F, 0xF9400000, 0xF8FE0F01, 0x000F0FEF),
+	uint4(0x7FF00000, 0x00F03C3F, 0xF9800000, 0xC1FC0FC0), uint4(0x3FC3FC1F, 0xFC7FC3FC, 0x00FCFFC7, 0xF9C00000),
+	uint4(0x00000001, 0xFFFF0000, 0x03F0FF7F, 0x0000100F), uint4(0xFA400000, 0xFF8FF8FF, 0xF4FFCFFC, 0x0FF0FF2F),
+	uint4(0x0003F07F, 0xFB000000, 0xF0E00000, 0xFFFFFFFF), uint4(0x000000FF, 0x00FE0E00, 0xFB800000, 0x07F0FF0F),
+	uint4(0x1F87783F, 0x7C33C1F8, 0x001E05E2, 0xFBC00000), uint4(0x00008000, 0x00000000, 0x00000000, 0x00000000),
+	uint4(0xFC000000, 0xFEF80001, 0xFFFFFFFF, 0x1FFFFFFF), uint4(0x0000301F, 0xFC400000, 0x00F80FC0, 0x0C00E00F),
+	uint4(0x00707F00, 0x00000000, 0xFC800000, 0xFE1F0381), uint4(0xF07F0FF1, 0x00F01F03, 0x00007007, 0xFD400000),
+	uint4(0x00C00E03, 0xF0FF800C, 0x00000000, 0x001FFFFF), uint4(0xFD800000, 0x5E87C8BC, 0xF22F43E4, 0x10F11721),
+	uint4(0x0088708B, 0xFDC00000, 0x80800600, 0xF7FF7F07), uint4(0x7F07FC7F, 0x006007C0, 0xFE000000, 0xFF5FF3FF),
+	uint4(0xFDFFDFFD, 0xCFFCFFCF, 0x00C7FCFF, 0xFE400000), uint4(0x78078078, 0x00300300, 0x03003003, 0x00030030),
+	uint4(0xFE800000, 0x0C008010, 0x7C0E80E8, 0xF07F07E0), uint4(0x007C3F83, 0xFEC00000, 0x03E07C0F, 0x0F00F01E),
+	uint4(0xFC0F80F8, 0x007E0FC0, 0xFF000000, 0x80780780), uint4(0x07807807, 0x70070070, 0x00700700, 0xFF400000),
+	uint4(0x1E0F87F0, 0x00000030, 0x80000000, 0x00E01C00), uint4(0xFF800000, 0x0C80C10E, 0x8D08E0CC, 0x9E0DC8D8),
+	uint4(0x009F89F0, 0xFFC00000, 0x00000000, 0x00000000),
+};
+
+#define PARTITION_2_COUNT_12X12 838
+#define PARTITION_2_WORDS_12X12 5
+static const uint4 partition_2_12x12[1048] =
+{
+	uint4(0x1F01F01E, 0x700F00F0, 0xF07C0700, 0xFDFF3FC3), uint4(0x0040FFDF, 0x0700F00F, 0x30030070, 0x80100100),
+	uint4(0x00E00C00, 0x0080F00E, 0x78279673, 0xE03C07C1), uint4(0x83F83E07, 0x13E17C2F, 0x00C07196, 0x80F00E00),
+	uint4(0x80F01E07, 0x01E03C07, 0x01803007, 0x0100E00C), uint4(0x07E0FE1F, 0x3E03E07E, 0xE00E01E0, 0x0FE03E01),
+	uint4(0x014061F6, 0x60C61827, 0x3CE1CE1C, 0x3E7DE3DE), uint4(0x0F43F0E7, 0x01C0C13C, 0x1F03F03F, 0xF00F01F0),
+	uint4(0x00700700, 0x01003003, 0x02000010, 0xFCFF8FF0), uint4(0xFFFEFFCF, 0xFFFFFFFF, 0xFFFFFFFF, 0x0240FFFF),
+	uint4(0xFCFFCFFE, 0x8FF8FFCF, 0xFF0FF8FF, 0xE0FF0FF0), uint4(0x0280FE0F, 0x0CC18830, 0x0F02E04E, 0x7C0F80F8),
+	uint4(0x700E03E0, 0x02C0C388, 0xFF3FF3FF, 0xF0FF0FF1), uint4(0x03F03F07, 0x0F00F01F, 0x03400070, 0x87F07F0F),
+	uint4(0x03C17C3F, 0x0F81F03E, 0x3E87C078, 0x0380C1EC), uint4(0xE0F00000, 0xFFFFFFEF, 0x00000001, 0x00000000),
+	uint4(0x03C0FE0E, 0x01E01E01, 0x1E01E01E, 0xE01E01E0), uint4(0x01E01E01, 0x0400E01E, 0x7F7FFFFF, 0x00000070),
+	uint4(0x00000000, 0xFFFFF000, 0x0440FFFF, 0x00000007), uint4(0x07FF8000, 0x00000000, 0x00018000, 0x0480FFF0),
+	uint4(0xFC9FC9FC, 0xC9FC9FC9, 0x9FC9FC9F, 0xFC9FC9FC), uint4(0x04C09FC9, 0xC00C00C0, 0x00C00C00, 0x0C00C00C),
+	uint4(0xC00C00C0, 0x05000C00, 0xC0F80F81, 0x07E0FC0F), uint4(0x1F03E03E, 0x780F81F0, 0x054007C0, 0xF0FC1F81),
+	uint4(0xE7FCFF8F, 0x00301F0F, 0x00000000, 0x05C0E00C), uint4(0x0FF0FF0F, 0xFF1FF1FF, 0xF3FF3FF1, 0x7FF7FF3F),
+	uint4(0x060017F7, 0xE0FE0FE7, 0x0FE0FE0F, 0xFE0FE0FE), uint4(0x000E07E0, 0x0640FE30, 0x00000FFF, 0xF01F0000),
+	uint4(0x0000007F, 0x3F001000, 0x0680FFF0, 0x33633673), uint4(0x93313316, 0x31831931, 0x8C198198, 0x06C098C9),
+	uint4(0xF07F07F0, 0x07F07F07, 0x7F07F07F, 0xF07F07F0), uint4(0x07007F07, 0xF0FE0FE0, 0x87F8FF0F, 0x7FC7FC7F),
+	uint4(0xFF3FE3FE, 0x07403FF3, 0x7FF7FF7F, 0xFF3FF3FF), uint4(0xF3FF3FF3, 0x1FF3FF3F, 0x0780F1FF, 0xC2FC2FC2),
+	uint4(0x2FC2FC2F, 0xFC2FC2FC, 0xC2FC2FC2, 0x07C0FC2F), uint4(0x80080080, 0x00800800, 0x08008008, 0x80080080),
+	uint4(0x08000800, 0x00000007, 0xFFFFFFCE, 0xFFFFFFFF), uint4(0x0000F7FF, 0x0840C000, 0x00000000, 0x08000000),
+	uint4(0xE00C00C0, 0x80F00F00, 0x0880FC0F, 0xFFFFF000), uint4(0x0000000F, 0x00000000, 0x00000000, 0x09000000),
+	uint4(0x1FE1FE1F, 0xEC1EC1EE, 0x80C80EC0, 0x0880C80C), uint4(0x09400080, 0xDFFDFFDF, 0x0FFFFFFF, 0x00000000),
+	uint4(0x10810810, 0x09C08108, 0xFF000007, 0x07FFFFFF), uint4(0x00000000, 0x0001FFFF, 0x0A808000, 0xF8FFCFFE),
+	uint4(0x0FE0FF0F, 0xF00F80FC, 0x00C00E00, 0x0AC0FFF8), uint4(0xC0FC0FC0, 0x1FC0FC0F, 0x040FCFFC, 0xC0FC03C0),
+	uint4(0x0B00FC0F, 0x0FC1EC3E, 0x1E03E07C, 0xF00F00E0), uint4(0x80F00F00, 0x0B40F80F, 0x00FFFFFF, 0xFFFFFFF0),
+	uint4(0xFFFFFFFF, 0xFF000FFF, 0x0B80FFFF, 0x7CF7CE7C), uint4(0xFF7FF7DF, 0x000FFFF7, 0x81081000, 0x0BC00C10),
+	uint4(0x10010010, 0x00100100, 0x01001001, 0x10010010), uint4(0x0C000100, 0x81E03C07, 0x87E07C1F, 0x1FE1FC3F),
+	uint4(0x7F07F0FF, 0x0C4003F0, 0xE0FC0F80, 0xFFFCFF8F), uint4(0xDFF3FF7F, 0x1F07F6FF, 0x0C800030, 0x20E60C60),
+	uint4(0x0F20F20E, 0xFE0FA0FA, 0xE0FE0FC0, 0x0CC0FF0F), uint4(0xFF3FF1FF, 0xFFFF7FF3, 0xFFFFFFFF, 0xFFFFFFFF),
+	uint4(0x0D00FFFF, 0xFEFFE000, 0xE1FE7FEF, 0x03E07E0F), uint4(0x0200601E, 0x0D40FFF0, 0xFFBFEFF9, 0x3FCFF3FC),
+	uint4(0x9FF7FCFF, 0xC7F9FE7F, 0x0D807F1F, 0x00080001), uint4(0x00000400, 0x01000002, 0x08000800, 0x0DC00004),
+	uint4(0x00C0380F, 0x0F80F00E, 0xFF0FE0FC, 0xFE3FCFF8), uint4(0x0E0007F0, 0x78030FDF, 0x0CFE87C0, 0x3C118010),
+	uint4(0x04FFB7E3, 0x0E80C0E8, 0x01700600, 0x00C01803), uint4(0x81002004, 0x04C08810, 0x0EC0600E, 0x00000000),
+	uint4(0xF0000000, 0xFFFFFFFF, 0xFFFFFFFF, 0x0F00FFFF), uint4(0x0700700F, 0x10010030, 0xC0080000, 0xE0780F00),
+	uint4(0x0F403F07, 0xBFFBF000, 0xFF3FF3FF, 0xC1EE1FE3), uint4(0x1881C81E, 0x0F800180, 0xFCFF0FC0, 0x000103E7),
+	uint4(0x00000000, 0x00000000, 0x0FC0E00C, 0x00800800), uint4(0x08008008, 0x80080080, 0x00800800, 0x10008008),
+	uint4(0x00001004, 0x00000000, 0x380600C0, 0x380701C0), uint4(0x104001E0, 0x1FE0FE0F, 0xFF1FE1FE, 0xF9FF1FF1),
+	uint4(0xBFFBFF9F, 0x1080FFFF, 0x78078078, 0x80780780), uint4(0x07807807, 0x78078078, 0x10C00780, 0x0FE0FE1F),
+	uint4(0x7F07E0FE, 0xF07F07F0, 0x83703703, 0x11007817), uint4(0x3F0FF1FF, 0x300701F0, 0x00100000, 0xFF07F00F),
+	uint4(0x1140FFF3, 0x0300E038, 0x00000000, 0x00000000), uint4(0xEF000000, 0x1180FFBF, 0xBE73EE7E, 0xE3DE79E7),
+	uint4(0x1EE1EE3C, 0xFA8F69F6, 0x11C0C7EC, 0x3F07F0FF), uint4(0x700F01F0, 0x00100300, 0x00000000, 0x12000000),
+	uint4(0xFE1FF1FC, 0x01F01F81, 0x9001C01E, 0xC0D00C00), uint4(0x12401E09, 0x04008000, 0x00010020, 0x80000000),
+	uint4(0x00200400, 0x12800001, 0x700C0180, 0x600C0380), uint4(0x80100300, 0x00600C00, 0x12C01C03, 0xFC7FC7F8),
+	uint4(0x060041E7, 0x7C078070, 0xF07E07C0, 0x13007F87), uint4(0xF00F00F8, 0x00E00E00, 0x0800C00C, 0xFFFFF000),
+	uint4(0x1340EFFE, 0xFF000000, 0xFFFFFFFF, 0x000FFFFF), uint4(0x00000000, 0x13800000, 0xF83E83E8, 0x03F03F03),
+	uint4(0x1F43F43F, 0xE71F61F6, 0x13C01E71, 0x00C00C00), uint4(0x0C00C00C, 0xC00C00C0, 0x00C00C00, 0x1400C00C),
+	uint4(0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x00000000), uint4(0x14400000, 0x00000000, 0xF0000000, 0xFFFFFFFF),
+	uint4(0x00000000, 0x14800000, 0xDEFDEFDE, 0xE79E7DE7), uint4(0x79C79C79, 0x1C79C79C, 0x14C071C7, 0x01001001),
+	uint4(0x10010010, 0x00100100, 0x01001001, 0x15000010), uint4(0xFF1FF1FF, 0xF1FF1FF1, 0x1FF1FF1F, 0xFF1FF1FF),
+	uint4(0x15401FF1, 0x3F83E07E, 0xFC1F83F8, 0xE0FC1FC1), uint4(0x07E0FE0F, 0x1580F07F, 0x848848C4, 0x00000800),
+	uint4(0xFF7FF700, 0xE7EF7EF7, 0x15C0CE7E, 0x03F07F87), uint4(0x1E01E03F, 0xBFF40040, 0xFE1FEBFF, 0x16000FC1),
+	uint4(0x0020127F, 0x1F00F006, 0xF83F83F0, 0xDFFCFF87), uint4(0x164001F7, 0x7FFFF180, 0xF83FC3FE, 0x00700F01),
+	uint4(0x00003007, 0x1680FFC0, 0x3F03F07F, 0xF01F01F0), uint4(0x00700F00, 0x03003007, 0x16C00010, 0xFEFFEFFE),
+	uint4(0xE7FEFFEF, 0x0FE1FE3F, 0x1E03E07E, 0x170000E0), uint4(0xFEFFF000, 0x0E00FE0F, 0xFFFFFF00, 0x00F00FF0),
+	uint4(0x17800000, 0x04FFBFF9, 0xE01E00C0, 0x07F03E01), uint4(0xFF1FF0FF, 0x17C0BFF1, 0xFFCFFDFF, 0xFEFFEFFC),
+	uint4(0xF7FE7FE7, 0x3FF3FF7F, 0x1840FBFF, 0x3F07E1FC), uint4(0x180300F0, 0xF00E00C0, 0xE0FC0F80, 0x1880FF0F),
+	uint4(0x1CE1CE1C, 0x8C1CE1CE, 0xC18C18C1, 0x18C18C18), uint4(0x18C0C18C, 0xF8070007, 0xFFFE7FC1, 0xFFFFFFFF),
+	uint4(0x0000F7FF, 0x19000000, 0x1F0CF1C7, 0x304701F0), uint4(0x3C01C00C, 0xC0FC07C0, 0x1940FC0F, 0x00000000),
+	uint4(0x00000000, 0x000FFF00, 0x00000000, 0x19800000), uint4(0x18818818, 0x88188188, 0x81881881, 0x18818818),
+	uint4(0x19C08188, 0xFC1FC1FC, 0xC1FC1FC1, 0x1FC1FC1F), uint4(0xFC1FC1FC, 0x1A001FC1, 0x3F07F0FF, 0x700F01F0),
+	uint4(0xF01C0380, 0xF0FE0F80, 0x1A40FFCF, 0x0700F01F), uint4(0x0C018038, 0xF80F00E0, 0xE0FC0F80, 0x1AC03F07),
+	uint4(0x1FC3F87F, 0x3FC7F8FF, 0xFF8FF1FE, 0x7F1FF7FE), uint4(0x1B0001F0, 0xC1FC3F87, 0x07C07C1F, 0x1E01C03C),
+	uint4(0x600600E0, 0x1B400200, 0xF01F0013, 0xF0F0FF0F), uint4(0xFF00F000, 0x171F0FF0, 0x1B800710, 0x3F03F07F),
+	uint4(0xF01F01F0, 0x00400E00, 0xF3FFB000, 0x1BC0FE1F), uint4(0x00001003, 0x00000000, 0x00000000, 0xF0F80C00),
+	uint4(0x1C00FFEF, 0x00F00F00, 0x1F00F00F, 0xF07F03F0), uint4(0x3FF1FF0F, 0x1C4017F7, 0xFF1FF3FF, 0xF01F03F0),
+	uint4(0x00100300, 0xFF000000, 0x1C80FFFF, 0xFC1F81FC), uint4(0x39F21F21, 0xEC3CE38E, 0x81F81EC1, 0x1CC0F01F),
+	uint4(0x03F01F00, 0xFF0FF07F, 0xF7FF3FF1, 0x00100000), uint4(0x1D007003, 0x00000C00, 0x00000000, 0x00000000),
+	uint4(0xFFFFFFFF, 0x1D40FFFF, 0x00000000, 0x00000000), uint4(0xFFFFFF00, 0xFFFFFFFF, 0x1D80FFFF, 0x80301603),
+	uint4(0x08C01803, 0xE30C7086, 0x8EF1CE18, 0x1DC0F86F), uint4(0x00FFFFFF, 0x00000000, 0x00000000, 0xFF000000),
+	uint4(0x1E00FFFF, 0x3F63F83F, 0xE0380270, 0x03F03F03), uint4(0x3F03F03F, 0x1E4003F0, 0xC7FEF010, 0x3703F87F),
+	uint4(0xFFF00160, 0xF01F89FC, 0x1E800600, 0x9F39F39F), uint4(0xF39F39F3, 0x39F39F39, 0x9F39F39F, 0x1EC039F3),
+	uint4(0x00FFFFFF, 0x00000000, 0xFFFFFEF0, 0xFFFFFFFF), uint4(0x1F00FFFF, 0x0000701F, 0x0E000000, 0xFFCFF0F8),
+	uint4(0xFFFFFFFF, 0x1F403FFF, 0xFFFFFFFF, 0xFFFFFFFF), uint4(0xFFFFFFFF, 0xFF3FF7FF, 0x1F800FF1, 0x8FF1FE1F),
+	uint4(0xFFCFFCFF, 0x000FFFFE, 0x06004004, 0x20000070), uint4(0x1F01F01F, 0xFE0FC0F0, 0xFE6FC7F0, 0xFAFFCFF4),
+	uint4(0x2040FF3F, 0xC0200803, 0x10040100, 0x06010040), uint4(0x00802008, 0x20800802, 0xE01E10E3, 0x07E0FE03),
+	uint4(0x8E19E0BE, 0x17837863, 0x20C080F8, 0xFFFFFFFF), uint4(0x0000000F, 0x01F00000, 0xFFFFF3FF, 0x2100FFFF),
+	uint4(0x1C01003F, 0x7F8FE0F8, 0xC0200FFE, 0xF1FC1F03), uint4(0x2180FFCF, 0x08000EFF, 0x86182180, 0xE7BE3963),
+	uint4(0x00EFFEFB, 0x21C00080, 0x00000000, 0xFFFF0000), uint4(0x000FFFFF, 0x00000000, 0x22000000, 0xC0FC0F80),
+	uint4(0x0FF0FE0F, 0xFFCFF8FF, 0x3F0FE3FC, 0x224000F0), uint4(0x01005079, 0x0F80E008, 0x0FCFF0FC, 0x00C00806),
+	uint4(0x2280FC0F, 0xC870C00E, 0xF7EE7F07, 0x3077877C), uint4(0x07807207, 0x22C03C6A, 0x01C03007, 0x01C0380E),
+	uint4(0x03C0780E, 0x0300701F, 0x2380E01C, 0x1FC1FC1F), uint4(0xFE1FE1FE, 0xF1EE1EE1, 0x1CF1EF1E, 0x23C0F1CF),
+	uint4(0x300E0180, 0x300601C0, 0x00000000, 0x00000000), uint4(0x24000000, 0x7F07F07F, 0xF07F07F0, 0x07F07F07),
+	uint4(0x7E07E07F, 0x244007C0, 0xFCFE0F00, 0x00000FFF), uint4(0xFC0C0000, 0x03FFFFF8, 0x24800000, 0x9FF3FE7F),
+	uint4(0xF7EFFDFF, 0x00301F0F, 0x01801002, 0x24C0E00C), uint4(0x0F81FC3F, 0x30070070, 0x00000100, 0xFCFFEFFF),
+	uint4(0x2500FF8F, 0x00C00000, 0x0FC0F80E, 0xFFEFF8FF), uint4(0xFFFFFFFF, 0x2540FFFF, 0xFFFFF000, 0xF7FFFFFF),
+	uint4(0xFFFFE0C1, 0x7FFFFFFF, 0x25800010, 0xB27A27C2), uint4(0xF3BE3BC7, 0x39E39F39, 0x0C19C19C, 0x25C010C1),
+	uint4(0xFFFFFFFF, 0xFFFFFFFF, 0x000FFFFF, 0x00000000), uint4(0x26000000, 0xE07F07F0, 0x07E07E07, 0x7C07C07C),
+	uint4(0x80780780, 0x26407007, 0x80F00F00, 0x03C07C0F), uint4(0x0F01F03E, 0x3C07C0F8, 0x268003E0, 0xE0FE0FE0),
+	uint4(0x0FE0FE0F, 0x1E03E07E, 0x270610E0, 0x26C001F0), uint4(0xC0FE0FF0, 0x0F00F80F, 0x800C00E0, 0x00000000),
+	uint4(0x27000000, 0xFEDFECFE, 0xE7FEFFED, 0x4FE5FE3F), uint4(0x1EC3EC7E, 0x2740C0EC, 0xE0FE1FEE, 0x07E0FE0F),
+	uint4(0xFEC8200E, 0xE0FE0FE3, 0x27807E0F, 0xC3F07C07), uint4(0xEFF9FE3F, 0x7E07F8FF, 0x00E00380, 0x27C01809),
+	uint4(0x7F7FFFFF, 0x00000070, 0xFFFFFF00, 0xFFFFFFFF), uint4(0x2840FFFF, 0x00F7FF3F, 0x07003001, 0xF03F01F0),
+	uint4(0x1FF0FF07, 0x2940F7FF, 0x7E87C0F8, 0xFF1FE3FC), uint4(0xFE7FCFF9, 0xFD7FBFF3, 0x29C0DFEB, 0xF9FF3FE7),
+	uint4(0xCFFCFF9F, 0x3FF7FEFF, 0xFF1FF1FF, 0x2A0087F8), uint4(0x00FFBFF9, 0x80180080, 0x0F807803, 0xF93F81F8),
+	uint4(0x2A40FFB7, 0x78FC0F00, 0x00000020, 0xF80E0000), uint4(0x0000C1F0, 0x2A800000, 0x00C0381F, 0x0F00E00E),
+	uint4(0xFC0F80F0, 0xE0FE0FC0, 0x2AC0FF0F, 0xF7000060), uint4(0x8FF8FF1F, 0xFFCFFCFF, 0xFFFFEFFE, 0x2B00FFFF),
+	uint4(0x380700E0, 0x7E0F81C0, 0x1C0781F0, 0x3C0780F0), uint4(0x2B80C1F8, 0x00FFFFEF, 0x18608208, 0x8E38E186),
+	uint4(0xEFBE79E7, 0x2BC0FEFB, 0x7F7FFFFF, 0x00000070), uint4(0x00000000, 0xFF03F003, 0x2C00FFF3, 0x02C02804),
+	uint4(0x0601E01C, 0x30030060, 0xC0180180, 0x2C400C00), uint4(0x00FFEFFF, 0x0000000C, 0xFFF00000, 0x00E00FFF),
+	uint4(0x2C800000, 0x1F01F01F, 0xF01F01F0, 0x01F01F01), uint4(0x1F01F01F, 0x2CC001F0, 0x00000000, 0x08008000),
+	uint4(0xE00E00C0, 0x80F80F00, 0x2D00FC0F, 0x00000001), uint4(0x0F008000, 0x0FEFF0FC, 0x0000101F, 0x2D400000),
+	uint4(0xFFFFFFFF, 0x0000000F, 0x00000000, 0x07E03C01), uint4(0x2D80FCFF, 0x0C40C40C, 0xE60E60E4, 0x20660660),
+	uint4(0x06206206, 0x2DC03072, 0x0FF0FE0F, 0xF18F38F7), uint4(0x02F04F0C, 0x0700F00F, 0x2E0000B0, 0xFF1FF0FF),
+	uint4(0xF3FF3FF1, 0x000FFF7F, 0x01001000, 0x2E400030), uint4(0x00FFFFFF, 0x00000000, 0x00000000, 0x00000000),
+	uint4(0x2E800000, 0xFFFFFFFF, 0xF1FF3FF7, 0x03F07F0F), uint4(0x0700F01F, 0x2F000030, 0xFFFFFFFF, 0xE800000F),
+	uint4(0xFFFFFFFF, 0x1F0FF7FF, 0x2F80FE30, 0x3803C03C), uint4(0x00300380, 0x02002003, 0xA0F00800, 0x2FC0FBCF),
+	uint4(0xE00E00C0, 0x00E00E00, 0x0F00E00E, 0xF00F00F0), uint4(0x30400F00, 0xFEFFCFF8, 0xF0FFFFFF, 0xFFFFC000),
+	uint4(0x1F1FFFFF, 0x30800010, 0x99399399, 0x93B93B93), uint4(0x7BB7B93B, 0xFB7BB7BB, 0x30C07FB7, 0x3E83E03E),
+	uint4(0xF83F83F8, 0xC3F83F83, 0x3FC3FC3F, 0x3100C3FC), uint4(0xFFFFFFFF, 0x0FF8FFEF, 0xE00F80FE, 0x00000800),
+	uint4(0x31800000, 0x9E31C21D, 0x70CF18F1, 0x8738670C), uint4(0x3943B473, 0x31C031D2, 0xFF0FF1FF, 0xF03F07F0),
+	uint4(0x00F01F03, 0x0300700F, 0x32000030, 0x00000000), uint4(0xFFFF0000, 0xFFEFFFFF, 0xF8FF8FFC, 0x3240FF0F),
+	uint4(0xFF000000, 0x0000C00F, 0x00000000, 0x00FC0000), uint4(0x32800000, 0xDF000010, 0xFF9FFDFF, 0xF0FF0FF9),
+	uint4(0x0EC0FE0F, 0x32C080CC, 0x01E03E07, 0x0600601E), uint4(0x00000020, 0x7FE7FEFF, 0x3300E3FE, 0x0000000F),
+	uint4(0xFC000000, 0x00301F0F, 0x00000000, 0x33803F00), uint4(0x7FC3FC1F, 0x0000DFFC, 0xC00C0040, 0x00C00C00),
+	uint4(0x33C0C00C, 0x01003007, 0x0E008010, 0x3F87E0F8), uint4(0xFF1FF1FE, 0x340007F0, 0xF8FF8FF8, 0x87F8FF8F),
+	uint4(0x0F81F83F, 0x18038078, 0x34400090, 0xFF1FF3FF), uint4(0x80FC0FE1, 0x02007007, 0x1FF9FFFF, 0x3480E0FF),
+	uint4(0x8C38C308, 0xFFCEBCEB, 0x20722F3E, 0x88308300), uint4(0x34C0B8C3, 0x00000800, 0x00004004, 0x00020020),
+	uint4(0x00100100, 0x35000800, 0x80F01E06, 0x0FE0FC0F), uint4(0x3FC7F8FF, 0x3FC7F9FE, 0x3540F9FE, 0xFF1F83C0),
+	uint4(0xF39FC3F0, 0x00100001, 0xF8FC0E00, 0x358007FF), uint4(0x8C19C198, 0xC9CC98C9, 0xCCE8CE9C, 0xE6CE6CCE),
+	uint4(0x35C0EE7C, 0x01802002, 0x0C018018, 0xE00C00C0), uint4(0x00600E00, 0x36007007, 0x0780F81F, 0x1C038038),
+	uint4(0xC00C00C0, 0x00E00E00, 0x3640E00E, 0xF8F80C00), uint4(0x0000FFFF, 0xFFCFE0E0, 0x80800FFF, 0x3680FF0F),
+	uint4(0x00D00D00, 0x0D00D00D, 0xD00D00D0, 0x00D00D00), uint4(0x36C0D00D, 0x00700FC0, 0xF3F87004, 0x1FF3FF3F),
+	uint4(0xFF1FF1FF, 0x37000FF0, 0x00F00F00, 0x0F00F00F), uint4(0xF00F00F0, 0x00F00F00, 0x3740F00F, 0x9FF1FF3F),
+	uint4(0x3FC7F8FF, 0xFF1FE1FE, 0xFCFF8FF0, 0x37803FC7), uint4(0x0700F01F, 0x10030070, 0x00000000, 0x00000000),
+	uint4(0x37C0C008, 0x3F0FF1FF, 0x300701F0, 0xC0080000), uint4(0x80F00E00, 0x3800FC0F, 0xF0FE0FC3, 0xEFFCFF8F),
+	uint4(0x3FFFFFFF, 0x0F03F0FF, 0x38400030, 0xF8FE0FC0), uint4(0xF7FFFFCF, 0x07F0FF3F, 0x0300F01F, 0x38800010),
+	uint4(0x03006006, 0x1C018038, 0x600600C0, 0x80300300), uint4(0x38C01801, 0x80381703, 0x00E01C01, 0x03807006),
+	uint4(0x0E00C018, 0x39408060, 0x80300C01, 0xC0300601), uint4(0xC0180600, 0x60180300, 0x39800300, 0xFFFFBFF3),
+	uint4(0x1801000F, 0x701E01C0, 0xE07C0781, 0x39C07F07), uint4(0xFF003001, 0xFFFFFFF1, 0x1FFFFFFF, 0x0100301F),
+	uint4(0x3A000FF0, 0xE03C13A1, 0xC1C81F03, 0xE87CCE8C), uint4(0xC3F83F07, 0x3AC07237, 0x10030030, 0x30110100),
+	uint4(0x00700700, 0x73037017, 0x3B000F30, 0x00000003), uint4(0x00000000, 0x00000000, 0x00C00000, 0x3B40F80E),
+	uint4(0xFCFFCFFC, 0xCFFCFFCF, 0xFFCFFCFF, 0xFCFFCFFC), uint4(0x3B80FFCF, 0x1FC1FC1F, 0xFE1FC1FC, 0xE0FE0FE1),
+	uint4(0x0FF0FF0F, 0x3BC0F0FF, 0x0FE07E03, 0xF63FE1FE), uint4(0x0FF0FF27, 0x1F63F27F, 0x3C00E0FE, 0xFFFFFFFF),
+	uint4(0xFFFFFFFF, 0x007000FF, 0xFF0FF01F, 0x3C80FFF3), uint4(0x00100100, 0x01001001, 0x10010010, 0x00100100),
+	uint4(0x3CC01001, 0xF0FF0FF0, 0x0FF0FF0F, 0xFF0FF0FF), uint4(0xF0FF0FF0, 0x3D00FF0F, 0x1F01F01F, 0xFE0F80F0),
+	uint4(0xFF8FE4F8, 0x83FC3FF6, 0x3D40F03F, 0x00000FFF), uint4(0x00000000, 0xFFFFFF00, 0x00FFFFFF, 0x3D800000),
+	uint4(0xFCFF0FE1, 0xF07F3FEF, 0xE00C0100, 0xC0380700), uint4(0x3DC01F03, 0x8FF0FF0F, 0xFFCFF8FF, 0xFEFFEFFC),
+	uint4(0x08000000, 0x3E000080, 0x7FE7FF7F, 0xEC7EC7FE), uint4(0x87C87CC7, 0x78078078, 0x3E400700, 0x0FC03406),
+	uint4(0x07FFE7FE, 0xE1FE0360, 0x0011FE7F, 0x3E80F077), uint4(0x1F000001, 0xFFFFFFF0, 0x1FFFFFFF, 0x0000301F),
+	uint4(0x3F0000F0, 0xFF1FC9F0, 0xF1FF1FF1, 0x1FC1FE1F), uint4(0xE01F01F8, 0x3F401C01, 0x0101E0F0, 0x00000000),
+	uint4(0x00000000, 0x1E1E0F00, 0x3F800030, 0x3C03C07C), uint4(0xD11D11D0, 0x30710D10, 0x03303307, 0x3FC07053),
+	uint4(0xFFFFFFFF, 0x0000000F, 0x00000000, 0x00000000), uint4(0x40000000, 0x0400400C, 0xDFFD0000, 0xFFCFFCFF),
+	uint4(0xFC7FCFFC, 0x40403FC7, 0xE7F0FC1F, 0x000001B7), uint4(0xC0000000, 0xF8FC0F00, 0x4080FFEF, 0x80F03E0F),
+	uint4(0x0FE0FC0F, 0xFFCFF8FF, 0xFF3FFFFE, 0x410007F0), uint4(0x00F80FC0, 0x0C00E00F, 0x00000080, 0xFFFFF000),
+	uint4(0x41401FF7, 0x7C07F87E, 0xFF30E200, 0x83C03F83), uint4(0x1FF3CFA0, 0x418001F0, 0xF08F08F0, 0x08F08F08),
+	uint4(0x8F08F08F, 0xF08F08F0, 0x41C08F08, 0x80200BFF), uint4(0xC3F03E03, 0x3FF3FF3F, 0x00BFF3FF, 0x42003802),
+	uint4(0x00FFF9FF, 0x0E006004, 0xF81F80F0, 0xE7FC3FC1), uint4(0x4240FF7F, 0x06006006, 0x60060060, 0x00600600),
+	uint4(0x06006006, 0x42800060, 0x00040040, 0x00200200), uint4(0x00002002, 0x10010010, 0x42C00100, 0x00000000),
+	uint4(0x00000000, 0x00000000, 0xFF000000, 0x4340FFFF), uint4(0x80C0100F, 0xFFFEFF0F, 0x00707F7F, 0xF0F80C00),
+	uint4(0x43800FE7, 0xC73C73C6, 0x31C33C73, 0x9C39C31C), uint4(0xC1CC1DC1, 0x43C0EC1C, 0x00FFFFFF, 0xFFFF0000),
+	uint4(0xFFFFFFFF, 0xFFFFFFFF, 0x4400FFFF, 0xE01F01F8), uint4(0x01C01E01, 0x10018018, 0xFFFFFFFF, 0x44409FFD),
+	uint4(0xC0FC0FC0, 0x0FC0FC0F, 0xFC0FC0FC, 0xC0FC0FC0), uint4(0x4480FC0F, 0x03001000, 0xF00F0070, 0x07F03F01),
+	uint4(0xFF1FF0FF, 0x44C07FF3, 0xFFFFF000, 0xFFFFFFFF), uint4(0x83F0FF7F, 0xC0F81E0F, 0x4500FF0F, 0x00F00F60),
+	uint4(0x0840C00F, 0x07006006, 0x7C078070, 0x454007C0), uint4(0x1F81EF30, 0x8F1F81F0, 0xC0FF8CFE, 0xC7E07007),
+	uint4(0x4580FFCF, 0x1E81E81C, 0x7E0FE0FC, 0xF83F07F0), uint4(0xE17C3783, 0x45C03E13, 0x00000000, 0x00000000),
+	uint4(0xFFFFF0C0, 0x00000FFF, 0x46000000, 0xF81F81FC), uint4(0x81F81F81, 0x1F81F81F, 0xF01F01F0, 0x46401F01),
+	uint4(0xE00E01E0, 0x00E00E00, 0x0600600E, 0x60060060), uint4(0x46800200, 0xFEFFCFF8, 0xFFFFFFFF, 0xFFFFFFFF),
+	uint4(0xFFFFFFFF, 0x46C0FFFF, 0xFF3FF7FE, 0xF01F07F0), uint4(0x00100300, 0x00000000, 0x4700FFF0, 0xE0FF0FF0),
+	uint4(0x0FC0FE0F, 0xF80F80FC, 0x00F00F00, 0x4780E00E), uint4(0x80380300, 0x00C00C01, 0x03006006, 0x08018010),
+	uint4(0x47C000C0, 0xE0FE0FC0, 0x0FF0FE0F, 0xFF8FF0FF), uint4(0xFCFF8FF8, 0x48407FCF, 0x3F07F0FF, 0x700F01F0),
+	uint4(0x00100300, 0x00000000, 0x4880FFF0, 0x7CE7CCF9), uint4(0xFF1EF3EE, 0x7C778FF9, 0xF11E33E7, 0x48C08F19),
+	uint4(0x700700F0, 0x00300300, 0xFFF01001, 0xF7FF7FFF), uint4(0x4900FF3F, 0xC0FF0FFC, 0xF400F00F, 0x00301F0F),
+	uint4(0x00000000, 0x49400000, 0x00000001, 0x00000000), uint4(0xF00E0080, 0xF0FE0F80, 0x4980FF8F, 0x1F42F87F),
+	uint4(0x73076076, 0x18218130, 0x608E18C0, 0x49C0C70C), uint4(0xFF3FF7FF, 0xF81F07F0, 0xFC1F03E0, 0xFCFF8FE0),
+	uint4(0x4A00FFFF, 0x00C013FF, 0x0E00E00C, 0x19FF00F0), uint4(0xC0FC0F80, 0x4A80FE0F, 0xC6386386, 0x39C79C69),
+	uint4(0x8E39E39C, 0xF1CE3CE3, 0x4AC0CF1C, 0x00E00E00), uint4(0x0F80F80F, 0xFE0FE0FC, 0xF8FF8FF0, 0x4B00FFCF),
+	uint4(0x0000100F, 0xF7F8FC0E, 0xC0000F07, 0xFEFF0F80), uint4(0x4B8007F3, 0x00FC0FFC, 0x0000000E, 0x00000000),
+	uint4(0xE0FFCFFF, 0x4BC0E00F, 0x3F7BFFBF, 0x00400470), uint4(0x0E00E00C, 0xF01F01E0, 0x4C003F03, 0xFE3FE7FD),
+	uint4(0xF87F8FF1, 0xE07C0FC1, 0x00701E03, 0x4C401803), uint4(0x30F20FC0, 0xF01F03C8, 0x80F01F01, 0xC7F8FE0F),
+	uint4(0x4C80FF6F, 0xFEDFE9FC, 0x0000DFFD, 0x30010000), uint4(0x81381381, 0x4CC03C13, 0xFFFFF000, 0xFE1FE7FC),
+	uint4(0xF81F03F0, 0xC0FC0F80, 0x4D40FE0F, 0x00C00C00), uint4(0x0E00C00C, 0xE00E00E0, 0x00F00F00, 0x4D80F00F),
+	uint4(0x80F00F00, 0x0FC0FC0F, 0x0F01F03E, 0x0C01C038), uint4(0x4E400020, 0xFF000C00, 0x0FF0FFEF, 0x800E00FC),
+	uint4(0xF8FFFFFF, 0x4E80FE0F, 0xE0FE0FF0, 0x0FC0FE0F), uint4(0xF80FC0FC, 0x00F80F80, 0x4F00F00F, 0x80F00E01),
+	uint4(0x0FC0F80F, 0xFF8FF0FE, 0xFE3FC7F8, 0x4F4007F1), uint4(0xFF03F01F, 0xF3FF1FF0, 0xFFFFFFFF, 0x00000000),
+	uint4(0x4F800000, 0x63463462, 0x36236236, 0x23163163), uint4(0x11331231, 0x4FC03113, 0xF8FF8FF8, 0x8FF8FF8F),
+	uint4(0xFF8FF8FF, 0xF8FF8FF8, 0x5040FF8F, 0x0100300F), uint4(0x0E00C018, 0xF80F80F0, 0xF07E0FC0, 0x50C01F83),
+	uint4(0x0701F07F, 0x00000010, 0x00000000, 0x00000000), uint4(0x51000000, 0x00C01C03, 0x01803006, 0x0600600C),
+	uint4(0x0C018030, 0x51400060, 0x1FFFFF80, 0x00000000), uint4(0xFFE80000, 0x0003FFFF, 0x51800000, 0x78E78E7C),
+	uint4(0xC67C6786, 0x63E63C63, 0x3E33E73C, 0x51C033E3), uint4(0xF7FE7FEF, 0x9FF1FF3F, 0xFFCFF8FF, 0xFE7FCFFC),
+	uint4(0x52403FE7, 0x07C0FC1F, 0x0F81F03E, 0x1E03E07C), uint4(0x7C0F81F0, 0x528003E0, 0xE0FE0FC0, 0x03F07E0F),
+	uint4(0x0F01F03F, 0x380780F8, 0x52C003C0, 0x1FC1FC1F), uint4(0xFF0FE0FE, 0xF87F87F0, 0xE3FC3FC7, 0x5300FE3F),
+	uint4(0x00000FFF, 0x00000000, 0x00000000, 0x00000000), uint4(0x53400000, 0x0460460C, 0x63043043, 0x18210230),
+	uint4(0x81182182, 0x53C00811, 0x1FC1FC1E, 0x7F8FF0FE), uint4(0x1F77E7FC, 0x0501B073, 0x5440C018, 0x0700F01F),
+	uint4(0x30038070, 0xC01C0180, 0x80F00C00, 0x5480E00E), uint4(0x60C618C1, 0x8E30C30C, 0x708718E1, 0x8638430C),
+	uint4(0x54C01C21, 0x3F07F0FF, 0x700F01F0, 0x00100300), uint4(0x00000000, 0x5500C008, 0x81783703, 0x01C03C13),
+	uint4(0x0700E01E, 0x3C038078, 0x554081C8, 0xC0FFFFFF), uint4(0xF7FFE00F, 0x07F0FF3F, 0x0300FF18, 0x55800010),
+	uint4(0x7F8FF3FF, 0x37CFF1FC, 0x01E0791E, 0x00001007), uint4(0x55C00000, 0x40040040, 0x08000400, 0xF00E00C0),
+	uint4(0x60F40F80, 0x5600F70F, 0x38C38C70, 0xEF1CE3CE), uint4(0x38F78E71, 0xE73C73CF, 0x56C09E31, 0xE3FC7F87),
+	uint4(0xDFF9FF3F, 0x3FF7FE7F, 0xFF1FF3FF, 0x57000FF1), uint4(0x00000003, 0x0E008000, 0x0781E038, 0x07C0F83E),
+	uint4(0x5740F01E, 0x80780700, 0x03C03C03, 0x1F01E01E), uint4(0xF80F80F0, 0x578007C0, 0x7C007004, 0xEFFE7FC0),
+	uint4(0x3FE7FEFF, 0x3F0FF1FE, 0x57C001F0, 0x01FFFFFE), uint4(0xF01F0070, 0x3FF0FF03, 0xFFFFF7FF, 0x5800FFFF),
+	uint4(0xE0FE0FC0, 0x8FF0FF0F, 0xFFCFF8FF, 0xFEFFEFFC), uint4(0x58401FF7, 0x87E0F81C, 0xEFF9FE3F, 0x1C030040),
+	uint4(0x7F8FC1F0, 0x5880FBFE, 0xCF1CF1CF, 0xF06F06F0), uint4(0x01F00F02, 0x0780780F, 0x58C08038, 0x7F7FFFFF),
+	uint4(0x00000070, 0x00000000, 0xFFFFFFFF, 0x5900FFFF), uint4(0xFF7FFFFF, 0xF3FF7FF7, 0x1FF3FF3F, 0xFF1FF1FF),
+	uint4(0x59400FF0, 0x7FE7FE7F, 0xFE7FE7FE, 0xE7FE7FE7), uint4(0x7FE7FE7F, 0x5980E7FE, 0x1E61E61E, 0xE61E61E6),
+	uint4(0x61E61E61, 0x1E61E61E, 0x59C061E6, 0xFF7FFFFF), uint4(0xFBFFFFF7, 0xDFFFFFBF, 0xFFFFFDFF, 0x5A00EFFE),
+	uint4(0xF8FF0FC0, 0xFFFFFFEF, 0xFFFFFFFF, 0xFF7FFFFF), uint4(0x5A401FF3, 0x0600600E, 0x70070060, 0x00300300),
+	uint4(0x03003003, 0x5A800010, 0x0C20C60C, 0xC20C20C2), uint4(0x20420C20, 0x04204204, 0x5AC00042, 0x0000701F),
+	uint4(0x00000000, 0x80000000, 0xE0F80E00, 0x5B403F8F), uint4(0xFEFF8FF0, 0xFFFFFFFF, 0xFFFFFFFF, 0x1F0FF7FF),
+	uint4(0x5B808030, 0x00000007, 0xFFFFFFF0, 0xFFFFFFFF), uint4(0x0000F7FF, 0x5BC00000, 0x01C01407, 0x3F83F03E),
+	uint4(0xFE7FC7F8, 0x0800F7E7, 0x5C0000C0, 0xF87C0E7F), uint4(0x0FFFFFFF, 0x00700000, 0x007FF07F, 0x5C80F008),
+	uint4(0x30630630, 0x06306306, 0x63063063, 0x30630630), uint4(0x5CC06306, 0x00000003, 0xF0000000, 0x3FFFFFFF),
+	uint4(0x0FE3FCFF, 0x5D40FC3F, 0xFFFFFFFF, 0x000001F7), uint4(0x01F00700, 0xFF3FF0FF, 0x5D80FFFF, 0x73673673),
+	uint4(0x36336336, 0x23163163, 0x11231231, 0x5DC02112), uint4(0x80301603, 0x00600C01, 0x80C01803, 0x01603C06),
+	uint4(0x5E001803, 0x0000701F, 0x00000000, 0x00000000), uint4(0xFFFFFFFF, 0x5E403FFF, 0xF8FE0F80, 0xFFFFFFEF),
+	uint4(0x0FF3FFFF, 0x03C0F03F, 0x5E80FC0F, 0xE0010018), uint4(0xFF9FFDFF, 0xC0FE0FF0, 0x0C00E80F, 0x5F00FC80),
+	uint4(0x00C00800, 0x01803006, 0x0300600C, 0x0600C018), uint4(0x5F400030, 0x00000FFF, 0x00000000, 0x00000000),
+	uint4(0x00000000, 0x5F80FFF0, 0x1FC1FC1F, 0xFC1FC1FC), uint4(0xC1FC1FC1, 0x1FC1FC1F, 0x5FC0C1FC, 0xFFFFFFFF),
+	uint4(0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x60001FF7), uint4(0x00000000, 0x08000000, 0xF00E00C0, 0xE0FC0F80),
+	uint4(0x6040FF0F, 0xF0FC3E07, 0xFC7F1FC7, 0xFFBFEFF3), uint4(0x80200000, 0x60800300, 0xFBEFBEF9, 0x4000FFBE),
+	uint4(0x20420400, 0x0C30C20C, 0x60C071C7, 0xF87F0FE1), uint4(0xE0FC1FC3, 0x01F03F07, 0x0300700F, 0x6100C010),
+	uint4(0x00C00000, 0xCFF0FC0F, 0xFFFFFFFF, 0xFFFFFFFF), uint4(0x6140FFEF, 0x00007FFF, 0xFFFFFC00, 0xFFFFFFFF),
+	uint4(0x1F0FC70F, 0x61800030, 0x80380300, 0x01C01803), uint4(0x0E00C01C, 0x700600E0, 0x61C00700, 0xFFFFEFF8),
+	uint4(0x0000000F, 0x00000000, 0x03001001, 0x62000030), uint4(0x1C83C83C, 0xE81E81E8, 0x81F81E81, 0x0F80F81F),
+	uint4(0x624080F8, 0x1FC1F83F, 0x3F07F0FE, 0xFE1FC1F8), uint4(0xF8FF0FF0, 0x62803FC7, 0x000600F0, 0x7F0FF9F0),
+	uint4(0x801C03E0, 0x00000000, 0x62C00000, 0x00000FFF), uint4(0x00000000, 0x00000000, 0xFF000000, 0x6300FFFF),
+	uint4(0x81081001, 0x00400000, 0x02000004, 0x10000020), uint4(0x63C08108, 0x00000000, 0xFFFF0000, 0xFFFFFFFF),
+	uint4(0x00000000, 0x64000000, 0x00FE0FFF, 0x0000000C), uint4(0x00000000, 0x00000000, 0x64800000, 0xF8FF8FF0),
+	uint4(0xEFFCFFCF, 0x001FFEFF, 0x01001001, 0x64C00030), uint4(0x7C01C005, 0xCFFC3FC0, 0x03C0FC7F, 0x1C00100C),
+	uint4(0x650007C0, 0x00201403, 0x00801801, 0x03006004), uint4(0x0C00C018, 0x65408060, 0x01703E03, 0x01803013),
+	uint4(0x0C008018, 0x20800040, 0x65C0F80E, 0x00000020), uint4(0x00040000, 0x00000000, 0x00000000, 0x66400000),
+	uint4(0x80FC0FE0, 0x0F00F80F, 0xC00E00E0, 0x00800800), uint4(0x66800000, 0xC104300F, 0x11C01C00, 0x7C37C33C),
+	uint4(0xCF3CFFC7, 0x66C005F1, 0x7C87C83C, 0xC87C87C8), uint4(0x8FC87C87, 0xFC8FC8FC, 0x67008FC8, 0x00FFFFFF),
+	uint4(0xF0000000, 0xFFFFFFFF, 0x00000FFF, 0x67800000), uint4(0x0300700F, 0x00000010, 0xE00C0000, 0xE07C0F00),
+	uint4(0x67C01F03, 0xFF1FF1FF, 0xF1FF1FF1, 0x1FF1FF1F), uint4(0xFE1FE1FF, 0x68401FC1, 0xF0FE0F80, 0xF07E7F8F),
+	uint4(0xC0080000, 0xC0F80F00, 0x6880FF0F, 0xDF09F0BE), uint4(0x306704F0, 0xC7187186, 0x3CE38C38, 0x68C033C6),
+	uint4(0x00000000, 0x00000000, 0xFFEFC080, 0x000070FF), uint4(0x69000000, 0x3F07F0FF, 0x700F01F0, 0xF0180300),
+	uint4(0xFFFFCFE0, 0x6940FFFF, 0xE0FC1F87, 0xE07C1F83), uint4(0x80700F03, 0x00200C01, 0x69800001, 0x00000003),
+	uint4(0xFFF8F808, 0x1FFFFFFF, 0x0000303F, 0x69C00000), uint4(0xFF1FF3FE, 0xF03F07F0, 0x00700F01, 0xF83C1603),
+	uint4(0x6A008FF9, 0xFFFFF7FF, 0x0000000F, 0x00000000), uint4(0x0F001000, 0x6A4003F0, 0xF8FE3FDF, 0xFFFEFFCF),
+	uint4(0x01F0FF7F, 0x00000003, 0x6A800000, 0x00FFFFFF), uint4(0x00000000, 0x00000000, 0xFFFFFFFF, 0x6AC0FFFF),
+	uint4(0xFFFFF000, 0xFFFFFFFF, 0xFFFFFFFF, 0x00000000), uint4(0x6B000000, 0x0FE0FC1F, 0x7F07E0FE, 0xF07F07F0),
+	uint4(0x83783783, 0x6B407C17, 0xFE7FFFFF, 0x1FE70380), uint4(0x800E00F8, 0x00000000, 0x6B80FFF0, 0x1FC1F81F),
+	uint4(0xFFCFF8FF, 0x000FF7FE, 0x03803006, 0x6C00E03C), uint4(0xFF1FE1FE, 0xFDFF9FF9, 0x000FFFDF, 0x80100100),
+	uint4(0x6C401801, 0x00E00E1F, 0x0E00E00E, 0xE00E00E0), uint4(0x00E0FE00, 0x6D00E006, 0x0000200C, 0x00000000),
+	uint4(0x00000000, 0x80200C00, 0x6D400600, 0x3F87CEC0), uint4(0x700F01F0, 0xE01FF3FC, 0xF8C00000, 0x6D80FFFF),
+	uint4(0xDF7BF77F, 0x37E77CF7, 0x7F87F97F, 0xFF7FE7FC), uint4(0x6DC07FF7, 0x02004008, 0x0200C018, 0x04008010),
+	uint4(0x04018030, 0x6E000020, 0x0000100F, 0x00000000), uint4(0x00000000, 0x00000000, 0x6E400000, 0xFFFFFFFF),
+	uint4(0xF07F3FFF, 0x00000100, 0x00000000, 0x6EC00000), uint4(0x7F0FF0FF, 0xF07F07F0, 0x03F07F07, 0x3F03F03F),
+	uint4(0x6F0003F0, 0xE002701F, 0x03E01E00, 0xFE0FE07E), uint4(0xE3FE0FE0, 0x6F403E7F, 0x0003FFFF, 0x00000000),
+	uint4(0x83F00000, 0x00C0087F, 0x6F80E00C, 0xC73C73C7), uint4(0x31E71E71, 0x8E39E39E, 0xF18F38F3, 0x6FC0CF1C),
+	uint4(0xFF3FF2FF, 0xF2FF2FF1, 0xE3F63F67, 0x0FE0FE1F), uint4(0x7040E07E, 0x00FF0000, 0x00000000, 0x000FFF00),
+	uint4(0x00000000, 0x70800000, 0xC79C79C7, 0x79C79C79), uint4(0x9C79C79C, 0xC79C79C7, 0x70C09C79, 0x0F01F03F),
+	uint4(0x10030070, 0x00000000, 0x00000000, 0x71000000), uint4(0x7F3FF3FF, 0x83E03872, 0x3FF3FE3F, 0xFF3FF3FF),
+	uint4(0x71403FF3, 0x00F00F00, 0x1F01F00F, 0xF01F01F0), uint4(0x03F03F03, 0x7180F03F, 0xE3FE7FE7, 0x13E17E37),
+	uint4(0x1E03E03E, 0xE00E01E0, 0x71C00600, 0xFFFFFFFF), uint4(0x0000000F, 0x00000000, 0xFF000000, 0x7200FFFF),
+	uint4(0x3F03C838, 0xF03F03F0, 0xE1EC1F03, 0xD0FD0F98), uint4(0x7280F18F, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF),
+	uint4(0x00FFF000, 0x72C00000, 0x00001006, 0x00000000), uint4(0x00000000, 0xBFF7F000, 0x7340FDFF, 0xFE0FE1FE),
+	uint4(0xF0FF0FF0, 0x07F07F0F, 0x7F07F07F, 0x738003F0), uint4(0x7CCFD9F9, 0xEC3CC7CC, 0xE1EE1EE3, 0x0770F60E),
+	uint4(0x73C03033, 0xBF0BF07F, 0xF39F19F1, 0xF8778F78), uint4(0x83F83F87, 0x7440F81F, 0xFFFFF000, 0x0000000F),
+	uint4(0xFFF00000, 0xFFFFFFFF, 0x7480FFFF, 0x00000000), uint4(0x00008000, 0xEFFDFF00, 0x1FF3FE7F, 0x7540F8FF),
+	uint4(0x00FFCFFF, 0x0000000E, 0xFC0E0000, 0xFEFFFFFC), uint4(0x7580F00F, 0xF0FF0FE3, 0xCFF8FF8F, 0x07E1FC3F),
+	uint4(0x0700F03E, 0x75C00010, 0x00000000, 0x0FC0F00C), uint4(0xFFFFFCFF, 0xFFFFFFFF, 0x76401FF7, 0x0300F03F),
+	uint4(0xF0000000, 0x7FFFFFFF, 0x0807C1FE, 0x7680FF30), uint4(0x0103F7FF, 0x0E00C008, 0xF80F00E0, 0xE0FE0FC0),
+	uint4(0x76C0FF0F, 0x07007003, 0xF00F00F0, 0x03F01F01), uint4(0x7F07F03F, 0x77000FF0, 0xF8FFB01C, 0x0FF0FF8F),
+	uint4(0x0000F07F, 0xC0FE0FE3, 0x7780FC0F, 0x00000000), uint4(0xFFBFFBF0, 0xE3FF3FF3, 0x3EE3FE3F, 0x77C0C3EC),
+	uint4(0x00000FFF, 0xF0000000, 0xFFFFFFFF, 0x00FFFFFF), uint4(0x78000000, 0x0000300F, 0x00000000, 0xE0080000),
+	uint4(0xF03C0F00, 0x78400780, 0x00007078, 0xF0000000), uint4(0x8FFFFFFF, 0xFFFF0F87, 0x7880FFFF, 0xF88F09E0),
+	uint4(0xFE3EC7CC, 0xF0FF1FE3, 0xC3F87F8F, 0x7900FC3F), uint4(0xFFE0007F, 0xFFFFFFFF, 0x0000007F, 0xFFFFFFF8),
+	uint4(0x7980007F, 0x7E0FE3FE, 0x200E01E0, 0xFFEFFF00), uint4(0xFEFFEFFE, 0x79C0FFEF, 0xC0180E7F, 0xEFF8FF07),
+	uint4(0xFFFFFFFF, 0x00FFFFFF, 0x7A000000, 0xFF3FF7FF), uint4(0xFE1F87F0, 0x00D0F3F8, 0x00000000, 0x7A400000),
+	uint4(0xE0F00803, 0x703F1FCF, 0xFC0E0000, 0x0F07F3F8), uint4(0x7A80C010, 0x03C07E07, 0x13014038, 0x1F83F03C),
+	uint4(0xFE0FF1FE, 0x7AC007C0, 0x7F07F07F, 0xF03F03F0), uint4(0x03F03F03, 0x1F01F01F, 0x7B0001F0, 0x3F07F0FF),
+	uint4(0x700F01F0, 0xC0180300, 0x80F00E00, 0x7B40FC0F), uint4(0xFF000000, 0xFFFFFFFF, 0x000FFFFF, 0xFFFFF000),
+	uint4(0x7B80FFFF, 0x00F01E07, 0x1F00F00F, 0x39FF07F0), uint4(0x8F0BF0BF, 0x7BC07833, 0x0300F01F, 0x00000010),
+	uint4(0xFFF00000, 0xFFFFFFFF, 0x7C00FFFF, 0x07F0FF9F), uint4(0xF402E07F, 0x3F13F9FF, 0xC01E01F0, 0x7C800000),
+	uint4(0x07803803, 0x78078078, 0x80F80F80, 0x1F80F80F), uint4(0x7CC081F8, 0xE03F87FE, 0xFE1F0000, 0x00100380),
+	uint4(0x00000000, 0x7D000000, 0x7EC7EC7E, 0xEC7EC7EC), uint4(0x87C87C87, 0x7C87C87C, 0x7D4087C8, 0xFF0FF07F),
+	uint4(0xF7FF3FF1, 0x000000FF, 0x01000000, 0x7D808038), uint4(0x00300380, 0x03003003, 0x20020020, 0x00C00A00),
+	uint4(0x7DC0F00E, 0x00000003, 0xFFFF0000, 0x3FFFFFFF), uint4(0x0F03F0FF, 0x7E000030, 0x1FF0FF0F, 0xFF9FF1FF),
+	uint4(0xFBFFBFFB, 0x40000000, 0x7E400C00, 0xFEFFFFFF), uint4(0xFE7F1E07, 0x00100701, 0xFE000000, 0x7E80FE0F),
+	uint4(0x80E00801, 0xEFF8FE0F, 0x03F0FF7F, 0x0000100F), uint4(0x7F008000, 0x7F07F0FF, 0xF03F03F0, 0xC0F81F01),
+	uint4(0x07E07C0F, 0x7F40F03F, 0xF81F9000, 0x81F83F8F), uint4(0x00001807, 0xF8FF80F9, 0x7F801F87, 0x80F81FC3),
+	uint4(0x0700F80F, 0xE0090030, 0x1FE3CE60, 0x7FC0C0FC), uint4(0x01003007, 0xCFC0C000, 0x000FFFFF, 0x00000000),
+	uint4(0x80400000, 0x00FFFFFF, 0xFFFFFFF0, 0xFFFFFFFF), uint4(0x00000000, 0x80800000, 0x1F80F80F, 0xF83F81F8),
+	uint4(0x87F87F83, 0xFF8FF8FF, 0x80C09FF9, 0xFFFFFFFF), uint4(0x0800000F, 0xFE0F80E0, 0xFFFFEFF8, 0x8100FFFF),
+	uint4(0xC0F80187, 0x0FE0FE0F, 0xFF8FF8FF, 0x0200E7FC), uint4(0x814001F0, 0x1FFFFFFF, 0xEFE0E000, 0x00F07F1F),
+	uint4(0xFCFC0C03, 0x818003FF, 0xF01E03E1, 0xCCF88F09), uint4(0x63E67CC7, 0x1E31F23E, 0x81C018F1, 0xFF7FF7FE),
+	uint4(0xF7FF7FF7, 0x7FF7FF7F, 0xE07FC7FF, 0x82007007), uint4(0x0101F1FF, 0x00000000, 0xF00E0080, 0xF0FE0F80),
+	uint4(0x8240FF8F, 0x80F80F80, 0x0F80F80F, 0xF80F80F8), uint4(0x80780F80, 0x82807807, 0x10FFFBEF, 0x08308100),
+	uint4(0xC71C70C3, 0xF3CF3CF1, 0x82C0DFFD, 0xF01E03C1), uint4(0xE83C0780, 0xF07E0FC1, 0xE03C1783, 0x83000F01),
+	uint4(0x00F00E03, 0xF087F80F, 0xFE0FC0FC, 0x101F0FE0), uint4(0x83801F90, 0xFD9FC9FC, 0x0000BFDB, 0x80480400),
+	uint4(0x1C81C80C, 0x83C083C8, 0xFFFFFFFF, 0x0000FFFF), uint4(0x00000000, 0x01000000, 0x84000030, 0xFE1FE1FE),
+	uint4(0xF7FE3FE3, 0x002FFF7F, 0x06006002, 0x844000E0), uint4(0xC0E007FF, 0x0FFFFFCF, 0x00F00000, 0x007FF07F),
+	uint4(0x8480FC0C, 0x20E00E40, 0x8E10E10E, 0xE04E0CE0), uint4(0x03E03E06, 0x84C0E01E, 0xFF3FF3FF, 0xF0FF0FF1),
+	uint4(0x83F83F07, 0x0FE0FC1F, 0x8500F07E, 0x7C87CC7E), uint4(0x00700780, 0x06006007, 0x00040040, 0x8540F7F0),
+	uint4(0xF8FF8FF8, 0x0FF0FF0F, 0xFE0FE0FF, 0xC0FC0FE0), uint4(0x8580FC0F, 0x80380380, 0x01C01801, 0x0C00C01C),
+	uint4(0x600E00E0, 0x85C00600, 0x00000000, 0x08008000), uint4(0x40040000, 0x00200000, 0x86000002, 0xFF7FFFFF),
+	uint4(0xF3FF7FF7, 0x9FF3FF3F, 0xFFDFF9FF, 0x8640EFFE), uint4(0x1F0FF7FF, 0xEF800030, 0x000FFFFF, 0xF8E00000),
+	uint4(0x86803FFF, 0x00100201, 0xFFFFFFF0, 0xFE7FEFFD), uint4(0xF83F17F3, 0x86C00FC1, 0xFFE00000, 0x0FFFFFFF),
+	uint4(0xFFFFF800, 0x1F0FF7FF, 0x87800038, 0x1FC3FC7F), uint4(0x3C07C0FC, 0xC00C01C0, 0x00C00C00, 0x87C0C00C),
+	uint4(0x00E03C0E, 0x0FC0F80F, 0xFF8FF0FE, 0xFF3FEFFC), uint4(0x884087F0, 0xFC7F0400, 0x07C07F07, 0x7FEF0060),
+	uint4(0x007C07F8, 0x88804007, 0x18318211, 0x608C10C1), uint4(0x84204608, 0x21423043, 0x88C08110, 0xFF1FF1FF),
+	uint4(0x00003FF3, 0xFC0F0060, 0xFCFF8FE0, 0x8900FFFF), uint4(0x00FC0FFC, 0x0800000E, 0xFFFFFFFF, 0xE0FFCFFF),
+	uint4(0x8940E00F, 0x80F81F87, 0xF0001803, 0xF87F8FFB), uint4(0x80380F81, 0x89800001, 0x00200204, 0x21020000),
+	uint4(0x00000010, 0x80081001, 0x89C00000, 0x007C07E0), uint4(0xF4006007, 0x7FC7FF7F, 0xC07E07F8, 0x8A407807),
+	uint4(0xE07E0FE0, 0x10E70270, 0xFE0FE0FE, 0xE0FE0FE0), uint4(0x8A80FE0F, 0x00000000, 0x00000000, 0x00000000),
+	uint4(0x01000000, 0x8B400030, 0xFEFFCFF9, 0x001FFFFF), uint4(0xFFFFFF00, 0x000031FF, 0x8B80FFF0, 0xC03C07C0),
+	uint4(0x03E03E03, 0x1E01E01E, 0xF00F01F0, 0x8BC00F00), uint4(0xFFFFFFFF, 0xFFFFFFFF, 0x000FFFFF, 0x0F007001),
+	uint4(0x8C4003F0, 0x00000004, 0x08000000, 0x00000000), uint4(0x00000010, 0x8C800000, 0xFFFFEFF8, 0x0000000F),
+	uint4(0xFC0F00C0, 0xFE7F8FE0, 0x8CC03FF7, 0xFFFFFFFF), uint4(0x0000000F, 0x80000000, 0x00C00C00, 0x8D00F00E),
+	uint4(0xFFFFFFFF, 0xFFFFFFFF, 0xFFF000FF, 0x00000000), uint4(0x8D800000, 0x60060060, 0x00400400, 0xFFF00004),
+	uint4(0x7EF7EFFF, 0x8DC0F7EF, 0xFFFF0F00, 0x0000FFFF), uint4(0x00000000, 0x00000000, 0x8E400000, 0x00000E00),
+	uint4(0xFFFF0000, 0xF00FFFFF, 0x00000000, 0x8E80FFF0), uint4(0x30030030, 0x00300300, 0x03003003, 0x30030030),
+	uint4(0x8EC00300, 0xF03FC3FE, 0x03C03E03, 0xBFF20030), uint4(0xFC3FE3FF, 0x8F003F83, 0x3FC3FC3F, 0xFE1FE1FE),
+	uint4(0xF8FF0FF0, 0xC3F87F87, 0x8FC0FC3F, 0x00000000), uint4(0xFFFF0000, 0xFFFFFFFF, 0xFFFFFFFF, 0x9000000F),
+	uint4(0x009FF8FF, 0x3E01C004, 0xF1FE07E0, 0x80080F3F), uint4(0x90803801, 0xBC3BC7BC, 0xC1BC3BC3, 0x0BC1BC1B),
+	uint4(0x3E0BE0BE, 0x90C003E0, 0x00E00C00, 0x0F80F00E), uint4(0xFE0FC0FC, 0xF8FF8FF0, 0x9100FFCF, 0x1C83C83C),
+	uint4(0x801801C8, 0x01801801, 0x08008018, 0x91400000), uint4(0x8FF8FF9F, 0xF78F78F7, 0x7CF7CF7C, 0xC77CF7CF),
+	uint4(0x91C03C77, 0x0780700F, 0x1C01C038, 0xE00E00C0), uint4(0x00700F00, 0x92003807, 0x0780780F, 0x3C03C07C),
+	uint4(0xE01E03E0, 0x00701F01, 0x92407807, 0x3FC3E87C), uint4(0x003FFBFF, 0xC0E01801, 0xC7F8FE0F, 0x9280FE7F),
+	uint4(0x8008107B, 0xC98C0840, 0xBDC98C98, 0xFFBDCBDC), uint4(0x92C041F3, 0x00400400, 0x04004004, 0x40040040),
+	uint4(0x00400400, 0x93404004, 0xFCFF8FF0, 0xF7FFFFEF), uint4(0xE07C3F8F, 0xE07C0F81, 0x93807F07, 0x18C0B807),
+	uint4(0xEE1CE1CC, 0x33E71EE1, 0x3F0BF1BF, 0x93C001F0), uint4(0xF0FF8FFC, 0x0F80FC0F, 0x800C00F0, 0x00000000),
+	uint4(0x9440FFF0, 0xE0980C00, 0xF1FF1FC1, 0x0FF0FF0F), uint4(0x7E0FF0FF, 0x94800780, 0xFB1F31F3, 0xDCFD8F99),
+	uint4(0xE7EC7CCF, 0x3FE3EE7E, 0x94C0F3FF, 0xFCFF0FC0), uint4(0xFFFFFFFF, 0xFFFFFFFF, 0x7F1FF7FF, 0x950001F0),
+	uint4(0xC09C0D80, 0x01F01E01, 0x1FC1F81F, 0xFF1FE1FC), uint4(0x95401FF1, 0xC3F87E0F, 0xC3F97F3F, 0xF7FEFF9F),
+	uint4(0x10020000, 0x958080C0, 0xC03E03F0, 0x03003803), uint4(0xBFF00020, 0xF83FC3FE, 0x95C03F03, 0xFEFFEFE0),
+	uint4(0xC1FC7FEF, 0x03C07C0F, 0xFBFC0018, 0x9600FF9F), uint4(0xE0FFCFFF, 0x0800F00F, 0x00000000, 0x00000000),
+	uint4(0x96400000, 0xFFFFCFC3, 0xF0FFFFFF, 0xFFFFF0F0), uint4(0x1F1FFFFF, 0x9680FE1E, 0xFF3FF3FF, 0xF0FF0FF1),
+	uint4(0x03C03E07, 0xCFFEF018, 0x9740F87F, 0x00000000), uint4(0x000007EF, 0xFE000000, 0x00000001, 0x9780E000),
+	uint4(0xE4FE8FE0, 0x3FE2FE6F, 0x7E1FE1FE, 0xE03E07E0), uint4(0x97C09E03, 0x7FE03E00, 0x0E00E00E, 0xE00E00E0),
+	uint4(0x00E00E00, 0x9800E00E, 0x00C00800, 0x0780F00E), uint4(0x0F01E03C, 0x1E03C078, 0x984000F0, 0x1FCFF000),
+	uint4(0x0E00E03C, 0xF80F00F0, 0xC0FC0F80, 0x98803E0F), uint4(0x3803C03C, 0x00100300, 0xFDFFDF00, 0x0FF1FF9F),
+	uint4(0x98C0E0FF, 0x00000007, 0x00000000, 0xFFFFFF00), uint4(0x1F0FF7FF, 0x99000030, 0xFFFFFFF1, 0x000F0FFF),
+	uint4(0x7FCFE0F0, 0x0000303F, 0x9980C000, 0x20040081), uint4(0x88100000, 0x00000000, 0xFFFFF000, 0x99C0FBFF),
+	uint4(0x0000107F, 0xF0000000, 0xFFFFFFFF, 0xFFFFFFFF), uint4(0x9A0001F7, 0xFF1FF0FF, 0xFFFF7FF3, 0xFFFFFFFF),
+	uint4(0xFFFFFFFF, 0x9A40FFFF, 0x7E03E03E, 0xE07E07E0), uint4(0x0FE0FE07, 0xFE0FE0FE, 0x9A801FE1, 0xCEBCC79C),
+	uint4(0xF42F4EE1, 0x70F60F61, 0x8478C70B, 0x9AC03C6F), uint4(0x00000001, 0x00000000, 0x1F8FC0C0, 0x0000301F),
+	uint4(0x9B000000, 0xFFFFEFFC, 0x0000FFFF, 0x00000000), uint4(0x00800000, 0x9B40E00C, 0x003C17E2, 0xF838CC0D),
+	uint4(0xF0300F01, 0xFF1FE3E1, 0x9B80C3C0, 0xFFF7FF7E), uint4(0x6102002F, 0x30E30610, 0x1E71E70E, 0x9BC0F3EF),
+	uint4(0x1FE1FE1F, 0xFE1FE1FE, 0xF1FE1FE1, 0x1FF1FF1F), uint4(0x9C00F1FF, 0xE00F00F0, 0x00800C00, 0xEFFEFF00),
+	uint4(0xFE8FFCFF, 0x9C400FC0, 0xC67C63CE, 0x6BC63C63), uint4(0x9C29C2BC, 0xC19C39C3, 0x9CC08C39, 0xFF7FF800),
+	uint4(0xF3FF7FF7, 0x1FF3FF3F, 0xFF1FF1FF, 0x9D000FF0), uint4(0xF87F8FF8, 0x83F87F87, 0x1F83F83F, 0xF81F81F8),
+	uint4(0x9D400F80, 0x30031861, 0x80184104, 0xC0C80820), uint4(0x80F04E04, 0x9DC0F42F, 0x10FF7FF3, 0x00F00300),
+	uint4(0xFF07F01F, 0xF1FF0FF0, 0x9E40FF3F, 0xFF7FFFFF), uint4(0x307FDFF3, 0x01E03806, 0x0300700F, 0x9E800010),
+	uint4(0x07F07F8F, 0x1C03E03F, 0x7FE801C0, 0xF83FC7FC), uint4(0x9F001F03, 0xFFFFFFFC, 0x3000000F, 0x3FF03F00),
+	uint4(0xFFFFFFFF, 0x9F80FFFF, 0x83C83C87, 0x3C43C43C), uint4(0xC41C43C4, 0x21C21C61, 0x9FC0421C, 0x00000000),
+	uint4(0xFFFFFFF0, 0xFFFFFFFF, 0xFFFFFFFF, 0xA0001FF7), uint4(0xA37837C3, 0x93B93B17, 0x31E31D31, 0x0EC1E91F),
+	uint4(0xA0C0F0EE, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF), uint4(0xFF000000, 0xA100FFFF, 0x7FFFCFF0, 0x00000030),
+	uint4(0x00000000, 0x00000000, 0xA140E008, 0x0000707F), uint4(0x00000000, 0x0FFFFF00, 0x00C00807, 0xA180F00E),
+	uint4(0xEFFFFFFF, 0xEDEEFEFF, 0x9CEDCEDE, 0x8C98C9CC), uint4(0xA1C01889, 0xF0FE0FD0, 0xEFF4FF8F, 0xFFBFFFFF),
+	uint4(0xFDFFBFFB, 0xA200FFDF, 0x3F47E4FE, 0x760F61F4), uint4(0x70170360, 0x80700700, 0xA2407807, 0x70070070),
+	uint4(0x00700700, 0x07007007, 0x70070070, 0xA2800700), uint4(0x00E03E07, 0x0E00E00E, 0x200600E0, 0x3FEE0C00),
+	uint4(0xA2C0E1FE, 0x0C018038, 0x10020060, 0x00000000), uint4(0xFF000000, 0xA300FFFF, 0xC0FE0FF0, 0x0F00F80F),
+	uint4(0x800C00E0, 0xFF7FFFFF, 0xA3807FF7, 0xF3BF33F7), uint4(0x19F19F39, 0x8F08F18F, 0x78878870, 0xA3C0C38C),
+	uint4(0xF81F81F8, 0x81F81F81, 0x1F81F81F, 0xF81F81F8), uint4(0xA4401F81, 0xFF1F8DC0, 0x01FC1FE1, 0x1C01E01F),
+	uint4(0x00900180, 0xA4809E0D, 0x20420420, 0x04204204), uint4(0x42042042, 0x20420420, 0xA4C04204, 0xFFFFFFFF),
+	uint4(0x0000FFFF, 0x00000000, 0x00000000, 0xA5000000), uint4(0x787F8FF8, 0x80380030, 0xFF8FF83F, 0xF8FF8FF8),
+	uint4(0xA540FF8F, 0x0303F1FF, 0xFFFF0000, 0xF80FF0FF), uint4(0x3F3FF800, 0xA5800070, 0xF03E17E3, 0xC0FC1F83),
+	uint4(0xE3FC7E87, 0x8FF1FE1F, 0xA5C0F87F, 0xCFF9FF3F), uint4(0xBFF7FE7F, 0xFFEFFDFF, 0xFFFFFFFF, 0xA600FFFF),
+	uint4(0x02402402, 0x34034024, 0x20160160, 0x01201201), uint4(0xA6402012, 0xF01E03E0, 0x80780F01, 0x01C03C07),
+	uint4(0x0700E01E, 0xA6800070, 0xFFFFFFFF, 0x0000000F), uint4(0x00000000, 0xFFFFF000, 0xA6C0FFFF, 0x00000F7F),
+	uint4(0x0F00F003, 0xF07F01F0, 0x00F3FF1F, 0xA7003000), uint4(0xFFFFFFFF, 0xF000FFFF, 0x000000FF, 0x00000000),
+	uint4(0xA780FFF0, 0x7F07F07F, 0xF07F07F0, 0x07F07F07), uint4(0x7F07F07F, 0xA7C007F0, 0x0701F07F, 0xC0080110),
+	uint4(0xE07C0680, 0x83F03E07, 0xA800FC1F, 0xCF39F33F), uint4(0x10E31C71, 0x07C0780F, 0x1F03E03C, 0xA84001F0),
+	uint4(0xBFF3FC7F, 0xC018000F, 0xE0780F00, 0xF3FC3F87), uint4(0xA880FFDF, 0x81F01E03, 0x0FC0F81F, 0xFD0FA0F8),
+	uint4(0xC87D87D0, 0xA8C03CC7, 0xE0FE1FE3, 0x07E0FE0F), uint4(0x0F01F03F, 0x18030070, 0xAA400080, 0x793713F1),
+	uint4(0xC1F81781, 0x8FC8BC1B, 0x5E4DE8DC, 0xAAC046E4), uint4(0xFE3FF3FF, 0x83FC3FC3, 0x3F03F03F, 0xC03C03E0),
+	uint4(0xAB003803, 0x80100201, 0x00200400, 0x80400801), uint4(0x00201402, 0xAB400801, 0xF0F83C1F, 0xFFFFFFEF),
+	uint4(0x81F0FF7F, 0xFCFE0F03, 0xAB80FFFF, 0x0100703F), uint4(0x08000000, 0xFC0F00E0, 0xFCFF8FE0, 0xABC03FFF),
+	uint4(0xFF9FF7FF, 0x71CF33F6, 0x03C0710E, 0x0700F01E), uint4(0xAC00E038, 0xF8C3C1FC, 0xCFFCFFCF, 0xFFCFFCFF),
+	uint4(0x3C3FCFFC, 0xAC80FF48, 0x08408408, 0x84084084), uint4(0x40840840, 0x08408408, 0xACC04084, 0x3FE3FE1F),
+	uint4(0xF67FE7FE, 0x0FF0FF2F, 0x1F23F07F, 0xAD0060F2), uint4(0xFEDFE9FC, 0xF7FFFFFD, 0x10311F0F, 0xC0180180),
+	uint4(0xAD401C01, 0x00000FFF, 0x0FFF0000, 0x00000000), uint4(0x00FFF000, 0xAD800000, 0x61843843, 0x1C218618),
+	uint4(0x421421C2, 0x10430430, 0xADC06106, 0xE7FE7FE3), uint4(0x7FF7FF7F, 0x000FF7FF, 0x0C008008, 0xAE0080C0),
+	uint4(0xFFFFFFFF, 0x0FF0FFEF, 0x000C00F8, 0xFFFE0800), uint4(0xAE40FFFF, 0xFF3FF3FF, 0xF1FF1FF1, 0x0FF0FF1F),
+	uint4(0x7F0FF0FF, 0xAEC007F0, 0x80F00701, 0x1F80F80F), uint4(0x1CFFC7FC, 0xE002301F, 0xAF001F00, 0x00F80FE0),
+	uint4(0x0000C00F, 0xE0000000, 0xFFFFFFF0, 0xAF40FFCF), uint4(0xF0E00000, 0x0000000F, 0x80000000, 0x00FFEFC0),
+	uint4(0xAF800000, 0xFC7F0FE0, 0x300F07E1, 0xF00E0080), uint4(0xF0FE0F80, 0xAFC01FCF, 0x1C038070, 0x10030060),
+	uint4(0x600C0080, 0xE01C0300, 0xB0400700, 0x00000F00), uint4(0x00000000, 0x00000000, 0x00F80FFF, 0xB0800000),
+	uint4(0x7CE7CEFC, 0xCF7CF7CE, 0x7BC7BDF3, 0xDC7DC7BC), uint4(0xB0C03DC3, 0x00000001, 0x08000000, 0x03C0E070),
+	uint4(0x0000100F, 0xB1408000, 0xFF1FC3F8, 0xFE7FCFF9), uint4(0x000FFFF7, 0x04008010, 0xB1C08060, 0x6F03F03F),
+	uint4(0x31E70E70, 0xFF07F13E, 0xF0FF0FF0, 0xB240FF0F), uint4(0x00000000, 0x0FFFFFF0, 0x000000F0, 0xFFFFFFFF),
+	uint4(0xB280C00F, 0x18018018, 0xC80C81C0, 0xC0680E80), uint4(0x07C06C06, 0xB300603E, 0xFFFFFFFF, 0x0000FFFF),
+	uint4(0x00000000, 0xFF000000, 0xB340FFFF, 0x78278279), uint4(0x81381781, 0x13C13C13, 0x9C09C1BC, 0xB3C009C0),
+	uint4(0xE0FC7F9F, 0xCFF8FF0F, 0xFFFFFEFF, 0xFFFFFFFF), uint4(0xB4003FFF, 0x07003001, 0xF01F00F0, 0x0FF07F03),
+	uint4(0xFF3FF1FF, 0xB440FFF7, 0x3FE1FE1F, 0xFE7FE7FE), uint4(0xFFFEFFEF, 0x01201000, 0xB4806036, 0x07E0FE0F),
+	uint4(0x3E03E07E, 0x601E01E0, 0x03200600, 0xB4C001F2), uint4(0xFFFF7FE3, 0x0010010F, 0x0F807803, 0xF81F81F8),
+	uint4(0xB5007FC3, 0xC03C17C3, 0x00C01C01, 0xFFF04004), uint4(0xCFFCFFDF, 0xB540FC7F, 0x3F07F1FF, 0x1E03C0F0),
+	uint4(0xFF0FE0F8, 0xFFFFFFFC, 0xB580FFFF, 0x608418C1), uint4(0x88388308, 0xC0E81C81, 0x07A0780E, 0xB5C09039),
+	uint4(0xFFFFFFF8, 0x087F1FF7, 0x00100700, 0x80000000), uint4(0xB680FFEF, 0xEEDEECEE, 0xEDFEDEED, 0x000FFEDF),
+	uint4(0x20020000, 0xB6C04220, 0xF0F80E01, 0xFFFFFFCF), uint4(0x1FFFFFFF, 0x0000301F, 0xB7000000, 0x00400DFF),
+	uint4(0xFC03C01C, 0xC3FC1FC0, 0x00DFFCFF, 0xB800C004), uint4(0x00000000, 0x00000000, 0xC0000000, 0x000071F0),
+	uint4(0xB8800000, 0x67E67E67, 0x7EE7EE7E, 0xEEFEE7EE), uint4(0xEFEEFEEF, 0xB8C0FEFF, 0xF0FC0F00, 0xFFFFFFCF),
+	uint4(0xFFFFFFFF, 0x7F9FF7FF, 0xB90009F2, 0xE77C7FC3), uint4(0x100702F0, 0x03801801, 0x7E07C03C, 0xB9808FE0),
+	uint4(0x00000000, 0x0C008000, 0xF80F00E0, 0xF0FE0FC0), uint4(0xB9C07F8F, 0x00800000, 0x0E00C008, 0x780F00F0),
+	uint4(0xE03E03C0, 0xBA400F01, 0x03C07C0F, 0x0C00C01C), uint4(0xC00C00C0, 0x00400C00, 0xBAC0DFF0, 0xFFFFFFC0),
+	uint4(0xFFFFFFFF, 0x0070FFFF, 0xFFF80000, 0xBB00FFFF), uint4(0x700600E0, 0x80300300, 0x00C01801, 0x0600400C),
+	uint4(0xBBC00020, 0x0F01F03E, 0x10030070, 0xE0000000), uint4(0xFFFFCFE0, 0xBC40FFFF, 0xFF0001E0, 0x00F80FFC),
+	uint4(0xC7FF7F0E, 0x6007807F, 0xBC80F3F0, 0x02004008), uint4(0x00000010, 0x00000000, 0x00000000, 0xBCC00000),
+	uint4(0xFFFFFF87, 0xFFFFFFFF, 0xFFFFFFFF, 0xFEF0F7FF), uint4(0xBD00FFFF, 0x80F80F00, 0x0FC0F80F, 0x7E07E0FC),
+	uint4(0xF01F03F0, 0xBD400F80, 0x1FFFFFFF, 0x00000000), uint4(0xFFF00000, 0xFFFFFFFF, 0xBD8003FF, 0x38038038),
+	uint4(0xC0180380, 0x81C81C01, 0x1C81C81C, 0xBE0080C8), uint4(0xC7FEF010, 0x0F01F83F, 0xFFFC00E0, 0xFC1FE3FF),
+	uint4(0xBE800780, 0x61C61C61, 0x0E60E60E, 0xE60E60E6), uint4(0x70E70E70, 0xBEC0E70E, 0xFFFFCFFC, 0xF006002F),
+	uint4(0x07F03F01, 0xFF3FF1FF, 0xBF00FFF7, 0x1F00EFEF), uint4(0x0C3F03F0, 0x0FF0FC04, 0x80BFF1FF, 0xBF807F83),
+	uint4(0x00F80F80, 0x0E00F00F, 0xC00C00E0, 0x00800800), uint4(0xC0000000, 0xE0F00000, 0xFFFFFFEF, 0xE00FFCFF),
+	uint4(0x00000000, 0xC040FE0E, 0x6004707F, 0x81F80F00), uint4(0x4FEFFC3F, 0x01E00C06, 0xC080F03F, 0x1F03F07F),
+	uint4(0x300700F0, 0x00000100, 0x1F003000, 0xC0C00FF0), uint4(0x0701F07F, 0x08000010, 0xFE0F80E0, 0xFFFFEFF8),
+	uint4(0xC1001FF7, 0xF03F83FC, 0x00C00E01, 0xE3FF3F00), uint4(0x0F80FC1F, 0xC1400070, 0xFF77FE7F, 0x104703F0),
+	uint4(0x07007006, 0x7C87C078, 0xC180C7E8, 0x40040040), uint4(0x00400400, 0x04004004, 0x40040040, 0xC1C00400),
+	uint4(0x3F4FF5FF, 0x370761F6, 0x7C078078, 0xF07E07C0), uint4(0xC2007F07, 0x7F1FF7F9, 0xEFE3F0F0, 0xC3F0FF3F),
+	uint4(0xFFFF9F87, 0xC28007F1, 0xF8FF0FE1, 0xE3FC7F8F), uint4(0x00F03E0F, 0xF8F01007, 0xC300FFFF, 0xFF1FF0FF),
+	uint4(0xF3FF3FF1, 0xFFF7FF7F, 0x00000000, 0xC3408008), uint4(0x00000000, 0x10000000, 0x00300100, 0x07007003),
+	uint4(0xC38000F0, 0xF8FF0FE0, 0xF7FEFFCF, 0x9FF3FF3F), uint4(0x7FE7FCFF, 0xC3C01BF7, 0x00000000, 0x00000000),
+	uint4(0xE0080000, 0xE0FC0F00, 0xC400FF8F, 0xFF9FF9FF), uint4(0xF9FF9FF9, 0x9FF9FF9F, 0xFF9FF9FF, 0xC4409FF9),
+	uint4(0xFF000000, 0x307FFFFF, 0xF00C0000, 0xFCFF0FC0), uint4(0xC480FFFF, 0xC03C03C0, 0x03C03C03, 0x3C03C03C),
+	uint4(0xC03C03C0, 0xC4C03C03, 0x01C03807, 0x0600401C), uint4(0x10000020, 0xFFF7F000, 0xC500FBFF, 0xFBFF9FF8),
+	uint4(0xC01C004F, 0x1FE07E03, 0xFF7FF3FE, 0xC540FFFF), uint4(0xFFFBFFBE, 0x000707F7, 0x83082002, 0x38C30C30),
+	uint4(0xC5C0E38C, 0x80F80F80, 0x0F80F80F, 0xFC0FC0FC), uint4(0xE0FC0FC0, 0xC600FE0F, 0x80F80F80, 0x0FC0FC0F),
+	uint4(0xFE0FC0FC, 0xE0FE0FE0, 0xC640FF0F, 0x80F81780), uint4(0x0F80F80F, 0xF9FF80F8, 0x80F80F80, 0xC680F80F),
+	uint4(0xFC0FC0FC, 0xC0FC0FC0, 0x0FC0FC0F, 0xFC0FC0FC), uint4(0xC6C00FC0, 0x00000007, 0xFFC00000, 0xFFFFFFFF),
+	uint4(0x1F0FF7FF, 0xC7000030, 0xFFFFF000, 0x0000FFFF), uint4(0x00000000, 0x00000000, 0xC7400000, 0x0383F1FF),
+	uint4(0x0FC0F00E, 0xFFEFFCFF, 0x3F3FFFFF, 0xC780C078), uint4(0x0760760F, 0x72072072, 0xC03C03A0, 0x01F03E03),
+	uint4(0xC7C0E81F, 0x7F03F01F, 0xF0FF07F0, 0x3FF1FF1F), uint4(0xFF7FF7FF, 0xC8001FF7, 0xFEFFEFFE, 0xE07E3FEF),
+	uint4(0x00200100, 0x1E00E006, 0xC84003E0, 0x04FFFFFC), uint4(0xE07E01C0, 0xFFE7FE1F, 0x1F007000, 0xC88007F0),
+	uint4(0xFFFFF000, 0xFFFFFFFF, 0xFFFFFFFF, 0x00000FFF), uint4(0xC8C0FFF0, 0x3FEFF9FF, 0xBFE7FDFF, 0xFFFFFCFF),
+	uint4(0xFFFFFFFF, 0xC900FFFF, 0x80E00800, 0xEFF8FE0F), uint4(0xFFFFFFFF, 0x7F1FF7FF, 0xC94001F0, 0x00000FFF),
+	uint4(0xF0000000, 0x000FFFFF, 0xFF000000, 0xC980FFFF), uint4(0x7F7FDFFD, 0x46042072, 0xE0CE0C60, 0x3CE1CE1C),
+	uint4(0xC9C0E3CE, 0xFCFFCFFC, 0xF07E3FEF, 0x00000100), uint4(0x01000000, 0xCA008018, 0x80E00800, 0xE0781E07),
+	uint4(0x00100701, 0x00000000, 0xCA800000, 0xC3183186), uint4(0x08600610, 0x618C3083, 0x0630C60C, 0xCAC01863),
+	uint4(0xFFBFDBFD, 0x1201000F, 0x78370120, 0xC37C3783), uint4(0xCB007E37, 0x80F01E03, 0x07E0FC0F, 0x0F81F03E),
+	uint4(0x1E03E07C, 0xCB4000F0, 0xFF1FF3FF, 0xF0FF0FF1), uint4(0x03F07F07, 0x1F01F03F, 0xCB8080F8, 0x00000000),
+	uint4(0x00000000, 0xFFF00000, 0xFFFFFFFF, 0xCBC0FFEF), uint4(0x0E80E80E, 0xE80E80E8, 0x80E80E80, 0x0E80E80E),
+	uint4(0xCC4080E8, 0x0300F03F, 0x0E00C000, 0x7F0FE0F8), uint4(0x0F07F1FC, 0xCC800030, 0x84084084, 0x20420820),
+	uint4(0x84184204, 0x21821821, 0xCCC04204, 0x7F07F0FF), uint4(0xF03F03F0, 0x00F01F01, 0x0700700F, 0xCD000030),
+	uint4(0xE03C17C3, 0x80F81F01, 0xC3E87C07, 0x0FE0FC1E), uint4(0xCD40F07F, 0xFFFFEFF8, 0xFFFFFFFF, 0xFFFFFFFF),
+	uint4(0xFFFFFFFF, 0xCD80FFFF, 0xE78E79E7, 0x7CE7CE78), uint4(0xCE7CE7CE, 0xE3CE3CE7, 0xCDC0CF3C, 0x80F00F00),
+	uint4(0x0FC0F80F, 0xFE0FE0FC, 0xF8FF0FF0, 0xCE40FF8F), uint4(0xF3C0E03F, 0x0E00FC0F, 0x7FC00080, 0x0F07F1FF),
+	uint4(0xCE800030, 0xFF0FF1FF, 0x80FE0FF0, 0xFC006007), uint4(0x3F83FE7F, 0xCF0003F0, 0xFF1FF0FF, 0xF7FF3FF1),
+	uint4(0xFFFFFF7F, 0xFFFFFFFF, 0xCF40FFFF, 0xF87F8FF8), uint4(0x80F81F83, 0x01803807, 0xFBFFF008, 0xCF80FF9F),
+	uint4(0xF01F03E1, 0x8E308700, 0xFF8FE8F9, 0xFC3FD7FA), uint4(0xCFC00FC1, 0xFCFF8FF0, 0xF7FFFFEF, 0x80000707),
+	uint4(0x00E00C00, 0xD040F00F, 0x10000020, 0x00000000), uint4(0xFFB00000, 0xFDFFDFFF, 0xD0807FEF, 0xF8CF8DF0),
+	uint4(0x68FECFCC, 0x8F78F78F, 0xF38F38F7, 0xD0C08F38), uint4(0x6101F7C7, 0x07E01E00, 0xFF0FF0FF, 0xF8FF8FF8),
+	uint4(0xD100FFCF, 0x00000FFF, 0xFFFF0000, 0xFFFFFFFF), uint4(0x00FFFFFF, 0xD1400000, 0xF8FE1F0F, 0xFFFFFFFF),
+	uint4(0xFFFFFFFF, 0x3F1FFFFF, 0xD1C00070, 0x00000001), uint4(0x08000000, 0x3FFC1F80, 0x80F03E1F, 0xD200F80F),
+	uint4(0x7E0FE0FE, 0xE07E07E0, 0x03E07E07, 0x3E03E03E), uint4(0xD24003E0, 0xFFC3FC0F, 0x0F0031F6, 0xFC0FC0F8),
+	uint4(0xF0FF0FE0, 0xD280FF8F, 0xFF3FF7FE, 0xF01F07F0), uint4(0x00100300, 0x00000000, 0xD3000000, 0x83F87F87),
+	uint4(0x1F81F83F, 0x38078078, 0x80180380, 0xD3400801), uint4(0x00FFFFFF, 0xFFFF0000, 0xFFFFFFFF, 0x00000000),
+	uint4(0xD380FFF0, 0x04FFFFF9, 0xF00E0060, 0x03F01F00), uint4(0x7FC7F83F, 0xD3C0EFFC, 0xFFFFFFFF, 0x0000000F),
+	uint4(0x00000000, 0x00E00800, 0xD400FC0F, 0x01603603), uint4(0x0E002012, 0xE7FEFEFE, 0x3FE3FE7F, 0xD440E1FE),
+	uint4(0xBE7BE7BE, 0xE7BE7BE7, 0x7BE7BE7B, 0xBE7BE7BE), uint4(0xD4C07BE7, 0x0E01E03E, 0xD0000040, 0xFF8FF8FF),
+	uint4(0xF0FF0FF8, 0xD500FF0F, 0xFF3FFFFF, 0x300703F0), uint4(0x00000000, 0x00000000, 0xD580E008, 0x7F7FFFFF),
+	uint4(0x00000070, 0x00000000, 0x00000000, 0xD5C00000), uint4(0x7F07F07F, 0xF0FF0FF0, 0x1FF1FF1F, 0xFF3FF3FF),
+	uint4(0xD6007FF7, 0x00300300, 0x03003003, 0x30030030), uint4(0x00300300, 0xD6403003, 0xFF7FFFFF, 0x180703F0),
+	uint4(0xFC0F00E0, 0xFCFF8FE0, 0xD680FFFF, 0x01FFFFFE), uint4(0xF01F0070, 0x7FF1FF07, 0xFFFFFFFF, 0xD740FFFF),
+	uint4(0x00000000, 0x0000FFF0, 0x00000000, 0x00FFFFFF), uint4(0xD7800000, 0x00000000, 0x00000000, 0x00000000),
+	uint4(0x00000000, 0xD7C0FFF0, 0x00000000, 0xF0000000), uint4(0x800FFCFF, 0x00000000, 0xD8800000, 0xE31E31E3),
+	uint4(0x73E31E31, 0x3E73E73E, 0xEF7EF3E7, 0xD8C07EF7), uint4(0x0F003FFE, 0xF0FF03F0, 0xFFFFFF3F, 0x00FFFFFF),
+	uint4(0xD9000000, 0xF01F01E0, 0xE9FC1F81, 0xFFFDFE9F), uint4(0x80100100, 0xD9401C01, 0x0000707F, 0xFFF8F80C),
+	uint4(0x0FFFFFFF, 0x00000007, 0xD9808000, 0x8E98E98E), uint4(0xE98E98E9, 0x98E98E98, 0x8E98E98E, 0xD9C098E9),
+	uint4(0x00040000, 0x00200200, 0x00001000, 0x04000008), uint4(0xDA008040, 0x3F83F07F, 0xFF1FE1FC, 0xFE7FCFF8),
+	uint4(0xFCFFAFF7, 0xDA40FF8F, 0x00C01003, 0xCFF0FC0F), uint4(0x00707F7F, 0x00000000, 0xDA808000, 0x78C78C78),
+	uint4(0x8C78C78C, 0xC78C78C7, 0x78C78C78, 0xDAC0C78C), uint4(0xFFFFFFFC, 0x0F80FFEF, 0x00000000, 0xF0F80C00),
+	uint4(0xDB00FFEF, 0x3F0FE1F8, 0x300701F0, 0x00000000), uint4(0x00000000, 0xDB400000, 0x01703F07, 0xF0001003),
+	uint4(0xF1FF3FF7, 0x03F07F0F, 0xDB803017, 0xC00C00E0), uint4(0x00800C00, 0x08008008, 0xFF000000, 0xDBC0EFFF),
+	uint4(0x80F80F00, 0x0FC0F80F, 0xFE0FC0FC, 0xF0FE0FE0), uint4(0xDC00FF1F, 0x78E60F00, 0xF07F07E8, 0x07C07E07),
+	uint4(0x00C60070, 0xDC40F40F, 0x00C00E00, 0xFFFFFFF8), uint4(0xFFFFFFFF, 0xF8FFCFFE, 0xDCC0FF0F, 0x3C07E0FF),
+	uint4(0x7FEF0100, 0xC01F03F8, 0xFF000800, 0xDD80FFFF), uint4(0x73E73673, 0x7E77E77E, 0xF77F77E7, 0xF7FF7F77),
+	uint4(0xDDC0FF7F, 0xFC3FC3FC, 0xC8FC0FC1, 0xF3CE3CC7), uint4(0xECFCCF9C, 0xDE00FF4F, 0x0000000F, 0xFFFF0000),
+	uint4(0x00301F0F, 0x00000000, 0xDE803FF0, 0xF72F36F3), uint4(0x70F71F70, 0x03707707, 0x0F21F01F, 0xDEC02072),
+	uint4(0x10FFFFEF, 0x00300300, 0x1F00F007, 0xFB3F91F8), uint4(0xDF407FB7, 0xFF0FF07F, 0xF7FF3FF1, 0xFC0C00FF),
+	uint4(0xFFFFFFFC, 0xDF80FFFF, 0xE71E71E7, 0x79F79E79), uint4(0xDFFDF7DF, 0x04000000, 0xDFC00040, 0x3F0FF1FF),
+	uint4(0x300701F0, 0x00000000, 0x00000000, 0xE0000000), uint4(0xDFFDFFDF, 0x7FEFFEFF, 0xFF7FF7FF, 0xFDFFBFFB),
+	uint4(0xE040FFDF, 0x3EFF8FE0, 0x0FC0F00C, 0xE07BFCFF), uint4(0xF8FE0F80, 0xE080C7EF, 0xE7FE7FEF, 0x17E37E3F),
+	uint4(0x3C13E17E, 0xC01C01C0, 0xE0C00C00, 0x3F0FF1FF), uint4(0x3E07C1F8, 0xFC0F80F0, 0xF8FF0FE0, 0xE140FFCF),
+	uint4(0x03C3F1FF, 0xCFF0FC0F, 0xFFFFFFFF, 0x3F3FFFFF), uint4(0xE1808070, 0xFE7FCFFD, 0xF8FF9FE3, 0xE1FC3FC7),
+	uint4(0x03F07E0F, 0xE1C0F81F, 0x00000000, 0xFFFF0000), uint4(0xFFEFFFFF, 0xFEFFEFFE, 0xE200FFCF, 0x00C00007),
+	uint4(0x8FF0FC0F, 0x00F0FEFF, 0xC0F00C00, 0xE280FE0F), uint4(0xFF3FF7FF, 0xF01F07F0, 0x00100300, 0x00E00800),
+	uint4(0xE300FC0F, 0x40FDFFC7, 0x07C01C00, 0xFC0FC0FC), uint4(0xC3FC0FC0, 0xE340FCFF, 0x01E03E0F, 0x0600E00E),
+	uint4(0xE70E80A0, 0x07E0FE1F, 0xE380E01E, 0xCECCECEF), uint4(0xC8CE8CE8, 0x08C08C8C, 0x0808C08C, 0xE3C00080),
+	uint4(0x00000000, 0xC0000000, 0x000F00FF, 0x00000000), uint4(0xE4000000, 0xE0FF0FF0, 0x0FE0FE0F, 0xFC0FC0FC),
+	uint4(0x80F80F80, 0xE440F00F, 0xF87E03CF, 0xFFFEFFCF), uint4(0xE0381F0F, 0xE0FC0F00, 0xE4803F0F, 0x87F8FF8F),
+	uint4(0x3FC3FC7F, 0x7E1FE1FC, 0xF0BF07E0, 0xE4C09F0B), uint4(0x0700700F, 0x10030030, 0x40080180, 0x00000400),
+	uint4(0xE5008002, 0x00000007, 0x00000000, 0xFC0E0000), uint4(0x1F0FF7F8, 0xE5400030, 0x60060060, 0x00200200),
+	uint4(0x02002002, 0x00020020, 0xE5800000, 0xF79FE9F8), uint4(0x31F31F31, 0x0C30E30E, 0x010C10C1, 0xE5C0F01C),
+	uint4(0x00E00E01, 0x0E00E00E, 0x000E00E0, 0x00E03E1F), uint4(0xE600E00E, 0xFF7FEFF8, 0xF07F0FF3, 0x00700F03),
+	uint4(0x80E00803, 0xE640FC0F, 0x43C43847, 0x36436434), uint4(0x78370370, 0xC13C1781, 0xE6C03E13, 0x80600C00),
+	uint4(0x80700C03, 0x00700C01, 0x00C00001, 0xE7003806), uint4(0x83183183, 0x30C30C31, 0x0C30C30C, 0xC10C10C3),
+	uint4(0xE7C00C10, 0x01003003, 0x00000000, 0xC0080080), uint4(0x00C00C00, 0xE840E00E, 0xC01C0FDF, 0x0FC3FC0F),
+	uint4(0xFC07C004, 0xC0FCFFC0, 0xE880FC01, 0x1E01E01E), uint4(0xE01E01E0, 0x01E01E01, 0x1E01E01E, 0xE90001E0),
+	uint4(0xFF8FFFFF, 0xE0FF0FF0, 0x07007C07, 0x3FFBF060), uint4(0xE940C3FF, 0xFCFFCFFC, 0xC00401D7, 0x1FC07C01),
+	uint4(0xFCFFC7FC, 0xE980FFCF, 0x00E00C00, 0x03C0780F), uint4(0x0780F01E, 0x0F01E03C, 0xE9C00070, 0x00800003),
+	uint4(0x8FE0F80E, 0x7FFFFEFF, 0x3F0FF3FF, 0xEA0001F0), uint4(0xFFDFEBFD, 0xFFBFF7FE, 0xFE7FCFF9, 0xFC3F97F3),
+	uint4(0xEA408FE9, 0xFFFF8F81, 0x0C0703F3, 0x0FFFF8FC), uint4(0xC0E0101F, 0xEA803F8F, 0xC0FC0FC0, 0x0FC0FC0F),
+	uint4(0xFE0FE0FE, 0xE0FE0FE0, 0xEB00FE0F, 0x3FF3FF3F), uint4(0xFE1FE1FE, 0xC1FE1FE1, 0x0FC0FC1F, 0xEB40C0FC),
+	uint4(0xF8F81000, 0xFFFFFFFF, 0x01FFFFFF, 0x00000000), uint4(0xEB80FFF0, 0x18610421, 0x410C1082, 0x8430C208),
+	uint4(0x10421861, 0xEBC02186, 0x7F8FF8FF, 0xF87F87F8), uint4(0x83F87F87, 0x3F83F83F, 0xEC0083F8, 0xE17E27E2),
+	uint4(0x09E03E13, 0xE60EE0DE, 0xE0FA0F60, 0xEC40FE0F), uint4(0x18318310, 0xCB9C3983, 0x7FEFDEBD, 0x1321F0FF),
+	uint4(0xECC03102, 0x3F07F0FF, 0x7FC801E0, 0xF81FC3FF), uint4(0x00C00E00, 0xED000000, 0xF0FC0F00, 0xF7FFFFCF),
+	uint4(0x03F0FF1F, 0x0180700F, 0xED40F80E, 0x0000301F), uint4(0x0F00C000, 0x01F0FC7E, 0x00000003, 0xED80C000),
+	uint4(0x3D87D07B, 0xF43E43F8, 0x31F21F61, 0xCF18F38F), uint4(0xEDC01C71, 0xFE3FC3FC, 0x307FBFFB, 0x38030020),
+	uint4(0xE03C03C0, 0xEE803F03, 0xE31C31C7, 0x09E09E11), uint4(0x1F85F09F, 0xFC1F83F8, 0xEEC017C0, 0x1F01F01F),
+	uint4(0xF00F00F0, 0xC0780700, 0x03E03C07, 0xEF00F03F), uint4(0x1C038070, 0x3F07C0F8, 0x0F03C078, 0x1E83C078),
+	uint4(0xEF80F0FC, 0xDF79F79F, 0xC7DE7DF7, 0x7F07D87D), uint4(0x80FC07E0, 0xEFC0F00F, 0x00800000, 0x0E00C008),
+	uint4(0xF80F00E0, 0xE0FC0F80, 0xF000FE0F, 0xC03E03E0), uint4(0x03803803, 0x20030030, 0xFF000000, 0xF040BFFB),
+	uint4(0x1F0FF7FF, 0x08000030, 0xFE0F80E0, 0xFFFFEFF8), uint4(0xF0803FFF, 0xFDCFDCF9, 0x2000EFDE, 0x10310210),
+	uint4(0x83183183, 0xF0C01C31, 0xF87F07E0, 0x0FFF7FC7), uint4(0x70060040, 0xF07E07C0, 0xF1007F87, 0xE07C0F81),
+	uint4(0xCFFB0100, 0x07F1FEFF, 0x0080100F, 0xF180EFF4), uint4(0xF0782642, 0xF7BF7BC7, 0x33973973, 0x11239339),
+	uint4(0xF1C02112, 0xE0FC1F83, 0xC1F83F07, 0xC7F8FE0F), uint4(0x8FF1FE3F, 0xF200FC7F, 0xFEFFEFFC, 0xFFFFFFFF),
+	uint4(0x3FF7FFFF, 0x7F8FF1FF, 0xF240C3F8, 0x01E07C0F), uint4(0x0F80F00F, 0xFC0FC0F8, 0xF0FF0FE0, 0xF2807F8F),
+	uint4(0xF9FB9FB9, 0x93F97F9F, 0x07F0FF1F, 0x0F81F83F), uint4(0xF2C08078, 0xFF1FF0FF, 0xF7FF3FF1, 0x000FFFFF),
+	uint4(0x00000000, 0xF3000000, 0x1FE0FE0F, 0xFF3FF1FF), uint4(0xFFFF3FF3, 0x80080000, 0xF3C00800, 0xF81F07C0),
+	uint4(0xF03F07C0, 0xE03C0701, 0xE0FC0F81, 0xF4003F87), uint4(0x600E00E0, 0x00600600, 0x02006006, 0x20020020),
+	uint4(0xF4400210, 0x61C61C61, 0x1C61C61C, 0xC61C61C6), uint4(0x61C61C61, 0xF4C0C61C, 0x00000000, 0x8F000000),
+	uint4(0xFFFFFFFF, 0x00F00FF8, 0xF5000000, 0x00800000), uint4(0x0C00C008, 0xF00E00E0, 0x80F80F00, 0xF580FC0F),
+	uint4(0xE1C3F7FF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF), uint4(0xF5C0FFFF, 0xFFFFFFFF, 0x8FFCFFEF, 0xFE0FF0FF),
+	uint4(0x00F80FC0, 0xF680E00F, 0x3D08D083, 0xC3FC0FD0), uint4(0xF9CFBCFB, 0x8C79C79C, 0xF6C038C7, 0x1C03C078),
+	uint4(0x780F00E0, 0xE01C03C0, 0x80F00F00, 0xF7007C0F), uint4(0x7C07C07C, 0xC07C07C0, 0x07C07C07, 0x7C07C07C),
+	uint4(0xF74007C0, 0xFEFFFFFF, 0x0E00FE0F, 0x00000000), uint4(0x00000000, 0xF8400000, 0xFE9FF000, 0x01E01F81),
+	uint4(0x0FFEFF08, 0x600F80FE, 0xF880F7F0, 0x02302306), uint4(0x01001021, 0xFFEFFF00, 0x7EF7EF7E, 0xF8C0F3EF),
+	uint4(0xFF0FF1FF, 0xF0FF0FF0, 0x07F07F07, 0x3F03F07F), uint4(0xF90003F0, 0x78CF0EC0, 0xF07F87E8, 0x03F07F07),
+	uint4(0x3F03F03F, 0xF94003F0, 0xF8FE0F01, 0x000F0FEF), uint4(0x7FF00000, 0xC0F03C3F, 0xF980FF8F, 0xC1FC0FC0),
+	uint4(0x3FC3FC1F, 0xFC7FC3FC, 0xCFFCFFC7, 0xF9C0FCFF), uint4(0x00000001, 0xFFFF0000, 0x03F0FF7F, 0x0000100F),
+	uint4(0xFA400000, 0xFF8FF8FF, 0xF4FFCFFC, 0x0FF0FF2F), uint4(0x9F03F07F, 0xFB0008F0, 0xF0E00000, 0xFFFFFFFF),
+	uint4(0x000000FF, 0xFFFE0E00, 0xFB801FF7, 0x07F0FF0F), uint4(0x1F87783F, 0x7C33C1F8, 0xE11E05E2, 0xFBC02F12),
+	uint4(0x00008000, 0x00000000, 0x00000000, 0x00000000), uint4(0xFC008000, 0xFEF80001, 0xFFFFFFFF, 0x1FFFFFFF),
+	uint4(0x0000301F, 0xFC408000, 0x00F80FC0, 0x0C00E00F), uint4(0x00707F00, 0x00000000, 0xFC800000, 0xFE1F0381),
+	uint4(0xF07F0FF1, 0x00F01F03, 0x03007007, 0xFD403C16), uint4(0x00C00E03, 0xF0FF800C, 0x00000000, 0x1F1FFFFF),
+	uint4(0xFD800010, 0x5E87C8BC, 0xF22F43E4, 0x10F11721), uint4(0x4588708B, 0xFDC0C438, 0x80800600, 0xF7FF7F07),
+	uint4(0x7F07FC7F, 0x006007C0, 0xFE007008, 0xFF5FF3FF), uint4(0xFDFFDFFD, 0xCFFCFFCF, 0x7FC7FCFF, 0xFE40C7FC),
+	uint4(0x78078078, 0x00300300, 0x03003003, 0x00030030), uint4(0xFE800000, 0x0C008010, 0x7C0E80E8, 0xF07F07E0),
+	uint4(0xC37C3F83, 0xFEC07E37, 0x03E07C0F, 0x0F00F01E), uint4(0xFC0F80F8, 0xE07E0FC0, 0xFF001F03, 0x80780780),
+	uint4(0x07807807, 0x70070070, 0x00700700, 0xFF406007), uint4(0x1E0F87F0, 0x00000030, 0x80000000, 0x81E01C00),
+	uint4(0xFF803C3F, 0x0C80C10E, 0x8D08E0CC, 0x9E0DC8D8), uint4(0xEC9F89F0, 0xFFC01EE1, 0x00000000, 0x00000000),
+};
+
+#define PARTITION_2_COUNT_3X3X3 628
+#define PARTITION_2_WORDS_3X3X3 2
+static const uint4 partition_2_3x3x3[314] =
+{
+	uint4(0x07FFFE00, 0x00000000, 0x012DB6FE, 0x00400000), uint4(0x0024965B, 0x00800000, 0x06BF5BA5, 0x00C00000),
+	uint4(0x04020100, 0x01000000, 0x0104165F, 0x01400000), uint4(0x00036C00, 0x01800000, 0x01208243, 0x01C00000),
+	uint4(0x0024B6FF, 0x02000000, 0x07FFFDB4, 0x02400000), uint4(0x07004936, 0x02800000, 0x00502814, 0x02C00000),
+	uint4(0x07FBFFFF, 0x03400000, 0x07D2425B, 0x03800000), uint4(0x00FDF1C0, 0x03C00000, 0x07FDB649, 0x04000000),
+	uint4(0x00FC7E3F, 0x04400000, 0x070383C3, 0x04800000), uint4(0x05B5B7B6, 0x04C00000, 0x04040201, 0x05400000),
+	uint4(0x07FFE9A1, 0x05C00000, 0x007FFFDB, 0x06000000), uint4(0x000FF603, 0x06400000, 0x071F8FC7, 0x06800000),
+	uint4(0x02494B6D, 0x06C00000, 0x04924924, 0x07000000), uint4(0x06924120, 0x07400000, 0x06D92400, 0x07C00000),
+	uint4(0x024A4800, 0x08000000, 0x070381C3, 0x08400000), uint4(0x00024000, 0x08800000, 0x00000E38, 0x09000000),
+	uint4(0x00596DBF, 0x09400000, 0x07FC0000, 0x09800000), uint4(0x041C7FFF, 0x09C00000, 0x03FFFFFF, 0x0A000000),
+	uint4(0x0003FE00, 0x0A400000, 0x070FF1FB, 0x0A800000), uint4(0x00984C26, 0x0AC00000, 0x07E76C00, 0x0B000000),
+	uint4(0x002CBE5E, 0x0B400000, 0x07DBEDF6, 0x0BC00000), uint4(0x0606120B, 0x0C400000, 0x06070380, 0x0C800000),
+	uint4(0x036C4800, 0x0CC00000, 0x06DB6DB0, 0x0D400000), uint4(0x03F9FEFD, 0x0D800000, 0x00404001, 0x0DC00000),
+	uint4(0x068A0603, 0x0E000000, 0x00D3E1A7, 0x0E800000), uint4(0x04000208, 0x0EC00000, 0x07E38000, 0x0F000000),
+	uint4(0x0004165B, 0x0F400000, 0x037DF1F8, 0x0F800000), uint4(0x07FDFE70, 0x0FC00000, 0x000C0402, 0x10400000),
+	uint4(0x0123FFFB, 0x10800000, 0x00000124, 0x10C00000), uint4(0x016DB6DF, 0x11000000, 0x000C3EFF, 0x11400000),
+	uint4(0x0040000C, 0x11800000, 0x04936DB6, 0x11C00000), uint4(0x017DFEFF, 0x12000000, 0x07FBFD36, 0x12400000),
+	uint4(0x00041450, 0x12800000, 0x028140A0, 0x12C00000), uint4(0x00FC7C34, 0x13000000, 0x00904824, 0x13400000),
+	uint4(0x071FF1F8, 0x13800000, 0x04824120, 0x13C00000), uint4(0x07038000, 0x14800000, 0x0135B7B6, 0x14C00000),
+	uint4(0x00000049, 0x15000000, 0x037DFFFE, 0x15800000), uint4(0x024FF012, 0x15C00000, 0x012C964B, 0x16000000),
+	uint4(0x00000207, 0x16400000, 0x07E3F1F8, 0x16800000), uint4(0x06DB6DB6, 0x17000000, 0x00E07030, 0x17800000),
+	uint4(0x06C32F95, 0x17C00000, 0x002CBEFF, 0x18000000), uint4(0x017CFE7E, 0x18800000, 0x07FBE9A3, 0x19000000),
+	uint4(0x02D9D8FB, 0x19400000, 0x07FF6DB6, 0x1A000000), uint4(0x0004BEFF, 0x1A400000, 0x0683FFFF, 0x1A800000),
+	uint4(0x0004165F, 0x1AC00000, 0x06AEBEFF, 0x1B000000), uint4(0x002C160B, 0x1B400000, 0x00CB6D25, 0x1B800000),
+	uint4(0x001FFE01, 0x1C000000, 0x07FE4800, 0x1C400000), uint4(0x05916DFF, 0x1C800000, 0x04DADD36, 0x1CC00000),
+	uint4(0x000076C8, 0x1D000000, 0x037F4001, 0x1DC00000), uint4(0x0125373F, 0x1E400000, 0x0120B05C, 0x1E800000),
+	uint4(0x036DB7FF, 0x1EC00000, 0x00FC0E07, 0x1F000000), uint4(0x000C0607, 0x1F400000, 0x00007FFF, 0x1FC00000),
+	uint4(0x0124B6FF, 0x20400000, 0x060D0681, 0x20800000), uint4(0x04960201, 0x20C00000, 0x07E1803F, 0x21000000),
+	uint4(0x047086F7, 0x21800000, 0x05820107, 0x21C00000), uint4(0x07F1B20D, 0x22800000, 0x01B1C482, 0x22C00000),
+	uint4(0x000381FF, 0x23000000, 0x03D3000B, 0x23800000), uint4(0x04936DFF, 0x23C00000, 0x03FDFEA0, 0x24000000),
+	uint4(0x07E0E030, 0x24800000, 0x000CFEFF, 0x24C00000), uint4(0x002CB6DF, 0x25000000, 0x07F7FBF8, 0x25800000),
+	uint4(0x04092DA0, 0x25C00000, 0x04DA4804, 0x26400000), uint4(0x00001600, 0x26C00000, 0x00000004, 0x27000000),
+	uint4(0x02056DB6, 0x27400000, 0x00040202, 0x27800000), uint4(0x062F974B, 0x27C00000, 0x00000E3F, 0x28400000),
+	uint4(0x07FFF000, 0x29000000, 0x000241FF, 0x29800000), uint4(0x001FFDF4, 0x29C00000, 0x002B81AB, 0x2A000000),
+	uint4(0x04820B05, 0x2A400000, 0x00804020, 0x2A800000), uint4(0x07E3F338, 0x2B000000, 0x0383D6E0, 0x2B800000),
+	uint4(0x000C0603, 0x2BC00000, 0x037CB442, 0x2C400000), uint4(0x00FC4E07, 0x2C800000, 0x012C1200, 0x2D000000),
+	uint4(0x04000001, 0x2D400000, 0x001C7E3F, 0x2D800000), uint4(0x036E4892, 0x2DC00000, 0x048000DB, 0x2E000000),
+	uint4(0x00000007, 0x2E800000, 0x07EFFFFF, 0x2F000000), uint4(0x06DA4800, 0x2F400000, 0x071F0E3F, 0x2F800000),
+	uint4(0x07104926, 0x2FC00000, 0x0603E3F4, 0x30800000), uint4(0x00B6DB6D, 0x30C00000, 0x07FFFFF6, 0x31000000),
+	uint4(0x0000013F, 0x31800000, 0x03D5EEF7, 0x31C00000), uint4(0x012DFFFF, 0x32000000, 0x06FFF1C0, 0x32400000),
+	uint4(0x00000038, 0x32800000, 0x036DBFFC, 0x32C00000), uint4(0x0004120B, 0x33000000, 0x06040203, 0x33800000),
+	uint4(0x0400020B, 0x34000000, 0x06DB6D24, 0x34400000), uint4(0x07FF7FBF, 0x34800000, 0x06D00A90, 0x34C00000),
+	uint4(0x07FB4202, 0x35400000, 0x0003FA94, 0x35C00000), uint4(0x00041248, 0x36000000, 0x012CB65F, 0x36400000),
+	uint4(0x024BFE00, 0x36C00000, 0x07C38100, 0x37000000), uint4(0x000416FF, 0x37800000, 0x0100B45F, 0x37C00000),
+	uint4(0x068743A1, 0x38400000, 0x07FBFFE0, 0x38800000), uint4(0x0000104A, 0x38C00000, 0x07F80201, 0x39400000),
+	uint4(0x07870301, 0x39800000, 0x0340AE7D, 0x39C00000), uint4(0x07EFF1F9, 0x3A000000, 0x07E3FE00, 0x3A800000),
+	uint4(0x04894801, 0x3AC00000, 0x06DEB364, 0x3B000000), uint4(0x00000001, 0x3B400000, 0x07000000, 0x3C400000),
+	uint4(0x012DB6FF, 0x3D400000, 0x071C0E07, 0x3D800000), uint4(0x03E7E3F1, 0x3DC00000, 0x06FF7FBF, 0x3E400000),
+	uint4(0x006031DA, 0x3E800000, 0x07E001FF, 0x3EC00000), uint4(0x07E3F1F9, 0x3F000000, 0x0000020C, 0x3F800000),
+	uint4(0x020097F6, 0x3FC00000, 0x0000003F, 0x40000000), uint4(0x016CB7D2, 0x40400000, 0x00FC781F, 0x40800000),
+	uint4(0x04060603, 0x41000000, 0x07E00000, 0x41400000), uint4(0x034FCF36, 0x41800000, 0x06DA4924, 0x41C00000),
+	uint4(0x041E0F07, 0x42000000, 0x01240092, 0x42800000), uint4(0x04920000, 0x42C00000, 0x00E05F83, 0x43800000),
+	uint4(0x012CB65A, 0x43C00000, 0x001C0FC7, 0x44000000), uint4(0x00984804, 0x44400000, 0x07FFFEC8, 0x44C00000),
+	uint4(0x06F379FC, 0x45800000, 0x00FDFEF6, 0x45C00000), uint4(0x07E30000, 0x46000000, 0x049A4D26, 0x46400000),
+	uint4(0x0003FFF4, 0x46C00000, 0x000CBFFE, 0x47000000), uint4(0x07DA4000, 0x47C00000, 0x0159E9B5, 0x48C00000),
+	uint4(0x02FC6E06, 0x49400000, 0x07FDFE01, 0x49800000), uint4(0x002DB6FF, 0x49C00000, 0x03FDFFFF, 0x4A000000),
+	uint4(0x06D364D2, 0x4AC00000, 0x07FA4000, 0x4B000000), uint4(0x07E3FFC7, 0x4B400000, 0x040E0703, 0x4B800000),
+	uint4(0x001C3E3F, 0x4C000000, 0x03FFFFF7, 0x4C400000), uint4(0x07D3E1E0, 0x4C800000, 0x07D9A436, 0x4CC00000),
+	uint4(0x03E1F1F8, 0x4D400000, 0x06E37138, 0x4E800000), uint4(0x0004B8FF, 0x4EC00000, 0x04904804, 0x4F000000),
+	uint4(0x00040201, 0x4F400000, 0x07EE0248, 0x4FC00000), uint4(0x07D1EA0B, 0x50C00000, 0x00783E1F, 0x51000000),
+	uint4(0x06800001, 0x51400000, 0x07F07038, 0x51800000), uint4(0x0526DBA6, 0x51C00000, 0x037FFFFF, 0x52000000),
+	uint4(0x016CB77B, 0x52400000, 0x0400125F, 0x52800000), uint4(0x06DA4900, 0x52C00000, 0x00248092, 0x53C00000),
+	uint4(0x0024B4FE, 0x54400000, 0x017CBE5F, 0x54800000), uint4(0x03594901, 0x54C00000, 0x000016FF, 0x55000000),
+	uint4(0x00001209, 0x55400000, 0x03FFFFC7, 0x55800000), uint4(0x07F302FF, 0x55C00000, 0x07D00000, 0x56000000),
+	uint4(0x03DB69A4, 0x56C00000, 0x07D3534B, 0x57000000), uint4(0x04040200, 0x57800000, 0x07E3E1B2, 0x57C00000),
+	uint4(0x07FBF1CE, 0x58000000, 0x04F1C35E, 0x58800000), uint4(0x0000063F, 0x59000000, 0x0783C1E0, 0x5A400000),
+	uint4(0x000012D2, 0x5A800000, 0x036DB692, 0x5AC00000), uint4(0x00080607, 0x5B400000, 0x07FC1DF4, 0x5B800000),
+	uint4(0x070F87C3, 0x5BC00000, 0x07F9B44B, 0x5C000000), uint4(0x0763FFE7, 0x5C800000, 0x07FEDB24, 0x5CC00000),
+	uint4(0x07D7F001, 0x5D400000, 0x007C7E3F, 0x5D800000), uint4(0x024A4B6D, 0x5DC00000, 0x06860201, 0x5E000000),
+	uint4(0x07C3E1E0, 0x5E800000, 0x036DB1C4, 0x5F000000), uint4(0x00038007, 0x5F800000, 0x07FF4000, 0x60400000),
+	uint4(0x00BFD7E3, 0x60800000, 0x00D87E2D, 0x60C00000), uint4(0x000603A1, 0x61000000, 0x07838FC7, 0x61800000),
+	uint4(0x0125B7B6, 0x62400000, 0x03E1F0C4, 0x62C00000), uint4(0x00900009, 0x63C00000, 0x0527FFA4, 0x64C00000),
+	uint4(0x06CB65B3, 0x65000000, 0x001C0E3F, 0x65800000), uint4(0x06D80000, 0x66000000, 0x07FFFE80, 0x66400000),
+	uint4(0x010C060B, 0x66C00000, 0x01F9E9A0, 0x68800000), uint4(0x057DBEFE, 0x68C00000, 0x0011C183, 0x69800000),
+	uint4(0x00040301, 0x69C00000, 0x07F7FFFE, 0x6A000000), uint4(0x008341A7, 0x6A800000, 0x00000E07, 0x6AC00000),
+	uint4(0x02112CDF, 0x6B400000, 0x07071EF7, 0x6B800000), uint4(0x00EFB6FF, 0x6C000000, 0x00FFFDFE, 0x6C400000),
+	uint4(0x002C0000, 0x6C800000, 0x07FC0007, 0x6CC00000), uint4(0x07FE4807, 0x6D000000, 0x00080402, 0x6D400000),
+	uint4(0x00281400, 0x6E000000, 0x003C0E03, 0x6E400000), uint4(0x04900207, 0x6F400000, 0x0703FFFF, 0x70000000),
+	uint4(0x017FFFFF, 0x70400000, 0x00E00000, 0x70800000), uint4(0x00F0403F, 0x71400000, 0x04900040, 0x71800000),
+	uint4(0x0124964B, 0x71C00000, 0x07FF8002, 0x73400000), uint4(0x049369F6, 0x73800000, 0x04974BB5, 0x73C00000),
+	uint4(0x012DBFFF, 0x74400000, 0x00FC7E38, 0x74800000), uint4(0x00000C07, 0x75800000, 0x07E00121, 0x75C00000),
+	uint4(0x0707860F, 0x76800000, 0x060C0E0F, 0x76C00000), uint4(0x06CA6526, 0x77800000, 0x001F0E04, 0x78800000),
+	uint4(0x0103F7FF, 0x78C00000, 0x048001A0, 0x79000000), uint4(0x000071C0, 0x79400000, 0x06EBACB6, 0x79C00000),
+	uint4(0x07E3CF07, 0x7A000000, 0x007DFFFF, 0x7A400000), uint4(0x040703C1, 0x7A800000, 0x03008203, 0x7BC00000),
+	uint4(0x0004160F, 0x7C000000, 0x0704961F, 0x7C800000), uint4(0x012592D9, 0x7CC00000, 0x015DCFC6, 0x7D000000),
+	uint4(0x07FF7FB6, 0x7D400000, 0x07FFF1C1, 0x7E000000), uint4(0x00B5B7FB, 0x7E400000, 0x07DFEFF7, 0x7E800000),
+	uint4(0x0703F007, 0x7EC00000, 0x03C30101, 0x7F000000), uint4(0x07E76120, 0x7F800000, 0x00000201, 0x7FC00000),
+	uint4(0x032190C8, 0x80000000, 0x00FFFE0B, 0x80400000), uint4(0x0121B3FB, 0x80C00000, 0x06820003, 0x81400000),
+	uint4(0x07030E3F, 0x81800000, 0x037B2921, 0x81C00000), uint4(0x07FC7E0F, 0x82400000, 0x021E0F23, 0x82C00000),
+	uint4(0x028341A1, 0x83000000, 0x07E74AC1, 0x83800000), uint4(0x03240C3E, 0x83C00000, 0x00FFFFB6, 0x84400000),
+	uint4(0x07038FC7, 0x84800000, 0x06824100, 0x84C00000), uint4(0x04DA6D36, 0x85400000, 0x03FDFFC1, 0x86C00000),
+	uint4(0x03640000, 0x87000000, 0x04900000, 0x87400000), uint4(0x07F3F1F8, 0x87800000, 0x03FDC8FF, 0x87C00000),
+	uint4(0x001C7038, 0x88000000, 0x06E27030, 0x88800000), uint4(0x025928A5, 0x88C00000, 0x04FC4E06, 0x89400000),
+	uint4(0x070F8603, 0x89800000, 0x00001002, 0x89C00000), uint4(0x06E38000, 0x8A400000, 0x000006C0, 0x8A800000),
+	uint4(0x01F9FDF5, 0x8B800000, 0x00F87C3C, 0x8CC00000), uint4(0x04984800, 0x8DC00000, 0x02810000, 0x8E000000),
+	uint4(0x00FC7C38, 0x8E400000, 0x07FC0124, 0x8EC00000), uint4(0x06FE6E26, 0x8F000000, 0x011C8E47, 0x90800000),
+	uint4(0x06920000, 0x91000000, 0x036DB6DF, 0x91C00000), uint4(0x016CB65B, 0x92000000, 0x03FDBE5B, 0x92400000),
+	uint4(0x0404B5FE, 0x92800000, 0x06412085, 0x92C00000), uint4(0x01249200, 0x93400000, 0x07FBE9F4, 0x93800000),
+	uint4(0x068F47A3, 0x93C00000, 0x07FF7E26, 0x94400000), uint4(0x0783C1C0, 0x94800000, 0x07B7DBED, 0x94C00000),
+	uint4(0x007BF9F0, 0x95000000, 0x04120100, 0x95400000), uint4(0x001EBF4B, 0x95800000, 0x00100804, 0x95C00000),
+	uint4(0x07E3F1B0, 0x96000000, 0x07F3F3F9, 0x96800000), uint4(0x02FFFFFF, 0x97400000, 0x06D37A10, 0x97C00000),
+	uint4(0x0703BE38, 0x98000000, 0x06820000, 0x98400000), uint4(0x04800238, 0x98800000, 0x00F0F8FD, 0x99800000),
+	uint4(0x00504101, 0x99C00000, 0x0505A4D6, 0x9AC00000), uint4(0x00F87C3E, 0x9B400000, 0x0013C300, 0x9B800000),
+	uint4(0x01348292, 0x9CC00000, 0x0373F1F8, 0x9D000000), uint4(0x00904B21, 0x9DC00000, 0x061B2D25, 0x9E400000),
+	uint4(0x00FCFFFF, 0x9E800000, 0x001C7E3E, 0x9F800000), uint4(0x0258124B, 0x9FC00000, 0x06A6D349, 0xA0C00000),
+	uint4(0x00F8783C, 0xA1400000, 0x07FB8E07, 0xA1800000), uint4(0x07FDFE9F, 0xA1C00000, 0x07FFFEFE, 0xA2400000),
+	uint4(0x06000003, 0xA2C00000, 0x04075614, 0xA3000000), uint4(0x07FF8004, 0xA3800000, 0x012C976F, 0xA3C00000),
+	uint4(0x07FF6D24, 0xA4400000, 0x04D271B8, 0xA4800000), uint4(0x05B6DA00, 0xA4C00000, 0x071F9FCF, 0xA5800000),
+	uint4(0x07DB69A1, 0xA5C00000, 0x040697DF, 0xA6000000), uint4(0x07D9A440, 0xA6400000, 0x0005AD20, 0xA6800000),
+	uint4(0x07FC7E3F, 0xA6C00000, 0x07800000, 0xA7400000), uint4(0x07038E3F, 0xA7800000, 0x0683461F, 0xA8000000),
+	uint4(0x0050BE5F, 0xA8400000, 0x06830F3F, 0xA8800000), uint4(0x033EDB2D, 0xAAC00000, 0x07FF7FB7, 0xAB000000),
+	uint4(0x07FC0001, 0xAB400000, 0x001A0FE7, 0xAB800000), uint4(0x0000060F, 0xABC00000, 0x05FDFEFF, 0xAC000000),
+	uint4(0x0703F1FF, 0xAC400000, 0x06DB69A6, 0xAC800000), uint4(0x01240000, 0xACC00000, 0x07FFFDF6, 0xAD400000),
+	uint4(0x000001C7, 0xAD800000, 0x05B6D249, 0xADC00000), uint4(0x040C77D9, 0xAE000000, 0x07FF7F3F, 0xAE400000),
+	uint4(0x02000000, 0xAE800000, 0x000097FF, 0xAEC00000), uint4(0x01008001, 0xAF000000, 0x009C0C00, 0xAF400000),
+	uint4(0x00180020, 0xAF800000, 0x03F9E8F0, 0xAFC00000), uint4(0x0170A874, 0xB0400000, 0x06DF6DB6, 0xB0C00000),
+	uint4(0x00FFFDFC, 0xB1C00000, 0x07DBFFFF, 0xB2000000), uint4(0x0766FEDF, 0xB2400000, 0x07004FC0, 0xB2800000),
+	uint4(0x06D368A4, 0xB3000000, 0x07FC9200, 0xB3800000), uint4(0x06D74B25, 0xB3C00000, 0x040E0707, 0xB4000000),
+	uint4(0x07EFB3D9, 0xB4400000, 0x011FFFFF, 0xB4800000), uint4(0x0300025B, 0xB4C00000, 0x048E0739, 0xB5000000),
+	uint4(0x01FCFE7F, 0xB5800000, 0x01292901, 0xB5C00000), uint4(0x000C0000, 0xB6400000, 0x04020192, 0xB6C00000),
+	uint4(0x0787C3E1, 0xB7000000, 0x01008E47, 0xB8000000), uint4(0x001C0200, 0xB8800000, 0x00EDB6DB, 0xB8C00000),
+	uint4(0x07FFFE49, 0xB9400000, 0x00009CD9, 0xB9800000), uint4(0x07FE0000, 0xB9C00000, 0x000381C7, 0xBA800000),
+	uint4(0x07E38E3F, 0xBB800000, 0x00042520, 0xBBC00000), uint4(0x017CBE5E, 0xBC400000, 0x00DE7138, 0xBC800000),
+	uint4(0x07F3F3FB, 0xBD000000, 0x04040000, 0xBD400000), uint4(0x05B7B609, 0xBEC00000, 0x06DB2EBE, 0xBF000000),
+	uint4(0x00E071FB, 0xBF800000, 0x0179FC01, 0xBFC00000), uint4(0x00FFF1C0, 0xC0400000, 0x01660107, 0xC0800000),
+	uint4(0x0000061F, 0xC1000000, 0x068200FF, 0xC1800000), uint4(0x02492400, 0xC1C00000, 0x01F4FA7D, 0xC2800000),
+	uint4(0x000201A1, 0xC3000000, 0x076FFFFF, 0xC3400000), uint4(0x000C7FF8, 0xC4800000, 0x04AF740B, 0xC5000000),
+	uint4(0x06970BAC, 0xC5400000, 0x03FDFCFE, 0xC5C00000), uint4(0x001C0000, 0xC6800000, 0x0491B7B6, 0xC6C00000),
+	uint4(0x07030203, 0xC7000000, 0x003C1E0F, 0xC7800000), uint4(0x06D892DB, 0xC7C00000, 0x01039F96, 0xC8800000),
+	uint4(0x00E38007, 0xC9800000, 0x00D87CBF, 0xC9C00000), uint4(0x07FFFF00, 0xCA800000, 0x0426120A, 0xCAC00000),
+	uint4(0x03488E7F, 0xCB000000, 0x0401BFFF, 0xCB800000), uint4(0x06DB6C92, 0xCC400000, 0x001C1E0F, 0xCC800000),
+	uint4(0x02492412, 0xCCC00000, 0x0494B7FF, 0xCD000000), uint4(0x06864301, 0xCD400000, 0x07FFFFFC, 0xCD800000),
+	uint4(0x034ADADB, 0xCDC00000, 0x00EC6E2F, 0xCE800000), uint4(0x04FF7FBF, 0xCF000000, 0x07FF6F21, 0xCFC00000),
+	uint4(0x02480000, 0xD0000000, 0x07FFEE20, 0xD0800000), uint4(0x07D369A4, 0xD0C00000, 0x0000060B, 0xD1000000),
+	uint4(0x0001B600, 0xD1800000, 0x078FC7E3, 0xD1C00000), uint4(0x07EF8001, 0xD2000000, 0x036FFFB6, 0xD2400000),
+	uint4(0x00039C3B, 0xD2800000, 0x02552A95, 0xD3C00000), uint4(0x06040209, 0xD4400000, 0x049001B6, 0xD4C00000),
+	uint4(0x00582C16, 0xD5000000, 0x001FFFC0, 0xD5400000), uint4(0x04061EFF, 0xD5800000, 0x03FC48FF, 0xD6C00000),
+	uint4(0x077B9DCE, 0xD7400000, 0x00E07000, 0xD7800000), uint4(0x00038000, 0xD7C00000, 0x07FBF5DE, 0xD9000000),
+	uint4(0x03FC0107, 0xD9800000, 0x04900092, 0xD9C00000), uint4(0x04FEBF01, 0xDA800000, 0x0170F8FC, 0xDB400000),
+	uint4(0x03FFF00B, 0xDB800000, 0x07000800, 0xDBC00000), uint4(0x07F3E1E0, 0xDC400000, 0x04DF7FC0, 0xDCC00000),
+	uint4(0x0319CCF7, 0xDD800000, 0x00007FED, 0xDDC00000), uint4(0x049017FD, 0xDEC00000, 0x04924923, 0xDF400000),
+	uint4(0x07FFF7DB, 0xDFC00000, 0x029040FF, 0xE0400000), uint4(0x01A67C30, 0xE0800000, 0x068002FF, 0xE1400000),
+	uint4(0x07FBC30F, 0xE1800000, 0x07DBEFF7, 0xE1C00000), uint4(0x07830103, 0xE2800000, 0x07636E03, 0xE3400000),
+	uint4(0x02492493, 0xE3C00000, 0x00E20000, 0xE4000000), uint4(0x07CFE7A3, 0xE4800000, 0x0000125B, 0xE5000000),
+	uint4(0x00024800, 0xE5800000, 0x0010DB7C, 0xE5C00000), uint4(0x02820100, 0xE7000000, 0x016C9649, 0xE7C00000),
+	uint4(0x00200047, 0xE8800000, 0x00FC7EB6, 0xE9800000), uint4(0x07D20000, 0xE9C00000, 0x040C0201, 0xEA000000),
+	uint4(0x07DFFFFF, 0xEA400000, 0x00E0F0F9, 0xEA800000), uint4(0x04B40000, 0xEB000000, 0x00E3F1E0, 0xEB800000),
+	uint4(0x077840A1, 0xEBC00000, 0x06DA5808, 0xEC400000), uint4(0x07B57FA4, 0xECC00000, 0x06E3163F, 0xED000000),
+	uint4(0x07FBE1E0, 0xED400000, 0x06F77BBD, 0xEDC00000), uint4(0x07FBFDF6, 0xEE800000, 0x0024160B, 0xEEC00000),
+	uint4(0x016DB6FF, 0xEF000000, 0x07D5E8F4, 0xEF800000), uint4(0x024249BF, 0xEFC00000, 0x03FC0200, 0xF0000000),
+	uint4(0x003C203F, 0xF0800000, 0x00F47A3D, 0xF0C00000), uint4(0x00F869E0, 0xF1000000, 0x05068341, 0xF1800000),
+	uint4(0x04020101, 0xF2000000, 0x01363E0B, 0xF2800000), uint4(0x0249FB6D, 0xF2C00000, 0x0327F7FF, 0xF3000000),
+	uint4(0x0003FE38, 0xF3800000, 0x069193FB, 0xF3C00000), uint4(0x017DF9E0, 0xF4000000, 0x07640000, 0xF4400000),
+	uint4(0x07D80000, 0xF5800000, 0x07FFF7CF, 0xF5C00000), uint4(0x07FFFFBF, 0xF6800000, 0x049393B9, 0xF6C00000),
+	uint4(0x07D1E8F4, 0xF7000000, 0x00000C37, 0xF8400000), uint4(0x036BCE30, 0xF8800000, 0x05A38402, 0xF8C00000),
+	uint4(0x0080C0E1, 0xF9800000, 0x04908048, 0xF9C00000), uint4(0x01000000, 0xFA800000, 0x07E3E1E0, 0xFB800000),
+	uint4(0x06D11ADB, 0xFBC00000, 0x07C3E200, 0xFC000000), uint4(0x07E3F1F1, 0xFC400000, 0x00980800, 0xFC800000),
+	uint4(0x0707C3F1, 0xFD400000, 0x014812F6, 0xFDC00000), uint4(0x07D88A94, 0xFEC00000, 0x00909212, 0xFFC00000),
+};
+
+#define PARTITION_2_COUNT_4X4X4 625
+#define PARTITION_2_WORDS_4X4X4 3
+static const uint4 partition_2_4x4x4[469] =
+{
+	uint4(0x00000000, 0xFFFFFFFF, 0x00000000, 0xFFFFFFFE), uint4(0x377F77FF, 0x00400000, 0x377F77FF, 0x13373377),
+	uint4(0x00800000, 0xC893C893, 0xC9B7C993, 0x00C00000), uint4(0x337F77FF, 0x00131137, 0x01400000, 0xFFFF0000),
+	uint4(0x0000CCCC, 0x01800000, 0x10031017, 0x11011001), uint4(0x01C00000, 0xFFFFFFFF, 0x337777FF, 0x02000000),
+	uint4(0xFECCCC80, 0xFFFFFFFE, 0x02400000, 0x888CCCCE), uint4(0x00000008, 0x02800000, 0x4C804C80, 0x4C804C80),
+	uint4(0x02C00000, 0x0137377F, 0xC8808001, 0x03800000), uint4(0xFC00E000, 0xFFF8FFC0, 0x03C00000, 0x33331111),
+	uint4(0xFFFF7777, 0x04000000, 0x7FFF7FFF, 0x7FFF7FFF), uint4(0x04400000, 0x00030007, 0x00000001, 0x04800000),
+	uint4(0xFFFFCCCC, 0x33337777, 0x04C00000, 0x00010001), uint4(0x00110001, 0x05400000, 0x8888FFFF, 0x00000000),
+	uint4(0x05800000, 0xE8008011, 0xFFFCFEC8, 0x05C00000), uint4(0xEEE60007, 0x0007FF07, 0x06400000, 0x000F000F),
+	uint4(0x000F000F, 0x06800000, 0x99111333, 0xCCCCC889), uint4(0x06C00000, 0x80000000, 0x88008000, 0x07400000),
+	uint4(0x66662222, 0xEEEEEEEE, 0x07C00000, 0x00000000), uint4(0x88880000, 0x08000000, 0xE000C007, 0xF000F000),
+	uint4(0x08400000, 0x00000000, 0x77640000, 0x08800000), uint4(0x00F00FF0, 0x000F00FF, 0x09000000, 0xEEFFEFFF),
+	uint4(0xCCEEEEEE, 0x09400000, 0x00000000, 0xFFFF0000), uint4(0x09800000, 0xFFFFFFFF, 0x00FF0FFF, 0x09C00000),
+	uint4(0x00000000, 0x08CEFFFF, 0x0A400000, 0xFFF7FF07), uint4(0xFE07FFF0, 0x0A800000, 0x08CE08CE, 0x08CE08CE),
+	uint4(0x0AC00000, 0x00000000, 0xFF1F4CCC, 0x0B000000), uint4(0x37FF7FEE, 0x137F37FF, 0x0B400000, 0xF0FFF0FF),
+	uint4(0x00FFF0FF, 0x0B800000, 0xDCCCDCCC, 0xDCCCDCCC), uint4(0x0BC00000, 0x01331137, 0x00130113, 0x0C400000),
+	uint4(0x80018000, 0x80018001, 0x0C800000, 0x00000000), uint4(0xCCCC8888, 0x0CC00000, 0xEEEFEEE0, 0xEEEEEEEE),
+	uint4(0x0D400000, 0xFFEDFFE9, 0xFFFCFFFD, 0x0D800000), uint4(0x00000001, 0x08000000, 0x0DC00000, 0x003F003F),
+	uint4(0x803F003F, 0x0E000000, 0xE800C80F, 0xEC80EC00), uint4(0x0E800000, 0x00100100, 0x00000001, 0x0EC00000),
+	uint4(0x00000000, 0xF000F000, 0x0F000000, 0x1377377F), uint4(0x01131137, 0x0F400000, 0xFFF0FFF0, 0xFFFFFFF0),
+	uint4(0x0F800000, 0xFFE8EC00, 0xFFFFFFFF, 0x0FC00000), uint4(0x00160014, 0x00170016, 0x10400000, 0xFFFFFFFF),
+	uint4(0x0FFFFFFF, 0x10800000, 0x00008888, 0x00000000), uint4(0x10C00000, 0x7FFFFFFF, 0x777F77FF, 0x11000000),
+	uint4(0x7FFFFFFF, 0x037F37FF, 0x11400000, 0x000303E8), uint4(0x00000000, 0x11800000, 0xEEEEEEEE, 0x8898CCDC),
+	uint4(0x11C00000, 0xEFFC8EFC, 0xFFFCFFFC, 0x12400000), uint4(0x12482480, 0x00120124, 0x12800000, 0xFEECECC8),
+	uint4(0xFFFFFFFE, 0x13000000, 0x00080008, 0x00080008), uint4(0x13400000, 0xFFF0FF00, 0x0FFFFFF0, 0x13800000),
+	uint4(0x08880888, 0x08880888, 0x13C00000, 0xEEFFEEEE), uint4(0x33337777, 0x14C00000, 0x00001111, 0x00000000),
+	uint4(0x15000000, 0xFFFFFFEE, 0xFFFFFFFF, 0x15800000), uint4(0x00000444, 0x77777770, 0x15C00000, 0x33773377),
+	uint4(0x33773377, 0x16000000, 0x000F001F, 0x00000001), uint4(0x16400000, 0xEEEEEEEE, 0xEEEEEEEE, 0x17000000),
+	uint4(0x0FF00EF0, 0xCFF08FF0, 0x17800000, 0xCC0BC4B9), uint4(0xCC80CC0F, 0x17C00000, 0xFFFFFFFF, 0x37FF7FFF),
+	uint4(0x18000000, 0xFFFEFFEC, 0x7FFF7FFF, 0x18800000), uint4(0xCCCCCCCC, 0xCCCCCCCC, 0x18C00000, 0xEC80C807),
+	uint4(0xFFECFEC8, 0x19000000, 0xF731FFF7, 0x98887310), uint4(0x19400000, 0x88888888, 0x88888888, 0x19C00000),
+	uint4(0xEEEECCCC, 0xFFFFEEEE, 0x1A000000, 0x7FFFFFFF), uint4(0x137F37FF, 0x1A400000, 0xFFFFFFFF, 0xFFECFFFF),
+	uint4(0x1A800000, 0x37FF37FF, 0x0137137F, 0x1AC00000), uint4(0x11371137, 0x11371137, 0x1B400000, 0x88890003),
+	uint4(0xEEEECCCC, 0x1B800000, 0xFFFF0013, 0xFFFFFFFF), uint4(0x1C000000, 0x00000000, 0xCCCC0000, 0x1C400000),
+	uint4(0xFFFFFFFF, 0xCCCCEEEE, 0x1C800000, 0x3A8C2C8C), uint4(0x88DD99CE, 0x1CC00000, 0xF7317310, 0x00FFFFF7),
+	uint4(0x1D000000, 0x00010013, 0xFFFF8800, 0x1DC00000), uint4(0x00FF00FF, 0x00FF00FF, 0x1E000000, 0x3FFF7FFF),
+	uint4(0x47779FFF, 0x1E400000, 0x77F077F0, 0x37703770), uint4(0x1E800000, 0x00FF00FF, 0x0FFF00FF, 0x1F000000),
+	uint4(0x003F007F, 0x001F003F, 0x1F400000, 0x7FFFFFFF), uint4(0x3337777F, 0x20400000, 0x00030003, 0x001F0017),
+	uint4(0x20800000, 0x00130013, 0x00130013, 0x20C00000), uint4(0x000F0FFF, 0xF1000000, 0x21000000, 0x768FFC0F),
+	uint4(0x00C112B7, 0x21800000, 0x888F880F, 0x88808880), uint4(0x21C00000, 0x00000000, 0xC8808000, 0x22400000),
+	uint4(0x330B0159, 0xFFC8774B, 0x22800000, 0x404E08CE), uint4(0x3A827846, 0x22C00000, 0xFFF0FFFF, 0x0000F000),
+	uint4(0x23000000, 0x00030137, 0xE8008000, 0x23800000), uint4(0xEEFFFFFF, 0x88CCCCEE, 0x23C00000, 0xFFFFC000),
+	uint4(0xFFFFFFFF, 0x24000000, 0xFE00FC00, 0xFE00FE00), uint4(0x24800000, 0xFFFFFFFF, 0x03FFFFFF, 0x24C00000),
+	uint4(0x77FF7FFF, 0x1377377F, 0x25000000, 0xFFF0FFF0), uint4(0xFFFBFFFB, 0x25800000, 0xEFFCC222, 0x666EEEEE),
+	uint4(0x25C00000, 0x00080000, 0x88CC0888, 0x26400000), uint4(0xCCCC0000, 0x0000137F, 0x26C00000, 0xEEEEEEEE),
+	uint4(0x37EEEEEE, 0x27400000, 0x0017001E, 0x00010003), uint4(0x27800000, 0x03FF7FFF, 0x0000001F, 0x28400000),
+	uint4(0x00000000, 0xFFFFFF00, 0x29000000, 0xCCC8FFFF), uint4(0x00000000, 0x29800000, 0xFEC8FEC8, 0xFFEDFFEC),
+	uint4(0x29C00000, 0xDDB79937, 0x1124F000, 0x2A000000), uint4(0x880B80B9, 0x8880880B, 0x2A400000, 0x28002800),
+	uint4(0x28002800, 0x2A800000, 0x003F003F, 0x003F003F), uint4(0x2AC00000, 0xEC081700, 0xFFF0FFF1, 0x2B000000),
+	uint4(0xC801C800, 0x00FFC937, 0x2B800000, 0x33661224), uint4(0x77FE376E, 0x2C400000, 0x00FF00EF, 0x0EFF00FF),
+	uint4(0x2C800000, 0x00010000, 0x11330111, 0x2D000000), uint4(0x00000001, 0x00000000, 0x2D400000, 0x0FFF0FFF),
+	uint4(0x00FF0FFF, 0x2D800000, 0xC888ECCC, 0x77778088), uint4(0x2DC00000, 0x3333FFFF, 0x00000000, 0x2E000000),
+	uint4(0x000F00FF, 0x00000000, 0x2E800000, 0x00200000), uint4(0x02200020, 0x2EC00000, 0x0FFF0FFF, 0x00FF00FF),
+	uint4(0x2F800000, 0x088C88CC, 0x00000008, 0x2FC00000), uint4(0xFFC3FEC8, 0xC000FC01, 0x30800000, 0x99999999),
+	uint4(0xBBBBBB99, 0x30C00000, 0xFFFFFEEE, 0xFFFFFFFF), uint4(0x31000000, 0x0000EFFF, 0x00000000, 0x31800000),
+	uint4(0xFECDFECD, 0xEECDEECD, 0x31C00000, 0xFFFFFFFF), uint4(0x7FFFFFFF, 0x32000000, 0xF0000000, 0xFFFFFF00),
+	uint4(0x32400000, 0x00000F00, 0x00000000, 0x32800000), uint4(0xFFFFFFFF, 0x00FFFFFF, 0x33400000, 0x0007000F),
+	uint4(0x00030003, 0x33800000, 0x0FFFFFFF, 0x000F00FF), uint4(0x33C00000, 0x01131137, 0x00010011, 0x34000000),
+	uint4(0x88888888, 0xCCCCCCCC, 0x34400000, 0xEFFFEFFF), uint4(0xFFFFFFFF, 0x34800000, 0x6441ECC8, 0x7DD920FB),
+	uint4(0x34C00000, 0xFFFF0000, 0xFFFFFFFF, 0x35000000), uint4(0x00130016, 0xFEC8C801, 0x35400000, 0xFF80FF80),
+	uint4(0xFF80FF80, 0x35800000, 0xCCD9CCC8, 0xFFFBDDD9), uint4(0x35C00000, 0x11131122, 0x00110111, 0x36000000),
+	uint4(0x37FF37FF, 0x337F377F, 0x36400000, 0xF800F800), uint4(0xF800F800, 0x36800000, 0xEEEE0000, 0xEEEEFFFF),
+	uint4(0x36C00000, 0x00000000, 0xF000C000, 0x37000000), uint4(0x37FFFFFF, 0x00131377, 0x37800000, 0x37FF77FF),
+	uint4(0x376C37FE, 0x37C00000, 0x80038003, 0x80038003), uint4(0x38400000, 0x0000C800, 0xFFFFFFFF, 0x38800000),
+	uint4(0x13263366, 0x01021122, 0x38C00000, 0x00110013), uint4(0x00000001, 0x39400000, 0x00010001, 0x80010001),
+	uint4(0x39800000, 0x20B30FB3, 0x640724F7, 0x39C00000), uint4(0xFFF0FF31, 0xFFF1FFF0, 0x3A000000, 0xFF000000),
+	uint4(0xFF0FFF0F, 0x3A800000, 0x80010011, 0x00888008), uint4(0x3AC00000, 0xB9880000, 0xDDF7B731, 0x3B000000),
+	uint4(0x00000003, 0x00000000, 0x3B400000, 0xCCCCCCCC), uint4(0xEEEEEEEE, 0x3B800000, 0xFF73FF73, 0xFF73FF73),
+	uint4(0x3C000000, 0x00000000, 0xEEEE0000, 0x3CC00000), uint4(0x00000000, 0x88888888, 0x3D000000, 0xFFFFFFFF),
+	uint4(0x377777FF, 0x3D400000, 0xEC11EC01, 0xEC13EC13), uint4(0x3DC00000, 0xFF30FF36, 0xFF30FF30, 0x3E800000),
+	uint4(0xFF00FF01, 0xFF10FF00, 0x3F000000, 0x003E01E0), uint4(0x00000003, 0x3F800000, 0xDDDCDCCC, 0x01113155),
+	uint4(0x3FC00000, 0x00000FFF, 0x00000000, 0x40000000), uint4(0x266E044C, 0x377F377F, 0x40400000, 0xFC01B7FF),
+	uint4(0xFFFFFFE8, 0x40800000, 0x0037003F, 0x00170017), uint4(0x41000000, 0x08FF0CFE, 0xF0EF80FF, 0x41800000),
+	uint4(0x88880000, 0x88888888, 0x41C00000, 0x00FF00FF), uint4(0x000F000F, 0x42400000, 0x66666666, 0x22222222),
+	uint4(0x42800000, 0xC07F001F, 0x160F1BFF, 0x43800000), uint4(0x37777776, 0x33773777, 0x43C00000, 0x00080008),
+	uint4(0x008C0088, 0x44400000, 0xFFF77310, 0xFFFFFFFF), uint4(0x44C00000, 0xFFE0FFE0, 0xFFF8FFE0, 0x45800000),
+	uint4(0xFFFEFEEC, 0xFFFFFFFF, 0x45C00000, 0x00000000), uint4(0xE0000000, 0x46000000, 0x888C888C, 0x888C888C),
+	uint4(0x46400000, 0xFFFFFEC8, 0x0000FFFF, 0x46C00000), uint4(0xFFFFFFFE, 0x13FF7FFF, 0x47000000, 0x00000000),
+	uint4(0xCC888000, 0x47C00000, 0xECC8ECC9, 0xEECCEEC8), uint4(0x48C00000, 0x00CF000C, 0xCFFF0CFF, 0x49400000),
+	uint4(0x37FF0001, 0xFFFFFFFF, 0x49800000, 0x7FFF7FFF), uint4(0x37FF37FF, 0x49C00000, 0x000F001F, 0x000F000F),
+	uint4(0x4A800000, 0x66446666, 0x88004444, 0x4AC00000), uint4(0x00000000, 0xEC888000, 0x4B000000, 0xF00F00FF),
+	uint4(0xFFFFFF0F, 0x4B400000, 0x001F001F, 0x001F001F), uint4(0x4B800000, 0x000E000C, 0x008F000F, 0x4BC00000),
+	uint4(0x1FFF7FFF, 0x01FF07FF, 0x4C000000, 0xFFFEFEED), uint4(0xFFFFFFFF, 0x4C400000, 0xE800C000, 0xFE80FC00),
+	uint4(0x4C800000, 0x300DFEEC, 0xFEEC7664, 0x4CC00000), uint4(0xEF00EF00, 0xFFF0FF00, 0x4E800000, 0x7FFFFFFF),
+	uint4(0xC13737E0, 0x4EC00000, 0x00000000, 0x00080000), uint4(0x4F000000, 0x00010001, 0x00030001, 0x4F400000),
+	uint4(0x11113332, 0xFFFF0001, 0x4FC00000, 0x649B113F), uint4(0xEC88EC89, 0x50C00000, 0x17FF17FF, 0x17FF17FF),
+	uint4(0x51000000, 0x00010013, 0x00000000, 0x51400000), uint4(0x1FF00FF0, 0xFFF0FFF0, 0x51800000, 0xAA88888C),
+	uint4(0x3333BBB3, 0x51C00000, 0x377F377F, 0x377F377F), uint4(0x52400000, 0x137737FF, 0x00010113, 0x52800000),
+	uint4(0x0000000F, 0x00000000, 0x53400000, 0x2644444C), uint4(0x11133222, 0x53C00000, 0x7FFEFFFE, 0x13323776),
+	uint4(0x54400000, 0x77FF77FF, 0x77FF77FF, 0x54800000), uint4(0x80010011, 0xECC8C880, 0x54C00000, 0x37FFFFFF),
+	uint4(0x00010137, 0x55000000, 0x01331133, 0x01120113), uint4(0x55400000, 0x0CFF00FF, 0x0FFF0FFF, 0x55800000),
+	uint4(0x13FFFFFF, 0xE8008001, 0x55C00000, 0xCC88C880), uint4(0xEECCECC8, 0x56C00000, 0x91333377, 0xC8018113),
+	uint4(0x57000000, 0x00030003, 0x00030003, 0x57400000), uint4(0x00000000, 0x00010001, 0x57800000, 0xEE70CC74),
+	uint4(0xFF71FE60, 0x57C00000, 0xF71E71FE, 0xFFF6FF70), uint4(0x58000000, 0x913737FC, 0xFE80E813, 0x58800000),
+	uint4(0x01FF7FFF, 0x00000007, 0x59000000, 0xEEEEEEEE), uint4(0xFFFFEEEE, 0x59C00000, 0x3333666E, 0x00001111),
+	uint4(0x5A800000, 0xEEEECCCC, 0xFFFFFFFF, 0x5AC00000), uint4(0xFFC8FE80, 0x7FFE01EC, 0x5B800000, 0xF007F007),
+	uint4(0xF007F007, 0x5BC00000, 0x77323117, 0xFFFEFF76), uint4(0x5C000000, 0xFFCFF80F, 0xFF30FFFD, 0x5C800000),
+	uint4(0x11110000, 0x33333333, 0x5CC00000, 0xF0020003), uint4(0xFFEBFF00, 0x5D400000, 0x7FFFFFFF, 0x0FFF1FFF),
+	uint4(0x5D800000, 0x99993333, 0xCCCC8889, 0x5DC00000), uint4(0x00130013, 0x80010001, 0x5E000000, 0xFC00E800),
+	uint4(0xFC00FC00, 0x5E800000, 0xFF00F008, 0xFFFFFFF0), uint4(0x5F000000, 0x000F000F, 0x00000000, 0x5F800000),
+	uint4(0x00000000, 0xFFFFC800, 0x60400000, 0xE03FC037), uint4(0xE97FE93F, 0x60800000, 0xFFD9BBB9, 0xFDCCDDDD),
+	uint4(0x60C00000, 0x0001C801, 0x00010001, 0x61000000), uint4(0x000F007F, 0xF007C00F, 0x61800000, 0x00000000),
+	uint4(0x00010000, 0x61C00000, 0x0FE80FE8, 0x0FE80FE8), uint4(0x62000000, 0xFFFFECCC, 0x337777FF, 0x62400000),
+	uint4(0xFF00F000, 0xFFF0FF00, 0x62C00000, 0x00010111), uint4(0x00000000, 0x63C00000, 0x0008000F, 0x00000000),
+	uint4(0x64800000, 0xFFFFC880, 0xFFFFFFFF, 0x64C00000), uint4(0xCCC4CCC5, 0xEEEECCC4, 0x65000000, 0x00110013),
+	uint4(0x00010001, 0x65400000, 0x00FF0FFF, 0x00FF00FF), uint4(0x65800000, 0x11331133, 0x01130133, 0x65C00000),
+	uint4(0x00000000, 0xDFF7FF7F, 0x66400000, 0x003F013F), uint4(0x00170037, 0x66C00000, 0x137F137F, 0x137F137F),
+	uint4(0x67C00000, 0xE8008000, 0xFFC8FC80, 0x68800000), uint4(0xFFFEFFFE, 0x7FFF7FFF, 0x68C00000, 0xC0018017),
+	uint4(0x7C80E800, 0x69800000, 0xFFFFFFFE, 0xFFFDFFFD), uint4(0x6A000000, 0x0FFF0FFF, 0x0FFF0FFF, 0x6A400000),
+	uint4(0xC803C83F, 0xC800C800, 0x6A800000, 0x000F00FF), uint4(0x0000000F, 0x6AC00000, 0xFEEEFFFF, 0xCCC8EECC),
+	uint4(0x6B400000, 0x6FFF8EFF, 0x003F03FF, 0x6B800000), uint4(0xFFFFFFFF, 0x777F7FFF, 0x6C000000, 0xFFEEFFEE),
+	uint4(0xFFFFFFFE, 0x6C400000, 0x000F00FF, 0xFFFF0000), uint4(0x6CC00000, 0x000F000F, 0xFFFF8888, 0x6D000000),
+	uint4(0x002C002C, 0x002C002C, 0x6D400000, 0x13681248), uint4(0x037C136C, 0x6E000000, 0x003F001F, 0x01FF007F),
+	uint4(0x6E400000, 0xFFFFFFFF, 0xC800FFFF, 0x6EC00000), uint4(0x001F007F, 0x00010003, 0x6F400000, 0x00FF00FF),
+	uint4(0x00F300FF, 0x6F800000, 0xFFFFFFFF, 0xFF00FFFF), uint4(0x70000000, 0x00F00000, 0x00F000F0, 0x70800000),
+	uint4(0x7FFF7FFF, 0x7E804000, 0x71400000, 0x33373377), uint4(0x13371337, 0x71C00000, 0xFFC8FFC8, 0xFFC8FFC8),
+	uint4(0x72800000, 0x00010016, 0xFFFFF000, 0x73400000), uint4(0xEECCFEEE, 0x8888CCC8, 0x73800000, 0xCC99CCD9),
+	uint4(0x88918899, 0x73C00000, 0x0FFF0FF0, 0x0FFF0FFF), uint4(0x74800000, 0x000F00CF, 0x0000000E, 0x75800000),
+	uint4(0x00008003, 0x00000000, 0x75C00000, 0x017F03FF), uint4(0x0017003F, 0x76800000, 0x00FF01FF, 0x007F00FF),
+	uint4(0x76C00000, 0xF773F773, 0xF773F773, 0x77000000), uint4(0x88FC88BC, 0xCCDE8CDC, 0x77800000, 0xFC7F0078),
+	uint4(0x007F007F, 0x78800000, 0xFFFFFFFF, 0xF700FFFF), uint4(0x78C00000, 0x0000C800, 0x00000000, 0x79000000),
+	uint4(0xF0000000, 0x00F0FF00, 0x79400000, 0xFF0FFF0F), uint4(0xFF0FFF0F, 0x79800000, 0xEEEEEEEE, 0xF2EE2EEE),
+	uint4(0x79C00000, 0x800F000F, 0xFE8FE80F, 0x7A000000), uint4(0x8003C003, 0x00030003, 0x7A800000, 0xFFF0FF00),
+	uint4(0xFFF0FFF0, 0x7B800000, 0x00030017, 0x10000001), uint4(0x7BC00000, 0x037F13FF, 0x0037013F, 0x7C000000),
+	uint4(0x377F77FF, 0x01131337, 0x7C800000, 0x73337733), uint4(0x33313333, 0x7CC00000, 0x00CF008E, 0x0CFF08EF),
+	uint4(0x7D000000, 0xEEEFEEEE, 0xFFFFEFFF, 0x7D400000), uint4(0xF0010003, 0xFFFFFFF0, 0x7E000000, 0x0EFF0EFF),
+	uint4(0x0EFF0EFF, 0x7E800000, 0xFFFF00FF, 0xFF00FFF0), uint4(0x7EC00000, 0x00000001, 0xE8008000, 0x7F000000),
+	uint4(0xCCD08890, 0xFF01EE62, 0x7F800000, 0x00130013), uint4(0x00000001, 0x7FC00000, 0x73107310, 0x73107310),
+	uint4(0x80000000, 0x7FFF0137, 0xFFFFFFFF, 0x80400000), uint4(0xFF0FF0FF, 0xFFF0FF00, 0x80800000, 0xFF77FFFF),
+	uint4(0x33117733, 0x80C00000, 0x00FF0FFF, 0x0000000F), uint4(0x81000000, 0x00000007, 0x80000000, 0x81400000),
+	uint4(0x00FF0FFF, 0x8000000F, 0x81800000, 0xC8000001), uint4(0x7EEC6CC8, 0x81C00000, 0x0FFF01FF, 0xFFFF7FFF),
+	uint4(0x82400000, 0x00F700FF, 0x440F880F, 0x82C00000), uint4(0x80008001, 0xC8008000, 0x83000000, 0x00030003),
+	uint4(0xFFE2C883, 0x83800000, 0x0FEEDDCC, 0x311F20FE), uint4(0x83C00000, 0xEEEEEEEE, 0xFFFFFFFF, 0x84400000),
+	uint4(0xC00FC00F, 0xC000C00F, 0x84800000, 0x33770000), uint4(0x80000000, 0x84C00000, 0x8CCE8CCE, 0x8CCE8CCE),
+	uint4(0x85400000, 0x3FFF3FFF, 0x3FFF3FFF, 0x86800000), uint4(0xFFF0F001, 0xFFFFFFFF, 0x86C00000, 0x00000000),
+	uint4(0x31100000, 0x87000000, 0xFFFFFFFF, 0xFFFF8888), uint4(0x87C00000, 0xFF00FF00, 0x0FF00FF0, 0x88000000),
+	uint4(0x003E003E, 0x003E003E, 0x88400000, 0x8EC00C00), uint4(0xEFF0CFF0, 0x88800000, 0xCC89C881, 0x6CC8CCC8),
+	uint4(0x88C00000, 0x008F000C, 0x0FFF08FF, 0x89400000), uint4(0x00170017, 0x00170017, 0x89800000, 0x00220004),
+	uint4(0x00000110, 0x89C00000, 0x00000000, 0xFFF0FF00), uint4(0x8A000000, 0x17FF7000, 0x00000017, 0x8A800000),
+	uint4(0xFEC8FEC9, 0xFFECFFEC, 0x8B800000, 0x00040004), uint4(0x00040004, 0x8C800000, 0x0FEC0FE8, 0x0FFC0FFC),
+	uint4(0x8CC00000, 0x00000000, 0x00880000, 0x8DC00000), uint4(0x48000000, 0xC800C800, 0x8E000000, 0x0FE0FF00),
+	uint4(0x0FFF0FFC, 0x8E400000, 0x0CEF00CE, 0xEFFF8EFF), uint4(0x8F000000, 0xFF000000, 0xFFFFFFFF, 0x90000000),
+	uint4(0x00000000, 0xFFFF8888, 0x90400000, 0xECCCCCCC), uint4(0xEEEEEEEE, 0x90C00000, 0x77FF777F, 0xFFFFFFFF),
+	uint4(0x92400000, 0xFFFCFFEC, 0x11123776, 0x92800000), uint4(0xC407401B, 0xCC40CC00, 0x92C00000, 0x00000000),
+	uint4(0x11111111, 0x93400000, 0xFEC0EC80, 0xFFECFEC8), uint4(0x93800000, 0xC8B7C8B7, 0xC8B7C8B7, 0x93C00000),
+	uint4(0x8CEF008C, 0xFFFFEFFF, 0x94400000, 0xC000C000), uint4(0xE800E000, 0x94800000, 0x9B339B33, 0x9B339B33),
+	uint4(0x94C00000, 0x37FF337F, 0xFFFF7FFF, 0x95800000), uint4(0xEFF1EEE0, 0xFFF0FFF0, 0x96000000, 0x00CF00CF),
+	uint4(0x00CF00CF, 0x96400000, 0xFFC3FFC3, 0xFFF0FFE1), uint4(0x96800000, 0xE000E000, 0xE000E000, 0x97800000),
+	uint4(0xCC846480, 0xEC81ED93, 0x97C00000, 0x00000F30), uint4(0xF10FF7FF, 0x98000000, 0x01FF3FF0, 0x00000003),
+	uint4(0x98800000, 0x08CC08CC, 0x08CC08CC, 0x98C00000), uint4(0x00070007, 0x00070007, 0x99000000, 0xFFF0FFF1),
+	uint4(0xFFF0FFF0, 0x99800000, 0x00000001, 0x48008000), uint4(0x99C00000, 0x0003001F, 0x00000000, 0x9A000000),
+	uint4(0xEECCEECC, 0x76646644, 0x9AC00000, 0x00010001), uint4(0x00010001, 0x9B000000, 0x80130012, 0xCE93F813),
+	uint4(0x9B800000, 0x2FFE2FFE, 0x2FFE2FFE, 0x9BC00000), uint4(0x0222666E, 0x11000001, 0x9CC00000, 0x0F000FF0),
+	uint4(0x0F000F00, 0x9D800000, 0x00110011, 0x80008001), uint4(0x9DC00000, 0x88F90073, 0xE6FEC4FC, 0x9E400000),
+	uint4(0x0FFF0FFC, 0x00FF0FFF, 0x9F800000, 0x11333337), uint4(0x88880111, 0x9FC00000, 0x11331333, 0x91111113),
+	uint4(0xA0C00000, 0x3FE03FC0, 0x3FF83FE8, 0xA1400000), uint4(0x007F007F, 0xF07F007F, 0xA1800000, 0xFFFFFFFF),
+	uint4(0x77FF777F, 0xA1C00000, 0xC8008000, 0xFCC8EC80), uint4(0xA2000000, 0xFFFEFFEE, 0xFFFFFFFF, 0xA2400000),
+	uint4(0x00010037, 0x00000000, 0xA2C00000, 0x00806C88), uint4(0x81379B7F, 0xA3000000, 0x00000000, 0xFFF00000),
+	uint4(0xA3800000, 0x33373337, 0x33373337, 0xA3C00000), uint4(0xCCCC8888, 0xFFFFEEEE, 0xA4400000, 0xEF80EF80),
+	uint4(0xCEC0CFC0, 0xA4800000, 0x11110000, 0x11111111), uint4(0xA4C00000, 0x38883888, 0x38883888, 0xA5400000),
+	uint4(0x03FF03FF, 0x01FF01FF, 0xA5800000, 0xC8018013), uint4(0xECC8CC80, 0xA5C00000, 0x37FF7FFF, 0x0137137F),
+	uint4(0xA6000000, 0xC8800000, 0x13377EEC, 0xA6800000), uint4(0x0FFF0FFF, 0x0F000FFF, 0xA6C00000, 0x817F17FF),
+	uint4(0xC8018017, 0xA8000000, 0x7FFF7FFF, 0x1B377FFF), uint4(0xA8400000, 0x0FFF0FFF, 0x800F00FF, 0xA8800000),
+	uint4(0x01131113, 0x01110113, 0xA8C00000, 0x99938911), uint4(0xBBB79BB3, 0xAAC00000, 0xEFFFCEFF, 0xFFFFFFFF),
+	uint4(0xAB000000, 0x00010001, 0xFFFF0000, 0xAB400000), uint4(0x003FE03F, 0x003F003F, 0xAB800000, 0x003F017F),
+	uint4(0x00010007, 0xABC00000, 0xFFFFFFFF, 0xFF00FFF0), uint4(0xAC400000, 0xCC8CC8CC, 0xCCCCCCC8, 0xAC800000),
+	uint4(0x44448888, 0x22220000, 0xACC00000, 0xFFEEFEEC), uint4(0xFFFFFFFE, 0xAD400000, 0x0000000F, 0xF0000000),
+	uint4(0xAD800000, 0x11331133, 0x91331133, 0xADC00000), uint4(0x77777773, 0x0FFFFF77, 0xAE000000, 0xFFFFEFFF),
+	uint4(0xFFFFFFFF, 0xAE400000, 0xFFFFFFFF, 0x00003377), uint4(0xAEC00000, 0x00000000, 0x008E000C, 0xAF400000),
+	uint4(0x0E000000, 0x00F00080, 0xAF800000, 0xFE80EC00), uint4(0xFFE8FEC8, 0xAFC00000, 0x7C806C80, 0x36C87EC0),
+	uint4(0xB0400000, 0xCCECCCCC, 0xEEEEDCCC, 0xB0C00000), uint4(0xFFECFFC8, 0xFFFEFFFE, 0xB1C00000, 0x7FFF7FFF),
+	uint4(0xBF7B37F7, 0xB2400000, 0xFF00F000, 0x000F08FF), uint4(0xB2800000, 0xF0000000, 0xFF00F000, 0xB2C00000),
+	uint4(0xCC88C888, 0xCCC8CC88, 0xB3000000, 0x00000000), uint4(0x77771111, 0xB3800000, 0x88898889, 0xC8898889),
+	uint4(0xB3C00000, 0xFF73F731, 0xFFF7FF73, 0xB4400000), uint4(0x133777FF, 0x00000011, 0xB4C00000, 0x0F730F73),
+	uint4(0x00F70077, 0xB5000000, 0x80000011, 0x76CCCC80), uint4(0xB5C00000, 0x03000000, 0x001C00E0, 0xB6400000),
+	uint4(0xFFFFEEEE, 0x88880000, 0xB6C00000, 0xC001C001), uint4(0xC001C001, 0xB7000000, 0x000F100F, 0x000F000F),
+	uint4(0xB8000000, 0x00000000, 0x000F0001, 0xB8800000), uint4(0x77777777, 0xFFFFFFF7, 0xB8C00000, 0xC000C000),
+	uint4(0xC001C000, 0xB9000000, 0x77773333, 0xFFFFFFFF), uint4(0xB9400000, 0x3B91F773, 0x000701EE, 0xB9800000),
+	uint4(0x00000000, 0xFEC80000, 0xB9C00000, 0x000F000F), uint4(0xF000F000, 0xBA800000, 0xFFFEFFF0, 0xFFFFFFFF),
+	uint4(0xBB000000, 0x0FFFFFFF, 0xF000000F, 0xBB800000), uint4(0x88800000, 0x112264CC, 0xBBC00000, 0x7FFE7FFE),
+	uint4(0x7FFF7FFF, 0xBC400000, 0xEFF0FF00, 0xCFF0CFF0), uint4(0xBC800000, 0xFFFE1248, 0xFFFFFFFF, 0xBCC00000),
+	uint4(0xFFF3FFF7, 0xFFF0FFF1, 0xBD000000, 0xCCCC8888), uint4(0xEEEEEECC, 0xBE000000, 0x37F037F0, 0x37F037F0),
+	uint4(0xBE800000, 0x777F0111, 0x7777FFFF, 0xBEC00000), uint4(0xE2DC2FCC, 0xEEC4EE4D, 0xBF000000, 0xFFE0FFEF),
+	uint4(0xFFE0FFE0, 0xBF800000, 0xFFFE0001, 0xFFFEFFFE), uint4(0xBFC00000, 0x0003007F, 0x11000000, 0xC0800000),
+	uint4(0x017F17FF, 0x00010017, 0xC1000000, 0x008C008C), uint4(0x08CE08CE, 0xC1400000, 0x01FFFFFF, 0x00000000),
+	uint4(0xC1800000, 0x00000000, 0x66666666, 0xC1C00000), uint4(0xFFF9FFF9, 0xFFF9FFF9, 0xC2800000, 0x80008801),
+	uint4(0x00000000, 0xC3000000, 0xEC80C800, 0xFEC8EC80), uint4(0xC3C00000, 0xFFFFFF00, 0x00FF0FFF, 0xC4800000),
+	uint4(0x11261137, 0xD9BFFD04, 0xC5000000, 0xC0984B98), uint4(0xC8F9C0B9, 0xC5400000, 0x00000000, 0x88000000),
+	uint4(0xC6000000, 0x00100010, 0x001F0010, 0xC6800000), uint4(0xEEEECCCC, 0x3333FFFF, 0xC6C00000, 0x03FF03FF),
+	uint4(0x03FF03FF, 0xC7800000, 0x3337777F, 0x00001111), uint4(0xC7C00000, 0xF30FC4FC, 0x300F710F, 0xC8800000),
+	uint4(0x80000000, 0xFE80E800, 0xC9400000, 0x0000000F), uint4(0xFF00F000, 0xC9800000, 0x7DDC7FDD, 0x7FEE5DCC),
+	uint4(0xC9C00000, 0xECCCECCC, 0xECCCECCC, 0xCA000000), uint4(0x11371336, 0x01331133, 0xCAC00000, 0x20DD0FDD),
+	uint4(0x6600220F, 0xCB000000, 0xFFFFFFFF, 0x11337FFF), uint4(0xCB800000, 0x01FF03FF, 0x017F017F, 0xCC800000),
+	uint4(0x64442444, 0x6ECC66CC, 0xCCC00000, 0xFFFFFFFF), uint4(0x113377FF, 0xCD000000, 0x00110013, 0x80010001),
+	uint4(0xCD400000, 0xFFFFFFE8, 0xFFFFFFFF, 0xCD800000), uint4(0x33337777, 0xCCCC9999, 0xCDC00000, 0x097F03EF),
+	uint4(0x8E3F0C7F, 0xCE800000, 0x88890001, 0xFFEEECCD), uint4(0xCFC00000, 0xF0080000, 0xFFFFEEFD, 0xD0800000),
+	uint4(0x8C84C880, 0xCCEAEC88, 0xD0C00000, 0x003F01F7), uint4(0x00000007, 0xD1000000, 0x000F000F, 0xF0000000),
+	uint4(0xD1400000, 0xCCCC0000, 0x0000FFFF, 0xD1800000), uint4(0xF81FF81F, 0xF81FF81F, 0xD1C00000, 0x00000001),
+	uint4(0xFF10F000, 0xD2000000, 0x0F30FFFF, 0x0003717E), uint4(0xD2800000, 0x33773377, 0x13371337, 0xD3400000),
+	uint4(0x64F964F9, 0x64F964F9, 0xD3C00000, 0x01131133), uint4(0x00010011, 0xD4400000, 0x0000EEEE, 0x00000000),
+	uint4(0xD4C00000, 0x4EEE4EEE, 0x4EEE4EEE, 0xD5000000), uint4(0x7FFFFFFF, 0x003F03FF, 0xD5800000, 0xFFFFFFFF),
+	uint4(0xFF000000, 0xD6C00000, 0x71FE71FE, 0xF30EF30E), uint4(0xD7400000, 0xFF00F000, 0x0F00FF00, 0xD7800000),
+	uint4(0x00000000, 0xFFFFF000, 0xD7C00000, 0xFFFFFFFF), uint4(0xEEEEFFFF, 0xD8400000, 0xFFF2FF3E, 0xFFFEFFFE),
+	uint4(0xD9000000, 0x0007007F, 0x00000000, 0xD9800000), uint4(0xCCCCEEEE, 0x88888888, 0xD9C00000, 0x7FFFFFFF),
+	uint4(0x00113377, 0xDA400000, 0x137F0013, 0xFFFF7FFF), uint4(0xDA800000, 0x0EFFEFFC, 0x000E00EF, 0xDB000000),
+	uint4(0xFFE8FFE8, 0x7FE8FFE8, 0xDB400000, 0x00130137), uint4(0xFFF0FF00, 0xDB800000, 0x00000000, 0xFFFECC88),
+	uint4(0xDC000000, 0xFC00E800, 0xFE80FC00, 0xDC400000), uint4(0x00FF00FF, 0x000F00FF, 0xDC800000, 0xFFFFF000),
+	uint4(0xCEFFFFFF, 0xDCC00000, 0x08CF0CEF, 0xF08CF0CE), uint4(0xDD800000, 0x77777333, 0x8800FF77, 0xDDC00000),
+	uint4(0xFFFFCCCC, 0xFFFFFFFF, 0xDE000000, 0x77777733), uint4(0x888899B7, 0xDEC00000, 0x000000FF, 0x88000000),
+	uint4(0xDF400000, 0xFFFFFFFF, 0x80000000, 0xE0400000), uint4(0x1FC00E80, 0x77767FFC, 0xE0800000, 0x17FFFFFF),
+	uint4(0x00000013, 0xE1400000, 0x803F03FF, 0xFE80E803), uint4(0xE1800000, 0xEECDEECD, 0xEECCEECD, 0xE1C00000),
+	uint4(0x00030007, 0x80000000, 0xE2800000, 0x000300F7), uint4(0xFF30CC4D, 0xE3400000, 0x0017013F, 0x00010003),
+	uint4(0xE3800000, 0xEEEFEEEF, 0xEEEEEEEE, 0xE3C00000), uint4(0x00000000, 0xC0000000, 0xE4000000, 0xE80FC80F),
+	uint4(0xFC8FEC0F, 0xE4800000, 0x1337377F, 0x00000113), uint4(0xE5000000, 0x333B37E8, 0x0011111B, 0xE5C00000),
+	uint4(0x33333333, 0x33773337, 0xE7C00000, 0x01330133), uint4(0x01330133, 0xE8400000, 0x0000000F, 0x70001000),
+	uint4(0xE8800000, 0xFFFFEEEE, 0x7777FFFF, 0xE9000000), uint4(0xFFFFDCCC, 0xFFFFFFFF, 0xE9800000, 0x00030003),
+	uint4(0x00170013, 0xEA000000, 0xFFEDFFED, 0xFFEDFFED), uint4(0xEA400000, 0xFF80FF81, 0x7FC0FFC0, 0xEA800000),
+	uint4(0xFFFFFFFF, 0x37777FFF, 0xEB400000, 0xFFF0F810), uint4(0xFFF0FFF0, 0xEB800000, 0x80008801, 0xFFFE0000),
+	uint4(0xEBC00000, 0xFFFFFFFF, 0xFFF0FFFF, 0xEC000000), uint4(0x01201122, 0xCDCC8988, 0xEC400000, 0x88BF8880),
+	uint4(0xFBB37FF7, 0xECC00000, 0x6FFFEFFF, 0xF813D37F), uint4(0xED000000, 0xFC00C000, 0xFFE8FE80, 0xED400000),
+	uint4(0x003F003F, 0x001F001F, 0xED800000, 0xEDD9FDDB), uint4(0xCD99ED99, 0xEDC00000, 0xFEECFECC, 0xFFECFFEC),
+	uint4(0xEE800000, 0x11371337, 0x01370137, 0xEEC00000), uint4(0xFC80FC80, 0xFC80FC80, 0xEF800000, 0x08CEFFFF),
+	uint4(0x88000000, 0xEFC00000, 0x00000000, 0x37FF0001), uint4(0xF0000000, 0x1FFF3FFF, 0x03FF0680, 0xF0800000),
+	uint4(0xDDD9DDD9, 0xDDD9DDD9, 0xF0C00000, 0xEC80C800), uint4(0xFFE8FEC8, 0xF1000000, 0xC222C022, 0xC003C222),
+	uint4(0xF1C00000, 0x137F017F, 0x37FF17FF, 0xF2800000), uint4(0xBBB99999, 0x4137FFBB, 0xF2C00000, 0xFFFF0FF0),
+	uint4(0xFFFFFFFF, 0xF3800000, 0xF777FFFF, 0x11003331), uint4(0xF3C00000, 0xFC80C800, 0x7FFCFFC8, 0xF4000000),
+	uint4(0x00000000, 0x31000000, 0xF4400000, 0x33331111), uint4(0x77773333, 0xF4C00000, 0xFE3FF1FF, 0xFFF8FFC7),
+	uint4(0xF5C00000, 0x000F0FFF, 0x00000000, 0xF6000000), uint4(0xEF30DDD3, 0x10017111, 0xF6C00000, 0xECC8ECC8),
+	uint4(0xECC8ECC8, 0xF7000000, 0x00EF0EFF, 0x0000000E), uint4(0xF8400000, 0x0CFF8EF0, 0xF08F08EF, 0xF8800000),
+	uint4(0x22262226, 0xFF040004, 0xF8C00000, 0xE800E801), uint4(0xE800E800, 0xF9800000, 0x10001100, 0x00000000),
+	uint4(0xF9C00000, 0xF0000001, 0xFF00F000, 0xFA400000), uint4(0x01000000, 0x000C0020, 0xFA800000, 0xF800F000),
+	uint4(0xFF00FE00, 0xFB800000, 0x9BB737FF, 0xC899D99B), uint4(0xFBC00000, 0xEDB70080, 0xEC80EC83, 0xFC000000),
+	uint4(0xFF00FE01, 0xFF00FF00, 0xFC400000, 0xFC01FE01), uint4(0xE001F801, 0xFD400000, 0x00030003, 0xF0010003),
+	uint4(0xFD800000, 0x6ECDEECC, 0x22440113, 0xFDC00000), uint4(0x80000000, 0xC0008000, 0xFE000000, 0x00880888),
+	uint4(0x00000008, 0xFE800000, 0x6400EC80, 0xEED900FB), uint4(0xFEC00000, 0x3FE83E80, 0x3FFF3FFE, 0xFF800000),
+	uint4(0x6677CCCE, 0x11113333, 0xFFC00000, 0x00000000),
+};
+
+#define PARTITION_2_COUNT_5X5X5 778
+#define PARTITION_2_WORDS_5X5X5 5
+static const uint4 partition_2_5x5x5[973] =
+{
+	uint4(0x00000000, 0xFFFC0000, 0xFFFFFFFF, 0x1FFFFFFF), uint4(0x00000000, 0xFEF7FFFE, 0x77BCEF7B, 0x8CE779CE),
+	uint4(0x0118CE71, 0x00400000, 0xDE339DEF, 0x339C6339), uint4(0x84633846, 0x00084630, 0x00800000, 0x67CE6333),
+	uint4(0x9CCF9CC6, 0x733BBF39, 0x1CE6777E, 0x00C00000), uint4(0x01000000, 0x00020000, 0x40000600, 0x1880000C),
+	uint4(0x01000000, 0xDE339DFF, 0x119C2319, 0x00011802), uint4(0x01000010, 0x01400000, 0xFE000000, 0xCE73FFFF),
+	uint4(0x00000739, 0x00000000, 0x01800000, 0x06108027), uint4(0x00042100, 0x842008C2, 0x03084001, 0x01C00000),
+	uint4(0xFEFFFFFF, 0x77BCEF7F, 0x8C6738CE, 0x00084630), uint4(0x02000000, 0x39EE7310, 0xFFFBFFF7, 0xFFFFFFFF),
+	uint4(0x1FFFFFFF, 0x02400000, 0x398E739E, 0x086218C6), uint4(0x00008021, 0x1F000000, 0x02800000, 0x20223310),
+	uint4(0xCC404466, 0x11988088, 0x02233101, 0x02C00000), uint4(0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x1FFFFFEF),
+	uint4(0x03400000, 0xCE119CEF, 0x00060008, 0x73188631), uint4(0x1FF7B98F, 0x03800000, 0x01FF0000, 0xFE03FFE0),
+	uint4(0x7FFFC3FF, 0x003FFFF0, 0x03C00000, 0xC6108421), uint4(0x739C6318, 0xFFFFF9CE, 0x1FFFFFFF, 0x04000000),
+	uint4(0xFE03FFFF, 0xFFFC07FF, 0x1FFFF80F, 0x003FFFF0), uint4(0x04400000, 0x07F00007, 0x0007E000, 0x800007C0),
+	uint4(0x1F00000F, 0x04800000, 0xDFCE739C, 0x739DEF7B), uint4(0x8C6319CE, 0x118C6311, 0x04C00000, 0x02000001),
+	uint4(0x00040000, 0x00010800, 0x10800218, 0x05400000), uint4(0x31FFFFFF, 0x000318C6, 0x00000000, 0x00000000),
+	uint4(0x05800000, 0x01CC4021, 0xEE63FEC4, 0xFFFFE7FF), uint4(0x1FFFFFFF, 0x05C00000, 0xFFFFBDEF, 0xFFFFFFFF),
+	uint4(0xFFFFFFFF, 0x0009FFFF, 0x06000000, 0x8C000007), uint4(0xF01FDEF7, 0x80003FFF, 0x0000007F, 0x06400000),
+	uint4(0x3FF0001F, 0x007FE000, 0x8000FFC0, 0x1F0001FF), uint4(0x06800000, 0x6318CE73, 0x8C6719CC, 0x318C6319),
+	uint4(0x06318CC7, 0x06C00000, 0x21084210, 0x08421084), uint4(0x42108421, 0x10842108, 0x07000000, 0x01884000),
+	uint4(0x08031884, 0x63108631, 0x1CC6210E, 0x07400000), uint4(0x8C210842, 0xE738C631, 0x7BDEF39C, 0x1EF7BDEF),
+	uint4(0x07C00000, 0x00000000, 0x08400000, 0x6318C421), uint4(0x0C6318CC, 0x08000000, 0x01FE0007, 0x0003FE00),
+	uint4(0xFC0007FE, 0x1FF8000F, 0x08400000, 0x00000000), uint4(0x00000000, 0x9CE62621, 0x00000003, 0x08800000),
+	uint4(0xC0007FE0, 0x0FFC0007, 0x0000F800, 0x00000000), uint4(0x09000000, 0xFFEF7FFF, 0xEF79DEF7, 0x319EF31D),
+	uint4(0x086319E6, 0x09400000, 0x00000000, 0x00000000), uint4(0xFFFFF800, 0x1FFFFFFF, 0x09800000, 0xFFFFFFFF),
+	uint4(0xFFFC1FFF, 0x001FF801, 0x100001F0, 0x09C00000), uint4(0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x077FFFFF),
+	uint4(0x0A000000, 0x00000000, 0xFFFC0000, 0x431CF7FF), uint4(0x00000000, 0x0A400000, 0xCFFFFC07, 0xFF83FFFF),
+	uint4(0xFFC03FFF, 0x1FC0007F, 0x0A800000, 0x3C08639E), uint4(0x8E7810C7, 0x431CF021, 0x008639E0, 0x0AC00000),
+	uint4(0x20000000, 0xCE727084, 0xFDE1FF09, 0x1FFFFE3F), uint4(0x0B000000, 0xFE33BFDE, 0x77FC233B, 0x04677846),
+	uint4(0x0008CEF0, 0x0B400000, 0xFFFF83FF, 0x0FFFFF07), uint4(0x801FFFFE, 0x1F003FFF, 0x0B800000, 0x39FEF39C),
+	uint4(0xCE73FDE7, 0xF79CE7FB, 0x1FEF39CF, 0x0BC00000), uint4(0xC6008467, 0x108E0008, 0x40011E00, 0x1CC0021C),
+	uint4(0x0C400000, 0x03CC0000, 0x00079800, 0x60000F30), uint4(0x1CC0001E, 0x0C800000, 0x20000000, 0x8C621084),
+	uint4(0x318C6231, 0x0739CE76, 0x0CC00000, 0xBFEF7BC0), uint4(0xEF7BDEF7, 0x7BDEF7BD, 0x1EF7BDEF, 0x0D400000),
+	uint4(0xBAFFFFD9, 0xFFF5FFFF, 0xFFFFE1FF, 0x07FFFFC3), uint4(0x0D800000, 0x00000001, 0x00000000, 0x01008001),
+	uint4(0x02010082, 0x0DC00000, 0xDE00006F, 0x01BC0000), uint4(0x62037C00, 0x1EE626CE, 0x0E000000, 0x01EE621F),
+	uint4(0xC803FEC4, 0x7B9887FD, 0x00FFB100, 0x0E800000), uint4(0x40000400, 0x00040000, 0x00000000, 0x10800008),
+	uint4(0x0EC00000, 0x00000000, 0x0003E000, 0xFC0007FE), uint4(0x1FFFC00F, 0x0F000000, 0xCE119CEF, 0x119C2119),
+	uint4(0x00211802, 0x00000210, 0x0F400000, 0xC1FFFFE0), uint4(0xFF83FFFF, 0xBDEFFBDF, 0x0739EF77, 0x0F800000),
+	uint4(0xB01F7200, 0xFFFC7FFF, 0xFFFFF9FF, 0x1FFFFFF7), uint4(0x0FC00000, 0x4C000024, 0x00980000, 0x00013800),
+	uint4(0x00000270, 0x10400000, 0xFFFFFDEF, 0xFFFFFFFF), uint4(0x03FFFFFF, 0x01084000, 0x10800000, 0x218C6318),
+	uint4(0x00021084, 0x00000000, 0x00000000, 0x10C00000), uint4(0xDE77BDFF, 0x77BCE77B, 0x9CE779CE, 0x0339CE73),
+	uint4(0x11000000, 0xFE7FFFFF, 0x7FFC67FF, 0x0067F806), uint4(0x00000670, 0x11400000, 0x06000DD8, 0x00000000),
+	uint4(0x00000000, 0x001B2004, 0x11800000, 0xBDEF7BDE), uint4(0xCEF3DEF7, 0x6319C739, 0x18C6338C, 0x11C00000),
+	uint4(0xFEFFFFFF, 0xFFFCEFFF, 0xBFFFF9DF, 0x033BFFF3), uint4(0x12000000, 0xF90C7BFC, 0xFFF39EFF, 0xFFFFE7FF),
+	uint4(0x1FFFFFCF, 0x12400000, 0x10111100, 0x11100111), uint4(0x00011000, 0x00000010, 0x12800000, 0x00CC4000),
+	uint4(0x00019880, 0x62000331, 0x0CC40006, 0x12C00000), uint4(0xB80F7398, 0xFFF81FF7, 0x7FFFF83F, 0x00FFFFF0),
+	uint4(0x13000000, 0x30004218, 0x08600084, 0x0210C001), uint4(0x00042180, 0x13400000, 0xC1FFFC00, 0xFF83FFFF),
+	uint4(0x03FFFFFF, 0x1F003FF0, 0x13800000, 0x11086108), uint4(0x842210C2, 0x43084421, 0x10861088, 0x13C00000),
+	uint4(0x00000000, 0x00000000, 0x800007C0, 0x1F00000F), uint4(0x14800000, 0xDFEF7BDE, 0x739DCE73, 0x8C6319CE),
+	uint4(0x01086311, 0x14C00000, 0x00108421, 0x00000000), uint4(0x00000000, 0x00000000, 0x15000000, 0xFFFFFFDE),
+	uint4(0xFFFFFFFF, 0xBDFFFBFF, 0x077BDFF7, 0x15800000), uint4(0x00001084, 0x7B82E000, 0x1CF7BDEF, 0x06318E73),
+	uint4(0x15C00000, 0xCE118CE7, 0x339C2319, 0x8C673846), uint4(0x0118CE70, 0x16000000, 0x1E00003F, 0x00040000),
+	uint4(0x00000000, 0x00000000, 0x16400000, 0xC1FFFFE0), uint4(0xFF83FFFF, 0xFFFF07FF, 0x1FFFFE0F, 0x16800000),
+	uint4(0xBDEF7BDE, 0xEF7BDEF7, 0x7BDEF7BD, 0x1EF7BDEF), uint4(0x17000000, 0xC0007BE0, 0xFF8010FF, 0x73FF0031),
+	uint4(0x00F7FE00, 0x17800000, 0x37E61379, 0xC07FCC60), uint4(0x738807B8, 0x1EE7308F, 0x17C00000, 0xFEFFFFFF),
+	uint4(0xFFFCEFFF, 0x8CEFF8CE, 0x0008CEF0, 0x18000000), uint4(0xFC37FFDC, 0xFFFC6FFF, 0x9FFFF8CF, 0x013BFFF0),
+	uint4(0x18800000, 0x39CE739C, 0xCE739CE7, 0x739CE739), uint4(0x1CE739CE, 0x18C00000, 0x21EE6207, 0xEE63FEE6),
+	uint4(0xFFFEE7FF, 0x1FFFFFEF, 0x19000000, 0xC27FFDE7), uint4(0x38C0EF38, 0xE718C1EF, 0x04E739C1, 0x19400000),
+	uint4(0x318C6318, 0x8C6318C6, 0x6318C631, 0x18C6318C), uint4(0x19C00000, 0xBDCE739C, 0xEF7BDEF7, 0xFFFFFFBD),
+	uint4(0x1FFFFFFF, 0x1A000000, 0xFEFFFFFF, 0x77FC677F), uint4(0x04677846, 0x00000230, 0x1A400000, 0xFFFFFFFF),
+	uint4(0xFFFFFFFF, 0xFFFEE7FF, 0x1EE6200F, 0x1A800000), uint4(0xFE119DFF, 0x33BC233B, 0x00233802, 0x00000230),
+	uint4(0x1AC00000, 0xFE77FFFF, 0xFFFCEFFF, 0xCCEFFCCE), uint4(0x1CCCCEFC, 0x1B000000, 0xCE008467, 0x119C0108),
+	uint4(0x04233802, 0x00084670, 0x1B400000, 0x33084213), uint4(0xCE7318C6, 0x7BDE7739, 0x02F7BCE7, 0x1B800000),
+	uint4(0xFE000023, 0xFFFDFFFF, 0xFFFFFFFF, 0x00003FFF), uint4(0x1C000000, 0x00000000, 0x08400000, 0x739CE421),
+	uint4(0x1FFFFFFE, 0x1C400000, 0xFFFFFFFF, 0xEF79FFFF), uint4(0x339CE3BD, 0x1B463182, 0x1C800000, 0x3929731C),
+	uint4(0x9E7A33D6, 0x631DEC73, 0x18C739E8, 0x1CC00000), uint4(0xC2F38C20, 0xF79FEF38, 0x001FF83F, 0x00000000),
+	uint4(0x1D000000, 0x02000023, 0x88000000, 0xFFFFFF31), uint4(0x077BFFF7, 0x1DC00000, 0xFE0003FF, 0x0FFC0007),
+	uint4(0x001FF800, 0x00003FF0, 0x1E000000, 0xFF83FFFF), uint4(0xF7BF93FF, 0x90E73B92, 0x0310C633, 0x1E400000),
+	uint4(0xC0339DF0, 0x7380673B, 0x8CF700C6, 0x0118EE00), uint4(0x1E800000, 0xDFFFFFFF, 0xF7BDEF7B, 0xBDEF7BDE),
+	uint4(0x0739CE77, 0x1EC00000, 0xFE0003FF, 0x0FFC0007), uint4(0x03FFF800, 0x0007FFF0, 0x1F000000, 0xFE0000FF),
+	uint4(0x01BC0000, 0x00017800, 0x00000270, 0x1F400000), uint4(0xFFFFFFFF, 0xFFFFFFFF, 0x0000003F, 0x00000000),
+	uint4(0x1FC00000, 0xFEF7BFFF, 0xFFFDEF7F, 0xBDFFFBDE), uint4(0x0F7BFFF7, 0x20000000, 0xDEF7FFFF, 0x73BCE77B),
+	uint4(0x8C6338CE, 0x01084630, 0x20400000, 0x06480003), uint4(0x009D9000, 0x40017B20, 0x1C8006FE, 0x20800000),
+	uint4(0x46000023, 0x008C0000, 0x42119C20, 0x10842338), uint4(0x20C00000, 0x3E007FFF, 0x00000000, 0xFC2003C0),
+	uint4(0x1FFFCE0F, 0x21000000, 0x1EF7F21F, 0x2D9C6732), uint4(0x001C8842, 0x1003FD80, 0x21800000, 0x3F8C201F),
+	uint4(0x84031842, 0x63080630, 0x19C6108C, 0x21C00000), uint4(0x01F00000, 0x0003E000, 0x800007C0, 0x1F00000F),
+	uint4(0x22000000, 0x01000000, 0x08031000, 0x73188731), uint4(0x1FF7398F, 0x22400000, 0x360004B9, 0x722C2318),
+	uint4(0xBDFCC1CE, 0x1FFFF987, 0x22800000, 0x1CE8218E), uint4(0x8218F481, 0xCF5811EF, 0x019EF921, 0x22C00000),
+	uint4(0xC1FFFFFF, 0x0003FFFF, 0x000007FE, 0x00000000), uint4(0x23000000, 0x06000467, 0x00020000, 0xFB100730),
+	uint4(0x077FB907, 0x23800000, 0xFFFFFFFF, 0xCF7BDEF7), uint4(0x631CE739, 0x1084318C, 0x23C00000, 0xFE6E4000),
+	uint4(0xFFFEFFFF, 0xFFFFF9FF, 0x07FFFFF3, 0x24000000), uint4(0x000FF000, 0xE8001FF0, 0xFFD000FF, 0x1FFFE007),
+	uint4(0x24800000, 0xFEFFFFFF, 0xFFFFFFFF, 0x007FF85F), uint4(0x00000070, 0x24C00000, 0xFE73BFFF, 0x73BC673B),
+	uint4(0x04673846, 0x00004670, 0x25000000, 0xC1FFFFE0), uint4(0xFFEFFFFF, 0xFFFFDFFF, 0x1FFFFF9F, 0x25800000),
+	uint4(0xF9EE4842, 0xE77BDEFF, 0x18C6739C, 0x12108463), uint4(0x25C00000, 0x30000210, 0x8C601084, 0x631CE421),
+	uint4(0x18E739EC, 0x26400000, 0x00000000, 0x00000000), uint4(0x00000000, 0x10000000, 0x26800000, 0x38000000),
+	uint4(0x33BF9CE7, 0x00000002, 0x00000000, 0x26C00000), uint4(0x00000010, 0x00000000, 0x00000000, 0x00000000),
+	uint4(0x27000000, 0xBDEF7BDE, 0xEF7BDEF7, 0x8CEEF3BD), uint4(0x06108410, 0x27400000, 0x4E00002E, 0x000C0000),
+	uint4(0x00000800, 0x00000010, 0x27800000, 0xCF918CE7), uint4(0x339F3319, 0xCC673F66, 0x1C98CE7E, 0x27C00000),
+	uint4(0xFE03FFFF, 0x00FC001F, 0x00000000, 0x00000000), uint4(0x28400000, 0x00000000, 0xF003E000, 0xFFFFFFFF),
+	uint4(0x1FFFFFFF, 0x29000000, 0x31FFFFFF, 0x0003DCE7), uint4(0x00000421, 0x00000000, 0x29800000, 0x31FFFB98),
+	uint4(0xFF73FFF7, 0xFFFEEFFF, 0x00003FDF, 0x29C00000), uint4(0xEFCCE667, 0x0003DDEE, 0x042227FE, 0x00084660),
+	uint4(0x2A000000, 0x37840379, 0x806F1840, 0x63080630), uint4(0x18C6100C, 0x2A400000, 0x00016000, 0x800002C0),
+	uint4(0x0B000005, 0x00160000, 0x2A800000, 0xFE00007F), uint4(0x01FC0000, 0x0003F800, 0x000007F0, 0x2AC00000),
+	uint4(0x1188DC00, 0xFF87DEE0, 0xFFFF07FF, 0x1FFFFE0F), uint4(0x2B000000, 0x02FE6200, 0x999FFCC4, 0x801FFFF9),
+	uint4(0x07662000, 0x2B800000, 0xDE0003EF, 0x0FBC0007), uint4(0x001F7800, 0x00003EF0, 0x2BC00000, 0x8C108844),
+	uint4(0x73382319, 0x9CEF70C6, 0x073BDFF1, 0x2C400000), uint4(0xFE0003DF, 0x0FFC0007, 0x03DFF801, 0x0007FFF0),
+	uint4(0x2C800000, 0x02000000, 0x10840000, 0x84231800), uint4(0x0118C670, 0x2D000000, 0x00000001, 0x00000000),
+	uint4(0x00000000, 0x10000000, 0x2D400000, 0xFE007FFF), uint4(0xFFFC00FF, 0x001FF801, 0x00003FF0, 0x2D800000),
+	uint4(0x10E7318C, 0x0C608C42, 0xDCE73E31, 0x0739CE7B), uint4(0x2DC00000, 0xC6F7BDEF, 0x00006318, 0x40000000),
+	uint4(0x18C42008, 0x2E000000, 0x3E0003FF, 0x00000000), uint4(0x00000000, 0x00000000, 0x2E800000, 0x80000000),
+	uint4(0x01000000, 0x00420000, 0x00008400, 0x2EC00000), uint4(0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x1FFFFEFF),
+	uint4(0x2F000000, 0x00000000, 0x08400000, 0x6318C421), uint4(0x1CE739CC, 0x2F400000, 0xFE007FFF, 0x0FFC00FF),
+	uint4(0x801FFF80, 0x1FF03FFF, 0x2F800000, 0x390C639C), uint4(0x086210C6, 0x00108001, 0x1FE00100, 0x2FC00000),
+	uint4(0x07FFFB98, 0xC007FFFF, 0xF00007FF, 0x1C00000F), uint4(0x30800000, 0x739CE739, 0xBCE779CE, 0xEF7BDEF7),
+	uint4(0x00DEF7BD, 0x30C00000, 0xFFFFFBDE, 0xFFFFFFFF), uint4(0xFFFFFFFF, 0x1FFFFFFF, 0x31000000, 0x218F7FFF),
+	uint4(0x00000000, 0x00000000, 0x00000000, 0x31800000), uint4(0x3AF7FB9D, 0xEE75EFF7, 0xBBDCEBDD, 0x0F77B997),
+	uint4(0x31C00000, 0xFFFFFFFF, 0xFFFFFFFF, 0x9DEFFBDF), uint4(0x0118CEF1, 0x32000000, 0x01F00000, 0xF003FF00),
+	uint4(0x7FFFFFFF, 0x1CF7FFFF, 0x32400000, 0x00007C00), uint4(0x00000004, 0x00000000, 0x00E00000, 0x32800000),
+	uint4(0xC1FFFC10, 0xFFFDFFFF, 0xBDEF7BDE, 0x0F7BDEF7), uint4(0x32C00000, 0xC6008467, 0x108C0008, 0x00011800),
+	uint4(0x00000210, 0x33000000, 0xFFFFFFFF, 0xFFFFFFFF), uint4(0x001FF83F, 0x00000000, 0x33400000, 0x0E00000F),
+	uint4(0x000C0000, 0x00001800, 0x1C000018, 0x33800000), uint4(0xFE0FFFFF, 0x0FFC00FF, 0x0000F800, 0x00000000),
+	uint4(0x33C00000, 0x46008467, 0x00840008, 0x00000800), uint4(0x18000008, 0x34000000, 0x318C6318, 0xCE7318C6),
+	uint4(0x739CE739, 0x1CE739CE, 0x34400000, 0xFFCF7FFF), uint4(0xFFFF9EFF, 0x7FFFFFBF, 0x1FFFFFFF, 0x34800000),
+	uint4(0x02E73188, 0x07ECC621, 0x1FBDC884, 0x1EF73980), uint4(0x34C00000, 0xFE000000, 0xFFFFFFFF, 0xFFFFFFFF),
+	uint4(0x1FFFFFFF, 0x35000000, 0x46000026, 0x88071000), uint4(0xFFDCC7B9, 0x1FFFFFEF, 0x35400000, 0x01FFFF00),
+	uint4(0xFC03FFFE, 0xFFF807FF, 0x1FFFF00F, 0x35800000), uint4(0x72C63398, 0xDEE79CE7, 0xFFFFDF7B, 0x0000080E),
+	uint4(0x35C00000, 0x46108442, 0x10840108, 0x00010800), uint4(0x00000010, 0x36000000, 0xDE319DFF, 0x73BC233B),
+	uint4(0x8C677846, 0x0108CEF0, 0x36400000, 0x000FE000), uint4(0x80001FC0, 0x7F00003F, 0x00FE0000, 0x36800000),
+	uint4(0xBC000000, 0xFFFFDEF7, 0x39CE77FF, 0x0E739CE7), uint4(0x36C00000, 0x01800000, 0x0003E000, 0xFE0007F8),
+	uint4(0x1FFF800F, 0x37000000, 0xFE77FFFF, 0x339C633B), uint4(0x00011802, 0x00000010, 0x37800000, 0xFE339DFF),
+	uint4(0x77B8633B, 0x8CE66046, 0x01188880, 0x37C00000), uint4(0xFE7FFFFF, 0xFFFCFFFF, 0xFFFFF9FF, 0x07FFFFF3),
+	uint4(0x38000000, 0x07CC4003, 0x000F9880, 0x62001F31), uint4(0x1CC4003E, 0x38400000, 0x01FE6000, 0xFFFC0000),
+	uint4(0xFFFFFFFF, 0x1FFFFDCF, 0x38800000, 0x8C118CC6), uint4(0x11082118, 0x00201002, 0x00000000, 0x38C00000),
+	uint4(0x42000023, 0x00040000, 0x00000000, 0x1FFFFFE8), uint4(0x39400000, 0x03000001, 0x00071000, 0x62000F20),
+	uint4(0x1FE6001F, 0x39800000, 0xE6107F73, 0x4FDC6206), uint4(0x9880B8C4, 0x07331003, 0x39C00000, 0xC1FFFC61),
+	uint4(0xFF83FFFB, 0xFFFF0FFF, 0x1FFFFE7F, 0x3A000000), uint4(0x00000000, 0xF07FFFF8, 0xFFE0FFFF, 0x1FFFFE0F),
+	uint4(0x3A800000, 0x22880021, 0x00618804, 0x42084131), uint4(0x1AE620CA, 0x3AC00000, 0x31184210, 0x7184EB4A),
+	uint4(0x77AF3ED6, 0x1CE739DE, 0x3B000000, 0x00000003), uint4(0x00000000, 0x00000000, 0x00000000, 0x3B400000),
+	uint4(0x39CE739C, 0xEF7B9CE7, 0x7BDEF7BD, 0x1FFFFFFF), uint4(0x3B800000, 0xDFFFFFFF, 0x739DEF7B, 0x8C6319CE),
+	uint4(0x01084211, 0x3BC00000, 0xC7FFBCE3, 0xF38FFF79), uint4(0xFDE71FFE, 0x1FFBCE3F, 0x3C000000, 0x00000000),
+	uint4(0x00000000, 0x00000000, 0x1F000000, 0x3C400000), uint4(0x00000000, 0x00000000, 0x7BDEF000, 0x1FFFFFFF),
+	uint4(0x3CC00000, 0x21084210, 0x8C621084, 0x6318C631), uint4(0x18C6318C, 0x3D000000, 0xFEF7FFFF, 0x77BCEF7B),
+	uint4(0x8CE739CE, 0x0118C671, 0x3D400000, 0x3E00001F), uint4(0x007C0000, 0x8000F800, 0x1F0001FF, 0x3D800000),
+	uint4(0x43FF7201, 0xC88FFEE4, 0xFB911FFD, 0x07F76237), uint4(0x3DC00000, 0xFEF7BDEF, 0xFFFFFFFF, 0xFFFFFFFF),
+	uint4(0x1FFFFFFF, 0x3E000000, 0xFFEFFFFF, 0xFFFFDFFF), uint4(0x7FFFFFBF, 0x1EFFFFFF, 0x3E400000, 0xC1FFBC66),
+	uint4(0xF183FF78, 0x7DE3003E, 0x000BC600, 0x3E800000), uint4(0xFFFFFFFF, 0x00001FFF, 0x00000000, 0x1FFFFE00),
+	uint4(0x3EC00000, 0x01FFFC01, 0xF003FFF8, 0xFFE107FF), uint4(0x1FFFC60F, 0x3F000000, 0x21FFFF90, 0xFE43FFFF),
+	uint4(0xFFFC87FF, 0x1FFFF90F, 0x3F400000, 0xFC0007D0), uint4(0x000C0000, 0x00000000, 0x00000000, 0x3F800000),
+	uint4(0x79DEF39C, 0x1294AD6F, 0x00210846, 0x06308420), uint4(0x3FC00000, 0x00007FFF, 0x00000000, 0x00000000),
+	uint4(0x00000000, 0x40000000, 0x9DD0108C, 0x73BC0231), uint4(0x8CE77846, 0x0119CEF0, 0x40400000, 0x020D9DFF),
+	uint4(0xFF601FE4, 0x7FFFF83F, 0x08FFFFF0, 0x40800000), uint4(0xCE00006F, 0x009C0000, 0x00013C00, 0x10000238),
+	uint4(0x41000000, 0x00000000, 0x00000000, 0xFC000000), uint4(0x1FFFFE0F, 0x41400000, 0xFF0073FE, 0x0FFFC0C7),
+	uint4(0xBC1EFFF1, 0x077B98F7, 0x41800000, 0x31084210), uint4(0x8C6318C6, 0x6318C631, 0x1CE739CC, 0x41C00000),
+	uint4(0x3F00001F, 0x007F0000, 0x0000FE00, 0x188001FC), uint4(0x42000000, 0xFE0003FF, 0x007C0007, 0x0000F800),
+	uint4(0x000001F0, 0x42400000, 0x8C6318C6, 0x2108C631), uint4(0x08421084, 0x01084211, 0x42800000, 0x00000000),
+	uint4(0x00000000, 0x42000400, 0x10842108, 0x42C00000), uint4(0xFFE8002F, 0xB7FFFC01, 0x04D07803, 0x001FF800),
+	uint4(0x43800000, 0xCE339CE6, 0x739C6339, 0x8C6738C6), uint4(0x0318CE71, 0x43C00000, 0xFFF003FF, 0x007C0007),
+	uint4(0x0000F800, 0x000001F0, 0x44000000, 0x30000218), uint4(0x0C600084, 0x4218E001, 0x008631C0, 0x44400000),
+	uint4(0x00000000, 0x8C600000, 0x739CE631, 0x1FFFFFFE), uint4(0x44800000, 0xCEF38C20, 0xFFFFFFFB, 0xFFFFFFFF),
+	uint4(0x1FFFFFFF, 0x44C00000, 0xA1FFFFD0, 0xFF43FFFF), uint4(0x7FFFC7BF, 0x1EFFFF8F, 0x45800000, 0xFCF7FBDC),
+	uint4(0xFFFDEFFF, 0xBFFFFBDF, 0x00FFFFF7, 0x45C00000), uint4(0x00000000, 0x00000000, 0xF8000700, 0x1FFFC00F),
+	uint4(0x46000000, 0x398C631C, 0x8C7318C6, 0x6318E631), uint4(0x18C631CC, 0x46400000, 0xFFFFFB98, 0xFFFFFFFF),
+	uint4(0x000007FF, 0x00000000, 0x46C00000, 0xFFFFFFFE), uint4(0xFFFCFFFF, 0x046FF84E, 0x00000670, 0x47000000),
+	uint4(0x00000210, 0x00000000, 0x00000000, 0x00000000), uint4(0x47800000, 0x00000000, 0x08020000, 0x7398C631),
+	uint4(0x1FFFBDCF, 0x47C00000, 0x01000000, 0x00020000), uint4(0x00000400, 0x10000008, 0x48400000, 0x31EF7399),
+	uint4(0xEE63FEE7, 0xB9DCE3FD, 0x033399C3, 0x48C00000), uint4(0x3E00021C, 0xCFFC0087, 0x73FFF821, 0x04FFFFF8),
+	uint4(0x49400000, 0xFE000001, 0xFFFC233B, 0xFFFFFBFF), uint4(0x1FFFFFFF, 0x49800000, 0xFE73FDFF, 0x77BC677F),
+	uint4(0x8CEFF946, 0x0028CEF0, 0x49C00000, 0xFFFFFFFF), uint4(0xFFFFFFFF, 0xFFFFFBFF, 0x07FFFFF7, 0x4A000000),
+	uint4(0x3E00003F, 0x007C0000, 0x0000F800, 0x000001F0), uint4(0x4A800000, 0x087318C6, 0x4210C631, 0x63108529),
+	uint4(0x1CE7210E, 0x4AC00000, 0x00000000, 0x00000000), uint4(0x7B98C631, 0x1FFFFDEF, 0x4B000000, 0x3FF003FF),
+	uint4(0xF07FFF00, 0xFFFFFFFF, 0x1FFFFE0F, 0x4B400000), uint4(0x5F80002F, 0x00BF0000, 0x00017E00, 0x180002FC),
+	uint4(0x4B800000, 0x3C00001C, 0x087C0000, 0x0018F800), uint4(0x000039F0, 0x4BC00000, 0xFE03FFFF, 0x7FFC01FF),
+	uint4(0x003FF800, 0x00000FF0, 0x4C000000, 0xFDFFFBDD), uint4(0xFFFFFFFF, 0xFFFFFFFF, 0x077FFFF7, 0x4C400000),
+	uint4(0x01FE4000, 0xC803FEC0, 0xFFD807FF, 0x1FFFB90F), uint4(0x4C800000, 0x3A0FFBDC, 0x63106300, 0xFFDEE1CE),
+	uint4(0x1FFFBDCF, 0x4CC00000, 0xC1FFFFE0, 0xFF83FFFF), uint4(0xFFFF03FF, 0x07FFFE07, 0x4D400000, 0xFFFFFFFF),
+	uint4(0xEF7BFFFF, 0x739CE7BD, 0x1084210E, 0x4DC00000), uint4(0x010F7C00, 0xF0031EF8, 0x7FFF073F, 0x1EFFFE0E),
+	uint4(0x4E800000, 0xFEFFFFFF, 0x7740677F, 0xF0233846), uint4(0x0000001F, 0x4EC00000, 0x20000010, 0x08400004),
+	uint4(0x4210C001, 0x10843180, 0x4F000000, 0x02000001), uint4(0x00040000, 0x00001800, 0x00000230, 0x4F400000),
+	uint4(0x42318C62, 0x00062108, 0xFFEF7C20, 0x17BDEE7F), uint4(0x4FC00000, 0x7600846F, 0xCC646622, 0xFB98C3FD),
+	uint4(0x1FF7318F, 0x50C00000, 0xFE009FFF, 0x7FFC013F), uint4(0x04FFF802, 0x0009FFE0, 0x51000000, 0x02000023),
+	uint4(0x00000000, 0x40000000, 0x1CC40008, 0x51400000), uint4(0xC0007FE0, 0xFF8001FF, 0xFFFF803F, 0x1FFFFF81),
+	uint4(0x51800000, 0x31CC631C, 0xBDCFDAD6, 0xCE739EF7), uint4(0x1318C639, 0x51C00000, 0xFFFFFFFF, 0xFFFFFFFF),
+	uint4(0xFFFFFFFF, 0x077BFFFF, 0x52000000, 0xDF19DCEF), uint4(0x73BE2339, 0x8CE77846, 0x0119CEF0, 0x52400000),
+	uint4(0xCE119DFF, 0x108C0119, 0x00000800, 0x18800008), uint4(0x52800000, 0x01000000, 0x88421084, 0x7398C631),
+	uint4(0x1EF739CE, 0x52C00000, 0xFEF7FFFF, 0xFFFDEFFF), uint4(0xBFFFFBDF, 0x0F7FFFF7, 0x53000000, 0x0000001F),
+	uint4(0x00000000, 0x00000000, 0x00000000, 0x53400000), uint4(0x0842108C, 0x21084231, 0x84211846, 0x00004210),
+	uint4(0x53C00000, 0xDCF7FFFE, 0x7398E77B, 0x846310C6), uint4(0x00004210, 0x54400000, 0xFE339DFF, 0x77FC673B),
+	uint4(0x9CEFF8CE, 0x0339DFF1, 0x54800000, 0x03080021), uint4(0x8C431884, 0x3B9CC339, 0x073B9DC7, 0x54C00000),
+	uint4(0xFEFFFFFF, 0x119C233B, 0x00000800, 0x00000000), uint4(0x55000000, 0xC6008463, 0x108C0008, 0x00211000),
+	uint4(0x00000000, 0x55400000, 0xFFF003FF, 0xFFFFE0E7), uint4(0x83FFFFC1, 0x07F7FFFF, 0x55800000, 0xFEFFFFFF),
+	uint4(0x0006011B, 0xFB100730, 0x1FFFF90F, 0x55C00000), uint4(0x00000000, 0x00000000, 0x62000000, 0x1FFFB98E),
+	uint4(0x56000000, 0x31CE6310, 0xCE63DCE6, 0xFBDCE7BD), uint4(0x0F7FBDC7, 0x56C00000, 0xC7998CE7, 0x108F9988),
+	uint4(0x73100F31, 0x1FF7310F, 0x57000000, 0x06000003), uint4(0x000C0000, 0x00001800, 0x00000030, 0x57400000),
+	uint4(0x00000000, 0x00040000, 0x00000800, 0x10000210), uint4(0x57800000, 0xC1EE70E4, 0xE303DEF1, 0xFFE70FFF),
+	uint4(0x1FFFCE0F, 0x57C00000, 0x7DF387FE, 0xF383FF38), uint4(0xFFFF37FF, 0x1FFFFFEF, 0x58000000, 0xCF919DFC),
+	uint4(0x808FD908, 0x7FD801FD, 0x101FFD80, 0x58800000), uint4(0xFE03FFFF, 0x001C000F, 0x00000000, 0x00000000),
+	uint4(0x59000000, 0xBDEF7BDE, 0xEF7BDEF7, 0xFFFFFFBD), uint4(0x1FFFFFFF, 0x59C00000, 0x01FF6200, 0x8803FEC4),
+	uint4(0xFB1007FD, 0x1FF6200F, 0x5A400000, 0xC67318CE), uint4(0x10846318, 0x00000002, 0x00000000, 0x5A800000),
+	uint4(0x9CC6318C, 0xF7BDCE73, 0xBDEF7BDE, 0x0F7BDEF7), uint4(0x5AC00000, 0xFE0000FF, 0x01BC0000, 0x00017800),
+	uint4(0x00000260, 0x5B400000, 0x31FFFB10, 0x1773FFFF), uint4(0x9DEFF000, 0x1FFFFFF3, 0x5B800000, 0x0FFF8007),
+	uint4(0x001FFF00, 0xFC003FFE, 0x1FF8007F, 0x5BC00000), uint4(0xC4318427, 0xF398E738, 0xFFFF73DE, 0x1FFFFFEF),
+	uint4(0x5C000000, 0x1FFFE01F, 0xFFF7FFFF, 0xFFE307FF), uint4(0x1FF9C00F, 0x5C800000, 0x63084210, 0x39CE318C),
+	uint4(0xCE739CE7, 0x17BDEF79, 0x5CC00000, 0x04000003), uint4(0xF003FF00, 0xFFFEDFFF, 0x1FFFB93F, 0x5D400000),
+	uint4(0xFE0FFFFF, 0xFFFC07FF, 0x03FFF803, 0x0001FFF0), uint4(0x5D800000, 0x7339CE73, 0x8C6739CE, 0x318C6631),
+	uint4(0x06318C66, 0x5DC00000, 0x46000023, 0x00060000), uint4(0x62000E20, 0x1EE6201E, 0x5E000000, 0x01FF6000),
+	uint4(0xC803FFE4, 0xFF9007FF, 0x1FFFB00F, 0x5E800000), uint4(0x21FF8218, 0xF781EFF8, 0xBDEF7BDE, 0x077BDEF7),
+	uint4(0x5F000000, 0x00000000, 0x00000000, 0x00000000), uint4(0x10000008, 0x5F400000, 0x3E00001F, 0x00000000),
+	uint4(0x800007C0, 0x00F8000F, 0x5F800000, 0xFFFFFFFF), uint4(0xFFFFFFFF, 0xFFFFFFFF, 0x07FFFFFF, 0x60000000),
+	uint4(0x00000000, 0x88000000, 0xFFFFFFB9, 0x1FFFFFFF), uint4(0x60400000, 0xDFFE4067, 0x91BFFE80, 0xFB277FFD),
+	uint4(0x00FE4FFF, 0x60800000, 0x720DEF79, 0xDEF41FFF), uint4(0x7FBCE03B, 0x00FFBDE0, 0x60C00000, 0x03CE6201),
+	uint4(0x00071080, 0x00000C00, 0x00000010, 0x61000000), uint4(0x3FF000FF, 0x007FF000, 0xFC003FF8, 0x1FFC000F),
+	uint4(0x61800000, 0x00000000, 0x00000000, 0x00000800), uint4(0x00000210, 0x61C00000, 0xB0007FD8, 0xFF6000FF),
+	uint4(0x03FEC001, 0x0007FD80, 0x62000000, 0xFFEF739C), uint4(0x77BDEF7F, 0x8C6739CE, 0x01084631, 0x62400000),
+	uint4(0xFE77FFFF, 0xFFFCEFFF, 0xBFFFF9DF, 0x077FFFF3), uint4(0x62800000, 0x00FF8010, 0xF001FFF8, 0xFFFF03FF),
+	uint4(0x0FFFFE07, 0x62C00000, 0x02000421, 0x00000000), uint4(0x40000000, 0x08442108, 0x63C00000, 0x3000001F),
+	uint4(0x00000000, 0x00000000, 0x00000000, 0x64800000), uint4(0xFFCE6310, 0xFFFFFFFF, 0xFFFF7FFF, 0x1398421F),
+	uint4(0x64C00000, 0x09CE7385, 0xCE139CE7, 0x7BDE7739), uint4(0x1EF7BCEF, 0x65000000, 0x42000023, 0x00040000),
+	uint4(0x00000800, 0x00000010, 0x65400000, 0xFE007FFF), uint4(0x0FFC0007, 0x001FF800, 0x00003FF0, 0x65800000),
+	uint4(0xC6008463, 0x118C0108, 0x00211800, 0x00004230), uint4(0x65C00000, 0x00000000, 0x00000000, 0x00000000),
+	uint4(0x1EF7BDE0, 0x66000000, 0x00400000, 0xFBFC0000), uint4(0x77FFBFFF, 0x1FF777FF, 0x66400000, 0xDE00046F),
+	uint4(0x019C0000, 0x80013800, 0x01000270, 0x66C00000), uint4(0xBDCE739C, 0xFFFFDEF7, 0xFFFFFFFF, 0x1FFFFFFF),
+	uint4(0x67000000, 0xDE008CEF, 0x33BC0119, 0x04677802), uint4(0x0008CEF0, 0x67C00000, 0x21084210, 0x08421084),
+	uint4(0x6318C421, 0x18C6318C, 0x68000000, 0x01EC4000), uint4(0xCC43FEC4, 0xFFFCC3FF, 0x01FFFDC3, 0x68800000),
+	uint4(0xFC77FFFE, 0xFFFCEF7F, 0x9DFFF9CE, 0x133BFFF1), uint4(0x68C00000, 0x00000000, 0x00000000, 0x00000000),
+	uint4(0x1F000008, 0x69000000, 0x03CC0027, 0x8803DC80), uint4(0x9D9881FD, 0x00089980, 0x69800000, 0x07800003),
+	uint4(0x000C0000, 0x00001800, 0x00000030, 0x69C00000), uint4(0xFFFFFFFE, 0xFFF7FFFF, 0xFFFFEFFF, 0x1FFFFF9F),
+	uint4(0x6A000000, 0xFE007FFF, 0xFFFC00FF, 0x03FFF801), uint4(0x0007FFF0, 0x6A400000, 0x07EE607F, 0x8003DCC0),
+	uint4(0x730007B9, 0x02E6000F, 0x6A800000, 0x3E0003FF), uint4(0x007C0000, 0x00000000, 0x00000000, 0x6AC00000),
+	uint4(0xBC77BDFF, 0xE670EF73, 0x318CC19C, 0x04621183), uint4(0x6B400000, 0xFE7C7BFF, 0x3FFF06FF, 0x80037F80),
+	uint4(0x1FF8001F, 0x6B800000, 0xFEF7FFFF, 0xF7BCEF7B), uint4(0xDCE77DCE, 0x02DDCE7D, 0x6C000000, 0xBDFFFFDE),
+	uint4(0xFFFBFFFF, 0x7FFFFFFF, 0x0007FFF0, 0x6C400000), uint4(0x00000000, 0x00000000, 0x00000000, 0x00004670),
+	uint4(0x6C800000, 0x3E0003FF, 0x00000000, 0xFFFFF800), uint4(0x1FFFFFFF, 0x6CC00000, 0x3E00001F, 0x8C600000),
+	uint4(0xFFFFFE31, 0x1FFFFFFF, 0x6D000000, 0x9800004C), uint4(0x01300000, 0x00026000, 0x000004C0, 0x6D400000),
+	uint4(0x00FFFF80, 0xFE01FFFF, 0xFFFC03FF, 0x0FFFF807), uint4(0x6D800000, 0x90008888, 0x33300119, 0x00676002),
+	uint4(0x00004EE0, 0x6E000000, 0xFE00002F, 0x03FC0000), uint4(0x002FF800, 0x0000FFF0, 0x6E400000, 0xFFFFFFFF),
+	uint4(0xFFFFFFFF, 0x731007FF, 0x07FFFFF7, 0x6EC00000), uint4(0x5E0000FF, 0x000C0000, 0x42108800, 0x10842108),
+	uint4(0x6F400000, 0xFE0003FF, 0x0FFC0007, 0x001F1800), uint4(0x00003E00, 0x6F800000, 0xFFFFFFFF, 0xFFFFFFFF),
+	uint4(0xFFE007FF, 0x1F00000F, 0x70000000, 0xFFFFFFFF), uint4(0xFFFFFFFF, 0xBFFFFFFF, 0x033BDFF7, 0x70400000),
+	uint4(0xC0000200, 0x0F800007, 0x021F0000, 0x0007FE00), uint4(0x70800000, 0xFE33BFFF, 0xFFFC677F, 0x9DFFF8CE),
+	uint4(0x033BFFF1, 0x71000000, 0xFE03FFFF, 0x000397FF), uint4(0x1FD80009, 0x003FFD80, 0x71400000, 0x00100000),
+	uint4(0x00000000, 0x00000000, 0x10842100, 0x71800000), uint4(0xCE118CE7, 0x319C2318, 0x84633842, 0x0108C630),
+	uint4(0x71C00000, 0x31FFFF98, 0xFE63FFFF, 0xFFFCC7FF), uint4(0x1FFFF98F, 0x72800000, 0x02000026, 0x00000000),
+	uint4(0xFFFFFFFE, 0x1FFFFFFF, 0x73400000, 0x39FFFBDE), uint4(0xCE63DEF7, 0x6318C739, 0x1884210C, 0x73800000),
+	uint4(0x73CE73B9, 0x8CE79CE6, 0x63198F31, 0x18C4231C), uint4(0x73C00000, 0xFFFFFFFF, 0xF7FDEFFF, 0x8CE779CE),
+	uint4(0x0108C671, 0x74400000, 0xFE007FE0, 0xFFFC00FF), uint4(0x03FFF801, 0x0007FFF0, 0x74800000, 0x00000000),
+	uint4(0x00000000, 0xBDEF7800, 0x00000007, 0x74C00000), uint4(0x3E00039F, 0x00780000, 0x00008000, 0x00000000),
+	uint4(0x75800000, 0x018C4203, 0x00020000, 0x00000000), uint4(0x1FFFC000, 0x75C00000, 0x00000000, 0x00000000),
+	uint4(0x00000000, 0x1FFFFFF0, 0x76400000, 0xFE000DFF), uint4(0x01BFE009, 0x80013FC0, 0x1F00003F, 0x76800000),
+	uint4(0xFE0007FF, 0x07FC0007, 0x4007F800, 0x1EE206FC), uint4(0x76C00000, 0xC6F79CE3, 0x738DEF39, 0xBCE71BDE),
+	uint4(0x0F79CE37, 0x77000000, 0xF90C637C, 0xCEB318C7), uint4(0x739D7631, 0x1CE73EEC, 0x77800000, 0x01FF8000),
+	uint4(0xF003FFF8, 0xFFE007FF, 0x1FFFFE0F, 0x77C00000), uint4(0xFE0000F8, 0x03FFFFE1, 0x0007FF80, 0x00000FF0),
+	uint4(0x78800000, 0xFFFFFFFF, 0xFFBFFFFF, 0xFCE007FF), uint4(0x0300000F, 0x78C00000, 0x01EE6200, 0x00020000),
+	uint4(0x00000000, 0x18840000, 0x79000000, 0x01F00000), uint4(0xF003FF00, 0x001F003F, 0x00000000, 0x79400000),
+	uint4(0x3FFFFC1F, 0xF07FFFF8, 0xFFE0FFFF, 0x1FFFC1FF), uint4(0x79800000, 0xBCEF7BDE, 0xEF784EF7, 0x7C4EF7C4),
+	uint4(0x1EF7C4EF, 0x79C00000, 0x3F88001F, 0x887FD880), uint4(0xFFD8FFFD, 0x1FFFFC0F, 0x7A000000, 0xFFFFFFFF),
+	uint4(0xFFFDFFFF, 0xBFFFF9FF, 0x007BFFF5, 0x7A400000), uint4(0x07FE0003, 0x000FF800, 0x00001FA0, 0x1800003E),
+	uint4(0x7A800000, 0xC1FFFC00, 0xFF83FFFF, 0xFFFF07FF), uint4(0x1FFFFFFF, 0x7B800000, 0x06000027, 0x00042000),
+	uint4(0x840000C0, 0x0F180003, 0x7BC00000, 0xDE008DFF), uint4(0x11BC0019, 0x00033800, 0x00000230, 0x7C000000),
+	uint4(0xDE239DFF, 0x319C0339, 0x00211842, 0x1F000210), uint4(0x7C800000, 0xC6739C63, 0x318CE718, 0x8C6309C6),
+	uint4(0x0318C211, 0x7CC00000, 0x3FF0031E, 0x8F7DE087), uint4(0x839FF9C1, 0x0103BFF1, 0x7D000000, 0xBFEF7BDE),
+	uint4(0xFFFFDEF7, 0xFFFFFFBD, 0x1FFFFFFF, 0x7D400000), uint4(0x03F00003, 0xFF83FF00, 0xFFFFFFFF, 0x1FFFFFFF),
+	uint4(0x7E000000, 0xCFFFFDEF, 0x739FEF7B, 0xDEF31BDE), uint4(0x00DEF79B, 0x7E400000, 0xFFF07BFF, 0xEFFFE0F7),
+	uint4(0x83DFFFC1, 0x1F07BFFF, 0x7E800000, 0xFE0003FF), uint4(0xFF83FFFF, 0xFFE007FF, 0x1FF8000F, 0x7EC00000),
+	uint4(0x01800001, 0x00039000, 0xFB0007B0, 0x0FFF200F), uint4(0x7F000000, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF),
+	uint4(0x0F7FFFF7, 0x7F400000, 0x418C6320, 0xE30B9CE7), uint4(0xFFE00FBD, 0x1FFFC01F, 0x7F800000, 0x46000023),
+	uint4(0x00040000, 0x00000000, 0x00000000, 0x7FC00000), uint4(0x40F38C20, 0x3081E718, 0x9C6103CE, 0x0F38C207),
+	uint4(0x80000000, 0xFE000467, 0xFFFC677F, 0x7FFFFFFF), uint4(0x0007FFF0, 0x80400000, 0x3FFF83FF, 0xF003FFF8),
+	uint4(0xFFFF07FF, 0x1FFFFFFF, 0x80800000, 0xCFFFFDEF), uint4(0x718FEF79, 0x8C610BCE, 0x03084003, 0x80C00000),
+	uint4(0xFE007FFF, 0x007C0007, 0x00000000, 0x00000000), uint4(0x81000000, 0x00000007, 0x00020000, 0x62000620),
+	uint4(0x1CC6200C, 0x81400000, 0xFE007FFF, 0x007F0007), uint4(0xE0000780, 0x1FF0000F, 0x81800000, 0x21884001),
+	uint4(0xC6629C44, 0x9DCEE58C, 0x073BDFE3, 0x81C00000), uint4(0xFFFFFFFE, 0xFFFFFFFF, 0xFFFFFFFF, 0x1FFFFFFF),
+	uint4(0x82000000, 0xFE0007FF, 0xFFFC007F, 0xFFFFF80F), uint4(0x1FFFFFF1, 0x82400000, 0xEF0843EF, 0x807F1007),
+	uint4(0x1080FE10, 0x063001D6, 0x82C00000, 0x01CC4001), uint4(0x00039880, 0x73100731, 0x0EE62007, 0x83000000),
+	uint4(0x00000000, 0x00000000, 0x739CE000, 0x1FFFFFFE), uint4(0x83400000, 0x06700003, 0x8C4E0000, 0xFFFE1739),
+	uint4(0x1FFFC03F, 0x83800000, 0xBC0EF79C, 0x0FF840FF), uint4(0x8C21F884, 0x0718C213, 0x83C00000, 0xFE0FFFFF),
+	uint4(0xFFFC1FFF, 0x03FFF83F, 0x0007FFF0, 0x84000000), uint4(0xBDEF7BDE, 0xFFFFDEF7, 0x7FFFFFFF, 0x0007FFF0),
+	uint4(0x84400000, 0x3FFE001F, 0x007FFC00, 0xF00007F8), uint4(0x1FE0000F, 0x84800000, 0xCF080000, 0x00033319),
+	uint4(0x62000621, 0x1CC4200C, 0x84C00000, 0xFFFFFFFF), uint4(0xFFFFFFFF, 0x9DFFFBFF, 0x0118CEF3, 0x85000000),
+	uint4(0x3D0C739E, 0xCE7A18E7, 0x639CF431, 0x10C739E8), uint4(0x85400000, 0x31086318, 0x8C6210C6, 0x4318C421),
+	uint4(0x10863188, 0x85800000, 0xFE01FFFF, 0xFFFC03FF), uint4(0x0FFFF807, 0x001FFFF0, 0x86800000, 0xC1FF8001),
+	uint4(0xFFFFFFFF, 0xFFFFFBFF, 0x077FFFF7, 0x86C00000), uint4(0x00000000, 0x00000000, 0x8C210000, 0x0F79CE31),
+	uint4(0x87000000, 0x00000000, 0x00000000, 0x00000000), uint4(0x10842100, 0x87400000, 0x01FFFC00, 0xFF83FFFC),
+	uint4(0xFFFF07FF, 0x1FFFFF8F, 0x87800000, 0xFE77FFFF), uint4(0x8C60EFFF, 0xBFFFF9D1, 0x077FFFF3, 0x87C00000),
+	uint4(0x000FFC00, 0xFF801FF8, 0x03FF0001, 0x00003FF0), uint4(0x88000000, 0xDC00006E, 0x01B80000, 0x00037000),
+	uint4(0x000006E0, 0x88400000, 0x00087200, 0xFF8018F7), uint4(0x7BFF0439, 0x1CFFFE0C, 0x88800000, 0x32C66311),
+	uint4(0xCE608C66, 0x198CC198, 0x063399C3, 0x88C00000), uint4(0x3E00001C, 0x8FFC0006, 0x43FFF801, 0x10F7FFF0),
+	uint4(0x89400000, 0x4E000027, 0x009FE000, 0x80013FC0), uint4(0x1F00027F, 0x89800000, 0x84200004, 0x10800000),
+	uint4(0x00000000, 0x00000000, 0x89C00000, 0x00000000), uint4(0xF003E000, 0xFFFF07FF, 0x1FFFFFFF, 0x8A000000),
+	uint4(0x00000000, 0x0003E000, 0x7C0007C0, 0x1CFFC00F), uint4(0x8A400000, 0xFE738000, 0x009DE13F, 0x00000000),
+	uint4(0x00000000, 0x8A800000, 0x31FFFB99, 0xFF71FFF7), uint4(0xFFFEE1FF, 0x01FFFFE1, 0x8B800000, 0x08000004),
+	uint4(0x00100000, 0x00002000, 0x00000040, 0x8C800000), uint4(0xB8007FD8, 0xFFF000FF, 0x03FFE001, 0x0007FFC0),
+	uint4(0x8CC00000, 0x20000000, 0x08400004, 0x4218C001), uint4(0x10C631C8, 0x8DC00000, 0x00000000, 0x88000444),
+	uint4(0x33100118, 0x0CE62002, 0x8E000000, 0x800FFE00), uint4(0xFFF000FF, 0x03FFF801, 0x0007FFF0, 0x8E400000),
+	uint4(0x01084210, 0x00000000, 0xFFFFF800, 0x1FFFFFFF), uint4(0x8EC00000, 0xBE00439E, 0xEFFC10E7, 0x7BFFFC31),
+	uint4(0x1CFFFFFC, 0x8F000000, 0x01F00000, 0xFFFFFFF8), uint4(0xFFFFFFFF, 0x1FFFFFFF, 0x90000000, 0x00000000),
+	uint4(0x8C600000, 0xFFFFFE31, 0x1FFFFFFF, 0x90400000), uint4(0xFE1003FF, 0x0FFC2007, 0x801FF840, 0x01003FF0),
+	uint4(0x90800000, 0x39CE739C, 0xEF7BDEE7, 0x7BDEF7BD), uint4(0x1FFFFFFF, 0x90C00000, 0x00000000, 0x00000000),
+	uint4(0x62000400, 0x1EE6310C, 0x91000000, 0x398E739C), uint4(0xCE731CE7, 0x739CE639, 0x18E739CC, 0x91400000),
+	uint4(0xDEF7BDFF, 0xF7BDEF7B, 0xBDEF7BDE, 0x0739DEF3), uint4(0x91C00000, 0xDE119CEF, 0x73BC2339, 0x8CE77846),
+	uint4(0x0119CEF0, 0x92000000, 0xDE339CEF, 0xF7FCE73B), uint4(0xBDFFF9DE, 0x0FFFFFF7, 0x92400000, 0xF9FFFFDC),
+	uint4(0x7399EF7F, 0x042110C6, 0x10000038, 0x92800000), uint4(0x0EC2003B, 0xC0018C20, 0x31840318, 0x1C631806),
+	uint4(0x92C00000, 0x00000000, 0x00020000, 0x00000400), uint4(0x10000008, 0x93000000, 0x00000000, 0x10840000),
+	uint4(0x84210842, 0x01084210, 0x93400000, 0x21FF7310), uint4(0xEE63FFF7, 0xFFFEE7FF, 0x1FFFFDCF, 0x93800000),
+	uint4(0xCFCE6167, 0x859F9CC2, 0x730B3F39, 0x1CE6167E), uint4(0x93C00000, 0xBE00431C, 0xFFFC18E7, 0xFFFFFF3D),
+	uint4(0x1FFFFFFF, 0x94400000, 0x01FE0000, 0x0003FC80), uint4(0xFB0007FD, 0x1FFE000F, 0x94800000, 0xE7DCEE73),
+	uint4(0xB9CFB9DC, 0xE7739F73, 0x1DCEE73E, 0x94C00000), uint4(0x01FFF200, 0xFE43FFF6, 0xFFFEC7FF, 0x0009FFC7),
+	uint4(0x95000000, 0x01000000, 0x00020000, 0x00000400), uint4(0x10002108, 0x95400000, 0xFF998CEF, 0xFFFF733B),
+	uint4(0x7FFFFEEE, 0x08803FF0, 0x95800000, 0x20000010), uint4(0x00400000, 0x00008000, 0x00000100, 0x95C00000),
+	uint4(0xC3CF7BC0, 0xFF83DEFF, 0xFFFF07FF, 0x1FFFFE0F), uint4(0x96000000, 0x3E00039F, 0x0E7C0007, 0x001CF800),
+	uint4(0x000039F0, 0x96400000, 0x07FFFF83, 0xFF07FFFF), uint4(0xFFFF87FF, 0x1FFFFF0F, 0x96800000, 0xFFFFFFFF),
+	uint4(0xFFFFFFFF, 0xFFFFFFFF, 0x0E7FFFFF, 0x97400000), uint4(0x000F0000, 0x00001E00, 0x7800003C, 0x00F00000),
+	uint4(0x97800000, 0x28231100, 0xDCCF9CE6, 0x7B988FBD), uint4(0x1EF7310F, 0x97C00000, 0x20007C60, 0x7FFE1084),
+	uint4(0xFC20FFFE, 0x1F78000F, 0x98000000, 0x00000000), uint4(0x00000000, 0x40000400, 0x1CC4000C, 0x98400000),
+	uint4(0xFE01FFE0, 0x000C000B, 0x00000000, 0x18C42008), uint4(0x98800000, 0x3908639C, 0x8E7210C7, 0x431CE421),
+	uint4(0x108639C8, 0x98C00000, 0x0E000007, 0x001C0000), uint4(0x80003FC0, 0x1FF8007F, 0x99000000, 0xE0FFFFF1),
+	uint4(0xFFC07FFF, 0x3FFF807F, 0x003FFF00, 0x99800000), uint4(0x01000001, 0x00011000, 0x11108011, 0x00011100),
+	uint4(0x99C00000, 0x0600003F, 0x00000000, 0x00000000), uint4(0x00000000, 0x9A000000, 0x18F7399C, 0x6211EE73),
+	uint4(0x9CC621CC, 0x13188411, 0x9AC00000, 0x02000001), uint4(0x00040000, 0x00000800, 0x00000010, 0x9B000000),
+	uint4(0xB80FFFDC, 0xFF701FFF, 0x7FFEE03F, 0x00FFFDC0), uint4(0x9B400000, 0x47800022, 0x808FF800, 0x73D91FFF),
+	uint4(0x00002388, 0x9B800000, 0xFC217FFE, 0xFFF842FF), uint4(0x0BFFF085, 0x0217FFE1, 0x9BC00000, 0x20000210),
+	uint4(0x00400000, 0x00008000, 0x00000100, 0x9C400000), uint4(0x846318CE, 0x00040010, 0xC6308040, 0x0B5A5398),
+	uint4(0x9CC00000, 0xC1FFFFE0, 0xFF83FFFF, 0xFFFF07FF), uint4(0x0F7BFF0F, 0x9D000000, 0x00007FE0, 0xF00000F8),
+	uint4(0x03E00001, 0x0007C000, 0x9D800000, 0x63884221), uint4(0x08471084, 0x62108231, 0x08442104, 0x9DC00000),
+	uint4(0xF30842F3, 0x4FF31847, 0x38DFF738, 0x1E30BDEF), uint4(0x9E400000, 0xFFFFFFFF, 0xFFFDFFFF, 0x1FFFF87F),
+	uint4(0x0007FFF0, 0x9E800000, 0xDE319CEF, 0x73BC6339), uint4(0x8CE778C6, 0x0319CEF1, 0x9F000000, 0xFE007FFC),
+	uint4(0xFFFC00FF, 0x001FF801, 0x00003FF0, 0x9F800000), uint4(0xC6318C67, 0x10842108, 0x6318C000, 0x0E739DEC),
+	uint4(0x9FC00000, 0xC7988C63, 0x108F3108, 0x66210E63), uint4(0x1CC4421E, 0xA0C00000, 0xA001FF90, 0xFF6003FF),
+	uint4(0x0FFFC007, 0x001FFFC0, 0xA1400000, 0xFE0000FF), uint4(0x03FC0001, 0xFC07FFC0, 0x1FFFCFEF, 0xA1800000),
+	uint4(0xFEE7BFFF, 0x7BFDEFFF, 0xDEFFF9EF, 0x17BFFFFB), uint4(0xA1C00000, 0x014C4010, 0xCC435CC4, 0xFF9CC7FD),
+	uint4(0x1FF7FDCF, 0xA2000000, 0xFCFFFFDE, 0xFFFDFFFF), uint4(0xFFFFFFFF, 0x1FFFFFFF, 0xA2400000, 0x21084210),
+	uint4(0x8C621084, 0x739CE631, 0x1EF7BDEE, 0xA2800000), uint4(0x02000067, 0x00000000, 0x00000000, 0x1C000000),
+	uint4(0xA2C00000, 0x20233318, 0xBBBC0002, 0x62233F33), uint4(0x1880023C, 0xA3000000, 0x00000010, 0x00000000),
+	uint4(0xFFFF07C0, 0x1FFFFFFF, 0xA3800000, 0xCF19CE77), uint4(0x319E2318, 0x8C633846, 0x0118C670, 0xA3C00000),
+	uint4(0x398C6318, 0xEF7B9CE7, 0xFFFFFFBD, 0x1FFFFFFF), uint4(0xA4400000, 0x01CF7F00, 0xFE031EFE, 0x73DC0639),
+	uint4(0x18E7BD0C, 0xA4800000, 0x62000000, 0x18C6318C), uint4(0xC6318C63, 0x19CE7398, 0xA4C00000, 0x3181E318),
+	uint4(0x8C6303C6, 0x0F18C607, 0x181E318C, 0xA5400000), uint4(0xFFF00FFF, 0x1FFFE01F, 0x802FFFC0, 0x1F001FFF),
+	uint4(0xA5800000, 0x03CC4023, 0xCC439CC4, 0xFB9CC7B9), uint4(0x1FFFB9CF, 0xA5C00000, 0xFF73BFFF, 0x33BE633B),
+	uint4(0x00233C42, 0x10000238, 0xA6000000, 0x8C310842), uint4(0xE738E631, 0xBBDEF1DC, 0x1FF7BDE7, 0xA6400000),
+	uint4(0x21884000, 0xEF739CC6, 0x046339CE, 0x00000010), uint4(0xA6800000, 0xFE007FFF, 0xFFFC00FF, 0x03E00001),
+	uint4(0x1F07FFF0, 0xA6C00000, 0x00000000, 0x00000000), uint4(0x00000000, 0x1FF60000, 0xA7400000, 0xFE0FFFFF),
+	uint4(0x0FFC00FF, 0x8000FFC0, 0x1FF8000F, 0xA7800000), uint4(0xFFFFFFFF, 0xFFFFFFFF, 0x000007FF, 0x01084210),
+	uint4(0xA7C00000, 0xFE889FFF, 0x009D9889, 0x73100F31), uint4(0x1EE6200E, 0xA8000000, 0xFE33BFFF, 0xFFFE677F),
+	uint4(0x857338CE, 0x02233100, 0xA8400000, 0xFF807FFF), uint4(0x0FFF10FF, 0x6000FF20, 0x1EE4000F, 0xA8800000),
+	uint4(0x46008423, 0x108C0008, 0x00210800, 0x00004210), uint4(0xA8C00000, 0x46000023, 0x008C0000, 0x00011800),
+	uint4(0x00000010, 0xAA400000, 0x678C6631, 0xBDCF39CE), uint4(0xEF7BBE73, 0x0F5AFF7E, 0xAAC00000, 0xFFCE7BFF),
+	uint4(0xFFFF9EFF, 0xFFFFFFBF, 0x1FFFFFFF, 0xAB000000), uint4(0x02000001, 0x00000000, 0xFFFFF800, 0x1FFFFFFF),
+	uint4(0xAB400000, 0xFFFF407F, 0x01FFD000, 0x0003FC00), uint4(0x000007E0, 0xAB800000, 0xDE0004FF, 0x001C0000),
+	uint4(0x00000800, 0x00000000, 0xABC00000, 0xFEFFFFFF), uint4(0xFFFDFFFF, 0xBFFFF9FF, 0x133FFFF1, 0xAC000000),
+	uint4(0xFFFFFFFF, 0xFF83FFFF, 0xFFE007FF, 0x1F00000F), uint4(0xAC400000, 0x39CE639C, 0xCE639CE6, 0x739CE739),
+	uint4(0x1CE739CE, 0xAC800000, 0x08842108, 0x00008421), uint4(0x08421000, 0x01084211, 0xACC00000, 0xBDFFFBDC),
+	uint4(0xFFFBFFFF, 0xFFFFFFFF, 0x1FFFFFFF, 0xAD400000), uint4(0x01F0001F, 0x0003E000, 0x7C000000, 0x00F80000),
+	uint4(0xAD800000, 0xC6108463, 0x198E2108, 0xE6339C63), uint4(0x19CE77BC, 0xADC00000, 0xCF7B9CE3, 0xF39EF739),
+	uint4(0x03EF783F, 0x10803EF0, 0xAE000000, 0xFF0F7FFF), uint4(0xFFFF1FFF, 0x7FFFFF3F, 0x1FFFFFFF, 0xAE400000),
+	uint4(0x00000000, 0x00001000, 0x40000220, 0x0C800004), uint4(0xAE800000, 0xFFFFFFFF, 0x339FFFFF, 0x000000C6),
+	uint4(0x00000000, 0xAEC00000, 0x00000001, 0x00002000), uint4(0x80000040, 0x03080001, 0xAF000000, 0x20000000),
+	uint4(0x08700000, 0x0218F000, 0x00063DF0, 0xAF400000), uint4(0x00004000, 0x0C0000F0, 0x001F0000, 0x000001C0),
+	uint4(0xAF800000, 0x20FF7200, 0xEE61FFF6, 0xFFFEC3FF), uint4(0x07FFFFC3, 0xAFC00000, 0x20337310, 0xEE406766),
+	uint4(0x8CDCC04E, 0x0119D980, 0xB0400000, 0xB9CE739C), uint4(0xCE73BCE7, 0x7BDEF73B, 0x1EF7BDFF, 0xB0C00000),
+	uint4(0xB9FFFF98, 0xFFFBFFFF, 0x7FFFF7FF, 0x0007FFF0), uint4(0xB1C00000, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFF7FF),
+	uint4(0x1FF7B9CF, 0xB2000000, 0xDE73BFFF, 0x77DE77FB), uint4(0xEDE75EE7, 0x1D69C69C, 0xB2400000, 0x01FF8000),
+	uint4(0x8FFC1FF8, 0x0000F801, 0x1FF80000, 0xB2800000), uint4(0x01F00000, 0x0003FF00, 0xFFE007FE, 0x1FFFC00F),
+	uint4(0xB2C00000, 0x30CE6318, 0xCC639CE6, 0x739CC739), uint4(0x1EE7398E, 0xB3000000, 0xFE0FFFFF, 0xFFFC1FFF),
+	uint4(0x7FFFF83F, 0x0007FFF0, 0xB3400000, 0x00000000), uint4(0x10840000, 0x9CE73842, 0x1FFFFFF3, 0xB3800000),
+	uint4(0x338C6319, 0x8C6718C6, 0x7318CF31, 0x1CE7319E), uint4(0xB3C00000, 0xFF8800FF, 0x01BF1000, 0x40017E20),
+	uint4(0x1880027C, 0xB4000000, 0xC7F79C61, 0xF38FFF79), uint4(0xFFEF3FFE, 0x1FFFDE7F, 0xB4400000, 0xFFFFFFFF),
+	uint4(0xFFFFFFFF, 0xFFFFFFFF, 0x01083FF0, 0xB4800000), uint4(0xCE339DEF, 0x00842118, 0x00000000, 0x0F080000),
+	uint4(0xB4C00000, 0xC7087EE3, 0x0B9E10FD, 0x401F3C20), uint4(0x10843E78, 0xB5000000, 0x46000023, 0x008C0000),
+	uint4(0x00011800, 0x00000230, 0xB5400000, 0xFE37FFFF), uint4(0xFFFC6FFF, 0xBFFFF8DF, 0x037FFFF1, 0xB5800000),
+	uint4(0x01880021, 0xCC439884, 0x9CCC6198, 0x0108C661), uint4(0xB5C00000, 0x00000000, 0x0F000018, 0x0001E000),
+	uint4(0x000000F0, 0xB6400000, 0xF1FFFFF8, 0xFFE3FFFF), uint4(0xFFFFC7FF, 0x1FFFFF8F, 0xB6800000, 0xDFE739CE),
+	uint4(0x00000F7B, 0x61084420, 0x18C2108C, 0xB6C00000), uint4(0x03FE4001, 0x0007FC80, 0xF2000FF9, 0x1FE4001F),
+	uint4(0xB7000000, 0x3E30801F, 0x007C6000, 0x8000F840), uint4(0x01000000, 0xB8000000, 0x00000000, 0x00040000),
+	uint4(0x0000F800, 0x00000FF0, 0xB8800000, 0xCE739CE7), uint4(0xF79DE739, 0xBDEF7BDE, 0x00FFDEF7, 0xB8C00000),
+	uint4(0x01FE4000, 0x0003FC80, 0xF2000FF9, 0x1FE4003F), uint4(0xB9000000, 0xCE318C63, 0xFFFCE739, 0xFFFFFFFF),
+	uint4(0x1FFFFFFF, 0xB9400000, 0x62779CE3, 0x177883DE), uint4(0x00003840, 0x00000000, 0xB9800000, 0x00000000),
+	uint4(0x00000000, 0xFFDCC620, 0x1FFFFFFF, 0xB9C00000), uint4(0x3FF0001F, 0x0003E000, 0xFC0007FE, 0x00F8000F),
+	uint4(0xBA800000, 0xFDFFFFE0, 0xFFFFFFFF, 0xFFFFFFFF), uint4(0x1FFFFFFF, 0xBB000000, 0xFE0FFFFF, 0x007C00FF),
+	uint4(0xFC0007C0, 0x1FFFC00F, 0xBB800000, 0x21084000), uint4(0x463188C6, 0x0422108C, 0x00000010, 0xBBC00000),
+	uint4(0xFC33BFFE, 0xFFFC677F, 0x9DFFF8CE, 0x033BFFF1), uint4(0xBC400000, 0xC18FFC00, 0xFF831EFF, 0x73FF0439),
+	uint4(0x00C7BFF0, 0xBC800000, 0xFC008888, 0xFFFCEFFF), uint4(0xFFFFFFFF, 0x1FFFFFFF, 0xBCC00000, 0xC7FFFFE7),
+	uint4(0xFF87FFFF, 0xFFFF87FF, 0x1FFFFF8F, 0xBD000000), uint4(0x00000000, 0x00000000, 0x00000800, 0x10800018),
+	uint4(0xBD400000, 0x00000000, 0x00000000, 0x00000000), uint4(0x01084210, 0xBDC00000, 0x398C6318, 0xEE739CE7),
+	uint4(0xFBDEF7BD, 0x1FFFFFFF, 0xBE000000, 0x21084210), uint4(0x08421084, 0x42108421, 0x18C63188, 0xBE400000),
+	uint4(0xE0119DF0, 0x77C0233B, 0x8CEF8046, 0x0119DF00), uint4(0xBE800000, 0xDE000421, 0xF7BCE739, 0xDEE73FDE),
+	uint4(0x139CE73B, 0xBEC00000, 0x78617F9C, 0xE277CE17), uint4(0x7BCC27BC, 0x1EF7B9CF, 0xBF000000, 0x81FFFDCF),
+	uint4(0xFF03FFFF, 0x7FFE003F, 0x0007FC00, 0xBF800000), uint4(0xFC000001, 0xFFFBFFFF, 0xBFFFF3FF, 0x033BFDC3),
+	uint4(0xBFC00000, 0x01FF0000, 0xFE03FFE0, 0x7FFFC7FF), uint4(0x00F7FFFC, 0xC0400000, 0x078800FF, 0x00031000),
+	uint4(0xC4200620, 0x09B9C61D, 0xC0800000, 0xFE009FFF), uint4(0x009C0009, 0x00000800, 0x00000000, 0xC1000000),
+	uint4(0x3800431C, 0x8E780086, 0x431CF021, 0x008639E0), uint4(0xC1400000, 0xFE7FFFFF, 0x0000000B, 0x40000400),
+	uint4(0x1CC4000C, 0xC1800000, 0x00000000, 0x63180000), uint4(0x18C6318C, 0x06318C63, 0xC1C00000, 0xF237FFF9),
+	uint4(0xFFE46FFF, 0xBFFFC8DF, 0x037FFF91, 0xC2800000), uint4(0x01CC6201, 0x00031880, 0x00000620, 0x00000008),
+	uint4(0xC3000000, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFF7FFF), uint4(0x1FFBDE7F, 0xC3400000, 0x21EE6200, 0xCC43FEE6),
+	uint4(0xFFDCC7FD, 0x1FFFFDCF, 0xC3C00000, 0xFFFFFC00), uint4(0xFFFC3FFF, 0x000FF801, 0x00000070, 0xC4800000),
+	uint4(0x8C008467, 0xD0100108, 0x773BFFBF, 0x188C667E), uint4(0xC5000000, 0x71C26F38, 0x0DE78C06, 0x711FCF38),
+	uint4(0x1CE601BE, 0xC5400000, 0xFC7FFFFE, 0xFFF8FFFF), uint4(0xFFFFF1FF, 0x07FFFFF3, 0xC5C00000, 0x00000000),
+	uint4(0x00000000, 0x63108420, 0x1CE7398C, 0xC6000000), uint4(0x40000020, 0x00800000, 0x0001F800, 0x000003F0),
+	uint4(0xC6800000, 0xBDCE739C, 0xF7BFDEF7, 0x8C631BDE), uint4(0x18C63181, 0xC6C00000, 0x06000007, 0x00060000),
+	uint4(0x80000700, 0x1F80000F, 0xC7000000, 0xFE000FFF), uint4(0x3FFC001F, 0x007FF800, 0x0000FFF0, 0xC7800000),
+	uint4(0xCE739CEF, 0x10846318, 0x42108042, 0x1CE739C8), uint4(0xC7C00000, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFF7FFF),
+	uint4(0x1FFFFEFF, 0xC8000000, 0x3FEE13FC, 0x107FEF18), uint4(0x8C00FFCE, 0x03000003, 0xC8800000, 0x01800000),
+	uint4(0x8003D800, 0xFFD807FD, 0x1FFFFD8F, 0xC9400000), uint4(0x0000001F, 0x0003E000, 0x7FE007FE, 0x0007FE00),
+	uint4(0xC9800000, 0x7843FFBD, 0xDE7007EF, 0x1FFEF00B), uint4(0x003FBDE1, 0xC9C00000, 0x39EF739C, 0xCE73DEE7),
+	uint4(0x7B9CE7BD, 0x1EF739CF, 0xCA000000, 0x01800000), uint4(0xFFFC0000, 0xFFFFFFFF, 0x1FFFFFFF, 0xCA800000),
+	uint4(0xCE008C66, 0x118E0108, 0x40231C02, 0x10804238), uint4(0xCAC00000, 0x7A107FBD, 0x207C6207, 0x98C000C4),
+	uint4(0x07318843, 0xCB000000, 0xFFFFFFFF, 0xF7FFFFFF), uint4(0x042319CE, 0x10800000, 0xCB800000, 0xBCE739CE),
+	uint4(0xEF7BDEF7, 0x7BDEF7BD, 0x1EF7BDEF, 0xCC400000), uint4(0xFE000DFF, 0x13FC000B, 0x0027F800, 0x00000FF0),
+	uint4(0xCC800000, 0x08211084, 0x66304621, 0x19CC618C), uint4(0x067398C3, 0xCCC00000, 0xFFFFFFFF, 0x77BDEFFF),
+	uint4(0x042318CE, 0x10842110, 0xCD000000, 0x43880023), uint4(0x00071000, 0x62000E21, 0x1CC4201C, 0xCD400000),
+	uint4(0xFFFFFFD8, 0xFFFFFFFF, 0xFFFFFFFF, 0x1FFFFFFF), uint4(0xCD800000, 0xE6739CE7, 0x9CE6739C, 0x739CE673),
+	uint4(0x0F7B9CEE, 0xCDC00000, 0xFE004DDF, 0xC3FC00C9), uint4(0x63C37821, 0x00E7C2F0, 0xCE800000, 0xFFEFFFFF),
+	uint4(0xFFFF9FFF, 0x7FFFFF3F, 0x18F7FFFE, 0xCF000000), uint4(0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x00003FFF),
+	uint4(0xCF400000, 0x33084201, 0xCE7798C6, 0xFFFEF7BD), uint4(0x1FFFFFDF, 0xCFC00000, 0x00000000, 0x00000000),
+	uint4(0x21084000, 0x04210844, 0xD0000000, 0x10004000), uint4(0xEFF7FF00, 0xFFFFFFFD, 0x1FFFFFFF, 0xD0800000),
+	uint4(0x29EE6310, 0xCC6358E6, 0xF39ED7BD, 0x1FF7B98E), uint4(0xD0C00000, 0xFE0007E7, 0x001C0000, 0x00000000),
+	uint4(0x00000000, 0xD1000000, 0x3FF0001F, 0x0003E000), uint4(0xFC0007C0, 0x1FF8000F, 0xD1400000, 0x38000000),
+	uint4(0xF7BF9CE7, 0x000003DE, 0x00000000, 0xD1800000), uint4(0x5FFFE02F, 0x80BFFFC0, 0xFF017FFF, 0x1FFE02FF),
+	uint4(0xD1C00000, 0x00000001, 0x00006000, 0xFFE107DE), uint4(0x1FFFFE7F, 0xD2000000, 0xFFEF7BDE, 0xFFFFFFFF),
+	uint4(0xBDFFFFFF, 0x0739DEF7, 0xD2400000, 0xC00FFFEF), uint4(0x13FB1078, 0x80001FCE, 0x00000000, 0xD2800000),
+	uint4(0x00000000, 0x00000000, 0x42108000, 0x00000008), uint4(0xD2C00000, 0xCE118CE7, 0x319C2319, 0x84633842),
+	uint4(0x0108C670, 0xD3400000, 0x3FF003FF, 0x007FE000), uint4(0x8000FFC0, 0x1FF8000F, 0xD3800000, 0xF2E313F9),
+	uint4(0x4FE5C627, 0x189FCB8C, 0x0E313F97, 0xD3C00000), uint4(0x46008463, 0x00840008, 0x00000800, 0x1E00001C),
+	uint4(0xD4400000, 0x21EF7BDE, 0x00021084, 0x42108000), uint4(0x18C63188, 0xD4C00000, 0xBC023BDE, 0xEF780477),
+	uint4(0x11DEF008, 0x0023BDE0, 0xD5000000, 0xFFFF8000), uint4(0xFFFFFFFF, 0xFFFFFFFF, 0x00003FFF, 0xD5400000),
+	uint4(0xFE7FFFFF, 0x3FFE07FF, 0x00037C00, 0x10000018), uint4(0xD5800000, 0xFEFFFFFF, 0x0841FFFF, 0xFFE00021),
+	uint4(0x0FFFFFF7, 0xD6C00000, 0xFDF387FE, 0x307BE70F), uint4(0xBC60F7DE, 0x1FF9C3EF, 0xD7400000, 0x000F8000),
+	uint4(0xF0001FF8, 0x03E0003F, 0x0007FE00, 0xD7800000), uint4(0x00000000, 0x00000000, 0x7FFFFFFE, 0x00000000),
+	uint4(0xD7C00000, 0xFFFFFFFF, 0xFFFFFFFF, 0x7BDEF7FF), uint4(0x1CE739CF, 0xD8400000, 0xC5FFBC7E, 0xFFBBFFFB),
+	uint4(0xFFFFF7FF, 0x1FFFFFEF, 0xD9000000, 0x01CC4200), uint4(0x08039884, 0x62100731, 0x1CC4200E, 0xD9400000),
+	uint4(0x0F8000FF, 0x00000000, 0x00000000, 0x07FFFFF0), uint4(0xD9800000, 0x18E739CE, 0x84218C63, 0x6318C210),
+	uint4(0x18C6318C, 0xD9C00000, 0x00000000, 0x00020000), uint4(0x63108621, 0x1CE7318E, 0xDA000000, 0xFFFFFFFF),
+	uint4(0x339CE77B, 0x00010846, 0x00000000, 0xDA400000), uint4(0xDF000023, 0xFFFE0119, 0xFFFFFCCE, 0x103FFFF3),
+	uint4(0xDA800000, 0xFE0F7FFC, 0x0F7C00F7, 0x0000F000), uint4(0x00000000, 0xDB000000, 0xB07FFFD8, 0xFF60EFFF),
+	uint4(0x9FFEC0DF, 0x013BFD81, 0xDB400000, 0x46000467), uint4(0xF003E000, 0xFFFF07FF, 0x077FFFF7, 0xDB800000),
+	uint4(0x00000000, 0x00400000, 0x02108000, 0x1F001080), uint4(0xDBC00000, 0x00000000, 0xCC621000, 0xFFFFF739),
+	uint4(0x1FFFFFFF, 0xDC000000, 0x01FF6000, 0xC803FFE4), uint4(0xFFD807FF, 0x1FFFF90F, 0xDC400000, 0xFE0003FF),
+	uint4(0x0FFC0007, 0x0000F800, 0x000001F0, 0xDC800000), uint4(0xFFFF8000, 0xFFFFFFFF, 0x73DFFFBF, 0x10C73DFC),
+	uint4(0xDCC00000, 0x00000000, 0x00000000, 0x42108000), uint4(0x10842108, 0xDD000000, 0x3EF873DF, 0x0E79E0C7),
+	uint4(0xFC18E3FF, 0x0FF821C7, 0xDD800000, 0xEF7BCE73), uint4(0xFBDEF7BD, 0x2100003F, 0x08421084, 0xDDC00000),
+	uint4(0xFFCE739C, 0xFFFFFFFF, 0xFFFFFFFF, 0x1FFFFFFF), uint4(0xDE000000, 0x0FF0000F, 0x000FE000, 0x80001FC0),
+	uint4(0x1F00001F, 0xDE800000, 0xEF7BDE73, 0x959DF7BD), uint4(0x61084212, 0x18C6318C, 0xDEC00000, 0x010843EF),
+	uint4(0x08421084, 0x63108621, 0x18C6318C, 0xDF400000), uint4(0xFFFFFFFF, 0xFFFFFFFF, 0x03FFF83F, 0x0007FFF0),
+	uint4(0xDF800000, 0xCF739CE7, 0x739EF739, 0xDEF73DEF), uint4(0x1FFDEF7F, 0xDFC00000, 0xFEF7FFFF, 0x0003EFFF),
+	uint4(0x22100001, 0x0C462104, 0xE0400000, 0x20007B00), uint4(0xFFF001FF, 0x5CE7360F, 0x01EC4212, 0xE0800000),
+	uint4(0xFE7FFFFF, 0x008C013B, 0x40000000, 0x1EE6200C), uint4(0xE1400000, 0xFF000FFF, 0x800FD800, 0xFFD807FD),
+	uint4(0x1FFFFFCF, 0xE1800000, 0x3BFF7B9D, 0xEE77FEF7), uint4(0xFBDCE7FD, 0x1FF7B9CF, 0xE1C00000, 0x07000007),
+	uint4(0x00030000, 0x60000720, 0x1FE4000F, 0xE2800000), uint4(0x260003E7, 0xC2761080, 0xFDE30739, 0x1FF9C20F),
+	uint4(0xE3400000, 0x4E00046F, 0x000C0000, 0x00000800), uint4(0x10000000, 0xE3800000, 0x9EE739CF, 0xE739CE73),
+	uint4(0x39CE739C, 0x0C739CE6, 0xE3C00000, 0x00000000), uint4(0x0003E000, 0x70000400, 0x0007C000, 0xE4000000),
+	uint4(0x20000210, 0x08400004, 0x00108000, 0x00002100), uint4(0xE4400000, 0x1FEE600F, 0xC83FFEC4, 0xFF98FFFD),
+	uint4(0x1FFFB8FF, 0xE4800000, 0xDE339DEF, 0x77BC673B), uint4(0x9CEF78CE, 0x0339DEF1, 0xE4C00000, 0xCE319CEF),
+	uint4(0x108C2118, 0x00000000, 0x00000000, 0xE5000000), uint4(0x20000000, 0x08421084, 0x2118C421, 0x00421084),
+	uint4(0xE5800000, 0xF739DFD8, 0x18EC339C, 0x02118843), uint4(0x00002100, 0xE5C00000, 0xB1FFFFD8, 0xFF63FFFF),
+	uint4(0xFFFEC7FF, 0x1FFFFD8F, 0xE6400000, 0xCE318C67), uint4(0x319C6318, 0x8C6338C6, 0x0318C671, 0xE6C00000),
+	uint4(0x01000000, 0x00020000, 0x60000620, 0x0EC4000E), uint4(0xE7000000, 0x3FF0001F, 0x007C0000, 0x0000F800),
+	uint4(0x000001F0, 0xE7400000, 0xC6318C63, 0x319C6318), uint4(0x8C6738C6, 0x0319CE71, 0xE7C00000, 0xC6000463),
+	uint4(0x118C0008, 0x00231800, 0x00004630, 0xE8400000), uint4(0x0030001F, 0x0001E000, 0x1C000002, 0x00004000),
+	uint4(0xE8800000, 0x01F00000, 0x0003E000, 0xFC0007FE), uint4(0x1FF8000F, 0xE8C00000, 0xFFEF7BDE, 0xF7BFFFFF),
+	uint4(0x9CE73BDE, 0x0318C633, 0xE9000000, 0xFE4EF39C), uint4(0xFFFC1FFF, 0x7FFFF83F, 0x00FFFFF0, 0xE9800000),
+	uint4(0x00000000, 0x00020000, 0x62000620, 0x1FF7310E), uint4(0xE9C00000, 0x06000003, 0x008C0000, 0x00013800),
+	uint4(0x10000278, 0xEA000000, 0xBBFFFFDD, 0xFF77FFFF), uint4(0xFFFEEFFF, 0x1FFFBDDF, 0xEA400000, 0x007FFF01),
+	uint4(0xFE007FFE, 0x1FFC005F, 0x001FFC00, 0xEA800000), uint4(0x00000000, 0x00000000, 0x40000000, 0x10846318),
+	uint4(0xEB000000, 0xFFFFFFFF, 0xF7BDEFFF, 0x8CE739CE), uint4(0x118CE7B1, 0xEB400000, 0xC1FFE020, 0xFF83FFFF),
+	uint4(0xFFFF07FF, 0x00FFFE0F, 0xEB800000, 0x00C46201), uint4(0x00000884, 0xFDFFF001, 0x177BFDEB, 0xEBC00000),
+	uint4(0xFFFFFFFF, 0xFFFFFFFF, 0xFFFF07FF, 0x0000000F), uint4(0xEC000000, 0xA0008442, 0x9C62108C, 0x73BCE631),
+	uint4(0x1EF7BDEE, 0xEC400000, 0xFFCC6310, 0xFFDD8842), uint4(0xFF7B990F, 0x1DEE7317, 0xECC00000, 0xFE8F7FFF),
+	uint4(0x33BFC67F, 0x7F011F3A, 0x1EFFE00F, 0xED000000), uint4(0x01FE4000, 0xEC03FFE4, 0xFFFEC7FF, 0x1FFFFFEF),
+	uint4(0xED400000, 0xFE00007F, 0x00BC0000, 0x00017800), uint4(0x000002F0, 0xED800000, 0x73EFF7BB, 0xDCE7DEEF),
+	uint4(0x73B9CFBD, 0x1EE7739F, 0xEDC00000, 0x00000000), uint4(0x00000000, 0x00000000, 0x1FF80000, 0xEE000000),
+	uint4(0xB9FFFB9C, 0xFF73FFF7, 0xFFFEE7FF, 0x1FFFFDCF), uint4(0xEE800000, 0xCE008C67, 0x119C0108, 0x00233800),
+	uint4(0x00004630, 0xEEC00000, 0xFEF7FFFF, 0xF7BCEF7B), uint4(0x9CE779CE, 0x0319CE71, 0xEF000000, 0x2077F310),
+	uint4(0xCC40FFE6, 0xFF9883FF, 0x1FFF311F, 0xEF800000), uint4(0x3DEFFFFF, 0x004010C7, 0x21000421, 0x0C631084),
+	uint4(0xEFC00000, 0x00000000, 0x00040000, 0x8CEFF800), uint4(0x0FFFFFF0, 0xF0000000, 0xFE01FFFF, 0x6C02017F),
+	uint4(0x007FF800, 0x00005FF0, 0xF0800000, 0x720EF7B9), uint4(0xDEE41DEF, 0x77BDC83B, 0x00EF7B90, 0xF0C00000),
+	uint4(0x21FE6200, 0xEE601EE6, 0x7FFEC03F, 0x0007FDC0), uint4(0xF1000000, 0x03B80001, 0x00077000, 0xC0000EE0),
+	uint4(0x1B80001D, 0xF1800000, 0x85FE4042, 0x210BBC90), uint4(0xF2001F79, 0x1FE4021F, 0xF1C00000, 0x03880023),
+	uint4(0x00031000, 0x40000620, 0x1880000C, 0xF2000000), uint4(0xFDFFFBDC, 0xFFFFFFFF, 0xFFFFFFFF, 0x1FFFFFFF),
+	uint4(0xF2400000, 0xFE0004EF, 0x77FC0119, 0xCEFFFC02), uint4(0x013AF73C, 0xF2800000, 0xF39CE739, 0xFDEFFBDE),
+	uint4(0x102339DF, 0x04210842, 0xF2C00000, 0xFFFFFFFF), uint4(0xFFBFFFFF, 0xFDE73FFF, 0x0F38C61F, 0xF3000000),
+	uint4(0xFE007FE0, 0xFFFFFFFF, 0xFFFFFFFF, 0x0000000F), uint4(0xF3800000, 0xCFFFFDEF, 0x3185EF39, 0xC63001C6),
+	uint4(0x1CC63188, 0xF3C00000, 0x21FE6200, 0xFE63FFE6), uint4(0x9FFFE1FF, 0x0119FFF1, 0xF4000000, 0x00000000),
+	uint4(0x00000000, 0x8C200000, 0x1FFBCE33, 0xF4400000), uint4(0xC6108421, 0x318C6318, 0x9CE738C6, 0x0739CE73),
+	uint4(0xF4C00000, 0x00000000, 0x00000000, 0x63108000), uint4(0x1FFFBDCE, 0xF5800000, 0xFFFF87FF, 0xFE1FFFF0),
+	uint4(0xFFFFC7FF, 0x1FFFFFFF, 0xF5C00000, 0x3E007FFF), uint4(0x00000000, 0x00000000, 0x00000000, 0xF6000000),
+	uint4(0x3E00001F, 0x007C0000, 0x00000000, 0x00000000), uint4(0xF6400000, 0xFFCF7FFF, 0xFFFFFFFF, 0xFFFFFFFF),
+	uint4(0x1FFFFFFF, 0xF6800000, 0xC1CEF5A3, 0x1087DE78), uint4(0x84000FCE, 0x10842103, 0xF6C00000, 0x30F77398),
+	uint4(0xCE61FEE7, 0xFB9CC3FD, 0x1FF7398F, 0xF7000000), uint4(0xFE0FFFFF, 0xFFFC1FFF, 0x03FFF801, 0x00003FF0),
+	uint4(0xF7800000, 0xBE007BFF, 0x00780007, 0x00000000), uint4(0x00000000, 0xF8400000, 0xFE0C7BE0, 0x8F7C10E7),
+	uint4(0xFC18FFC1, 0x0739FEC7, 0xF8800000, 0x8C010846), uint4(0x00100210, 0xFFE02740, 0x19DEF60E, 0xF8C00000),
+	uint4(0x00FF6001, 0x80007EC0, 0x3B00007D, 0x00360000), uint4(0xF9800000, 0x00308400, 0x00002100, 0x42108040),
+	uint4(0x10842108, 0xF9C00000, 0x01F00001, 0x0003FF00), uint4(0xFFE007FE, 0x1FFFC00F, 0xFA400000, 0x00000000),
+	uint4(0x01000008, 0x00006000, 0x03000000, 0xFA800000), uint4(0x01FFC000, 0xE003FFC0, 0xFFF007FF, 0x1FFFF00F),
+	uint4(0xFB800000, 0xCE719DEF, 0x9CECA95A, 0x7319CB1A), uint4(0x1CE73186, 0xFBC00000, 0xCE000100, 0xCC0FFEEE),
+	uint4(0xFB9807FD, 0x1FF7300F, 0xFC000000, 0x01FFF801), uint4(0xF003FFF8, 0xFFF007FF, 0x1FFFF00F, 0xFC400000),
+	uint4(0x00000000, 0x00400000, 0x0010C000, 0x000431C0), uint4(0xFC800000, 0x03FFFA01, 0x8007FFE0, 0xFA000FFF),
+	uint4(0x1FE0001F, 0xFD400000, 0x07F00003, 0x000FE000), uint4(0xFC000FC0, 0x1FF8001F, 0xFD800000, 0x3AFF7B9C),
+	uint4(0x108CE673, 0x88442000, 0x033198C0, 0xFDC00000), uint4(0x01F80000, 0x0003F800, 0xF00007F0, 0x1FE0000F),
+	uint4(0xFE000000, 0x31086318, 0x08621086, 0x42108421), uint4(0x10842108, 0xFE800000, 0x00E73110, 0x0FEC6620),
+	uint4(0xFBDDC840, 0x1FFFB9CF, 0xFEC00000, 0x00000000), uint4(0x00000000, 0xFC000000, 0x1EF7BDEF, 0xFF400000),
+	uint4(0xB001FB10, 0xFFF803FF, 0x0FFFF807, 0x001FFFF0), uint4(0xFF800000, 0xCE86318E, 0x318CC631, 0x842108C6),
+	uint4(0x00842180, 0xFFC00000, 0x00000000, 0x00000000),
+};
+
+#define PARTITION_2_COUNT_6X6X6 870
+#define PARTITION_2_WORDS_6X6X6 8
+static const uint4 partition_2_6x6x6[1740] =
+{
+	uint4(0x00000000, 0x00000000, 0xFFFFFF00, 0xFFFFFFFF), uint4(0xFFFFFFFF, 0xFFFFFFFF, 0x00FFFFFF, 0x00000000),
+	uint4(0xCF3DF7DE, 0x73CF3DF1, 0x1C73CF1C, 0xC71CF0C7), uint4(0x31C70C30, 0x0C30410C, 0x00001043, 0x00400000),
+	uint4(0xC31C73CF, 0x30C71CF0, 0x0C31C704, 0x430C7041), uint4(0x10C30010, 0x04300004, 0x00000001, 0x00800000),
+	uint4(0xBCF38E73, 0xCF38E73F, 0xF39E73FB, 0x39EF77BC), uint4(0x96F779C7, 0x6D779C71, 0x0038C759, 0x00C00000),
+	uint4(0x30800000, 0x0800000E, 0x800000E3, 0x20000F38), uint4(0x0000F38C, 0x0007B8C2, 0x007BCE20, 0x01000000),
+	uint4(0xC31C73DF, 0x10C31CF0, 0x0410C704, 0x00043000), uint4(0x00010400, 0x0000C100, 0x003C3040, 0x01400000),
+	uint4(0x00000000, 0xFFFFFFF0, 0xF3CF3CFF, 0x00000F3C), uint4(0x00000000, 0x00000000, 0x00000000, 0x01800000),
+	uint4(0xE1860867, 0x18608238, 0x8608218E, 0x618218E3), uint4(0x18208E38, 0x8609E386, 0x009E38E1, 0x01C00000),
+	uint4(0xCF7DFFFF, 0x73CF7DF3, 0x1C73CF1C, 0xC31C70C3), uint4(0x10C30410, 0x04100004, 0x00000000, 0x02000000),
+	uint4(0xFEF3CE30, 0xFFFEF3CF, 0xFFFFFEFF, 0xFFFFFFFF), uint4(0xFFFFFFFF, 0xFFFFFFFF, 0x00FFFFFF, 0x02400000),
+	uint4(0x38F3CF3E, 0x0E38E3CE, 0xC30C38C3, 0x20830820), uint4(0x00200008, 0x1C7FFF00, 0x001C71C7, 0x02800000),
+	uint4(0x0210C630, 0x210C6300, 0x10C63000, 0x0C630002), uint4(0xC6300021, 0x63000210, 0x0000210C, 0x02C00000),
+	uint4(0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF), uint4(0xFFFE7FFF, 0xF383DFFF, 0x003CF7FE, 0x03400000),
+	uint4(0x010C71CF, 0x08010C78, 0xE30801E3, 0x38E30F38), uint4(0xEF387BEF, 0x7BE3DF7B, 0x000C73DF, 0x03800000),
+	uint4(0xFFFA0000, 0xFFFC8007, 0xFFFF0007, 0xFFFF800F), uint4(0xFFFF000F, 0xFFF0001F, 0x0000003F, 0x03C00000),
+	uint4(0x41041041, 0x30C30C30, 0x1C71C70C, 0xDF7DF1C7), uint4(0xFFFF7DF7, 0xFFFFFFFF, 0x00FFFFFF, 0x04000000),
+	uint4(0x001FFFFF, 0x01FFFFF0, 0x1FFFFF00, 0xFFFFF000), uint4(0xFFFF0001, 0xFFF0001F, 0x000001FF, 0x04400000),
+	uint4(0x3F000007, 0xF0000030, 0x00000103, 0x0000003F), uint4(0x000003F0, 0x00003F00, 0x0003F000, 0x04800000),
+	uint4(0x3CF3CF3C, 0xFBEFBEFF, 0x9E79E7BE, 0xE38E39E7), uint4(0x1C718E38, 0x410C71C7, 0x00410410, 0x04C00000),
+	uint4(0x20000001, 0x08000018, 0x82000182, 0x20841C20), uint4(0x0861C308, 0x863E30C2, 0x00E38C30, 0x05400000),
+	uint4(0xFFFFFFFF, 0x8E38E38F, 0x000000E3, 0x00000000), uint4(0x00000000, 0x00000000, 0x00000000, 0x05800000),
+	uint4(0xBCE30041, 0xFFB8C20F, 0xFFEF38FF, 0xFFFFCFFF), uint4(0xFFFFFFFF, 0xFFFFFFFF, 0x00FFFFFF, 0x05C00000),
+	uint4(0xDF7CF3CF, 0xFFDF7DF7, 0xFFFFFFFF, 0xFFFFFFFF), uint4(0x77FF1DFF, 0x00100004, 0x00000000, 0x06000000),
+	uint4(0x20820827, 0xEFBEF868, 0xFFF007FB, 0x00007FFF), uint4(0x0007FFF0, 0x007FC000, 0x00000000, 0x06400000),
+	uint4(0xDF00003F, 0xF00003FF, 0x00003FFD, 0x0003FFDF), uint4(0x003FFDF0, 0x03FFDF00, 0x00FDF000, 0x06800000),
+	uint4(0x71C73CF3, 0x8659C716, 0x31861961, 0x0C30C30C), uint4(0x618C18E3, 0x9A69A618, 0x00CE38E7, 0x06C00000),
+	uint4(0x30C30C30, 0x0C30C30C, 0xC30C30C3, 0x30C30C30), uint4(0x0C30C30C, 0xC30C30C3, 0x00C30C30, 0x07000000),
+	uint4(0x38C30820, 0x8E30C20E, 0xE30C20F3, 0x38C30F38), uint4(0x8C30F3CE, 0xE30F3CE3, 0x00FBCF38, 0x07400000),
+	uint4(0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF), uint4(0xFFFFFFFF, 0xFBEFFFFF, 0x00FBEFBE, 0x07800000),
+	uint4(0x82082082, 0x61861860, 0x38E38E18, 0x9E79E38E), uint4(0xE79E79E7, 0xFBE79E79, 0x00FBEFBE, 0x07C00000),
+	uint4(0x00000000, 0x00000000, 0xC30C3000, 0x18618C30), uint4(0xC30C6186, 0x18630C30, 0x00186186, 0x08000000),
+	uint4(0xFFF00007, 0xFF80000F, 0xFC0000FF, 0xC0000FFF), uint4(0x0000FFFF, 0x000FFFFE, 0x00FFFFF0, 0x08400000),
+	uint4(0x00000000, 0x00000000, 0xC3080000, 0xC7184F38), uint4(0x00001C71, 0x03000000, 0x00000000, 0x08800000),
+	uint4(0x0003FFC0, 0x0000FC00, 0x000FFF00, 0x0003F000), uint4(0x00000000, 0x00000000, 0x00000000, 0x09000000),
+	uint4(0x9E79F7DF, 0xE79E7DF3, 0x39E79E30, 0x0C79E30C), uint4(0xC31E30C3, 0x30C20830, 0x0020820C, 0x09400000),
+	uint4(0x00000000, 0x00000000, 0x00000000, 0xFFFFF000), uint4(0xFFFFFFFF, 0x000FFFFF, 0x00000000, 0x09800000),
+	uint4(0x3FFDF7DF, 0x0FFF7DF0, 0x03FFDF00, 0x00FFF000), uint4(0x003F4000, 0x00041000, 0x00410400, 0x09C00000),
+	uint4(0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF), uint4(0xFFFFFFFF, 0x0000C73D, 0x00000000, 0x0A000000),
+	uint4(0x00000000, 0x00000000, 0xFFFFFFFC, 0x38F3EFFF), uint4(0x0000020C, 0x00000000, 0x00000000, 0x0A400000),
+	uint4(0x3FFFF007, 0xFFFFFC70, 0xFFFFC003, 0xFE80703F), uint4(0x000703FF, 0x00703FE0, 0x00FA0000, 0x0A800000),
+	uint4(0x20C38F3E, 0x0C38F3E0, 0xC38F3E02, 0x38F3E020), uint4(0x8F3E020C, 0xF3E020C3, 0x00020C38, 0x0AC00000),
+	uint4(0x40000000, 0x3C30C300, 0x13CF3C43, 0xCF07FF3C), uint4(0xF7C3FFFF, 0xFFFFFFFF, 0x00FFFFFF, 0x0B000000),
+	uint4(0x431CF7BE, 0x10C73DF0, 0x0C73DF00, 0x431CF001), uint4(0x31CF0000, 0x0C780004, 0x00C20821, 0x0B400000),
+	uint4(0xFFFC0FFF, 0xFFC0FFFF, 0xFC0FFFFF, 0x00FFFFFF), uint4(0x0FFFFFF0, 0xFFFFFF00, 0x00FC0000, 0x0B800000),
+	uint4(0xFFF7CF3C, 0xFF7CF3CF, 0xF7CF3CFF, 0x7CF3CFFF), uint4(0xCF3CFFFF, 0xF3CFFFF7, 0x00FFFF7C, 0x0BC00000),
+	uint4(0x10410410, 0x0C30C304, 0xC30C30C3, 0x30C30C30), uint4(0x0C30C30C, 0xC30C30C3, 0x00C30C30, 0x0C000000),
+	uint4(0x200410C7, 0x08010C3E, 0x801043E3, 0x20043F38), uint4(0x0041FB8C, 0x801FBCE2, 0x00FFEE30, 0x0C400000),
+	uint4(0xFCE20000, 0xCE20001F, 0xE20001FF, 0x20001FFC), uint4(0x0001FFCE, 0x043FFCE2, 0x00FFCE20, 0x0C800000),
+	uint4(0x20820820, 0x0430C308, 0x61861841, 0x0C30C208), uint4(0x71C710C3, 0x0C71C71C, 0x000C30C3, 0x0CC00000),
+	uint4(0xBEFBEF80, 0xEFBEFBFF, 0xFBEFBEFB, 0xBEFBEFBE), uint4(0xEFBEFBEF, 0xFBEFBEFB, 0x007BEFBE, 0x0D400000),
+	uint4(0xCFFFFFB9, 0xFFFFFBDC, 0x7FFFFDCC, 0xFFFFCC47), uint4(0xFFFCC677, 0xFFCE677F, 0x00E233FF, 0x0D800000),
+	uint4(0x00000001, 0x08000008, 0x01002040, 0x08010200), uint4(0x40080040, 0x00000200, 0x00001002, 0x0DC00000),
+	uint4(0x000000CF, 0x00000CF0, 0x8000CFC2, 0x308CFE30), uint4(0x8CECFBCE, 0xF28FFEF3, 0x00FFFFFE, 0x0E000000),
+	uint4(0x00000000, 0x00000000, 0x00000000, 0x00000000), uint4(0x00000000, 0xE3800000, 0x00E38E38, 0x0E400000),
+	uint4(0x3EF38C1F, 0xFFB8C000, 0xFBCC0003, 0xBCE3003F), uint4(0xEE30000F, 0xF30000FF, 0x00000FFE, 0x0E800000),
+	uint4(0x00001000, 0x00000400, 0x00000180, 0x00000420), uint4(0x00004108, 0x80021042, 0x00108410, 0x0EC00000),
+	uint4(0xC0000000, 0xF000000F, 0xFC0000FF, 0xC0000FFF), uint4(0xF000FFFF, 0xFC0FFFFF, 0x00FFFFFF, 0x0F000000),
+	uint4(0x410C71CF, 0x10431C70, 0x0410C700, 0x01043000), uint4(0x00410000, 0x00100000, 0x00000000, 0x0F400000),
+	uint4(0xFFFFFFC0, 0xF7DF7E0F, 0x3DFFC07D, 0xEFBFF3CF), uint4(0x7DF71CF3, 0xDFF1C79E, 0x000E38F3, 0x0F800000),
+	uint4(0x01FBCC00, 0x3FFFFB80, 0xFFFFFF00, 0xFFFFF007), uint4(0xFFFF00FF, 0x7DF01FFF, 0x0047F7DF, 0x0FC00000),
+	uint4(0x00000000, 0x00000000, 0x00000000, 0x00000000), uint4(0x00000000, 0x82000000, 0x00820820, 0x10000000),
+	uint4(0x00000044, 0x00000460, 0x00004600, 0x00047000), uint4(0x00470000, 0x04700000, 0x00000000, 0x10400000),
+	uint4(0xDF7DF3CF, 0xFFFFFFF7, 0xFFFFFFFF, 0x3FFFFFFF), uint4(0x10000000, 0x0C304104, 0x000C30C3, 0x10800000),
+	uint4(0x38E38E38, 0x0C30C30E, 0x820820C3, 0x00000820), uint4(0x00000000, 0xFFF00000, 0x00FFFFFF, 0x10C00000),
+	uint4(0xC73CF3DF, 0x71CF3CF1, 0x1C73CF1C, 0xC71CF1C7), uint4(0x71C70C71, 0x1C70C31C, 0x000C30C7, 0x11000000),
+	uint4(0xC77FFFFF, 0x31DFFFF0, 0x0C77FF00, 0x031DF000), uint4(0x00C70000, 0x00300000, 0x00000000, 0x11400000),
+	uint4(0x000033B8, 0x00000030, 0x00000000, 0x00000800), uint4(0xCC000888, 0x0CE0000C, 0x00000000, 0x11800000),
+	uint4(0x9E7BEFBE, 0xE7BEFBE3, 0x73CF7C39, 0x38E78B1C), uint4(0x8E78A186, 0xC71A3863, 0x00830430, 0x11C00000),
+	uint4(0xCF7FFFFF, 0x73DFFFF1, 0x3DFFFF0C, 0xDFFFF0C7), uint4(0xF7FF0C73, 0x7FF0431C, 0x000431CF, 0x12000000),
+	uint4(0x30E3EFFC, 0xCFBFFFC8, 0xFFFFFCE3, 0xFFFFCF3F), uint4(0xF7DCFFFF, 0x3CC7DF7D, 0x003CF3CF, 0x12400000),
+	uint4(0x01084200, 0x00421080, 0x00108400, 0x00042000), uint4(0x00010000, 0x00000000, 0x00000000, 0x12800000),
+	uint4(0x8CE30000, 0xCE300001, 0xE3000018, 0x3000018C), uint4(0x000018CE, 0x00018CE3, 0x0018CE30, 0x12C00000),
+	uint4(0x007BCF38, 0x07FEFBC0, 0x7FFFFE00, 0xFFFFF000), uint4(0xFFFF8007, 0x7DFC207F, 0x006107DF, 0x13000000),
+	uint4(0x20830C38, 0x0830C380, 0x830C3802, 0x30C38020), uint4(0x0C380208, 0xC3802083, 0x00020830, 0x13400000),
+	uint4(0xFFFFF000, 0xFFFFFC0F, 0xFFFFC0FF, 0x3FFFF03F), uint4(0x0FFFFC00, 0x03FFFF00, 0x00FFFFC0, 0x13800000),
+	uint4(0x30C38A28, 0x0C38A28C, 0xC38A28C3, 0x38A28C30), uint4(0x8A28C30C, 0xA28C30C3, 0x00C30C38, 0x13C00000),
+	uint4(0xC0000000, 0x0000000F, 0x000000FC, 0x00000FFF), uint4(0x0000FFF0, 0x000FFF00, 0x00FFF000, 0x14800000),
+	uint4(0x9E79E79E, 0xE38E3CF7, 0x1E79E738, 0xE38E3187), uint4(0x1C710E38, 0xC3086186, 0x00820C30, 0x14C00000),
+	uint4(0x41041041, 0x00000000, 0x00000000, 0x00000000), uint4(0x00000000, 0x00000000, 0x00000000, 0x15000000),
+	uint4(0xDFFFFFBE, 0xF7DFFFF7, 0x7DF7FF3D, 0xCF7DF3CF), uint4(0xF3DF1CF3, 0x3CF1C73C, 0x000C71C7, 0x15800000),
+	uint4(0x00004104, 0x70000000, 0xDF7DC0DF, 0xE7DF79F7), uint4(0x69E79A69, 0x1A61061A, 0x00104106, 0x15C00000),
+	uint4(0x410C31C7, 0x10C31C70, 0x0C31C704, 0xC31C7041), uint4(0x31C70410, 0x1C70410C, 0x000410C3, 0x16000000),
+	uint4(0x4000007F, 0x000000F0, 0x00000104, 0x00000000), uint4(0x00000000, 0x00082000, 0x00C20820, 0x16400000),
+	uint4(0xFFFFFFC0, 0xFFFFFC07, 0xFFFFC07F, 0xFFFC07FF), uint4(0xFFC07FFF, 0xFC07FFFF, 0x007FFFFF, 0x16800000),
+	uint4(0xDF7FFFFF, 0xF7FFFFF3, 0x7FFFFF3D, 0xFFFFF3DF), uint4(0xFFFF3DF7, 0xFFF3DF7F, 0x003DF7FF, 0x16C00000),
+	uint4(0xBEFBEFBE, 0xEFBEFBEF, 0xFBEFBEFB, 0xBEFBEFBE), uint4(0xEFBEFBEF, 0xFBEFBEFB, 0x00FBEFBE, 0x17000000),
+	uint4(0x0083EFC0, 0x0C3FFC00, 0xE3FFC000, 0x3FFC0000), uint4(0xFFC0000F, 0xFC0020FB, 0x00030FFF, 0x17800000),
+	uint4(0x9E304EF9, 0xE30C03B7, 0x70C03FF9, 0x1C200FBE), uint4(0xC608FBEF, 0x608FBEF1, 0x00FBEF3C, 0x17C00000),
+	uint4(0xCF7FFFFF, 0x73DFFFF1, 0x1CF7FF0C, 0xC73DF043), uint4(0x31CF0010, 0x0C700004, 0x00000001, 0x18000000),
+	uint4(0x433FFFBC, 0x33DFFFE0, 0x1DFFFF00, 0xDFFFF003), uint4(0xFFFF0011, 0xFFF0011C, 0x008010CF, 0x18800000),
+	uint4(0x1C71C71C, 0xC71C71C6, 0x71C71C71, 0x1C71C71C), uint4(0xC71C71C7, 0x71E71C71, 0x0071C71C, 0x18C00000),
+	uint4(0xFEF38C07, 0xFFBCE30F, 0xFFEF38FF, 0xFFFBCFFF), uint4(0xFFFEFFFF, 0xFFF3FFFF, 0x0000FFFF, 0x19000000),
+	uint4(0xC77DF3C7, 0x73E78E10, 0x5F3C708C, 0x78E384C7), uint4(0xCF3C0C36, 0xFBE04473, 0x000867BE, 0x19400000),
+	uint4(0x18618618, 0x86186186, 0x61861861, 0x18618618), uint4(0x86186186, 0x61861861, 0x00618618, 0x19C00000),
+	uint4(0x3CF3CF3C, 0xEFBEFBEF, 0xFBEFBEFB, 0xFFFFFFBE), uint4(0xFFFFFFFF, 0xFFFFFFFF, 0x00FFFFFF, 0x1A000000),
+	uint4(0xCF7FFFFF, 0x31CF7FF1, 0x0C73DF04, 0x431CF001), uint4(0x00430000, 0x00180000, 0x00C20000, 0x1A400000),
+	uint4(0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFBCFFF), uint4(0x8C20FFFF, 0x000FFEF3, 0x00E30800, 0x1A800000),
+	uint4(0x010C73DF, 0x10C73DF0, 0x0431CF00, 0x010C7000), uint4(0x00430000, 0x04300000, 0x00800000, 0x1AC00000),
+	uint4(0xC73DFFFF, 0x73DFFFF8, 0x9CF7FFCE, 0xE73DFE73), uint4(0x31CFF39C, 0x8C7FBCE7, 0x00FFEF39, 0x1B000000),
+	uint4(0x000410C7, 0x00410C70, 0x0410C700, 0x410C7000), uint4(0x10C70000, 0x0C700004, 0x00000041, 0x1B400000),
+	uint4(0xF0C30C13, 0x8E38E193, 0xF3CF1C2F, 0xBEF8E15C), uint4(0xEF8E18EF, 0xFCF182FB, 0x000C17FF, 0x1B800000),
+	uint4(0x00000043, 0xF7FFFFF0, 0xFFFFFF1C, 0xFFFFFFFF), uint4(0x0FFFFFFF, 0x00000000, 0x00000000, 0x1C000000),
+	uint4(0x40000000, 0x00000000, 0xC30C3000, 0x3CF3CC30), uint4(0xFFFFF3CF, 0xFFF7FFFF, 0x000477FF, 0x1C400000),
+	uint4(0xDFFFFFFF, 0xFFFFFFF3, 0x7BEFBE1C, 0x3CF3C08E), uint4(0x8E38FC43, 0x820E7B21, 0x008239EF, 0x1C800000),
+	uint4(0xF2CBCE3C, 0x1CFAE3C8, 0xE79F3E87, 0x38F7DC71), uint4(0xCF3EC30E, 0xF3EC38E3, 0x0041861C, 0x1CC00000),
+	uint4(0xCF1C3040, 0xF3C70C17, 0xFDF3C7FD, 0x00FDF000), uint4(0x00000000, 0x00000000, 0x00000000, 0x1D000000),
+	uint4(0x00000043, 0x00000018, 0xE38C2000, 0xFFFFF7BC), uint4(0xF7FF3CF7, 0x3DF0C73C, 0x000430C7, 0x1DC00000),
+	uint4(0x00000FFF, 0x0000FFF0, 0x000FFF00, 0x00FFF000), uint4(0x0FFF0000, 0xFFF00000, 0x00000000, 0x1E000000),
+	uint4(0xB89FFFFF, 0xC4DF7DFF, 0x24F3CF7D, 0x071C73CE), uint4(0x38C31C71, 0xC410C308, 0x00041041, 0x1E400000),
+	uint4(0xC31C7BD0, 0x31C7BC00, 0x0C79C004, 0xE7DC0043), uint4(0x3DC00410, 0xDC00410E, 0x00001063, 0x1E800000),
+	uint4(0xDF7DF7DF, 0xF3CF3CF7, 0x3CF3CF3C, 0xCF3CF3CF), uint4(0x71C73CF3, 0x1C71C71C, 0x001C71C7, 0x1EC00000),
+	uint4(0x00000FFF, 0x0000FFF0, 0x000FFF00, 0x3FFFF000), uint4(0xFFFF0000, 0xFFF00003, 0x0000003F, 0x1F000000),
+	uint4(0x000001DF, 0x00000DF0, 0x0000CF00, 0x0004F000), uint4(0x00478000, 0x00780000, 0x00C00000, 0x1F400000),
+	uint4(0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x00000000), uint4(0x00000000, 0x00000000, 0x00000000, 0x1FC00000),
+	uint4(0xCF3CF7DF, 0xF3CF7DFB, 0x3CF7DFBC, 0xCF7DFBCF), uint4(0xF7DFBCF3, 0x7DFBCF3C, 0x00BCF3CF, 0x20000000),
+	uint4(0xCF3DF7DF, 0x71CF3CF3, 0x1C71CF1C, 0xC30C70C3), uint4(0x10C30410, 0x04100104, 0x00000000, 0x20400000),
+	uint4(0x44400003, 0xCC000030, 0xC0004704, 0x0004F0CC), uint4(0x00CF1DCC, 0x1DF1FCC0, 0x003FCC00, 0x20800000),
+	uint4(0x20820863, 0x08208638, 0xC2086382, 0x30C73C30), uint4(0x0C73C30C, 0xC31C30C3, 0x00E38C30, 0x20C00000),
+	uint4(0x0003FFFF, 0x000003F0, 0x0000000C, 0xC1000FCF), uint4(0xF1C0FFFF, 0xFDFFFFFF, 0x00FFFFFF, 0x21000000),
+	uint4(0x00000000, 0x00000000, 0x00000000, 0x00000000), uint4(0x00000000, 0xF38F38C2, 0x00FFFFFE, 0x21400000),
+	uint4(0xCF3DC43F, 0x31C622F9, 0x0426E7CC, 0x00F31C01), uint4(0xFFB8E200, 0xFFCF3000, 0x00F3003F, 0x21800000),
+	uint4(0x1860803F, 0x860823FE, 0x608200E5, 0x18200E78), uint4(0x8208E786, 0x208E7961, 0x00E79618, 0x21C00000),
+	uint4(0xFF000000, 0xF000000F, 0x000000FF, 0x00000FFF), uint4(0x0000FFF0, 0x000FFF00, 0x00FFF000, 0x22000000),
+	uint4(0x30800000, 0x8C20800C, 0xE30C20E3, 0x38E30F3C), uint4(0xCF38FBEF, 0xFBCFFFFB, 0x00FFFFFE, 0x22400000),
+	uint4(0x00001179, 0x10C301B0, 0x1C710B04, 0xCF7180C7), uint4(0xFF383CF3, 0xF387DF7F, 0x003FFFFF, 0x22800000),
+	uint4(0xEEC0830E, 0x7D3010E3, 0xDF89061E, 0xFAE020E7), uint4(0xBF320E3C, 0xF7C061CF, 0x00061C79, 0x22C00000),
+	uint4(0xFFFFFFFF, 0xFFFFFC0F, 0xFC0000FF, 0x00000FFF), uint4(0x0000FC00, 0xFFF00000, 0x00FFFFFF, 0x23000000),
+	uint4(0x000010C7, 0x08000038, 0xE20000E3, 0xB8C007BC), uint4(0xEF301CF7, 0x3FC0473D, 0x000010C7, 0x23800000),
+	uint4(0xDF7DF7DF, 0xE79E7DF7, 0x71C79E79, 0x1871C71C), uint4(0x06186186, 0x41041041, 0x00820820, 0x23C00000),
+	uint4(0xC6730800, 0x77FFFFF0, 0x7FFFFFEF, 0xFFFFF0C7), uint4(0xFFFF0C77, 0xFFF0C77F, 0x000C77FF, 0x24000000),
+	uint4(0x00FFC800, 0x0FFE8000, 0xFFEC0000, 0xFEC00003), uint4(0xFC0000FF, 0xE0003FFF, 0x0003FFFF, 0x24800000),
+	uint4(0xEF7DFFFF, 0xFFFFFFFF, 0x3FFFFF1F, 0x037FF421), uint4(0x0007C200, 0x000C2000, 0x00C20000, 0x24C00000),
+	uint4(0xC71CF7FF, 0x31C73DF0, 0x0C71CF04, 0x431C7001), uint4(0x10C70000, 0x04300000, 0x00000000, 0x25000000),
+	uint4(0x00000000, 0x0000000C, 0x000000C0, 0x00000C00), uint4(0x0000C000, 0x000C0000, 0x00C00000, 0x25400000),
+	uint4(0xFFFFFFC0, 0xFFFFFC07, 0xFFFFFB7F, 0xFFFFB3FF), uint4(0xFFF93FFF, 0xFF91FFFF, 0x001FFFFF, 0x25800000),
+	uint4(0xFEF32882, 0xE79F7FC7, 0x38E39E39, 0x8618E18E), uint4(0x20860861, 0xE32F3288, 0x0079F7FC, 0x25C00000),
+	uint4(0x20820C30, 0x0C30C380, 0xC38E3882, 0x38F3CC30), uint4(0xCF3EC38E, 0xFBEE38F3, 0x00F3CF3E, 0x26400000),
+	uint4(0x00000000, 0x00000008, 0x00000082, 0x00000C20), uint4(0x0000C208, 0x000C3080, 0x00E30820, 0x26800000),
+	uint4(0x20820820, 0xCF3CF3C8, 0x0431CF73, 0x00000000), uint4(0x00000000, 0x00004000, 0x001C1000, 0x26C00000),
+	uint4(0x00000830, 0x00000200, 0x00000000, 0x00000000), uint4(0x00000000, 0x00000000, 0x00000000, 0x27000000),
+	uint4(0xBEFBEFBE, 0xEFBEFBEF, 0x7BEFBEFB, 0xC739E18E), uint4(0x20810810, 0x18618608, 0x0078E386, 0x27400000),
+	uint4(0x2082086E, 0x08208678, 0x82082382, 0x20821820), uint4(0x08218208, 0x82002082, 0x00820820, 0x27800000),
+	uint4(0xB98C31C7, 0x9CC31C7F, 0xCC31C7FB, 0xC31C7F3D), uint4(0x31C7F7DC, 0x1C7E7CCE, 0x00E7CEE3, 0x27C00000),
+	uint4(0x001FFFFF, 0x0003FFF0, 0x00005F00, 0x00000000), uint4(0x00000000, 0x00000000, 0x00000000, 0x28400000),
+	uint4(0x00000000, 0xF0000000, 0xFFF000FF, 0xFFFFFFFF), uint4(0xFFFFFFFF, 0xFFFFFFFF, 0x00FFFFFF, 0x29000000),
+	uint4(0xFFFFFFFF, 0xEF3CF38F, 0xC30820FB, 0x00000E30), uint4(0x00000000, 0x00000000, 0x00000000, 0x29800000),
+	uint4(0xDFFFEF38, 0xFFFEF387, 0xFFFFBC7F, 0xFFFBDFFF), uint4(0x0FFD03FF, 0x00000000, 0x00000000, 0x29C00000),
+	uint4(0x3CE79CE7, 0xEF7DEF7F, 0xFC0000FB, 0x41084FFF), uint4(0x10C60000, 0x0C700004, 0x00000041, 0x2A000000),
+	uint4(0x18200EF9, 0x860803BE, 0x60803BE3, 0x18200E38), uint4(0x8200E38E, 0x608E38E1, 0x00E38E38, 0x2A400000),
+	uint4(0x000B8000, 0x00B80000, 0x0B800000, 0xB8000000), uint4(0x80000000, 0x0000000B, 0x000000B8, 0x2A800000),
+	uint4(0x000000DF, 0x00000DF0, 0x0000DF00, 0x000DF000), uint4(0x00DF0000, 0x0DF00000, 0x00000000, 0x2AC00000),
+	uint4(0x38C77020, 0xEFBC008E, 0xFFFFC1FF, 0xFFFC0FFF), uint4(0xFFC0FFFF, 0xFFFFFFFF, 0x00FFFFFF, 0x2B000000),
+	uint4(0xCF738C20, 0xFF38C211, 0xF39CE77F, 0x00FFFFFF), uint4(0x8C200010, 0xC2004731, 0x001DFF38, 0x2B800000),
+	uint4(0x60800FEF, 0x0800FEF8, 0x800FEF86, 0x00FEF860), uint4(0x0FEF8608, 0xFEF86080, 0x00860800, 0x2BC00000),
+	uint4(0x001FFFFF, 0x01FFFFF0, 0x1FFFFF00, 0xFFFFF000), uint4(0xFFFF0001, 0x1C00001F, 0x000001FF, 0x2C000000),
+	uint4(0x01042084, 0x10C31860, 0x0C718E04, 0xC73CE043), uint4(0xF3DF0C31, 0x7DF0C71C, 0x001C73CF, 0x2C400000),
+	uint4(0x00000FBF, 0x0000FFF0, 0x030FFF00, 0x3EFFF000), uint4(0xFFFF0000, 0xFFF00003, 0x00000C3F, 0x2C800000),
+	uint4(0xDF7DF7DF, 0xFFFFFFF7, 0xFFFFFFFF, 0xFFFFFFFF), uint4(0xFFFFFFFF, 0x041FFFFF, 0x00041041, 0x2CC00000),
+	uint4(0x00000000, 0x00000010, 0x00104100, 0x410C3000), uint4(0x30C70010, 0x1C70410C, 0x000C30C7, 0x2D000000),
+	uint4(0x00000001, 0x00000000, 0x00000080, 0x00000C00), uint4(0x0000E200, 0x000F3000, 0x00FB8000, 0x2D400000),
+	uint4(0x0003FFFF, 0x003FFFF0, 0x03FFFF00, 0x00FFF000), uint4(0x0FFF0000, 0xFFF04000, 0x00040000, 0x2D800000),
+	uint4(0x8E38C30C, 0x43082083, 0xE30E3810, 0xE79E7E38), uint4(0x71C7DF7D, 0x1C79E79C, 0x000C71C7, 0x2DC00000),
+	uint4(0xCF3CF3CF, 0x30C30C33, 0x8000008C, 0x20800C20), uint4(0x0C20E30C, 0xE30F38E3, 0x00FBCF38, 0x2E000000),
+	uint4(0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF), uint4(0xFFFFFFFF, 0xFDFFFFFF, 0x00FFFFFF, 0x2E400000),
+	uint4(0x00000FFF, 0x000003F0, 0x00000000, 0x00000000), uint4(0x00000000, 0x00000000, 0x00000000, 0x2E800000),
+	uint4(0x00000000, 0x00000800, 0x00008000, 0x02080000), uint4(0x20800000, 0x08000000, 0x00000082, 0x2EC00000),
+	uint4(0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF), uint4(0xFFCF7FFF, 0x1C13DFFF, 0x001CF7DF, 0x2F000000),
+	uint4(0x00000000, 0x08208200, 0x41041082, 0x18618410), uint4(0xC71C6186, 0x38E71C71, 0x0038E38E, 0x2F400000),
+	uint4(0x8003FFFF, 0x003FFFFF, 0x000FFFFC, 0x00FFFFFE), uint4(0x0FFFFFF0, 0xFFF3FFF8, 0x00007FC0, 0x2F800000),
+	uint4(0x30E38F3C, 0x0C38E3CC, 0x830C3883, 0x20C30020), uint4(0x0010F208, 0x7207DF72, 0x007DF7DF, 0x2FC00000),
+	uint4(0x20820800, 0x08208008, 0x82080082, 0x20800820), uint4(0x08008208, 0x80082082, 0x00820820, 0x30400000),
+	uint4(0xFFFFEF38, 0xFFFFF033, 0xFFC0011F, 0x000000FF), uint4(0x00000FFF, 0xC2005C00, 0x00F0EF38, 0x30800000),
+	uint4(0x79E59659, 0xBE79E79E, 0xEFBE79EF, 0xFBEFBEFB), uint4(0xBEFBEFBE, 0xFFB000EF, 0x00000000, 0x30C00000),
+	uint4(0xFFFFEFBE, 0xFFFFFFFF, 0x7DF7DFFF, 0xDF7DF7DF), uint4(0xF7DF7DF7, 0x3CF7DF7D, 0x003CF3CF, 0x31000000),
+	uint4(0x38FBFFFF, 0x00000308, 0x00000000, 0x00000000), uint4(0x00000000, 0x80080000, 0x00FBCE30, 0x31800000),
+	uint4(0xCF3DE71D, 0xF3DE71D1, 0x39E71D1C, 0x9E71D1CF), uint4(0xE7191CF3, 0x7191CF39, 0x001CF39E, 0x31C00000),
+	uint4(0xFFFFFFFF, 0xFFFFFFFF, 0x3DFFFF3D, 0xCF3DF1CF), uint4(0x31CF0C31, 0x0C30010C, 0x00000001, 0x32000000),
+	uint4(0xFF000000, 0xFFC0000F, 0xFFF000FF, 0xFFFFFFBF), uint4(0xFFFFF3EF, 0xFFFE3CFB, 0x00E38F3E, 0x32400000),
+	uint4(0x0003F000, 0x0000C000, 0x00000000, 0x00000000), uint4(0x00000000, 0x000000F0, 0x00000000, 0x32800000),
+	uint4(0xDF7DF010, 0xF7DF7C07, 0x3CF7DF3C, 0xCF3CF3CF), uint4(0xF3CF3CF3, 0x3CF1CF3C, 0x001871CF, 0x32C00000),
+	uint4(0x000410C7, 0x00010C30, 0x00104300, 0x00043000), uint4(0x00410000, 0x00100000, 0x00FC0000, 0x33000000),
+	uint4(0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFF03, 0x00FFF000), uint4(0x00000000, 0x00000000, 0x00000000, 0x33400000),
+	uint4(0xC000000F, 0x0000007F, 0x000003FC, 0x00003FC0), uint4(0x0001FF00, 0x000FFC00, 0x007FF000, 0x33800000),
+	uint4(0x00FFFFDF, 0x003FFDF0, 0x000FDF00, 0x0003F000), uint4(0x08200000, 0xE3882082, 0x00E38E38, 0x33C00000),
+	uint4(0x000410C7, 0x00010430, 0x00004180, 0x00001C00), uint4(0x0000F300, 0x000FB880, 0x00FFEE20, 0x34000000),
+	uint4(0x38E38E38, 0x8E38E38E, 0xF3CF3CE3, 0x3CF3CF3C), uint4(0xCF3CF3CF, 0xF3CF3CF3, 0x00F3CF3C, 0x34400000),
+	uint4(0x3CFBFFFF, 0xCFBFFFFE, 0xFFFFFFE3, 0xFFFFFF3E), uint4(0xFFFF71EF, 0x7FF39F7F, 0x0018F3DF, 0x34800000),
+	uint4(0xCE38C308, 0x6184101B, 0x0803FB9C, 0xFDF798C2), uint4(0xCF388401, 0x7188DEFB, 0x00FDE79C, 0x34C00000),
+	uint4(0x00000000, 0xFFFFFFF0, 0xFFFFFFFF, 0xFFFFFFFF), uint4(0xFFFFFFFF, 0xFFFFFFFF, 0x00FFFFFF, 0x35000000),
+	uint4(0x20000046, 0x8C20043C, 0xF38C21F3, 0xFEF38FFE), uint4(0xFFFEFFFF, 0xFFFFFFFF, 0x00FFFFFF, 0x35400000),
+	uint4(0xDFFFFE00, 0xFFFFE007, 0xFFFE007D, 0xFFE007DF), uint4(0xFE007DFF, 0xE007DFFF, 0x007DFFFF, 0x35800000),
+	uint4(0x0C30C718, 0xC71C7593, 0xF7DF7971, 0xFFFFB75D), uint4(0x0100F7DF, 0x10000000, 0x00104104, 0x35C00000),
+	uint4(0x01041082, 0x00410430, 0x00104100, 0x00041000), uint4(0x00010000, 0x00000000, 0x00000000, 0x36000000),
+	uint4(0x430C73DF, 0x10C73CF0, 0x0C71CF04, 0xC31CF001), uint4(0x31CF0010, 0x1C700104, 0x00000043, 0x36400000),
+	uint4(0x00FF8000, 0x0FF80000, 0xFF800000, 0xF8000000), uint4(0x8000000F, 0x000000FF, 0x00000FF8, 0x36800000),
+	uint4(0x00000000, 0xEFBEFBE0, 0xFFFFFFFB, 0x8E38EFFF), uint4(0xE38E38E3, 0x30C38E38, 0x0030C30C, 0x36C00000),
+	uint4(0xF8000000, 0xF800000F, 0xF00000FF, 0xF0000FFF), uint4(0xE000FFFF, 0xE00FFFFF, 0x007DFFFF, 0x37000000),
+	uint4(0xC73DF7FF, 0x30C73DF8, 0x0431C784, 0x00043800), uint4(0x00018200, 0x00082000, 0x00C20000, 0x37800000),
+	uint4(0x431C73DF, 0x30C73DF0, 0x0C73CE04, 0xC718C041), uint4(0x21080010, 0xF3C0010C, 0x00F3DF3C, 0x37C00000),
+	uint4(0xC77FFFFF, 0x77FFFFF0, 0x7FFFFF0C, 0xFFFFF0C7), uint4(0xFFFF0C77, 0xFFF0C77F, 0x000C77FF, 0x38000000),
+	uint4(0xBCE30803, 0xCE30803F, 0xE30803FB, 0x30803FBC), uint4(0x0803FBCE, 0x803FBCE3, 0x00FBCE30, 0x38400000),
+	uint4(0xFFF38800, 0x0000000F, 0xFFFFFF00, 0xFFFFFFFF), uint4(0xFFBCFFFF, 0x000FFFFF, 0x00F38800, 0x38800000),
+	uint4(0x410C3186, 0x10430860, 0x04108200, 0x01002000), uint4(0x00000000, 0xFBF00000, 0x00FFFFFF, 0x38C00000),
+	uint4(0x20000043, 0x00000418, 0x00000180, 0x00000000), uint4(0xFFFEE308, 0xFFEFFFFF, 0x007FFFFF, 0x39400000),
+	uint4(0x30800001, 0x8C000013, 0xC200013B, 0x300013BC), uint4(0x88013FEE, 0xC013FFF3, 0x003FFFB8, 0x39800000),
+	uint4(0x4103FEF3, 0x3080EF30, 0x084FF70C, 0x840370C3), uint4(0xC2001C71, 0x2001C718, 0x003CF38C, 0x39C00000),
+	uint4(0xFFFFF0C1, 0xFFFF3C0F, 0xFFFFC0FF, 0xFFFC1FFF), uint4(0xFFC7FFFF, 0xFDFFFFFF, 0x00FFFFFF, 0x3A000000),
+	uint4(0x00000000, 0xFFFF0000, 0xFFF03FFF, 0xFF03FFFF), uint4(0xFFC0FFFF, 0xFC0FFFFF, 0x00FFFFFF, 0x3A800000),
+	uint4(0x08C20061, 0xCA20C113, 0xE308189A, 0x30A089A4), uint4(0x8C2CCB4C, 0xD24CFAF3, 0x00E7AE38, 0x3AC00000),
+	uint4(0xD1410C30, 0x72C92180, 0x2C70C13C, 0x5D3C7E5B), uint4(0xCF1DF3CF, 0xFBEF3CF3, 0x00FBEFBE, 0x3B000000),
+	uint4(0x00000003, 0x00000000, 0x00000000, 0x00000000), uint4(0x00000000, 0x00000000, 0x00000000, 0x3B400000),
+	uint4(0x3CF3CF3C, 0xCF3CF3CF, 0xFBEFBEF3, 0xBEFBEFBE), uint4(0xFFFFFBEF, 0xFFFFFFFF, 0x00FFFFFF, 0x3B800000),
+	uint4(0xDF7DF7DF, 0xF3CF3CF7, 0x1C71C73C, 0xC30C31C7), uint4(0x10410C30, 0x82086104, 0x00C30820, 0x3BC00000),
+	uint4(0xFF7CF1C3, 0xF7CF1C3F, 0x7CF1C3FF, 0xCF1C3FFF), uint4(0xF1C3FFF7, 0x1C3FFF7C, 0x00FFF7CF, 0x3C000000),
+	uint4(0x00000000, 0x00000000, 0x000000FC, 0x00000FC0), uint4(0x0000FC00, 0x000FFF00, 0x00FFF000, 0x3C400000),
+	uint4(0x00000000, 0x00000000, 0x00000000, 0xBEFBE000), uint4(0xFFFFFBEF, 0xFFFFFFFF, 0x00FFFFFF, 0x3CC00000),
+	uint4(0x30C30C30, 0x0C30C30C, 0xE38E38C3, 0x38E38E38), uint4(0x8E38E38E, 0xF3CE38E3, 0x00F3CF3C, 0x3D000000),
+	uint4(0xCF3DF7DF, 0x73CF3DF3, 0x1C73CF1C, 0xC71C70C7), uint4(0x30C70C30, 0x0C30410C, 0x00001041, 0x3D400000),
+	uint4(0x0000003F, 0x000003F0, 0x00003FFC, 0x0003F000), uint4(0x003F03F0, 0x03F03F00, 0x0003FFC0, 0x3D800000),
+	uint4(0xFFFBCC21, 0xFFBCC613, 0xFBCC631F, 0xBCC630DF), uint4(0xDC6304FF, 0xCE3007FB, 0x000037BD, 0x3DC00000),
+	uint4(0xCF3CF3CF, 0xF7DF7DF3, 0x7DF7DF7D, 0xDF7DF7DF), uint4(0xFFFF7DF7, 0xFFF03FFF, 0x0003FFFF, 0x3E000000),
+	uint4(0xBEFFFFFF, 0xEFFFFFFF, 0xFFFFFFFB, 0xFFFFFFBE), uint4(0xFFFFFBEF, 0xFFFFBEFF, 0x00FBEFFF, 0x3E400000),
+	uint4(0x3FFCF0C6, 0xFFCF0C00, 0xFCF0C001, 0xCF0C0000), uint4(0xF0C0000F, 0x8E000004, 0x0082082F, 0x3E800000),
+	uint4(0xFFFFFFFF, 0x0FFFFFFF, 0x00000000, 0x00000000), uint4(0xFFC0FC00, 0xFFFFFFFF, 0x00FFFFFF, 0x3EC00000),
+	uint4(0xFFFDF001, 0xFFFF000F, 0xFFF000FF, 0xFF040FFF), uint4(0xF0C07FFF, 0x1C00DFFF, 0x000037FF, 0x3F000000),
+	uint4(0xFFFFFF30, 0xFFFFF30F, 0xFFFF30FF, 0xFFF30FFF), uint4(0xFF30FFFF, 0xF30FFFFF, 0x00FFFFFF, 0x3F400000),
+	uint4(0x000017B0, 0x00000DE0, 0x00000300, 0x00000000), uint4(0x00000000, 0x00080000, 0x00FA0000, 0x3F800000),
+	uint4(0x5D77CF3C, 0x534D75C3, 0x0C11451C, 0x01041041), uint4(0x20821000, 0x18218618, 0x00386186, 0x3FC00000),
+	uint4(0x0003FFFF, 0x00000000, 0x00000000, 0x00000000), uint4(0x00000000, 0x00000000, 0x00000000, 0x40000000),
+	uint4(0x7D00410C, 0x008618EF, 0x0C71CF00, 0xC71CF041), uint4(0x71CF0410, 0x1CF0410C, 0x000410C7, 0x40400000),
+	uint4(0x006E73DF, 0x07FCC010, 0x7FFFB800, 0xFFFFF000), uint4(0xFFFFC007, 0x0C71887F, 0x00000731, 0x40800000),
+	uint4(0x200000CF, 0x00000C7C, 0x800047C2, 0x00047E30), uint4(0x0043E308, 0x003E3080, 0x00F38C20, 0x41000000),
+	uint4(0x00000000, 0x00000000, 0x00000000, 0xC0000FC0), uint4(0xFFC0FFFF, 0xFFFFFFFF, 0x00FFFFFF, 0x41400000),
+	uint4(0xF083CFFE, 0xE038FFFF, 0x6107DF7F, 0xE079F7DF), uint4(0xE30F3CF3, 0xE071C73C, 0x001C71C7, 0x41800000),
+	uint4(0x30C30C30, 0x8E38E38C, 0xE38E38E3, 0x38E38E38), uint4(0xC71CE38E, 0x30C71C71, 0x0030C30C, 0x41C00000),
+	uint4(0x3080003F, 0x880003FF, 0x80003FF3, 0x0003FFB8), uint4(0x003FFB88, 0x03FFB8C0, 0x00FBCC00, 0x42000000),
+	uint4(0x00000FFF, 0x0000FFF0, 0x00003F00, 0x0003F000), uint4(0x003F0000, 0x03F00000, 0x00000000, 0x42400000),
+	uint4(0x86186186, 0x61861861, 0x08208218, 0x82082082), uint4(0x10410820, 0x04104104, 0x00041041, 0x42800000),
+	uint4(0x20800000, 0x08208008, 0x82082082, 0x30820430), uint4(0x0C30410C, 0xC3061043, 0x00618610, 0x42C00000),
+	uint4(0x00000000, 0x00000000, 0x00000000, 0x00000000), uint4(0x00000000, 0x00000000, 0x00FC0000, 0x43400000),
+	uint4(0xFEC0004F, 0xFF201DFF, 0x05B3FF0F, 0x46C0F000), uint4(0xFF200000, 0xFF80000D, 0x000013FF, 0x43800000),
+	uint4(0xC31C71C6, 0x30C71C70, 0x0C71C70C, 0xC31C70C3), uint4(0x31C70C30, 0x0C70C30C, 0x000C30C3, 0x43C00000),
+	uint4(0xFF000FFF, 0x0000FFFF, 0x00003FFC, 0x0003FFC0), uint4(0x003F0000, 0x03F00000, 0x00000000, 0x44000000),
+	uint4(0x00820C38, 0x0830C380, 0x830E3800, 0x30E3C020), uint4(0x8E3C020C, 0xF3C820C3, 0x00830C38, 0x44400000),
+	uint4(0x00000000, 0x08208200, 0xE38E3882, 0x3CF3CE38), uint4(0xFFFFF3CF, 0xFFFFFFFF, 0x00FFFFFF, 0x44800000),
+	uint4(0xCF1C3040, 0xFFDF3C77, 0xFFFFFFFF, 0xFFFFFFFF), uint4(0xFFFFFFFF, 0xFFFFFFFF, 0x00FFFFFF, 0x44C00000),
+	uint4(0xFFFFFFC0, 0xFFFFFC0F, 0xFFFFC0FF, 0xFFFC0FFF), uint4(0xFFC0FFFF, 0xFC0FFFFF, 0x00FFFFFF, 0x45000000),
+	uint4(0x00000020, 0x00000208, 0x00002080, 0x00020800), uint4(0x00208000, 0x02080000, 0x00800000, 0x45400000),
+	uint4(0x1F7DF7B0, 0xF7DF7B0A, 0x7DF7B081, 0xDF7F881E), uint4(0xF7F8C1E7, 0x7F881E7D, 0x0081C7DF, 0x45800000),
+	uint4(0xCF3DE79C, 0xF3DF7DE1, 0x3DF7DF1C, 0xDF7DF1CF), uint4(0xFFDFDEF3, 0x400000FF, 0x0010C210, 0x45C00000),
+	uint4(0x00000000, 0x00000000, 0x000000E0, 0x80000FFC), uint4(0xF000FFFF, 0xFE0FFFFF, 0x0003FFFF, 0x46000000),
+	uint4(0x38E38E3C, 0x8E38E3CE, 0xE38E3CE3, 0x38E3CE38), uint4(0x8E3CE38E, 0xE3CE38E3, 0x00E38E38, 0x46400000),
+	uint4(0x20820820, 0x08208208, 0x82082082, 0x20820820), uint4(0x08208208, 0x82082082, 0x00820820, 0x46800000),
+	uint4(0xFFFFEF38, 0xFFFFFFFF, 0xFFFFFFFF, 0x00000FFF), uint4(0x00000000, 0x00000000, 0x00F38C20, 0x46C00000),
+	uint4(0xDFFFFFFE, 0x77FFFFF3, 0x1CFFFF0C, 0x433DF001), uint4(0x00C70000, 0x00100000, 0x00000000, 0x47000000),
+	uint4(0x00820C30, 0x00000000, 0x00000000, 0x00000000), uint4(0x00000000, 0x00000000, 0x00000000, 0x47800000),
+	uint4(0x00000000, 0x08200008, 0xE30C20C3, 0x3CE38F38), uint4(0xEFBC79EF, 0xFFF3DF7F, 0x001CF3DF, 0x47C00000),
+	uint4(0x30820800, 0x0820800C, 0x820800C3, 0x20800C30), uint4(0x0800C308, 0x800C3082, 0x00C30820, 0x48400000),
+	uint4(0xCF7FFFFF, 0xF7FFFFF1, 0x7FFFFF1C, 0xFFFFF1CF), uint4(0xFFFF1CF7, 0xFFF1CF7F, 0x001CF7FF, 0x48800000),
+	uint4(0xDEFBCF39, 0xF7BCF387, 0x79EF383D, 0x8E73C1CF), uint4(0xE31C0C73, 0x30C0C318, 0x00043086, 0x48C00000),
+	uint4(0x30C30C30, 0x0C30C304, 0xC30C3043, 0x30C30430), uint4(0x0C30430C, 0xC30430C3, 0x00430C30, 0x49000000),
+	uint4(0xC0000C3C, 0x0030F3FF, 0xC3CFFFFC, 0x3FFFF3C0), uint4(0xFFFF0D0F, 0xFFFC04FF, 0x00F013FF, 0x49400000),
+	uint4(0x00000001, 0x10C73DF0, 0x7FFFFF00, 0xFFFFF1CF), uint4(0xFFFFFFFF, 0x000FFFFF, 0x00000000, 0x49800000),
+	uint4(0xC71DFBFF, 0x31CF7FF1, 0x0C73CF04, 0xC73DF005), uint4(0x31CF0810, 0x0C708014, 0x00002005, 0x49C00000),
+	uint4(0xDFFFFFFF, 0xFFFFFFF3, 0xFFFFFF1D, 0xFFFFF1CF), uint4(0xFFFF0CF7, 0xFFF0C77F, 0x000473FF, 0x4A000000),
+	uint4(0x0000007F, 0x000003F0, 0x00003F00, 0x0003F000), uint4(0x003F0000, 0x03F00000, 0x00000000, 0x4A800000),
+	uint4(0xC7186186, 0x69A61040, 0xD349248A, 0x38C30C34), uint4(0xCC30E3CE, 0xD34E3CF3, 0x00CB6DB6, 0x4AC00000),
+	uint4(0x00000000, 0x08000000, 0xE30820C2, 0xBCE38F38), uint4(0xFFBEFFEF, 0xFFFFFFFF, 0x00FFFFFF, 0x4B000000),
+	uint4(0xFF000FFF, 0xFFC003FF, 0xFFF03FFF, 0xFFFFFFFF), uint4(0xFFC0FFFF, 0x000FFFFF, 0x00FFFFFF, 0x4B400000),
+	uint4(0xF800004F, 0x800004FF, 0x00004FFF, 0x0004FFF8), uint4(0x004FFF80, 0x04FFF800, 0x00FF8000, 0x4B800000),
+	uint4(0x0000003C, 0x000083E0, 0x000C3F00, 0x00E3F000), uint4(0x0F3F0000, 0xFBF00002, 0x00000030, 0x4BC00000),
+	uint4(0x001FFFFF, 0x005FFFF0, 0x007FFF00, 0x017FF000), uint4(0x01FF0000, 0x05F00000, 0x00000000, 0x4C000000),
+	uint4(0xFFFFEFBD, 0xFFFFFFE7, 0xFFFFFF3F, 0xFFFFF1DF), uint4(0xFFFF0CF7, 0x7FF0473D, 0x008031CF, 0x4C400000),
+	uint4(0xDFF30800, 0xFFB88007, 0xFFCC007D, 0xFEE207DF), uint4(0xEF307DFF, 0xF387DFFF, 0x007DFFFF, 0x4C800000),
+	uint4(0x00FFEFBC, 0x30C003D0, 0x1C61840C, 0xDE79C3C7), uint4(0xEFBC7DF7, 0xFBCFFFFF, 0x0003FFFE, 0x4CC00000),
+	uint4(0xDFFFFFC0, 0xFFFFFC03, 0xFFFFC01D, 0xFFFC01CF), uint4(0xFFC00CF7, 0xFC00C77F, 0x000473FF, 0x4D400000),
+	uint4(0xFFFFFFFF, 0xFFFFFFFF, 0xFBEFBEFF, 0x3CF3CFBE), uint4(0x0C30F3CF, 0x000C30C3, 0x00000000, 0x4DC00000),
+	uint4(0x00000000, 0x00000008, 0x00000080, 0x00000800), uint4(0x00008000, 0x00080000, 0x00800000, 0x4E400000),
+	uint4(0x30FBF000, 0x8FBF0000, 0xFFF00003, 0xFFFC083C), uint4(0xFFC0C3CF, 0xFC0E3EFF, 0x00E3FFFF, 0x4E800000),
+	uint4(0xCF7FFFFF, 0x31CF7FF1, 0x8E7BB004, 0x210C7821), uint4(0x0001FFFF, 0x000E0000, 0x00000000, 0x4EC00000),
+	uint4(0x00820830, 0x0820C300, 0x830C3002, 0x30C38820), uint4(0x0E38820C, 0xE38830C3, 0x00C30C38, 0x4F000000),
+	uint4(0x00000001, 0x00000018, 0x00000180, 0x00003800), uint4(0x00438000, 0x04380000, 0x00800000, 0x4F400000),
+	uint4(0xFFFFFFDF, 0xFFFFFDFF, 0xFFFFFFFF, 0xFFFFFFFF), uint4(0xFFFFFFFF, 0xFFFFFFFF, 0x00FFFFFF, 0x4F800000),
+	uint4(0xE38E38E2, 0x1861861C, 0x40000145, 0xFFBEF010), uint4(0x7DE7FFFF, 0xCF7DF7DF, 0x00CF3CF3, 0x4FC00000),
+	uint4(0x38E38E38, 0x8E38E38E, 0xE38E38E3, 0x38E38E38), uint4(0x8E38E38E, 0xE38E38E3, 0x00E38E38, 0x50400000),
+	uint4(0x000410CF, 0x318425B0, 0x79CE3904, 0xBCE381CF), uint4(0xCE387FFF, 0xE38FFFFB, 0x00FFFFBC, 0x50C00000),
+	uint4(0x000477FF, 0x00477FF0, 0x0477FF00, 0x477FF000), uint4(0x77FE0000, 0x7BC00004, 0x00000047, 0x51000000),
+	uint4(0x00000043, 0x00000010, 0x00000080, 0x20000C20), uint4(0x0800E30C, 0xC20F3CE3, 0x007FEF38, 0x51400000),
+	uint4(0x0001FFC0, 0x007FFC00, 0xFFFFE000, 0xFFFF0000), uint4(0xFFF8003F, 0xFFC03FFF, 0x001FFFFF, 0x51800000),
+	uint4(0x3CE38E3C, 0xEEBAE38F, 0xEFBEF3FB, 0xF3CF3EFB), uint4(0x38E3CF3C, 0x8C3CF38E, 0x008638E3, 0x51C00000),
+	uint4(0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF), uint4(0xF7DFFFFF, 0x0431C73C, 0x00000001, 0x52000000),
+	uint4(0x71CF79EF, 0x18E71CFE, 0x0C71CFC7, 0xC71CF861), uint4(0x71CF0410, 0x1CF0410C, 0x000410C7, 0x52400000),
+	uint4(0x010C73DF, 0x00431C70, 0x00104380, 0x00001C20), uint4(0x0000E308, 0x820F38C2, 0x007BCE30, 0x52800000),
+	uint4(0x30820800, 0x0C30C20C, 0xE38C30E3, 0x3CE38F38), uint4(0xCF3CF3CF, 0xFBEFBEFB, 0x00FFFFFE, 0x52C00000),
+	uint4(0xCF3DF7DF, 0xF3DF7DF3, 0x3DF7DF3C, 0xDF7DF3CF), uint4(0xF7DF3CF3, 0x7DF3CF3D, 0x003CF3DF, 0x53000000),
+	uint4(0x0000003F, 0x00000000, 0x00000000, 0x00000000), uint4(0x00000000, 0x00000000, 0x00000000, 0x53400000),
+	uint4(0x8410410C, 0x20861041, 0x0C208208, 0x41043041), uint4(0x10410410, 0x82082080, 0x00C20820, 0x53C00000),
+	uint4(0x00000000, 0x00000000, 0x82082000, 0x00000820), uint4(0x00000000, 0x00000000, 0x00000000, 0x54000000),
+	uint4(0xCF3DF7DE, 0x71CF3CE1, 0x0C71C60C, 0x430C2043), uint4(0x10410010, 0x04600000, 0x00000000, 0x54400000),
+	uint4(0xC31C73DF, 0x31C73DF0, 0x1C73DF0C, 0xC73DF0C3), uint4(0x73DF0C31, 0x3DF0C31C, 0x000C31C7, 0x54800000),
+	uint4(0x30C20841, 0x8E30C216, 0x718E3071, 0x9C73838C), uint4(0xE39C1CE3, 0xBCE8E71C, 0x00CF39E7, 0x54C00000),
+	uint4(0xCF7FFFFF, 0x10C73DF1, 0x0010C700, 0x00001000), uint4(0x00000000, 0x00000000, 0x00000000, 0x55000000),
+	uint4(0x000410C3, 0x00010C38, 0x00104300, 0x01042000), uint4(0x00000000, 0xF7F00000, 0x00FFFFBE, 0x55400000),
+	uint4(0xFF000FFF, 0xF03CFFFF, 0x03FFFFFF, 0x3FFFFFFF), uint4(0xFFFF3DF8, 0xFFF0C77B, 0x000011CF, 0x55800000),
+	uint4(0xCF7FFFFF, 0x00433DF8, 0xE20001F3, 0xB8C00FFC), uint4(0xFF30FFFF, 0xFFEFFFFF, 0x00FFFFFF, 0x55C00000),
+	uint4(0x00000000, 0x00000000, 0x00000000, 0x30800C20), uint4(0xE718FBCE, 0x7DF7DF7D, 0x007DF7DF, 0x56000000),
+	uint4(0x9CF38E30, 0xE73CE387, 0x79CF3839, 0x9E73C3DE), uint4(0xE7BC3CF7, 0x79E3CF3D, 0x009CF3CF, 0x56C00000),
+	uint4(0x79CE31C7, 0xCE718C3F, 0xE31843FB, 0x38C21FBC), uint4(0xCE30FFEF, 0xE30FFFFB, 0x00FFFFBC, 0x57000000),
+	uint4(0x00000003, 0x00000030, 0x00000300, 0x00003000), uint4(0x00030000, 0x00300000, 0x00000000, 0x57400000),
+	uint4(0x00000000, 0x00000008, 0x80000182, 0x00001C20), uint4(0x0041C208, 0x841C3082, 0x00E30C20, 0x57800000),
+	uint4(0xBEF3C1C4, 0xEFBE1C0F, 0xFFE180FB, 0xFF1C1FFF), uint4(0xF1C0FFFF, 0x1C0FFFFF, 0x00FFFFFF, 0x57C00000),
+	uint4(0xDF1C1FFE, 0xF7C707EF, 0xFDF1C0FF, 0xFF7C6FFF), uint4(0xFFDEFFFF, 0xFFEFFFFF, 0x00FFFFFF, 0x58000000),
+	uint4(0x30C20800, 0x0C20800E, 0xC20800E3, 0x20800E30), uint4(0x0800E30C, 0x800E30C2, 0x00E30C20, 0x58400000),
+	uint4(0xB98C73DC, 0xEE610C73, 0xFB884303, 0xFEE20007), uint4(0xFFB8C00F, 0xFFE7300F, 0x003CC43F, 0x58800000),
+	uint4(0xEFBCF3CF, 0xFBEF3CFB, 0xBEF3CFBE, 0xEFBCFBEF), uint4(0xFBCFBEFB, 0x9E7FEFBE, 0x00DE79E7, 0x58C00000),
+	uint4(0x001FFFFF, 0x00017FF0, 0x00000700, 0x00000000), uint4(0x00000000, 0x000FC000, 0x00FFF000, 0x59000000),
+	uint4(0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF), uint4(0xFFDFFFFF, 0x3C7FFFFF, 0x00FFFFDF, 0x59400000),
+	uint4(0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF), uint4(0xF7DFFFFF, 0x7DF7DF7D, 0x007DF7DF, 0x59800000),
+	uint4(0x9E79E79E, 0xE79E79E7, 0x79E79E79, 0xDF7DF79E), uint4(0xF7DF7DF7, 0x3CF7DF7D, 0x003CF3CF, 0x59C00000),
+	uint4(0xFFFB8C00, 0xFFB8C00F, 0xFB8C00FF, 0xB8C00FFF), uint4(0x8C00FFFF, 0xC00FFFFB, 0x00FFFFB8, 0x5A400000),
+	uint4(0xC718618E, 0x30C30C31, 0x04104104, 0x00000000), uint4(0x00000000, 0x00000000, 0x00000000, 0x5A800000),
+	uint4(0x0C30C30C, 0xE38E38E3, 0x3CF3CF38, 0xCF3CF3CF), uint4(0xF3CF3CF3, 0xBEF3CF3C, 0x00BEFBEF, 0x5AC00000),
+	uint4(0x000001DF, 0x00000DF0, 0x0000CF00, 0x0004F000), uint4(0x00460000, 0xFBFFC000, 0x00FFFFFF, 0x5B400000),
+	uint4(0xFFFFEE30, 0xFFFFF38F, 0x0013BCFF, 0xCF3DE000), uint4(0xFFFF0C71, 0xFFFFFFFF, 0x00FFFFFF, 0x5B800000),
+	uint4(0xFFFC0007, 0xFFC0007F, 0xFC0007FF, 0xC0007FFF), uint4(0x0007FFFF, 0x007FFFFC, 0x00FFFFC0, 0x5BC00000),
+	uint4(0xC30C1047, 0x71C70C20, 0x3CF1C63C, 0xDF7CE7CF), uint4(0xFFDEFFF7, 0xFFE3FFFF, 0x0000FFFF, 0x5C000000),
+	uint4(0x3CF3CF3C, 0xCF3CF3CF, 0xF3CF3CF3, 0x3CF3CF3C), uint4(0xCF3CF3CF, 0xF3CF3CF3, 0x00F3CF3C, 0x5C400000),
+	uint4(0x3FFF803F, 0xFFFFF2F0, 0xFFF7FD03, 0xFF0C003F), uint4(0x700003FF, 0x00003FFC, 0x0003F3C0, 0x5C800000),
+	uint4(0x30C30C30, 0x1C71C71C, 0xCF3CF3C7, 0xF3CF3CF3), uint4(0x7DF7CF3C, 0xDF7DF7DF, 0x00DF7DF7, 0x5CC00000),
+	uint4(0xC0000003, 0xFFC0002F, 0xFFF000FF, 0xFFFBBFFF), uint4(0xEF33FFFF, 0xE23FFFFF, 0x00FFFFBC, 0x5D400000),
+	uint4(0x007FFFFF, 0x01FFFFF0, 0x07FFFF00, 0x1FFFF000), uint4(0x7FFF0000, 0xFFF00000, 0x00000001, 0x5D800000),
+	uint4(0xF3CF3CF3, 0x9E79E79C, 0x61861965, 0x0C30C218), uint4(0x618630C3, 0x8E718618, 0x008E38E3, 0x5DC00000),
+	uint4(0x20000043, 0x0800043C, 0xC20001E3, 0x30801F38), uint4(0x8C217BCE, 0xC217FEF3, 0x007FEF38, 0x5E000000),
+	uint4(0x000001DF, 0x00001DF0, 0x0001DF00, 0x001DF000), uint4(0x01DF0000, 0x1DF00000, 0x00000000, 0x5E400000),
+	uint4(0xFFFB8800, 0xFFFCC00F, 0xFFCC00FF, 0xFCC00FFF), uint4(0xEE20FFFF, 0xE677FFFF, 0x000011DE, 0x5E800000),
+	uint4(0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF), uint4(0xFFFF03FF, 0xFFF000FF, 0x0000003F, 0x5EC00000),
+	uint4(0xDF7E0418, 0xF3DF8103, 0x3CF3E03C, 0xCF3EF3CF), uint4(0xF3CF3CF3, 0x3CF1873C, 0x001871C7, 0x5F000000),
+	uint4(0x00000000, 0x00000000, 0x00000080, 0x00000C20), uint4(0x0000E308, 0x00063080, 0x00318C20, 0x5F400000),
+	uint4(0x0000003F, 0x000003F0, 0x000000FC, 0x0000003F), uint4(0x000003F0, 0x000000FC, 0x00000FFF, 0x5F800000),
+	uint4(0xDF7DF7DF, 0xF3CF3CF7, 0x1C71C73C, 0xC30C31C7), uint4(0x18610C30, 0xF3C86186, 0x00F3CF3C, 0x5FC00000),
+	uint4(0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF), uint4(0xFFFFFFFF, 0x3FF0477F, 0x00000003, 0x60000000),
+	uint4(0x00000000, 0x00000000, 0xF38C2080, 0xFFFFFFFE), uint4(0xFFFFFFFF, 0xFFFFFFFF, 0x00FFFFFF, 0x60400000),
+	uint4(0xFFF300C7, 0xFFB00CFF, 0xFB90CFFF, 0xB99CFFFF), uint4(0x99DF03FF, 0x9DF000FF, 0x0000003F, 0x60800000),
+	uint4(0x00EFBEF9, 0x0FFFF791, 0xF7DF7D00, 0xFDF3C000), uint4(0xEFBE080F, 0xFBE000FF, 0x00040FBE, 0x60C00000),
+	uint4(0xBCF38C21, 0x8C30801F, 0x800001F3, 0x00001E30), uint4(0x00018200, 0x00100000, 0x00000000, 0x61000000),
+	uint4(0x30000000, 0x0000000F, 0x000000F3, 0x00000F30), uint4(0x0000F300, 0x000F3000, 0x00F30000, 0x61400000),
+	uint4(0xFF0001FF, 0xFC0003FF, 0xF0003FFF, 0xC0007FFF), uint4(0x0000FFFF, 0x000FFFFF, 0x00FFFFFC, 0x61800000),
+	uint4(0x00000000, 0x00000000, 0x00000000, 0x00001000), uint4(0x00410000, 0x04100000, 0x00000001, 0x61C00000),
+	uint4(0x0003FFB8, 0x003FFB80, 0x03FFB800, 0x3FFB8000), uint4(0xFFB80000, 0xFB800003, 0x0000003F, 0x62000000),
+	uint4(0x9E79CF3C, 0xF3CF7DF7, 0x1C73CF3C, 0xC31C71C7), uint4(0x10C30C30, 0x04104104, 0x00000000, 0x62400000),
+	uint4(0xC73DF7FF, 0x73DF7FF0, 0x3DF7FF0C, 0xDF7FF0C7), uint4(0xF7FF0C73, 0x7FF0C73D, 0x000C73DF, 0x62800000),
+	uint4(0xCF7C0830, 0xF7FF0201, 0x7FF0001C, 0xFFFC01CF), uint4(0xFFC01CF7, 0xFFF1CF7F, 0x001CF7FF, 0x62C00000),
+	uint4(0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF), uint4(0xFFFFFFFF, 0xFFFFFFFF, 0x003DFFFF, 0x63400000),
+	uint4(0x00001041, 0x00000010, 0x82000082, 0x00820420), uint4(0x04100104, 0x21020821, 0x00104208, 0x63C00000),
+	uint4(0xFF000000, 0xF000000F, 0x000000FF, 0x00000FFF), uint4(0x0000FFF0, 0x000FFF00, 0x00FFFFC0, 0x64000000),
+	uint4(0x0000083F, 0x00000380, 0x00000000, 0x00000000), uint4(0x00000000, 0x00000000, 0x00000000, 0x64800000),
+	uint4(0xBCF38E30, 0xFFFFFFFF, 0xFFFFFFFF, 0xDF7CFFFF), uint4(0x1841FDF7, 0xF3CEF3CE, 0x00FFFFBE, 0x64C00000),
+	uint4(0x3CF3C705, 0xCF3C704F, 0xF3CF04F3, 0xBEF8EF3C), uint4(0xEF8EFBEF, 0xF8EFBEFB, 0x00FBEFBE, 0x65000000),
+	uint4(0x00000043, 0x00000410, 0x00000100, 0x00001800), uint4(0x00018000, 0x00080000, 0x00800000, 0x65400000),
+	uint4(0x0003FFFF, 0x0000FFF0, 0x000FFF00, 0x00FFF000), uint4(0x0FFF0000, 0x03F00000, 0x00000000, 0x65800000),
+	uint4(0x000410C3, 0x00410C30, 0x0010C300, 0x01043000), uint4(0x10430000, 0x04300000, 0x00C00001, 0x65C00000),
+	uint4(0x00000000, 0x00000000, 0x00000000, 0x00000000), uint4(0xEFBE0000, 0xF3CFBEFB, 0x00F3CF3C, 0x66000000),
+	uint4(0x04000020, 0x00000000, 0xFFFDFF00, 0x7FFF7FBF), uint4(0xDEFFFFEF, 0xF7BFFFFB, 0x00FFFFBE, 0x66400000),
+	uint4(0x00000020, 0x00000000, 0x00000000, 0x00000000), uint4(0x00000000, 0x00000000, 0x00FC0000, 0x66800000),
+	uint4(0x400010CF, 0x00000CF0, 0x0000C704, 0x00047040), uint4(0x00470410, 0x04304100, 0x000C1000, 0x66C00000),
+	uint4(0x3CF3CF3C, 0xEFBEFBEF, 0xFFFFFFFB, 0xFFFFFFFF), uint4(0xFFFFFFFF, 0xFFFFFFFF, 0x00FFFFFF, 0x67000000),
+	uint4(0xC0000FFF, 0x0000FFFF, 0x000FFF00, 0x00FFF000), uint4(0x0FFF0000, 0xFFF00000, 0x00000000, 0x67800000),
+	uint4(0x000431CF, 0x00431CF0, 0x0431CF00, 0x431CF000), uint4(0x31CF0000, 0x1CF00004, 0x00000043, 0x67C00000),
+	uint4(0x30C30C30, 0x0C30C30C, 0xC30C30C3, 0x38E38C30), uint4(0x8E38E38E, 0xF3CE38E3, 0x00F3CF3C, 0x68000000),
+	uint4(0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF), uint4(0xF7DFFFFF, 0x3CF7DF7D, 0x003CF3CF, 0x68400000),
+	uint4(0xFEE30800, 0xFFB8C003, 0xFFCE300F, 0xFFF3804F), uint4(0xFFBC007F, 0xFFE0017F, 0x000001FF, 0x68800000),
+	uint4(0xE73DF7FE, 0x7BCF7FE8, 0x9CF7FFCE, 0xCF7FFCE7), uint4(0xF7DFCE39, 0x3DFC739E, 0x00C739EF, 0x68C00000),
+	uint4(0x00000000, 0x00000000, 0x00000000, 0x00000E00), uint4(0x0000FF00, 0x000FFF80, 0x00FFFF80, 0x69000000),
+	uint4(0xBCE20047, 0xEF30801F, 0x7B8C203D, 0xCCE300C7), uint4(0x23180011, 0x084F2004, 0x00FFFFB0, 0x69800000),
+	uint4(0xF8000003, 0x0000003F, 0x000003FA, 0x00003E00), uint4(0x00038000, 0x00300000, 0x00000000, 0x69C00000),
+	uint4(0xFFFFFFFE, 0xFFFFFFF7, 0xFFFFFD7F, 0xFFFFD7FF), uint4(0xFFF97FFF, 0xFF97FFFF, 0x007FFFFF, 0x6A000000),
+	uint4(0x0003FFFF, 0x003FFFF0, 0x03FFFF00, 0x3FFFF000), uint4(0xFFFF0000, 0xFFF00003, 0x0000003F, 0x6A400000),
+	uint4(0xFEF388DF, 0xEF38803F, 0xF38800FF, 0x388007FE), uint4(0x88000DEF, 0x80000273, 0x00FFE018, 0x6A800000),
+	uint4(0x00000FFF, 0x000003F0, 0x00003F00, 0x00000000), uint4(0x00000000, 0x00000000, 0x00000000, 0x6AC00000),
+	uint4(0xC73CF3DF, 0x73CE39E1, 0x38E31C1C, 0x0C3181C6), uint4(0x82181863, 0x01010430, 0x00000208, 0x6B400000),
+	uint4(0x67E3EFFF, 0x819FFFF0, 0x0037FF83, 0x000CFE3E), uint4(0x0001FBF0, 0x000FFFFC, 0x00FFFFC0, 0x6B800000),
+	uint4(0xCF3DF7DF, 0x73CF3DFB, 0x9CF3CFDE, 0xE71CF037), uint4(0x79C70BBD, 0xCE70C2EF, 0x000410BB, 0x6C000000),
+	uint4(0xFFFFFFBE, 0xFFFFFBEF, 0xFFFFFEFF, 0xFFFFF03F), uint4(0xFFFF000F, 0xFFF00003, 0x00000000, 0x6C400000),
+	uint4(0x00000000, 0x00000000, 0x00000000, 0x00000000), uint4(0x10C70000, 0xFFF00000, 0x000C73DF, 0x6C800000),
+	uint4(0x00000FFF, 0x000003F0, 0x00000000, 0xFFFFF000), uint4(0xFFFFFFFF, 0xFC0FFFFF, 0x00FFFFFF, 0x6CC00000),
+	uint4(0x0000001F, 0x000001F0, 0xE38E1800, 0xFFFDFE38), uint4(0xFFDFFFFF, 0xFDFFFFFF, 0x00FFFFFF, 0x6D000000),
+	uint4(0x0000008C, 0x000008C0, 0x00008C00, 0x0008C000), uint4(0x008C0000, 0x08C00000, 0x00000000, 0x6D400000),
+	uint4(0xCF7FFF00, 0xF7FFF001, 0x7FFF001C, 0xFFF001CF), uint4(0xFF001CF7, 0xF001CF7F, 0x001CF7FF, 0x6D800000),
+	uint4(0xE73DFFFF, 0x73DFFFFC, 0x3DFFFFCE, 0xDFFFFCE7), uint4(0xFFFFCE73, 0xFFFCE73D, 0x00CE73DF, 0x6DC00000),
+	uint4(0x00042108, 0x00431880, 0x04318C00, 0x031CC000), uint4(0x11CE0000, 0x0CE00000, 0x00800001, 0x6E000000),
+	uint4(0x0000004F, 0x00000DF0, 0x0001FF00, 0x013FF000), uint4(0x37FF0000, 0xFFF00000, 0x00000007, 0x6E400000),
+	uint4(0xFFFFFFFF, 0xFFFFFFF3, 0xFFFFFF1F, 0x38C200DF), uint4(0xFFFF04EF, 0xFFF007FF, 0x000037FF, 0x6EC00000),
+	uint4(0x208209DF, 0x082084F8, 0x82082382, 0x30C31820), uint4(0x0C30C30C, 0xC30C30C3, 0x00C30C30, 0x6F400000),
+	uint4(0x00000FFF, 0x0000FFF0, 0x000FFF00, 0x00FC3000), uint4(0x0FC00000, 0xCE0C2080, 0x00F38E30, 0x6F800000),
+	uint4(0xE79C71C7, 0x79C71C78, 0x9C71C78E, 0xC71C78E7), uint4(0x71C78E79, 0x1C78E79C, 0x008E79C7, 0x6FC00000),
+	uint4(0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFF000FFF), uint4(0x0000FFFF, 0x000FFF00, 0x00000000, 0x70000000),
+	uint4(0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xDFFFF3DF), uint4(0xFBDF1CF3, 0x5DF8E39E, 0x00C31CF3, 0x70400000),
+	uint4(0x00000C00, 0x0000FC00, 0x000FC000, 0x30FC0000), uint4(0xFFC00000, 0xFC000003, 0x0000003F, 0x70800000),
+	uint4(0xC71C71C7, 0x71C71C71, 0x8E38E31C, 0xE38E38E3), uint4(0x38E38E38, 0x8E38E38E, 0x008E38E3, 0x70C00000),
+	uint4(0x431CF7FF, 0x31CF7FF0, 0x1CF7FF04, 0xCF7FF043), uint4(0xF7FF0431, 0x7FF0431C, 0x000431CF, 0x71000000),
+	uint4(0x201FFFFF, 0xC5DF7DFE, 0x1300007D, 0xFEE20000), uint4(0xFFB80001, 0xFFF0001F, 0x000001FF, 0x71400000),
+	uint4(0x41000000, 0x00000000, 0x00000000, 0x20820000), uint4(0x0C308208, 0xE38C30C3, 0x00E38E38, 0x71800000),
+	uint4(0x618E39E7, 0x18E38E78, 0x8638E786, 0x638E7861), uint4(0x38E38218, 0x8E382186, 0x00821861, 0x71C00000),
+	uint4(0x00000000, 0x00000000, 0x00000000, 0x00000000), uint4(0x00000000, 0xC3000000, 0x00C30C30, 0x72400000),
+	uint4(0xFFFFFF38, 0xFFFFF38F, 0xFFFF38FF, 0xFFF38FFF), uint4(0xFF38FFFF, 0xF38FFFFF, 0x00FFFFFF, 0x72800000),
+	uint4(0x00000046, 0x00000010, 0xFC000000, 0xFFFFFFFF), uint4(0xFFFFFFFF, 0xFFFFFFFF, 0x007FFFFF, 0x73400000),
+	uint4(0xFFFFEFBE, 0xEFBEF3CF, 0xF3CF38FB, 0x38E38F3C), uint4(0x0C30F38E, 0x820E38C3, 0x00C30C20, 0x73800000),
+	uint4(0xBCF3CF79, 0xCF3CE79F, 0xE38E79F3, 0x38E71F3C), uint4(0x0C71F38E, 0xC71E38E3, 0x00E38C30, 0x73C00000),
+	uint4(0xDF7FFFFF, 0xF3DF7FF3, 0x1CF3DF1C, 0xC71CF0C7), uint4(0x30C70430, 0x04300104, 0x00000001, 0x74400000),
+	uint4(0x0003FFC0, 0x003FFFF0, 0x03FFFF00, 0x3FFFF000), uint4(0xFFFF0000, 0xFFF00003, 0x0000003F, 0x74800000),
+	uint4(0x00000000, 0x00000000, 0x00000000, 0xCF3CF000), uint4(0x00003CF3, 0x00000000, 0x00000000, 0x74C00000),
+	uint4(0x00000F3F, 0x000083F0, 0x00003E00, 0x00030000), uint4(0x00000000, 0x00000000, 0x00800000, 0x75800000),
+	uint4(0x38E30C23, 0x0820000F, 0x000000C3, 0x00000820), uint4(0xF0007C00, 0xFFF1DFFF, 0x000C77FF, 0x75C00000),
+	uint4(0x00000000, 0x0000000C, 0x00000000, 0x00000000), uint4(0xFFFF0000, 0xFFFFFFFF, 0x00FFFFFF, 0x76400000),
+	uint4(0xC00033FF, 0xF0011DFF, 0x0000CFFF, 0x00047FFF), uint4(0x0003FFF0, 0x001FFF00, 0x00FFF000, 0x76800000),
+	uint4(0x00001FFF, 0x00007FF0, 0x0003FF00, 0x201FF820), uint4(0x80EFE38C, 0x07B79E70, 0x001C70C2, 0x76C00000),
+	uint4(0xCF3C71C3, 0xF3C71C37, 0x3C71C37C, 0xC71C37CF), uint4(0x71C37CF3, 0x1C37CF3C, 0x007CF3C7, 0x77000000),
+	uint4(0x30E38EDC, 0x8E38FDCC, 0xE3CF4CC3, 0x3CF4EE38), uint4(0xCFCEE38F, 0xF86E3CF3, 0x00F3CF3E, 0x77800000),
+	uint4(0xFFFC0000, 0xFFFF000F, 0xFFF000FF, 0xFF000FFF), uint4(0xFFC0FFFF, 0xFC0FFFFF, 0x00FFFFFF, 0x77C00000),
+	uint4(0xC000003F, 0x000003FF, 0x00003F00, 0x0003F000), uint4(0x003F0000, 0x03F00000, 0x00FC0000, 0x78000000),
+	uint4(0xC00001F8, 0xFFFC1FFF, 0x8001FFFF, 0x001FFFFE), uint4(0x01FFC000, 0x1FE00000, 0x00000000, 0x78800000),
+	uint4(0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFCFFF, 0xC7000FFF), uint4(0x0000FFFF, 0x0007C300, 0x00000000, 0x78C00000),
+	uint4(0xFEF38C20, 0x0800000F, 0x000000E3, 0x00000000), uint4(0x0820C208, 0xE30E38C3, 0x00FBCF38, 0x79000000),
+	uint4(0xFF000000, 0xFFC0000F, 0xFFF00003, 0x00FC0000), uint4(0x00000000, 0x00000000, 0x00000000, 0x79400000),
+	uint4(0xFFFFF03F, 0xFFFF03FF, 0xFFF03FFF, 0xFF03FFFF), uint4(0xF03FFFFF, 0x03FFFFFF, 0x00FFFFFF, 0x79800000),
+	uint4(0x8E7BEFBE, 0x239EFBE0, 0x08E7BEFC, 0xC239EFBF), uint4(0xF08EFBEF, 0xFC2FBEFB, 0x00FBEFBE, 0x79C00000),
+	uint4(0xB8C0003F, 0xEE3003FF, 0xFB8C1FFF, 0xFEE3FFFF), uint4(0xF780FFFF, 0x3C2FFFFF, 0x00FFFFFF, 0x7A000000),
+	uint4(0xDFFFFFFF, 0xFFFFFFF3, 0x7FFFFF9C, 0xDFFFF2E7), uint4(0xFFFF00BB, 0x7FF0003C, 0x00000087, 0x7A400000),
+	uint4(0xFFF20003, 0xFE000031, 0xC000031F, 0x000031FE), uint4(0x00031FC8, 0x0031F800, 0x001B0000, 0x7A800000),
+	uint4(0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF), uint4(0xFFFF7FFF, 0xFFF7DFFF, 0x007DF7FF, 0x7B000000),
+	uint4(0xFFFFF000, 0xFFFFFC0F, 0xFFFFC0FF, 0xFFFC0FFF), uint4(0xFFFF03FF, 0xFFF03FFF, 0x00000FFF, 0x7B800000),
+	uint4(0x40000047, 0x10000030, 0x0000010C, 0x400001C3), uint4(0x00003C70, 0x0007CF0C, 0x00FDF1C1, 0x7BC00000),
+	uint4(0x000433DF, 0x00031CF0, 0x0010CF00, 0x000C7000), uint4(0x00430000, 0x00300000, 0x00000000, 0x7C000000),
+	uint4(0xC21C73DF, 0x00C71CFF, 0x0430C7FC, 0x01063F81), uint4(0x0061F800, 0x820FFF00, 0x00FFF000, 0x7C800000),
+	uint4(0xC71C70C3, 0x71C30C31, 0x0C30C31C, 0xC30C11C7), uint4(0x30411C30, 0x0410C30C, 0x000C30C1, 0x7CC00000),
+	uint4(0xDF020E3E, 0xF030F3F3, 0x038FBF1C, 0x1CFFF0C7), uint4(0xEFFF0430, 0x7FF02100, 0x00030007, 0x7D000000),
+	uint4(0xBEFBEFBE, 0xEFBEFBFF, 0xFBFFFFFB, 0xFFFFFFBE), uint4(0xFFFFFBFF, 0x7DFFFFFF, 0x007DF7DF, 0x7D400000),
+	uint4(0xFF000003, 0xFFC0001F, 0xFFFFC0FF, 0xFFFFFFFF), uint4(0xFFFFFFFF, 0xFFFFFFFF, 0x007FFFFF, 0x7E000000),
+	uint4(0xDF7DF3CF, 0xF3CF3C7F, 0xBE71C77D, 0xF7CE3BEF), uint4(0xBEF9037D, 0xF7D000EF, 0x0008003D, 0x7E400000),
+	uint4(0xFF83EFFF, 0xF83EFFF7, 0x83EFFF7F, 0x3EFFF7FF), uint4(0xEFFF7FF8, 0xFFF7FF83, 0x007FF83E, 0x7E800000),
+	uint4(0x00000FFF, 0xFFFFFFF0, 0xFFFFC0FF, 0xFF000FFF), uint4(0x0000FFFF, 0x000FFFFC, 0x00FFF000, 0x7EC00000),
+	uint4(0xB8800001, 0xCC00000F, 0xE20000FF, 0xB8800FFE), uint4(0xCC003FFF, 0xE2004FFF, 0x000013FE, 0x7F000000),
+	uint4(0xFFFFFFFF, 0xFFFFFFF7, 0x7FFFFF7D, 0xDFFFF3DF), uint4(0xF7FF3CF7, 0x7DF1CF3D, 0x001C73CF, 0x7F400000),
+	uint4(0x38E38E40, 0xCF3CF40E, 0xFBE182F3, 0xFF001FBE), uint4(0xF0017FFF, 0x0003FFFF, 0x003FFFC7, 0x7F800000),
+	uint4(0x00000043, 0x00000430, 0x00000100, 0x00020000), uint4(0x08200000, 0x82000000, 0x00000020, 0x7FC00000),
+	uint4(0xCF1C3040, 0xF1C30407, 0x1C30407C, 0xC30407CF), uint4(0x30407CF1, 0x0407CF1C, 0x007CF1C3, 0x80000000),
+	uint4(0x000010C7, 0x31CF7FFF, 0xFFFFFFF4, 0xFFFFF31F), uint4(0xFFFFF00F, 0xFFFF0003, 0x00F00000, 0x80400000),
+	uint4(0xFFFC0FFF, 0xFFFF03FF, 0xFFF000FF, 0xFFFC0FFF), uint4(0xFFFFFFFF, 0xFFFFFFFF, 0x0003FFFF, 0x80800000),
+	uint4(0xFF7DF3CF, 0xF3CF1C7F, 0x1C70C37D, 0xC30413CF), uint4(0x10001C70, 0x0000C304, 0x00041000, 0x80C00000),
+	uint4(0x0003FFFF, 0x0000FFF0, 0x00003F00, 0x00000000), uint4(0x00000000, 0x00080000, 0x00C00000, 0x81000000),
+	uint4(0x20800007, 0x0820000C, 0xC20800E3, 0x30820E38), uint4(0x8C20F38E, 0xE30FBCE3, 0x00FBEF38, 0x81400000),
+	uint4(0xA001FFFF, 0x80007FFF, 0x80001FFF, 0x00000FFE), uint4(0x0000FFFE, 0x000FFFFA, 0x00FFFFF8, 0x81800000),
+	uint4(0x38C30821, 0x4F28C10F, 0x9AC318FB, 0xCE39CCF6), uint4(0xF3DECE79, 0x3DE8E71C, 0x000C71CF, 0x81C00000),
+	uint4(0xFFFFFFFE, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF), uint4(0xFFFFFFFF, 0xFFFF3FFF, 0x0083CFFF, 0x82000000),
+	uint4(0x000017FF, 0x000FFFF0, 0x1FFFFF00, 0xFFFFF000), uint4(0xFFFF003F, 0xFFF05FFF, 0x003FFFFF, 0x82400000),
+	uint4(0x00000000, 0x00000000, 0x00000000, 0xFFFFFFC0), uint4(0xFFFFFFFF, 0xFFFFFFFF, 0x00FFFFFF, 0x82800000),
+	uint4(0x30410FEF, 0x8400FF7C, 0x20803FE1, 0x0403F618), uint4(0x003D30C1, 0x03F38618, 0x00186082, 0x82C00000),
+	uint4(0xBCE30801, 0xCE308007, 0xE3080039, 0x38C2039C), uint4(0x8C201CE7, 0xC201CE73, 0x001CE738, 0x83000000),
+	uint4(0x00000000, 0x00000000, 0x82082000, 0x3CF3C820), uint4(0xFFFFF3CF, 0xFFFFFFFF, 0x00FFFFFF, 0x83400000),
+	uint4(0xC7000003, 0x08200033, 0xF38E331F, 0xFFF823BC), uint4(0xF0033FFF, 0x0033FFFF, 0x003FFFC0, 0x83800000),
+	uint4(0x00F7DF3C, 0x203FFBE0, 0x080FFE18, 0xC107F182), uint4(0x30411C70, 0x0411C70C, 0x003C71C3, 0x83C00000),
+	uint4(0x00FFFFFF, 0x0FFFFFF0, 0xFFFFFF00, 0x3FFFF000), uint4(0xFFFF0000, 0xFFF00003, 0x0000003F, 0x84000000),
+	uint4(0xFEFBEFBE, 0xEFBEFBEF, 0xFFFFFFFB, 0xFFFFF03F), uint4(0xFFFF000F, 0xFFF00003, 0x00000000, 0x84400000),
+	uint4(0x3FF0003F, 0xFF0003F0, 0xF0003F03, 0x0000003F), uint4(0x000003FF, 0x00003FF0, 0x0003FF00, 0x84800000),
+	uint4(0x10420000, 0x9CE39C72, 0xC30800E7, 0x30820F38), uint4(0x0C20F38E, 0x400F3CE3, 0x00184208, 0x84C00000),
+	uint4(0xFFFFFFFF, 0xFFFFFFFF, 0x7FFFFF7F, 0xCF7DF3CF), uint4(0x31CF0C71, 0x0438010C, 0x00C30801, 0x85000000),
+	uint4(0x30E3CF3E, 0x0E3CF3EC, 0xE3CF3EC3, 0x3CF3EC30), uint4(0xCF3EC30E, 0xF3EC30E3, 0x00C30E3C, 0x85400000),
+	uint4(0x30C38E38, 0x0C38E38C, 0xC38E38C3, 0x38E38C30), uint4(0x8E38C30C, 0xE38C30C3, 0x00C30C38, 0x85800000),
+	uint4(0x00000000, 0xFFFFFFF0, 0xFFFFFFFF, 0xFFFFFFFF), uint4(0xFFFFFFFF, 0x3DF7DF7F, 0x001C73CF, 0x86000000),
+	uint4(0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF), uint4(0xFFFFFFFF, 0x7DF7DF7F, 0x001CF3CF, 0x86400000),
+	uint4(0x800DFFFF, 0x00DFFFFF, 0x0DFFFFF8, 0xDFFFFFC0), uint4(0xFFFFFC00, 0xFFFFE00D, 0x00FE00DF, 0x86800000),
+	uint4(0xFFFC0001, 0xFFFFFC07, 0x7FFFFF3D, 0xFFFFF1CF), uint4(0xFFFF1CF7, 0x7FF0C73D, 0x000431CF, 0x86C00000),
+	uint4(0x00000000, 0x00000000, 0x00000000, 0xC1040040), uint4(0x79E31C30, 0x5CFFEFBE, 0x00C30C53, 0x87000000),
+	uint4(0x00000000, 0x00000000, 0x00000000, 0x00000000), uint4(0x0C300000, 0xF3CC30C3, 0x00F3CF3C, 0x87400000),
+	uint4(0x3FFFF000, 0xFFFFC000, 0xFFFFC003, 0xFFFC003F), uint4(0xFFF8F3FF, 0xFFF3FFFF, 0x00007FFF, 0x87800000),
+	uint4(0xC73DFFFF, 0x73DFFDF0, 0x218E380C, 0xDFFFFEC7), uint4(0xFFFF0C73, 0xFFF0C73D, 0x000C73DF, 0x87C00000),
+	uint4(0x00FFF000, 0x0FFF0000, 0x03FFC000, 0x3FFC0000), uint4(0x0FFF0000, 0xFFF00000, 0x00000000, 0x88000000),
+	uint4(0x000000CE, 0x00000CE8, 0x0000CE80, 0x000CE800), uint4(0x00CE8000, 0x0CE80000, 0x00800000, 0x88400000),
+	uint4(0x00C3CC00, 0x0E3EF000, 0xF3FFC002, 0xBFFC0030), uint4(0xFFC0038F, 0x7C083CFF, 0x0041E7DF, 0x88800000),
+	uint4(0x8C318611, 0x430C6191, 0x30C71818, 0x8C318186), uint4(0xE31C1C61, 0x38C8C618, 0x008C7186, 0x88C00000),
+	uint4(0x0000003C, 0x0000E3FC, 0x038FFFC0, 0x3FFFFC00), uint4(0xFFFFC00C, 0x3CFC30FB, 0x0080E3CF, 0x89400000),
+	uint4(0xC0000047, 0xF000047F, 0x000047FF, 0x00047FFF), uint4(0x0047FFF0, 0x047FFF00, 0x00FFFFC0, 0x89800000),
+	uint4(0x82000004, 0x00000820, 0x00104004, 0x00000000), uint4(0x00000000, 0x82082000, 0x00400000, 0x89C00000),
+	uint4(0xC0000000, 0xF000000F, 0xFFF000FF, 0xFFFC0FFF), uint4(0xFFFFFFFF, 0xFFFFFFFF, 0x00FFFFFF, 0x8A000000),
+	uint4(0xC0000020, 0xF000000F, 0x000000FF, 0xC0000FBF), uint4(0xF000F3EF, 0xFC0E3CFF, 0x00C38FBF, 0x8A400000),
+	uint4(0x679E0820, 0xF047FFF8, 0x000047FC, 0x000007C0), uint4(0x00000400, 0xE3800000, 0x00E38E38, 0x8A800000),
+	uint4(0x1FFFEF39, 0xFFFEF380, 0xFFFFBCFC, 0xFFFBCFC7), uint4(0xFFFEFC3F, 0xFFEFC1FF, 0x00FC0FFF, 0x8B800000),
+	uint4(0x20800000, 0x08208008, 0x82082082, 0x30820C30), uint4(0x0C30C30C, 0xC30E30C3, 0x00E38E30, 0x8BC00000),
+	uint4(0x00000004, 0x00000040, 0x00000400, 0x00004000), uint4(0x00040000, 0x00400000, 0x00000000, 0x8C800000),
+	uint4(0x0003FFB8, 0x003FFBC0, 0x03FFFC00, 0x3FFFC000), uint4(0xFFFC0000, 0xFFE00003, 0x0000003F, 0x8CC00000),
+	uint4(0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF), uint4(0xFFFF03FF, 0xFFF03FFF, 0x0003FFFF, 0x8D800000),
+	uint4(0x00020820, 0x0820C300, 0x830C3002, 0x10618820), uint4(0x861C0104, 0x30C41061, 0x00008208, 0x8DC00000),
+	uint4(0x00000000, 0x01084200, 0x30842000, 0x18C20084), uint4(0x8C200843, 0xC2018C73, 0x0038C738, 0x8E000000),
+	uint4(0x00FFFC00, 0x003FFA00, 0x03FFFC00, 0x3FFFF000), uint4(0xFFFF0000, 0xFFF00003, 0x00000000, 0x8E400000),
+	uint4(0x30C30C30, 0x0820820C, 0x82082082, 0xDF7DF820), uint4(0xF7DF7DF7, 0x3CF7DF7D, 0x003CF3CF, 0x8EC00000),
+	uint4(0x00830F3E, 0x0C3CFBF0, 0xE3EFFF02, 0xBFFFF830), uint4(0xF7DFC38F, 0x3CF61C7D, 0x0030F3CF, 0x8F000000),
+	uint4(0xFF000000, 0xFFFF000F, 0xFFFFFFFF, 0xFFFFFFFF), uint4(0xFFFFFFFF, 0xFFFFFFFF, 0x00FFFFFF, 0x90000000),
+	uint4(0x00000000, 0x00000000, 0xE38E3800, 0xFFFFFE38), uint4(0xFFFFFFFF, 0xFFFFFFFF, 0x00FFFFFF, 0x90400000),
+	uint4(0xC1000FFF, 0x1000FFF0, 0x000FFF0C, 0x00FFF0C1), uint4(0x0FFF1C10, 0xFFF1C100, 0x001C3000, 0x90800000),
+	uint4(0x3CF3CF3C, 0xEFBCF3CF, 0xFBEFBEFB, 0xBEFBEFBE), uint4(0xF7DFFFEF, 0x7FF7DF7D, 0x003CF7DF, 0x90C00000),
+	uint4(0x00000000, 0x00000000, 0x80000080, 0x30800E30), uint4(0x8E30F38E, 0xF38FFEF3, 0x00FFFFFE, 0x91000000),
+	uint4(0x1871CF3C, 0x871CF3C6, 0x71CF3C61, 0x1CF3C618), uint4(0xCF3C6187, 0xF3C61871, 0x0061871C, 0x91400000),
+	uint4(0x00000000, 0x00000000, 0x00000000, 0x00000000), uint4(0xF7DF0000, 0x0417DF7D, 0x00041041, 0x91800000),
+	uint4(0xCF3CF3DF, 0xF3CF3CF3, 0x3CF3CF3C, 0xCF3CF3CF), uint4(0x73CF1C73, 0x1C71C71C, 0x009E71C7, 0x91C00000),
+	uint4(0x410C71CF, 0x10C71CF0, 0x0C71CF04, 0xC71CF041), uint4(0x71CF0410, 0x1CE0410C, 0x000410C7, 0x92000000),
+	uint4(0xC31C71CF, 0x71C73CF0, 0x3CF3DF0C, 0xCF7DF1C7), uint4(0xF7FF1CF3, 0xFFF3CF7D, 0x003DF7DF, 0x92400000),
+	uint4(0x3FFFFFBC, 0xF3CF7DC4, 0x0C71C65E, 0x41042EE3), uint4(0x0003E300, 0x07FF3080, 0x00F38800, 0x92800000),
+	uint4(0x0C10007B, 0xC3040073, 0x30C00030, 0x0C10030C), uint4(0xC30070C3, 0x30C71C30, 0x0071C70C, 0x92C00000),
+	uint4(0x00000000, 0x08000000, 0x80000063, 0x00000E30), uint4(0x0000E308, 0x000E3080, 0x00E30800, 0x93000000),
+	uint4(0x00000000, 0x00000000, 0x04104100, 0x41041041), uint4(0x10410410, 0x0C304104, 0x000C30C3, 0x93400000),
+	uint4(0xFFFBCE30, 0xFFFEF30F, 0xFFEF38FF, 0xFFFBCFFF), uint4(0xFFBC7FFF, 0xFFE3FFFF, 0x001FFFFF, 0x93800000),
+	uint4(0x9C7182C7, 0xC7182C77, 0x7182C779, 0x182C779C), uint4(0x82C779C7, 0x2C779C71, 0x0079C718, 0x93C00000),
+	uint4(0x00030E3C, 0x0E3CFBF0, 0xFBFFFF02, 0xFFFFFC3C), uint4(0xFFFFFBFF, 0x3CFFFFFF, 0x003CF3CF, 0x94400000),
+	uint4(0xFFF20000, 0xFF30000F, 0xFB0000FF, 0xB8000FFF), uint4(0x8800FFFF, 0x800FFFFF, 0x00FFFFFC, 0x94800000),
+	uint4(0x7DE7BCF3, 0xDE7BCF3F, 0xE7BCF3F7, 0x7BCF3F7D), uint4(0xBCF3F7DE, 0xCF3F7DE7, 0x00F7DE7B, 0x94C00000),
+	uint4(0xFFFFCC00, 0xFFFEE20F, 0xFFFF30FF, 0xFFFB8FFF), uint4(0x77FC0CFF, 0x00200004, 0x00000000, 0x95000000),
+	uint4(0x30800000, 0x0800000C, 0x800000C3, 0x00020C30), uint4(0x0410C308, 0x20C41000, 0x00820808, 0x95400000),
+	uint4(0x39CC31CF, 0xBCC73DFF, 0xDCF7FFF7, 0xDFFFF03B), uint4(0x0FFF000F, 0x03F10840, 0x00318C00, 0x95800000),
+	uint4(0x00000830, 0x00008300, 0x00083000, 0x00830000), uint4(0x08300000, 0x83000000, 0x00000000, 0x95C00000),
+	uint4(0x3CFBEFA0, 0xEFBFFE1F, 0xFFFFE0FB, 0xFFFE0FFF), uint4(0xFFE0FFFF, 0xFE0FFFFF, 0x007FFFFF, 0x96000000),
+	uint4(0x00020F3F, 0x0020F3F0, 0x020F3F00, 0x20F3F000), uint4(0x0F3F0000, 0xF3F00002, 0x00000020, 0x96400000),
+	uint4(0xFFFFFF03, 0xFFFFF033, 0xFFFFA11F, 0xFFFF00FF), uint4(0xFFF00FFF, 0xFF885FFF, 0x00C0FFFF, 0x96800000),
+	uint4(0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFF7BF), uint4(0xFFFF39F7, 0x7DF10E3D, 0x00EC61CF, 0x97400000),
+	uint4(0x00F80000, 0x0F800000, 0xF8000000, 0x80000000), uint4(0x0000000F, 0x000000F8, 0x00000F80, 0x97800000),
+	uint4(0xE29A4A20, 0xCF3CE348, 0xFBDE73F3, 0xBCE31FFE), uint4(0xCE30FFEF, 0xE30FFEFB, 0x00FFEFBC, 0x97C00000),
+	uint4(0x0003F0C0, 0x0C10C300, 0xFC7FFFC3, 0xC103FFFF), uint4(0x0000FFFF, 0x000FFF3C, 0x00FFF0C0, 0x98000000),
+	uint4(0x00000000, 0x00000000, 0x80000080, 0x20000E30), uint4(0x0800F38C, 0xE30FBCE3, 0x00FFFFBC, 0x98400000),
+	uint4(0x000DFFC0, 0x00013FF0, 0x00000300, 0x20000800), uint4(0x0C20C308, 0xE38F38E3, 0x00FBEF3C, 0x98800000),
+	uint4(0x10C38F3C, 0x0C38F3C0, 0xC38F3C01, 0x38F3C010), uint4(0x8F3C010C, 0xF3C010C3, 0x00010C38, 0x98C00000),
+	uint4(0x00000007, 0x00000070, 0x000007FC, 0x00007FFF), uint4(0x0007FFF0, 0x007FFFFC, 0x00FFFFFF, 0x99000000),
+	uint4(0x00000FFF, 0x000003F0, 0x00003F00, 0x0003F000), uint4(0x00000000, 0x00000000, 0x00000000, 0x99400000),
+	uint4(0x0FFFFFF1, 0x3FFFFF00, 0xFFFFF000, 0xFFFF0001), uint4(0xFFF00003, 0xFF00001F, 0x000000FF, 0x99800000),
+	uint4(0x10020001, 0x84008002, 0x21002000, 0x08410000), uint4(0x42100001, 0x10804000, 0x00001000, 0x99C00000),
+	uint4(0xC000007F, 0x0000003F, 0x000000FC, 0x00000FC0), uint4(0x0000FC00, 0x000FC000, 0x00FC0000, 0x9A000000),
+	uint4(0xEFB8E31C, 0xFB8E30C7, 0x986104DE, 0xC6184DE7), uint4(0x2081CE39, 0x081CF38E, 0x00C71862, 0x9AC00000),
+	uint4(0x00000001, 0x00000010, 0x00000100, 0x00001000), uint4(0x00010000, 0x00100000, 0x00000000, 0x9B000000),
+	uint4(0x00FFFFBC, 0x0FFFFBC0, 0xFFFFBC00, 0xFFFBC000), uint4(0xFFBC000F, 0xFBC000FF, 0x00000FFF, 0x9B400000),
+	uint4(0xF8000062, 0xFE000437, 0xFF80437F, 0x3EE437BF), uint4(0x0C78030F, 0x0437A002, 0x007FE800, 0x9B800000),
+	uint4(0x820BFFFE, 0x20BFFFE1, 0x0BFFFE18, 0xBFFFE182), uint4(0xFFFE1820, 0xFFE1820B, 0x001820BF, 0x9BC00000),
+	uint4(0xDF7DF7DF, 0xFFFFFFF7, 0xFFFFFFFF, 0xFFFFFFFF), uint4(0xFFFFFFFF, 0xFFFFFFFF, 0x007FFFFF, 0x9C000000),
+	uint4(0x00020C30, 0x00208300, 0x00083000, 0x00830FC0), uint4(0x0830FC00, 0x830FC000, 0x00FC0000, 0x9C400000),
+	uint4(0x8618618E, 0x08228A21, 0x82082182, 0x71C30861), uint4(0x92594D14, 0x1C51CB2C, 0x001C71C7, 0x9CC00000),
+	uint4(0xFFFFFFC0, 0xFFFFFC0F, 0xFFFFC0FF, 0xFFFC0FFF), uint4(0xFFD07DFF, 0xFC01CF3C, 0x000E38F7, 0x9D000000),
+	uint4(0x38E38E38, 0x8E38E38E, 0xE38E38E3, 0x38E38E38), uint4(0x8E38E38E, 0x61861863, 0x00008208, 0x9D400000),
+	uint4(0x0003FFC0, 0x003F0000, 0x03F00000, 0x3F000000), uint4(0xF0000000, 0x00000003, 0x0000003F, 0x9D800000),
+	uint4(0x18430C61, 0x8410C712, 0x610C3121, 0x10430208), uint4(0x04302086, 0x41000821, 0x00008208, 0x9DC00000),
+	uint4(0x3FFFFFFF, 0xFFFFFFF0, 0xFFFFFF03, 0xFFFFF03F), uint4(0xFFFF03FF, 0xFFF03FFF, 0x0003FFFF, 0x9E000000),
+	uint4(0x30C10DF3, 0x8E08FF9C, 0x704FFCE3, 0x86FFEF3C), uint4(0x2FBEFBE3, 0xFFFF9E18, 0x00FCF1C1, 0x9E400000),
+	uint4(0xFFFFFFFF, 0xFFFFFFF8, 0xFFFFFF80, 0xFFFFF801), uint4(0xFFFF8001, 0xFFF80001, 0x00800003, 0x9E800000),
+	uint4(0x430C71CF, 0x30C71CF0, 0x0C71CF04, 0xC71CF043), uint4(0x71CF0430, 0x1CF0430C, 0x000430C7, 0x9F000000),
+	uint4(0xC003FFFC, 0x003FFFF0, 0x03FFFF04, 0x00FFF000), uint4(0x0FFF0000, 0xFFF00000, 0x00000000, 0x9F800000),
+	uint4(0xC30C30C7, 0x10410C30, 0x00104104, 0x18618000), uint4(0xE39EE38E, 0xBEFBAEBA, 0x00DE79E7, 0x9FC00000),
+	uint4(0xFFFC0000, 0xFFC0000F, 0xFC0000FF, 0xFF000FFF), uint4(0xF000FFFF, 0x000FFFFF, 0x00FFFFFF, 0xA0000000),
+	uint4(0x79C630C3, 0x9C610C36, 0x47184375, 0x51841719), uint4(0x106171C6, 0x44179C61, 0x0039C618, 0xA0C00000),
+	uint4(0x000FFF30, 0x00FFFB00, 0x0FFFB800, 0xFFFF8000), uint4(0xFFFC0000, 0xFFC0000F, 0x000000FF, 0xA1400000),
+	uint4(0x000001FF, 0x00001FF0, 0x0001FFFC, 0xC01FFFFF), uint4(0xF1FEFFFF, 0xDE0FFFFF, 0x00FFEF38, 0xA1800000),
+	uint4(0xAEBEFFFF, 0xFBFFFFFB, 0xDF7DFFBA, 0xF7FFF9E7), uint4(0xFFFF9F7D, 0xFFFDF7DF, 0x00DF7FFF, 0xA1C00000),
+	uint4(0xB4E30810, 0xAF38C20F, 0xFBCE30EF, 0xFCF38F7F), uint4(0xFFBCFBFF, 0xFFEFFFFB, 0x00FFFFFF, 0xA2000000),
+	uint4(0xCF7FFFBE, 0xF7FFFFE1, 0xFFFFFF1C, 0xFFFFF3DF), uint4(0xFFFF3DFF, 0xFFF7FFFF, 0x007FFFFF, 0xA2400000),
+	uint4(0x30C30C30, 0x0C30C30C, 0xE38E38C3, 0x3CF3CE38), uint4(0xEFBEF3CF, 0xFFFFBEFB, 0x00FFFFFF, 0xA2800000),
+	uint4(0x000000C7, 0x00000010, 0x00000000, 0x00000000), uint4(0x0000C000, 0x000FFC00, 0x003DFFE0, 0xA2C00000),
+	uint4(0x4218C638, 0x00002100, 0xE7BDEFF8, 0x318E7FBC), uint4(0x0843F38E, 0x001E38C2, 0x00E30820, 0xA3000000),
+	uint4(0x00000000, 0x00000000, 0xE38E3800, 0xFFFFFE38), uint4(0xFFFFFFFF, 0x7DFFFFFF, 0x007DF7DF, 0xA3400000),
+	uint4(0x00000830, 0x00000000, 0x00000000, 0xFFFC0FFF), uint4(0xFFFFFFFF, 0xFFFFFFFF, 0x00FBFFFF, 0xA3800000),
+	uint4(0x71CF3CF7, 0x18E38E7C, 0x8E38E7C7, 0xC30C7861), uint4(0x30C78618, 0x0C70410C, 0x000410C3, 0xA3C00000),
+	uint4(0xFFFFFFFF, 0xF7DF7DFF, 0x3CF3CF7D, 0xC71C73CF), uint4(0x30C31C71, 0x0410C30C, 0x00041041, 0xA4000000),
+	uint4(0x38E38E38, 0xCF3CF3CE, 0xFBEFBEF3, 0xFFFFFFBE), uint4(0xF7DFFFFF, 0x3CF7DF7D, 0x003CF3CF, 0xA4400000),
+	uint4(0x3CFBFE00, 0x8FBFE00C, 0xF3FF20C3, 0x3EF20C38), uint4(0xEFB0C38F, 0xFB0C38F3, 0x00838F3E, 0xA4800000),
+	uint4(0x20820820, 0x1C71C718, 0xC71C71C7, 0x71C71C71), uint4(0x9E79C71C, 0xE79E79E7, 0x00E79E79, 0xA4C00000),
+	uint4(0x380F8E38, 0x80F8E38E, 0x0F8E38E3, 0xF8E38E38), uint4(0x8E38E380, 0xE38E380F, 0x00E380F8, 0xA5400000),
+	uint4(0xFF003FFF, 0xF0037FFF, 0x0017FFFB, 0x013FFFBF), uint4(0x03FFF3F0, 0x1FFF3F00, 0x00E3F000, 0xA5800000),
+	uint4(0x3CE30863, 0xCF38C21F, 0xF3CE30FB, 0xBCF38FFE), uint4(0xEF3C7FFF, 0xFBC3DF7F, 0x001CF7DF, 0xA5C00000),
+	uint4(0xF79CF7FF, 0x38C73DFE, 0x8431CFE7, 0x010C7E31), uint4(0x0043E308, 0x001E3080, 0x00E30800, 0xA6000000),
+	uint4(0xC3082082, 0x71861860, 0x38E38E0C, 0x9E79E1C7), uint4(0xEFBE3CF3, 0xFBE7DF79, 0x00FFFFBE, 0xA6400000),
+	uint4(0x38C30820, 0xCF38E30E, 0x1CE79C39, 0x430C70C7), uint4(0x00010000, 0x00000000, 0x00000000, 0xA6800000),
+	uint4(0x0003FFFF, 0x003FFFF0, 0x03FFFF00, 0x3F000000), uint4(0xFFFF0000, 0xFFFFFF03, 0x0000003F, 0xA6C00000),
+	uint4(0x00000000, 0x00000000, 0x00000000, 0x00000000), uint4(0x8800E200, 0xFFEFFFFB, 0x00FFFFFF, 0xA7400000),
+	uint4(0xC0FFFFFF, 0x003FFFFF, 0x000FFFFC, 0x0003FFFF), uint4(0x0000FFF0, 0x000FFFFC, 0x00FFFFC0, 0xA7800000),
+	uint4(0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x00000FFF), uint4(0x10410000, 0x7DF04104, 0x007DF7DF, 0xA7C00000),
+	uint4(0x084477FF, 0xC6119DF3, 0x61086730, 0x38C2139C), uint4(0x8C2039C7, 0xE307DE73, 0x007DEF3C, 0xA8000000),
+	uint4(0x631CF7FF, 0x39EF7FFC, 0x1CF7DF67, 0x4B4E7143), uint4(0xC6300010, 0x73804210, 0x0004318E, 0xA8400000),
+	uint4(0x1803FFFF, 0x843FFFF3, 0xC20FFF39, 0x2003F7DC), uint4(0x00007DEE, 0x8007DEF3, 0x007FFF38, 0xA8800000),
+	uint4(0x00041043, 0x00010430, 0x00104380, 0x01041820), uint4(0x1041C200, 0x041C2080, 0x00C30820, 0xA8C00000),
+	uint4(0x00000000, 0x00000000, 0x00000000, 0x00000000), uint4(0xFFFF0000, 0xFFFFFFFF, 0x00FFFFFF, 0xA9800000),
+	uint4(0x20820863, 0x0000043C, 0x00004382, 0x00043000), uint4(0x00010000, 0x00100000, 0x00000000, 0xAA400000),
+	uint4(0x00000000, 0xFFFFFFF0, 0xFFFFFFFF, 0xFFFFFFFF), uint4(0xFFFFFFFF, 0xFFFFFFFF, 0x003CF7DF, 0xAA800000),
+	uint4(0x38E39C71, 0x9E79E73F, 0xE7BEF3F3, 0xFBEF7F79), uint4(0xB7D775D6, 0x1CF34F2C, 0x000C70C7, 0xAAC00000),
+	uint4(0x3CF3EFFF, 0xCFBFFFFE, 0xFFFFFFF3, 0xFFFFFF3E), uint4(0xFFFFFBFF, 0xFFFFFFFF, 0x00FFFFFF, 0xAB000000),
+	uint4(0x20000001, 0x00000014, 0x00000042, 0xFFFFF000), uint4(0xFFFFFFFF, 0xFFFFFFFF, 0x007FFFFF, 0xAB400000),
+	uint4(0xFFFB00DF, 0xEC000DFF, 0x0000DFFF, 0x000DFFB0), uint4(0x00DEC000, 0x09000000, 0x00000000, 0xAB800000),
+	uint4(0x000011FF, 0x00000CF0, 0x00000700, 0x00001000), uint4(0x00000000, 0x00000000, 0x00000000, 0xABC00000),
+	uint4(0xCFFFFFFF, 0xF7FFFFF9, 0x7FFFFFCC, 0xFFFFFC67), uint4(0xFFFFE633, 0xFFFE339D, 0x00F399CF, 0xAC000000),
+	uint4(0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFC0FF, 0xFF000FFF), uint4(0x0000FFFF, 0x000FFF00, 0x00FC0000, 0xAC400000),
+	uint4(0x3CF38F3C, 0xCF3CE3CF, 0xF3CF38F3, 0x3CF3CF3C), uint4(0xCF3CF3CF, 0xF3CF3CF3, 0x00F3CF3C, 0xAC800000),
+	uint4(0x08208208, 0x41041042, 0x00000010, 0x82082000), uint4(0x10410820, 0x00004104, 0x00000000, 0xACC00000),
+	uint4(0xFFFFFFDF, 0xFFFFFDFF, 0xFFF7DFFF, 0xFF7DFFFF), uint4(0xF7CFFFFF, 0x7CFFFFFD, 0x007FFFDF, 0xAD000000),
+	uint4(0xFFFFEFBC, 0xFFFFFBEF, 0xFFFFFEFF, 0xFFFFFFFF), uint4(0xF7DFFFFF, 0x3CF7DF7D, 0x003CF3CF, 0xAD400000),
+	uint4(0x3F00003F, 0xF0000000, 0x00000003, 0xC0000000), uint4(0x0000000F, 0x000000FC, 0x00000000, 0xAD800000),
+	uint4(0x618610C3, 0x18618E38, 0xC71CE3C7, 0x71CF3C71), uint4(0x9EFBE79E, 0xEFBE79E7, 0x00F7DF7D, 0xADC00000),
+	uint4(0xF7DE79E3, 0x7DE79E7D, 0xFFF9E7FF, 0x3FBEF000), uint4(0x0FEF2000, 0x40061040, 0x00618410, 0xAE000000),
+	uint4(0x30FBFFFF, 0x8FFFFFF0, 0xFFFFFF03, 0xFFFFF83C), uint4(0xFFFFC3EF, 0xFFFE3FFF, 0x00F3FFFF, 0xAE400000),
+	uint4(0x00000000, 0x04000000, 0x40000008, 0x00000088), uint4(0x00000884, 0x00008C42, 0x0018CC20, 0xAE800000),
+	uint4(0xFFFFFFFF, 0xFFFFFFFF, 0x0C31C77D, 0x000000C3), uint4(0x00000000, 0x82000000, 0x00820820, 0xAEC00000),
+	uint4(0x40000001, 0x10000000, 0x0000000C, 0x000000C1), uint4(0x00001C30, 0x0001C304, 0x00BC7040, 0xAF000000),
+	uint4(0x00000020, 0x00008300, 0x000C3C00, 0x30E3E000), uint4(0x8FBF0000, 0xFFF00083, 0x00020E3C, 0xAF400000),
+	uint4(0x00030000, 0x003E0000, 0x000E0000, 0x00FE0000), uint4(0x003C0000, 0x00000000, 0x00000000, 0xAF800000),
+	uint4(0xCFFBCC20, 0xFFFEE300, 0xFFEF380C, 0xFFFB804F), uint4(0xFFFC047F, 0xFFE0477F, 0x000077FF, 0xAFC00000),
+	uint4(0x4319CE30, 0x31CC6300, 0x1CE73004, 0xC6738001), uint4(0x73180010, 0x39C0010C, 0x00000047, 0xB0400000),
+	uint4(0x00000000, 0x00000000, 0x00000000, 0x00020000), uint4(0x00300000, 0x03800000, 0x00000000, 0xB0800000),
+	uint4(0x3CF3CF3C, 0xDF3CFBCF, 0xF7CF3CF7, 0xBEFBE73C), uint4(0xEFBF79EF, 0x79E79E79, 0x00B8E79E, 0xB0C00000),
+	uint4(0xFFFFFF38, 0xFFFFFBCF, 0xFFFFFEFF, 0xFFFFE03F), uint4(0xFFFF000F, 0xFFF80003, 0x00C20000, 0xB1C00000),
+	uint4(0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFEFFF), uint4(0xEF3CFFFF, 0xE30FFFFB, 0x00FBCF38, 0xB2000000),
+	uint4(0xE79EFFFF, 0x3DFF3CF8, 0xCD73D7C7, 0xCF1CBE7B), uint4(0x70C9E396, 0x044F1D34, 0x0078E143, 0xB2400000),
+	uint4(0x3FFC0000, 0x0FFF0000, 0x038FFF00, 0x0003F000), uint4(0x0000FC00, 0x000FFFFC, 0x00038FFF, 0xB2800000),
+	uint4(0xFF000000, 0xFFC0000F, 0xFC0000FF, 0xFF000FFF), uint4(0xF000FFFF, 0xFC0FFFFF, 0x00FFFFFF, 0xB2C00000),
+	uint4(0x0C718618, 0xC71CE383, 0x73CE3831, 0x3CF3879C), uint4(0xCF387BCF, 0xF3CFBEF3, 0x00FBEF3C, 0xB3000000),
+	uint4(0x00FFFFFF, 0x0FFFFFF0, 0xFFFFFF00, 0xFFFFF000), uint4(0xFFFF000F, 0xFFF00003, 0x0000003F, 0xB3400000),
+	uint4(0x00000000, 0x00000000, 0x04104100, 0xC71C7041), uint4(0xF7DF1C71, 0xFFF7DF7D, 0x00FFFFFF, 0xB3800000),
+	uint4(0x38E38E39, 0x8E38E39E, 0xE38E39F3, 0x38E3973C), uint4(0xC63971C7, 0x71971C71, 0x0030C71C, 0xB3C00000),
+	uint4(0x38C201DF, 0x8C200DFF, 0xC200CFF3, 0x2004FF38), uint4(0x0047F38C, 0x007F38C2, 0x00F38C20, 0xB4000000),
+	uint4(0xDF3C70C1, 0xF7CF1C3F, 0x7CF1C3FF, 0xDF3C7FFF), uint4(0xF3C7FFFF, 0x7CFFFFFD, 0x00FFFFFF, 0xB4400000),
+	uint4(0xFFFFF7DF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFF03F), uint4(0x0FFF041F, 0x07F0C104, 0x001C30C1, 0xB4800000),
+	uint4(0xC31C73CF, 0x10430C70, 0x00004100, 0x00000000), uint4(0x00000C00, 0x000FCF04, 0x007DFFC7, 0xB4C00000),
+	uint4(0x1043FDE3, 0x043FDE3C, 0x400DE7C3, 0x00FE7C30), uint4(0x0FE7C304, 0xFE7C3041, 0x00C30C10, 0xB5000000),
+	uint4(0x00000043, 0x00000430, 0x00004300, 0x00043000), uint4(0x00430000, 0x04300000, 0x00000000, 0xB5400000),
+	uint4(0x433FFFFF, 0x33FFFFF0, 0x3FFFFF04, 0xFFFFF043), uint4(0xFFFF0433, 0xFFF0433F, 0x000433FF, 0xB5800000),
+	uint4(0x38C20041, 0xC630C206, 0x30C61039, 0xC630C1C6), uint4(0x30C60C31, 0x04300104, 0x00800001, 0xB5C00000),
+	uint4(0x00000000, 0x00000000, 0x00000000, 0x00000800), uint4(0x00008000, 0x000C2000, 0x00420800, 0xB6000000),
+	uint4(0x00000000, 0x00030000, 0x00078000, 0x0007C000), uint4(0x000F0000, 0x00000000, 0x00000000, 0xB6400000),
+	uint4(0x3FFFFFF8, 0xFFFFFF80, 0xFFFFF803, 0xFFFF803F), uint4(0xFFF803FF, 0xFF803FFF, 0x0003FFFF, 0xB6800000),
+	uint4(0xBEBAEBAE, 0x0BEFBEFF, 0x40000000, 0x08208410), uint4(0x82086186, 0x30C65860, 0x0075C71C, 0xB6C00000),
+	uint4(0xFFF30001, 0xFF30001F, 0xF30001FF, 0x30001FFF), uint4(0x0001FFFF, 0x001FFFF3, 0x00FFFF30, 0xB7000000),
+	uint4(0x00000000, 0x00000000, 0x00000000, 0x00000FC0), uint4(0x0000FC00, 0x000FFF00, 0x00FFF000, 0xB7400000),
+	uint4(0xC304003F, 0x300003F3, 0x00003F1C, 0x0003F1C1), uint4(0x00000C10, 0x0000C100, 0x000C0000, 0xB8000000),
+	uint4(0x00000000, 0x00000000, 0x00000100, 0x0001F000), uint4(0x01FF0000, 0xFFF00000, 0x00000001, 0xB8800000),
+	uint4(0xE79E79E7, 0xF9E79E79, 0xBEFBE7BE, 0xEFBEFBEF), uint4(0xFBEFFEFB, 0x03F000FF, 0x00041040, 0xB8C00000),
+	uint4(0xFFF30000, 0xFF30000F, 0xF30000FF, 0x30001FFF), uint4(0x0003FFFF, 0x047FFFF3, 0x00FFFF30, 0xB9000000),
+	uint4(0xC30C30C3, 0x71C71C70, 0x7DF7DF1C, 0xFFFFF7DF), uint4(0xFFFFFFFF, 0xFFFFFFFF, 0x00FFFFFF, 0xB9400000),
+	uint4(0x47BE71C3, 0x40DBE714, 0x0013BE18, 0x00007041), uint4(0x00000000, 0x82082000, 0x00E38C30, 0xB9800000),
+	uint4(0x00000000, 0x00000000, 0xC2000080, 0xFEF38F38), uint4(0xFFFFFFFF, 0xFFFFFFFF, 0x003DFFFF, 0xB9C00000),
+	uint4(0x3F00003F, 0xF00003F0, 0xFC000003, 0xC000003F), uint4(0x000003FF, 0x000000FC, 0x00000FFF, 0xBA800000),
+	uint4(0xFFFFFFC0, 0xFFFFFFEF, 0xFFFFFFFF, 0xFFFFFFFF), uint4(0xFFFFFFFF, 0xFFFFFFFF, 0x00000FFF, 0xBB000000),
+	uint4(0x20820820, 0x08208208, 0x82082082, 0x20820820), uint4(0x08208208, 0x86186082, 0x009E78E3, 0xBB400000),
+	uint4(0x00FFFFFF, 0x003FFFF0, 0x00003F00, 0xC0000FFF), uint4(0xF000FFFF, 0xFC0FFFFF, 0x00FFFFFF, 0xBB800000),
+	uint4(0x30C30820, 0xC2186306, 0x18430C10, 0x410820C2), uint4(0x00010000, 0x00000000, 0x00000000, 0xBBC00000),
+	uint4(0x431CF7FE, 0x31CF7FE0, 0x1CF7FF04, 0xCF7FF043), uint4(0xF7FF0431, 0x7FF0431C, 0x000431CF, 0xBC400000),
+	uint4(0x38FFF020, 0x8FBFFC08, 0xF3FFC003, 0x3FFC0030), uint4(0xEFFFFE0F, 0xFFFFC0E3, 0x00FFFC3E, 0xBC800000),
+	uint4(0x00042108, 0x73DFFFE0, 0xFFFFFF0C, 0xFFFFF7FF), uint4(0xFFFFFFFF, 0x000FFFFF, 0x00000000, 0xBCC00000),
+	uint4(0xFFFFFFC7, 0xFFFFFC3F, 0xFFFFE1FF, 0xFFFF0FFF), uint4(0xFFF8FFFF, 0xFFCFFFFF, 0x00FFFFFF, 0xBD000000),
+	uint4(0x00000000, 0x00000000, 0x80000080, 0x20001820), uint4(0x0801C308, 0x821E30C2, 0x00E38C30, 0xBD400000),
+	uint4(0x0001FFFF, 0x001FFFF0, 0x01FFFF00, 0x1FFFF000), uint4(0xFFFF0000, 0xFFF00001, 0x0000001F, 0xBD800000),
+	uint4(0x00000000, 0x00000000, 0x00000000, 0x00000000), uint4(0x10410000, 0x7DF04104, 0x007DF7DF, 0xBDC00000),
+	uint4(0x18E38E38, 0xCF3CF3C7, 0xFBEF3C71, 0xBEFBE79E), uint4(0xFFFF7DFF, 0xFFF7DFFF, 0x007DFFFF, 0xBE000000),
+	uint4(0x30C30C30, 0x0C30C30C, 0xC30C30C3, 0x30C30C30), uint4(0x8E38C30C, 0x618E38E3, 0x00618618, 0xBE400000),
+	uint4(0x010C7BD0, 0x10C7BD00, 0x0C7BD000, 0xC7BD0001), uint4(0x7BD00010, 0x9C00010C, 0x00000043, 0xBE800000),
+	uint4(0x20821861, 0x71C71CF8, 0x3EFBEF0C, 0xF79E77DF), uint4(0x3CF3DF7D, 0xC71CF3CF, 0x00C71C71, 0xBEC00000),
+	uint4(0xC60BFF3C, 0xE382F7C7, 0x78E13DFD, 0xBE304FFE), uint4(0xEF1CFFEF, 0xF3CFFEFB, 0x00FFEFBE, 0xBF000000),
+	uint4(0x3FFDF3AF, 0xFFFFFA00, 0xFFFFA003, 0xFFFA0000), uint4(0xFFA0000F, 0xFA000003, 0x0000003F, 0xBF800000),
+	uint4(0x20000001, 0xFFFFFFE4, 0x7FFFFEBD, 0xDFFFE9CF), uint4(0xF7BC0C73, 0x39C0431C, 0x000010C7, 0xBFC00000),
+	uint4(0xFFFA0000, 0xFFFC800F, 0xFFFF00FF, 0xFFFF883F), uint4(0xFFFF038F, 0xFFF000FB, 0x0000003F, 0xC0400000),
+	uint4(0x38C201FF, 0x8C20003E, 0xC20000E3, 0x61000E78), uint4(0x70C10FBC, 0x3C7609DE, 0x00E3845F, 0xC0800000),
+	uint4(0xC73DFFFF, 0x73DFFFF0, 0x3DFFFF0C, 0xDFFFF0C7), uint4(0xFFFF0C73, 0xFFF0C73D, 0x000C73DF, 0xC0C00000),
+	uint4(0x000477FF, 0x00011DF0, 0x00004700, 0x00001000), uint4(0x00008000, 0x000E2000, 0x00F30000, 0xC1000000),
+	uint4(0x00830E3C, 0x0830E3C0, 0xC38F3E00, 0x38F3E020), uint4(0x8F3E020C, 0xFBF020C3, 0x00030E3C, 0xC1400000),
+	uint4(0x47FFFFFF, 0x00013FF8, 0x800000C2, 0x20800E30), uint4(0x0820E38C, 0xCF373CE3, 0x000801DB, 0xC1800000),
+	uint4(0x00000000, 0x00000000, 0x18618600, 0x86186186), uint4(0x69A61861, 0x9E79A69A, 0x009E79E7, 0xC1C00000),
+	uint4(0xA33FFFF9, 0x33FFFF9F, 0x3FFFF9FA, 0xFFFF9FA3), uint4(0xFFF9FA33, 0xFF9FA33F, 0x00FA33FF, 0xC2800000),
+	uint4(0xBCE38C21, 0x8E30820F, 0xC20800F3, 0x20000E38), uint4(0x0000E308, 0x00042080, 0x00A20000, 0xC3000000),
+	uint4(0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xDF7CFFFF), uint4(0xF3C7FFFF, 0x0C3FDF7C, 0x003CF1C7, 0xC3400000),
+	uint4(0x40000000, 0x00000000, 0x00000004, 0x00000040), uint4(0x00000400, 0x00004000, 0x00040000, 0xC3800000),
+	uint4(0xFEF38C20, 0xFFBCE30F, 0xFBCE30FF, 0xFEF38FFF), uint4(0xFFBCFFFF, 0xFBCFFFFF, 0x00FFFFFF, 0xC3C00000),
+	uint4(0x00000000, 0x00000000, 0x00000000, 0x00000000), uint4(0x00008000, 0x000F3080, 0x00FFEE30, 0xC4000000),
+	uint4(0xFFFFF000, 0x1FFFFFF0, 0x01FFFF00, 0x003FF000), uint4(0x00070000, 0x00000000, 0x00000000, 0xC4800000),
+	uint4(0x00000000, 0x00000000, 0x82082000, 0x20820820), uint4(0x0C308208, 0xC30C30C3, 0x00C30C30, 0xC4C00000),
+	uint4(0x000410C7, 0x00410860, 0xFFD004FC, 0x79EFFFBE), uint4(0x1CE7F3CF, 0x8C7E38C7, 0x00C30861, 0xC5000000),
+	uint4(0x1C13BE78, 0xC300E78F, 0x700EF9F1, 0x08FF9F3C), uint4(0x803BF3C7, 0x23FF3CF1, 0x00F3CF18, 0xC5400000),
+	uint4(0x07FFFFFE, 0x7FFFFFE8, 0xFFFFFE80, 0xFFFFE827), uint4(0xF7DF827F, 0x7DF0077D, 0x000077DF, 0xC5C00000),
+	uint4(0x00000000, 0x00000000, 0xC2082082, 0x38C30C30), uint4(0xCF38E38E, 0xFBEF3CF3, 0x00FFEFBE, 0xC6000000),
+	uint4(0x00000040, 0x00000400, 0x00004000, 0x0007F000), uint4(0x007F0000, 0x07F00000, 0x00000000, 0xC6800000),
+	uint4(0x3CF3CF3C, 0xEFBEFBEF, 0x3CF3CFFB, 0xC30C33CF), uint4(0x8E380C30, 0xFFFE38E3, 0x00FFFFFF, 0xC6C00000),
+	uint4(0xC0000007, 0x0000003F, 0x000001FF, 0x00000FFC), uint4(0x0000FFF0, 0x000FFFC0, 0x00FFFF00, 0xC7000000),
+	uint4(0x00FFFFC0, 0x0FFFFC00, 0xFFFFC000, 0xFFFC0000), uint4(0xFFC0000F, 0xFC0000FF, 0x0003FFFF, 0xC7400000),
+	uint4(0x00003FFF, 0x0003FFFC, 0x003FFFC0, 0x03FFFC00), uint4(0x3FFFC000, 0xFFFC0000, 0x00C00003, 0xC7800000),
+	uint4(0xC71C71CF, 0x30C30C71, 0x04104104, 0x30C30001), uint4(0xCF3CC30C, 0x79E71CF3, 0x0038E79E, 0xC7C00000),
+	uint4(0xFFFFFFDF, 0xFFFFFDFF, 0xFFF7DFFF, 0xFF7CFFFF), uint4(0xF7CFFFFF, 0x3CFFFFFD, 0x00FFFFDF, 0xC8000000),
+	uint4(0xBEFBEFBE, 0xFFFFFFF3, 0xFFFFFF3F, 0xFFFFF3FF), uint4(0xFFFF3FFF, 0xFFF3FFFF, 0x003FFFFF, 0xC8400000),
+	uint4(0xBE704FFC, 0xF3C303FF, 0x1C103FFF, 0xC003FFDF), uint4(0x00007C70, 0x0003C300, 0x009E1800, 0xC8800000),
+	uint4(0xFFFFFFC0, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF), uint4(0xFFFFFFFF, 0xFFFFFFFF, 0x00000FFF, 0xC8C00000),
+	uint4(0xE77FFFFF, 0x77FFFFFE, 0x7FFFFFEE, 0xFFFFFEE7), uint4(0xFFFFEE77, 0xFFFEE77F, 0x00EE77FF, 0xC9000000),
+	uint4(0xB8800000, 0xEE20000F, 0xFB8800FF, 0xFEE20FFF), uint4(0xFFB8FFFF, 0xFFEFFFFF, 0x00FFFFFF, 0xC9400000),
+	uint4(0xC000003F, 0xF000000F, 0xFC0000FF, 0xFF00003F), uint4(0xFFC0000F, 0xFFF00003, 0x00FC0000, 0xC9800000),
+	uint4(0x041FFF7D, 0x01FDF7C1, 0x17DF3C10, 0xFFFBE000), uint4(0xEFBE0821, 0xFBE0801F, 0x000001BE, 0xC9C00000),
+	uint4(0xFEFBCF3C, 0xEFBCF3C3, 0xFBCF3C3F, 0xBCF3C3FE), uint4(0xCF3C3FEF, 0xF3C3FEFB, 0x003FEFBC, 0xCA000000),
+	uint4(0xB8800000, 0x00000007, 0xFFFFFF40, 0xFFFFF7FF), uint4(0xFFFF7FFF, 0xFFF7FFFF, 0x007FFFFF, 0xCA800000),
+	uint4(0x208430C6, 0x08410C7C, 0x8610C3C3, 0x210C3C30), uint4(0x1843E30C, 0x843630C2, 0x00638C31, 0xCAC00000),
+	uint4(0x4103FF7D, 0x3080F7D0, 0x08203F0C, 0x860000C3), uint4(0x61041C71, 0x3043C718, 0x003CF38E, 0xCB000000),
+	uint4(0x20000043, 0x00000438, 0x00004380, 0x00043000), uint4(0x00430000, 0x04300000, 0x00000000, 0xCB400000),
+	uint4(0xFFFFFFFF, 0xFFFFFFFF, 0x1CF3DF7D, 0x410C30C7), uint4(0x08200000, 0xE38C30C2, 0x00FBCF3C, 0xCB800000),
+	uint4(0x00000000, 0x00000000, 0x00000000, 0x00000000), uint4(0x00200000, 0x83E00000, 0x00000000, 0xCBC00000),
+	uint4(0x8E38E38E, 0xE79E79E3, 0xFBEFBE79, 0xBEFBEFBE), uint4(0xEFBEFBEF, 0xFBEFBEFB, 0x00FBEFBE, 0xCC400000),
+	uint4(0x000033FF, 0x00013FF0, 0x0011FF00, 0x011DF000), uint4(0x01DF0000, 0x0DF00000, 0x00800000, 0xCC800000),
+	uint4(0x82084104, 0x21841040, 0x18630C08, 0x8E30C186), uint4(0xE30C1861, 0x79C18638, 0x003CE38E, 0xCCC00000),
+	uint4(0xFFFFFFFF, 0xF3DF7FF7, 0x1C73CF1C, 0x410C30C3), uint4(0x0C310000, 0xF3CC30C3, 0x00F3CF3C, 0xCD000000),
+	uint4(0x38C20043, 0x8C20841E, 0xC30801F3, 0x30821F38), uint4(0x0C21F38E, 0xC20F3CE3, 0x00FBCE38, 0xCD400000),
+	uint4(0xFFFFFFB8, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF), uint4(0xFFFFFFFF, 0xFFFFFFFF, 0x00FFFFFF, 0xCD800000),
+	uint4(0xE79E79E7, 0x3CF3CF39, 0xE79E79CF, 0x1C71CE39), uint4(0xE38E79C7, 0x9E71CF3C, 0x00CE38E7, 0xCDC00000),
+	uint4(0x000333BF, 0x08391FF0, 0xC3C1DF00, 0x3E0CF000), uint4(0xF04F000E, 0x047020F3, 0x00030FBF, 0xCE800000),
+	uint4(0x3EFFFFFF, 0xCFFFFFFE, 0xFFFFFFC3, 0xFFFFFC3C), uint4(0xF7FF41CF, 0x7DF81879, 0x00BC838F, 0xCF000000),
+	uint4(0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF), uint4(0x0FFF03FF, 0x00000000, 0x00000000, 0xCF400000),
+	uint4(0x30C30C21, 0xCE38E396, 0xFBCF3D73, 0xFFFBE7BE), uint4(0xFFFD7FFF, 0xF317FFFF, 0x007FFFFF, 0xCFC00000),
+	uint4(0x00000000, 0x00000000, 0x82082000, 0x08208820), uint4(0x41042082, 0x0C310410, 0x000C30C3, 0xD0000000),
+	uint4(0x00010020, 0xFFC00080, 0xFBEFFDF7, 0xFFFFFFFF), uint4(0xFFFFFFFF, 0x3DF7DFFF, 0x000C71CF, 0xD0800000),
+	uint4(0xBEF38E30, 0xAE3CE34D, 0xFBCE38EF, 0x3CFBAFFE), uint4(0xEF38F7DF, 0xF7DFFFFB, 0x00FBEFBF, 0xD0C00000),
+	uint4(0x208217C7, 0x08200DFC, 0x820007C2, 0x20000C20), uint4(0x0000C208, 0x000C2082, 0x00C20820, 0xD1000000),
+	uint4(0xFF00003F, 0xF00003FF, 0x000000FF, 0xC0000FFF), uint4(0x0000FFFF, 0x000FFFFC, 0x00FFFFC0, 0xD1400000),
+	uint4(0x00000000, 0xCF3CF3C0, 0x3CF3CFF3, 0x000003CF), uint4(0x00000000, 0x82000000, 0x00820820, 0xD1800000),
+	uint4(0xFFFF884F, 0xFFF884FF, 0xFF884FFF, 0xF884FFFF), uint4(0x884FFFFF, 0x84FFFFFF, 0x00FFFFF8, 0xD1C00000),
+	uint4(0x00000001, 0x30000000, 0x3C0000FC, 0xFF040FFF), uint4(0xFFC77FFF, 0xFFF0DFFF, 0x000037FF, 0xD2000000),
+	uint4(0xBEFBEFBE, 0xFFFFFFFF, 0x7DFFFFFF, 0xCF7DF7DF), uint4(0x73CF3CF3, 0x1C71C71C, 0x000C30C3, 0xD2400000),
+	uint4(0x007FFFCF, 0x8C0F8C00, 0x1C11FEF3, 0x00003FDF), uint4(0x00001C10, 0x00000000, 0x00800000, 0xD2800000),
+	uint4(0x00000000, 0x08208200, 0x82082082, 0x10410820), uint4(0x00004104, 0x00000000, 0x00000000, 0xD2C00000),
+	uint4(0xDFFFFFFE, 0xFFFFFFE3, 0xFFFFFE3D, 0xFFFFE3DF), uint4(0xFFFE3DFF, 0xFFE3DFFF, 0x003DFFFF, 0xD3000000),
+	uint4(0x410C31C7, 0x10C31C70, 0x0430C704, 0x430C7001), uint4(0x30C70010, 0x0C300104, 0x00000041, 0xD3400000),
+	uint4(0xFF000FFF, 0xF00003FF, 0x00003FFF, 0x0003FFFF), uint4(0x0000FFF0, 0x000FFFFC, 0x00FFFFC0, 0xD3800000),
+	uint4(0xCE184FF9, 0xE184FF93, 0x184FF93C, 0x84FF93CE), uint4(0x4FF93CE1, 0xFF93CE18, 0x003CE184, 0xD3C00000),
+	uint4(0x0003FFFF, 0x003FFFF0, 0x03FFFF00, 0x3FFFF000), uint4(0xFFDF0000, 0x1C3E2003, 0x00FFC62F, 0xD4000000),
+	uint4(0x000410C3, 0x00010438, 0x000041E0, 0x00001FA0), uint4(0x0001FF80, 0x000FFE80, 0x00FFFE00, 0xD4400000),
+	uint4(0xBEFBEFBE, 0x0C30C30F, 0x820820C3, 0x30C30820), uint4(0x8E38C30C, 0xF3CE38E3, 0x00F3CF3C, 0xD4C00000),
+	uint4(0x4010E7BE, 0x010E7BEF, 0x10E7BEF4, 0x0E7BEF40), uint4(0xE7BEF401, 0x7BEF4010, 0x00F4010E, 0xD5000000),
+	uint4(0xFFFC0000, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF), uint4(0x0FFF03FF, 0x00000000, 0x00000000, 0xD5400000),
+	uint4(0xC7FFFFFF, 0x01DFFFF0, 0x0037FFFB, 0x000CFFB0), uint4(0x0001FB00, 0x000FB000, 0x00FB0000, 0xD5800000),
+	uint4(0x001FFFFF, 0x00017FF0, 0x00000700, 0x00000000), uint4(0x00000000, 0x82000000, 0x00820820, 0xD5C00000),
+	uint4(0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFDFFFF), uint4(0xF7DFFFFF, 0x7DFFFFFF, 0x00FFFFDF, 0xD6000000),
+	uint4(0x47FFFFFF, 0x7FFFFFF0, 0xFFFFFF04, 0xFFFFF047), uint4(0xFFFF047F, 0xFBC047FF, 0x00047FFF, 0xD6800000),
+	uint4(0xCF7FFFFF, 0xF7FFFFF1, 0x430C301C, 0xFF000DC0), uint4(0xFFFF1CF7, 0xFFF1CF7F, 0x001CF7FF, 0xD6C00000),
+	uint4(0xDF1C1FFE, 0xF1C1FFEF, 0x3C303EFD, 0xC303EFFF), uint4(0x707EFFF3, 0x07EFFF7C, 0x00FFF7C7, 0xD7400000),
+	uint4(0x00FC0000, 0x0FFF0000, 0xFFF00000, 0x3F000000), uint4(0xFFC00000, 0xFC000003, 0x0000003F, 0xD7800000),
+	uint4(0x00000000, 0x00000000, 0xFC000000, 0xFFFFFFFF), uint4(0x0000000F, 0x00000000, 0x00000000, 0xD7C00000),
+	uint4(0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xBEFBEFFF), uint4(0xCF3CFBEF, 0xE38F3CF3, 0x00E38E38, 0xD8400000),
+	uint4(0xE38E38E3, 0x38E38E39, 0x8E38E39E, 0xE38E39E3), uint4(0x38E39E38, 0x8E39E38E, 0x009E38E3, 0xD8C00000),
+	uint4(0xFFFCF0FE, 0xFFFF3C2F, 0xFFFFCEFF, 0xFFFFEFFF), uint4(0xFFFEFFFF, 0xFFEFFFFF, 0x0003FFFF, 0xD9000000),
+	uint4(0xBCE30C20, 0xCE30C20F, 0xE30C20FB, 0x30C20FBC), uint4(0x0C20FBCE, 0x400FBCE3, 0x0079C610, 0xD9400000),
+	uint4(0xF80001FF, 0x0000007F, 0x000000FA, 0x00000E00), uint4(0xFFFFDC00, 0xFFF007FF, 0x000001FF, 0xD9800000),
+	uint4(0x8E38E38E, 0xC30C30C3, 0xA28A2830, 0x38E38A28), uint4(0x8E38E38E, 0xD34E38E3, 0x00D34D34, 0xD9C00000),
+	uint4(0x20800000, 0x08208000, 0xC3082043, 0x38C30638), uint4(0xCE3873CE, 0xF3C7BCF3, 0x007FEFBC, 0xDA000000),
+	uint4(0xDF7FFFFF, 0x71CF3DF3, 0x0C31C70C, 0x00041041), uint4(0x00000000, 0x00000000, 0x00000000, 0xDA400000),
+	uint4(0x30000043, 0x00431CFF, 0x1CF7FFF3, 0xFFFFF173), uint4(0xFFFF1077, 0xFFF7301F, 0x00F30007, 0xDA800000),
+	uint4(0x00FBFFFC, 0x003EFFF0, 0x000FBF00, 0x0003E000), uint4(0x00000000, 0x00000000, 0x00C00000, 0xDB000000),
+	uint4(0xC77FFFB8, 0x73FFFB80, 0x3DFFB804, 0xDFFB8043), uint4(0xFFB80031, 0x7B80011C, 0x000010CF, 0xDB400000),
+	uint4(0xC00010C7, 0xF000043F, 0xFFF000FF, 0xFFFC03DF), uint4(0xFFFF1CF7, 0x7FF0C73D, 0x000431CF, 0xDB800000),
+	uint4(0x00000020, 0x00208200, 0x82083000, 0x10410020), uint4(0x02080000, 0x000BFF00, 0x00DF7FC0, 0xDBC00000),
+	uint4(0x00000000, 0x0C208200, 0xF3CE38C3, 0xFFFFEFBC), uint4(0xFFFFFFFF, 0xFFFFFFFF, 0x00000FFF, 0xDC000000),
+	uint4(0xFFFB8800, 0xFFFCC00F, 0xFFCC00FF, 0xFEE20FFF), uint4(0xFF30FFFF, 0xF30FFFFF, 0x00FFFFFF, 0xDC400000),
+	uint4(0x00000FFF, 0x0000FFF0, 0x000FFF00, 0x0003F000), uint4(0x003F0000, 0x03F00000, 0x00000000, 0xDC800000),
+	uint4(0xFFFC0000, 0xFFFFFFFF, 0xFFFFFFFF, 0x3EFFFF3E), uint4(0xCFBFC38F, 0xE3C830E3, 0x00FFF830, 0xDCC00000),
+	uint4(0x00000000, 0x08208200, 0x82082082, 0x30C30820), uint4(0x0C30C30C, 0xE38C30C3, 0x00E38E38, 0xDD000000),
+	uint4(0xEF43CFBF, 0xF038F3F1, 0xFF0F3E1C, 0xE0E3C1CF), uint4(0x0C3C1CF7, 0x8381CF7E, 0x001CF7FF, 0xDD800000),
+	uint4(0xF7DF3CF3, 0x7DF7DF7D, 0xFFFDF7DF, 0x08000000), uint4(0x82082082, 0x30820820, 0x0030C30C, 0xDDC00000),
+	uint4(0x3CF3CF3C, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF), uint4(0xFFFF7FFF, 0xFFF3DFFF, 0x003CF7FF, 0xDE000000),
+	uint4(0xFF00000F, 0xF000007F, 0x000003FF, 0x00003FFF), uint4(0x0001FFF0, 0x000FFF00, 0x007FF000, 0xDE800000),
+	uint4(0xF7DF7CF3, 0xF5D7DF7D, 0x2492C71C, 0x08208208), uint4(0x86186186, 0xF1CE1861, 0x00F3CF3C, 0xDEC00000),
+	uint4(0x30C10FEF, 0x0C30400C, 0xC30C10C3, 0x38C30E38), uint4(0x8E38E38E, 0xE38E78E3, 0x00FF9E38, 0xDF400000),
+	uint4(0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFF03, 0x3FFFF000), uint4(0xFFFF8000, 0xFFFF0003, 0x00FF8000, 0xDF800000),
+	uint4(0xF79E79E7, 0x7DE79E7D, 0xDF79E7DF, 0xF7DE7FF7), uint4(0x7DF7FFFD, 0xDF7FFFFF, 0x0013FFFF, 0xDFC00000),
+	uint4(0xEFBDF7DF, 0xFBFFFDFD, 0x010000DF, 0x10400000), uint4(0x84100082, 0x61810C21, 0x0018C318, 0xE0400000),
+	uint4(0x0003EE20, 0x007FF30C, 0x9FFFFCE2, 0xC71C6FB8), uint4(0x10411C45, 0x800041F7, 0x00003FB8, 0xE0800000),
+	uint4(0x638E79EF, 0x38E79EF8, 0x8E79EF86, 0xE79EF863), uint4(0x79EF8638, 0x9EF8638E, 0x008638E7, 0xE0C00000),
+	uint4(0xC77FFFFF, 0x00473FF0, 0x00004300, 0x20000C20), uint4(0x8C20F38C, 0xF38FFEF3, 0x00FFFFFE, 0xE1400000),
+	uint4(0x30003FFF, 0xEE200FFF, 0xFB8803FF, 0xFEE20FFF), uint4(0xFFFCFFFF, 0xFFFFFFFF, 0x00FFFFFF, 0xE1800000),
+	uint4(0xFFFBEF3D, 0xFFBEF3DF, 0xFBEF3DFF, 0xBEF3CFFF), uint4(0xEF3CFFFF, 0xF3CFFFFB, 0x007FFFBE, 0xE1C00000),
+	uint4(0xC0000000, 0x0000000F, 0x00000000, 0x00000000), uint4(0x00000000, 0x00000000, 0x00000000, 0xE2400000),
+	uint4(0x30000007, 0x8800003E, 0xC00000F3, 0x20000FBC), uint4(0x0000FFEE, 0x800FFFF3, 0x007FFFB8, 0xE2800000),
+	uint4(0xDFFFFFFF, 0xFFFFFFF3, 0xFFFFFF3D, 0xFFFFF3DF), uint4(0xFFFF3DFF, 0xFFF3DFFF, 0x003DFFFF, 0xE3000000),
+	uint4(0x000007C7, 0x0C300330, 0xF1C13DC3, 0xCF0C0F3C), uint4(0x7040FFFF, 0x000FFF7C, 0x00FFF3C3, 0xE3400000),
+	uint4(0x000010CF, 0x00000470, 0x00000300, 0x00001000), uint4(0x0000E000, 0x000FB000, 0x007FC800, 0xE3800000),
+	uint4(0x0E38E3AF, 0xE38E3AF3, 0x38E3AE30, 0x8E38E30E), uint4(0xE38E30C3, 0x38E30C38, 0x0030C38E, 0xE3C00000),
+	uint4(0x00000000, 0xF000000F, 0x00000003, 0x00000030), uint4(0xF000000F, 0x00000003, 0x00000030, 0xE4000000),
+	uint4(0x20820C30, 0x0820C300, 0x820C3002, 0x20C30020), uint4(0x0C300208, 0xC3002082, 0x00020820, 0xE4400000),
+	uint4(0xFEF3880F, 0xFFB8C0FF, 0xFBCC2FFF, 0xFCE1FFFF), uint4(0xE70FFFFF, 0x30BFFFFF, 0x00FFFFDF, 0xE4800000),
+	uint4(0xC31C73CF, 0x31C73CF0, 0x1C73CF0C, 0xC73CF0C3), uint4(0x73CF0C31, 0x3CF0C31C, 0x000C31C7, 0xE4C00000),
+	uint4(0x430C71CF, 0x10430C70, 0x00104300, 0x00000000), uint4(0x00000000, 0x00000000, 0x00000000, 0xE5000000),
+	uint4(0x00000007, 0x00000070, 0x00000700, 0x00007000), uint4(0x00070000, 0x00700000, 0x00000000, 0xE5400000),
+	uint4(0x20820820, 0x0C30C308, 0x41041043, 0x08618410), uint4(0x82082082, 0x10400020, 0x00104104, 0xE5800000),
+	uint4(0xF3CF7FB8, 0x1CF3CFB8, 0x871C7B86, 0x30C71861), uint4(0x0C300208, 0x83082082, 0x007D8800, 0xE5C00000),
+	uint4(0xFFFFFFB8, 0xFFFFFB8F, 0xFFFFB8FF, 0xFFFB8FFF), uint4(0xFFB8FFFF, 0xFB8FFFFF, 0x00FFFFFF, 0xE6400000),
+	uint4(0x00000000, 0x00000000, 0x00000000, 0xDF7DF000), uint4(0xFFFF7DF7, 0xFFFFFFFF, 0x00FFFFFF, 0xE6800000),
+	uint4(0xC30C30C7, 0x30C30C70, 0x0C30C70C, 0xC30C70C3), uint4(0x30C70C30, 0x0868C30C, 0x008A2082, 0xE6C00000),
+	uint4(0x30000000, 0x08000006, 0xC0000073, 0x200003B8), uint4(0x080039CE, 0x8001CEE3, 0x000CF738, 0xE7000000),
+	uint4(0xFF00003F, 0x000003FF, 0x00003FFC, 0x0003F000), uint4(0x003F0000, 0x03F00000, 0x00000000, 0xE7400000),
+	uint4(0xC30C30C3, 0x30C30C30, 0x0C30C70C, 0xC31C70C3), uint4(0x71C70C30, 0x1C70C30C, 0x000C31C7, 0xE7C00000),
+	uint4(0x000010C3, 0x00010C30, 0x0010C300, 0x010C3000), uint4(0x10C30000, 0x0C300000, 0x00000001, 0xE8400000),
+	uint4(0x0300001F, 0xF0000000, 0x86082000, 0xE0820820), uint4(0x18208209, 0xC3082002, 0x00C30C37, 0xE8800000),
+	uint4(0xFF000000, 0xF000000F, 0xFC0000FF, 0xC0000FFF), uint4(0x0000FFFF, 0x000FFFFC, 0x0003FFFF, 0xE8C00000),
+	uint4(0x9E79E79E, 0xF7DF7DF7, 0x3CF3CF7D, 0xC71C73CF), uint4(0x30C31C71, 0x0C30C30C, 0x000C30C3, 0xE9000000),
+	uint4(0xBFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF), uint4(0xFFFFFFFF, 0xFFF7FFFF, 0x007DF7FF, 0xE9400000),
+	uint4(0x0477CF3C, 0x07FFFFF7, 0x7FFFFF0C, 0xFFFFF000), uint4(0xFFFF0007, 0xFCF0007F, 0x000007FF, 0xE9800000),
+	uint4(0x00000000, 0x08000008, 0xC20000E3, 0x30800F38), uint4(0xCE30FBCE, 0xF38FFFFB, 0x00FFFFFE, 0xE9C00000),
+	uint4(0x20000003, 0x0000003E, 0x000043E2, 0x00047E20), uint4(0x0047F300, 0x0C7F3000, 0x00F30000, 0xEA000000),
+	uint4(0xFFFFFFBD, 0xFFFFFBD7, 0xFFFFBD7F, 0xFFFBD7FF), uint4(0xEFBD7FFF, 0xF3D7FFFF, 0x007FFFFE, 0xEA400000),
+	uint4(0x07FFFE01, 0x37FFE000, 0x3FFF0000, 0xFFF20801), uint4(0xFFA08001, 0xFB0C000F, 0x00C0005F, 0xEA800000),
+	uint4(0x00000000, 0x00200000, 0x82000041, 0x20000430), uint4(0x0000C308, 0x000C3082, 0x00C30820, 0xEAC00000),
+	uint4(0x00000000, 0x08200008, 0x82082082, 0x20820820), uint4(0x1C71C30C, 0x4D7C30C3, 0x006594D3, 0xEB000000),
+	uint4(0xDF7FFFFF, 0xF3DF7DF7, 0x1CF3CF3C, 0xE79E71C7), uint4(0x3CFB0E38, 0xF7DC71C7, 0x00E38E39, 0xEB400000),
+	uint4(0xFFFF8040, 0xFFFFFC0F, 0xFFFFC0FF, 0xFFFC07FF), uint4(0xFFC001FF, 0xFC00007F, 0x0080001F, 0xEB800000),
+	uint4(0x0C218421, 0x02104201, 0x01000010, 0xEFFFE000), uint4(0xF7BEFF7F, 0x79CDF7BE, 0x00DE7BCE, 0xEBC00000),
+	uint4(0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFC0FFF), uint4(0x0000FFFF, 0xC3000000, 0x00C30C30, 0xEC000000),
+	uint4(0x208618A2, 0x0C31CB08, 0xE39E38C3, 0x3DF3CE38), uint4(0xEFBEF3CF, 0xF7FFBEFB, 0x00FFFFFE, 0xEC400000),
+	uint4(0x1C618610, 0xC2082DF7, 0x1DFFF730, 0xFBEF3104), uint4(0x9E7104FF, 0x610FFDF7, 0x0079C718, 0xECC00000),
+	uint4(0xC87BFFFF, 0xE18F7FFD, 0xF431CFC7, 0xF8043E3C), uint4(0xFC00E3EF, 0xFE0F3EFF, 0x00F3FFFF, 0xED000000),
+	uint4(0xFFF30000, 0xFFFCC00F, 0xFFEE20FF, 0xFFFB8FFF), uint4(0xFFFEFFFF, 0xFFFFFFFF, 0x00FFFFFF, 0xED400000),
+	uint4(0x000000DF, 0x00000DF8, 0x00004F80, 0x0004FC00), uint4(0x004FC000, 0x007C0000, 0x00E00000, 0xED800000),
+	uint4(0xFEFFDF7B, 0xEFBDF797, 0xFBDE797D, 0x3DE797DE), uint4(0xDE797DEF, 0xE7179EF3, 0x0079E73C, 0xEDC00000),
+	uint4(0x00000000, 0x00000000, 0x00000000, 0x00000000), uint4(0x00000000, 0xFFFFFFFC, 0x00FFFFFF, 0xEE000000),
+	uint4(0xFFFFEF3C, 0xFFFEFBC0, 0xFFFFBC1F, 0xFFFBC3FF), uint4(0xFFBC7FFF, 0xFBCFFFFF, 0x00FFFFFF, 0xEE800000),
+	uint4(0x208630C7, 0x08610C7C, 0x8210C7C2, 0x210C7C20), uint4(0x10C3C208, 0x043C2082, 0x00C20821, 0xEEC00000),
+	uint4(0xCF3DF7DF, 0x73CF3DF3, 0x1CF3CF1C, 0xC71CF1C7), uint4(0x71C70C31, 0x0C70C30C, 0x000410C3, 0xEF000000),
+	uint4(0xC73DCE30, 0x77FCE300, 0x7FCE300C, 0xFCE301CF), uint4(0xCE313DFF, 0xE733FFFF, 0x007FFFFC, 0xEF800000),
+	uint4(0x1E7DF7DF, 0x0C3871E7, 0x41083002, 0x08000410), uint4(0xC2082082, 0x30C30C30, 0x0038E38E, 0xEFC00000),
+	uint4(0x00000000, 0x00000000, 0x00000100, 0xC73DF000), uint4(0xFFFF0010, 0xFFF1CF7F, 0x00FFFFFF, 0xF0000000),
+	uint4(0x00000820, 0x00000200, 0x00002000, 0x00020000), uint4(0x00000000, 0x00000000, 0x00000000, 0xF0400000),
+	uint4(0x000DFFFF, 0x004FFFF0, 0x006E20F3, 0x037FFFC0), uint4(0x13FF0000, 0x1FF00000, 0x00000000, 0xF0800000),
+	uint4(0x80F7DF79, 0x0F7DF790, 0xF7DF7908, 0x7DF79080), uint4(0xDF79080F, 0xF79080F7, 0x00080F7D, 0xF0C00000),
+	uint4(0x3FF38C20, 0x0FBCE300, 0xFFEF3800, 0xFFFB8000), uint4(0xFFBC000F, 0xFFE00003, 0x0000003F, 0xF1000000),
+	uint4(0x38E38E38, 0xCF3CF3CE, 0xFBEFBEF3, 0xFFFFFFBE), uint4(0xFFFFFFFF, 0xFFFFFFFF, 0x00FFFFFF, 0xF1400000),
+	uint4(0x3B420001, 0xB420001F, 0x420001F3, 0x20001F3B), uint4(0x0001F3B4, 0x001F3B42, 0x00F3B420, 0xF1800000),
+	uint4(0xFFF30082, 0xDF32082F, 0xF32082F7, 0x30003F7D), uint4(0x006177FF, 0x8617DFF3, 0x0079F711, 0xF1C00000),
+	uint4(0x38C20043, 0x8C20001F, 0xC20000F3, 0x20000F38), uint4(0x0000F38C, 0x001738C2, 0x00318C20, 0xF2000000),
+	uint4(0xFFFFEFBC, 0xFFFFFFEF, 0xFFFFFFFF, 0xFFFFFFFF), uint4(0xFFFFFFFF, 0xFFF3DFFF, 0x000C73DF, 0xF2400000),
+	uint4(0x000011CF, 0x00431DF0, 0x8473DF80, 0xD77FFC30), uint4(0xB6F37194, 0xF3C0811C, 0x0004319E, 0xF2800000),
+	uint4(0x79E79E79, 0xFEFBEF9E, 0x3DFEFB7F, 0x010C70C7), uint4(0x41041041, 0x10410410, 0x00304104, 0xF2C00000),
+	uint4(0xFFFFFFFF, 0xFFFFFFFF, 0xFFF7CFFF, 0xCF1C7FFF), uint4(0x30C1FFF7, 0xC307CF1C, 0x00DF3C71, 0xF3000000),
+	uint4(0x0003FFC0, 0xFFFFFFF0, 0xFFFFFFFF, 0xFFFFFFFF), uint4(0x0000FFFF, 0x00000000, 0x00000000, 0xF3800000),
+	uint4(0xFF7DF3CF, 0xF3C71C7F, 0x8C30C17C, 0x71C209E7), uint4(0x8E38CF1C, 0xF3CF3CE3, 0x00FBEFBE, 0xF3C00000),
+	uint4(0xFFF38C00, 0xFFFCE307, 0x7FFF381D, 0xDFFFC0C7), uint4(0x77FF0431, 0x1DF0010C, 0x00800043, 0xF4000000),
+	uint4(0x20820820, 0x08208208, 0x82082082, 0xE1820860), uint4(0xF1C33C70, 0xFDFBFF7C, 0x00BEFBEF, 0xF4400000),
+	uint4(0x61861861, 0x38E38E38, 0x8E38E38E, 0xE79E78E3), uint4(0x79E79E79, 0x9E79E79E, 0x009E79E7, 0xF4C00000),
+	uint4(0x00000000, 0x0000000E, 0x000000E0, 0x00000E00), uint4(0x0000E000, 0x000E0000, 0x00E00000, 0xF5000000),
+	uint4(0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF), uint4(0xFFFFFFFF, 0xFFF7DFFF, 0x007DF7DF, 0xF5400000),
+	uint4(0x00000000, 0x00000000, 0x80000000, 0x38C30C20), uint4(0xEFBCF3CE, 0xFFFFFFFF, 0x00FFFFFF, 0xF5800000),
+	uint4(0xFFFE1FFF, 0xFFFE0FFF, 0xFFFF07FF, 0xFFFF8FFF), uint4(0xFFFFFFFF, 0xFFFFFFFF, 0x00FFFFFF, 0xF5C00000),
+	uint4(0x0003FFFF, 0x000003F0, 0x00000000, 0x00000000), uint4(0x00000000, 0x00000000, 0x00000000, 0xF6000000),
+	uint4(0x0000003F, 0x000003F0, 0x00003F00, 0x00000000), uint4(0x00000000, 0x00000000, 0x00000000, 0xF6400000),
+	uint4(0x3CFBFFFF, 0xFFFFFFFE, 0xFFFFFFFF, 0xFFFFFFFF), uint4(0xFFFFFFFF, 0xFFFFFFFF, 0x00FFFFFF, 0xF6800000),
+	uint4(0x3CF7D343, 0xEF8F0C0F, 0x1C1041FB, 0x608217DF), uint4(0x0C307C78, 0xE384D043, 0x00218618, 0xF6C00000),
+	uint4(0xCF39CF38, 0xF7BCF381, 0x7BCF381C, 0xBCF383CF), uint4(0xCF383DFF, 0xF383DFFB, 0x007FFFBC, 0xF7000000),
+	uint4(0x3CF3CF3C, 0xCF3CF3CF, 0xF3CF3CF3, 0x3CF3CF3C), uint4(0xC71CF3CF, 0x71C71C71, 0x0071C71C, 0xF7400000),
+	uint4(0x00FFFFFF, 0x0FFFFFF0, 0x03FFFF00, 0x3FFFF000), uint4(0x0FFF0000, 0xFC0FC000, 0x00FFFFC0, 0xF7800000),
+	uint4(0x0083EFFF, 0x0020FBF0, 0x00083E00, 0x00020000), uint4(0x00000000, 0x00000000, 0x00000000, 0xF8400000),
+	uint4(0x20E3EFC0, 0x0C3CFFF0, 0x038FBFFC, 0xC061FFFF), uint4(0x7FCC3CF7, 0x8FB1C71C, 0x000030C3, 0xF8800000),
+	uint4(0x00082086, 0x00820860, 0x000004FC, 0xFF004F7D), uint4(0xBEC0F7DF, 0xEFFE79EF, 0x00E79EFB, 0xF8C00000),
+	uint4(0x0FFB8801, 0x3FB88000, 0xFB880000, 0xB8800001), uint4(0x8800FC03, 0x800FC01B, 0x00FFF0B8, 0xF9800000),
+	uint4(0xC3041000, 0x18608200, 0x8208208E, 0x30C30861), uint4(0x0C30C70C, 0xC30C30C3, 0x00C30C30, 0xF9C00000),
+	uint4(0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x00000FFF), uint4(0x00000000, 0x00000000, 0x00000000, 0xFA000000),
+	uint4(0xFF000001, 0xFFC0000F, 0xFC0000FF, 0xFF000FFF), uint4(0xF000FFFF, 0xFC07FFFF, 0x003FFFFF, 0xFA400000),
+	uint4(0x00000000, 0x00010000, 0x00008000, 0x0000C800), uint4(0x00000400, 0x00000300, 0x00000380, 0xFA800000),
+	uint4(0xFFFF0000, 0xFFF8000F, 0xFFE000FF, 0xFFC00FFF), uint4(0xFE0003FF, 0xF8003FFF, 0x0003FFFF, 0xFB800000),
+	uint4(0x470C73CF, 0x524B2C70, 0x34965B14, 0x1867930C), uint4(0xCE3830C7, 0xE3879C73, 0x007BCF3C, 0xFBC00000),
+	uint4(0x00000200, 0xFFBDEE70, 0xFBCE23FF, 0xBCE20FFF), uint4(0xCE20FFFF, 0xE20FFFFB, 0x00FFFFBC, 0xFC000000),
+	uint4(0xFFFFE001, 0xFFFF000F, 0xFFF800FF, 0xFFC00FFF), uint4(0xFE00FFFF, 0xF00FFFFF, 0x00FFFFFF, 0xFC400000),
+	uint4(0x00000000, 0x00000200, 0x00083000, 0x20C38000), uint4(0x0E3C0000, 0xF3E00083, 0x00020C38, 0xFC800000),
+	uint4(0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x00FFF000), uint4(0x00000000, 0x00000000, 0x00000000, 0xFD000000),
+	uint4(0xFFFFEC01, 0xFFFC801F, 0xFF8001FF, 0xB0001FFF), uint4(0x0001FFFF, 0x001FFFF2, 0x00FFFE00, 0xFD400000),
+	uint4(0xFF000003, 0xF0000033, 0x0000031F, 0xC00011FF), uint4(0x00011FFF, 0x0010FFFC, 0x000FFFC0, 0xFD800000),
+	uint4(0xEFF9EF3C, 0x798E31D7, 0x8010434C, 0x82104C20), uint4(0x630CC618, 0x73CCE398, 0x00DEFB9E, 0xFDC00000),
+	uint4(0xFFC00000, 0xFE00000F, 0xE00000FF, 0x00000FFF), uint4(0x0000FFFF, 0x000FFFF2, 0x00FFFFA0, 0xFE000000),
+	uint4(0x30C38E38, 0x0C30E38C, 0xC30C38C3, 0x30C30C30), uint4(0x0C30C30C, 0xC30C30C3, 0x00830C30, 0xFE800000),
+	uint4(0xCE38C210, 0x31840001, 0x000FFB0C, 0xBEF79041), uint4(0xEF3C03FF, 0xFBCFFFFF, 0x00FFFFFE, 0xFEC00000),
+	uint4(0x00000000, 0x00000000, 0x00000000, 0xC0000000), uint4(0xEFBEFFFF, 0xF3CF3EFB, 0x00E38F3C, 0xFF400000),
+	uint4(0x000DEE30, 0x00DFFB80, 0x0DFFFE00, 0xDFFFF000), uint4(0xFFFF0000, 0xFFF0000D, 0x000000DF, 0xFF800000),
+	uint4(0x0830C30E, 0x61861C72, 0x0C30C310, 0x618610C3), uint4(0x04180410, 0x20C00041, 0x00800208, 0xFFC00000),
+};
+
+#endif // ASTC_PARTITION_TABLE_HLSL
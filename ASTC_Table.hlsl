@@ -1,3 +1,65 @@
+// constants and tables shared by ASTC_BlockEncode.hlsl and the c++ build of it,
+// they don't depend on the shader permutation so the c++ side includes them once.
+#ifndef ASTC_TABLE_HLSL
+#define ASTC_TABLE_HLSL
+
+// the default weight grid, weight_grids_<w>x<h>[0] of every footprint
+#define X_GRIDS 4
+#define Y_GRIDS 4
+
+#define SMALL_VALUE 0.00001f
+
+// the power iterations eigen_vector() makes at most, each one multiplies by the 4th power of the covariance,
+// and the cosine between two iterations above which the axis has converged
+#define EIGEN_ITERATIONS 4
+#define EIGEN_CONVERGED 0.99999f
+
+/*
+* supported color_endpoint_mode
+*/
+#define CEM_LDR_LUMINANCE_DIRECT 0
+#define CEM_LDR_LUMINANCE_ALPHA_DIRECT 4
+#define CEM_LDR_RGB_DIRECT 8
+#define CEM_LDR_RGB_BASE_OFFSET 9
+#define CEM_LDR_RGBA_DIRECT 12
+#define CEM_LDR_RGBA_BASE_OFFSET 13
+#define CEM_HDR_RGB_SCALE 7
+#define CEM_HDR_RGB_DIRECT 11
+#define CEM_HDR_RGBA_DIRECT 15
+
+/**
+ * form [ARM:astc-encoder]
+ * Define normalized (starting at zero) numeric ranges that can be represented
+ * with 8 bits or less.
+ */
+#define	QUANT_2 0
+#define	QUANT_3 1
+#define	QUANT_4 2
+#define	QUANT_5 3
+#define	QUANT_6 4
+#define	QUANT_8 5
+#define	QUANT_10 6
+#define	QUANT_12 7
+#define	QUANT_16 8
+#define	QUANT_20 9
+#define	QUANT_24 10
+#define	QUANT_32 11
+#define	QUANT_40 12
+#define	QUANT_48 13
+#define	QUANT_64 14
+#define	QUANT_80 15
+#define	QUANT_96 16
+#define	QUANT_128 17
+#define	QUANT_160 18
+#define	QUANT_192 19
+#define	QUANT_256 20
+#define	QUANT_MAX 21
+
+// number of values of each QUANT_* range
+static const int quant_levels[QUANT_MAX] =
+{
+	2, 3, 4, 5, 6, 8, 10, 12, 16, 20, 24, 32, 40, 48, 64, 80, 96, 128, 160, 192, 256
+};
 
 // from [ARM:astc-encoder] quantization_and_transfer_table quant_and_xfer_tables
 #define WEIGHT_QUANTIZE_NUM 32
@@ -65,3 +127,216 @@ static const int scramble_table[12 * WEIGHT_QUANTIZE_NUM] = {
 
 };
 
+ /**
+  * Table that describes the number of trits or quints along with bits required
+  * for storing each range.
+  */
+static const int bits_trits_quints_table[QUANT_MAX * 3] =
+{
+	1, 0, 0,  // RANGE_2
+	0, 1, 0,  // RANGE_3
+	2, 0, 0,  // RANGE_4
+	0, 0, 1,  // RANGE_5
+	1, 1, 0,  // RANGE_6
+	3, 0, 0,  // RANGE_8
+	1, 0, 1,  // RANGE_10
+	2, 1, 0,  // RANGE_12
+	4, 0, 0,  // RANGE_16
+	2, 0, 1,  // RANGE_20
+	3, 1, 0,  // RANGE_24
+	5, 0, 0,  // RANGE_32
+	3, 0, 1,  // RANGE_40
+	4, 1, 0,  // RANGE_48
+	6, 0, 0,  // RANGE_64
+	4, 0, 1,  // RANGE_80
+	5, 1, 0,  // RANGE_96
+	7, 0, 0,  // RANGE_128
+	5, 0, 1,  // RANGE_160
+	6, 1, 0,  // RANGE_192
+	8, 0, 0   // RANGE_256
+};
+
+static const int integer_from_trits[243] =
+{
+	0,1,2,    4,5,6,    8,9,10, 
+	16,17,18, 20,21,22, 24,25,26,
+	3,7,15,   19,23,27, 12,13,14, 
+	32,33,34, 36,37,38, 40,41,42,
+	48,49,50, 52,53,54, 56,57,58,
+	35,39,47, 51,55,59, 44,45,46, 
+	64,65,66, 68,69,70, 72,73,74,
+	80,81,82, 84,85,86, 88,89,90,
+	67,71,79, 83,87,91, 76,77,78,
+
+	128,129,130, 132,133,134, 136,137,138,
+	144,145,146, 148,149,150, 152,153,154,
+	131,135,143, 147,151,155, 140,141,142,
+	160,161,162, 164,165,166, 168,169,170,
+	176,177,178, 180,181,182, 184,185,186,
+	163,167,175, 179,183,187, 172,173,174,
+	192,193,194, 196,197,198, 200,201,202,
+	208,209,210, 212,213,214, 216,217,218,
+	195,199,207, 211,215,219, 204,205,206,
+
+	96,97,98, 	 100,101,102, 104,105,106,
+	112,113,114, 116,117,118, 120,121,122,
+	99,103,111,  115,119,123, 108,109,110, 
+	224,225,226, 228,229,230, 232,233,234,
+	240,241,242, 244,245,246, 248,249,250,
+	227,231,239, 243,247,251, 236,237,238,
+	28,29,30, 	 60,61,62, 	  92,93,94, 
+	156,157,158, 188,189,190, 220,221,222,
+	31,63,127, 	 159,191,255, 252,253,254,
+
+};
+
+static const int integer_from_quints[125] =
+{
+	0,1,2,3,4, 			8,9,10,11,12, 			16,17,18,19,20,			24,25,26,27,28, 		5,13,21,29,6,
+	32,33,34,35,36, 	40,41,42,43,44, 		48,49,50,51,52, 		56,57,58,59,60, 		37,45,53,61,14,	
+	64,65,66,67,68, 	72,73,74,75,76, 		80,81,82,83,84, 		88,89,90,91,92, 		69,77,85,93,22,
+	96,97,98,99,100, 	104,105,106,107,108,	112,113,114,115,116,	120,121,122,123,124, 	101,109,117,125,30,	
+	102,103,70,71,38, 	110,111,78,79,46, 		118,119,86,87,54, 		126,127,94,95,62, 		39,47,55,63,31
+};
+
+// first entry of each range in color_quant_table, the endpoints use QUANT_6 and up
+static const int color_table_offset[QUANT_MAX] =
+{
+	0, 0, 0, 0, 0, 6, 14, 24, 36, 52, 72, 96, 128, 168, 216, 280, 360, 456, 584, 744, 936
+};
+
+/**
+ * "C.2.13 Endpoint Unquantization" of the endpoint ranges, entry k of a range packs
+ *	bits 0..7: the ise value with the k-th smallest unquantized value
+ *	bits 8..15: the unquantized 8 bit value of ise value k
+ */
+static const int color_quant_table[1192] =
+{
+	// QUANT_6
+	0x0000, 0xFF02, 0x3304, 0xCC05, 0x6603, 0x9901,
+	// QUANT_8
+	0x0000, 0x2401, 0x4902, 0x6D03, 0x9204, 0xB605, 0xDB06, 0xFF07,
+	// QUANT_10
+	0x0000, 0xFF02, 0x1C04, 0xE306, 0x3808, 0xC709, 0x5407, 0xAB05, 0x7103, 0x8E01,
+	// QUANT_12
+	0x0000, 0xFF04, 0x4508, 0xBA02, 0x1706, 0xE80A, 0x5C0B, 0xA307, 0x2E03, 0xD109, 0x7405, 0x8B01,
+	// QUANT_16
+	0x0000, 0x1101, 0x2202, 0x3303, 0x4404, 0x5505, 0x6606, 0x7707, 0x8808, 0x9909, 0xAA0A, 0xBB0B,
+	0xCC0C, 0xDD0D, 0xEE0E, 0xFF0F,
+	// QUANT_20
+	0x0000, 0xFF04, 0x4308, 0xBC0C, 0x0D10, 0xF202, 0x5006, 0xAF0A, 0x1B0E, 0xE412, 0x5E13, 0xA10F,
+	0x280B, 0xD707, 0x6B03, 0x9411, 0x360D, 0xC909, 0x7905, 0x8601,
+	// QUANT_24
+	0x0000, 0xFF08, 0x2110, 0xDE02, 0x420A, 0xBD12, 0x6304, 0x9C0C, 0x0B14, 0xF406, 0x2C0E, 0xD316,
+	0x4D17, 0xB20F, 0x6E07, 0x9115, 0x160D, 0xE905, 0x3713, 0xC80B, 0x5803, 0xA711, 0x7909, 0x8601,
+	// QUANT_32
+	0x0000, 0x0801, 0x1002, 0x1803, 0x2104, 0x2905, 0x3106, 0x3907, 0x4208, 0x4A09, 0x520A, 0x5A0B,
+	0x630C, 0x6B0D, 0x730E, 0x7B0F, 0x8410, 0x8C11, 0x9412, 0x9C13, 0xA514, 0xAD15, 0xB516, 0xBD17,
+	0xC618, 0xCE19, 0xD61A, 0xDE1B, 0xE71C, 0xEF1D, 0xF71E, 0xFF1F,
+	// QUANT_40
+	0x0000, 0xFF08, 0x2010, 0xDF18, 0x4120, 0xBE02, 0x610A, 0x9E12, 0x061A, 0xF922, 0x2704, 0xD80C,
+	0x4714, 0xB81C, 0x6824, 0x9706, 0x0D0E, 0xF216, 0x2D1E, 0xD226, 0x4E27, 0xB11F, 0x6E17, 0x910F,
+	0x1307, 0xEC25, 0x341D, 0xCB15, 0x540D, 0xAB05, 0x7523, 0x8A1B, 0x1A13, 0xE50B, 0x3A03, 0xC521,
+	0x5B19, 0xA411, 0x7B09, 0x8401,
+	// QUANT_48
+	0x0000, 0xFF10, 0x1020, 0xEF02, 0x2012, 0xDF22, 0x3004, 0xCF14, 0x4124, 0xBE06, 0x5116, 0xAE26,
+	0x6108, 0x9E18, 0x7128, 0x8E0A, 0x051A, 0xFA2A, 0x150C, 0xEA1C, 0x262C, 0xD90E, 0x361E, 0xC92E,
+	0x462F, 0xB91F, 0x560F, 0xA92D, 0x671D, 0x980D, 0x772B, 0x881B, 0x0B0B, 0xF429, 0x1B19, 0xE409,
+	0x2B27, 0xD417, 0x3B07, 0xC425, 0x4C15, 0xB305, 0x5C23, 0xA313, 0x6C03, 0x9321, 0x7C11, 0x8301,
+	// QUANT_64
+	0x0000, 0x0401, 0x0802, 0x0C03, 0x1004, 0x1405, 0x1806, 0x1C07, 0x2008, 0x2409, 0x280A, 0x2C0B,
+	0x300C, 0x340D, 0x380E, 0x3C0F, 0x4110, 0x4511, 0x4912, 0x4D13, 0x5114, 0x5515, 0x5916, 0x5D17,
+	0x6118, 0x6519, 0x691A, 0x6D1B, 0x711C, 0x751D, 0x791E, 0x7D1F, 0x8220, 0x8621, 0x8A22, 0x8E23,
+	0x9224, 0x9625, 0x9A26, 0x9E27, 0xA228, 0xA629, 0xAA2A, 0xAE2B, 0xB22C, 0xB62D, 0xBA2E, 0xBE2F,
+	0xC330, 0xC731, 0xCB32, 0xCF33, 0xD334, 0xD735, 0xDB36, 0xDF37, 0xE338, 0xE739, 0xEB3A, 0xEF3B,
+	0xF33C, 0xF73D, 0xFB3E, 0xFF3F,
+	// QUANT_80
+	0x0000, 0xFF10, 0x1020, 0xEF30, 0x2040, 0xDF02, 0x3012, 0xCF22, 0x4032, 0xBF42, 0x5004, 0xAF14,
+	0x6024, 0x9F34, 0x7044, 0x8F06, 0x0316, 0xFC26, 0x1336, 0xEC46, 0x2308, 0xDC18, 0x3328, 0xCC38,
+	0x4348, 0xBC0A, 0x531A, 0xAC2A, 0x643A, 0x9B4A, 0x740C, 0x8B1C, 0x062C, 0xF93C, 0x164C, 0xE90E,
+	0x261E, 0xD92E, 0x363E, 0xC94E, 0x474F, 0xB83F, 0x572F, 0xA81F, 0x670F, 0x984D, 0x773D, 0x882D,
+	0x091D, 0xF60D, 0x194B, 0xE63B, 0x2A2B, 0xD51B, 0x3A0B, 0xC549, 0x4A39, 0xB529, 0x5A19, 0xA509,
+	0x6A47, 0x9537, 0x7A27, 0x8517, 0x0D07, 0xF245, 0x1D35, 0xE225, 0x2D15, 0xD205, 0x3D43, 0xC233,
+	0x4D23, 0xB213, 0x5D03, 0xA241, 0x6D31, 0x9221, 0x7D11, 0x8201,
+	// QUANT_96
+	0x0000, 0xFF20, 0x0840, 0xF702, 0x1022, 0xEF42, 0x1804, 0xE724, 0x2044, 0xDF06, 0x2826, 0xD746,
+	0x3008, 0xCF28, 0x3848, 0xC70A, 0x402A, 0xBF4A, 0x480C, 0xB72C, 0x504C, 0xAF0E, 0x582E, 0xA74E,
+	0x6010, 0x9F30, 0x6850, 0x9712, 0x7032, 0x8F52, 0x7814, 0x8734, 0x0254, 0xFD16, 0x0A36, 0xF556,
+	0x1218, 0xED38, 0x1A58, 0xE51A, 0x233A, 0xDC5A, 0x2B1C, 0xD43C, 0x335C, 0xCC1E, 0x3B3E, 0xC45E,
+	0x435F, 0xBC3F, 0x4B1F, 0xB45D, 0x533D, 0xAC1D, 0x5B5B, 0xA43B, 0x631B, 0x9C59, 0x6B39, 0x9419,
+	0x7357, 0x8C37, 0x7B17, 0x8455, 0x0535, 0xFA15, 0x0D53, 0xF233, 0x1513, 0xEA51, 0x1D31, 0xE211,
+	0x254F, 0xDA2F, 0x2D0F, 0xD24D, 0x352D, 0xCA0D, 0x3D4B, 0xC22B, 0x460B, 0xB949, 0x4E29, 0xB109,
+	0x5647, 0xA927, 0x5E07, 0xA145, 0x6625, 0x9905, 0x6E43, 0x9123, 0x7603, 0x8941, 0x7E21, 0x8101,
+	// QUANT_128
+	0x0000, 0x0201, 0x0402, 0x0603, 0x0804, 0x0A05, 0x0C06, 0x0E07, 0x1008, 0x1209, 0x140A, 0x160B,
+	0x180C, 0x1A0D, 0x1C0E, 0x1E0F, 0x2010, 0x2211, 0x2412, 0x2613, 0x2814, 0x2A15, 0x2C16, 0x2E17,
+	0x3018, 0x3219, 0x341A, 0x361B, 0x381C, 0x3A1D, 0x3C1E, 0x3E1F, 0x4020, 0x4221, 0x4422, 0x4623,
+	0x4824, 0x4A25, 0x4C26, 0x4E27, 0x5028, 0x5229, 0x542A, 0x562B, 0x582C, 0x5A2D, 0x5C2E, 0x5E2F,
+	0x6030, 0x6231, 0x6432, 0x6633, 0x6834, 0x6A35, 0x6C36, 0x6E37, 0x7038, 0x7239, 0x743A, 0x763B,
+	0x783C, 0x7A3D, 0x7C3E, 0x7E3F, 0x8140, 0x8341, 0x8542, 0x8743, 0x8944, 0x8B45, 0x8D46, 0x8F47,
+	0x9148, 0x9349, 0x954A, 0x974B, 0x994C, 0x9B4D, 0x9D4E, 0x9F4F, 0xA150, 0xA351, 0xA552, 0xA753,
+	0xA954, 0xAB55, 0xAD56, 0xAF57, 0xB158, 0xB359, 0xB55A, 0xB75B, 0xB95C, 0xBB5D, 0xBD5E, 0xBF5F,
+	0xC160, 0xC361, 0xC562, 0xC763, 0xC964, 0xCB65, 0xCD66, 0xCF67, 0xD168, 0xD369, 0xD56A, 0xD76B,
+	0xD96C, 0xDB6D, 0xDD6E, 0xDF6F, 0xE170, 0xE371, 0xE572, 0xE773, 0xE974, 0xEB75, 0xED76, 0xEF77,
+	0xF178, 0xF379, 0xF57A, 0xF77B, 0xF97C, 0xFB7D, 0xFD7E, 0xFF7F,
+	// QUANT_160
+	0x0000, 0xFF20, 0x0840, 0xF760, 0x1080, 0xEF02, 0x1822, 0xE742, 0x2062, 0xDF82, 0x2804, 0xD724,
+	0x3044, 0xCF64, 0x3884, 0xC706, 0x4026, 0xBF46, 0x4866, 0xB786, 0x5008, 0xAF28, 0x5848, 0xA768,
+	0x6088, 0x9F0A, 0x682A, 0x974A, 0x706A, 0x8F8A, 0x780C, 0x872C, 0x014C, 0xFE6C, 0x098C, 0xF60E,
+	0x112E, 0xEE4E, 0x196E, 0xE68E, 0x2110, 0xDE30, 0x2950, 0xD670, 0x3190, 0xCE12, 0x3932, 0xC652,
+	0x4172, 0xBE92, 0x4914, 0xB634, 0x5154, 0xAE74, 0x5994, 0xA616, 0x6136, 0x9E56, 0x6976, 0x9696,
+	0x7118, 0x8E38, 0x7958, 0x8678, 0x0398, 0xFC1A, 0x0B3A, 0xF45A, 0x137A, 0xEC9A, 0x1B1C, 0xE43C,
+	0x235C, 0xDC7C, 0x2B9C, 0xD41E, 0x333E, 0xCC5E, 0x3B7E, 0xC49E, 0x439F, 0xBC7F, 0x4B5F, 0xB43F,
+	0x531F, 0xAC9D, 0x5B7D, 0xA45D, 0x633D, 0x9C1D, 0x6B9B, 0x947B, 0x735B, 0x8C3B, 0x7B1B, 0x8499,
+	0x0479, 0xFB59, 0x0C39, 0xF319, 0x1497, 0xEB77, 0x1C57, 0xE337, 0x2417, 0xDB95, 0x2C75, 0xD355,
+	0x3435, 0xCB15, 0x3C93, 0xC373, 0x4453, 0xBB33, 0x4C13, 0xB391, 0x5471, 0xAB51, 0x5C31, 0xA311,
+	0x648F, 0x9B6F, 0x6C4F, 0x932F, 0x740F, 0x8B8D, 0x7C6D, 0x834D, 0x062D, 0xF90D, 0x0E8B, 0xF16B,
+	0x164B, 0xE92B, 0x1E0B, 0xE189, 0x2669, 0xD949, 0x2E29, 0xD109, 0x3687, 0xC967, 0x3E47, 0xC127,
+	0x4607, 0xB985, 0x4E65, 0xB145, 0x5625, 0xA905, 0x5E83, 0xA163, 0x6643, 0x9923, 0x6E03, 0x9181,
+	0x7661, 0x8941, 0x7E21, 0x8101,
+	// QUANT_192
+	0x0000, 0xFF40, 0x0480, 0xFB02, 0x0842, 0xF782, 0x0C04, 0xF344, 0x1084, 0xEF06, 0x1446, 0xEB86,
+	0x1808, 0xE748, 0x1C88, 0xE30A, 0x204A, 0xDF8A, 0x240C, 0xDB4C, 0x288C, 0xD70E, 0x2C4E, 0xD38E,
+	0x3010, 0xCF50, 0x3490, 0xCB12, 0x3852, 0xC792, 0x3C14, 0xC354, 0x4094, 0xBF16, 0x4456, 0xBB96,
+	0x4818, 0xB758, 0x4C98, 0xB31A, 0x505A, 0xAF9A, 0x541C, 0xAB5C, 0x589C, 0xA71E, 0x5C5E, 0xA39E,
+	0x6020, 0x9F60, 0x64A0, 0x9B22, 0x6862, 0x97A2, 0x6C24, 0x9364, 0x70A4, 0x8F26, 0x7466, 0x8BA6,
+	0x7828, 0x8768, 0x7CA8, 0x832A, 0x016A, 0xFEAA, 0x052C, 0xFA6C, 0x09AC, 0xF62E, 0x0D6E, 0xF2AE,
+	0x1130, 0xEE70, 0x15B0, 0xEA32, 0x1972, 0xE6B2, 0x1D34, 0xE274, 0x21B4, 0xDE36, 0x2576, 0xDAB6,
+	0x2938, 0xD678, 0x2DB8, 0xD23A, 0x317A, 0xCEBA, 0x353C, 0xCA7C, 0x39BC, 0xC63E, 0x3D7E, 0xC2BE,
+	0x41BF, 0xBE7F, 0x453F, 0xBABD, 0x497D, 0xB63D, 0x4DBB, 0xB27B, 0x513B, 0xAEB9, 0x5579, 0xAA39,
+	0x59B7, 0xA677, 0x5D37, 0xA2B5, 0x6175, 0x9E35, 0x65B3, 0x9A73, 0x6933, 0x96B1, 0x6D71, 0x9231,
+	0x71AF, 0x8E6F, 0x752F, 0x8AAD, 0x796D, 0x862D, 0x7DAB, 0x826B, 0x022B, 0xFDA9, 0x0669, 0xF929,
+	0x0AA7, 0xF567, 0x0E27, 0xF1A5, 0x1265, 0xED25, 0x16A3, 0xE963, 0x1A23, 0xE5A1, 0x1E61, 0xE121,
+	0x229F, 0xDD5F, 0x261F, 0xD99D, 0x2A5D, 0xD51D, 0x2E9B, 0xD15B, 0x321B, 0xCD99, 0x3659, 0xC919,
+	0x3A97, 0xC557, 0x3E17, 0xC195, 0x4255, 0xBD15, 0x4693, 0xB953, 0x4A13, 0xB591, 0x4E51, 0xB111,
+	0x528F, 0xAD4F, 0x560F, 0xA98D, 0x5A4D, 0xA50D, 0x5E8B, 0xA14B, 0x620B, 0x9D89, 0x6649, 0x9909,
+	0x6A87, 0x9547, 0x6E07, 0x9185, 0x7245, 0x8D05, 0x7683, 0x8943, 0x7A03, 0x8581, 0x7E41, 0x8101,
+	// QUANT_256
+	0x0000, 0x0101, 0x0202, 0x0303, 0x0404, 0x0505, 0x0606, 0x0707, 0x0808, 0x0909, 0x0A0A, 0x0B0B,
+	0x0C0C, 0x0D0D, 0x0E0E, 0x0F0F, 0x1010, 0x1111, 0x1212, 0x1313, 0x1414, 0x1515, 0x1616, 0x1717,
+	0x1818, 0x1919, 0x1A1A, 0x1B1B, 0x1C1C, 0x1D1D, 0x1E1E, 0x1F1F, 0x2020, 0x2121, 0x2222, 0x2323,
+	0x2424, 0x2525, 0x2626, 0x2727, 0x2828, 0x2929, 0x2A2A, 0x2B2B, 0x2C2C, 0x2D2D, 0x2E2E, 0x2F2F,
+	0x3030, 0x3131, 0x3232, 0x3333, 0x3434, 0x3535, 0x3636, 0x3737, 0x3838, 0x3939, 0x3A3A, 0x3B3B,
+	0x3C3C, 0x3D3D, 0x3E3E, 0x3F3F, 0x4040, 0x4141, 0x4242, 0x4343, 0x4444, 0x4545, 0x4646, 0x4747,
+	0x4848, 0x4949, 0x4A4A, 0x4B4B, 0x4C4C, 0x4D4D, 0x4E4E, 0x4F4F, 0x5050, 0x5151, 0x5252, 0x5353,
+	0x5454, 0x5555, 0x5656, 0x5757, 0x5858, 0x5959, 0x5A5A, 0x5B5B, 0x5C5C, 0x5D5D, 0x5E5E, 0x5F5F,
+	0x6060, 0x6161, 0x6262, 0x6363, 0x6464, 0x6565, 0x6666, 0x6767, 0x6868, 0x6969, 0x6A6A, 0x6B6B,
+	0x6C6C, 0x6D6D, 0x6E6E, 0x6F6F, 0x7070, 0x7171, 0x7272, 0x7373, 0x7474, 0x7575, 0x7676, 0x7777,
+	0x7878, 0x7979, 0x7A7A, 0x7B7B, 0x7C7C, 0x7D7D, 0x7E7E, 0x7F7F, 0x8080, 0x8181, 0x8282, 0x8383,
+	0x8484, 0x8585, 0x8686, 0x8787, 0x8888, 0x8989, 0x8A8A, 0x8B8B, 0x8C8C, 0x8D8D, 0x8E8E, 0x8F8F,
+	0x9090, 0x9191, 0x9292, 0x9393, 0x9494, 0x9595, 0x9696, 0x9797, 0x9898, 0x9999, 0x9A9A, 0x9B9B,
+	0x9C9C, 0x9D9D, 0x9E9E, 0x9F9F, 0xA0A0, 0xA1A1, 0xA2A2, 0xA3A3, 0xA4A4, 0xA5A5, 0xA6A6, 0xA7A7,
+	0xA8A8, 0xA9A9, 0xAAAA, 0xABAB, 0xACAC, 0xADAD, 0xAEAE, 0xAFAF, 0xB0B0, 0xB1B1, 0xB2B2, 0xB3B3,
+	0xB4B4, 0xB5B5, 0xB6B6, 0xB7B7, 0xB8B8, 0xB9B9, 0xBABA, 0xBBBB, 0xBCBC, 0xBDBD, 0xBEBE, 0xBFBF,
+	0xC0C0, 0xC1C1, 0xC2C2, 0xC3C3, 0xC4C4, 0xC5C5, 0xC6C6, 0xC7C7, 0xC8C8, 0xC9C9, 0xCACA, 0xCBCB,
+	0xCCCC, 0xCDCD, 0xCECE, 0xCFCF, 0xD0D0, 0xD1D1, 0xD2D2, 0xD3D3, 0xD4D4, 0xD5D5, 0xD6D6, 0xD7D7,
+	0xD8D8, 0xD9D9, 0xDADA, 0xDBDB, 0xDCDC, 0xDDDD, 0xDEDE, 0xDFDF, 0xE0E0, 0xE1E1, 0xE2E2, 0xE3E3,
+	0xE4E4, 0xE5E5, 0xE6E6, 0xE7E7, 0xE8E8, 0xE9E9, 0xEAEA, 0xEBEB, 0xECEC, 0xEDED, 0xEEEE, 0xEFEF,
+	0xF0F0, 0xF1F1, 0xF2F2, 0xF3F3, 0xF4F4, 0xF5F5, 0xF6F6, 0xF7F7, 0xF8F8, 0xF9F9, 0xFAFA, 0xFBFB,
+	0xFCFC, 0xFDFD, 0xFEFE, 0xFFFF,
+};
+
+#include "ASTC_PartitionTable.hlsl"
+#include "ASTC_DecimationTable.hlsl"
+
+#endif // ASTC_TABLE_HLSL
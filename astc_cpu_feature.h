@@ -0,0 +1,108 @@
+#pragma once
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
+#define ASTC_X86 1
+#else
+#define ASTC_X86 0
+#endif
+
+#if ASTC_X86
+#if defined(_MSC_VER)
+#include <intrin.h>
+#else
+#include <cpuid.h>
+#endif
+#endif
+
+#if ASTC_X86
+inline void astc_cpuid(int leaf, int subleaf, unsigned int regs[4])
+{
+#if defined(_MSC_VER)
+	int info[4];
+	__cpuidex(info, leaf, subleaf);
+	for (int i = 0; i < 4; ++i) {
+		regs[i] = (unsigned int)info[i];
+	}
+#else
+	__cpuid_count(leaf, subleaf, regs[0], regs[1], regs[2], regs[3]);
+#endif
+}
+
+// the os saves the ymm (and zmm) registers on context switch
+inline unsigned long long astc_xgetbv()
+{
+#if defined(_MSC_VER)
+	return _xgetbv(0);
+#else
+	unsigned int eax, edx;
+	__asm__ __volatile__("xgetbv" : "=a"(eax), "=d"(edx) : "c"(0));
+	return ((unsigned long long)edx << 32) | eax;
+#endif
+}
+#endif
+
+/**
+ * The instruction sets the block-parallel kernels are built for, from narrow to wide.
+ */
+enum simd_isa
+{
+	SIMD_ISA_SCALAR = 0,
+	SIMD_ISA_SSE41,
+	SIMD_ISA_AVX2,
+	SIMD_ISA_AVX512,
+	SIMD_ISA_AUTO,		// the widest one the cpu supports
+};
+
+inline simd_isa detect_simd_isa()
+{
+#if ASTC_X86
+	unsigned int regs[4];
+	astc_cpuid(0, 0, regs);
+	unsigned int max_leaf = regs[0];
+	if (max_leaf < 1) {
+		return SIMD_ISA_SCALAR;
+	}
+
+	astc_cpuid(1, 0, regs);
+	bool sse41 = (regs[2] & (1u << 19)) != 0;
+	bool osxsave = (regs[2] & (1u << 27)) != 0;
+	bool avx = (regs[2] & (1u << 28)) != 0;
+	if (!sse41) {
+		return SIMD_ISA_SCALAR;
+	}
+
+	// the os must save the ymm state for AVX2, and the opmask/zmm state for AVX-512
+	unsigned long long xcr0 = (osxsave && avx) ? astc_xgetbv() : 0;
+	if (max_leaf < 7 || (xcr0 & 0x6) != 0x6) {
+		return SIMD_ISA_SSE41;
+	}
+
+	astc_cpuid(7, 0, regs);
+	bool avx2 = (regs[1] & (1u << 5)) != 0;
+	bool avx512f = (regs[1] & (1u << 16)) != 0;
+	if (avx512f && avx2 && (xcr0 & 0xE6) == 0xE6) {
+		return SIMD_ISA_AVX512;
+	}
+	return avx2 ? SIMD_ISA_AVX2 : SIMD_ISA_SSE41;
+#else
+	return SIMD_ISA_SCALAR;
+#endif
+}
+
+// cpuid is only queried once per process
+inline simd_isa cpu_simd_isa()
+{
+	static const simd_isa isa = detect_simd_isa();
+	return isa;
+}
+
+inline const char* simd_isa_name(simd_isa isa)
+{
+	switch (isa) {
+	case SIMD_ISA_SSE41: return "sse4.1";
+	case SIMD_ISA_AVX2: return "avx2";
+	case SIMD_ISA_AVX512: return "avx512";
+	case SIMD_ISA_AUTO: return "auto";
+	default: return "scalar";
+	}
+}
@@ -7,26 +7,7 @@
 #include <d3d11.h>
 #include <d3dcompiler.h>
 
-#define THREAD_NUM_X	8
-#define THREAD_NUM_Y	8
-#define BLOCK_BYTES		16
-
-struct encode_option
-{
-	bool is4x4;
-	bool is6x6;
-	bool is_normal_map;
-	bool has_alpha;
-	bool srgb;
-	encode_option() : is4x4(true)
-		, is6x6(false)
-		, is_normal_map(false)
-		, has_alpha(false)
-		, srgb(false)
-	{
-	}
-};
-
+#include "astc_option.h"
 
 typedef struct _csConstantBuffer
 {
@@ -51,13 +32,22 @@ HRESULT compile_shader(_In_ LPCWSTR srcFile, _In_ LPCSTR entryPoint, LPCSTR targ
 
 	auto cTHREAD_NUM_X = std::to_string(THREAD_NUM_X);
 	auto cTHREAD_NUM_Y = std::to_string(THREAD_NUM_Y);
+	auto cBLOCK_DIM_X = std::to_string(option.block_x);
+	auto cBLOCK_DIM_Y = std::to_string(option.block_y);
+	auto cEFFORT = std::to_string(option.effort);
+	auto cVOID_EXTENT_TOLERANCE = std::to_string(option.void_extent_tolerance);
 
 	const D3D_SHADER_MACRO defines[] = {
 		"THREAD_NUM_X", cTHREAD_NUM_X.c_str(),
 		"THREAD_NUM_Y", cTHREAD_NUM_Y.c_str(),
 		"IS_NORMALMAP", option.is_normal_map ? "1" : "0",
-		"BLOCK_6X6", option.is4x4 ? "0" : "1",
+		"BLOCK_DIM_X", cBLOCK_DIM_X.c_str(),
+		"BLOCK_DIM_Y", cBLOCK_DIM_Y.c_str(),
 		"HAS_ALPHA", option.has_alpha ? "1" : "0",
+		"EFFORT", cEFFORT.c_str(),
+		"DUAL_PLANE", option.dual_plane ? "1" : "0",
+		"VOID_EXTENT_TOLERANCE", cVOID_EXTENT_TOLERANCE.c_str(),
+		"IS_HDR", option.hdr ? "1" : "0",
 		NULL, NULL
 	};
 
@@ -121,16 +111,15 @@ ID3D11Buffer* encode_astc(ID3D11Device *pd3dDevice, ID3D11DeviceContext *pDevice
 
 	pDeviceContext->CSSetShaderResources(0, 1, &pTextureSRV);
 
-	int DimSize = option.is4x4 ? 4 : 6;
 	int TexWidth = TexDesc.Width;
 	int TexHeight = TexDesc.Height;
-	int xBlockNum = (TexWidth + DimSize - 1) / DimSize;
-	int yBlockNum = (TexHeight + DimSize - 1) / DimSize;
+	int xBlockNum = (TexWidth + option.block_x - 1) / option.block_x;
+	int yBlockNum = (TexHeight + option.block_y - 1) / option.block_y;
 	int TotalBlockNum = xBlockNum * yBlockNum;
 
 	int GroupSize = THREAD_NUM_X * THREAD_NUM_Y;
 	int GroupNum = (TotalBlockNum + GroupSize - 1) / GroupSize;
-	int GroupNumX = (TexWidth + DimSize - 1) / DimSize;
+	int GroupNumX = xBlockNum;
 	int GroupNumY = (GroupNum + GroupNumX - 1) / GroupNumX;
 
 	// unordered access view for output astc buf
@@ -0,0 +1,18 @@
+#include "astc_encode_cpu.h"
+
+#if ASTC_X86
+
+// everything above is compiled for the baseline ISA, only the kernel below may use AVX2
+#if defined(__GNUC__) && !defined(__AVX2__)
+#pragma GCC target("avx2")
+#endif
+
+#include "astc_vecmath_avx2.h"
+#include "astc_simd_kernel.h"
+
+void encode_blocks_avx2(const simd_kernel_params& params, const float* soa_texels, uint8_t* out_blocks, int count)
+{
+	simd_block_kernel<astc_avx2::simd_avx2>::encode_blocks(params, soa_texels, out_blocks, count);
+}
+
+#endif
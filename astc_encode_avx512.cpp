@@ -0,0 +1,25 @@
+#include "astc_encode_cpu.h"
+
+#if ASTC_X86
+
+// everything above is compiled for the baseline ISA, only the kernel below may use AVX-512
+#if defined(__GNUC__) && !defined(__AVX512F__)
+#pragma GCC target("avx512f")
+#endif
+
+// AVX-512F implies FMA, keep every multiply and add separately rounded like the scalar path
+#if defined(__clang__)
+#pragma clang fp contract(off)
+#elif defined(__GNUC__)
+#pragma GCC optimize("fp-contract=off")
+#endif
+
+#include "astc_vecmath_avx512.h"
+#include "astc_simd_kernel.h"
+
+void encode_blocks_avx512(const simd_kernel_params& params, const float* soa_texels, uint8_t* out_blocks, int count)
+{
+	simd_block_kernel<astc_avx512::simd_avx512>::encode_blocks(params, soa_texels, out_blocks, count);
+}
+
+#endif
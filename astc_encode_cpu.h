@@ -0,0 +1,534 @@
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+#include "astc_option.h"
+#include "astc_thread_pool.h"
+#include "astc_cpu_feature.h"
+#include "astc_encode_simd.h"
+#include "astc_hlsl_shim.h"
+
+/**
+ * Portable cpu backend of ASTC_Encode.hlsl.
+ * the scalar path is ASTC_BlockEncode.hlsl itself, compiled as c++ in astc_encode_scalar.cpp,
+ * so one block encoded here is bit-identical to the uint4 the compute shader writes for it.
+ */
+namespace astc_cpu
+{
+
+#include "ASTC_Table.hlsl"
+
+// texels of the largest footprint, 6x6x6 (12x12 has 144)
+#define CPU_MAX_BLOCK_SIZE 216
+
+/**
+ * every footprint with shader permutations in the cpu backend, X(x, y, z) with z = 1 for the 2d ones.
+ * astc_encode_permutations.h instantiates them and the lookup tables of astc_encode_scalar.cpp and astc_encode_hdr.cpp
+ * list them from here, a new footprint is one line next to its tables from astc_table_gen.cpp.
+ */
+#define ASTC_FOOTPRINTS(X) \
+	X(4, 4, 1) \
+	X(5, 4, 1) \
+	X(5, 5, 1) \
+	X(6, 5, 1) \
+	X(6, 6, 1) \
+	X(8, 5, 1) \
+	X(8, 6, 1) \
+	X(8, 8, 1) \
+	X(10, 5, 1) \
+	X(10, 6, 1) \
+	X(10, 8, 1) \
+	X(10, 10, 1) \
+	X(12, 10, 1) \
+	X(12, 12, 1) \
+	X(3, 3, 3) \
+	X(4, 4, 4) \
+	X(5, 5, 5) \
+	X(6, 6, 6)
+
+// namespace of a permutation, block_4x4x1_rgb, block_6x6x6_hdr_rgba, ...
+#define ASTC_PERMUTATION_NAME(w, h, d, variant) ASTC_PERMUTATION_NAME_(w, h, d, variant)
+#define ASTC_PERMUTATION_NAME_(w, h, d, variant) block_##w##x##h##x##d##_##variant
+
+/**
+ * The per-texture settings that the shader receives as macros.
+ */
+struct kernel_config
+{
+	int dim_x;			// BLOCK_DIM_X
+	int dim_y;			// BLOCK_DIM_Y
+	int dim_z;			// BLOCK_DIM_Z, 1 for the 2d footprints
+	bool has_alpha;		// HAS_ALPHA
+	bool is_normal_map;	// IS_NORMALMAP
+	bool srgb;			// the source texture is DXGI_FORMAT_R8G8B8A8_UNORM_SRGB
+	uint effort;		// EFFORT
+	bool dual_plane;	// DUAL_PLANE
+	float void_extent_tolerance;	// VOID_EXTENT_TOLERANCE
+	bool hdr;			// IS_HDR, the texels are floats
+	int block_size() const { return dim_x * dim_y * dim_z; }
+};
+
+// encode_block() of the shader permutation that matches "cfg"
+uint4 encode_block(const kernel_config& cfg, float4* texels);
+
+// encode_block() of the IS_HDR permutation that matches "cfg", astc_encode_hdr.cpp
+uint4 encode_block_hdr(const kernel_config& cfg, float4* texels);
+
+// assemble_blockmode() of the shader, the same for every permutation
+uint assemble_blockmode(uint weight_quantmethod);
+
+// grid_sample_taps() of the 4x4 default grid of the shader permutation that matches "cfg", the texels weight "i" of the grid samples
+void weight_grid_taps(const kernel_config& cfg, uint i, uint4& index, float4& coff);
+
+// encode_void_extent() of the shader, the same for every permutation.
+// named apart from it, a float4 argument would find both through argument dependent lookup
+uint4 void_extent_block(float4 color);
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// texel fetch, the cpu side of MainCS
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+inline float srgb_to_linear(float c)
+{
+	return (c <= 0.04045f) ? c / 12.92f : std::pow((c + 0.055f) / 1.055f, 2.4f);
+}
+
+/**
+ * byte to "InTexture.Load() * 255.0f", for both the UNORM and the UNORM_SRGB source format.
+ * UNORM_SRGB only decodes the color channels, alpha stays linear.
+ */
+struct texel_lut
+{
+	float value[256];
+	float alpha[256];
+	explicit texel_lut(bool srgb)
+	{
+		for (int i = 0; i < 256; ++i) {
+			float c = i / 255.0f;
+			value[i] = (srgb ? srgb_to_linear(c) : c) * 255.0f;
+			alpha[i] = c * 255.0f;
+		}
+	}
+};
+
+// Load() out of the texture returns zero, the same for the border blocks here
+inline void fetch_block(const kernel_config& cfg, const texel_lut& lut, const uint8_t* rgba, int width, int height, int row_stride, int block_x, int block_y, float4* texels)
+{
+	for (int y = 0; y < cfg.dim_y; ++y)
+	{
+		int py = block_y * cfg.dim_y + y;
+		for (int x = 0; x < cfg.dim_x; ++x)
+		{
+			int px = block_x * cfg.dim_x + x;
+			float4 texel = 0;
+			if (px < width && py < height)
+			{
+				const uint8_t* p = rgba + (ptrdiff_t)py * row_stride + (size_t)px * 4;
+				texel = float4(lut.value[p[0]], lut.value[p[1]], lut.value[p[2]], lut.alpha[p[3]]);
+			}
+			if (cfg.is_normal_map)
+			{
+				texel.z = 255.0f;
+				texel.w = 255.0f;
+			}
+			texels[y * cfg.dim_x + x] = texel;
+		}
+	}
+}
+
+// the hdr texels are "InTexture.Load()" of a float texture, rows "row_stride" bytes apart.
+// the texels past the edge repeat it like the shader, zero would stretch the block in the log domain.
+inline void fetch_block_hdr(const kernel_config& cfg, const float* rgba, int width, int height, int row_stride, int block_x, int block_y, float4* texels)
+{
+	for (int y = 0; y < cfg.dim_y; ++y)
+	{
+		int py = std::min(block_y * cfg.dim_y + y, height - 1);
+		for (int x = 0; x < cfg.dim_x; ++x)
+		{
+			int px = std::min(block_x * cfg.dim_x + x, width - 1);
+			const float* p = (const float*)((const uint8_t*)rgba + (ptrdiff_t)py * row_stride) + (size_t)px * 4;
+			float4 texel = float4(p[0], p[1], p[2], p[3]);
+			if (cfg.is_normal_map)
+			{
+				texel.z = 1.0f;
+				texel.w = 1.0f;
+			}
+			texels[y * cfg.dim_x + x] = texel;
+		}
+	}
+}
+
+// the texels of a 3d block, one fetch_block() per slice of "slices".
+// the slices past the last one repeat it, a whole slice of zero texels would cost a short slab most of its endpoint range
+inline void fetch_volume_block(const kernel_config& cfg, const texel_lut& lut, const uint8_t* const* slices, int width, int height, int depth, int row_stride, int block_x, int block_y, int block_z, float4* texels)
+{
+	for (int z = 0; z < cfg.dim_z; ++z)
+	{
+		int pz = std::min(block_z * cfg.dim_z + z, depth - 1);
+		fetch_block(cfg, lut, slices[pz], width, height, row_stride, block_x, block_y, texels + z * cfg.dim_x * cfg.dim_y);
+	}
+}
+
+// the same for hdr
+inline void fetch_volume_block_hdr(const kernel_config& cfg, const float* const* slices, int width, int height, int depth, int row_stride, int block_x, int block_y, int block_z, float4* texels)
+{
+	for (int z = 0; z < cfg.dim_z; ++z)
+	{
+		int pz = std::min(block_z * cfg.dim_z + z, depth - 1);
+		fetch_block_hdr(cfg, slices[pz], width, height, row_stride, block_x, block_y, texels + z * cfg.dim_x * cfg.dim_y);
+	}
+}
+
+// the texels of "count" consecutive blocks in the simd layout, missing lanes repeat the last block
+inline void fetch_blocks_soa(const kernel_config& cfg, const texel_lut& lut, const uint8_t* rgba, int width, int height, int row_stride, int block_x, int block_y, int count, int lanes, float* soa)
+{
+	for (int lane = 0; lane < lanes; ++lane)
+	{
+		int bx = block_x + (lane < count ? lane : count - 1);
+		for (int y = 0; y < cfg.dim_y; ++y)
+		{
+			int py = block_y * cfg.dim_y + y;
+			for (int x = 0; x < cfg.dim_x; ++x)
+			{
+				int px = bx * cfg.dim_x + x;
+				float* dst = soa + (y * cfg.dim_x + x) * 4 * lanes + lane;
+				if (px < width && py < height)
+				{
+					const uint8_t* p = rgba + (ptrdiff_t)py * row_stride + (size_t)px * 4;
+					dst[0] = lut.value[p[0]];
+					dst[lanes] = lut.value[p[1]];
+					dst[2 * lanes] = lut.value[p[2]];
+					dst[3 * lanes] = lut.alpha[p[3]];
+				}
+				else
+				{
+					dst[0] = 0.0f;
+					dst[lanes] = 0.0f;
+					dst[2 * lanes] = 0.0f;
+					dst[3 * lanes] = 0.0f;
+				}
+				if (cfg.is_normal_map)
+				{
+					dst[2 * lanes] = 255.0f;
+					dst[3 * lanes] = 255.0f;
+				}
+			}
+		}
+	}
+}
+
+// r == g == b on every texel of "lane", encode_block() gives those blocks luminance endpoints
+inline bool is_gray_block_soa(const kernel_config& cfg, const float* soa, int lanes, int lane)
+{
+	for (int i = 0; i < cfg.block_size(); ++i)
+	{
+		const float* src = soa + i * 4 * lanes + lane;
+		if (src[0] != src[lanes] || src[0] != src[2 * lanes])
+		{
+			return false;
+		}
+	}
+	return true;
+}
+
+// is_void_extent_block() of the shader on "lane", encode_block() turns those blocks into void-extent blocks of "color"
+inline bool is_void_extent_soa(const kernel_config& cfg, const float* soa, int lanes, int lane, float4& color)
+{
+	color = float4(255.0f);
+	const int channels = cfg.has_alpha ? 4 : 3;
+	for (int c = 0; c < channels; ++c)
+	{
+		float cmin = soa[c * lanes + lane];
+		float cmax = cmin;
+		for (int i = 1; i < cfg.block_size(); ++i)
+		{
+			float v = soa[(i * 4 + c) * lanes + lane];
+			cmin = min(cmin, v);
+			cmax = max(cmax, v);
+		}
+		if (!(cmax - cmin <= cfg.void_extent_tolerance))
+		{
+			return false;
+		}
+		color[c] = (cmin + cmax) * 0.5f;
+	}
+	return true;
+}
+
+inline void store_block(const uint4& blk, uint8_t* out)
+{
+	const uint words[4] = { blk.x, blk.y, blk.z, blk.w };
+	for (int i = 0; i < 4; ++i)
+	{
+		out[i * 4 + 0] = (uint8_t)(words[i] & 0xFF);
+		out[i * 4 + 1] = (uint8_t)((words[i] >> 8) & 0xFF);
+		out[i * 4 + 2] = (uint8_t)((words[i] >> 16) & 0xFF);
+		out[i * 4 + 3] = (uint8_t)((words[i] >> 24) & 0xFF);
+	}
+}
+
+inline kernel_config make_kernel_config(const encode_option& option)
+{
+	kernel_config cfg;
+	cfg.dim_x = option.block_x;
+	cfg.dim_y = option.block_y;
+	cfg.dim_z = option.block_z;
+	cfg.has_alpha = option.has_alpha;
+	cfg.is_normal_map = option.is_normal_map;
+	cfg.srgb = option.srgb && !option.is_normal_map;
+	cfg.effort = option.effort > 0 ? option.effort : 0;
+	cfg.dual_plane = option.dual_plane;
+	cfg.void_extent_tolerance = (float)option.void_extent_tolerance;
+	cfg.hdr = option.hdr;
+	return cfg;
+}
+
+inline simd_kernel_params make_simd_kernel_params(const kernel_config& cfg)
+{
+	simd_kernel_params params;
+	params.dim_x = cfg.dim_x;
+	params.dim_y = cfg.dim_y;
+	params.has_alpha = cfg.has_alpha ? 1 : 0;
+	params.decimated = (cfg.dim_x != X_GRIDS || cfg.dim_y != Y_GRIDS) ? 1 : 0;
+	for (uint i = 0; i < X_GRIDS * Y_GRIDS; ++i)
+	{
+		uint4 index;
+		float4 coff;
+		weight_grid_taps(cfg, i, index, coff);
+		const uint idx[4] = { index.x, index.y, index.z, index.w };
+		for (int k = 0; k < 4; ++k)
+		{
+			params.grid_index[i][k] = idx[k];
+			params.grid_coff[i][k] = coff[k];
+		}
+	}
+	return params;
+}
+
+/**
+ * everything about an encode_option that does not depend on the image
+ */
+struct encode_context
+{
+	kernel_config cfg;
+	texel_lut lut;
+	simd_kernel kernel;
+	simd_kernel_params params;
+	float rdo_lambda;	// 0 when the rate-distortion pass is off, it only decodes 2d ldr blocks
+	int rdo_window;
+
+	explicit encode_context(const encode_option& option)
+		: cfg(make_kernel_config(option))
+		, lut(cfg.srgb)
+		, kernel(select_simd_kernel(option.fast_blockmode() ? option.max_simd_isa : SIMD_ISA_SCALAR))
+		, params(make_simd_kernel_params(cfg))
+		, rdo_lambda((option.hdr || option.block_z != 1 || option.rdo_lambda < 0.0f) ? 0.0f : option.rdo_lambda)
+		, rdo_window(std::min(std::max(option.rdo_window, 1), RDO_MAX_WINDOW))
+	{
+	}
+};
+
+/**
+ * the rate-distortion pass over the encoded row "block_y" of a rgba8 image, astc_encode_rdo.cpp.
+ * left to right, every block may turn into a splice of its bytes with the bytes of the ctx.rdo_window blocks
+ * before it when the error it gains is below ctx.rdo_lambda times the bytes a lz compressor saves on it.
+ */
+void rdo_block_row(const encode_context& ctx, const uint8_t* rgba, int width, int height, int row_stride, int block_y, uint8_t* out_blocks);
+
+} // namespace astc_cpu
+
+namespace astc_cpu
+{
+
+// the row "block_y" of blocks of a rgba8 image through the simd kernel of "ctx"
+inline void encode_block_row_simd(const encode_context& ctx, const uint8_t* rgba, int width, int height, int row_stride, int block_y, uint8_t* out_blocks)
+{
+	const kernel_config& cfg = ctx.cfg;
+	const texel_lut& lut = ctx.lut;
+	const int xBlockNum = (width + cfg.dim_x - 1) / cfg.dim_x;
+
+	float4 texels[CPU_MAX_BLOCK_SIZE];
+	const simd_kernel& kernel = ctx.kernel;
+	const simd_kernel_params& params = ctx.params;
+	const int lanes = kernel.lanes;
+	float soa[CPU_MAX_BLOCK_SIZE * 4 * SIMD_MAX_LANES];
+	for (int block_x = 0; block_x < xBlockNum; block_x += lanes)
+	{
+		int count = (xBlockNum - block_x < lanes) ? xBlockNum - block_x : lanes;
+		fetch_blocks_soa(cfg, lut, rgba, width, height, row_stride, block_x, block_y, count, lanes, soa);
+
+		// the simd kernels only have the rgb(a) endpoints, void-extent blocks are written here
+		// and gray blocks go through the scalar path
+		bool scalar_lane[SIMD_MAX_LANES];
+		int scalar_count = 0;
+		for (int lane = 0; lane < count; ++lane)
+		{
+			uint8_t* out = out_blocks + ((size_t)block_y * xBlockNum + block_x + lane) * BLOCK_BYTES;
+			float4 color;
+			scalar_lane[lane] = true;
+			if (is_void_extent_soa(cfg, soa, lanes, lane, color))
+			{
+				store_block(void_extent_block(color), out);
+			}
+			else if (is_gray_block_soa(cfg, soa, lanes, lane))
+			{
+				fetch_block(cfg, lut, rgba, width, height, row_stride, block_x + lane, block_y, texels);
+				store_block(encode_block(cfg, texels), out);
+			}
+			else
+			{
+				scalar_lane[lane] = false;
+				continue;
+			}
+			++scalar_count;
+		}
+		if (scalar_count < count)
+		{
+			uint8_t simd_blocks[SIMD_MAX_LANES * BLOCK_BYTES];
+			kernel.encode_blocks(params, soa, simd_blocks, count);
+			for (int lane = 0; lane < count; ++lane)
+			{
+				if (!scalar_lane[lane])
+				{
+					memcpy(out_blocks + ((size_t)block_y * xBlockNum + block_x + lane) * BLOCK_BYTES, simd_blocks + lane * BLOCK_BYTES, BLOCK_BYTES);
+				}
+			}
+		}
+	}
+}
+
+/**
+ * encode the row "block_y" of blocks of a rgba8 image, the simd kernel of "ctx" when it has one,
+ * then the rate-distortion pass when "ctx" has one.
+ * the output has the layout of the shader's OutBuffer: BLOCK_BYTES per block, in row major block order.
+ */
+inline void encode_block_row(const encode_context& ctx, const uint8_t* rgba, int width, int height, int row_stride, int block_y, uint8_t* out_blocks)
+{
+	const kernel_config& cfg = ctx.cfg;
+	const int xBlockNum = (width + cfg.dim_x - 1) / cfg.dim_x;
+
+	if (ctx.kernel.encode_blocks != nullptr)
+	{
+		encode_block_row_simd(ctx, rgba, width, height, row_stride, block_y, out_blocks);
+	}
+	else
+	{
+		float4 texels[CPU_MAX_BLOCK_SIZE];
+		for (int block_x = 0; block_x < xBlockNum; ++block_x)
+		{
+			fetch_block(cfg, ctx.lut, rgba, width, height, row_stride, block_x, block_y, texels);
+			uint4 blk = encode_block(cfg, texels);
+			store_block(blk, out_blocks + ((size_t)block_y * xBlockNum + block_x) * BLOCK_BYTES);
+		}
+	}
+
+	if (ctx.rdo_lambda > 0.0f)
+	{
+		rdo_block_row(ctx, rgba, width, height, row_stride, block_y, out_blocks);
+	}
+}
+
+// the same for a rgba32f image of an hdr option, always the scalar path
+inline void encode_block_row(const encode_context& ctx, const float* rgba, int width, int height, int row_stride, int block_y, uint8_t* out_blocks)
+{
+	const kernel_config& cfg = ctx.cfg;
+	const int xBlockNum = (width + cfg.dim_x - 1) / cfg.dim_x;
+
+	float4 texels[CPU_MAX_BLOCK_SIZE];
+	for (int block_x = 0; block_x < xBlockNum; ++block_x)
+	{
+		fetch_block_hdr(cfg, rgba, width, height, row_stride, block_x, block_y, texels);
+		uint4 blk = encode_block(cfg, texels);
+		store_block(blk, out_blocks + ((size_t)block_y * xBlockNum + block_x) * BLOCK_BYTES);
+	}
+}
+
+} // namespace astc_cpu
+
+/**
+ * encode a rgba8 image on the cpu, one row of blocks per task spread over the pool.
+ * rows are "row_stride" bytes apart, a negative stride walks a bottom-up image.
+ * the output has the layout of the shader's OutBuffer: BLOCK_BYTES per block, in row major block order.
+ */
+inline void encode_astc_cpu(thread_pool& pool, const astc_cpu::encode_context& ctx, const uint8_t* rgba, int width, int height, int row_stride, uint8_t* out_blocks)
+{
+	const int yBlockNum = (height + ctx.cfg.dim_y - 1) / ctx.cfg.dim_y;
+
+	// one task per row of blocks keeps the source reads of a task inside a few cache lines
+	pool.parallel_for(yBlockNum, [&](int block_y) {
+		astc_cpu::encode_block_row(ctx, rgba, width, height, row_stride, block_y, out_blocks);
+	});
+}
+
+/**
+ * the same for a rgba32f image of an hdr option, "row_stride" is in bytes too.
+ * every block goes through the scalar path, the simd kernels are ldr only.
+ */
+inline void encode_astc_cpu(thread_pool& pool, const astc_cpu::encode_context& ctx, const float* rgba, int width, int height, int row_stride, uint8_t* out_blocks)
+{
+	const int yBlockNum = (height + ctx.cfg.dim_y - 1) / ctx.cfg.dim_y;
+
+	pool.parallel_for(yBlockNum, [&](int block_y) {
+		astc_cpu::encode_block_row(ctx, rgba, width, height, row_stride, block_y, out_blocks);
+	});
+}
+
+inline void encode_astc_cpu(thread_pool& pool, const uint8_t* rgba, int width, int height, int row_stride, const encode_option& option, uint8_t* out_blocks)
+{
+	encode_astc_cpu(pool, astc_cpu::encode_context(option), rgba, width, height, row_stride, out_blocks);
+}
+
+/**
+ * encode a rgba8 volume of "depth" slices, each a 2d image like above with the same "row_stride".
+ * one task per row of blocks of a slab of cfg.dim_z slices; the blocks are stored x fastest, then y, then z,
+ * the order of the .astc file. volumes only take the scalar path, the simd kernels are 2d.
+ */
+inline void encode_astc_cpu(thread_pool& pool, const astc_cpu::encode_context& ctx, const uint8_t* const* slices, int width, int height, int depth, int row_stride, uint8_t* out_blocks)
+{
+	using namespace astc_cpu;
+
+	const kernel_config& cfg = ctx.cfg;
+	const texel_lut& lut = ctx.lut;
+	const int xBlockNum = (width + cfg.dim_x - 1) / cfg.dim_x;
+	const int yBlockNum = (height + cfg.dim_y - 1) / cfg.dim_y;
+	const int zBlockNum = (depth + cfg.dim_z - 1) / cfg.dim_z;
+
+	pool.parallel_for(zBlockNum * yBlockNum, [&](int row) {
+		const int block_z = row / yBlockNum;
+		const int block_y = row % yBlockNum;
+		float4 texels[CPU_MAX_BLOCK_SIZE];
+		for (int block_x = 0; block_x < xBlockNum; ++block_x)
+		{
+			fetch_volume_block(cfg, lut, slices, width, height, depth, row_stride, block_x, block_y, block_z, texels);
+			uint4 blk = encode_block(cfg, texels);
+			store_block(blk, out_blocks + ((size_t)row * xBlockNum + block_x) * BLOCK_BYTES);
+		}
+	});
+}
+
+// the same for a rgba32f volume of an hdr option
+inline void encode_astc_cpu(thread_pool& pool, const astc_cpu::encode_context& ctx, const float* const* slices, int width, int height, int depth, int row_stride, uint8_t* out_blocks)
+{
+	using namespace astc_cpu;
+
+	const kernel_config& cfg = ctx.cfg;
+	const int xBlockNum = (width + cfg.dim_x - 1) / cfg.dim_x;
+	const int yBlockNum = (height + cfg.dim_y - 1) / cfg.dim_y;
+	const int zBlockNum = (depth + cfg.dim_z - 1) / cfg.dim_z;
+
+	pool.parallel_for(zBlockNum * yBlockNum, [&](int row) {
+		const int block_z = row / yBlockNum;
+		const int block_y = row % yBlockNum;
+		float4 texels[CPU_MAX_BLOCK_SIZE];
+		for (int block_x = 0; block_x < xBlockNum; ++block_x)
+		{
+			fetch_volume_block_hdr(cfg, slices, width, height, depth, row_stride, block_x, block_y, block_z, texels);
+			uint4 blk = encode_block(cfg, texels);
+			store_block(blk, out_blocks + ((size_t)row * xBlockNum + block_x) * BLOCK_BYTES);
+		}
+	});
+}
@@ -0,0 +1,51 @@
+#include "astc_encode_cpu.h"
+
+/**
+ * the IS_HDR permutations of ASTC_BlockEncode.hlsl, every footprint of ASTC_FOOTPRINTS with and without alpha like
+ * astc_encode_scalar.cpp. hdr blocks always take the scalar path, the simd kernels are ldr only.
+ */
+namespace astc_cpu
+{
+#define ASTC_PERMUTATION_HDR 1
+#include "astc_encode_permutations.h"
+
+typedef uint4 (*encode_block_func)(float4* texels, uint effort, bool dual_plane, float void_extent_tolerance);
+
+struct hdr_permutation
+{
+	int dim_x;
+	int dim_y;
+	int dim_z;
+	encode_block_func encode_rgb;
+	encode_block_func encode_rgba;
+};
+
+#define ASTC_PERMUTATION_ENTRY(x, y, z) { x, y, z, ASTC_PERMUTATION_NAME(x, y, z, hdr_rgb)::encode_block, \
+	ASTC_PERMUTATION_NAME(x, y, z, hdr_rgba)::encode_block },
+
+static const hdr_permutation hdr_permutations[] = {
+	ASTC_FOOTPRINTS(ASTC_PERMUTATION_ENTRY)
+};
+
+#undef ASTC_PERMUTATION_ENTRY
+
+static const hdr_permutation& find_hdr_permutation(const kernel_config& cfg)
+{
+	for (const hdr_permutation& permutation : hdr_permutations)
+	{
+		if (permutation.dim_x == cfg.dim_x && permutation.dim_y == cfg.dim_y && permutation.dim_z == cfg.dim_z)
+		{
+			return permutation;
+		}
+	}
+	return hdr_permutations[0];
+}
+
+uint4 encode_block_hdr(const kernel_config& cfg, float4* texels)
+{
+	const hdr_permutation& permutation = find_hdr_permutation(cfg);
+	encode_block_func encode = cfg.has_alpha ? permutation.encode_rgba : permutation.encode_rgb;
+	return encode(texels, cfg.effort, cfg.dual_plane, cfg.void_extent_tolerance);
+}
+
+} // namespace astc_cpu
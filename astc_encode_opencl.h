@@ -0,0 +1,300 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#ifndef CL_TARGET_OPENCL_VERSION
+#define CL_TARGET_OPENCL_VERSION 120
+#endif
+
+#ifdef __APPLE__
+#include <OpenCL/opencl.h>
+#else
+#include <CL/cl.h>
+#endif
+
+#include "astc_option.h"
+
+/**
+ * OpenCL backend, runs MainCS of ASTC_Encode.cl, the OpenCL C port of ASTC_Encode.hlsl.
+ * Needs OpenCL 1.2 with image support, a cpu runtime like PoCL is enough:
+ *   astc_cs_enc tex.png -opencl
+ * gpu devices are preferred, set ASTC_OPENCL_DEVICE=cpu to force a cpu device.
+ * the port only has the rgb(a) fast blockmode with direct endpoints (cem 8/12), gray blocks keep rgb(a) endpoints,
+ * so its blocks differ from the ones of the other backends. an option with effort, dual_plane or hdr is rejected.
+ */
+
+struct opencl_context
+{
+	cl_platform_id platform;
+	cl_device_id device;
+	cl_context context;
+	cl_command_queue queue;
+
+	opencl_context()
+		: platform(nullptr)
+		, device(nullptr)
+		, context(nullptr)
+		, queue(nullptr)
+	{
+	}
+};
+
+inline void destroy_opencl_context(opencl_context& ctx)
+{
+	if (ctx.queue != nullptr) {
+		clReleaseCommandQueue(ctx.queue);
+	}
+	if (ctx.context != nullptr) {
+		clReleaseContext(ctx.context);
+	}
+	ctx = opencl_context();
+}
+
+// the first device with image support, gpus first
+inline cl_int create_opencl_context(opencl_context& ctx)
+{
+	cl_uint platformCount = 0;
+	cl_int err = clGetPlatformIDs(0, nullptr, &platformCount);
+	if (err != CL_SUCCESS) {
+		return err;
+	}
+	if (platformCount == 0) {
+		return CL_DEVICE_NOT_FOUND;
+	}
+	std::vector<cl_platform_id> platforms(platformCount);
+	clGetPlatformIDs(platformCount, platforms.data(), nullptr);
+
+	const char* forced = getenv("ASTC_OPENCL_DEVICE");
+	bool cpu_only = forced != nullptr && std::string(forced) == "cpu";
+
+	const cl_device_type types[2] = { CL_DEVICE_TYPE_GPU, CL_DEVICE_TYPE_ALL };
+	for (int t = cpu_only ? 1 : 0; t < 2 && ctx.device == nullptr; ++t)
+	{
+		for (cl_platform_id platform : platforms)
+		{
+			cl_uint deviceCount = 0;
+			if (clGetDeviceIDs(platform, types[t], 0, nullptr, &deviceCount) != CL_SUCCESS || deviceCount == 0) {
+				continue;
+			}
+			std::vector<cl_device_id> devices(deviceCount);
+			clGetDeviceIDs(platform, types[t], deviceCount, devices.data(), nullptr);
+
+			for (cl_device_id dev : devices)
+			{
+				cl_bool images = CL_FALSE;
+				cl_device_type type = 0;
+				clGetDeviceInfo(dev, CL_DEVICE_IMAGE_SUPPORT, sizeof(images), &images, nullptr);
+				clGetDeviceInfo(dev, CL_DEVICE_TYPE, sizeof(type), &type, nullptr);
+				if (images == CL_FALSE || (cpu_only && (type & CL_DEVICE_TYPE_CPU) == 0)) {
+					continue;
+				}
+				ctx.platform = platform;
+				ctx.device = dev;
+				break;
+			}
+			if (ctx.device != nullptr) {
+				break;
+			}
+		}
+	}
+
+	if (ctx.device == nullptr) {
+		return CL_DEVICE_NOT_FOUND;
+	}
+
+	ctx.context = clCreateContext(nullptr, 1, &ctx.device, nullptr, nullptr, &err);
+	if (err != CL_SUCCESS) {
+		destroy_opencl_context(ctx);
+		return err;
+	}
+
+	ctx.queue = clCreateCommandQueue(ctx.context, ctx.device, 0, &err);
+	if (err != CL_SUCCESS) {
+		destroy_opencl_context(ctx);
+		return err;
+	}
+
+	return CL_SUCCESS;
+}
+
+inline std::string opencl_device_name(const opencl_context& ctx)
+{
+	char name[256] = {};
+	clGetDeviceInfo(ctx.device, CL_DEVICE_NAME, sizeof(name) - 1, name, nullptr);
+	return name;
+}
+
+inline bool read_text_file(const char* path, std::string& text)
+{
+	FILE* f = fopen(path, "rb");
+	if (f == nullptr) {
+		return false;
+	}
+	fseek(f, 0, SEEK_END);
+	long size = ftell(f);
+	fseek(f, 0, SEEK_SET);
+	text.resize(size > 0 ? size : 0);
+	bool ok = size > 0 && fread(&text[0], 1, size, f) == (size_t)size;
+	fclose(f);
+	return ok;
+}
+
+// the same specialization as compile_shader() of the d3d11 backend
+inline cl_program compile_program(const opencl_context& ctx, const char* srcFile, const encode_option& option)
+{
+	std::string source;
+	if (!read_text_file(srcFile, source)) {
+		std::cout << "can't read " << srcFile << std::endl;
+		return nullptr;
+	}
+
+	std::string defines;
+	defines += " -D THREAD_NUM_X=" + std::to_string(THREAD_NUM_X);
+	defines += " -D THREAD_NUM_Y=" + std::to_string(THREAD_NUM_Y);
+	defines += option.is_normal_map ? " -D IS_NORMALMAP=1" : " -D IS_NORMALMAP=0";
+	defines += " -D BLOCK_DIM_X=" + std::to_string(option.block_x);
+	defines += " -D BLOCK_DIM_Y=" + std::to_string(option.block_y);
+	defines += option.has_alpha ? " -D HAS_ALPHA=1" : " -D HAS_ALPHA=0";
+	defines += (option.srgb && !option.is_normal_map) ? " -D IS_SRGB=1" : " -D IS_SRGB=0";
+	defines += " -D VOID_EXTENT_TOLERANCE=" + std::to_string(option.void_extent_tolerance);
+
+	const char* src = source.c_str();
+	size_t length = source.size();
+	cl_int err = CL_SUCCESS;
+	cl_program program = clCreateProgramWithSource(ctx.context, 1, &src, &length, &err);
+	if (err != CL_SUCCESS) {
+		return nullptr;
+	}
+
+	err = clBuildProgram(program, 1, &ctx.device, defines.c_str(), nullptr, nullptr);
+	if (err != CL_SUCCESS) {
+		size_t logSize = 0;
+		clGetProgramBuildInfo(program, ctx.device, CL_PROGRAM_BUILD_LOG, 0, nullptr, &logSize);
+		std::string log(logSize, '\0');
+		clGetProgramBuildInfo(program, ctx.device, CL_PROGRAM_BUILD_LOG, logSize, &log[0], nullptr);
+		std::cout << log << std::endl;
+		clReleaseProgram(program);
+		return nullptr;
+	}
+	return program;
+}
+
+/**
+ * encode a rgba8 image, rows "row_stride" bytes apart. the blocks are read back straight into "out_blocks",
+ * BLOCK_BYTES per block in row major block order like the d3d11 OutBuffer.
+ */
+inline bool encode_astc_opencl(const opencl_context& ctx, const uint8_t* rgba, int width, int height, int row_stride, const encode_option& option, uint8_t* out_blocks)
+{
+	if (option.effort > 0 || option.dual_plane || option.hdr) {
+		std::cout << "the opencl port has no -effort, -dualplane or -hdr" << std::endl;
+		return false;
+	}
+
+	cl_program program = compile_program(ctx, "ASTC_Encode.cl", option);
+	if (program == nullptr) {
+		std::cout << "compile kernel failed!" << std::endl;
+		return false;
+	}
+
+	int xBlockNum = (width + option.block_x - 1) / option.block_x;
+	int yBlockNum = (height + option.block_y - 1) / option.block_y;
+	int TotalBlockNum = xBlockNum * yBlockNum;
+
+	int GroupSize = THREAD_NUM_X * THREAD_NUM_Y;
+	int GroupNum = (TotalBlockNum + GroupSize - 1) / GroupSize;
+	int GroupNumX = xBlockNum;
+	int GroupNumY = (GroupNum + GroupNumX - 1) / GroupNumX;
+
+	cl_kernel kernel = nullptr;
+	cl_mem texture = nullptr;
+	cl_mem outBuf = nullptr;
+
+	bool ok = false;
+	do
+	{
+		cl_int err = CL_SUCCESS;
+		kernel = clCreateKernel(program, "MainCS", &err);
+		if (err != CL_SUCCESS) {
+			break;
+		}
+
+		// source texture, srgb is decoded in the kernel since CL_sRGBA images need opencl 2.0
+		cl_image_format format;
+		format.image_channel_order = CL_RGBA;
+		format.image_channel_data_type = CL_UNORM_INT8;
+
+		cl_image_desc desc;
+		memset(&desc, 0, sizeof(desc));
+		desc.image_type = CL_MEM_OBJECT_IMAGE2D;
+		desc.image_width = width;
+		desc.image_height = height;
+
+		texture = clCreateImage(ctx.context, CL_MEM_READ_ONLY, &format, &desc, nullptr, &err);
+		if (err != CL_SUCCESS) {
+			break;
+		}
+
+		// a positive stride is uploaded in one go, a bottom-up image row by row
+		if (row_stride > 0) {
+			size_t origin[3] = { 0, 0, 0 };
+			size_t region[3] = { (size_t)width, (size_t)height, 1 };
+			err = clEnqueueWriteImage(ctx.queue, texture, CL_FALSE, origin, region, row_stride, 0, rgba, 0, nullptr, nullptr);
+		}
+		else {
+			for (int y = 0; y < height && err == CL_SUCCESS; ++y) {
+				size_t origin[3] = { 0, (size_t)y, 0 };
+				size_t region[3] = { (size_t)width, 1, 1 };
+				err = clEnqueueWriteImage(ctx.queue, texture, CL_FALSE, origin, region, 0, 0, rgba + (ptrdiff_t)y * row_stride, 0, nullptr, nullptr);
+			}
+		}
+		if (err != CL_SUCCESS) {
+			break;
+		}
+
+		outBuf = clCreateBuffer(ctx.context, CL_MEM_WRITE_ONLY, (size_t)TotalBlockNum * BLOCK_BYTES, nullptr, &err);
+		if (err != CL_SUCCESS) {
+			break;
+		}
+
+		cl_int TexelHeight = height;
+		cl_int TexelWidth = width;
+		cl_int InGroupNumX = GroupNumX;
+		err = clSetKernelArg(kernel, 0, sizeof(cl_mem), &texture);
+		err |= clSetKernelArg(kernel, 1, sizeof(cl_mem), &outBuf);
+		err |= clSetKernelArg(kernel, 2, sizeof(cl_int), &TexelHeight);
+		err |= clSetKernelArg(kernel, 3, sizeof(cl_int), &TexelWidth);
+		err |= clSetKernelArg(kernel, 4, sizeof(cl_int), &InGroupNumX);
+		if (err != CL_SUCCESS) {
+			break;
+		}
+
+		// compress one block per work-item
+		size_t localSize[2] = { THREAD_NUM_X, THREAD_NUM_Y };
+		size_t globalSize[2] = { (size_t)GroupNumX * THREAD_NUM_X, (size_t)GroupNumY * THREAD_NUM_Y };
+		err = clEnqueueNDRangeKernel(ctx.queue, kernel, 2, nullptr, globalSize, localSize, 0, nullptr, nullptr);
+		if (err != CL_SUCCESS) {
+			break;
+		}
+
+		err = clEnqueueReadBuffer(ctx.queue, outBuf, CL_TRUE, 0, (size_t)TotalBlockNum * BLOCK_BYTES, out_blocks, 0, nullptr, nullptr);
+		if (err != CL_SUCCESS) {
+			break;
+		}
+
+		ok = true;
+	} while (false);
+
+	if (outBuf != nullptr) clReleaseMemObject(outBuf);
+	if (texture != nullptr) clReleaseMemObject(texture);
+	if (kernel != nullptr) clReleaseKernel(kernel);
+	clReleaseProgram(program);
+
+	return ok;
+}
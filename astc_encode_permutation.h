@@ -0,0 +1,30 @@
+// no include guard, astc_encode_permutations.h includes it once per shader permutation.
+// it defines BLOCK_DIM_X, BLOCK_DIM_Y, BLOCK_DIM_Z, HAS_ALPHA, IS_HDR and ASTC_PERMUTATION, the namespace that gets the permutation.
+namespace ASTC_PERMUTATION
+{
+#include "ASTC_BlockEncode.hlsl"
+}
+
+#undef ASTC_PERMUTATION
+#undef BLOCK_DIM_X
+#undef BLOCK_DIM_Y
+#undef BLOCK_DIM_Z
+#undef HAS_ALPHA
+#undef IS_HDR
+#undef BLOCK_SIZE
+#undef PARTITION_2_TABLE
+#undef PARTITION_2_COUNT
+#undef PARTITION_2_WORDS
+#undef WEIGHT_GRID_COUNT
+#undef MAX_GRID_WEIGHTS
+#undef WEIGHT_GRIDS
+#undef WEIGHT_GRIDS_Z
+#undef DECIMATION_IDX
+#undef DECIMATION_WT
+#undef INFILL_IDX
+#undef INFILL_WT
+#undef PSEUDO_INVERSE_IDX
+#undef PSEUDO_INVERSE_WT
+#undef DEFAULT_GRID_WEIGHTS
+#undef FAST_WEIGHT_QUANT
+#undef GRID_DEPTH
@@ -0,0 +1,91 @@
+// no include guard, astc_encode_scalar.cpp includes it once with ASTC_PERMUTATION_HDR 0 and astc_encode_hdr.cpp once with 1.
+// it instantiates astc_encode_permutation.h with and without alpha for every footprint of ASTC_FOOTPRINTS. the preprocessor
+// cannot #include from a macro, so this includes itself once per z, y and x an astc block can have and the x, y, z on the list
+// get their permutations.
+#if !defined(ASTC_FOOTPRINT_Z)
+#define ASTC_FOOTPRINT_LISTED(x, y, z) || ((x) == ASTC_FOOTPRINT_X && (y) == ASTC_FOOTPRINT_Y && (z) == ASTC_FOOTPRINT_Z)
+#define ASTC_FOOTPRINT_Z 1
+#include "astc_encode_permutations.h"
+#undef ASTC_FOOTPRINT_Z
+#define ASTC_FOOTPRINT_Z 3
+#include "astc_encode_permutations.h"
+#undef ASTC_FOOTPRINT_Z
+#define ASTC_FOOTPRINT_Z 4
+#include "astc_encode_permutations.h"
+#undef ASTC_FOOTPRINT_Z
+#define ASTC_FOOTPRINT_Z 5
+#include "astc_encode_permutations.h"
+#undef ASTC_FOOTPRINT_Z
+#define ASTC_FOOTPRINT_Z 6
+#include "astc_encode_permutations.h"
+#undef ASTC_FOOTPRINT_Z
+#undef ASTC_FOOTPRINT_LISTED
+#undef ASTC_PERMUTATION_HDR
+#elif !defined(ASTC_FOOTPRINT_Y)
+#define ASTC_FOOTPRINT_Y 3
+#include "astc_encode_permutations.h"
+#undef ASTC_FOOTPRINT_Y
+#define ASTC_FOOTPRINT_Y 4
+#include "astc_encode_permutations.h"
+#undef ASTC_FOOTPRINT_Y
+#define ASTC_FOOTPRINT_Y 5
+#include "astc_encode_permutations.h"
+#undef ASTC_FOOTPRINT_Y
+#define ASTC_FOOTPRINT_Y 6
+#include "astc_encode_permutations.h"
+#undef ASTC_FOOTPRINT_Y
+#define ASTC_FOOTPRINT_Y 8
+#include "astc_encode_permutations.h"
+#undef ASTC_FOOTPRINT_Y
+#define ASTC_FOOTPRINT_Y 10
+#include "astc_encode_permutations.h"
+#undef ASTC_FOOTPRINT_Y
+#define ASTC_FOOTPRINT_Y 12
+#include "astc_encode_permutations.h"
+#undef ASTC_FOOTPRINT_Y
+#elif !defined(ASTC_FOOTPRINT_X)
+#define ASTC_FOOTPRINT_X 3
+#include "astc_encode_permutations.h"
+#undef ASTC_FOOTPRINT_X
+#define ASTC_FOOTPRINT_X 4
+#include "astc_encode_permutations.h"
+#undef ASTC_FOOTPRINT_X
+#define ASTC_FOOTPRINT_X 5
+#include "astc_encode_permutations.h"
+#undef ASTC_FOOTPRINT_X
+#define ASTC_FOOTPRINT_X 6
+#include "astc_encode_permutations.h"
+#undef ASTC_FOOTPRINT_X
+#define ASTC_FOOTPRINT_X 8
+#include "astc_encode_permutations.h"
+#undef ASTC_FOOTPRINT_X
+#define ASTC_FOOTPRINT_X 10
+#include "astc_encode_permutations.h"
+#undef ASTC_FOOTPRINT_X
+#define ASTC_FOOTPRINT_X 12
+#include "astc_encode_permutations.h"
+#undef ASTC_FOOTPRINT_X
+#elif 0 ASTC_FOOTPRINTS(ASTC_FOOTPRINT_LISTED)
+#define BLOCK_DIM_X ASTC_FOOTPRINT_X
+#define BLOCK_DIM_Y ASTC_FOOTPRINT_Y
+#define BLOCK_DIM_Z ASTC_FOOTPRINT_Z
+#define HAS_ALPHA 0
+#define IS_HDR ASTC_PERMUTATION_HDR
+#if ASTC_PERMUTATION_HDR
+#define ASTC_PERMUTATION ASTC_PERMUTATION_NAME(ASTC_FOOTPRINT_X, ASTC_FOOTPRINT_Y, ASTC_FOOTPRINT_Z, hdr_rgb)
+#else
+#define ASTC_PERMUTATION ASTC_PERMUTATION_NAME(ASTC_FOOTPRINT_X, ASTC_FOOTPRINT_Y, ASTC_FOOTPRINT_Z, rgb)
+#endif
+#include "astc_encode_permutation.h"
+#define BLOCK_DIM_X ASTC_FOOTPRINT_X
+#define BLOCK_DIM_Y ASTC_FOOTPRINT_Y
+#define BLOCK_DIM_Z ASTC_FOOTPRINT_Z
+#define HAS_ALPHA 1
+#define IS_HDR ASTC_PERMUTATION_HDR
+#if ASTC_PERMUTATION_HDR
+#define ASTC_PERMUTATION ASTC_PERMUTATION_NAME(ASTC_FOOTPRINT_X, ASTC_FOOTPRINT_Y, ASTC_FOOTPRINT_Z, hdr_rgba)
+#else
+#define ASTC_PERMUTATION ASTC_PERMUTATION_NAME(ASTC_FOOTPRINT_X, ASTC_FOOTPRINT_Y, ASTC_FOOTPRINT_Z, rgba)
+#endif
+#include "astc_encode_permutation.h"
+#endif
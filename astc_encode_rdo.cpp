@@ -0,0 +1,805 @@
+#include "astc_encode_cpu.h"
+
+/**
+ * the rate-distortion pass of the cpu backend, for textures shipped under a lz compressor (zstd, lz4, deflate).
+ * the blocks a row ends up with only repeat bytes of the blocks before them when the encoder says so,
+ * so after the row is encoded every block tries splices of its bytes with the bytes of the blocks before it
+ * and keeps the one of the least "error + lambda * compressed bytes".
+ * a splice takes the low bytes (header and endpoints) from one block and the high bytes (weights) from the other,
+ * cut at the bytes around the weight bits of the block, or the whole other block. the error of a candidate is
+ * measured on its decoded texels, so any splice that the decoder rejects or that does not hold up is dropped.
+ */
+namespace astc_cpu
+{
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// the ldr decoder of "C.2 Decoding Process", for the 2d blocks the encoder writes
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// "count" (at most 32) bits from bit "pos" of the BLOCK_BYTES of "data", lsb first
+static uint read_bits(const uint8_t* data, int pos, int count)
+{
+	uint64_t bits = 0;
+	for (int i = 0, first = pos >> 3; i < 5 && first + i < BLOCK_BYTES; ++i)
+	{
+		bits |= (uint64_t)data[first + i] << (8 * i);
+	}
+	return (uint)((bits >> (pos & 7)) & ((1ull << count) - 1));
+}
+
+// bits of "count" ise values of the range "quant"
+static int ise_size(int count, int quant)
+{
+	int bits = bits_trits_quints_table[quant * 3 + 0];
+	if (bits_trits_quints_table[quant * 3 + 1])
+	{
+		return ((8 + 5 * bits) * count + 4) / 5;
+	}
+	if (bits_trits_quints_table[quant * 3 + 2])
+	{
+		return ((7 + 3 * bits) * count + 2) / 3;
+	}
+	return bits * count;
+}
+
+// "C.2.12 Integer Sequence Encoding", the trit and quint blocks unpacked bit by bit
+static void decode_ise(const uint8_t* data, int pos, int count, int quant, int* values)
+{
+	const int bits = bits_trits_quints_table[quant * 3 + 0];
+	if (bits_trits_quints_table[quant * 3 + 1])
+	{
+		static const int t_bits[5] = { 2, 2, 1, 2, 1 };
+		static const int t_shift[5] = { 0, 2, 4, 5, 7 };
+		for (int group = 0; group < count; group += 5)
+		{
+			int m[5];
+			int T = 0;
+			for (int i = 0; i < 5; ++i)
+			{
+				m[i] = read_bits(data, pos, bits);
+				pos += bits;
+				T |= read_bits(data, pos, t_bits[i]) << t_shift[i];
+				pos += t_bits[i];
+			}
+
+			int t[5];
+			int C;
+			if (((T >> 2) & 7) == 7)
+			{
+				C = (((T >> 5) & 7) << 2) | (T & 3);
+				t[4] = 2;
+				t[3] = 2;
+			}
+			else
+			{
+				C = T & 0x1F;
+				if (((T >> 5) & 3) == 3)
+				{
+					t[4] = 2;
+					t[3] = (T >> 7) & 1;
+				}
+				else
+				{
+					t[4] = (T >> 7) & 1;
+					t[3] = (T >> 5) & 3;
+				}
+			}
+			if ((C & 3) == 3)
+			{
+				t[2] = 2;
+				t[1] = (C >> 4) & 1;
+				t[0] = (((C >> 3) & 1) << 1) | (((C >> 2) & 1) & ~((C >> 3) & 1));
+			}
+			else if (((C >> 2) & 3) == 3)
+			{
+				t[2] = 2;
+				t[1] = 2;
+				t[0] = C & 3;
+			}
+			else
+			{
+				t[2] = (C >> 4) & 1;
+				t[1] = (C >> 2) & 3;
+				t[0] = (((C >> 1) & 1) << 1) | ((C & 1) & ~((C >> 1) & 1));
+			}
+			for (int i = 0; i < 5 && group + i < count; ++i)
+			{
+				values[group + i] = (t[i] << bits) | m[i];
+			}
+		}
+	}
+	else if (bits_trits_quints_table[quant * 3 + 2])
+	{
+		static const int q_bits[3] = { 3, 2, 2 };
+		static const int q_shift[3] = { 0, 3, 5 };
+		for (int group = 0; group < count; group += 3)
+		{
+			int m[3];
+			int Q = 0;
+			for (int i = 0; i < 3; ++i)
+			{
+				m[i] = read_bits(data, pos, bits);
+				pos += bits;
+				Q |= read_bits(data, pos, q_bits[i]) << q_shift[i];
+				pos += q_bits[i];
+			}
+
+			int q[3];
+			if (((Q >> 1) & 3) == 3 && ((Q >> 5) & 3) == 0)
+			{
+				q[2] = ((Q & 1) << 2) | ((((Q >> 4) & 1) & ~Q & 1) << 1) | (((Q >> 3) & 1) & ~Q & 1);
+				q[1] = 4;
+				q[0] = 4;
+			}
+			else
+			{
+				int C;
+				if (((Q >> 1) & 3) == 3)
+				{
+					q[2] = 4;
+					C = (((Q >> 3) & 3) << 3) | ((~(Q >> 5) & 3) << 1) | (Q & 1);
+				}
+				else
+				{
+					q[2] = (Q >> 5) & 3;
+					C = Q & 0x1F;
+				}
+				if ((C & 7) == 5)
+				{
+					q[1] = 4;
+					q[0] = (C >> 3) & 3;
+				}
+				else
+				{
+					q[1] = (C >> 3) & 3;
+					q[0] = C & 7;
+				}
+			}
+			for (int i = 0; i < 3 && group + i < count; ++i)
+			{
+				values[group + i] = (q[i] << bits) | m[i];
+			}
+		}
+	}
+	else
+	{
+		for (int i = 0; i < count; ++i)
+		{
+			values[i] = read_bits(data, pos, bits);
+			pos += bits;
+		}
+	}
+}
+
+// "C.2.17 Weight Unquantization" to 0..64
+static int unquantize_weight_value(int quant, int value)
+{
+	const int bits = bits_trits_quints_table[quant * 3 + 0];
+	const bool trits = bits_trits_quints_table[quant * 3 + 1] != 0;
+	const bool quints = bits_trits_quints_table[quant * 3 + 2] != 0;
+
+	int T;
+	if (!trits && !quints)
+	{
+		T = value << (6 - bits);
+		for (int shift = bits; shift < 6; shift *= 2)
+		{
+			T |= T >> shift;
+		}
+		T &= 0x3F;
+	}
+	else if (bits == 0)
+	{
+		static const int trit_weights[3] = { 0, 32, 63 };
+		static const int quint_weights[5] = { 0, 16, 32, 47, 63 };
+		T = trits ? trit_weights[value] : quint_weights[value];
+	}
+	else
+	{
+		int D = value >> bits;
+		int m = value & ((1 << bits) - 1);
+		int A = (m & 1) ? 0x7F : 0;
+		int cb = m >> 1;
+		int B = 0;
+		int C = 0;
+		if (trits)
+		{
+			C = (bits == 1) ? 50 : (bits == 2) ? 23 : 11;
+			B = (bits == 2) ? (cb << 6) | (cb << 2) | cb : (bits == 3) ? (cb << 5) | cb : 0;
+		}
+		else
+		{
+			C = (bits == 1) ? 28 : 13;
+			B = (bits == 2) ? (cb << 6) | (cb << 1) : 0;
+		}
+		T = D * C + B;
+		T ^= A;
+		T = (A & 0x20) | (T >> 2);
+	}
+	return (T > 32) ? T + 1 : T;
+}
+
+// "bit_transfer_signed" of "C.2.14 LDR Endpoint Decoding"
+static void bit_transfer_signed(int& a, int& b)
+{
+	b >>= 1;
+	b |= a & 0x80;
+	a >>= 1;
+	a &= 0x3F;
+	if (a & 0x20)
+	{
+		a -= 0x40;
+	}
+}
+
+static void set_endpoint(int* e, int r, int g, int b, int a)
+{
+	const int c[4] = { r, g, b, a };
+	for (int i = 0; i < 4; ++i)
+	{
+		e[i] = c[i] < 0 ? 0 : (c[i] > 255 ? 255 : c[i]);
+	}
+}
+
+// the 8 bit endpoints of the ldr "cem" out of its unquantized values, false for the hdr modes
+static bool decode_endpoints(int cem, const int* values, int* e0, int* e1)
+{
+	int v[8];
+	memcpy(v, values, sizeof(v));
+	switch (cem)
+	{
+	case CEM_LDR_LUMINANCE_DIRECT:
+		set_endpoint(e0, v[0], v[0], v[0], 255);
+		set_endpoint(e1, v[1], v[1], v[1], 255);
+		return true;
+	case 1:	// luminance, base + offset
+	{
+		int l0 = (v[0] >> 2) | (v[1] & 0xC0);
+		int l1 = std::min(l0 + (v[1] & 0x3F), 255);
+		set_endpoint(e0, l0, l0, l0, 255);
+		set_endpoint(e1, l1, l1, l1, 255);
+		return true;
+	}
+	case CEM_LDR_LUMINANCE_ALPHA_DIRECT:
+		set_endpoint(e0, v[0], v[0], v[0], v[2]);
+		set_endpoint(e1, v[1], v[1], v[1], v[3]);
+		return true;
+	case 5:	// luminance alpha, base + offset
+		bit_transfer_signed(v[1], v[0]);
+		bit_transfer_signed(v[3], v[2]);
+		set_endpoint(e0, v[0], v[0], v[0], v[2]);
+		set_endpoint(e1, v[0] + v[1], v[0] + v[1], v[0] + v[1], v[2] + v[3]);
+		return true;
+	case 6:	// rgb, base + scale
+		set_endpoint(e0, (v[0] * v[3]) >> 8, (v[1] * v[3]) >> 8, (v[2] * v[3]) >> 8, 255);
+		set_endpoint(e1, v[0], v[1], v[2], 255);
+		return true;
+	case 10:	// rgb, base + scale, plus two alpha
+		set_endpoint(e0, (v[0] * v[3]) >> 8, (v[1] * v[3]) >> 8, (v[2] * v[3]) >> 8, v[4]);
+		set_endpoint(e1, v[0], v[1], v[2], v[5]);
+		return true;
+	case CEM_LDR_RGB_DIRECT:
+	case CEM_LDR_RGBA_DIRECT:
+	{
+		int a0 = (cem == CEM_LDR_RGBA_DIRECT) ? v[6] : 255;
+		int a1 = (cem == CEM_LDR_RGBA_DIRECT) ? v[7] : 255;
+		if (v[1] + v[3] + v[5] >= v[0] + v[2] + v[4])
+		{
+			set_endpoint(e0, v[0], v[2], v[4], a0);
+			set_endpoint(e1, v[1], v[3], v[5], a1);
+		}
+		else
+		{
+			// blue contraction
+			set_endpoint(e0, (v[1] + v[5]) >> 1, (v[3] + v[5]) >> 1, v[5], a1);
+			set_endpoint(e1, (v[0] + v[4]) >> 1, (v[2] + v[4]) >> 1, v[4], a0);
+		}
+		return true;
+	}
+	case CEM_LDR_RGB_BASE_OFFSET:
+	case CEM_LDR_RGBA_BASE_OFFSET:
+	{
+		bit_transfer_signed(v[1], v[0]);
+		bit_transfer_signed(v[3], v[2]);
+		bit_transfer_signed(v[5], v[4]);
+		int a0 = 255;
+		int a1 = 255;
+		if (cem == CEM_LDR_RGBA_BASE_OFFSET)
+		{
+			bit_transfer_signed(v[7], v[6]);
+			a0 = v[6];
+			a1 = v[6] + v[7];
+		}
+		if (v[1] + v[3] + v[5] >= 0)
+		{
+			set_endpoint(e0, v[0], v[2], v[4], a0);
+			set_endpoint(e1, v[0] + v[1], v[2] + v[3], v[4] + v[5], a1);
+		}
+		else
+		{
+			int r = v[0] + v[1];
+			int g = v[2] + v[3];
+			int b = v[4] + v[5];
+			set_endpoint(e0, (r + b) >> 1, (g + b) >> 1, b, a1);
+			set_endpoint(e1, (v[0] + v[4]) >> 1, (v[2] + v[4]) >> 1, v[4], a0);
+		}
+		return true;
+	}
+	default:
+		return false;
+	}
+}
+
+// "C.2.10 Block Mode" of the 2d blocks, false for the reserved ones
+static bool decode_blockmode(uint mode, int& grid_x, int& grid_y, bool& dual, int& quant)
+{
+	int R;
+	int H;
+	int A = (mode >> 5) & 3;
+	if (mode & 3)
+	{
+		int B = (mode >> 7) & 3;
+		R = ((mode >> 4) & 1) | ((mode & 3) << 1);
+		switch ((mode >> 2) & 3)
+		{
+		case 0: grid_x = B + 4; grid_y = A + 2; break;
+		case 1: grid_x = B + 8; grid_y = A + 2; break;
+		case 2: grid_x = A + 2; grid_y = B + 8; break;
+		default:
+			if (mode & 0x100)
+			{
+				grid_x = (B & 1) + 2;
+				grid_y = A + 2;
+			}
+			else
+			{
+				grid_x = A + 2;
+				grid_y = (B & 1) + 6;
+			}
+			break;
+		}
+		H = (mode >> 9) & 1;
+		dual = ((mode >> 10) & 1) != 0;
+	}
+	else
+	{
+		if (((mode >> 2) & 3) == 0)
+		{
+			return false;
+		}
+		R = ((mode >> 4) & 1) | (((mode >> 2) & 3) << 1);
+		H = (mode >> 9) & 1;
+		dual = ((mode >> 10) & 1) != 0;
+		switch ((mode >> 7) & 3)
+		{
+		case 0: grid_x = 12; grid_y = A + 2; break;
+		case 1: grid_x = A + 2; grid_y = 12; break;
+		case 2:
+			grid_x = A + 6;
+			grid_y = ((mode >> 9) & 3) + 6;
+			H = 0;
+			dual = false;
+			break;
+		default:
+			if ((mode >> 6) & 1)
+			{
+				return false;
+			}
+			grid_x = ((mode >> 5) & 1) ? 10 : 6;
+			grid_y = ((mode >> 5) & 1) ? 6 : 10;
+			break;
+		}
+	}
+	if (R < 2)
+	{
+		return false;
+	}
+	// with H = 0 the weight ranges 2 ... 8 are QUANT_2 + (R - 2), with H = 1 the ranges 10 ... 32 are QUANT_10 + (R - 2)
+	static const int weight_quant[12] = { QUANT_2, QUANT_3, QUANT_4, QUANT_5, QUANT_6, QUANT_8, QUANT_10, QUANT_12, QUANT_16, QUANT_20, QUANT_24, QUANT_32 };
+	quant = weight_quant[(R - 2) + 6 * H];
+	return true;
+}
+
+// "C.2.21 Partition Pattern Generation" of a 2 partition 2d block, the only partitioned blocks the encoder writes
+static int select_partition(int seed, int x, int y, bool small_block)
+{
+	if (small_block)
+	{
+		x <<= 1;
+		y <<= 1;
+	}
+	seed += 1024;
+
+	uint r = (uint)seed;
+	r ^= r >> 15;
+	r -= r << 17;
+	r += r << 7;
+	r += r << 4;
+	r ^= r >> 5;
+	r += r << 16;
+	r ^= r >> 7;
+	r ^= r >> 3;
+	r ^= r << 6;
+	r ^= r >> 17;
+
+	// seeds 1 to 4, the ones of the partitions 3 and 4 and of z do not take part
+	int s[4];
+	for (int i = 0; i < 4; ++i)
+	{
+		s[i] = (r >> (4 * i)) & 0xF;
+		s[i] *= s[i];
+	}
+
+	int sh1 = (seed & 1) ? ((seed & 2) ? 4 : 5) : 5;
+	int sh2 = (seed & 1) ? 5 : ((seed & 2) ? 4 : 5);
+	for (int i = 0; i < 4; ++i)
+	{
+		s[i] >>= (i & 1) ? sh2 : sh1;
+	}
+
+	int a = (s[0] * x + s[1] * y + (r >> 14)) & 0x3F;
+	int b = (s[2] * x + s[3] * y + (r >> 10)) & 0x3F;
+	return (a >= b) ? 0 : 1;
+}
+
+/**
+ * decode a 2d ldr block of the "dim_x" x "dim_y" footprint to "InTexture.Load() * 255.0f" texels.
+ * "weight_bits" is the size of the weight area at the top of the block, 0 for a void-extent block.
+ * false for the blocks that decode to the error color, hdr ones included, and for the 3 and 4 partition blocks
+ * the encoder never writes.
+ */
+static bool decode_block_ldr(const uint8_t* blk, int dim_x, int dim_y, float4* texels, int& weight_bits)
+{
+	const uint mode = read_bits(blk, 0, 11);
+	if ((mode & 0x1FF) == 0x1FC)
+	{
+		// only the void-extent blocks without extent coordinates, the ones encode_void_extent() writes
+		if ((mode & 0x200) || read_bits(blk, 10, 22) != 0x3FFFFF || read_bits(blk, 32, 32) != 0xFFFFFFFF)
+		{
+			return false;
+		}
+		float4 color = float4((float)read_bits(blk, 64, 16), (float)read_bits(blk, 80, 16), (float)read_bits(blk, 96, 16), (float)read_bits(blk, 112, 16)) / 257.0f;
+		for (int i = 0; i < dim_x * dim_y; ++i)
+		{
+			texels[i] = color;
+		}
+		weight_bits = 0;
+		return true;
+	}
+
+	int grid_x;
+	int grid_y;
+	bool dual;
+	int quant;
+	if (!decode_blockmode(mode, grid_x, grid_y, dual, quant) || grid_x > dim_x || grid_y > dim_y)
+	{
+		return false;
+	}
+	const int partition_count = read_bits(blk, 11, 2) + 1;
+	const int planes = dual ? 2 : 1;
+	const int weight_count = grid_x * grid_y * planes;
+	if (partition_count > 2 || weight_count > 64)
+	{
+		return false;
+	}
+	weight_bits = ise_size(weight_count, quant);
+	if (weight_bits < 24 || weight_bits > 96)
+	{
+		return false;
+	}
+
+	// the color endpoint modes
+	int cem[4];
+	int below_weights = 128 - weight_bits;
+	int color_start;
+	if (partition_count == 1)
+	{
+		cem[0] = read_bits(blk, 13, 4);
+		color_start = 17;
+	}
+	else
+	{
+		color_start = 29;
+		int cem_bits = read_bits(blk, 23, 6);
+		int base = cem_bits & 3;
+		if (base == 0)
+		{
+			for (int i = 0; i < partition_count; ++i)
+			{
+				cem[i] = (cem_bits >> 2) & 0xF;
+			}
+		}
+		else
+		{
+			int high_bits = 3 * partition_count - 4;
+			below_weights -= high_bits;
+			int encoded = (cem_bits >> 2) | (read_bits(blk, below_weights, high_bits) << 4);
+			for (int i = 0; i < partition_count; ++i)
+			{
+				cem[i] = ((((encoded >> i) & 1) + base - 1) << 2) | ((encoded >> (partition_count + 2 * i)) & 3);
+			}
+		}
+	}
+	int ccs = 0;
+	if (dual)
+	{
+		below_weights -= 2;
+		ccs = read_bits(blk, below_weights, 2);
+	}
+
+	// the endpoints take the largest range that fits between the header and the weights
+	int color_count = 0;
+	for (int i = 0; i < partition_count; ++i)
+	{
+		color_count += 2 * ((cem[i] >> 2) + 1);
+	}
+	if (color_count > 18)
+	{
+		return false;
+	}
+	int color_quant = -1;
+	for (int q = QUANT_256; q >= QUANT_6; --q)
+	{
+		if (ise_size(color_count, q) <= below_weights - color_start)
+		{
+			color_quant = q;
+			break;
+		}
+	}
+	if (color_quant < 0)
+	{
+		return false;
+	}
+	int colors[18 + 2];
+	decode_ise(blk, color_start, color_count, color_quant, colors);
+	for (int i = 0; i < color_count; ++i)
+	{
+		colors[i] = (color_quant_table[color_table_offset[color_quant] + colors[i]] >> 8) & 0xFF;
+	}
+	int e0[4][4];
+	int e1[4][4];
+	for (int i = 0, offset = 0; i < partition_count; ++i)
+	{
+		int values[8] = { 0 };
+		int count = 2 * ((cem[i] >> 2) + 1);
+		memcpy(values, colors + offset, sizeof(int) * count);
+		offset += count;
+		if (!decode_endpoints(cem[i], values, e0[i], e1[i]))
+		{
+			return false;
+		}
+	}
+
+	// the weights are stored bit reversed from the top of the block
+	uint8_t reversed[BLOCK_BYTES];
+	for (int i = 0; i < BLOCK_BYTES; ++i)
+	{
+		uint8_t b = blk[BLOCK_BYTES - 1 - i];
+		b = (uint8_t)(((b & 0x0F) << 4) | (b >> 4));
+		b = (uint8_t)(((b & 0x33) << 2) | ((b >> 2) & 0x33));
+		b = (uint8_t)(((b & 0x55) << 1) | ((b >> 1) & 0x55));
+		reversed[i] = b;
+	}
+	int weights[64];
+	decode_ise(reversed, 0, weight_count, quant, weights);
+	for (int i = 0; i < weight_count; ++i)
+	{
+		weights[i] = unquantize_weight_value(quant, weights[i]);
+	}
+
+	// "C.2.18 Weight Infill"
+	const int Ds = (1024 + dim_x / 2) / (dim_x - 1);
+	const int Dt = (1024 + dim_y / 2) / (dim_y - 1);
+	const int partition_seed = (partition_count > 1) ? (int)read_bits(blk, 13, 10) : 0;
+	const bool small_block = dim_x * dim_y < 31;
+	for (int t = 0; t < dim_y; ++t)
+	{
+		for (int s = 0; s < dim_x; ++s)
+		{
+			int gs = (Ds * s * (grid_x - 1) + 32) >> 6;
+			int gt = (Dt * t * (grid_y - 1) + 32) >> 6;
+			int js = gs >> 4;
+			int fs = gs & 0xF;
+			int jt = gt >> 4;
+			int ft = gt & 0xF;
+			int v0 = js + jt * grid_x;
+			int w11 = (fs * ft + 8) >> 4;
+			int w10 = ft - w11;
+			int w01 = fs - w11;
+			int w00 = 16 - fs - ft + w11;
+
+			int plane_weight[2];
+			for (int p = 0; p < planes; ++p)
+			{
+				int sum = weights[v0 * planes + p] * w00;
+				sum += w01 ? weights[(v0 + 1) * planes + p] * w01 : 0;
+				sum += w10 ? weights[(v0 + grid_x) * planes + p] * w10 : 0;
+				sum += w11 ? weights[(v0 + grid_x + 1) * planes + p] * w11 : 0;
+				plane_weight[p] = (sum + 8) >> 4;
+			}
+
+			int part = (partition_count > 1) ? select_partition(partition_seed, s, t, small_block) : 0;
+			float c[4];
+			for (int k = 0; k < 4; ++k)
+			{
+				int w = (dual && k == ccs) ? plane_weight[1] : plane_weight[0];
+				int c0 = e0[part][k] * 257;
+				int c1 = e1[part][k] * 257;
+				c[k] = ((c0 * (64 - w) + c1 * w + 32) >> 6) / 257.0f;
+			}
+			texels[t * dim_x + s] = float4(c[0], c[1], c[2], c[3]);
+		}
+	}
+	return true;
+}
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// the rate of a block in the lz stream
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// the shortest match lz4 takes, and what a match costs it and zstd: token, offset and length
+#define RDO_MIN_MATCH	4
+#define RDO_MATCH_BYTES	3.0f
+
+/**
+ * the bytes of the blocks before the current one, indexed by their first two bytes.
+ * "cost" parses a block after them greedily, every match of RDO_MIN_MATCH bytes or more costs RDO_MATCH_BYTES
+ * and every other byte one literal.
+ */
+struct lz_window
+{
+	const uint8_t* bytes;
+	int size;
+	int head[256];
+	int next[RDO_MAX_WINDOW * BLOCK_BYTES];
+
+	static int key(const uint8_t* p)
+	{
+		return (p[0] * 31 + p[1]) & 0xFF;
+	}
+
+	void reset(const uint8_t* window, int window_bytes)
+	{
+		bytes = window;
+		size = window_bytes;
+		for (int i = 0; i < 256; ++i)
+		{
+			head[i] = -1;
+		}
+		for (int pos = 0; pos + RDO_MIN_MATCH <= size; ++pos)
+		{
+			int k = key(bytes + pos);
+			next[pos] = head[k];
+			head[k] = pos;
+		}
+	}
+
+	float cost(const uint8_t* blk) const
+	{
+		float bytes_cost = 0.0f;
+		int pos = 0;
+		while (pos < BLOCK_BYTES)
+		{
+			int longest = 0;
+			if (pos + RDO_MIN_MATCH <= BLOCK_BYTES)
+			{
+				for (int start = head[key(blk + pos)]; start >= 0; start = next[start])
+				{
+					int len = 0;
+					while (pos + len < BLOCK_BYTES && start + len < size && bytes[start + len] == blk[pos + len])
+					{
+						++len;
+					}
+					longest = std::max(longest, len);
+				}
+			}
+			if (longest >= RDO_MIN_MATCH)
+			{
+				bytes_cost += RDO_MATCH_BYTES;
+				pos += longest;
+			}
+			else
+			{
+				bytes_cost += 1.0f;
+				++pos;
+			}
+		}
+		return bytes_cost;
+	}
+};
+
+// mean squared error of the texels inside the image, alpha only counts with has_alpha
+static float candidate_error(const kernel_config& cfg, const float4* texels, const float4* decoded, int cols, int rows)
+{
+	float sum = 0.0f;
+	for (int y = 0; y < rows; ++y)
+	{
+		for (int x = 0; x < cols; ++x)
+		{
+			float4 d = texels[y * cfg.dim_x + x] - decoded[y * cfg.dim_x + x];
+			sum += d.x * d.x + d.y * d.y + d.z * d.z;
+			if (cfg.has_alpha)
+			{
+				sum += d.w * d.w;
+			}
+		}
+	}
+	return sum / (float)(cols * rows * (cfg.has_alpha ? 4 : 3));
+}
+
+void rdo_block_row(const encode_context& ctx, const uint8_t* rgba, int width, int height, int row_stride, int block_y, uint8_t* out_blocks)
+{
+	const kernel_config& cfg = ctx.cfg;
+	const float lambda = ctx.rdo_lambda;
+	const int xBlockNum = (width + cfg.dim_x - 1) / cfg.dim_x;
+	const int rows = std::min(cfg.dim_y, height - block_y * cfg.dim_y);
+	uint8_t* row_blocks = out_blocks + (size_t)block_y * xBlockNum * BLOCK_BYTES;
+
+	float4 texels[CPU_MAX_BLOCK_SIZE];
+	float4 decoded[CPU_MAX_BLOCK_SIZE];
+	lz_window window;
+	for (int block_x = 1; block_x < xBlockNum; ++block_x)
+	{
+		uint8_t* blk = row_blocks + block_x * BLOCK_BYTES;
+		const int cols = std::min(cfg.dim_x, width - block_x * cfg.dim_x);
+		const int window_blocks = std::min(block_x, ctx.rdo_window);
+		window.reset(blk - window_blocks * BLOCK_BYTES, window_blocks * BLOCK_BYTES);
+
+		int weight_bits;
+		if (!decode_block_ldr(blk, cfg.dim_x, cfg.dim_y, decoded, weight_bits))
+		{
+			continue;
+		}
+		fetch_block(cfg, ctx.lut, rgba, width, height, row_stride, block_x, block_y, texels);
+
+		uint8_t original[BLOCK_BYTES];
+		memcpy(original, blk, BLOCK_BYTES);
+		float best_cost = candidate_error(cfg, texels, decoded, cols, rows) + lambda * window.cost(original);
+
+		// the byte cuts around the start of the weights, or no cut in a void-extent block
+		int cuts[3] = { BLOCK_BYTES, 0, 0 };
+		int cut_count = 1;
+		if (weight_bits > 0)
+		{
+			const int weight_start = 128 - weight_bits;
+			cuts[cut_count++] = weight_start >> 3;
+			if (weight_start & 7)
+			{
+				cuts[cut_count++] = (weight_start >> 3) + 1;
+			}
+		}
+
+		// the nearest blocks first, their bytes are the likeliest to be close
+		for (int back = 1; back <= window_blocks; ++back)
+		{
+			const uint8_t* source = blk - back * BLOCK_BYTES;
+			for (int c = 0; c < cut_count * 2 - 1; ++c)
+			{
+				// the low bytes of "source" up to the cut, then the high bytes of it past the cut
+				uint8_t candidate[BLOCK_BYTES];
+				const int cut = cuts[(c + 1) / 2];
+				const bool source_low = (c & 1) == 0;
+				memcpy(candidate, source_low ? source : original, cut);
+				memcpy(candidate + cut, (source_low ? original : source) + cut, BLOCK_BYTES - cut);
+				if (memcmp(candidate, blk, BLOCK_BYTES) == 0)
+				{
+					continue;
+				}
+
+				// the error is never negative, a candidate whose rate alone is above the best cost can't win
+				float rate = lambda * window.cost(candidate);
+				int candidate_weight_bits;
+				if (rate >= best_cost || !decode_block_ldr(candidate, cfg.dim_x, cfg.dim_y, decoded, candidate_weight_bits))
+				{
+					continue;
+				}
+				float cost = candidate_error(cfg, texels, decoded, cols, rows) + rate;
+				if (cost < best_cost)
+				{
+					best_cost = cost;
+					memcpy(blk, candidate, BLOCK_BYTES);
+				}
+			}
+		}
+	}
+}
+
+} // namespace astc_cpu
@@ -0,0 +1,73 @@
+#include "astc_encode_cpu.h"
+
+/**
+ * ASTC_BlockEncode.hlsl compiled as c++, one namespace per shader permutation of the cpu backend:
+ * every footprint of ASTC_FOOTPRINTS with and without alpha. IS_NORMALMAP only matters to the texel fetch.
+ */
+namespace astc_cpu
+{
+
+#define ASTC_PERMUTATION_HDR 0
+#include "astc_encode_permutations.h"
+
+typedef uint4 (*encode_block_func)(float4* texels, uint effort, bool dual_plane, float void_extent_tolerance);
+typedef void (*grid_sample_taps_func)(uint grid, uint i, uint4& index, float4& coff);
+
+struct block_permutation
+{
+	int dim_x;
+	int dim_y;
+	int dim_z;
+	encode_block_func encode_rgb;
+	encode_block_func encode_rgba;
+	grid_sample_taps_func grid_sample_taps;
+};
+
+#define ASTC_PERMUTATION_ENTRY(x, y, z) { x, y, z, ASTC_PERMUTATION_NAME(x, y, z, rgb)::encode_block, \
+	ASTC_PERMUTATION_NAME(x, y, z, rgba)::encode_block, ASTC_PERMUTATION_NAME(x, y, z, rgb)::grid_sample_taps },
+
+static const block_permutation permutations[] = {
+	ASTC_FOOTPRINTS(ASTC_PERMUTATION_ENTRY)
+};
+
+#undef ASTC_PERMUTATION_ENTRY
+
+static const block_permutation& find_permutation(const kernel_config& cfg)
+{
+	for (const block_permutation& permutation : permutations)
+	{
+		if (permutation.dim_x == cfg.dim_x && permutation.dim_y == cfg.dim_y && permutation.dim_z == cfg.dim_z)
+		{
+			return permutation;
+		}
+	}
+	return permutations[0];
+}
+
+uint4 encode_block(const kernel_config& cfg, float4* texels)
+{
+	if (cfg.hdr)
+	{
+		return encode_block_hdr(cfg, texels);
+	}
+	const block_permutation& permutation = find_permutation(cfg);
+	encode_block_func encode = cfg.has_alpha ? permutation.encode_rgba : permutation.encode_rgb;
+	return encode(texels, cfg.effort, cfg.dual_plane, cfg.void_extent_tolerance);
+}
+
+void weight_grid_taps(const kernel_config& cfg, uint i, uint4& index, float4& coff)
+{
+	find_permutation(cfg).grid_sample_taps(0, i, index, coff);
+}
+
+uint assemble_blockmode(uint weight_quantmethod)
+{
+	return block_4x4x1_rgb::assemble_blockmode(weight_quantmethod);
+}
+
+uint4 void_extent_block(float4 color)
+{
+	return block_4x4x1_rgb::encode_void_extent(color);
+}
+
+} // namespace astc_cpu
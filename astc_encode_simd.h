@@ -0,0 +1,78 @@
+#pragma once
+
+#include <cstdint>
+
+#include "astc_cpu_feature.h"
+
+/**
+ * Block-parallel simd kernels: every simd lane encodes one block, the cpu analog of
+ * "one block per thread" in MainCS. The texels of a group of blocks are passed in
+ * structure-of-arrays form, soa_texels[(texel * 4 + channel) * lanes + lane].
+ *
+ * The kernels only implement the fast path of encode_block() (pca endpoints, QUANT_256 color,
+ * fixed weight quant) and are bit-identical to the scalar path, ASTC_BlockEncode.hlsl compiled as c++.
+ * void-extent and gray blocks take other encodings there, encode_astc_cpu() hands them to the scalar path.
+ */
+
+#define SIMD_MAX_LANES 16
+
+struct simd_kernel_params
+{
+	int dim_x;			// block footprint
+	int dim_y;
+	int has_alpha;
+	int decimated;		// the 4x4 weight grid is smaller than the block, the weights sample the texels
+	unsigned int grid_index[16][4];	// grid_sample_taps() of every weight of a decimated block
+	float grid_coff[16][4];
+};
+
+typedef void (*encode_blocks_func)(const simd_kernel_params& params, const float* soa_texels, uint8_t* out_blocks, int count);
+
+#if ASTC_X86
+// encode "count" (<= lanes) blocks, block i is written to out_blocks + i * BLOCK_BYTES
+void encode_blocks_sse41(const simd_kernel_params& params, const float* soa_texels, uint8_t* out_blocks, int count);
+void encode_blocks_avx2(const simd_kernel_params& params, const float* soa_texels, uint8_t* out_blocks, int count);
+void encode_blocks_avx512(const simd_kernel_params& params, const float* soa_texels, uint8_t* out_blocks, int count);
+#endif
+
+struct simd_kernel
+{
+	simd_isa isa;
+	int lanes;
+	encode_blocks_func encode_blocks;	// nullptr for the scalar path
+};
+
+/**
+ * Runtime dispatch: the widest kernel that both the cpu and "max_isa" allow.
+ */
+inline simd_kernel select_simd_kernel(simd_isa max_isa)
+{
+	simd_isa isa = cpu_simd_isa();
+	if (max_isa < isa) {
+		isa = max_isa;
+	}
+
+	simd_kernel kernel = { SIMD_ISA_SCALAR, 1, nullptr };
+#if ASTC_X86
+	switch (isa) {
+	case SIMD_ISA_AVX512:
+		kernel.isa = SIMD_ISA_AVX512;
+		kernel.lanes = 16;
+		kernel.encode_blocks = encode_blocks_avx512;
+		break;
+	case SIMD_ISA_AVX2:
+		kernel.isa = SIMD_ISA_AVX2;
+		kernel.lanes = 8;
+		kernel.encode_blocks = encode_blocks_avx2;
+		break;
+	case SIMD_ISA_SSE41:
+		kernel.isa = SIMD_ISA_SSE41;
+		kernel.lanes = 4;
+		kernel.encode_blocks = encode_blocks_sse41;
+		break;
+	default:
+		break;
+	}
+#endif
+	return kernel;
+}
@@ -0,0 +1,18 @@
+#include "astc_encode_cpu.h"
+
+#if ASTC_X86
+
+// everything above is compiled for the baseline ISA, only the kernel below may use SSE4.1
+#if defined(__GNUC__) && !defined(__SSE4_1__)
+#pragma GCC target("sse4.1")
+#endif
+
+#include "astc_vecmath_sse41.h"
+#include "astc_simd_kernel.h"
+
+void encode_blocks_sse41(const simd_kernel_params& params, const float* soa_texels, uint8_t* out_blocks, int count)
+{
+	simd_block_kernel<astc_sse41::simd_sse41>::encode_blocks(params, soa_texels, out_blocks, count);
+}
+
+#endif
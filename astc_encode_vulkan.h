@@ -0,0 +1,605 @@
+#pragma once
+
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include <vulkan/vulkan.h>
+
+#include "astc_option.h"
+
+/**
+ * Vulkan compute backend, runs MainCS of ASTC_Encode.hlsl compiled to spir-v by dxc.
+ * Works on any vulkan 1.0 device with a compute queue, including the lavapipe cpu driver:
+ *   VK_ICD_FILENAMES=/usr/share/vulkan/icd.d/lvp_icd.x86_64.json astc_cs_enc tex.png -vulkan
+ *
+ * descriptor set 0: binding 0 constData, binding 1 InTexture, binding 2 OutBuffer (see VK_BINDING in the shader)
+ */
+
+struct vulkan_context
+{
+	VkInstance instance;
+	VkPhysicalDevice physical_device;
+	VkDevice device;
+	VkQueue queue;
+	uint32_t queue_family;
+	VkCommandPool command_pool;
+	VkPhysicalDeviceMemoryProperties memory_properties;
+
+	vulkan_context()
+		: instance(VK_NULL_HANDLE)
+		, physical_device(VK_NULL_HANDLE)
+		, device(VK_NULL_HANDLE)
+		, queue(VK_NULL_HANDLE)
+		, queue_family(0)
+		, command_pool(VK_NULL_HANDLE)
+	{
+		memset(&memory_properties, 0, sizeof(memory_properties));
+	}
+};
+
+struct vulkan_buffer
+{
+	VkBuffer buffer;
+	VkDeviceMemory memory;
+	VkDeviceSize size;
+};
+
+typedef struct _vkConstantBuffer
+{
+	int TexelHeight;
+	int TexelWidth;
+	int GroupNumX;
+	int Padding;
+} VKConstantBuffer;
+
+inline void destroy_vulkan_context(vulkan_context& ctx)
+{
+	if (ctx.device != VK_NULL_HANDLE) {
+		vkDeviceWaitIdle(ctx.device);
+		if (ctx.command_pool != VK_NULL_HANDLE) {
+			vkDestroyCommandPool(ctx.device, ctx.command_pool, nullptr);
+		}
+		vkDestroyDevice(ctx.device, nullptr);
+	}
+	if (ctx.instance != VK_NULL_HANDLE) {
+		vkDestroyInstance(ctx.instance, nullptr);
+	}
+	ctx = vulkan_context();
+}
+
+// the first device with a compute queue, discrete gpus first
+inline VkResult create_vulkan_context(vulkan_context& ctx)
+{
+	VkApplicationInfo appInfo = {};
+	appInfo.sType = VK_STRUCTURE_TYPE_APPLICATION_INFO;
+	appInfo.pApplicationName = "astc_cs_enc";
+	appInfo.apiVersion = VK_API_VERSION_1_0;
+
+	VkInstanceCreateInfo instanceInfo = {};
+	instanceInfo.sType = VK_STRUCTURE_TYPE_INSTANCE_CREATE_INFO;
+	instanceInfo.pApplicationInfo = &appInfo;
+
+	VkResult res = vkCreateInstance(&instanceInfo, nullptr, &ctx.instance);
+	if (res != VK_SUCCESS) {
+		return res;
+	}
+
+	uint32_t deviceCount = 0;
+	vkEnumeratePhysicalDevices(ctx.instance, &deviceCount, nullptr);
+	std::vector<VkPhysicalDevice> devices(deviceCount);
+	vkEnumeratePhysicalDevices(ctx.instance, &deviceCount, devices.data());
+
+	int bestScore = -1;
+	for (VkPhysicalDevice dev : devices)
+	{
+		uint32_t familyCount = 0;
+		vkGetPhysicalDeviceQueueFamilyProperties(dev, &familyCount, nullptr);
+		std::vector<VkQueueFamilyProperties> families(familyCount);
+		vkGetPhysicalDeviceQueueFamilyProperties(dev, &familyCount, families.data());
+
+		for (uint32_t i = 0; i < familyCount; ++i)
+		{
+			if ((families[i].queueFlags & VK_QUEUE_COMPUTE_BIT) == 0) {
+				continue;
+			}
+			VkPhysicalDeviceProperties props;
+			vkGetPhysicalDeviceProperties(dev, &props);
+			int score = (props.deviceType == VK_PHYSICAL_DEVICE_TYPE_DISCRETE_GPU) ? 2
+				: (props.deviceType == VK_PHYSICAL_DEVICE_TYPE_INTEGRATED_GPU) ? 1 : 0;
+			if (score > bestScore) {
+				bestScore = score;
+				ctx.physical_device = dev;
+				ctx.queue_family = i;
+			}
+			break;
+		}
+	}
+
+	if (ctx.physical_device == VK_NULL_HANDLE) {
+		destroy_vulkan_context(ctx);
+		return VK_ERROR_INITIALIZATION_FAILED;
+	}
+
+	vkGetPhysicalDeviceMemoryProperties(ctx.physical_device, &ctx.memory_properties);
+
+	float priority = 1.0f;
+	VkDeviceQueueCreateInfo queueInfo = {};
+	queueInfo.sType = VK_STRUCTURE_TYPE_DEVICE_QUEUE_CREATE_INFO;
+	queueInfo.queueFamilyIndex = ctx.queue_family;
+	queueInfo.queueCount = 1;
+	queueInfo.pQueuePriorities = &priority;
+
+	VkDeviceCreateInfo deviceInfo = {};
+	deviceInfo.sType = VK_STRUCTURE_TYPE_DEVICE_CREATE_INFO;
+	deviceInfo.queueCreateInfoCount = 1;
+	deviceInfo.pQueueCreateInfos = &queueInfo;
+
+	res = vkCreateDevice(ctx.physical_device, &deviceInfo, nullptr, &ctx.device);
+	if (res != VK_SUCCESS) {
+		destroy_vulkan_context(ctx);
+		return res;
+	}
+
+	vkGetDeviceQueue(ctx.device, ctx.queue_family, 0, &ctx.queue);
+
+	VkCommandPoolCreateInfo poolInfo = {};
+	poolInfo.sType = VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO;
+	poolInfo.flags = VK_COMMAND_POOL_CREATE_TRANSIENT_BIT;
+	poolInfo.queueFamilyIndex = ctx.queue_family;
+
+	res = vkCreateCommandPool(ctx.device, &poolInfo, nullptr, &ctx.command_pool);
+	if (res != VK_SUCCESS) {
+		destroy_vulkan_context(ctx);
+		return res;
+	}
+
+	return VK_SUCCESS;
+}
+
+inline std::string vulkan_device_name(const vulkan_context& ctx)
+{
+	VkPhysicalDeviceProperties props;
+	vkGetPhysicalDeviceProperties(ctx.physical_device, &props);
+	return props.deviceName;
+}
+
+inline bool find_memory_type(const vulkan_context& ctx, uint32_t typeBits, VkMemoryPropertyFlags flags, uint32_t& index)
+{
+	for (uint32_t i = 0; i < ctx.memory_properties.memoryTypeCount; ++i)
+	{
+		if ((typeBits & (1u << i)) && (ctx.memory_properties.memoryTypes[i].propertyFlags & flags) == flags) {
+			index = i;
+			return true;
+		}
+	}
+	return false;
+}
+
+inline VkResult allocate_memory(const vulkan_context& ctx, const VkMemoryRequirements& req, VkMemoryPropertyFlags flags, VkDeviceMemory& memory)
+{
+	VkMemoryAllocateInfo allocInfo = {};
+	allocInfo.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
+	allocInfo.allocationSize = req.size;
+	if (!find_memory_type(ctx, req.memoryTypeBits, flags, allocInfo.memoryTypeIndex)) {
+		return VK_ERROR_OUT_OF_DEVICE_MEMORY;
+	}
+	return vkAllocateMemory(ctx.device, &allocInfo, nullptr, &memory);
+}
+
+inline VkResult create_buffer(const vulkan_context& ctx, VkDeviceSize size, VkBufferUsageFlags usage, VkMemoryPropertyFlags flags, vulkan_buffer& buf)
+{
+	buf.buffer = VK_NULL_HANDLE;
+	buf.memory = VK_NULL_HANDLE;
+	buf.size = size;
+
+	VkBufferCreateInfo bufferInfo = {};
+	bufferInfo.sType = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO;
+	bufferInfo.size = size;
+	bufferInfo.usage = usage;
+	bufferInfo.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
+
+	VkResult res = vkCreateBuffer(ctx.device, &bufferInfo, nullptr, &buf.buffer);
+	if (res != VK_SUCCESS) {
+		return res;
+	}
+
+	VkMemoryRequirements req;
+	vkGetBufferMemoryRequirements(ctx.device, buf.buffer, &req);
+	res = allocate_memory(ctx, req, flags, buf.memory);
+	if (res != VK_SUCCESS) {
+		return res;
+	}
+	return vkBindBufferMemory(ctx.device, buf.buffer, buf.memory, 0);
+}
+
+inline void destroy_buffer(const vulkan_context& ctx, vulkan_buffer& buf)
+{
+	if (buf.buffer != VK_NULL_HANDLE) {
+		vkDestroyBuffer(ctx.device, buf.buffer, nullptr);
+	}
+	if (buf.memory != VK_NULL_HANDLE) {
+		vkFreeMemory(ctx.device, buf.memory, nullptr);
+	}
+	buf.buffer = VK_NULL_HANDLE;
+	buf.memory = VK_NULL_HANDLE;
+}
+
+/**
+ * the same specialization as compile_shader() of the d3d11 backend, one spir-v file per permutation.
+ * a prebuilt ASTC_Encode_<w>x<h>_a<alpha>_n<normal>_e<effort>_d<dual plane>_v<void extent tolerance>.spv next to the shader is used as is,
+ * otherwise it is compiled with dxc (from PATH, or the DXC environment variable) and kept for the next run.
+ */
+inline std::string spirv_path(const encode_option& option)
+{
+	std::string path = "ASTC_Encode_";
+	path += std::to_string(option.block_x) + "x" + std::to_string(option.block_y);
+	path += option.has_alpha ? "_a1" : "_a0";
+	path += option.is_normal_map ? "_n1" : "_n0";
+	path += "_e" + std::to_string(option.effort);
+	path += option.dual_plane ? "_d1" : "_d0";
+	path += "_v" + std::to_string(option.void_extent_tolerance);
+	path += ".spv";
+	return path;
+}
+
+inline bool read_spirv(const std::string& path, std::vector<uint32_t>& code)
+{
+	FILE* f = fopen(path.c_str(), "rb");
+	if (f == nullptr) {
+		return false;
+	}
+	fseek(f, 0, SEEK_END);
+	long size = ftell(f);
+	fseek(f, 0, SEEK_SET);
+	bool ok = size > 0 && (size % 4) == 0;
+	if (ok) {
+		code.resize(size / 4);
+		ok = fread(code.data(), 1, size, f) == (size_t)size;
+	}
+	fclose(f);
+	return ok;
+}
+
+inline bool compile_shader_spirv(const char* srcFile, const char* entryPoint, const encode_option& option, std::vector<uint32_t>& code)
+{
+	std::string path = spirv_path(option);
+	if (read_spirv(path, code)) {
+		return true;
+	}
+
+	const char* dxc = getenv("DXC");
+	std::string cmd = (dxc != nullptr) ? dxc : "dxc";
+	cmd += " -spirv -T cs_6_0 -E ";
+	cmd += entryPoint;
+	cmd += " -D THREAD_NUM_X=" + std::to_string(THREAD_NUM_X);
+	cmd += " -D THREAD_NUM_Y=" + std::to_string(THREAD_NUM_Y);
+	cmd += option.is_normal_map ? " -D IS_NORMALMAP=1" : " -D IS_NORMALMAP=0";
+	cmd += " -D BLOCK_DIM_X=" + std::to_string(option.block_x);
+	cmd += " -D BLOCK_DIM_Y=" + std::to_string(option.block_y);
+	cmd += option.has_alpha ? " -D HAS_ALPHA=1" : " -D HAS_ALPHA=0";
+	cmd += " -D EFFORT=" + std::to_string(option.effort);
+	cmd += option.dual_plane ? " -D DUAL_PLANE=1" : " -D DUAL_PLANE=0";
+	cmd += " -D VOID_EXTENT_TOLERANCE=" + std::to_string(option.void_extent_tolerance);
+	cmd += " -Fo " + path + " ";
+	cmd += srcFile;
+
+	if (system(cmd.c_str()) != 0) {
+		std::cout << "dxc failed: " << cmd << std::endl;
+		return false;
+	}
+	return read_spirv(path, code);
+}
+
+/**
+ * encode a rgba8 image, rows "row_stride" bytes apart. the output has the layout of the d3d11 OutBuffer,
+ * BLOCK_BYTES per block in row major block order.
+ */
+inline bool encode_astc_vulkan(const vulkan_context& ctx, const uint8_t* rgba, int width, int height, int row_stride, const encode_option& option, uint8_t* out_blocks)
+{
+	std::vector<uint32_t> spirv;
+	if (!compile_shader_spirv("ASTC_Encode.hlsl", "MainCS", option, spirv)) {
+		std::cout << "compile shader failed!" << std::endl;
+		return false;
+	}
+
+	VkDevice device = ctx.device;
+
+	int xBlockNum = (width + option.block_x - 1) / option.block_x;
+	int yBlockNum = (height + option.block_y - 1) / option.block_y;
+	int TotalBlockNum = xBlockNum * yBlockNum;
+
+	int GroupSize = THREAD_NUM_X * THREAD_NUM_Y;
+	int GroupNum = (TotalBlockNum + GroupSize - 1) / GroupSize;
+	int GroupNumX = xBlockNum;
+	int GroupNumY = (GroupNum + GroupNumX - 1) / GroupNumX;
+
+	VkDeviceSize blockBytes = (VkDeviceSize)TotalBlockNum * BLOCK_BYTES;
+	VkDeviceSize texBytes = (VkDeviceSize)width * height * 4;
+
+	VkShaderModule shaderModule = VK_NULL_HANDLE;
+	VkDescriptorSetLayout setLayout = VK_NULL_HANDLE;
+	VkPipelineLayout pipelineLayout = VK_NULL_HANDLE;
+	VkPipeline pipeline = VK_NULL_HANDLE;
+	VkDescriptorPool descriptorPool = VK_NULL_HANDLE;
+	VkImage image = VK_NULL_HANDLE;
+	VkDeviceMemory imageMemory = VK_NULL_HANDLE;
+	VkImageView imageView = VK_NULL_HANDLE;
+	VkCommandBuffer cmd = VK_NULL_HANDLE;
+	VkFence fence = VK_NULL_HANDLE;
+	vulkan_buffer upload = {};
+	vulkan_buffer constants = {};
+	vulkan_buffer outBuf = {};
+	vulkan_buffer readback = {};
+
+	bool ok = false;
+	do
+	{
+		// compute pipeline
+		VkShaderModuleCreateInfo moduleInfo = {};
+		moduleInfo.sType = VK_STRUCTURE_TYPE_SHADER_MODULE_CREATE_INFO;
+		moduleInfo.codeSize = spirv.size() * sizeof(uint32_t);
+		moduleInfo.pCode = spirv.data();
+		if (vkCreateShaderModule(device, &moduleInfo, nullptr, &shaderModule) != VK_SUCCESS) {
+			break;
+		}
+
+		VkDescriptorSetLayoutBinding bindings[3] = {};
+		bindings[0].binding = 0;
+		bindings[0].descriptorType = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER;
+		bindings[1].binding = 1;
+		bindings[1].descriptorType = VK_DESCRIPTOR_TYPE_SAMPLED_IMAGE;
+		bindings[2].binding = 2;
+		bindings[2].descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
+		for (int i = 0; i < 3; ++i) {
+			bindings[i].descriptorCount = 1;
+			bindings[i].stageFlags = VK_SHADER_STAGE_COMPUTE_BIT;
+		}
+
+		VkDescriptorSetLayoutCreateInfo setLayoutInfo = {};
+		setLayoutInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_CREATE_INFO;
+		setLayoutInfo.bindingCount = 3;
+		setLayoutInfo.pBindings = bindings;
+		if (vkCreateDescriptorSetLayout(device, &setLayoutInfo, nullptr, &setLayout) != VK_SUCCESS) {
+			break;
+		}
+
+		VkPipelineLayoutCreateInfo pipelineLayoutInfo = {};
+		pipelineLayoutInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_LAYOUT_CREATE_INFO;
+		pipelineLayoutInfo.setLayoutCount = 1;
+		pipelineLayoutInfo.pSetLayouts = &setLayout;
+		if (vkCreatePipelineLayout(device, &pipelineLayoutInfo, nullptr, &pipelineLayout) != VK_SUCCESS) {
+			break;
+		}
+
+		VkComputePipelineCreateInfo pipelineInfo = {};
+		pipelineInfo.sType = VK_STRUCTURE_TYPE_COMPUTE_PIPELINE_CREATE_INFO;
+		pipelineInfo.stage.sType = VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO;
+		pipelineInfo.stage.stage = VK_SHADER_STAGE_COMPUTE_BIT;
+		pipelineInfo.stage.module = shaderModule;
+		pipelineInfo.stage.pName = "MainCS";
+		pipelineInfo.layout = pipelineLayout;
+		if (vkCreateComputePipelines(device, VK_NULL_HANDLE, 1, &pipelineInfo, nullptr, &pipeline) != VK_SUCCESS) {
+			break;
+		}
+
+		// source texture, UNORM_SRGB makes the shader read linear values the same as on d3d11
+		bool srgb = option.srgb && !option.is_normal_map;
+		VkImageCreateInfo imageInfo = {};
+		imageInfo.sType = VK_STRUCTURE_TYPE_IMAGE_CREATE_INFO;
+		imageInfo.imageType = VK_IMAGE_TYPE_2D;
+		imageInfo.format = srgb ? VK_FORMAT_R8G8B8A8_SRGB : VK_FORMAT_R8G8B8A8_UNORM;
+		imageInfo.extent.width = width;
+		imageInfo.extent.height = height;
+		imageInfo.extent.depth = 1;
+		imageInfo.mipLevels = 1;
+		imageInfo.arrayLayers = 1;
+		imageInfo.samples = VK_SAMPLE_COUNT_1_BIT;
+		imageInfo.tiling = VK_IMAGE_TILING_OPTIMAL;
+		imageInfo.usage = VK_IMAGE_USAGE_TRANSFER_DST_BIT | VK_IMAGE_USAGE_SAMPLED_BIT;
+		imageInfo.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
+		imageInfo.initialLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+		if (vkCreateImage(device, &imageInfo, nullptr, &image) != VK_SUCCESS) {
+			break;
+		}
+
+		VkMemoryRequirements imageReq;
+		vkGetImageMemoryRequirements(device, image, &imageReq);
+		if (allocate_memory(ctx, imageReq, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT, imageMemory) != VK_SUCCESS
+			|| vkBindImageMemory(device, image, imageMemory, 0) != VK_SUCCESS) {
+			break;
+		}
+
+		VkImageViewCreateInfo viewInfo = {};
+		viewInfo.sType = VK_STRUCTURE_TYPE_IMAGE_VIEW_CREATE_INFO;
+		viewInfo.image = image;
+		viewInfo.viewType = VK_IMAGE_VIEW_TYPE_2D;
+		viewInfo.format = imageInfo.format;
+		viewInfo.subresourceRange.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
+		viewInfo.subresourceRange.levelCount = 1;
+		viewInfo.subresourceRange.layerCount = 1;
+		if (vkCreateImageView(device, &viewInfo, nullptr, &imageView) != VK_SUCCESS) {
+			break;
+		}
+
+		// buffers
+		const VkMemoryPropertyFlags hostFlags = VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT;
+		if (create_buffer(ctx, texBytes, VK_BUFFER_USAGE_TRANSFER_SRC_BIT, hostFlags, upload) != VK_SUCCESS
+			|| create_buffer(ctx, sizeof(VKConstantBuffer), VK_BUFFER_USAGE_UNIFORM_BUFFER_BIT, hostFlags, constants) != VK_SUCCESS
+			|| create_buffer(ctx, blockBytes, VK_BUFFER_USAGE_STORAGE_BUFFER_BIT | VK_BUFFER_USAGE_TRANSFER_SRC_BIT, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT, outBuf) != VK_SUCCESS
+			|| create_buffer(ctx, blockBytes, VK_BUFFER_USAGE_TRANSFER_DST_BIT, hostFlags, readback) != VK_SUCCESS) {
+			break;
+		}
+
+		void* mapped = nullptr;
+		if (vkMapMemory(device, upload.memory, 0, texBytes, 0, &mapped) != VK_SUCCESS) {
+			break;
+		}
+		for (int y = 0; y < height; ++y) {
+			memcpy((uint8_t*)mapped + (size_t)y * width * 4, rgba + (ptrdiff_t)y * row_stride, (size_t)width * 4);
+		}
+		vkUnmapMemory(device, upload.memory);
+
+		VKConstantBuffer ConstBuff;
+		ConstBuff.TexelHeight = height;
+		ConstBuff.TexelWidth = width;
+		ConstBuff.GroupNumX = GroupNumX;
+		ConstBuff.Padding = 0;
+		if (vkMapMemory(device, constants.memory, 0, sizeof(ConstBuff), 0, &mapped) != VK_SUCCESS) {
+			break;
+		}
+		memcpy(mapped, &ConstBuff, sizeof(ConstBuff));
+		vkUnmapMemory(device, constants.memory);
+
+		// descriptors
+		VkDescriptorPoolSize poolSizes[3];
+		for (int i = 0; i < 3; ++i) {
+			poolSizes[i].type = bindings[i].descriptorType;
+			poolSizes[i].descriptorCount = 1;
+		}
+		VkDescriptorPoolCreateInfo descriptorPoolInfo = {};
+		descriptorPoolInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_POOL_CREATE_INFO;
+		descriptorPoolInfo.maxSets = 1;
+		descriptorPoolInfo.poolSizeCount = 3;
+		descriptorPoolInfo.pPoolSizes = poolSizes;
+		if (vkCreateDescriptorPool(device, &descriptorPoolInfo, nullptr, &descriptorPool) != VK_SUCCESS) {
+			break;
+		}
+
+		VkDescriptorSet descriptorSet = VK_NULL_HANDLE;
+		VkDescriptorSetAllocateInfo setInfo = {};
+		setInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_ALLOCATE_INFO;
+		setInfo.descriptorPool = descriptorPool;
+		setInfo.descriptorSetCount = 1;
+		setInfo.pSetLayouts = &setLayout;
+		if (vkAllocateDescriptorSets(device, &setInfo, &descriptorSet) != VK_SUCCESS) {
+			break;
+		}
+
+		VkDescriptorBufferInfo constInfo = { constants.buffer, 0, VK_WHOLE_SIZE };
+		VkDescriptorImageInfo texInfo = { VK_NULL_HANDLE, imageView, VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL };
+		VkDescriptorBufferInfo outInfo = { outBuf.buffer, 0, VK_WHOLE_SIZE };
+
+		VkWriteDescriptorSet writes[3] = {};
+		for (int i = 0; i < 3; ++i) {
+			writes[i].sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
+			writes[i].dstSet = descriptorSet;
+			writes[i].dstBinding = i;
+			writes[i].descriptorCount = 1;
+			writes[i].descriptorType = bindings[i].descriptorType;
+		}
+		writes[0].pBufferInfo = &constInfo;
+		writes[1].pImageInfo = &texInfo;
+		writes[2].pBufferInfo = &outInfo;
+		vkUpdateDescriptorSets(device, 3, writes, 0, nullptr);
+
+		// upload, compress one block per thread, readback
+		VkCommandBufferAllocateInfo cmdInfo = {};
+		cmdInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO;
+		cmdInfo.commandPool = ctx.command_pool;
+		cmdInfo.level = VK_COMMAND_BUFFER_LEVEL_PRIMARY;
+		cmdInfo.commandBufferCount = 1;
+		if (vkAllocateCommandBuffers(device, &cmdInfo, &cmd) != VK_SUCCESS) {
+			break;
+		}
+
+		VkCommandBufferBeginInfo beginInfo = {};
+		beginInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
+		beginInfo.flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT;
+		vkBeginCommandBuffer(cmd, &beginInfo);
+
+		VkImageMemoryBarrier imageBarrier = {};
+		imageBarrier.sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER;
+		imageBarrier.srcAccessMask = 0;
+		imageBarrier.dstAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+		imageBarrier.oldLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+		imageBarrier.newLayout = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
+		imageBarrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+		imageBarrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+		imageBarrier.image = image;
+		imageBarrier.subresourceRange = viewInfo.subresourceRange;
+		vkCmdPipelineBarrier(cmd, VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT, 0, 0, nullptr, 0, nullptr, 1, &imageBarrier);
+
+		VkBufferImageCopy region = {};
+		region.imageSubresource.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
+		region.imageSubresource.layerCount = 1;
+		region.imageExtent = imageInfo.extent;
+		vkCmdCopyBufferToImage(cmd, upload.buffer, image, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, 1, &region);
+
+		imageBarrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+		imageBarrier.dstAccessMask = VK_ACCESS_SHADER_READ_BIT;
+		imageBarrier.oldLayout = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
+		imageBarrier.newLayout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
+		vkCmdPipelineBarrier(cmd, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, 0, 0, nullptr, 0, nullptr, 1, &imageBarrier);
+
+		vkCmdBindPipeline(cmd, VK_PIPELINE_BIND_POINT_COMPUTE, pipeline);
+		vkCmdBindDescriptorSets(cmd, VK_PIPELINE_BIND_POINT_COMPUTE, pipelineLayout, 0, 1, &descriptorSet, 0, nullptr);
+		vkCmdDispatch(cmd, GroupNumX, GroupNumY, 1);
+
+		VkBufferMemoryBarrier bufferBarrier = {};
+		bufferBarrier.sType = VK_STRUCTURE_TYPE_BUFFER_MEMORY_BARRIER;
+		bufferBarrier.srcAccessMask = VK_ACCESS_SHADER_WRITE_BIT;
+		bufferBarrier.dstAccessMask = VK_ACCESS_TRANSFER_READ_BIT;
+		bufferBarrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+		bufferBarrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+		bufferBarrier.buffer = outBuf.buffer;
+		bufferBarrier.size = VK_WHOLE_SIZE;
+		vkCmdPipelineBarrier(cmd, VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT, 0, 0, nullptr, 1, &bufferBarrier, 0, nullptr);
+
+		VkBufferCopy copy = { 0, 0, blockBytes };
+		vkCmdCopyBuffer(cmd, outBuf.buffer, readback.buffer, 1, &copy);
+
+		bufferBarrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+		bufferBarrier.dstAccessMask = VK_ACCESS_HOST_READ_BIT;
+		bufferBarrier.buffer = readback.buffer;
+		vkCmdPipelineBarrier(cmd, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_HOST_BIT, 0, 0, nullptr, 1, &bufferBarrier, 0, nullptr);
+
+		if (vkEndCommandBuffer(cmd) != VK_SUCCESS) {
+			break;
+		}
+
+		VkFenceCreateInfo fenceInfo = {};
+		fenceInfo.sType = VK_STRUCTURE_TYPE_FENCE_CREATE_INFO;
+		if (vkCreateFence(device, &fenceInfo, nullptr, &fence) != VK_SUCCESS) {
+			break;
+		}
+
+		VkSubmitInfo submitInfo = {};
+		submitInfo.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO;
+		submitInfo.commandBufferCount = 1;
+		submitInfo.pCommandBuffers = &cmd;
+		if (vkQueueSubmit(ctx.queue, 1, &submitInfo, fence) != VK_SUCCESS
+			|| vkWaitForFences(device, 1, &fence, VK_TRUE, UINT64_MAX) != VK_SUCCESS) {
+			break;
+		}
+
+		if (vkMapMemory(device, readback.memory, 0, blockBytes, 0, &mapped) != VK_SUCCESS) {
+			break;
+		}
+		memcpy(out_blocks, mapped, (size_t)blockBytes);
+		vkUnmapMemory(device, readback.memory);
+
+		ok = true;
+	} while (false);
+
+	if (fence != VK_NULL_HANDLE) vkDestroyFence(device, fence, nullptr);
+	if (cmd != VK_NULL_HANDLE) vkFreeCommandBuffers(device, ctx.command_pool, 1, &cmd);
+	if (descriptorPool != VK_NULL_HANDLE) vkDestroyDescriptorPool(device, descriptorPool, nullptr);
+	destroy_buffer(ctx, readback);
+	destroy_buffer(ctx, outBuf);
+	destroy_buffer(ctx, constants);
+	destroy_buffer(ctx, upload);
+	if (imageView != VK_NULL_HANDLE) vkDestroyImageView(device, imageView, nullptr);
+	if (image != VK_NULL_HANDLE) vkDestroyImage(device, image, nullptr);
+	if (imageMemory != VK_NULL_HANDLE) vkFreeMemory(device, imageMemory, nullptr);
+	if (pipeline != VK_NULL_HANDLE) vkDestroyPipeline(device, pipeline, nullptr);
+	if (pipelineLayout != VK_NULL_HANDLE) vkDestroyPipelineLayout(device, pipelineLayout, nullptr);
+	if (setLayout != VK_NULL_HANDLE) vkDestroyDescriptorSetLayout(device, setLayout, nullptr);
+	if (shaderModule != VK_NULL_HANDLE) vkDestroyShaderModule(device, shaderModule, nullptr);
+
+	return ok;
+}
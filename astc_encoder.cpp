@@ -0,0 +1,205 @@
+#include "astc_encoder.h"
+#include "astc_encode_cpu.h"
+#include "astc_mipmap.h"
+
+astc_encoder::astc_encoder(const encode_option& option)
+	: m_option(option)
+	, m_pool(nullptr)
+	, m_context(nullptr)
+{
+	// the shader has no permutation for other footprints, every encode() then fails
+	if (is_astc_footprint(m_option.block_x, m_option.block_y, m_option.block_z)) {
+		m_pool = new thread_pool(m_option.thread_count);
+		m_context = new astc_cpu::encode_context(m_option);
+	}
+}
+
+astc_encoder::~astc_encoder()
+{
+	delete m_context;
+	delete m_pool;
+}
+
+bool astc_encoder::valid() const
+{
+	return m_context != nullptr;
+}
+
+int astc_encoder::block_dim_x() const
+{
+	return m_option.block_x;
+}
+
+int astc_encoder::block_dim_y() const
+{
+	return m_option.block_y;
+}
+
+int astc_encoder::block_dim_z() const
+{
+	return m_option.block_z;
+}
+
+size_t astc_encoder::output_size(int width, int height, int depth) const
+{
+	if (!valid() || width <= 0 || height <= 0 || depth <= 0) {
+		return 0;
+	}
+	size_t xBlockNum = (size_t)((width + block_dim_x() - 1) / block_dim_x());
+	size_t yBlockNum = (size_t)((height + block_dim_y() - 1) / block_dim_y());
+	size_t zBlockNum = (size_t)((depth + block_dim_z() - 1) / block_dim_z());
+	return xBlockNum * yBlockNum * zBlockNum * BLOCK_BYTES;
+}
+
+bool astc_encoder::encode(const uint8_t* rgba, int width, int height, int row_stride, uint8_t* out_blocks, size_t out_size)
+{
+	if (block_dim_z() != 1) {
+		return encode(&rgba, width, height, 1, row_stride, out_blocks, out_size);
+	}
+
+	if (!valid() || rgba == nullptr || out_blocks == nullptr || width <= 0 || height <= 0 || m_option.hdr) {
+		return false;
+	}
+
+	const int row_bytes = row_stride < 0 ? -row_stride : row_stride;
+	if (row_bytes / 4 < width) {
+		return false;
+	}
+
+	if (out_size < output_size(width, height)) {
+		return false;
+	}
+
+	encode_astc_cpu(*m_pool, *m_context, rgba, width, height, row_stride, out_blocks);
+	return true;
+}
+
+bool astc_encoder::encode(const float* rgba, int width, int height, int row_stride, uint8_t* out_blocks, size_t out_size)
+{
+	if (block_dim_z() != 1) {
+		return encode(&rgba, width, height, 1, row_stride, out_blocks, out_size);
+	}
+
+	if (!valid() || rgba == nullptr || out_blocks == nullptr || width <= 0 || height <= 0 || !m_option.hdr) {
+		return false;
+	}
+
+	const int row_bytes = row_stride < 0 ? -row_stride : row_stride;
+	if (row_bytes / 16 < width) {
+		return false;
+	}
+
+	if (out_size < output_size(width, height)) {
+		return false;
+	}
+
+	encode_astc_cpu(*m_pool, *m_context, rgba, width, height, row_stride, out_blocks);
+	return true;
+}
+
+// the slices of a volume or the layers of an array, "texel_bytes" is 4 for rgba8 and 16 for float
+template <typename T>
+static bool valid_slices(const T* const* slices, int width, int height, int depth, int row_stride, int texel_bytes)
+{
+	if (slices == nullptr || width <= 0 || height <= 0 || depth <= 0) {
+		return false;
+	}
+	for (int z = 0; z < depth; ++z) {
+		if (slices[z] == nullptr) {
+			return false;
+		}
+	}
+	const int row_bytes = row_stride < 0 ? -row_stride : row_stride;
+	return row_bytes / texel_bytes >= width;
+}
+
+bool astc_encoder::encode(const uint8_t* const* slices, int width, int height, int depth, int row_stride, uint8_t* out_blocks, size_t out_size)
+{
+	if (!valid() || out_blocks == nullptr || m_option.hdr || !valid_slices(slices, width, height, depth, row_stride, 4)) {
+		return false;
+	}
+
+	if (out_size < output_size(width, height, depth)) {
+		return false;
+	}
+
+	encode_astc_cpu(*m_pool, *m_context, slices, width, height, depth, row_stride, out_blocks);
+	return true;
+}
+
+bool astc_encoder::encode(const float* const* slices, int width, int height, int depth, int row_stride, uint8_t* out_blocks, size_t out_size)
+{
+	if (!valid() || out_blocks == nullptr || !m_option.hdr || !valid_slices(slices, width, height, depth, row_stride, 16)) {
+		return false;
+	}
+
+	if (out_size < output_size(width, height, depth)) {
+		return false;
+	}
+
+	encode_astc_cpu(*m_pool, *m_context, slices, width, height, depth, row_stride, out_blocks);
+	return true;
+}
+
+int astc_encoder::mip_levels(int width, int height) const
+{
+	if (!valid() || width <= 0 || height <= 0) {
+		return 0;
+	}
+	return m_option.mip_filter == MIP_FILTER_NONE ? 1 : astc_cpu::mip_level_count(width, height);
+}
+
+size_t astc_encoder::mipmap_output_size(int width, int height) const
+{
+	return layers_output_size(width, height, 1);
+}
+
+bool astc_encoder::encode_mipmaps(const uint8_t* rgba, int width, int height, int row_stride, uint8_t* out_blocks, size_t out_size)
+{
+	return encode_layers(&rgba, width, height, 1, row_stride, out_blocks, out_size);
+}
+
+bool astc_encoder::encode_mipmaps(const float* rgba, int width, int height, int row_stride, uint8_t* out_blocks, size_t out_size)
+{
+	return encode_layers(&rgba, width, height, 1, row_stride, out_blocks, out_size);
+}
+
+size_t astc_encoder::layers_output_size(int width, int height, int layer_count) const
+{
+	if (layer_count <= 0) {
+		return 0;
+	}
+	size_t size = 0;
+	for (int level = 0; level < mip_levels(width, height); ++level) {
+		size += output_size(astc_cpu::mip_size(width, level), astc_cpu::mip_size(height, level));
+	}
+	return size * (size_t)layer_count;
+}
+
+bool astc_encoder::encode_layers(const uint8_t* const* layers, int width, int height, int layer_count, int row_stride, uint8_t* out_blocks, size_t out_size)
+{
+	if (!valid() || out_blocks == nullptr || m_option.hdr || block_dim_z() != 1 || !valid_slices(layers, width, height, layer_count, row_stride, 4)) {
+		return false;
+	}
+
+	if (out_size < layers_output_size(width, height, layer_count)) {
+		return false;
+	}
+
+	encode_astc_layers_cpu(*m_pool, *m_context, m_option.mip_filter, m_option.alpha_coverage, layers, layer_count, width, height, row_stride, out_blocks);
+	return true;
+}
+
+bool astc_encoder::encode_layers(const float* const* layers, int width, int height, int layer_count, int row_stride, uint8_t* out_blocks, size_t out_size)
+{
+	if (!valid() || out_blocks == nullptr || !m_option.hdr || block_dim_z() != 1 || !valid_slices(layers, width, height, layer_count, row_stride, 16)) {
+		return false;
+	}
+
+	if (out_size < layers_output_size(width, height, layer_count)) {
+		return false;
+	}
+
+	encode_astc_layers_cpu(*m_pool, *m_context, m_option.mip_filter, m_option.alpha_coverage, layers, layer_count, width, height, row_stride, out_blocks);
+	return true;
+}
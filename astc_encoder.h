@@ -0,0 +1,84 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include "astc_option.h"
+
+class thread_pool;
+namespace astc_cpu { struct encode_context; }
+
+/**
+ * Embeddable cpu encoder, the library entry point of the astc_enc_lib target.
+ *
+ * The source is read in place: "rgba" points at the first texel of the first row, rows are
+ * "row_stride" bytes apart (negative for a bottom-up image), 4 bytes per texel.
+ * No copy and no vertical flip is made. The blocks are written straight into the caller's buffer,
+ * BLOCK_BYTES per block in row major block order, the payload of a .astc file without its header.
+ *
+ * A volume is a list of "depth" slices, each laid out like a 2d image with the same "row_stride".
+ * Its blocks are stored x fastest, then y, then z. The 2d overloads take an image as a volume of one
+ * slice when option() has a 3d footprint.
+ *
+ * The worker threads and the option dependent tables live as long as the encoder,
+ * keep one around to encode many images. One encode() at a time per encoder.
+ */
+class astc_encoder
+{
+public:
+	explicit astc_encoder(const encode_option& option = encode_option());
+	~astc_encoder();
+
+	astc_encoder(const astc_encoder&) = delete;
+	astc_encoder& operator=(const astc_encoder&) = delete;
+
+	const encode_option& option() const { return m_option; }
+
+	// false when option() has no astc footprint (is_astc_footprint()), output_size() is then 0 and every encode() fails
+	bool valid() const;
+
+	// the block footprint of option()
+	int block_dim_x() const;
+	int block_dim_y() const;
+	int block_dim_z() const;
+
+	// bytes the output of a width x height x depth image takes
+	size_t output_size(int width, int height, int depth = 1) const;
+
+	// returns false without writing anything when the arguments are invalid or "out_size" is too small
+	bool encode(const uint8_t* rgba, int width, int height, int row_stride, uint8_t* out_blocks, size_t out_size);
+
+	// the same for the float texels of an option().hdr encoder, 16 bytes per texel, linear half float range values.
+	// the rgba8 overload refuses an hdr encoder and this one an ldr encoder
+	bool encode(const float* rgba, int width, int height, int row_stride, uint8_t* out_blocks, size_t out_size);
+
+	// the volume overloads, "slices" has "depth" entries
+	bool encode(const uint8_t* const* slices, int width, int height, int depth, int row_stride, uint8_t* out_blocks, size_t out_size);
+	bool encode(const float* const* slices, int width, int height, int depth, int row_stride, uint8_t* out_blocks, size_t out_size);
+
+	// the levels of the mip chain of a width x height image, 1 when option().mip_filter is MIP_FILTER_NONE
+	int mip_levels(int width, int height) const;
+
+	// bytes the mip chain takes, the levels back to back from level 0
+	size_t mipmap_output_size(int width, int height) const;
+
+	// encode the image and every level of its mip chain in one job, filtered with option().mip_filter.
+	// level N + 1 is filtered while level N is encoded. 2d footprints only
+	bool encode_mipmaps(const uint8_t* rgba, int width, int height, int row_stride, uint8_t* out_blocks, size_t out_size);
+	bool encode_mipmaps(const float* rgba, int width, int height, int row_stride, uint8_t* out_blocks, size_t out_size);
+
+	// bytes "layer_count" images and their mip chains take
+	size_t layers_output_size(int width, int height, int layer_count) const;
+
+	// encode the layers of a texture array or the 6 faces of a cubemap (+x, -x, +y, -y, +z, -z) in one job,
+	// every row of blocks of every layer goes in one queue. the images share the size and the row stride.
+	// with option().mip_filter the mip chain of every layer too. the output is level major, then layer,
+	// the order of a ktx file. 2d footprints only
+	bool encode_layers(const uint8_t* const* layers, int width, int height, int layer_count, int row_stride, uint8_t* out_blocks, size_t out_size);
+	bool encode_layers(const float* const* layers, int width, int height, int layer_count, int row_stride, uint8_t* out_blocks, size_t out_size);
+
+private:
+	encode_option m_option;
+	thread_pool* m_pool;
+	astc_cpu::encode_context* m_context;
+};
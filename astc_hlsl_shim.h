@@ -0,0 +1,117 @@
+#pragma once
+
+#include <cmath>
+
+/**
+ * The part of hlsl that ASTC_BlockEncode.hlsl uses, enough to compile the shader's block encoder as c++.
+ * the operations follow the shader's float semantics: dot/mul sum left to right, round() is round half
+ * to even and min/max/clamp use the operand order of the sse instructions, the simd kernels rely on all three.
+ * The ctors are constexpr so the float4/uint4 tables of ASTC_Table.hlsl are constant initialized.
+ */
+
+// parameter qualifiers of ASTC_BlockEncode.hlsl, arrays already decay to pointers in c++
+#define ASTC_OUT(T) T&
+#define ASTC_INOUT(T) T&
+#define ASTC_OUT_ARRAY
+
+namespace astc_cpu
+{
+
+typedef unsigned int uint;
+
+struct float4
+{
+	float x, y, z, w;
+	constexpr float4() : x(0), y(0), z(0), w(0) {}
+	constexpr float4(float s) : x(s), y(s), z(s), w(s) {}
+	constexpr float4(float x_, float y_, float z_, float w_) : x(x_), y(y_), z(z_), w(w_) {}
+	float& operator[](int i) { return (&x)[i]; }
+	float operator[](int i) const { return (&x)[i]; }
+};
+
+struct uint4
+{
+	uint x, y, z, w;
+	constexpr uint4() : x(0), y(0), z(0), w(0) {}
+	constexpr uint4(uint s) : x(s), y(s), z(s), w(s) {}
+	constexpr uint4(uint x_, uint y_, uint z_, uint w_) : x(x_), y(y_), z(z_), w(w_) {}
+	// float4 to uint4 truncates like the hlsl conversion
+	uint4(const float4& v) : x((uint)v.x), y((uint)v.y), z((uint)v.z), w((uint)v.w) {}
+	uint& operator[](int i) { return (&x)[i]; }
+	uint operator[](int i) const { return (&x)[i]; }
+};
+
+struct float4x4
+{
+	float4 m[4];
+	float4x4() {}
+	float4x4(float s) { m[0] = m[1] = m[2] = m[3] = float4(s); }
+	float4& operator[](int i) { return m[i]; }
+	const float4& operator[](int i) const { return m[i]; }
+};
+
+inline float4 operator+(const float4& a, const float4& b) { return float4(a.x + b.x, a.y + b.y, a.z + b.z, a.w + b.w); }
+inline float4 operator-(const float4& a, const float4& b) { return float4(a.x - b.x, a.y - b.y, a.z - b.z, a.w - b.w); }
+inline float4 operator*(const float4& a, float s) { return float4(a.x * s, a.y * s, a.z * s, a.w * s); }
+inline float4 operator*(const float4& a, const float4& b) { return float4(a.x * b.x, a.y * b.y, a.z * b.z, a.w * b.w); }
+inline float4 operator/(const float4& a, float s) { return float4(a.x / s, a.y / s, a.z / s, a.w / s); }
+inline float4& operator+=(float4& a, const float4& b) { return a = a + b; }
+inline float4& operator/=(float4& a, float s) { return a = a / s; }
+
+inline float4x4& operator/=(float4x4& m, float s)
+{
+	for (int i = 0; i < 4; ++i)
+	{
+		m.m[i] /= s;
+	}
+	return m;
+}
+
+inline float dot(const float4& a, const float4& b) { return a.x * b.x + a.y * b.y + a.z * b.z + a.w * b.w; }
+inline float length(const float4& v) { return std::sqrt(dot(v, v)); }
+inline float4 normalize(const float4& v) { return v / length(v); }
+
+inline float4 mul(const float4x4& m, const float4& v)
+{
+	return float4(dot(m.m[0], v), dot(m.m[1], v), dot(m.m[2], v), dot(m.m[3], v));
+}
+
+inline float4x4 mul(const float4x4& a, const float4x4& b)
+{
+	float4x4 r;
+	for (int i = 0; i < 4; ++i)
+	{
+		for (int j = 0; j < 4; ++j)
+		{
+			r.m[i][j] = a.m[i].x * b.m[0][j] + a.m[i].y * b.m[1][j] + a.m[i].z * b.m[2][j] + a.m[i].w * b.m[3][j];
+		}
+	}
+	return r;
+}
+
+inline float round(float f) { return std::nearbyint(f); }
+inline float4 round(const float4& v) { return float4(round(v.x), round(v.y), round(v.z), round(v.w)); }
+
+inline float abs(float f) { return std::fabs(f); }
+inline float floor(float f) { return std::floor(f); }
+inline float log2(float f) { return std::log2(f); }
+inline float exp2(float f) { return std::exp2(f); }
+inline float sin(float f) { return std::sin(f); }
+inline float cos(float f) { return std::cos(f); }
+inline float atan2(float y, float x) { return std::atan2(y, x); }
+
+inline uint countbits(uint v)
+{
+	v = v - ((v >> 1) & 0x55555555u);
+	v = (v & 0x33333333u) + ((v >> 2) & 0x33333333u);
+	return (((v + (v >> 4)) & 0x0F0F0F0Fu) * 0x01010101u) >> 24;
+}
+
+inline float min(float a, float b) { return a < b ? a : b; }
+inline float max(float a, float b) { return a > b ? a : b; }
+
+inline float clamp(float f, float lo, float hi) { return f < lo ? lo : (f > hi ? hi : f); }
+inline float4 clamp(const float4& v, float lo, float hi) { return float4(clamp(v.x, lo, hi), clamp(v.y, lo, hi), clamp(v.z, lo, hi), clamp(v.w, lo, hi)); }
+inline uint clamp(uint u, uint lo, uint hi) { return u < lo ? lo : (u > hi ? hi : u); }
+
+} // namespace astc_cpu
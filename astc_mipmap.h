@@ -0,0 +1,389 @@
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "astc_encode_cpu.h"
+
+/**
+ * Mip chains and texture arrays of the cpu backend, generated while the blocks are encoded.
+ * every level is filtered from the float texels of the level above it, srgb textures in linear light,
+ * and the job that encodes level N also filters level N + 1, so the downsampling hides behind the encoding.
+ * the layers of an array or a cubemap are encoded by the same jobs, their rows of blocks share one queue.
+ */
+namespace astc_cpu
+{
+
+// the levels of the full chain down to 1x1
+inline int mip_level_count(int width, int height)
+{
+	int levels = 1;
+	while (width > 1 || height > 1)
+	{
+		width = std::max(1, width / 2);
+		height = std::max(1, height / 2);
+		++levels;
+	}
+	return levels;
+}
+
+inline int mip_size(int size, int level)
+{
+	return std::max(1, size >> level);
+}
+
+inline float linear_to_srgb(float c)
+{
+	return (c <= 0.0031308f) ? c * 12.92f : 1.055f * std::pow(c, 1.0f / 2.4f) - 0.055f;
+}
+
+inline float sinc(float x)
+{
+	if (std::fabs(x) < 1e-6f)
+	{
+		return 1.0f;
+	}
+	x *= 3.14159265f;
+	return std::sin(x) / x;
+}
+
+// the modified bessel function of the first kind of order 0, the kaiser window
+inline float bessel_i0(float x)
+{
+	float sum = 1.0f;
+	float term = 1.0f;
+	for (int k = 1; k < 32 && term > sum * 1e-8f; ++k)
+	{
+		term *= (x * x) / (4.0f * k * k);
+		sum += term;
+	}
+	return sum;
+}
+
+// half the width of the filter, in texels of the smaller level
+inline float mip_filter_support(mipmap_filter filter)
+{
+	return filter == MIP_FILTER_BOX ? 0.5f : 3.0f;
+}
+
+// the weight of a source texel "t" texels of the smaller level away from the center of the filter
+inline float mip_filter_weight(mipmap_filter filter, float t)
+{
+	const float support = mip_filter_support(filter);
+	switch (filter)
+	{
+	case MIP_FILTER_BOX:
+		return (t >= -0.5f && t < 0.5f) ? 1.0f : 0.0f;
+	case MIP_FILTER_KAISER:
+	{
+		const float alpha = 4.0f;
+		float r = t / support;
+		return (r * r < 1.0f) ? sinc(t) * bessel_i0(alpha * std::sqrt(1.0f - r * r)) / bessel_i0(alpha) : 0.0f;
+	}
+	case MIP_FILTER_LANCZOS:
+		return (std::fabs(t) < support) ? sinc(t) * sinc(t / support) : 0.0f;
+	default:
+		return 0.0f;
+	}
+}
+
+/**
+ * the source texels and the normalized weights of every texel of the smaller level along one axis.
+ * the texels past the edge repeat it.
+ */
+struct mip_taps
+{
+	std::vector<int> first;		// dst_size + 1 entries, the taps of texel i are first[i] to first[i + 1]
+	std::vector<int> index;
+	std::vector<float> weight;
+
+	mip_taps(mipmap_filter filter, int src_size, int dst_size)
+	{
+		const float scale = (float)src_size / (float)dst_size;
+		const float reach = mip_filter_support(filter) * scale;
+		first.push_back(0);
+		for (int i = 0; i < dst_size; ++i)
+		{
+			const float center = (i + 0.5f) * scale;
+			const int begin = (int)std::floor(center - reach - 0.5f);
+			const int end = (int)std::ceil(center + reach - 0.5f);
+			const size_t start = weight.size();
+			float sum = 0.0f;
+			for (int s = begin; s <= end; ++s)
+			{
+				float w = mip_filter_weight(filter, (s + 0.5f - center) / scale);
+				if (w != 0.0f)
+				{
+					index.push_back(std::min(std::max(s, 0), src_size - 1));
+					weight.push_back(w);
+					sum += w;
+				}
+			}
+			for (size_t k = start; k < weight.size(); ++k)
+			{
+				weight[k] /= sum;
+			}
+			first.push_back((int)weight.size());
+		}
+	}
+};
+
+/**
+ * one level of the chain: its float texels, in the 0-255 scale of texel_lut for ldr,
+ * and for ldr the bytes the encoder reads, in the color space of the source.
+ */
+struct mip_level
+{
+	int width;
+	int height;
+	std::vector<float> texels;
+	std::vector<uint8_t> rgba;
+};
+
+// the texels a level is filtered from, the caller's image for level 1 and a mip_level after that
+struct mip_source
+{
+	const uint8_t* bytes;		// ldr level 0, read through "lut"
+	const float* floats;
+	int row_stride;
+	const texel_lut* lut;
+};
+
+// acc += w * row "y" of "src"
+inline void accumulate_mip_row(const mip_source& src, int width, int y, float w, float* acc)
+{
+	if (src.bytes != nullptr)
+	{
+		const uint8_t* p = src.bytes + (ptrdiff_t)y * src.row_stride;
+		for (int x = 0; x < width; ++x, p += 4, acc += 4)
+		{
+			acc[0] += w * src.lut->value[p[0]];
+			acc[1] += w * src.lut->value[p[1]];
+			acc[2] += w * src.lut->value[p[2]];
+			acc[3] += w * src.lut->alpha[p[3]];
+		}
+		return;
+	}
+	const float* p = (const float*)((const uint8_t*)src.floats + (ptrdiff_t)y * src.row_stride);
+	for (int i = 0; i < width * 4; ++i)
+	{
+		acc[i] += w * p[i];
+	}
+}
+
+// float 0-255 back to the byte the lut of "cfg" reads as it, the alpha byte is left to the caller
+inline void quantize_mip_texel(const kernel_config& cfg, const float* texel, uint8_t* rgba)
+{
+	for (int c = 0; c < 3; ++c)
+	{
+		float v = cfg.srgb ? linear_to_srgb(texel[c] / 255.0f) * 255.0f : texel[c];
+		rgba[c] = (uint8_t)std::min(std::max(v + 0.5f, 0.0f), 255.0f);
+	}
+}
+
+/**
+ * filter the row "y" of "dst" out of "src": the source rows of the vertical taps are summed first,
+ * then the horizontal taps run over that one row. the ldr texels are clamped to 0-255, the hdr ones to >= 0
+ * against the negative lobes of the windowed sincs.
+ */
+inline void filter_mip_row(const kernel_config& cfg, const mip_source& src, int src_width, const mip_taps& taps_x, const mip_taps& taps_y, int y, bool quantize_alpha, mip_level& dst)
+{
+	std::vector<float> row((size_t)src_width * 4, 0.0f);
+	for (int k = taps_y.first[y]; k < taps_y.first[y + 1]; ++k)
+	{
+		accumulate_mip_row(src, src_width, taps_y.index[k], taps_y.weight[k], row.data());
+	}
+
+	const float upper = cfg.hdr ? 65504.0f : 255.0f;
+	for (int x = 0; x < dst.width; ++x)
+	{
+		float sum[4] = { 0.0f, 0.0f, 0.0f, 0.0f };
+		for (int k = taps_x.first[x]; k < taps_x.first[x + 1]; ++k)
+		{
+			const float* p = &row[(size_t)taps_x.index[k] * 4];
+			const float w = taps_x.weight[k];
+			for (int c = 0; c < 4; ++c)
+			{
+				sum[c] += w * p[c];
+			}
+		}
+		float* texel = &dst.texels[((size_t)y * dst.width + x) * 4];
+		for (int c = 0; c < 4; ++c)
+		{
+			texel[c] = std::min(std::max(sum[c], 0.0f), upper);
+		}
+		if (!cfg.hdr)
+		{
+			uint8_t* rgba = &dst.rgba[((size_t)y * dst.width + x) * 4];
+			quantize_mip_texel(cfg, texel, rgba);
+			if (quantize_alpha)
+			{
+				rgba[3] = (uint8_t)(texel[3] + 0.5f);
+			}
+		}
+	}
+}
+
+/**
+ * the scale of the alpha of "level" that makes as many of its texels pass "reference" (0-255) as "coverage" says.
+ * the threshold is put halfway between the last texel that should pass and the first one that should not.
+ */
+inline float alpha_coverage_scale(const mip_level& level, float reference, float coverage)
+{
+	const size_t count = (size_t)level.width * level.height;
+	std::vector<float> alpha(count);
+	for (size_t i = 0; i < count; ++i)
+	{
+		alpha[i] = level.texels[i * 4 + 3];
+	}
+	const size_t pass = (size_t)std::min(std::max(coverage * count + 0.5f, 0.0f), (float)count);
+	std::sort(alpha.begin(), alpha.end(), [](float a, float b) { return a > b; });
+	float threshold;
+	if (pass == 0)
+	{
+		threshold = alpha[0];
+	}
+	else if (pass == count)
+	{
+		threshold = alpha[count - 1] * 0.5f;
+	}
+	else
+	{
+		threshold = (alpha[pass - 1] + alpha[pass]) * 0.5f;
+	}
+	return threshold > 0.0f ? reference / threshold : 1.0f;
+}
+
+inline const uint8_t* mip_encoder_texels(const mip_level& level, const uint8_t*)
+{
+	return level.rgba.data();
+}
+
+inline const float* mip_encoder_texels(const mip_level& level, const float*)
+{
+	return level.texels.data();
+}
+
+} // namespace astc_cpu
+
+/**
+ * encode "layer_count" images of the same size and row stride, the layers of an array or the faces of a cubemap,
+ * and with a filter the mip chain of each. they are rgba8 images or the rgba32f ones of an hdr option.
+ * the output is level major, then layer, each image in the layout of encode_astc_cpu(): the order of a ktx file.
+ * the job of level N runs the rows of blocks of every layer and then the rows of level N + 1 of every layer in one
+ * parallel_for, so the layers share one queue and the filter rows fill the threads that run out of blocks.
+ * "alpha_coverage" is the alpha reference (0-1) of an ldr alpha tested texture, 0 leaves the filtered alpha as it is.
+ */
+template <typename T>
+inline void encode_astc_layers_cpu(thread_pool& pool, const astc_cpu::encode_context& ctx, mipmap_filter filter, float alpha_coverage, const T* const* layers, int layer_count, int width, int height, int row_stride, uint8_t* out_blocks)
+{
+	using namespace astc_cpu;
+
+	const kernel_config& cfg = ctx.cfg;
+	const int levels = (filter == MIP_FILTER_NONE) ? 1 : mip_level_count(width, height);
+	const bool keep_coverage = alpha_coverage > 0.0f && !cfg.hdr;
+	const float reference = alpha_coverage * 255.0f;
+
+	std::vector<float> coverage(layer_count, 0.0f);
+	if (keep_coverage && levels > 1)
+	{
+		pool.parallel_for(layer_count, [&](int layer) {
+			size_t pass = 0;
+			for (int y = 0; y < height; ++y)
+			{
+				const uint8_t* p = (const uint8_t*)layers[layer] + (ptrdiff_t)y * row_stride;
+				for (int x = 0; x < width; ++x)
+				{
+					pass += (ctx.lut.alpha[p[x * 4 + 3]] > reference) ? 1 : 0;
+				}
+			}
+			coverage[layer] = (float)pass / ((float)width * height);
+		});
+	}
+
+	// per layer, the level being encoded and the one being filtered, swapped after every job
+	std::vector<mip_level> chains((size_t)layer_count * 2);
+	std::vector<mip_source> sources(layer_count);
+	std::vector<const T*> texels(layers, layers + layer_count);
+	int stride = row_stride;
+	for (int level = 0; level < levels; ++level)
+	{
+		const int level_width = mip_size(width, level);
+		const int level_height = mip_size(height, level);
+		const int xBlockNum = (level_width + cfg.dim_x - 1) / cfg.dim_x;
+		const int yBlockNum = (level_height + cfg.dim_y - 1) / cfg.dim_y;
+		const size_t layer_bytes = (size_t)xBlockNum * yBlockNum * BLOCK_BYTES;
+
+		const bool filter_next = level + 1 < levels;
+		const int next_width = filter_next ? mip_size(width, level + 1) : 1;
+		const int next_height = filter_next ? mip_size(height, level + 1) : 1;
+		const int next_rows = filter_next ? next_height : 0;
+		for (int layer = 0; filter_next && layer < layer_count; ++layer)
+		{
+			const mip_level* src = (level == 0) ? nullptr : &chains[layer * 2 + ((level - 1) & 1)];
+			mip_level& dst = chains[layer * 2 + (level & 1)];
+			dst.width = next_width;
+			dst.height = next_height;
+			dst.texels.resize((size_t)next_width * next_height * 4);
+			dst.rgba.resize(cfg.hdr ? 0 : (size_t)next_width * next_height * 4);
+
+			mip_source& source = sources[layer];
+			source = mip_source();
+			if (src == nullptr && !cfg.hdr)
+			{
+				source.bytes = (const uint8_t*)layers[layer];
+				source.lut = &ctx.lut;
+				source.row_stride = row_stride;
+			}
+			else
+			{
+				source.floats = (src == nullptr) ? (const float*)layers[layer] : src->texels.data();
+				source.row_stride = (src == nullptr) ? row_stride : level_width * 16;
+			}
+		}
+		const mip_taps taps_x(filter, level_width, next_width);
+		const mip_taps taps_y(filter, level_height, next_height);
+
+		const int encode_tasks = layer_count * yBlockNum;
+		pool.parallel_for(encode_tasks + layer_count * next_rows, [&](int task) {
+			if (task < encode_tasks)
+			{
+				const int layer = task / yBlockNum;
+				encode_block_row(ctx, texels[layer], level_width, level_height, stride, task % yBlockNum, out_blocks + layer * layer_bytes);
+			}
+			else
+			{
+				const int layer = (task - encode_tasks) / next_rows;
+				mip_level& dst = chains[layer * 2 + (level & 1)];
+				filter_mip_row(cfg, sources[layer], level_width, taps_x, taps_y, (task - encode_tasks) % next_rows, !keep_coverage, dst);
+			}
+		});
+
+		out_blocks += layer_bytes * layer_count;
+		if (!filter_next)
+		{
+			break;
+		}
+
+		if (keep_coverage)
+		{
+			pool.parallel_for(layer_count, [&](int layer) {
+				mip_level& dst = chains[layer * 2 + (level & 1)];
+				const float scale = alpha_coverage_scale(dst, reference, coverage[layer]);
+				const size_t count = (size_t)dst.width * dst.height;
+				for (size_t i = 0; i < count; ++i)
+				{
+					dst.rgba[i * 4 + 3] = (uint8_t)std::min(dst.texels[i * 4 + 3] * scale + 0.5f, 255.0f);
+				}
+			});
+		}
+		for (int layer = 0; layer < layer_count; ++layer)
+		{
+			texels[layer] = mip_encoder_texels(chains[layer * 2 + (level & 1)], layers[layer]);
+		}
+		stride = next_width * 4 * (int)sizeof(T);
+	}
+}
@@ -0,0 +1,93 @@
+#pragma once
+
+#include "astc_cpu_feature.h"
+
+#define BLOCK_BYTES		16
+
+// most previous blocks the rate-distortion pass looks back for bytes to repeat
+#define RDO_MAX_WINDOW	64
+
+// thread group size of the compute shader backends
+#define THREAD_NUM_X	8
+#define THREAD_NUM_Y	8
+
+// the 2d block footprints of the astc spec, and its cubic 3d ones when "z" is not 1
+inline bool is_astc_footprint(int x, int y, int z = 1)
+{
+	if (z != 1)
+	{
+		return x == y && y == z && z >= 3 && z <= 6;
+	}
+	static const int footprints[14][2] = {
+		{ 4, 4 }, { 5, 4 }, { 5, 5 }, { 6, 5 }, { 6, 6 }, { 8, 5 }, { 8, 6 },
+		{ 8, 8 }, { 10, 5 }, { 10, 6 }, { 10, 8 }, { 10, 10 }, { 12, 10 }, { 12, 12 },
+	};
+	for (int i = 0; i < 14; ++i)
+	{
+		if (footprints[i][0] == x && footprints[i][1] == y)
+		{
+			return true;
+		}
+	}
+	return false;
+}
+
+// the downsampling filter of the mip chain, MIP_FILTER_NONE encodes level 0 only
+enum mipmap_filter
+{
+	MIP_FILTER_NONE,
+	MIP_FILTER_BOX,		// the average of the texels under the smaller texel, 2x2 for an even size
+	MIP_FILTER_KAISER,	// kaiser windowed sinc, 3 texels of the smaller level each way, alpha 4
+	MIP_FILTER_LANCZOS,	// lanczos 3
+};
+
+struct encode_option
+{
+	int block_x;		// block footprint, one of is_astc_footprint()
+	int block_y;
+	int block_z;		// 1 for the 2d footprints
+	bool is_normal_map;
+	bool has_alpha;
+	bool srgb;
+	bool use_cpu;		// encode with the portable cpu backend instead of d3d11
+	bool use_vulkan;	// encode with the vulkan compute backend, needs a build with ASTC_VULKAN
+	bool use_opencl;	// encode with the opencl backend, needs a build with ASTC_OPENCL
+	int thread_count;	// worker threads of the cpu backend, 0 means all cores
+	simd_isa max_simd_isa;	// widest simd kernel the cpu backend may use
+	int effort;			// quant method pairs tried besides the fast one, 0 is the fixed fast blockmode
+	bool dual_plane;	// let blocks put their least correlated channel on a second weight plane
+	int void_extent_tolerance;	// blocks whose channels span at most this many 8 bit steps become one color void-extent blocks
+	bool hdr;			// float texels, encoded with the hdr endpoint modes
+	mipmap_filter mip_filter;	// filter of the mip chain of astc_encoder::encode_mipmaps(), srgb textures are filtered in linear light
+	float alpha_coverage;	// 0 or the alpha reference (0-1) whose coverage every ldr mip level keeps, for alpha tested textures
+	float rdo_lambda;	// 0 or the mean squared error (0-255 texels) a block may gain per byte of it a lz compressor can drop, cpu backend, 2d ldr only
+	int rdo_window;		// previous blocks of the row the rate-distortion pass repeats bytes of, at most RDO_MAX_WINDOW
+	encode_option() : block_x(4)
+		, block_y(4)
+		, block_z(1)
+		, is_normal_map(false)
+		, has_alpha(false)
+		, srgb(false)
+#ifdef _WIN32
+		, use_cpu(false)
+#else
+		, use_cpu(true)
+#endif
+		, use_vulkan(false)
+		, use_opencl(false)
+		, thread_count(0)
+		, max_simd_isa(SIMD_ISA_AUTO)
+		, effort(0)
+		, dual_plane(false)
+		, void_extent_tolerance(0)
+		, hdr(false)
+		, mip_filter(MIP_FILTER_NONE)
+		, alpha_coverage(0.0f)
+		, rdo_lambda(0.0f)
+		, rdo_window(8)
+	{
+	}
+
+	// the simd kernels of the cpu backend only implement the fixed fast blockmode of 2d ldr blocks
+	bool fast_blockmode() const { return effort == 0 && !dual_plane && !hdr && block_z == 1; }
+};
@@ -1,5 +1,9 @@
 #pragma once
 
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+
 #define MAGIC_FILE_CONSTANT 0x5CA1AB13
 
 struct astc_header
@@ -13,6 +17,7 @@ struct astc_header
 	uint8_t zsize[3];			// block count is inferred
 };
 
+#ifdef _WIN32
 //--------------------------------------------------------------------------------------
 // Create a CPU accessible buffer and download the content of a GPU buffer into it
 //-------------------------------------------------------------------------------------- 
@@ -48,8 +53,9 @@ HRESULT read_gpu(ID3D11Device* pd3dDevice, ID3D11DeviceContext* pDeviceContext,
 	pDeviceContext->Unmap(pReadbackbuf, 0);
 	return S_OK;
 }
+#endif
 
-void save_astc(const char* astc_path, int xdim, int ydim, int xsize, int ysize, uint8_t* buffer, int bufsz)
+void save_astc(const char* astc_path, int xdim, int ydim, int zdim, int xsize, int ysize, int zsize, uint8_t* buffer, int bufsz)
 {
 	astc_header hdr;
 	hdr.magic[0] = MAGIC_FILE_CONSTANT & 0xFF;
@@ -58,16 +64,16 @@ void save_astc(const char* astc_path, int xdim, int ydim, int xsize, int ysize,
 	hdr.magic[3] = (MAGIC_FILE_CONSTANT >> 24) & 0xFF;
 	hdr.blockdim_x = xdim;
 	hdr.blockdim_y = ydim;
-	hdr.blockdim_z = 1;
+	hdr.blockdim_z = zdim;
 	hdr.xsize[0] = xsize & 0xFF;
 	hdr.xsize[1] = (xsize >> 8) & 0xFF;
 	hdr.xsize[2] = (xsize >> 16) & 0xFF;
 	hdr.ysize[0] = ysize & 0xFF;
 	hdr.ysize[1] = (ysize >> 8) & 0xFF;
 	hdr.ysize[2] = (ysize >> 16) & 0xFF;
-	hdr.zsize[0] = 1;
-	hdr.zsize[1] = 0;
-	hdr.zsize[2] = 0;
+	hdr.zsize[0] = zsize & 0xFF;
+	hdr.zsize[1] = (zsize >> 8) & 0xFF;
+	hdr.zsize[2] = (zsize >> 16) & 0xFF;
 
 	FILE *wf = fopen(astc_path, "wb");
 	fwrite(&hdr, 1, sizeof(astc_header), wf);
@@ -75,3 +81,61 @@ void save_astc(const char* astc_path, int xdim, int ydim, int xsize, int ysize,
 	fclose(wf);
 }
 
+
+// the ktx internal format of a 2d footprint, GL_COMPRESSED_RGBA_ASTC_4x4_KHR (0x93B0) to GL_COMPRESSED_RGBA_ASTC_12x12_KHR (0x93BD)
+uint32_t ktx_astc_format(int xdim, int ydim)
+{
+	static const int footprints[14][2] = {
+		{ 4, 4 }, { 5, 4 }, { 5, 5 }, { 6, 5 }, { 6, 6 }, { 8, 5 }, { 8, 6 },
+		{ 8, 8 }, { 10, 5 }, { 10, 6 }, { 10, 8 }, { 10, 10 }, { 12, 10 }, { 12, 12 },
+	};
+	for (uint32_t i = 0; i < 14; ++i) {
+		if (footprints[i][0] == xdim && footprints[i][1] == ydim) {
+			return 0x93B0 + i;
+		}
+	}
+	return 0x93B0;
+}
+
+/**
+ * Save a ktx 1.1 file of "mip_levels" levels of a 2d astc texture, "buffer" holds the levels back to back from level 0,
+ * each level max(1, size >> level) texels wide and high. the .astc header has no room for the other levels.
+ * a level holds "array_layers" (0 for a single texture) times "faces" (6 for a cubemap) images, array layer major.
+ */
+void save_ktx(const char* ktx_path, int xdim, int ydim, int xsize, int ysize, int mip_levels, int array_layers, int faces, uint8_t* buffer, size_t bufsz)
+{
+	const int images = (array_layers > 0 ? array_layers : 1) * faces;
+	static const uint8_t identifier[12] = { 0xAB, 'K', 'T', 'X', ' ', '1', '1', 0xBB, '\r', '\n', 0x1A, '\n' };
+	const uint32_t header[13] = {
+		0x04030201,						// endianness
+		0,								// glType, 0 for compressed textures
+		1,								// glTypeSize
+		0,								// glFormat
+		ktx_astc_format(xdim, ydim),	// glInternalFormat
+		0x1908,							// glBaseInternalFormat, GL_RGBA
+		(uint32_t)xsize,				// pixelWidth
+		(uint32_t)ysize,				// pixelHeight
+		0,								// pixelDepth
+		(uint32_t)array_layers,			// numberOfArrayElements
+		(uint32_t)faces,				// numberOfFaces
+		(uint32_t)mip_levels,			// numberOfMipmapLevels
+		0,								// bytesOfKeyValueData
+	};
+
+	FILE *wf = fopen(ktx_path, "wb");
+	fwrite(identifier, 1, sizeof(identifier), wf);
+	fwrite(header, 1, sizeof(header), wf);
+	size_t offset = 0;
+	for (int level = 0; level < mip_levels && offset < bufsz; ++level) {
+		int w = (xsize >> level) > 1 ? (xsize >> level) : 1;
+		int h = (ysize >> level) > 1 ? (ysize >> level) : 1;
+		// the blocks are 16 bytes, every face and level is already 4 byte aligned
+		uint32_t face_size = (uint32_t)(((w + xdim - 1) / xdim) * ((h + ydim - 1) / ydim) * 16);
+		// the size of one face for a cubemap that is not an array, of the whole level otherwise
+		uint32_t image_size = (faces == 6 && array_layers == 0) ? face_size : face_size * images;
+		fwrite(&image_size, 1, sizeof(image_size), wf);
+		fwrite(buffer + offset, 1, (size_t)face_size * images, wf);
+		offset += (size_t)face_size * images;
+	}
+	fclose(wf);
+}
@@ -0,0 +1,426 @@
+#pragma once
+
+/**
+ * The fast path of encode_block() written once for any simd width.
+ * S is an ISA description (see simd_avx2 in astc_vecmath_avx2.h) with
+ *	S::lanes, S::vfloat, S::vint, S::vmask
+ * S::load(), and the free functions store/min/max/sqrt/round_even/select/float_to_int/shl/shr/gather.
+ *
+ * Every lane follows the exact operation order of the functions in ASTC_BlockEncode.hlsl,
+ * so the blocks are bit-identical to the shader and the scalar path whatever the lane count is.
+ * Include this after astc_encode_cpu.h, it reuses the constants and tables of ASTC_Table.hlsl.
+ */
+
+template <typename S>
+struct simd_block_kernel
+{
+	typedef typename S::vfloat vfloat;
+	typedef typename S::vint vint;
+	typedef typename S::vmask vmask;
+
+	struct vtexel
+	{
+		vfloat v[4];
+	};
+
+	static vfloat dot(const vtexel& a, const vtexel& b)
+	{
+		return a.v[0] * b.v[0] + a.v[1] * b.v[1] + a.v[2] * b.v[2] + a.v[3] * b.v[3];
+	}
+
+	static vfloat clamp(vfloat f, vfloat lo, vfloat hi)
+	{
+		return select(select(f, hi, f > hi), lo, f < lo);
+	}
+
+	// v = mul(m, v), m is symmetric so only 10 entries are kept
+	static vtexel mul(const vfloat cov[4][4], const vtexel& v)
+	{
+		vtexel r;
+		for (int i = 0; i < 4; ++i)
+		{
+			r.v[i] = cov[i][0] * v.v[0] + cov[i][1] * v.v[1] + cov[i][2] * v.v[2] + cov[i][3] * v.v[3];
+		}
+		return r;
+	}
+
+	// r = mul(m, m), the matrix product of the shim
+	static void square(const vfloat m[4][4], vfloat r[4][4])
+	{
+		for (int i = 0; i < 4; ++i)
+		{
+			for (int j = 0; j < 4; ++j)
+			{
+				r[i][j] = m[i][0] * m[0][j] + m[i][1] * m[1][j] + m[i][2] * m[2][j] + m[i][3] * m[3][j];
+			}
+		}
+	}
+
+	static vtexel eigen_vector(const vfloat cov[4][4])
+	{
+		const vfloat small_value(SMALL_VALUE);
+		const vfloat converged(EIGEN_CONVERGED);
+
+		// lanes of a flat block take the fixed axis at the end
+		vfloat trace = cov[0][0] + cov[1][1] + cov[2][2] + cov[3][3];
+		vmask flat = trace < small_value;
+
+		vfloat m[4][4];
+		for (int i = 0; i < 4; ++i)
+		{
+			for (int j = 0; j < 4; ++j)
+			{
+				m[i][j] = cov[i][j] / trace;
+			}
+		}
+		vfloat m2[4][4];
+		vfloat m4[4][4];
+		square(m, m2);
+		square(m2, m4);
+
+		vtexel v;
+		vfloat largest = m2[0][0];
+		for (int c = 0; c < 4; ++c)
+		{
+			v.v[c] = m2[0][c];
+		}
+		for (int r = 1; r < 4; ++r)
+		{
+			vmask larger = m2[r][r] > largest;
+			largest = select(largest, m2[r][r], larger);
+			for (int c = 0; c < 4; ++c)
+			{
+				v.v[c] = select(v.v[c], m2[r][c], larger);
+			}
+		}
+		vfloat vlen = sqrt(dot(v, v));
+		for (int c = 0; c < 4; ++c)
+		{
+			v.v[c] = v.v[c] / vlen;
+		}
+
+		// lanes that stopped keep their vector, like the breaks of the loop
+		vmask done = flat;
+		for (int i = 0; i < EIGEN_ITERATIONS; ++i)
+		{
+			vtexel w = mul(m4, v);
+			vfloat len = sqrt(dot(w, w));
+			vmask small = len < small_value;
+			for (int c = 0; c < 4; ++c)
+			{
+				w.v[c] = w.v[c] / len;
+			}
+			vfloat cosine = dot(w, v);
+			vmask keep = done | small;
+			for (int c = 0; c < 4; ++c)
+			{
+				v.v[c] = select(w.v[c], v.v[c], keep);
+			}
+			done = keep | (cosine > converged);
+		}
+
+		const float axis[4] = { 0.57735f, 0.57735f, 0.57735f, 0.0f };
+		for (int c = 0; c < 4; ++c)
+		{
+			v.v[c] = select(v.v[c], vfloat(axis[c]), flat);
+		}
+		return v;
+	}
+
+	static void principal_component_analysis(const simd_kernel_params& p, const float* soa, vtexel& e0, vtexel& e1)
+	{
+		const int lanes = S::lanes;
+		const int block_size = p.dim_x * p.dim_y;
+
+		vtexel mean;
+		for (int c = 0; c < 4; ++c)
+		{
+			mean.v[c] = vfloat(0.0f);
+		}
+		for (int i = 0; i < block_size; ++i)
+		{
+			for (int c = 0; c < 4; ++c)
+			{
+				mean.v[c] = mean.v[c] + S::load(soa + (i * 4 + c) * lanes);
+			}
+		}
+		const vfloat count((float)block_size);
+		for (int c = 0; c < 4; ++c)
+		{
+			mean.v[c] = mean.v[c] / count;
+		}
+
+		vfloat cov[4][4];
+		for (int i = 0; i < 4; ++i)
+		{
+			for (int j = i; j < 4; ++j)
+			{
+				cov[i][j] = vfloat(0.0f);
+			}
+		}
+		for (int k = 0; k < block_size; ++k)
+		{
+			vtexel t;
+			for (int c = 0; c < 4; ++c)
+			{
+				t.v[c] = S::load(soa + (k * 4 + c) * lanes) - mean.v[c];
+			}
+			for (int i = 0; i < 4; ++i)
+			{
+				for (int j = i; j < 4; ++j)
+				{
+					cov[i][j] = cov[i][j] + t.v[i] * t.v[j];
+				}
+			}
+		}
+		const vfloat count_1((float)(block_size - 1));
+		for (int i = 0; i < 4; ++i)
+		{
+			for (int j = i; j < 4; ++j)
+			{
+				cov[i][j] = cov[i][j] / count_1;
+				cov[j][i] = cov[i][j];
+			}
+		}
+
+		vtexel vec_k = eigen_vector(cov);
+
+		// find_min_max
+		vfloat a(1e31f);
+		vfloat b(-1e31f);
+		for (int i = 0; i < block_size; ++i)
+		{
+			vtexel t;
+			for (int c = 0; c < 4; ++c)
+			{
+				t.v[c] = S::load(soa + (i * 4 + c) * lanes) - mean.v[c];
+			}
+			vfloat d = dot(t, vec_k);
+			a = min(a, d);
+			b = max(b, d);
+		}
+
+		const vfloat zero(0.0f);
+		const vfloat full(255.0f);
+		for (int c = 0; c < 4; ++c)
+		{
+			e0.v[c] = clamp(vec_k.v[c] * a + mean.v[c], zero, full);
+			e1.v[c] = clamp(vec_k.v[c] * b + mean.v[c], zero, full);
+		}
+
+		// make the first endpoint the darkest one
+		vfloat s0 = round_even(e0.v[0]) + round_even(e0.v[1]) + round_even(e0.v[2]);
+		vfloat s1 = round_even(e1.v[0]) + round_even(e1.v[1]) + round_even(e1.v[2]);
+		vmask flip = s0 > s1;
+		for (int c = 0; c < 4; ++c)
+		{
+			vfloat t = e0.v[c];
+			e0.v[c] = select(e0.v[c], e1.v[c], flip);
+			e1.v[c] = select(e1.v[c], t, flip);
+		}
+
+		if (!p.has_alpha)
+		{
+			e0.v[3] = full;
+			e1.v[3] = full;
+		}
+	}
+
+	static void calculate_quantized_weights(const simd_kernel_params& p, const float* soa, const vtexel& ep0, const vtexel& ep1, int weight_range, vint weights[X_GRIDS * Y_GRIDS])
+	{
+		const int lanes = S::lanes;
+
+		vtexel vec_k;
+		for (int c = 0; c < 4; ++c)
+		{
+			vec_k.v[c] = ep1.v[c] - ep0.v[c];
+		}
+		vfloat len = sqrt(dot(vec_k, vec_k));
+		vmask degenerate = len < vfloat(SMALL_VALUE);
+		for (int c = 0; c < 4; ++c)
+		{
+			vec_k.v[c] = vec_k.v[c] / len;
+		}
+
+		vfloat projw[X_GRIDS * Y_GRIDS];
+		vfloat minw(1e31f);
+		vfloat maxw(-1e31f);
+		for (int i = 0; i < X_GRIDS * Y_GRIDS; ++i)
+		{
+			vtexel sum;
+			if (p.decimated)
+			{
+				const unsigned int* idx = p.grid_index[i];
+				const float* coff = p.grid_coff[i];
+				for (int c = 0; c < 4; ++c)
+				{
+					sum.v[c] = S::load(soa + (idx[0] * 4 + c) * lanes) * vfloat(coff[0]);
+					sum.v[c] = sum.v[c] + S::load(soa + (idx[1] * 4 + c) * lanes) * vfloat(coff[1]);
+					sum.v[c] = sum.v[c] + S::load(soa + (idx[2] * 4 + c) * lanes) * vfloat(coff[2]);
+					sum.v[c] = sum.v[c] + S::load(soa + (idx[3] * 4 + c) * lanes) * vfloat(coff[3]);
+				}
+			}
+			else
+			{
+				for (int c = 0; c < 4; ++c)
+				{
+					sum.v[c] = S::load(soa + (i * 4 + c) * lanes);
+				}
+			}
+			for (int c = 0; c < 4; ++c)
+			{
+				sum.v[c] = sum.v[c] - ep0.v[c];
+			}
+			vfloat w = dot(vec_k, sum);
+			minw = min(w, minw);
+			maxw = max(w, maxw);
+			projw[i] = w;
+		}
+
+		vfloat invlen = max(vfloat(SMALL_VALUE), maxw - minw);
+		invlen = vfloat(1.0f) / invlen;
+
+		const vfloat range((float)weight_range);
+		const vint range_i(weight_range);
+		const vfloat zero(0.0f);
+		for (int i = 0; i < X_GRIDS * Y_GRIDS; ++i)
+		{
+			vfloat w = select((projw[i] - minw) * invlen, zero, degenerate);
+			weights[i] = min(float_to_int(round_even(w * range)), range_i);
+		}
+	}
+
+	// orbits8_ptr with a bit position that is the same for all lanes
+	static void orbits(vint outputs[4], int& bitoffset, vint number, int bitcount)
+	{
+		int newpos = bitoffset + bitcount;
+		int nidx = newpos >> 5;
+		int uidx = bitoffset >> 5;
+		int bit_idx = bitoffset & 31;
+
+		outputs[uidx] = outputs[uidx] | shl(number, bit_idx);
+		if (nidx > uidx)
+		{
+			outputs[uidx + 1] = outputs[uidx + 1] | shr(number, 32 - bit_idx);
+		}
+		bitoffset = newpos;
+	}
+
+	static void encode_trits(int bitcount, const vint* b, vint outputs[4], int& outpos)
+	{
+		const vint low_mask((1 << bitcount) - 1);
+		vint m[5];
+		vint t[5];
+		for (int i = 0; i < 5; ++i)
+		{
+			m[i] = b[i] & low_mask;
+			t[i] = shr(b[i], bitcount);
+		}
+
+		vint index = t[4] * vint(81) + t[3] * vint(27) + t[2] * vint(9) + t[1] * vint(3) + t[0];
+		vint packhigh = gather(astc_cpu::integer_from_trits, index);
+
+		orbits(outputs, outpos, m[0], bitcount);
+		orbits(outputs, outpos, packhigh & vint(3), 2);
+
+		orbits(outputs, outpos, m[1], bitcount);
+		orbits(outputs, outpos, shr(packhigh, 2) & vint(3), 2);
+
+		orbits(outputs, outpos, m[2], bitcount);
+		orbits(outputs, outpos, shr(packhigh, 4) & vint(1), 1);
+
+		orbits(outputs, outpos, m[3], bitcount);
+		orbits(outputs, outpos, shr(packhigh, 5) & vint(3), 2);
+
+		orbits(outputs, outpos, m[4], bitcount);
+		orbits(outputs, outpos, shr(packhigh, 7) & vint(1), 1);
+	}
+
+	// bise_weights for the trit ranges of the fast path (QUANT_6 and QUANT_12)
+	static void bise_weights(const vint numbers[X_GRIDS * Y_GRIDS], int bits, vint outputs[4])
+	{
+		int bitpos = 0;
+		vint group[5];
+		for (int g = 0; g < X_GRIDS * Y_GRIDS; g += 5)
+		{
+			for (int i = 0; i < 5; ++i)
+			{
+				group[i] = (g + i < X_GRIDS * Y_GRIDS) ? numbers[g + i] : vint(0);
+			}
+			encode_trits(bits, group, outputs, bitpos);
+		}
+	}
+
+	// reverse_byte() of the 4 bytes and swapping them is a 32 bit reverse
+	static vint reverse_bits(vint x)
+	{
+		x = (shr(x, 1) & vint(0x55555555)) | shl(x & vint(0x55555555), 1);
+		x = (shr(x, 2) & vint(0x33333333)) | shl(x & vint(0x33333333), 2);
+		x = (shr(x, 4) & vint(0x0F0F0F0F)) | shl(x & vint(0x0F0F0F0F), 4);
+		x = (shr(x, 8) & vint(0x00FF00FF)) | shl(x & vint(0x00FF00FF), 8);
+		x = shr(x, 16) | shl(x, 16);
+		return x;
+	}
+
+	static void encode_blocks(const simd_kernel_params& p, const float* soa, uint8_t* out_blocks, int count)
+	{
+		vtexel ep0, ep1;
+		principal_component_analysis(p, soa, ep0, ep1);
+
+		// for fast compression!
+		const int weight_quantmethod = p.has_alpha ? QUANT_6 : QUANT_12;
+		const int weight_range = p.has_alpha ? 6 : 12;
+		const int* scramble = astc_cpu::scramble_table + weight_quantmethod * WEIGHT_QUANTIZE_NUM;
+		const astc_cpu::uint blockmode = astc_cpu::assemble_blockmode(weight_quantmethod);
+		const astc_cpu::uint color_endpoint_mode = p.has_alpha ? CEM_LDR_RGBA_DIRECT : CEM_LDR_RGB_DIRECT;
+
+		// endpoint_ise: QUANT_256 is plain 8 bit packing
+		vint e0q[4], e1q[4];
+		for (int c = 0; c < 4; ++c)
+		{
+			e0q[c] = float_to_int(round_even(ep0.v[c]));
+			e1q[c] = float_to_int(round_even(ep1.v[c]));
+		}
+		vint ep_x = e0q[0] | shl(e1q[0], 8) | shl(e0q[1], 16) | shl(e1q[1], 24);
+		vint ep_y = e0q[2] | shl(e1q[2], 8);
+		if (p.has_alpha)
+		{
+			ep_y = ep_y | shl(e0q[3], 16) | shl(e1q[3], 24);
+		}
+
+		// weight_ise
+		vint weights[X_GRIDS * Y_GRIDS];
+		calculate_quantized_weights(p, soa, ep0, ep1, weight_range - 1, weights);
+		for (int i = 0; i < X_GRIDS * Y_GRIDS; ++i)
+		{
+			weights[i] = gather(scramble, weights[i]);
+		}
+		vint wt_ise[4] = { vint(0), vint(0), vint(0), vint(0) };
+		bise_weights(weights, astc_cpu::bits_trits_quints_table[weight_quantmethod * 3], wt_ise);
+
+		// assemble_block
+		vint phy[4];
+		phy[0] = vint((int)(blockmode | (color_endpoint_mode << 13))) | shl(ep_x & vint(0x7FFF), 17);
+		phy[1] = (shr(ep_x, 15) & vint(0x1FFFF)) | shl(ep_y & vint(0x7FFF), 17);
+		phy[2] = (shr(ep_y, 15) & vint(0x1FFFF)) | reverse_bits(wt_ise[1]);
+		phy[3] = reverse_bits(wt_ise[0]);
+
+		int words[4][SIMD_MAX_LANES];
+		for (int i = 0; i < 4; ++i)
+		{
+			store(words[i], phy[i]);
+		}
+		for (int lane = 0; lane < count; ++lane)
+		{
+			uint8_t* out = out_blocks + lane * BLOCK_BYTES;
+			for (int i = 0; i < 4; ++i)
+			{
+				unsigned int w = (unsigned int)words[i][lane];
+				out[i * 4 + 0] = (uint8_t)(w & 0xFF);
+				out[i * 4 + 1] = (uint8_t)((w >> 8) & 0xFF);
+				out[i * 4 + 2] = (uint8_t)((w >> 16) & 0xFF);
+				out[i * 4 + 3] = (uint8_t)((w >> 24) & 0xFF);
+			}
+		}
+	}
+};
@@ -0,0 +1,639 @@
+/**
+ * regenerates the "generated" tables the shader and the cpu backend include, next to this file or in the directory of argv[1]:
+ *   g++ -O2 -std=c++14 -ffp-contract=off astc_table_gen.cpp -o astc_table_gen && ./astc_table_gen
+ * ASTC_DecimationTable.hlsl: the weight grids of every footprint, "C.2.18 Weight Infill" and its pseudo-inverse,
+ * it prints what the truncation of the pseudo-inverse rows leaves of every grid that has longer rows.
+ * ASTC_PartitionTable.hlsl: the 2 partition patterns of every footprint, "C.2.21 Partition Pattern Generation".
+ * the arithmetic keeps the order the checked in tables were built with, a rerun on an unchanged footprint list writes the same bytes.
+ */
+#include <algorithm>
+#include <cctype>
+#include <cmath>
+#include <cstdarg>
+#include <cstdint>
+#include <cstdio>
+#include <set>
+#include <string>
+#include <vector>
+
+struct footprint
+{
+	int w;
+	int h;
+	int d;
+};
+
+// every footprint the shader has a permutation for, the 2d ones first
+static const footprint footprints[] =
+{
+	{ 4, 4, 1 }, { 5, 4, 1 }, { 5, 5, 1 }, { 6, 5, 1 }, { 6, 6, 1 }, { 8, 5, 1 }, { 8, 6, 1 }, { 8, 8, 1 },
+	{ 10, 5, 1 }, { 10, 6, 1 }, { 10, 8, 1 }, { 10, 10, 1 }, { 12, 10, 1 }, { 12, 12, 1 },
+	{ 3, 3, 3 }, { 4, 4, 4 }, { 5, 5, 5 }, { 6, 6, 6 },
+};
+
+struct tap4
+{
+	int idx[4];
+	double wt[4];
+};
+
+typedef std::vector<std::vector<double>> matrix;
+
+static std::string format(const char* fmt, ...)
+{
+	char buf[256];
+	va_list args;
+	va_start(args, fmt);
+	vsnprintf(buf, sizeof(buf), fmt, args);
+	va_end(args);
+	return buf;
+}
+
+static std::string join(const std::vector<std::string>& items, const char* sep)
+{
+	std::string out;
+	for (size_t i = 0; i < items.size(); ++i)
+	{
+		out += (i == 0 ? "" : sep) + items[i];
+	}
+	return out;
+}
+
+// "items" as the body of an array, "per" of them on a line
+static std::string rows(const std::vector<std::string>& items, size_t per)
+{
+	std::string out;
+	for (size_t k = 0; k < items.size(); k += per)
+	{
+		std::vector<std::string> line(items.begin() + k, items.begin() + std::min(items.size(), k + per));
+		out += "\t" + join(line, ", ") + ",\n";
+	}
+	return out;
+}
+
+// the weight grids of a footprint: 4x4, 5x5, 6x6 and 8x8 clamped to the block, 3x3x3 and 4x4x4 for the 3d ones
+static std::vector<footprint> grids(const footprint& f)
+{
+	std::vector<footprint> out;
+	static const int sizes_2d[] = { 4, 5, 6, 8 };
+	static const int sizes_3d[] = { 3, 4 };
+	const int* sizes = f.d > 1 ? sizes_3d : sizes_2d;
+	int count = f.d > 1 ? 2 : 4;
+	for (int k = 0; k < count; ++k)
+	{
+		footprint g = { std::min(f.w, sizes[k]), std::min(f.h, sizes[k]), f.d > 1 ? std::min(f.d, sizes[k]) : 1 };
+		bool seen = false;
+		for (const footprint& o : out)
+		{
+			seen |= (o.w == g.w && o.h == g.h && o.d == g.d);
+		}
+		if (!seen)
+		{
+			out.push_back(g);
+		}
+	}
+	return out;
+}
+
+// the bilinear taps of the texels around every grid weight, at the texel position the infill gives it
+static std::vector<tap4> decimation(const footprint& f, const footprint& g)
+{
+	std::vector<tap4> out;
+	for (int i = 0; i < g.w * g.h * g.d; ++i)
+	{
+		float u = (float)((double)((i % g.w) * (f.w - 1)) / (double)(g.w - 1));
+		float v = (float)((double)((i / g.w % g.h) * (f.h - 1)) / (double)(g.h - 1));
+		// 3d grids take the bilinear taps of the nearest texel slice
+		int zo = (g.d == 1) ? 0 : (int)((double)((i / (g.w * g.h)) * (f.d - 1)) / (double)(g.d - 1) + 0.5) * f.w * f.h;
+		int x0 = (int)u;
+		int y0 = (int)v;
+		int x1 = (x0 + 1 < f.w) ? x0 + 1 : x0;
+		int y1 = (y0 + 1 < f.h) ? y0 + 1 : y0;
+		float fx = u - x0;
+		float fy = v - y0;
+		float ox = 1.0f - fx;
+		float oy = 1.0f - fy;
+		tap4 t = { { zo + y0 * f.w + x0, zo + y0 * f.w + x1, zo + y1 * f.w + x0, zo + y1 * f.w + x1 },
+			{ ox * oy, fx * oy, ox * fy, fx * fy } };
+		out.push_back(t);
+	}
+	return out;
+}
+
+// the simplex interpolation of the 3d grids
+static std::vector<tap4> infill_3d(const footprint& f, const footprint& g)
+{
+	std::vector<tap4> out;
+	int ds = (1024 + f.w / 2) / (f.w - 1);
+	int dt = (1024 + f.h / 2) / (f.h - 1);
+	int dr = (1024 + f.d / 2) / (f.d - 1);
+	int N = g.w;
+	int NM = g.w * g.h;
+	for (int i = 0; i < f.w * f.h * f.d; ++i)
+	{
+		int s = i % f.w;
+		int t = i / f.w % f.h;
+		int r = i / (f.w * f.h);
+		int gs = (ds * s * (g.w - 1) + 32) >> 6;
+		int gt = (dt * t * (g.h - 1) + 32) >> 6;
+		int gr = (dr * r * (g.d - 1) + 32) >> 6;
+		int fs = gs & 15;
+		int ft = gt & 15;
+		int fp = gr & 15;
+		int v0 = (gs >> 4) + (gt >> 4) * N + (gr >> 4) * NM;
+		int cas = ((fs > ft) << 2) | ((ft > fp) << 1) | (fs > fp);
+		int s1, s2, ws[4];
+		switch (cas)
+		{
+		case 7: s1 = 1; s2 = N; ws[0] = 16 - fs; ws[1] = fs - ft; ws[2] = ft - fp; ws[3] = fp; break;
+		case 3: s1 = N; s2 = 1; ws[0] = 16 - ft; ws[1] = ft - fs; ws[2] = fs - fp; ws[3] = fp; break;
+		case 5: s1 = 1; s2 = NM; ws[0] = 16 - fs; ws[1] = fs - fp; ws[2] = fp - ft; ws[3] = ft; break;
+		case 4: s1 = NM; s2 = 1; ws[0] = 16 - fp; ws[1] = fp - fs; ws[2] = fs - ft; ws[3] = ft; break;
+		case 2: s1 = N; s2 = NM; ws[0] = 16 - ft; ws[1] = ft - fp; ws[2] = fp - fs; ws[3] = fs; break;
+		default: s1 = NM; s2 = N; ws[0] = 16 - fp; ws[1] = fp - ft; ws[2] = ft - fs; ws[3] = fs; break;
+		}
+		int q[4] = { v0, v0 + s1, v0 + s1 + s2, v0 + NM + N + 1 };
+		tap4 tap;
+		for (int k = 0; k < 4; ++k)
+		{
+			// taps with a 0 factor point at the first one, they never read past the grid
+			tap.idx[k] = (k == 0 || ws[k] > 0) ? q[k] : v0;
+			tap.wt[k] = ws[k] / 16.0;
+		}
+		out.push_back(tap);
+	}
+	return out;
+}
+
+// "C.2.18 Weight Infill": the grid weights of every texel and the decoder's integer factors divided by 16
+static std::vector<tap4> infill(const footprint& f, const footprint& g)
+{
+	if (f.d > 1)
+	{
+		return infill_3d(f, g);
+	}
+	std::vector<tap4> out;
+	int ds = (1024 + f.w / 2) / (f.w - 1);
+	int dt = (1024 + f.h / 2) / (f.h - 1);
+	for (int i = 0; i < f.w * f.h; ++i)
+	{
+		int s = i % f.w;
+		int t = i / f.w;
+		int gs = (ds * s * (g.w - 1) + 32) >> 6;
+		int gt = (dt * t * (g.h - 1) + 32) >> 6;
+		int fs = gs & 15;
+		int ft = gt & 15;
+		int v0 = (gs >> 4) + (gt >> 4) * g.w;
+		int w11 = (fs * ft + 8) >> 4;
+		int w10 = ft - w11;
+		int w01 = fs - w11;
+		int w00 = 16 - fs - ft + w11;
+		tap4 tap = { { v0, w01 > 0 ? v0 + 1 : v0, w10 > 0 ? v0 + g.w : v0, w11 > 0 ? v0 + g.w + 1 : v0 },
+			{ w00 / 16.0, w01 / 16.0, w10 / 16.0, w11 / 16.0 } };
+		out.push_back(tap);
+	}
+	return out;
+}
+
+// the texels x grid weights matrix of the infill
+static matrix infill_matrix(const footprint& f, const footprint& g)
+{
+	matrix m(f.w * f.h * f.d, std::vector<double>(g.w * g.h * g.d, 0.0));
+	std::vector<tap4> taps = infill(f, g);
+	for (size_t t = 0; t < taps.size(); ++t)
+	{
+		for (int k = 0; k < 4; ++k)
+		{
+			m[t][taps[t].idx[k]] += taps[t].wt[k];
+		}
+	}
+	return m;
+}
+
+// gauss-jordan with partial pivoting, the first of equal pivots
+static matrix inverse(const matrix& a)
+{
+	size_t n = a.size();
+	matrix m(n, std::vector<double>(2 * n, 0.0));
+	for (size_t i = 0; i < n; ++i)
+	{
+		std::copy(a[i].begin(), a[i].end(), m[i].begin());
+		m[i][n + i] = 1.0;
+	}
+	for (size_t c = 0; c < n; ++c)
+	{
+		size_t p = c;
+		for (size_t r = c + 1; r < n; ++r)
+		{
+			p = (std::fabs(m[r][c]) > std::fabs(m[p][c])) ? r : p;
+		}
+		std::swap(m[c], m[p]);
+		double pv = m[c][c];
+		for (double& x : m[c])
+		{
+			x /= pv;
+		}
+		for (size_t r = 0; r < n; ++r)
+		{
+			if (r != c && m[r][c] != 0.0)
+			{
+				double k = m[r][c];
+				for (size_t j = 0; j < 2 * n; ++j)
+				{
+					m[r][j] -= k * m[c][j];
+				}
+			}
+		}
+	}
+	for (std::vector<double>& row : m)
+	{
+		row.erase(row.begin(), row.begin() + n);
+	}
+	return m;
+}
+
+// (m^T m)^-1 m^T, the infill has full column rank so this is the moore-penrose pseudo-inverse
+static matrix pseudo_inverse(const matrix& m)
+{
+	size_t texels = m.size();
+	size_t n = m[0].size();
+	matrix a(n, std::vector<double>(n, 0.0));
+	for (size_t i = 0; i < n; ++i)
+	{
+		for (size_t j = 0; j < n; ++j)
+		{
+			for (size_t t = 0; t < texels; ++t)
+			{
+				a[i][j] += m[t][i] * m[t][j];
+			}
+		}
+	}
+	matrix ai = inverse(a);
+	matrix p(n, std::vector<double>(texels, 0.0));
+	for (size_t i = 0; i < n; ++i)
+	{
+		for (size_t t = 0; t < texels; ++t)
+		{
+			for (size_t j = 0; j < n; ++j)
+			{
+				p[i][t] += ai[i][j] * m[t][j];
+			}
+		}
+	}
+	return p;
+}
+
+// the taps of a row of the pseudo-inverse the shader keeps
+#define PSEUDO_INVERSE_TAPS 16
+
+// what the truncation to PSEUDO_INVERSE_TAPS leaves of the rows of a grid, over all its rows
+struct truncation
+{
+	double min_sum;		// the kept taps of a row, a full row sums to 1
+	double max_sum;
+	double min_abs;		// the part of the absolute weight of a row the kept taps hold
+};
+
+/**
+ * the PSEUDO_INVERSE_TAPS largest taps of every row, in texel order, as PSEUDO_INVERSE_TAPS / 4 tap4s per grid weight.
+ * the kept taps are the entries of the pseudo-inverse as they are, they are not rescaled after the truncation,
+ * so a truncated row no longer sums to 1. fit_grid_weights() corrects for the dropped taps with its residual passes.
+ */
+static std::vector<tap4> pseudo_inverse_taps(const footprint& f, const footprint& g, truncation& kept)
+{
+	matrix p = pseudo_inverse(infill_matrix(f, g));
+	std::vector<tap4> out;
+	kept.min_sum = 1e30;
+	kept.max_sum = -1e30;
+	kept.min_abs = 1.0;
+	for (const std::vector<double>& row : p)
+	{
+		std::vector<int> order(row.size());
+		for (size_t t = 0; t < row.size(); ++t)
+		{
+			order[t] = (int)t;
+		}
+		std::stable_sort(order.begin(), order.end(), [&](int a, int b) { return std::fabs(row[a]) > std::fabs(row[b]); });
+		order.resize(std::min(order.size(), (size_t)PSEUDO_INVERSE_TAPS));
+		std::sort(order.begin(), order.end());
+
+		std::vector<std::pair<int, double>> taps;
+		for (int t : order)
+		{
+			if (std::fabs(row[t]) > 1e-7)
+			{
+				taps.push_back(std::make_pair(t, row[t]));
+			}
+		}
+		double sum = 0.0;
+		double kept_abs = 0.0;
+		double row_abs = 0.0;
+		for (const std::pair<int, double>& t : taps)
+		{
+			sum += t.second;
+			kept_abs += std::fabs(t.second);
+		}
+		for (double v : row)
+		{
+			row_abs += std::fabs(v);
+		}
+		kept.min_sum = std::min(kept.min_sum, sum);
+		kept.max_sum = std::max(kept.max_sum, sum);
+		kept.min_abs = std::min(kept.min_abs, kept_abs / row_abs);
+
+		// a short row ends with 0 taps
+		taps.resize(PSEUDO_INVERSE_TAPS, std::make_pair(taps[0].first, 0.0));
+		for (int k = 0; k < PSEUDO_INVERSE_TAPS; k += 4)
+		{
+			tap4 t;
+			for (int j = 0; j < 4; ++j)
+			{
+				t.idx[j] = taps[k + j].first;
+				t.wt[j] = taps[k + j].second;
+			}
+			out.push_back(t);
+		}
+	}
+	return out;
+}
+
+// a float literal of the decimation and infill factors, exact for the float values they hold
+static std::string float_literal(double v)
+{
+	return (v == (double)(long long)v) ? format("%.1ff", v) : format("%.9gf", v);
+}
+
+// a float literal of the pseudo-inverse taps, 6 digits
+static std::string tap_literal(double v)
+{
+	if (v == 0.0)
+	{
+		return "0.0f";
+	}
+	return (v == (double)(long long)v) ? format("%.1ff", v) : format("%.6gf", v);
+}
+
+static std::string uint4_literal(const tap4& t)
+{
+	return format("uint4(%d, %d, %d, %d)", t.idx[0], t.idx[1], t.idx[2], t.idx[3]);
+}
+
+static std::string float4_literal(const tap4& t, std::string (*literal)(double))
+{
+	return "float4(" + literal(t.wt[0]) + ", " + literal(t.wt[1]) + ", " + literal(t.wt[2]) + ", " + literal(t.wt[3]) + ")";
+}
+
+static std::string array(const char* type, const std::string& name, const std::vector<std::string>& items, size_t per)
+{
+	return format("static const %s %s[%d] =\n{\n", type, name.c_str(), (int)items.size()) + rows(items, per) + "};";
+}
+
+static std::string decimation_table()
+{
+	std::vector<std::string> o;
+	o.push_back(
+		"// generated by astc_table_gen.cpp, the weight grids of every footprint and their \"C.2.18 Weight Infill\" tables.\n"
+		"//\tweight_grids_<w>x<h>: uint4(grid width, grid height, first decimation entry, first infill entry), the 4x4 grid first.\n"
+		"//\t\tthe 3d footprints put the 3x3x3 grid first, weight_grids_z_<w>x<h>x<d> holds the grid depths\n"
+		"//\tdecimation_*: the bilinear taps of the texels around every grid weight, at the texel position the infill gives it,\n"
+		"//\t\tin the nearest texel slice for the 3d grids\n"
+		"//\tinfill_*: the grid weights of every texel and their factors, the decoder's integer factors divided by 16.\n"
+		"//\t\tthe 3d grids take the 4 corners of the simplex interpolation.\n"
+		"//\t\ttaps with a 0 factor point at the first one, they never read past the grid.\n"
+		"//\tpseudo_inverse_*: the 16 largest taps of every row of the pseudo-inverse of the infill, 4 entries per grid weight\n"
+		"//\t\tfrom 4 * the first decimation entry. the texels of a row are in order, a short row ends with 0 taps.\n"
+		"//\t\tthe kept taps are not rescaled after the truncation, the residual passes of fit_grid_weights() make up for the rest.\n"
+		"#ifndef ASTC_DECIMATION_TABLE_HLSL\n"
+		"#define ASTC_DECIMATION_TABLE_HLSL\n");
+	for (const footprint& f : footprints)
+	{
+		std::vector<footprint> gl = grids(f);
+		std::string name = (f.d == 1) ? format("%dx%d", f.w, f.h) : format("%dx%dx%d", f.w, f.h, f.d);
+		std::string upper = name;
+		std::transform(upper.begin(), upper.end(), upper.begin(), ::toupper);
+
+		std::vector<std::string> grid_rows, grid_z, dec_idx, dec_wt, inf_idx, inf_wt, pin_idx, pin_wt;
+		int max_weights = 0;
+		for (const footprint& g : gl)
+		{
+			grid_rows.push_back(format("uint4(%d, %d, %d, %d)", g.w, g.h, (int)dec_idx.size(), (int)inf_idx.size()));
+			grid_z.push_back(format("%d", g.d));
+			max_weights = std::max(max_weights, g.w * g.h * g.d);
+			for (const tap4& t : decimation(f, g))
+			{
+				dec_idx.push_back(uint4_literal(t));
+				dec_wt.push_back(float4_literal(t, float_literal));
+			}
+			for (const tap4& t : infill(f, g))
+			{
+				inf_idx.push_back(uint4_literal(t));
+				inf_wt.push_back(float4_literal(t, float_literal));
+			}
+			truncation kept;
+			for (const tap4& t : pseudo_inverse_taps(f, g, kept))
+			{
+				pin_idx.push_back(uint4_literal(t));
+				pin_wt.push_back(float4_literal(t, tap_literal));
+			}
+			if (kept.min_abs < 1.0)
+			{
+				std::string grid = (g.d == 1) ? format("%dx%d", g.w, g.h) : format("%dx%dx%d", g.w, g.h, g.d);
+				printf("%s, grid %s: the kept taps of a row sum to %.3f ... %.3f and hold at least %.0f%% of its absolute weight\n",
+					name.c_str(), grid.c_str(), kept.min_sum, kept.max_sum, kept.min_abs * 100.0);
+			}
+		}
+
+		o.push_back("");
+		o.push_back(format("#define WEIGHT_GRID_COUNT_%s %d", upper.c_str(), (int)gl.size()));
+		o.push_back(format("#define MAX_GRID_WEIGHTS_%s %d", upper.c_str(), max_weights));
+		o.push_back("static const uint4 weight_grids_" + name + "[WEIGHT_GRID_COUNT_" + upper + "] = { " + join(grid_rows, ", ") + " };");
+		if (f.d > 1)
+		{
+			o.push_back("static const uint weight_grids_z_" + name + "[WEIGHT_GRID_COUNT_" + upper + "] = { " + join(grid_z, ", ") + " };");
+		}
+		o.push_back(array("uint4", "decimation_idx_" + name, dec_idx, 4));
+		o.push_back(array("float4", "decimation_wt_" + name, dec_wt, 2));
+		o.push_back(array("uint4", "infill_idx_" + name, inf_idx, 4));
+		o.push_back(array("float4", "infill_wt_" + name, inf_wt, 4));
+		o.push_back(array("uint4", "pseudo_inverse_idx_" + name, pin_idx, 4));
+		o.push_back(array("float4", "pseudo_inverse_wt_" + name, pin_wt, 2));
+	}
+	o.push_back("\n#endif // ASTC_DECIMATION_TABLE_HLSL\n");
+	return join(o, "\n");
+}
+
+// "C.2.21 Partition Pattern Generation", the partition of texel (x, y, z) of "seed"
+static int select_partition(int seed, int x, int y, int z, int partition_count, bool small_block)
+{
+	if (small_block)
+	{
+		x <<= 1;
+		y <<= 1;
+		z <<= 1;
+	}
+	seed += (partition_count - 1) * 1024;
+
+	uint32_t r = (uint32_t)seed;
+	r ^= r >> 15;
+	r *= 0xEEDE0891u;
+	r ^= r >> 5;
+	r += r << 16;
+	r ^= r >> 7;
+	r ^= r >> 3;
+	r ^= r << 6;
+	r ^= r >> 17;
+
+	int s[12];
+	for (int i = 0; i < 8; ++i)
+	{
+		s[i] = (r >> (4 * i)) & 0xF;
+	}
+	s[8] = (r >> 18) & 0xF;
+	s[9] = (r >> 22) & 0xF;
+	s[10] = (r >> 26) & 0xF;
+	s[11] = ((r >> 30) | (r << 2)) & 0xF;
+
+	int sh1;
+	int sh2;
+	if (seed & 1)
+	{
+		sh1 = (seed & 2) ? 4 : 5;
+		sh2 = (partition_count == 3) ? 6 : 5;
+	}
+	else
+	{
+		sh1 = (partition_count == 3) ? 6 : 5;
+		sh2 = (seed & 2) ? 4 : 5;
+	}
+	int sh3 = (seed & 0x10) ? sh1 : sh2;
+	for (int i = 0; i < 12; ++i)
+	{
+		s[i] *= s[i];
+		s[i] >>= (i < 8) ? ((i & 1) ? sh2 : sh1) : sh3;
+	}
+
+	int a = (s[0] * x + s[1] * y + s[10] * z + (int)(r >> 14)) & 0x3F;
+	int b = (s[2] * x + s[3] * y + s[11] * z + (int)(r >> 10)) & 0x3F;
+	int c = (partition_count < 3) ? 0 : (s[4] * x + s[5] * y + s[8] * z + (int)(r >> 6)) & 0x3F;
+	int d = (partition_count < 4) ? 0 : (s[6] * x + s[7] * y + s[9] * z + (int)(r >> 2)) & 0x3F;
+
+	if (a >= b && a >= c && a >= d)
+	{
+		return 0;
+	}
+	if (b >= c && b >= d)
+	{
+		return 1;
+	}
+	return (c >= d) ? 2 : 3;
+}
+
+// the texel mask of a pattern, bit i is the partition of texel i
+typedef std::vector<uint32_t> texel_mask;
+
+/**
+ * the 2 partition patterns of a footprint in seed order, with their seeds.
+ * the ones leaving a partition empty and the ones that only swap the partitions of an earlier pattern are left out.
+ */
+static std::vector<std::pair<texel_mask, int>> partition_2_patterns(const footprint& f)
+{
+	int n = f.w * f.h * f.d;
+	std::vector<std::pair<texel_mask, int>> out;
+	std::set<texel_mask> seen;
+	for (int seed = 0; seed < 1024; ++seed)
+	{
+		texel_mask m((n + 31) / 32, 0);
+		texel_mask swapped((n + 31) / 32, 0);
+		int ones = 0;
+		for (int i = 0; i < n; ++i)
+		{
+			int p = select_partition(seed, i % f.w, i / f.w % f.h, i / (f.w * f.h), 2, n < 31);
+			m[i / 32] |= (uint32_t)p << (i % 32);
+			swapped[i / 32] |= (uint32_t)(p ^ 1) << (i % 32);
+			ones += p;
+		}
+		if (ones == 0 || ones == n)
+		{
+			continue;
+		}
+		// a pattern and its swap are the same one, keyed by the one with texel 0 in partition 0
+		if (!seen.insert((m[0] & 1) ? swapped : m).second)
+		{
+			continue;
+		}
+		out.push_back(std::make_pair(m, seed));
+	}
+	return out;
+}
+
+static std::string partition_table()
+{
+	std::vector<std::string> o;
+	o.push_back(
+		"// generated by astc_table_gen.cpp, the 2 partition patterns of \"C.2.21 Partition Pattern Generation\" for every footprint.\n"
+		"// the ones leaving a partition empty and the ones that only swap the partitions of an earlier pattern are left out.\n"
+		"// a pattern takes PARTITION_2_WORDS_<W>X<H>[X<D>] consecutive words of the flat word stream of the uint4s:\n"
+		"// bit i is the partition of texel i, the top 10 bits of its last word are the partition index.\n"
+		"#ifndef ASTC_PARTITION_TABLE_HLSL\n"
+		"#define ASTC_PARTITION_TABLE_HLSL\n");
+	for (const footprint& f : footprints)
+	{
+		std::vector<std::pair<texel_mask, int>> patterns = partition_2_patterns(f);
+		int n = f.w * f.h * f.d;
+		int words = (n + 10 + 31) / 32;
+		std::vector<uint32_t> stream;
+		for (const std::pair<texel_mask, int>& p : patterns)
+		{
+			for (int k = 0; k < words; ++k)
+			{
+				uint32_t v = (k < (int)p.first.size()) ? p.first[k] : 0;
+				stream.push_back((k == words - 1) ? v | ((uint32_t)p.second << 22) : v);
+			}
+		}
+		while (stream.size() % 4)
+		{
+			stream.push_back(0);
+		}
+
+		std::string name = (f.d == 1) ? format("%dX%d", f.w, f.h) : format("%dX%dX%d", f.w, f.h, f.d);
+		std::string lower = name;
+		std::transform(lower.begin(), lower.end(), lower.begin(), ::tolower);
+		o.push_back(format("#define PARTITION_2_COUNT_%s %d", name.c_str(), (int)patterns.size()));
+		o.push_back(format("#define PARTITION_2_WORDS_%s %d", name.c_str(), words));
+		o.push_back(format("static const uint4 partition_2_%s[%d] =\n{", lower.c_str(), (int)stream.size() / 4));
+		for (size_t i = 0; i < stream.size(); i += 8)
+		{
+			std::vector<std::string> line;
+			for (size_t j = i; j < std::min(stream.size(), i + 8); j += 4)
+			{
+				line.push_back(format("uint4(0x%08X, 0x%08X, 0x%08X, 0x%08X),", stream[j], stream[j + 1], stream[j + 2], stream[j + 3]));
+			}
+			o.push_back("\t" + join(line, " "));
+		}
+		o.push_back("};\n");
+	}
+	o.push_back("#endif // ASTC_PARTITION_TABLE_HLSL");
+	return join(o, "\n") + "\n";
+}
+
+static bool write_file(const std::string& path, const std::string& text)
+{
+	FILE* f = fopen(path.c_str(), "wb");
+	if (f == nullptr)
+	{
+		printf("can't write %s\n", path.c_str());
+		return false;
+	}
+	fwrite(text.data(), 1, text.size(), f);
+	fclose(f);
+	printf("wrote %s\n", path.c_str());
+	return true;
+}
+
+int main(int argc, char** argv)
+{
+	std::string dir = (argc > 1) ? std::string(argv[1]) + "/" : std::string();
+	bool ok = write_file(dir + "ASTC_DecimationTable.hlsl", decimation_table());
+	ok = write_file(dir + "ASTC_PartitionTable.hlsl", partition_table()) && ok;
+	return ok ? 0 : -1;
+}
@@ -0,0 +1,135 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/**
+ * A fixed set of worker threads that run "parallel for" jobs.
+ * The calling thread takes part in every job, so a pool of N threads keeps N cores busy.
+ */
+class thread_pool
+{
+public:
+	explicit thread_pool(int thread_count = 0)
+		: m_task_count(0)
+		, m_next_task(0)
+		, m_busy_workers(0)
+		, m_generation(0)
+		, m_quit(false)
+	{
+		if (thread_count <= 0) {
+			thread_count = (int)std::thread::hardware_concurrency();
+		}
+		if (thread_count <= 0) {
+			thread_count = 1;
+		}
+		// the caller is the first worker
+		for (int i = 1; i < thread_count; ++i) {
+			m_workers.emplace_back(&thread_pool::worker_loop, this);
+		}
+	}
+
+	~thread_pool()
+	{
+		{
+			std::lock_guard<std::mutex> lock(m_mutex);
+			m_quit = true;
+		}
+		m_wake.notify_all();
+		for (std::thread& t : m_workers) {
+			t.join();
+		}
+	}
+
+	thread_pool(const thread_pool&) = delete;
+	thread_pool& operator=(const thread_pool&) = delete;
+
+	int size() const
+	{
+		return (int)m_workers.size() + 1;
+	}
+
+	// run task(0) ... task(task_count - 1) across all threads, returns when every task is done
+	void parallel_for(int task_count, const std::function<void(int)>& task)
+	{
+		if (task_count <= 0) {
+			return;
+		}
+
+		if (m_workers.empty() || task_count == 1) {
+			for (int i = 0; i < task_count; ++i) {
+				task(i);
+			}
+			return;
+		}
+
+		{
+			std::lock_guard<std::mutex> lock(m_mutex);
+			m_task = &task;
+			m_task_count = task_count;
+			m_next_task.store(0);
+			m_busy_workers = (int)m_workers.size();
+			++m_generation;
+		}
+		m_wake.notify_all();
+
+		run_tasks(task);
+
+		std::unique_lock<std::mutex> lock(m_mutex);
+		m_done.wait(lock, [this] { return m_busy_workers == 0; });
+		m_task = nullptr;
+	}
+
+private:
+	void run_tasks(const std::function<void(int)>& task)
+	{
+		for (;;) {
+			int i = m_next_task.fetch_add(1);
+			if (i >= m_task_count) {
+				break;
+			}
+			task(i);
+		}
+	}
+
+	void worker_loop()
+	{
+		unsigned int seen_generation = 0;
+		for (;;) {
+			const std::function<void(int)>* task = nullptr;
+			{
+				std::unique_lock<std::mutex> lock(m_mutex);
+				m_wake.wait(lock, [&] { return m_quit || m_generation != seen_generation; });
+				if (m_quit) {
+					return;
+				}
+				seen_generation = m_generation;
+				task = m_task;
+			}
+
+			run_tasks(*task);
+
+			{
+				std::lock_guard<std::mutex> lock(m_mutex);
+				--m_busy_workers;
+			}
+			m_done.notify_one();
+		}
+	}
+
+	std::vector<std::thread> m_workers;
+	std::mutex m_mutex;
+	std::condition_variable m_wake;
+	std::condition_variable m_done;
+
+	const std::function<void(int)>* m_task = nullptr;
+	int m_task_count;
+	std::atomic<int> m_next_task;
+	int m_busy_workers;
+	unsigned int m_generation;
+	bool m_quit;
+};
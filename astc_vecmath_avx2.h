@@ -0,0 +1,77 @@
+#pragma once
+
+#include <immintrin.h>
+
+/**
+ * 8-wide vector types for the block-parallel kernel, see astc_simd_kernel.h for the interface
+ * every ISA provides. Only include this from a translation unit compiled for AVX2.
+ */
+namespace astc_avx2
+{
+
+struct vfloat8
+{
+	__m256 m;
+	vfloat8() {}
+	explicit vfloat8(__m256 v) : m(v) {}
+	explicit vfloat8(float s) : m(_mm256_set1_ps(s)) {}
+};
+
+struct vint8
+{
+	__m256i m;
+	vint8() {}
+	explicit vint8(__m256i v) : m(v) {}
+	explicit vint8(int s) : m(_mm256_set1_epi32(s)) {}
+};
+
+struct vmask8
+{
+	__m256 m;
+	vmask8() {}
+	explicit vmask8(__m256 v) : m(v) {}
+};
+
+inline void store(int* p, vint8 v) { _mm256_storeu_si256((__m256i*)p, v.m); }
+
+inline vfloat8 operator+(vfloat8 a, vfloat8 b) { return vfloat8(_mm256_add_ps(a.m, b.m)); }
+inline vfloat8 operator-(vfloat8 a, vfloat8 b) { return vfloat8(_mm256_sub_ps(a.m, b.m)); }
+inline vfloat8 operator*(vfloat8 a, vfloat8 b) { return vfloat8(_mm256_mul_ps(a.m, b.m)); }
+inline vfloat8 operator/(vfloat8 a, vfloat8 b) { return vfloat8(_mm256_div_ps(a.m, b.m)); }
+
+// same operand order as the sse min/max instructions: min(a, b) == (a < b) ? a : b
+inline vfloat8 min(vfloat8 a, vfloat8 b) { return vfloat8(_mm256_min_ps(a.m, b.m)); }
+inline vfloat8 max(vfloat8 a, vfloat8 b) { return vfloat8(_mm256_max_ps(a.m, b.m)); }
+inline vfloat8 sqrt(vfloat8 a) { return vfloat8(_mm256_sqrt_ps(a.m)); }
+inline vfloat8 round_even(vfloat8 a) { return vfloat8(_mm256_round_ps(a.m, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC)); }
+
+inline vmask8 operator<(vfloat8 a, vfloat8 b) { return vmask8(_mm256_cmp_ps(a.m, b.m, _CMP_LT_OQ)); }
+inline vmask8 operator>(vfloat8 a, vfloat8 b) { return vmask8(_mm256_cmp_ps(a.m, b.m, _CMP_GT_OQ)); }
+inline vmask8 operator|(vmask8 a, vmask8 b) { return vmask8(_mm256_or_ps(a.m, b.m)); }
+
+// mask ? b : a
+inline vfloat8 select(vfloat8 a, vfloat8 b, vmask8 mask) { return vfloat8(_mm256_blendv_ps(a.m, b.m, mask.m)); }
+inline vint8 select(vint8 a, vint8 b, vmask8 mask) { return vint8(_mm256_castps_si256(_mm256_blendv_ps(_mm256_castsi256_ps(a.m), _mm256_castsi256_ps(b.m), mask.m))); }
+
+// truncating conversion, the kernel only converts values that are already integral
+inline vint8 float_to_int(vfloat8 a) { return vint8(_mm256_cvttps_epi32(a.m)); }
+
+inline vint8 operator+(vint8 a, vint8 b) { return vint8(_mm256_add_epi32(a.m, b.m)); }
+inline vint8 operator*(vint8 a, vint8 b) { return vint8(_mm256_mullo_epi32(a.m, b.m)); }
+inline vint8 operator&(vint8 a, vint8 b) { return vint8(_mm256_and_si256(a.m, b.m)); }
+inline vint8 operator|(vint8 a, vint8 b) { return vint8(_mm256_or_si256(a.m, b.m)); }
+inline vint8 shl(vint8 a, int s) { return vint8(_mm256_sll_epi32(a.m, _mm_cvtsi32_si128(s))); }
+inline vint8 shr(vint8 a, int s) { return vint8(_mm256_srl_epi32(a.m, _mm_cvtsi32_si128(s))); }
+inline vint8 min(vint8 a, vint8 b) { return vint8(_mm256_min_epi32(a.m, b.m)); }
+inline vint8 gather(const int* table, vint8 index) { return vint8(_mm256_i32gather_epi32(table, index.m, 4)); }
+
+struct simd_avx2
+{
+	static const int lanes = 8;
+	typedef vfloat8 vfloat;
+	typedef vint8 vint;
+	typedef vmask8 vmask;
+	static vfloat8 load(const float* p) { return vfloat8(_mm256_loadu_ps(p)); }
+};
+
+} // namespace astc_avx2
@@ -0,0 +1,76 @@
+#pragma once
+
+#include <immintrin.h>
+
+/**
+ * 16-wide vector types for the block-parallel kernel, see astc_simd_kernel.h for the interface
+ * every ISA provides. Only include this from a translation unit compiled for AVX-512F.
+ */
+namespace astc_avx512
+{
+
+struct vfloat16
+{
+	__m512 m;
+	vfloat16() {}
+	explicit vfloat16(__m512 v) : m(v) {}
+	explicit vfloat16(float s) : m(_mm512_set1_ps(s)) {}
+};
+
+struct vint16
+{
+	__m512i m;
+	vint16() {}
+	explicit vint16(__m512i v) : m(v) {}
+	explicit vint16(int s) : m(_mm512_set1_epi32(s)) {}
+};
+
+struct vmask16
+{
+	__mmask16 m;
+	vmask16() {}
+	explicit vmask16(__mmask16 v) : m(v) {}
+};
+
+inline void store(int* p, vint16 v) { _mm512_storeu_si512((void*)p, v.m); }
+
+inline vfloat16 operator+(vfloat16 a, vfloat16 b) { return vfloat16(_mm512_add_ps(a.m, b.m)); }
+inline vfloat16 operator-(vfloat16 a, vfloat16 b) { return vfloat16(_mm512_sub_ps(a.m, b.m)); }
+inline vfloat16 operator*(vfloat16 a, vfloat16 b) { return vfloat16(_mm512_mul_ps(a.m, b.m)); }
+inline vfloat16 operator/(vfloat16 a, vfloat16 b) { return vfloat16(_mm512_div_ps(a.m, b.m)); }
+
+// min(a, b) == (a < b) ? a : b, like the sse instructions
+inline vfloat16 min(vfloat16 a, vfloat16 b) { return vfloat16(_mm512_min_ps(a.m, b.m)); }
+inline vfloat16 max(vfloat16 a, vfloat16 b) { return vfloat16(_mm512_max_ps(a.m, b.m)); }
+inline vfloat16 sqrt(vfloat16 a) { return vfloat16(_mm512_sqrt_ps(a.m)); }
+inline vfloat16 round_even(vfloat16 a) { return vfloat16(_mm512_roundscale_ps(a.m, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC)); }
+
+inline vmask16 operator<(vfloat16 a, vfloat16 b) { return vmask16(_mm512_cmp_ps_mask(a.m, b.m, _CMP_LT_OQ)); }
+inline vmask16 operator>(vfloat16 a, vfloat16 b) { return vmask16(_mm512_cmp_ps_mask(a.m, b.m, _CMP_GT_OQ)); }
+inline vmask16 operator|(vmask16 a, vmask16 b) { return vmask16((__mmask16)(a.m | b.m)); }
+
+// mask ? b : a
+inline vfloat16 select(vfloat16 a, vfloat16 b, vmask16 mask) { return vfloat16(_mm512_mask_blend_ps(mask.m, a.m, b.m)); }
+inline vint16 select(vint16 a, vint16 b, vmask16 mask) { return vint16(_mm512_mask_blend_epi32(mask.m, a.m, b.m)); }
+
+inline vint16 float_to_int(vfloat16 a) { return vint16(_mm512_cvttps_epi32(a.m)); }
+
+inline vint16 operator+(vint16 a, vint16 b) { return vint16(_mm512_add_epi32(a.m, b.m)); }
+inline vint16 operator*(vint16 a, vint16 b) { return vint16(_mm512_mullo_epi32(a.m, b.m)); }
+inline vint16 operator&(vint16 a, vint16 b) { return vint16(_mm512_and_si512(a.m, b.m)); }
+inline vint16 operator|(vint16 a, vint16 b) { return vint16(_mm512_or_si512(a.m, b.m)); }
+inline vint16 shl(vint16 a, int s) { return vint16(_mm512_sll_epi32(a.m, _mm_cvtsi32_si128(s))); }
+inline vint16 shr(vint16 a, int s) { return vint16(_mm512_srl_epi32(a.m, _mm_cvtsi32_si128(s))); }
+inline vint16 min(vint16 a, vint16 b) { return vint16(_mm512_min_epi32(a.m, b.m)); }
+inline vint16 gather(const int* table, vint16 index) { return vint16(_mm512_i32gather_epi32(index.m, table, 4)); }
+
+struct simd_avx512
+{
+	static const int lanes = 16;
+	typedef vfloat16 vfloat;
+	typedef vint16 vint;
+	typedef vmask16 vmask;
+	static vfloat16 load(const float* p) { return vfloat16(_mm512_loadu_ps(p)); }
+};
+
+} // namespace astc_avx512
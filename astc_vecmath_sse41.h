@@ -0,0 +1,83 @@
+#pragma once
+
+#include <immintrin.h>
+
+/**
+ * 4-wide vector types for the block-parallel kernel, see astc_simd_kernel.h for the interface
+ * every ISA provides. Only include this from a translation unit compiled for SSE4.1.
+ */
+namespace astc_sse41
+{
+
+struct vfloat4
+{
+	__m128 m;
+	vfloat4() {}
+	explicit vfloat4(__m128 v) : m(v) {}
+	explicit vfloat4(float s) : m(_mm_set1_ps(s)) {}
+};
+
+struct vint4
+{
+	__m128i m;
+	vint4() {}
+	explicit vint4(__m128i v) : m(v) {}
+	explicit vint4(int s) : m(_mm_set1_epi32(s)) {}
+};
+
+struct vmask4
+{
+	__m128 m;
+	vmask4() {}
+	explicit vmask4(__m128 v) : m(v) {}
+};
+
+inline void store(int* p, vint4 v) { _mm_storeu_si128((__m128i*)p, v.m); }
+
+inline vfloat4 operator+(vfloat4 a, vfloat4 b) { return vfloat4(_mm_add_ps(a.m, b.m)); }
+inline vfloat4 operator-(vfloat4 a, vfloat4 b) { return vfloat4(_mm_sub_ps(a.m, b.m)); }
+inline vfloat4 operator*(vfloat4 a, vfloat4 b) { return vfloat4(_mm_mul_ps(a.m, b.m)); }
+inline vfloat4 operator/(vfloat4 a, vfloat4 b) { return vfloat4(_mm_div_ps(a.m, b.m)); }
+
+// min(a, b) == (a < b) ? a : b
+inline vfloat4 min(vfloat4 a, vfloat4 b) { return vfloat4(_mm_min_ps(a.m, b.m)); }
+inline vfloat4 max(vfloat4 a, vfloat4 b) { return vfloat4(_mm_max_ps(a.m, b.m)); }
+inline vfloat4 sqrt(vfloat4 a) { return vfloat4(_mm_sqrt_ps(a.m)); }
+inline vfloat4 round_even(vfloat4 a) { return vfloat4(_mm_round_ps(a.m, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC)); }
+
+inline vmask4 operator<(vfloat4 a, vfloat4 b) { return vmask4(_mm_cmplt_ps(a.m, b.m)); }
+inline vmask4 operator>(vfloat4 a, vfloat4 b) { return vmask4(_mm_cmpgt_ps(a.m, b.m)); }
+inline vmask4 operator|(vmask4 a, vmask4 b) { return vmask4(_mm_or_ps(a.m, b.m)); }
+
+// mask ? b : a
+inline vfloat4 select(vfloat4 a, vfloat4 b, vmask4 mask) { return vfloat4(_mm_blendv_ps(a.m, b.m, mask.m)); }
+inline vint4 select(vint4 a, vint4 b, vmask4 mask) { return vint4(_mm_castps_si128(_mm_blendv_ps(_mm_castsi128_ps(a.m), _mm_castsi128_ps(b.m), mask.m))); }
+
+inline vint4 float_to_int(vfloat4 a) { return vint4(_mm_cvttps_epi32(a.m)); }
+
+inline vint4 operator+(vint4 a, vint4 b) { return vint4(_mm_add_epi32(a.m, b.m)); }
+inline vint4 operator*(vint4 a, vint4 b) { return vint4(_mm_mullo_epi32(a.m, b.m)); }
+inline vint4 operator&(vint4 a, vint4 b) { return vint4(_mm_and_si128(a.m, b.m)); }
+inline vint4 operator|(vint4 a, vint4 b) { return vint4(_mm_or_si128(a.m, b.m)); }
+inline vint4 shl(vint4 a, int s) { return vint4(_mm_sll_epi32(a.m, _mm_cvtsi32_si128(s))); }
+inline vint4 shr(vint4 a, int s) { return vint4(_mm_srl_epi32(a.m, _mm_cvtsi32_si128(s))); }
+inline vint4 min(vint4 a, vint4 b) { return vint4(_mm_min_epi32(a.m, b.m)); }
+
+// no hardware gather before AVX2
+inline vint4 gather(const int* table, vint4 index)
+{
+	int idx[4];
+	_mm_storeu_si128((__m128i*)idx, index.m);
+	return vint4(_mm_set_epi32(table[idx[3]], table[idx[2]], table[idx[1]], table[idx[0]]));
+}
+
+struct simd_sse41
+{
+	static const int lanes = 4;
+	typedef vfloat4 vfloat;
+	typedef vint4 vint;
+	typedef vmask4 vmask;
+	static vfloat4 load(const float* p) { return vfloat4(_mm_loadu_ps(p)); }
+};
+
+} // namespace astc_sse41
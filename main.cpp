@@ -2,27 +2,45 @@
 #define _WIN32_WINNT 0x600
 
 #include <string>
+#include <vector>
+#include <cstdio>
+#include <cstring>
 #include <iostream>
 
+#ifdef _WIN32
 #include <d3d11.h>
 #include <d3dcompiler.h>
 #pragma comment(lib, "d3d11.lib")
 #pragma comment(lib, "d3dcompiler.lib")
+#endif
 
 #define STB_IMAGE_IMPLEMENTATION
 
 #include "stb_image.h"
 
+#ifdef _WIN32
 #include "astc_encode.h"
+#endif
+#include "astc_encoder.h"
+#include "astc_encode_simd.h"
 #include "astc_save.h"
+#ifdef ASTC_VULKAN
+#include "astc_encode_vulkan.h"
+#endif
+#ifdef ASTC_OPENCL
+#include "astc_encode_opencl.h"
+#endif
 
-ID3D11Texture2D* load_tex(ID3D11Device* pd3dDevice, const char* tex_path, bool bSRGB)
+#ifdef _WIN32
+ID3D11Texture2D* load_tex(ID3D11Device* pd3dDevice, const char* tex_path, bool bSRGB, bool bHDR)
 {
 	int xsize = 0;
 	int ysize = 0;
 	int components = 0;
 	stbi_set_flip_vertically_on_load(1);
-	stbi_uc* image = stbi_load(tex_path, &xsize, &ysize, &components, STBI_rgb_alpha);
+	// hdr textures are read as linear floats, ldr files go through stbi's gamma 2.2
+	void* image = bHDR ? (void*)stbi_loadf(tex_path, &xsize, &ysize, &components, STBI_rgb_alpha)
+		: (void*)stbi_load(tex_path, &xsize, &ysize, &components, STBI_rgb_alpha);
 	if (image == nullptr) {
 		// if we haven't returned, it's because we failed to load the file.
 		printf("Failed to load image %s\nReason: %s\n", tex_path, stbi_failure_reason());
@@ -35,7 +53,7 @@ ID3D11Texture2D* load_tex(ID3D11Device* pd3dDevice, const char* tex_path, bool b
 	TexDesc.Height = ysize;		// grid size of the waves, colums
 	TexDesc.MipLevels = 1;
 	TexDesc.ArraySize = 1;
-	TexDesc.Format = bSRGB ? DXGI_FORMAT_R8G8B8A8_UNORM_SRGB : DXGI_FORMAT_R8G8B8A8_UNORM;
+	TexDesc.Format = bHDR ? DXGI_FORMAT_R32G32B32A32_FLOAT : (bSRGB ? DXGI_FORMAT_R8G8B8A8_UNORM_SRGB : DXGI_FORMAT_R8G8B8A8_UNORM);
 	TexDesc.SampleDesc.Count = 1;
 	TexDesc.SampleDesc.Quality = 0;
 	TexDesc.Usage = D3D11_USAGE_DEFAULT;
@@ -45,8 +63,9 @@ ID3D11Texture2D* load_tex(ID3D11Device* pd3dDevice, const char* tex_path, bool b
 
 	D3D11_SUBRESOURCE_DATA InitialData;
 	InitialData.pSysMem = image;
-	InitialData.SysMemPitch = xsize * 4;
-	InitialData.SysMemSlicePitch = xsize * ysize * 4;
+	const int texel_bytes = bHDR ? 16 : 4;
+	InitialData.SysMemPitch = xsize * texel_bytes;
+	InitialData.SysMemSlicePitch = xsize * ysize * texel_bytes;
 
 	ID3D11Texture2D* pTex = nullptr;
 	pd3dDevice->CreateTexture2D(&TexDesc, &InitialData, &pTex);
@@ -117,6 +136,7 @@ HRESULT create_device_swapchain(HWND hwnd, IDXGISwapChain*& pSwapChain, ID3D11De
 	return hr;
 
 }
+#endif
 
 std::string get_file_extension(const char* file_path)
 {
@@ -137,7 +157,46 @@ void strip_file_extension(std::string &file_path)
 	}
 }
 
-bool parse_cmd(int argc, char** argv, encode_option& option)
+// the images of a -depth volume, an -array or a -cube, input_texture is then a printf pattern of their files
+struct image_set
+{
+	int depth;			// slices of a volume
+	int array_layers;	// layers of a texture array, each a cubemap with "cube"
+	bool cube;			// 6 faces, +x, -x, +y, -y, +z, -z
+
+	image_set() : depth(0), array_layers(0), cube(false) {}
+
+	bool layered() const { return array_layers > 0 || cube; }
+
+	// the files of the pattern, array layer major
+	int count() const { return depth > 0 ? depth : (array_layers > 0 ? array_layers : 1) * (cube ? 6 : 1); }
+};
+
+// "pattern" goes to snprintf as the format of the image set, it must hold exactly one integer
+// conversion, %d, %i or %u with an optional 0 flag and width such as %02d, and any number of %%
+bool is_image_pattern(const char* pattern)
+{
+	int conversions = 0;
+	for (const char* c = pattern; *c != 0; ++c) {
+		if (*c != '%') {
+			continue;
+		}
+		++c;
+		if (*c == '%') {
+			continue;
+		}
+		while (*c >= '0' && *c <= '9') {
+			++c;
+		}
+		if (*c != 'd' && *c != 'i' && *c != 'u') {
+			return false;
+		}
+		++conversions;
+	}
+	return conversions == 1;
+}
+
+bool parse_cmd(int argc, char** argv, encode_option& option, image_set& images)
 {
 	auto func_arg_value = [](int index, int argc, char** argv, bool &ret) -> bool {
 		if (index < argc && *(argv[index]) == '-') {
@@ -148,15 +207,25 @@ bool parse_cmd(int argc, char** argv, encode_option& option)
 	};
 
 	for (int i = 2; i < argc; ++i) {
-		if (argv[i] == std::string("-4x4")) {
-			if (!func_arg_value(i, argc, argv, option.is4x4)) {
+		int block_x = 0;
+		int block_y = 0;
+		int block_z = 0;
+		char tail = 0;
+		if (sscanf(argv[i], "-%dx%dx%d%c", &block_x, &block_y, &block_z, &tail) == 3) {
+			if (!is_astc_footprint(block_x, block_y, block_z)) {
 				return false;
 			}
+			option.block_x = block_x;
+			option.block_y = block_y;
+			option.block_z = block_z;
 		}
-		else if (argv[i] == std::string("-6x6")) {
-			if (!func_arg_value(i, argc, argv, option.is6x6)) {
+		else if (sscanf(argv[i], "-%dx%d%c", &block_x, &block_y, &tail) == 2) {
+			if (!is_astc_footprint(block_x, block_y)) {
 				return false;
 			}
+			option.block_x = block_x;
+			option.block_y = block_y;
+			option.block_z = 1;
 		}
 		else if (argv[i] == std::string("-norm")) {
 			if (!func_arg_value(i, argc, argv, option.is_normal_map)) {
@@ -173,10 +242,389 @@ bool parse_cmd(int argc, char** argv, encode_option& option)
 				return false;
 			}
 		}
+		else if (argv[i] == std::string("-cpu")) {
+			if (!func_arg_value(i, argc, argv, option.use_cpu)) {
+				return false;
+			}
+		}
+		else if (argv[i] == std::string("-vulkan")) {
+			if (!func_arg_value(i, argc, argv, option.use_vulkan)) {
+				return false;
+			}
+		}
+		else if (argv[i] == std::string("-opencl")) {
+			if (!func_arg_value(i, argc, argv, option.use_opencl)) {
+				return false;
+			}
+		}
+		else if (argv[i] == std::string("-hdr")) {
+			if (!func_arg_value(i, argc, argv, option.hdr)) {
+				return false;
+			}
+		}
+		else if (argv[i] == std::string("-dualplane")) {
+			if (!func_arg_value(i, argc, argv, option.dual_plane)) {
+				return false;
+			}
+		}
+		else if (argv[i] == std::string("-threads")) {
+			if (i + 1 >= argc) {
+				return false;
+			}
+			option.thread_count = atoi(argv[++i]);
+		}
+		else if (argv[i] == std::string("-depth")) {
+			if (i + 1 >= argc) {
+				return false;
+			}
+			images.depth = atoi(argv[++i]);
+			if (images.depth <= 0) {
+				return false;
+			}
+		}
+		else if (argv[i] == std::string("-array")) {
+			if (i + 1 >= argc) {
+				return false;
+			}
+			images.array_layers = atoi(argv[++i]);
+			if (images.array_layers <= 0) {
+				return false;
+			}
+		}
+		else if (argv[i] == std::string("-cube")) {
+			if (!func_arg_value(i, argc, argv, images.cube)) {
+				return false;
+			}
+		}
+		else if (argv[i] == std::string("-mips")) {
+			if (i + 1 >= argc) {
+				return false;
+			}
+			std::string filter = argv[++i];
+			if (filter == "box") {
+				option.mip_filter = MIP_FILTER_BOX;
+			}
+			else if (filter == "kaiser") {
+				option.mip_filter = MIP_FILTER_KAISER;
+			}
+			else if (filter == "lanczos") {
+				option.mip_filter = MIP_FILTER_LANCZOS;
+			}
+			else {
+				return false;
+			}
+		}
+		else if (argv[i] == std::string("-alphacoverage")) {
+			if (i + 1 >= argc) {
+				return false;
+			}
+			option.alpha_coverage = (float)atof(argv[++i]);
+			if (option.alpha_coverage <= 0.0f || option.alpha_coverage >= 1.0f) {
+				return false;
+			}
+		}
+		else if (argv[i] == std::string("-effort")) {
+			if (i + 1 >= argc) {
+				return false;
+			}
+			option.effort = atoi(argv[++i]);
+			if (option.effort < 0) {
+				return false;
+			}
+		}
+		else if (argv[i] == std::string("-voidextent")) {
+			if (i + 1 >= argc) {
+				return false;
+			}
+			option.void_extent_tolerance = atoi(argv[++i]);
+			if (option.void_extent_tolerance < 0 || option.void_extent_tolerance > 255) {
+				return false;
+			}
+		}
+		else if (argv[i] == std::string("-rdo")) {
+			if (i + 1 >= argc) {
+				return false;
+			}
+			// 0 is off, as when -rdo is not given
+			option.rdo_lambda = (float)atof(argv[++i]);
+			if (option.rdo_lambda < 0.0f) {
+				return false;
+			}
+		}
+		else if (argv[i] == std::string("-rdowindow")) {
+			if (i + 1 >= argc) {
+				return false;
+			}
+			option.rdo_window = atoi(argv[++i]);
+			if (option.rdo_window < 1 || option.rdo_window > RDO_MAX_WINDOW) {
+				return false;
+			}
+		}
+		else if (argv[i] == std::string("-isa")) {
+			if (i + 1 >= argc) {
+				return false;
+			}
+			std::string isa = argv[++i];
+			if (isa == "scalar") {
+				option.max_simd_isa = SIMD_ISA_SCALAR;
+			}
+			else if (isa == "sse41") {
+				option.max_simd_isa = SIMD_ISA_SSE41;
+			}
+			else if (isa == "avx2") {
+				option.max_simd_isa = SIMD_ISA_AVX2;
+			}
+			else if (isa == "avx512") {
+				option.max_simd_isa = SIMD_ISA_AVX512;
+			}
+			else {
+				return false;
+			}
+		}
+	}
+
+	if ((images.depth > 0 || images.layered()) && !is_image_pattern(argv[1])) {
+		return false;
+	}
+
+	return true;
+}
+
+int encode_with_cpu(const std::string& src_tex, const std::string& dst_tex, const encode_option& option)
+{
+	int xsize = 0;
+	int ysize = 0;
+	int components = 0;
+	stbi_set_flip_vertically_on_load(1);
+	// hdr textures are read as linear floats, ldr files go through stbi's gamma 2.2
+	void* image = option.hdr ? (void*)stbi_loadf(src_tex.c_str(), &xsize, &ysize, &components, STBI_rgb_alpha)
+		: (void*)stbi_load(src_tex.c_str(), &xsize, &ysize, &components, STBI_rgb_alpha);
+	if (image == nullptr) {
+		std::cout << "load source texture failed! [" << src_tex << "] " << stbi_failure_reason() << std::endl;
+		return -1;
+	}
+
+	astc_encoder encoder(option);
+	if (option.mip_filter != MIP_FILTER_NONE) {
+		// every level in one job and one .ktx file
+		std::vector<uint8_t> mip_buf(encoder.mipmap_output_size(xsize, ysize));
+		bool ok = option.hdr ? encoder.encode_mipmaps((const float*)image, xsize, ysize, xsize * 16, mip_buf.data(), mip_buf.size())
+			: encoder.encode_mipmaps((const uint8_t*)image, xsize, ysize, xsize * 4, mip_buf.data(), mip_buf.size());
+		stbi_image_free(image);
+		if (!ok) {
+			std::cout << "encode astc failed!" << std::endl;
+			return -1;
+		}
+
+		std::string ktx_tex = dst_tex.substr(0, dst_tex.size() - strlen(".astc")) + ".ktx";
+		save_ktx(ktx_tex.c_str(), option.block_x, option.block_y, xsize, ysize, encoder.mip_levels(xsize, ysize), 0, 1, mip_buf.data(), mip_buf.size());
+
+		std::cout << "save " << encoder.mip_levels(xsize, ysize) << " mip levels to:" << ktx_tex << std::endl;
+
+		return 0;
+	}
+
+	std::vector<uint8_t> astc_buf(encoder.output_size(xsize, ysize));
+	bool ok = option.hdr ? encoder.encode((const float*)image, xsize, ysize, xsize * 16, astc_buf.data(), astc_buf.size())
+		: encoder.encode((const uint8_t*)image, xsize, ysize, xsize * 4, astc_buf.data(), astc_buf.size());
+	stbi_image_free(image);
+	if (!ok) {
+		std::cout << "encode astc failed!" << std::endl;
+		return -1;
+	}
+
+	save_astc(dst_tex.c_str(), option.block_x, option.block_y, option.block_z, xsize, ysize, 1, astc_buf.data(), (int)astc_buf.size());
+
+	std::cout << "save astc to:" << dst_tex << std::endl;
+
+	return 0;
+}
+
+// the "count" images named by the printf pattern "src_pattern", numbered from 0, all of one size.
+// "images" gets the stbi buffers of the ones loaded, even when a later one fails
+bool load_image_set(const std::string& src_pattern, int count, const encode_option& option, int& xsize, int& ysize, std::vector<void*>& images)
+{
+	images.assign(count, nullptr);
+	stbi_set_flip_vertically_on_load(1);
+	for (int i = 0; i < count; ++i) {
+		char image_path[1024];
+		snprintf(image_path, sizeof(image_path), src_pattern.c_str(), i);
+		int w = 0;
+		int h = 0;
+		int components = 0;
+		images[i] = option.hdr ? (void*)stbi_loadf(image_path, &w, &h, &components, STBI_rgb_alpha)
+			: (void*)stbi_load(image_path, &w, &h, &components, STBI_rgb_alpha);
+		if (images[i] == nullptr) {
+			std::cout << "load source texture failed! [" << image_path << "] " << stbi_failure_reason() << std::endl;
+			return false;
+		}
+		if (i == 0) {
+			xsize = w;
+			ysize = h;
+		}
+		else if (w != xsize || h != ysize) {
+			std::cout << "image size differs from image 0! [" << image_path << "]" << std::endl;
+			return false;
+		}
 	}
 	return true;
 }
 
+// "depth" slices named by the printf pattern "src_pattern", slice 0 first, encoded as one volume
+int encode_volume_with_cpu(const std::string& src_pattern, const std::string& dst_tex, int depth, const encode_option& option)
+{
+	int xsize = 0;
+	int ysize = 0;
+	std::vector<void*> slices;
+	bool loaded = load_image_set(src_pattern, depth, option, xsize, ysize, slices);
+
+	bool ok = false;
+	astc_encoder encoder(option);
+	std::vector<uint8_t> astc_buf;
+	if (loaded) {
+		astc_buf.resize(encoder.output_size(xsize, ysize, depth));
+		ok = option.hdr ? encoder.encode((const float* const*)slices.data(), xsize, ysize, depth, xsize * 16, astc_buf.data(), astc_buf.size())
+			: encoder.encode((const uint8_t* const*)slices.data(), xsize, ysize, depth, xsize * 4, astc_buf.data(), astc_buf.size());
+		if (!ok) {
+			std::cout << "encode astc failed!" << std::endl;
+		}
+	}
+	for (void* slice : slices) {
+		stbi_image_free(slice);
+	}
+	if (!ok) {
+		return -1;
+	}
+
+	save_astc(dst_tex.c_str(), option.block_x, option.block_y, option.block_z, xsize, ysize, depth, astc_buf.data(), (int)astc_buf.size());
+
+	std::cout << "save astc to:" << dst_tex << std::endl;
+
+	return 0;
+}
+
+// the layers of an array and/or the faces of a cubemap named by "src_pattern", encoded in one job into one .ktx file
+int encode_layers_with_cpu(const std::string& src_pattern, const std::string& dst_tex, const image_set& set, const encode_option& option)
+{
+	int xsize = 0;
+	int ysize = 0;
+	std::vector<void*> layers;
+	bool loaded = load_image_set(src_pattern, set.count(), option, xsize, ysize, layers);
+	if (loaded && set.cube && xsize != ysize) {
+		std::cout << "the faces of a cubemap must be square!" << std::endl;
+		loaded = false;
+	}
+
+	bool ok = false;
+	astc_encoder encoder(option);
+	std::vector<uint8_t> astc_buf;
+	if (loaded) {
+		astc_buf.resize(encoder.layers_output_size(xsize, ysize, set.count()));
+		ok = option.hdr ? encoder.encode_layers((const float* const*)layers.data(), xsize, ysize, set.count(), xsize * 16, astc_buf.data(), astc_buf.size())
+			: encoder.encode_layers((const uint8_t* const*)layers.data(), xsize, ysize, set.count(), xsize * 4, astc_buf.data(), astc_buf.size());
+		if (!ok) {
+			std::cout << "encode astc failed!" << std::endl;
+		}
+	}
+	for (void* layer : layers) {
+		stbi_image_free(layer);
+	}
+	if (!ok) {
+		return -1;
+	}
+
+	std::string ktx_tex = dst_tex.substr(0, dst_tex.size() - strlen(".astc")) + ".ktx";
+	save_ktx(ktx_tex.c_str(), option.block_x, option.block_y, xsize, ysize, encoder.mip_levels(xsize, ysize), set.array_layers, set.cube ? 6 : 1, astc_buf.data(), astc_buf.size());
+
+	std::cout << "save " << set.count() << " images of " << encoder.mip_levels(xsize, ysize) << " mip levels to:" << ktx_tex << std::endl;
+
+	return 0;
+}
+
+#ifdef ASTC_VULKAN
+int encode_with_vulkan(const std::string& src_tex, const std::string& dst_tex, const encode_option& option)
+{
+	int xsize = 0;
+	int ysize = 0;
+	int components = 0;
+	stbi_set_flip_vertically_on_load(1);
+	stbi_uc* image = stbi_load(src_tex.c_str(), &xsize, &ysize, &components, STBI_rgb_alpha);
+	if (image == nullptr) {
+		std::cout << "load source texture failed! [" << src_tex << "] " << stbi_failure_reason() << std::endl;
+		return -1;
+	}
+
+	vulkan_context ctx;
+	VkResult res = create_vulkan_context(ctx);
+	if (res != VK_SUCCESS) {
+		std::cout << "init vulkan failed! " << res << std::endl;
+		stbi_image_free(image);
+		return -1;
+	}
+	std::cout << "vulkan device\t" << vulkan_device_name(ctx) << std::endl;
+
+	int xBlockNum = (xsize + option.block_x - 1) / option.block_x;
+	int yBlockNum = (ysize + option.block_y - 1) / option.block_y;
+	std::vector<uint8_t> astc_buf((size_t)xBlockNum * yBlockNum * BLOCK_BYTES);
+
+	bool ok = encode_astc_vulkan(ctx, image, xsize, ysize, xsize * 4, option, astc_buf.data());
+	stbi_image_free(image);
+	destroy_vulkan_context(ctx);
+	if (!ok) {
+		std::cout << "encode astc failed!" << std::endl;
+		return -1;
+	}
+
+	save_astc(dst_tex.c_str(), option.block_x, option.block_y, 1, xsize, ysize, 1, astc_buf.data(), (int)astc_buf.size());
+
+	std::cout << "save astc to:" << dst_tex << std::endl;
+
+	return 0;
+}
+#endif
+
+#ifdef ASTC_OPENCL
+int encode_with_opencl(const std::string& src_tex, const std::string& dst_tex, const encode_option& option)
+{
+	int xsize = 0;
+	int ysize = 0;
+	int components = 0;
+	stbi_set_flip_vertically_on_load(1);
+	stbi_uc* image = stbi_load(src_tex.c_str(), &xsize, &ysize, &components, STBI_rgb_alpha);
+	if (image == nullptr) {
+		std::cout << "load source texture failed! [" << src_tex << "] " << stbi_failure_reason() << std::endl;
+		return -1;
+	}
+
+	opencl_context ctx;
+	cl_int err = create_opencl_context(ctx);
+	if (err != CL_SUCCESS) {
+		std::cout << "init opencl failed! " << err << std::endl;
+		stbi_image_free(image);
+		return -1;
+	}
+	std::cout << "opencl device\t" << opencl_device_name(ctx) << std::endl;
+
+	int xBlockNum = (xsize + option.block_x - 1) / option.block_x;
+	int yBlockNum = (ysize + option.block_y - 1) / option.block_y;
+	std::vector<uint8_t> astc_buf((size_t)xBlockNum * yBlockNum * BLOCK_BYTES);
+
+	bool ok = encode_astc_opencl(ctx, image, xsize, ysize, xsize * 4, option, astc_buf.data());
+	stbi_image_free(image);
+	destroy_opencl_context(ctx);
+	if (!ok) {
+		std::cout << "encode astc failed!" << std::endl;
+		return -1;
+	}
+
+	save_astc(dst_tex.c_str(), option.block_x, option.block_y, 1, xsize, ysize, 1, astc_buf.data(), (int)astc_buf.size());
+
+	std::cout << "save astc to:" << dst_tex << std::endl;
+
+	return 0;
+}
+#endif
+
 int main(int argc, char** argv)
 {
 	if (argc < 2) {
@@ -185,17 +633,119 @@ int main(int argc, char** argv)
 	}
 
 	encode_option option;
-	if (!parse_cmd(argc, argv, option)) {
+	image_set images;
+	if (!parse_cmd(argc, argv, option, images)) {
 		std::cout << "wrong args options" << std::endl;
 		return -1;
 	}
 
+	static const char* mip_filter_names[] = { "none", "box", "kaiser", "lanczos" };
 	std::cout << "encode option setting:\n"
 		<< "has_alpha\t" << std::boolalpha << option.has_alpha << std::endl
-		<< "is 4x4 block\t" << option.is4x4 << std::endl
+		<< "block size\t" << option.block_x << "x" << option.block_y;
+	if (option.block_z != 1) {
+		std::cout << "x" << option.block_z;
+	}
+	std::cout << std::endl
 		<< "normal map\t" << option.is_normal_map << std::endl
-		<< "encode in gamma color space\t" << option.srgb << std::endl;
+		<< "encode in gamma color space\t" << option.srgb << std::endl
+		<< "encode on cpu\t" << option.use_cpu << std::endl
+		<< "encode on vulkan\t" << option.use_vulkan << std::endl
+		<< "encode on opencl\t" << option.use_opencl << std::endl
+		<< "effort\t" << option.effort << std::endl
+		<< "dual plane\t" << option.dual_plane << std::endl
+		<< "void extent tolerance\t" << option.void_extent_tolerance << std::endl
+		<< "hdr\t" << option.hdr << std::endl
+		<< "mip filter\t" << mip_filter_names[option.mip_filter] << std::endl
+		<< "alpha coverage\t" << option.alpha_coverage << std::endl
+		<< "rdo lambda\t" << option.rdo_lambda << std::endl
+		<< "rdo window\t" << option.rdo_window << std::endl;
+
+	if (option.use_cpu && !option.use_vulkan && !option.use_opencl) {
+		simd_isa max_isa = option.fast_blockmode() ? option.max_simd_isa : SIMD_ISA_SCALAR;
+		std::cout << "simd kernel\t" << simd_isa_name(select_simd_kernel(max_isa).isa) << std::endl;
+	}
 
+	std::string src_tex = argv[1];
+
+	std::string dst_tex(src_tex);
+	strip_file_extension(dst_tex);
+	if (images.depth > 0 || images.layered()) {
+		// "vol_%02d.png" saves to "vol.astc", "sky_%d.png" of a -cube to "sky.ktx"
+		dst_tex = dst_tex.substr(0, dst_tex.find('%'));
+		while (!dst_tex.empty() && strchr("_-.", dst_tex.back()) != nullptr) {
+			dst_tex.pop_back();
+		}
+		if (dst_tex.empty()) {
+			dst_tex = images.layered() ? "layers" : "volume";
+		}
+	}
+	dst_tex += ".astc";
+
+	if ((option.block_z != 1 || images.depth > 0) && (option.use_vulkan || option.use_opencl || !option.use_cpu)) {
+		std::cout << "3d footprints and -depth volumes are encoded on the cpu only, use -cpu" << std::endl;
+		return -1;
+	}
+
+	if (images.layered() && (images.depth > 0 || option.block_z != 1 || option.use_vulkan || option.use_opencl || !option.use_cpu)) {
+		std::cout << "-array and -cube are encoded on the cpu only, with a 2d footprint and without -depth, use -cpu" << std::endl;
+		return -1;
+	}
+
+	if (option.mip_filter != MIP_FILTER_NONE && (option.block_z != 1 || option.use_vulkan || option.use_opencl || !option.use_cpu)) {
+		std::cout << "-mips is encoded on the cpu only and with a 2d footprint, use -cpu" << std::endl;
+		return -1;
+	}
+
+	if (images.depth > 0 && option.block_z == 1) {
+		std::cout << "-depth needs a 3d footprint such as -4x4x4" << std::endl;
+		return -1;
+	}
+
+	if (option.rdo_lambda > 0.0f && (option.hdr || option.block_z != 1 || option.use_vulkan || option.use_opencl || !option.use_cpu)) {
+		std::cout << "-rdo only runs on the cpu backend (-cpu) and only on 2d ldr blocks, not with -hdr or a 3d footprint" << std::endl;
+		return -1;
+	}
+
+	if (option.hdr && (option.use_vulkan || option.use_opencl)) {
+		std::cout << "the vulkan and opencl backends are ldr only, use -cpu or d3d11 for -hdr" << std::endl;
+		return -1;
+	}
+
+	if (option.use_opencl && (option.effort > 0 || option.dual_plane)) {
+		std::cout << "the opencl port only has the fast blockmode, use -cpu, -vulkan or d3d11 for -effort and -dualplane" << std::endl;
+		return -1;
+	}
+
+	if (option.use_vulkan) {
+#ifdef ASTC_VULKAN
+		return encode_with_vulkan(src_tex, dst_tex, option);
+#else
+		std::cout << "built without vulkan, rebuild with ASTC_VULKAN defined" << std::endl;
+		return -1;
+#endif
+	}
+
+	if (option.use_opencl) {
+#ifdef ASTC_OPENCL
+		return encode_with_opencl(src_tex, dst_tex, option);
+#else
+		std::cout << "built without opencl, rebuild with ASTC_OPENCL defined" << std::endl;
+		return -1;
+#endif
+	}
+
+	if (option.use_cpu) {
+		if (images.depth > 0) {
+			return encode_volume_with_cpu(src_tex, dst_tex, images.depth, option);
+		}
+		if (images.layered()) {
+			return encode_layers_with_cpu(src_tex, dst_tex, images, option);
+		}
+		return encode_with_cpu(src_tex, dst_tex, option);
+	}
+
+#ifdef _WIN32
 	HWND hwnd = ::GetDesktopWindow();
 
 	// setting up device
@@ -208,10 +758,8 @@ int main(int argc, char** argv)
 		return hr;
 	}
 
-	std::string src_tex = argv[1];
-
 	// shader resource view
-	ID3D11Texture2D* pSrcTexture = load_tex(pd3dDevice, src_tex.c_str(), option.srgb && (!option.is_normal_map));
+	ID3D11Texture2D* pSrcTexture = load_tex(pd3dDevice, src_tex.c_str(), option.srgb && (!option.is_normal_map), option.hdr);
 	if (pSrcTexture == nullptr) {
 		std::cout << "load source texture failed! [" << src_tex << "]" << std::endl;
 		return -1;
@@ -241,12 +789,7 @@ int main(int argc, char** argv)
 		return -1;
 	}
 
-	std::string dst_tex(src_tex);
-	strip_file_extension(dst_tex);
-	dst_tex += ".astc";
-
-	int DimSize = option.is4x4 ? 4 : 6;
-	save_astc(dst_tex.c_str(), DimSize, DimSize, TexDesc.Width, TexDesc.Height, pMemBuf, bufLen);
+	save_astc(dst_tex.c_str(), option.block_x, option.block_y, 1, TexDesc.Width, TexDesc.Height, 1, pMemBuf, bufLen);
 
 	delete[] pMemBuf;
 	pMemBuf = nullptr;
@@ -254,6 +797,10 @@ int main(int argc, char** argv)
 	std::cout << "save astc to:" << dst_tex << std::endl;
 
 	return 0;
+#else
+	std::cout << "d3d11 is not available on this platform, use -cpu" << std::endl;
+	return -1;
+#endif
 
 }
 